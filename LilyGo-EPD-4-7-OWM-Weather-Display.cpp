@@ -6,6 +6,7 @@
 #include "esp_task_wdt.h"      // In-built
 #include "freertos/FreeRTOS.h" // In-built
 #include "freertos/task.h"     // In-built
+#include "esp_timer.h"         // In-built
 #include "epd_driver.h"        // https://github.com/Xinyuan-LilyGO/LilyGo-EPD47
 #include "esp_adc_cal.h"       // In-built
 #include "driver/uart.h"       // In-built
@@ -34,6 +35,23 @@
 #include "web.h"
 #include "LilyGo-EPD-4-7-OWM-Weather-Display.h"
 #include "drawingFunctions.h"
+#include "layers.h"
+#include "frameDiff.h"
+#include "renderProfiler.h"
+#include "allocCounter.h"
+#include "doubleBuffer.h"
+#include "graph.h"
+#include "displayList.h"
+#include "grayImage.h"
+#include "frameSnapshot.h"
+#include "fastUpdate.h"
+#include "fontPack.h"
+#include "textFormat.h"
+#include "wakeArena.h"
+#include "soakTest.h"
+#include "timeFormat.h"
+#include "astronomy.h"
+#include "moon_sprites.h"
 
 #if T5_47_PLUS_V2
 #define USR_BUTTON GPIO_NUM_21
@@ -59,7 +77,8 @@ String version = "2.5 / 4.7in"; // Programme version, see change log at end
 String Time_str = "--:--:--";
 String Date_str = "-- --- ----";
 
-#define max_readings 8 // (was 24) Limited to 3-days here, but could go to 5-days = 40
+#define max_readings 40  // 5 days of 3-hourly forecast slots for the graphs
+#define forecast_boxes 8 // Slots shown as forecast boxes on screen 0
 
 volatile int screenState = 0; // default screen state
 
@@ -89,18 +108,16 @@ SemaphoreHandle_t sensorDataReadySem;
 SemaphoreHandle_t dataProcessedSem;
 SemaphoreHandle_t historyCalcMutex;
 SemaphoreHandle_t i2cMutex;
+SemaphoreHandle_t renderMutex; // Screen functions share font and raster target state, one renderer at a time
+SemaphoreHandle_t panelMutex;  // Weather updates and button presses both push frames to the panel
+SemaphoreHandle_t dataMutex;   // Weather, time and astronomy data: written by WeatherUpdateCycle, read by every compose
+RenderedFrame shownFrame;      // Double buffering: frame owned by the panel task between DisplayWeather and epd_update
+bool shownFrameTaken = false;
 
 // Queue handles
 QueueHandle_t sensorDataQueue;
 QueueHandle_t processedDataQueue;
 
-// Define structure for sensor data
-typedef struct {
-    float temperature;
-    float humidity;
-    float pressure;
-} UntaggedSensorData;
-
 typedef enum {
     SENSOR_NONE = 0,
     SENSOR_BME280,
@@ -119,10 +136,15 @@ int historyIndex = 0;
 int numReadings = 0;
 UntaggedSensorData readingHistory[3] = {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}};
 UntaggedSensorData processedResult;
+bool roomReadingsValid = false; // Set by ReceiveRoomReadings() once per frame
 
 
 bool wakeInterruptFlag = false;
 
+// Moon phase only changes daily, taken from the astronomy cache and kept over sleep
+RTC_DATA_ATTR int moonSpriteIndex = 0;     // 0..MOON_SPRITE_PHASES-1
+RTC_DATA_ATTR int moonPhaseNameIndex = 0;  // 0..7, see MoonPhaseName()
+
 //################ ISR ##################################################
 
 // Button interrupt handler
@@ -147,9 +169,18 @@ void IRAM_ATTR handleButtonPress()
 void InitialiseDisplay()
 {
     epd_init();
+    if (framebuffer)
+        return; // Light sleep wake: PSRAM kept the last frame, it still matches the panel
+#if STRIP_RENDERING
+    framebuffer = NULL;
+#else
     framebuffer = (uint8_t *)ps_calloc(sizeof(uint8_t), EPD_WIDTH * EPD_HEIGHT / 2);
+#endif
     if (!framebuffer)
-        Serial.println("Memory alloc failed!");
+    {
+        ESP_LOGW("DISPLAY", "No framebuffer, using strip rendering (%d rows per band)", STRIP_HEIGHT);
+        return;
+    }
     memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
 }
 
@@ -173,7 +204,20 @@ void InitialiseSystem()
 void InitiateSleep()
 {
     epd_poweroff_all();
+    if (WEB_DEBUG_SERVER && WiFi.status() == WL_CONNECTED)
+        vTaskDelay(pdMS_TO_TICKS(WEB_DEBUG_WINDOW_MS)); // Leaves time to fetch /profile before the server sleeps too
+    xSemaphoreTake(dataMutex, portMAX_DELAY); // The render task may still be composing the next screen
     UpdateLocalTime();
+    xSemaphoreGive(dataMutex);
+    LogHeapFragmentation("Before arena reset");
+    ArenaReset(); // Everything allocated for this wake cycle is dropped at once
+    LogHeapFragmentation("After arena reset");
+#if SOAK_TEST
+    SoakSample();
+    SoakAdvanceClock(SleepDuration); // Stands in for the sleep, the next cycle starts straight away
+    vTaskDelay(pdMS_TO_TICKS(SOAK_CYCLE_MS));
+    return;
+#endif
 
     // If SleepHoursEnabled and it's past SleepHour or before WakeupHour, sleep until defined WakeupHour
     if (SleepHoursEnabled == true && (CurrentHour >= SleepHour || CurrentHour < WakeupHour))
@@ -222,8 +266,19 @@ boolean SetTime()
     configTime(gmtOffset_sec, daylightOffset_sec, const_cast<const char *>(ntpServer.c_str()), "time.nist.gov"); //(gmtOffset_sec, daylightOffset_sec, ntpServer)
     setenv("TZ", const_cast<const char *>(Timezone.c_str()), 1);                                                 //setenv()adds the "TZ" variable to the environment with a value TimeZone, only used if set to 1, 0 means no change
     tzset();                                                                   // Set the TZ environment variable
+    TimeZoneSet(Timezone.c_str());                                             // Keeps the cached offsets unless the zone changed
     delay(100);
-    return UpdateLocalTime();
+    if (!UpdateLocalTime())
+        return false;
+#if TIME_BENCHMARK
+    static bool benchmarked = false;
+    if (!benchmarked)
+    {
+        benchmarked = true;
+        BenchmarkTimeFormat();
+    }
+#endif
+    return true;
 }
 
 uint8_t StartWiFi()
@@ -259,10 +314,10 @@ void StopWiFi()
     Serial.println("WiFi switched Off");
 }
 
-bool DecodeWeather(WiFiClient &json, String Type)
+bool DecodeWeather(Stream &json, const String &Type)
 {
     Serial.print(F("\nCreating object...and "));
-    DynamicJsonDocument doc(64 * 1024);                      // allocate the JsonDocument
+    BasicJsonDocument<ArenaAllocator> doc(64 * 1024);        // allocate the JsonDocument in the per-wake arena
     DeserializationError error = deserializeJson(doc, json); // Deserialize the JSON document
     if (error)
     { // Test if parsing succeeds.
@@ -276,8 +331,8 @@ bool DecodeWeather(WiFiClient &json, String Type)
     if (Type == "weather")
     {
         // All Serial.println statements are for diagnostic purposes and some are not required, remove if not needed with //
-        //WxConditions[0].lon         = root["coord"]["lon"].as<float>();              Serial.println(" Lon: " + String(WxConditions[0].lon));
-        //WxConditions[0].lat         = root["coord"]["lat"].as<float>();              Serial.println(" Lat: " + String(WxConditions[0].lat));
+        WxConditions[0].lon         = root["coord"]["lon"].as<float>();              Serial.println(" Lon: " + String(WxConditions[0].lon));
+        WxConditions[0].lat         = root["coord"]["lat"].as<float>();              Serial.println(" Lat: " + String(WxConditions[0].lat));
         WxConditions[0].Main0 = root["weather"][0]["main"].as<const char *>();
         Serial.println("Main: " + String(WxConditions[0].Main0));
         WxConditions[0].Forecast0 = root["weather"][0]["description"].as<const char *>();
@@ -370,14 +425,17 @@ bool DecodeWeather(WiFiClient &json, String Type)
 
 bool obtainWeatherData(WiFiClient &client, const String &RequestType)
 {
-    const String units = (Units == "M" ? "metric" : "imperial");
     client.stop(); // close connection before sending a new request
     HTTPClient http;
-    String uri = "/data/2.5/" + RequestType + "?q=" + City + "," + Country + "&APPID=" + apikey + "&mode=json&units=" + units + "&lang=" + Language;
+    const size_t uriSize = 256;
+    char uriScratch[uriSize];
+    char *uri = (char *)ArenaAlloc(uriSize); // Per-wake scratch, the stack buffer only if the arena is unavailable
+    if (!uri)
+        uri = uriScratch;
+    int length = formatText(uri, uriSize, "/data/2.5/%s?q=%s,%s&APPID=%s&mode=json&units=%s&lang=%s", RequestType.c_str(), City.c_str(),
+                            Country.c_str(), apikey.c_str(), Units == "M" ? "metric" : "imperial", LanguageCode());
     if (RequestType != "weather")
-    {
-        uri += "&cnt=" + String(max_readings);
-    }
+        formatText(uri + length, uriSize - length, "&cnt=%d", max_readings);
     http.begin(client, server, 80, uri); //http.begin(uri,test_root_ca); //HTTPS example connection
     int httpCode = http.GET();
     if (httpCode == HTTP_CODE_OK)
@@ -399,26 +457,28 @@ bool obtainWeatherData(WiFiClient &client, const String &RequestType)
     return true;
 }
 
-float SumOfPrecip(float DataArray[], int readings)
+// Stand-in for obtainWeatherData() in the soak test and the host build, the response comes from a SPIFFS fixture
+bool obtainFixtureData(const char *path, const String &RequestType)
 {
-    float sum = 0;
-    for (int i = 0; i <= readings; i++)
+    File fixture = SPIFFS.open(path, FILE_READ);
+    if (!fixture)
     {
-        sum += DataArray[i];
+        ESP_LOGE("SOAK", "Fixture %s missing, upload data/soak with uploadfs", path);
+        return false;
     }
-    return sum;
+    bool decoded = DecodeWeather(fixture, RequestType);
+    fixture.close();
+    return decoded;
 }
 
-String TitleCase(String text)
+float SumOfPrecip(float DataArray[], int readings)
 {
-    if (text.length() > 0)
+    float sum = 0;
+    for (int i = 0; i < readings; i++)
     {
-        String temp_text = text.substring(0, 1);
-        temp_text.toUpperCase();
-        return temp_text + text.substring(1); // Title-case the string
+        sum += DataArray[i];
     }
-    else
-        return text;
+    return sum;
 }
 
 void DisplayWeather_Screen0()
@@ -436,10 +496,19 @@ void DisplayWeather_Screen0()
     DisplayForecastSection(0, 370);    // 3hr forecast boxes (was 320x220)
 }
 
+// Static content of screen 0, drawn once into the cached background layer
+void DisplayWeather_Screen0_Background()
+{
+    DrawCompassRose(130, 140, 100);
+    DrawSensorReadingsFrame(490, 65);
+    DrawForecastFrame(0, 370);
+}
+
 void DisplayWeather_Screen1()
 {   // 4.7" e-paper display is 960x540 resolution
     DisplayStatusSection(600, 20, wifi_signal); // Wi-Fi signal strength and Battery voltage
     DisplayGeneralInfoSection();                // Top line of the display
+    DisplayGraphSection(80, 110);               // Pressure, temperature, humidity and precipitation for 5 days
 }
 
 void DisplayWeather_Screen2()
@@ -449,26 +518,216 @@ void DisplayWeather_Screen2()
     DisplayWeatherIcon(383, 290);                // Display weather icon    scale = Large
 }
 
-// Array of function pointers to select different screens for display
+// Timed draws into buffer, the current raster target; the frame composed next is drawn over them
+void RunDrawBenchmarks(const uint8_t *buffer)
+{
+#if ICON_BENCHMARK
+    BenchmarkIcons();
+#endif
+#if IMAGE_BENCHMARK
+    BenchmarkGrayImage();
+#endif
+#if TEXT_BENCHMARK
+    BenchmarkText(&OpenSans12B);
+    BenchmarkFontEncodings(&OpenSans24B);
+#endif
+#if DISPLAY_LIST && (ICON_BENCHMARK || IMAGE_BENCHMARK || TEXT_BENCHMARK)
+    InvalidateDisplayList(buffer); // Only a full redraw covers what the benchmarks left
+#endif
+}
+
+// Array of function pointers to select different screens for display, with their static backgrounds (NULL if none)
 void (*screens[])() = {DisplayWeather_Screen0, DisplayWeather_Screen1, DisplayWeather_Screen2};
+void (*screenBackgrounds[])() = {DisplayWeather_Screen0_Background, NULL, NULL};
 void DisplayWeather(volatile int &screenState) 
 {
-    if ((screenState >= 0) && (screenState < (sizeof(screens) / sizeof(screens[0])))) {
-        screens[screenState]();
-        ESP_LOGI("DISPLAY", "Displaying screen nr: %d", screenState);
+#if RASTER_STATS
+    rasterResetStats();
+#endif
+    unsigned long renderStart = micros();
+    int screen = screenState;
+    if ((screen >= 0) && (screen < (sizeof(screens) / sizeof(screens[0])))) {
+        ESP_LOGI("DISPLAY", "Displaying screen nr: %d", screen);
     } else {
-        ESP_LOGW("DISPLAY", "Invalid screen state: %d. Defaulting to Screen 0.", screenState);
-        screens[0]();
+        ESP_LOGW("DISPLAY", "Invalid screen state: %d. Defaulting to Screen 0.", screen);
+        screen = 0;
+    }
+    if (RenderTaskRunning())
+    {   // Composed on the render core; while epd_update() pushes it, the next screen is pre-rendered
+        NewRenderGeneration();
+        RequestFrame(screen);
+        shownFrameTaken = TakeFrame(screen, &shownFrame, pdMS_TO_TICKS(10000));
+        if (shownFrameTaken)
+        {
+            framebuffer = shownFrame.buffer;
+            RequestFrame((screen + 1) % ScreenCount()); // Next screen of the button cycle
+            ESP_LOGI("DISPLAY", "Screen composed in %lld us", shownFrame.renderEnd - shownFrame.renderStart);
+        }
+        else
+            ESP_LOGE("DISPLAY", "Render task did not deliver screen %d", screen);
+        return;
+    }
+    xSemaphoreTake(renderMutex, portMAX_DELAY);
+    xSemaphoreTake(dataMutex, portMAX_DELAY);
+    ProfileBeginFrame();
+    AllocCountBegin();
+    BeginFastRegions(screen);
+    if (framebuffer)
+    {
+        RunDrawBenchmarks(framebuffer);
+#if DISPLAY_LIST
+        if (!RedrawChangedRegions(screen, framebuffer))
+#endif
+        {
+            BeginFrame(framebuffer, screen, Language, screenBackgrounds[screen]); // Cached static layer instead of a blank frame
+            screens[screen]();
+        }
+    }
+    else
+    {   // Bands are pushed to the panel as they are drawn, epd_update() has nothing left to do
+#if STRIP_BENCHMARK
+        BenchmarkStripHeights(screenBackgrounds[screen], screens[screen]);
+        renderStart = micros();
+#endif
+#if DISPLAY_LIST
+        if (RecordScreen(screen)) // Screen functions run once, each band replays the commands reaching it
+            RenderStrips(NULL, DisplayListDraw, STRIP_HEIGHT, true);
+        else
+#endif
+        RenderStrips(screenBackgrounds[screen], screens[screen], STRIP_HEIGHT, true);
     }
+    AllocCountEnd("DisplayWeather");
+    ProfileEndFrame("DisplayWeather");
+    xSemaphoreGive(dataMutex);
+    xSemaphoreGive(renderMutex);
+    ESP_LOGI("DISPLAY", "Screen rendered in %lu us", micros() - renderStart);
+#if RASTER_STATS
+    ESP_LOGI("DISPLAY", "Raster primitives: %u, spans: %u, pixels: %u", rasterPrimitives, rasterSpanWrites, rasterPixelWrites);
+#endif
+}
+
+int ScreenCount()
+{
+    return sizeof(screens) / sizeof(screens[0]);
+}
+
+#if DISPLAY_LIST
+// Runs the screen functions once into the display list, false when it overflowed
+bool RecordScreen(int screen)
+{
+    DisplayListBegin();
+    if (screenBackgrounds[screen])
+        screenBackgrounds[screen]();
+    screens[screen]();
+    return DisplayListEnd();
+}
+
+// buffer, the raster target, still holds the last frame drawn into it from the list: redraw only the regions whose
+// commands changed since. Each buffer is diffed against its own committed list, double buffering alternates two.
+bool RedrawChangedRegions(int screen, uint8_t *buffer)
+{
+    if (!RecordScreen(screen))
+    {
+        InvalidateDisplayList(buffer); // The immediate mode fallback overwrites the buffer
+        return false;
+    }
+    RasterBox regions[FRAME_TILE_ROWS];
+    const int count = DisplayListDiff(buffer, regions, FRAME_TILE_ROWS);
+    for (int i = 0; i < count; i++)
+        DisplayListRenderRegion(regions[i]);
+    DisplayListCommit(buffer);
+    ESP_LOGI("DISPLAY", "Display list: %d commands, %d changed regions", DisplayListSize(), count);
+    return true;
+}
+#endif
+
+// Render task side of double buffering: draws a screen into a buffer it was handed through the free queue
+void ComposeScreen(int screen, uint8_t *buffer)
+{
+    xSemaphoreTake(renderMutex, portMAX_DELAY);
+    xSemaphoreTake(dataMutex, portMAX_DELAY); // Not while WeatherUpdateCycle() is halfway through new data
+#if RASTER_STATS
+    rasterResetStats();
+#endif
+    ProfileBeginFrame();
+    AllocCountBegin();
+    BeginFastRegions(screen);
+    rasterSetTarget(buffer, 0, EPD_HEIGHT);
+    RunDrawBenchmarks(buffer); // Benchmark builds time the draws on the render core too
+#if DISPLAY_LIST
+    if (!RedrawChangedRegions(screen, buffer))
+#endif
+    {
+        BeginFrame(buffer, screen, Language, screenBackgrounds[screen]);
+        screens[screen]();
+    }
+    rasterResetTarget();
+    AllocCountEnd("ComposeScreen");
+    ProfileEndFrame("ComposeScreen");
+    xSemaphoreGive(dataMutex);
+    xSemaphoreGive(renderMutex);
+}
+
+// Button press: shows the pre-rendered screen straight away, composing it first if it is not ready
+void ShowScreenNow(int screen)
+{
+    if (!RenderTaskRunning() || xSemaphoreTake(panelMutex, 0) != pdTRUE)
+        return; // No second buffer, or a weather update is drawing, the new screen shows with the next update
+    RenderedFrame frame;
+    if (!TakeFrame(screen, &frame, 0))
+    {
+        RequestFrame(screen);
+        if (!TakeFrame(screen, &frame, pdMS_TO_TICKS(10000)))
+        {
+            xSemaphoreGive(panelMutex);
+            return;
+        }
+    }
+    framebuffer = frame.buffer;
+    RequestFrame((screen + 1) % ScreenCount());
+    const int64_t pushStart = esp_timer_get_time();
+    const bool changed = UpdatePanel(screen) != FRAME_SKIP;
+    const int64_t pushEnd = esp_timer_get_time();
+    if (changed && FRAME_SNAPSHOT) // The restored shadow after a reset must be what the panel shows
+        SaveFrameSnapshot(framebuffer, screen);
+    ReleaseFrame(frame);
+    RenderedFrame next;
+    if (WaitForRenderIdle(&next, pdMS_TO_TICKS(10000)))
+        LogRenderOverlap(next, pushStart, pushEnd);
+    xSemaphoreGive(panelMutex);
+}
+
+// Renders a screen from the current data into buffer (a full 4bpp frame) without touching the framebuffer,
+// the background cache or the panel. Used for web snapshots, returns the render time in us.
+unsigned long RenderScreenSnapshot(int screen, uint8_t *buffer)
+{
+    xSemaphoreTake(renderMutex, portMAX_DELAY);
+    xSemaphoreTake(dataMutex, portMAX_DELAY);
+    unsigned long start = micros();
+    ProfileBeginFrame();
+    BeginFastRegions(screen); // Marks the same regions its compose does
+    memset(buffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+    rasterSetTarget(buffer, 0, EPD_HEIGHT);
+    if (screenBackgrounds[screen])
+        screenBackgrounds[screen]();
+    screens[screen]();
+    rasterResetTarget();
+    ProfileEndFrame("Snapshot");
+    unsigned long elapsed = micros() - start;
+    xSemaphoreGive(dataMutex);
+    xSemaphoreGive(renderMutex);
+    return elapsed;
 }
 
 void DisplayWeatherIcon(int x, int y)
 {
+    PROFILE_SECTION("DisplayWeatherIcon");
     DisplayConditionsSection(x, y, WxConditions[0].Icon, LargeIcon);
 }
 
 void DisplayMainWeatherSection(int x, int y)
 {
+    PROFILE_SECTION("DisplayMainWeatherSection");
     DisplayTemperatureSection(x + 10, y);
     // DisplayForecastTextSection(x - 55, y + 25); // Turned off text forecast
     DisplayPressureSection(x+10, y + 50, WxConditions[0].Pressure, WxConditions[0].Trend);
@@ -476,65 +735,82 @@ void DisplayMainWeatherSection(int x, int y)
 
 void DisplayGeneralInfoSection()
 {
+    PROFILE_SECTION("DisplayGeneralInfoSection");
     setFont(OpenSans12B);
     drawString(5, 5, City, LEFT);
     setFont(OpenSans18B);
     drawString(170, 0, Date_str, LEFT);
     setFont(OpenSans10B);
-    drawString(490, 2, "Aktualizacja: " + Time_str, LEFT);
+    drawStringf(490, 2, LEFT, "%s: %s", Txt(TXT_LAST_UPDATE), Time_str.c_str());
+    MarkFastRegion(490, 0, EPD_WIDTH - 490, 36); // Update time, above the line at y 40
 }
 
-void DisplaySensorReadings(int x, int y)
+void DrawSensorReadingsFrame(int x, int y)
 {
+    PROFILE_SECTION("DrawSensorReadingsFrame");
     drawLine(480, 10, 480, 500, DarkGrey);
     drawLine(200, 40, 910, 40, DarkGrey);
+    //drawLine(480, 310, 940, 310, DarkGrey);
+    setFont(OpenSans12B);
+    drawString(x, 40, Txt(TXT_SENSOR_OUTDOOR), LEFT); // Garden title, the room title changes with the sensor state
+}
+
+void DisplaySensorReadings(int x, int y)
+{
+    PROFILE_SECTION("DisplaySensorReadings");
     DisplaySensorReadingsGarden(x, 40);
     DisplaySensorReadingsRoom(x+245, 40);
-    //drawLine(480, 310, 940, 310, DarkGrey);
 }
 
 void DisplaySensorReadingsGarden(int x, int y)
 {
-    setFont(OpenSans12B);
-    drawString(x, y, "Czujnik ZEWN.", LEFT);
+    PROFILE_SECTION("DisplaySensorReadingsGarden");
     setFont(OpenSans24B);
-    //drawString(x, y+40, String("12.6") + "° " + "85" + "%", LEFT);
-    drawString(x, y+40, String("12.6") + "°", LEFT);
+    drawString(x, y+40, "12.6°", LEFT);
     setFont(OpenSans18B);
-    drawString(x+135, y+40, " " + String("85") + "%", LEFT);
-    drawString(x, y+90, String("1024") + " hPa", LEFT);
+    drawString(x+135, y+40, " 85%", LEFT);
+    drawString(x, y+90, "1024 hPa", LEFT);
+}
+
+// Takes the latest room readings before drawing, screens may be drawn several times (strip rendering)
+void ReceiveRoomReadings()
+{
+    roomReadingsValid = (xQueueReceive(processedDataQueue, &processedResult, pdMS_TO_TICKS(500)) == pdTRUE);
+    if (roomReadingsValid)
+        ESP_LOGI("DISPLAY", "Successfully received processed data from queue");
+    else
+        ESP_LOGW("DISPLAY", "Failed to receive processed data from queue");
 }
 
 void DisplaySensorReadingsRoom(int x, int y)
 {
-    if (xQueueReceive(processedDataQueue, &processedResult, pdMS_TO_TICKS(500)) == pdTRUE)
+    PROFILE_SECTION("DisplaySensorReadingsRoom");
+    MarkFastRegion(x, y + 30, 230, 100); // Temperature, humidity and pressure values
+    if (roomReadingsValid)
     {
-        ESP_LOGI("DISPLAY", "Successfully received processed data from queue");
         setFont(OpenSans12B);
-        drawString(x, y, "Czujnik DOM", LEFT);
+        drawString(x, y, Txt(TXT_SENSOR_ROOM), LEFT);
         setFont(OpenSans24B);
-        drawString(x, y+40, String(processedResult.temperature, 1) + "°", LEFT);
+        drawStringf(x, y+40, LEFT, "%.1f°", processedResult.temperature);
         setFont(OpenSans18B);
-        drawString(x+135, y+40, " " + String(processedResult.humidity, 0) + "%", LEFT);
-        drawString(x, y+90, String(processedResult.pressure, 0) + " hPa", LEFT);
+        drawStringf(x+135, y+40, LEFT, " %.0f%%", processedResult.humidity);
+        drawStringf(x, y+90, LEFT, "%.0f hPa", processedResult.pressure);
     }
     else
     {
-        ESP_LOGW("DISPLAY", "Failed to receive processed data from queue");
         setFont(OpenSans12B);
-        drawString(x, y, "Czujnik dom", LEFT);
+        drawString(x, y, Txt(TXT_SENSOR_ROOM_NO_DATA), LEFT);
         setFont(OpenSans24B);
-        drawString(x, y+40, String("--.-") + "°", LEFT);
+        drawString(x, y+40, "--.-°", LEFT);
         setFont(OpenSans18B);
-        drawString(x+135, y+40, " " + String("--") + "%", LEFT);
-        drawString(x, y+90, String("----") + " hPa", LEFT);
+        drawString(x+135, y+40, " --%", LEFT);
+        drawString(x, y+90, "---- hPa", LEFT);
     }    
 }
 
-void DisplayDisplayWindSection(int x, int y, float angle, float windspeed, int Cradius)
+void DrawCompassRose(int x, int y, int Cradius)
 {
-    angle = fmod((angle + 180), 360); // Ensure the angle points opposite direction and wraps correctly between 0-360°
-    arrow(x, y, Cradius - 22, angle, 18+2, 33+2); // Show wind direction on outer circle of width and length
+    PROFILE_SECTION("DrawCompassRose");
     setFont(OpenSans8B);
     int dxo, dyo, dxi, dyi;
     drawCircle(x, y, Cradius, Black);       // Draw compass circle
@@ -545,13 +821,13 @@ void DisplayDisplayWindSection(int x, int y, float angle, float windspeed, int C
         dxo = Cradius * cos((a - 90) * PI / 180);
         dyo = Cradius * sin((a - 90) * PI / 180);
         if (a == 45)
-            drawString(dxo + x + 15, dyo + y - 18, TXT_NE, CENTER);
+            drawString(dxo + x + 15, dyo + y - 18, Txt(TXT_NE), CENTER);
         if (a == 135)
-            drawString(dxo + x + 20, dyo + y - 2, TXT_SE, CENTER);
+            drawString(dxo + x + 20, dyo + y - 2, Txt(TXT_SE), CENTER);
         if (a == 225)
-            drawString(dxo + x - 20, dyo + y - 2, TXT_SW, CENTER);
+            drawString(dxo + x - 20, dyo + y - 2, Txt(TXT_SW), CENTER);
         if (a == 315)
-            drawString(dxo + x - 15, dyo + y - 18, TXT_NW, CENTER);
+            drawString(dxo + x - 15, dyo + y - 18, Txt(TXT_NW), CENTER);
         dxi = dxo * 0.9;
         dyi = dyo * 0.9;
         drawLine(dxo + x, dyo + y, dxi + x, dyi + y, Black);
@@ -561,102 +837,118 @@ void DisplayDisplayWindSection(int x, int y, float angle, float windspeed, int C
         dyi = dyo * 0.9;
         drawLine(dxo + x, dyo + y, dxi + x, dyi + y, Black);
     }
-    drawString(x, y - Cradius - 20, TXT_N, CENTER);
-    drawString(x, y + Cradius + 10, TXT_S, CENTER);
-    drawString(x - Cradius - 15, y - 5, TXT_W, CENTER);
-    drawString(x + Cradius + 10, y - 5, TXT_E, CENTER);
-    drawString(x + 3, y + 50, String(angle, 0) + "°", CENTER);
+    drawString(x, y - Cradius - 20, Txt(TXT_N), CENTER);
+    drawString(x, y + Cradius + 10, Txt(TXT_S), CENTER);
+    drawString(x - Cradius - 15, y - 5, Txt(TXT_W), CENTER);
+    drawString(x + Cradius + 10, y - 5, Txt(TXT_E), CENTER);
+}
+
+void DisplayDisplayWindSection(int x, int y, float angle, float windspeed, int Cradius)
+{
+    PROFILE_SECTION("DisplayDisplayWindSection");
+    angle = fmod((angle + 180), 360); // Ensure the angle points opposite direction and wraps correctly between 0-360°
+    arrow(x, y, Cradius - 22, angle, 18+2, 33+2); // Show wind direction on outer circle of width and length, compass rose is in the background layer
+    setFont(OpenSans8B);
+    drawStringf(x + 3, y + 50, CENTER, "%.0f°", angle);
     setFont(OpenSans12B);
     drawString(x, y - 50, WindDegToOrdinalDirection(angle), CENTER);
     setFont(OpenSans24B);
-    drawString(x + 3, y - 18, String(windspeed, 1), CENTER);
+    drawStringf(x + 3, y - 18, CENTER, "%.1f", windspeed);
     setFont(OpenSans12B);
     drawString(x, y + 25, (Units == "M" ? "km/h" : "mph"), CENTER); // change from m/s
 }
 
-String WindDegToOrdinalDirection(float winddirection)
+const char *WindDegToOrdinalDirection(float winddirection)
 {
     if (winddirection >= 348.75 || winddirection < 11.25)
-        return TXT_N;
+        return Txt(TXT_N);
     if (winddirection >= 11.25 && winddirection < 33.75)
-        return TXT_NNE;
+        return Txt(TXT_NNE);
     if (winddirection >= 33.75 && winddirection < 56.25)
-        return TXT_NE;
+        return Txt(TXT_NE);
     if (winddirection >= 56.25 && winddirection < 78.75)
-        return TXT_ENE;
+        return Txt(TXT_ENE);
     if (winddirection >= 78.75 && winddirection < 101.25)
-        return TXT_E;
+        return Txt(TXT_E);
     if (winddirection >= 101.25 && winddirection < 123.75)
-        return TXT_ESE;
+        return Txt(TXT_ESE);
     if (winddirection >= 123.75 && winddirection < 146.25)
-        return TXT_SE;
+        return Txt(TXT_SE);
     if (winddirection >= 146.25 && winddirection < 168.75)
-        return TXT_SSE;
+        return Txt(TXT_SSE);
     if (winddirection >= 168.75 && winddirection < 191.25)
-        return TXT_S;
+        return Txt(TXT_S);
     if (winddirection >= 191.25 && winddirection < 213.75)
-        return TXT_SSW;
+        return Txt(TXT_SSW);
     if (winddirection >= 213.75 && winddirection < 236.25)
-        return TXT_SW;
+        return Txt(TXT_SW);
     if (winddirection >= 236.25 && winddirection < 258.75)
-        return TXT_WSW;
+        return Txt(TXT_WSW);
     if (winddirection >= 258.75 && winddirection < 281.25)
-        return TXT_W;
+        return Txt(TXT_W);
     if (winddirection >= 281.25 && winddirection < 303.75)
-        return TXT_WNW;
+        return Txt(TXT_WNW);
     if (winddirection >= 303.75 && winddirection < 326.25)
-        return TXT_NW;
+        return Txt(TXT_NW);
     if (winddirection >= 326.25 && winddirection < 348.75)
-        return TXT_NNW;
+        return Txt(TXT_NNW);
     return "?";
 }
 
 void DisplayTemperatureSection(int x, int y)
 {
+    PROFILE_SECTION("DisplayTemperatureSection");
     setFont(OpenSans18B);
-    drawString(x, y - 40, String(WxConditions[0].Temperature, 1) + "°     " + String(WxConditions[0].Humidity, 0) + "%", LEFT);
+    drawStringf(x, y - 40, LEFT, "%.1f°     %.0f%%", WxConditions[0].Temperature, WxConditions[0].Humidity);
     setFont(OpenSans12B);
-    drawString(x, y, "Max " + String(WxConditions[0].High, 0) + "° | Min " + String(WxConditions[0].Low, 0) + "°", LEFT); // Show forecast high and Low
+    drawStringf(x, y, LEFT, "Max %.0f° | Min %.0f°", WxConditions[0].High, WxConditions[0].Low); // Show forecast high and Low
 }
 
 void DisplayForecastTextSection(int x, int y)
 {
+    PROFILE_SECTION("DisplayForecastTextSection");
 #define lineWidth 34
     setFont(OpenSans12B);
-    //Wx_Description = WxConditions[0].Main0;          // e.g. typically 'Clouds'
-    String Wx_Description = WxConditions[0].Forecast0; // e.g. typically 'overcast clouds' ... you choose which
-    Wx_Description.replace(".", "");                   // remove any '.'
-    int spaceRemaining = 0, p = 0, charCount = 0, Width = lineWidth;
-    while (p < Wx_Description.length())
-    {
-        if (Wx_Description.substring(p, p + 1) == " ")
-            spaceRemaining = p;
-        if (charCount > Width - 1)
-        { // '~' is the end of line marker
-            Wx_Description = Wx_Description.substring(0, spaceRemaining) + "~" + Wx_Description.substring(spaceRemaining + 1);
-            charCount = 0;
+    //Main0 is typically 'Clouds', Forecast0 'overcast clouds' ... you choose which
+    char text[DRAW_STRINGF_SIZE];
+    int length = 0;
+    for (const char *c = WxConditions[0].Forecast0.c_str(); *c && length < (int)sizeof(text) - 1; c++)
+        if (*c != '.')
+            text[length++] = *c; // remove any '.'
+    text[length] = 0;
+    const char *line2 = NULL;
+    for (int p = lineWidth; length > lineWidth && p > 0 && !line2; p--)
+    { // Wrapped once, at the last space within the line width
+        if (text[p] == ' ')
+        {
+            text[p] = 0;
+            line2 = text + p + 1;
         }
-        p++;
-        charCount++;
     }
+    text[0] = toupper(text[0]); // Title-case the first line
+    char rain[24] = "";
     if (WxForecast[0].Rainfall > 0)
-        Wx_Description += " (" + String(WxForecast[0].Rainfall, 1) + String((Units == "M" ? "mm" : "in")) + ")";
-    //Wx_Description = wordWrap(Wx_Description, lineWidth);
-    String Line1 = Wx_Description.substring(0, Wx_Description.indexOf("~"));
-    String Line2 = Wx_Description.substring(Wx_Description.indexOf("~") + 1);
-    drawString(x + 30, y + 5, TitleCase(Line1), LEFT);
-    if (Line1 != Line2)
-        drawString(x + 30, y + 30, Line2, LEFT);
+        formatText(rain, sizeof(rain), " (%.1f%s)", WxForecast[0].Rainfall, Units == "M" ? "mm" : "in");
+    if (line2)
+    {
+        drawString(x + 30, y + 5, text, LEFT);
+        drawStringf(x + 30, y + 30, LEFT, "%s%s", line2, rain);
+    }
+    else
+        drawStringf(x + 30, y + 5, LEFT, "%s%s", text, rain);
 }
 
-void DisplayPressureSection(int x, int y, float pressure, String slope)
+void DisplayPressureSection(int x, int y, float pressure, const String &slope)
 {
+    PROFILE_SECTION("DisplayPressureSection");
     setFont(OpenSans12B);
     DrawPressureAndTrend(x - 20, y - 5, pressure, slope);
     /* // Turned off visivility
     if (WxConditions[0].Visibility > 0)
     {
-        Visibility(x + 145, y, String(WxConditions[0].Visibility) + "M");
+        char visibility[16];
+        formatText(visibility, sizeof(visibility), "%dM", WxConditions[0].Visibility);
+        Visibility(x + 145, y, visibility);
         x += 150; // Draw the text in the same positions if one is zero, otherwise in-line
     }
     */
@@ -666,229 +958,214 @@ void DisplayPressureSection(int x, int y, float pressure, String slope)
 
 void DisplayForecastWeather(int x, int y, int index)
 {
+    PROFILE_SECTION("DisplayForecastWeather");
     int fwidth = 120; // EPD_WIDTH
     x = x + fwidth * index;
     DisplayConditionsSection(x + fwidth / 2, y + 90, WxForecast[index].Icon, MediumIcon); // changed from SmallIcon 
-    drawLine(x+fwidth, y+10, x+fwidth, y + 160, DarkGrey);
     setFont(OpenSans12B);
-    drawString(x + fwidth / 2, y + 10, String(ConvertUnixTime(WxForecast[index].Dt + WxConditions[0].Timezone).substring(0, 5)), CENTER);
-    drawString(x + fwidth / 2, y + 135, String(WxForecast[index].High, 0) + "°/" + String(WxForecast[index].Low, 0) + "°", CENTER);
+    char time[8];
+    FormatClock(time, sizeof(time), WxForecast[index].Dt, Units != "M"); // Dt is UTC, FormatClock applies the local offset
+    drawString(x + fwidth / 2, y + 10, time, CENTER);
+    drawStringf(x + fwidth / 2, y + 135, CENTER, "%.0f°/%.0f°", WxForecast[index].High, WxForecast[index].Low);
 }
 
 void DisplayAstronomySection(int x, int y)
 {
+    PROFILE_SECTION("DisplayAstronomySection");
     setFont(OpenSans12B);
-    drawString(x + 5, y + 30, TXT_SUNRISE + ": " + ConvertUnixTime(WxConditions[0].Sunrise).substring(0, 5), LEFT);
-    drawString(x + 5, y + 55, TXT_SUNSET + ":  " + ConvertUnixTime(WxConditions[0].Sunset).substring(0, 5), LEFT);
-    time_t now = time(NULL);
-    struct tm *now_utc = gmtime(&now);
-    const int day_utc = now_utc->tm_mday;
-    const int month_utc = now_utc->tm_mon + 1;
-    const int year_utc = now_utc->tm_year + 1900;
-    drawString(x + 5, y + 80, MoonPhase(day_utc, month_utc, year_utc, Hemisphere), LEFT);
-    DrawMoon(x + 150, y - 30, day_utc, month_utc, year_utc, Hemisphere);
+    char time[8];
+    const bool located = AstronomyLocationKnown(); // Otherwise OWM's times; 0 then means no sunrise or sunset (polar day or night)
+    const time_t sunrise = located ? astronomyDay.sunrise : WxConditions[0].Sunrise;
+    const time_t sunset = located ? astronomyDay.sunset : WxConditions[0].Sunset;
+    if (sunrise)
+        FormatClock(time, sizeof(time), sunrise, Units != "M");
+    else
+        strcpy(time, "--:--");
+    drawStringf(x + 5, y + 30, LEFT, "%s: %s", Txt(TXT_SUNRISE), time);
+    if (sunset)
+        FormatClock(time, sizeof(time), sunset, Units != "M");
+    else
+        strcpy(time, "--:--");
+    drawStringf(x + 5, y + 55, LEFT, "%s:  %s", Txt(TXT_SUNSET), time);
+    drawString(x + 5, y + 80, MoonPhaseName(moonPhaseNameIndex), LEFT);
+    DrawMoon(x + 150, y - 30, moonSpriteIndex);
 }
 
-void DisplayForecastSection(int x, int y)
+// Refreshes the sun and moon events when the local day or the location changed, keeps the render path integer only.
+// The configured location wins, then the city coordinates of the last OWM response, then the last one used.
+void UpdateAstronomyCache()
 {
-    drawLine(20, 365, 940, 365, DarkGrey);
-    int f = 0;
-    do
+    float latitude = Latitude, longitude = Longitude;
+    if (latitude == 0 && longitude == 0)
     {
-        DisplayForecastWeather(x, y, f);
-        f++;
-    } while (f < max_readings);
-    /* // turning off 4 graphs in the main screen
+        latitude = WxConditions[0].lat;
+        longitude = WxConditions[0].lon;
+    }
+    if (latitude == 0 && longitude == 0 && AstronomyLocationKnown())
+    {
+        latitude = astronomyDay.latitude;
+        longitude = astronomyDay.longitude;
+    }
+    if (latitude == 0 && longitude == 0)
+        latitude = longitude = NAN; // Nothing known, only the moon phase is computed
+    UpdateAstronomy(time(NULL), latitude, longitude);
+    moonSpriteIndex = MoonSpriteIndex(astronomyDay.phase, Hemisphere == "south");
+    moonPhaseNameIndex = MoonPhaseNameIndex(astronomyDay.phase);
+}
 
-    int r = 0;
-    do
-    { // Pre-load temporary arrays with with data - because C parses by reference and remember that[1] has already been converted to I units
-        if (Units == "I")
-            pressure_readings[r] = WxForecast[r].Pressure * 0.02953;
-        else
-            pressure_readings[r] = WxForecast[r].Pressure;
-        if (Units == "I")
-            rain_readings[r] = WxForecast[r].Rainfall * 0.0393701;
-        else
-            rain_readings[r] = WxForecast[r].Rainfall;
-        if (Units == "I")
-            snow_readings[r] = WxForecast[r].Snowfall * 0.0393701;
-        else
-            snow_readings[r] = WxForecast[r].Snowfall;
+void DisplayGraphSection(int x, int y)
+{
+    PROFILE_SECTION("DisplayGraphSection");
+    for (int r = 0; r < max_readings; r++)
+    { // Pre-load the graph arrays, WxForecast[0] rain and snow have already been converted to imperial units
+        const bool convert = Units == "I" && r > 0;
+        pressure_readings[r] = (Units == "I") ? WxForecast[r].Pressure * 0.02953 : WxForecast[r].Pressure;
+        rain_readings[r] = convert ? mm_to_inches(WxForecast[r].Rainfall) : WxForecast[r].Rainfall;
+        snow_readings[r] = convert ? mm_to_inches(WxForecast[r].Snowfall) : WxForecast[r].Snowfall;
         temperature_readings[r] = WxForecast[r].Temperature;
         humidity_readings[r] = WxForecast[r].Humidity;
-        r++;
-    } while (r < max_readings);
-
-    int gwidth = 175, gheight = 100;
-    int gx = (SCREEN_WIDTH - gwidth * 4) / 5 + 8; // equals 60px
-    int gy = (SCREEN_HEIGHT - gheight - 30); // equals 410
-    int gap = gwidth + gx;
+    }
+    const int gwidth = 360, gheight = 150;
+    const int gapx = 480, gapy = 215;
 
     // (x,y,width,height,MinValue, MaxValue, Title, Data Array, AutoScale, ChartMode)
-    
-    DrawGraph(gx + 0 * gap, gy, gwidth, gheight, 900, 1050, Units == "M" ? TXT_PRESSURE_HPA : TXT_PRESSURE_IN, pressure_readings, max_readings, autoscale_on, barchart_off);
-    DrawGraph(gx + 1 * gap, gy, gwidth, gheight, 10, 30, Units == "M" ? TXT_TEMPERATURE_C : TXT_TEMPERATURE_F, temperature_readings, max_readings, autoscale_on, barchart_off);
-    DrawGraph(gx + 2 * gap, gy, gwidth, gheight, 0, 100, TXT_HUMIDITY_PERCENT, humidity_readings, max_readings, autoscale_off, barchart_off);
+    DrawGraph(x, y, gwidth, gheight, 900, 1050, Txt(Units == "M" ? TXT_PRESSURE_HPA : TXT_PRESSURE_IN), pressure_readings, max_readings, autoscale_on, barchart_off);
+    DrawGraph(x + gapx, y, gwidth, gheight, 10, 30, Txt(Units == "M" ? TXT_TEMPERATURE_C : TXT_TEMPERATURE_F), temperature_readings, max_readings, autoscale_on, barchart_off);
+    DrawGraph(x, y + gapy, gwidth, gheight, 0, 100, Txt(TXT_HUMIDITY_PERCENT), humidity_readings, max_readings, autoscale_off, barchart_off);
     if (SumOfPrecip(rain_readings, max_readings) >= SumOfPrecip(snow_readings, max_readings))
-        DrawGraph(gx + 3 * gap + 5, gy, gwidth, gheight, 0, 30, Units == "M" ? TXT_RAINFALL_MM : TXT_RAINFALL_IN, rain_readings, max_readings, autoscale_on, barchart_on);
+        DrawGraph(x + gapx, y + gapy, gwidth, gheight, 0, 30, Txt(Units == "M" ? TXT_RAINFALL_MM : TXT_RAINFALL_IN), rain_readings, max_readings, autoscale_on, barchart_on);
     else
-        DrawGraph(gx + 3 * gap + 5, gy, gwidth, gheight, 0, 30, Units == "M" ? TXT_SNOWFALL_MM : TXT_SNOWFALL_IN, snow_readings, max_readings, autoscale_on, barchart_on);
-        */
+        DrawGraph(x + gapx, y + gapy, gwidth, gheight, 0, 30, Txt(Units == "M" ? TXT_SNOWFALL_MM : TXT_SNOWFALL_IN), snow_readings, max_readings, autoscale_on, barchart_on);
 }
 
-void DisplayConditionsSection(int x, int y, String IconName, IconSize size)
+void DrawForecastFrame(int x, int y)
 {
-    Serial.println("Icon name: " + IconName);
-    if (IconName == "01d" || IconName == "01n")
-        Sunny(x, y, size, IconName);
-    else if (IconName == "02d" || IconName == "02n")
-        MostlySunny(x, y, size, IconName);
-    else if (IconName == "03d" || IconName == "03n")
-        Cloudy(x, y, size, IconName);
-    else if (IconName == "04d" || IconName == "04n")
-        MostlySunny(x, y, size, IconName);
-    else if (IconName == "09d" || IconName == "09n")
-        ChanceRain(x, y, size, IconName);
-    else if (IconName == "10d" || IconName == "10n")
-        Rain(x, y, size, IconName);
-    else if (IconName == "11d" || IconName == "11n")
-        Tstorms(x, y, size, IconName);
-    else if (IconName == "13d" || IconName == "13n")
-        Snow(x, y, size, IconName);
-    else if (IconName == "50d")
-        Haze(x, y, size, IconName);
-    else if (IconName == "50n")
-        Fog(x, y, size, IconName);
-    else
-        Nodata(x, y, size, IconName);
+    PROFILE_SECTION("DrawForecastFrame");
+    int fwidth = 120; // Same slot width as DisplayForecastWeather
+    drawLine(20, 365, 940, 365, DarkGrey);
+    for (int f = 0; f < forecast_boxes; f++)
+        drawLine(x + fwidth * (f + 1), y + 10, x + fwidth * (f + 1), y + 160, DarkGrey);
+}
+
+void DisplayForecastSection(int x, int y)
+{
+    PROFILE_SECTION("DisplayForecastSection");
+    int f = 0;
+    do
+    {
+        DisplayForecastWeather(x, y, f);
+        f++;
+    } while (f < forecast_boxes);
+}
+
+void DisplayConditionsSection(int x, int y, const String &IconName, const IconSize &size)
+{
+    PROFILE_SECTION("DisplayConditionsSection");
+    Serial.printf("Icon name: %s\n", IconName.c_str());
+    DrawWeatherIcon(x, y, IconName, size);
 }
 
 void DisplayStatusSection(int x, int y, int rssi)
 {
+    PROFILE_SECTION("DisplayStatusSection");
     setFont(OpenSans10B);
     DrawRSSI(x + 310, y + 15, rssi);
     DrawBattery(x + 150, y);
+    MarkFastRegion(x + 310, y - 16, 50, 32); // RSSI bars
+    MarkFastRegion(x + 170, y - 16, 140, 24); // Battery gauge and percentage
 }
 
-void DrawPressureAndTrend(int x, int y, float pressure, String slope)
+void DrawPressureAndTrend(int x, int y, float pressure, const String &slope)
 {
-    drawString(x + 20, y, String(pressure, (Units == "M" ? 0 : 1)) + (Units == "M" ? "hPa" : "in"), LEFT);
+    PROFILE_SECTION("DrawPressureAndTrend");
+    drawStringf(x + 20, y, LEFT, "%.*f%s", Units == "M" ? 0 : 1, pressure, Units == "M" ? "hPa" : "in");
     if (slope == "+")
-    {
-        DrawSegment(x, y + 10, 0, 0, 8, -8, 8, -8, 16, 0);
-        DrawSegment(x - 1, y + 10, 0, 0, 8, -8, 8, -8, 16, 0);
-    }
+        DrawSegment(x, y + 10, 0, 0, 8, -8, 16, 0, 2);
     else if (slope == "0")
-    {
-        DrawSegment(x, y + 10, 8, -8, 16, 0, 8, 8, 16, 0);
-        DrawSegment(x - 1, y + 10, 8, -8, 16, 0, 8, 8, 16, 0);
-    }
+        DrawSegment(x, y + 10, 8, -8, 16, 0, 8, 8, 2);
     else if (slope == "-")
-    {
-        DrawSegment(x, y + 10, 0, 0, 8, 8, 8, 8, 16, 0);
-        DrawSegment(x - 1, y + 10, 0, 0, 8, 8, 8, 8, 16, 0);
-    }
+        DrawSegment(x, y + 10, 0, 0, 8, 8, 16, 0, 2);
 }
 
 boolean UpdateLocalTime()
 {
-    struct tm timeinfo;
-    char time_output[30], day_output[30], update_time[30];
-    while (!getLocalTime(&timeinfo, 5000))
-    { // Wait for 5-sec for time to synchronise
-        Serial.println("Failed to obtain time");
-        return false;
+    time_t now = time(NULL);
+    if (now < 1500000000) // Not synchronised yet
+    {
+        struct tm timeinfo;
+        if (!getLocalTime(&timeinfo, 5000)) // Wait for 5-sec for time to synchronise
+        {
+            Serial.println("Failed to obtain time");
+            return false;
+        }
+        now = time(NULL);
     }
+    TimeZoneUpdate(now); // Offset and next DST change, only worked out again after that change
+    struct tm timeinfo;
+    LocalTimeFields(now, &timeinfo);
     CurrentHour = timeinfo.tm_hour;
     CurrentMin = timeinfo.tm_min;
     CurrentSec = timeinfo.tm_sec;
-    //See http://www.cplusplus.com/reference/ctime/strftime/
-    Serial.println(&timeinfo, "%a %b %d %Y   %H:%M:%S"); // Displays: Saturday, June 24 2017 14:05:49
+    char time_output[16], day_output[48];
     if (Units == "M")
     {
-        sprintf(day_output, "%s, %02u %s %04u", weekday_D[timeinfo.tm_wday], timeinfo.tm_mday, month_M[timeinfo.tm_mon], (timeinfo.tm_year) + 1900);
-        strftime(update_time, sizeof(update_time), "%H:%M:%S", &timeinfo); // Creates: '@ 14:05:49'   and change from 30 to 8 <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
-        sprintf(time_output, "%s", update_time);
+        FormatDate(day_output, sizeof(day_output), now, DATE_LONG);                // Creates: 'Saturday, 24 June 2017'
+        FormatClockSeconds(time_output, sizeof(time_output), now, false);          // Creates: '14:05:49'
     }
     else
     {
-        strftime(day_output, sizeof(day_output), "%a %b-%d-%Y", &timeinfo); // Creates  'Sat May-31-2019'
-        strftime(update_time, sizeof(update_time), "%r", &timeinfo);        // Creates: '@ 02:05:49pm'
-        sprintf(time_output, "%s", update_time);
+        FormatDate(day_output, sizeof(day_output), now, DATE_US_SHORT);            // Creates  'Sat May-31-2019'
+        FormatClockSeconds(time_output, sizeof(time_output), now, true);           // Creates: '02:05:49 PM'
     }
+    Serial.printf("%s   %s\n", day_output, time_output);
     Date_str = day_output;
     Time_str = time_output;
     return true;
 }
 
-String ConvertUnixTime(int unix_time)
+void epd_update()
 {
-    // Returns either '21:12  ' or ' 09:12pm' depending on Units mode
-    time_t tm = unix_time;
-    struct tm *now_tm = localtime(&tm);
-    char output[40];
-    if (Units == "M")
-    {
-        strftime(output, sizeof(output), "%H:%M %d/%m/%y", now_tm);
+    if (RenderTaskRunning())
+    {   // Push the composed frame while the render task works on the next screen, then hand the buffer back
+        if (!shownFrameTaken)
+            return;
+        const int64_t pushStart = esp_timer_get_time();
+        const bool changed = UpdatePanel(shownFrame.screen) != FRAME_SKIP;
+        const int64_t pushEnd = esp_timer_get_time();
+        if (changed && FRAME_SNAPSHOT)
+            SaveFrameSnapshot(framebuffer, shownFrame.screen);
+        ReleaseFrame(shownFrame);
+        shownFrameTaken = false;
+        RenderedFrame next;
+        if (WaitForRenderIdle(&next, pdMS_TO_TICKS(10000)))
+            LogRenderOverlap(next, pushStart, pushEnd);
     }
-    else
+    else if (framebuffer) // In strip mode the bands were already pushed by DisplayWeather
     {
-        strftime(output, sizeof(output), "%I:%M%P %m/%d/%y", now_tm);
+        // Skipped or limited to the changed tile rows when the frame matches the previous one
+        if (UpdatePanel(screenState) != FRAME_SKIP && FRAME_SNAPSHOT)
+            SaveFrameSnapshot(framebuffer, screenState);
     }
-    return output;
 }
 
-void epd_update()
+const char *MoonPhaseName(int b)
 {
-    epd_draw_grayscale_image(epd_full_screen(), framebuffer); // Update the screen
-}
-
-double NormalizedMoonPhase(int d, int m, int y)
-{
-    int j = JulianDate(d, m, y);
-    //Calculate approximate moon phase
-    double Phase = (j + 4.867) / 29.53059;
-    return (Phase - (int)Phase);
-}
-
-String MoonPhase(int d, int m, int y, String hemisphere)
-{
-    int c, e;
-    double jd;
-    int b;
-    if (m < 3)
-    {
-        y--;
-        m += 12;
-    }
-    ++m;
-    c = 365.25 * y;
-    e = 30.6 * m;
-    jd = c + e + d - 694039.09; /* jd is total days elapsed */
-    jd /= 29.53059;             /* divide by the moon cycle (29.53 days) */
-    b = jd;                     /* int(jd) -> b, take integer part of jd */
-    jd -= b;                    /* subtract integer part to leave fractional part of original jd */
-    b = jd * 8 + 0.5;           /* scale fraction from 0-8 and round by adding 0.5 */
-    b = b & 7;                  /* 0 and 8 are the same phase so modulo 8 for 0 */
-    if (hemisphere == "south")
-        b = 7 - b;
     if (b == 0)
-        return TXT_MOON_NEW; // New;              0%  illuminated
+        return Txt(TXT_MOON_NEW); // New;              0%  illuminated
     if (b == 1)
-        return TXT_MOON_WAXING_CRESCENT; // Waxing crescent; 25%  illuminated
+        return Txt(TXT_MOON_WAXING_CRESCENT); // Waxing crescent; 25%  illuminated
     if (b == 2)
-        return TXT_MOON_FIRST_QUARTER; // First quarter;   50%  illuminated
+        return Txt(TXT_MOON_FIRST_QUARTER); // First quarter;   50%  illuminated
     if (b == 3)
-        return TXT_MOON_WAXING_GIBBOUS; // Waxing gibbous;  75%  illuminated
+        return Txt(TXT_MOON_WAXING_GIBBOUS); // Waxing gibbous;  75%  illuminated
     if (b == 4)
-        return TXT_MOON_FULL; // Full;            100% illuminated
+        return Txt(TXT_MOON_FULL); // Full;            100% illuminated
     if (b == 5)
-        return TXT_MOON_WANING_GIBBOUS; // Waning gibbous;  75%  illuminated
+        return Txt(TXT_MOON_WANING_GIBBOUS); // Waning gibbous;  75%  illuminated
     if (b == 6)
-        return TXT_MOON_THIRD_QUARTER; // Third quarter;   50%  illuminated
+        return Txt(TXT_MOON_THIRD_QUARTER); // Third quarter;   50%  illuminated
     if (b == 7)
-        return TXT_MOON_WANING_CRESCENT; // Waning crescent; 25%  illuminated
+        return Txt(TXT_MOON_WANING_CRESCENT); // Waning crescent; 25%  illuminated
     return "";
 }
 
@@ -909,23 +1186,6 @@ float hPa_to_inHg(float value_hPa)
     return 0.02953 * value_hPa;
 }
 
-int JulianDate(int d, int m, int y)
-{
-    int mm, yy, k1, k2, k3, j;
-    yy = y - (int)((12 - m) / 10);
-    mm = m + 9;
-    if (mm >= 12)
-        mm = mm - 12;
-    k1 = (int)(365.25 * (yy + 4712));
-    k2 = (int)(30.6001 * mm + 0.5);
-    k3 = (int)((int)((yy / 100) + 49) * 0.75) - 38;
-    // 'j' for dates in Julian calendar:
-    j = k1 + k2 + d + 59 + 1;
-    if (j > 2299160)
-        j = j - k3; // 'j' is the Julian date at 12h UT (Universal Time) For Gregorian calendar:
-    return j;
-}
-
 
 // Tasks //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -970,11 +1230,21 @@ void ConfigTask(void *pvParameters)
         Country    = json1["OpenWeather"]["country"].as<String>();
         City       = json1["OpenWeather"]["city"].as<String>();
         Hemisphere = json1["OpenWeather"]["hemisphere"].as<String>();
+        Latitude   = json1["OpenWeather"]["latitude"] | 0.0f;
+        Longitude  = json1["OpenWeather"]["longitude"] | 0.0f;
         Units      = json1["OpenWeather"]["units"].as<String>();
 
         ntpServer = json1["ntp"]["server"].as<String>();
         Timezone = json1["ntp"]["timezone"].as<String>();
 
+        if (json1.containsKey("Language"))
+        {   // Older configs have no key and keep the default tables
+            SetLanguage(json1["Language"] | "");
+            Language = LanguageCode(); // An unknown code keeps the current tables, OWM gets the same language
+        }
+
+        SelectFonts(json1["display"]["fonts"] | "");
+
         // WakeupHour = strtok(json1["schedule_power"]["on_time"].as<const char *>());
         // SleepHour  = json1["schedule_power"]["off_time"].as<String>();
         Serial.println("Config loaded successfully.");
@@ -1227,73 +1497,96 @@ void ProcessSensorDataTask(void *pvParameters)
     }
 }
 
+// One wake cycle: new weather, time, room and astronomy data under dataMutex, so a screen composed meanwhile on the
+// render core sees either the previous set or the new one, then the current screen on the panel
+void WeatherUpdateCycle()
+{
+#if SOAK_TEST
+    SoakAdvanceClock(0); // No NTP without Wi-Fi, the clock starts at the fixture time and moves on per cycle
+#else
+    if (StartWiFi() != WL_CONNECTED)
+        return;
+#if WEB_DEBUG_SERVER
+    setupDebugWEB();
+#endif
+#endif
+    xSemaphoreTake(dataMutex, portMAX_DELAY);
+    if (SetTime() != true)
+    {
+        xSemaphoreGive(dataMutex);
+        return;
+    }
+#if SOAK_TEST
+    bool RxWeather = obtainFixtureData(SOAK_WEATHER_FIXTURE, "weather");
+    bool RxForecast = obtainFixtureData(SOAK_FORECAST_FIXTURE, "forecast");
+#else
+    WiFiClient client;
+    bool RxWeather = false;
+    bool RxForecast = false;
+
+    for (int attempts = 0; attempts < 2 && (!RxWeather || !RxForecast); ++attempts)
+    {
+        if (!RxWeather)
+            RxWeather = obtainWeatherData(client, "weather");
+        if (!RxForecast)
+            RxForecast = obtainWeatherData(client, "forecast");
+    }
+#endif
+    // Trigger sensor readings
+    xSemaphoreGive(SHT4XTriggerSem);
+    xSemaphoreGive(BME280TriggerSem);
+
+    //if (RxWeather && RxForecast)
+    //{
+    Serial.println("Updating display...");
+    if (!framebuffer)
+    {   // Strip rendering pushes bands while drawing, the panel has to be cleared first
+        epd_poweron();
+        Serial.println("EPD POWER ON");
+        epd_clear();
+        Serial.println("EPD CLEAR");
+    }
+
+    if(xSemaphoreTake(dataProcessedSem, pdMS_TO_TICKS(10000)) != pdTRUE)
+    {
+        Serial.println("Failed to take dataProcessedMutex");
+    }
+    ReceiveRoomReadings();
+    ReadBatteryVoltage();
+    UpdateAstronomyCache();
+    xSemaphoreGive(dataMutex);
+    xSemaphoreTake(panelMutex, portMAX_DELAY);
+    DisplayWeather(screenState);
+    epd_update();
+    epd_poweroff_all();
+    xSemaphoreGive(panelMutex);
+    // Serial.println("Stack high watermark: " + String(uxTaskGetStackHighWaterMark(NULL)));
+    // Serial.println("Free heap: " + String(esp_get_free_heap_size()));
+    //}
+}
+
 void WeatherUpdateTask(void *pvParameters)
 {
     while (1)
     {
-        if (StartWiFi() == WL_CONNECTED && SetTime() == true)
-        {
-            WiFiClient client;
-            bool RxWeather = false;
-            bool RxForecast = false;
-
-            for (int attempts = 0; attempts < 2 && (!RxWeather || !RxForecast); ++attempts)
-            {
-                if (!RxWeather)
-                    RxWeather = obtainWeatherData(client, "weather");
-                if (!RxForecast)
-                    RxForecast = obtainWeatherData(client, "forecast");
-            }
-                    // Trigger sensor readings
-        xSemaphoreGive(SHT4XTriggerSem);
-        xSemaphoreGive(BME280TriggerSem);
-            
-            //if (RxWeather && RxForecast)
-            //{   
-                    Serial.println("Updating display...");
-                    epd_poweron();
-                    Serial.println("EPD POWER ON");
-                    epd_clear();
-                    Serial.println("EPD CLEAR");
-
-                    if(xSemaphoreTake(dataProcessedSem, pdMS_TO_TICKS(10000)) != pdTRUE)
-                    {
-                        Serial.println("Failed to take dataProcessedMutex");
-                    }
-                    DisplayWeather(screenState);
-                    epd_update();
-                    epd_poweroff_all();
-                    // Serial.println("Stack high watermark: " + String(uxTaskGetStackHighWaterMark(NULL)));
-                    // Serial.println("Free heap: " + String(esp_get_free_heap_size()));
-            //}
-        }
+        WeatherUpdateCycle();
         Serial.println("Initiating Sleep...");
-        memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
         InitiateSleep(); // Light sleep by default rn
         vTaskDelay(pdMS_TO_TICKS(500));
         //vTaskDelay(MINUTES_TO_TICKS(SleepDuration)); //- TESTS ONLY with InitiateSleep OFF
-        
-
     }
 }
 
-void setup()
+// Creates the queues and semaphores the tasks share, false if any of them is missing
+bool CreateQueuesAndSemaphores()
 {
-    InitialiseSystem();
-    SPIFFS.begin();
-
-    // Configure button interrupt
-    pinMode(USR_BUTTON, INPUT_PULLUP);
-    attachInterrupt(digitalPinToInterrupt(USR_BUTTON), handleButtonPress, RISING);
-
-
     // Create queues with error checking
     sensorDataQueue = xQueueCreate(10, sizeof(TaggedSensorData));
     processedDataQueue = xQueueCreate(10, sizeof(UntaggedSensorData));
     if (sensorDataQueue == NULL || processedDataQueue == NULL) 
     {
         ESP_LOGE("SETUP", "Failed to create queues");
-        return;
+        return false;
     }
     ESP_LOGI("SETUP", "All queues created successfully");
 
@@ -1307,17 +1600,42 @@ void setup()
 
     historyCalcMutex = xSemaphoreCreateMutex();
     i2cMutex = xSemaphoreCreateMutex();
+    renderMutex = xSemaphoreCreateMutex();
+    panelMutex = xSemaphoreCreateMutex();
+    dataMutex = xSemaphoreCreateMutex();
 
-    if (!configSemaphore || !BME280TriggerSem || !SHT4XTriggerSem || !sensorDataReadySem || !dataProcessedSem || !historyCalcMutex || !i2cMutex) 
+    if (!configSemaphore || !BME280TriggerSem || !SHT4XTriggerSem || !sensorDataReadySem || !dataProcessedSem || !historyCalcMutex || !i2cMutex || !renderMutex || !panelMutex || !dataMutex) 
     {
         ESP_LOGE("SETUP", "Failed to create semaphores");
-        return;
+        return false;
     }
     ESP_LOGI("SETUP", "All semaphores created successfully");
-    
+    return true;
+}
 
+void setup()
+{
+    InitialiseSystem();
+#if LANG_BENCHMARK
+    BenchmarkLanguageTables();
+#endif
+#if ASTRONOMY_BENCHMARK
+    BenchmarkAstronomy();
+#endif
+    SPIFFS.begin();
+#if FRAME_SNAPSHOT
+    if (framebuffer && RestoreFrameSnapshot(framebuffer)) // The panel still shows it after a reset or a deep sleep
+        SetPanelShadow(framebuffer);
+#endif
+
+    // Configure button interrupt
+    pinMode(USR_BUTTON, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(USR_BUTTON), handleButtonPress, RISING);
 
 
+    if (!CreateQueuesAndSemaphores())
+        return;
+
     // Create tasks with error checking
     BaseType_t xReturned;
     xReturned = xTaskCreate(ConfigTask, "ConfigTask", 8192, NULL, 1, NULL);
@@ -1350,7 +1668,17 @@ void setup()
         return;
     }
 
+#if DOUBLE_BUFFERING
+    if (framebuffer)
+        StartRenderTask(framebuffer, ComposeScreen);
+    // Panel pushes stay off the render core so composing overlaps them
+    xReturned = xTaskCreatePinnedToCore(WeatherUpdateTask, "WeatherUpdateTask", 8192, NULL, 4, NULL, !RENDER_TASK_CORE);
+#elif RENDER_PROFILE
+    // Cycle counters are per core, keep the renderer on one core while profiling
+    xReturned = xTaskCreatePinnedToCore(WeatherUpdateTask, "WeatherUpdateTask", 8192, NULL, 4, NULL, 1);
+#else
     xReturned = xTaskCreate(WeatherUpdateTask, "WeatherUpdateTask", 8192, NULL, 4, NULL);
+#endif
     if (xReturned != pdPASS) 
     {
         ESP_LOGE("SETUP", "Failed to create WeatherUpdate Task");
@@ -1367,5 +1695,6 @@ void loop()
         ButtonPressed = false; // Reset the flag
         screenState = (screenState + 1) % 3; // Cycle through the 3 screens
         Serial.println("Screen state: " + String(screenState));
+        ShowScreenNow(screenState);
     }
 }
@@ -6,46 +6,71 @@
 #include "epd_driver.h"        // https://github.com/Xinyuan-LilyGO/LilyGo-EPD47
 #include "drawingFunctions.h"
 
+// Room readings after the sensor fusion, passed to the display through processedDataQueue
+typedef struct {
+    float temperature;
+    float humidity;
+    float pressure;
+} UntaggedSensorData;
+
+extern QueueHandle_t processedDataQueue;
+extern SemaphoreHandle_t panelMutex; // Held while a frame goes to the panel and its flash snapshot is written
+extern SemaphoreHandle_t dataProcessedSem;
+extern volatile int screenState;
+
 void InitialiseDisplay();
 void InitialiseSystem();
 void InitiateSleep();
 boolean SetTime();
 uint8_t StartWiFi();
 void StopWiFi();
+bool obtainFixtureData(const char *path, const String &RequestType);
+bool CreateQueuesAndSemaphores();
+void WeatherUpdateCycle();
+
+int ScreenCount();
+unsigned long RenderScreenSnapshot(int screen, uint8_t *buffer);
+void ComposeScreen(int screen, uint8_t *buffer);
+bool RecordScreen(int screen);
+bool RedrawChangedRegions(int screen, uint8_t *buffer);
+void ShowScreenNow(int screen);
 
 void DisplayGeneralInfoSection();
 void DisplayWeatherIcon(int x, int y);
 void DisplayMainWeatherSection(int x, int y);
 void DisplayDisplayWindSection(int x, int y, float angle, float windspeed, int Cradius);
+void DrawCompassRose(int x, int y, int Cradius);
 
-String WindDegToOrdinalDirection(float winddirection);
+const char *WindDegToOrdinalDirection(float winddirection);
 
 void DisplayTemperatureSection(int x, int y);
+void DrawSensorReadingsFrame(int x, int y);
 void DisplaySensorReadings(int x, int y);
 void DisplaySensorReadingsGarden(int x, int y);
+void ReceiveRoomReadings();
 void DisplaySensorReadingsRoom(int x, int y);
 void DisplayForecastTextSection(int x, int y);
-void DisplayPressureSection(int x, int y, float pressure, String slope);
+void DisplayPressureSection(int x, int y, float pressure, const String &slope);
 void DisplayForecastWeather(int x, int y, int index);
 void DisplayAstronomySection(int x, int y);
 
-String MoonPhase(int d, int m, int y, String hemisphere);
+const char *MoonPhaseName(int b);
+void UpdateAstronomyCache();
 
+void DrawForecastFrame(int x, int y);
 void DisplayForecastSection(int x, int y);
-void DisplayConditionsSection(int x, int y, String IconName, IconSize size);
-void DrawPressureAndTrend(int x, int y, float pressure, String slope);
+void DisplayGraphSection(int x, int y);
+void DisplayConditionsSection(int x, int y, const String &IconName, const IconSize &size);
+void DrawPressureAndTrend(int x, int y, float pressure, const String &slope);
 
 void DisplayStatusSection(int x, int y, int rssi);
 
 boolean UpdateLocalTime();
-String ConvertUnixTime(int unix_time);
 
 void edp_update();
 
 void Convert_Readings_to_Imperial();
 float mm_to_inches(float value_mm);
 float hPa_to_inHg(float value_hPa);
-double NormalizedMoonPhase(int d, int m, int y);
-int JulianDate(int d, int m, int y);
 
 #endif // #endif
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include "allocCounter.h"
+
+#if ALLOC_COUNT
+#include "freertos/FreeRTOS.h" // In-built
+#include "freertos/task.h"     // In-built
+
+static volatile TaskHandle_t countedTask = NULL; // Task composing the frame, NULL outside a frame
+static volatile uint32_t allocations = 0;
+static volatile uint32_t allocatedBytes = 0;
+
+extern "C" void *__real_malloc(size_t size);
+extern "C" void *__real_calloc(size_t count, size_t size);
+extern "C" void *__real_realloc(void *ptr, size_t size);
+
+static inline void countAllocation(size_t size)
+{
+    if (countedTask && xTaskGetCurrentTaskHandle() == countedTask)
+    {
+        allocations = allocations + 1;
+        allocatedBytes = allocatedBytes + size;
+    }
+}
+
+// The linker routes every malloc, calloc and realloc call here with --wrap
+extern "C" void *__wrap_malloc(size_t size)
+{
+    countAllocation(size);
+    return __real_malloc(size);
+}
+
+extern "C" void *__wrap_calloc(size_t count, size_t size)
+{
+    countAllocation(count * size);
+    return __real_calloc(count, size);
+}
+
+extern "C" void *__wrap_realloc(void *ptr, size_t size)
+{
+    countAllocation(size);
+    return __real_realloc(ptr, size);
+}
+
+void AllocCountBegin()
+{
+    allocations = 0;
+    allocatedBytes = 0;
+    countedTask = xTaskGetCurrentTaskHandle();
+}
+
+// Stops counting and logs the frame's allocations, returns their number
+uint32_t AllocCountEnd(const char *frameName)
+{
+    countedTask = NULL;
+    ESP_LOGI("ALLOC", "%s: %u heap allocations, %u bytes", frameName, (unsigned)allocations, (unsigned)allocatedBytes);
+    return allocations;
+}
+
+#endif // ALLOC_COUNT
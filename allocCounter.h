@@ -0,0 +1,26 @@
+#ifndef ALLOCCOUNTER_H
+#define ALLOCCOUNTER_H
+
+#include <Arduino.h>           // In-built
+
+// Heap allocations made by the rendering task while it composes one frame, enabled with -DALLOC_COUNT=1
+// together with -Wl,--wrap=malloc -Wl,--wrap=calloc -Wl,--wrap=realloc (see platformio.ini). Allocations of
+// other tasks (Wi-Fi, web server) are not counted. The first frame after boot includes the one-off glyph
+// scratch and inflate buffers, every later frame should report 0.
+#ifndef ALLOC_COUNT
+#define ALLOC_COUNT 0
+#endif
+
+#if ALLOC_COUNT
+
+void AllocCountBegin();
+uint32_t AllocCountEnd(const char *frameName);
+
+#else
+
+#define AllocCountBegin()
+#define AllocCountEnd(frameName)
+
+#endif // ALLOC_COUNT
+
+#endif // ALLOCCOUNTER_H
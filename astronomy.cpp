@@ -0,0 +1,333 @@
+#include "astronomy.h"
+#include "timeFormat.h"
+#include "moon_sprites.h"
+#include <math.h>              // In-built
+
+static const char *TAG = "ASTRO";
+
+#define SUN_RISE_ALTITUDE -0.833f // Refraction and the solar semi-diameter
+#define CIVIL_TWILIGHT -6.0f
+#define SECONDS_PER_DAY 86400
+
+RTC_DATA_ATTR AstronomyDay astronomyDay = {0, NAN, NAN, 0, 0, 0, 0, 0, 0, 0, 0};
+
+static inline double rad(double degrees)
+{
+    return degrees * (M_PI / 180.0);
+}
+
+static inline double deg(double radians)
+{
+    return radians * (180.0 / M_PI);
+}
+
+static inline double normalize(double degrees)
+{
+    degrees = fmod(degrees, 360.0);
+    return degrees < 0 ? degrees + 360.0 : degrees;
+}
+
+static inline double julianDay(double utc)
+{
+    return utc / SECONDS_PER_DAY + 2440587.5;
+}
+
+// NOAA: solar declination (degrees) and equation of time (minutes) at a Julian day
+static void sunPosition(double jd, double &declination, double &equationOfTime)
+{
+    const double T = (jd - 2451545.0) / 36525.0;
+    const double L0 = normalize(280.46646 + T * (36000.76983 + T * 0.0003032));
+    const double M = 357.52911 + T * (35999.05029 - 0.0001537 * T);
+    const double e = 0.016708634 - T * (0.000042037 + 0.0000001267 * T);
+    const double C = sin(rad(M)) * (1.914602 - T * (0.004817 + 0.000014 * T)) + sin(rad(2 * M)) * (0.019993 - 0.000101 * T) +
+                     sin(rad(3 * M)) * 0.000289;
+    const double omega = 125.04 - 1934.136 * T;
+    const double lambda = L0 + C - 0.00569 - 0.00478 * sin(rad(omega));
+    const double epsilon0 = 23.0 + (26.0 + (21.448 - T * (46.815 + T * (0.00059 - T * 0.001813))) / 60.0) / 60.0;
+    const double epsilon = epsilon0 + 0.00256 * cos(rad(omega));
+    declination = deg(asin(sin(rad(epsilon)) * sin(rad(lambda))));
+    const double y = tan(rad(epsilon / 2)) * tan(rad(epsilon / 2));
+    equationOfTime = 4.0 * deg(y * sin(rad(2 * L0)) - 2 * e * sin(rad(M)) + 4 * e * y * sin(rad(M)) * cos(rad(2 * L0)) -
+                               0.5 * y * y * sin(rad(4 * L0)) - 1.25 * e * e * sin(rad(2 * M)));
+}
+
+// Minutes after 00:00 UTC of utcDay for sunrise (rising) or sunset at the altitude, NAN when the sun stays above or below it
+static double sunEventMinutes(double utcDay, double latitude, double longitude, double altitude, bool rising)
+{
+    double minutes = 720.0 - 4.0 * longitude; // Start at solar noon, then refine at the event itself
+    for (int pass = 0; pass < 3; pass++)
+    {
+        double declination, equationOfTime;
+        sunPosition(julianDay(utcDay + minutes * 60.0), declination, equationOfTime);
+        const double cosH = (sin(rad(altitude)) - sin(rad(latitude)) * sin(rad(declination))) /
+                            (cos(rad(latitude)) * cos(rad(declination)));
+        if (cosH < -1.0 || cosH > 1.0)
+            return NAN;
+        const double hourAngle = deg(acos(cosH));
+        minutes = 720.0 - 4.0 * (longitude + (rising ? hourAngle : -hourAngle)) - equationOfTime;
+    }
+    return minutes;
+}
+
+void SunEvents(time_t localMidnight, float latitude, float longitude, float altitude, time_t &rise, time_t &set)
+{
+    // The UTC day holding local noon, the NOAA equations count minutes from its 00:00 UTC
+    const double localNoon = (double)localMidnight + SECONDS_PER_DAY / 2;
+    const double utcDay = floor(localNoon / SECONDS_PER_DAY) * SECONDS_PER_DAY;
+    const double riseMinutes = sunEventMinutes(utcDay, latitude, longitude, altitude, true);
+    const double setMinutes = sunEventMinutes(utcDay, latitude, longitude, altitude, false);
+    rise = isnan(riseMinutes) ? 0 : (time_t)lround(utcDay + riseMinutes * 60.0);
+    set = isnan(setMinutes) ? 0 : (time_t)lround(utcDay + setMinutes * 60.0);
+}
+
+// Meeus chapter 47, the largest terms: geocentric ecliptic longitude and latitude (degrees), distance (km)
+static void moonEcliptic(double d, double &longitude, double &latitude, double &distance)
+{
+    const double L = 218.316 + 13.176396 * d;  // Mean longitude
+    const double D = 297.8502 + 12.190749 * d; // Mean elongation
+    const double M = 357.5291 + 0.98560028 * d; // Sun's mean anomaly
+    const double Mm = 134.963 + 13.064993 * d; // Moon's mean anomaly
+    const double F = 93.272 + 13.229350 * d;   // Argument of latitude
+    longitude = normalize(L + 6.289 * sin(rad(Mm)) + 1.274 * sin(rad(2 * D - Mm)) + 0.658 * sin(rad(2 * D)) + 0.214 * sin(rad(2 * Mm)) -
+                          0.186 * sin(rad(M)) - 0.114 * sin(rad(2 * F)));
+    latitude = 5.128 * sin(rad(F)) + 0.281 * sin(rad(Mm + F)) + 0.278 * sin(rad(Mm - F)) + 0.173 * sin(rad(2 * D - F));
+    distance = 385001.0 - 20905.0 * cos(rad(Mm)) - 3699.0 * cos(rad(2 * D - Mm)) - 2956.0 * cos(rad(2 * D));
+}
+
+static double sunEclipticLongitude(double d)
+{
+    const double M = 357.5291 + 0.98560028 * d;
+    const double C = 1.9148 * sin(rad(M)) + 0.02 * sin(rad(2 * M)) + 0.0003 * sin(rad(3 * M));
+    return normalize(M + C + 180.0 + 102.9372); // Mean anomaly + centre + perihelion of the Earth
+}
+
+// Moon altitude above the horizon correction for rise and set (degrees) at a Unix time
+static double moonAltitude(double utc, double latitude, double longitude)
+{
+    const double d = julianDay(utc) - 2451545.0;
+    double lambda, beta, distance;
+    moonEcliptic(d, lambda, beta, distance);
+    const double epsilon = rad(23.4397);
+    const double rightAscension = atan2(sin(rad(lambda)) * cos(epsilon) - tan(rad(beta)) * sin(epsilon), cos(rad(lambda)));
+    const double declination = asin(sin(rad(beta)) * cos(epsilon) + cos(rad(beta)) * sin(epsilon) * sin(rad(lambda)));
+    const double siderealTime = rad(280.16 + 360.9856235 * d) + rad(longitude);
+    const double hourAngle = siderealTime - rightAscension;
+    const double altitude = asin(sin(rad(latitude)) * sin(declination) + cos(rad(latitude)) * cos(declination) * cos(hourAngle));
+    const double parallax = asin(6378.14 / distance);
+    return deg(altitude) - (0.7275 * deg(parallax) - 0.5667); // 0 at rise and set, refraction and semi-diameter included
+}
+
+// Altitude every hour of the local day, a parabola through each pair of hours finds the crossings (as in suncalc)
+void MoonEvents(time_t localMidnight, float latitude, float longitude, time_t &rise, time_t &set)
+{
+    rise = set = 0;
+    double h0 = moonAltitude(localMidnight, latitude, longitude);
+    for (int hour = 1; hour <= 24 && (!rise || !set); hour += 2)
+    {
+        const double h1 = moonAltitude(localMidnight + hour * 3600.0, latitude, longitude);
+        const double h2 = moonAltitude(localMidnight + (hour + 1) * 3600.0, latitude, longitude);
+        const double a = (h0 + h2) / 2 - h1;
+        const double b = (h2 - h0) / 2;
+        const double xe = a != 0 ? -b / (2 * a) : 0;
+        const double ye = (a * xe + b) * xe + h1;
+        const double discriminant = b * b - 4 * a * h1;
+        int roots = 0;
+        double x1 = 0, x2 = 0;
+        if (a == 0)
+        {
+            if (b != 0 && fabs(-h1 / b) <= 1)
+            {
+                x1 = -h1 / b;
+                roots = 1;
+            }
+        }
+        else if (discriminant >= 0)
+        {
+            const double dx = sqrt(discriminant) / (fabs(a) * 2);
+            x1 = xe - dx;
+            x2 = xe + dx;
+            if (fabs(x1) <= 1)
+                roots++;
+            if (fabs(x2) <= 1)
+                roots++;
+            if (x1 < -1)
+                x1 = x2;
+        }
+        if (roots == 1)
+        {
+            const time_t t = localMidnight + (time_t)lround((hour + x1) * 3600.0);
+            if (h0 < 0)
+            {
+                if (!rise)
+                    rise = t;
+            }
+            else if (!set)
+                set = t;
+        }
+        else if (roots == 2)
+        {
+            const time_t first = localMidnight + (time_t)lround((hour + x1) * 3600.0);
+            const time_t second = localMidnight + (time_t)lround((hour + x2) * 3600.0);
+            if (!rise)
+                rise = ye < 0 ? second : first;
+            if (!set)
+                set = ye < 0 ? first : second;
+        }
+        h0 = h2;
+    }
+}
+
+void MoonPhase(time_t utc, float &phase, float &illumination)
+{
+    const double d = julianDay(utc) - 2451545.0;
+    double lambda, beta, distance;
+    moonEcliptic(d, lambda, beta, distance);
+    const double elongation = normalize(lambda - sunEclipticLongitude(d));
+    phase = (float)(elongation / 360.0);
+    illumination = (float)((1.0 - cos(rad(beta)) * cos(rad(elongation))) / 2.0);
+}
+
+// 0..7 for MoonPhaseName(), centred on the principal phases. The names do not depend on the hemisphere
+int MoonPhaseNameIndex(float phase)
+{
+    return (int)(phase * 8 + 0.5f) & 7;
+}
+
+// Sprite index, mirrored in the southern hemisphere where the moon is lit from the other side
+int MoonSpriteIndex(float phase, bool southernHemisphere)
+{
+    if (southernHemisphere)
+        phase = 1 - phase;
+    return (int)(phase * MOON_SPRITE_PHASES + 0.5f) % MOON_SPRITE_PHASES;
+}
+
+// Recomputes astronomyDay when the local date or the location changed, true when it did
+bool UpdateAstronomy(time_t now, float latitude, float longitude)
+{
+    struct tm local;
+    LocalTimeFields(now, &local);
+    const int32_t dateKey = ((local.tm_year + 1900) * 100 + local.tm_mon + 1) * 100 + local.tm_mday;
+    const bool sameLocation = (isnan(latitude) && isnan(astronomyDay.latitude)) ||
+                              (latitude == astronomyDay.latitude && longitude == astronomyDay.longitude);
+    if (dateKey == astronomyDay.dateKey && sameLocation)
+        return false;
+    const time_t localMidnight = now - (local.tm_hour * 3600 + local.tm_min * 60 + local.tm_sec);
+    AstronomyDay day = {dateKey, latitude, longitude, 0, 0, 0, 0, 0, 0, 0, 0};
+    if (!isnan(latitude) && !isnan(longitude))
+    {
+        SunEvents(localMidnight, latitude, longitude, SUN_RISE_ALTITUDE, day.sunrise, day.sunset);
+        SunEvents(localMidnight, latitude, longitude, CIVIL_TWILIGHT, day.dawn, day.dusk);
+        MoonEvents(localMidnight, latitude, longitude, day.moonrise, day.moonset);
+    }
+    MoonPhase(localMidnight + SECONDS_PER_DAY / 2, day.phase, day.illumination);
+    astronomyDay = day;
+    ESP_LOGI(TAG, "%d: sun %ld-%ld, twilight %ld-%ld, moon %ld-%ld, phase %.3f, lit %.0f%%", (int)dateKey, (long)day.sunrise,
+             (long)day.sunset, (long)day.dawn, (long)day.dusk, (long)day.moonrise, (long)day.moonset, day.phase, day.illumination * 100);
+    return true;
+}
+
+// True when astronomyDay was computed for a real location, its sun times (0 included) are then the answer.
+// 0,0 is what older builds cached with nothing configured.
+bool AstronomyLocationKnown()
+{
+    return !isnan(astronomyDay.latitude) && !isnan(astronomyDay.longitude) &&
+           !(astronomyDay.latitude == 0 && astronomyDay.longitude == 0);
+}
+
+#if ASTRONOMY_BENCHMARK
+typedef struct
+{
+    time_t localMidnight; // UTC
+    float latitude, longitude;
+    time_t sunrise, sunset; // 0 = no such event (polar day or night)
+} SunReference;
+
+typedef struct
+{
+    time_t utc;
+    float phase; // 0, 0.25, 0.5 or 0.75
+} PhaseReference;
+
+// Published sunrise and sunset times to the minute, and principal moon phases to the minute
+static const SunReference sunReferences[] = {
+    {1718928000, 51.4769f, 0.0f, 1718941380, 1719001260},     // Greenwich 2024-06-21: 03:43 and 20:21 UTC
+    {1734739200, 51.4769f, 0.0f, 1734768240, 1734796380},     // Greenwich 2024-12-21: 08:04 and 15:53 UTC
+    {1718856000, 40.7128f, -74.0060f, 1718875500, 1718929860}, // New York 2024-06-20: 05:25 and 20:31 EDT
+    {1718920800, 69.6492f, 18.9553f, 0, 0},                   // Tromsø 2024-06-21: midnight sun
+    {1734735600, 69.6492f, 18.9553f, 0, 0},                   // Tromsø 2024-12-21: polar night
+};
+static const PhaseReference phaseReferences[] = {
+    {1704339000, 0.75f}, // 2024-01-04 03:30 UTC last quarter
+    {1704974220, 0.0f},  // 2024-01-11 11:57 UTC new moon
+    {1705549920, 0.25f}, // 2024-01-18 03:52 UTC first quarter
+    {1706205240, 0.5f},  // 2024-01-25 17:54 UTC full moon
+    {1759808820, 0.5f},  // 2025-10-07 03:47 UTC full moon
+    {1761049500, 0.0f},  // 2025-10-21 12:25 UTC new moon
+};
+
+// A missing event must be missing in the reference too, a present one within tolerance of it
+static bool sunEventMatches(time_t computed, time_t reference)
+{
+    return reference ? computed && labs((long)(computed - reference)) <= ASTRONOMY_SUN_TOLERANCE : computed == 0;
+}
+
+// Compares the sun events and the moon phases with the references, logs every result and returns the number
+// out of tolerance
+int CheckAstronomy()
+{
+    int failures = 0;
+    for (const SunReference &reference : sunReferences)
+    {
+        time_t rise, set;
+        SunEvents(reference.localMidnight, reference.latitude, reference.longitude, SUN_RISE_ALTITUDE, rise, set);
+        const bool pass = sunEventMatches(rise, reference.sunrise) && sunEventMatches(set, reference.sunset);
+        if (reference.sunrise)
+            ESP_LOGI(TAG, "Sun %.2f,%.2f: rise %+ld s, set %+ld s from reference, %s", reference.latitude, reference.longitude,
+                     (long)(rise - reference.sunrise), (long)(set - reference.sunset), pass ? "PASS" : "FAIL");
+        else
+            ESP_LOGI(TAG, "Sun %.2f,%.2f: rise %ld, set %ld, none expected, %s", reference.latitude, reference.longitude,
+                     (long)rise, (long)set, pass ? "PASS" : "FAIL");
+        failures += !pass;
+    }
+    for (const PhaseReference &reference : phaseReferences)
+    {
+        float phase, illumination;
+        MoonPhase(reference.utc, phase, illumination);
+        float error = phase - reference.phase;
+        error -= floorf(error + 0.5f); // Wrap to -0.5..0.5
+        const float errorSeconds = error * 29.530589f * SECONDS_PER_DAY;
+        const bool pass = fabsf(errorSeconds) <= ASTRONOMY_PHASE_TOLERANCE;
+        ESP_LOGI(TAG, "Moon phase at %ld: %.4f, expected %.2f, %+.1f hours, lit %.0f%%, %s", (long)reference.utc, phase,
+                 reference.phase, errorSeconds / 3600, illumination * 100, pass ? "PASS" : "FAIL");
+        failures += !pass;
+    }
+    return failures;
+}
+
+// The check above, the moon events for the same places and the compute time of one day
+void BenchmarkAstronomy()
+{
+    CheckAstronomy();
+    for (const SunReference &reference : sunReferences)
+    {
+        time_t rise, set;
+        MoonEvents(reference.localMidnight, reference.latitude, reference.longitude, rise, set);
+        ESP_LOGI(TAG, "Moon %.2f,%.2f: rise %ld (altitude %.2f°), set %ld (altitude %.2f°)", reference.latitude, reference.longitude,
+                 (long)rise, rise ? moonAltitude(rise, reference.latitude, reference.longitude) : 0.0, (long)set,
+                 set ? moonAltitude(set, reference.latitude, reference.longitude) : 0.0);
+    }
+    const int rounds = 20;
+    unsigned long start = micros();
+    for (int i = 0; i < rounds; i++)
+    {
+        const SunReference &reference = sunReferences[i % 3];
+        time_t rise, set;
+        float phase, illumination;
+        SunEvents(reference.localMidnight, reference.latitude, reference.longitude, SUN_RISE_ALTITUDE, rise, set);
+        SunEvents(reference.localMidnight, reference.latitude, reference.longitude, CIVIL_TWILIGHT, rise, set);
+        MoonEvents(reference.localMidnight, reference.latitude, reference.longitude, rise, set);
+        MoonPhase(reference.localMidnight, phase, illumination);
+    }
+    ESP_LOGI(TAG, "One day computed in %lu us", (micros() - start) / rounds);
+}
+#endif // ASTRONOMY_BENCHMARK
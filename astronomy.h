@@ -0,0 +1,45 @@
+#ifndef ASTRONOMY_H
+#define ASTRONOMY_H
+
+#include <Arduino.h>           // In-built
+#include <time.h>              // In-built
+
+// Offline sun and moon events for the astronomy section, so it renders without the OWM "weather" response.
+// Sun: the NOAA solar calculator equations (sunrise and sunset at -0.833°, civil twilight at -6°), good to about
+// a minute. Moon: the main terms of Meeus' lunar theory (about 0.3°), rise and set found by scanning the
+// altitude over the local day, which is good to a few minutes. The phase (the moon-sun elongation as a fraction
+// of the synodic month) drives both the moon sprite and the phase name. Computed once per local day and location
+// and kept in RTC memory.
+#ifndef ASTRONOMY_BENCHMARK
+#define ASTRONOMY_BENCHMARK 0 // 1 = log the results against reference sun times and moon phases, and the compute time
+#endif
+#define ASTRONOMY_SUN_TOLERANCE 60       // Seconds a sunrise or sunset may be off the reference
+#define ASTRONOMY_PHASE_TOLERANCE 3600   // Seconds a principal moon phase may be off the reference
+
+typedef struct
+{
+    int32_t dateKey;             // Local date as yyyymmdd, 0 = nothing cached
+    float latitude, longitude;   // NAN = location unknown, only the moon phase is valid
+    time_t dawn, sunrise;        // UTC, 0 = no such event on this day (polar day or night)
+    time_t sunset, dusk;
+    time_t moonrise, moonset;    // UTC, 0 = the moon does not rise or set on this day
+    float phase;                 // At local noon: 0 new, 0.25 first quarter, 0.5 full, 0.75 last quarter
+    float illumination;          // Lit fraction of the disc at local noon, 0..1
+} AstronomyDay;
+
+extern AstronomyDay astronomyDay;
+
+bool UpdateAstronomy(time_t now, float latitude, float longitude);
+bool AstronomyLocationKnown();
+void SunEvents(time_t localMidnight, float latitude, float longitude, float altitude, time_t &rise, time_t &set);
+void MoonEvents(time_t localMidnight, float latitude, float longitude, time_t &rise, time_t &set);
+void MoonPhase(time_t utc, float &phase, float &illumination);
+int MoonPhaseNameIndex(float phase);
+int MoonSpriteIndex(float phase, bool southernHemisphere);
+
+#if ASTRONOMY_BENCHMARK
+int CheckAstronomy();
+void BenchmarkAstronomy();
+#endif
+
+#endif // ASTRONOMY_H
@@ -0,0 +1,318 @@
+#include "displayList.h"
+#include "frameDiff.h"
+#include "textRenderer.h"
+#include <esp_heap_caps.h>     // In-built
+
+typedef struct
+{ // What the diff needs of a command once the list itself is gone
+    uint32_t hash;
+    int16_t x0, y0, x1, y1;
+} DiffEntry;
+
+bool displayListRecording = false;
+
+static DrawCommand *commands = NULL;
+static uint8_t *listData = NULL;
+static int commandCount = 0;
+static int dataUsed = 0;
+static bool overflow = false;
+
+typedef struct
+{ // Last list rendered into one frame buffer, double buffering alternates two of them
+    const uint8_t *buffer; // NULL when the slot holds nothing valid
+    DiffEntry *entries;    // Sorted by hash
+    int count;
+} CommittedList;
+
+static CommittedList committed[DISPLAY_LIST_BUFFERS] = {};
+static int nextEvicted = 0;
+static DiffEntry *currentEntries = NULL; // Sorted by hash, built by DisplayListDiff()
+static bool currentBuilt = false;
+
+// PSRAM when there is some, strip rendering boards fall back to internal RAM
+static void *ListAlloc(size_t size)
+{
+    void *p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    return p ? p : heap_caps_malloc(size, MALLOC_CAP_8BIT);
+}
+
+void DisplayListBegin()
+{
+    if (!commands)
+        commands = (DrawCommand *)ListAlloc(MAX_DRAW_COMMANDS * sizeof(DrawCommand));
+    if (!listData)
+        listData = (uint8_t *)ListAlloc(DISPLAY_LIST_DATA);
+    commandCount = 0;
+    dataUsed = 0;
+    currentBuilt = false;
+    overflow = !commands || !listData;
+    displayListRecording = true;
+}
+
+static uint32_t Fnv(uint32_t hash, const void *data, int length)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    for (int i = 0; i < length; i++)
+    {
+        hash ^= p[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Stops recording and hashes the commands, false when the list overflowed and cannot be drawn
+bool DisplayListEnd()
+{
+    displayListRecording = false;
+    if (overflow)
+    {
+        ESP_LOGW("DLIST", "Display list overflow (%d commands, %d data bytes)", commandCount, dataUsed);
+        return false;
+    }
+    for (int i = 0; i < commandCount; i++)
+    {
+        DrawCommand &c = commands[i];
+        uint32_t hash = Fnv(2166136261u, &c.op, 3);
+        hash = Fnv(hash, c.p, sizeof(c.p));
+        c.hash = Fnv(hash, listData + c.dataOffset, c.dataLength);
+    }
+    return true;
+}
+
+void DisplayListRecord(DrawOp op, uint8_t color, uint8_t fill, int x0, int y0, int x1, int y1, const int *params, int paramCount)
+{
+    if (overflow || commandCount == MAX_DRAW_COMMANDS)
+    {
+        overflow = true;
+        return;
+    }
+    dataUsed = (dataUsed + 3) & ~3; // Points, discs and fonts are read in place
+    DrawCommand &c = commands[commandCount++];
+    c = {op, color, fill, (int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1, {0}, (uint16_t)dataUsed, 0, 0};
+    for (int i = 0; i < paramCount && i < 6; i++)
+        c.p[i] = params[i];
+}
+
+// Adds variable data (points, discs, font, string) to the last recorded command
+void DisplayListAppend(const void *data, int length)
+{
+    if (overflow || commandCount == 0 || dataUsed + length > DISPLAY_LIST_DATA)
+    {
+        overflow = true;
+        return;
+    }
+    memcpy(listData + dataUsed, data, length);
+    dataUsed += length;
+    commands[commandCount - 1].dataLength += length;
+}
+
+int DisplayListSize()
+{
+    return commandCount;
+}
+
+static void Replay(const DrawCommand &c)
+{
+    const uint8_t *data = listData + c.dataOffset;
+    switch (c.op)
+    {
+    case DL_SPAN:
+        rasterSpan(c.p[0], c.p[1], c.p[2], c.color);
+        break;
+    case DL_RECT:
+        rasterFillRect(c.p[0], c.p[1], c.p[2], c.p[3], c.color);
+        break;
+    case DL_CIRCLE:
+        rasterCircle(c.p[0], c.p[1], c.p[2], c.color);
+        break;
+    case DL_LINE:
+        rasterLine(c.p[0], c.p[1], c.p[2], c.p[3], c.color);
+        break;
+    case DL_POLYLINE:
+        rasterPolyline((const RasterPoint *)data, c.p[0], c.p[1], c.color);
+        break;
+    case DL_DISC:
+        rasterFillCircle(c.p[0], c.p[1], c.p[2], c.color);
+        break;
+    case DL_RING:
+        rasterFillRing(c.p[0], c.p[1], c.p[2], c.p[3], c.color);
+        break;
+    case DL_CAPSULE:
+        rasterFillCapsule(c.p[0], c.p[1], c.p[2], c.p[3], c.color);
+        break;
+    case DL_TRIANGLE:
+        rasterFillTriangle(c.p[0], c.p[1], c.p[2], c.p[3], c.p[4], c.p[5], c.color);
+        break;
+    case DL_OUTLINED:
+    { // Data: outer discs, inner discs, outer box, inner box
+        const RasterDisc *outer = (const RasterDisc *)data;
+        const RasterBox *boxes = (const RasterBox *)(outer + 2 * c.p[0]);
+        rasterFillOutlined(outer, outer + c.p[0], c.p[0], boxes[0], boxes[1], c.color, c.fill);
+        break;
+    }
+    case DL_TEXT:
+    { // Data: the font, then the NUL terminated string
+        int x = c.p[0], y = c.p[1];
+        textWrite((const GFXfont *)data, (const char *)(data + sizeof(GFXfont)), &x, &y);
+        break;
+    }
+    }
+}
+
+// Replays, in paint order, every command that reaches the current raster target and clip.
+// Abutting spans of one colour on a row (rect outlines, moon rows, dashes drawn pixel by pixel) are batched.
+void DisplayListDraw()
+{
+    int spanX0 = 0, spanX1 = -1, spanY = 0;
+    uint8_t spanColor = 0;
+    for (int i = 0; i < commandCount; i++)
+    {
+        const DrawCommand &c = commands[i];
+        if (!rasterBoxVisible(c.x0, c.y0, c.x1 - c.x0 + 1, c.y1 - c.y0 + 1))
+            continue;
+        if (c.op == DL_SPAN)
+        {
+            if (spanX1 >= spanX0 && c.p[2] == spanY && c.color == spanColor && c.x0 <= spanX1 + 1 && c.x1 >= spanX0 - 1)
+            {
+                spanX0 = min(spanX0, (int)c.x0);
+                spanX1 = max(spanX1, (int)c.x1);
+                continue;
+            }
+            if (spanX1 >= spanX0)
+                rasterSpan(spanX0, spanX1, spanY, spanColor);
+            spanX0 = c.x0;
+            spanX1 = c.x1;
+            spanY = c.p[2];
+            spanColor = c.color;
+            continue;
+        }
+        if (spanX1 >= spanX0)
+        {
+            rasterSpan(spanX0, spanX1, spanY, spanColor);
+            spanX1 = spanX0 - 1;
+        }
+        Replay(c);
+    }
+    if (spanX1 >= spanX0)
+        rasterSpan(spanX0, spanX1, spanY, spanColor);
+}
+
+// Clears a screen region to white and redraws everything of the list that touches it
+void DisplayListRenderRegion(const RasterBox &region)
+{
+    rasterSetClip(region.x, region.y, region.w, region.h);
+    rasterFillRect(region.x, region.y, region.w, region.h, 0xFF);
+    DisplayListDraw();
+    rasterResetClip();
+}
+
+static int CompareEntries(const void *a, const void *b)
+{
+    const uint32_t ha = ((const DiffEntry *)a)->hash, hb = ((const DiffEntry *)b)->hash;
+    return (ha > hb) - (ha < hb);
+}
+
+static bool BuildEntries()
+{
+    if (!currentEntries)
+        currentEntries = (DiffEntry *)ListAlloc(MAX_DRAW_COMMANDS * sizeof(DiffEntry));
+    if (!currentEntries)
+        return false;
+    for (int i = 0; i < commandCount; i++)
+        currentEntries[i] = {commands[i].hash, commands[i].x0, commands[i].y0, commands[i].x1, commands[i].y1};
+    qsort(currentEntries, commandCount, sizeof(DiffEntry), CompareEntries);
+    currentBuilt = true;
+    return true;
+}
+
+static void MarkTiles(bool dirty[FRAME_TILE_ROWS][FRAME_TILE_COLS], const DiffEntry &e)
+{
+    const int c0 = constrain(e.x0 / FRAME_TILE_WIDTH, 0, FRAME_TILE_COLS - 1), c1 = constrain(e.x1 / FRAME_TILE_WIDTH, 0, FRAME_TILE_COLS - 1);
+    const int r0 = constrain(e.y0 / FRAME_TILE_HEIGHT, 0, FRAME_TILE_ROWS - 1), r1 = constrain(e.y1 / FRAME_TILE_HEIGHT, 0, FRAME_TILE_ROWS - 1);
+    for (int r = r0; r <= r1; r++)
+        for (int c = c0; c <= c1; c++)
+            dirty[r][c] = true;
+}
+
+static CommittedList *FindCommitted(const uint8_t *buffer)
+{
+    for (int i = 0; i < DISPLAY_LIST_BUFFERS; i++)
+        if (buffer && committed[i].buffer == buffer)
+            return &committed[i];
+    return NULL;
+}
+
+// Compares the recorded list with the one last committed for buffer. Commands present in only one of them mark
+// their bounding boxes dirty on the 64x60 tile grid; every tile row with changes gives one region from its first
+// to its last dirty tile. Returns the number of regions, the whole screen when there is nothing to compare with.
+int DisplayListDiff(const uint8_t *buffer, RasterBox *regions, int maxRegions)
+{
+    const CommittedList *last = FindCommitted(buffer);
+    if (!last || !BuildEntries() || maxRegions < FRAME_TILE_ROWS)
+    {
+        regions[0] = {0, 0, EPD_WIDTH, EPD_HEIGHT};
+        return 1;
+    }
+    const DiffEntry *previousEntries = last->entries;
+    const int previousCount = last->count;
+    bool dirty[FRAME_TILE_ROWS][FRAME_TILE_COLS] = {};
+    int p = 0, c = 0;
+    while (p < previousCount || c < commandCount)
+    { // Merge walk over both hash-sorted lists, equal hashes cancel out
+        if (c == commandCount || (p < previousCount && previousEntries[p].hash < currentEntries[c].hash))
+            MarkTiles(dirty, previousEntries[p++]);
+        else if (p == previousCount || currentEntries[c].hash < previousEntries[p].hash)
+            MarkTiles(dirty, currentEntries[c++]);
+        else
+        {
+            p++;
+            c++;
+        }
+    }
+    int n = 0;
+    for (int r = 0; r < FRAME_TILE_ROWS; r++)
+    {
+        int first = FRAME_TILE_COLS, last = -1;
+        for (int col = 0; col < FRAME_TILE_COLS; col++)
+        {
+            if (dirty[r][col])
+            {
+                first = min(first, col);
+                last = col;
+            }
+        }
+        if (last >= 0)
+            regions[n++] = {first * FRAME_TILE_WIDTH, r * FRAME_TILE_HEIGHT, (last - first + 1) * FRAME_TILE_WIDTH, FRAME_TILE_HEIGHT};
+    }
+    return n;
+}
+
+// The recorded list is now what buffer shows, keep it for the next diff against that buffer
+void DisplayListCommit(const uint8_t *buffer)
+{
+    if (!currentBuilt && !BuildEntries())
+        return;
+    CommittedList *slot = FindCommitted(buffer);
+    for (int i = 0; !slot && i < DISPLAY_LIST_BUFFERS; i++)
+        if (!committed[i].buffer)
+            slot = &committed[i];
+    if (!slot)
+    {   // More buffers than slots, the oldest one is redrawn in full next time
+        slot = &committed[nextEvicted];
+        nextEvicted = (nextEvicted + 1) % DISPLAY_LIST_BUFFERS;
+    }
+    DiffEntry *t = slot->entries;
+    slot->entries = currentEntries;
+    currentEntries = t;
+    slot->buffer = buffer;
+    slot->count = commandCount;
+    currentBuilt = false;
+}
+
+// buffer was drawn without the list, its next diff has to redraw everything
+void InvalidateDisplayList(const uint8_t *buffer)
+{
+    CommittedList *slot = FindCommitted(buffer);
+    if (slot)
+        slot->buffer = NULL;
+}
@@ -0,0 +1,59 @@
+#ifndef DISPLAYLIST_H
+#define DISPLAYLIST_H
+
+#include <Arduino.h>           // In-built
+#include "epd_driver.h"        // https://github.com/Xinyuan-LilyGO/LilyGo-EPD47
+#include "rasteriser.h"
+
+// Retained display list: while recording, the rasteriser and the text renderer append typed draw commands with
+// screen bounding boxes instead of drawing. One engine replays them in paint order, per band or per region, and
+// a new list is compared with the last rendered one to find the regions that changed.
+#ifndef DISPLAY_LIST
+#define DISPLAY_LIST 0 // 1 = screens are recorded and redrawn from a display list
+#endif
+#define MAX_DRAW_COMMANDS 1024
+#define DISPLAY_LIST_DATA 8192 // Polyline points, outlined shapes, fonts and strings
+#define DISPLAY_LIST_BUFFERS 2 // Frame buffers with their own committed list (double buffering uses two)
+
+typedef enum : uint8_t
+{
+    DL_SPAN,
+    DL_RECT,
+    DL_CIRCLE,
+    DL_LINE,
+    DL_POLYLINE,
+    DL_DISC,
+    DL_RING,
+    DL_CAPSULE,
+    DL_TRIANGLE,
+    DL_OUTLINED,
+    DL_TEXT
+} DrawOp;
+
+typedef struct
+{
+    DrawOp op;
+    uint8_t color;
+    uint8_t fill;           // DL_OUTLINED inner colour
+    int16_t x0, y0, x1, y1; // Bounding box, inclusive screen coordinates
+    int16_t p[6];           // Op parameters
+    uint16_t dataOffset;    // Into the list data pool
+    uint16_t dataLength;
+    uint32_t hash;          // Op, colours, parameters and data, set by DisplayListEnd()
+} DrawCommand;
+
+extern bool displayListRecording;
+
+void DisplayListBegin();
+bool DisplayListEnd();
+void DisplayListRecord(DrawOp op, uint8_t color, uint8_t fill, int x0, int y0, int x1, int y1, const int *params, int paramCount);
+void DisplayListAppend(const void *data, int length);
+int DisplayListSize();
+
+void DisplayListDraw();
+void DisplayListRenderRegion(const RasterBox &region);
+int DisplayListDiff(const uint8_t *buffer, RasterBox *regions, int maxRegions);
+void DisplayListCommit(const uint8_t *buffer);
+void InvalidateDisplayList(const uint8_t *buffer);
+
+#endif // DISPLAYLIST_H
@@ -0,0 +1,109 @@
+#include "doubleBuffer.h"
+#include "freertos/queue.h"    // In-built
+#include "freertos/task.h"     // In-built
+#include <esp_timer.h>         // In-built
+
+typedef struct
+{
+    int screen;
+    uint32_t generation;
+} RenderRequest;
+
+static QueueHandle_t requestQueue = NULL; // RenderRequest, panel task -> render task
+static QueueHandle_t freeQueue = NULL;    // uint8_t *, buffers nobody owns
+static QueueHandle_t readyQueue = NULL;   // RenderedFrame, render task -> panel task
+static void (*compose)(int screen, uint8_t *buffer) = NULL;
+static volatile uint32_t generation = 0;
+
+static void RenderTask(void *parameter)
+{
+    RenderRequest request;
+    uint8_t *buffer;
+    while (1)
+    {
+        xQueueReceive(requestQueue, &request, portMAX_DELAY);
+        xQueueReceive(freeQueue, &buffer, portMAX_DELAY); // Blocks until the panel task releases a frame
+        RenderedFrame frame = {buffer, request.screen, request.generation, esp_timer_get_time(), 0};
+        compose(request.screen, buffer);
+        frame.renderEnd = esp_timer_get_time();
+        xQueueSend(readyQueue, &frame, portMAX_DELAY);
+    }
+}
+
+// Allocates the second frame next to firstBuffer (the framebuffer) and starts the render task.
+// Returns false, leaving the single-buffer path in charge, when memory or the task is not available.
+bool StartRenderTask(uint8_t *firstBuffer, void (*composeScreen)(int screen, uint8_t *buffer))
+{
+    uint8_t *secondBuffer = (uint8_t *)ps_malloc(EPD_WIDTH * EPD_HEIGHT / 2);
+    requestQueue = xQueueCreate(2, sizeof(RenderRequest));
+    freeQueue = xQueueCreate(2, sizeof(uint8_t *));
+    readyQueue = xQueueCreate(2, sizeof(RenderedFrame));
+    if (!secondBuffer || !requestQueue || !freeQueue || !readyQueue)
+    {
+        ESP_LOGW("RENDER", "Double buffering unavailable, rendering in sequence");
+        free(secondBuffer);
+        requestQueue = NULL;
+        return false;
+    }
+    compose = composeScreen;
+    xQueueSend(freeQueue, &firstBuffer, 0);
+    xQueueSend(freeQueue, &secondBuffer, 0);
+    if (xTaskCreatePinnedToCore(RenderTask, "RenderTask", 8192, NULL, 3, NULL, RENDER_TASK_CORE) != pdPASS)
+    {
+        ESP_LOGE("RENDER", "Failed to create Render Task");
+        requestQueue = NULL;
+        return false;
+    }
+    ESP_LOGI("RENDER", "Double buffering on core %d", RENDER_TASK_CORE);
+    return true;
+}
+
+bool RenderTaskRunning()
+{
+    return requestQueue != NULL;
+}
+
+// The weather or sensor data changed, frames composed so far are stale
+void NewRenderGeneration()
+{
+    generation++;
+}
+
+void RequestFrame(int screen)
+{
+    RenderRequest request = {screen, generation};
+    xQueueSend(requestQueue, &request, portMAX_DELAY);
+}
+
+// Receives the frame of screen from the current generation, stale or other frames are released on the way
+bool TakeFrame(int screen, RenderedFrame *frame, TickType_t wait)
+{
+    const TickType_t start = xTaskGetTickCount();
+    while (xQueueReceive(readyQueue, frame, wait - min(wait, xTaskGetTickCount() - start)) == pdTRUE)
+    {
+        if (frame->screen == screen && frame->generation == generation)
+            return true;
+        ReleaseFrame(*frame);
+    }
+    return false;
+}
+
+// Waits for a pre-render to finish without taking the frame, so its timing can be reported
+bool WaitForRenderIdle(RenderedFrame *lastFrame, TickType_t wait)
+{
+    return xQueuePeek(readyQueue, lastFrame, wait) == pdTRUE;
+}
+
+void ReleaseFrame(const RenderedFrame &frame)
+{
+    xQueueSend(freeQueue, &frame.buffer, portMAX_DELAY);
+}
+
+// Logs how much of the panel push was covered by composing the next frame on the other core
+void LogRenderOverlap(const RenderedFrame &frame, int64_t pushStart, int64_t pushEnd)
+{
+    const int64_t overlap = max((int64_t)0, min(pushEnd, frame.renderEnd) - max(pushStart, frame.renderStart));
+    ESP_LOGI("RENDER", "Screen %d composed in %lld us during a %lld us panel push, %lld us overlapped (%d%%)",
+             frame.screen, frame.renderEnd - frame.renderStart, pushEnd - pushStart, overlap,
+             (int)(frame.renderEnd > frame.renderStart ? overlap * 100 / (frame.renderEnd - frame.renderStart) : 0));
+}
@@ -0,0 +1,34 @@
+#ifndef DOUBLEBUFFER_H
+#define DOUBLEBUFFER_H
+
+#include <Arduino.h>           // In-built
+#include "freertos/FreeRTOS.h" // In-built
+#include "epd_driver.h"        // https://github.com/Xinyuan-LilyGO/LilyGo-EPD47
+
+// Double-buffered rendering: two PSRAM frames, a render task pinned to RENDER_TASK_CORE composes screens while
+// the panel task pushes the previous frame. Buffers change hands only through queues: a free buffer is taken by
+// the render task, handed to the panel task as a RenderedFrame and given back with ReleaseFrame().
+#ifndef DOUBLE_BUFFERING
+#define DOUBLE_BUFFERING 1 // 0 = render and push in sequence from one framebuffer
+#endif
+#define RENDER_TASK_CORE 1
+
+typedef struct
+{
+    uint8_t *buffer;
+    int screen;
+    uint32_t generation; // Data generation the frame was composed from, older frames are stale
+    int64_t renderStart; // esp_timer us
+    int64_t renderEnd;
+} RenderedFrame;
+
+bool StartRenderTask(uint8_t *firstBuffer, void (*composeScreen)(int screen, uint8_t *buffer));
+bool RenderTaskRunning();
+void NewRenderGeneration();
+void RequestFrame(int screen);
+bool TakeFrame(int screen, RenderedFrame *frame, TickType_t wait);
+bool WaitForRenderIdle(RenderedFrame *lastFrame, TickType_t wait);
+void ReleaseFrame(const RenderedFrame &frame);
+void LogRenderOverlap(const RenderedFrame &frame, int64_t pushStart, int64_t pushEnd);
+
+#endif // DOUBLEBUFFER_H
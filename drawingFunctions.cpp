@@ -1,21 +1,24 @@
 
 #include "drawingFunctions.h"
 #include "LilyGo-EPD-4-7-OWM-Weather-Display.h"
+#include "moon_sprites.h"
+#include "renderProfiler.h"
+#include "fontPack.h"
+#include "textFormat.h"
+#if ICON_BENCHMARK
+#include "esp_timer.h"         // In-built
+#endif
 
 
-//Icon modifiers: scale, offset, linesize
-const IconSize SmallIcon(8, 10, 5); // Previously sizes were defined as Small - scale 8
-const IconSize MediumIcon(12, 25, 5); 
-const IconSize LargeIcon(20, 35, 5); // Large 20
-
 int wifi_signal, CurrentHour = 0, CurrentMin = 0, CurrentSec = 0, EventCnt = 0, vref = 1100;
+float batteryVoltage = 0;
 
 GFXfont currentFont;
 uint8_t *framebuffer;
 
-void DrawBattery(int x, int y)
+// Samples the battery once per frame, screens may be drawn several times (strip rendering)
+void ReadBatteryVoltage()
 {
-    uint8_t percentage = 100;
     esp_adc_cal_characteristics_t adc_chars;
     esp_adc_cal_value_t val_type = esp_adc_cal_characterize(ADC_UNIT_1, ADC_ATTEN_DB_11, ADC_WIDTH_BIT_12, 1100, &adc_chars);
     if (val_type == ESP_ADC_CAL_VAL_EFUSE_VREF)
@@ -28,10 +31,16 @@ void DrawBattery(int x, int y)
 #else
     const uint8_t bat_adc_pin = 14;
 #endif
-    float voltage = analogRead(bat_adc_pin) / 4096.0 * 6.566 * (vref / 1000.0);
+    batteryVoltage = analogRead(bat_adc_pin) / 4096.0 * 6.566 * (vref / 1000.0);
+}
+
+void DrawBattery(int x, int y)
+{
+    uint8_t percentage = 100;
+    float voltage = batteryVoltage;
     if (voltage > 1)
     { // Only display if there is a valid reading
-        Serial.println("\nVoltage = " + String(voltage));
+        Serial.printf("\nVoltage = %d mV\n", int(voltage * 1000));
         percentage = 2836.9625 * pow(voltage, 4) - 43987.4889 * pow(voltage, 3) + 255233.8134 * pow(voltage, 2) - 656689.7123 * voltage + 632041.7303;
         if (voltage >= 4.20)
             percentage = 100;
@@ -40,7 +49,7 @@ void DrawBattery(int x, int y)
         drawRect(x + 25, y - 14, 40, 15, Black);
         fillRect(x + 65, y - 10, 4, 7, Black);
         fillRect(x + 27, y - 12, 36 * percentage / 100.0, 11, Black);
-        drawString(x + 75, y - 14, String(percentage) + "%  " + String(voltage, 1) + "v", LEFT);
+        drawStringf(x + 75, y - 14, LEFT, "%u%%  %.1fv", percentage, voltage);
     }
 }
 
@@ -65,259 +74,344 @@ void DrawRSSI(int x, int y, int rssi)
     }
 }
 
+// Per-size icon geometry, every offset below is an integer constant once the template is instantiated
+template <IconSizeId Id> struct IconGeometry;
+
+template <> struct IconGeometry<ICON_SMALL>
+{
+    static constexpr int scale = SmallIcon.scale, Offset = SmallIcon.Offset, linesize = SmallIcon.linesize;
+    static constexpr int lift = 3;                                  // Small sun sits slightly higher
+    static constexpr int rayWidth = 1;
+    static constexpr int glyphX = -25, rainY = 12, snowY = 15;      // Rain and snow glyphs under the cloud
+    static constexpr int fogLift = 10, fogLine = 1;
+    static constexpr int moonX = -28, moonY = -37, moonR = scale, shadowX = -20, shadowR = int(scale * 1.6);
+    static const GFXfont &glyphFont() { return OpenSans8B; }
+    static const GFXfont &nodataFont() { return OpenSans12B; }
+};
+
+template <> struct IconGeometry<ICON_MEDIUM>
+{
+    static constexpr int scale = MediumIcon.scale, Offset = MediumIcon.Offset, linesize = MediumIcon.linesize;
+    static constexpr int lift = 0;
+    static constexpr int rayWidth = 1;
+    static constexpr int glyphX = -38, rainY = 17, snowY = 20;
+    static constexpr int fogLift = 0, fogLine = linesize;
+    static constexpr int moonX = -45, moonY = -65, moonR = int(scale * 0.9), shadowX = -33, shadowR = int(scale * 1.6);
+    static const GFXfont &glyphFont() { return OpenSans12B; }
+    static const GFXfont &nodataFont() { return OpenSans18B; }
+};
+
+template <> struct IconGeometry<ICON_LARGE>
+{
+    static constexpr int scale = LargeIcon.scale, Offset = LargeIcon.Offset, linesize = LargeIcon.linesize;
+    static constexpr int lift = 0;
+    static constexpr int rayWidth = 4;                              // Large icon used to stack 4 offset diagonals
+    static constexpr int glyphX = -60, rainY = 25, snowY = 30;
+    static constexpr int fogLift = 0, fogLine = linesize;
+    static constexpr int moonX = -85, moonY = -100, moonR = int(scale * 0.8), shadowX = -57, shadowR = int(scale * 1.6);
+    static const GFXfont &glyphFont() { return OpenSans18B; }
+    static const GFXfont &nodataFont() { return OpenSans24B; }
+};
+
 // Symbols are drawn on a relative 10x10grid and 1 scale unit = 1 drawing unit
-void addcloud(int x, int y, int scale, int linesize)
+// The outline and the cleared interior are rasterised in a single pass, each pixel is written once
+template <int Scale, int Linesize>
+void addcloud(int x, int y)
 {
-    fillCircle(x - scale * 3, y, scale, Black);                                                              // Left most circle
-    fillCircle(x + scale * 3, y, scale, Black);                                                              // Right most circle
-    fillCircle(x - scale, y - scale, scale * 1.4, Black);                                                    // left middle upper circle
-    fillCircle(x + scale * 1.5, y - scale * 1.3, scale * 1.75, Black);                                       // Right middle upper circle
-    fillRect(x - scale * 3 - 1, y - scale, scale * 6, scale * 2 + 1, Black);                                 // Upper and lower lines
-    fillCircle(x - scale * 3, y, scale - linesize, White);                                                   // Clear left most circle
-    fillCircle(x + scale * 3, y, scale - linesize, White);                                                   // Clear right most circle
-    fillCircle(x - scale, y - scale, scale * 1.4 - linesize, White);                                         // left middle upper circle
-    fillCircle(x + scale * 1.5, y - scale * 1.3, scale * 1.75 - linesize, White);                            // Right middle upper circle
-    fillRect(x - scale * 3 + 2, y - scale + linesize - 1, scale * 5.9, scale * 2 - linesize * 2 + 2, White); // Upper and lower lines
+    constexpr int upperLeftR = int(Scale * 1.4), upperRightR = int(Scale * 1.75);
+    constexpr int upperRightX = int(Scale * 1.5), upperRightY = int(Scale * 1.3);
+    const RasterDisc outer[] = {
+        {x - Scale * 3, y, Scale},                                           // Left most circle
+        {x + Scale * 3, y, Scale},                                           // Right most circle
+        {x - Scale, y - Scale, upperLeftR},                                  // left middle upper circle
+        {x + upperRightX, y - upperRightY, upperRightR}};                    // Right middle upper circle
+    const RasterDisc inner[] = {
+        {x - Scale * 3, y, Scale - Linesize},                                // Clear left most circle
+        {x + Scale * 3, y, Scale - Linesize},                                // Clear right most circle
+        {x - Scale, y - Scale, int(Scale * 1.4 - Linesize)},                 // left middle upper circle
+        {x + upperRightX, y - upperRightY, int(Scale * 1.75 - Linesize)}};   // Right middle upper circle
+    const RasterBox outerBox = {x - Scale * 3 - 1, y - Scale, Scale * 6, Scale * 2 + 1};                                  // Upper and lower lines
+    const RasterBox innerBox = {x - Scale * 3 + 2, y - Scale + Linesize - 1, int(Scale * 5.9), Scale * 2 - Linesize * 2 + 2}; // Upper and lower lines
+    rasterFillOutlined(outer, inner, 4, outerBox, innerBox, Black, White);
 }
 
-void addrain(int x, int y, int scale, const IconSize &size)
+template <IconSizeId Id>
+void addrain(int x, int y)
 {
-    if (&size == &SmallIcon)
-    {
-        setFont(OpenSans8B);
-        drawString(x - 25, y + 12, "///////", LEFT);
-    }
-    else if(&size == &LargeIcon)
-    {
-        setFont(OpenSans18B);
-        drawString(x - 60, y + 25, "///////", LEFT);
-    }
+    typedef IconGeometry<Id> G;
+    setFont(G::glyphFont());
+    drawString(x + G::glyphX, y + G::rainY, "///////", LEFT);
 }
 
-void addsnow(int x, int y, int scale, const IconSize &size)
+template <IconSizeId Id>
+void addsnow(int x, int y)
 {
-    if (&size == &SmallIcon)
-    {
-        setFont(OpenSans8B);
-        drawString(x - 25, y + 15, "* * * *", LEFT);
-    }
-    else if(&size == &LargeIcon)
-    {
-        setFont(OpenSans18B);
-        drawString(x - 60, y + 30, "* * * *", LEFT);
-    }
+    typedef IconGeometry<Id> G;
+    setFont(G::glyphFont());
+    drawString(x + G::glyphX, y + G::snowY, "* * * *", LEFT);
 }
 
-void addtstorm(int x, int y, int scale)
+template <IconSizeId Id>
+void addtstorm(int x, int y)
 {
+    constexpr int scale = IconGeometry<Id>::scale;
+    constexpr int width = (Id != ICON_SMALL) ? 3 : 1; // Larger bolts were three stacked 1px lines
+    constexpr int shift = width / 2;                  // Those were offset by +1 and +2, keep the same centre
     y = y + scale / 2;
     for (int i = 0; i < 5; i++)
     {
-        drawLine(x - scale * 4 + scale * i * 1.5 + 0, y + scale * 1.5, x - scale * 3.5 + scale * i * 1.5 + 0, y + scale, Black);
-        if (scale != SmallIcon.scale)
-        {
-            drawLine(x - scale * 4 + scale * i * 1.5 + 1, y + scale * 1.5, x - scale * 3.5 + scale * i * 1.5 + 1, y + scale, Black);
-            drawLine(x - scale * 4 + scale * i * 1.5 + 2, y + scale * 1.5, x - scale * 3.5 + scale * i * 1.5 + 2, y + scale, Black);
-        }
-        drawLine(x - scale * 4 + scale * i * 1.5, y + scale * 1.5 + 0, x - scale * 3 + scale * i * 1.5 + 0, y + scale * 1.5 + 0, Black);
-        if (scale != SmallIcon.scale)
-        {
-            drawLine(x - scale * 4 + scale * i * 1.5, y + scale * 1.5 + 1, x - scale * 3 + scale * i * 1.5 + 0, y + scale * 1.5 + 1, Black);
-            drawLine(x - scale * 4 + scale * i * 1.5, y + scale * 1.5 + 2, x - scale * 3 + scale * i * 1.5 + 0, y + scale * 1.5 + 2, Black);
-        }
-        drawLine(x - scale * 3.5 + scale * i * 1.4 + 0, y + scale * 2.5, x - scale * 3 + scale * i * 1.5 + 0, y + scale * 1.5, Black);
-        if (scale != SmallIcon.scale)
-        {
-            drawLine(x - scale * 3.5 + scale * i * 1.4 + 1, y + scale * 2.5, x - scale * 3 + scale * i * 1.5 + 1, y + scale * 1.5, Black);
-            drawLine(x - scale * 3.5 + scale * i * 1.4 + 2, y + scale * 2.5, x - scale * 3 + scale * i * 1.5 + 2, y + scale * 1.5, Black);
-        }
+        const RasterPoint bolt[] = {
+            {int(x - scale * 3.5 + scale * i * 1.5) + shift, int(y + scale)},
+            {int(x - scale * 4 + scale * i * 1.5) + shift, int(y + scale * 1.5) + shift},
+            {int(x - scale * 3 + scale * i * 1.5) + shift, int(y + scale * 1.5) + shift},
+            {int(x - scale * 3.5 + scale * i * 1.4) + shift, int(y + scale * 2.5)}};
+        rasterPolyline(bolt, 4, width, Black);
     }
 }
 
-void addsun(int x, int y, int scale, const IconSize &size)
-{
-    int linesize = size.linesize;
-    fillRect(x - scale * 2, y, scale * 4, linesize, Black);
-    fillRect(x, y - scale * 2, linesize, scale * 4, Black);
-    drawLine(x - scale * 1.3, y - scale * 1.3, x + scale * 1.3, y + scale * 1.3, Black);
-    drawLine(x - scale * 1.3, y + scale * 1.3, x + scale * 1.3, y - scale * 1.3, Black);
-    if (&size == &LargeIcon)
+template <IconSizeId Id, int Scale>
+void addsun(int x, int y)
+{
+    constexpr int linesize = IconGeometry<Id>::linesize;
+    constexpr int gap = int(Scale * 1.3);                             // Rays stop where the white gap around the sun starts
+    constexpr int diag = int(Scale * 1.3), diagInner = int(Scale * 0.92); // 1.3 / sqrt(2), start of the diagonal rays outside the gap
+    constexpr int rayWidth = IconGeometry<Id>::rayWidth;
+    constexpr int rayShift = rayWidth / 2;
+    fillRect(x - Scale * 2, y, Scale * 2 - gap, linesize, Black);
+    fillRect(x + gap + 1, y, Scale * 2 - gap - 1, linesize, Black);
+    fillRect(x, y - Scale * 2, linesize, Scale * 2 - gap, Black);
+    fillRect(x, y + gap + 1, linesize, Scale * 2 - gap - 1, Black);
+    rasterThickLine(x - diag + rayShift, y - diag, x - diagInner + rayShift, y - diagInner, rayWidth, Black);
+    rasterThickLine(x + diagInner + rayShift, y + diagInner, x + diag + rayShift, y + diag, rayWidth, Black);
+    rasterThickLine(x - diag + rayShift, y + diag, x - diagInner + rayShift, y + diagInner, rayWidth, Black);
+    rasterThickLine(x + diagInner + rayShift, y - diagInner, x + diag + rayShift, y - diag, rayWidth, Black);
+    rasterFillRing(x, y, gap, Scale, White);              // Gap between the rays and the sun
+    rasterFillRing(x, y, Scale, Scale - linesize, Black); // Sun outline
+    rasterFillCircle(x, y, Scale - linesize, White);      // Clear sun centre
+}
+
+template <IconSizeId Id, int Scale>
+void addfog(int x, int y)
+{
+    typedef IconGeometry<Id> G;
+    y -= G::fogLift;
+    for (int i = 0; i < 6; i++)
     {
-        drawLine(1 + x - scale * 1.3, y - scale * 1.3, 1 + x + scale * 1.3, y + scale * 1.3, Black);
-        drawLine(2 + x - scale * 1.3, y - scale * 1.3, 2 + x + scale * 1.3, y + scale * 1.3, Black);
-        drawLine(3 + x - scale * 1.3, y - scale * 1.3, 3 + x + scale * 1.3, y + scale * 1.3, Black);
-        drawLine(1 + x - scale * 1.3, y + scale * 1.3, 1 + x + scale * 1.3, y - scale * 1.3, Black);
-        drawLine(2 + x - scale * 1.3, y + scale * 1.3, 2 + x + scale * 1.3, y - scale * 1.3, Black);
-        drawLine(3 + x - scale * 1.3, y + scale * 1.3, 3 + x + scale * 1.3, y - scale * 1.3, Black);
+        fillRect(x - Scale * 3, y + int(Scale * 1.5), Scale * 6, G::fogLine, Black);
+        fillRect(x - Scale * 3, y + Scale * 2, Scale * 6, G::fogLine, Black);
+        fillRect(x - Scale * 3, y + int(Scale * 2.5), Scale * 6, G::fogLine, Black);
     }
-    fillCircle(x, y, scale * 1.3, White);
-    fillCircle(x, y, scale, Black);
-    fillCircle(x, y, scale - linesize, White);
 }
 
-void addfog(int x, int y, int scale, int linesize, const IconSize &size)
+template <IconSizeId Id>
+void addmoon(int x, int y)
 {
-    if (&size == &SmallIcon)
-    {
-        y -= 10;
-        linesize = 1;
-    }
-    for (int i = 0; i < 6; i++)
-    {
-        fillRect(x - scale * 3, y + scale * 1.5, scale * 6, linesize, Black);
-        fillRect(x - scale * 3, y + scale * 2.0, scale * 6, linesize, Black);
-        fillRect(x - scale * 3, y + scale * 2.5, scale * 6, linesize, Black);
-    }
+    typedef IconGeometry<Id> G;
+    y += G::Offset;
+    fillCircle(x + G::moonX, y + G::moonY, G::moonR, Black);
+    fillCircle(x + G::shadowX, y + G::moonY, G::shadowR, White);
 }
 
-void Sunny(int x, int y, const IconSize &size, String IconName)
+// Sun peeking out from the top left of the cloud
+template <IconSizeId Id>
+void addsmallsun(int x, int y)
 {
-    int scale = size.scale; 
-    int Offset = size.Offset;
-
-    if(&size == &SmallIcon){
-        y = y - 3; // Shift small sun icon slightly up
-    }
-
-    if (IconName.endsWith("n")){
-        addmoon(x, y + Offset, scale, size);
-    }
-    scale = scale * 1.6;
-    addsun(x, y, scale, size);
+    constexpr int scale = IconGeometry<Id>::scale;
+    constexpr int shift = int(scale * 1.8);
+    addsun<Id, scale>(x - shift, y - shift);
 }
 
-void MostlySunny(int x, int y, IconSize size, String IconName)
+template <IconSizeId Id>
+void addmaincloud(int x, int y)
 {
-    int scale = size.scale; 
-    int Offset = size.Offset;
-    int linesize = size.linesize;
-
-    if (IconName.endsWith("n")){
-        addmoon(x, y + Offset, scale, size);}
-    addsun(x - scale * 1.8, y - scale * 1.8, scale, size);
-    addcloud(x, y, scale, linesize);
+    addcloud<IconGeometry<Id>::scale, IconGeometry<Id>::linesize>(x, y);
 }
 
-void MostlyCloudy(int x, int y, IconSize size, String IconName)
+template <IconSizeId Id>
+void Sunny(int x, int y, bool night)
 {
-    int scale = size.scale; 
-    int Offset = size.Offset;
-    int linesize = size.linesize;
-
-    if (IconName.endsWith("n"))
-        addmoon(x, y + Offset, scale, size);
-    addcloud(x, y, scale, linesize);
-    addsun(x - scale * 1.8, y - scale * 1.8, scale, size);
+    typedef IconGeometry<Id> G;
+    y -= G::lift;
+    if (night)
+        addmoon<Id>(x, y);
+    addsun<Id, int(G::scale * 1.6)>(x, y);
 }
 
-void Cloudy(int x, int y, IconSize size, String IconName)
+template <IconSizeId Id>
+void MostlySunny(int x, int y, bool night)
 {
-    int scale = size.scale; 
-    int Offset = size.Offset;
-    int linesize = size.linesize;
-
-    if (IconName.endsWith("n"))
-        addmoon(x, y + Offset, scale, size);
-    addcloud(x + 15, y - 22, scale / 2, linesize); // Cloud top right
-    addcloud(x - 10, y - 18, scale / 2, linesize); // Cloud top left
-    addcloud(x, y, scale, linesize);               // Main cloud
+    if (night)
+        addmoon<Id>(x, y);
+    addsmallsun<Id>(x, y);
+    addmaincloud<Id>(x, y);
 }
 
-void Rain(int x, int y, IconSize size, String IconName)
+template <IconSizeId Id>
+void MostlyCloudy(int x, int y, bool night)
 {
-    int scale = size.scale; 
-    int Offset = size.Offset;
-    int linesize = size.linesize;
-
-    if (IconName.endsWith("n"))
-        addmoon(x, y + Offset, scale, size);
-    addcloud(x, y, scale, linesize);
-    addrain(x, y, scale, size);
+    if (night)
+        addmoon<Id>(x, y);
+    addmaincloud<Id>(x, y);
+    addsmallsun<Id>(x, y);
 }
 
-void ExpectRain(int x, int y, IconSize size, String IconName)
+template <IconSizeId Id>
+void Cloudy(int x, int y, bool night)
 {
-    int scale = size.scale; 
-    int Offset = size.Offset;
-    int linesize = size.linesize;
+    typedef IconGeometry<Id> G;
+    if (night)
+        addmoon<Id>(x, y);
+    addcloud<G::scale / 2, G::linesize>(x + 15, y - 22); // Cloud top right
+    addcloud<G::scale / 2, G::linesize>(x - 10, y - 18); // Cloud top left
+    addmaincloud<Id>(x, y);                              // Main cloud
+}
 
-    if (IconName.endsWith("n"))
-        addmoon(x, y + Offset, scale, size);
-    addsun(x - scale * 1.8, y - scale * 1.8, scale, size);
-    addcloud(x, y, scale, linesize);
-    addrain(x, y, scale, size);
+template <IconSizeId Id>
+void Rain(int x, int y, bool night)
+{
+    if (night)
+        addmoon<Id>(x, y);
+    addmaincloud<Id>(x, y);
+    addrain<Id>(x, y);
 }
 
-void ChanceRain(int x, int y, IconSize size, String IconName)
+template <IconSizeId Id>
+void ExpectRain(int x, int y, bool night)
 {
-    int scale = size.scale; 
-    int Offset = size.Offset;
-    int linesize = size.linesize;
+    if (night)
+        addmoon<Id>(x, y);
+    addsmallsun<Id>(x, y);
+    addmaincloud<Id>(x, y);
+    addrain<Id>(x, y);
+}
 
-    if (IconName.endsWith("n"))
-        addmoon(x, y + Offset, scale, size);
-    addsun(x - scale * 1.8, y - scale * 1.8, scale, size);
-    addcloud(x, y, scale, linesize);
-    addrain(x, y, scale, size);
+template <IconSizeId Id>
+void ChanceRain(int x, int y, bool night)
+{
+    ExpectRain<Id>(x, y, night);
 }
 
-void Tstorms(int x, int y, IconSize size, String IconName)
+template <IconSizeId Id>
+void Tstorms(int x, int y, bool night)
 {
-    int scale = size.scale; 
-    int Offset = size.Offset;
-    int linesize = size.linesize;
+    if (night)
+        addmoon<Id>(x, y);
+    addmaincloud<Id>(x, y);
+    addtstorm<Id>(x, y);
+}
 
-    if (IconName.endsWith("n"))
-        addmoon(x, y + Offset, scale, size);
-    addcloud(x, y, scale, linesize);
-    addtstorm(x, y, scale);
+template <IconSizeId Id>
+void Snow(int x, int y, bool night)
+{
+    if (night)
+        addmoon<Id>(x, y);
+    addmaincloud<Id>(x, y);
+    addsnow<Id>(x, y);
 }
 
-void Snow(int x, int y, IconSize size, String IconName)
+template <IconSizeId Id>
+void Fog(int x, int y, bool night)
 {
-    int scale = size.scale; 
-    int Offset = size.Offset;
-    int linesize = size.linesize;
+    if (night)
+        addmoon<Id>(x, y);
+    addmaincloud<Id>(x, y - 5);
+    addfog<Id, IconGeometry<Id>::scale>(x, y - 5);
+}
 
-    if (IconName.endsWith("n"))
-        addmoon(x, y + Offset, scale, size);
-    addcloud(x, y, scale, linesize);
-    addsnow(x, y, scale, size);
+template <IconSizeId Id>
+void Haze(int x, int y, bool night)
+{
+    constexpr int scale = int(IconGeometry<Id>::scale * 1.4);
+    if (night)
+        addmoon<Id>(x, y);
+    addsun<Id, scale>(x, y - 5);
+    addfog<Id, scale>(x, y - 5);
 }
 
-void Fog(int x, int y, IconSize size, String IconName)
+template <IconSizeId Id>
+void Nodata(int x, int y)
 {
-    int scale = size.scale; 
-    int Offset = size.Offset;
-    int linesize = size.linesize;
+    setFont(IconGeometry<Id>::nodataFont());
+    drawString(x - 3, y - 10, "?", CENTER);
+}
 
-    if (IconName.endsWith("n"))
-        addmoon(x, y + Offset, scale, size);
-    addcloud(x, y - 5, scale, linesize);
-    addfog(x, y - 5, scale, linesize, size);
+// Maps an OpenWeatherMap icon code onto the icon drawn at one size
+template <IconSizeId Id>
+void DrawIcon(int x, int y, const String &IconName)
+{
+    const bool night = IconName.length() > 0 && IconName[IconName.length() - 1] == 'n';
+    if (IconName == "01d" || IconName == "01n")
+        Sunny<Id>(x, y, night);
+    else if (IconName == "02d" || IconName == "02n")
+        MostlySunny<Id>(x, y, night);
+    else if (IconName == "03d" || IconName == "03n")
+        Cloudy<Id>(x, y, night);
+    else if (IconName == "04d" || IconName == "04n")
+        MostlySunny<Id>(x, y, night);
+    else if (IconName == "09d" || IconName == "09n")
+        ChanceRain<Id>(x, y, night);
+    else if (IconName == "10d" || IconName == "10n")
+        Rain<Id>(x, y, night);
+    else if (IconName == "11d" || IconName == "11n")
+        Tstorms<Id>(x, y, night);
+    else if (IconName == "13d" || IconName == "13n")
+        Snow<Id>(x, y, night);
+    else if (IconName == "50d")
+        Haze<Id>(x, y, night);
+    else if (IconName == "50n")
+        Fog<Id>(x, y, night);
+    else
+        Nodata<Id>(x, y);
+}
+
+// One instantiation per size, the size only selects which one runs
+void DrawWeatherIcon(int x, int y, const String &IconName, const IconSize &size)
+{
+    switch (size.id)
+    {
+    case ICON_SMALL:
+        DrawIcon<ICON_SMALL>(x, y, IconName);
+        break;
+    case ICON_MEDIUM:
+        DrawIcon<ICON_MEDIUM>(x, y, IconName);
+        break;
+    case ICON_LARGE:
+        DrawIcon<ICON_LARGE>(x, y, IconName);
+        break;
+    }
 }
 
-void Haze(int x, int y, IconSize size, String IconName)
+#if ICON_BENCHMARK
+// Draws every icon code at every size into the current target and logs the average time per icon
+void BenchmarkIcons()
 {
-    int scale = size.scale; 
-    int Offset = size.Offset;
-    int linesize = size.linesize;
-
-    if (IconName.endsWith("n"))
-        addmoon(x, y + Offset, scale, size);
-    addsun(x, y - 5, scale * 1.4, size);
-    addfog(x, y - 5, scale * 1.4, linesize, size);
+    static const char *const names[] = {"01d", "01n", "02d", "03d", "09d", "10d", "11d", "13d", "50d", "50n", "xx"};
+    static const IconSize *const sizes[] = {&SmallIcon, &MediumIcon, &LargeIcon};
+    static const char *const sizeNames[] = {"small", "medium", "large"};
+    const int rounds = 10;
+    for (int s = 0; s < 3; s++)
+    {
+        for (const char *name : names)
+        {
+            const String iconName(name);
+            const int64_t start = esp_timer_get_time();
+            for (int r = 0; r < rounds; r++)
+                DrawWeatherIcon(EPD_WIDTH / 2, EPD_HEIGHT / 2, iconName, *sizes[s]);
+            ESP_LOGI("ICONS", "%-6s %s: %lld us", sizeNames[s], name, (esp_timer_get_time() - start) / rounds);
+        }
+    }
 }
+#endif
 
 void CloudCover(int x, int y, int CCover)
 {
-    addcloud(x - 9, y + 2 + 5, SmallIcon.scale * 0.3, 2); // Cloud top left
-    addcloud(x + 3, y - 2 + 5, SmallIcon.scale * 0.3, 2); // Cloud top right
-    addcloud(x, y + 10 + 5, SmallIcon.scale * 0.6, 2);    // Main cloud
-    drawString(x + 25, y, String(CCover) + "%", LEFT);
+    addcloud<int(SmallIcon.scale * 0.3), 2>(x - 9, y + 2 + 5); // Cloud top left
+    addcloud<int(SmallIcon.scale * 0.3), 2>(x + 3, y - 2 + 5); // Cloud top right
+    addcloud<int(SmallIcon.scale * 0.6), 2>(x, y + 10 + 5);    // Main cloud
+    drawStringf(x + 25, y, LEFT, "%d%%", CCover);
 }
 
-void Visibility(int x, int y, String Visi)
+void Visibility(int x, int y, const char *Visi)
 {
     float start_angle = 0.52, end_angle = 2.61, Offset = 8;
     int r = 14;
@@ -337,187 +431,88 @@ void Visibility(int x, int y, String Visi)
     drawString(x + 20, y, Visi, LEFT);
 }
 
-void addmoon(int x, int y, int scale, const IconSize &size)
-{
-    if (&size == &LargeIcon)
-    {
-        fillCircle(x - 85, y - 100, uint16_t(scale * 0.8), Black);
-        fillCircle(x - 57, y - 100, uint16_t(scale * 1.6), White);
-    }
-    else if (&size == &SmallIcon)
-    {
-        fillCircle(x - 28, y - 37, uint16_t(scale * 1.0), Black);
-        fillCircle(x - 20, y - 37, uint16_t(scale * 1.6), White);
-    }
-}
-
-void Nodata(int x, int y, IconSize &size, String IconName)
-{
-    if (&size == &LargeIcon)
-        setFont(OpenSans24B);
-    else if(&size == &SmallIcon){
-        setFont(OpenSans12B);
-    }
-    drawString(x - 3, y - 10, "?", CENTER);
-}
-
-/* (C) D L BIRD
-    This function will draw a graph on a ePaper/TFT/LCD display using data from an array containing data to be graphed.
-    The variable 'max_readings' determines the maximum number of data elements for each array. Call it with the following parametric data:
-    x_pos-the x axis top-left position of the graph
-    y_pos-the y-axis top-left position of the graph, e.g. 100, 200 would draw the graph 100 pixels along and 200 pixels down from the top-left of the screen
-    width-the width of the graph in pixels
-    height-height of the graph in pixels
-    Y1_Max-sets the scale of plotted data, for example 5000 would scale all data to a Y-axis of 5000 maximum
-    data_array1 is parsed by value, externally they can be called anything else, e.g. within the routine it is called data_array1, but externally could be temperature_readings
-    auto_scale-a logical value (TRUE or FALSE) that switches the Y-axis autoscale On or Off
-    barchart_on-a logical value (TRUE or FALSE) that switches the drawing mode between barhcart and line graph
-    barchart_colour-a sets the title and graph plotting colour
-    If called with Y!_Max value of 500 and the data never goes above 500, then autoscale will retain a 0-500 Y scale, if on, the scale increases/decreases to match the data.
-    auto_scale_margin, e.g. if set to 1000 then autoscale increments the scale by 1000 steps.
-*/
-void DrawGraph(int x_pos, int y_pos, int gwidth, int gheight, float Y1Min, float Y1Max, String title, float DataArray[], int readings, boolean auto_scale, boolean barchart_mode)
-{
-#define auto_scale_margin 0 // Sets the autoscale increment, so axis steps up fter a change of e.g. 3
-#define y_minor_axis 5      // 5 y-axis division markers
-    setFont(OpenSans10B);
-    int maxYscale = -10000;
-    int minYscale = 10000;
-    int last_x, last_y;
-    float x2, y2;
-    if (auto_scale == true)
-    {
-        for (int i = 1; i < readings; i++)
-        {
-            if (DataArray[i] >= maxYscale)
-                maxYscale = DataArray[i];
-            if (DataArray[i] <= minYscale)
-                minYscale = DataArray[i];
-        }
-        maxYscale = round(maxYscale + auto_scale_margin); // Auto scale the graph and round to the nearest value defined, default was Y1Max
-        Y1Max = round(maxYscale + 0.5);
-        if (minYscale != 0)
-            minYscale = round(minYscale - auto_scale_margin); // Auto scale the graph and round to the nearest value defined, default was Y1Min
-        Y1Min = round(minYscale);
-    }
-    // Draw the graph
-    last_x = x_pos + 1;
-    last_y = y_pos + (Y1Max - constrain(DataArray[1], Y1Min, Y1Max)) / (Y1Max - Y1Min) * gheight;
-    drawRect(x_pos, y_pos, gwidth + 3, gheight + 2, Grey);
-    drawString(x_pos - 20 + gwidth / 2, y_pos - 28, title, CENTER);
-    for (int gx = 0; gx < readings; gx++)
-    {
-        x2 = x_pos + gx * gwidth / (readings - 1) - 1; // max_readings is the global variable that sets the maximum data that can be plotted
-        y2 = y_pos + (Y1Max - constrain(DataArray[gx], Y1Min, Y1Max)) / (Y1Max - Y1Min) * gheight + 1;
-        if (barchart_mode)
-        {
-            fillRect(last_x + 2, y2, (gwidth / readings) - 1, y_pos + gheight - y2 + 2, Black);
-        }
-        else
-        {
-            drawLine(last_x, last_y - 1, x2, y2 - 1, Black); // Two lines for hi-res display
-            drawLine(last_x, last_y, x2, y2, Black);
-        }
-        last_x = x2;
-        last_y = y2;
-    }
-    //Draw the Y-axis scale
-#define number_of_dashes 20
-    for (int spacing = 0; spacing <= y_minor_axis; spacing++)
-    {
-        for (int j = 0; j < number_of_dashes; j++)
-        { // Draw dashed graph grid lines
-            if (spacing < y_minor_axis)
-                drawFastHLine((x_pos + 3 + j * gwidth / number_of_dashes), y_pos + (gheight * spacing / y_minor_axis), gwidth / (2 * number_of_dashes), Grey);
-        }
-        if ((Y1Max - (float)(Y1Max - Y1Min) / y_minor_axis * spacing) < 5 || title == TXT_PRESSURE_IN)
-        {
-            drawString(x_pos - 10, y_pos + gheight * spacing / y_minor_axis - 5, String((Y1Max - (float)(Y1Max - Y1Min) / y_minor_axis * spacing + 0.01), 1), RIGHT);
-        }
-        else
-        {
-            if (Y1Min < 1 && Y1Max < 10)
-            {
-                drawString(x_pos - 3, y_pos + gheight * spacing / y_minor_axis - 5, String((Y1Max - (float)(Y1Max - Y1Min) / y_minor_axis * spacing + 0.01), 1), RIGHT);
-            }
-            else
-            {
-                drawString(x_pos - 7, y_pos + gheight * spacing / y_minor_axis - 5, String((Y1Max - (float)(Y1Max - Y1Min) / y_minor_axis * spacing + 0.01), 0), RIGHT);
-            }
-        }
-    }
-    for (int i = 0; i < 3; i++)
-    {
-        drawString(20 + x_pos + gwidth / 3 * i, y_pos + gheight + 10, String(i) + "d", LEFT);
-        if (i < 2)
-            drawFastVLine(x_pos + gwidth / 3 * i + gwidth / 3, y_pos, gheight, LightGrey);
-    }
-}
-
-void drawString(int x, int y, String text, alignment align)
+void drawString(int x, int y, const char *text, alignment align)
 {
-    char *data = const_cast<char *>(text.c_str());
+    PROFILE_SECTION("drawString"); // Text cost across all sections
     int x1, y1; //the bounds of x,y and w and h of the variable 'text' in pixels.
     int w, h;
-    int xx = x, yy = y;
-    get_text_bounds(&currentFont, data, &xx, &yy, &x1, &y1, &w, &h, NULL);
+    textBounds(&currentFont, text, x, y, &x1, &y1, &w, &h);
     if (align == RIGHT)
         x = x - w;
     if (align == CENTER)
         x = x - w / 2;
     int cursor_y = y + h;
-    write_string(&currentFont, data, &x, &cursor_y, framebuffer);
+    textWrite(&currentFont, text, &x, &cursor_y);
+}
+
+void drawString(int x, int y, const String &text, alignment align)
+{
+    drawString(x, y, text.c_str(), align);
+}
+
+// Formats into a stack buffer (textFormat.h, floats as fixed point) and draws it, no heap use
+void drawStringf(int x, int y, alignment align, const char *format, ...)
+{
+    char text[DRAW_STRINGF_SIZE];
+    va_list args;
+    va_start(args, format);
+    vformatText(text, sizeof(text), format, args);
+    va_end(args);
+    drawString(x, y, text, align);
 }
 
 void fillCircle(int x, int y, int r, uint8_t color)
 {
-    epd_fill_circle(x, y, r, color, framebuffer);
+    rasterFillCircle(x, y, r, color);
 }
 
 void drawFastHLine(int16_t x0, int16_t y0, int length, uint16_t color)
 {
-    epd_draw_hline(x0, y0, length, color, framebuffer);
+    rasterSpan(x0, x0 + length - 1, y0, color);
 }
 
 void drawFastVLine(int16_t x0, int16_t y0, int length, uint16_t color)
 {
-    epd_draw_vline(x0, y0, length, color, framebuffer);
+    rasterFillRect(x0, y0, 1, length, color);
 }
 
 void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
 {
-    epd_write_line(x0, y0, x1, y1, color, framebuffer);
+    rasterLine(x0, y0, x1, y1, color);
 }
 
 void drawCircle(int x0, int y0, int r, uint8_t color)
 {
-    epd_draw_circle(x0, y0, r, color, framebuffer);
+    rasterCircle(x0, y0, r, color);
 }
 
 void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
-    epd_draw_rect(x, y, w, h, color, framebuffer);
+    rasterSpan(x, x + w - 1, y, color);
+    rasterSpan(x, x + w - 1, y + h - 1, color);
+    rasterFillRect(x, y + 1, 1, h - 2, color);
+    rasterFillRect(x + w - 1, y + 1, 1, h - 2, color);
 }
 
 void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
-    epd_fill_rect(x, y, w, h, color, framebuffer);
+    rasterFillRect(x, y, w, h, color);
 }
 
 void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
                   int16_t x2, int16_t y2, uint16_t color)
 {
-    epd_fill_triangle(x0, y0, x1, y1, x2, y2, color, framebuffer);
+    rasterFillTriangle(x0, y0, x1, y1, x2, y2, color);
 }
 
 void drawPixel(int x, int y, uint8_t color)
 {
-    epd_draw_pixel(x, y, color, framebuffer);
+    rasterPixel(x, y, color);
 }
 
 void setFont(GFXfont const &font)
 {
-    currentFont = font;
+    currentFont = ResolveFont(font); // A packed font picked in config.json may stand in for it
 }
 
 void arrow(int x, int y, int asize, float aangle, int pwidth, int plength)
@@ -540,50 +535,25 @@ void arrow(int x, int y, int asize, float aangle, int pwidth, int plength)
     fillTriangle(xx1, yy1, xx3, yy3, xx2, yy2, Black);
 }
 
-void DrawSegment(int x, int y, int o1, int o2, int o3, int o4, int o11, int o12, int o13, int o14)
+// Two joined segments (o1,o2)->(o3,o4)->(o5,o6) drawn as one polyline so the joint is written once
+void DrawSegment(int x, int y, int o1, int o2, int o3, int o4, int o5, int o6, int width)
 {
-    drawLine(x + o1, y + o2, x + o3, y + o4, Black);
-    drawLine(x + o11, y + o12, x + o13, y + o14, Black);
+    const RasterPoint points[] = {{x + o1, y + o2}, {x + o3, y + o4}, {x + o5, y + o6}};
+    rasterPolyline(points, 3, width, Black);
 }
 
-void DrawMoon(int x, int y, int dd, int mm, int yy, String hemisphere)
+// Moon phase is a blit of a precomputed sprite (see tools/moon_sprites.py), no trigonometry per frame
+void DrawMoon(int x, int y, int phaseIndex)
 {
     const int diameter = 75;
-    double Phase = NormalizedMoonPhase(dd, mm, yy);
-    hemisphere.toLowerCase();
-    if (hemisphere == "south")
-        Phase = 1 - Phase;
+    const uint8_t (*spans)[2] = MoonSpriteSpans[phaseIndex % MOON_SPRITE_PHASES];
     // Draw dark part of moon
     fillCircle(x + diameter - 1, y + diameter, diameter / 2 + 1, LightGrey);
-    const int number_of_lines = 90;
-    for (double Ypos = 0; Ypos <= number_of_lines / 2; Ypos++)
+    // Draw light part of moon
+    for (int row = 0; row < MOON_SPRITE_ROWS; row++)
     {
-        double Xpos = sqrt(number_of_lines / 2 * number_of_lines / 2 - Ypos * Ypos);
-        // Determine the edges of the lighted part of the moon
-        double Rpos = 2 * Xpos;
-        double Xpos1, Xpos2;
-        if (Phase < 0.5)
-        {
-            Xpos1 = -Xpos;
-            Xpos2 = Rpos - 2 * Phase * Rpos - Xpos;
-        }
-        else
-        {
-            Xpos1 = Xpos;
-            Xpos2 = Xpos - 2 * Phase * Rpos + Rpos;
-        }
-        // Draw light part of moon
-        double pW1x = (Xpos1 + number_of_lines) / number_of_lines * diameter + x;
-        double pW1y = (number_of_lines - Ypos) / number_of_lines * diameter + y;
-        double pW2x = (Xpos2 + number_of_lines) / number_of_lines * diameter + x;
-        double pW2y = (number_of_lines - Ypos) / number_of_lines * diameter + y;
-        double pW3x = (Xpos1 + number_of_lines) / number_of_lines * diameter + x;
-        double pW3y = (Ypos + number_of_lines) / number_of_lines * diameter + y;
-        double pW4x = (Xpos2 + number_of_lines) / number_of_lines * diameter + x;
-        double pW4y = (Ypos + number_of_lines) / number_of_lines * diameter + y;
-        drawLine(pW1x, pW1y, pW2x, pW2y, White);
-        drawLine(pW3x, pW3y, pW4x, pW4y, White);
+        if (spans[row][0] <= spans[row][1])
+            rasterSpan(x + spans[row][0], x + spans[row][1], y + MOON_SPRITE_ROW0 + row, White);
     }
     drawCircle(x + diameter - 1, y + diameter, diameter / 2, Black);
 }
-
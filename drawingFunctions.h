@@ -24,6 +24,8 @@
 
 #include "lang.h"
 #include "forecast_record.h"
+#include "rasteriser.h"
+#include "textRenderer.h"
 
 //#include "LilyGo-EPD-4-7-OWM-Weather-Display.h"
 
@@ -38,35 +40,64 @@
 #define barchart_on   true
 #define barchart_off  false
 
+#define DRAW_STRINGF_SIZE 96 // Stack buffer of drawStringf(), longer text is cut off
+
 extern int wifi_signal;
 extern int CurrentHour;
 extern int CurrentMin;
 extern int CurrentSec;
 extern int EventCnt;
 extern int vref;
-
-//fonts
-#include "opensans8b.h"
-#include "opensans10b.h"
-#include "opensans12b.h"
-#include "opensans18b.h"
-#include "opensans24b.h"
+extern float batteryVoltage;
+
+//fonts, defined once in fonts.cpp
+#ifndef FONT_SUBSET
+#define FONT_SUBSET 0 // 1 = glyph subsets generated by tools/fontsubset.py, only what the firmware renders
+#endif
+#define FONT_ZLIB 0 // Glyph encodings of the large fonts, tools/fontencode.py writes the raw and RLE headers
+#define FONT_RAW 1  // Largest in flash, no decode
+#define FONT_RLE 2  // About 15% larger than zlib, decoded without inflate
+#ifndef FONT_ENCODING_18B
+#define FONT_ENCODING_18B FONT_ZLIB
+#endif
+#ifndef FONT_ENCODING_24B
+#define FONT_ENCODING_24B FONT_ZLIB
+#endif
+extern const GFXfont OpenSans8B;
+extern const GFXfont OpenSans10B;
+extern const GFXfont OpenSans12B;
+extern const GFXfont OpenSans18B;
+extern const GFXfont OpenSans24B;
 
 extern GFXfont currentFont;
 extern uint8_t *framebuffer;
 
+#ifndef ICON_BENCHMARK
+#define ICON_BENCHMARK 0 // 1 = log the draw time of every icon at every size before each frame
+#endif
+
+enum IconSizeId
+{
+    ICON_SMALL,
+    ICON_MEDIUM,
+    ICON_LARGE
+};
+
+// Icon modifiers: scale, offset, linesize. The drawing code is instantiated once per size (IconGeometry in
+// drawingFunctions.cpp), so every coordinate derived from these folds into an integer constant
 class IconSize{
 public:
+    IconSizeId id;
     int scale;
     int Offset;
     int linesize;
 
-    IconSize(int s, int o, int l) : scale(s), Offset(o), linesize(l) {}
+    constexpr IconSize(IconSizeId i, int s, int o, int l) : id(i), scale(s), Offset(o), linesize(l) {}
 };
 
-extern const IconSize SmallIcon;
-extern const IconSize MediumIcon;
-extern const IconSize LargeIcon;
+constexpr IconSize SmallIcon(ICON_SMALL, 8, 10, 5); // Previously sizes were defined as Small - scale 8
+constexpr IconSize MediumIcon(ICON_MEDIUM, 12, 25, 5);
+constexpr IconSize LargeIcon(ICON_LARGE, 20, 35, 5); // Large 20
 
 
 enum alignment
@@ -78,40 +109,25 @@ enum alignment
 
 
 
+void ReadBatteryVoltage();
 void DrawBattery(int x, int y);
 void DrawRSSI(int x, int y, int rssi);
 
-void addcloud(int x, int y, int scale, int linesize);
-void addrain(int x, int y, int scale, const IconSize &size);
-void addsnow(int x, int y, int scale, const IconSize &size);
-void addtstorm(int x, int y, int scale);
-void addsun(int x, int y, int scale, const IconSize &size);
-void addfog(int x, int y, int scale, int linesize, const IconSize &size);
-
-void Sunny(int x, int y, const IconSize &size, String IconName);
-void MostlySunny(int x, int y, IconSize size, String IconName);
-void MostlyCloudy(int x, int y, IconSize size, String IconName);
-void Cloudy(int x, int y, IconSize size, String IconName);
-void Rain(int x, int y, IconSize size, String IconName);
-void ExpectRain(int x, int y, IconSize size, String IconName);
-void ChanceRain(int x, int y, IconSize size, String IconName);
-void Tstorms(int x, int y, IconSize size, String IconName);
-void Snow(int x, int y, IconSize size, String IconName);
-void Fog(int x, int y, IconSize size, String IconName);
-void Haze(int x, int y, IconSize size, String IconName);
+void DrawWeatherIcon(int x, int y, const String &IconName, const IconSize &size);
+#if ICON_BENCHMARK
+void BenchmarkIcons();
+#endif
 
 void CloudCover(int x, int y, int CCover);
-void Visibility(int x, int y, String Visi);
-
-void addmoon(int x, int y, int scale, const IconSize &size);
-void Nodata(int x, int y, IconSize &size, String IconName);
+void Visibility(int x, int y, const char *Visi);
 
-void DrawGraph(int x_pos, int y_pos, int gwidth, int gheight, float Y1Min, float Y1Max, String title, float DataArray[], int readings, boolean auto_scale, boolean barchart_mode);
 void arrow(int x, int y, int asize, float aangle, int pwidth, int plength);
-void DrawSegment(int x, int y, int o1, int o2, int o3, int o4, int o11, int o12, int o13, int o14);
-void DrawMoon(int x, int y, int dd, int mm, int yy, String hemisphere);
+void DrawSegment(int x, int y, int o1, int o2, int o3, int o4, int o5, int o6, int width);
+void DrawMoon(int x, int y, int phaseIndex);
 
-void drawString(int x, int y, String text, alignment align);
+void drawString(int x, int y, const char *text, alignment align);
+void drawString(int x, int y, const String &text, alignment align);
+void drawStringf(int x, int y, alignment align, const char *format, ...) __attribute__((format(printf, 4, 5)));
 void fillCircle(int x, int y, int r, uint8_t color);
 void drawFastHLine(int16_t x0, int16_t y0, int length, uint16_t color);
 void drawFastVLine(int16_t x0, int16_t y0, int length, uint16_t color);
@@ -0,0 +1,186 @@
+#include "fastUpdate.h"
+#include "rasteriser.h"
+#include <time.h>              // In-built
+
+#define ROW_BYTES (EPD_WIDTH / 2)
+
+RTC_DATA_ATTR uint16_t fastUpdatesSinceFull = 0;
+RTC_DATA_ATTR time_t lastFullRefresh = 0;
+
+static RasterBox regions[FAST_SCREENS][FAST_REGIONS];
+static volatile int regionCount[FAST_SCREENS];
+static int markScreen = -1;           // Screen being composed, MarkFastRegion() adds to its list
+static int fastScreen = 0;            // Screen of the prepared fast update
+static RasterBox dirty[FAST_REGIONS]; // Pixels to drive per region, w == 0 when clean
+static uint8_t *shadow = NULL; // What the panel shows, the binarised pixels of fast updates included
+static bool shadowValid = false;
+
+static inline uint8_t pixelAt(const uint8_t *frame, int x, int y)
+{
+    const uint8_t b = frame[y * ROW_BYTES + x / 2];
+    return (x & 1) ? b >> 4 : b & 0x0F;
+}
+
+static inline void setShadowPixel(int x, int y, uint8_t v)
+{
+    uint8_t *b = shadow + y * ROW_BYTES + x / 2;
+    *b = (x & 1) ? (*b & 0x0F) | (v << 4) : (*b & 0xF0) | v;
+}
+
+// Starts the region list of a screen, called under the render mutex before its screen functions run. Another
+// screen's regions stay untouched, the panel task may be pushing that one.
+void BeginFastRegions(int screen)
+{
+    markScreen = screen >= 0 && screen < FAST_SCREENS ? screen : -1;
+    if (markScreen >= 0)
+        regionCount[markScreen] = 0;
+}
+
+// Regions are fixed by the layout of each screen, they are marked on every compose and duplicates are ignored
+void MarkFastRegion(int x, int y, int w, int h)
+{
+    if (markScreen < 0)
+        return;
+    x = max(x, 0);
+    y = max(y, 0);
+    w = min(w, EPD_WIDTH - x);
+    h = min(h, EPD_HEIGHT - y);
+    RasterBox *list = regions[markScreen];
+    const int count = regionCount[markScreen];
+    for (int i = 0; i < count; i++)
+        if (list[i].x == x && list[i].y == y && list[i].w == w && list[i].h == h)
+            return;
+    if (count == FAST_REGIONS || w <= 0 || h <= 0)
+        return;
+    list[count] = {x, y, w, h};
+    regionCount[markScreen] = count + 1; // Published after the box, the panel task may be reading
+}
+
+// Records the frame the panel now shows, called after every grayscale update
+void SetPanelShadow(const uint8_t *frame)
+{
+    if (!shadow)
+        shadow = (uint8_t *)ps_malloc(ROW_BYTES * EPD_HEIGHT);
+    if (!shadow)
+        return;
+    memcpy(shadow, frame, ROW_BYTES * EPD_HEIGHT);
+    shadowValid = true;
+}
+
+// Records one redrawn area after a partial update, the rest of the panel keeps what it showed before
+void SetPanelShadowArea(const uint8_t *frame, const Rect_t &area)
+{
+    if (!shadowValid)
+        return;
+    const int offset = area.x / 2, bytes = area.width / 2;
+    for (int y = area.y; y < area.y + area.height; y++)
+        memcpy(shadow + y * ROW_BYTES + offset, frame + y * ROW_BYTES + offset, bytes);
+}
+
+static int regionOf(int x, int y)
+{
+    const RasterBox *list = regions[fastScreen];
+    for (int i = 0; i < regionCount[fastScreen]; i++)
+        if (x >= list[i].x && x < list[i].x + list[i].w && y >= list[i].y && y < list[i].y + list[i].h)
+            return i;
+    return -1;
+}
+
+// True when all pixels of the changed tiles that differ from the panel lie in the fast regions of the screen
+bool PrepareFastUpdate(const bool changed[FRAME_TILE_ROWS][FRAME_TILE_COLS], int screen)
+{
+    if (!FAST_UPDATE || !shadowValid || screen < 0 || screen >= FAST_SCREENS || regionCount[screen] == 0)
+        return false;
+    fastScreen = screen;
+    for (int i = 0; i < FAST_REGIONS; i++)
+        dirty[i].w = 0;
+    for (int row = 0; row < FRAME_TILE_ROWS; row++)
+    {
+        for (int col = 0; col < FRAME_TILE_COLS; col++)
+        {
+            if (!changed[row][col])
+                continue;
+            for (int y = row * FRAME_TILE_HEIGHT; y < (row + 1) * FRAME_TILE_HEIGHT; y++)
+            {
+                const uint8_t *fb = framebuffer + y * ROW_BYTES, *sh = shadow + y * ROW_BYTES;
+                for (int x = col * FRAME_TILE_WIDTH; x < (col + 1) * FRAME_TILE_WIDTH; x += 2)
+                {
+                    if (fb[x / 2] == sh[x / 2])
+                        continue; // Both pixels unchanged
+                    for (int px = x; px < x + 2; px++)
+                    {
+                        const uint8_t v = pixelAt(framebuffer, px, y);
+                        if (v == pixelAt(shadow, px, y))
+                            continue;
+                        const int r = regionOf(px, y);
+                        if (r < 0)
+                            return false;
+                        if ((v >= 8 ? 15 : 0) == pixelAt(shadow, px, y))
+                            continue; // Already shows the binarised value
+                        RasterBox &d = dirty[r];
+                        if (d.w == 0)
+                            d = {px, y, 1, 1};
+                        const int x1 = max(d.x + d.w, px + 1), y1 = max(d.y + d.h, y + 1);
+                        d.x = min(d.x, px);
+                        d.y = min(d.y, y);
+                        d.w = x1 - d.x;
+                        d.h = y1 - d.y;
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Drives the dirty pixels of every region to black or white, the panel must be powered
+void ApplyFastUpdate()
+{
+    for (int i = 0; i < regionCount[fastScreen]; i++)
+    {
+        if (dirty[i].w == 0)
+            continue;
+        Rect_t area = {dirty[i].x & ~7, dirty[i].y, 0, dirty[i].h}; // 1-bit rows are whole bytes
+        area.width = ((dirty[i].x + dirty[i].w - area.x) + 7) & ~7;
+        const int stride = area.width / 8;
+        uint8_t *toBlack = (uint8_t *)calloc(2 * stride * area.height, 1);
+        if (!toBlack)
+            continue; // Stays as it is until the next grayscale update
+        uint8_t *toWhite = toBlack + stride * area.height;
+        for (int y = area.y; y < area.y + area.height; y++)
+        {
+            for (int x = area.x; x < min(area.x + area.width, EPD_WIDTH); x++)
+            {
+                const uint8_t v = pixelAt(framebuffer, x, y), was = pixelAt(shadow, x, y);
+                const uint8_t target = v >= 8 ? 15 : 0;
+                if (v == was || target == was || regionOf(x, y) != i)
+                    continue;
+                const int bit = (y - area.y) * area.width + (x - area.x); // First pixel in the lowest bit
+                (target ? toWhite : toBlack)[bit / 8] |= 1 << (bit & 7);
+                setShadowPixel(x, y, target);
+            }
+        }
+        for (int c = 0; c < FAST_UPDATE_CYCLES; c++)
+        {
+            epd_draw_frame_1bit(area, toBlack, BLACK_ON_WHITE, FAST_UPDATE_PULSE);
+            epd_draw_frame_1bit(area, toWhite, WHITE_ON_BLACK, FAST_UPDATE_PULSE);
+        }
+        free(toBlack);
+        ESP_LOGI("FAST", "Region %d: %dx%d at %d,%d", i, area.width, area.height, area.x, area.y);
+    }
+    fastUpdatesSinceFull++;
+}
+
+// Ghosting builds up with every fast update, a full grayscale refresh clears it
+bool GhostingRefreshDue()
+{
+    if (fastUpdatesSinceFull == 0)
+        return false;
+    return fastUpdatesSinceFull >= FAST_UPDATE_MAX_PARTIALS || time(NULL) - lastFullRefresh >= FAST_UPDATE_FULL_INTERVAL;
+}
+
+void NoteFullRefresh()
+{
+    fastUpdatesSinceFull = 0;
+    lastFullRefresh = time(NULL);
+}
@@ -0,0 +1,36 @@
+#ifndef FASTUPDATE_H
+#define FASTUPDATE_H
+
+#include <Arduino.h>           // In-built
+#include "epd_driver.h"        // https://github.com/Xinyuan-LilyGO/LilyGo-EPD47
+#include "frameDiff.h"
+
+// Fast monochrome updates for small readouts (clock, room sensor values, battery and RSSI). When every pixel that
+// changed since the last push lies in a marked region, only those pixels are driven to black or white with a few
+// short 1-bit pulses instead of clearing and redrawing 16 gray levels. Text in the regions shows binarised until
+// the ghosting scheduler forces a full grayscale refresh, after FAST_UPDATE_MAX_PARTIALS fast updates or once
+// FAST_UPDATE_FULL_INTERVAL has passed since the last one.
+#ifndef FAST_UPDATE
+#define FAST_UPDATE 1 // 0 = every change goes through the grayscale partial or full update
+#endif
+#ifndef FAST_UPDATE_MAX_PARTIALS
+#define FAST_UPDATE_MAX_PARTIALS 10
+#endif
+#ifndef FAST_UPDATE_FULL_INTERVAL
+#define FAST_UPDATE_FULL_INTERVAL (6 * 3600) // Seconds
+#endif
+#define FAST_REGIONS 8 // Per screen
+#define FAST_SCREENS 4 // Screens with their own region list, higher ones get no fast updates
+#define FAST_UPDATE_CYCLES 4 // Pulses per colour, tune with FAST_UPDATE_PULSE for the panel's contrast
+#define FAST_UPDATE_PULSE 50 // Row time passed to epd_draw_frame_1bit()
+
+void BeginFastRegions(int screen);
+void MarkFastRegion(int x, int y, int w, int h);
+void SetPanelShadow(const uint8_t *frame);
+void SetPanelShadowArea(const uint8_t *frame, const Rect_t &area);
+bool PrepareFastUpdate(const bool changed[FRAME_TILE_ROWS][FRAME_TILE_COLS], int screen);
+void ApplyFastUpdate();
+bool GhostingRefreshDue();
+void NoteFullRefresh();
+
+#endif // FASTUPDATE_H
@@ -0,0 +1,155 @@
+#include "fontPack.h"
+#include "drawingFunctions.h"
+#if FONT_PACK
+#include "esp_partition.h"     // In-built
+#endif
+
+static_assert(sizeof(GFXglyph) == 16 && sizeof(UnicodeInterval) == 12, "tools/fontpack.py writes this table layout");
+
+typedef struct
+{ // Directory entry, written by tools/fontpack.py
+    char name[24];
+    uint32_t offset;
+    uint32_t size;
+} PackEntry;
+
+typedef struct
+{ // Start of every packed font, followed by the glyph table, the intervals and the bitmap
+    char magic[4];
+    uint32_t glyphCount;
+    uint32_t intervalCount;
+    uint32_t bitmapSize;
+    uint8_t compressed;
+    uint8_t advanceY;
+    int16_t ascender;
+    int16_t descender;
+    uint16_t reserved;
+} PackFont;
+
+typedef struct
+{ // A compiled-in font and the packed font drawn in its place
+    const char *name;
+    const GFXfont *compiled;
+    GFXfont packed;
+    bool active;
+} FontSlot;
+
+static FontSlot slots[] = {{"OpenSans8B", &OpenSans8B}, {"OpenSans10B", &OpenSans10B}, {"OpenSans12B", &OpenSans12B},
+                           {"OpenSans18B", &OpenSans18B}, {"OpenSans24B", &OpenSans24B}};
+static_assert(sizeof(slots) / sizeof(slots[0]) <= FONT_PACK_SLOTS, "More compiled-in fonts than slots");
+
+static const uint8_t *pack = NULL; // Mapped partition, stays mapped until the next reset
+static uint32_t packSize = 0;
+
+#if FONT_PACK
+// Maps the font partition once, false without partition or with an unwritten one
+static bool mapPack()
+{
+    if (pack)
+        return true;
+    const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)FONT_PACK_SUBTYPE, FONT_PACK_LABEL);
+    if (!partition)
+        return false;
+    const void *mapped;
+    spi_flash_mmap_handle_t handle;
+    esp_err_t err = esp_partition_mmap(partition, 0, partition->size, SPI_FLASH_MMAP_DATA, &mapped, &handle);
+    if (err != ESP_OK)
+    {
+        ESP_LOGW("FONT", "Font partition mmap failed: %d", err);
+        return false;
+    }
+    if (memcmp(mapped, "FPK1", 4) != 0)
+    {
+        ESP_LOGW("FONT", "Font partition holds no font pack");
+        return false; // The mapping is kept, MMU pages are not worth the unmap bookkeeping here
+    }
+    pack = (const uint8_t *)mapped;
+    packSize = partition->size;
+    return true;
+}
+#endif
+
+// A font from the pack as a GFXfont pointing into flash, NULL if the pack or the font is missing or damaged
+const GFXfont *FindPackedFont(const char *name)
+{
+    static GFXfont found;
+#if FONT_PACK
+    if (!mapPack())
+        return NULL;
+    uint32_t count;
+    memcpy(&count, pack + 4, 4);
+    const PackEntry *entries = (const PackEntry *)(pack + 8);
+    if (8 + count * sizeof(PackEntry) > packSize)
+        return NULL;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const PackEntry &entry = entries[i];
+        if (strncmp(entry.name, name, sizeof(entry.name)) != 0)
+            continue;
+        const PackFont *font = (const PackFont *)(pack + entry.offset);
+        const uint32_t tables = sizeof(PackFont) + font->glyphCount * sizeof(GFXglyph) + font->intervalCount * sizeof(UnicodeInterval);
+        if (entry.offset % 4 || entry.offset + entry.size > packSize || memcmp(font->magic, "FNT1", 4) != 0 ||
+            tables + font->bitmapSize > entry.size)
+        {
+            ESP_LOGW("FONT", "Packed font %s is damaged", name);
+            return NULL;
+        }
+        const uint8_t *data = (const uint8_t *)(font + 1);
+        found.glyph = (GFXglyph *)data; // The driver types are not const, the mapping is read-only
+        found.intervals = (UnicodeInterval *)(data + font->glyphCount * sizeof(GFXglyph));
+        found.bitmap = (uint8_t *)(found.intervals + font->intervalCount);
+        found.interval_count = font->intervalCount;
+        found.compressed = font->compressed;
+        found.advance_y = font->advanceY;
+        found.ascender = font->ascender;
+        found.descender = font->descender;
+        return &found;
+    }
+#endif
+    return NULL;
+}
+
+// Applies a font selection like "OpenSans8B=OpenSans9B,OpenSans24B=OpenSans26B": each compiled-in font on the left
+// is drawn with the packed font on the right. An empty spec restores the compiled-in fonts. Returns the number of
+// fonts replaced, unknown or missing names are logged and skipped.
+int SelectFonts(const char *spec)
+{
+    int replaced = 0;
+    for (FontSlot &slot : slots)
+        slot.active = false;
+    while (spec && *spec)
+    {
+        const char *end = strchr(spec, ',');
+        const int length = end ? end - spec : strlen(spec);
+        char item[56], *packedName;
+        snprintf(item, sizeof(item), "%.*s", length, spec);
+        spec = end ? end + 1 : NULL;
+        if (!(packedName = strchr(item, '=')))
+            continue;
+        *packedName++ = 0;
+        FontSlot *slot = NULL;
+        for (FontSlot &s : slots)
+            if (strcmp(s.name, item) == 0)
+                slot = &s;
+        const GFXfont *packed = slot ? FindPackedFont(packedName) : NULL;
+        if (!packed)
+        {
+            ESP_LOGW("FONT", "No font %s for %s, keeping the compiled-in one", packedName, item);
+            continue;
+        }
+        slot->packed = *packed;
+        slot->active = true;
+        replaced++;
+        ESP_LOGI("FONT", "%s drawn with packed %s", item, packedName);
+    }
+    return replaced;
+}
+
+// The font setFont() draws with: the packed replacement of a compiled-in font if one is selected
+const GFXfont &ResolveFont(const GFXfont &font)
+{
+    for (const FontSlot &slot : slots)
+        if (slot.compiled == &font)
+            return slot.active ? slot.packed : font;
+    return font;
+}
@@ -0,0 +1,19 @@
+#ifndef FONT_PACK_H
+#define FONT_PACK_H
+
+#include <Arduino.h>           // In-built
+#include "epd_driver.h"        // https://github.com/Xinyuan-LilyGO/LilyGo-EPD47
+
+#ifndef FONT_PACK
+#define FONT_PACK 1 // 0 = only the compiled-in fonts, no lookup of the "fonts" flash partition
+#endif
+
+#define FONT_PACK_LABEL "fonts"   // Partition written with tools/fontpack.py, see partitions.csv
+#define FONT_PACK_SUBTYPE 0x40    // First custom data subtype
+#define FONT_PACK_SLOTS 8         // Compiled-in fonts that can be replaced at the same time
+
+const GFXfont *FindPackedFont(const char *name);
+int SelectFonts(const char *spec);
+const GFXfont &ResolveFont(const GFXfont &font);
+
+#endif
@@ -0,0 +1,49 @@
+// The compiled-in fonts are built in this translation unit only. drawingFunctions.h declares them extern first,
+// which gives the definitions in the headers below external linkage.
+#include "drawingFunctions.h"
+
+#if FONT_SUBSET
+#include "opensans8b_subset.h"
+#include "opensans10b_subset.h"
+#include "opensans12b_subset.h"
+#else
+#include "opensans8b.h"
+#include "opensans10b.h"
+#include "opensans12b.h"
+#endif
+
+#if FONT_ENCODING_18B == FONT_RAW
+#if FONT_SUBSET
+#include "opensans18b_subset_raw.h"
+#else
+#include "opensans18b_raw.h"
+#endif
+#elif FONT_ENCODING_18B == FONT_RLE
+#if FONT_SUBSET
+#include "opensans18b_subset_rle.h"
+#else
+#include "opensans18b_rle.h"
+#endif
+#elif FONT_SUBSET
+#include "opensans18b_subset.h"
+#else
+#include "opensans18b.h"
+#endif
+
+#if FONT_ENCODING_24B == FONT_RAW
+#if FONT_SUBSET
+#include "opensans24b_subset_raw.h"
+#else
+#include "opensans24b_raw.h"
+#endif
+#elif FONT_ENCODING_24B == FONT_RLE
+#if FONT_SUBSET
+#include "opensans24b_subset_rle.h"
+#else
+#include "opensans24b_rle.h"
+#endif
+#elif FONT_SUBSET
+#include "opensans24b_subset.h"
+#else
+#include "opensans24b.h"
+#endif
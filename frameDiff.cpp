@@ -0,0 +1,153 @@
+#include "frameDiff.h"
+#include "fastUpdate.h"
+#include "timeFormat.h"
+#include <time.h>              // In-built
+
+RTC_DATA_ATTR uint32_t tileHashes[FRAME_TILE_ROWS][FRAME_TILE_COLS];
+RTC_DATA_ATTR bool tileHashesValid = false;  // False after power on, the panel content is unknown
+RTC_DATA_ATTR int frameStatsDay = -1;        // Day of year the counters below belong to
+RTC_DATA_ATTR uint16_t framesSkipped = 0;
+RTC_DATA_ATTR uint16_t framesPartial = 0;
+RTC_DATA_ATTR uint16_t framesFast = 0;
+RTC_DATA_ATTR uint16_t framesFull = 0;
+
+static bool tileChanged[FRAME_TILE_ROWS][FRAME_TILE_COLS];
+static int changedTiles = FRAME_TILE_ROWS * FRAME_TILE_COLS;
+
+// FNV-1a over the tile rows, 32 bytes (64 px) per row
+static uint32_t TileHash(int col, int row)
+{
+    uint32_t hash = 2166136261u;
+    const uint8_t *p = framebuffer + (row * FRAME_TILE_HEIGHT) * (EPD_WIDTH / 2) + col * (FRAME_TILE_WIDTH / 2);
+    for (int y = 0; y < FRAME_TILE_HEIGHT; y++, p += EPD_WIDTH / 2)
+    {
+        for (int x = 0; x < FRAME_TILE_WIDTH / 2; x++)
+        {
+            hash ^= p[x];
+            hash *= 16777619u;
+        }
+    }
+    return hash;
+}
+
+void InvalidateFrameHashes()
+{
+    tileHashesValid = false;
+}
+
+// Hashes the rendered framebuffer against the previous frame, returns the number of changed tiles
+int HashFrameTiles()
+{
+    changedTiles = 0;
+    for (int row = 0; row < FRAME_TILE_ROWS; row++)
+    {
+        for (int col = 0; col < FRAME_TILE_COLS; col++)
+        {
+            const uint32_t hash = TileHash(col, row);
+            tileChanged[row][col] = !tileHashesValid || hash != tileHashes[row][col];
+            tileHashes[row][col] = hash;
+            if (tileChanged[row][col])
+                changedTiles++;
+        }
+    }
+    tileHashesValid = true;
+    return changedTiles;
+}
+
+// Clears and redraws one band of tile rows between the first and last changed column of each tile row
+static void UpdateChangedRows()
+{
+    static uint8_t *scratch = NULL; // One tile row, 28.8 KB
+    if (scratch == NULL)
+        scratch = (uint8_t *)ps_malloc((EPD_WIDTH / 2) * FRAME_TILE_HEIGHT);
+    if (scratch == NULL)
+    {
+        ESP_LOGW("FRAME", "Partial update buffer alloc failed, redrawing whole panel");
+        epd_clear();
+        epd_draw_grayscale_image(epd_full_screen(), framebuffer);
+        SetPanelShadow(framebuffer);
+        return;
+    }
+    for (int row = 0; row < FRAME_TILE_ROWS; row++)
+    {
+        int first = FRAME_TILE_COLS, last = -1;
+        for (int col = 0; col < FRAME_TILE_COLS; col++)
+        {
+            if (tileChanged[row][col])
+            {
+                first = min(first, col);
+                last = col;
+            }
+        }
+        if (last < 0)
+            continue;
+        const int rowBytes = (last - first + 1) * (FRAME_TILE_WIDTH / 2);
+        Rect_t area = {first * FRAME_TILE_WIDTH, row * FRAME_TILE_HEIGHT, (last - first + 1) * FRAME_TILE_WIDTH, FRAME_TILE_HEIGHT};
+        const uint8_t *src = framebuffer + area.y * (EPD_WIDTH / 2) + first * (FRAME_TILE_WIDTH / 2);
+        for (int y = 0; y < FRAME_TILE_HEIGHT; y++)
+            memcpy(scratch + y * rowBytes, src + y * (EPD_WIDTH / 2), rowBytes);
+        epd_clear_area(area);
+        epd_draw_grayscale_image(area, scratch);
+        SetPanelShadowArea(framebuffer, area); // Untouched tiles may still show binarised fast update pixels
+    }
+}
+
+// Counts the update kinds per local day and logs the skip rate when the day rolls over
+static void RecordFrameUpdate(FrameUpdate update)
+{
+    time_t now = time(NULL);
+    struct tm local;
+    LocalTimeFields(now, &local);
+    if (frameStatsDay != local.tm_yday)
+    {
+        const int total = framesSkipped + framesPartial + framesFast + framesFull;
+        if (frameStatsDay >= 0 && total > 0)
+            ESP_LOGI("FRAME", "Day %d: %d frames, %d skipped (%d%%), %d partial, %d fast, %d full", frameStatsDay, total,
+                     framesSkipped, framesSkipped * 100 / total, framesPartial, framesFast, framesFull);
+        frameStatsDay = local.tm_yday;
+        framesSkipped = framesPartial = framesFast = framesFull = 0;
+    }
+    if (update == FRAME_SKIP)
+        framesSkipped++;
+    else if (update == FRAME_PARTIAL)
+        framesPartial++;
+    else if (update == FRAME_FAST)
+        framesFast++;
+    else
+        framesFull++;
+    ESP_LOGI("FRAME", "Today: %d skipped, %d partial, %d fast, %d full", framesSkipped, framesPartial, framesFast, framesFull);
+}
+
+// Sends the rendered framebuffer (showing screen) to the panel, touching only what changed since the last frame
+FrameUpdate UpdatePanel(int screen)
+{
+    FrameUpdate update = FRAME_FULL;
+    const int changed = HashFrameTiles();
+    if (GhostingRefreshDue())
+        ESP_LOGI("FRAME", "Full refresh to clear fast update ghosting");
+    else if (changed == 0)
+        update = FRAME_SKIP;
+    else if (PrepareFastUpdate(tileChanged, screen))
+        update = FRAME_FAST;
+    else if (changed * 100 <= FRAME_PARTIAL_PERCENT * FRAME_TILE_ROWS * FRAME_TILE_COLS)
+        update = FRAME_PARTIAL;
+    ESP_LOGI("FRAME", "%d of %d tiles changed", changed, FRAME_TILE_ROWS * FRAME_TILE_COLS);
+    if (update != FRAME_SKIP)
+    {
+        epd_poweron();
+        if (update == FRAME_FAST)
+            ApplyFastUpdate();
+        else if (update == FRAME_PARTIAL)
+            UpdateChangedRows();
+        else
+        {
+            epd_clear();
+            epd_draw_grayscale_image(epd_full_screen(), framebuffer);
+            NoteFullRefresh();
+            SetPanelShadow(framebuffer);
+        }
+        epd_poweroff_all();
+    }
+    RecordFrameUpdate(update);
+    return update;
+}
@@ -0,0 +1,31 @@
+#ifndef FRAMEDIFF_H
+#define FRAMEDIFF_H
+
+#include <Arduino.h>           // In-built
+#include "epd_driver.h"        // https://github.com/Xinyuan-LilyGO/LilyGo-EPD47
+
+// Per-tile hashes of the last frame sent to the panel, kept in RTC memory across sleeps.
+// 64x60 px tiles give a 15x9 grid, 540 bytes of RTC memory.
+#define FRAME_TILE_WIDTH 64
+#define FRAME_TILE_HEIGHT 60
+#define FRAME_TILE_COLS (EPD_WIDTH / FRAME_TILE_WIDTH)
+#define FRAME_TILE_ROWS (EPD_HEIGHT / FRAME_TILE_HEIGHT)
+#ifndef FRAME_PARTIAL_PERCENT
+#define FRAME_PARTIAL_PERCENT 40 // Above this share of changed tiles the whole panel is cleared and redrawn
+#endif
+
+extern uint8_t *framebuffer;
+
+typedef enum
+{
+    FRAME_SKIP,    // Nothing changed, panel left untouched
+    FRAME_PARTIAL, // Only the changed tile rows were cleared and redrawn
+    FRAME_FAST,    // Changed pixels of the fast regions driven to black or white, see fastUpdate.h
+    FRAME_FULL     // Whole panel cleared and redrawn
+} FrameUpdate;
+
+int HashFrameTiles();
+FrameUpdate UpdatePanel(int screen);
+void InvalidateFrameHashes();
+
+#endif // FRAMEDIFF_H
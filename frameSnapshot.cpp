@@ -0,0 +1,99 @@
+#include "frameSnapshot.h"
+#include "packbits.h"
+#include "SPIFFS.h"
+#include "FS.h"
+#include "esp_timer.h"         // In-built
+
+#define ROW_BYTES (EPD_WIDTH / 2)
+#define WRITE_CHUNK 4096 // Encoded rows are collected and written to flash in chunks of this size
+
+bool SaveFrameSnapshot(const uint8_t *buffer, int screen)
+{
+    const int64_t start = esp_timer_get_time();
+    File file = SPIFFS.open(FRAME_SNAPSHOT_PATH, FILE_WRITE);
+    if (!file)
+    {
+        ESP_LOGE("SNAPSHOT", "Cannot create %s", FRAME_SNAPSHOT_PATH);
+        return false;
+    }
+    uint8_t *chunk = (uint8_t *)malloc(WRITE_CHUNK);
+    if (!chunk)
+    {
+        file.close();
+        return false;
+    }
+    const uint8_t header[] = {'F', 'B', 'S', '1', EPD_WIDTH & 0xFF, EPD_WIDTH >> 8, EPD_HEIGHT & 0xFF, EPD_HEIGHT >> 8, uint8_t(screen)};
+    memcpy(chunk, header, sizeof(header));
+    size_t used = sizeof(header), total = 0;
+    int64_t encodeTime = 0;
+    bool ok = true;
+    for (int y = 0; y < EPD_HEIGHT && ok; y++)
+    {
+        if (used + PACKBITS_MAX_SIZE(ROW_BYTES) > WRITE_CHUNK)
+        {
+            ok = file.write(chunk, used) == used;
+            total += used;
+            used = 0;
+        }
+        const int64_t encodeStart = esp_timer_get_time();
+        used += PackBitsEncode(buffer + y * ROW_BYTES, ROW_BYTES, chunk + used);
+        encodeTime += esp_timer_get_time() - encodeStart;
+    }
+    if (ok)
+    {
+        ok = file.write(chunk, used) == used;
+        total += used;
+    }
+    file.close();
+    free(chunk);
+    if (!ok)
+    { // SPIFFS full, a truncated snapshot must not be restored
+        SPIFFS.remove(FRAME_SNAPSHOT_PATH);
+        ESP_LOGE("SNAPSHOT", "Writing %s failed", FRAME_SNAPSHOT_PATH);
+        return false;
+    }
+    ESP_LOGI("SNAPSHOT", "Screen %d saved: %u of %u bytes (%.1f%%), compress %lld us, total %lld us", screen, total,
+             ROW_BYTES * EPD_HEIGHT, 100.0 * total / (ROW_BYTES * EPD_HEIGHT), encodeTime, esp_timer_get_time() - start);
+    return true;
+}
+
+// Decodes the snapshot one row at a time, into buffer when given and to sink when given. False when there is no
+// valid snapshot; rows already decoded into buffer stay.
+bool ReadFrameSnapshot(uint8_t *buffer, SnapshotRowSink sink, void *context, int *screen)
+{
+    File file = SPIFFS.open(FRAME_SNAPSHOT_PATH, FILE_READ);
+    if (!file)
+        return false;
+    ByteSource in(file);
+    uint8_t header[9];
+    bool ok = in.read(header, sizeof(header)) == sizeof(header) && memcmp(header, "FBS1", 4) == 0 &&
+              (header[4] | (header[5] << 8)) == EPD_WIDTH && (header[6] | (header[7] << 8)) == EPD_HEIGHT;
+    if (ok && screen)
+        *screen = header[8];
+    uint8_t row[ROW_BYTES];
+    for (int y = 0; y < EPD_HEIGHT && ok; y++)
+    {
+        uint8_t *dst = buffer ? buffer + y * ROW_BYTES : row;
+        ok = PackBitsDecode(in, dst, ROW_BYTES);
+        if (ok && sink)
+            sink(y, dst, context);
+    }
+    file.close();
+    return ok;
+}
+
+bool RestoreFrameSnapshot(uint8_t *buffer)
+{
+    if (!SPIFFS.exists(FRAME_SNAPSHOT_PATH))
+        return false;
+    const int64_t start = esp_timer_get_time();
+    int screen = 0;
+    if (!ReadFrameSnapshot(buffer, NULL, NULL, &screen))
+    {
+        memset(buffer, 0xFF, ROW_BYTES * EPD_HEIGHT);
+        ESP_LOGW("SNAPSHOT", "%s is damaged, ignored", FRAME_SNAPSHOT_PATH);
+        return false;
+    }
+    ESP_LOGI("SNAPSHOT", "Screen %d restored in %lld us", screen, esp_timer_get_time() - start);
+    return true;
+}
@@ -0,0 +1,22 @@
+#ifndef FRAMESNAPSHOT_H
+#define FRAMESNAPSHOT_H
+
+#include <Arduino.h>           // In-built
+#include "epd_driver.h"        // https://github.com/Xinyuan-LilyGO/LilyGo-EPD47
+
+// PackBits compressed copy of the last frame pushed to the panel, kept in SPIFFS. After a reset or a deep sleep
+// the framebuffer is restored from it, so it matches the panel before any weather data has been fetched.
+// A white weather screen compresses to a few percent: a blank 480 byte row is 8 bytes.
+// Layout: "FBS1", width and height as little endian uint16, screen number, then EPD_HEIGHT PackBits rows.
+#ifndef FRAME_SNAPSHOT
+#define FRAME_SNAPSHOT 1 // 0 = no snapshot, the framebuffer starts white after every reset
+#endif
+#define FRAME_SNAPSHOT_PATH "/frame.pbf"
+
+typedef void (*SnapshotRowSink)(int y, const uint8_t *row, void *context);
+
+bool SaveFrameSnapshot(const uint8_t *buffer, int screen);
+bool ReadFrameSnapshot(uint8_t *buffer, SnapshotRowSink sink, void *context, int *screen);
+bool RestoreFrameSnapshot(uint8_t *buffer);
+
+#endif // FRAMESNAPSHOT_H
@@ -0,0 +1,206 @@
+#include "graph.h"
+
+/* Based on DrawGraph (C) D L BIRD
+    Draws a line or bar chart of DataArray at x_pos, y_pos (top-left of the plot area), gwidth x gheight pixels.
+    Y1Min/Y1Max give the Y range; with auto_scale the range is fitted to the data and rounded to 1/2/5 steps.
+    Long series are decimated (LTTB for lines, bucket maxima for bars) so readings may exceed the pixel width.
+    readingsPerDay places the day dividers and "Nd" labels on the X axis (8 for 3-hourly forecast slots).
+    All scaling runs on values in hundredths (GRAPH_FIXED) with integer arithmetic.
+*/
+
+#define GRAPH_FIXED 100     // Fixed point: values are stored in hundredths
+#define y_minor_axis 5      // 5 y-axis division markers
+#define number_of_dashes 20 // Dashes per grid line
+#define max_graph_points 64 // Line mode draws at most this many points, longer series are decimated
+
+typedef struct
+{ // Y axis in hundredths, min + y_minor_axis * step == max
+    int32_t min;
+    int32_t max;
+    int32_t step;
+    int decimals;
+} GraphAxis;
+
+// Min, max and sum of a series in one pass, count must be at least 1
+SeriesStats ScanSeries(const float *data, int count)
+{
+    SeriesStats stats = {data[0], data[0], 0};
+    for (int i = 0; i < count; i++)
+    {
+        const float v = data[i];
+        if (v < stats.min)
+            stats.min = v;
+        if (v > stats.max)
+            stats.max = v;
+        stats.sum += v;
+    }
+    return stats;
+}
+
+// Largest-Triangle-Three-Buckets: keeps the first and last reading and, for every bucket in between, the reading
+// spanning the largest triangle with the previous pick and the average of the next bucket. Writes the picked
+// indices in order and returns how many there are (count when no decimation is needed).
+int DecimateLTTB(const float *data, int count, int threshold, int *indices)
+{
+    if (threshold >= count || threshold < 3)
+    {
+        const int n = min(count, max(threshold, 2));
+        for (int i = 0; i < n; i++)
+            indices[i] = (n == count) ? i : i * (count - 1) / (n - 1);
+        return n;
+    }
+    const float every = (float)(count - 2) / (threshold - 2);
+    int n = 0, a = 0;
+    indices[n++] = 0;
+    for (int i = 0; i < threshold - 2; i++)
+    {
+        const int avgStart = (int)((i + 1) * every) + 1;
+        const int avgEnd = min((int)((i + 2) * every) + 1, count);
+        float avgX = 0, avgY = 0;
+        for (int j = avgStart; j < avgEnd; j++)
+        {
+            avgX += j;
+            avgY += data[j];
+        }
+        avgX /= (avgEnd - avgStart);
+        avgY /= (avgEnd - avgStart);
+        const int rangeStart = (int)(i * every) + 1, rangeEnd = (int)((i + 1) * every) + 1;
+        float maxArea = -1;
+        int pick = rangeStart;
+        for (int j = rangeStart; j < rangeEnd; j++)
+        {
+            const float area = fabsf((a - avgX) * (data[j] - data[a]) - (a - j) * (avgY - data[a]));
+            if (area > maxArea)
+            {
+                maxArea = area;
+                pick = j;
+            }
+        }
+        indices[n++] = a = pick;
+    }
+    indices[n++] = count - 1;
+    return n;
+}
+
+static int32_t ToFixed(float value)
+{
+    return lroundf(value * GRAPH_FIXED);
+}
+
+// Smallest 1, 2 or 5 x 10^k step (in hundredths) covering range in y_minor_axis divisions
+static int32_t NiceStep(int32_t range)
+{
+    for (int32_t magnitude = 1;; magnitude *= 10)
+        for (int32_t m : {1, 2, 5})
+            if (m * magnitude * y_minor_axis >= range)
+                return m * magnitude;
+}
+
+static int32_t FloorToStep(int32_t value, int32_t step)
+{
+    return (value >= 0 ? value / step : -((-value + step - 1) / step)) * step;
+}
+
+static GraphAxis MakeAxis(int32_t lo, int32_t hi, bool autoScale)
+{
+    GraphAxis axis;
+    if (!autoScale)
+    {
+        axis.min = lo;
+        axis.step = max((int32_t)1, (hi - lo) / y_minor_axis);
+    }
+    else
+    {
+        if (hi <= lo)
+            hi = lo + GRAPH_FIXED; // Flat series, show one unit of range
+        axis.step = NiceStep(hi - lo);
+        axis.min = FloorToStep(lo, axis.step);
+        while (axis.min + axis.step * y_minor_axis < hi)
+        { // Flooring the minimum pushed the top below the data, take the next nice step
+            axis.step = NiceStep(axis.step * y_minor_axis + 1);
+            axis.min = FloorToStep(lo, axis.step);
+        }
+    }
+    axis.max = axis.min + axis.step * y_minor_axis;
+    axis.decimals = (axis.step % 100 == 0) ? 0 : (axis.step % 10 == 0) ? 1 : 2;
+    return axis;
+}
+
+// Formats a value in hundredths with the given number of decimals, without floating point
+static void FormatFixed(char *out, size_t size, int32_t value, int decimals)
+{
+    const char *sign = value < 0 ? "-" : "";
+    const uint32_t a = value < 0 ? -value : value;
+    if (decimals == 0)
+        snprintf(out, size, "%s%u", sign, (unsigned)(a / 100));
+    else if (decimals == 1)
+        snprintf(out, size, "%s%u.%u", sign, (unsigned)(a / 100), (unsigned)(a / 10 % 10));
+    else
+        snprintf(out, size, "%s%u.%02u", sign, (unsigned)(a / 100), (unsigned)(a % 100));
+}
+
+static int PlotY(const GraphAxis &axis, int y_pos, int gheight, float value)
+{
+    const int32_t v = constrain(ToFixed(value), axis.min, axis.max);
+    return y_pos + (axis.max - v) * gheight / (axis.max - axis.min);
+}
+
+void DrawGraph(int x_pos, int y_pos, int gwidth, int gheight, float Y1Min, float Y1Max, const char *title, float DataArray[], int readings, boolean auto_scale, boolean barchart_mode, int readingsPerDay)
+{
+    if (readings < 2)
+        return;
+    setFont(OpenSans10B);
+    GraphAxis axis;
+    if (auto_scale)
+    {
+        const SeriesStats stats = ScanSeries(DataArray, readings);
+        axis = MakeAxis(ToFixed(stats.min), ToFixed(stats.max), true);
+    }
+    else
+        axis = MakeAxis(ToFixed(Y1Min), ToFixed(Y1Max), false);
+
+    drawRect(x_pos, y_pos, gwidth + 3, gheight + 2, Grey);
+    drawString(x_pos - 20 + gwidth / 2, y_pos - 28, title, CENTER);
+    if (barchart_mode)
+    { // One bar per bucket of readings, the bucket maximum so peaks survive
+        const int buckets = min(readings, gwidth / 2);
+        const int barWidth = max(1, gwidth / buckets - 1);
+        for (int b = 0; b < buckets; b++)
+        {
+            const int start = b * readings / buckets, end = (b + 1) * readings / buckets;
+            float peak = DataArray[start];
+            for (int i = start + 1; i < end; i++)
+                peak = max(peak, DataArray[i]);
+            const int top = PlotY(axis, y_pos, gheight, peak) + 1;
+            fillRect(x_pos + 3 + b * gwidth / buckets, top, barWidth, y_pos + gheight - top + 1, Black);
+        }
+    }
+    else
+    {
+        int indices[max_graph_points];
+        const int points = DecimateLTTB(DataArray, readings, min(max_graph_points, gwidth / 2), indices);
+        RasterPoint trace[max_graph_points];
+        for (int i = 0; i < points; i++)
+            trace[i] = {x_pos + 1 + indices[i] * gwidth / (readings - 1), PlotY(axis, y_pos, gheight, DataArray[indices[i]]) + 1};
+        rasterPolyline(trace, points, 2, Black); // 2px wide for hi-res display
+    }
+    //Draw the Y-axis scale
+    char label[12];
+    for (int spacing = 0; spacing <= y_minor_axis; spacing++)
+    {
+        const int gy = y_pos + gheight * spacing / y_minor_axis;
+        if (spacing < y_minor_axis)
+            for (int j = 0; j < number_of_dashes; j++) // Draw dashed graph grid lines
+                drawFastHLine(x_pos + 3 + j * gwidth / number_of_dashes, gy, gwidth / (2 * number_of_dashes), Grey);
+        FormatFixed(label, sizeof(label), axis.max - axis.step * spacing, axis.decimals);
+        drawString(x_pos - 7, gy - 5, label, RIGHT);
+    }
+    const int days = readings / readingsPerDay;
+    for (int i = 0; i < days; i++)
+    {
+        const int dayX = x_pos + gwidth * readingsPerDay * i / readings;
+        drawStringf(20 + dayX, y_pos + gheight + 10, LEFT, "%dd", i);
+        if (i > 0)
+            drawFastVLine(dayX, y_pos, gheight, LightGrey);
+    }
+}
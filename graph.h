@@ -0,0 +1,18 @@
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <Arduino.h>           // In-built
+#include "drawingFunctions.h"
+
+typedef struct
+{
+    float min;
+    float max;
+    float sum;
+} SeriesStats;
+
+SeriesStats ScanSeries(const float *data, int count);
+int DecimateLTTB(const float *data, int count, int threshold, int *indices);
+void DrawGraph(int x_pos, int y_pos, int gwidth, int gheight, float Y1Min, float Y1Max, const char *title, float DataArray[], int readings, boolean auto_scale, boolean barchart_mode, int readingsPerDay = 8);
+
+#endif // GRAPH_H
@@ -0,0 +1,170 @@
+#include "grayImage.h"
+#include "rasteriser.h"
+#include "displayList.h"
+#if IMAGE_BENCHMARK
+#include "esp_timer.h"         // In-built
+#endif
+
+static const uint8_t bayer4[4][4] = {{0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+
+// Reads one unsigned decimal field of a PGM header, skipping whitespace and # comments
+static int pgmField(ByteSource &in)
+{
+    int c = in.read();
+    while (c == '#' || isspace(c))
+    {
+        if (c == '#')
+            while (c >= 0 && c != '\n')
+                c = in.read();
+        c = in.read();
+    }
+    int value = -1;
+    while (c >= '0' && c <= '9')
+    {
+        value = (value < 0 ? 0 : value * 10) + c - '0';
+        c = in.read();
+    }
+    return value; // The single whitespace after the field has been consumed
+}
+
+static bool readHeader(ByteSource &in, int *w, int *h, bool *packed)
+{
+    uint8_t magic[4];
+    if (in.read(magic, 2) != 2)
+        return false;
+    if (magic[0] == 'P' && magic[1] == '5')
+    {
+        *w = pgmField(in);
+        *h = pgmField(in);
+        *packed = false;
+        return pgmField(in) == 255;
+    }
+    uint8_t size[4];
+    if (magic[0] != 'G' || magic[1] != 'R' || in.read(magic + 2, 2) != 2 || magic[2] != 'L' || magic[3] != 'E' ||
+        in.read(size, 4) != 4)
+        return false;
+    *w = size[0] | (size[1] << 8);
+    *h = size[2] | (size[3] << 8);
+    *packed = true;
+    return true;
+}
+
+// 8-bit gray to 0..15 levels in place
+static void ditherRow(uint8_t *row, int w, int y, ImageDither dither, int16_t *err, int16_t *nextErr)
+{
+    switch (dither)
+    {
+    case DITHER_NONE:
+        for (int x = 0; x < w; x++)
+            row[x] = (row[x] * 15 + 127) / 255;
+        break;
+    case DITHER_ORDERED:
+        for (int x = 0; x < w; x++)
+        {
+            const int t = row[x] * 15; // Level and the fraction towards the next one in 1/255
+            const int threshold = (2 * bayer4[y & 3][x & 3] + 1) * 255 / 32;
+            row[x] = t / 255 + (t % 255 > threshold);
+        }
+        break;
+    case DITHER_DIFFUSION: // err holds this row's error in 1/16 gray, indices shifted by one for the borders
+        memset(nextErr, 0, (w + 2) * sizeof(int16_t));
+        for (int x = 0; x < w; x++)
+        {
+            const int v = constrain(row[x] + err[x + 1] / 16, 0, 255);
+            const int level = (v * 15 + 127) / 255;
+            const int e = v - level * 17;
+            err[x + 2] += e * 7;
+            nextErr[x] += e * 3;
+            nextErr[x + 1] += e * 5;
+            nextErr[x + 2] += e;
+            row[x] = level;
+        }
+        break;
+    }
+}
+
+// Draws the image with its top-left corner at x, y; false on a malformed or truncated image, rows drawn so far stay
+bool DrawGrayImage(ByteSource &in, int x, int y, ImageDither dither)
+{
+    if (displayListRecording)
+    { // The input is consumed once, there is nothing a display list could replay
+        ESP_LOGW("IMAGE", "Images cannot be recorded into a display list");
+        return false;
+    }
+    int w, h;
+    bool packed;
+    if (!readHeader(in, &w, &h, &packed) || w <= 0 || h <= 0 || w > EPD_WIDTH)
+    {
+        ESP_LOGE("IMAGE", "Unsupported image header");
+        return false;
+    }
+    const int errWords = dither == DITHER_DIFFUSION ? 2 * (w + 2) : 0;
+    uint8_t *row = (uint8_t *)malloc(w + 1 + errWords * sizeof(int16_t));
+    if (!row)
+    {
+        ESP_LOGE("IMAGE", "No memory for a %d pixel row", w);
+        return false;
+    }
+    int16_t *err = (int16_t *)(row + w + (w & 1)), *nextErr = err + w + 2;
+    if (errWords)
+        memset(err, 0, (w + 2) * sizeof(int16_t));
+    bool ok = true;
+    for (int r = 0; r < h && ok; r++)
+    {
+        ok = packed ? PackBitsDecode(in, row, w) : in.read(row, w) == size_t(w);
+        if (!ok)
+            break;
+        if (dither != DITHER_DIFFUSION && !rasterRowsVisible(y + r, 1))
+            continue; // Rows outside the band only matter for the diffused error
+        ditherRow(row, w, y + r, dither, err, nextErr);
+        rasterGrayRow(x, y + r, w, row);
+        int16_t *t = err;
+        err = nextErr;
+        nextErr = t;
+    }
+    free(row);
+    if (!ok)
+        ESP_LOGE("IMAGE", "Image data ends early");
+    return ok;
+}
+
+#if IMAGE_BENCHMARK
+// Encodes a 480x270 radar-like test image (gradient background, flat blobs) and times every dither mode
+void BenchmarkGrayImage()
+{
+    const int w = 480, h = 270;
+    uint8_t *image = (uint8_t *)ps_malloc(8 + h * PACKBITS_MAX_SIZE(w));
+    uint8_t *row = (uint8_t *)malloc(w);
+    if (!image || !row)
+    {
+        free(image);
+        free(row);
+        return;
+    }
+    memcpy(image, "GRLE", 4);
+    image[4] = w & 0xFF;
+    image[5] = w >> 8;
+    image[6] = h & 0xFF;
+    image[7] = h >> 8;
+    size_t length = 8;
+    for (int y = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            const int dx = x % 120 - 60, dy = y % 90 - 45;
+            row[x] = dx * dx + dy * dy < 900 ? 64 * ((x / 120 + y / 90) % 3) : x * 255 / (w - 1);
+        }
+        length += PackBitsEncode(row, w, image + length);
+    }
+    free(row);
+    static const char *const names[] = {"none", "ordered", "diffusion"};
+    for (int d = DITHER_NONE; d <= DITHER_DIFFUSION; d++)
+    {
+        ByteSource in(image, length);
+        const int64_t start = esp_timer_get_time();
+        DrawGrayImage(in, 0, 0, ImageDither(d));
+        ESP_LOGI("IMAGE", "%dx%d %-9s: %lld us, %u of %u bytes", w, h, names[d], esp_timer_get_time() - start, length, w * h);
+    }
+    free(image);
+}
+#endif
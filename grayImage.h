@@ -0,0 +1,28 @@
+#ifndef GRAYIMAGE_H
+#define GRAYIMAGE_H
+
+#include <Arduino.h>           // In-built
+#include "packbits.h"
+
+// Streaming gray image blit for bitmap content (radar tiles, logos, pre-rendered charts).
+// Rows are decoded one at a time, dithered from 8-bit gray to the panel's 16 levels and written through the
+// rasteriser, so an image costs a few rows of RAM however large it is and honours the clip and band target.
+// Formats: binary PGM (P5, maxval 255) and GRLE: "GRLE", width and height as little endian uint16, then every
+// row PackBits coded on its own (tools/grle.py converts PGM/PNG files).
+#ifndef IMAGE_BENCHMARK
+#define IMAGE_BENCHMARK 0 // 1 = log decode and blit time of a 480x270 test image before each frame
+#endif
+
+typedef enum
+{
+    DITHER_NONE,      // Nearest level
+    DITHER_ORDERED,   // 4x4 Bayer, no state between pixels
+    DITHER_DIFFUSION  // Floyd-Steinberg, carries two rows of error
+} ImageDither;
+
+bool DrawGrayImage(ByteSource &in, int x, int y, ImageDither dither);
+#if IMAGE_BENCHMARK
+void BenchmarkGrayImage();
+#endif
+
+#endif // GRAYIMAGE_H
@@ -0,0 +1,31 @@
+// Host check of the offline astronomy (astronomy.cpp): sunrise and sunset within ASTRONOMY_SUN_TOLERANCE of
+// published times, none at all on polar days and nights, principal moon phases within ASTRONOMY_PHASE_TOLERANCE.
+// Then a polar day must count as a known location without sun events, which DisplayAstronomySection() shows as
+// "--:--" instead of OWM's times, and NAN as an unknown one. Fails on any miss.
+//
+// Usage: astronomyCheck [--verbose]
+
+#include <Arduino.h>
+#include "hostPlatform.h"
+#include "astronomy.h"
+#include "timeFormat.h"
+
+int main(int argc, char **argv)
+{
+    if (argc > 1 && !strcmp(argv[1], "--verbose"))
+        hostLogLevel = ESP_LOG_INFO;
+    const int failures = CheckAstronomy();
+    printf("Sun and moon references: %d out of tolerance\n", failures);
+
+    // Tromsø at the June solstice: located, and neither sunrise nor sunset
+    setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1);
+    tzset();
+    TimeZoneSet(getenv("TZ"));
+    UpdateAstronomy(1718964000, 69.6492f, 18.9553f); // 2024-06-21 12:00 CEST
+    const bool polar = AstronomyLocationKnown() && !astronomyDay.sunrise && !astronomyDay.sunset;
+    printf("Polar day: location %s, sunrise %ld, sunset %ld\n", AstronomyLocationKnown() ? "known" : "unknown",
+           (long)astronomyDay.sunrise, (long)astronomyDay.sunset);
+    UpdateAstronomy(1718964000, NAN, NAN);
+    const bool unknown = !AstronomyLocationKnown();
+    return failures || !polar || !unknown ? 1 : 0;
+}
@@ -0,0 +1,34 @@
+// Host run of the firmware's micro benchmarks (icons, gray image, text and font encodings, language tables, time
+// formatting, astronomy), built with every *_BENCHMARK flag. The figures are host figures: compare them between
+// builds of the same machine, the device has its own.
+//
+// Usage: bench
+
+#include <Arduino.h>
+#include "hostPlatform.h"
+#include "LilyGo-EPD-4-7-OWM-Weather-Display.h"
+#include "drawingFunctions.h"
+#include "grayImage.h"
+#include "textRenderer.h"
+#include "timeFormat.h"
+#include "astronomy.h"
+#include "lang.h"
+#include "soakTest.h"
+
+int main()
+{
+    hostLogLevel = ESP_LOG_INFO;
+    HostSetClock(SOAK_START_TIME);
+    InitialiseDisplay();
+    BenchmarkLanguageTables();
+    BenchmarkIcons();
+    BenchmarkGrayImage();
+    BenchmarkText(&OpenSans12B);
+    BenchmarkFontEncodings(&OpenSans24B);
+    setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1); // The C library is the reference of the time check
+    tzset();
+    TimeZoneSet(getenv("TZ"));
+    BenchmarkTimeFormat();
+    BenchmarkAstronomy();
+    return 0;
+}
@@ -0,0 +1,174 @@
+// Host golden renders: every screens[] entry is composed from the data/soak fixtures with the clock fixed at
+// SOAK_START_TIME and fixed room readings, then compared pixel for pixel with GOLDEN_DIR/screenN.pgm.
+// The renders are written to OUT_DIR and the render profile of each screen is printed.
+// Screens are composed into two frames in turn, as the render task does with double buffering.
+//
+// Usage: render [--golden DIR] [--out DIR] [--passes N] [--update] [--verbose]
+//        --passes composes the screen cycle N times (display list builds redraw only changed regions after the
+//        first), --update writes the renders over the golden images, --verbose prints the firmware's info logs.
+
+#include <Arduino.h>
+#include <sys/stat.h>
+#include "hostPlatform.h"
+#include "LilyGo-EPD-4-7-OWM-Weather-Display.h"
+#include "renderProfiler.h"
+#include "soakTest.h"
+
+#define FRAME_BYTES (EPD_WIDTH * EPD_HEIGHT / 2)
+
+static const UntaggedSensorData roomReading = {21.4f, 47.0f, 1009.0f};
+
+// 4bpp frame as an 8-bit binary PGM (values scaled by 17, even pixel in the low nibble, as /snapshot sends it)
+static bool writePgm(const char *path, const uint8_t *frame, int screen)
+{
+    FILE *file = fopen(path, "wb");
+    if (!file)
+        return false;
+    fprintf(file, "P5\n# screen %d, data/soak fixtures at %d\n%d %d\n255\n", screen, SOAK_START_TIME, EPD_WIDTH, EPD_HEIGHT);
+    uint8_t row[EPD_WIDTH];
+    for (int y = 0; y < EPD_HEIGHT; y++)
+    {
+        const uint8_t *src = frame + y * EPD_WIDTH / 2;
+        for (int x = 0; x < EPD_WIDTH / 2; x++)
+        {
+            row[2 * x] = (src[x] & 0x0F) * 17;
+            row[2 * x + 1] = (src[x] >> 4) * 17;
+        }
+        fwrite(row, 1, EPD_WIDTH, file);
+    }
+    return fclose(file) == 0;
+}
+
+// Pixels of an 8-bit binary PGM of the panel size, false when missing or of another format
+static bool readPgm(const char *path, uint8_t *pixels)
+{
+    FILE *file = fopen(path, "rb");
+    if (!file)
+        return false;
+    int fields[3], count = 0, c = 0;
+    char magic[3] = {0};
+    bool ok = fread(magic, 1, 2, file) == 2 && strcmp(magic, "P5") == 0;
+    while (ok && count < 3 && (c = fgetc(file)) != EOF)
+    {
+        if (c == '#')
+            while ((c = fgetc(file)) != EOF && c != '\n')
+                ;
+        else if (isdigit(c))
+        {
+            ungetc(c, file);
+            ok = fscanf(file, "%d", &fields[count++]) == 1;
+        }
+    }
+    ok = ok && count == 3 && fields[0] == EPD_WIDTH && fields[1] == EPD_HEIGHT && fields[2] == 255 && fgetc(file) != EOF &&
+         fread(pixels, 1, EPD_WIDTH * EPD_HEIGHT, file) == EPD_WIDTH * EPD_HEIGHT;
+    fclose(file);
+    return ok;
+}
+
+// Changed pixels between two PGM files, with their bounding box
+static int comparePgm(const char *goldenPath, const char *renderPath, int box[4])
+{
+    static uint8_t golden[EPD_WIDTH * EPD_HEIGHT], render[EPD_WIDTH * EPD_HEIGHT];
+    if (!readPgm(goldenPath, golden) || !readPgm(renderPath, render))
+        return -1;
+    int changed = 0;
+    box[0] = EPD_WIDTH, box[1] = EPD_HEIGHT, box[2] = box[3] = -1;
+    for (int y = 0; y < EPD_HEIGHT; y++)
+        for (int x = 0; x < EPD_WIDTH; x++)
+            if (golden[y * EPD_WIDTH + x] != render[y * EPD_WIDTH + x])
+            {
+                changed++;
+                box[0] = min(box[0], x), box[1] = min(box[1], y);
+                box[2] = max(box[2], x), box[3] = max(box[3], y);
+            }
+    return changed;
+}
+
+// One wake cycle's data, as WeatherUpdateTask gathers it before drawing
+static bool loadFixtureData()
+{
+    HostSetClock(SOAK_START_TIME);
+    if (!CreateQueuesAndSemaphores() || !SetTime())
+        return false;
+    if (!obtainFixtureData(SOAK_WEATHER_FIXTURE, "weather") || !obtainFixtureData(SOAK_FORECAST_FIXTURE, "forecast"))
+        return false;
+    wifi_signal = -62;
+    xQueueSend(processedDataQueue, &roomReading, 0);
+    ReceiveRoomReadings();
+    ReadBatteryVoltage();
+    UpdateAstronomyCache();
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const char *goldenDir = "tools/golden", *outDir = "snapshots";
+    int passes = 1;
+    bool update = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--golden") && i + 1 < argc)
+            goldenDir = argv[++i];
+        else if (!strcmp(argv[i], "--out") && i + 1 < argc)
+            outDir = argv[++i];
+        else if (!strcmp(argv[i], "--passes") && i + 1 < argc)
+            passes = max(1, atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--update"))
+            update = true;
+        else if (!strcmp(argv[i], "--verbose"))
+            hostLogLevel = ESP_LOG_INFO;
+        else
+        {
+            fprintf(stderr, "Usage: %s [--golden DIR] [--out DIR] [--passes N] [--update] [--verbose]\n", argv[0]);
+            return 2;
+        }
+    }
+    mkdir(outDir, 0755);
+    if (update)
+        mkdir(goldenDir, 0755);
+
+    if (!loadFixtureData())
+    {
+        fprintf(stderr, "Fixture data could not be loaded\n");
+        return 1;
+    }
+    uint8_t *frames[2] = {(uint8_t *)ps_malloc(FRAME_BYTES), (uint8_t *)ps_malloc(FRAME_BYTES)};
+    int failures = 0;
+    for (int n = 0; n < passes * ScreenCount(); n++)
+    {
+        const int screen = n % ScreenCount();
+        uint8_t *frame = frames[n % 2];
+        const unsigned long start = micros();
+        ComposeScreen(screen, frame);
+        const unsigned long elapsed = micros() - start;
+        printf("%s\n", ProfileTable());
+
+        char renderPath[512], goldenPath[512];
+        snprintf(renderPath, sizeof(renderPath), "%s/screen%d.pgm", outDir, screen);
+        snprintf(goldenPath, sizeof(goldenPath), "%s/screen%d.pgm", goldenDir, screen);
+        if (!writePgm(update ? goldenPath : renderPath, frame, screen))
+        {
+            printf("screen %d: cannot write %s\n", screen, update ? goldenPath : renderPath);
+            failures++;
+            continue;
+        }
+        if (update)
+        {
+            printf("screen %d: golden updated (composed in %lu us)\n", screen, elapsed);
+            continue;
+        }
+        int box[4];
+        const int changed = comparePgm(goldenPath, renderPath, box);
+        if (changed < 0)
+            printf("screen %d: no golden image %s (composed in %lu us)\n", screen, goldenPath, elapsed);
+        else if (changed)
+            printf("screen %d: %d pixels differ in (%d, %d)-(%d, %d), see %s\n", screen, changed, box[0], box[1], box[2], box[3],
+                   renderPath);
+        else
+            printf("screen %d: matches (composed in %lu us)\n", screen, elapsed);
+        failures += changed != 0;
+    }
+    free(frames[0]);
+    free(frames[1]);
+    return failures ? 1 : 0;
+}
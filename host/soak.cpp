@@ -0,0 +1,57 @@
+// Host soak of the wake loop: the firmware built with SOAK_TEST=1 runs WeatherUpdateCycle() and InitiateSleep()
+// back to back on the data/soak fixtures, as the device soak does, with the clock moved on by SleepDuration per
+// cycle. The sensor tasks do not run on the host, so every cycle gets a room reading in processedDataQueue and
+// the screen changes as a button press would. The heap wraps of soakTest.cpp track the live blocks and bytes;
+// the run fails unless every verdict passes.
+//
+// Usage: soak [--cycles N] [--verbose]
+//        --cycles defaults to SOAK_WARMUP + SOAK_CYCLES (one verdict), --verbose prints the firmware's info logs
+//        with the trend of every verdict.
+
+#include <Arduino.h>
+#include "hostPlatform.h"
+#include "LilyGo-EPD-4-7-OWM-Weather-Display.h"
+#include "soakTest.h"
+#include "SPIFFS.h"
+
+// Readings drift a little every cycle, so the room section and its fast update regions change
+static UntaggedSensorData roomReading(int cycle)
+{
+    return {21.0f + (cycle % 17) * 0.1f, 45.0f + (cycle % 11), 1005.0f + (cycle % 9)};
+}
+
+int main(int argc, char **argv)
+{
+    int cycles = SOAK_WARMUP + SOAK_CYCLES;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--cycles") && i + 1 < argc)
+            cycles = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--verbose"))
+            hostLogLevel = ESP_LOG_INFO;
+        else
+        {
+            fprintf(stderr, "Usage: %s [--cycles N] [--verbose]\n", argv[0]);
+            return 2;
+        }
+    }
+    HostSetClock(SOAK_START_TIME);
+    InitialiseSystem();
+    SPIFFS.begin();
+    if (!CreateQueuesAndSemaphores())
+        return 1;
+    for (int cycle = 0; cycle < cycles; cycle++)
+    {
+        const UntaggedSensorData reading = roomReading(cycle);
+        xQueueSend(processedDataQueue, &reading, 0);
+        xSemaphoreGive(dataProcessedSem);
+        screenState = cycle % ScreenCount();
+        WeatherUpdateCycle();
+        InitiateSleep(); // Samples the heap and moves the clock on
+    }
+    const SoakHeapUse live = SoakHeapLive();
+    const bool pass = SoakVerdicts() && !SoakFailed();
+    printf("%s: %d cycles, %u verdicts, %u live heap blocks of %u bytes at the end (%u untracked)\n", pass ? "PASS" : "FAIL",
+           cycles, (unsigned)SoakVerdicts(), (unsigned)live.blocks, (unsigned)live.bytes, (unsigned)live.untracked);
+    return pass ? 0 : 1;
+}
@@ -0,0 +1,393 @@
+#include <Arduino.h>
+#include <sys/time.h>
+#include "hostPlatform.h"
+
+HardwareSerial Serial;
+int hostLogLevel = ESP_LOG_WARN;
+
+//################ String ##################################################
+
+String::String(const char *text) : buffer(NULL), len(0), capacity(0)
+{
+    concat(text ? text : "");
+}
+
+String::String(const String &other) : buffer(NULL), len(0), capacity(0)
+{
+    concat(other);
+}
+
+String::String(String &&other) : buffer(other.buffer), len(other.len), capacity(other.capacity)
+{
+    other.buffer = NULL;
+    other.len = other.capacity = 0;
+}
+
+String::String(char c) : buffer(NULL), len(0), capacity(0)
+{
+    concat(c);
+}
+
+// Digits of value in base, with a minus sign when negative
+static void appendInteger(String &text, unsigned long long value, bool negative, unsigned char base)
+{
+    char digits[72];
+    char *p = digits + sizeof(digits) - 1;
+    *p = 0;
+    do
+    {
+        *--p = "0123456789abcdefghijklmnopqrstuvwxyz"[value % base];
+        value /= base;
+    } while (value);
+    if (negative)
+        *--p = '-';
+    text.concat(p);
+}
+
+String::String(int value, unsigned char base) : buffer(NULL), len(0), capacity(0)
+{
+    appendInteger(*this, value < 0 && base == 10 ? -(long long)value : (unsigned int)value, value < 0 && base == 10, base);
+}
+
+String::String(unsigned int value, unsigned char base) : buffer(NULL), len(0), capacity(0)
+{
+    appendInteger(*this, value, false, base);
+}
+
+String::String(long value, unsigned char base) : buffer(NULL), len(0), capacity(0)
+{
+    appendInteger(*this, value < 0 && base == 10 ? -(long long)value : (unsigned long)value, value < 0 && base == 10, base);
+}
+
+String::String(unsigned long value, unsigned char base) : buffer(NULL), len(0), capacity(0)
+{
+    appendInteger(*this, value, false, base);
+}
+
+String::String(float value, unsigned int decimalPlaces) : String((double)value, decimalPlaces)
+{
+}
+
+String::String(double value, unsigned int decimalPlaces) : buffer(NULL), len(0), capacity(0)
+{
+    char text[64];
+    snprintf(text, sizeof(text), "%.*f", decimalPlaces, value);
+    concat(text);
+}
+
+String::~String()
+{
+    free(buffer);
+}
+
+String &String::operator=(const String &other)
+{
+    if (this != &other)
+    {
+        len = 0;
+        concat(other);
+    }
+    return *this;
+}
+
+String &String::operator=(String &&other)
+{
+    if (this != &other)
+    {
+        free(buffer);
+        buffer = other.buffer;
+        len = other.len;
+        capacity = other.capacity;
+        other.buffer = NULL;
+        other.len = other.capacity = 0;
+    }
+    return *this;
+}
+
+String &String::operator=(const char *text)
+{
+    len = 0;
+    concat(text ? text : "");
+    return *this;
+}
+
+bool String::reserve(unsigned int size)
+{
+    if (buffer && capacity >= size)
+        return true;
+    char *grown = (char *)realloc(buffer, size + 1);
+    if (!grown)
+        return false;
+    if (!buffer)
+        grown[0] = 0;
+    buffer = grown;
+    capacity = size;
+    return true;
+}
+
+bool String::concat(const char *text, unsigned int length)
+{
+    if (!reserve(len + length))
+        return false;
+    memmove(buffer + len, text, length);
+    len += length;
+    buffer[len] = 0;
+    return true;
+}
+
+bool String::endsWith(const String &suffix) const
+{
+    return len >= suffix.len && strcmp(c_str() + len - suffix.len, suffix.c_str()) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const
+{
+    if (from >= len)
+        return -1;
+    const char *found = strchr(c_str() + from, c);
+    return found ? found - c_str() : -1;
+}
+
+int String::indexOf(const String &text, unsigned int from) const
+{
+    if (from >= len)
+        return -1;
+    const char *found = strstr(c_str() + from, text.c_str());
+    return found ? found - c_str() : -1;
+}
+
+String String::substring(unsigned int from, unsigned int to) const
+{
+    if (from > to)
+        std::swap(from, to);
+    if (from >= len)
+        return String();
+    if (to > len)
+        to = len;
+    String part;
+    part.concat(c_str() + from, to - from);
+    return part;
+}
+
+void String::replace(const String &find, const String &replacement)
+{
+    if (find.len == 0)
+        return;
+    String result;
+    const char *s = c_str();
+    for (const char *hit; (hit = strstr(s, find.c_str())) != NULL; s = hit + find.len)
+    {
+        result.concat(s, hit - s);
+        result.concat(replacement);
+    }
+    result.concat(s);
+    *this = static_cast<String &&>(result);
+}
+
+void String::toLowerCase()
+{
+    for (unsigned int i = 0; i < len; i++)
+        buffer[i] = tolower((unsigned char)buffer[i]);
+}
+
+void String::toUpperCase()
+{
+    for (unsigned int i = 0; i < len; i++)
+        buffer[i] = toupper((unsigned char)buffer[i]);
+}
+
+void String::trim()
+{
+    unsigned int start = 0, end = len;
+    while (start < end && isspace((unsigned char)buffer[start]))
+        start++;
+    while (end > start && isspace((unsigned char)buffer[end - 1]))
+        end--;
+    *this = substring(start, end);
+}
+
+String operator+(const String &a, const String &b)
+{
+    String sum(a);
+    sum.concat(b);
+    return sum;
+}
+
+String operator+(const String &a, const char *b)
+{
+    String sum(a);
+    sum.concat(b);
+    return sum;
+}
+
+String operator+(const char *a, const String &b)
+{
+    String sum(a);
+    sum.concat(b);
+    return sum;
+}
+
+//################ Print, Stream, Serial ##################################################
+
+size_t Print::write(const uint8_t *data, size_t size)
+{
+    size_t n = 0;
+    while (n < size && write(data[n]))
+        n++;
+    return n;
+}
+
+size_t Print::printf(const char *format, ...)
+{
+    char text[512];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    if (length < 0)
+        return 0;
+    return write((const uint8_t *)text, std::min((size_t)length, sizeof(text) - 1));
+}
+
+size_t Stream::readBytes(char *data, size_t length)
+{
+    size_t n = 0;
+    for (int c; n < length && (c = read()) >= 0; n++)
+        data[n] = c;
+    return n;
+}
+
+// Serial diagnostics are printed with the info logs
+size_t HardwareSerial::write(uint8_t c)
+{
+    return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t *data, size_t size)
+{
+    return hostLogLevel >= ESP_LOG_INFO ? fwrite(data, 1, size, stdout) : size;
+}
+
+void hostLog(esp_log_level_t level, const char *tag, const char *format, ...)
+{
+    if (level > hostLogLevel)
+        return;
+    va_list args;
+    va_start(args, format);
+    printf("[%c][%s] ", "NEWIDV"[level], tag);
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+}
+
+//################ Timing ##################################################
+
+static int64_t monotonicMicros()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+static const int64_t bootMicros = monotonicMicros();
+
+unsigned long millis()
+{
+    return (monotonicMicros() - bootMicros) / 1000;
+}
+
+unsigned long micros()
+{
+    return monotonicMicros() - bootMicros;
+}
+
+int64_t esp_timer_get_time()
+{
+    return monotonicMicros() - bootMicros;
+}
+
+void delay(uint32_t ms)
+{
+    (void)ms;
+}
+
+void yield()
+{
+}
+
+//################ Wall clock ##################################################
+
+// The firmware's time(), gettimeofday() and settimeofday() calls are linked to this clock (-Wl,--wrap), so every
+// run sees the same time no matter when it runs
+static struct timeval hostClock = {0, 0};
+
+void HostSetClock(time_t now)
+{
+    hostClock.tv_sec = now;
+    hostClock.tv_usec = 0;
+}
+
+extern "C" time_t __wrap_time(time_t *out)
+{
+    if (out)
+        *out = hostClock.tv_sec;
+    return hostClock.tv_sec;
+}
+
+extern "C" int __wrap_gettimeofday(struct timeval *tv, void *tz)
+{
+    (void)tz;
+    if (tv)
+        *tv = hostClock;
+    return 0;
+}
+
+extern "C" int __wrap_settimeofday(const struct timeval *tv, const void *tz)
+{
+    (void)tz;
+    if (tv)
+        hostClock = *tv;
+    return 0;
+}
+
+void configTime(long gmtOffset, int daylightOffset, const char *server1, const char *server2, const char *server3)
+{
+    (void)gmtOffset, (void)daylightOffset, (void)server1, (void)server2, (void)server3;
+}
+
+bool getLocalTime(struct tm *info, uint32_t ms)
+{
+    (void)ms;
+    time_t now = time(NULL);
+    localtime_r(&now, info);
+    return info->tm_year > (2016 - 1900);
+}
+
+//################ Pins ##################################################
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    (void)pin, (void)mode;
+}
+
+int digitalRead(uint8_t pin)
+{
+    (void)pin;
+    return HIGH; // Buttons are pulled up and never pressed
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+    (void)pin, (void)value;
+}
+
+uint16_t analogRead(uint8_t pin)
+{
+    (void)pin;
+    return 2400; // 4.2 V on the battery divider with the default 1100 mV reference
+}
+
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode)
+{
+    (void)pin, (void)handler, (void)mode;
+}
@@ -0,0 +1,225 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Host stand-in for the parts of the Arduino ESP32 core the firmware uses: String, Stream, Serial, ESP, timing,
+// pins and logging. Only what the shared sources need, see host/CMakeLists.txt.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <ctype.h>
+#include <time.h>
+#include <algorithm>
+
+#include "esp_err.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_system.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define PI 3.1415926535897932384626433832795
+#define F(text) (text)
+#define PROGMEM
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+using std::max;
+using std::min;
+
+// Arduino String on the C heap like the core's WString, so the host allocation tracker sees it
+class String
+{
+public:
+    String(const char *text = "");
+    String(const String &other);
+    String(String &&other);
+    explicit String(char c);
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(float value, unsigned int decimalPlaces = 2);
+    explicit String(double value, unsigned int decimalPlaces = 2);
+    ~String();
+
+    String &operator=(const String &other);
+    String &operator=(String &&other);
+    String &operator=(const char *text);
+
+    const char *c_str() const { return buffer ? buffer : ""; }
+    unsigned int length() const { return len; }
+    bool reserve(unsigned int size);
+
+    bool concat(const String &other) { return concat(other.c_str(), other.len); }
+    bool concat(const char *text) { return text ? concat(text, strlen(text)) : false; }
+    bool concat(const char *text, unsigned int length);
+    bool concat(char c) { return concat(&c, 1); }
+    String &operator+=(const String &other) { concat(other); return *this; }
+    String &operator+=(const char *text) { concat(text); return *this; }
+    String &operator+=(char c) { concat(c); return *this; }
+
+    bool equals(const String &other) const { return strcmp(c_str(), other.c_str()) == 0; }
+    bool equals(const char *text) const { return strcmp(c_str(), text ? text : "") == 0; }
+    bool equalsIgnoreCase(const String &other) const { return strcasecmp(c_str(), other.c_str()) == 0; }
+    bool operator==(const String &other) const { return equals(other); }
+    bool operator==(const char *text) const { return equals(text); }
+    bool operator!=(const String &other) const { return !equals(other); }
+    bool operator!=(const char *text) const { return !equals(text); }
+    bool startsWith(const String &prefix) const { return strncmp(c_str(), prefix.c_str(), prefix.len) == 0; }
+    bool endsWith(const String &suffix) const;
+
+    char operator[](unsigned int index) const { return index < len ? buffer[index] : 0; }
+    char charAt(unsigned int index) const { return (*this)[index]; }
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String &text, unsigned int from = 0) const;
+    String substring(unsigned int from) const { return substring(from, len); }
+    String substring(unsigned int from, unsigned int to) const;
+    void replace(const String &find, const String &replacement);
+    void toLowerCase();
+    void toUpperCase();
+    void trim();
+    long toInt() const { return atol(c_str()); }
+    float toFloat() const { return atof(c_str()); }
+
+private:
+    char *buffer;
+    unsigned int len;
+    unsigned int capacity;
+};
+
+String operator+(const String &a, const String &b);
+String operator+(const String &a, const char *b);
+String operator+(const char *a, const String &b);
+
+class Print;
+
+class Printable
+{
+public:
+    virtual ~Printable() {}
+    virtual size_t printTo(Print &p) const = 0;
+};
+
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *data, size_t size);
+    size_t write(const char *text) { return text ? write((const uint8_t *)text, strlen(text)) : 0; }
+    size_t print(const char *text) { return write(text); }
+    size_t print(const String &text) { return write(text.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int value) { return printf("%d", value); }
+    size_t print(unsigned int value) { return printf("%u", value); }
+    size_t print(long value) { return printf("%ld", value); }
+    size_t print(unsigned long value) { return printf("%lu", value); }
+    size_t print(double value, int decimalPlaces = 2) { return printf("%.*f", decimalPlaces, value); }
+    size_t println() { return write("\r\n"); }
+    template <typename T> size_t println(const T &value) { return print(value) + println(); }
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    size_t readBytes(char *data, size_t length);
+    size_t readBytes(uint8_t *data, size_t length) { return readBytes((char *)data, length); }
+    void setTimeout(unsigned long) {}
+};
+
+// Serial output goes to stdout
+class HardwareSerial : public Stream
+{
+public:
+    void begin(unsigned long) {}
+    void end() {}
+    operator bool() const { return true; }
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *data, size_t size) override;
+    using Print::write;
+};
+extern HardwareSerial Serial;
+
+class EspClass
+{
+public:
+    uint32_t getCycleCount(); // Host nanoseconds scaled to the 240 MHz CPU clock
+    uint32_t getCpuFreqMHz() { return 240; }
+    uint32_t getFreeHeap();
+    uint32_t getHeapSize();
+    uint32_t getMaxAllocHeap();
+    uint32_t getFreePsram();
+    uint32_t getPsramSize();
+    uint32_t getMaxAllocPsram();
+    void restart();
+};
+extern EspClass ESP;
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms); // Returns at once, nothing on the host waits for hardware
+void yield();
+
+void *ps_malloc(size_t size);
+void *ps_calloc(size_t count, size_t size);
+void *ps_realloc(void *ptr, size_t size);
+
+// Pins
+typedef enum
+{
+    GPIO_NUM_0 = 0, GPIO_NUM_14 = 14, GPIO_NUM_15 = 15, GPIO_NUM_16 = 16, GPIO_NUM_17 = 17, GPIO_NUM_18 = 18,
+    GPIO_NUM_21 = 21, GPIO_NUM_35 = 35, GPIO_NUM_36 = 36, GPIO_NUM_39 = 39
+} gpio_num_t;
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define LOW 0
+#define HIGH 1
+#define RISING 0x01
+#define FALLING 0x02
+#define digitalPinToInterrupt(pin) (pin)
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t value);
+uint16_t analogRead(uint8_t pin);
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode);
+
+// Time, NTP is never reached on the host, the clock is set by the harness
+void configTime(long gmtOffset, int daylightOffset, const char *server1, const char *server2 = NULL, const char *server3 = NULL);
+bool getLocalTime(struct tm *info, uint32_t ms = 5000);
+
+// Sleep, the host harness runs the wake cycle itself
+typedef enum { ESP_PD_DOMAIN_RTC_PERIPH } esp_sleep_pd_domain_t;
+typedef enum { ESP_PD_OPTION_OFF, ESP_PD_OPTION_ON, ESP_PD_OPTION_AUTO } esp_sleep_pd_option_t;
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us);
+esp_err_t esp_sleep_pd_config(esp_sleep_pd_domain_t domain, esp_sleep_pd_option_t option);
+void esp_deep_sleep_start();
+esp_err_t esp_light_sleep_start();
+
+// ESP-IDF logging, printed from hostLogLevel up (1 error .. 5 verbose, CORE_DEBUG_LEVEL on the device)
+typedef enum { ESP_LOG_NONE, ESP_LOG_ERROR, ESP_LOG_WARN, ESP_LOG_INFO, ESP_LOG_DEBUG, ESP_LOG_VERBOSE } esp_log_level_t;
+extern int hostLogLevel;
+void hostLog(esp_log_level_t level, const char *tag, const char *format, ...) __attribute__((format(printf, 3, 4)));
+#define ESP_LOGE(tag, format, ...) hostLog(ESP_LOG_ERROR, tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) hostLog(ESP_LOG_WARN, tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) hostLog(ESP_LOG_INFO, tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) hostLog(ESP_LOG_DEBUG, tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) hostLog(ESP_LOG_VERBOSE, tag, format, ##__VA_ARGS__)
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,113 @@
+#include "FS.h"
+#include "SPIFFS.h"
+#include <sys/stat.h>
+
+#ifndef HOST_SPIFFS_ROOT
+#define HOST_SPIFFS_ROOT "spiffs"
+#endif
+
+SPIFFSFS SPIFFS;
+
+SPIFFSFS::SPIFFSFS() : fs::FS(HOST_SPIFFS_ROOT)
+{
+}
+
+namespace fs
+{
+
+File &File::operator=(File &&other)
+{
+    if (this != &other)
+    {
+        close();
+        file = other.file;
+        other.file = NULL;
+    }
+    return *this;
+}
+
+int File::available()
+{
+    if (!file)
+        return 0;
+    return size() - position();
+}
+
+int File::read()
+{
+    return file ? fgetc(file) : -1;
+}
+
+int File::peek()
+{
+    if (!file)
+        return -1;
+    int c = fgetc(file);
+    if (c >= 0)
+        ungetc(c, file);
+    return c;
+}
+
+size_t File::read(uint8_t *data, size_t size)
+{
+    return file ? fread(data, 1, size, file) : 0;
+}
+
+size_t File::write(const uint8_t *data, size_t size)
+{
+    return file ? fwrite(data, 1, size, file) : 0;
+}
+
+bool File::seek(uint32_t position)
+{
+    return file && fseek(file, position, SEEK_SET) == 0;
+}
+
+size_t File::position() const
+{
+    return file ? ftell(file) : 0;
+}
+
+size_t File::size() const
+{
+    struct stat info;
+    return file && fstat(fileno(file), &info) == 0 ? info.st_size : 0;
+}
+
+void File::close()
+{
+    if (file)
+        fclose(file);
+    file = NULL;
+}
+
+void FS::hostPath(char *out, size_t size, const char *path) const
+{
+    snprintf(out, size, "%s%s%s", root, path[0] == '/' ? "" : "/", path);
+}
+
+File FS::open(const char *path, const char *mode)
+{
+    char name[512];
+    hostPath(name, sizeof(name), path);
+    char binaryMode[4];
+    snprintf(binaryMode, sizeof(binaryMode), "%sb", mode);
+    return File(fopen(name, binaryMode));
+}
+
+bool FS::exists(const char *path)
+{
+    char name[512];
+    hostPath(name, sizeof(name), path);
+    struct stat info;
+    return stat(name, &info) == 0;
+}
+
+bool FS::remove(const char *path)
+{
+    char name[512];
+    hostPath(name, sizeof(name), path);
+    return ::remove(name) == 0;
+}
+
+} // namespace fs
@@ -0,0 +1,60 @@
+#ifndef HOST_FS_H
+#define HOST_FS_H
+
+#include <Arduino.h>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs
+{
+
+// A file of the host directory standing in for the SPIFFS partition
+class File : public Stream
+{
+public:
+    File(FILE *file = NULL) : file(file) {}
+    File(const File &) = delete;
+    File(File &&other) : file(other.file) { other.file = NULL; }
+    File &operator=(File &&other);
+    ~File() { close(); }
+
+    operator bool() const { return file != NULL; }
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t read(uint8_t *data, size_t size);
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *data, size_t size) override;
+    using Print::write;
+    bool seek(uint32_t position);
+    size_t position() const;
+    size_t size() const;
+    void close();
+
+private:
+    FILE *file;
+};
+
+class FS
+{
+public:
+    FS(const char *root) : root(root) {}
+    File open(const char *path, const char *mode = FILE_READ);
+    File open(const String &path, const char *mode = FILE_READ) { return open(path.c_str(), mode); }
+    bool exists(const char *path);
+    bool exists(const String &path) { return exists(path.c_str()); }
+    bool remove(const char *path);
+    bool remove(const String &path) { return remove(path.c_str()); }
+
+protected:
+    void hostPath(char *out, size_t size, const char *path) const;
+    const char *root;
+};
+
+} // namespace fs
+
+using fs::File;
+
+#endif // HOST_FS_H
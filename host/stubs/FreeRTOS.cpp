@@ -0,0 +1,175 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include <Arduino.h>
+
+// Queues hold copies of their items in a ring, semaphores are queues of zero sized items
+struct HostQueue
+{
+    UBaseType_t length;
+    UBaseType_t itemSize;
+    UBaseType_t count;
+    UBaseType_t head;
+    uint8_t *items;
+};
+
+struct HostTask
+{
+    const char *name;
+};
+
+static HostTask mainTask = {"main"};
+
+// Nothing else runs that could end the wait
+static BaseType_t cannotWait(const char *call, TickType_t wait)
+{
+    if (wait == portMAX_DELAY)
+    {
+        fprintf(stderr, "%s would block forever, no other task runs on the host\n", call);
+        abort();
+    }
+    return pdFALSE;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+    HostQueue *queue = (HostQueue *)calloc(1, sizeof(HostQueue));
+    if (!queue)
+        return NULL;
+    queue->length = length;
+    queue->itemSize = itemSize;
+    if (itemSize && !(queue->items = (uint8_t *)malloc(length * itemSize)))
+    {
+        free(queue);
+        return NULL;
+    }
+    return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+    if (queue)
+        free(queue->items);
+    free(queue);
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t wait)
+{
+    if (queue->count == queue->length)
+        return cannotWait("xQueueSend", wait);
+    memcpy(queue->items + (queue->head + queue->count) % queue->length * queue->itemSize, item, queue->itemSize);
+    queue->count++;
+    return pdTRUE;
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void *item, TickType_t wait)
+{
+    if (queue->count == 0)
+        return cannotWait("xQueuePeek", wait);
+    memcpy(item, queue->items + queue->head * queue->itemSize, queue->itemSize);
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t wait)
+{
+    if (queue->count == 0)
+        return cannotWait("xQueueReceive", wait);
+    memcpy(item, queue->items + queue->head * queue->itemSize, queue->itemSize);
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    return pdTRUE;
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue)
+{
+    queue->count = queue->head = 0;
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    return queue->count;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary()
+{
+    return xQueueCreate(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    SemaphoreHandle_t mutex = xQueueCreate(1, 0);
+    if (mutex)
+        mutex->count = 1;
+    return mutex;
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initialCount)
+{
+    SemaphoreHandle_t semaphore = xQueueCreate(maxCount, 0);
+    if (semaphore)
+        semaphore->count = initialCount;
+    return semaphore;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t wait)
+{
+    if (semaphore->count == 0)
+        return cannotWait("xSemaphoreTake", wait);
+    semaphore->count--;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    if (semaphore->count == semaphore->length)
+        return pdFALSE;
+    semaphore->count++;
+    return pdTRUE;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t task, const char *name, uint32_t stackDepth, void *parameter, UBaseType_t priority,
+                       TaskHandle_t *created)
+{
+    return xTaskCreatePinnedToCore(task, name, stackDepth, parameter, priority, created, 0);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stackDepth, void *parameter,
+                                   UBaseType_t priority, TaskHandle_t *created, BaseType_t core)
+{
+    (void)task, (void)stackDepth, (void)parameter, (void)priority, (void)created, (void)core;
+    ESP_LOGW("HOST", "Task %s not started, there is no scheduler on the host", name);
+    return errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    (void)task;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    (void)ticks;
+}
+
+TickType_t xTaskGetTickCount()
+{
+    return millis();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    return &mainTask;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task)
+{
+    (void)task;
+    return 0;
+}
+
+BaseType_t xPortGetCoreID()
+{
+    return 0;
+}
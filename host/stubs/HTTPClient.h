@@ -0,0 +1,20 @@
+#ifndef HOST_HTTPCLIENT_H
+#define HOST_HTTPCLIENT_H
+
+#include <Arduino.h>
+#include "WiFiClient.h"
+
+#define HTTP_CODE_OK 200
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+
+class HTTPClient
+{
+public:
+    bool begin(WiFiClient &client, const String &host, uint16_t port, const String &uri) { (void)client; (void)host; (void)port; (void)uri; return false; }
+    int GET() { return HTTPC_ERROR_CONNECTION_REFUSED; }
+    Stream &getStream();
+    void end() {}
+    static String errorToString(int error) { (void)error; return "connection refused"; }
+};
+
+#endif // HOST_HTTPCLIENT_H
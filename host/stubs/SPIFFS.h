@@ -0,0 +1,18 @@
+#ifndef HOST_SPIFFS_H
+#define HOST_SPIFFS_H
+
+#include "FS.h"
+
+// SPIFFS is the directory HOST_SPIFFS_ROOT, a copy of data/ made in the build tree
+class SPIFFSFS : public fs::FS
+{
+public:
+    SPIFFSFS();
+    bool begin(bool formatOnFail = false) { (void)formatOnFail; return true; }
+    void end() {}
+    size_t totalBytes() { return 1536 * 1024; }
+    size_t usedBytes() { return 0; }
+};
+extern SPIFFSFS SPIFFS;
+
+#endif // HOST_SPIFFS_H
@@ -0,0 +1,39 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+#include "WiFiClient.h"
+
+// No network on the host: every connection attempt fails, the fixtures in data/soak stand in for OWM
+typedef enum { WIFI_OFF, WIFI_STA, WIFI_AP, WIFI_AP_STA } wifi_mode_t;
+typedef enum { WL_IDLE_STATUS = 0, WL_NO_SSID_AVAIL = 1, WL_CONNECTED = 3, WL_CONNECT_FAILED = 4, WL_DISCONNECTED = 6 } wl_status_t;
+
+class IPAddress
+{
+public:
+    IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : octets{a, b, c, d} {}
+    String toString() const;
+
+private:
+    uint8_t octets[4];
+};
+
+class WiFiClass
+{
+public:
+    bool mode(wifi_mode_t) { return true; }
+    wifi_mode_t getMode() { return WIFI_OFF; }
+    bool disconnect(bool wifiOff = false) { (void)wifiOff; return true; }
+    bool setAutoConnect(bool) { return true; }
+    bool setAutoReconnect(bool) { return true; }
+    wl_status_t begin(const char *ssid, const char *password = NULL) { (void)ssid; (void)password; return WL_DISCONNECTED; }
+    uint8_t waitForConnectResult(unsigned long timeout = 60000) { (void)timeout; return WL_DISCONNECTED; }
+    wl_status_t status() { return WL_DISCONNECTED; }
+    int8_t RSSI() { return 0; }
+    IPAddress localIP() { return IPAddress(); }
+    IPAddress softAPIP() { return IPAddress(); }
+    bool softAP(const char *ssid, const char *password = NULL) { (void)ssid; (void)password; return false; }
+};
+extern WiFiClass WiFi;
+
+#endif // HOST_WIFI_H
@@ -0,0 +1,12 @@
+#ifndef HOST_WIFICLIENT_H
+#define HOST_WIFICLIENT_H
+
+#include <Arduino.h>
+
+class WiFiClient
+{
+public:
+    void stop() {}
+};
+
+#endif // HOST_WIFICLIENT_H
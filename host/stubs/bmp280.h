@@ -0,0 +1,28 @@
+#ifndef HOST_BMP280_H
+#define HOST_BMP280_H
+
+#include "i2cdev.h"
+
+#define BMP280_I2C_ADDRESS_0 0x76
+#define BMP280_CHIP_ID 0x58
+#define BME280_CHIP_ID 0x60
+
+typedef struct
+{
+    int mode;
+} bmp280_params_t;
+
+typedef struct
+{
+    i2c_port_t port;
+    uint8_t id;
+} bmp280_t;
+
+esp_err_t bmp280_init_default_params(bmp280_params_t *params);
+esp_err_t bmp280_init_desc(bmp280_t *dev, uint8_t addr, i2c_port_t port, gpio_num_t sda_gpio, gpio_num_t scl_gpio);
+esp_err_t bmp280_init(bmp280_t *dev, bmp280_params_t *params);
+esp_err_t bmp280_force_measurement(bmp280_t *dev);
+esp_err_t bmp280_is_measuring(bmp280_t *dev, bool *busy);
+esp_err_t bmp280_read_float(bmp280_t *dev, float *temperature, float *pressure, float *humidity);
+
+#endif // HOST_BMP280_H
@@ -0,0 +1,64 @@
+#include "epd_driver.h"
+#include <zlib.h>
+#include "esp32s3/rom/miniz.h"
+
+// The panel: nothing to drive on the host, the harnesses read the framebuffer
+
+void epd_init() {}
+void epd_deinit() {}
+void epd_poweron() {}
+void epd_poweroff() {}
+void epd_poweroff_all() {}
+void epd_clear() {}
+void epd_clear_area(Rect_t area) { (void)area; }
+void epd_clear_area_cycles(Rect_t area, int32_t cycles, int32_t cycle_time) { (void)area, (void)cycles, (void)cycle_time; }
+void epd_draw_grayscale_image(Rect_t area, uint8_t *data) { (void)area, (void)data; }
+void epd_draw_image(Rect_t area, uint8_t *data, DrawMode_t mode) { (void)area, (void)data, (void)mode; }
+void epd_draw_frame_1bit(Rect_t area, uint8_t *ptr, DrawMode_t mode, int32_t time) { (void)area, (void)ptr, (void)mode, (void)time; }
+void epd_push_pixels(Rect_t area, int16_t time, int32_t color) { (void)area, (void)time, (void)color; }
+
+Rect_t epd_full_screen()
+{
+    return {0, 0, EPD_WIDTH, EPD_HEIGHT};
+}
+
+// Same lookup as the driver: binary search of the code point intervals
+void get_glyph(const GFXfont *font, uint32_t code_point, GFXglyph **glyph)
+{
+    const UnicodeInterval *intervals = font->intervals;
+    *glyph = NULL;
+    if (!font->interval_count)
+        return;
+    int low = 0, high = font->interval_count - 1;
+    while (low <= high)
+    {
+        const int mid = low + (high - low) / 2;
+        const UnicodeInterval *interval = &intervals[mid];
+        if (code_point >= interval->first && code_point <= interval->last)
+        {
+            *glyph = &font->glyph[interval->offset + (code_point - interval->first)];
+            return;
+        }
+        if (code_point < interval->first)
+            high = mid - 1;
+        else
+            low = mid + 1;
+    }
+}
+
+// Glyph streams are inflated in one call: the whole input and output buffer are always given
+tinfl_status tinfl_decompress(tinfl_decompressor *r, const uint8_t *in, size_t *inSize, uint8_t *outStart, uint8_t *outNext,
+                              size_t *outSize, uint32_t flags)
+{
+    (void)r, (void)outStart;
+    if (!(flags & TINFL_FLAG_PARSE_ZLIB_HEADER) || !(flags & TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF))
+        return TINFL_STATUS_BAD_PARAM;
+    uLongf produced = *outSize;
+    uLong consumed = *inSize;
+    const int result = uncompress2(outNext, &produced, in, &consumed);
+    *inSize = consumed;
+    *outSize = produced;
+    if (result == Z_BUF_ERROR)
+        return TINFL_STATUS_HAS_MORE_OUTPUT;
+    return result == Z_OK ? TINFL_STATUS_DONE : TINFL_STATUS_FAILED;
+}
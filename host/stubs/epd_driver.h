@@ -0,0 +1,83 @@
+#ifndef HOST_EPD_DRIVER_H
+#define HOST_EPD_DRIVER_H
+
+// Types and calls of the LilyGo-EPD47 driver the firmware uses. The firmware draws into its framebuffer itself
+// (rasteriser, textRenderer), the panel calls do nothing on the host.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define EPD_WIDTH 960
+#define EPD_HEIGHT 540
+
+typedef struct
+{
+    int x;
+    int y;
+    int width;
+    int height;
+} Rect_t;
+
+typedef enum
+{
+    BLACK_ON_WHITE = 1 << 0,
+    WHITE_ON_WHITE = 1 << 1,
+    WHITE_ON_BLACK = 1 << 2,
+} DrawMode_t;
+
+typedef struct
+{
+    uint8_t width;
+    uint8_t height;
+    uint8_t advance_x;
+    int16_t left;
+    int16_t top;
+    uint16_t compressed_size;
+    uint32_t data_offset;
+} GFXglyph;
+
+typedef struct
+{
+    uint32_t first;
+    uint32_t last;
+    uint32_t offset;
+} UnicodeInterval;
+
+typedef struct
+{
+    uint8_t *bitmap;
+    GFXglyph *glyph;
+    UnicodeInterval *intervals;
+    uint32_t interval_count;
+    bool compressed;
+    uint8_t advance_y;
+    int ascender;
+    int descender;
+} GFXfont;
+
+typedef struct
+{
+    uint8_t fg_color : 4;
+    uint8_t bg_color : 4;
+    uint32_t fallback_glyph;
+    uint32_t flags;
+} FontProperties;
+
+void epd_init();
+void epd_deinit();
+void epd_poweron();
+void epd_poweroff();
+void epd_poweroff_all();
+void epd_clear();
+void epd_clear_area(Rect_t area);
+void epd_clear_area_cycles(Rect_t area, int32_t cycles, int32_t cycle_time);
+Rect_t epd_full_screen();
+void epd_draw_grayscale_image(Rect_t area, uint8_t *data);
+void epd_draw_image(Rect_t area, uint8_t *data, DrawMode_t mode);
+void epd_draw_frame_1bit(Rect_t area, uint8_t *ptr, DrawMode_t mode, int32_t time);
+void epd_push_pixels(Rect_t area, int16_t time, int32_t color);
+
+void get_glyph(const GFXfont *font, uint32_t code_point, GFXglyph **glyph);
+
+#endif // HOST_EPD_DRIVER_H
@@ -0,0 +1,171 @@
+#include <Arduino.h>
+#include <malloc.h>
+#include "esp_adc_cal.h"
+#include "esp_timer.h"
+
+EspClass ESP;
+
+// Nominal sizes of the ESP32-S3 heaps with 8 MB PSRAM, the host does not track what is free
+#define HOST_INTERNAL_HEAP (320 * 1024)
+#define HOST_PSRAM_HEAP (8 * 1024 * 1024)
+
+static size_t heapSize(uint32_t caps)
+{
+    if (caps & MALLOC_CAP_INTERNAL)
+        return HOST_INTERNAL_HEAP;
+    if (caps & MALLOC_CAP_SPIRAM)
+        return HOST_PSRAM_HEAP;
+    return HOST_INTERNAL_HEAP + HOST_PSRAM_HEAP;
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    (void)caps;
+    return malloc(size);
+}
+
+void *heap_caps_calloc(size_t count, size_t size, uint32_t caps)
+{
+    (void)caps;
+    return calloc(count, size);
+}
+
+void *heap_caps_realloc(void *ptr, size_t size, uint32_t caps)
+{
+    (void)caps;
+    return realloc(ptr, size);
+}
+
+void heap_caps_free(void *ptr)
+{
+    free(ptr);
+}
+
+size_t heap_caps_get_total_size(uint32_t caps)
+{
+    return heapSize(caps);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+    return heapSize(caps);
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps)
+{
+    return heapSize(caps);
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+    return heapSize(caps);
+}
+
+size_t heap_caps_get_allocated_size(void *ptr)
+{
+    return malloc_usable_size(ptr);
+}
+
+uint32_t esp_get_free_heap_size()
+{
+    return heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+}
+
+uint32_t esp_get_minimum_free_heap_size()
+{
+    return heap_caps_get_minimum_free_size(MALLOC_CAP_DEFAULT);
+}
+
+void esp_restart()
+{
+    exit(0);
+}
+
+void *ps_malloc(size_t size)
+{
+    return heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+}
+
+void *ps_calloc(size_t count, size_t size)
+{
+    return heap_caps_calloc(count, size, MALLOC_CAP_SPIRAM);
+}
+
+void *ps_realloc(void *ptr, size_t size)
+{
+    return heap_caps_realloc(ptr, size, MALLOC_CAP_SPIRAM);
+}
+
+uint32_t EspClass::getCycleCount()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 240000000ULL + (uint64_t)now.tv_nsec * 240 / 1000);
+}
+
+uint32_t EspClass::getFreeHeap()
+{
+    return heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+}
+
+uint32_t EspClass::getHeapSize()
+{
+    return heap_caps_get_total_size(MALLOC_CAP_INTERNAL);
+}
+
+uint32_t EspClass::getMaxAllocHeap()
+{
+    return heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+}
+
+uint32_t EspClass::getFreePsram()
+{
+    return heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+}
+
+uint32_t EspClass::getPsramSize()
+{
+    return heap_caps_get_total_size(MALLOC_CAP_SPIRAM);
+}
+
+uint32_t EspClass::getMaxAllocPsram()
+{
+    return heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
+}
+
+void EspClass::restart()
+{
+    esp_restart();
+}
+
+esp_adc_cal_value_t esp_adc_cal_characterize(adc_unit_t unit, adc_atten_t atten, adc_bits_width_t width, uint32_t defaultVref,
+                                             esp_adc_cal_characteristics_t *chars)
+{
+    *chars = {unit, atten, width, 0, 0, defaultVref};
+    return ESP_ADC_CAL_VAL_DEFAULT_VREF;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us)
+{
+    (void)us;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_pd_config(esp_sleep_pd_domain_t domain, esp_sleep_pd_option_t option)
+{
+    (void)domain, (void)option;
+    return ESP_OK;
+}
+
+// A sleep ends the run, the harnesses call the wake cycle themselves and never get here
+void esp_deep_sleep_start()
+{
+    fprintf(stderr, "Deep sleep reached on the host\n");
+    exit(1);
+}
+
+esp_err_t esp_light_sleep_start()
+{
+    fprintf(stderr, "Light sleep reached on the host\n");
+    exit(1);
+}
@@ -0,0 +1,34 @@
+#ifndef HOST_MINIZ_H
+#define HOST_MINIZ_H
+
+// The ROM inflate of the ESP32 family, backed by zlib on the host (one call per complete glyph stream)
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum
+{
+    TINFL_STATUS_BAD_PARAM = -3,
+    TINFL_STATUS_ADLER32_MISMATCH = -2,
+    TINFL_STATUS_FAILED = -1,
+    TINFL_STATUS_DONE = 0,
+    TINFL_STATUS_NEEDS_MORE_INPUT = 1,
+    TINFL_STATUS_HAS_MORE_OUTPUT = 2
+} tinfl_status;
+
+#define TINFL_FLAG_PARSE_ZLIB_HEADER 1
+#define TINFL_FLAG_HAS_MORE_INPUT 2
+#define TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF 4
+#define TINFL_FLAG_COMPUTE_ADLER32 8
+
+typedef struct
+{
+    uint32_t state;
+    uint8_t reserved[11000 - sizeof(uint32_t)]; // Same footprint as the ROM decompressor
+} tinfl_decompressor;
+
+#define tinfl_init(r) ((r)->state = 0)
+
+tinfl_status tinfl_decompress(tinfl_decompressor *r, const uint8_t *in, size_t *inSize, uint8_t *outStart, uint8_t *outNext,
+                              size_t *outSize, uint32_t flags);
+
+#endif // HOST_MINIZ_H
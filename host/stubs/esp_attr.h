@@ -0,0 +1,11 @@
+#ifndef HOST_ESP_ATTR_H
+#define HOST_ESP_ATTR_H
+
+// Placement attributes have no meaning on the host, RTC memory is ordinary static storage
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+#define EXT_RAM_ATTR
+
+#endif // HOST_ESP_ATTR_H
@@ -0,0 +1,6 @@
+#ifndef HOST_ESP_NOW_H
+#define HOST_ESP_NOW_H
+
+#include "esp_err.h"
+
+#endif // HOST_ESP_NOW_H
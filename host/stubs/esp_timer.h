@@ -0,0 +1,8 @@
+#ifndef HOST_ESP_TIMER_H
+#define HOST_ESP_TIMER_H
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time(); // Microseconds of the host's monotonic clock
+
+#endif // HOST_ESP_TIMER_H
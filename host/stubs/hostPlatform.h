@@ -0,0 +1,10 @@
+#ifndef HOST_PLATFORM_H
+#define HOST_PLATFORM_H
+
+#include <Arduino.h>
+
+// Controls of the host build that have no counterpart on the device, used by the harnesses in host/
+
+void HostSetClock(time_t now); // Wall clock seen by time(), gettimeofday() and localtime
+
+#endif // HOST_PLATFORM_H
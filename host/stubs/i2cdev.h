@@ -0,0 +1,11 @@
+#ifndef HOST_I2CDEV_H
+#define HOST_I2CDEV_H
+
+#include <Arduino.h>
+
+// No I2C bus on the host, the room readings come from the harness (see host/soak.cpp)
+typedef int i2c_port_t;
+
+esp_err_t i2cdev_init();
+
+#endif // HOST_I2CDEV_H
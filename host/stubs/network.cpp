@@ -0,0 +1,27 @@
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include "web.h"
+
+WiFiClass WiFi;
+
+String IPAddress::toString() const
+{
+    char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+    return text;
+}
+
+// Never reached, GET() fails before a response could be read
+Stream &HTTPClient::getStream()
+{
+    return Serial;
+}
+
+// No web server on the host (web.cpp is not built)
+void setupWEB()
+{
+}
+
+void setupDebugWEB()
+{
+}
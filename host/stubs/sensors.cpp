@@ -0,0 +1,77 @@
+#include "i2cdev.h"
+#include "sht4x.h"
+#include "bmp280.h"
+
+// No sensors answer on the host, the sensor tasks are never started there
+
+esp_err_t i2cdev_init()
+{
+    return ESP_OK;
+}
+
+esp_err_t sht4x_init_desc(sht4x_t *dev, i2c_port_t port, gpio_num_t sda_gpio, gpio_num_t scl_gpio)
+{
+    (void)dev, (void)port, (void)sda_gpio, (void)scl_gpio;
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t sht4x_init(sht4x_t *dev)
+{
+    (void)dev;
+    return ESP_ERR_NOT_FOUND;
+}
+
+size_t sht4x_get_measurement_duration(sht4x_t *dev)
+{
+    (void)dev;
+    return 1;
+}
+
+esp_err_t sht4x_start_measurement(sht4x_t *dev)
+{
+    (void)dev;
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t sht4x_get_results(sht4x_t *dev, float *temperature, float *humidity)
+{
+    (void)dev, (void)temperature, (void)humidity;
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t bmp280_init_default_params(bmp280_params_t *params)
+{
+    params->mode = 0;
+    return ESP_OK;
+}
+
+esp_err_t bmp280_init_desc(bmp280_t *dev, uint8_t addr, i2c_port_t port, gpio_num_t sda_gpio, gpio_num_t scl_gpio)
+{
+    (void)dev, (void)addr, (void)port, (void)sda_gpio, (void)scl_gpio;
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t bmp280_init(bmp280_t *dev, bmp280_params_t *params)
+{
+    (void)dev, (void)params;
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t bmp280_force_measurement(bmp280_t *dev)
+{
+    (void)dev;
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t bmp280_is_measuring(bmp280_t *dev, bool *busy)
+{
+    (void)dev;
+    *busy = false;
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t bmp280_read_float(bmp280_t *dev, float *temperature, float *pressure, float *humidity)
+{
+    (void)dev, (void)temperature, (void)pressure, (void)humidity;
+    return ESP_ERR_NOT_FOUND;
+}
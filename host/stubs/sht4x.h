@@ -0,0 +1,17 @@
+#ifndef HOST_SHT4X_H
+#define HOST_SHT4X_H
+
+#include "i2cdev.h"
+
+typedef struct
+{
+    i2c_port_t port;
+} sht4x_t;
+
+esp_err_t sht4x_init_desc(sht4x_t *dev, i2c_port_t port, gpio_num_t sda_gpio, gpio_num_t scl_gpio);
+esp_err_t sht4x_init(sht4x_t *dev);
+size_t sht4x_get_measurement_duration(sht4x_t *dev);
+esp_err_t sht4x_start_measurement(sht4x_t *dev);
+esp_err_t sht4x_get_results(sht4x_t *dev, float *temperature, float *humidity);
+
+#endif // HOST_SHT4X_H
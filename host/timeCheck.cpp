@@ -0,0 +1,39 @@
+// Host check of the cached local time formatting (timeFormat.cpp) against the C library in several zones:
+// whole and half hour offsets, northern and southern DST rules and none, over 400 days around the fixture time.
+// Fails on any mismatch.
+//
+// Usage: timeCheck
+
+#include <Arduino.h>
+#include "hostPlatform.h"
+#include "timeFormat.h"
+#include "soakTest.h"
+
+static const struct
+{
+    const char *name;
+    const char *tz;
+} zones[] = {
+    {"CET", "CET-1CEST,M3.5.0,M10.5.0/3"},
+    {"EST", "EST5EDT,M3.2.0,M11.1.0"},
+    {"AEST", "AEST-10AEDT,M10.1.0,M4.1.0/3"},
+    {"IST", "IST-5:30"},
+    {"NZST", "NZST-12NZDT,M9.5.0,M4.1.0/3"},
+};
+
+int main()
+{
+    HostSetClock(SOAK_START_TIME);
+    int failures = 0;
+    for (const auto &zone : zones)
+    {
+        setenv("TZ", zone.tz, 1); // The C library is the reference
+        tzset();
+        TimeZoneSet(zone.tz);
+        int checked = 0;
+        const int mismatches = CheckTimeFormat(SOAK_START_TIME, &checked);
+        printf("%-5s %d times checked, %d mismatches\n", zone.name, checked, mismatches);
+        failures += mismatches != 0;
+    }
+    return failures ? 1 : 0;
+}
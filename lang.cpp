@@ -1,69 +1,142 @@
 #include "lang.h"
+#if LANG_BENCHMARK
+#include "esp_timer.h"         // In-built
+#endif
 
-//Temperature - Humidity - Forecast
-const String TXT_FORECAST_VALUES  = "Prognoza na 3 dni";
-const String TXT_CONDITIONS       = "Warunki";
-const String TXT_DAYS             = "(Dni)";
-const String TXT_TEMPERATURES     = "Temperatura";
-const String TXT_TEMPERATURE_C    = "Temperatura (°C)";
-const String TXT_TEMPERATURE_F    = "Temperatura (°F)";
-const String TXT_HUMIDITY_PERCENT = "Wilgotnosc (%)";
+// Language tables: constexpr arrays of pointers to literals, placed in flash with no constructor or heap copy.
+// Each row follows the StringId order, the static_asserts catch a missing or extra entry.
 
-// Pressure
-const String TXT_PRESSURE         = "Cisnienie";
-const String TXT_PRESSURE_HPA     = "Cisnienie (hPa)";
-const String TXT_PRESSURE_IN      = "Cisnienie (in)";
-const String TXT_PRESSURE_STEADY  = "Stabilne";
-const String TXT_PRESSURE_RISING  = "Rosnie";
-const String TXT_PRESSURE_FALLING = "Spada";
+static constexpr const char *polish[] = {
+    //Temperature - Humidity - Forecast
+    "Prognoza na 3 dni", "Warunki", "(Dni)", "Temperatura", "Temperatura (°C)", "Temperatura (°F)", "Wilgotnosc (%)",
+    // Pressure
+    "Cisnienie", "Cisnienie (hPa)", "Cisnienie (in)", "Stabilne", "Rosnie", "Spada",
+    //RainFall / SnowFall
+    "Opady deszczu (mm)", "Opady deszczu (in)", "Opady sniegu (mm)", "Opady sniegu (in)", "Opady wkrotce",
+    //Sun
+    "Wschod", "Zachod",
+    //Moon
+    "Nowiu", "Wzrastajacy sierp", "Pierwsza kwadra", "Wzrastajacy garb", "Pelnia", "Malejacy garb", "Trzecia kwadra", "Malejacy sierp",
+    //Power / WiFi
+    "Zasilanie", "Wi-Fi", "Zaktualizowano:",
+    //Wind
+    "Predkość wiatru / Kierunek",
+    "N", "NNE", "NE", "ENE", "E", "ESE", "SE", "SSE", "S", "SSW", "SW", "WSW", "W", "WNW", "NW", "NNW",
+    //Header and sensors
+    "Aktualizacja", "Czujnik ZEWN.", "Czujnik DOM", "Czujnik dom"};
+static constexpr const char *polishWeekdays[] = {"Nd", "Pon", "Wt", "Sr", "Czw", "Pt", "Sob"};
+static constexpr const char *polishMonths[] = {"Sty", "Lut", "Mar", "Kwi", "Maj", "Cze", "Lip", "Sie", "Wrz", "Paz", "Lis", "Gru"};
 
-//RainFall / SnowFall
-const String TXT_RAINFALL_MM = "Opady deszczu (mm)";
-const String TXT_RAINFALL_IN = "Opady deszczu (in)";
-const String TXT_SNOWFALL_MM = "Opady sniegu (mm)";
-const String TXT_SNOWFALL_IN = "Opady sniegu (in)";
-const String TXT_PRECIPITATION_SOON = "Opady wkrotce";
+static constexpr const char *english[] = {
+    //Temperature - Humidity - Forecast
+    "3-Day Forecast", "Conditions", "(Days)", "Temperature", "Temperature (°C)", "Temperature (°F)", "Humidity (%)",
+    // Pressure
+    "Pressure", "Pressure (hPa)", "Pressure (in)", "Steady", "Rising", "Falling",
+    //RainFall / SnowFall
+    "Rainfall (mm)", "Rainfall (in)", "Snowfall (mm)", "Snowfall (in)", "Precip. soon",
+    //Sun
+    "Sunrise", "Sunset",
+    //Moon
+    "New", "Waxing Crescent", "First Quarter", "Waxing Gibbous", "Full", "Waning Gibbous", "Third Quarter", "Waning Crescent",
+    //Power / WiFi
+    "Power", "Wi-Fi", "Updated:",
+    //Wind
+    "Wind Speed / Direction",
+    "N", "NNE", "NE", "ENE", "E", "ESE", "SE", "SSE", "S", "SSW", "SW", "WSW", "W", "WNW", "NW", "NNW",
+    //Header and sensors
+    "Updated", "OUTDOOR", "INDOOR", "Indoor"};
+static constexpr const char *englishWeekdays[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+static constexpr const char *englishMonths[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
 
-//Sun
-const String TXT_SUNRISE  = "Wschod";
-const String TXT_SUNSET   = "Zachod";
+static constexpr const char *german[] = {
+    //Temperature - Humidity - Forecast
+    "3-Tage-Vorhersage", "Bedingungen", "(Tage)", "Temperatur", "Temperatur (°C)", "Temperatur (°F)", "Luftfeuchte (%)",
+    // Pressure
+    "Luftdruck", "Luftdruck (hPa)", "Luftdruck (in)", "Stabil", "Steigend", "Fallend",
+    //RainFall / SnowFall
+    "Regen (mm)", "Regen (in)", "Schnee (mm)", "Schnee (in)", "Bald Niederschlag",
+    //Sun
+    "Aufgang", "Untergang",
+    //Moon
+    "Neumond", "Zunehmende Sichel", "Erstes Viertel", "Zunehmender Mond", "Vollmond", "Abnehmender Mond", "Letztes Viertel", "Abnehmende Sichel",
+    //Power / WiFi
+    "Energie", "WLAN", "Aktualisiert:",
+    //Wind
+    "Windgeschw. / Richtung",
+    "N", "NNO", "NO", "ONO", "O", "OSO", "SO", "SSO", "S", "SSW", "SW", "WSW", "W", "WNW", "NW", "NNW",
+    //Header and sensors
+    "Aktualisiert", "AUSSEN", "INNEN", "Innen"};
+static constexpr const char *germanWeekdays[] = {"So", "Mo", "Di", "Mi", "Do", "Fr", "Sa"};
+static constexpr const char *germanMonths[] = {"Jan", "Feb", "Mär", "Apr", "Mai", "Jun", "Jul", "Aug", "Sep", "Okt", "Nov", "Dez"};
 
-//Moon
-const String TXT_MOON_NEW             = "Nowiu";
-const String TXT_MOON_WAXING_CRESCENT = "Wzrastajacy sierp";
-const String TXT_MOON_FIRST_QUARTER   = "Pierwsza kwadra";
-const String TXT_MOON_WAXING_GIBBOUS  = "Wzrastajacy garb";
-const String TXT_MOON_FULL            = "Pelnia";
-const String TXT_MOON_WANING_GIBBOUS  = "Malejacy garb";
-const String TXT_MOON_THIRD_QUARTER   = "Trzecia kwadra";
-const String TXT_MOON_WANING_CRESCENT = "Malejacy sierp";
+static_assert(sizeof(polish) / sizeof(polish[0]) == TXT_COUNT, "Polish table does not match StringId");
+static_assert(sizeof(english) / sizeof(english[0]) == TXT_COUNT, "English table does not match StringId");
+static_assert(sizeof(german) / sizeof(german[0]) == TXT_COUNT, "German table does not match StringId");
 
-//Power / WiFi
-const String TXT_POWER  = "Zasilanie";
-const String TXT_WIFI   = "Wi-Fi";
-const char* TXT_UPDATED = "Zaktualizowano:";
+typedef struct
+{
+    const char *code; // As in config.json "Language", also sent to OWM for the weather descriptions
+    const char *const *strings;
+    const char *const *weekdays;
+    const char *const *months;
+} LanguageTable;
 
-//Wind
-const String TXT_WIND_SPEED_DIRECTION = "Predkość wiatru / Kierunek";
-const String TXT_N   = "N";
-const String TXT_NNE = "NNE";
-const String TXT_NE  = "NE";
-const String TXT_ENE = "ENE";
-const String TXT_E   = "E";
-const String TXT_ESE = "ESE";
-const String TXT_SE  = "SE";
-const String TXT_SSE = "SSE";
-const String TXT_S   = "S";
-const String TXT_SSW = "SSW";
-const String TXT_SW  = "SW";
-const String TXT_WSW = "WSW";
-const String TXT_W   = "W";
-const String TXT_WNW = "WNW";
-const String TXT_NW  = "NW";
-const String TXT_NNW = "NNW";
+static constexpr LanguageTable languages[] = {
+    {"PL", polish, polishWeekdays, polishMonths},
+    {"EN", english, englishWeekdays, englishMonths},
+    {"DE", german, germanWeekdays, germanMonths},
+};
 
-//Day of the week
-const char* weekday_D[] = { "Nd", "Pon", "Wt", "Sr", "Czw", "Pt", "Sob" };
+static const LanguageTable *language = &languages[0]; // Polish until the configuration says otherwise
+const char *const *languageStrings = polish;
 
-//Month
-const char* month_M[] = { "Sty", "Lut", "Mar", "Kwi", "Maj", "Cze", "Lip", "Sie", "Wrz", "Paz", "Lis", "Gru" };
\ No newline at end of file
+const char *WeekdayName(int day)
+{
+    return language->weekdays[day % 7];
+}
+
+const char *MonthName(int month)
+{
+    return language->months[month % 12];
+}
+
+// Selects the tables by language code, case-insensitive. Unknown codes keep the current language.
+bool SetLanguage(const char *code)
+{
+    for (const LanguageTable &table : languages)
+    {
+        if (strcasecmp(table.code, code) == 0)
+        {
+            language = &table;
+            languageStrings = table.strings;
+            ESP_LOGI("LANG", "Display language %s", table.code);
+            return true;
+        }
+    }
+    ESP_LOGW("LANG", "No tables for language '%s', keeping %s", code, language->code);
+    return false;
+}
+
+const char *LanguageCode()
+{
+    return language->code;
+}
+
+#if LANG_BENCHMARK
+// Builds the selected table as String objects, the way the former const String TXT_* globals were constructed
+// before setup(), and logs the time and heap that cost. The tables themselves need neither.
+void BenchmarkLanguageTables()
+{
+    const uint32_t heapBefore = ESP.getFreeHeap();
+    const int64_t start = esp_timer_get_time();
+    {
+        String copies[TXT_COUNT]; // The objects themselves lived in .bss, only their buffers came from the heap
+        for (int i = 0; i < TXT_COUNT; i++)
+            copies[i] = languageStrings[i];
+        const int64_t elapsed = esp_timer_get_time() - start;
+        const uint32_t heapUsed = heapBefore - ESP.getFreeHeap();
+        ESP_LOGI("LANG", "%d String globals: %lld us to construct, %u heap bytes; tables: %u bytes of flash pointers per language",
+                 TXT_COUNT, elapsed, (unsigned)heapUsed, (unsigned)sizeof(polish));
+    }
+}
+#endif
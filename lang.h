@@ -1,77 +1,102 @@
-#ifndef LANG_H
-#define LANG_H
-
-#include <Arduino.h>
-#include <lang.h>
-
-#define FONT(x) x##_tf
-
-//Temperature - Humidity - Forecast
-extern const String TXT_FORECAST_VALUES;
-extern const String TXT_CONDITIONS;
-extern const String TXT_DAYS;
-extern const String TXT_TEMPERATURES;
-extern const String TXT_TEMPERATURE_C;
-extern const String TXT_TEMPERATURE_F;
-extern const String TXT_HUMIDITY_PERCENT;
-
-// Pressure
-extern const String TXT_PRESSURE;
-extern const String TXT_PRESSURE_HPA;
-extern const String TXT_PRESSURE_IN;
-extern const String TXT_PRESSURE_STEADY;
-extern const String TXT_PRESSURE_RISING;
-extern const String TXT_PRESSURE_FALLING;
-
-//RainFall / SnowFall
-extern const String TXT_RAINFALL_MM;
-extern const String TXT_RAINFALL_IN;
-extern const String TXT_SNOWFALL_MM;
-extern const String TXT_SNOWFALL_IN;
-extern const String TXT_PRECIPITATION_SOON;
-
-//Sun
-extern const String TXT_SUNRISE;
-extern const String TXT_SUNSET;
-
-//Moon
-extern const String TXT_MOON_NEW;
-extern const String TXT_MOON_WAXING_CRESCENT;
-extern const String TXT_MOON_FIRST_QUARTER;
-extern const String TXT_MOON_WAXING_GIBBOUS;
-extern const String TXT_MOON_FULL;
-extern const String TXT_MOON_WANING_GIBBOUS;
-extern const String TXT_MOON_THIRD_QUARTER;
-extern const String TXT_MOON_WANING_CRESCENT;
-
-//Power / WiFi
-extern const String TXT_POWER;
-extern const String TXT_WIFI;
-extern const char* TXT_UPDATED;
-
-//Wind
-extern const String TXT_WIND_SPEED_DIRECTION;
-extern const String TXT_N;
-extern const String TXT_NNE;
-extern const String TXT_NE;
-extern const String TXT_ENE;
-extern const String TXT_E;
-extern const String TXT_ESE;
-extern const String TXT_SE;
-extern const String TXT_SSE;
-extern const String TXT_S;
-extern const String TXT_SSW;
-extern const String TXT_SW;
-extern const String TXT_WSW;
-extern const String TXT_W;
-extern const String TXT_WNW;
-extern const String TXT_NW;
-extern const String TXT_NNW;
-
-//Day of the week
-extern const char* weekday_D[];
-
-//Month
-extern const char* month_M[];
-
-#endif // LANG_H
\ No newline at end of file
+#ifndef LANG_H
+#define LANG_H
+
+#include <Arduino.h>
+
+#define FONT(x) x##_tf
+
+#ifndef LANG_BENCHMARK
+#define LANG_BENCHMARK 0 // 1 = log what the former String globals cost at boot: constructor time and heap
+#endif
+
+// Every translated UI string, one column of each language table in lang.cpp
+enum StringId
+{
+    //Temperature - Humidity - Forecast
+    TXT_FORECAST_VALUES,
+    TXT_CONDITIONS,
+    TXT_DAYS,
+    TXT_TEMPERATURES,
+    TXT_TEMPERATURE_C,
+    TXT_TEMPERATURE_F,
+    TXT_HUMIDITY_PERCENT,
+
+    // Pressure
+    TXT_PRESSURE,
+    TXT_PRESSURE_HPA,
+    TXT_PRESSURE_IN,
+    TXT_PRESSURE_STEADY,
+    TXT_PRESSURE_RISING,
+    TXT_PRESSURE_FALLING,
+
+    //RainFall / SnowFall
+    TXT_RAINFALL_MM,
+    TXT_RAINFALL_IN,
+    TXT_SNOWFALL_MM,
+    TXT_SNOWFALL_IN,
+    TXT_PRECIPITATION_SOON,
+
+    //Sun
+    TXT_SUNRISE,
+    TXT_SUNSET,
+
+    //Moon
+    TXT_MOON_NEW,
+    TXT_MOON_WAXING_CRESCENT,
+    TXT_MOON_FIRST_QUARTER,
+    TXT_MOON_WAXING_GIBBOUS,
+    TXT_MOON_FULL,
+    TXT_MOON_WANING_GIBBOUS,
+    TXT_MOON_THIRD_QUARTER,
+    TXT_MOON_WANING_CRESCENT,
+
+    //Power / WiFi
+    TXT_POWER,
+    TXT_WIFI,
+    TXT_UPDATED,
+
+    //Wind
+    TXT_WIND_SPEED_DIRECTION,
+    TXT_N,
+    TXT_NNE,
+    TXT_NE,
+    TXT_ENE,
+    TXT_E,
+    TXT_ESE,
+    TXT_SE,
+    TXT_SSE,
+    TXT_S,
+    TXT_SSW,
+    TXT_SW,
+    TXT_WSW,
+    TXT_W,
+    TXT_WNW,
+    TXT_NW,
+    TXT_NNW,
+
+    //Header and sensors
+    TXT_LAST_UPDATE,
+    TXT_SENSOR_OUTDOOR,
+    TXT_SENSOR_ROOM,
+    TXT_SENSOR_ROOM_NO_DATA,
+
+    TXT_COUNT
+};
+
+extern const char *const *languageStrings; // Table of the selected language, see SetLanguage()
+
+// Flash-resident text of the selected language
+inline const char *Txt(StringId id)
+{
+    return languageStrings[id];
+}
+
+const char *WeekdayName(int day); // 0 = Sunday, like tm_wday
+const char *MonthName(int month); // 0 = January, like tm_mon
+bool SetLanguage(const char *code);
+const char *LanguageCode();
+#if LANG_BENCHMARK
+void BenchmarkLanguageTables();
+#endif
+
+#endif // LANG_H
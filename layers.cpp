@@ -0,0 +1,110 @@
+#include "layers.h"
+#include "rasteriser.h"
+#include <esp_heap_caps.h>     // In-built
+
+#define FRAMEBUFFER_SIZE (EPD_WIDTH * EPD_HEIGHT / 2)
+
+static uint8_t *backgroundCache = NULL; // PSRAM copy of the static content of the last rendered layout
+static uint32_t backgroundKey = 0;      // 0 means the cache holds nothing valid
+
+// FNV-1a over everything that changes the static content: layout version, screen and language
+static uint32_t LayerKey(int screen, const String &language)
+{
+    uint32_t hash = 2166136261u;
+    const uint32_t words[] = {LAYOUT_VERSION, (uint32_t)screen};
+    for (uint32_t word : words)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            hash ^= (word >> (i * 8)) & 0xFF;
+            hash *= 16777619u;
+        }
+    }
+    for (const char *c = language.c_str(); *c; c++)
+    {
+        hash ^= (uint8_t)*c;
+        hash *= 16777619u;
+    }
+    return hash | 1;
+}
+
+void InvalidateBackgroundLayer()
+{
+    backgroundKey = 0;
+}
+
+// Starts a frame in buffer (the current raster target): copies the cached background into it, or clears it,
+// draws the static content once and caches it when the screen, layout or language differ from the cached one.
+// Screens without static content only clear the buffer and leave the cache alone, so pre-rendering one of them
+// between two frames of a screen with a background does not evict its layer.
+void BeginFrame(uint8_t *buffer, int screen, const String &language, void (*drawBackground)())
+{
+    if (drawBackground == NULL)
+    {
+        memset(buffer, 0xFF, FRAMEBUFFER_SIZE);
+        return;
+    }
+    const uint32_t key = LayerKey(screen, language);
+    if (backgroundCache == NULL)
+    {
+        backgroundCache = (uint8_t *)ps_malloc(FRAMEBUFFER_SIZE);
+        if (!backgroundCache)
+            ESP_LOGW("LAYERS", "Background cache alloc failed, drawing static content every frame");
+    }
+    if (backgroundCache && key == backgroundKey)
+    {
+        memcpy(buffer, backgroundCache, FRAMEBUFFER_SIZE);
+        return;
+    }
+    memset(buffer, 0xFF, FRAMEBUFFER_SIZE);
+    drawBackground();
+    if (backgroundCache)
+    {
+        memcpy(backgroundCache, buffer, FRAMEBUFFER_SIZE);
+        backgroundKey = key;
+        ESP_LOGI("LAYERS", "Background layer rebuilt for screen %d", screen);
+    }
+}
+
+// Draws the screen once per horizontal band into a small internal RAM buffer and pushes each finished band
+// to the panel, so no full framebuffer is needed. Screen functions must not have side effects, they run
+// once per band. Returns the render time in us.
+unsigned long RenderStrips(void (*drawBackground)(), void (*drawScreen)(), int bandHeight, bool push)
+{
+    const size_t bandSize = (EPD_WIDTH / 2) * bandHeight;
+    uint8_t *band = (uint8_t *)heap_caps_malloc(bandSize, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!band)
+    {
+        ESP_LOGE("LAYERS", "Band buffer alloc failed (%u bytes)", bandSize);
+        return 0;
+    }
+    unsigned long start = micros();
+    for (int y = 0; y < EPD_HEIGHT; y += bandHeight)
+    {
+        const int rows = min(bandHeight, EPD_HEIGHT - y);
+        memset(band, 0xFF, (EPD_WIDTH / 2) * rows);
+        rasterSetTarget(band, y, rows);
+        if (drawBackground)
+            drawBackground();
+        drawScreen();
+        if (push)
+        {
+            Rect_t area = {0, y, EPD_WIDTH, rows};
+            epd_draw_grayscale_image(area, band);
+        }
+    }
+    rasterResetTarget();
+    heap_caps_free(band);
+    return micros() - start;
+}
+
+// Logs render time (without panel pushes) against band height
+void BenchmarkStripHeights(void (*drawBackground)(), void (*drawScreen)())
+{
+    const int heights[] = {18, 27, 36, 54, 90, 135};
+    for (int h : heights)
+    {
+        unsigned long us = RenderStrips(drawBackground, drawScreen, h, false);
+        ESP_LOGI("LAYERS", "Band height %3d: %2d bands, %6u bytes, render %lu us", h, (EPD_HEIGHT + h - 1) / h, (EPD_WIDTH / 2) * h, us);
+    }
+}
@@ -0,0 +1,28 @@
+#ifndef LAYERS_H
+#define LAYERS_H
+
+#include <Arduino.h>           // In-built
+#include "epd_driver.h"        // https://github.com/Xinyuan-LilyGO/LilyGo-EPD47
+
+// Bump when coordinates of any static (background) content change, so a cached layer is never reused
+#define LAYOUT_VERSION 1
+
+// Strip rendering: used when there is no PSRAM framebuffer, or forced with -DSTRIP_RENDERING=1
+#ifndef STRIP_RENDERING
+#define STRIP_RENDERING 0
+#endif
+#ifndef STRIP_HEIGHT
+#define STRIP_HEIGHT 36 // Rows per band, 36 rows = 17280 bytes of internal RAM, 15 bands per screen
+#endif
+#ifndef STRIP_BENCHMARK
+#define STRIP_BENCHMARK 0 // 1 = log render time for several band heights before each strip render
+#endif
+
+extern uint8_t *framebuffer;
+
+void BeginFrame(uint8_t *buffer, int screen, const String &language, void (*drawBackground)());
+void InvalidateBackgroundLayer();
+unsigned long RenderStrips(void (*drawBackground)(), void (*drawScreen)(), int bandHeight, bool push);
+void BenchmarkStripHeights(void (*drawBackground)(), void (*drawScreen)());
+
+#endif // LAYERS_H
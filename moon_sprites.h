@@ -0,0 +1,299 @@
+#pragma once
+// Generated by tools/moon_sprites.py, do not edit
+#include <stdint.h>
+
+#define MOON_SPRITE_PHASES 32
+#define MOON_SPRITE_ROW0   37 // First row, relative to the DrawMoon() y position
+#define MOON_SPRITE_ROWS   76
+
+// Lit span {x0, x1} per row, relative to the DrawMoon() x position, {0xFF, 0x00} when the row is dark
+const uint8_t MoonSpriteSpans[MOON_SPRITE_PHASES][MOON_SPRITE_ROWS][2] = {
+    { // Phase 0/32
+        {75, 75}, {67, 82}, {63, 86}, {59, 90}, {57, 92}, {56, 93}, {54, 95}, {53, 96}, {51, 98}, {50, 99}, {49, 100}, {48, 101},
+        {47, 102}, {46, 103}, {45, 104}, {45, 105}, {44, 105}, {43, 106}, {42, 107}, {42, 107}, {41, 108}, {41, 108}, {41, 108}, {40, 109},
+        {39, 110}, {39, 110}, {39, 110}, {39, 110}, {38, 111}, {38, 111}, {38, 111}, {38, 111}, {37, 112}, {37, 112}, {37, 112}, {37, 112},
+        {37, 112}, {37, 112}, {37, 112}, {37, 112}, {37, 112}, {37, 112}, {37, 112}, {37, 112}, {38, 111}, {38, 111}, {38, 111}, {38, 111},
+        {38, 111}, {39, 110}, {39, 110}, {39, 110}, {40, 109}, {40, 109}, {41, 108}, {41, 108}, {42, 107}, {42, 107}, {43, 106}, {44, 105},
+        {45, 105}, {45, 104}, {46, 103}, {47, 102}, {48, 101}, {49, 100}, {50, 99}, {51, 98}, {52, 97}, {54, 95}, {56, 93}, {57, 92},
+        {59, 90}, {63, 86}, {67, 82}, {75, 75},
+    },
+    { // Phase 1/32
+        {75, 75}, {67, 81}, {63, 84}, {59, 88}, {57, 90}, {56, 91}, {54, 92}, {53, 93}, {51, 95}, {50, 96}, {49, 97}, {48, 98},
+        {47, 98}, {46, 100}, {45, 100}, {45, 101}, {44, 101}, {43, 102}, {42, 103}, {42, 103}, {41, 104}, {41, 104}, {41, 104}, {40, 105},
+        {39, 105}, {39, 105}, {39, 106}, {39, 106}, {38, 106}, {38, 106}, {38, 107}, {38, 107}, {37, 107}, {37, 107}, {37, 107}, {37, 107},
+        {37, 107}, {37, 107}, {37, 107}, {37, 107}, {37, 107}, {37, 107}, {37, 107}, {37, 107}, {38, 107}, {38, 107}, {38, 106}, {38, 106},
+        {38, 106}, {39, 106}, {39, 105}, {39, 105}, {40, 105}, {40, 105}, {41, 104}, {41, 104}, {42, 103}, {42, 103}, {43, 102}, {44, 101},
+        {45, 101}, {45, 100}, {46, 100}, {47, 99}, {48, 98}, {49, 97}, {50, 96}, {51, 95}, {52, 94}, {54, 92}, {56, 91}, {57, 90},
+        {59, 88}, {63, 84}, {67, 81}, {75, 75},
+    },
+    { // Phase 2/32
+        {75, 75}, {67, 80}, {63, 83}, {59, 86}, {57, 87}, {56, 89}, {54, 90}, {53, 91}, {51, 92}, {50, 93}, {49, 94}, {48, 94},
+        {47, 95}, {46, 96}, {45, 97}, {45, 97}, {44, 97}, {43, 98}, {42, 99}, {42, 99}, {41, 99}, {41, 100}, {41, 100}, {40, 101},
+        {39, 101}, {39, 101}, {39, 101}, {39, 101}, {38, 102}, {38, 102}, {38, 102}, {38, 102}, {37, 102}, {37, 102}, {37, 103}, {37, 103},
+        {37, 103}, {37, 103}, {37, 103}, {37, 103}, {37, 103}, {37, 103}, {37, 102}, {37, 102}, {38, 102}, {38, 102}, {38, 102}, {38, 102},
+        {38, 102}, {39, 101}, {39, 101}, {39, 101}, {40, 101}, {40, 100}, {41, 100}, {41, 99}, {42, 99}, {42, 99}, {43, 98}, {44, 97},
+        {45, 97}, {45, 97}, {46, 96}, {47, 95}, {48, 94}, {49, 94}, {50, 93}, {51, 92}, {52, 91}, {54, 90}, {56, 89}, {57, 87},
+        {59, 86}, {63, 83}, {67, 80}, {75, 75},
+    },
+    { // Phase 3/32
+        {75, 75}, {67, 79}, {63, 81}, {59, 84}, {57, 85}, {56, 86}, {54, 87}, {53, 88}, {51, 89}, {50, 90}, {49, 90}, {48, 91},
+        {47, 91}, {46, 92}, {45, 93}, {45, 93}, {44, 94}, {43, 94}, {42, 95}, {42, 95}, {41, 95}, {41, 95}, {41, 96}, {40, 96},
+        {39, 96}, {39, 97}, {39, 97}, {39, 97}, {38, 97}, {38, 97}, {38, 97}, {38, 98}, {37, 98}, {37, 98}, {37, 98}, {37, 98},
+        {37, 98}, {37, 98}, {37, 98}, {37, 98}, {37, 98}, {37, 98}, {37, 98}, {37, 98}, {38, 98}, {38, 97}, {38, 97}, {38, 97},
+        {38, 97}, {39, 97}, {39, 97}, {39, 96}, {40, 96}, {40, 96}, {41, 95}, {41, 95}, {42, 95}, {42, 95}, {43, 94}, {44, 94},
+        {45, 93}, {45, 93}, {46, 92}, {47, 92}, {48, 91}, {49, 90}, {50, 90}, {51, 89}, {52, 89}, {54, 87}, {56, 86}, {57, 85},
+        {59, 84}, {63, 81}, {67, 79}, {75, 75},
+    },
+    { // Phase 4/32
+        {75, 75}, {67, 78}, {63, 80}, {59, 82}, {57, 83}, {56, 84}, {54, 85}, {53, 85}, {51, 86}, {50, 87}, {49, 87}, {48, 88},
+        {47, 88}, {46, 89}, {45, 89}, {45, 90}, {44, 90}, {43, 90}, {42, 91}, {42, 91}, {41, 91}, {41, 91}, {41, 91}, {40, 92},
+        {39, 92}, {39, 92}, {39, 92}, {39, 92}, {38, 93}, {38, 93}, {38, 93}, {38, 93}, {37, 93}, {37, 93}, {37, 93}, {37, 93},
+        {37, 93}, {37, 93}, {37, 93}, {37, 93}, {37, 93}, {37, 93}, {37, 93}, {37, 93}, {38, 93}, {38, 93}, {38, 93}, {38, 93},
+        {38, 93}, {39, 92}, {39, 92}, {39, 92}, {40, 92}, {40, 92}, {41, 91}, {41, 91}, {42, 91}, {42, 91}, {43, 90}, {44, 90},
+        {45, 90}, {45, 89}, {46, 89}, {47, 88}, {48, 88}, {49, 87}, {50, 87}, {51, 86}, {52, 86}, {54, 85}, {56, 84}, {57, 83},
+        {59, 82}, {63, 80}, {67, 78}, {75, 75},
+    },
+    { // Phase 5/32
+        {75, 75}, {67, 77}, {63, 79}, {59, 80}, {57, 81}, {56, 82}, {54, 82}, {53, 83}, {51, 83}, {50, 84}, {49, 84}, {48, 84},
+        {47, 85}, {46, 85}, {45, 86}, {45, 86}, {44, 86}, {43, 86}, {42, 87}, {42, 87}, {41, 87}, {41, 87}, {41, 87}, {40, 88},
+        {39, 88}, {39, 88}, {39, 88}, {39, 88}, {38, 88}, {38, 88}, {38, 88}, {38, 88}, {37, 88}, {37, 88}, {37, 89}, {37, 89},
+        {37, 89}, {37, 89}, {37, 89}, {37, 89}, {37, 89}, {37, 89}, {37, 88}, {37, 88}, {38, 88}, {38, 88}, {38, 88}, {38, 88},
+        {38, 88}, {39, 88}, {39, 88}, {39, 88}, {40, 88}, {40, 87}, {41, 87}, {41, 87}, {42, 87}, {42, 87}, {43, 86}, {44, 86},
+        {45, 86}, {45, 86}, {46, 85}, {47, 85}, {48, 84}, {49, 84}, {50, 84}, {51, 83}, {52, 83}, {54, 82}, {56, 82}, {57, 81},
+        {59, 80}, {63, 79}, {67, 77}, {75, 75},
+    },
+    { // Phase 6/32
+        {75, 75}, {67, 76}, {63, 77}, {59, 78}, {57, 79}, {56, 79}, {54, 80}, {53, 80}, {51, 80}, {50, 81}, {49, 81}, {48, 81},
+        {47, 81}, {46, 82}, {45, 82}, {45, 82}, {44, 82}, {43, 82}, {42, 83}, {42, 83}, {41, 83}, {41, 83}, {41, 83}, {40, 83},
+        {39, 83}, {39, 83}, {39, 83}, {39, 83}, {38, 84}, {38, 84}, {38, 84}, {38, 84}, {37, 84}, {37, 84}, {37, 84}, {37, 84},
+        {37, 84}, {37, 84}, {37, 84}, {37, 84}, {37, 84}, {37, 84}, {37, 84}, {37, 84}, {38, 84}, {38, 84}, {38, 84}, {38, 84},
+        {38, 84}, {39, 83}, {39, 83}, {39, 83}, {40, 83}, {40, 83}, {41, 83}, {41, 83}, {42, 83}, {42, 83}, {43, 82}, {44, 82},
+        {45, 82}, {45, 82}, {46, 82}, {47, 81}, {48, 81}, {49, 81}, {50, 81}, {51, 80}, {52, 80}, {54, 80}, {56, 79}, {57, 79},
+        {59, 78}, {63, 77}, {67, 76}, {75, 75},
+    },
+    { // Phase 7/32
+        {75, 75}, {67, 75}, {63, 76}, {59, 76}, {57, 77}, {56, 77}, {54, 77}, {53, 77}, {51, 77}, {50, 78}, {49, 78}, {48, 78},
+        {47, 78}, {46, 78}, {45, 78}, {45, 78}, {44, 78}, {43, 78}, {42, 79}, {42, 79}, {41, 79}, {41, 79}, {41, 79}, {40, 79},
+        {39, 79}, {39, 79}, {39, 79}, {39, 79}, {38, 79}, {38, 79}, {38, 79}, {38, 79}, {37, 79}, {37, 79}, {37, 79}, {37, 79},
+        {37, 79}, {37, 79}, {37, 79}, {37, 79}, {37, 79}, {37, 79}, {37, 79}, {37, 79}, {38, 79}, {38, 79}, {38, 79}, {38, 79},
+        {38, 79}, {39, 79}, {39, 79}, {39, 79}, {40, 79}, {40, 79}, {41, 79}, {41, 79}, {42, 79}, {42, 79}, {43, 78}, {44, 78},
+        {45, 78}, {45, 78}, {46, 78}, {47, 78}, {48, 78}, {49, 78}, {50, 78}, {51, 77}, {52, 77}, {54, 77}, {56, 77}, {57, 77},
+        {59, 76}, {63, 76}, {67, 75}, {75, 75},
+    },
+    { // Phase 8/32
+        {75, 75}, {67, 75}, {63, 75}, {59, 75}, {57, 75}, {56, 75}, {54, 75}, {53, 75}, {51, 75}, {50, 75}, {49, 75}, {48, 75},
+        {47, 75}, {46, 75}, {45, 75}, {45, 75}, {44, 75}, {43, 75}, {42, 75}, {42, 75}, {41, 75}, {41, 75}, {41, 75}, {40, 75},
+        {39, 75}, {39, 75}, {39, 75}, {39, 75}, {38, 75}, {38, 75}, {38, 75}, {38, 75}, {37, 75}, {37, 75}, {37, 75}, {37, 75},
+        {37, 75}, {37, 75}, {37, 75}, {37, 75}, {37, 75}, {37, 75}, {37, 75}, {37, 75}, {38, 75}, {38, 75}, {38, 75}, {38, 75},
+        {38, 75}, {39, 75}, {39, 75}, {39, 75}, {40, 75}, {40, 75}, {41, 75}, {41, 75}, {42, 75}, {42, 75}, {43, 75}, {44, 75},
+        {45, 75}, {45, 75}, {46, 75}, {47, 75}, {48, 75}, {49, 75}, {50, 75}, {51, 75}, {52, 75}, {54, 75}, {56, 75}, {57, 75},
+        {59, 75}, {63, 75}, {67, 75}, {75, 75},
+    },
+    { // Phase 9/32
+        {75, 75}, {67, 74}, {63, 73}, {59, 73}, {57, 72}, {56, 72}, {54, 72}, {53, 72}, {51, 72}, {50, 71}, {49, 71}, {48, 71},
+        {47, 71}, {46, 71}, {45, 71}, {45, 71}, {44, 71}, {43, 71}, {42, 70}, {42, 70}, {41, 70}, {41, 70}, {41, 70}, {40, 70},
+        {39, 70}, {39, 70}, {39, 70}, {39, 70}, {38, 70}, {38, 70}, {38, 70}, {38, 70}, {37, 70}, {37, 70}, {37, 70}, {37, 70},
+        {37, 70}, {37, 70}, {37, 70}, {37, 70}, {37, 70}, {37, 70}, {37, 70}, {37, 70}, {38, 70}, {38, 70}, {38, 70}, {38, 70},
+        {38, 70}, {39, 70}, {39, 70}, {39, 70}, {40, 70}, {40, 70}, {41, 70}, {41, 70}, {42, 70}, {42, 70}, {43, 71}, {44, 71},
+        {45, 71}, {45, 71}, {46, 71}, {47, 71}, {48, 71}, {49, 71}, {50, 71}, {51, 72}, {52, 72}, {54, 72}, {56, 72}, {57, 72},
+        {59, 73}, {63, 73}, {67, 74}, {75, 75},
+    },
+    { // Phase 10/32
+        {75, 75}, {67, 73}, {63, 72}, {59, 71}, {57, 70}, {56, 70}, {54, 69}, {53, 69}, {51, 69}, {50, 68}, {49, 68}, {48, 68},
+        {47, 68}, {46, 68}, {45, 67}, {45, 67}, {44, 67}, {43, 67}, {42, 66}, {42, 66}, {41, 66}, {41, 66}, {41, 66}, {40, 66},
+        {39, 66}, {39, 66}, {39, 66}, {39, 66}, {38, 65}, {38, 65}, {38, 65}, {38, 65}, {37, 65}, {37, 65}, {37, 65}, {37, 65},
+        {37, 65}, {37, 65}, {37, 65}, {37, 65}, {37, 65}, {37, 65}, {37, 65}, {37, 65}, {38, 65}, {38, 65}, {38, 65}, {38, 65},
+        {38, 66}, {39, 66}, {39, 66}, {39, 66}, {40, 66}, {40, 66}, {41, 66}, {41, 66}, {42, 66}, {42, 66}, {43, 67}, {44, 67},
+        {45, 67}, {45, 67}, {46, 67}, {47, 68}, {48, 68}, {49, 68}, {50, 68}, {51, 69}, {52, 69}, {54, 69}, {56, 70}, {57, 70},
+        {59, 71}, {63, 72}, {67, 73}, {75, 75},
+    },
+    { // Phase 11/32
+        {75, 75}, {67, 72}, {63, 70}, {59, 69}, {57, 68}, {56, 67}, {54, 67}, {53, 66}, {51, 66}, {50, 65}, {49, 65}, {48, 65},
+        {47, 64}, {46, 64}, {45, 63}, {45, 63}, {44, 63}, {43, 63}, {42, 62}, {42, 62}, {41, 62}, {41, 62}, {41, 62}, {40, 62},
+        {39, 61}, {39, 61}, {39, 61}, {39, 61}, {38, 61}, {38, 61}, {38, 61}, {38, 61}, {37, 61}, {37, 61}, {37, 60}, {37, 60},
+        {37, 60}, {37, 60}, {37, 60}, {37, 60}, {37, 60}, {37, 60}, {37, 61}, {37, 61}, {38, 61}, {38, 61}, {38, 61}, {38, 61},
+        {38, 61}, {39, 61}, {39, 61}, {39, 61}, {40, 61}, {40, 62}, {41, 62}, {41, 62}, {42, 62}, {42, 62}, {43, 63}, {44, 63},
+        {45, 63}, {45, 63}, {46, 64}, {47, 64}, {48, 65}, {49, 65}, {50, 65}, {51, 66}, {52, 66}, {54, 67}, {56, 67}, {57, 68},
+        {59, 69}, {63, 70}, {67, 72}, {75, 75},
+    },
+    { // Phase 12/32
+        {75, 75}, {67, 71}, {63, 69}, {59, 68}, {57, 66}, {56, 65}, {54, 64}, {53, 64}, {51, 63}, {50, 62}, {49, 62}, {48, 61},
+        {47, 61}, {46, 61}, {45, 60}, {45, 60}, {44, 59}, {43, 59}, {42, 58}, {42, 58}, {41, 58}, {41, 58}, {41, 58}, {40, 57},
+        {39, 57}, {39, 57}, {39, 57}, {39, 57}, {38, 56}, {38, 56}, {38, 56}, {38, 56}, {37, 56}, {37, 56}, {37, 56}, {37, 56},
+        {37, 56}, {37, 56}, {37, 56}, {37, 56}, {37, 56}, {37, 56}, {37, 56}, {37, 56}, {38, 56}, {38, 56}, {38, 56}, {38, 56},
+        {38, 57}, {39, 57}, {39, 57}, {39, 57}, {40, 57}, {40, 58}, {41, 58}, {41, 58}, {42, 58}, {42, 58}, {43, 59}, {44, 59},
+        {45, 60}, {45, 60}, {46, 60}, {47, 61}, {48, 61}, {49, 62}, {50, 62}, {51, 63}, {52, 64}, {54, 64}, {56, 65}, {57, 66},
+        {59, 68}, {63, 69}, {67, 71}, {75, 75},
+    },
+    { // Phase 13/32
+        {75, 75}, {67, 70}, {63, 68}, {59, 66}, {57, 64}, {56, 63}, {54, 62}, {53, 61}, {51, 60}, {50, 59}, {49, 59}, {48, 58},
+        {47, 58}, {46, 57}, {45, 56}, {45, 56}, {44, 55}, {43, 55}, {42, 54}, {42, 54}, {41, 54}, {41, 54}, {41, 53}, {40, 53},
+        {39, 53}, {39, 52}, {39, 52}, {39, 52}, {38, 52}, {38, 52}, {38, 52}, {38, 51}, {37, 51}, {37, 51}, {37, 51}, {37, 51},
+        {37, 51}, {37, 51}, {37, 51}, {37, 51}, {37, 51}, {37, 51}, {37, 51}, {37, 51}, {38, 51}, {38, 52}, {38, 52}, {38, 52},
+        {38, 52}, {39, 52}, {39, 52}, {39, 53}, {40, 53}, {40, 53}, {41, 54}, {41, 54}, {42, 54}, {42, 54}, {43, 55}, {44, 55},
+        {45, 56}, {45, 56}, {46, 57}, {47, 58}, {48, 58}, {49, 59}, {50, 59}, {51, 60}, {52, 61}, {54, 62}, {56, 63}, {57, 64},
+        {59, 66}, {63, 68}, {67, 70}, {75, 75},
+    },
+    { // Phase 14/32
+        {75, 75}, {67, 69}, {63, 66}, {59, 64}, {57, 62}, {56, 60}, {54, 59}, {53, 58}, {51, 58}, {50, 56}, {49, 55}, {48, 55},
+        {47, 54}, {46, 54}, {45, 52}, {45, 52}, {44, 52}, {43, 51}, {42, 50}, {42, 50}, {41, 50}, {41, 49}, {41, 49}, {40, 49},
+        {39, 48}, {39, 48}, {39, 48}, {39, 48}, {38, 47}, {38, 47}, {38, 47}, {38, 47}, {37, 47}, {37, 47}, {37, 46}, {37, 46},
+        {37, 46}, {37, 46}, {37, 46}, {37, 46}, {37, 46}, {37, 46}, {37, 47}, {37, 47}, {38, 47}, {38, 47}, {38, 47}, {38, 47},
+        {38, 48}, {39, 48}, {39, 48}, {39, 48}, {40, 48}, {40, 49}, {41, 49}, {41, 50}, {42, 50}, {42, 50}, {43, 51}, {44, 52},
+        {45, 52}, {45, 52}, {46, 53}, {47, 54}, {48, 55}, {49, 55}, {50, 56}, {51, 57}, {52, 58}, {54, 59}, {56, 60}, {57, 62},
+        {59, 64}, {63, 66}, {67, 69}, {75, 75},
+    },
+    { // Phase 15/32
+        {75, 75}, {67, 68}, {63, 65}, {59, 63}, {57, 59}, {56, 58}, {54, 57}, {53, 56}, {51, 55}, {50, 53}, {49, 52}, {48, 51},
+        {47, 51}, {46, 50}, {45, 49}, {45, 48}, {44, 48}, {43, 47}, {42, 46}, {42, 46}, {41, 45}, {41, 45}, {41, 45}, {40, 44},
+        {39, 44}, {39, 44}, {39, 43}, {39, 43}, {38, 43}, {38, 43}, {38, 42}, {38, 42}, {37, 42}, {37, 42}, {37, 42}, {37, 42},
+        {37, 42}, {37, 42}, {37, 42}, {37, 42}, {37, 42}, {37, 42}, {37, 42}, {37, 42}, {38, 42}, {38, 42}, {38, 43}, {38, 43},
+        {38, 43}, {39, 43}, {39, 44}, {39, 44}, {40, 44}, {40, 45}, {41, 45}, {41, 45}, {42, 46}, {42, 46}, {43, 47}, {44, 48},
+        {45, 48}, {45, 49}, {46, 49}, {47, 51}, {48, 51}, {49, 52}, {50, 53}, {51, 54}, {52, 56}, {54, 57}, {56, 58}, {57, 59},
+        {59, 63}, {63, 65}, {67, 68}, {75, 75},
+    },
+    { // Phase 16/32
+        {75, 75}, {82, 82}, {86, 86}, {88, 90}, {92, 92}, {93, 93}, {95, 95}, {96, 96}, {97, 98}, {99, 99}, {100, 100}, {101, 101},
+        {102, 102}, {102, 103}, {104, 104}, {105, 105}, {105, 105}, {106, 106}, {107, 107}, {107, 107}, {108, 108}, {108, 108}, {108, 108}, {109, 109},
+        {110, 110}, {110, 110}, {110, 110}, {110, 110}, {111, 111}, {111, 111}, {111, 111}, {111, 111}, {112, 112}, {112, 112}, {112, 112}, {112, 112},
+        {112, 112}, {112, 112}, {112, 112}, {112, 112}, {112, 112}, {112, 112}, {112, 112}, {112, 112}, {111, 111}, {111, 111}, {111, 111}, {111, 111},
+        {110, 111}, {110, 110}, {110, 110}, {110, 110}, {109, 109}, {108, 109}, {108, 108}, {108, 108}, {107, 107}, {107, 107}, {106, 106}, {105, 105},
+        {105, 105}, {104, 104}, {103, 103}, {102, 102}, {101, 101}, {100, 100}, {99, 99}, {98, 98}, {96, 97}, {95, 95}, {93, 93}, {92, 92},
+        {88, 90}, {86, 86}, {82, 82}, {75, 75},
+    },
+    { // Phase 17/32
+        {75, 75}, {81, 82}, {84, 86}, {86, 90}, {90, 92}, {91, 93}, {92, 95}, {93, 96}, {94, 98}, {96, 99}, {97, 100}, {98, 101},
+        {98, 102}, {99, 103}, {100, 104}, {101, 105}, {101, 105}, {102, 106}, {103, 107}, {103, 107}, {104, 108}, {104, 108}, {104, 108}, {105, 109},
+        {105, 110}, {105, 110}, {106, 110}, {106, 110}, {106, 111}, {106, 111}, {107, 111}, {107, 111}, {107, 112}, {107, 112}, {107, 112}, {107, 112},
+        {107, 112}, {107, 112}, {107, 112}, {107, 112}, {107, 112}, {107, 112}, {107, 112}, {107, 112}, {107, 111}, {107, 111}, {106, 111}, {106, 111},
+        {106, 111}, {106, 110}, {105, 110}, {105, 110}, {105, 109}, {104, 109}, {104, 108}, {104, 108}, {103, 107}, {103, 107}, {102, 106}, {101, 105},
+        {101, 105}, {100, 104}, {100, 103}, {98, 102}, {98, 101}, {97, 100}, {96, 99}, {95, 98}, {93, 97}, {92, 95}, {91, 93}, {90, 92},
+        {86, 90}, {84, 86}, {81, 82}, {75, 75},
+    },
+    { // Phase 18/32
+        {75, 75}, {80, 82}, {83, 86}, {85, 90}, {87, 92}, {89, 93}, {90, 95}, {91, 96}, {91, 98}, {93, 99}, {94, 100}, {94, 101},
+        {95, 102}, {95, 103}, {97, 104}, {97, 105}, {97, 105}, {98, 106}, {99, 107}, {99, 107}, {99, 108}, {100, 108}, {100, 108}, {100, 109},
+        {101, 110}, {101, 110}, {101, 110}, {101, 110}, {102, 111}, {102, 111}, {102, 111}, {102, 111}, {102, 112}, {102, 112}, {103, 112}, {103, 112},
+        {103, 112}, {103, 112}, {103, 112}, {103, 112}, {103, 112}, {103, 112}, {102, 112}, {102, 112}, {102, 111}, {102, 111}, {102, 111}, {102, 111},
+        {101, 111}, {101, 110}, {101, 110}, {101, 110}, {101, 109}, {100, 109}, {100, 108}, {99, 108}, {99, 107}, {99, 107}, {98, 106}, {97, 105},
+        {97, 105}, {97, 104}, {96, 103}, {95, 102}, {94, 101}, {94, 100}, {93, 99}, {92, 98}, {91, 97}, {90, 95}, {89, 93}, {87, 92},
+        {85, 90}, {83, 86}, {80, 82}, {75, 75},
+    },
+    { // Phase 19/32
+        {75, 75}, {79, 82}, {81, 86}, {83, 90}, {85, 92}, {86, 93}, {87, 95}, {88, 96}, {89, 98}, {90, 99}, {90, 100}, {91, 101},
+        {91, 102}, {92, 103}, {93, 104}, {93, 105}, {94, 105}, {94, 106}, {95, 107}, {95, 107}, {95, 108}, {95, 108}, {96, 108}, {96, 109},
+        {96, 110}, {97, 110}, {97, 110}, {97, 110}, {97, 111}, {97, 111}, {97, 111}, {98, 111}, {98, 112}, {98, 112}, {98, 112}, {98, 112},
+        {98, 112}, {98, 112}, {98, 112}, {98, 112}, {98, 112}, {98, 112}, {98, 112}, {98, 112}, {98, 111}, {97, 111}, {97, 111}, {97, 111},
+        {97, 111}, {97, 110}, {97, 110}, {96, 110}, {96, 109}, {96, 109}, {95, 108}, {95, 108}, {95, 107}, {95, 107}, {94, 106}, {94, 105},
+        {93, 105}, {93, 104}, {92, 103}, {91, 102}, {91, 101}, {90, 100}, {90, 99}, {89, 98}, {88, 97}, {87, 95}, {86, 93}, {85, 92},
+        {83, 90}, {81, 86}, {79, 82}, {75, 75},
+    },
+    { // Phase 20/32
+        {75, 75}, {78, 82}, {80, 86}, {81, 90}, {83, 92}, {84, 93}, {85, 95}, {85, 96}, {86, 98}, {87, 99}, {87, 100}, {88, 101},
+        {88, 102}, {88, 103}, {89, 104}, {90, 105}, {90, 105}, {90, 106}, {91, 107}, {91, 107}, {91, 108}, {91, 108}, {91, 108}, {92, 109},
+        {92, 110}, {92, 110}, {92, 110}, {92, 110}, {93, 111}, {93, 111}, {93, 111}, {93, 111}, {93, 112}, {93, 112}, {93, 112}, {93, 112},
+        {93, 112}, {93, 112}, {93, 112}, {93, 112}, {93, 112}, {93, 112}, {93, 112}, {93, 112}, {93, 111}, {93, 111}, {93, 111}, {93, 111},
+        {92, 111}, {92, 110}, {92, 110}, {92, 110}, {92, 109}, {91, 109}, {91, 108}, {91, 108}, {91, 107}, {91, 107}, {90, 106}, {90, 105},
+        {90, 105}, {89, 104}, {89, 103}, {88, 102}, {88, 101}, {87, 100}, {87, 99}, {86, 98}, {85, 97}, {85, 95}, {84, 93}, {83, 92},
+        {81, 90}, {80, 86}, {78, 82}, {75, 75},
+    },
+    { // Phase 21/32
+        {75, 75}, {77, 82}, {79, 86}, {80, 90}, {81, 92}, {82, 93}, {82, 95}, {83, 96}, {83, 98}, {84, 99}, {84, 100}, {84, 101},
+        {85, 102}, {85, 103}, {86, 104}, {86, 105}, {86, 105}, {86, 106}, {87, 107}, {87, 107}, {87, 108}, {87, 108}, {87, 108}, {87, 109},
+        {88, 110}, {88, 110}, {88, 110}, {88, 110}, {88, 111}, {88, 111}, {88, 111}, {88, 111}, {88, 112}, {88, 112}, {89, 112}, {89, 112},
+        {89, 112}, {89, 112}, {89, 112}, {89, 112}, {89, 112}, {89, 112}, {88, 112}, {88, 112}, {88, 111}, {88, 111}, {88, 111}, {88, 111},
+        {88, 111}, {88, 110}, {88, 110}, {88, 110}, {88, 109}, {87, 109}, {87, 108}, {87, 108}, {87, 107}, {87, 107}, {86, 106}, {86, 105},
+        {86, 105}, {86, 104}, {85, 103}, {85, 102}, {84, 101}, {84, 100}, {84, 99}, {83, 98}, {83, 97}, {82, 95}, {82, 93}, {81, 92},
+        {80, 90}, {79, 86}, {77, 82}, {75, 75},
+    },
+    { // Phase 22/32
+        {75, 75}, {76, 82}, {77, 86}, {78, 90}, {79, 92}, {79, 93}, {80, 95}, {80, 96}, {80, 98}, {81, 99}, {81, 100}, {81, 101},
+        {81, 102}, {81, 103}, {82, 104}, {82, 105}, {82, 105}, {82, 106}, {83, 107}, {83, 107}, {83, 108}, {83, 108}, {83, 108}, {83, 109},
+        {83, 110}, {83, 110}, {83, 110}, {83, 110}, {84, 111}, {84, 111}, {84, 111}, {84, 111}, {84, 112}, {84, 112}, {84, 112}, {84, 112},
+        {84, 112}, {84, 112}, {84, 112}, {84, 112}, {84, 112}, {84, 112}, {84, 112}, {84, 112}, {84, 111}, {84, 111}, {84, 111}, {84, 111},
+        {83, 111}, {83, 110}, {83, 110}, {83, 110}, {83, 109}, {83, 109}, {83, 108}, {83, 108}, {83, 107}, {83, 107}, {82, 106}, {82, 105},
+        {82, 105}, {82, 104}, {82, 103}, {81, 102}, {81, 101}, {81, 100}, {81, 99}, {80, 98}, {80, 97}, {80, 95}, {79, 93}, {79, 92},
+        {78, 90}, {77, 86}, {76, 82}, {75, 75},
+    },
+    { // Phase 23/32
+        {75, 75}, {75, 82}, {76, 86}, {76, 90}, {77, 92}, {77, 93}, {77, 95}, {77, 96}, {77, 98}, {78, 99}, {78, 100}, {78, 101},
+        {78, 102}, {78, 103}, {78, 104}, {78, 105}, {78, 105}, {78, 106}, {79, 107}, {79, 107}, {79, 108}, {79, 108}, {79, 108}, {79, 109},
+        {79, 110}, {79, 110}, {79, 110}, {79, 110}, {79, 111}, {79, 111}, {79, 111}, {79, 111}, {79, 112}, {79, 112}, {79, 112}, {79, 112},
+        {79, 112}, {79, 112}, {79, 112}, {79, 112}, {79, 112}, {79, 112}, {79, 112}, {79, 112}, {79, 111}, {79, 111}, {79, 111}, {79, 111},
+        {79, 111}, {79, 110}, {79, 110}, {79, 110}, {79, 109}, {79, 109}, {79, 108}, {79, 108}, {79, 107}, {79, 107}, {78, 106}, {78, 105},
+        {78, 105}, {78, 104}, {78, 103}, {78, 102}, {78, 101}, {78, 100}, {78, 99}, {77, 98}, {77, 97}, {77, 95}, {77, 93}, {77, 92},
+        {76, 90}, {76, 86}, {75, 82}, {75, 75},
+    },
+    { // Phase 24/32
+        {75, 75}, {75, 82}, {75, 86}, {75, 90}, {75, 92}, {75, 93}, {75, 95}, {75, 96}, {75, 98}, {75, 99}, {75, 100}, {75, 101},
+        {75, 102}, {74, 103}, {74, 104}, {75, 105}, {74, 105}, {75, 106}, {75, 107}, {75, 107}, {75, 108}, {75, 108}, {75, 108}, {75, 109},
+        {75, 110}, {75, 110}, {75, 110}, {75, 110}, {74, 111}, {75, 111}, {75, 111}, {75, 111}, {75, 112}, {74, 112}, {75, 112}, {75, 112},
+        {75, 112}, {75, 112}, {75, 112}, {75, 112}, {75, 112}, {75, 112}, {74, 112}, {75, 112}, {75, 111}, {75, 111}, {75, 111}, {74, 111},
+        {75, 111}, {75, 110}, {75, 110}, {75, 110}, {75, 109}, {75, 109}, {75, 108}, {75, 108}, {75, 107}, {75, 107}, {75, 106}, {74, 105},
+        {75, 105}, {74, 104}, {75, 103}, {74, 102}, {75, 101}, {75, 100}, {75, 99}, {75, 98}, {75, 97}, {75, 95}, {75, 93}, {75, 92},
+        {75, 90}, {75, 86}, {75, 82}, {75, 75},
+    },
+    { // Phase 25/32
+        {75, 75}, {74, 82}, {73, 86}, {73, 90}, {72, 92}, {72, 93}, {72, 95}, {72, 96}, {72, 98}, {71, 99}, {71, 100}, {71, 101},
+        {71, 102}, {71, 103}, {71, 104}, {71, 105}, {71, 105}, {71, 106}, {70, 107}, {70, 107}, {70, 108}, {70, 108}, {70, 108}, {70, 109},
+        {70, 110}, {70, 110}, {70, 110}, {70, 110}, {70, 111}, {70, 111}, {70, 111}, {70, 111}, {70, 112}, {70, 112}, {70, 112}, {70, 112},
+        {70, 112}, {70, 112}, {70, 112}, {70, 112}, {70, 112}, {70, 112}, {70, 112}, {70, 112}, {70, 111}, {70, 111}, {70, 111}, {70, 111},
+        {70, 111}, {70, 110}, {70, 110}, {70, 110}, {70, 109}, {70, 109}, {70, 108}, {70, 108}, {70, 107}, {70, 107}, {71, 106}, {71, 105},
+        {71, 105}, {71, 104}, {71, 103}, {71, 102}, {71, 101}, {71, 100}, {71, 99}, {72, 98}, {72, 97}, {72, 95}, {72, 93}, {72, 92},
+        {73, 90}, {73, 86}, {74, 82}, {75, 75},
+    },
+    { // Phase 26/32
+        {75, 75}, {73, 82}, {72, 86}, {71, 90}, {70, 92}, {70, 93}, {69, 95}, {69, 96}, {69, 98}, {68, 99}, {68, 100}, {68, 101},
+        {68, 102}, {67, 103}, {67, 104}, {67, 105}, {67, 105}, {67, 106}, {66, 107}, {66, 107}, {66, 108}, {66, 108}, {66, 108}, {66, 109},
+        {66, 110}, {66, 110}, {66, 110}, {66, 110}, {65, 111}, {65, 111}, {65, 111}, {65, 111}, {65, 112}, {65, 112}, {65, 112}, {65, 112},
+        {65, 112}, {65, 112}, {65, 112}, {65, 112}, {65, 112}, {65, 112}, {65, 112}, {65, 112}, {65, 111}, {65, 111}, {65, 111}, {65, 111},
+        {65, 111}, {66, 110}, {66, 110}, {66, 110}, {66, 109}, {66, 109}, {66, 108}, {66, 108}, {66, 107}, {66, 107}, {67, 106}, {67, 105},
+        {67, 105}, {67, 104}, {67, 103}, {68, 102}, {68, 101}, {68, 100}, {68, 99}, {69, 98}, {69, 97}, {69, 95}, {70, 93}, {70, 92},
+        {71, 90}, {72, 86}, {73, 82}, {75, 75},
+    },
+    { // Phase 27/32
+        {75, 75}, {72, 82}, {70, 86}, {69, 90}, {68, 92}, {67, 93}, {67, 95}, {66, 96}, {66, 98}, {65, 99}, {65, 100}, {65, 101},
+        {64, 102}, {64, 103}, {63, 104}, {63, 105}, {63, 105}, {63, 106}, {62, 107}, {62, 107}, {62, 108}, {62, 108}, {62, 108}, {61, 109},
+        {61, 110}, {61, 110}, {61, 110}, {61, 110}, {61, 111}, {61, 111}, {61, 111}, {61, 111}, {61, 112}, {61, 112}, {60, 112}, {60, 112},
+        {60, 112}, {60, 112}, {60, 112}, {60, 112}, {60, 112}, {60, 112}, {61, 112}, {61, 112}, {61, 111}, {61, 111}, {61, 111}, {61, 111},
+        {61, 111}, {61, 110}, {61, 110}, {61, 110}, {61, 109}, {62, 109}, {62, 108}, {62, 108}, {62, 107}, {62, 107}, {63, 106}, {63, 105},
+        {63, 105}, {63, 104}, {64, 103}, {64, 102}, {65, 101}, {65, 100}, {65, 99}, {66, 98}, {66, 97}, {67, 95}, {67, 93}, {68, 92},
+        {69, 90}, {70, 86}, {72, 82}, {75, 75},
+    },
+    { // Phase 28/32
+        {75, 75}, {71, 82}, {69, 86}, {67, 90}, {66, 92}, {65, 93}, {64, 95}, {64, 96}, {63, 98}, {62, 99}, {62, 100}, {61, 101},
+        {61, 102}, {60, 103}, {60, 104}, {60, 105}, {59, 105}, {59, 106}, {58, 107}, {58, 107}, {58, 108}, {58, 108}, {58, 108}, {57, 109},
+        {57, 110}, {57, 110}, {57, 110}, {57, 110}, {56, 111}, {56, 111}, {56, 111}, {56, 111}, {56, 112}, {56, 112}, {56, 112}, {56, 112},
+        {56, 112}, {56, 112}, {56, 112}, {56, 112}, {56, 112}, {56, 112}, {56, 112}, {56, 112}, {56, 111}, {56, 111}, {56, 111}, {56, 111},
+        {56, 111}, {57, 110}, {57, 110}, {57, 110}, {57, 109}, {57, 109}, {58, 108}, {58, 108}, {58, 107}, {58, 107}, {59, 106}, {59, 105},
+        {60, 105}, {60, 104}, {60, 103}, {61, 102}, {61, 101}, {62, 100}, {62, 99}, {63, 98}, {63, 97}, {64, 95}, {65, 93}, {66, 92},
+        {67, 90}, {69, 86}, {71, 82}, {75, 75},
+    },
+    { // Phase 29/32
+        {75, 75}, {70, 82}, {68, 86}, {65, 90}, {64, 92}, {63, 93}, {62, 95}, {61, 96}, {60, 98}, {59, 99}, {59, 100}, {58, 101},
+        {58, 102}, {57, 103}, {56, 104}, {56, 105}, {55, 105}, {55, 106}, {54, 107}, {54, 107}, {54, 108}, {54, 108}, {53, 108}, {53, 109},
+        {53, 110}, {52, 110}, {52, 110}, {52, 110}, {52, 111}, {52, 111}, {52, 111}, {51, 111}, {51, 112}, {51, 112}, {51, 112}, {51, 112},
+        {51, 112}, {51, 112}, {51, 112}, {51, 112}, {51, 112}, {51, 112}, {51, 112}, {51, 112}, {51, 111}, {52, 111}, {52, 111}, {52, 111},
+        {52, 111}, {52, 110}, {52, 110}, {53, 110}, {53, 109}, {53, 109}, {54, 108}, {54, 108}, {54, 107}, {54, 107}, {55, 106}, {55, 105},
+        {56, 105}, {56, 104}, {57, 103}, {57, 102}, {58, 101}, {59, 100}, {59, 99}, {60, 98}, {60, 97}, {62, 95}, {63, 93}, {64, 92},
+        {65, 90}, {68, 86}, {70, 82}, {75, 75},
+    },
+    { // Phase 30/32
+        {75, 75}, {69, 82}, {66, 86}, {63, 90}, {62, 92}, {60, 93}, {59, 95}, {58, 96}, {57, 98}, {56, 99}, {55, 100}, {55, 101},
+        {54, 102}, {53, 103}, {52, 104}, {52, 105}, {52, 105}, {51, 106}, {50, 107}, {50, 107}, {50, 108}, {49, 108}, {49, 108}, {48, 109},
+        {48, 110}, {48, 110}, {48, 110}, {48, 110}, {47, 111}, {47, 111}, {47, 111}, {47, 111}, {47, 112}, {47, 112}, {46, 112}, {46, 112},
+        {46, 112}, {46, 112}, {46, 112}, {46, 112}, {46, 112}, {46, 112}, {47, 112}, {47, 112}, {47, 111}, {47, 111}, {47, 111}, {47, 111},
+        {47, 111}, {48, 110}, {48, 110}, {48, 110}, {48, 109}, {49, 109}, {49, 108}, {50, 108}, {50, 107}, {50, 107}, {51, 106}, {52, 105},
+        {52, 105}, {52, 104}, {53, 103}, {54, 102}, {55, 101}, {55, 100}, {56, 99}, {57, 98}, {58, 97}, {59, 95}, {60, 93}, {62, 92},
+        {63, 90}, {66, 86}, {69, 82}, {75, 75},
+    },
+    { // Phase 31/32
+        {75, 75}, {68, 82}, {65, 86}, {61, 90}, {59, 92}, {58, 93}, {57, 95}, {56, 96}, {54, 98}, {53, 99}, {52, 100}, {51, 101},
+        {51, 102}, {49, 103}, {49, 104}, {48, 105}, {48, 105}, {47, 106}, {46, 107}, {46, 107}, {45, 108}, {45, 108}, {45, 108}, {44, 109},
+        {44, 110}, {44, 110}, {43, 110}, {43, 110}, {43, 111}, {43, 111}, {42, 111}, {42, 111}, {42, 112}, {42, 112}, {42, 112}, {42, 112},
+        {42, 112}, {42, 112}, {42, 112}, {42, 112}, {42, 112}, {42, 112}, {42, 112}, {42, 112}, {42, 111}, {42, 111}, {43, 111}, {43, 111},
+        {43, 111}, {43, 110}, {44, 110}, {44, 110}, {44, 109}, {44, 109}, {45, 108}, {45, 108}, {46, 107}, {46, 107}, {47, 106}, {48, 105},
+        {48, 105}, {49, 104}, {49, 103}, {50, 102}, {51, 101}, {52, 100}, {53, 99}, {54, 98}, {55, 97}, {57, 95}, {58, 93}, {59, 92},
+        {61, 90}, {65, 86}, {68, 82}, {75, 75},
+    },
+};
@@ -0,0 +1,742 @@
+#pragma once
+// Generated by tools/fontsubset.py from opensans12b.h, do not edit
+#include "epd_driver.h"
+const uint8_t OpenSans12BBitmaps[9556] = {
+    0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x9C, 0xFB, 0xFE, 0x9F, 0xEB, 0xFB, 0x7F,
+    0xCE, 0x6F, 0xFF, 0x39, 0xBF, 0xFE, 0xE7, 0xF8, 0xF2, 0x9F, 0xFD, 0xF3, 0x7F, 0xB6, 0x4F, 0xFF,
+    0x59, 0x3F, 0xFE, 0x67, 0x01, 0xA2, 0x0F, 0xFF, 0x99, 0x3F, 0xFC, 0x67, 0x5A, 0x70, 0x86, 0x91,
+    0x01, 0x08, 0x18, 0x19, 0x1E, 0xBD, 0x67, 0xFE, 0x01, 0x56, 0xBC, 0xF1, 0x3C, 0x13, 0x00, 0x95,
+    0xED, 0x1E, 0x71, 0x78, 0x9C, 0x01, 0x1E, 0x00, 0xE1, 0xFF, 0xF5, 0xFF, 0x20, 0xFF, 0x2F, 0xF4,
+    0xEF, 0x10, 0xFF, 0x0F, 0xF2, 0xDF, 0x00, 0xFF, 0x0F, 0xF1, 0xBF, 0x00, 0xFE, 0x0E, 0xF0, 0xAF,
+    0x00, 0xFD, 0x0C, 0xE0, 0x9F, 0x00, 0xFC, 0x0B, 0x1D, 0xC2, 0x11, 0x0D, 0x78, 0x9C, 0x63, 0x60,
+    0x30, 0xF8, 0xCF, 0xFE, 0xB1, 0x9F, 0x81, 0x81, 0x21, 0xE1, 0x3F, 0xCB, 0x97, 0x78, 0x20, 0x3D,
+    0xE1, 0x3F, 0xE3, 0x77, 0x7D, 0x20, 0x7D, 0xE0, 0x3D, 0xC3, 0x2F, 0x7E, 0x20, 0xFD, 0x61, 0x3F,
+    0xC3, 0x5F, 0x1E, 0xA0, 0x28, 0x18, 0xCC, 0x87, 0xD1, 0x01, 0x33, 0xFF, 0xCC, 0x3F, 0xF9, 0x7F,
+    0x66, 0x24, 0x03, 0xC3, 0x6F, 0xBE, 0x05, 0xFF, 0x81, 0xCA, 0x18, 0xFE, 0x73, 0x3F, 0xD8, 0xCF,
+    0xC0, 0xF0, 0x1D, 0x22, 0xCF, 0x03, 0xA3, 0x9B, 0x4F, 0xFC, 0xEF, 0xF8, 0x33, 0xBF, 0x83, 0x8D,
+    0x61, 0xC3, 0x7F, 0x86, 0xDF, 0x20, 0xE3, 0x1E, 0x9C, 0x67, 0xF8, 0xC7, 0x03, 0x32, 0x76, 0x3E,
+    0xC3, 0x7F, 0x2E, 0x20, 0xFD, 0x39, 0x1F, 0xE8, 0x00, 0x20, 0xFD, 0xD5, 0x1F, 0xE8, 0x00, 0x06,
+    0x06, 0x00, 0x54, 0xCE, 0x46, 0xB2, 0x78, 0x9C, 0x63, 0x60, 0x58, 0xC0, 0xCF, 0x00, 0x02, 0x10,
+    0x6A, 0xF2, 0xDF, 0xF7, 0x6B, 0xC4, 0x18, 0x1A, 0xFE, 0x03, 0xC1, 0x7D, 0x86, 0x6F, 0x20, 0xAA,
+    0x9E, 0xE1, 0xCF, 0xFF, 0xAD, 0xF2, 0x2D, 0xB2, 0x0C, 0xFF, 0xEE, 0x83, 0x95, 0xFC, 0xFE, 0xBF,
+    0x03, 0x44, 0x7D, 0xF9, 0xFF, 0xDF, 0x1E, 0x48, 0x25, 0x00, 0x55, 0xC4, 0x00, 0xE9, 0x45, 0x40,
+    0x5A, 0x1A, 0x48, 0x1F, 0xFC, 0xFF, 0xFF, 0x3C, 0xC8, 0x30, 0xFF, 0x7F, 0xFF, 0x99, 0x18, 0x81,
+    0x66, 0x7E, 0xFB, 0xCF, 0xB2, 0x4F, 0x6D, 0x81, 0xFC, 0xEF, 0xFF, 0x4C, 0xFF, 0x40, 0x86, 0x9D,
+    0x67, 0x00, 0x53, 0x32, 0x0C, 0x89, 0xA7, 0xFE, 0xBD, 0x8F, 0x46, 0x58, 0x0B, 0xA1, 0x00, 0x7A,
+    0xF8, 0x3F, 0x41, 0x78, 0x9C, 0x35, 0x8E, 0x4D, 0x0E, 0xC1, 0x40, 0x00, 0x85, 0x9F, 0x14, 0x49,
+    0xAB, 0x88, 0x1B, 0xF4, 0x06, 0xBA, 0x27, 0x99, 0xAE, 0x6C, 0xB9, 0x81, 0x23, 0xB8, 0xC2, 0x24,
+    0xD6, 0xF4, 0x08, 0x7A, 0x83, 0x4E, 0xE2, 0x00, 0x2C, 0x2C, 0x2D, 0xDC, 0xA0, 0x47, 0xF0, 0x53,
+    0x1A, 0xA5, 0xE6, 0x99, 0x8A, 0xD9, 0xBD, 0xBC, 0x7C, 0xF9, 0xDE, 0xC3, 0x81, 0x23, 0x00, 0xCF,
+    0x05, 0x10, 0x91, 0x74, 0x10, 0xB0, 0x0B, 0xEC, 0x79, 0x64, 0x07, 0x09, 0x9B, 0xC0, 0x85, 0x03,
+    0xF6, 0x91, 0xEF, 0x0C, 0x74, 0x3B, 0x43, 0x0B, 0x54, 0xC2, 0xC4, 0x3C, 0xC3, 0x47, 0x44, 0xF4,
+    0x6C, 0x7B, 0x62, 0x03, 0x7F, 0xB6, 0x88, 0xA5, 0x5E, 0x41, 0x19, 0x83, 0xAF, 0x7B, 0x6F, 0xD2,
+    0x0B, 0x8D, 0x77, 0xC9, 0x09, 0x53, 0x0A, 0x6C, 0x39, 0xBE, 0x66, 0x92, 0x6E, 0x19, 0x1B, 0x1C,
+    0xE5, 0x3C, 0x61, 0xBB, 0xA8, 0xD5, 0x01, 0x7D, 0xC5, 0xD6, 0xA3, 0x8E, 0x8A, 0x8E, 0x6D, 0xEF,
+    0x29, 0x2C, 0x5B, 0x0D, 0x11, 0x72, 0xC3, 0x29, 0x30, 0xA3, 0x0B, 0xBC, 0x68, 0xFE, 0xE1, 0xB7,
+    0x2A, 0xF5, 0x1A, 0x5F, 0xB5, 0x91, 0x5B, 0xCC, 0x78, 0x9C, 0x1D, 0x8D, 0xC1, 0x09, 0xC2, 0x40,
+    0x14, 0x44, 0x87, 0x68, 0xC0, 0x08, 0x6A, 0x4A, 0x48, 0x09, 0xC1, 0x06, 0xAC, 0x40, 0xB6, 0x03,
+    0xB5, 0x10, 0x41, 0xB1, 0x81, 0x34, 0x20, 0x58, 0x4A, 0xEC, 0xC0, 0x1A, 0xA2, 0x07, 0xC1, 0x93,
+    0x07, 0x35, 0x87, 0x4D, 0xF6, 0xF9, 0x37, 0xEF, 0x32, 0x0F, 0xFE, 0x67, 0x46, 0xE5, 0x8B, 0xBD,
+    0x22, 0x2D, 0x30, 0xB3, 0x2C, 0x20, 0x50, 0x99, 0xEC, 0x70, 0x79, 0xA8, 0x07, 0x59, 0xA8, 0xBB,
+    0x98, 0x94, 0x1C, 0x8E, 0xB8, 0xF8, 0xEC, 0xE9, 0x99, 0x46, 0x69, 0x20, 0x5E, 0x94, 0x7B, 0x98,
+    0xE8, 0xCD, 0xFC, 0x6A, 0x35, 0x5B, 0x7D, 0xC9, 0x5A, 0xD6, 0x81, 0xD4, 0x93, 0xF4, 0x24, 0x77,
+    0x2A, 0x6A, 0x81, 0x8A, 0x00, 0x2B, 0x93, 0x44, 0x0F, 0xC8, 0xAC, 0x66, 0xB3, 0x7C, 0x42, 0xAA,
+    0x0F, 0x03, 0xCE, 0xB6, 0x8C, 0x1B, 0x8C, 0x75, 0xEA, 0x38, 0x8F, 0x7E, 0xB8, 0x3F, 0xB7, 0x76,
+    0x57, 0xD4, 0x78, 0x9C, 0xFB, 0xFA, 0x9F, 0xE1, 0xCB, 0x7B, 0x86, 0x4F, 0xF7, 0x19, 0x3E, 0xEE,
+    0x67, 0xF8, 0xB0, 0x9E, 0xE1, 0xC1, 0x7C, 0x06, 0x00, 0x6D, 0xE0, 0x0A, 0x77, 0x78, 0x9C, 0x25,
+    0x8C, 0xCB, 0x0D, 0x40, 0x40, 0x00, 0x44, 0x9F, 0x8B, 0x13, 0x35, 0x6D, 0x09, 0x4A, 0xA0, 0x03,
+    0x3A, 0x50, 0x0A, 0x1D, 0xD1, 0x01, 0x35, 0x10, 0x2B, 0xF1, 0x1B, 0x23, 0x0E, 0x93, 0xCC, 0x9F,
+    0x5E, 0x29, 0xDB, 0x00, 0x4F, 0xA0, 0x52, 0xCE, 0x68, 0xB9, 0x28, 0x21, 0x4E, 0x70, 0x74, 0x70,
+    0xB5, 0x8E, 0x4A, 0x50, 0xF1, 0xE3, 0xE3, 0x77, 0x0D, 0xA7, 0xB3, 0xDD, 0xB3, 0x55, 0x30, 0x7B,
+    0xD3, 0x28, 0x73, 0x21, 0x40, 0xB4, 0xE9, 0xCF, 0x17, 0x29, 0x86, 0x22, 0xDF, 0x78, 0x9C, 0x7B,
+    0xF0, 0x9F, 0x89, 0x21, 0xE0, 0x3F, 0x0F, 0x03, 0xC3, 0x9F, 0x7C, 0x06, 0x86, 0xAF, 0xF7, 0x19,
+    0x18, 0x1E, 0xFC, 0x67, 0x61, 0x98, 0xF0, 0x9F, 0x0B, 0x28, 0xC8, 0xC7, 0xA0, 0xF0, 0x5F, 0x9E,
+    0x81, 0xE1, 0xBF, 0x3F, 0x03, 0xC3, 0xBF, 0x78, 0x06, 0x86, 0xBF, 0xF9, 0x10, 0x0C, 0x62, 0x03,
+    0xC5, 0x04, 0xFE, 0xEB, 0x83, 0xD5, 0x80, 0xD4, 0x3E, 0xF8, 0xCF, 0xCA, 0xF0, 0xF5, 0x3D, 0xD0,
+    0x8C, 0x7A, 0xA0, 0x10, 0x2F, 0x90, 0xCB, 0xC4, 0x00, 0x00, 0xC9, 0xE0, 0x21, 0x75, 0x78, 0x9C,
+    0x63, 0x60, 0xD8, 0xF0, 0x9F, 0x95, 0x01, 0x08, 0x16, 0xFC, 0x67, 0x06, 0x51, 0x0D, 0xFF, 0x99,
+    0x18, 0x18, 0x12, 0x58, 0x12, 0xFE, 0x33, 0x04, 0xB2, 0x3C, 0xF8, 0xBF, 0xFA, 0xFF, 0x8D, 0xFF,
+    0x9C, 0x1F, 0xFF, 0x83, 0x00, 0x77, 0xE1, 0x8C, 0xDF, 0xFF, 0xD7, 0x77, 0xB2, 0x31, 0x30, 0xFC,
+    0xFA, 0xEF, 0x0F, 0x54, 0x98, 0xF0, 0xFF, 0xE7, 0x7B, 0x46, 0x06, 0x86, 0x4F, 0xFF, 0x9B, 0xFE,
+    0x73, 0x33, 0x30, 0x7C, 0xDF, 0x2F, 0xF0, 0x5F, 0x8F, 0x81, 0x41, 0xC1, 0x9B, 0x61, 0x26, 0x23,
+    0x03, 0x14, 0x00, 0x00, 0xC2, 0x2E, 0x23, 0x96, 0x78, 0x9C, 0x63, 0x60, 0x38, 0x14, 0xC3, 0x00,
+    0x02, 0x9F, 0xEB, 0x71, 0x51, 0xFF, 0xFE, 0x83, 0x00, 0x33, 0x94, 0x5A, 0xB9, 0xEA, 0xF7, 0xFD,
+    0x55, 0xAB, 0x98, 0xF0, 0x69, 0x60, 0x60, 0x48, 0x54, 0x03, 0x12, 0x00, 0x8A, 0x3E, 0x1D, 0xB1,
+    0x78, 0x9C, 0x13, 0xF8, 0x5F, 0xEF, 0xF0, 0xDF, 0xBE, 0xE0, 0x3F, 0xDF, 0x82, 0xFF, 0x1C, 0x0F,
+    0xFE, 0x33, 0x7E, 0x5C, 0xCF, 0x00, 0x00, 0x5B, 0xF7, 0x09, 0xB1, 0x78, 0x9C, 0xFB, 0xF2, 0xFF,
+    0xBF, 0xFF, 0x17, 0x28, 0x16, 0x10, 0x14, 0x64, 0x04, 0x00, 0x6A, 0x0C, 0x09, 0xF7, 0x78, 0x9C,
+    0x63, 0x60, 0x64, 0x78, 0xF4, 0x9E, 0xF9, 0xC7, 0x7F, 0xAE, 0xEF, 0xFF, 0x39, 0x37, 0x9E, 0x67,
+    0x02, 0x00, 0x34, 0xAA, 0x07, 0x58, 0x78, 0x9C, 0x15, 0xCA, 0xCB, 0x0D, 0x40, 0x50, 0x00, 0x44,
+    0xD1, 0x47, 0x22, 0x24, 0x42, 0x74, 0x40, 0x27, 0x4A, 0xA0, 0x13, 0x4A, 0xD0, 0x89, 0x12, 0xE8,
+    0x40, 0x09, 0x94, 0xA0, 0x03, 0x11, 0x9F, 0xC4, 0x27, 0xC6, 0x7D, 0xB3, 0x38, 0x9B, 0xB9, 0xC6,
+    0x98, 0x43, 0x86, 0x3D, 0x1D, 0x24, 0x2A, 0xB0, 0x56, 0x8C, 0x93, 0x02, 0xDC, 0xE4, 0xE2, 0x35,
+    0xDA, 0xE4, 0xAB, 0xA0, 0x54, 0x8A, 0xBD, 0x42, 0x5C, 0xE5, 0xE1, 0xB9, 0xD8, 0xF3, 0x6D, 0x21,
+    0x53, 0x8E, 0x8D, 0x22, 0x9C, 0xE5, 0xE3, 0x2E, 0x07, 0xEF, 0xC1, 0x26, 0x3F, 0x8B, 0x1B, 0x1E,
+    0x94, 0x78, 0x9C, 0x63, 0x60, 0x38, 0xFE, 0xBF, 0x97, 0x91, 0x81, 0xE1, 0xE2, 0xFF, 0xFF, 0xFF,
+    0xF5, 0x18, 0x18, 0x7E, 0x03, 0xA9, 0xFB, 0x0C, 0x06, 0xFF, 0xEF, 0x0B, 0xFD, 0xFA, 0xCF, 0x36,
+    0xE1, 0xBF, 0x3D, 0xC3, 0x83, 0xFF, 0x3C, 0x07, 0xFE, 0xF3, 0x31, 0x2C, 0xF8, 0xCF, 0xFF, 0xE1,
+    0x3F, 0x0F, 0x43, 0xC3, 0x7F, 0xFB, 0x0F, 0xFF, 0xB9, 0x19, 0x12, 0xFE, 0xFB, 0x7F, 0xFC, 0xCF,
+    0x05, 0xA4, 0xE2, 0xA1, 0x14, 0x54, 0xF0, 0x01, 0x44, 0x09, 0x44, 0x83, 0x7C, 0x03, 0x58, 0x3B,
+    0xAF, 0x02, 0xD8, 0x30, 0x0E, 0x86, 0x5F, 0x40, 0xA3, 0xDF, 0x33, 0x32, 0x1C, 0x00, 0x52, 0xF6,
+    0x0C, 0x0C, 0x0C, 0xC7, 0xFE, 0xCF, 0x65, 0x64, 0x00, 0x00, 0xB7, 0xEA, 0x43, 0x29, 0x78, 0x9C,
+    0x63, 0x60, 0x48, 0xF8, 0x1F, 0xCF, 0xC0, 0xF0, 0x13, 0x48, 0x1C, 0xFC, 0xFF, 0x3F, 0xDE, 0xE0,
+    0x1F, 0x90, 0xF8, 0xFC, 0xBF, 0xEF, 0x7F, 0xFC, 0x81, 0xFB, 0x49, 0xFF, 0xE3, 0x05, 0x38, 0xC1,
+    0xB2, 0x60, 0xA2, 0x80, 0x44, 0x02, 0x00, 0xA8, 0xE8, 0x27, 0x9D, 0x78, 0x9C, 0x63, 0x50, 0x38,
+    0xF1, 0x6F, 0x1D, 0x33, 0x03, 0xC3, 0xCF, 0xFF, 0xFF, 0xFF, 0xF7, 0x33, 0x1C, 0xF8, 0x0F, 0x02,
+    0xAC, 0x0E, 0xFF, 0xEB, 0x8C, 0x7F, 0xFD, 0xE7, 0x61, 0x98, 0xC6, 0xC0, 0xF0, 0xE0, 0x3F, 0x1F,
+    0x03, 0x10, 0x1C, 0x80, 0x50, 0x1F, 0xFE, 0x73, 0x83, 0xA8, 0x1F, 0xFF, 0x59, 0x81, 0xA4, 0xC3,
+    0xFF, 0xF3, 0x20, 0xCE, 0xE7, 0xFF, 0x72, 0x40, 0xD2, 0xE0, 0xDF, 0x7B, 0x26, 0x20, 0xF5, 0xF8,
+    0xBF, 0x1E, 0x98, 0x73, 0x1F, 0xC2, 0x91, 0x85, 0xC8, 0x28, 0x2B, 0x29, 0x09, 0x3D, 0x00, 0x1B,
+    0x5D, 0xFF, 0x01, 0x85, 0x02, 0x00, 0x8A, 0x09, 0x3B, 0x37, 0x78, 0x9C, 0x63, 0x28, 0x7C, 0xFD,
+    0x7F, 0x2D, 0x0B, 0x43, 0xC3, 0x7F, 0x20, 0x58, 0x0F, 0xA1, 0xFE, 0xB3, 0x31, 0xDC, 0x55, 0x57,
+    0xFC, 0xF5, 0x9F, 0x9B, 0x81, 0x91, 0x81, 0xE1, 0x03, 0x90, 0x02, 0x82, 0x8F, 0xFF, 0xD9, 0x81,
+    0xA4, 0xE3, 0x9F, 0xFB, 0x0C, 0x0C, 0x0E, 0x40, 0x15, 0x9C, 0x60, 0x6A, 0x3D, 0x2B, 0x90, 0x7A,
+    0xF7, 0xFF, 0xFF, 0x7D, 0x26, 0xA0, 0x9C, 0xC2, 0xCF, 0xFF, 0xBC, 0x20, 0x95, 0x07, 0xFE, 0xDB,
+    0x83, 0xA8, 0x0D, 0xFF, 0xFD, 0x41, 0xD4, 0x83, 0xFF, 0xF6, 0x0F, 0x3C, 0x19, 0x0D, 0x7F, 0xFF,
+    0xE7, 0xFB, 0x00, 0x31, 0x1A, 0x4C, 0xD5, 0x33, 0x18, 0x1C, 0xFF, 0xFB, 0xBE, 0x87, 0x89, 0x01,
+    0x00, 0x85, 0xEF, 0x3B, 0xA4, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x50, 0xF8, 0xBF, 0x9F, 0x01, 0x08,
+    0x0E, 0x40, 0xA8, 0xEF, 0x60, 0xCA, 0xE0, 0x3F, 0x98, 0xBA, 0xF0, 0xFE, 0x1F, 0x88, 0xFA, 0x91,
+    0xFF, 0x17, 0x48, 0x39, 0xFC, 0xE7, 0x01, 0xF1, 0x1E, 0xFC, 0x67, 0x02, 0xC9, 0xFD, 0xAA, 0x67,
+    0x00, 0x52, 0x01, 0xFF, 0x79, 0x40, 0xD4, 0xC3, 0xFF, 0x4C, 0x20, 0xEA, 0xC7, 0x7F, 0x10, 0x78,
+    0xFF, 0x13, 0x42, 0x41, 0x78, 0xF7, 0x41, 0x86, 0x42, 0x8C, 0xC6, 0xA4, 0x00, 0x7F, 0x74, 0x3C,
+    0xC4, 0x78, 0x9C, 0x3B, 0xF0, 0x1F, 0x08, 0xF8, 0x18, 0x2E, 0x40, 0xA8, 0x0F, 0x30, 0xCA, 0xD2,
+    0xD8, 0x98, 0x89, 0xE1, 0xE3, 0x7F, 0x36, 0x06, 0x20, 0xF8, 0xF4, 0x9F, 0x05, 0x44, 0x7D, 0xF9,
+    0xFF, 0xF7, 0xBD, 0x37, 0x03, 0xC3, 0x57, 0x90, 0x12, 0x0E, 0x08, 0x15, 0xCF, 0xA0, 0xA0, 0xAA,
+    0x78, 0xF5, 0xFF, 0x79, 0x90, 0xB4, 0xC0, 0xFF, 0xFF, 0x20, 0x8A, 0xE1, 0xF7, 0x7F, 0x46, 0x10,
+    0xF5, 0xE7, 0x3F, 0x23, 0x23, 0x48, 0xF0, 0x3D, 0xC3, 0x1E, 0x33, 0xA0, 0x92, 0xF9, 0x40, 0x01,
+    0x20, 0x90, 0x03, 0x53, 0xF7, 0x99, 0x18, 0x9A, 0xDE, 0xFC, 0xDF, 0x07, 0x34, 0x1C, 0x00, 0x5D,
+    0x0A, 0x3F, 0x41, 0x78, 0x9C, 0x63, 0x60, 0x50, 0x38, 0xF1, 0xEF, 0x3D, 0x13, 0x03, 0xC3, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x33, 0x33, 0x1C, 0xF8, 0x0F, 0xA6, 0x7E, 0xFC, 0xF7, 0x66, 0x14, 0x60, 0x10,
+    0xF8, 0x5F, 0xCF, 0x00, 0x04, 0x05, 0xFF, 0x79, 0x41, 0xD4, 0x86, 0xFF, 0x12, 0xAF, 0xDE, 0x4B,
+    0x32, 0x3C, 0xF8, 0xFF, 0xE2, 0xFF, 0xFF, 0xF7, 0x4C, 0x1F, 0x40, 0x0A, 0xFF, 0xF3, 0x7C, 0xFC,
+    0xBF, 0x9E, 0xF1, 0xD1, 0x7F, 0xFD, 0x8F, 0x40, 0x25, 0x09, 0xFF, 0xF3, 0x3F, 0xFC, 0xE7, 0x62,
+    0x30, 0xF8, 0x5F, 0xFF, 0xE0, 0x3F, 0x0F, 0x83, 0xC3, 0xFF, 0xFC, 0x05, 0xFF, 0xF5, 0x19, 0x1A,
+    0xFE, 0xFB, 0x3B, 0xFC, 0xBF, 0x2F, 0xFC, 0xF5, 0x3F, 0x3F, 0xC3, 0x2F, 0x90, 0x06, 0x76, 0xA0,
+    0x31, 0xFF, 0xFF, 0xCF, 0x07, 0x1A, 0xB7, 0xF5, 0xDF, 0x3E, 0x16, 0x06, 0x00, 0x30, 0x95, 0x43,
+    0x9C, 0x78, 0x9C, 0xFB, 0xFA, 0x1F, 0x04, 0xEA, 0xBF, 0x22, 0x53, 0xF9, 0x0A, 0x4A, 0x4A, 0x4A,
+    0x87, 0xFE, 0xF3, 0x33, 0x00, 0xC1, 0xA7, 0xFF, 0x1C, 0x20, 0xEA, 0xE7, 0x7F, 0x26, 0x20, 0x29,
+    0xF0, 0x7F, 0x3F, 0x88, 0x53, 0xF0, 0xDF, 0x1F, 0x44, 0x3D, 0xF8, 0xCF, 0x0B, 0xA2, 0xBE, 0xFD,
+    0x67, 0x03, 0x51, 0x7F, 0xDF, 0x83, 0x48, 0x87, 0xFF, 0xFD, 0x20, 0xEA, 0xC0, 0x7F, 0x79, 0x10,
+    0xF5, 0xF9, 0x3F, 0x17, 0x88, 0xFA, 0xF5, 0x9F, 0x19, 0xAC, 0xF9, 0x3C, 0x88, 0xD3, 0xF0, 0x3F,
+    0x1E, 0x44, 0x7D, 0xF8, 0xCF, 0x07, 0x24, 0x01, 0xC9, 0xC5, 0x30, 0x43, 0x78, 0x9C, 0x1D, 0x8B,
+    0xBD, 0x0D, 0x82, 0x60, 0x00, 0x05, 0x9F, 0x44, 0xD4, 0x88, 0x3F, 0x2B, 0x7C, 0x13, 0x50, 0xD2,
+    0xCA, 0x04, 0xE2, 0x06, 0x8C, 0xA0, 0x95, 0xB5, 0x23, 0x38, 0x89, 0x32, 0x81, 0x71, 0x01, 0x42,
+    0xA2, 0x15, 0x24, 0x14, 0xB8, 0x00, 0x10, 0x43, 0x45, 0xF0, 0xFC, 0xB4, 0x7C, 0x77, 0xF7, 0x64,
+    0x72, 0x2E, 0x63, 0xA9, 0x03, 0xAE, 0x32, 0x50, 0xC2, 0xE4, 0xC0, 0x5E, 0x6F, 0x16, 0x27, 0xD6,
+    0xBA, 0xB3, 0xDC, 0x11, 0xA9, 0x62, 0xAE, 0x0F, 0xC1, 0x80, 0xA3, 0x97, 0x2D, 0xB7, 0xFA, 0xA5,
+    0xB5, 0x23, 0x3D, 0xFF, 0xCB, 0x50, 0x1F, 0xC1, 0x4D, 0xF0, 0xF5, 0x60, 0xD5, 0x30, 0x53, 0x48,
+    0xD4, 0x32, 0xB5, 0x22, 0x6E, 0x2C, 0x4C, 0xD8, 0x9C, 0x21, 0x05, 0x4F, 0xBD, 0x3D, 0x64, 0x23,
+    0x85, 0x05, 0x37, 0x57, 0x5F, 0x75, 0xD0, 0x46, 0xE4, 0x78, 0x9C, 0x1D, 0x8C, 0xCD, 0x0D, 0x01,
+    0x51, 0x00, 0x06, 0x87, 0x10, 0x1B, 0x84, 0x16, 0x28, 0xC0, 0x4F, 0x07, 0x2E, 0xEE, 0x5B, 0xC2,
+    0x2A, 0x40, 0x62, 0x3B, 0x20, 0x51, 0x00, 0x0D, 0x48, 0x74, 0xF4, 0x5C, 0xDD, 0x74, 0xB0, 0xAC,
+    0x88, 0x44, 0x6C, 0xC6, 0x3E, 0x97, 0x6F, 0x2E, 0x33, 0x1F, 0xA3, 0x6B, 0xB1, 0x06, 0x5E, 0xEA,
+    0x84, 0x79, 0xBD, 0x16, 0x9C, 0x3D, 0x8C, 0x3F, 0x26, 0x77, 0xFB, 0x5C, 0x1C, 0x94, 0x26, 0xEC,
+    0x9C, 0x95, 0x76, 0x58, 0x99, 0x3E, 0xEC, 0x72, 0x74, 0x73, 0x33, 0xE3, 0x6D, 0x96, 0xC7, 0xC0,
+    0x94, 0xAF, 0x6E, 0x5D, 0x90, 0x57, 0x61, 0xE9, 0xB0, 0xBE, 0xAB, 0x95, 0x5E, 0xC4, 0xD3, 0x36,
+    0x0D, 0xF6, 0x06, 0x88, 0xE2, 0xF4, 0x8F, 0xD0, 0x84, 0xAA, 0x38, 0xB5, 0xE0, 0x07, 0x45, 0x49,
+    0x41, 0xF6, 0x78, 0x9C, 0x3B, 0x78, 0x9E, 0xE9, 0xFB, 0x7F, 0xCE, 0x1F, 0xFF, 0xB9, 0x1E, 0xBD,
+    0x67, 0x66, 0x60, 0x64, 0x40, 0x01, 0x8C, 0x0C, 0x40, 0x41, 0xA0, 0x14, 0x50, 0xC1, 0xC6, 0xF3,
+    0x4C, 0x00, 0x45, 0x4A, 0x0E, 0xBF, 0x78, 0x9C, 0x13, 0xF8, 0xA3, 0x53, 0xF0, 0x7F, 0x7E, 0xC3,
+    0xFF, 0xF5, 0x0A, 0xFF, 0xEC, 0x18, 0x04, 0x18, 0x30, 0x81, 0xC0, 0xFF, 0x7A, 0x87, 0xFF, 0xF6,
+    0x05, 0xFF, 0xF9, 0x16, 0xFC, 0xE7, 0x78, 0xF0, 0x9F, 0xF1, 0xE3, 0x7A, 0x06, 0x00, 0x93, 0x15,
+    0x10, 0x91, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x82, 0x02, 0x26, 0x30, 0xF9, 0x8F, 0x19, 0x4C, 0xFE,
+    0x67, 0x06, 0x93, 0x75, 0x60, 0x32, 0x17, 0x4C, 0xFA, 0x00, 0x25, 0xFE, 0xFE, 0xB7, 0x06, 0xA9,
+    0xFA, 0xF7, 0x3F, 0x1A, 0x44, 0x2D, 0xFE, 0xFF, 0xBF, 0x8E, 0x11, 0x48, 0x37, 0xFE, 0xFB, 0xBF,
+    0x9E, 0x05, 0x48, 0x27, 0xFC, 0xFD, 0x7F, 0x1F, 0xC4, 0x77, 0xF8, 0x0D, 0xD2, 0xCE, 0xC0, 0xA0,
+    0xF0, 0x13, 0x4C, 0x31, 0x08, 0x30, 0x00, 0x00, 0xF7, 0x4D, 0x1E, 0x57, 0x78, 0x9C, 0xFB, 0xF7,
+    0x1F, 0x04, 0x98, 0xFF, 0x41, 0xA8, 0x95, 0xAB, 0x40, 0x80, 0x89, 0x01, 0x02, 0xA0, 0xBC, 0x7F,
+    0x28, 0x4A, 0x00, 0x2D, 0xE6, 0x1F, 0xEB, 0x78, 0x9C, 0x93, 0x60, 0x00, 0x83, 0x7F, 0x92, 0x10,
+    0xEA, 0x3F, 0x98, 0x3E, 0xFA, 0x1F, 0x42, 0x6F, 0x81, 0xD2, 0x8B, 0xA0, 0xF4, 0xC4, 0xFF, 0xFF,
+    0x99, 0x80, 0xD4, 0xE4, 0xFF, 0xFF, 0x99, 0x19, 0x18, 0x8E, 0xFD, 0xFF, 0xEF, 0xC3, 0xA0, 0xF0,
+    0xE2, 0xFF, 0x7F, 0x2B, 0x06, 0x86, 0xDF, 0xFF, 0xDF, 0x4B, 0x80, 0xB4, 0xDF, 0x67, 0x03, 0x29,
+    0xDB, 0xC7, 0x02, 0x36, 0x8C, 0x09, 0x62, 0x34, 0x00, 0xB0, 0x91, 0x1C, 0xC3, 0x78, 0x9C, 0x53,
+    0xD8, 0xFE, 0xEF, 0xBE, 0x04, 0xC3, 0xCF, 0xFF, 0xFF, 0xFF, 0xBF, 0x67, 0xFE, 0x0E, 0x24, 0xFF,
+    0xF3, 0x3E, 0x88, 0x66, 0xDC, 0xF4, 0xDF, 0x9E, 0x81, 0x81, 0xC1, 0xE1, 0xBF, 0x3F, 0x90, 0x2C,
+    0xF8, 0xAF, 0x0F, 0x24, 0xBF, 0xFE, 0xE7, 0x61, 0x60, 0x68, 0xF8, 0x7F, 0x9F, 0x91, 0x01, 0xA8,
+    0x56, 0x1A, 0x24, 0xD7, 0xCF, 0x00, 0x12, 0x00, 0x8A, 0x32, 0x4C, 0xF8, 0xCF, 0xC9, 0x00, 0x07,
+    0x82, 0x0C, 0x60, 0x3D, 0x5C, 0x40, 0xF2, 0x03, 0x58, 0xE7, 0x03, 0x30, 0x19, 0xF0, 0x8F, 0x83,
+    0x81, 0x01, 0x00, 0xCE, 0x39, 0x25, 0x7C, 0x78, 0x9C, 0x2D, 0x8E, 0xBB, 0x0E, 0x01, 0x51, 0x18,
+    0x84, 0x87, 0xB8, 0x6C, 0x14, 0x56, 0xA5, 0x5D, 0x6F, 0x60, 0xDF, 0x00, 0x89, 0x4A, 0x43, 0x23,
+    0x4A, 0x95, 0x46, 0x23, 0xD1, 0x0B, 0x6F, 0xE0, 0x11, 0x2C, 0xBD, 0xCB, 0x0B, 0xA0, 0x44, 0x45,
+    0xA2, 0x54, 0xAC, 0x44, 0xA2, 0xA0, 0x58, 0xB7, 0xB8, 0xED, 0x3A, 0xE3, 0x1C, 0x31, 0xC5, 0xFC,
+    0x5F, 0x31, 0xF3, 0x67, 0x00, 0xD4, 0x8F, 0x9C, 0xC4, 0xA1, 0xD4, 0xA5, 0x52, 0x48, 0x92, 0x29,
+    0x9C, 0x6A, 0x71, 0xC6, 0xA1, 0xC4, 0x2B, 0x35, 0xE9, 0x6B, 0xE5, 0x22, 0xAF, 0x52, 0x31, 0x91,
+    0x44, 0x8B, 0x61, 0xF3, 0xC0, 0xB1, 0x76, 0xEB, 0xE0, 0x64, 0xE3, 0x21, 0x5B, 0xC6, 0xCA, 0xC1,
+    0xAD, 0x59, 0x60, 0x3B, 0xEB, 0xE9, 0x16, 0x7D, 0xCF, 0xD4, 0x8A, 0x01, 0x78, 0x7A, 0x8B, 0xFE,
+    0xB7, 0x71, 0xB6, 0x81, 0x8F, 0x44, 0x9F, 0xAB, 0x5F, 0xA6, 0x00, 0xA3, 0x16, 0xE1, 0xEA, 0xB2,
+    0x98, 0x66, 0x74, 0x3B, 0xC5, 0xCB, 0x18, 0x31, 0xB7, 0x67, 0xED, 0x95, 0xC7, 0xBD, 0x6C, 0xCA,
+    0x5F, 0x1B, 0x32, 0x82, 0xCB, 0x12, 0x3D, 0xD1, 0x48, 0x78, 0x0D, 0xC0, 0x62, 0x18, 0x7F, 0x25,
+    0x44, 0x5B, 0x9D, 0x8C, 0xB2, 0x1D, 0x07, 0xA5, 0xCA, 0xC2, 0xF9, 0x6D, 0x72, 0xD5, 0x72, 0xFB,
+    0x17, 0x31, 0xE7, 0xC2, 0xE9, 0x07, 0x25, 0x7C, 0x01, 0x2A, 0xE5, 0x64, 0x2F, 0x78, 0x9C, 0x25,
+    0xCC, 0xDB, 0x0D, 0x82, 0x50, 0x10, 0x84, 0xE1, 0x89, 0x97, 0xA8, 0x11, 0x91, 0x0E, 0x48, 0xA8,
+    0xC0, 0xD8, 0x80, 0x2D, 0xD0, 0xC1, 0xA1, 0x13, 0x4A, 0xD0, 0x0E, 0xA4, 0x03, 0x5B, 0xB0, 0x03,
+    0x5B, 0x30, 0x34, 0x80, 0x31, 0x20, 0x09, 0x8A, 0xBF, 0x67, 0x8F, 0xF3, 0x32, 0xDF, 0xC3, 0xEE,
+    0x48, 0xFA, 0x92, 0xCA, 0xB2, 0x83, 0x32, 0xE0, 0x04, 0xB7, 0x80, 0x3B, 0x03, 0x13, 0x43, 0x4B,
+    0xCD, 0xD2, 0x30, 0x34, 0x15, 0x1B, 0x03, 0xE7, 0x9C, 0x83, 0xEF, 0x1C, 0x97, 0x70, 0xF4, 0xA8,
+    0xD8, 0xEA, 0xD3, 0x78, 0x3C, 0x88, 0xD4, 0x33, 0x93, 0x5E, 0x2C, 0xF4, 0x64, 0x25, 0xBD, 0xB1,
+    0xC4, 0x4A, 0x42, 0xE3, 0x54, 0xFC, 0x71, 0xD1, 0x15, 0x97, 0x65, 0x7B, 0xF0, 0x77, 0xB1, 0xAD,
+    0x33, 0xEF, 0xED, 0x41, 0x1D, 0xEB, 0x91, 0x69, 0x18, 0x4B, 0x7F, 0x2B, 0x3D, 0x49, 0x7E, 0x78,
+    0x9C, 0xFB, 0xF3, 0xFF, 0xFF, 0xFB, 0x39, 0x2C, 0x0C, 0x7F, 0xFE, 0x03, 0xC1, 0x7E, 0x08, 0xF5,
+    0x9F, 0xF3, 0xCF, 0x7F, 0x41, 0xA7, 0x5F, 0xFF, 0xF9, 0xFE, 0xFC, 0x67, 0x60, 0xF8, 0xF0, 0x9F,
+    0x1F, 0x42, 0x81, 0x78, 0x0A, 0x3F, 0xFF, 0x73, 0x80, 0x95, 0x9C, 0x87, 0xA8, 0x94, 0x86, 0x6A,
+    0x60, 0x05, 0xC9, 0x7D, 0xFF, 0x2F, 0x0F, 0x52, 0xB9, 0xE0, 0x7F, 0x3C, 0x88, 0x6A, 0xF8, 0x5F,
+    0x0F, 0xA2, 0x36, 0xFC, 0xCF, 0xFF, 0xF3, 0x5F, 0xC9, 0xE8, 0xE7, 0x7F, 0x7D, 0x88, 0x4A, 0x6E,
+    0x24, 0x8B, 0xD6, 0xB1, 0x30, 0x00, 0x00, 0xA7, 0xE2, 0x56, 0x8D, 0x78, 0x9C, 0x63, 0x60, 0x48,
+    0x78, 0xFD, 0x7F, 0x2D, 0x2B, 0x03, 0x83, 0xC1, 0xBF, 0xFF, 0xFF, 0xFF, 0xDF, 0x67, 0x60, 0xF8,
+    0x0A, 0xA4, 0xFE, 0xF7, 0x33, 0x08, 0xFC, 0xFB, 0x1F, 0x63, 0x7C, 0x4C, 0x9F, 0x61, 0xC1, 0xFF,
+    0xFD, 0x0C, 0x0C, 0x0C, 0x4C, 0x0C, 0x1F, 0xFE, 0xCB, 0x33, 0x80, 0xC0, 0x97, 0xFF, 0x5C, 0x60,
+    0xFA, 0xFB, 0x7F, 0x76, 0x30, 0xFD, 0xE3, 0x3F, 0x2B, 0x0A, 0xFD, 0xFD, 0x3F, 0x1B, 0x98, 0xFE,
+    0xFA, 0x9F, 0x13, 0x4C, 0x7F, 0xFC, 0xCF, 0x07, 0xA6, 0x0F, 0xFC, 0x9F, 0x0F, 0xA6, 0x1D, 0xFE,
+    0xFF, 0x8F, 0x36, 0x6A, 0x8D, 0x65, 0x60, 0xF8, 0x09, 0xB2, 0x27, 0x9F, 0x81, 0xA1, 0x01, 0x4A,
+    0x33, 0x34, 0xBD, 0x79, 0x0F, 0x74, 0x07, 0x00, 0xCF, 0x69, 0x36, 0xD8, 0x78, 0x9C, 0xFB, 0xF3,
+    0xFF, 0xFF, 0xFB, 0x6A, 0x46, 0x06, 0x86, 0x3F, 0xFF, 0x81, 0xA0, 0x1F, 0x4A, 0xFF, 0xE7, 0x06,
+    0xD2, 0x82, 0x4E, 0x3F, 0xFF, 0xCF, 0x07, 0xD2, 0x0C, 0x0C, 0x0E, 0xFF, 0xFF, 0x33, 0x81, 0x68,
+    0x86, 0x9F, 0xFF, 0x39, 0xC0, 0xF4, 0xA7, 0xFF, 0x3C, 0x60, 0xFA, 0xC3, 0x7F, 0x7E, 0x30, 0xFD,
+    0x00, 0x8D, 0xFE, 0xF0, 0x9F, 0x0F, 0x4C, 0x7F, 0xFE, 0xCF, 0x0D, 0xA6, 0x7F, 0xFD, 0x67, 0x07,
+    0xD1, 0x09, 0xFF, 0xFF, 0x33, 0xFE, 0xF9, 0xAF, 0x14, 0xF4, 0xFB, 0x7F, 0x3D, 0xD4, 0x1E, 0x4E,
+    0x08, 0x9D, 0x07, 0xB6, 0xF7, 0x5E, 0x16, 0x50, 0x29, 0x00, 0x6D, 0x42, 0x51, 0xA2, 0x78, 0x9C,
+    0xFB, 0xF3, 0x1F, 0x08, 0x38, 0xFE, 0xA0, 0x90, 0x82, 0x82, 0x82, 0x0C, 0x7F, 0xFE, 0x33, 0x00,
+    0x01, 0x2A, 0x09, 0x04, 0x8C, 0xA8, 0x24, 0x2E, 0x95, 0x4A, 0x4A, 0x4A, 0x8C, 0x7F, 0x30, 0x4C,
+    0x06, 0x00, 0xD3, 0x8C, 0x3F, 0x8C, 0x78, 0x9C, 0xFB, 0xF3, 0x1F, 0x08, 0xD8, 0xFF, 0xA0, 0x90,
+    0x82, 0x82, 0x82, 0x0C, 0x7F, 0xFE, 0x33, 0x00, 0x01, 0x36, 0x12, 0x08, 0xD0, 0x48, 0xFC, 0xEA,
+    0x11, 0x24, 0x00, 0x41, 0x00, 0x36, 0x10, 0x78, 0x9C, 0x63, 0x60, 0x30, 0x38, 0xF1, 0xEF, 0x7E,
+    0x35, 0x13, 0x83, 0xC2, 0x9F, 0xFF, 0x40, 0xC0, 0xC7, 0xF0, 0x18, 0x44, 0xFD, 0x67, 0x17, 0xF8,
+    0xF7, 0x7F, 0xBE, 0x4A, 0xF0, 0x2F, 0xC6, 0x09, 0xFF, 0xDF, 0x33, 0x33, 0x00, 0xC1, 0x87, 0xFF,
+    0xFE, 0x20, 0x8A, 0xE1, 0xCB, 0x7F, 0x1E, 0x30, 0xFD, 0xED, 0x3F, 0x07, 0x98, 0xFE, 0xF1, 0x9F,
+    0x8D, 0x01, 0xA8, 0x5E, 0xFE, 0xC7, 0x7F, 0x56, 0x30, 0xFD, 0xFD, 0x3F, 0x3B, 0x98, 0xFE, 0xFA,
+    0x9F, 0x8B, 0x41, 0x69, 0xD1, 0x7F, 0xF9, 0x8F, 0xFF, 0xE5, 0x19, 0x18, 0x26, 0xFC, 0x97, 0xDF,
+    0xF0, 0x7F, 0x3D, 0x98, 0x76, 0xF8, 0xFF, 0x3F, 0xC6, 0xF8, 0x08, 0x50, 0xF0, 0x07, 0xD8, 0x1E,
+    0x79, 0x86, 0x02, 0x28, 0xCD, 0x50, 0xF8, 0xE6, 0xFF, 0xB9, 0x2C, 0x26, 0x00, 0x1C, 0x3E, 0x4A,
+    0x0B, 0x78, 0x9C, 0xFB, 0xF3, 0x9F, 0x81, 0x81, 0xE1, 0xC1, 0x7F, 0xBE, 0x3F, 0x24, 0xD3, 0x60,
+    0x80, 0x85, 0x56, 0x52, 0x52, 0x7A, 0x44, 0x8E, 0x79, 0x10, 0x1A, 0x00, 0xF4, 0xC2, 0x50, 0x0D,
+    0x78, 0x9C, 0xFB, 0xF3, 0x9F, 0xE1, 0x0F, 0xE9, 0x08, 0x00, 0xE6, 0x70, 0x23, 0xA7, 0x78, 0x9C,
+    0x63, 0x60, 0xF8, 0xF3, 0x9F, 0x81, 0x81, 0xEA, 0xC4, 0x5F, 0x20, 0x21, 0xF0, 0xFF, 0x3E, 0x83,
+    0xC9, 0x91, 0xFF, 0xF3, 0x81, 0x9C, 0xFF, 0xFA, 0x20, 0x82, 0x8D, 0xE1, 0xF7, 0x7B, 0x2B, 0x06,
+    0x06, 0x00, 0x6B, 0x52, 0x30, 0x7B, 0x78, 0x9C, 0x3D, 0xCD, 0xCB, 0x0D, 0x40, 0x40, 0x18, 0x04,
+    0xE0, 0x3F, 0x59, 0x11, 0x9C, 0x54, 0x40, 0x09, 0x4A, 0x51, 0x02, 0x25, 0xE8, 0x40, 0x0B, 0x3A,
+    0xA1, 0x04, 0x1D, 0x28, 0x45, 0x64, 0x0F, 0x22, 0x1E, 0x63, 0x67, 0x22, 0x4E, 0xDF, 0x65, 0x1E,
+    0x17, 0xCC, 0xF2, 0x07, 0xEE, 0x0A, 0xCE, 0x68, 0x8C, 0x1E, 0x48, 0x69, 0x8B, 0xC5, 0xA8, 0x47,
+    0x41, 0x43, 0x2A, 0xA2, 0x13, 0x7A, 0xA3, 0x3B, 0x32, 0x89, 0xDF, 0x5A, 0x8E, 0x58, 0xA5, 0x3B,
+    0x91, 0xA8, 0xBF, 0xA1, 0x92, 0xDD, 0xB7, 0x67, 0x37, 0x62, 0xE9, 0x51, 0xCA, 0x01, 0xA3, 0xE4,
+    0xC3, 0x0B, 0x43, 0x04, 0x4A, 0x09, 0x78, 0x9C, 0xFB, 0xF3, 0x9F, 0x01, 0x08, 0xFE, 0x50, 0x99,
+    0x54, 0x52, 0x52, 0x62, 0xFA, 0xF3, 0x1F, 0x08, 0xFC, 0x91, 0x49, 0x00, 0x3E, 0x9A, 0x2D, 0xF3,
+    0x78, 0x9C, 0x25, 0xCD, 0xC1, 0x0D, 0x82, 0x40, 0x14, 0x45, 0xD1, 0xA7, 0x21, 0x1A, 0x03, 0xB1,
+    0x05, 0xDC, 0xBB, 0x40, 0x17, 0xAC, 0xB5, 0x04, 0x3A, 0xA0, 0x84, 0xB1, 0x13, 0xEC, 0x40, 0x3A,
+    0xA0, 0x84, 0xB1, 0x03, 0x4A, 0xC0, 0x12, 0x34, 0x12, 0x93, 0x09, 0x64, 0x9E, 0xFF, 0xF3, 0xEF,
+    0xEA, 0xEC, 0xEE, 0xCC, 0x06, 0x12, 0x59, 0xCF, 0x1C, 0x04, 0xD5, 0x22, 0xAE, 0x81, 0xD6, 0xB4,
+    0x05, 0xDE, 0x2A, 0xCF, 0x0C, 0x18, 0xBD, 0xA8, 0x61, 0x0E, 0x04, 0xA7, 0x9A, 0x1C, 0x10, 0x0B,
+    0xD1, 0xE3, 0xE7, 0x71, 0xE5, 0x51, 0xF5, 0x21, 0xEE, 0x2C, 0x55, 0x4F, 0x26, 0x2F, 0x9E, 0x45,
+    0xDD, 0x8D, 0xBB, 0xAF, 0x3F, 0xA9, 0x0E, 0xDC, 0x07, 0xB7, 0x08, 0xF1, 0x12, 0x73, 0x53, 0xE8,
+    0x99, 0x9A, 0x46, 0x72, 0x63, 0x92, 0xE9, 0xCA, 0xD4, 0xB2, 0x87, 0xA9, 0xA2, 0x53, 0xFD, 0x01,
+    0x62, 0xBF, 0x69, 0xD3, 0x78, 0x9C, 0x35, 0xCC, 0x41, 0x0D, 0x80, 0x30, 0x0C, 0x05, 0xD0, 0xC2,
+    0x65, 0x07, 0x44, 0x6C, 0x8E, 0x90, 0x80, 0x05, 0x1C, 0x20, 0x01, 0x09, 0x95, 0xC0, 0x1C, 0x2D,
+    0x48, 0x20, 0x0C, 0x12, 0x92, 0x8D, 0x4F, 0xD3, 0xB2, 0xDB, 0x3B, 0xBD, 0x82, 0x91, 0x88, 0x2E,
+    0x74, 0x05, 0xA9, 0x01, 0xAE, 0xC1, 0x1B, 0x12, 0xD8, 0xB0, 0x54, 0xF4, 0x8A, 0x35, 0x63, 0x50,
+    0x70, 0xC4, 0x64, 0x08, 0x12, 0x28, 0xE8, 0x81, 0xCB, 0x82, 0x8D, 0x76, 0x78, 0xC3, 0x0C, 0x3E,
+    0x15, 0x54, 0x71, 0x1B, 0x32, 0x5E, 0x43, 0x04, 0x0C, 0xA1, 0x41, 0x82, 0x1F, 0x87, 0xE0, 0x03,
+    0xF0, 0xEC, 0x5E, 0x0A, 0x78, 0x9C, 0x63, 0x60, 0x28, 0x7C, 0xFD, 0x7F, 0x1F, 0x1B, 0x03, 0x03,
+    0x43, 0xC2, 0x7F, 0x20, 0x78, 0xCF, 0xC2, 0xC0, 0xF0, 0x1D, 0xC4, 0xF8, 0x1F, 0xCF, 0x60, 0xF0,
+    0xFF, 0x7F, 0x8E, 0xF1, 0xB5, 0xFF, 0xFF, 0x99, 0x36, 0xFC, 0xDF, 0x0F, 0x94, 0xFF, 0xF3, 0x9F,
+    0xF3, 0xE3, 0x7F, 0x79, 0x20, 0xE3, 0xD3, 0x7F, 0xFE, 0xAF, 0xFF, 0xB9, 0x81, 0x8C, 0x03, 0xFF,
+    0xED, 0xBF, 0xFF, 0xE7, 0x00, 0x32, 0x26, 0xFC, 0x8F, 0xFF, 0xF1, 0x9F, 0x1D, 0xC8, 0x68, 0xF8,
+    0x9F, 0x0F, 0x67, 0xC0, 0xA5, 0xBE, 0xC0, 0x14, 0xC3, 0xB5, 0xC3, 0x0D, 0x84, 0x5B, 0x01, 0xB7,
+    0x14, 0xE1, 0x0C, 0x98, 0xC3, 0x00, 0x07, 0x93, 0x51, 0x70, 0x78, 0x9C, 0xFB, 0xF3, 0xFF, 0xFF,
+    0xFB, 0x68, 0x06, 0x86, 0x3F, 0xFF, 0x81, 0x40, 0x06, 0x42, 0xED, 0x07, 0x52, 0x82, 0xCD, 0xFF,
+    0xFF, 0x33, 0xFF, 0xF9, 0xCF, 0xC0, 0xF0, 0xF3, 0x3F, 0x3B, 0x88, 0xFA, 0xFA, 0x9F, 0x03, 0x89,
+    0xFA, 0xF5, 0x9F, 0x0D, 0xA8, 0x64, 0xC9, 0xFF, 0xFF, 0x8C, 0x60, 0x0D, 0xFD, 0x10, 0x7D, 0x9C,
+    0x20, 0xEA, 0xBE, 0x25, 0xC8, 0x30, 0x06, 0x10, 0x20, 0x82, 0x02, 0x00, 0x68, 0x90, 0x42, 0xAD,
+    0x78, 0x9C, 0x63, 0x60, 0x28, 0x7C, 0xFD, 0x7F, 0x1F, 0x1B, 0x03, 0x03, 0x43, 0xC2, 0x7F, 0x20,
+    0x78, 0xCF, 0xC2, 0xC0, 0xF0, 0x1D, 0xC4, 0xF8, 0x1F, 0xCF, 0x60, 0xF0, 0xFF, 0x7F, 0x8E, 0xF1,
+    0xB5, 0xFF, 0xFF, 0x99, 0x36, 0xFC, 0xDF, 0x0F, 0x94, 0xFF, 0xF3, 0x9F, 0xF3, 0xE3, 0x7F, 0x79,
+    0x20, 0xE3, 0xD3, 0x7F, 0xFE, 0xAF, 0xFF, 0xB9, 0x81, 0x8C, 0x03, 0xFF, 0xED, 0xBF, 0xFF, 0xE7,
+    0x00, 0x32, 0x26, 0xFC, 0x8F, 0xFF, 0xF1, 0x9F, 0x1D, 0xC8, 0x68, 0xF8, 0x9F, 0x0F, 0x67, 0xC0,
+    0xA5, 0xBE, 0xC0, 0x14, 0xC3, 0xB5, 0xC3, 0x0D, 0x84, 0x5B, 0x01, 0xB5, 0x34, 0x1F, 0xE6, 0x0C,
+    0x56, 0xA0, 0x3C, 0xD0, 0x61, 0x40, 0x57, 0x80, 0x41, 0xC0, 0xFF, 0xFF, 0xCC, 0x10, 0xD6, 0x8F,
+    0xFF, 0x7A, 0x10, 0xC6, 0x86, 0xFF, 0xEF, 0x19, 0xC1, 0x0C, 0x81, 0xBF, 0xFF, 0x65, 0x01, 0x30,
+    0xDF, 0x5B, 0x59, 0x78, 0x9C, 0x2D, 0xCC, 0xBB, 0x0D, 0x80, 0x30, 0x0C, 0x04, 0x50, 0x13, 0xF1,
+    0x2B, 0x28, 0xC8, 0x00, 0x2C, 0xC6, 0x12, 0x20, 0x16, 0xA0, 0x60, 0x00, 0xD8, 0x30, 0x23, 0x20,
+    0x04, 0x12, 0x05, 0x81, 0xC3, 0x9F, 0xB8, 0x79, 0xB2, 0xEE, 0xEC, 0x08, 0x84, 0x9E, 0x88, 0x22,
+    0x78, 0xBA, 0x64, 0x10, 0xFD, 0x02, 0xE4, 0x2C, 0xD1, 0x8D, 0x4A, 0xBD, 0x50, 0xA7, 0xBD, 0x14,
+    0x27, 0x20, 0xB3, 0xFE, 0x60, 0x77, 0x7B, 0x61, 0xAE, 0xFA, 0xCF, 0x3F, 0x70, 0x22, 0x1D, 0x68,
+    0xD4, 0x11, 0xB3, 0x4A, 0x2F, 0x07, 0xE2, 0xC9, 0x81, 0xB8, 0x71, 0x20, 0xB6, 0x1F, 0xDC, 0x0F,
+    0x74, 0xB1, 0x4E, 0xCB, 0x78, 0x9C, 0x63, 0x68, 0xFC, 0xF3, 0xBE, 0x87, 0xD9, 0xE0, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xEB, 0x1F, 0x02, 0x89, 0xFF, 0xFA, 0xDF, 0xFE, 0xFB, 0x04, 0xDF, 0xE0, 0xF9, 0xF9,
+    0x9F, 0x89, 0x81, 0x81, 0xE1, 0xE7, 0x7F, 0x66, 0x20, 0xF9, 0xED, 0xBF, 0x1F, 0x90, 0x7C, 0xF0,
+    0xFF, 0xBF, 0x0F, 0x03, 0x83, 0x02, 0x50, 0xA5, 0x0D, 0x03, 0xC3, 0x44, 0xA0, 0x4A, 0x56, 0x06,
+    0x86, 0x49, 0x40, 0xF5, 0x40, 0xA9, 0x43, 0xFF, 0xFB, 0x81, 0xA4, 0xC0, 0xFF, 0xFD, 0xA2, 0x40,
+    0xEA, 0xFF, 0xFE, 0xBF, 0x59, 0xCA, 0x5B, 0xFE, 0xF7, 0xFF, 0x05, 0x99, 0x26, 0x07, 0x22, 0xDF,
+    0x33, 0x17, 0xBE, 0xFE, 0xBF, 0x8F, 0x9D, 0x01, 0x00, 0x58, 0x8A, 0x3A, 0x16, 0x78, 0x9C, 0xFB,
+    0xF1, 0x1F, 0x0C, 0x7E, 0xA0, 0x50, 0x8A, 0x4A, 0x9B, 0xFE, 0xFB, 0x2B, 0x29, 0x31, 0x30, 0x2C,
+    0xF8, 0xAF, 0xCF, 0xC0, 0x40, 0x43, 0x0A, 0x00, 0x5D, 0x16, 0x30, 0xA2, 0x78, 0x9C, 0xFB, 0xF7,
+    0x9E, 0x81, 0x81, 0xE1, 0xC3, 0x7F, 0x9E, 0x7F, 0x54, 0xA6, 0xFF, 0x42, 0x68, 0xEE, 0x3F, 0xFF,
+    0x19, 0x19, 0x18, 0x3E, 0xFF, 0xE7, 0xFA, 0xF9, 0x9F, 0x9D, 0x81, 0x01, 0x48, 0x7C, 0xFE, 0x3F,
+    0xDF, 0x64, 0xC9, 0xFF, 0xFF, 0x8C, 0x13, 0xFE, 0x83, 0x40, 0x3E, 0x48, 0x0C, 0x08, 0xD8, 0x18,
+    0x18, 0x0C, 0x6E, 0xFE, 0x3F, 0xA7, 0xCE, 0xC0, 0x00, 0x00, 0x72, 0x01, 0x4A, 0x2F, 0x78, 0x9C,
+    0x1D, 0xCE, 0x5B, 0x0D, 0xC2, 0x40, 0x14, 0x84, 0xE1, 0xBF, 0x84, 0x4B, 0x08, 0x04, 0x70, 0x50,
+    0x9C, 0x80, 0x04, 0x1C, 0x20, 0xA1, 0x75, 0x02, 0x12, 0x70, 0x80, 0x84, 0x56, 0x02, 0x0E, 0x8A,
+    0x04, 0xBA, 0x21, 0x34, 0x5C, 0xDA, 0x61, 0x76, 0xE7, 0xE5, 0xCC, 0xCB, 0x77, 0x32, 0xBD, 0x70,
+    0xBE, 0xCA, 0x3A, 0x8D, 0x61, 0xA3, 0x8A, 0xA0, 0x39, 0x1C, 0x54, 0x70, 0xD3, 0x0A, 0x2E, 0xCA,
+    0x29, 0xB5, 0x83, 0x87, 0x16, 0x6C, 0x75, 0x82, 0xA7, 0xA6, 0xD0, 0x37, 0xF0, 0x56, 0x06, 0x9D,
+    0x46, 0x0C, 0x95, 0x5F, 0x04, 0xCD, 0xF6, 0x46, 0x50, 0x6B, 0x79, 0x36, 0xC2, 0x2C, 0xBF, 0x1B,
+    0x61, 0x56, 0x84, 0x88, 0xE0, 0x77, 0x7D, 0x45, 0x64, 0xD6, 0x7C, 0x22, 0x82, 0x56, 0xC3, 0x31,
+    0x95, 0x5A, 0x5A, 0xA7, 0x52, 0x2A, 0xA1, 0x38, 0x46, 0x13, 0x9F, 0x3F, 0x19, 0xFD, 0x3D, 0xDE,
+    0x78, 0x9C, 0x25, 0x8F, 0xC1, 0x0D, 0x82, 0x40, 0x14, 0x44, 0x87, 0xA8, 0x51, 0x13, 0x92, 0xA5,
+    0x04, 0x0A, 0xB0, 0x07, 0x4A, 0x80, 0x1A, 0x6C, 0xC0, 0x12, 0x28, 0x01, 0x2E, 0xD6, 0x61, 0x09,
+    0x94, 0x00, 0x47, 0x6F, 0x94, 0x80, 0x24, 0x62, 0x80, 0x0D, 0x3B, 0xCE, 0x0F, 0x87, 0xDD, 0x9F,
+    0x9D, 0xFC, 0xBC, 0x37, 0x1B, 0x7A, 0x00, 0x1B, 0x75, 0xAD, 0xC4, 0xC2, 0x08, 0x09, 0x79, 0x04,
+    0x42, 0x8B, 0x49, 0xB3, 0x20, 0x2F, 0x48, 0x59, 0x61, 0xD4, 0xAC, 0xC9, 0x58, 0x49, 0x8E, 0x4E,
+    0xB3, 0x63, 0x70, 0x4A, 0xF6, 0x33, 0x0E, 0x7E, 0x4F, 0x0B, 0x66, 0xF8, 0x35, 0x73, 0x85, 0x8F,
+    0xF6, 0x13, 0x96, 0x58, 0xCB, 0xA9, 0xC7, 0xD7, 0x88, 0xDB, 0x0B, 0x21, 0x1F, 0x19, 0xCD, 0xE6,
+    0x5A, 0x86, 0x94, 0xAE, 0xE3, 0xC9, 0xB7, 0x7A, 0x4C, 0xBC, 0x33, 0xAE, 0x79, 0x95, 0x06, 0x12,
+    0x3D, 0x79, 0x2E, 0x78, 0x93, 0x06, 0x42, 0xBE, 0x79, 0x48, 0xF8, 0x90, 0x02, 0x12, 0x79, 0x1A,
+    0x46, 0x1A, 0x58, 0xB1, 0x46, 0x18, 0xAB, 0x07, 0xAB, 0x5C, 0x1A, 0xC6, 0x34, 0xF6, 0x99, 0xCC,
+    0x30, 0xA6, 0xB1, 0x0D, 0x67, 0x18, 0xD3, 0xFC, 0x01, 0x3B, 0x3D, 0x6E, 0xA6, 0x78, 0x9C, 0x25,
+    0x8C, 0x61, 0x0D, 0xC2, 0x50, 0x0C, 0x84, 0x0F, 0xC8, 0xFB, 0x01, 0x19, 0x64, 0x0A, 0x16, 0x9C,
+    0x80, 0x03, 0x2C, 0xCC, 0x01, 0x48, 0xC0, 0x01, 0x38, 0x18, 0x0E, 0xC0, 0x01, 0x38, 0x00, 0x0B,
+    0x53, 0xB0, 0x00, 0x0B, 0x24, 0xCB, 0xDE, 0x3E, 0xDA, 0x47, 0x93, 0xE6, 0xBE, 0xF6, 0xDA, 0x6B,
+    0x99, 0x4B, 0x4B, 0x1A, 0x9D, 0xD8, 0x4A, 0x17, 0x36, 0xCA, 0x07, 0x46, 0x6A, 0x99, 0x49, 0x1F,
+    0xA6, 0x8A, 0x36, 0xE8, 0xC6, 0x6A, 0xE7, 0xB6, 0x1D, 0xDE, 0x6B, 0x32, 0x03, 0x7D, 0x89, 0x8C,
+    0x1D, 0x1E, 0x70, 0x70, 0xD5, 0x1A, 0x8F, 0xB2, 0x3A, 0x42, 0x91, 0xE0, 0x0D, 0xD7, 0x04, 0xB1,
+    0xE9, 0x08, 0xA6, 0x16, 0x52, 0x27, 0xEF, 0x45, 0x56, 0x72, 0x36, 0xE8, 0x99, 0x58, 0x07, 0x95,
+    0x54, 0xBE, 0x2D, 0xF4, 0x64, 0x21, 0xED, 0xCD, 0xFB, 0x7F, 0x0C, 0x84, 0x1F, 0xAE, 0xE0, 0x43,
+    0xD7, 0x78, 0x9C, 0x95, 0xCB, 0xC1, 0x09, 0x83, 0x40, 0x00, 0x00, 0xC1, 0x0D, 0x22, 0x01, 0x51,
+    0xB0, 0x02, 0x49, 0x07, 0xB1, 0xA3, 0xB3, 0x14, 0x3B, 0x48, 0x0B, 0x96, 0x60, 0x07, 0x96, 0x62,
+    0x3A, 0x90, 0x70, 0x0F, 0x91, 0x03, 0x57, 0xAF, 0x84, 0xEC, 0x67, 0x5E, 0x9B, 0x2C, 0x61, 0x36,
+    0x44, 0x1B, 0x88, 0xD6, 0x93, 0x01, 0x92, 0xC5, 0xCB, 0x95, 0xDE, 0x05, 0x0E, 0xCB, 0xD9, 0x37,
+    0xFC, 0x6C, 0xA2, 0x15, 0x8C, 0x86, 0xE4, 0x03, 0xDA, 0x73, 0xF3, 0xC3, 0xDD, 0xAE, 0x5D, 0xF6,
+    0xAB, 0xCF, 0xEC, 0xE0, 0x96, 0xA1, 0xCD, 0xF7, 0xDF, 0x5E, 0x78, 0x2B, 0x34, 0x12, 0x78, 0x9C,
+    0xFB, 0xF4, 0x1F, 0x04, 0xD6, 0x7F, 0x42, 0xA6, 0xFA, 0x15, 0x94, 0x94, 0x94, 0xBE, 0xFC, 0xE7,
+    0x65, 0x00, 0x82, 0x3F, 0xFF, 0x99, 0x81, 0x64, 0xC1, 0xFF, 0x7E, 0x10, 0xE7, 0x33, 0x44, 0xEC,
+    0x2F, 0x58, 0xAC, 0xE1, 0x7F, 0x3D, 0x44, 0x8C, 0x07, 0x22, 0xC6, 0x04, 0x24, 0x27, 0xFC, 0xCF,
+    0x07, 0x71, 0xBE, 0xFC, 0xE7, 0x06, 0x92, 0x02, 0xFF, 0xFE, 0x33, 0x02, 0xA9, 0x05, 0xFF, 0xEB,
+    0x81, 0xC6, 0x09, 0x7D, 0x01, 0x1B, 0xFD, 0xFE, 0x1B, 0x0A, 0x05, 0x00, 0x0F, 0x81, 0x41, 0x6D,
+    0x78, 0x9C, 0xFB, 0xF2, 0xFF, 0x3F, 0xD7, 0x17, 0x30, 0x9E, 0xC9, 0xF6, 0xE5, 0x3D, 0x03, 0x03,
+    0x45, 0x18, 0x64, 0x06, 0xD4, 0x3C, 0x00, 0x5F, 0x26, 0x2F, 0x45, 0x78, 0x9C, 0xFB, 0xB5, 0x9F,
+    0x01, 0x08, 0xBE, 0xFC, 0x67, 0x04, 0x92, 0x0F, 0xFE, 0xB3, 0x03, 0xC9, 0x09, 0xFF, 0x79, 0x81,
+    0xA4, 0xC1, 0x7F, 0x7B, 0x90, 0xC4, 0xDF, 0xF9, 0x20, 0xF2, 0xFB, 0x7B, 0x10, 0xF9, 0xF1, 0x3F,
+    0x0B, 0x90, 0xDC, 0xF0, 0x9F, 0x0B, 0x48, 0x06, 0xFC, 0x97, 0x07, 0x09, 0xFD, 0xCF, 0x07, 0x91,
+    0x3F, 0xCF, 0x83, 0xC8, 0xCF, 0xFF, 0x99, 0x80, 0xE4, 0x85, 0xFF, 0x1C, 0x40, 0xB2, 0xE1, 0x3F,
+    0x1F, 0x90, 0x54, 0xF8, 0xEF, 0x0F, 0x92, 0xF8, 0xB3, 0x1E, 0x44, 0x7E, 0xFB, 0xCF, 0x00, 0x00,
+    0xAF, 0x1F, 0x1E, 0xD7, 0x78, 0x9C, 0xFB, 0xF6, 0xFF, 0x3F, 0xC7, 0x37, 0x20, 0x9E, 0x7C, 0xF3,
+    0x3F, 0x07, 0xC3, 0x02, 0xCA, 0x30, 0xC8, 0x8C, 0x6F, 0x50, 0xF3, 0x00, 0x89, 0xC3, 0x2B, 0x47,
+    0x78, 0x9C, 0x63, 0x60, 0x38, 0x50, 0xCF, 0x00, 0x02, 0x9F, 0xDF, 0x83, 0xA9, 0x5F, 0xFF, 0xD9,
+    0x81, 0xA4, 0xC2, 0xFF, 0xFF, 0x7C, 0x40, 0x6A, 0xC2, 0xFF, 0xAF, 0x20, 0xC9, 0x0F, 0xEB, 0x0F,
+    0x80, 0x24, 0xBF, 0xDB, 0x3B, 0x80, 0x24, 0xFF, 0xF1, 0x32, 0xFC, 0xE5, 0x63, 0x08, 0xF8, 0xCF,
+    0xC6, 0x00, 0x94, 0x3C, 0xF0, 0x9F, 0x81, 0xE1, 0xC2, 0x7B, 0x86, 0xCF, 0xF3, 0x19, 0x18, 0x12,
+    0xFE, 0xB3, 0xFF, 0xB2, 0x07, 0x2A, 0xFB, 0xC7, 0x07, 0x00, 0x91, 0x45, 0x1D, 0xB5, 0x78, 0x9C,
+    0xDB, 0xB0, 0x1B, 0x08, 0xAC, 0x3F, 0xFC, 0x07, 0x82, 0x78, 0x00, 0x39, 0x9C, 0x09, 0x23, 0x78,
+    0x9C, 0xFB, 0xF5, 0x9F, 0x93, 0xA1, 0xE1, 0x7F, 0x3C, 0x03, 0xC3, 0xD7, 0xFF, 0x4C, 0x0C, 0x06,
+    0x7F, 0x79, 0x01, 0x43, 0x18, 0x07, 0x11, 0x78, 0x9C, 0x63, 0x98, 0xF2, 0xE7, 0x7F, 0x0D, 0x03,
+    0x43, 0xC1, 0x7F, 0x20, 0xD0, 0x63, 0x10, 0xF8, 0xFF, 0xFE, 0xCF, 0xFF, 0xFD, 0x0C, 0x0C, 0xE9,
+    0x8C, 0x0C, 0x7F, 0xFE, 0x33, 0x32, 0x00, 0xC1, 0x8F, 0xFF, 0xCC, 0x0C, 0x93, 0xEF, 0xFC, 0xFB,
+    0xFF, 0x9F, 0x79, 0x01, 0x48, 0xC9, 0x7F, 0xE6, 0xEF, 0xFF, 0xFB, 0x4C, 0x7E, 0xFE, 0x67, 0xFE,
+    0x0B, 0x14, 0x07, 0xCA, 0xFD, 0x7B, 0xCF, 0xC0, 0xF0, 0x1B, 0xC4, 0x63, 0x4A, 0x00, 0xCA, 0xFD,
+    0xFA, 0x7F, 0xFE, 0x2F, 0x90, 0xFA, 0x04, 0x54, 0xF7, 0xE4, 0x3F, 0xB3, 0xC2, 0xAB, 0xF7, 0x5A,
+    0x13, 0xFE, 0x33, 0x03, 0x00, 0xC1, 0xCA, 0x3B, 0x0D, 0x78, 0x9C, 0xFB, 0xF0, 0x9F, 0x8B, 0x01,
+    0x08, 0x3E, 0xE0, 0xA7, 0x5E, 0xBC, 0x97, 0x04, 0x52, 0xB7, 0xFE, 0xFF, 0x7F, 0xCF, 0xF8, 0xE1,
+    0x3F, 0x08, 0x70, 0x7F, 0xF8, 0xBF, 0x9F, 0xE9, 0xEB, 0x7F, 0xFD, 0x0F, 0xFF, 0xF9, 0x19, 0x1A,
+    0xFE, 0xE7, 0x7F, 0xF8, 0xCF, 0xC3, 0x60, 0xF0, 0x7F, 0x3E, 0x48, 0x83, 0xC2, 0xFF, 0xF5, 0x1F,
+    0xFE, 0x73, 0x43, 0x28, 0x1E, 0x06, 0x07, 0x90, 0xA0, 0x3C, 0xC3, 0x04, 0x90, 0x92, 0xF3, 0xCC,
+    0x60, 0x0D, 0x20, 0xC0, 0xF5, 0xE1, 0xFF, 0x8B, 0xFF, 0xFF, 0xEF, 0x03, 0x0D, 0x13, 0x78, 0x09,
+    0x34, 0x1A, 0x00, 0x0B, 0x74, 0x49, 0xEE, 0x78, 0x9C, 0x63, 0x70, 0x78, 0xF5, 0x7E, 0x2E, 0x0B,
+    0xC3, 0xEF, 0xFF, 0xFF, 0xFF, 0xF3, 0x2E, 0x00, 0x12, 0xFF, 0xD9, 0x3F, 0xFF, 0x8F, 0x17, 0x5C,
+    0xC2, 0xF8, 0xE3, 0x3F, 0x1B, 0x03, 0x03, 0xC3, 0x9F, 0xFF, 0x8C, 0x40, 0xF2, 0xEF, 0x7F, 0x06,
+    0x38, 0x09, 0x11, 0xF9, 0x09, 0x96, 0xFD, 0x0A, 0x54, 0x39, 0x99, 0xF3, 0x00, 0x48, 0x17, 0x97,
+    0xC2, 0x5F, 0x10, 0xC9, 0x50, 0xF0, 0xE6, 0x7F, 0x2F, 0x23, 0x00, 0xE7, 0xAF, 0x29, 0x28, 0x78,
+    0x9C, 0x63, 0x60, 0x60, 0x60, 0xB8, 0xF0, 0x9F, 0x8F, 0x01, 0x1F, 0xB5, 0xE8, 0x5F, 0xEF, 0x81,
+    0xFF, 0x7C, 0x06, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0x9F, 0xEF, 0xC2, 0x7F, 0x10, 0xE0, 0xFB, 0xFA,
+    0xDF, 0xCF, 0xF0, 0xCF, 0x7F, 0xBE, 0x9F, 0xFF, 0xD9, 0x18, 0x3E, 0xFE, 0xE7, 0xFB, 0xF3, 0x9F,
+    0x91, 0x61, 0xC3, 0x7F, 0xBE, 0xBF, 0xFF, 0x19, 0x18, 0x26, 0x00, 0xA9, 0xF7, 0x60, 0xEA, 0x0F,
+    0x90, 0xB7, 0x01, 0xA4, 0x84, 0x95, 0xE1, 0x01, 0x58, 0x83, 0xC2, 0x2F, 0xB8, 0x76, 0x90, 0x61,
+    0xDD, 0x60, 0xA3, 0x6B, 0x15, 0xFE, 0xF3, 0x01, 0x00, 0x08, 0x42, 0x45, 0x62, 0x78, 0x9C, 0x1D,
+    0x8A, 0xB1, 0x0D, 0x40, 0x60, 0x14, 0x06, 0x3F, 0x05, 0x09, 0x66, 0x91, 0x68, 0x2D, 0x21, 0xB6,
+    0xD1, 0x18, 0xC2, 0x08, 0x96, 0x30, 0x85, 0x84, 0x5E, 0x43, 0xAF, 0x90, 0x90, 0x08, 0xE1, 0xCF,
+    0x79, 0x5C, 0x73, 0xC5, 0x9D, 0x8A, 0x65, 0xAD, 0x24, 0xDD, 0x40, 0xA2, 0x86, 0xA9, 0x63, 0xD2,
+    0x46, 0xA8, 0x03, 0xFF, 0xC4, 0xD3, 0x4C, 0xF8, 0x25, 0x88, 0xDC, 0xAF, 0xD8, 0x51, 0x1A, 0xFE,
+    0x63, 0xCD, 0x38, 0x09, 0x3E, 0xED, 0xE4, 0x52, 0xAB, 0x1A, 0x7A, 0xB7, 0x4A, 0x97, 0x8D, 0xA6,
+    0x74, 0x64, 0xC8, 0xF4, 0x02, 0x24, 0xD6, 0x37, 0xD3, 0x78, 0x9C, 0x63, 0x60, 0x38, 0xFE, 0xFF,
+    0x1C, 0x1B, 0xC3, 0x86, 0xFF, 0xFF, 0xFF, 0xB3, 0x33, 0x7C, 0x06, 0x92, 0x4C, 0x0C, 0xDF, 0xFE,
+    0x73, 0x2A, 0x30, 0x30, 0x7C, 0xFF, 0xCF, 0xC2, 0xC0, 0x50, 0xF0, 0xEF, 0xFF, 0xFF, 0x7E, 0x86,
+    0x1F, 0xFF, 0x41, 0xE4, 0xB1, 0x7F, 0xFF, 0xCF, 0xE6, 0x40, 0xC5, 0x29, 0x21, 0x01, 0x4A, 0xAE,
+    0x30, 0x92, 0x78, 0x9C, 0x63, 0x48, 0x78, 0xFD, 0xFF, 0xFF, 0xFF, 0xFB, 0x0C, 0xBF, 0x81, 0xE4,
+    0xFF, 0xF3, 0x05, 0xFF, 0xD7, 0x97, 0xFE, 0x7F, 0xCF, 0x7C, 0xE0, 0x3F, 0x2F, 0xC3, 0xF7, 0xFF,
+    0x8C, 0x0F, 0xFE, 0x73, 0x33, 0x7C, 0xF9, 0xCF, 0x02, 0xE1, 0x31, 0x25, 0xFC, 0x5F, 0x9F, 0x02,
+    0x54, 0xC8, 0xF0, 0x13, 0xA8, 0x50, 0x8F, 0x81, 0xE1, 0xD1, 0xFF, 0xFF, 0x35, 0x8C, 0x0C, 0x0C,
+    0xFF, 0x78, 0x19, 0x80, 0xC0, 0xE1, 0xBF, 0x2E, 0x88, 0x52, 0x00, 0x19, 0xD2, 0xCB, 0xC8, 0xF0,
+    0x0D, 0x44, 0xF3, 0x16, 0xFC, 0x03, 0x51, 0xF5, 0xDF, 0xDF, 0xB3, 0x30, 0x38, 0xFC, 0x5B, 0xFF,
+    0x37, 0x1F, 0xA8, 0xE0, 0xD7, 0xFC, 0x7F, 0xFD, 0x0C, 0x0C, 0x06, 0xFF, 0xE3, 0x7F, 0xFD, 0xAF,
+    0x6E, 0xFF, 0xF3, 0x9F, 0xF7, 0x22, 0x48, 0xC5, 0x7E, 0x46, 0x86, 0x6D, 0xFF, 0xDE, 0xCF, 0x61,
+    0x66, 0x00, 0x00, 0xA6, 0xB5, 0x50, 0x7D, 0x78, 0x9C, 0xFB, 0xF0, 0x9F, 0x8B, 0x01, 0x08, 0x3E,
+    0xE0, 0xA5, 0x38, 0x6F, 0xBC, 0xF7, 0x06, 0x52, 0x37, 0xFF, 0xFF, 0xFF, 0xCF, 0xF6, 0xE1, 0x3F,
+    0x08, 0xC8, 0x7F, 0xF8, 0x7F, 0x9F, 0xF9, 0xF1, 0xFF, 0xF8, 0x0F, 0xFF, 0xF5, 0x19, 0x12, 0xFE,
+    0xF7, 0x7F, 0xF8, 0xCF, 0xCB, 0x60, 0x00, 0xA2, 0xB8, 0x19, 0x14, 0x40, 0x14, 0x17, 0x69, 0x14,
+    0x00, 0xB3, 0xC1, 0x43, 0xCE, 0x78, 0x9C, 0x9B, 0xF0, 0x9E, 0xE5, 0xD3, 0x7F, 0x9E, 0x8F, 0xFF,
+    0xB9, 0x1D, 0x3A, 0x19, 0x19, 0x18, 0x18, 0x3E, 0xFC, 0xE7, 0x22, 0x12, 0x01, 0x00, 0xA7, 0x7B,
+    0x21, 0xE4, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0xE9, 0xC7, 0xA0, 0xF0, 0xFF, 0x3C, 0x83, 0xC0, 0xFF,
+    0xFD, 0x0C, 0x0C, 0x53, 0x24, 0x18, 0xC0, 0xE0, 0xFF, 0x7A, 0xB2, 0xB1, 0xC2, 0xFF, 0xF5, 0x82,
+    0x13, 0xFE, 0xF7, 0xFF, 0xFC, 0xFF, 0xDF, 0x1F, 0x88, 0xB9, 0x9E, 0xFF, 0xCF, 0x61, 0x00, 0x00,
+    0x6D, 0xB0, 0x2B, 0x78, 0x78, 0x9C, 0xFB, 0xF0, 0x9F, 0x8B, 0x01, 0x04, 0x3E, 0x10, 0x41, 0x17,
+    0xFC, 0xDF, 0x0F, 0xA6, 0xBF, 0xFE, 0xE7, 0x01, 0xD1, 0x0E, 0xFF, 0xEF, 0x33, 0x82, 0xE8, 0xCF,
+    0xFF, 0xF5, 0x40, 0xF2, 0x92, 0xFF, 0xFE, 0x33, 0x83, 0xE8, 0x13, 0xFF, 0xFD, 0xC1, 0xEA, 0xFF,
+    0xFD, 0xD7, 0x07, 0xD3, 0xFF, 0xFF, 0x9F, 0x07, 0xD3, 0xF7, 0x7F, 0xFD, 0xE7, 0x00, 0xD1, 0xBC,
+    0x17, 0xFE, 0xDB, 0x83, 0xCD, 0x33, 0xF8, 0xFF, 0x1E, 0xAC, 0x9F, 0xE1, 0x07, 0x10, 0x83, 0xE8,
+    0x03, 0xFF, 0xF3, 0xC1, 0xB4, 0xC2, 0xFF, 0xFF, 0x4C, 0x00, 0x53, 0xB0, 0x44, 0x3E, 0x78, 0x9C,
+    0xFB, 0xF0, 0x9F, 0xEB, 0x03, 0x59, 0x08, 0x00, 0x50, 0x76, 0x25, 0x7C, 0x78, 0x9C, 0xFB, 0xF0,
+    0x5E, 0xE0, 0xE5, 0x7B, 0x2B, 0x86, 0x63, 0xFF, 0x6B, 0x19, 0x3E, 0xFC, 0x7F, 0xFA, 0xFF, 0xFF,
+    0xFF, 0x25, 0x40, 0xCC, 0xFD, 0xE1, 0x3F, 0x0C, 0xF8, 0x7F, 0xF8, 0x7F, 0x9E, 0xE9, 0xEB, 0xFF,
+    0xFF, 0x62, 0x07, 0xFF, 0xF7, 0x7F, 0xF8, 0x2F, 0xCF, 0x70, 0xE0, 0xFF, 0x7C, 0x06, 0x87, 0xFF,
+    0xEB, 0x3F, 0xFC, 0xE7, 0x65, 0x98, 0xF0, 0xDF, 0x9F, 0x41, 0x00, 0xC4, 0xE4, 0x66, 0x68, 0xF8,
+    0x6F, 0xCF, 0xC0, 0xF0, 0x7F, 0xFF, 0x87, 0xFF, 0x5C, 0x40, 0xA6, 0x3E, 0x75, 0x98, 0x00, 0xCB,
+    0x04, 0x59, 0x3A, 0x78, 0x9C, 0xFB, 0xF0, 0x5E, 0xE0, 0xE6, 0x7F, 0x6F, 0x86, 0x0F, 0xFF, 0x9F,
+    0xFE, 0xFF, 0xFF, 0x9F, 0xFD, 0xC3, 0x7F, 0x10, 0x90, 0xFF, 0xF0, 0xFF, 0x3C, 0xF3, 0xE5, 0xFF,
+    0xF9, 0x1F, 0xFE, 0xEB, 0x33, 0x24, 0xFC, 0xEF, 0xFF, 0xF0, 0x9F, 0x97, 0xC1, 0x00, 0x44, 0x71,
+    0x33, 0x28, 0x80, 0x28, 0x2E, 0xD2, 0x28, 0x00, 0x25, 0x86, 0x39, 0xF6, 0x78, 0x9C, 0x63, 0x70,
+    0x78, 0xF5, 0xBE, 0x86, 0x91, 0x81, 0xE1, 0xD7, 0xFF, 0xFF, 0xFF, 0xED, 0x18, 0x16, 0x00, 0xC9,
+    0xFF, 0xEF, 0x19, 0x3F, 0xFF, 0xF7, 0x53, 0xF8, 0xF5, 0x9F, 0xF3, 0xC7, 0x7F, 0x56, 0x86, 0x0B,
+    0xFF, 0xF9, 0xFF, 0xFC, 0x67, 0x60, 0x98, 0xF0, 0xDF, 0xFE, 0x2F, 0x90, 0x2A, 0xF8, 0xEF, 0x0F,
+    0xA2, 0x1A, 0xFE, 0xC7, 0xFF, 0xFE, 0xCF, 0x08, 0x12, 0xFC, 0xFE, 0x9F, 0x8D, 0xE1, 0xC1, 0x7F,
+    0xFE, 0x4F, 0xFF, 0xFD, 0x04, 0x7E, 0xFE, 0xE7, 0x6A, 0x00, 0x69, 0xFF, 0xCF, 0xC4, 0xF0, 0x13,
+    0x6C, 0x18, 0x83, 0xC3, 0xAD, 0xFF, 0x3D, 0x8C, 0x0C, 0x00, 0xF9, 0x02, 0x38, 0x4C, 0x78, 0x9C,
+    0x8D, 0x8C, 0xB1, 0x11, 0x40, 0x50, 0x14, 0x04, 0x1F, 0xA1, 0x6F, 0x46, 0x20, 0x21, 0xA2, 0x03,
+    0x3A, 0x53, 0x02, 0x9D, 0x28, 0x41, 0x09, 0x4A, 0x90, 0x49, 0x7F, 0xCA, 0x08, 0x5C, 0x22, 0x5E,
+    0xDF, 0x50, 0x80, 0x4B, 0x76, 0xE6, 0xE6, 0xF6, 0x44, 0xB4, 0x9D, 0xA5, 0x89, 0x15, 0xCE, 0x48,
+    0x3C, 0x71, 0x62, 0x8E, 0x2F, 0x1A, 0x91, 0xD9, 0x40, 0x2F, 0x52, 0x6B, 0x19, 0x45, 0x62, 0x35,
+    0x93, 0x70, 0x2F, 0xBE, 0xB2, 0x0A, 0x93, 0x4E, 0x2C, 0xF9, 0x45, 0xF5, 0xEA, 0x89, 0x38, 0xC0,
+    0x87, 0xB3, 0x72, 0xF7, 0x85, 0x3D, 0x5E, 0xC8, 0x0F, 0xDC, 0x0F, 0x58, 0x4B, 0xC5, 0x78, 0x9C,
+    0x63, 0x58, 0xF4, 0xAF, 0x37, 0xE0, 0x3F, 0x9F, 0xC1, 0xFF, 0xFF, 0xFF, 0xE7, 0xFE, 0xE7, 0xBB,
+    0xF0, 0x1F, 0x04, 0xF8, 0xBE, 0xFE, 0x8F, 0x33, 0xFC, 0xF3, 0x9F, 0xEF, 0xE7, 0x7F, 0x36, 0x86,
+    0x8F, 0xFF, 0xF9, 0xFE, 0xFC, 0x67, 0x64, 0xD8, 0xF0, 0x9F, 0xEF, 0xEF, 0x7F, 0x06, 0x86, 0x09,
+    0x70, 0xEA, 0x0F, 0x90, 0xDA, 0x00, 0x52, 0xC2, 0xC2, 0xF0, 0x00, 0xA4, 0xC1, 0x4E, 0xE0, 0x27,
+    0x5C, 0x3B, 0xC8, 0xB0, 0xD3, 0xFF, 0xF9, 0x18, 0x16, 0xFD, 0xAB, 0xBD, 0x00, 0xA4, 0x80, 0x80,
+    0x38, 0x0A, 0x00, 0x7C, 0x37, 0x47, 0x9D, 0x78, 0x9C, 0xFB, 0xF0, 0x9E, 0xE1, 0xDA, 0xFE, 0x0F,
+    0xFF, 0x17, 0xFE, 0x07, 0x12, 0xBF, 0xFF, 0xAF, 0xFF, 0xF0, 0xFF, 0xFF, 0xBC, 0x88, 0x0F, 0xFF,
+    0xD7, 0x33, 0x30, 0x7C, 0xF8, 0xCF, 0x07, 0x22, 0x78, 0x40, 0x04, 0x17, 0x21, 0x02, 0x00, 0x09,
+    0xDB, 0x24, 0xA4, 0x78, 0x9C, 0x0D, 0x8A, 0xBD, 0x0D, 0x40, 0x00, 0x18, 0x05, 0xCF, 0x4F, 0x30,
+    0x82, 0xD2, 0x1A, 0x36, 0xB0, 0x82, 0x29, 0x2C, 0xA3, 0x35, 0x0B, 0x85, 0x44, 0x21, 0xA1, 0xD3,
+    0x8A, 0x09, 0x54, 0x42, 0xC4, 0x97, 0xE7, 0x7B, 0xCD, 0x25, 0x77, 0x8F, 0x49, 0x6B, 0xC9, 0x21,
+    0x5F, 0xF8, 0x6A, 0xB1, 0x1E, 0x3B, 0x29, 0x2A, 0x3E, 0xA5, 0xC0, 0xA3, 0x33, 0x87, 0xC1, 0x63,
+    0x06, 0x9B, 0xD4, 0xBB, 0x1B, 0xA5, 0xD8, 0x71, 0x2B, 0xAD, 0xE1, 0x52, 0x62, 0xFB, 0x2C, 0x05,
+    0xE6, 0x9F, 0x86, 0xD6, 0xD4, 0x45, 0xFC, 0xC4, 0x1A, 0x2E, 0x32, 0x78, 0x9C, 0x63, 0x48, 0x78,
+    0xC7, 0xC8, 0xC0, 0xC0, 0x70, 0xE1, 0x3F, 0x88, 0xFC, 0x0C, 0x22, 0x03, 0xFE, 0xFD, 0xFF, 0xFF,
+    0x9E, 0xE1, 0xDB, 0x7F, 0x10, 0x79, 0xF4, 0xDF, 0xFF, 0xB3, 0x7B, 0x18, 0x18, 0x7E, 0x81, 0x65,
+    0x89, 0x21, 0x7F, 0xFC, 0x67, 0x77, 0x60, 0x60, 0xF8, 0x0A, 0xD4, 0x0C, 0x32, 0x13, 0x44, 0x0A,
+    0xBC, 0x7C, 0xDF, 0xCB, 0x00, 0x00, 0xF3, 0x24, 0x2C, 0xC3, 0x78, 0x9C, 0xFB, 0xF4, 0x9F, 0x93,
+    0xC1, 0xE1, 0x7F, 0xFD, 0x27, 0xD2, 0x29, 0x2E, 0x86, 0x84, 0xFF, 0xF5, 0x1F, 0xFF, 0xF3, 0x32,
+    0x6C, 0xF8, 0x5F, 0xFF, 0xE1, 0x7F, 0x3E, 0xC3, 0xF7, 0xFF, 0xF5, 0x0B, 0xFE, 0x83, 0x40, 0xBD,
+    0xC2, 0xBF, 0xFF, 0xFF, 0xFB, 0xFF, 0xD4, 0x33, 0x4C, 0xFC, 0xB7, 0x8F, 0xE5, 0x47, 0x3D, 0x00,
+    0x85, 0xF2, 0x39, 0xA0, 0x78, 0x9C, 0x1D, 0xCB, 0xCB, 0x0D, 0x82, 0x00, 0x14, 0x05, 0xD1, 0xC1,
+    0x44, 0x63, 0x34, 0x21, 0x74, 0xA0, 0x1B, 0xEB, 0xB0, 0x04, 0xED, 0xC0, 0xBD, 0x1B, 0xEC, 0x88,
+    0x0A, 0x0C, 0x76, 0x40, 0x09, 0xD0, 0x81, 0x25, 0xF8, 0x21, 0x86, 0x10, 0xC1, 0xF1, 0xE9, 0xE6,
+    0x9E, 0xCD, 0x9D, 0xD1, 0x04, 0x46, 0x93, 0xCE, 0x19, 0x6B, 0x4B, 0x1E, 0x2E, 0x39, 0xB9, 0xE3,
+    0xE2, 0x8A, 0xC6, 0x94, 0xBD, 0x07, 0x9E, 0xCE, 0xE1, 0x53, 0xD1, 0x39, 0x81, 0x5E, 0x86, 0x1A,
+    0x68, 0xDD, 0x98, 0x87, 0x8D, 0xC7, 0xB8, 0x12, 0xD1, 0xD9, 0x45, 0x98, 0x79, 0x75, 0x1A, 0xF2,
+    0xF6, 0xF6, 0x83, 0x97, 0xC5, 0xDF, 0xBB, 0xDB, 0xD8, 0x2F, 0x4D, 0xEB, 0x2E, 0xE5, 0x78, 0x9C,
+    0x0D, 0x8E, 0xBD, 0x0D, 0x82, 0x50, 0x18, 0x45, 0x2F, 0x12, 0x43, 0x0C, 0x0A, 0x23, 0x58, 0x59,
+    0xC3, 0x08, 0x6E, 0x42, 0x6B, 0xC9, 0x08, 0xF6, 0x36, 0x6E, 0xF0, 0xDC, 0x40, 0x16, 0x30, 0x71,
+    0x03, 0xDD, 0x00, 0x0B, 0x7B, 0x84, 0x04, 0xCD, 0x7B, 0xFE, 0x1C, 0xBF, 0xEE, 0x26, 0xF7, 0xE4,
+    0xDC, 0xEB, 0x89, 0xF4, 0x22, 0xD3, 0x81, 0x7C, 0x64, 0xAA, 0x37, 0x85, 0x6E, 0xA4, 0x3D, 0x33,
+    0x41, 0xA5, 0x81, 0xE4, 0xCC, 0xA2, 0x24, 0x38, 0x3D, 0x99, 0x6C, 0x59, 0xD6, 0xDC, 0x5B, 0x85,
+    0x4E, 0x25, 0x55, 0x43, 0x43, 0xF4, 0x73, 0x12, 0xEE, 0xD1, 0xD6, 0xAC, 0x0C, 0x57, 0xB8, 0x0C,
+    0xAE, 0x64, 0x43, 0x2E, 0xE3, 0xC7, 0x4A, 0xEC, 0x98, 0x4B, 0x3D, 0xBE, 0xD0, 0xE7, 0x44, 0x22,
+    0x5D, 0xF9, 0x66, 0xF2, 0x1D, 0xB1, 0xB4, 0x87, 0x54, 0x23, 0x9D, 0xA4, 0x35, 0xD6, 0x0D, 0x1C,
+    0x2D, 0xDA, 0x6C, 0x6C, 0x0F, 0xCC, 0xF5, 0x07, 0x24, 0x63, 0x52, 0x4B, 0x78, 0x9C, 0x15, 0xCB,
+    0xCB, 0x0D, 0x44, 0x60, 0x18, 0x46, 0xE1, 0xF7, 0xB7, 0x98, 0x08, 0x26, 0x51, 0x82, 0xF5, 0x6C,
+    0xE8, 0x80, 0x12, 0x74, 0x30, 0xD3, 0x81, 0x12, 0xB4, 0xA2, 0x02, 0x51, 0xC2, 0x74, 0x40, 0x07,
+    0xA2, 0x02, 0x2B, 0xD7, 0x85, 0xE3, 0xB3, 0x7A, 0x92, 0x93, 0x9C, 0x85, 0xB7, 0x7E, 0xF4, 0x6A,
+    0xA8, 0x35, 0x91, 0x2A, 0x06, 0x77, 0xE0, 0x4B, 0x2B, 0x1F, 0x46, 0x49, 0x1D, 0x23, 0xB9, 0x99,
+    0xC0, 0x93, 0xA5, 0x8D, 0xF9, 0x41, 0x27, 0x78, 0x46, 0x69, 0x3D, 0x32, 0x27, 0x5A, 0x2A, 0xF3,
+    0xE0, 0x75, 0xE1, 0x54, 0xD8, 0xBC, 0x12, 0x6A, 0xB0, 0xF9, 0xCF, 0x57, 0x3B, 0x81, 0x32, 0x66,
+    0x77, 0x03, 0xCA, 0xFA, 0x34, 0xF4, 0x78, 0x9C, 0x25, 0xCD, 0x4D, 0x0D, 0xC2, 0x40, 0x18, 0x84,
+    0xE1, 0xA1, 0x84, 0x84, 0x9F, 0xA4, 0xA9, 0x03, 0x8E, 0x5C, 0x71, 0x40, 0x1D, 0xC0, 0x1D, 0x0B,
+    0x78, 0x28, 0x0E, 0xB0, 0x80, 0x83, 0x45, 0x02, 0x12, 0x40, 0x01, 0x12, 0x08, 0x90, 0xD0, 0x1E,
+    0xCA, 0xBE, 0xCC, 0x6E, 0x4F, 0xCF, 0x1C, 0xE6, 0xFB, 0xA6, 0x67, 0x2C, 0x45, 0x46, 0x5F, 0xA6,
+    0x5A, 0x13, 0xF4, 0xA2, 0xD4, 0x91, 0xAD, 0xCE, 0x6C, 0x74, 0x73, 0xAE, 0x39, 0xE9, 0xCD, 0x4C,
+    0xFA, 0x3D, 0xD4, 0xA5, 0x6E, 0x4B, 0xE1, 0x28, 0x17, 0x57, 0x34, 0xF6, 0xC2, 0x81, 0xA5, 0xDD,
+    0x11, 0x58, 0x58, 0xC5, 0x27, 0x93, 0x64, 0x07, 0x09, 0x5F, 0x87, 0xEC, 0xD5, 0x5F, 0x07, 0xCB,
+    0xEC, 0xC7, 0x8B, 0x52, 0x55, 0x47, 0x8A, 0xDC, 0xF2, 0xD0, 0xE0, 0x3C, 0x79, 0x67, 0x9F, 0x5B,
+    0x7F, 0xB9, 0x9D, 0x3D, 0xF6, 0x78, 0x9C, 0xFB, 0xF0, 0x1F, 0x08, 0xEC, 0x3F, 0x80, 0xC9, 0x03,
+    0x77, 0xEF, 0xFE, 0xFD, 0xAF, 0xCF, 0xC0, 0xC0, 0xF0, 0xFD, 0x3F, 0x3B, 0x03, 0x83, 0xC1, 0xFF,
+    0xF3, 0x40, 0xE6, 0x85, 0xFF, 0xF2, 0x40, 0xF2, 0xE7, 0x7F, 0x56, 0x06, 0x06, 0x87, 0xFF, 0xEB,
+    0x81, 0xCC, 0x87, 0xFF, 0xE5, 0x80, 0xE4, 0xEF, 0xFF, 0x2C, 0x0C, 0x0C, 0x09, 0xFF, 0xFB, 0x81,
+    0xCC, 0x4F, 0xFF, 0xEF, 0xDF, 0xBD, 0x9B, 0xFB, 0x15, 0x64, 0x42, 0x3D, 0x84, 0x04, 0x00, 0xAB,
+    0xD6, 0x2E, 0x91, 0x78, 0x9C, 0x63, 0x60, 0x98, 0xF8, 0x97, 0x97, 0x41, 0xE0, 0xDF, 0x7F, 0x5E,
+    0x86, 0x84, 0xFF, 0xFF, 0xB9, 0x18, 0x0A, 0xFE, 0xCB, 0x31, 0x30, 0x34, 0xFC, 0xE7, 0xC6, 0x20,
+    0x2E, 0x00, 0x25, 0xA7, 0xFC, 0xFB, 0xCF, 0xCA, 0xF0, 0xEB, 0x7F, 0x0C, 0x03, 0x84, 0x98, 0x0A,
+    0xE2, 0x32, 0x5C, 0x04, 0x4A, 0x60, 0xD5, 0x01, 0x36, 0x0A, 0x6C, 0x28, 0xD8, 0x78, 0x86, 0x49,
+    0x7F, 0x79, 0x01, 0xF8, 0xAB, 0x29, 0x30, 0x78, 0x9C, 0xFB, 0x6E, 0xFF, 0x9D, 0x44, 0x08, 0x00,
+    0x0D, 0x54, 0x1E, 0x47, 0x78, 0x9C, 0x7B, 0xDF, 0xC3, 0xC8, 0xC0, 0xF0, 0xFF, 0x3F, 0x2F, 0x03,
+    0xC3, 0xDF, 0xFF, 0xF6, 0x0C, 0x0C, 0x06, 0xFF, 0xE3, 0x19, 0x18, 0x18, 0xFE, 0x61, 0x21, 0xFE,
+    0xAC, 0x07, 0x12, 0xDF, 0xFF, 0xF7, 0x30, 0x33, 0x24, 0xFC, 0xFD, 0xCF, 0xCE, 0x90, 0xF0, 0x07,
+    0x48, 0xFC, 0xF8, 0x3F, 0x97, 0x99, 0xE1, 0xEF, 0x7E, 0x90, 0x92, 0x7C, 0x0C, 0x1D, 0x60, 0xA3,
+    0xFE, 0x80, 0x0C, 0x05, 0x1B, 0xFF, 0x1E, 0x64, 0x11, 0x00, 0x88, 0xBD, 0x26, 0xE0, 0x78, 0x9C,
+    0x63, 0x60, 0x00, 0x83, 0x84, 0xBF, 0x39, 0x0C, 0x0C, 0x06, 0x4C, 0xDF, 0xFE, 0xFF, 0xB7, 0x61,
+    0x78, 0xC4, 0xFC, 0xEF, 0xCC, 0xFF, 0xFF, 0x7B, 0xFF, 0x33, 0xC7, 0x31, 0x2C, 0xFC, 0xFF, 0x7F,
+    0x3F, 0x03, 0x1B, 0x03, 0xC3, 0xE6, 0x77, 0x9C, 0x0C, 0x50, 0x00, 0x00, 0xB8, 0x63, 0x11, 0x04,
+    0x78, 0x9C, 0x63, 0x78, 0x71, 0x9F, 0x8D, 0xE1, 0xC2, 0xFF, 0xFF, 0xF3, 0x19, 0x7E, 0xF4, 0x6F,
+    0xFD, 0xCF, 0xFC, 0x87, 0x93, 0xE1, 0x1F, 0xC7, 0x5F, 0x4E, 0x86, 0xBF, 0x1C, 0x3F, 0x41, 0xDC,
+    0x8B, 0x20, 0x09, 0x81, 0x97, 0x40, 0x25, 0x00, 0xBA, 0x40, 0x15, 0x1A, 0x78, 0x9C, 0x63, 0x60,
+    0x60, 0x60, 0x48, 0xF8, 0xBF, 0x9F, 0x01, 0x0C, 0x3E, 0xFF, 0xE7, 0x02, 0xD3, 0x02, 0xFF, 0xEA,
+    0x21, 0x02, 0x07, 0xDE, 0xB3, 0x30, 0xA0, 0x80, 0xC2, 0xD7, 0xFF, 0xF7, 0xB1, 0x81, 0xB5, 0x00,
+    0x01, 0x48, 0xF2, 0x3B, 0x88, 0xF1, 0x3F, 0x9E, 0xC1, 0xE0, 0xFF, 0xFF, 0x1C, 0xE3, 0x6B, 0xFF,
+    0xFF, 0x33, 0x6D, 0x00, 0x1B, 0xF6, 0xE7, 0x3F, 0xE7, 0xC7, 0xFF, 0xF2, 0x40, 0xC6, 0xA7, 0xFF,
+    0xFC, 0x5F, 0xFF, 0x73, 0x83, 0x8C, 0xFA, 0x6F, 0xFF, 0xFD, 0x3F, 0x07, 0x90, 0x31, 0xE1, 0x7F,
+    0xFC, 0x8F, 0xFF, 0xEC, 0x40, 0x46, 0xC3, 0xFF, 0x7C, 0x38, 0x03, 0x2E, 0xF5, 0x05, 0xA6, 0x18,
+    0xAE, 0x1D, 0x6E, 0x20, 0xDC, 0x0A, 0xB8, 0xA5, 0x08, 0x67, 0xC0, 0x1C, 0x06, 0x00, 0x7D, 0x7F,
+    0x58, 0xCA, 0x78, 0x9C, 0x63, 0x10, 0x60, 0x66, 0x30, 0x62, 0x60, 0x60, 0xF8, 0x32, 0x3F, 0xE0,
+    0x3F, 0x27, 0x03, 0xC3, 0xF7, 0xFB, 0x0D, 0xFF, 0x79, 0x18, 0x18, 0x2E, 0xE5, 0x1B, 0xBC, 0x65,
+    0x65, 0x40, 0x03, 0x53, 0xFE, 0xFC, 0xAF, 0x61, 0x60, 0x28, 0xF8, 0x0F, 0x04, 0x7A, 0x0C, 0x02,
+    0xFF, 0xDF, 0xFF, 0xF9, 0xBF, 0x9F, 0x81, 0x21, 0x9D, 0x91, 0xE1, 0xCF, 0x7F, 0x46, 0x90, 0xF4,
+    0x8F, 0xFF, 0xCC, 0x0C, 0x93, 0xEF, 0xFC, 0xFB, 0xFF, 0x9F, 0x79, 0x01, 0x48, 0xC9, 0x7F, 0xE6,
+    0xEF, 0xFF, 0xFB, 0x4C, 0x7E, 0xFE, 0x67, 0xFE, 0x0B, 0x14, 0x07, 0xCA, 0xFD, 0x7B, 0xCF, 0xC0,
+    0xF0, 0x1B, 0xC4, 0x63, 0x4A, 0x00, 0xCA, 0xFD, 0xFA, 0x7F, 0xFE, 0x2F, 0x90, 0xFA, 0x04, 0x54,
+    0xF7, 0xE4, 0x3F, 0xB3, 0xC2, 0xAB, 0xF7, 0x5A, 0x13, 0xFE, 0x33, 0x03, 0x00, 0x1B, 0x32, 0x44,
+    0x01, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x38, 0xF0, 0x3F, 0x9F, 0x01, 0x08, 0x7E, 0xFC, 0x67, 0x05,
+    0x92, 0x01, 0xFF, 0xED, 0x40, 0x9C, 0x4F, 0xFB, 0x19, 0x19, 0xD0, 0x81, 0xC3, 0xAB, 0xF7, 0x35,
+    0x40, 0xD1, 0x5F, 0xFF, 0xFF, 0x03, 0xD5, 0x2C, 0x00, 0x92, 0xFF, 0xDF, 0x33, 0x7E, 0xFE, 0xEF,
+    0xA7, 0xF0, 0xEB, 0x3F, 0x27, 0x48, 0xEF, 0x85, 0xFF, 0xFC, 0x7F, 0xFE, 0x33, 0x30, 0x4C, 0xF8,
+    0x6F, 0xFF, 0x17, 0x48, 0x15, 0xFC, 0xF7, 0x07, 0x51, 0x0D, 0xFF, 0xE3, 0x7F, 0xFF, 0x67, 0x04,
+    0x09, 0x7E, 0xFF, 0xCF, 0xC6, 0xF0, 0xE0, 0x3F, 0xFF, 0xA7, 0xFF, 0x7E, 0x02, 0x3F, 0xFF, 0x73,
+    0x35, 0x80, 0xB4, 0xFF, 0x67, 0x62, 0xF8, 0x09, 0x36, 0x8C, 0xC1, 0xE1, 0xD6, 0xFF, 0x1E, 0x46,
+    0x06, 0x00, 0xA7, 0x82, 0x3F, 0xB5, 0x78, 0x9C, 0x25, 0xCE, 0xCB, 0x0D, 0x82, 0x50, 0x14, 0x84,
+    0xE1, 0xF1, 0x15, 0x35, 0x2A, 0xD2, 0x80, 0x31, 0xA1, 0x02, 0x63, 0x03, 0xB6, 0xC0, 0xC2, 0x3D,
+    0x74, 0x62, 0x09, 0xDA, 0x81, 0x74, 0x40, 0x0B, 0x76, 0x40, 0x09, 0x12, 0x77, 0xAE, 0x20, 0x46,
+    0x21, 0xC1, 0xC7, 0xEF, 0x7D, 0xCC, 0x66, 0xBE, 0xC5, 0xB9, 0x93, 0x2B, 0xE9, 0xC7, 0x5A, 0x36,
+    0x1B, 0x38, 0x38, 0x9C, 0xA0, 0x70, 0x28, 0xE9, 0xE8, 0x5B, 0x3C, 0xB9, 0x31, 0xB1, 0xE8, 0xAA,
+    0x8C, 0x85, 0x05, 0xE7, 0x98, 0x9D, 0xE9, 0x98, 0x24, 0xE4, 0x68, 0x90, 0xB1, 0xD4, 0xA7, 0x32,
+    0xA8, 0x99, 0xAB, 0x65, 0x28, 0x35, 0x8C, 0xF5, 0x60, 0x2A, 0xBD, 0xB1, 0x09, 0x14, 0xBA, 0x26,
+    0x51, 0xEA, 0x91, 0xEB, 0x42, 0x12, 0x45, 0x5B, 0x30, 0x77, 0x81, 0x5D, 0x67, 0xD4, 0xDA, 0x07,
+    0x7A, 0x31, 0xFB, 0x32, 0x70, 0x63, 0xFE, 0x6F, 0x6A, 0x56, 0xBE, 0x53, 0x7A, 0x1E, 0x65, 0xEE,
+    0x5B, 0xF5, 0x75, 0xEF, 0x91, 0x99, 0x1D, 0x97, 0xF0, 0x5E, 0xE8, 0x0F, 0x96, 0xF2, 0x54, 0x09,
+    0x78, 0x9C, 0x63, 0x98, 0xF2, 0xE7, 0x7F, 0x0D, 0x03, 0x43, 0xC1, 0x7F, 0x20, 0xD0, 0x63, 0x10,
+    0xF8, 0xFF, 0xFE, 0xCF, 0xFF, 0xFD, 0x0C, 0x0C, 0xE9, 0x8C, 0x0C, 0x7F, 0xFE, 0x33, 0x32, 0x00,
+    0xC1, 0x8F, 0xFF, 0xCC, 0x0C, 0x93, 0xEF, 0xFC, 0xFB, 0xFF, 0x9F, 0x79, 0x01, 0x48, 0xC9, 0x7F,
+    0xE6, 0xEF, 0xFF, 0xFB, 0x4C, 0x7E, 0xFE, 0x67, 0xFE, 0x0B, 0x14, 0x07, 0xCA, 0xFD, 0x7B, 0xCF,
+    0xC0, 0xF0, 0x1B, 0xC4, 0x63, 0x4A, 0x00, 0xCA, 0xFD, 0xFA, 0x7F, 0xFE, 0x2F, 0x90, 0xFA, 0x04,
+    0x54, 0xF7, 0xE4, 0x3F, 0xB3, 0xC2, 0xAB, 0xF7, 0x5A, 0x13, 0x80, 0xCA, 0x80, 0xE0, 0x62, 0x3C,
+    0x88, 0x64, 0xF8, 0xCB, 0x01, 0x22, 0x13, 0x20, 0x26, 0x17, 0xFC, 0x77, 0x67, 0x02, 0x52, 0x06,
+    0xFF, 0xFF, 0xB3, 0x81, 0xB8, 0x57, 0xDF, 0xB3, 0x02, 0x00, 0x17, 0x30, 0x44, 0x57, 0x78, 0x9C,
+    0x63, 0x60, 0x60, 0x60, 0xF8, 0xFC, 0x5F, 0x8F, 0x01, 0x04, 0xFE, 0xDE, 0x67, 0x04, 0x51, 0x1B,
+    0xFE, 0x73, 0x81, 0xB9, 0x3F, 0xEA, 0x19, 0x90, 0x41, 0xC2, 0xEB, 0xFF, 0x6B, 0x59, 0x19, 0x18,
+    0x0C, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0x3E, 0x03, 0xC3, 0x57, 0x20, 0xF5, 0xBF, 0x9F, 0x41, 0xE0,
+    0xDF, 0xFF, 0x18, 0xE3, 0x63, 0xFA, 0x0C, 0x0B, 0xFE, 0xEF, 0x07, 0xAA, 0x61, 0x62, 0xF8, 0xF0,
+    0x5F, 0x1E, 0xAC, 0xFA, 0x0B, 0xD4, 0x90, 0xEF, 0xFF, 0xD9, 0x21, 0x86, 0xFD, 0x67, 0x45, 0xA1,
+    0xBF, 0xFF, 0x67, 0x03, 0xD3, 0x5F, 0xFF, 0x73, 0x82, 0xE9, 0x8F, 0xFF, 0xF9, 0xC0, 0xF4, 0x81,
+    0xFF, 0xF3, 0xC1, 0xB4, 0xC3, 0xFF, 0xFF, 0xD1, 0x46, 0xAD, 0xB1, 0x0C, 0x0C, 0x3F, 0x41, 0xF6,
+    0xE4, 0x33, 0x30, 0x34, 0x40, 0x69, 0x86, 0xA6, 0x37, 0xEF, 0x81, 0xEE, 0x00, 0x00, 0x8D, 0x42,
+    0x3E, 0x05, 0x78, 0x9C, 0x63, 0x60, 0x60, 0xF8, 0xF8, 0xDF, 0x9E, 0x81, 0x81, 0xE1, 0xCF, 0x7D,
+    0x26, 0x06, 0x86, 0x09, 0xFF, 0xA5, 0x81, 0xCC, 0x6F, 0xFD, 0x0C, 0xA8, 0xC0, 0xE1, 0xD5, 0xFB,
+    0xB9, 0x2C, 0x0C, 0xBF, 0xFF, 0xFF, 0xFF, 0xCF, 0xBB, 0x00, 0x48, 0xFC, 0x67, 0xFF, 0xFC, 0x3F,
+    0x5E, 0x70, 0x09, 0xE3, 0x8F, 0xFF, 0x6C, 0x20, 0x8D, 0xFF, 0x19, 0x81, 0xE4, 0xDF, 0xFF, 0x0C,
+    0x70, 0x12, 0x22, 0xF2, 0x13, 0x2C, 0xFB, 0x15, 0xA8, 0x72, 0x32, 0xE7, 0x01, 0x90, 0x2E, 0x2E,
+    0x85, 0xBF, 0x20, 0x92, 0xA1, 0xE0, 0xCD, 0xFF, 0x5E, 0x46, 0x00, 0xFA, 0x82, 0x30, 0x63, 0x78,
+    0x9C, 0xFB, 0xF3, 0x1F, 0x08, 0x38, 0xFE, 0xA0, 0x90, 0x82, 0x82, 0x82, 0x0C, 0x7F, 0xFE, 0x33,
+    0x00, 0x01, 0x2A, 0x09, 0x04, 0x8C, 0xA8, 0x24, 0x2E, 0x95, 0x4A, 0x4A, 0x4A, 0x8C, 0x7F, 0x30,
+    0x4C, 0x06, 0x4A, 0x7D, 0x93, 0x05, 0x12, 0x01, 0xFF, 0x19, 0x81, 0xE4, 0x85, 0xF5, 0x20, 0xB5,
+    0x0F, 0xEE, 0x87, 0x00, 0xC9, 0x05, 0xFF, 0x41, 0x1A, 0x05, 0x5E, 0x9E, 0x67, 0x00, 0x00, 0x66,
+    0x93, 0x49, 0xE7, 0x78, 0x9C, 0x63, 0x08, 0x78, 0xFD, 0xBE, 0x86, 0x81, 0x81, 0xE1, 0xF7, 0xFF,
+    0xFF, 0xFF, 0x75, 0x19, 0x16, 0xFC, 0xBF, 0x7F, 0xFA, 0xFF, 0x7D, 0x86, 0x4F, 0xFF, 0x39, 0x19,
+    0xBE, 0xFD, 0x67, 0xFD, 0xF1, 0x9F, 0x91, 0xE1, 0xC1, 0x7F, 0x4E, 0x90, 0xD4, 0xFF, 0xFF, 0x5C,
+    0x7F, 0xC1, 0x14, 0xF7, 0xDF, 0xFF, 0xE5, 0x40, 0xC0, 0xFA, 0x07, 0x28, 0x07, 0x04, 0x3F, 0xFE,
+    0xB3, 0x81, 0xA8, 0xCF, 0xFF, 0xFD, 0x18, 0x18, 0xB6, 0x32, 0x4C, 0xF8, 0xFF, 0xFF, 0xDC, 0xDF,
+    0xF7, 0x0C, 0x0C, 0x3F, 0x81, 0x0A, 0x81, 0x94, 0xC1, 0xAD, 0xFF, 0xE7, 0x2D, 0x41, 0xD2, 0x0E,
+    0xEF, 0x99, 0x40, 0xD4, 0x17, 0x7B, 0x10, 0xC9, 0xF0, 0x9B, 0x07, 0x4C, 0xFD, 0x89, 0x63, 0x85,
+    0x98, 0x20, 0x0F, 0xA2, 0x1A, 0xFE, 0xC9, 0x32, 0x00, 0x00, 0xEE, 0x72, 0x40, 0x4E, 0x78, 0x9C,
+    0x63, 0xF8, 0xF3, 0x9F, 0x01, 0x04, 0xF0, 0x53, 0x8D, 0x10, 0xEA, 0x1F, 0x07, 0x98, 0xFA, 0xCF,
+    0x07, 0xA6, 0xF6, 0x33, 0x31, 0x30, 0x5C, 0xFE, 0xFF, 0x9F, 0x15, 0xC8, 0xF9, 0xFD, 0x1F, 0xAC,
+    0xF2, 0x13, 0x84, 0x32, 0x40, 0xD7, 0xAE, 0xA4, 0xA4, 0xC4, 0x04, 0xD2, 0xF7, 0xFF, 0xBF, 0x3F,
+    0x2A, 0x05, 0x00, 0x1C, 0x85, 0x34, 0x46, 0x78, 0x9C, 0x63, 0xF8, 0xF3, 0x9F, 0x81, 0x81, 0x81,
+    0x10, 0xA1, 0x0D, 0x22, 0xF6, 0x83, 0x88, 0xFB, 0x8C, 0x09, 0xFF, 0xFF, 0x73, 0x30, 0xFC, 0xFE,
+    0x0F, 0x94, 0xF8, 0x0E, 0x22, 0x36, 0xFC, 0xC3, 0xA7, 0x17, 0x00, 0xEC, 0x90, 0x2A, 0x81, 0x78,
+    0x9C, 0x4D, 0xCD, 0xC1, 0x0D, 0x83, 0x30, 0x0C, 0x05, 0xD0, 0x4F, 0x2F, 0x39, 0x30, 0x04, 0x19,
+    0xA1, 0x13, 0x74, 0x05, 0x46, 0x60, 0x05, 0x36, 0x60, 0x84, 0x8E, 0x90, 0x11, 0xCA, 0x46, 0xA8,
+    0x23, 0x20, 0x02, 0x08, 0x29, 0xE9, 0xAF, 0x1D, 0x37, 0x52, 0x7D, 0xB0, 0xDF, 0xC1, 0xFA, 0x1F,
+    0x00, 0x4E, 0xB6, 0xD0, 0xB9, 0x33, 0x94, 0x8B, 0x37, 0x9D, 0x21, 0x3D, 0xF0, 0x3F, 0x89, 0xBD,
+    0xEC, 0x9D, 0x4D, 0xE2, 0x52, 0xA1, 0xAF, 0x86, 0xCE, 0xB0, 0x68, 0x8A, 0x62, 0xCA, 0xBC, 0x15,
+    0x3C, 0xA3, 0x14, 0x28, 0xC2, 0xCC, 0xC1, 0xE0, 0x25, 0xA0, 0x00, 0x17, 0x5D, 0x14, 0xBC, 0xA4,
+    0xB4, 0x33, 0x8C, 0x0C, 0x5B, 0x01, 0x32, 0x0F, 0x43, 0xE4, 0xC7, 0x30, 0x93, 0x06, 0x5F, 0x21,
+    0x01, 0x3F, 0xAC, 0x82, 0x2F, 0x1E, 0x7B, 0x64, 0xFA, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x08, 0xF8,
+    0x7F, 0x9E, 0x01, 0x08, 0x3E, 0xFD, 0xE7, 0x06, 0x51, 0x7F, 0xFB, 0x41, 0xE4, 0x82, 0xFF, 0xAC,
+    0x0C, 0x68, 0xE0, 0xC3, 0x7B, 0x81, 0x9B, 0xFF, 0xBD, 0x19, 0x3E, 0xFC, 0x7F, 0xFA, 0xFF, 0xFF,
+    0x7F, 0xF6, 0x0F, 0xFF, 0x41, 0x40, 0xFE, 0xC3, 0xFF, 0xF3, 0xCC, 0x97, 0xFF, 0xE7, 0x7F, 0xF8,
+    0xAF, 0xCF, 0x90, 0xF0, 0xBF, 0xFF, 0xC3, 0x7F, 0x5E, 0x06, 0x03, 0x10, 0xC5, 0xCD, 0xA0, 0x00,
+    0xA2, 0xB8, 0x48, 0xA3, 0x00, 0xC2, 0xD1, 0x41, 0x40, 0x78, 0x9C, 0x63, 0x60, 0x60, 0xF8, 0xFE,
+    0x9F, 0x9B, 0x81, 0xC1, 0xE0, 0xFF, 0x7C, 0x06, 0x06, 0x86, 0x87, 0xFF, 0xD9, 0x81, 0xE4, 0x1F,
+    0x3B, 0x06, 0x18, 0x68, 0xFC, 0xF3, 0xBE, 0x87, 0xD9, 0xE0, 0xDF, 0xFF, 0xFF, 0xFF, 0xEB, 0x1F,
+    0x02, 0x89, 0xFF, 0xFA, 0xDF, 0xFE, 0xFB, 0x04, 0xDF, 0xE0, 0xF9, 0xF9, 0x9F, 0x09, 0x28, 0xF9,
+    0xF3, 0x3F, 0x33, 0x90, 0xFC, 0xF6, 0xDF, 0x0F, 0x48, 0x3E, 0xF8, 0xFF, 0xDF, 0x87, 0x81, 0x41,
+    0x01, 0xA8, 0xD2, 0x86, 0x81, 0x61, 0x22, 0x50, 0x25, 0x2B, 0x03, 0xC3, 0x24, 0xA0, 0x7A, 0xA0,
+    0xD4, 0xA1, 0xFF, 0xFD, 0x40, 0x52, 0xE0, 0xFF, 0x7E, 0x51, 0x20, 0xF5, 0x7F, 0xFF, 0xDF, 0x2C,
+    0xE5, 0x2D, 0xFF, 0xFB, 0xFF, 0x82, 0x4C, 0x93, 0x03, 0x91, 0xEF, 0x99, 0x0B, 0x5F, 0xFF, 0xDF,
+    0xC7, 0xCE, 0x00, 0x00, 0xC9, 0xFB, 0x41, 0x06, 0x78, 0x9C, 0x63, 0x60, 0x70, 0xF8, 0x7F, 0x9F,
+    0x91, 0x81, 0xE1, 0xE1, 0x7F, 0x69, 0x06, 0x06, 0x86, 0x3F, 0xF3, 0x81, 0xC4, 0x82, 0xFF, 0xAC,
+    0x0C, 0xA8, 0xE0, 0xF8, 0xFF, 0xF3, 0x96, 0x40, 0x15, 0x40, 0xC0, 0xF4, 0xEB, 0xFF, 0xB9, 0xBF,
+    0xFB, 0x19, 0xFE, 0xBE, 0x67, 0x50, 0xF0, 0x60, 0xF8, 0xF3, 0x9F, 0x1D, 0x28, 0xF9, 0xE3, 0xFF,
+    0x7B, 0x09, 0x06, 0x86, 0x03, 0x40, 0x49, 0x0E, 0x06, 0x86, 0x6B, 0xFF, 0xFF, 0xEF, 0x07, 0x8A,
+    0x1D, 0xF9, 0xFF, 0x9F, 0x05, 0x48, 0x7D, 0xFF, 0xCF, 0x1E, 0xC9, 0xC0, 0xF0, 0xF5, 0x3F, 0xDB,
+    0xDF, 0xFB, 0xA7, 0xFF, 0xFF, 0x67, 0xFC, 0x0B, 0x54, 0x93, 0xCF, 0x30, 0xE5, 0xEF, 0xFF, 0xB9,
+    0xCC, 0x0C, 0x00, 0xE6, 0xCA, 0x35, 0x8B, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x28, 0xF8, 0xBF, 0x9F,
+    0x01, 0x08, 0x3E, 0xFF, 0xE7, 0x04, 0x92, 0x02, 0xFF, 0xEA, 0x41, 0x9C, 0x03, 0xEF, 0x99, 0x19,
+    0x60, 0xE0, 0xD3, 0x7F, 0x10, 0x58, 0x8F, 0x42, 0xF5, 0x2B, 0x28, 0x29, 0x29, 0x7D, 0xF9, 0xCF,
+    0x0B, 0x92, 0xFF, 0xF3, 0x1F, 0xA4, 0xB6, 0xE0, 0x7F, 0x3F, 0xC4, 0x14, 0xB0, 0xD8, 0x5F, 0xB0,
+    0x58, 0xC3, 0xFF, 0x7A, 0x88, 0x18, 0x0F, 0x44, 0x8C, 0x09, 0x48, 0x4E, 0xF8, 0x9F, 0x0F, 0xE2,
+    0x7C, 0xF9, 0xCF, 0x0D, 0xB6, 0xED, 0x3F, 0x23, 0x90, 0x5A, 0xF0, 0xBF, 0x1E, 0x68, 0x9C, 0xD0,
+    0x17, 0xB0, 0xD1, 0xEF, 0xBF, 0xA1, 0x50, 0x00, 0x57, 0xA3, 0x48, 0xD5, 0x78, 0x9C, 0x63, 0x60,
+    0x60, 0xF8, 0xFC, 0x5F, 0x8F, 0x81, 0x81, 0xE1, 0xEF, 0x7D, 0x46, 0x06, 0x86, 0x0D, 0xFF, 0xB9,
+    0x80, 0xCC, 0x1F, 0xF5, 0x0C, 0x28, 0xE0, 0xC3, 0x7F, 0x20, 0xB0, 0x87, 0x90, 0x07, 0xEE, 0xDE,
+    0xFD, 0xFB, 0x5F, 0x1F, 0x28, 0xF8, 0xFD, 0x3F, 0x3B, 0x03, 0x83, 0xC1, 0xFF, 0xF3, 0x40, 0xE6,
+    0x85, 0xFF, 0xF2, 0x40, 0xF2, 0xE7, 0x7F, 0x56, 0x06, 0x06, 0x87, 0xFF, 0xEB, 0x81, 0xCC, 0x87,
+    0xFF, 0xE5, 0x80, 0xE4, 0xEF, 0xFF, 0x2C, 0x0C, 0x0C, 0x09, 0xFF, 0xFB, 0x81, 0xCC, 0x4F, 0xFF,
+    0xEF, 0xDF, 0xBD, 0x9B, 0xFB, 0x15, 0x64, 0x42, 0x3D, 0x84, 0x04, 0x00, 0xB8, 0xE2, 0x35, 0xBE,
+    0x78, 0x9C, 0x63, 0x60, 0x10, 0x98, 0xC1, 0xC2, 0x00, 0x04, 0x0B, 0xFE, 0xCB, 0x83, 0xA8, 0x0D,
+    0xFF, 0xED, 0x41, 0x94, 0xC3, 0x3F, 0x4E, 0x06, 0x18, 0xF8, 0xF4, 0x1F, 0x04, 0xD6, 0xA3, 0x50,
+    0xFD, 0x0A, 0x4A, 0x4A, 0x4A, 0x5F, 0xFE, 0xF3, 0x82, 0xE4, 0xFF, 0xFC, 0x67, 0x06, 0x92, 0x05,
+    0xFF, 0xFB, 0x41, 0x9C, 0xCF, 0x10, 0xB1, 0xBF, 0x60, 0xB1, 0x86, 0xFF, 0xF5, 0x10, 0x31, 0x1E,
+    0x88, 0x18, 0x13, 0x90, 0x9C, 0xF0, 0x3F, 0x1F, 0xC4, 0xF9, 0xF2, 0x9F, 0x1B, 0x48, 0x0A, 0xFC,
+    0xFB, 0xCF, 0x08, 0xB6, 0xBB, 0x1E, 0x68, 0x9C, 0xD0, 0x17, 0xB0, 0xD1, 0xEF, 0xBF, 0xA1, 0x50,
+    0x00, 0x47, 0x1F, 0x47, 0x0C, 0x78, 0x9C, 0x63, 0x60, 0x98, 0x64, 0xC9, 0x00, 0x04, 0x7F, 0xDF,
+    0x83, 0xC8, 0x7F, 0xFF, 0x41, 0xE4, 0xB3, 0x3A, 0x06, 0x14, 0xF0, 0xE1, 0x3F, 0x10, 0xD8, 0x43,
+    0xC8, 0x03, 0x77, 0xEF, 0xFE, 0xFD, 0xAF, 0x0F, 0x14, 0xFC, 0xFE, 0x9F, 0x9D, 0x81, 0xC1, 0xE0,
+    0xFF, 0x79, 0x20, 0xF3, 0xC2, 0x7F, 0x79, 0x20, 0xF9, 0xF3, 0x3F, 0x2B, 0x03, 0x83, 0xC3, 0xFF,
+    0xF5, 0x40, 0xE6, 0xC3, 0xFF, 0x72, 0x40, 0xF2, 0xF7, 0x7F, 0x16, 0x06, 0x86, 0x84, 0xFF, 0xFD,
+    0x40, 0xE6, 0xA7, 0xFF, 0xF7, 0xEF, 0xDE, 0xCD, 0xFD, 0x0A, 0x32, 0xA1, 0x1E, 0x42, 0x02, 0x00,
+    0x3C, 0x26, 0x34, 0xA9,
+};
+const GFXglyph OpenSans12BGlyphs[] = {
+    { 0, 0, 7, 0, 0, 8, 0 }, //  
+    { 5, 18, 7, 1, 18, 59, 8 }, // !
+    { 10, 6, 12, 1, 18, 41, 67 }, // "
+    { 16, 18, 16, 0, 18, 122, 108 }, // #
+    { 13, 20, 14, 1, 19, 109, 230 }, // $
+    { 22, 18, 23, 0, 18, 165, 339 }, // %
+    { 18, 18, 19, 1, 18, 138, 504 }, // &
+    { 5, 6, 7, 1, 18, 27, 642 }, // '
+    { 7, 22, 8, 1, 18, 80, 669 }, // (
+    { 8, 22, 8, 0, 18, 81, 749 }, // )
+    { 13, 13, 14, 0, 19, 90, 830 }, // *
+    { 13, 13, 14, 1, 15, 40, 920 }, // +
+    { 6, 6, 7, 0, 3, 27, 960 }, // ,
+    { 8, 4, 8, 0, 8, 19, 987 }, // -
+    { 5, 5, 7, 1, 5, 24, 1006 }, // .
+    { 11, 18, 10, 0, 18, 91, 1030 }, // /
+    { 14, 18, 14, 0, 18, 109, 1121 }, // 0
+    { 10, 18, 14, 1, 18, 45, 1230 }, // 1
+    { 14, 18, 14, 0, 18, 95, 1275 }, // 2
+    { 14, 18, 14, 0, 18, 107, 1370 }, // 3
+    { 14, 18, 14, 0, 18, 76, 1477 }, // 4
+    { 13, 18, 14, 1, 18, 98, 1553 }, // 5
+    { 14, 18, 14, 0, 18, 126, 1651 }, // 6
+    { 14, 18, 14, 0, 18, 91, 1777 }, // 7
+    { 14, 18, 14, 0, 18, 125, 1868 }, // 8
+    { 14, 18, 14, 0, 18, 121, 1993 }, // 9
+    { 5, 14, 7, 1, 14, 36, 2114 }, // :
+    { 6, 17, 7, 0, 14, 44, 2150 }, // ;
+    { 13, 14, 14, 1, 16, 74, 2194 }, // <
+    { 13, 7, 14, 1, 13, 27, 2268 }, // =
+    { 13, 14, 14, 1, 16, 70, 2295 }, // >
+    { 12, 18, 12, 0, 18, 90, 2365 }, // ?
+    { 21, 20, 22, 1, 18, 198, 2455 }, // @
+    { 18, 18, 17, 0, 18, 130, 2653 }, // A
+    { 14, 18, 17, 2, 18, 92, 2783 }, // B
+    { 15, 18, 16, 1, 18, 113, 2875 }, // C
+    { 16, 18, 19, 2, 18, 98, 2988 }, // D
+    { 11, 18, 14, 2, 18, 40, 3086 }, // E
+    { 11, 18, 14, 2, 18, 33, 3126 }, // F
+    { 16, 18, 18, 1, 18, 122, 3159 }, // G
+    { 15, 18, 19, 2, 18, 31, 3281 }, // H
+    { 5, 18, 8, 2, 18, 14, 3312 }, // I
+    { 9, 23, 8, -2, 18, 40, 3326 }, // J
+    { 15, 18, 17, 2, 18, 96, 3366 }, // K
+    { 12, 18, 14, 2, 18, 26, 3462 }, // L
+    { 20, 18, 24, 2, 18, 132, 3488 }, // M
+    { 17, 18, 20, 2, 18, 96, 3620 }, // N
+    { 18, 18, 20, 1, 18, 102, 3716 }, // O
+    { 13, 18, 16, 2, 18, 70, 3818 }, // P
+    { 18, 22, 20, 1, 18, 131, 3888 }, // Q
+    { 15, 18, 17, 2, 18, 97, 4019 }, // R
+    { 12, 18, 14, 1, 18, 105, 4116 }, // S
+    { 14, 18, 14, 0, 18, 31, 4221 }, // T
+    { 15, 18, 19, 2, 18, 66, 4252 }, // U
+    { 17, 18, 16, 0, 18, 130, 4318 }, // V
+    { 25, 18, 24, 0, 18, 173, 4448 }, // W
+    { 17, 18, 17, 0, 18, 132, 4621 }, // X
+    { 16, 18, 16, 0, 18, 93, 4753 }, // Y
+    { 14, 18, 14, 0, 18, 82, 4846 }, // Z
+    { 7, 22, 8, 1, 18, 27, 4928 }, // [
+    { 11, 18, 10, 0, 18, 89, 4955 }, // '\\'
+    { 7, 22, 8, 0, 18, 28, 5044 }, // ]
+    { 14, 12, 13, 0, 18, 78, 5072 }, // ^
+    { 12, 2, 10, -1, -2, 17, 5150 }, // _
+    { 8, 4, 15, 4, 19, 24, 5167 }, // `
+    { 13, 14, 15, 1, 14, 98, 5191 }, // a
+    { 14, 19, 16, 1, 19, 94, 5289 }, // b
+    { 12, 14, 13, 1, 14, 72, 5383 }, // c
+    { 13, 19, 16, 1, 19, 94, 5455 }, // d
+    { 13, 14, 15, 1, 14, 92, 5549 }, // e
+    { 11, 19, 10, 0, 19, 57, 5641 }, // f
+    { 14, 20, 14, 0, 14, 133, 5698 }, // g
+    { 14, 19, 16, 1, 19, 62, 5831 }, // h
+    { 5, 19, 8, 1, 19, 29, 5893 }, // i
+    { 8, 25, 8, -2, 19, 50, 5922 }, // j
+    { 15, 19, 16, 1, 19, 90, 5972 }, // k
+    { 5, 19, 8, 1, 19, 14, 6062 }, // l
+    { 22, 14, 25, 1, 14, 87, 6076 }, // m
+    { 14, 14, 16, 1, 14, 57, 6163 }, // n
+    { 14, 14, 15, 1, 14, 98, 6220 }, // o
+    { 14, 20, 16, 1, 14, 96, 6318 }, // p
+    { 13, 20, 16, 1, 14, 89, 6414 }, // q
+    { 10, 14, 11, 1, 14, 44, 6503 }, // r
+    { 11, 14, 12, 1, 14, 88, 6547 }, // s
+    { 11, 17, 11, 0, 17, 63, 6635 }, // t
+    { 14, 14, 16, 1, 14, 58, 6698 }, // u
+    { 15, 14, 14, 0, 14, 106, 6756 }, // v
+    { 22, 14, 21, 0, 14, 142, 6862 }, // w
+    { 15, 14, 14, 0, 14, 106, 7004 }, // x
+    { 15, 20, 14, 0, 14, 127, 7110 }, // y
+    { 12, 14, 12, 0, 14, 78, 7237 }, // z
+    { 9, 22, 10, 0, 18, 68, 7315 }, // {
+    { 4, 25, 14, 5, 19, 13, 7383 }, // |
+    { 9, 22, 10, 1, 18, 74, 7396 }, // }
+    { 13, 7, 14, 1, 12, 50, 7470 }, // ~
+    { 9, 8, 11, 1, 18, 44, 7520 }, // °
+    { 18, 23, 20, 1, 23, 118, 7564 }, // Ó
+    { 13, 20, 15, 1, 20, 127, 7682 }, // ä
+    { 14, 20, 15, 1, 20, 117, 7809 }, // ó
+    { 18, 24, 17, 0, 18, 154, 7926 }, // Ą
+    { 13, 20, 15, 1, 14, 126, 8080 }, // ą
+    { 15, 23, 16, 1, 23, 132, 8206 }, // Ć
+    { 12, 20, 13, 1, 20, 93, 8338 }, // ć
+    { 11, 24, 14, 2, 18, 68, 8431 }, // Ę
+    { 13, 20, 15, 1, 14, 123, 8499 }, // ę
+    { 14, 18, 14, 0, 18, 57, 8622 }, // Ł
+    { 9, 19, 8, 0, 19, 40, 8679 }, // ł
+    { 17, 23, 20, 2, 23, 122, 8719 }, // Ń
+    { 14, 20, 16, 1, 20, 80, 8841 }, // ń
+    { 12, 23, 14, 1, 23, 127, 8921 }, // Ś
+    { 11, 20, 12, 1, 20, 111, 9048 }, // ś
+    { 14, 23, 14, 0, 23, 101, 9159 }, // Ź
+    { 12, 20, 12, 0, 20, 100, 9260 }, // ź
+    { 14, 23, 14, 0, 23, 101, 9360 }, // Ż
+    { 12, 20, 12, 0, 20, 95, 9461 }, // ż
+};
+const UnicodeInterval OpenSans12BIntervals[] = {
+    { 0x20, 0x7E, 0x0 },
+    { 0xB0, 0xB0, 0x5F },
+    { 0xD3, 0xD3, 0x60 },
+    { 0xE4, 0xE4, 0x61 },
+    { 0xF3, 0xF3, 0x62 },
+    { 0x104, 0x107, 0x63 },
+    { 0x118, 0x119, 0x67 },
+    { 0x141, 0x144, 0x69 },
+    { 0x15A, 0x15B, 0x6D },
+    { 0x179, 0x17C, 0x6F },
+};
+const GFXfont OpenSans12B = {
+    (uint8_t*)OpenSans12BBitmaps,
+    (GFXglyph*)OpenSans12BGlyphs,
+    (UnicodeInterval*)OpenSans12BIntervals,
+    10,
+    1,
+    34,
+    27,
+    -8,
+};
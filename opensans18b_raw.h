@@ -0,0 +1,3408 @@
+#pragma once
+// Generated by tools/fontencode.py raw from opensans18b.h, do not edit
+#include "epd_driver.h"
+const uint8_t OpenSans18BBitmaps[51124] = {
+    0xFB, 0xFF, 0xFF, 0x0A, 0xFA, 0xFF, 0xFF, 0x09, 0xF9, 0xFF, 0xFF, 0x08, 0xF9, 0xFF, 0xFF, 0x07,
+    0xF8, 0xFF, 0xFF, 0x06, 0xF7, 0xFF, 0xFF, 0x05, 0xF6, 0xFF, 0xFF, 0x05, 0xF5, 0xFF, 0xFF, 0x04,
+    0xF4, 0xFF, 0xFF, 0x03, 0xF3, 0xFF, 0xFF, 0x02, 0xF2, 0xFF, 0xFF, 0x01, 0xF2, 0xFF, 0xFF, 0x00,
+    0xF1, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xEF, 0x00, 0xF0, 0xFF, 0xEF, 0x00, 0xE0, 0xFF, 0xDF, 0x00,
+    0xD0, 0xFF, 0xCF, 0x00, 0x60, 0x88, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x42, 0x02, 0x00, 0xC1, 0xFF, 0xAF, 0x00, 0xF9, 0xFF, 0xFF, 0x06, 0xFC, 0xFF, 0xFF, 0x09,
+    0xFB, 0xFF, 0xFF, 0x09, 0xF6, 0xFF, 0xFF, 0x03, 0x70, 0xFD, 0x5D, 0x00, 0xF7, 0xFF, 0x9F, 0x00,
+    0xFA, 0xFF, 0x6F, 0xF6, 0xFF, 0x8F, 0x00, 0xF9, 0xFF, 0x5F, 0xF5, 0xFF, 0x7F, 0x00, 0xF8, 0xFF,
+    0x4F, 0xF4, 0xFF, 0x5F, 0x00, 0xF7, 0xFF, 0x3F, 0xF3, 0xFF, 0x4F, 0x00, 0xF5, 0xFF, 0x1F, 0xF1,
+    0xFF, 0x3F, 0x00, 0xF4, 0xFF, 0x0F, 0xF0, 0xFF, 0x2F, 0x00, 0xF3, 0xFF, 0x0F, 0xF0, 0xFF, 0x1F,
+    0x00, 0xF2, 0xFF, 0x0E, 0xE0, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0x0D, 0xC0, 0xFF, 0x0E, 0x00, 0xF0,
+    0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0E, 0x00, 0xF6, 0xFF, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0x0C, 0x00, 0xF8, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0x09, 0x00, 0xFB, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x06, 0x00, 0xFE, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x03, 0x10, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x40, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xDF,
+    0x00, 0x70, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xAF, 0x00, 0xA0, 0xFF, 0x5F,
+    0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xEB, 0xEE, 0xFE, 0xFF, 0xEF, 0xEE, 0xFE, 0xFF, 0xEF,
+    0xEE, 0xAE, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0B, 0x00, 0xF9, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0x08, 0x00, 0xFD, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x05,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x40, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF2, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xD2, 0xDD, 0xFD, 0xFF, 0xDF, 0xDD, 0xFD, 0xFF, 0xDF, 0xDD,
+    0xDD, 0x06, 0x00, 0x00, 0xE0, 0xFF, 0x2F, 0x00, 0xF4, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0x0F, 0x00, 0xF7, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0C, 0x00,
+    0xFA, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00, 0xFD, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x05, 0x10, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0x02, 0x40, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x70,
+    0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x2F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xC9, 0xFE, 0xFF, 0xCE, 0x69, 0x02, 0x00, 0x00, 0x50,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x05, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x07, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0xFF,
+    0xFD, 0xBF, 0xFD, 0xFF, 0xBF, 0x00, 0xF3, 0xFF, 0xFF, 0x0A, 0xF6, 0x2F, 0x00, 0x83, 0x4D, 0x00,
+    0xF5, 0xFF, 0xFF, 0x04, 0xF6, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x08, 0xF6, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xAF, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0x29, 0x00,
+    0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x6F,
+    0xFC, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x2F, 0xA0, 0xFF, 0xFF, 0x3F, 0x11, 0x00,
+    0x00, 0x00, 0xF6, 0x2F, 0x60, 0xFF, 0xFF, 0x3F, 0xF5, 0x6B, 0x01, 0x00, 0xF6, 0x2F, 0xB0, 0xFF,
+    0xFF, 0x1F, 0xF5, 0xFF, 0xDF, 0x7A, 0xFA, 0xAF, 0xFE, 0xFF, 0xFF, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00,
+    0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x51, 0xB9, 0xED, 0xFF, 0xEF,
+    0x8B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xEB, 0xEF,
+    0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x90, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0x8F, 0x60, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xF2, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xFE, 0xFF, 0x0C, 0x00, 0x00, 0xFB, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0xFF, 0x0F, 0x00, 0xFB, 0xFF, 0x0E, 0x00, 0x30, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0D, 0x00, 0xFA, 0xFF, 0x0F, 0x00, 0xC0, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x0D, 0x00, 0xF9, 0xFF, 0x0F, 0x00, 0xF5, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0D, 0x00, 0xFA, 0xFF, 0x0F, 0x00, 0xFE, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x0F, 0x00, 0xFB, 0xFF, 0x0E, 0x70, 0xFF, 0xEF,
+    0x00, 0xB4, 0xFE, 0xBE, 0x05, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xFE, 0xFF, 0x0C, 0xF1, 0xFF,
+    0x6F, 0x90, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF4, 0xFF, 0x8F, 0x50, 0xFF, 0xFF, 0x08, 0xF9,
+    0xFF, 0x0D, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xE0, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x22,
+    0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xB0, 0xFF, 0xBF, 0x50, 0xFF, 0xFF, 0x09, 0xF6, 0xFF, 0x8F, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF,
+    0x0B, 0xF4, 0xFF, 0x3F, 0x80, 0xFF, 0xFF, 0x02, 0xE0, 0xFF, 0xCF, 0x00, 0x00, 0x30, 0xEA, 0xEF,
+    0x5B, 0x00, 0xFC, 0xFF, 0x0A, 0xB0, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xDF, 0x00, 0xA0, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0x8F, 0x00, 0xD0, 0xFF, 0xDF, 0x00, 0x90, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x0E, 0x00, 0xC0, 0xFF, 0xDF, 0x00, 0xA0, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x06, 0x00, 0xB0, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDF, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0xE0, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x4F, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x08, 0xF5,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xDF,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF5, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA3, 0xFE, 0xBE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xEC, 0xFF, 0xAD, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xD0, 0xFF, 0xFF, 0x9F, 0x86, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0x06, 0x00, 0xF2, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x01,
+    0x00, 0xE0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0x00, 0xF1,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x09, 0x00, 0xFB, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x3F, 0xC2, 0xFF, 0xFF, 0x5F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFD,
+    0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x03, 0x00, 0xF5, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x5F, 0x00, 0x60, 0xFF, 0xFF, 0x8F, 0x00, 0xC0, 0xFF, 0xFF, 0xDF, 0x82, 0xFF, 0xFF, 0xFF, 0x07,
+    0xD0, 0xFF, 0xFF, 0x1F, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0xF6, 0xFF, 0xFF, 0x8F, 0xF7, 0xFF,
+    0xFF, 0x0A, 0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
+    0x00, 0xF7, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xF6,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0xBF, 0x03, 0x00, 0x30, 0xF9, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xEF,
+    0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xE2, 0xFF,
+    0xFF, 0xCF, 0x01, 0x00, 0x00, 0x30, 0xB8, 0xFE, 0xEF, 0xAD, 0x27, 0x00, 0x20, 0xFE, 0xFF, 0xFF,
+    0x1D, 0xF7, 0xFF, 0x9F, 0xF6, 0xFF, 0x8F, 0xF5, 0xFF, 0x7F, 0xF4, 0xFF, 0x5F, 0xF3, 0xFF, 0x4F,
+    0xF1, 0xFF, 0x3F, 0xF0, 0xFF, 0x2F, 0xF0, 0xFF, 0x1F, 0xE0, 0xFF, 0x0F, 0xC0, 0xFF, 0x0E, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xE1, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x2F,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF4, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x4F, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0x09, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0xF0, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xAF,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x09, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x3F, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0x05, 0xF8, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xDF, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0xF3, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x04, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xD0,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF3, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x3F, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xC0,
+    0xFF, 0xDF, 0x01, 0x00, 0x00, 0xF7, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x48, 0x00,
+    0x70, 0xFF, 0x2F, 0x00, 0x51, 0xD9, 0x00, 0xF5, 0xFF, 0xBF, 0x76, 0xFF, 0x4F, 0xC7, 0xFF, 0xFF,
+    0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xB8, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xBD, 0x05, 0x00,
+    0x00, 0x10, 0xFD, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x9F, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x10, 0xFE,
+    0xFF, 0x1A, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x03, 0xF8, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xCF, 0x00, 0xF1, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x50, 0xFD, 0x5F, 0x00,
+    0x90, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x00, 0x20, 0x5D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x10, 0x11, 0x11, 0x31, 0xFF, 0xEF, 0x11, 0x11, 0x11, 0x01, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x23, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x6F, 0x30, 0xFF, 0xFF, 0x2F, 0x60, 0xFF, 0xFF, 0x0D, 0x90, 0xFF, 0xFF,
+    0x08, 0xC0, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xCF, 0x00, 0xF4, 0xFF, 0x5F, 0x00, 0xF7, 0xFF, 0x0E,
+    0x00, 0xFB, 0xFF, 0x07, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xA8, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x00, 0x00, 0x42, 0x02, 0x00, 0xC1, 0xFF, 0xAF, 0x00, 0xF9, 0xFF, 0xFF, 0x06, 0xFC,
+    0xFF, 0xFF, 0x09, 0xFB, 0xFF, 0xFF, 0x09, 0xF6, 0xFF, 0xFF, 0x03, 0x70, 0xFD, 0x5D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xEF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xB7, 0xFE, 0xDE, 0x4A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0xBE, 0xFB, 0xFF, 0xFF, 0x8F, 0x00, 0x60, 0xFF, 0xFF, 0xBF, 0x00, 0x30, 0xFE,
+    0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x05, 0xF0, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0xF3, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
+    0x0E, 0xF5, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x0F, 0xF7, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0x2F, 0xF8, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x3F, 0xF9,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x4F, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x5F, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x4F, 0xF8, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x4F, 0xF7, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0x3F, 0xF5, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0xF2, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0x0E, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0xA0,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x07, 0x50, 0xFF, 0xFF, 0xBF, 0x00, 0x20, 0xFE,
+    0xFF, 0xFF, 0x02, 0x00, 0xFD, 0xFF, 0xFF, 0xAE, 0xFB, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF4, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x10, 0xB6, 0xFD,
+    0xDF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xC1,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xE4,
+    0xFF, 0xFF, 0x9F, 0xFE, 0xFF, 0xBF, 0xF4, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xBF, 0x80, 0xFF, 0x6F,
+    0x00, 0xFF, 0xFF, 0xBF, 0x00, 0xEB, 0x03, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x10, 0x00, 0x00, 0xFF,
+    0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xBF, 0x00, 0x00, 0x40, 0xC8, 0xFE, 0xDF, 0x7B, 0x01, 0x00, 0x00, 0x00, 0x50, 0xFD, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0xDE, 0xFE,
+    0xFF, 0xFF, 0xFF, 0x02, 0x30, 0xFF, 0xFF, 0x3A, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0x07, 0x00, 0xF5,
+    0x3D, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x0A, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC1, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF,
+    0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x6D, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x84, 0xDC, 0xFF, 0xDE, 0x7B, 0x01, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x01, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0xE1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0xCF, 0xBA, 0xFD, 0xFF, 0xFF,
+    0xFF, 0x02, 0x00, 0xF9, 0x6D, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0x05, 0x00, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xD7, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x9E, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xDF, 0x4A, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x62, 0x66, 0x97, 0xFC, 0xFF, 0xFF, 0xEF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x2F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x1F, 0xD8, 0x27, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0x0C, 0xF8, 0xFF, 0xBE, 0x99,
+    0xA9, 0xFE, 0xFF, 0xFF, 0xFF, 0x06, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x6E, 0x00, 0x00, 0x00, 0x73, 0xDA, 0xFE, 0xFF, 0xBE, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFE, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xDF, 0xF9, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x4F, 0xFA, 0xFF, 0xDF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x0A, 0xFB, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xEF, 0x01, 0xFB, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x5F, 0x00, 0xFC, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0x0B, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xA0, 0xFF,
+    0xEF, 0x01, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x5F, 0x00, 0x00, 0xFC, 0xFF,
+    0xDF, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0x0B, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0xA0, 0xFF,
+    0xEF, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x72, 0x77, 0x77, 0x77, 0x77, 0x77, 0xFD, 0xFF, 0xEF, 0x77, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0xFE, 0xFF, 0xEF, 0xDD, 0xDD, 0xDD, 0xDD, 0x1D, 0x00, 0x00, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xBF, 0xFE,
+    0xEF, 0x9C, 0x03, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xCF, 0x00, 0x10, 0xF9, 0xDF, 0xAC, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x0A, 0xF2, 0x49, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0x05, 0xF2, 0xFF, 0xEF, 0xAB, 0xCA, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xF2, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x73, 0xDB, 0xFE, 0xEF,
+    0xAD, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xDA, 0xFE, 0xFF, 0x7E, 0x00, 0x00,
+    0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xB0, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x89, 0x88, 0x7A, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xDF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x3F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xEF, 0x00, 0xA4, 0xFD, 0xDF,
+    0x39, 0x00, 0x00, 0xF6, 0xFF, 0xCF, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF7, 0xFF, 0xAF,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x06, 0xF9, 0xFF, 0xFF, 0xFF, 0x7B, 0x86, 0xFE, 0xFF, 0xFF, 0x0D, 0xFA, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0xE1, 0xFF, 0xFF, 0x2F, 0xF9, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x5F, 0xF8,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x7F, 0xF6, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0x7F, 0xF3, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x5F, 0xE0, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x3F, 0x80, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0x0E, 0x10, 0xFF, 0xFF, 0xFF, 0xAE, 0xC9, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF5, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00,
+    0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xFD, 0xEF, 0x8C,
+    0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+    0xDD, 0xED, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xC9, 0xFE, 0xEF, 0x8B, 0x02, 0x00, 0x00, 0x00, 0x20, 0xFC, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x10,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x70, 0xFF, 0xFF, 0xDF, 0x36, 0x84, 0xFF,
+    0xFF, 0xFF, 0x03, 0xB0, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x06, 0xC0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x08, 0xB0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x06, 0x70, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x02, 0x10, 0xFF, 0xFF, 0xEF, 0x04,
+    0x70, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xCF, 0xFD, 0xFF, 0xFF, 0x1D, 0x00, 0x00,
+    0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0xC1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0x7E, 0xFC, 0xFF, 0xFF, 0x7F,
+    0x00, 0xB0, 0xFF, 0xFF, 0x8F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x04, 0xF2, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0xE2, 0xFF, 0xFF, 0x0D, 0xF7, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x3F, 0xF9,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x5F, 0xF9, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0x4F, 0xF7, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x2F, 0xF3, 0xFF, 0xFF,
+    0xBF, 0x45, 0x64, 0xFC, 0xFF, 0xFF, 0x0C, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x03, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x61, 0xDA, 0xFE, 0xEF, 0x8C, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xD9, 0xFE, 0xCE, 0x39, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x1B, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x30, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xAB, 0xFB, 0xFF, 0xFF, 0xBF,
+    0x00, 0xF3, 0xFF, 0xFF, 0x2E, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0x03, 0xF8, 0xFF, 0xFF, 0x04, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0x09, 0xFA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0E, 0xFC,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x1F, 0xFB, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0x4F, 0xFA, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x5F, 0xF7, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x5F, 0xF2, 0xFF, 0xFF, 0xCF, 0x67, 0xD8, 0xFF, 0xFF, 0xFF,
+    0x5F, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x10, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x6F, 0xFF, 0xFF, 0x3F, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0xB5, 0xFE, 0xDF, 0x39, 0x30, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xAF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x9A, 0x78, 0x98, 0xFC,
+    0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A,
+    0x00, 0x00, 0x00, 0x00, 0xEB, 0xFF, 0xDF, 0xAC, 0x15, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFD, 0x5D,
+    0x00, 0xF6, 0xFF, 0xFF, 0x04, 0xFB, 0xFF, 0xFF, 0x09, 0xFC, 0xFF, 0xFF, 0x09, 0xF8, 0xFF, 0xFF,
+    0x06, 0xC1, 0xFF, 0xAF, 0x00, 0x00, 0x42, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x02, 0x00, 0xC1, 0xFF, 0xAF, 0x00, 0xF9, 0xFF, 0xFF,
+    0x06, 0xFC, 0xFF, 0xFF, 0x09, 0xFB, 0xFF, 0xFF, 0x09, 0xF6, 0xFF, 0xFF, 0x03, 0x70, 0xFD, 0x5D,
+    0x00, 0x00, 0xD7, 0xDF, 0x05, 0x60, 0xFF, 0xFF, 0x4F, 0xB0, 0xFF, 0xFF, 0x9F, 0xC0, 0xFF, 0xFF,
+    0x9F, 0x80, 0xFF, 0xFF, 0x6F, 0x10, 0xFC, 0xFF, 0x0A, 0x00, 0x20, 0x24, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x6F, 0x30, 0xFF, 0xFF, 0x2F, 0x60, 0xFF, 0xFF,
+    0x0D, 0x90, 0xFF, 0xFF, 0x08, 0xC0, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xCF, 0x00, 0xF4, 0xFF, 0x5F,
+    0x00, 0xF7, 0xFF, 0x0E, 0x00, 0xFB, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x10, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x10, 0xF8, 0xFF, 0xFF, 0xFF, 0x4B, 0x00, 0x00, 0x00,
+    0x10, 0xF8, 0xFF, 0xFF, 0xFF, 0x3A, 0x00, 0x00, 0x00, 0x10, 0xF8, 0xFF, 0xFF, 0xFF, 0x29, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xEF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x39, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFD, 0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFB, 0xFF, 0xFF,
+    0xFF, 0x9E, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF9, 0xFF, 0xFF, 0xFF, 0xBF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xE7, 0xFF, 0xFF, 0xFF, 0xEF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x92, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71,
+    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x01, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x6E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xE7, 0xFF, 0xFF, 0xFF,
+    0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF,
+    0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x10, 0xE8, 0xFF, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x00, 0x40, 0xFB, 0xFF,
+    0xFF, 0xFF, 0x9F, 0x02, 0x00, 0x00, 0x71, 0xFD, 0xFF, 0xFF, 0xFF, 0x7E, 0x01, 0x00, 0x00, 0xA2,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x4B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xEF, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xA6, 0xED, 0xFF,
+    0xBE, 0x27, 0x00, 0x00, 0x50, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xFA, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xC0,
+    0xFF, 0xFF, 0xAC, 0xA9, 0xFE, 0xFF, 0xFF, 0x0E, 0x40, 0xBF, 0x05, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0x2F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x1A, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x41, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xDF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFC, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xA6, 0xEC, 0xFF, 0xDE, 0x7A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x9C, 0x88, 0xB9, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xAF, 0x04, 0x00, 0x00, 0x00, 0x50, 0xFC, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xD0,
+    0xFF, 0xCF, 0x00, 0x00, 0x71, 0xEB, 0xFF, 0xCE, 0x7A, 0x04, 0x80, 0xFF, 0xEF, 0x00, 0x00, 0xF5,
+    0xFF, 0x1F, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xFE, 0xFF, 0x05, 0x00, 0xFD,
+    0xFF, 0x07, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF8, 0xFF, 0x0A, 0x30, 0xFF,
+    0xFF, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x66, 0xE8, 0xFF, 0x6F, 0x00, 0xF3, 0xFF, 0x0E, 0x80, 0xFF,
+    0xAF, 0x00, 0xF2, 0xFF, 0xCF, 0x01, 0x00, 0xD0, 0xFF, 0x6F, 0x00, 0xF0, 0xFF, 0x1F, 0xB0, 0xFF,
+    0x6F, 0x00, 0xF9, 0xFF, 0x1E, 0x00, 0x00, 0xE0, 0xFF, 0x5F, 0x00, 0xE0, 0xFF, 0x2F, 0xE0, 0xFF,
+    0x3F, 0x00, 0xFD, 0xFF, 0x08, 0x00, 0x00, 0xF0, 0xFF, 0x4F, 0x00, 0xE0, 0xFF, 0x2F, 0xF0, 0xFF,
+    0x1F, 0x00, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0xE0, 0xFF, 0x1F, 0xF1, 0xFF,
+    0x0F, 0x10, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF1, 0xFF, 0x3F, 0x00, 0xF0, 0xFF, 0x0F, 0xF1, 0xFF,
+    0x0F, 0x00, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xF4, 0xFF, 0x2F, 0x00, 0xF2, 0xFF, 0x0D, 0xF0, 0xFF,
+    0x1F, 0x00, 0xFE, 0xFF, 0x07, 0x00, 0x00, 0xF9, 0xFF, 0x2F, 0x00, 0xF7, 0xFF, 0x08, 0xE0, 0xFF,
+    0x3F, 0x00, 0xFA, 0xFF, 0x1E, 0x00, 0x30, 0xFF, 0xFF, 0x5F, 0x00, 0xFD, 0xFF, 0x03, 0xC0, 0xFF,
+    0x7F, 0x00, 0xF4, 0xFF, 0xEF, 0x68, 0xF9, 0xFF, 0xFF, 0xDF, 0xC7, 0xFF, 0xBF, 0x00, 0x80, 0xFF,
+    0xBF, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x30, 0xFF,
+    0xFF, 0x02, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x3E, 0xE1, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0xFD,
+    0xFF, 0x0B, 0x00, 0x30, 0xDA, 0xFF, 0x7C, 0x00, 0x10, 0xE9, 0xDF, 0x19, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0xEF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x51, 0xE9, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC1, 0xFF, 0xFF, 0xFF, 0xBE, 0x9A, 0xA9, 0xEC, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x84, 0xDC, 0xFE, 0xEF, 0xBD, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x8C, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xEF, 0x00, 0xFA, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0x9F, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x4F,
+    0x00, 0xF0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0xB0,
+    0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0A, 0x00, 0x60, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x06, 0x00, 0x10, 0xFF, 0xFF, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0x04, 0x00, 0x60, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00,
+    0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0xF1, 0xFF,
+    0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0xF7, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xAF, 0x00, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x01, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xAC, 0x16,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xBB, 0xFC, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xBF, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xCF, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xCF, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xBF, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0x7F, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x30, 0xF8, 0xFF, 0xFF, 0x1F,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x39,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF9, 0xFF, 0xFF,
+    0x9A, 0x99, 0xB9, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0x01, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x05, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0x08, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x06, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xFF, 0x03, 0xF9, 0xFF, 0xFF, 0xCC, 0xCC, 0xEC,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3C, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xEC, 0xFF, 0xCE, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xE2, 0xFF,
+    0xFF, 0xFF, 0xEF, 0xDD, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x30,
+    0xE8, 0x7F, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0xB0, 0xFF,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x9F, 0x02, 0x00, 0x00,
+    0x73, 0xDC, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xEF, 0xCD, 0xFE, 0xFF, 0xDF, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xB7, 0xED, 0xFF, 0xCE, 0x59, 0x01, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE,
+    0x7A, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x05, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xBB, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xFF,
+    0x0D, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x6F, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xEF, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x03, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x0B, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0C, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0D, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0x0E, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0D, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0B, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF,
+    0xFF, 0x06, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x02, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xCF, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0x4F, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x10, 0xD6, 0xFF, 0xFF, 0xFF,
+    0x0B, 0x00, 0xF9, 0xFF, 0xFF, 0xCC, 0xCC, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xEF, 0xCD, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xBB, 0xBB, 0xBB, 0x3B, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF9, 0xFF, 0xFF, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x4F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x4F, 0xF9, 0xFF, 0xFF, 0xBB, 0xBB, 0xBB, 0xBB, 0x3B, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xC9, 0xFD,
+    0xFF, 0xBE, 0x59, 0x01, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF,
+    0x02, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x10, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
+    0xDC, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x3A, 0x00, 0x00, 0x20, 0xD7, 0x0D,
+    0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xB0, 0xFF, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x03, 0x00, 0x40, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0x02, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x07, 0xFB, 0xFF, 0xFF, 0x02, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFA, 0xFF, 0xFF,
+    0x03, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0x06, 0x00, 0x30, 0xCC,
+    0xCC, 0xFC, 0xFF, 0xFF, 0x07, 0xF6, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0x07, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x07, 0xD0, 0xFF, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x07, 0x70, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0x07, 0x10, 0xFE, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0x07, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xFD, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x20, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF,
+    0x03, 0x00, 0x00, 0x00, 0x20, 0xA6, 0xED, 0xFF, 0xEF, 0xAC, 0x47, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x0A, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0A, 0xF9, 0xFF, 0xFF, 0xCD, 0xCC, 0xCC, 0xCC, 0xCC, 0xFC, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF,
+    0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF,
+    0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF,
+    0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF,
+    0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF,
+    0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF,
+    0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xDF, 0x00, 0x01, 0x00, 0xD2, 0xFF, 0xFF, 0x9F, 0x00, 0xFD,
+    0xED, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xFD, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x01, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0xD8, 0xFF, 0xDE, 0x49, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xBF, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1E, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x90, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0xF6,
+    0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x30, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0xE1, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0xFC, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x82, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x7F, 0xD0, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x04, 0x40, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0xFA,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0xE1, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0xF2, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xEF,
+    0x01, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x0A, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x4F, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0xDF, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCC,
+    0xCC, 0xCC, 0xCC, 0xCC, 0x2C, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF9, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0xFF, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0xAF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xEF, 0xFB,
+    0xFF, 0x6F, 0xF9, 0xFF, 0x6F, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x9F, 0xFB, 0xFF,
+    0x6F, 0xF9, 0xFF, 0x5F, 0xFC, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x4F, 0xFC, 0xFF, 0x6F,
+    0xF9, 0xFF, 0x6F, 0xF7, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0E, 0xFD, 0xFF, 0x6F, 0xF9,
+    0xFF, 0x6F, 0xF2, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x0A, 0xFD, 0xFF, 0x6F, 0xF9, 0xFF,
+    0x7F, 0xD0, 0xFF, 0xDF, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x04, 0xFE, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F,
+    0x90, 0xFF, 0xFF, 0x02, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x40,
+    0xFF, 0xFF, 0x07, 0x00, 0xD0, 0xFF, 0xAF, 0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0xFE,
+    0xFF, 0x0C, 0x00, 0xF3, 0xFF, 0x4F, 0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0xFA, 0xFF,
+    0x1F, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0xF5, 0xFF, 0x6F,
+    0x00, 0xFD, 0xFF, 0x0A, 0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0xF0, 0xFF, 0xBF, 0x30,
+    0xFF, 0xFF, 0x05, 0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0xB0, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0x60, 0xFF, 0xFF, 0xD5, 0xFF, 0xAF,
+    0x00, 0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0x10, 0xFF, 0xFF, 0xFC, 0xFF, 0x5F, 0x00,
+    0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFF,
+    0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xFF, 0xFF,
+    0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x6F,
+    0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x6F, 0xF9,
+    0xFF, 0x8F, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF,
+    0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xEF, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x5F, 0xF8, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x5F, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07,
+    0xF9, 0xFF, 0x6F, 0x50, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x7F,
+    0x00, 0xFC, 0xFF, 0xFF, 0x05, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0xF3, 0xFF,
+    0xFF, 0x0E, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0xA0, 0xFF, 0xFF, 0x8F, 0x00,
+    0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x02, 0xA0, 0xFF, 0xFF,
+    0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x0B, 0xA0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF,
+    0x8F, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x4F, 0x90, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xDF, 0x80, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+    0xFF, 0x87, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x07,
+    0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0x95, 0xEC, 0xFF, 0xDE, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFE, 0xFF, 0xFF, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x20, 0xF8, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xD0,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0xF2, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x6F, 0x00, 0xF6, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0xDF, 0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFA,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xF9, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xCF, 0x00, 0xF5, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x5F, 0x00, 0xD0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x20, 0xF9, 0xFF, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x95, 0xEC, 0xFF,
+    0xDE, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x7A, 0x01, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xF9,
+    0xFF, 0xFF, 0xBC, 0xCB, 0xFE, 0xFF, 0xFF, 0xFF, 0x06, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x30, 0xFD,
+    0xFF, 0xFF, 0x0C, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1F, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0x2F, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0F, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0x0E, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0xF9,
+    0xFF, 0xFF, 0xBC, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x49, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x95, 0xEC, 0xFF, 0xDE, 0x6A, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF,
+    0x03, 0x00, 0x20, 0xF8, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xD0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0x6F, 0x00, 0xF6, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F,
+    0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xDF, 0x00, 0xFA,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xFB, 0xFF, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0xCF, 0x00, 0xF5, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xAF,
+    0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x6F, 0x00, 0xD0,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF,
+    0x04, 0x00, 0x20, 0xF9, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x95, 0xEC, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0xFF, 0x6F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x40, 0xFD, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x10, 0x94, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xAB, 0xEA, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x40, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0xF9, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0xE1, 0xFF, 0xFF, 0x1E,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x50, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x70, 0xFF, 0xFF,
+    0xAF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x1E, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x20, 0xB7, 0xFE, 0xEF, 0xAD, 0x26, 0x00,
+    0x00, 0x00, 0x10, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xDF, 0xEC, 0xFF, 0xFF, 0x3F, 0x00, 0xA0, 0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x51,
+    0xFA, 0x0C, 0x00, 0xD0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xE0, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x9F,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x6F, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFB, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFB, 0xFF, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x06, 0xA3,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x04, 0xF4, 0xDF, 0x38, 0x00, 0x00, 0x50, 0xFE,
+    0xFF, 0xFF, 0x01, 0xF4, 0xFF, 0xFF, 0xDF, 0xDC, 0xFE, 0xFF, 0xFF, 0xBF, 0x00, 0xF4, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x51, 0xC9, 0xFE, 0xFF,
+    0xBD, 0x27, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F,
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x4F, 0xC2, 0xCC, 0xCC, 0xCC, 0xFF, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0x3C, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x08, 0xFB, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x07, 0xFA, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0x06, 0xF8, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x04, 0xF4, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0xFF, 0xFF, 0xEF, 0x05, 0x00,
+    0x10, 0xF8, 0xFF, 0xFF, 0x9F, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFE, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xEC, 0xFF, 0xDF, 0x7A, 0x01, 0x00,
+    0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x08, 0xF7,
+    0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x03, 0xF2, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xDF, 0x00, 0xC0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xFF, 0xFF, 0x8F, 0x00, 0x70, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0x2F, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0x03, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0xFD, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x20, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0xCF, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0x01, 0x00, 0xF7, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x06, 0x00, 0xFC,
+    0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x0B, 0x10, 0xFF, 0xFF, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x50, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFF, 0xFF, 0x5F, 0xA0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0x9F, 0xE0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xDF, 0xF2,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xF7, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFD, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0x09, 0xF9, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x05, 0xF5, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xDF, 0x00, 0xD0, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x9F, 0x00,
+    0x90, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x30, 0xFF,
+    0xFF, 0x5F, 0x00, 0x50, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0x1F, 0x00, 0x10, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFB,
+    0xFF, 0x1F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0xFD, 0xFF, 0xAF, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0xF5, 0xFF, 0x5F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF9, 0xFF, 0xEF,
+    0x00, 0x00, 0xD0, 0xFF, 0xDF, 0xF2, 0xFF, 0x9F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x04, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0x02, 0x00, 0xF1, 0xFF, 0xAF, 0xE0, 0xFF, 0xDF, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0x6F, 0xB0, 0xFF, 0xFF, 0x01, 0x00,
+    0xF9, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x09, 0x00, 0xF9, 0xFF, 0x3F, 0x70, 0xFF,
+    0xFF, 0x05, 0x00, 0xFD, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0D, 0x00, 0xFD, 0xFF,
+    0x0E, 0x30, 0xFF, 0xFF, 0x09, 0x10, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x1F,
+    0x10, 0xFF, 0xFF, 0x0B, 0x00, 0xFF, 0xFF, 0x0E, 0x50, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x4F, 0x60, 0xFF, 0xFF, 0x06, 0x00, 0xFB, 0xFF, 0x2F, 0x80, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0x8F, 0xA0, 0xFF, 0xFF, 0x02, 0x00, 0xF7, 0xFF, 0x5F, 0xC0, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xBF, 0xD0, 0xFF, 0xEF, 0x00, 0x00, 0xF2, 0xFF,
+    0x9F, 0xF0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xEF, 0xF0, 0xFF, 0xAF, 0x00,
+    0x00, 0xE0, 0xFF, 0xCF, 0xF2, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xF4,
+    0xFF, 0x6F, 0x00, 0x00, 0xA0, 0xFF, 0xEF, 0xF5, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0xFA, 0xFF, 0x2F, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFE, 0xFF, 0x0E, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFE, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x06, 0x70,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0x06, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x03, 0x00, 0xC0, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0D, 0x00, 0xF5, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xFF, 0xFF, 0x7F, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
+    0x81, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0x6F, 0x70, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0C, 0x00,
+    0xFD, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0xF3, 0xFF, 0xFF,
+    0x1E, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xFB, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1E, 0x00, 0x60, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xAF, 0x00, 0xE1, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0xFF, 0x05, 0xFA, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0x1E, 0xFB, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x7F, 0xF3, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0D, 0xA0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0x05, 0x20, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x01, 0x40, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x08, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xD0,
+    0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x8F, 0xFD,
+    0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C,
+    0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0B, 0x80, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+    0xCC, 0x1C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF,
+    0xFF, 0xFF, 0xAF, 0xF5, 0xFF, 0xFF, 0xFF, 0xAF, 0xF5, 0xFF, 0xFF, 0xFF, 0xAF, 0xF5, 0xFF, 0xFF,
+    0xEE, 0x9E, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00,
+    0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00,
+    0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5,
+    0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF,
+    0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F,
+    0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00,
+    0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00,
+    0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xEE, 0x9E, 0xF5, 0xFF, 0xFF, 0xFF, 0xAF, 0xF5, 0xFF, 0xFF, 0xFF, 0xAF, 0xF5, 0xFF,
+    0xFF, 0xFF, 0xAF, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xAF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x4F, 0xF0, 0xFF, 0xFF, 0xFF, 0xEF,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xEF, 0xF0, 0xFF, 0xFF, 0xFF, 0xEF, 0xE0, 0xEE, 0xFE, 0xFF, 0xEF, 0x00,
+    0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00,
+    0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0,
+    0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF,
+    0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF,
+    0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00,
+    0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00,
+    0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0,
+    0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0xE0, 0xEE, 0xFE, 0xFF,
+    0xEF, 0xF0, 0xFF, 0xFF, 0xFF, 0xEF, 0xF0, 0xFF, 0xFF, 0xFF, 0xEF, 0xF0, 0xFF, 0xFF, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x5F, 0xFD, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0x0E, 0xF5, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x06, 0xC0, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xEF, 0x00, 0x40, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0x8F, 0x00, 0x00, 0xFB, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x1F, 0x00, 0x00, 0xF3,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x09, 0x00, 0x00, 0xA0, 0xFF, 0xBF, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x03, 0x00, 0xA0, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0x0C, 0x00, 0xF2, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x5F, 0x00,
+    0xF9, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDF, 0x00, 0x90, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x06, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xF1, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFA, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0xC1, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0C, 0x00, 0x00, 0x40, 0xB8, 0xFE, 0xFF,
+    0xAD, 0x06, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF2,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x03, 0x00, 0x30, 0xFF, 0x9E, 0x36, 0x63, 0xFD, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x47, 0x00,
+    0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x40, 0xA8, 0xDC, 0xFE,
+    0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xA0, 0xFF, 0xFF, 0xFF, 0x8D, 0x56, 0xA5, 0xFF,
+    0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0xF4, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0xF6, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x1F,
+    0xF5, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x1F, 0xF2, 0xFF, 0xFF, 0x8F, 0x23, 0xB4,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x50, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFB, 0xFF, 0x1F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0xF5,
+    0xFF, 0x1F, 0x00, 0x20, 0xD9, 0xFF, 0xBE, 0x17, 0x00, 0xF0, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09, 0x60, 0xEB, 0xEF, 0x6B, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x28, 0xFD, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xD8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x01, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xAF, 0xA8, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF0, 0xFF, 0xFF, 0xDF, 0x01,
+    0x00, 0xD1, 0xFF, 0xFF, 0x9F, 0x00, 0xF0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xEF,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0x04, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x05, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x04, 0xF0, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x01, 0xF0, 0xFF,
+    0xFF, 0x5F, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xEF, 0x00, 0xF0, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xE2,
+    0xFF, 0xFF, 0x9F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xBF, 0xA9, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xF0, 0xFF, 0xDF, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00,
+    0xF0, 0xFF, 0x7F, 0x00, 0x71, 0xEC, 0xEF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xEC,
+    0xFF, 0xCE, 0x49, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00,
+    0xFE, 0xFF, 0xFF, 0xCF, 0x99, 0xFC, 0xFF, 0x02, 0x60, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x85,
+    0x00, 0xB0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x80, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0xA3, 0x0B, 0x20, 0xFF, 0xFF, 0xFF, 0xCF,
+    0x99, 0xEB, 0xFF, 0x0B, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xB0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x10, 0xB6, 0xFD, 0xFF, 0xBE, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x50, 0xEA, 0xEF, 0x7C, 0x01, 0xF7, 0xFF, 0xFF, 0x01, 0x00, 0x10, 0xFC, 0xFF, 0xFF,
+    0xFF, 0x4E, 0xF5, 0xFF, 0xFF, 0x01, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
+    0x01, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF,
+    0xBF, 0xBA, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xB1, 0xFF, 0xFF,
+    0xFF, 0x01, 0xD0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xF2, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0x01, 0xF3, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x01, 0xF4, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x01, 0xF3, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x01, 0xF3, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x01, 0xF0,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x01, 0xD0, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
+    0x00, 0xFD, 0xFF, 0xFF, 0x01, 0x90, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x01,
+    0x30, 0xFF, 0xFF, 0xFF, 0xAF, 0x98, 0xFD, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFA, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF4, 0xFF, 0xFF,
+    0x01, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0x2D, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60, 0xEB,
+    0xEF, 0x6C, 0x00, 0x60, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x94, 0xED, 0xEF, 0x9D, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0xFE, 0xFF, 0xFF, 0x28, 0x20, 0xF7, 0xFF, 0xFF, 0x0C, 0x50, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0x3F, 0xB0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x8F, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xAF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xCF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF3, 0xFF, 0xFF, 0xCD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x9C, 0xF2,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF,
+    0xDF, 0x01, 0x00, 0x00, 0x00, 0x50, 0x07, 0x00, 0xFD, 0xFF, 0xFF, 0x9F, 0x35, 0x54, 0xB7, 0xFF,
+    0x0A, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x40, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x72, 0xDB, 0xFF, 0xEF, 0x9C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x71, 0xEB, 0xFF, 0xDE,
+    0x5A, 0x01, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFE,
+    0xFF, 0xFF, 0x8D, 0xA8, 0x2E, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xF3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x40, 0x54, 0xFF, 0xFF, 0xAF, 0x44, 0x44, 0x01, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xB8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00,
+    0xF7, 0xFF, 0xFF, 0x8D, 0xB7, 0xFF, 0xFF, 0xFF, 0x48, 0x00, 0x00, 0xFE, 0xFF, 0xCF, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0x01, 0x00, 0x20, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00,
+    0x40, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x09, 0x00, 0x40, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0x0A, 0x00, 0x20, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0xFD, 0xFF, 0xCF, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0x9D, 0xB8, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0x10, 0xFB,
+    0xFF, 0xFE, 0xEF, 0x8C, 0x03, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6,
+    0xFF, 0xFF, 0x9B, 0x88, 0x88, 0x68, 0x03, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x06, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0x60, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xF2, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x20, 0xE6, 0xFF, 0xFF, 0x0B,
+    0xF9, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x0B, 0xFD, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A, 0xFD, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0x06, 0xFB, 0xFF, 0xDF, 0x03, 0x00, 0x00, 0x50, 0xFD, 0xFF, 0xEF, 0x01, 0xF5, 0xFF, 0xFF, 0xEF,
+    0xBC, 0xDB, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x10, 0xA6,
+    0xED, 0xFF, 0xEE, 0x9B, 0x15, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0x08, 0x50, 0xEB, 0xFF, 0x9D, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x17, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x99, 0xFD, 0xFF, 0xFF, 0xAF, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x80, 0xFF, 0xFF,
+    0xEF, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02,
+    0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0x40, 0xFC, 0xAE, 0x01, 0xE0, 0xFF, 0xFF, 0x09, 0xF3,
+    0xFF, 0xFF, 0x0D, 0xF2, 0xFF, 0xFF, 0x0C, 0xB0, 0xFF, 0xFF, 0x05, 0x00, 0x85, 0x27, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0,
+    0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0,
+    0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0,
+    0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0,
+    0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0,
+    0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xC4, 0xEF,
+    0x1A, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x9F, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x50, 0x78, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x10, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0x8F, 0xB6, 0x99, 0xFD, 0xFF, 0xFF, 0x4F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x04, 0xF7, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xB4, 0xFE, 0xEF, 0x7C, 0x01, 0x00, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+    0xFF, 0x09, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xBF, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x0C, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x70, 0xFF, 0xFF,
+    0xDF, 0x01, 0x00, 0xF0, 0xFF, 0xFF, 0x09, 0x00, 0xF6, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x09, 0x50, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x08, 0xF3, 0xFF, 0xFF,
+    0x3F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x17, 0xFE, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0xB6, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
+    0x2F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xDD,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xBF, 0x30, 0xFF, 0xFF, 0xEF, 0x01, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0xF8, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0xC0, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x20, 0xFF, 0xFF, 0xFF,
+    0x04, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1E, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xBF, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFE,
+    0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x3F, 0xF0, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0x6F, 0x00, 0x71, 0xEC, 0xEF, 0x7C, 0x02, 0x00, 0x10, 0xC7, 0xFE, 0xCE,
+    0x17, 0x00, 0x00, 0xF0, 0xFF, 0xAF, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF6, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0xF0, 0xFF, 0xEF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xBF, 0xA9, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x8B, 0xFA, 0xFF, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xE1, 0xFF, 0xFF,
+    0xFF, 0x2E, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x04, 0xF0, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0xFF, 0x04, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x06, 0xF0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x10, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07,
+    0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0x07, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0x6F, 0x00, 0x60, 0xEB, 0xFF, 0x9D, 0x03,
+    0x00, 0x00, 0xF0, 0xFF, 0xAF, 0x40, 0xFD, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF0, 0xFF, 0xEF,
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x4F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xCF, 0x99, 0xFC, 0xFF, 0xFF, 0xAF, 0x00, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x04, 0x00, 0x80, 0xFF, 0xFF, 0xEF, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x01, 0xF0,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02,
+    0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x84, 0xEC, 0xFF, 0xBD, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xBF, 0xA9,
+    0xFD, 0xFF, 0xFF, 0x5F, 0x00, 0x50, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0x80, 0xFF, 0xFF, 0xDF, 0x00,
+    0xB0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x08, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0x0A, 0xF3, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x0C, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x07, 0xB0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0x04, 0x50, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x70, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFC,
+    0xFF, 0xFF, 0xBF, 0x99, 0xFD, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00,
+    0x00, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xEC, 0xFF,
+    0xBD, 0x16, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xBF, 0x00, 0x60, 0xEB, 0xEF, 0x6B, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xD5, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xAF, 0xA8, 0xFE, 0xFF, 0xFF, 0x3F, 0x00, 0xF0, 0xFF, 0xFF, 0xDF,
+    0x01, 0x00, 0xC1, 0xFF, 0xFF, 0x9F, 0x00, 0xF0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0xEF, 0x00, 0xF0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0x04, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x05, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x04, 0xF0, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0xF0,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xDF, 0x00, 0xF0, 0xFF, 0xFF, 0xEF, 0x03, 0x00,
+    0xD1, 0xFF, 0xFF, 0x8F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xBF, 0xA9, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF0, 0xFF, 0xFF, 0xFB, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xF0, 0xFF, 0xFF, 0x47, 0xFE, 0xFF, 0xFF, 0xFF, 0x1C, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x08, 0x71, 0xEC, 0xEF, 0x5B, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xEA, 0xEF, 0x7C, 0x01, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x10, 0xFB, 0xFF, 0xFF, 0xFF,
+    0x4E, 0xF0, 0xFF, 0xFF, 0x01, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0x01,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xBF,
+    0xBA, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0xB1, 0xFF, 0xFF, 0xFF,
+    0x01, 0xD0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF5, 0xFF,
+    0xFF, 0x01, 0xF3, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x01, 0xF4, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x01, 0xF3, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0x01, 0xF3, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x01, 0xF0, 0xFF,
+    0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x01, 0xD0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x01, 0x90, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x01, 0x30,
+    0xFF, 0xFF, 0xFF, 0x9E, 0x87, 0xFC, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xFF, 0xFF, 0x01,
+    0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0x3D, 0xF7, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60, 0xEB, 0xEF,
+    0x6C, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0x5F, 0x00, 0x30, 0xEA, 0xFF,
+    0x05, 0xF0, 0xFF, 0x9F, 0x00, 0xF8, 0xFF, 0xFF, 0x05, 0xF0, 0xFF, 0xCF, 0x90, 0xFF, 0xFF, 0xFF,
+    0x04, 0xF0, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xDF, 0x58, 0x65, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x95, 0xEC, 0xFF, 0xCE, 0x59, 0x01, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xAF, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xD0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF2, 0xFF, 0xFF, 0x5D, 0x33, 0x95, 0xFE, 0x0F, 0x00, 0xF4, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x50, 0x06, 0x00, 0xF3, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0x00,
+    0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x71, 0xFE, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x06, 0x93, 0x03, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0x05, 0xF4, 0xEF, 0x69, 0x23, 0x53, 0xFD, 0xFF, 0xFF, 0x02, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xBF, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0xF3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x10, 0xA6, 0xEC, 0xFF, 0xEF, 0x8C, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x66, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF2, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x40, 0x94, 0xFF, 0xFF, 0x6F, 0x44, 0x44, 0x04, 0x00, 0x60,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x8C, 0xB9, 0x4F, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xA4, 0xFE, 0xEF, 0x9C, 0x04, 0xF2, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
+    0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF,
+    0xFF, 0xFF, 0x8C, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x3D, 0xB0, 0xFF, 0xFF, 0x00, 0x00, 0xA4, 0xFD, 0xEF, 0x6B, 0x00, 0x70, 0xFF, 0xFF,
+    0xFD, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x6F, 0xF7, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0x0A, 0xA0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x04, 0x40, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0xEF, 0x00, 0x00, 0xFE, 0xFF, 0xCF, 0x00, 0x00, 0x10, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0x00, 0x70, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xF2, 0xFF,
+    0xFF, 0x06, 0x00, 0xC0, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0C, 0x00, 0xF1, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x1F, 0x00, 0xF7, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0x6F, 0x00, 0xFC, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xCF, 0x10, 0xFF,
+    0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x60, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0xFF, 0xFF, 0xA4, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xE8,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFA, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0xF3, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xBF, 0x00, 0xE0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x7F, 0x00, 0xA0, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x50, 0xFF, 0xFF, 0x2F, 0x00, 0x50, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x08, 0x00, 0x90, 0xFF, 0xFF, 0x0E, 0x00, 0x10, 0xFF, 0xFF, 0x6F,
+    0x00, 0x30, 0xFF, 0xEF, 0xF7, 0xFF, 0x0C, 0x00, 0xD0, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xFC, 0xFF,
+    0xAF, 0x00, 0x70, 0xFF, 0xAF, 0xF3, 0xFF, 0x0F, 0x00, 0xF2, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xF8,
+    0xFF, 0xEF, 0x00, 0xB0, 0xFF, 0x6F, 0xF0, 0xFF, 0x3F, 0x00, 0xF6, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0x3F, 0xC0, 0xFF, 0x7F, 0x00, 0xFA, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x07, 0xF3, 0xFF, 0x0F, 0x80, 0xFF, 0xBF, 0x00, 0xFE, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0A, 0xF7, 0xFF, 0x0B, 0x50, 0xFF, 0xFF, 0x10, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0D, 0xFA, 0xFF, 0x08, 0x10, 0xFF, 0xFF, 0x42, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x0F, 0xFC, 0xFF, 0x04, 0x00, 0xFD, 0xFF, 0x74, 0xFF,
+    0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x3F, 0xFF, 0xFF, 0x01, 0x00, 0xF9, 0xFF, 0xA7,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x7F, 0xFF, 0xDF, 0x00, 0x00, 0xF6, 0xFF,
+    0xD9, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xBF, 0xFF, 0x9F, 0x00, 0x00, 0xF2,
+    0xFF, 0xFC, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x2F, 0x70, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0xFF, 0x07, 0x00, 0xFD, 0xFF, 0xFF, 0x07, 0x00, 0x70, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x1F, 0x00, 0xF1, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xAF, 0x00, 0xFA, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x98, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xFF, 0xEF, 0x00, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xD0, 0xFF, 0xFF,
+    0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0B, 0x00, 0xC0, 0xFF, 0xFF,
+    0x7F, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x02, 0xC0, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x0C, 0xF7, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x6F, 0xF6, 0xFF,
+    0xFF, 0x0B, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0x0A, 0xA0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x04, 0x30,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x05, 0x00, 0x80, 0xFF, 0xFF, 0x3F, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0x00, 0xD0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0F,
+    0x00, 0xF2, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x4F, 0x00, 0xF8, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0xFE, 0xFF, 0x9F, 0x00, 0xFD, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xEF, 0x20, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x73, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xB7, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFD, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0x9A, 0xFB, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFE, 0xEF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF6,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x52, 0x55, 0x55, 0x55, 0xB5, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0x5F, 0x55, 0x55, 0x55, 0x55, 0x02, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x10, 0xA6, 0xED,
+    0x7F, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x8F, 0x14, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0x03, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x30, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0xC4, 0xFE, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x18, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xC5, 0xFE, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x40, 0xFD, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0x03, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0x9F, 0x14, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x10, 0xA6, 0xED,
+    0x7F, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08,
+    0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9,
+    0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF,
+    0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08,
+    0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9,
+    0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF,
+    0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08,
+    0xF9, 0xFF, 0x08, 0xF7, 0xDE, 0x7B, 0x01, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x6F, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x41,
+    0xF8, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xDF, 0x4B, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0x6F, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xEF, 0x4C, 0x00, 0x10, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x41, 0xF8, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x5F,
+    0x00, 0x00, 0x00, 0xF7, 0xDF, 0x7B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFE, 0xBE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x00, 0x50, 0x1F, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x38, 0x31,
+    0xFA, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0x8F, 0x12, 0xA4,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xE5, 0x03, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xDF, 0x01,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFC, 0xDF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xFD, 0x5D, 0x00, 0xF6, 0xFF, 0xFF, 0x03, 0xFB, 0xFF, 0xFF, 0x09,
+    0xFC, 0xFF, 0xFF, 0x09, 0xF8, 0xFF, 0xFF, 0x06, 0xC1, 0xFF, 0xBF, 0x00, 0x00, 0x42, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0x58, 0x00, 0xE0, 0xFF, 0xBF, 0x00,
+    0xF0, 0xFF, 0xBF, 0x00, 0xF0, 0xFF, 0xCF, 0x00, 0xF1, 0xFF, 0xDF, 0x00, 0xF2, 0xFF, 0xEF, 0x00,
+    0xF2, 0xFF, 0xFF, 0x00, 0xF3, 0xFF, 0xFF, 0x00, 0xF4, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0x01,
+    0xF6, 0xFF, 0xFF, 0x02, 0xF7, 0xFF, 0xFF, 0x03, 0xF7, 0xFF, 0xFF, 0x04, 0xF8, 0xFF, 0xFF, 0x04,
+    0xF9, 0xFF, 0xFF, 0x05, 0xFA, 0xFF, 0xFF, 0x06, 0xFB, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA6, 0xFE, 0xFF, 0xCE, 0x59, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x2E, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x07, 0x20, 0xFF, 0xFF, 0xFF, 0xBF, 0x99, 0xFB, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0xEF,
+    0x02, 0x00, 0x00, 0x75, 0x00, 0xD0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
+    0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x82, 0x09, 0x20,
+    0xFF, 0xFF, 0xFF, 0xCF, 0xAA, 0xEB, 0xFF, 0x0A, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0A, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xA6, 0xFE, 0xFF, 0xBE, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xB7, 0xFE, 0xEF, 0x9C, 0x16,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x70, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xCF, 0xBA, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x04, 0x00,
+    0x10, 0x76, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x06, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x10, 0x31, 0xFF,
+    0xFF, 0x7F, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x5F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xD0, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xDF, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xCD, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8D,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x9C, 0x00, 0xD1, 0xFF, 0x08, 0xA6, 0xCC, 0x4A, 0xC1, 0xFF, 0x09,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x08, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xFC, 0xFF, 0x4D, 0x10,
+    0xF6, 0xFF, 0x8F, 0x00, 0x20, 0xFF, 0xEF, 0x01, 0x00, 0x40, 0xFF, 0xEF, 0x00, 0x60, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x70, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x02, 0x60,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x30, 0xFF, 0xEF, 0x01, 0x00, 0x40, 0xFF, 0xEF,
+    0x00, 0x00, 0xFC, 0xFF, 0x4D, 0x10, 0xF6, 0xFF, 0x8F, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x8F, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xC0, 0xFF, 0x18, 0xA7, 0xBC, 0x49, 0xD1, 0xFF, 0x08, 0x10, 0x8C,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x4F, 0xF2, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0C, 0xA0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0x04, 0x20, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xCF, 0x00, 0x00, 0xFA, 0xFF, 0xEF,
+    0x00, 0x00, 0x30, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x05, 0x00, 0xA0, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0C, 0x00, 0xF1, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x20, 0xFF,
+    0xFF, 0x3F, 0x00, 0xF8, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xAF, 0x00, 0xFE, 0xFF,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x61, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xD8, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x20, 0x44, 0x44, 0xFE,
+    0xFF, 0xAF, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x20, 0x44,
+    0x44, 0xFE, 0xFF, 0xAF, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFD, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9,
+    0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF,
+    0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08,
+    0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08,
+    0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9,
+    0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0x00, 0x00, 0x83, 0xEC, 0xFF,
+    0xBD, 0x27, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x50, 0xFF, 0xFF, 0xAE, 0x99, 0xFC, 0xFF, 0x0A, 0xA0, 0xFF, 0xEF, 0x01, 0x00,
+    0x10, 0xE7, 0x03, 0xB0, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xDF,
+    0x06, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xAF, 0x00, 0x10, 0xFF, 0xFF, 0x59, 0xFC, 0xFF, 0xFF, 0x09, 0x70, 0xFF, 0xBF, 0x00, 0x40,
+    0xFD, 0xFF, 0x3F, 0xA0, 0xFF, 0x6F, 0x00, 0x00, 0xF2, 0xFF, 0x8F, 0xB0, 0xFF, 0x9F, 0x00, 0x00,
+    0xB0, 0xFF, 0x9F, 0x80, 0xFF, 0xFF, 0x05, 0x00, 0xB0, 0xFF, 0x7F, 0x30, 0xFF, 0xFF, 0xBF, 0x02,
+    0xF2, 0xFF, 0x4F, 0x00, 0xF7, 0xFF, 0xFF, 0xBF, 0xFE, 0xFF, 0x0C, 0x00, 0x60, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xDF, 0x01, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0x70, 0xFD,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFE, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0x8F, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x9F, 0xF0, 0x49, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0x6F, 0xF0, 0xFF, 0xBF, 0x89, 0xC9, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x05, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x83, 0xEB, 0xFF, 0xDF,
+    0x5A, 0x00, 0x00, 0xA1, 0xDE, 0x05, 0x00, 0xD5, 0xAE, 0x01, 0xF9, 0xFF, 0x2F, 0x20, 0xFF, 0xFF,
+    0x0A, 0xFC, 0xFF, 0x5F, 0x40, 0xFF, 0xFF, 0x0D, 0xFA, 0xFF, 0x2F, 0x20, 0xFF, 0xFF, 0x0A, 0xB1,
+    0xEF, 0x06, 0x00, 0xE6, 0xBF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xEC, 0xFF, 0xBE, 0x38,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0xBE, 0xBA, 0xFC, 0xFF, 0xFF, 0x1B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xEF, 0x27, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xEF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0x3F, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0x4E, 0x00, 0x20, 0xD8, 0xFE, 0xCE, 0x38, 0x00, 0xF9, 0xEF, 0x01, 0x00,
+    0x00, 0xF2, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x90, 0xFF, 0x0B, 0x00, 0x00,
+    0xFA, 0x6F, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xFC, 0x4F, 0x00, 0x20, 0xFF,
+    0x0C, 0x00, 0xF4, 0xFF, 0xFF, 0x8A, 0xC9, 0xFF, 0x01, 0x00, 0xF3, 0xCF, 0x00, 0x70, 0xFF, 0x04,
+    0x00, 0xFC, 0xFF, 0x3F, 0x00, 0x00, 0x51, 0x00, 0x00, 0xB0, 0xFF, 0x01, 0xC0, 0xEF, 0x00, 0x10,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x06, 0xF0, 0xBF, 0x00, 0x40, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x09, 0xF1, 0x8F, 0x00, 0x60, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF2, 0x8F, 0x00, 0x60, 0xFF, 0xDF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0xF1, 0x8F, 0x00, 0x60, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFF, 0x09, 0xC0, 0xEF, 0x00, 0x10, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0x06, 0x80, 0xFF, 0x04, 0x00, 0xFB, 0xFF, 0x2E, 0x00, 0x00, 0x50, 0x01,
+    0x00, 0xB0, 0xFF, 0x02, 0x20, 0xFF, 0x0C, 0x00, 0xF3, 0xFF, 0xFF, 0x8A, 0xB9, 0xFF, 0x02, 0x00,
+    0xF2, 0xCF, 0x00, 0x00, 0xFA, 0x6F, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0xFC,
+    0x4F, 0x00, 0x00, 0xF2, 0xFF, 0x03, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0x0B,
+    0x00, 0x00, 0x60, 0xFF, 0x3E, 0x00, 0x20, 0xC8, 0xFE, 0xCF, 0x38, 0x00, 0xF8, 0xEF, 0x01, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xEF, 0x17, 0x00, 0x00, 0x00, 0x93, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE5, 0xFF, 0xFF, 0xBD, 0xAA, 0xFC, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x95, 0xEC, 0xFF, 0xBE, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xC9, 0xFE, 0xCE,
+    0x06, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xFD, 0xFF, 0xFE, 0xFF, 0xFF, 0x06,
+    0x00, 0xA5, 0x15, 0x00, 0xF6, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x10, 0xE2, 0xFF, 0x0E, 0x00, 0x70,
+    0xEB, 0xFF, 0xFF, 0xFF, 0x0E, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0xC0, 0xFF, 0xAF, 0x24,
+    0xD1, 0xFF, 0x0E, 0xF1, 0xFF, 0x0C, 0x00, 0xF0, 0xFF, 0x0E, 0xF1, 0xFF, 0x0D, 0x10, 0xFB, 0xFF,
+    0x0E, 0xD0, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0x0E, 0x50, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0x0E, 0x00,
+    0xB4, 0xFF, 0x8D, 0x01, 0xFB, 0x0E, 0x00, 0x00, 0x00, 0xC1, 0x06, 0x00, 0x00, 0x00, 0x99, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0xDF, 0x04, 0x00, 0x70, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xA0, 0xFF,
+    0xFF, 0x3F, 0x00, 0xF4, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x06, 0x20, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x9F, 0x00, 0xD1, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x0B, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x10, 0xFE, 0xFF, 0xDF, 0x01, 0x90, 0xFF, 0xFF,
+    0x5F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x2F, 0x00, 0xF7, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0x08, 0x00, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x2F, 0x00, 0xF7, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xDF, 0x01, 0xA0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x0B, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x9F, 0x00,
+    0xE1, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x06, 0x20, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x3F, 0x00, 0xF4, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFC, 0xDF,
+    0x05, 0x00, 0x70, 0xFF, 0x8F, 0x01, 0x00, 0x00, 0x00, 0xC1, 0x06, 0x00, 0x00, 0x00, 0x99, 0x01,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0xF1, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0xFE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x95, 0xEC, 0xFF, 0xBE, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0xFF,
+    0xFF, 0xBE, 0xBA, 0xFC, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xEF, 0x27,
+    0x00, 0x00, 0x00, 0xA4, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC2, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x4E, 0xE0, 0xFF, 0xFF, 0xEF,
+    0x7B, 0x00, 0x00, 0xF9, 0xEF, 0x01, 0x00, 0x00, 0xF2, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x2E, 0x00, 0x90, 0xFF, 0x0B, 0x00, 0x00, 0xFA, 0x6F, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x00, 0x00, 0xFC, 0x4F, 0x00, 0x20, 0xFF, 0x0C, 0x00, 0xE0, 0xFF, 0x6F, 0x93, 0xFF, 0xFF, 0x03,
+    0x00, 0xF3, 0xCF, 0x00, 0x70, 0xFF, 0x04, 0x00, 0xE0, 0xFF, 0x5F, 0x00, 0xFE, 0xFF, 0x06, 0x00,
+    0xB0, 0xFF, 0x01, 0xC0, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0x5F, 0x00, 0xFD, 0xFF, 0x06, 0x00, 0x50,
+    0xFF, 0x06, 0xF0, 0xBF, 0x00, 0x00, 0xE0, 0xFF, 0x5F, 0x10, 0xFF, 0xFF, 0x04, 0x00, 0x10, 0xFF,
+    0x09, 0xF1, 0x8F, 0x00, 0x00, 0xE0, 0xFF, 0x9F, 0xD7, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xFF, 0x0B,
+    0xF2, 0x8F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0xF1,
+    0x8F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0xBF,
+    0x00, 0x00, 0xE0, 0xFF, 0xDF, 0xFE, 0xFF, 0x05, 0x00, 0x00, 0x10, 0xFF, 0x09, 0xC0, 0xEF, 0x00,
+    0x00, 0xE0, 0xFF, 0x5F, 0xF6, 0xFF, 0x0E, 0x00, 0x00, 0x50, 0xFF, 0x06, 0x80, 0xFF, 0x04, 0x00,
+    0xE0, 0xFF, 0x5F, 0xD0, 0xFF, 0x8F, 0x00, 0x00, 0xB0, 0xFF, 0x02, 0x20, 0xFF, 0x0C, 0x00, 0xE0,
+    0xFF, 0x5F, 0x50, 0xFF, 0xFF, 0x02, 0x00, 0xF2, 0xCF, 0x00, 0x00, 0xFA, 0x6F, 0x00, 0xE0, 0xFF,
+    0x5F, 0x00, 0xFC, 0xFF, 0x0B, 0x00, 0xFC, 0x4F, 0x00, 0x00, 0xF2, 0xFF, 0x03, 0xE0, 0xFF, 0x5F,
+    0x00, 0xF4, 0xFF, 0x5F, 0x80, 0xFF, 0x0B, 0x00, 0x00, 0x60, 0xFF, 0x3E, 0xE0, 0xFF, 0x5F, 0x00,
+    0xC0, 0xFF, 0xEF, 0xF9, 0xEF, 0x01, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB2, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xEF, 0x17, 0x00, 0x00, 0x00, 0x93,
+    0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0xBD, 0xAA, 0xFC, 0xFF, 0xFF,
+    0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xEC, 0xFF, 0xBE, 0x38, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xB1, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x01, 0xF1, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0xC5, 0xFE, 0x7C, 0x01, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0xFD, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0x9A, 0xFE, 0xFF, 0x0C, 0xE0, 0xFF, 0x2E, 0x00, 0xC0, 0xFF,
+    0x3F, 0xF2, 0xFF, 0x07, 0x00, 0x30, 0xFF, 0x6F, 0xF4, 0xFF, 0x04, 0x00, 0x00, 0xFF, 0x8F, 0xF3,
+    0xFF, 0x07, 0x00, 0x30, 0xFF, 0x6F, 0xF0, 0xFF, 0x2E, 0x00, 0xC0, 0xFF, 0x3F, 0x90, 0xFF, 0xFF,
+    0x9A, 0xFE, 0xFF, 0x0C, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0xD2, 0xFF, 0xFF, 0xFF,
+    0x4E, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0x8D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x10, 0x11, 0x11, 0x31, 0xFF, 0xEF, 0x11, 0x11, 0x11, 0x01, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x23, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x40, 0xD9, 0xFF, 0xAE, 0x03, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0x6F,
+    0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x40, 0xFF, 0xCF, 0xD9, 0xFF, 0xFF, 0x07, 0x00,
+    0xD6, 0x03, 0x00, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x60, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xBE, 0xBB, 0xBB, 0x0B, 0xF0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0F, 0x00, 0xA5, 0xFD, 0xDF, 0x29, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xC0, 0xBF, 0x35, 0xF6, 0xFF, 0x5F, 0x20, 0x05, 0x00, 0xB0, 0xFF,
+    0x3F, 0x00, 0x00, 0x10, 0xF5, 0xFF, 0x0C, 0x00, 0xF6, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0x29, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0x6F, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xBF, 0x18, 0x00, 0x00, 0x50, 0xFF, 0xDF, 0xFE, 0x5A, 0x33, 0xE6, 0xFF,
+    0xAF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x50, 0xDA, 0xFF,
+    0xCE, 0x28, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0A, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0x07, 0x00, 0x30, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0xE1, 0xFF, 0xCF, 0x01, 0x00,
+    0x00, 0xFB, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02,
+    0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x02, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x9F,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0xFF, 0x8D, 0xB8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x9F, 0x80,
+    0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x48, 0xFB, 0xCF, 0x06, 0x40, 0xFF, 0xFF, 0x02, 0xF0, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x94, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xC1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x90,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xBB, 0xFC, 0xAF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0x00, 0xF5, 0xAF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF5, 0xAF, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF5, 0xAF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF5,
+    0xAF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF5, 0xAF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x00, 0xF5, 0xAF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF5, 0xAF, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF5, 0xAF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0x00, 0xF5, 0xAF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF5, 0xAF, 0xF2, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF5, 0xAF, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF5,
+    0xAF, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF5, 0xAF, 0x00, 0xE3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x00, 0xF5, 0xAF, 0x00, 0x00, 0xB6, 0xFE, 0xDF, 0xFD, 0x9F, 0x00, 0xF5, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0x9F, 0x00, 0xF5, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x9F,
+    0x00, 0xF5, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x9F, 0x00, 0xF5, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0x9F, 0x00, 0xF5, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x9F, 0x00, 0xF5,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x9F, 0x00, 0xF5, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0x9F, 0x00, 0xF5, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x9F, 0x00, 0xF5, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0x9F, 0x00, 0xF5, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x9F,
+    0x00, 0xF5, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x9F, 0x00, 0xF5, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0x9F, 0x00, 0xF5, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x9F, 0x00, 0xF5,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x9F, 0x00, 0xF5, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0x9F, 0x00, 0xF5, 0xAF, 0x70, 0xFD, 0x5D, 0x00, 0xF6, 0xFF, 0xFF, 0x04, 0xFB, 0xFF, 0xFF,
+    0x09, 0xFC, 0xFF, 0xFF, 0x09, 0xF8, 0xFF, 0xFF, 0x06, 0xC1, 0xFF, 0xAF, 0x00, 0x00, 0x42, 0x02,
+    0x00, 0x00, 0xF9, 0xFF, 0x01, 0x00, 0x20, 0xFF, 0xDF, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x2B, 0x00,
+    0x00, 0x91, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xFC, 0xFF, 0x0A, 0x44, 0x32, 0xFE, 0xFF, 0x0B, 0xFB,
+    0xFF, 0xFF, 0xFF, 0x08, 0xFB, 0xFF, 0xFF, 0xDF, 0x01, 0xD7, 0xFF, 0xCE, 0x07, 0x00, 0x00, 0x00,
+    0x60, 0xFF, 0xDF, 0x00, 0x00, 0xF9, 0xFF, 0xDF, 0x00, 0xC2, 0xFF, 0xFF, 0xDF, 0x40, 0xFE, 0xFF,
+    0xFF, 0xDF, 0xF1, 0xFF, 0xBF, 0xFF, 0xDF, 0x40, 0xFF, 0x84, 0xFF, 0xDF, 0x00, 0x25, 0x80, 0xFF,
+    0xDF, 0x00, 0x00, 0x90, 0xFF, 0xDF, 0x00, 0x00, 0x90, 0xFF, 0xDF, 0x00, 0x00, 0x90, 0xFF, 0xDF,
+    0x00, 0x00, 0x90, 0xFF, 0xDF, 0x00, 0x00, 0x90, 0xFF, 0xDF, 0x00, 0x00, 0x90, 0xFF, 0xDF, 0x00,
+    0x00, 0x90, 0xFF, 0xDF, 0x00, 0x00, 0x90, 0xFF, 0xDF, 0x00, 0x00, 0x90, 0xFF, 0xDF, 0x00, 0x70,
+    0xEC, 0xEF, 0x4A, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xD0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x8F, 0x00, 0xF6, 0xFF, 0x3C, 0x51, 0xFE, 0xFF, 0x01, 0xFB, 0xFF, 0x02, 0x00, 0xF7, 0xFF,
+    0x06, 0xFD, 0xEF, 0x00, 0x00, 0xF3, 0xFF, 0x09, 0xFE, 0xDF, 0x00, 0x00, 0xF2, 0xFF, 0x0A, 0xFD,
+    0xEF, 0x00, 0x00, 0xF3, 0xFF, 0x09, 0xFA, 0xFF, 0x02, 0x00, 0xF7, 0xFF, 0x06, 0xF5, 0xFF, 0x3C,
+    0x51, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x60, 0xEC, 0xEF, 0x4B, 0x00, 0x00, 0x00, 0x60, 0x1C, 0x00, 0x00, 0x00, 0xB3,
+    0x06, 0x00, 0x00, 0x00, 0x50, 0xFD, 0xCF, 0x00, 0x00, 0xA2, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0x0A, 0x00, 0xFC, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x7F, 0x00, 0xE2,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x05, 0x30, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0x3F, 0x00, 0xF6, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xEF,
+    0x01, 0x90, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0C, 0x00, 0xFB, 0xFF, 0xFF,
+    0x03, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x6F, 0x00, 0xF2, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xF2, 0xFF,
+    0xFF, 0x0C, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x10, 0xFD, 0xFF, 0xEF, 0x01, 0x90, 0xFF, 0xFF,
+    0x6F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x3F, 0x00, 0xF6, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x05, 0x30, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x8F, 0x00, 0xE1, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0A, 0x00, 0xFC, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0x50, 0xFD,
+    0xCF, 0x00, 0x00, 0xA2, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60, 0x1C, 0x00, 0x00, 0x00, 0xB3,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x56, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x60, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x3F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0x00, 0xD0, 0xFF, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0x00, 0xF6, 0xFF, 0x1E, 0x00, 0x00,
+    0xFD, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0x07, 0x00, 0x80,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xDF, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0xF2, 0xFF, 0x5F, 0x00, 0x00, 0xFE,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0xFA, 0xFF, 0x0C, 0x00, 0xA0, 0xFF,
+    0xFB, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x03, 0x00, 0xF5, 0xCF,
+    0xF7, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xAF, 0x00, 0x10, 0xFE, 0x3F,
+    0xF8, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x2F, 0x00, 0xB0, 0xFF, 0x08,
+    0xF8, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x08, 0x00, 0xF6, 0xDF, 0x00,
+    0xF8, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xEF, 0x01, 0x20, 0xFF, 0x2F, 0x00,
+    0xF8, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0x7F, 0x00, 0x90, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0D, 0x00, 0xA0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x05, 0x00, 0xA0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xCF, 0x00, 0x00, 0x10, 0x22, 0x22, 0x22,
+    0xF9, 0xFF, 0x2E, 0x02, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x56, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x60, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x3F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0x00, 0xD0, 0xFF, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0x00, 0xF6, 0xFF, 0x1E, 0x00, 0xA5,
+    0xFD, 0xDF, 0x29, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0x07, 0xD3, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xDF, 0x10, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0xF2, 0xFF, 0x5F, 0x00, 0xF6, 0xFF,
+    0x9B, 0xFE, 0xFF, 0x4F, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0xFA, 0xFF, 0x0C, 0x00, 0x90, 0x2C,
+    0x00, 0xF2, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x70,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xA0, 0xFF,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+    0xDF, 0xBB, 0xBB, 0x9B, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x71, 0xEC, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x48, 0xA4, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x10, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xDF, 0x05, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0xF7, 0xFF, 0x1E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFF, 0xEF, 0x00, 0x10, 0xFE, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x05, 0x80, 0xFF, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x06, 0xF2, 0xFF, 0x5F, 0x00, 0x40,
+    0xFF, 0xFF, 0x07, 0x00, 0xF5, 0x8E, 0x24, 0x93, 0xFF, 0xFF, 0x04, 0xFA, 0xFF, 0x0C, 0x00, 0xE1,
+    0xFF, 0xFF, 0x07, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x30, 0xFF, 0xFF, 0x03, 0x00, 0xFA,
+    0xFF, 0xFF, 0x07, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xC0, 0xFF, 0xAF, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0x07, 0x00, 0x10, 0xB7, 0xFE, 0xEF, 0x6B, 0x00, 0xF5, 0xFF, 0x2F, 0x00, 0xF1, 0xDF,
+    0xFE, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x08, 0x00, 0xFC, 0x5F,
+    0xFE, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xEF, 0x00, 0x70, 0xFF, 0x0C,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0x6F, 0x00, 0xF2, 0xFF, 0x02,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x0D, 0x00, 0xFD, 0x6F, 0x00,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x04, 0x80, 0xFF, 0x0B, 0x00,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xCF, 0x00, 0xF0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x3F, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0A, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x01, 0x00, 0x20, 0x22, 0x22, 0x22,
+    0xFF, 0xFF, 0x28, 0x01, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFD, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
+    0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0xFB, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0xB5, 0xCF, 0x00, 0xF7, 0xFF, 0xFF, 0xBF, 0xA9, 0xFC, 0xFF, 0xFF, 0x03, 0xE1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xD3,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x01, 0x00, 0x00, 0x94, 0xEC, 0xFF, 0xBD, 0x37, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFD,
+    0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDF, 0xFF,
+    0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x8C, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xEF, 0x00, 0xFA, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0x9F, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF,
+    0xFF, 0x4F, 0x00, 0xF0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0F,
+    0x00, 0xB0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0A, 0x00, 0x60,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x06, 0x00, 0x10, 0xFF, 0xFF,
+    0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD,
+    0xDD, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0x04, 0x00, 0x60, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0x09, 0x00, 0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0x00,
+    0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0xF7, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xAF, 0x00, 0xFD, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFE, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF,
+    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x8C, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xEF,
+    0x00, 0xFA, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x9F, 0x00, 0xF5,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x4F, 0x00, 0xF0, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0xB0, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0A, 0x00, 0x60, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x06, 0x00, 0x10, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x60, 0xFF,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00, 0xC0, 0xFF, 0xFF, 0x5F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0xF7, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0xAF, 0x00, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE1, 0xFF, 0xFF, 0x45, 0xFE, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD,
+    0xFF, 0x3D, 0x00, 0xC2, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x8F, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0x8C, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x47, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xEF, 0x00, 0xFA, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x9F, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0x4F, 0x00, 0xF0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0x0F, 0x00, 0xB0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x60, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x06,
+    0x00, 0x10, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0xFC, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x60, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00, 0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0x0F, 0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
+    0x5F, 0x00, 0xF7, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xAF, 0x00,
+    0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x10, 0xE8, 0xCF, 0x05, 0x00, 0x10, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1,
+    0xFF, 0xFF, 0xDF, 0x04, 0x90, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xEF, 0xFD, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x0D, 0x20, 0xFB, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x05, 0x00, 0x30, 0xFB, 0xAE, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x8C, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xEF, 0x00, 0xFA, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0x9F, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x4F,
+    0x00, 0xF0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0xB0,
+    0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0A, 0x00, 0x60, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x06, 0x00, 0x10, 0xFF, 0xFF, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0x04, 0x00, 0x60, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00,
+    0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0xF1, 0xFF,
+    0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0xF7, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xAF, 0x00, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x40, 0xED, 0x1B, 0x00, 0xA0,
+    0xDE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xBF, 0x00, 0xF8, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xEF, 0x00, 0xFB, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xBF, 0x00, 0xF8, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0xFD, 0x2C, 0x00, 0xA0, 0xEF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0xFF, 0x8C, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x03, 0xFE, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xEF, 0x00, 0xFA,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x9F, 0x00, 0xF5, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x4F, 0x00, 0xF0, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0xB0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0A, 0x00, 0x60, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x06, 0x00, 0x10, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0xFB, 0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x60, 0xFF, 0xFF, 0xAF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00, 0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0xF7, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0xFF, 0xFF, 0xAF, 0x00, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xEF, 0x55, 0xFD, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x6F,
+    0x00, 0xF4, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x5F, 0x00, 0xF3,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xCF, 0x11, 0xFB, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0x8C, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x47, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xEF, 0x00, 0xFA, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x9F, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0x4F, 0x00, 0xF0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0x0F, 0x00, 0xB0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x60, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x06,
+    0x00, 0x10, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0xFC, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x60, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00, 0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0x0F, 0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
+    0x5F, 0x00, 0xF7, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xAF, 0x00,
+    0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xDF, 0xBB, 0xBB,
+    0xBB, 0xBB, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x2F, 0x40, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0B, 0x40, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x04, 0x40, 0xFF, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xDF, 0x00, 0x40, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x7F, 0x00, 0x40,
+    0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0x00,
+    0x40, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x09,
+    0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0x02, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xCF, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0x5F, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xD0,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xDF, 0xBB, 0xBB, 0xBB, 0xBB, 0x2B, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xDE, 0xDD, 0xDD, 0xDD, 0xDD, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xDF,
+    0xCC, 0xCC, 0xCC, 0xCC, 0xBC, 0x60, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x95, 0xEC, 0xFF,
+    0xCE, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00,
+    0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xEF, 0xDD, 0xFF, 0xFF, 0xDF, 0x00,
+    0x00, 0xFB, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x30, 0xE8, 0x7F, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0xB0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF,
+    0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x10, 0xFF, 0xFF, 0xFF, 0x9F, 0x02, 0x00, 0x00, 0x73, 0xDC, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF,
+    0xEF, 0xCD, 0xFE, 0xFF, 0xDF, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x40, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x30, 0xB7, 0xED, 0xFF, 0xCE, 0x59,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xBF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x24, 0xE3, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFD, 0xEF,
+    0x7C, 0x01, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFC, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xBB, 0xBB, 0xBB, 0x3B, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xBC,
+    0xBB, 0xBB, 0xBB, 0xBB, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9,
+    0xFF, 0xFF, 0xBC, 0xBB, 0xBB, 0xBB, 0x3B, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xEF, 0x01, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xD1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x8F, 0xD2, 0xFF, 0xFF, 0x07, 0x00, 0xB0,
+    0xFF, 0xEF, 0x05, 0x00, 0xFA, 0xFF, 0x6F, 0x00, 0xFA, 0xFF, 0x1B, 0x00, 0x00, 0x50, 0xFE, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xBB, 0xBB,
+    0xBB, 0x3B, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC,
+    0xCC, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xB2, 0xCE, 0x04, 0x00, 0xD7, 0x9E, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0x0F, 0x30, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xFE, 0xFF, 0x3F, 0x60, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0xFC, 0xFF, 0x1F, 0x40, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xC2, 0xDF, 0x04, 0x00, 0xE7,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xBB, 0xBB, 0xBB, 0x3B, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xD0, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0xB1, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x90,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x09, 0x00, 0x90, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0x06, 0x00, 0x30, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0xE2, 0xFF, 0xCF, 0x01, 0x00,
+    0x00, 0xFC, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0x7F, 0xD2, 0xFF, 0xFF, 0x06, 0x00, 0xC0, 0xFF, 0xEF, 0x04, 0x10, 0xFA, 0xFF,
+    0x5F, 0x00, 0xFA, 0xFF, 0x1A, 0x00, 0x00, 0x50, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0x30, 0xEC, 0x3C, 0x00, 0x80, 0xEE, 0x09, 0xD0, 0xFF, 0xEF, 0x00, 0xF5, 0xFF, 0x6F, 0xF0, 0xFF,
+    0xFF, 0x01, 0xF8, 0xFF, 0xAF, 0xD0, 0xFF, 0xEF, 0x00, 0xF6, 0xFF, 0x7F, 0x30, 0xFC, 0x3D, 0x00,
+    0x90, 0xEE, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xAD, 0x37, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xCF, 0xBB, 0xDB,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x40, 0xFB, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x0E, 0x00, 0x90, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x3F, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x7F, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xBF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0xCF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xDF, 0xF2, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xDF, 0xB1, 0xEB, 0xFF, 0xFF, 0xCF, 0xBB, 0x6B, 0x00,
+    0x00, 0x30, 0xFF, 0xFF, 0xBF, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0xAF, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x6F, 0x00,
+    0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x2F, 0x00, 0x90, 0xFF, 0xFF,
+    0x2F, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x0C, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x61, 0xFE, 0xFF,
+    0xFF, 0xBF, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xCF, 0xCC, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x8C, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFC, 0x8E, 0x01, 0x00, 0xC0, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x7E, 0x00, 0xF4, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0x80, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xAF, 0x00, 0x00, 0x91, 0xFE, 0x5C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xEF, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x5F, 0xF8, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0x07, 0xF9, 0xFF, 0x5F, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF,
+    0x6F, 0x50, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x7F, 0x00, 0xFC,
+    0xFF, 0xFF, 0x05, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0xF3, 0xFF, 0xFF, 0x0E,
+    0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0xA0, 0xFF, 0xFF, 0x8F, 0x00, 0xB0, 0xFF,
+    0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x02, 0xA0, 0xFF, 0xFF, 0x07, 0xF9,
+    0xFF, 0x8F, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x0B, 0xA0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00,
+    0x00, 0xD0, 0xFF, 0xFF, 0x4F, 0x90, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xDF, 0x80, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x87,
+    0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x07,
+    0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x95,
+    0xEC, 0xFF, 0xDE, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x20, 0xF8, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x60,
+    0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xD0, 0xFF, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x6F, 0x00, 0xF6, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0xDF, 0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xEF, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x00, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFB,
+    0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFA, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xCF, 0x00, 0xF5, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xD0, 0xFF, 0xFF, 0x5F, 0x00, 0xD0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0x1F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x20, 0xF9, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x95, 0xEC, 0xFF, 0xDE, 0x6A,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD1, 0xFF, 0xDF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x95, 0xEC, 0xFF, 0xDE, 0x6A, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF,
+    0x03, 0x00, 0x20, 0xF8, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xD0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0x6F, 0x00, 0xF6, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F,
+    0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xDF, 0x00, 0xFA,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xFB, 0xFF, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0xCF, 0x00, 0xF5, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F,
+    0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x5F, 0x00, 0xD0,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF,
+    0x04, 0x00, 0x20, 0xF9, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x95, 0xEC, 0xFF, 0xDE, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x35,
+    0xFE, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0x3D, 0x00, 0xC2, 0xFF,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x95, 0xEC, 0xFF, 0xDE, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFE, 0xFF,
+    0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x20, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x03, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0xD0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0xF2,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x6F, 0x00, 0xF6, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xDF, 0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xF9,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xCF, 0x00, 0xF5, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x5F, 0x00, 0xD0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x20, 0xF9, 0xFF, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x95,
+    0xEC, 0xFF, 0xDE, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xDF, 0x06,
+    0x00, 0x10, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xDF, 0x04, 0x90,
+    0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xEF, 0xFD, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xFF, 0x0D, 0x20, 0xFA, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0xFF, 0x06, 0x00, 0x30, 0xFB, 0xAE, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x95, 0xEC, 0xFF,
+    0xDE, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x20, 0xF8, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xD0, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x6F, 0x00, 0xF6, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0x9F, 0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0xDF, 0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF,
+    0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFC,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFB, 0xFF, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0xCF, 0x00, 0xF5, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0x9F, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0x5F, 0x00, 0xD0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1F,
+    0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x20, 0xF9, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x95, 0xEC, 0xFF, 0xDE, 0x6A, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xEC, 0x2B, 0x00, 0x90, 0xDE, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xCF, 0x00, 0xF8, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x00, 0xFA, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xCF, 0x00, 0xF8, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFD,
+    0x2C, 0x00, 0xA0, 0xEF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x95, 0xEC, 0xFF, 0xDE, 0x6A, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xDD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF, 0x03, 0x00,
+    0x20, 0xF8, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xD0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0x1F, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x6F,
+    0x00, 0xF6, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x00, 0xF9,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xDF, 0x00, 0xFA, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xEF, 0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xCF,
+    0x00, 0xF5, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x00, 0xF2,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x5F, 0x00, 0xD0, 0xFF, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF, 0x04, 0x00,
+    0x20, 0xF9, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x95, 0xEC, 0xFF, 0xDE, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x1B, 0x00, 0x30, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xE2, 0xDF, 0x01, 0xF3,
+    0xFF, 0xAF, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0x1D, 0xE2, 0xFF, 0xFF, 0x0A, 0x00, 0xE2, 0xFF, 0xFF,
+    0x0A, 0x20, 0xFE, 0xFF, 0xAF, 0x20, 0xFE, 0xFF, 0xAF, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xEB, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE2, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00,
+    0x00, 0xE2, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0x09, 0x00, 0x10, 0xFD, 0xFF, 0xAF, 0x20, 0xFE, 0xFF,
+    0x9F, 0x00, 0xD1, 0xFF, 0xFF, 0x0A, 0x00, 0xE2, 0xFF, 0xFF, 0x09, 0xF3, 0xFF, 0xAF, 0x00, 0x00,
+    0x20, 0xFE, 0xFF, 0x0C, 0x30, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xE2, 0xCF, 0x01, 0x00, 0x93, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x95, 0xEC, 0xFF, 0xDF, 0x7B, 0x12, 0xFE, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xDD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x20,
+    0xFB, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x10, 0xFE, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0xD0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xDD, 0xFF, 0xFF, 0x5F, 0x00,
+    0xF6, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x9F, 0x00, 0xF9, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0xC0, 0xFF, 0x7F, 0x40, 0xFF, 0xFF, 0xCF, 0x00, 0xFA, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0xF8, 0xFF, 0x0C, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x30,
+    0xFF, 0xFF, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0xD0, 0xFF, 0x5F,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0xF9, 0xFF, 0x0A, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x50, 0xFF, 0xEF, 0x01, 0x00, 0x10, 0xFF, 0xFF,
+    0xEF, 0x00, 0xF9, 0xFF, 0xFF, 0x08, 0xE1, 0xFF, 0x4F, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xCF, 0x00,
+    0xF6, 0xFF, 0xFF, 0x0B, 0xFB, 0xFF, 0x09, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x00, 0xF2, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x5F, 0x00, 0xD0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x20,
+    0xF9, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF6,
+    0xFF, 0x16, 0xA6, 0xED, 0xFF, 0xDE, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xCC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0x08, 0xFB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x07,
+    0xFA, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x06, 0xF8, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0x10, 0xF8, 0xFF, 0xFF, 0x9F, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x84, 0xEC, 0xFF, 0xDF, 0x7A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE1, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x08, 0xFB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0x07, 0xFA, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x06,
+    0xF8, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0x10, 0xF8,
+    0xFF, 0xFF, 0x9F, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xAF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xEC, 0xFF, 0xDF, 0x7A, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1,
+    0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x18, 0xFD, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFA, 0xFF, 0x5F, 0x00, 0x90, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xBF,
+    0x02, 0x00, 0x00, 0xD4, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x08, 0xFB, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x07, 0xFA, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0x06, 0xF8, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x04,
+    0xF4, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0xFF, 0xFF, 0xEF,
+    0x05, 0x00, 0x10, 0xF8, 0xFF, 0xFF, 0x9F, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFE, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xEC, 0xFF, 0xDF, 0x7A,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xEB, 0x4C, 0x00, 0x70, 0xED, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x00, 0xF4, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
+    0xFF, 0x03, 0xF7, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0xF4, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFC, 0x4D, 0x00, 0x80, 0xFE, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x08,
+    0xFB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x07, 0xFA, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x06, 0xF8, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x00,
+    0xE0, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0x10, 0xF8, 0xFF, 0xFF, 0x9F, 0x00, 0x50, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xDE, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00,
+    0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84,
+    0xEC, 0xFF, 0xDF, 0x7A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0xB0, 0xFF, 0xFF, 0x7F, 0xF3, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0D,
+    0xA0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x05, 0x20, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xC0,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xFF, 0x01, 0x40, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x08, 0xC0, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0x8F, 0xFD, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x7A, 0x01, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0C, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF9, 0xFF, 0xFF, 0xAB,
+    0xBA, 0xFE, 0xFF, 0xFF, 0xFF, 0x03, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0x0A,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0E, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0xD0, 0xFF, 0xFF, 0x0F, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x2F, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x1F, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0x0F, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x0D, 0xF9, 0xFF, 0xFF, 0x02,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x08, 0xF9, 0xFF, 0xFF, 0xAB, 0xBA, 0xFE, 0xFF, 0xFF, 0xFF, 0x01,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x09, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xCE, 0x59, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xEC, 0xFF,
+    0xDF, 0x8B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04,
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xAF, 0x78,
+    0xD9, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xA0, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0x1F, 0x00, 0xE0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x2F, 0x00, 0xF0, 0xFF,
+    0xFF, 0x0B, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x0E, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0xFF, 0x08, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0xDF,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x90, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0xF4,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0xFA, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0xFB, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x00, 0xF8, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0xE1,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF,
+    0x2D, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0x0D, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x5F, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0x9F, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xAF, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x40, 0x02, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x9F, 0xF0, 0xFF, 0xFF, 0x0A, 0x70, 0xBF,
+    0x36, 0x21, 0xE5, 0xFF, 0xFF, 0x6F, 0xF0, 0xFF, 0xFF, 0x0A, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 0x0A, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x94,
+    0xEC, 0xFF, 0xDE, 0x6A, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xB8, 0xFE, 0xFF, 0xAD, 0x06, 0x00, 0x00,
+    0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x30,
+    0xFF, 0x9E, 0x36, 0x63, 0xFD, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0xE1, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x40, 0xA8, 0xDC, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x00, 0x70, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xA0, 0xFF, 0xFF, 0xFF, 0x8D, 0x56, 0xA5, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF,
+    0xFF, 0x5F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0xF4, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0x1F, 0xF6, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x1F, 0xF2, 0xFF, 0xFF, 0x8F, 0x23, 0xB4, 0xFF, 0xFF, 0xFF, 0x1F,
+    0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x4F, 0xFB, 0xFF, 0x1F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0xF5, 0xFF, 0x1F, 0x00, 0x20,
+    0xD9, 0xFF, 0xBE, 0x17, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xEF, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xB8, 0xFE, 0xFF, 0xAD, 0x06,
+    0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x30, 0xFF, 0x9E, 0x36, 0x63, 0xFD, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+    0xE1, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x40, 0xA8, 0xDC, 0xFE, 0xFF, 0xFF,
+    0xFF, 0x1F, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0xFC, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xA0, 0xFF, 0xFF, 0xFF, 0x8D, 0x56, 0xA5, 0xFF, 0xFF, 0x1F,
+    0xF1, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0xF4, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0x1F, 0xF6, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF,
+    0xFF, 0x09, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x1F, 0xF2, 0xFF, 0xFF, 0x8F, 0x23, 0xB4, 0xFF, 0xFF,
+    0xFF, 0x1F, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x50, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x4F, 0xFB, 0xFF, 0x1F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0xF5, 0xFF, 0x1F,
+    0x00, 0x20, 0xD9, 0xFF, 0xBE, 0x17, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x8F, 0xD2, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0xB0, 0xFF, 0xEF, 0x05, 0x00, 0xFA, 0xFF, 0x6F, 0x00, 0x00, 0xF9, 0xFF, 0x1B,
+    0x00, 0x00, 0x40, 0xFE, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xB8, 0xFE, 0xFF,
+    0xAD, 0x06, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF2,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x03, 0x00, 0x30, 0xFF, 0x9E, 0x36, 0x63, 0xFD, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x47, 0x00,
+    0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x40, 0xA8, 0xDC, 0xFE,
+    0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xA0, 0xFF, 0xFF, 0xFF, 0x8D, 0x56, 0xA5, 0xFF,
+    0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0xF4, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0xF6, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x1F,
+    0xF5, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x1F, 0xF2, 0xFF, 0xFF, 0x8F, 0x23, 0xB4,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x50, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFB, 0xFF, 0x1F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0xF5,
+    0xFF, 0x1F, 0x00, 0x20, 0xD9, 0xFF, 0xBE, 0x17, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x30, 0xFB,
+    0xAF, 0x02, 0x00, 0x80, 0xFF, 0x05, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x9F, 0x01, 0xE1, 0xFF, 0x02,
+    0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xEF, 0x00, 0x00, 0x70, 0xFF, 0xDF, 0xFE, 0xFF,
+    0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xB0, 0xFF, 0x07, 0x50, 0xFE, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xE0,
+    0xEF, 0x00, 0x00, 0x70, 0xFD, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xB8,
+    0xFE, 0xFF, 0xAD, 0x06, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x9E, 0x36, 0x63, 0xFD, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x47, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF,
+    0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x40, 0xA8,
+    0xDC, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xA0, 0xFF, 0xFF, 0xFF, 0x8D, 0x56,
+    0xA5, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0xF4, 0xFF,
+    0xFF, 0x09, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0xF6, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x1F, 0xF2, 0xFF, 0xFF, 0x8F,
+    0x23, 0xB4, 0xFF, 0xFF, 0xFF, 0x1F, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFB, 0xFF, 0x1F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF,
+    0x04, 0xF5, 0xFF, 0x1F, 0x00, 0x20, 0xD9, 0xFF, 0xBE, 0x17, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00,
+    0x90, 0xDE, 0x06, 0x00, 0xC4, 0xBE, 0x02, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x3F, 0x00, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x7F, 0x30, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0x4F, 0x10, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xA0, 0xEF, 0x07, 0x00, 0xD5, 0xCF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xB8, 0xFE, 0xFF, 0xAD, 0x06, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x06, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x9E, 0x36, 0x63, 0xFD, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x40, 0xA8, 0xDC, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1F, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xA0, 0xFF, 0xFF, 0xFF,
+    0x8D, 0x56, 0xA5, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F,
+    0xF4, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0xF6, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0xD0, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x1F, 0xF2, 0xFF,
+    0xFF, 0x8F, 0x23, 0xB4, 0xFF, 0xFF, 0xFF, 0x1F, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1F, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFB, 0xFF, 0x1F, 0x00, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x04, 0xF5, 0xFF, 0x1F, 0x00, 0x20, 0xD9, 0xFF, 0xBE, 0x17, 0x00, 0xF0, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0xD8, 0xEF, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xEF, 0xDA, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0x2F, 0x00, 0xFC, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0E, 0x00, 0xF9, 0x5F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0x00, 0xFD, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xEF, 0xDA, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xD8, 0xEF, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xB8, 0xFE, 0xFF, 0xAD, 0x06, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x06, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x9E, 0x36, 0x63, 0xFD, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x40, 0xA8, 0xDC, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1F, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xA0, 0xFF, 0xFF, 0xFF,
+    0x8D, 0x56, 0xA5, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F,
+    0xF4, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0xF6, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0xD0, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x1F, 0xF2, 0xFF,
+    0xFF, 0x8F, 0x23, 0xB4, 0xFF, 0xFF, 0xFF, 0x1F, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1F, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFB, 0xFF, 0x1F, 0x00, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x04, 0xF5, 0xFF, 0x1F, 0x00, 0x20, 0xD9, 0xFF, 0xBE, 0x17, 0x00, 0xF0, 0xFF, 0x1F,
+    0x00, 0x00, 0x40, 0xC9, 0xFE, 0xEF, 0x8C, 0x03, 0x00, 0x50, 0xDA, 0xFE, 0xCE, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x20, 0xFF, 0x8C, 0x35, 0x63, 0xFE, 0xFF, 0xFF, 0xFF, 0x5D, 0x02,
+    0xC3, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0xFD, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
+    0x0F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xB8, 0xEC, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xA0, 0xFF, 0xFF, 0xFF, 0x8C,
+    0x56, 0xE5, 0xFF, 0xFF, 0xCF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x02, 0xF1, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0x09, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0x09, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x30, 0x09, 0x00,
+    0xF2, 0xFF, 0xFF, 0x7F, 0x23, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x46, 0x43, 0x97, 0xFE, 0x0F,
+    0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0F, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0F, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x10, 0xD8, 0xFF, 0xDF, 0x5A, 0x00, 0x00, 0x00, 0x30, 0xC8, 0xFE,
+    0xEF, 0xBD, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xEC, 0xFF, 0xCE, 0x49, 0x00, 0x00, 0x00,
+    0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E,
+    0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xFE, 0xFF, 0xFF, 0xCF, 0x99, 0xFC,
+    0xFF, 0x02, 0x60, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x85, 0x00, 0xB0, 0xFF, 0xFF, 0x5F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0xFF, 0xFF, 0xEF,
+    0x03, 0x00, 0x00, 0xA3, 0x0B, 0x20, 0xFF, 0xFF, 0xFF, 0xCF, 0x99, 0xEB, 0xFF, 0x0B, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x10, 0xB6, 0xFD, 0xFF, 0xBE,
+    0x17, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xCF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDF, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x24, 0xC2, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFD, 0xFF, 0x8C,
+    0x01, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xED, 0xEF, 0x9D, 0x05, 0x00, 0x00, 0x00, 0x00, 0xD3,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xFE, 0xFF, 0xFF, 0x28,
+    0x20, 0xF7, 0xFF, 0xFF, 0x0C, 0x50, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x3F, 0xB0,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x8F, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xAF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xDF, 0xF3, 0xFF, 0xFF, 0xCD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x9C, 0xF2, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00,
+    0x00, 0x50, 0x07, 0x00, 0xFD, 0xFF, 0xFF, 0x9F, 0x35, 0x54, 0xB7, 0xFF, 0x0A, 0x00, 0xF3, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x72, 0xDB,
+    0xFF, 0xEF, 0x9C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xAF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xED, 0xEF, 0x9D, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x6F, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xFE, 0xFF,
+    0xFF, 0x28, 0x20, 0xF7, 0xFF, 0xFF, 0x0C, 0x50, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x30, 0xFF, 0xFF,
+    0x3F, 0xB0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x8F, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xAF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0xF3, 0xFF, 0xFF, 0xCD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x9C, 0xF2, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xDF, 0x01,
+    0x00, 0x00, 0x00, 0x50, 0x07, 0x00, 0xFD, 0xFF, 0xFF, 0x9F, 0x35, 0x54, 0xB7, 0xFF, 0x0A, 0x00,
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x72, 0xDB, 0xFF, 0xEF, 0x9C, 0x15, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xCF, 0x91, 0xFF, 0xFF, 0x0C, 0x00, 0x00,
+    0x60, 0xFF, 0xFF, 0x09, 0x00, 0xF6, 0xFF, 0xBF, 0x00, 0x00, 0xF4, 0xFF, 0x4E, 0x00, 0x00, 0x20,
+    0xFB, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xED, 0xEF, 0x9D, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0xFE, 0xFF, 0xFF, 0x28, 0x20, 0xF7, 0xFF, 0xFF, 0x0C, 0x50, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0x3F, 0xB0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x8F, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xAF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xCF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF3, 0xFF, 0xFF, 0xCD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x9C, 0xF2,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF,
+    0xDF, 0x01, 0x00, 0x00, 0x00, 0x50, 0x07, 0x00, 0xFD, 0xFF, 0xFF, 0x9F, 0x35, 0x54, 0xB7, 0xFF,
+    0x0A, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x40, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x72, 0xDB, 0xFF, 0xEF, 0x9C, 0x15, 0x00, 0x00, 0x00, 0x70, 0xEE, 0x09, 0x00, 0xB2,
+    0xCE, 0x04, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x7F, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xAF, 0x00, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x7F, 0x00, 0xFD, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0x80, 0xEE, 0x0A, 0x00, 0xC2, 0xDF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xED, 0xEF, 0x9D,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x03, 0x00, 0xFE, 0xFF, 0xFF, 0x28, 0x20, 0xF7, 0xFF, 0xFF, 0x0C, 0x50, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x30, 0xFF, 0xFF, 0x3F, 0xB0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x8F, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xAF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF4, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF3, 0xFF, 0xFF, 0xCD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+    0x9C, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x50, 0x07, 0x00, 0xFD, 0xFF, 0xFF, 0x9F, 0x35, 0x54,
+    0xB7, 0xFF, 0x0A, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x40, 0xFE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x72, 0xDB, 0xFF, 0xEF, 0x9C, 0x15, 0x00, 0xFA, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x40, 0xFE,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x3F, 0x00,
+    0x10, 0xFE, 0xFF, 0xEF, 0x03, 0x00, 0xC0, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0xF9, 0xFF, 0xAF, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF3, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
+    0x02, 0x00, 0x00, 0xF5, 0xFF, 0xDF, 0x82, 0xFF, 0xFF, 0x1D, 0x00, 0x40, 0xFF, 0xFF, 0x0A, 0x00,
+    0xE5, 0xFF, 0xCF, 0x01, 0xF2, 0xFF, 0x5E, 0x00, 0x00, 0x10, 0xFA, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x80, 0xEE, 0x08, 0x00,
+    0xC2, 0xCE, 0x03, 0xF5, 0xFF, 0x6F, 0x00, 0xFD, 0xFF, 0x0E, 0xF8, 0xFF, 0x9F, 0x00, 0xFF, 0xFF,
+    0x2F, 0xF5, 0xFF, 0x6F, 0x00, 0xFD, 0xFF, 0x0E, 0x80, 0xEE, 0x09, 0x00, 0xC3, 0xDF, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x07, 0x00, 0x00, 0x40, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xEF, 0x06, 0x10, 0xFA, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xCF, 0xF7, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xFE, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFB, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFD, 0x7F, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x02, 0x00,
+    0xD0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x3F, 0x00,
+    0x00, 0x00, 0x20, 0xC8, 0xFE, 0xDF, 0x39, 0xFA, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x04, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x50, 0xFF, 0xFF, 0xFF,
+    0x4A, 0x33, 0xE7, 0xFF, 0xFF, 0xFF, 0x0A, 0xB0, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x10, 0xFD, 0xFF,
+    0xFF, 0x0B, 0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x0C, 0xF2, 0xFF, 0xFF,
+    0x09, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x0B, 0xF4, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0xF2, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0x03, 0xA0, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xDF, 0x00, 0x30,
+    0xFF, 0xFF, 0xFF, 0x5B, 0x33, 0xE7, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xED,
+    0xFF, 0xAD, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFC, 0x8E, 0x01, 0x00, 0xC0, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x7F, 0x00, 0xF4, 0xEF, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xF2, 0xBF,
+    0x00, 0x00, 0x91, 0xFE, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0x6F, 0x00, 0x60, 0xEB, 0xFF, 0x9D, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xAF, 0x40, 0xFD, 0xFF, 0xFF,
+    0xFF, 0xAF, 0x00, 0x00, 0xF0, 0xFF, 0xEF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xCF, 0x99,
+    0xFC, 0xFF, 0xFF, 0xAF, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x80, 0xFF, 0xFF, 0xEF, 0x00,
+    0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x02, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0xEC, 0xFF, 0xBD, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xBF, 0xA9, 0xFD,
+    0xFF, 0xFF, 0x5F, 0x00, 0x50, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0x80, 0xFF, 0xFF, 0xDF, 0x00, 0xB0,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0x08, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A,
+    0xF3, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0C, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0D,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x07, 0xB0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+    0xFF, 0x04, 0x50, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x70, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0xBF, 0x99, 0xFD, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0B, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00,
+    0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xEC, 0xFF, 0xBD,
+    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84,
+    0xEC, 0xFF, 0xBD, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xBF, 0xA9, 0xFD, 0xFF,
+    0xFF, 0x5F, 0x00, 0x50, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0x80, 0xFF, 0xFF, 0xDF, 0x00, 0xB0, 0xFF,
+    0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0x08, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0xF3,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C,
+    0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x07, 0xB0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0x04, 0x50, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x70, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0xBF, 0x99, 0xFD, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0xB2,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xEC, 0xFF, 0xBD, 0x16,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0x0A, 0x00, 0xF5, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x5E, 0x00, 0x00,
+    0x10, 0xFA, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xEC,
+    0xFF, 0xBD, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xBF, 0xA9, 0xFD, 0xFF, 0xFF,
+    0x5F, 0x00, 0x50, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0x80, 0xFF, 0xFF, 0xDF, 0x00, 0xB0, 0xFF, 0xFF,
+    0x3F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0x08, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0xF3, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF2,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0x07, 0xB0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x04,
+    0x50, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x70, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF,
+    0x99, 0xFD, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0xB2, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xEC, 0xFF, 0xBD, 0x16, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xFB, 0xAF, 0x02, 0x00, 0x70, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0x9F, 0x01, 0xE1, 0xFF, 0x03, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0x08, 0x50, 0xFD, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x00, 0x00, 0x70, 0xFD,
+    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xEC, 0xFF,
+    0xBD, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xBF, 0xA9, 0xFD, 0xFF, 0xFF, 0x5F,
+    0x00, 0x50, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0x80, 0xFF, 0xFF, 0xDF, 0x00, 0xB0, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF5, 0xFF,
+    0xFF, 0x08, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0xF3, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF2, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0x07, 0xB0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x50,
+    0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x70, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0x99,
+    0xFD, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xEC, 0xFF, 0xBD, 0x16, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xEE, 0x08, 0x00, 0xC3, 0xCE, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0x5F, 0x00, 0xFE, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x8F, 0x10, 0xFF, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x5F, 0x00, 0xFE, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xEE, 0x08, 0x00, 0xD4, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xEC, 0xFF, 0xBD,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xBF, 0xA9, 0xFD, 0xFF, 0xFF, 0x5F, 0x00,
+    0x50, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0x80, 0xFF, 0xFF, 0xDF, 0x00, 0xB0, 0xFF, 0xFF, 0x3F, 0x00,
+    0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0x08, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0xF3, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF2, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0x07, 0xB0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x50, 0xFF,
+    0xFF, 0xEF, 0x02, 0x00, 0x70, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0x99, 0xFD,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xEC, 0xFF, 0xBD, 0x16, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xEC, 0xEF, 0xAD,
+    0x55, 0xCF, 0x02, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xBF, 0xA9, 0xFE, 0xFF, 0xFF, 0x5F, 0x00,
+    0x50, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0xFA, 0xFF, 0xFF, 0xDF, 0x00, 0xB0, 0xFF, 0xFF, 0x3F, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x07, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0xFB, 0xFF, 0xF8, 0xFF, 0xFF, 0x0A, 0xF3, 0xFF, 0xFF, 0x08,
+    0x60, 0xFF, 0xBF, 0xF0, 0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x07, 0xF2, 0xFF, 0x1E, 0xF0, 0xFF,
+    0xFF, 0x0C, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0x05, 0xF0, 0xFF, 0xFF, 0x0C, 0xF2, 0xFF, 0xFF,
+    0x8A, 0xFF, 0xAF, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0xFE, 0xFF, 0x1E, 0x00, 0xF5,
+    0xFF, 0xFF, 0x07, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x50, 0xFF,
+    0xFF, 0xFF, 0x8F, 0x00, 0x70, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xBF, 0x99, 0xFD,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0x85, 0xEC, 0xFF, 0xBD, 0x16, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0xFB, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xF2, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0xFF, 0x8C, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF3, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0xB0, 0xFF, 0xFF, 0x00, 0x00,
+    0xA4, 0xFD, 0xEF, 0x6B, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xAF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0xFF, 0x8C, 0xC9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFB, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0xB0, 0xFF, 0xFF,
+    0x00, 0x00, 0xA4, 0xFD, 0xEF, 0x6B, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x9F, 0xC1, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x06, 0x00, 0xF9, 0xFF, 0x7F, 0x00, 0x00, 0xF8, 0xFF, 0x2C,
+    0x00, 0x00, 0x40, 0xFD, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0xFF, 0x8C, 0xC9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFB,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0xB0,
+    0xFF, 0xFF, 0x00, 0x00, 0xA4, 0xFD, 0xEF, 0x6B, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0x00, 0xB2, 0xCE,
+    0x04, 0x00, 0xD7, 0x9E, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x0F, 0x30, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0x3F, 0x60, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x1F, 0x40,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xC2, 0xDF, 0x04, 0x00, 0xE7, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0xFB, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xF2, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0xFF,
+    0x8C, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x3D, 0xB0, 0xFF, 0xFF, 0x00, 0x00, 0xA4, 0xFD, 0xEF, 0x6B, 0x00, 0x70, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0x6F, 0xF6, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x0A, 0xA0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x04, 0x30, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0xFD, 0xFF,
+    0xFF, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x05, 0x00, 0x80, 0xFF,
+    0xFF, 0x3F, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0x00, 0xD0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0x0F, 0x00, 0xF2, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x4F, 0x00, 0xF8,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x9F, 0x00, 0xFD, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xEF, 0x20, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x73,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xB7, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xFD, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x3F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFC, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0x9A, 0xFB, 0xFF, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xEF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09, 0x60, 0xEB, 0xEF, 0x6B,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x28, 0xFD, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xAF, 0xA8, 0xFE, 0xFF, 0xFF, 0x3F, 0x00, 0xF0,
+    0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xC1, 0xFF, 0xFF, 0x9F, 0x00, 0xF0, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0xEF, 0x00, 0xF0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01,
+    0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x04, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0x05, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x04, 0xF0, 0xFF, 0xFF, 0x0C,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xEF, 0x00, 0xF0, 0xFF, 0xFF,
+    0xEF, 0x03, 0x00, 0xD1, 0xFF, 0xFF, 0x9F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xBF, 0xA9, 0xFF, 0xFF,
+    0xFF, 0x3F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF0, 0xFF,
+    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0xF0, 0xFF, 0xFF, 0x57, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x2D, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x08, 0x81, 0xEC, 0xEF, 0x6B, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xEE, 0x09, 0x00, 0xB2, 0xCE, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0x7F, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xAF, 0x00, 0xFF, 0xFF,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x7F, 0x00, 0xFD, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xEE, 0x0A, 0x00, 0xC2, 0xDF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x6F, 0xF6, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x1F,
+    0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x0A, 0xA0, 0xFF, 0xFF, 0x5F, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x04, 0x30, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF,
+    0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0x05, 0x00, 0x80, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0x00, 0xD0, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0F, 0x00, 0xF2, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0x4F, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x9F, 0x00, 0xFD, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xEF, 0x20, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0x73, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xB7, 0xFF,
+    0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xFD, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0x9A, 0xFB,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF,
+    0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xEF, 0x6B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+const GFXglyph OpenSans18BGlyphs[] = {
+    { 0, 0, 10, 0, 0, 0, 0 }, //  
+    { 7, 27, 11, 2, 27, 108, 0 }, // !
+    { 14, 10, 18, 2, 27, 70, 108 }, // "
+    { 24, 27, 25, 0, 27, 324, 178 }, // #
+    { 20, 31, 22, 1, 29, 310, 502 }, // $
+    { 33, 27, 34, 1, 27, 459, 812 }, // %
+    { 28, 27, 29, 1, 27, 378, 1271 }, // &
+    { 6, 10, 10, 2, 27, 30, 1649 }, // '
+    { 11, 33, 13, 1, 27, 198, 1679 }, // (
+    { 11, 33, 13, 1, 27, 198, 1877 }, // )
+    { 19, 19, 21, 1, 29, 190, 2075 }, // *
+    { 20, 20, 22, 1, 23, 200, 2265 }, // +
+    { 8, 9, 11, 1, 4, 36, 2465 }, // ,
+    { 11, 5, 12, 1, 13, 30, 2501 }, // -
+    { 7, 7, 11, 2, 7, 28, 2531 }, // .
+    { 16, 27, 16, 0, 27, 216, 2559 }, // /
+    { 20, 27, 22, 1, 27, 270, 2775 }, // 0
+    { 14, 27, 22, 2, 27, 189, 3045 }, // 1
+    { 20, 27, 22, 1, 27, 270, 3234 }, // 2
+    { 20, 27, 22, 1, 27, 270, 3504 }, // 3
+    { 22, 27, 22, 0, 27, 297, 3774 }, // 4
+    { 19, 27, 22, 1, 27, 270, 4071 }, // 5
+    { 20, 27, 22, 1, 27, 270, 4341 }, // 6
+    { 20, 27, 22, 1, 27, 270, 4611 }, // 7
+    { 20, 27, 22, 1, 27, 270, 4881 }, // 8
+    { 20, 27, 22, 1, 27, 270, 5151 }, // 9
+    { 7, 21, 11, 2, 21, 84, 5421 }, // :
+    { 8, 26, 11, 1, 21, 104, 5505 }, // ;
+    { 20, 21, 22, 1, 24, 210, 5609 }, // <
+    { 20, 11, 22, 1, 19, 110, 5819 }, // =
+    { 20, 21, 22, 1, 24, 210, 5929 }, // >
+    { 18, 27, 18, 0, 27, 243, 6139 }, // ?
+    { 32, 30, 34, 1, 27, 480, 6382 }, // @
+    { 27, 27, 26, 0, 27, 378, 6862 }, // A
+    { 21, 27, 26, 3, 27, 297, 7240 }, // B
+    { 21, 27, 24, 2, 27, 297, 7537 }, // C
+    { 23, 27, 28, 3, 27, 324, 7834 }, // D
+    { 17, 27, 21, 3, 27, 243, 8158 }, // E
+    { 16, 27, 21, 3, 27, 216, 8401 }, // F
+    { 23, 27, 28, 2, 27, 324, 8617 }, // G
+    { 23, 27, 29, 3, 27, 324, 8941 }, // H
+    { 7, 27, 13, 3, 27, 108, 9265 }, // I
+    { 13, 35, 13, -3, 27, 245, 9373 }, // J
+    { 23, 27, 25, 3, 27, 324, 9618 }, // K
+    { 18, 27, 21, 3, 27, 243, 9942 }, // L
+    { 30, 27, 36, 3, 27, 405, 10185 }, // M
+    { 25, 27, 31, 3, 27, 351, 10590 }, // N
+    { 27, 27, 30, 2, 27, 378, 10941 }, // O
+    { 20, 27, 24, 3, 27, 270, 11319 }, // P
+    { 27, 33, 30, 2, 27, 462, 11589 }, // Q
+    { 23, 27, 25, 3, 27, 324, 12051 }, // R
+    { 19, 27, 21, 1, 27, 270, 12375 }, // S
+    { 22, 27, 22, 0, 27, 297, 12645 }, // T
+    { 23, 27, 29, 3, 27, 324, 12942 }, // U
+    { 25, 27, 25, 0, 27, 351, 13266 }, // V
+    { 37, 27, 37, 0, 27, 513, 13617 }, // W
+    { 26, 27, 25, 0, 27, 351, 14130 }, // X
+    { 24, 27, 24, 0, 27, 324, 14481 }, // Y
+    { 22, 27, 22, 0, 27, 297, 14805 }, // Z
+    { 10, 33, 13, 2, 27, 165, 15102 }, // [
+    { 16, 27, 16, 0, 27, 216, 15267 }, // '\\'
+    { 10, 33, 13, 0, 27, 165, 15483 }, // ]
+    { 21, 17, 20, 0, 27, 187, 15648 }, // ^
+    { 17, 3, 16, -1, -3, 27, 15835 }, // _
+    { 11, 6, 23, 6, 29, 36, 15862 }, // `
+    { 20, 21, 23, 1, 21, 210, 15898 }, // a
+    { 21, 29, 24, 2, 29, 319, 16108 }, // b
+    { 18, 21, 20, 1, 21, 189, 16427 }, // c
+    { 21, 29, 24, 1, 29, 319, 16616 }, // d
+    { 20, 21, 22, 1, 21, 210, 16935 }, // e
+    { 17, 29, 15, 0, 29, 261, 17145 }, // f
+    { 22, 30, 21, 0, 21, 330, 17406 }, // g
+    { 21, 29, 25, 2, 29, 319, 17736 }, // h
+    { 7, 29, 12, 2, 29, 116, 18055 }, // i
+    { 12, 38, 12, -3, 29, 228, 18171 }, // j
+    { 22, 29, 24, 2, 29, 319, 18399 }, // k
+    { 7, 29, 12, 2, 29, 116, 18718 }, // l
+    { 33, 21, 37, 2, 21, 357, 18834 }, // m
+    { 21, 21, 25, 2, 21, 231, 19191 }, // n
+    { 21, 21, 24, 1, 21, 231, 19422 }, // o
+    { 21, 30, 24, 2, 21, 330, 19653 }, // p
+    { 21, 30, 24, 1, 21, 330, 19983 }, // q
+    { 15, 21, 17, 2, 21, 168, 20313 }, // r
+    { 17, 21, 19, 1, 21, 189, 20481 }, // s
+    { 16, 26, 17, 0, 26, 208, 20670 }, // t
+    { 20, 21, 25, 2, 21, 210, 20878 }, // u
+    { 22, 21, 22, 0, 21, 231, 21088 }, // v
+    { 33, 21, 33, 0, 21, 357, 21319 }, // w
+    { 22, 21, 22, 0, 21, 231, 21676 }, // x
+    { 22, 30, 22, 0, 21, 330, 21907 }, // y
+    { 17, 21, 19, 1, 21, 189, 22237 }, // z
+    { 14, 33, 15, 0, 27, 231, 22426 }, // {
+    { 5, 38, 21, 8, 29, 114, 22657 }, // |
+    { 14, 33, 15, 1, 27, 231, 22771 }, // }
+    { 20, 9, 22, 1, 18, 90, 23002 }, // ~
+    { 0, 0, 10, 0, 0, 0, 23092 }, //  
+    { 7, 28, 11, 2, 21, 112, 23092 }, // ¡
+    { 18, 27, 22, 2, 27, 243, 23204 }, // ¢
+    { 20, 27, 22, 1, 27, 270, 23447 }, // £
+    { 18, 19, 22, 2, 23, 171, 23717 }, // ¤
+    { 22, 27, 22, 0, 27, 297, 23888 }, // ¥
+    { 5, 38, 21, 8, 29, 114, 24185 }, // ¦
+    { 16, 29, 18, 1, 29, 232, 24299 }, // §
+    { 13, 5, 23, 5, 29, 35, 24531 }, // ¨
+    { 29, 27, 32, 1, 27, 405, 24566 }, // ©
+    { 13, 13, 15, 0, 27, 91, 24971 }, // ª
+    { 21, 17, 23, 1, 19, 187, 25062 }, // «
+    { 20, 11, 22, 1, 15, 110, 25249 }, // ¬
+    { 11, 5, 12, 1, 13, 30, 25359 }, // ­
+    { 29, 27, 32, 1, 27, 405, 25389 }, // ®
+    { 21, 4, 19, -1, 33, 44, 25794 }, // ¯
+    { 14, 13, 16, 1, 28, 91, 25838 }, // °
+    { 20, 25, 22, 1, 25, 250, 25929 }, // ±
+    { 14, 16, 14, 0, 27, 112, 26179 }, // ²
+    { 12, 16, 14, 1, 27, 96, 26291 }, // ³
+    { 11, 6, 23, 6, 29, 36, 26387 }, // ´
+    { 21, 30, 25, 2, 21, 330, 26423 }, // µ
+    { 20, 34, 25, 2, 29, 340, 26753 }, // ¶
+    { 7, 7, 11, 2, 17, 28, 27093 }, // ·
+    { 9, 9, 8, -1, 0, 45, 27121 }, // ¸
+    { 10, 16, 14, 1, 27, 80, 27166 }, // ¹
+    { 13, 13, 15, 1, 27, 91, 27246 }, // º
+    { 21, 17, 23, 1, 19, 187, 27337 }, // »
+    { 32, 27, 33, 0, 27, 432, 27524 }, // ¼
+    { 32, 27, 33, 0, 27, 432, 27956 }, // ½
+    { 31, 27, 33, 1, 27, 432, 28388 }, // ¾
+    { 18, 28, 18, 1, 21, 252, 28820 }, // ¿
+    { 27, 35, 26, 0, 35, 490, 29072 }, // À
+    { 27, 35, 26, 0, 35, 490, 29562 }, // Á
+    { 27, 35, 26, 0, 35, 490, 30052 }, // Â
+    { 27, 35, 26, 0, 35, 490, 30542 }, // Ã
+    { 27, 35, 26, 0, 35, 490, 31032 }, // Ä
+    { 27, 34, 26, 0, 34, 476, 31522 }, // Å
+    { 34, 27, 36, 0, 27, 459, 31998 }, // Æ
+    { 21, 36, 24, 2, 27, 396, 32457 }, // Ç
+    { 17, 35, 21, 3, 35, 315, 32853 }, // È
+    { 17, 35, 21, 3, 35, 315, 33168 }, // É
+    { 17, 35, 21, 3, 35, 315, 33483 }, // Ê
+    { 17, 35, 21, 3, 35, 315, 33798 }, // Ë
+    { 12, 35, 13, -2, 35, 210, 34113 }, // Ì
+    { 11, 35, 13, 3, 35, 210, 34323 }, // Í
+    { 17, 35, 13, -2, 35, 315, 34533 }, // Î
+    { 14, 35, 13, -1, 35, 245, 34848 }, // Ï
+    { 26, 27, 28, 0, 27, 351, 35093 }, // Ð
+    { 25, 35, 31, 3, 35, 455, 35444 }, // Ñ
+    { 27, 35, 30, 2, 35, 490, 35899 }, // Ò
+    { 27, 35, 30, 2, 35, 490, 36389 }, // Ó
+    { 27, 35, 30, 2, 35, 490, 36879 }, // Ô
+    { 27, 35, 30, 2, 35, 490, 37369 }, // Õ
+    { 27, 35, 30, 2, 35, 490, 37859 }, // Ö
+    { 18, 17, 22, 2, 22, 153, 38349 }, // ×
+    { 27, 31, 30, 2, 29, 434, 38502 }, // Ø
+    { 23, 35, 29, 3, 35, 420, 38936 }, // Ù
+    { 23, 35, 29, 3, 35, 420, 39356 }, // Ú
+    { 23, 35, 29, 3, 35, 420, 39776 }, // Û
+    { 23, 35, 29, 3, 35, 420, 40196 }, // Ü
+    { 24, 35, 24, 0, 35, 420, 40616 }, // Ý
+    { 20, 27, 24, 3, 27, 270, 41036 }, // Þ
+    { 24, 29, 27, 2, 29, 348, 41306 }, // ß
+    { 20, 29, 23, 1, 29, 290, 41654 }, // à
+    { 20, 29, 23, 1, 29, 290, 41944 }, // á
+    { 20, 29, 23, 1, 29, 290, 42234 }, // â
+    { 20, 29, 23, 1, 29, 290, 42524 }, // ã
+    { 20, 29, 23, 1, 29, 290, 42814 }, // ä
+    { 20, 32, 23, 1, 32, 320, 43104 }, // å
+    { 33, 21, 35, 1, 21, 357, 43424 }, // æ
+    { 18, 30, 20, 1, 21, 270, 43781 }, // ç
+    { 20, 29, 22, 1, 29, 290, 44051 }, // è
+    { 20, 29, 22, 1, 29, 290, 44341 }, // é
+    { 20, 29, 22, 1, 29, 290, 44631 }, // ê
+    { 20, 29, 22, 1, 29, 290, 44921 }, // ë
+    { 11, 29, 12, -2, 29, 174, 45211 }, // ì
+    { 12, 29, 12, 2, 29, 174, 45385 }, // í
+    { 17, 29, 12, -3, 29, 261, 45559 }, // î
+    { 14, 29, 12, -1, 29, 203, 45820 }, // ï
+    { 21, 29, 24, 1, 29, 319, 46023 }, // ð
+    { 21, 29, 25, 2, 29, 319, 46342 }, // ñ
+    { 21, 29, 24, 1, 29, 319, 46661 }, // ò
+    { 21, 29, 24, 1, 29, 319, 46980 }, // ó
+    { 21, 29, 24, 1, 29, 319, 47299 }, // ô
+    { 21, 29, 24, 1, 29, 319, 47618 }, // õ
+    { 21, 29, 24, 1, 29, 319, 47937 }, // ö
+    { 20, 19, 22, 1, 22, 190, 48256 }, // ÷
+    { 21, 24, 24, 1, 22, 264, 48446 }, // ø
+    { 20, 29, 25, 2, 29, 290, 48710 }, // ù
+    { 20, 29, 25, 2, 29, 290, 49000 }, // ú
+    { 20, 29, 25, 2, 29, 290, 49290 }, // û
+    { 20, 29, 25, 2, 29, 290, 49580 }, // ü
+    { 22, 38, 22, 0, 29, 418, 49870 }, // ý
+    { 21, 38, 24, 2, 29, 418, 50288 }, // þ
+    { 22, 38, 22, 0, 29, 418, 50706 }, // ÿ
+};
+const UnicodeInterval OpenSans18BIntervals[] = {
+    { 0x20, 0x7E, 0x0 },
+    { 0xA0, 0xFF, 0x5F },
+};
+const GFXfont OpenSans18B = {
+    (uint8_t*)OpenSans18BBitmaps,
+    (GFXglyph*)OpenSans18BGlyphs,
+    (UnicodeInterval*)OpenSans18BIntervals,
+    2,
+    0,
+    51,
+    41,
+    -11,
+};
@@ -0,0 +1,2038 @@
+#pragma once
+// Generated by tools/fontencode.py rle from opensans18b.h, do not edit
+#include "epd_driver.h"
+const uint8_t OpenSans18BBitmaps[29211] = {
+    0x52, 0x4C, 0x45, 0x34, 0x8B, 0x44, 0x9A, 0x44, 0x99, 0x44, 0x88, 0x89, 0x44, 0x87, 0x88, 0x44,
+    0x86, 0x87, 0x44, 0x85, 0x86, 0x44, 0x95, 0x44, 0x94, 0x44, 0x93, 0x44, 0x92, 0x44, 0x81, 0x82,
+    0x44, 0x00, 0x81, 0x44, 0x01, 0x43, 0x8E, 0x01, 0x43, 0x8E, 0x01, 0x8E, 0x42, 0x8D, 0x01, 0x8D,
+    0x42, 0x8C, 0x01, 0x86, 0xA8, 0x85, 0x10, 0x82, 0x84, 0x82, 0x01, 0x81, 0x8C, 0x42, 0x8A, 0x00,
+    0x89, 0x44, 0x86, 0x8C, 0x44, 0x89, 0x8B, 0x44, 0x89, 0x86, 0x44, 0x83, 0x00, 0x87, 0x8D, 0x40,
+    0x8D, 0x85, 0x00, 0x87, 0x43, 0x89, 0x01, 0x8A, 0x43, 0x96, 0x43, 0x88, 0x01, 0x89, 0x43, 0x95,
+    0x43, 0x87, 0x01, 0x88, 0x43, 0x94, 0x43, 0x85, 0x01, 0x87, 0x43, 0x93, 0x43, 0x84, 0x01, 0x85,
+    0x43, 0x91, 0x43, 0x83, 0x01, 0x84, 0x43, 0x01, 0x43, 0x82, 0x01, 0x83, 0x43, 0x01, 0x43, 0x81,
+    0x01, 0x82, 0x42, 0x8E, 0x01, 0x8E, 0x42, 0x03, 0x42, 0x8D, 0x01, 0x8C, 0x41, 0x8E, 0x03, 0x42,
+    0x8B, 0x00, 0x07, 0x82, 0x42, 0x8E, 0x02, 0x86, 0x42, 0x89, 0x0A, 0x84, 0x42, 0x8C, 0x02, 0x88,
+    0x42, 0x86, 0x0A, 0x87, 0x42, 0x89, 0x02, 0x8B, 0x42, 0x84, 0x0A, 0x8A, 0x42, 0x86, 0x02, 0x8E,
+    0x42, 0x81, 0x0A, 0x8D, 0x42, 0x83, 0x01, 0x81, 0x42, 0x8E, 0x0B, 0x43, 0x02, 0x84, 0x42, 0x8B,
+    0x0A, 0x83, 0x42, 0x8D, 0x02, 0x87, 0x42, 0x88, 0x0A, 0x86, 0x42, 0x8A, 0x02, 0x8A, 0x42, 0x85,
+    0x05, 0x8D, 0x53, 0x8B, 0x01, 0x8D, 0x53, 0x8B, 0x01, 0x8D, 0x53, 0x8B, 0x01, 0x8B, 0xBE, 0x43,
+    0xBE, 0x43, 0xBE, 0x8A, 0x05, 0x84, 0x42, 0x8B, 0x02, 0x89, 0x42, 0x86, 0x0A, 0x88, 0x42, 0x88,
+    0x02, 0x8D, 0x42, 0x83, 0x0A, 0x8B, 0x42, 0x85, 0x02, 0x43, 0x0B, 0x8E, 0x42, 0x81, 0x01, 0x84,
+    0x42, 0x8C, 0x05, 0x82, 0x54, 0x87, 0x00, 0x82, 0x54, 0x87, 0x00, 0x82, 0x54, 0x87, 0x00, 0x82,
+    0xBD, 0x43, 0xBD, 0x43, 0xCD, 0x86, 0x05, 0x8E, 0x42, 0x82, 0x01, 0x84, 0x42, 0x8C, 0x0A, 0x81,
+    0x43, 0x02, 0x87, 0x42, 0x89, 0x0A, 0x84, 0x42, 0x8C, 0x02, 0x8A, 0x42, 0x86, 0x0A, 0x87, 0x42,
+    0x88, 0x02, 0x8D, 0x42, 0x83, 0x0A, 0x8A, 0x42, 0x85, 0x01, 0x81, 0x43, 0x0B, 0x8D, 0x42, 0x82,
+    0x01, 0x84, 0x42, 0x8C, 0x0B, 0x43, 0x02, 0x87, 0x42, 0x89, 0x07, 0x07, 0x86, 0x41, 0x82, 0x0F,
+    0x86, 0x41, 0x82, 0x0F, 0x86, 0x41, 0x82, 0x0C, 0x84, 0x89, 0x8C, 0x8E, 0x42, 0x8E, 0x8C, 0x89,
+    0x86, 0x82, 0x05, 0x85, 0x8D, 0x4B, 0x8D, 0x85, 0x02, 0x89, 0x4E, 0x87, 0x01, 0x87, 0x4F, 0x81,
+    0x01, 0x46, 0x8D, 0x41, 0x8B, 0x8D, 0x43, 0x8B, 0x01, 0x83, 0x44, 0x8A, 0x00, 0x86, 0x41, 0x82,
+    0x01, 0x83, 0x88, 0x8D, 0x84, 0x01, 0x85, 0x44, 0x84, 0x00, 0x86, 0x41, 0x82, 0x07, 0x84, 0x44,
+    0x88, 0x00, 0x86, 0x41, 0x82, 0x07, 0x81, 0x45, 0x8A, 0x88, 0x41, 0x82, 0x08, 0x89, 0x48, 0x82,
+    0x08, 0x81, 0x8D, 0x47, 0x8E, 0x89, 0x82, 0x07, 0x81, 0x8B, 0x49, 0x8B, 0x83, 0x07, 0x85, 0x8D,
+    0x49, 0x89, 0x08, 0x84, 0x8A, 0x48, 0x8C, 0x09, 0x86, 0x48, 0x89, 0x08, 0x86, 0x41, 0x86, 0x8C,
+    0x45, 0x08, 0x86, 0x41, 0x82, 0x00, 0x8A, 0x44, 0x83, 0x91, 0x05, 0x86, 0x41, 0x82, 0x00, 0x86,
+    0x44, 0x83, 0x85, 0x40, 0x8B, 0x86, 0x81, 0x02, 0x86, 0x41, 0x82, 0x00, 0x8B, 0x44, 0x81, 0x85,
+    0x43, 0x8D, 0x8A, 0x87, 0x8A, 0x41, 0x8A, 0x8E, 0x44, 0x8C, 0x00, 0x85, 0x50, 0x84, 0x00, 0x85,
+    0x4F, 0x86, 0x01, 0x82, 0x8B, 0x4C, 0x8C, 0x83, 0x04, 0x81, 0x85, 0x89, 0x8B, 0x8D, 0x8E, 0x42,
+    0x8E, 0x8B, 0x88, 0x83, 0x0C, 0x86, 0x41, 0x82, 0x0F, 0x86, 0x41, 0x82, 0x0F, 0x86, 0x41, 0x82,
+    0x0F, 0x86, 0x41, 0x82, 0x07, 0x02, 0x84, 0x8B, 0x8E, 0x40, 0x8E, 0x8B, 0x85, 0x0A, 0x8D, 0x42,
+    0x88, 0x08, 0x89, 0x46, 0x8A, 0x08, 0x87, 0x42, 0x8E, 0x81, 0x07, 0x87, 0x48, 0x88, 0x06, 0x81,
+    0x43, 0x86, 0x08, 0x44, 0x8E, 0x44, 0x82, 0x05, 0x89, 0x42, 0x8D, 0x08, 0x85, 0x43, 0x88, 0x00,
+    0x86, 0x43, 0x88, 0x04, 0x82, 0x43, 0x85, 0x08, 0x88, 0x43, 0x81, 0x01, 0x8E, 0x42, 0x8C, 0x04,
+    0x8B, 0x42, 0x8C, 0x09, 0x8B, 0x43, 0x02, 0x8B, 0x42, 0x8E, 0x03, 0x83, 0x43, 0x83, 0x09, 0x8C,
+    0x42, 0x8D, 0x02, 0x8A, 0x43, 0x03, 0x8C, 0x42, 0x8A, 0x0A, 0x8D, 0x42, 0x8D, 0x02, 0x89, 0x43,
+    0x02, 0x85, 0x43, 0x81, 0x0A, 0x8C, 0x42, 0x8D, 0x02, 0x8A, 0x43, 0x02, 0x8E, 0x42, 0x88, 0x0B,
+    0x8B, 0x43, 0x02, 0x8B, 0x42, 0x8E, 0x01, 0x87, 0x42, 0x8E, 0x01, 0x84, 0x8B, 0x8E, 0x40, 0x8E,
+    0x8B, 0x85, 0x03, 0x88, 0x43, 0x81, 0x01, 0x8E, 0x42, 0x8C, 0x00, 0x81, 0x43, 0x86, 0x00, 0x89,
+    0x46, 0x8A, 0x02, 0x84, 0x43, 0x88, 0x00, 0x85, 0x43, 0x88, 0x00, 0x89, 0x42, 0x8D, 0x00, 0x87,
+    0x48, 0x88, 0x02, 0x8E, 0x43, 0x8E, 0x44, 0x92, 0x43, 0x84, 0x00, 0x4A, 0x82, 0x01, 0x85, 0x48,
+    0x89, 0x00, 0x8B, 0x42, 0x8B, 0x00, 0x85, 0x43, 0x89, 0x00, 0x86, 0x43, 0x88, 0x02, 0x87, 0x46,
+    0x8B, 0x00, 0x84, 0x43, 0x83, 0x00, 0x88, 0x43, 0x82, 0x01, 0x8E, 0x42, 0x8C, 0x03, 0x83, 0x8A,
+    0x8E, 0x40, 0x8E, 0x8B, 0x85, 0x01, 0x8C, 0x42, 0x8A, 0x01, 0x8B, 0x43, 0x02, 0x8B, 0x42, 0x8E,
+    0x0B, 0x86, 0x43, 0x81, 0x01, 0x8C, 0x42, 0x8D, 0x02, 0x8A, 0x43, 0x0B, 0x8E, 0x42, 0x88, 0x02,
+    0x8D, 0x42, 0x8D, 0x02, 0x89, 0x43, 0x0A, 0x87, 0x42, 0x8E, 0x03, 0x8C, 0x42, 0x8D, 0x02, 0x8A,
+    0x43, 0x09, 0x81, 0x43, 0x86, 0x03, 0x8B, 0x43, 0x02, 0x8B, 0x42, 0x8E, 0x09, 0x89, 0x42, 0x8D,
+    0x04, 0x88, 0x43, 0x81, 0x01, 0x8E, 0x42, 0x8C, 0x08, 0x82, 0x43, 0x84, 0x04, 0x84, 0x43, 0x88,
+    0x00, 0x85, 0x43, 0x88, 0x08, 0x8B, 0x42, 0x8B, 0x06, 0x8E, 0x43, 0x8D, 0x44, 0x82, 0x07, 0x84,
+    0x43, 0x82, 0x06, 0x85, 0x48, 0x89, 0x08, 0x8D, 0x42, 0x89, 0x08, 0x87, 0x46, 0x8B, 0x08, 0x86,
+    0x43, 0x81, 0x09, 0x83, 0x8A, 0x8E, 0x40, 0x8E, 0x8B, 0x85, 0x03, 0x05, 0x82, 0x88, 0x8C, 0x8E,
+    0x41, 0x8D, 0x8A, 0x85, 0x11, 0x89, 0x48, 0x8D, 0x83, 0x0E, 0x8B, 0x4B, 0x83, 0x0C, 0x87, 0x4C,
+    0x8D, 0x0C, 0x8D, 0x44, 0x89, 0x86, 0x88, 0x8E, 0x44, 0x82, 0x0A, 0x81, 0x44, 0x86, 0x02, 0x82,
+    0x44, 0x85, 0x0A, 0x82, 0x44, 0x81, 0x03, 0x8E, 0x43, 0x85, 0x0B, 0x44, 0x83, 0x02, 0x81, 0x44,
+    0x82, 0x0B, 0x8D, 0x43, 0x89, 0x02, 0x8B, 0x43, 0x8D, 0x0C, 0x87, 0x44, 0x83, 0x82, 0x8C, 0x44,
+    0x85, 0x0D, 0x8E, 0x43, 0x8E, 0x45, 0x8A, 0x0E, 0x84, 0x49, 0x8A, 0x10, 0x8C, 0x47, 0x86, 0x0F,
+    0x83, 0x8D, 0x47, 0x84, 0x05, 0x8A, 0x44, 0x83, 0x02, 0x85, 0x49, 0x8E, 0x83, 0x04, 0x44, 0x8E,
+    0x02, 0x83, 0x4C, 0x85, 0x02, 0x86, 0x44, 0x88, 0x02, 0x8C, 0x44, 0x8D, 0x82, 0x88, 0x45, 0x87,
+    0x01, 0x8D, 0x44, 0x81, 0x01, 0x82, 0x45, 0x81, 0x01, 0x86, 0x45, 0x88, 0x87, 0x44, 0x8A, 0x02,
+    0x86, 0x44, 0x89, 0x03, 0x84, 0x4B, 0x82, 0x02, 0x87, 0x44, 0x88, 0x04, 0x82, 0x8E, 0x48, 0x88,
+    0x03, 0x86, 0x44, 0x8D, 0x05, 0x81, 0x8D, 0x46, 0x8D, 0x04, 0x83, 0x45, 0x8B, 0x83, 0x03, 0x83,
+    0x89, 0x46, 0x82, 0x05, 0x8E, 0x46, 0x8E, 0x8C, 0x8D, 0x49, 0x8A, 0x05, 0x85, 0x54, 0x8B, 0x05,
+    0x86, 0x54, 0x8C, 0x81, 0x04, 0x83, 0x8D, 0x4A, 0x8D, 0x85, 0x82, 0x8E, 0x44, 0x8C, 0x81, 0x05,
+    0x83, 0x88, 0x8B, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x87, 0x82, 0x02, 0x82, 0x8E, 0x44, 0x8D, 0x81,
+    0x87, 0x43, 0x89, 0x86, 0x43, 0x88, 0x85, 0x43, 0x87, 0x84, 0x43, 0x85, 0x83, 0x43, 0x84, 0x81,
+    0x43, 0x83, 0x00, 0x43, 0x82, 0x00, 0x43, 0x81, 0x00, 0x8E, 0x42, 0x01, 0x8C, 0x41, 0x8E, 0x00,
+    0x04, 0x84, 0x43, 0x86, 0x03, 0x81, 0x8E, 0x42, 0x8B, 0x04, 0x8A, 0x43, 0x82, 0x03, 0x84, 0x43,
+    0x89, 0x04, 0x8C, 0x43, 0x81, 0x03, 0x84, 0x43, 0x8A, 0x04, 0x8A, 0x43, 0x84, 0x03, 0x81, 0x43,
+    0x8E, 0x04, 0x85, 0x43, 0x89, 0x04, 0x8A, 0x43, 0x85, 0x04, 0x8D, 0x43, 0x81, 0x04, 0x43, 0x8E,
+    0x04, 0x83, 0x43, 0x8B, 0x04, 0x85, 0x43, 0x8A, 0x04, 0x86, 0x43, 0x88, 0x04, 0x87, 0x43, 0x87,
+    0x04, 0x87, 0x43, 0x87, 0x04, 0x87, 0x43, 0x87, 0x04, 0x86, 0x43, 0x88, 0x04, 0x85, 0x43, 0x89,
+    0x04, 0x83, 0x43, 0x8B, 0x04, 0x81, 0x43, 0x8E, 0x05, 0x8E, 0x43, 0x81, 0x04, 0x8A, 0x43, 0x84,
+    0x04, 0x86, 0x43, 0x89, 0x04, 0x81, 0x43, 0x8D, 0x05, 0x8B, 0x43, 0x83, 0x04, 0x85, 0x43, 0x89,
+    0x05, 0x8D, 0x43, 0x81, 0x04, 0x85, 0x43, 0x88, 0x05, 0x8B, 0x43, 0x82, 0x04, 0x82, 0x8E, 0x42,
+    0x8B, 0x05, 0x84, 0x43, 0x85, 0x88, 0x43, 0x82, 0x05, 0x8D, 0x42, 0x8D, 0x05, 0x84, 0x43, 0x88,
+    0x05, 0x8B, 0x43, 0x82, 0x04, 0x83, 0x43, 0x8A, 0x05, 0x8C, 0x43, 0x82, 0x04, 0x86, 0x43, 0x88,
+    0x04, 0x81, 0x43, 0x8E, 0x05, 0x8B, 0x43, 0x83, 0x04, 0x87, 0x43, 0x87, 0x04, 0x83, 0x43, 0x8B,
+    0x05, 0x43, 0x8E, 0x05, 0x8E, 0x43, 0x81, 0x04, 0x8C, 0x43, 0x82, 0x04, 0x8A, 0x43, 0x84, 0x04,
+    0x89, 0x43, 0x85, 0x04, 0x89, 0x43, 0x85, 0x04, 0x89, 0x43, 0x85, 0x04, 0x8A, 0x43, 0x84, 0x04,
+    0x8B, 0x43, 0x83, 0x04, 0x8D, 0x43, 0x81, 0x04, 0x44, 0x04, 0x83, 0x43, 0x8C, 0x04, 0x86, 0x43,
+    0x88, 0x04, 0x8B, 0x43, 0x84, 0x04, 0x44, 0x04, 0x85, 0x43, 0x89, 0x04, 0x8C, 0x43, 0x83, 0x03,
+    0x83, 0x43, 0x8B, 0x04, 0x8A, 0x43, 0x83, 0x03, 0x83, 0x43, 0x89, 0x04, 0x8C, 0x42, 0x8D, 0x81,
+    0x03, 0x87, 0x43, 0x83, 0x04, 0x06, 0x43, 0x8B, 0x0D, 0x8E, 0x42, 0x89, 0x0D, 0x8D, 0x42, 0x87,
+    0x0D, 0x8B, 0x42, 0x86, 0x0D, 0x89, 0x42, 0x84, 0x06, 0x83, 0x8D, 0x88, 0x84, 0x02, 0x87, 0x42,
+    0x82, 0x01, 0x81, 0x85, 0x89, 0x8D, 0x00, 0x85, 0x43, 0x8B, 0x86, 0x87, 0x42, 0x84, 0x87, 0x8C,
+    0x43, 0x81, 0x88, 0x50, 0x83, 0x8A, 0x50, 0x86, 0x88, 0x8B, 0x8C, 0x8E, 0x4A, 0x8E, 0x8D, 0x8B,
+    0x85, 0x04, 0x81, 0x8D, 0x44, 0x89, 0x0A, 0x89, 0x46, 0x84, 0x08, 0x84, 0x43, 0x89, 0x42, 0x8E,
+    0x81, 0x06, 0x81, 0x8E, 0x42, 0x8A, 0x81, 0x43, 0x8B, 0x06, 0x8B, 0x43, 0x83, 0x00, 0x88, 0x43,
+    0x87, 0x04, 0x86, 0x43, 0x8C, 0x01, 0x81, 0x44, 0x82, 0x04, 0x85, 0x8D, 0x41, 0x85, 0x02, 0x89,
+    0x41, 0x8C, 0x83, 0x07, 0x86, 0x8C, 0x03, 0x82, 0x8D, 0x85, 0x17, 0x07, 0xB3, 0x0E, 0x83, 0x42,
+    0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42,
+    0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x07, 0x85, 0x51, 0x81, 0x85, 0x51, 0x81,
+    0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x00, 0xD1, 0x83, 0x42, 0x8E, 0xE1, 0x07, 0x83, 0x42, 0x8E,
+    0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E,
+    0x0E, 0x83, 0x42, 0x8E, 0x0F, 0xA3, 0x82, 0x07, 0x01, 0x44, 0x86, 0x00, 0x83, 0x44, 0x82, 0x00,
+    0x86, 0x43, 0x8D, 0x01, 0x89, 0x43, 0x88, 0x01, 0x8C, 0x43, 0x82, 0x01, 0x43, 0x8C, 0x01, 0x84,
+    0x43, 0x85, 0x01, 0x87, 0x42, 0x8E, 0x02, 0x8B, 0x42, 0x87, 0x02, 0x8E, 0x48, 0x81, 0x8E, 0x48,
+    0x81, 0x8E, 0x48, 0x81, 0x8E, 0x48, 0x81, 0x88, 0xFA, 0x8A, 0x00, 0x01, 0x82, 0x84, 0x82, 0x01,
+    0x81, 0x8C, 0x42, 0x8A, 0x00, 0x89, 0x44, 0x86, 0x8C, 0x44, 0x89, 0x8B, 0x44, 0x89, 0x86, 0x44,
+    0x83, 0x00, 0x87, 0x8D, 0x40, 0x8D, 0x85, 0x00, 0x09, 0x8D, 0x43, 0x85, 0x08, 0x82, 0x43, 0x8E,
+    0x09, 0x89, 0x43, 0x89, 0x09, 0x8E, 0x43, 0x83, 0x08, 0x85, 0x43, 0x8D, 0x09, 0x8B, 0x43, 0x87,
+    0x08, 0x81, 0x44, 0x81, 0x08, 0x86, 0x43, 0x8B, 0x09, 0x8C, 0x43, 0x85, 0x08, 0x82, 0x43, 0x8E,
+    0x09, 0x88, 0x43, 0x89, 0x09, 0x8E, 0x43, 0x83, 0x08, 0x84, 0x43, 0x8D, 0x09, 0x8A, 0x43, 0x87,
+    0x08, 0x81, 0x44, 0x81, 0x08, 0x86, 0x43, 0x8B, 0x09, 0x8C, 0x43, 0x85, 0x08, 0x82, 0x43, 0x8E,
+    0x09, 0x88, 0x43, 0x89, 0x09, 0x8E, 0x43, 0x83, 0x08, 0x84, 0x43, 0x8D, 0x09, 0x8A, 0x43, 0x87,
+    0x08, 0x81, 0x44, 0x81, 0x08, 0x86, 0x43, 0x8B, 0x09, 0x8C, 0x43, 0x85, 0x08, 0x82, 0x43, 0x8E,
+    0x09, 0x88, 0x43, 0x89, 0x09, 0x04, 0x81, 0x87, 0x8B, 0x8E, 0x40, 0x8E, 0x8D, 0x8A, 0x84, 0x09,
+    0x87, 0x48, 0x8C, 0x82, 0x06, 0x89, 0x4A, 0x8E, 0x82, 0x04, 0x86, 0x4C, 0x8E, 0x04, 0x8E, 0x44,
+    0x8E, 0x9B, 0x45, 0x88, 0x02, 0x86, 0x44, 0x8B, 0x02, 0x83, 0x8E, 0x44, 0x02, 0x8B, 0x44, 0x81,
+    0x03, 0x86, 0x44, 0x85, 0x01, 0x44, 0x8B, 0x05, 0x44, 0x8A, 0x00, 0x83, 0x44, 0x87, 0x05, 0x8C,
+    0x43, 0x8E, 0x00, 0x85, 0x44, 0x84, 0x05, 0x89, 0x44, 0x00, 0x87, 0x44, 0x83, 0x05, 0x88, 0x44,
+    0x82, 0x88, 0x44, 0x81, 0x05, 0x86, 0x44, 0x83, 0x89, 0x44, 0x81, 0x05, 0x86, 0x44, 0x84, 0x89,
+    0x44, 0x81, 0x05, 0x86, 0x44, 0x85, 0x89, 0x44, 0x81, 0x05, 0x86, 0x44, 0x84, 0x88, 0x44, 0x81,
+    0x05, 0x86, 0x44, 0x84, 0x87, 0x44, 0x82, 0x05, 0x88, 0x44, 0x83, 0x85, 0x44, 0x84, 0x05, 0x89,
+    0x44, 0x81, 0x82, 0x44, 0x86, 0x05, 0x8C, 0x43, 0x8E, 0x01, 0x44, 0x8A, 0x05, 0x44, 0x8B, 0x01,
+    0x8A, 0x44, 0x81, 0x03, 0x86, 0x44, 0x87, 0x01, 0x85, 0x44, 0x8B, 0x02, 0x82, 0x8E, 0x44, 0x82,
+    0x02, 0x8D, 0x44, 0x8E, 0x8A, 0x8B, 0x45, 0x8A, 0x03, 0x84, 0x4D, 0x82, 0x04, 0x87, 0x4B, 0x84,
+    0x06, 0x85, 0x8E, 0x47, 0x8D, 0x84, 0x08, 0x81, 0x86, 0x8B, 0x8D, 0x41, 0x8D, 0x8A, 0x85, 0x05,
+    0x07, 0x89, 0x43, 0x8B, 0x05, 0x81, 0x8C, 0x44, 0x8B, 0x04, 0x83, 0x8E, 0x45, 0x8B, 0x03, 0x86,
+    0x47, 0x8B, 0x02, 0x8A, 0x48, 0x8B, 0x00, 0x82, 0x8C, 0x49, 0x8B, 0x84, 0x8E, 0x44, 0x89, 0x8E,
+    0x43, 0x8B, 0x84, 0x44, 0x88, 0x00, 0x44, 0x8B, 0x00, 0x88, 0x42, 0x86, 0x01, 0x44, 0x8B, 0x01,
+    0x8B, 0x8E, 0x83, 0x02, 0x44, 0x8B, 0x02, 0x81, 0x03, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44,
+    0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B,
+    0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07,
+    0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x04, 0x84, 0x88, 0x8C, 0x8E,
+    0x41, 0x8D, 0x8B, 0x87, 0x81, 0x07, 0x85, 0x8D, 0x49, 0x88, 0x04, 0x81, 0x8B, 0x4C, 0x8B, 0x02,
+    0x82, 0x8E, 0x4E, 0x89, 0x01, 0x81, 0x8E, 0x45, 0x8E, 0x8D, 0x8E, 0x46, 0x82, 0x01, 0x83, 0x43,
+    0x8A, 0x83, 0x02, 0x83, 0x8D, 0x44, 0x87, 0x02, 0x85, 0x40, 0x8D, 0x83, 0x05, 0x84, 0x44, 0x8A,
+    0x03, 0x84, 0x08, 0x44, 0x8B, 0x0D, 0x44, 0x89, 0x0C, 0x83, 0x44, 0x86, 0x0C, 0x8A, 0x44, 0x81,
+    0x0B, 0x84, 0x44, 0x8A, 0x0B, 0x81, 0x8E, 0x44, 0x81, 0x0A, 0x81, 0x8D, 0x44, 0x85, 0x0A, 0x81,
+    0x8C, 0x44, 0x88, 0x0A, 0x81, 0x8C, 0x44, 0x89, 0x0A, 0x81, 0x8C, 0x44, 0x89, 0x0A, 0x81, 0x8C,
+    0x44, 0x88, 0x0A, 0x81, 0x8D, 0x44, 0x86, 0x0A, 0x81, 0x8D, 0x44, 0x85, 0x0A, 0x81, 0x8D, 0x44,
+    0x84, 0x0A, 0x81, 0x8D, 0x43, 0x8E, 0x83, 0x0A, 0x81, 0x8D, 0x45, 0xFD, 0xAD, 0x86, 0x87, 0x51,
+    0x97, 0x51, 0x97, 0x51, 0x97, 0x51, 0x87, 0x03, 0x84, 0x88, 0x8C, 0x8D, 0x41, 0x8E, 0x8D, 0x8B,
+    0x87, 0x81, 0x06, 0x88, 0x8E, 0x4A, 0x89, 0x81, 0x02, 0x83, 0x8E, 0x4D, 0x8D, 0x81, 0x01, 0x81,
+    0x8E, 0x4E, 0x8B, 0x02, 0x84, 0x44, 0x8C, 0x8A, 0x8B, 0x8D, 0x46, 0x82, 0x02, 0x89, 0x40, 0x8D,
+    0x86, 0x04, 0x83, 0x8E, 0x44, 0x85, 0x03, 0x86, 0x07, 0x87, 0x44, 0x86, 0x0C, 0x84, 0x44, 0x84,
+    0x0C, 0x85, 0x44, 0x81, 0x0C, 0x8D, 0x43, 0x88, 0x09, 0x81, 0x83, 0x87, 0x8D, 0x43, 0x8C, 0x06,
+    0x86, 0x49, 0x8A, 0x07, 0x86, 0x46, 0x8E, 0x89, 0x82, 0x08, 0x86, 0x47, 0x8D, 0x8A, 0x84, 0x07,
+    0x86, 0x4A, 0x8D, 0x82, 0x05, 0x82, 0xA6, 0x87, 0x89, 0x8C, 0x45, 0x8E, 0x82, 0x0B, 0x81, 0x8B,
+    0x44, 0x8A, 0x0C, 0x81, 0x45, 0x0D, 0x8D, 0x44, 0x82, 0x0C, 0x8E, 0x44, 0x82, 0x81, 0x0A, 0x83,
+    0x45, 0x81, 0x88, 0x8D, 0x87, 0x82, 0x06, 0x84, 0x8E, 0x44, 0x8C, 0x00, 0x88, 0x42, 0x8E, 0x8B,
+    0xA9, 0x8A, 0x8E, 0x46, 0x86, 0x00, 0x88, 0x4F, 0x8C, 0x01, 0x88, 0x4E, 0x8C, 0x02, 0x85, 0x8E,
+    0x4B, 0x8E, 0x86, 0x05, 0x83, 0x87, 0x8A, 0x8D, 0x8E, 0x42, 0x8E, 0x8B, 0x88, 0x84, 0x05, 0x0B,
+    0x8C, 0x43, 0x8D, 0x0E, 0x87, 0x44, 0x8D, 0x0D, 0x82, 0x45, 0x8D, 0x0D, 0x8D, 0x45, 0x8D, 0x0C,
+    0x88, 0x46, 0x8D, 0x0B, 0x83, 0x47, 0x8D, 0x0B, 0x8D, 0x42, 0x8E, 0x43, 0x8D, 0x0A, 0x88, 0x42,
+    0x8D, 0x89, 0x43, 0x8D, 0x09, 0x83, 0x43, 0x84, 0x8A, 0x43, 0x8D, 0x09, 0x8D, 0x42, 0x8A, 0x00,
+    0x8B, 0x43, 0x8D, 0x08, 0x89, 0x42, 0x8E, 0x81, 0x00, 0x8B, 0x43, 0x8D, 0x07, 0x84, 0x43, 0x85,
+    0x01, 0x8C, 0x43, 0x8D, 0x06, 0x81, 0x8E, 0x42, 0x8B, 0x02, 0x8C, 0x43, 0x8D, 0x06, 0x8A, 0x42,
+    0x8E, 0x81, 0x02, 0x8C, 0x43, 0x8D, 0x05, 0x85, 0x43, 0x85, 0x03, 0x8C, 0x43, 0x8D, 0x04, 0x81,
+    0x8E, 0x42, 0x8B, 0x04, 0x8C, 0x43, 0x8D, 0x04, 0x8A, 0x42, 0x8E, 0x81, 0x04, 0x8C, 0x43, 0x8D,
+    0x03, 0x84, 0x53, 0x81, 0x85, 0x53, 0x81, 0x85, 0x53, 0x81, 0x85, 0x53, 0x81, 0x82, 0xF7, 0xA7,
+    0x8D, 0x43, 0x8E, 0xA7, 0x0C, 0x8C, 0x43, 0x8D, 0x0F, 0x8C, 0x43, 0x8D, 0x0F, 0x8C, 0x43, 0x8D,
+    0x0F, 0x8C, 0x43, 0x8D, 0x0F, 0x8C, 0x43, 0x8D, 0x03, 0x01, 0x89, 0x4D, 0x82, 0x02, 0x8B, 0x4D,
+    0x82, 0x02, 0x8C, 0x4D, 0x82, 0x02, 0x8D, 0x4D, 0x82, 0x02, 0x8E, 0x43, 0x8E, 0xFD, 0x8D, 0x81,
+    0x02, 0x44, 0x86, 0x0C, 0x44, 0x84, 0x0B, 0x82, 0x44, 0x83, 0x0B, 0x83, 0x44, 0x81, 0x0B, 0x84,
+    0x44, 0x0C, 0x85, 0x44, 0x8B, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x83, 0x04, 0x86, 0x4C, 0x8B, 0x81,
+    0x02, 0x88, 0x4D, 0x8E, 0x81, 0x01, 0x89, 0x4E, 0x8C, 0x01, 0x81, 0x89, 0x41, 0x8D, 0x8C, 0x9A,
+    0x8C, 0x47, 0x84, 0x02, 0x81, 0x06, 0x86, 0x45, 0x8A, 0x0B, 0x84, 0x44, 0x8D, 0x0C, 0x8E, 0x44,
+    0x0C, 0x8C, 0x43, 0x8E, 0x0C, 0x8E, 0x43, 0x8D, 0x0B, 0x85, 0x44, 0x8A, 0x82, 0x40, 0x89, 0x84,
+    0x06, 0x86, 0x45, 0x85, 0x82, 0x43, 0x8E, 0x8B, 0x9A, 0x8C, 0x46, 0x8D, 0x00, 0x82, 0x4F, 0x84,
+    0x00, 0x82, 0x4E, 0x85, 0x01, 0x81, 0x8D, 0x4B, 0x8B, 0x82, 0x04, 0x83, 0x87, 0x8B, 0x8D, 0x8E,
+    0x41, 0x8E, 0x8D, 0x8A, 0x87, 0x82, 0x04, 0x07, 0x82, 0x86, 0x8A, 0x8D, 0x8E, 0x42, 0x8E, 0x87,
+    0x07, 0x84, 0x8C, 0x48, 0x89, 0x06, 0x8A, 0x4A, 0x89, 0x04, 0x81, 0x8C, 0x4B, 0x89, 0x04, 0x8B,
+    0x46, 0x8C, 0x89, 0xA8, 0x8A, 0x87, 0x03, 0x86, 0x45, 0x86, 0x0B, 0x8E, 0x43, 0x8D, 0x82, 0x0B,
+    0x85, 0x44, 0x83, 0x0C, 0x8B, 0x43, 0x88, 0x0D, 0x44, 0x82, 0x0C, 0x82, 0x43, 0x8E, 0x01, 0x84,
+    0x8A, 0x8D, 0x41, 0x8D, 0x89, 0x83, 0x03, 0x86, 0x43, 0x8C, 0x00, 0x8A, 0x47, 0x89, 0x02, 0x87,
+    0x43, 0x9A, 0x49, 0x8A, 0x01, 0x88, 0x50, 0x86, 0x00, 0x89, 0x46, 0x8B, 0x87, 0x86, 0x88, 0x8E,
+    0x44, 0x8D, 0x00, 0x8A, 0x45, 0x84, 0x03, 0x81, 0x8E, 0x44, 0x82, 0x89, 0x44, 0x85, 0x05, 0x86,
+    0x44, 0x85, 0x88, 0x44, 0x81, 0x05, 0x82, 0x44, 0x87, 0x86, 0x44, 0x81, 0x05, 0x81, 0x44, 0x87,
+    0x83, 0x44, 0x85, 0x05, 0x83, 0x44, 0x85, 0x00, 0x8E, 0x43, 0x8C, 0x05, 0x89, 0x44, 0x83, 0x00,
+    0x88, 0x44, 0x8A, 0x03, 0x84, 0x44, 0x8E, 0x01, 0x81, 0x45, 0x8E, 0x8A, 0x89, 0x8C, 0x45, 0x88,
+    0x02, 0x85, 0x4D, 0x8D, 0x04, 0x87, 0x4B, 0x8E, 0x82, 0x05, 0x84, 0x8E, 0x48, 0x8B, 0x81, 0x08,
+    0x85, 0x8A, 0x8D, 0x41, 0x8E, 0x8C, 0x88, 0x83, 0x04, 0x52, 0x87, 0x52, 0x87, 0x52, 0x87, 0x52,
+    0x87, 0xFD, 0xCD, 0x8E, 0x44, 0x81, 0x0C, 0x8E, 0x43, 0x8A, 0x0C, 0x85, 0x44, 0x83, 0x0C, 0x8D,
+    0x43, 0x8C, 0x0C, 0x84, 0x44, 0x85, 0x0C, 0x8B, 0x43, 0x8E, 0x0C, 0x83, 0x44, 0x87, 0x0C, 0x8A,
+    0x44, 0x81, 0x0B, 0x82, 0x44, 0x89, 0x0C, 0x89, 0x44, 0x82, 0x0B, 0x81, 0x44, 0x8B, 0x0C, 0x88,
+    0x44, 0x84, 0x0C, 0x8E, 0x43, 0x8D, 0x0C, 0x86, 0x44, 0x86, 0x0C, 0x8D, 0x43, 0x8E, 0x0C, 0x85,
+    0x44, 0x88, 0x0C, 0x8C, 0x44, 0x81, 0x0B, 0x84, 0x44, 0x8A, 0x0C, 0x8B, 0x44, 0x83, 0x0B, 0x82,
+    0x44, 0x8C, 0x0C, 0x8A, 0x44, 0x85, 0x0B, 0x81, 0x44, 0x8D, 0x0C, 0x88, 0x44, 0x87, 0x09, 0x04,
+    0x83, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8B, 0x88, 0x82, 0x07, 0x82, 0x8C, 0x49, 0x8A, 0x81, 0x04,
+    0x84, 0x4C, 0x8D, 0x81, 0x02, 0x81, 0x8E, 0x4D, 0x8B, 0x02, 0x87, 0x44, 0x8D, 0x86, 0x83, 0x84,
+    0x88, 0x45, 0x83, 0x01, 0x8B, 0x43, 0x8E, 0x81, 0x03, 0x84, 0x44, 0x86, 0x01, 0x8C, 0x43, 0x8A,
+    0x05, 0x8E, 0x43, 0x88, 0x01, 0x8B, 0x43, 0x8B, 0x05, 0x44, 0x86, 0x01, 0x87, 0x44, 0x82, 0x03,
+    0x86, 0x44, 0x82, 0x01, 0x81, 0x44, 0x8E, 0x84, 0x01, 0x87, 0x44, 0x8A, 0x03, 0x86, 0x45, 0x8C,
+    0x8D, 0x44, 0x8D, 0x81, 0x04, 0x87, 0x4A, 0x8B, 0x81, 0x06, 0x84, 0x8E, 0x47, 0x86, 0x08, 0x87,
+    0x8E, 0x47, 0x8B, 0x82, 0x05, 0x81, 0x8C, 0x4B, 0x85, 0x03, 0x81, 0x8D, 0x44, 0x8E, 0x87, 0x8C,
+    0x45, 0x87, 0x02, 0x8B, 0x44, 0x88, 0x02, 0x86, 0x45, 0x84, 0x00, 0x82, 0x44, 0x87, 0x04, 0x82,
+    0x8E, 0x43, 0x8D, 0x00, 0x87, 0x43, 0x8E, 0x06, 0x84, 0x44, 0x83, 0x89, 0x43, 0x8A, 0x07, 0x44,
+    0x85, 0x89, 0x43, 0x8C, 0x06, 0x81, 0x44, 0x84, 0x87, 0x44, 0x85, 0x05, 0x8A, 0x44, 0x82, 0x83,
+    0x45, 0x8B, 0x85, 0x94, 0x86, 0x8C, 0x44, 0x8C, 0x01, 0x8A, 0x4F, 0x83, 0x01, 0x81, 0x8C, 0x4D,
+    0x85, 0x04, 0x88, 0x4A, 0x8C, 0x83, 0x06, 0x81, 0x86, 0x8A, 0x8D, 0x8E, 0x41, 0x8E, 0x8C, 0x88,
+    0x83, 0x04, 0x04, 0x85, 0x89, 0x8D, 0x8E, 0x40, 0x8E, 0x8C, 0x89, 0x83, 0x08, 0x84, 0x8D, 0x48,
+    0x8B, 0x81, 0x05, 0x86, 0x4B, 0x8E, 0x83, 0x03, 0x83, 0x4D, 0x8E, 0x81, 0x02, 0x8C, 0x45, 0x8B,
+    0x8A, 0x8B, 0x45, 0x8B, 0x01, 0x83, 0x44, 0x8E, 0x82, 0x02, 0x82, 0x8D, 0x44, 0x83, 0x00, 0x88,
+    0x44, 0x84, 0x04, 0x82, 0x44, 0x89, 0x00, 0x8A, 0x44, 0x06, 0x8A, 0x43, 0x8E, 0x00, 0x8C, 0x43,
+    0x8D, 0x06, 0x86, 0x44, 0x81, 0x8B, 0x43, 0x8D, 0x06, 0x85, 0x44, 0x84, 0x8A, 0x44, 0x81, 0x05,
+    0x8A, 0x44, 0x85, 0x87, 0x44, 0x8A, 0x04, 0x88, 0x45, 0x85, 0x82, 0x45, 0x8C, 0x87, 0x86, 0x88,
+    0x8D, 0x46, 0x85, 0x00, 0x8B, 0x50, 0x84, 0x00, 0x81, 0x8E, 0x49, 0x86, 0x44, 0x83, 0x01, 0x82,
+    0x8D, 0x47, 0x87, 0x81, 0x44, 0x81, 0x03, 0x85, 0x8B, 0x8E, 0x41, 0x8D, 0x89, 0x83, 0x00, 0x83,
+    0x43, 0x8E, 0x0D, 0x88, 0x43, 0x8B, 0x0D, 0x8D, 0x43, 0x87, 0x0C, 0x87, 0x44, 0x81, 0x0B, 0x85,
+    0x44, 0x8A, 0x0A, 0x81, 0x89, 0x45, 0x82, 0x03, 0x8A, 0x89, 0x88, 0x87, 0x88, 0x89, 0x8C, 0x46,
+    0x87, 0x04, 0x8E, 0x4B, 0x89, 0x05, 0x8E, 0x4A, 0x87, 0x06, 0x8E, 0x48, 0x8A, 0x82, 0x07, 0x8B,
+    0x8E, 0x42, 0x8D, 0x8C, 0x8A, 0x85, 0x81, 0x07, 0x00, 0x87, 0x8D, 0x40, 0x8D, 0x85, 0x00, 0x86,
+    0x44, 0x84, 0x8B, 0x44, 0x89, 0x8C, 0x44, 0x89, 0x88, 0x44, 0x86, 0x81, 0x8C, 0x42, 0x8A, 0x02,
+    0x82, 0x84, 0x82, 0x34, 0x82, 0x84, 0x82, 0x01, 0x81, 0x8C, 0x42, 0x8A, 0x00, 0x89, 0x44, 0x86,
+    0x8C, 0x44, 0x89, 0x8B, 0x44, 0x89, 0x86, 0x44, 0x83, 0x00, 0x87, 0x8D, 0x40, 0x8D, 0x85, 0x00,
+    0x01, 0x87, 0x8D, 0x40, 0x8D, 0x85, 0x01, 0x86, 0x44, 0x84, 0x00, 0x8B, 0x44, 0x89, 0x00, 0x8C,
+    0x44, 0x89, 0x00, 0x88, 0x44, 0x86, 0x00, 0x81, 0x8C, 0x42, 0x8A, 0x03, 0x82, 0x84, 0x82, 0x3F,
+    0x13, 0x44, 0x86, 0x00, 0x83, 0x44, 0x82, 0x00, 0x86, 0x43, 0x8D, 0x01, 0x89, 0x43, 0x88, 0x01,
+    0x8C, 0x43, 0x82, 0x01, 0x43, 0x8C, 0x01, 0x84, 0x43, 0x85, 0x01, 0x87, 0x42, 0x8E, 0x02, 0x8B,
+    0x42, 0x87, 0x02, 0x10, 0x81, 0x88, 0x0F, 0x81, 0x88, 0x41, 0x81, 0x0C, 0x81, 0x88, 0x43, 0x81,
+    0x0A, 0x81, 0x88, 0x45, 0x81, 0x08, 0x81, 0x88, 0x46, 0x8D, 0x07, 0x81, 0x88, 0x46, 0x8C, 0x85,
+    0x06, 0x81, 0x88, 0x46, 0x8B, 0x84, 0x06, 0x81, 0x88, 0x46, 0x8A, 0x83, 0x06, 0x81, 0x88, 0x46,
+    0x89, 0x82, 0x07, 0x84, 0x45, 0x8E, 0x88, 0x81, 0x09, 0x85, 0x44, 0x8D, 0x81, 0x0B, 0x85, 0x46,
+    0x89, 0x83, 0x0A, 0x86, 0x8D, 0x46, 0x8C, 0x86, 0x0A, 0x84, 0x8B, 0x46, 0x8E, 0x89, 0x82, 0x09,
+    0x82, 0x89, 0x47, 0x8B, 0x85, 0x09, 0x81, 0x87, 0x8E, 0x46, 0x8E, 0x88, 0x0A, 0x86, 0x8D, 0x46,
+    0x81, 0x0B, 0x84, 0x8B, 0x44, 0x81, 0x0D, 0x82, 0x89, 0x42, 0x81, 0x0F, 0x81, 0x87, 0x8E, 0x81,
+    0x13, 0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x00, 0xF1, 0xF1,
+    0x91, 0x15, 0xF1, 0xF1, 0x91, 0x00, 0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x85,
+    0x51, 0x81, 0x84, 0x86, 0x11, 0x85, 0x40, 0x8E, 0x86, 0x0F, 0x85, 0x42, 0x8E, 0x86, 0x0D, 0x85,
+    0x44, 0x8E, 0x86, 0x0B, 0x84, 0x46, 0x8E, 0x86, 0x0A, 0x81, 0x87, 0x8E, 0x45, 0x8E, 0x86, 0x0B,
+    0x86, 0x8D, 0x45, 0x8E, 0x86, 0x0B, 0x85, 0x8C, 0x45, 0x8E, 0x86, 0x0B, 0x84, 0x8B, 0x45, 0x8E,
+    0x86, 0x0B, 0x83, 0x8A, 0x45, 0x8E, 0x0C, 0x84, 0x45, 0x81, 0x09, 0x85, 0x8B, 0x46, 0x81, 0x06,
+    0x81, 0x88, 0x8E, 0x46, 0x8B, 0x84, 0x05, 0x84, 0x8B, 0x47, 0x89, 0x82, 0x04, 0x81, 0x87, 0x8D,
+    0x46, 0x8E, 0x87, 0x81, 0x04, 0x82, 0x8A, 0x47, 0x8C, 0x85, 0x07, 0x85, 0x46, 0x8B, 0x84, 0x09,
+    0x85, 0x44, 0x89, 0x82, 0x0B, 0x85, 0x41, 0x8E, 0x87, 0x0E, 0x85, 0x8C, 0x85, 0x24, 0x02, 0x82,
+    0x86, 0x8A, 0x8D, 0x8E, 0x41, 0x8E, 0x8B, 0x87, 0x82, 0x04, 0x85, 0x8C, 0x4A, 0x89, 0x02, 0x8A,
+    0x4D, 0x8C, 0x01, 0x84, 0x4E, 0x88, 0x01, 0x8C, 0x43, 0x8C, 0x8A, 0x89, 0x8A, 0x8E, 0x44, 0x8E,
+    0x01, 0x84, 0x40, 0x8B, 0x85, 0x05, 0x8A, 0x44, 0x82, 0x01, 0x82, 0x07, 0x83, 0x44, 0x82, 0x0A,
+    0x84, 0x44, 0x0B, 0x8C, 0x43, 0x8B, 0x09, 0x81, 0x8C, 0x44, 0x83, 0x08, 0x85, 0x8E, 0x44, 0x85,
+    0x08, 0x8A, 0x44, 0x8E, 0x83, 0x08, 0x8B, 0x44, 0x8A, 0x81, 0x08, 0x85, 0x44, 0x86, 0x0A, 0x8B,
+    0x43, 0x87, 0x0B, 0x8D, 0x43, 0x81, 0x0B, 0x8E, 0x43, 0x3F, 0x03, 0x81, 0x84, 0x83, 0x0D, 0x88,
+    0x42, 0x8D, 0x82, 0x0A, 0x83, 0x44, 0x8B, 0x0A, 0x86, 0x45, 0x0A, 0x85, 0x44, 0x8E, 0x0A, 0x81,
+    0x44, 0x89, 0x0B, 0x83, 0x8C, 0x40, 0x8E, 0x89, 0x07, 0x0A, 0x81, 0x86, 0x8A, 0x8C, 0x8E, 0x41,
+    0x8E, 0x8D, 0x8A, 0x87, 0x82, 0x11, 0x84, 0x8C, 0x4B, 0x8C, 0x85, 0x0D, 0x82, 0x8C, 0x4F, 0x8B,
+    0x81, 0x0A, 0x86, 0x46, 0x8C, 0x89, 0x98, 0x89, 0x8B, 0x45, 0x8E, 0x83, 0x08, 0x88, 0x44, 0x8A,
+    0x84, 0x07, 0x85, 0x8C, 0x43, 0x8E, 0x82, 0x06, 0x86, 0x43, 0x8C, 0x83, 0x0B, 0x87, 0x43, 0x8D,
+    0x05, 0x83, 0x43, 0x8A, 0x0E, 0x85, 0x43, 0x87, 0x04, 0x8D, 0x42, 0x8C, 0x03, 0x81, 0x87, 0x8B,
+    0x8E, 0x41, 0x8E, 0x8C, 0x8A, 0x87, 0x84, 0x01, 0x88, 0x42, 0x8E, 0x03, 0x85, 0x43, 0x81, 0x02,
+    0x87, 0x4A, 0x88, 0x01, 0x8E, 0x42, 0x85, 0x02, 0x8D, 0x42, 0x87, 0x02, 0x8A, 0x4B, 0x87, 0x01,
+    0x88, 0x42, 0x8A, 0x01, 0x83, 0x43, 0x02, 0x88, 0x44, 0x89, 0x96, 0x88, 0x8E, 0x42, 0x86, 0x01,
+    0x83, 0x42, 0x8E, 0x01, 0x88, 0x42, 0x8A, 0x01, 0x82, 0x43, 0x8C, 0x81, 0x03, 0x8D, 0x42, 0x86,
+    0x02, 0x43, 0x81, 0x00, 0x8B, 0x42, 0x86, 0x01, 0x89, 0x42, 0x8E, 0x81, 0x04, 0x8E, 0x42, 0x85,
+    0x02, 0x8E, 0x42, 0x82, 0x00, 0x8E, 0x42, 0x83, 0x01, 0x8D, 0x42, 0x88, 0x05, 0x43, 0x84, 0x02,
+    0x8E, 0x42, 0x82, 0x00, 0x43, 0x81, 0x01, 0x43, 0x84, 0x05, 0x43, 0x83, 0x02, 0x8E, 0x42, 0x91,
+    0x43, 0x01, 0x81, 0x43, 0x83, 0x04, 0x81, 0x43, 0x83, 0x02, 0x43, 0x00, 0x81, 0x43, 0x02, 0x43,
+    0x84, 0x04, 0x84, 0x43, 0x82, 0x01, 0x82, 0x42, 0x8D, 0x01, 0x43, 0x81, 0x01, 0x8E, 0x42, 0x87,
+    0x04, 0x89, 0x43, 0x82, 0x01, 0x87, 0x42, 0x88, 0x01, 0x8E, 0x42, 0x83, 0x01, 0x8A, 0x42, 0x8E,
+    0x81, 0x02, 0x83, 0x44, 0x85, 0x01, 0x8D, 0x42, 0x83, 0x01, 0x8C, 0x42, 0x87, 0x01, 0x84, 0x43,
+    0x8E, 0x88, 0x86, 0x89, 0x45, 0x8D, 0x87, 0x8C, 0x42, 0x8B, 0x02, 0x88, 0x42, 0x8B, 0x02, 0x8A,
+    0x49, 0x8D, 0x46, 0x8E, 0x82, 0x02, 0x83, 0x43, 0x82, 0x02, 0x8A, 0x46, 0x8E, 0x83, 0x81, 0x8E,
+    0x44, 0x8E, 0x83, 0x04, 0x8D, 0x42, 0x8B, 0x03, 0x83, 0x8A, 0x8D, 0x41, 0x8C, 0x87, 0x02, 0x81,
+    0x89, 0x8E, 0x40, 0x8D, 0x89, 0x81, 0x05, 0x85, 0x43, 0x88, 0x1A, 0x8B, 0x43, 0x8A, 0x0E, 0x81,
+    0x0A, 0x8D, 0x43, 0x8E, 0x87, 0x81, 0x07, 0x81, 0x85, 0x89, 0x8E, 0x8A, 0x0A, 0x81, 0x8C, 0x45,
+    0x8E, 0x8B, 0x8A, 0x99, 0x8A, 0x8C, 0x8E, 0x43, 0x8A, 0x0C, 0x89, 0x50, 0x8A, 0x0D, 0x82, 0x89,
+    0x4D, 0x8B, 0x84, 0x0F, 0x81, 0x84, 0x88, 0x8C, 0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8B, 0x88, 0x85,
+    0x81, 0x08, 0x08, 0x89, 0x45, 0x8C, 0x12, 0x8E, 0x46, 0x82, 0x10, 0x84, 0x47, 0x87, 0x10, 0x8A,
+    0x47, 0x8D, 0x10, 0x44, 0x8D, 0x43, 0x83, 0x0E, 0x86, 0x43, 0x8C, 0x88, 0x43, 0x89, 0x0E, 0x8B,
+    0x43, 0x87, 0x84, 0x43, 0x8E, 0x0D, 0x81, 0x44, 0x83, 0x00, 0x8E, 0x43, 0x84, 0x0C, 0x87, 0x43,
+    0x8E, 0x01, 0x8A, 0x43, 0x8A, 0x0C, 0x8C, 0x43, 0x89, 0x01, 0x85, 0x44, 0x0B, 0x82, 0x44, 0x84,
+    0x02, 0x44, 0x85, 0x0A, 0x88, 0x44, 0x03, 0x8B, 0x43, 0x8B, 0x0A, 0x8D, 0x43, 0x8A, 0x03, 0x86,
+    0x44, 0x81, 0x08, 0x83, 0x44, 0x86, 0x03, 0x81, 0x44, 0x86, 0x08, 0x89, 0x44, 0x81, 0x04, 0x8C,
+    0x43, 0x8C, 0x08, 0x8E, 0x43, 0x8C, 0x05, 0x87, 0x44, 0x82, 0x06, 0x84, 0x51, 0x87, 0x06, 0x8A,
+    0x51, 0x8D, 0x06, 0x53, 0x83, 0x04, 0x85, 0x53, 0x88, 0x04, 0x8B, 0x44, 0xFD, 0x9D, 0x44, 0x8E,
+    0x03, 0x81, 0x44, 0x8E, 0x09, 0x8B, 0x44, 0x84, 0x02, 0x86, 0x44, 0x8A, 0x09, 0x86, 0x44, 0x89,
+    0x02, 0x8C, 0x44, 0x85, 0x09, 0x81, 0x45, 0x01, 0x81, 0x45, 0x0B, 0x8C, 0x44, 0x85, 0x00, 0x87,
+    0x44, 0x8A, 0x0B, 0x87, 0x44, 0x8A, 0x00, 0x8D, 0x44, 0x85, 0x0B, 0x82, 0x45, 0x81, 0x89, 0x48,
+    0x9E, 0x8C, 0x8A, 0x86, 0x81, 0x04, 0x89, 0x4E, 0x8A, 0x82, 0x02, 0x89, 0x50, 0x83, 0x01, 0x89,
+    0x50, 0x8E, 0x01, 0x89, 0x44, 0x8C, 0xAB, 0x8C, 0x47, 0x86, 0x00, 0x89, 0x44, 0x82, 0x04, 0x84,
+    0x8E, 0x44, 0x8B, 0x00, 0x89, 0x44, 0x82, 0x05, 0x85, 0x44, 0x8C, 0x00, 0x89, 0x44, 0x82, 0x05,
+    0x81, 0x44, 0x8C, 0x00, 0x89, 0x44, 0x82, 0x05, 0x82, 0x44, 0x8B, 0x00, 0x89, 0x44, 0x82, 0x05,
+    0x87, 0x44, 0x87, 0x00, 0x89, 0x44, 0x82, 0x03, 0x83, 0x88, 0x45, 0x81, 0x00, 0x89, 0x50, 0x85,
+    0x01, 0x89, 0x4E, 0x8B, 0x83, 0x02, 0x89, 0x4D, 0x8E, 0x89, 0x83, 0x02, 0x89, 0x50, 0x89, 0x01,
+    0x89, 0x44, 0x8A, 0xB9, 0x8B, 0x46, 0x88, 0x00, 0x89, 0x44, 0x82, 0x05, 0x88, 0x45, 0x81, 0x89,
+    0x44, 0x82, 0x06, 0x8B, 0x44, 0x85, 0x89, 0x44, 0x82, 0x06, 0x87, 0x44, 0x87, 0x89, 0x44, 0x82,
+    0x06, 0x88, 0x44, 0x88, 0x89, 0x44, 0x82, 0x06, 0x8D, 0x44, 0x86, 0x89, 0x44, 0x82, 0x04, 0x82,
+    0x8B, 0x45, 0x83, 0x89, 0x44, 0xCC, 0x8E, 0x46, 0x8D, 0x00, 0x89, 0x51, 0x84, 0x00, 0x89, 0x50,
+    0x85, 0x01, 0x89, 0x4E, 0x8C, 0x83, 0x02, 0x89, 0x4A, 0x8E, 0x8B, 0x88, 0x83, 0x04, 0x07, 0x85,
+    0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x85, 0x08, 0x88, 0x4B, 0x8A, 0x83, 0x03, 0x83, 0x8D,
+    0x4D, 0x8A, 0x02, 0x84, 0x4F, 0x83, 0x01, 0x82, 0x8E, 0x46, 0x8E, 0x9D, 0x44, 0x8D, 0x02, 0x8B,
+    0x45, 0x8B, 0x83, 0x03, 0x83, 0x88, 0x8E, 0x40, 0x87, 0x01, 0x84, 0x45, 0x87, 0x08, 0x85, 0x81,
+    0x01, 0x8B, 0x44, 0x8A, 0x0C, 0x81, 0x45, 0x81, 0x0C, 0x85, 0x44, 0x8B, 0x0D, 0x88, 0x44, 0x87,
+    0x0D, 0x8A, 0x44, 0x84, 0x0D, 0x8C, 0x44, 0x82, 0x0D, 0x8C, 0x44, 0x82, 0x0D, 0x8B, 0x44, 0x82,
+    0x0D, 0x8A, 0x44, 0x83, 0x0D, 0x89, 0x44, 0x86, 0x0D, 0x86, 0x44, 0x89, 0x0D, 0x83, 0x44, 0x8E,
+    0x0E, 0x8E, 0x44, 0x87, 0x0D, 0x88, 0x45, 0x84, 0x09, 0x81, 0x01, 0x81, 0x46, 0x89, 0x82, 0x04,
+    0x83, 0x87, 0x8C, 0x8D, 0x02, 0x86, 0x47, 0x8E, 0x8D, 0x8C, 0x8E, 0x43, 0x8D, 0x03, 0x8A, 0x4E,
+    0x8D, 0x04, 0x88, 0x4D, 0x8D, 0x05, 0x84, 0x8C, 0x4B, 0x8A, 0x07, 0x83, 0x87, 0x8B, 0x8D, 0x8E,
+    0x41, 0x8E, 0x8C, 0x89, 0x85, 0x81, 0x01, 0x89, 0x48, 0x8E, 0x8D, 0x8A, 0x87, 0x83, 0x07, 0x89,
+    0x4D, 0x8D, 0x85, 0x05, 0x89, 0x4F, 0x8C, 0x82, 0x03, 0x89, 0x50, 0x8E, 0x84, 0x02, 0x89, 0x44,
+    0x8C, 0xAB, 0x8D, 0x47, 0x8E, 0x82, 0x01, 0x89, 0x44, 0x82, 0x04, 0x84, 0x8B, 0x45, 0x8D, 0x01,
+    0x89, 0x44, 0x82, 0x06, 0x86, 0x45, 0x86, 0x00, 0x89, 0x44, 0x82, 0x07, 0x88, 0x44, 0x8E, 0x00,
+    0x89, 0x44, 0x82, 0x08, 0x8E, 0x44, 0x83, 0x89, 0x44, 0x82, 0x08, 0x89, 0x44, 0x87, 0x89, 0x44,
+    0x82, 0x08, 0x85, 0x44, 0x8B, 0x89, 0x44, 0x82, 0x08, 0x82, 0x44, 0x8C, 0x89, 0x44, 0x82, 0x08,
+    0x81, 0x44, 0x8D, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8E, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44,
+    0x8D, 0x89, 0x44, 0x82, 0x08, 0x83, 0x44, 0x8B, 0x89, 0x44, 0x82, 0x08, 0x86, 0x44, 0x8A, 0x89,
+    0x44, 0x82, 0x08, 0x8A, 0x44, 0x86, 0x89, 0x44, 0x82, 0x07, 0x81, 0x45, 0x82, 0x89, 0x44, 0x82,
+    0x07, 0x8B, 0x44, 0x8C, 0x00, 0x89, 0x44, 0x82, 0x06, 0x8A, 0x45, 0x84, 0x00, 0x89, 0x44, 0x82,
+    0x03, 0x81, 0x86, 0x8D, 0x45, 0x8B, 0x01, 0x89, 0x44, 0xBC, 0x8E, 0x47, 0x8D, 0x81, 0x01, 0x89,
+    0x50, 0x8D, 0x82, 0x02, 0x89, 0x4F, 0x8A, 0x04, 0x89, 0x4D, 0x8A, 0x83, 0x05, 0x89, 0x47, 0x8E,
+    0x8D, 0x8C, 0x88, 0x85, 0x81, 0x07, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89,
+    0x4E, 0x00, 0x89, 0x44, 0x8C, 0xFB, 0x8B, 0x00, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09,
+    0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09,
+    0x89, 0x4D, 0x85, 0x00, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x4D, 0x85, 0x00,
+    0x89, 0x44, 0x8C, 0xFB, 0x83, 0x00, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44,
+    0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44,
+    0xFC, 0x9C, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89,
+    0x4E, 0x89, 0x4E, 0x89, 0x4E, 0x89, 0x4E, 0x89, 0x44, 0xFB, 0x9B, 0x89, 0x44, 0x81, 0x08, 0x89,
+    0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08, 0x89,
+    0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08, 0x89, 0x4D, 0x84, 0x89, 0x4D, 0x84, 0x89, 0x4D, 0x84,
+    0x89, 0x4D, 0x84, 0x89, 0x44, 0xFB, 0x8B, 0x83, 0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08,
+    0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08,
+    0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08,
+    0x07, 0x81, 0x85, 0x89, 0x8C, 0x8D, 0x42, 0x8E, 0x8B, 0x89, 0x85, 0x81, 0x07, 0x83, 0x8A, 0x4C,
+    0x8A, 0x82, 0x04, 0x89, 0x4F, 0x81, 0x02, 0x81, 0x8D, 0x4F, 0x8A, 0x03, 0x8C, 0x48, 0x8D, 0x8C,
+    0x8D, 0x44, 0x84, 0x02, 0x8A, 0x46, 0x8A, 0x83, 0x04, 0x82, 0x87, 0x9D, 0x02, 0x83, 0x45, 0x8E,
+    0x83, 0x09, 0x81, 0x02, 0x8B, 0x45, 0x82, 0x0E, 0x45, 0x86, 0x0E, 0x84, 0x44, 0x8E, 0x0F, 0x88,
+    0x44, 0x88, 0x0F, 0x8A, 0x44, 0x85, 0x0F, 0x8B, 0x44, 0x83, 0x03, 0x84, 0x49, 0x87, 0x8C, 0x44,
+    0x82, 0x03, 0x84, 0x49, 0x87, 0x8B, 0x44, 0x82, 0x03, 0x84, 0x49, 0x87, 0x8A, 0x44, 0x83, 0x03,
+    0x84, 0x49, 0x87, 0x89, 0x44, 0x86, 0x03, 0x83, 0xCC, 0x44, 0x87, 0x86, 0x44, 0x8A, 0x08, 0x82,
+    0x44, 0x87, 0x82, 0x45, 0x81, 0x07, 0x82, 0x44, 0x87, 0x00, 0x8D, 0x44, 0x89, 0x07, 0x82, 0x44,
+    0x87, 0x00, 0x87, 0x45, 0x87, 0x06, 0x82, 0x44, 0x87, 0x00, 0x81, 0x8E, 0x45, 0x8B, 0x83, 0x04,
+    0x83, 0x44, 0x87, 0x01, 0x84, 0x48, 0x8D, 0x8C, 0x8D, 0x46, 0x87, 0x02, 0x88, 0x51, 0x87, 0x03,
+    0x86, 0x50, 0x87, 0x04, 0x82, 0x8A, 0x4D, 0x8B, 0x83, 0x06, 0x82, 0x86, 0x8A, 0x8D, 0x8E, 0x42,
+    0x8E, 0x8C, 0x8A, 0x87, 0x84, 0x02, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82,
+    0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81,
+    0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A,
+    0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44,
+    0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08,
+    0x81, 0x44, 0x8A, 0x89, 0x54, 0x8A, 0x89, 0x54, 0x8A, 0x89, 0x54, 0x8A, 0x89, 0x54, 0x8A, 0x89,
+    0x44, 0x8D, 0xFC, 0x9C, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82,
+    0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81,
+    0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A,
+    0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44,
+    0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08,
+    0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89,
+    0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44,
+    0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82,
+    0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89,
+    0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44,
+    0x82, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82,
+    0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82,
+    0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82,
+    0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82,
+    0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82,
+    0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82,
+    0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x8A, 0x44, 0x81,
+    0x05, 0x8C, 0x44, 0x05, 0x82, 0x44, 0x8D, 0x00, 0x81, 0x02, 0x82, 0x8D, 0x44, 0x89, 0x00, 0x8D,
+    0x40, 0x8D, 0x8E, 0x46, 0x83, 0x00, 0x8D, 0x48, 0x8B, 0x01, 0x8D, 0x47, 0x8E, 0x81, 0x01, 0x8D,
+    0x46, 0x8C, 0x81, 0x02, 0x88, 0x8D, 0x41, 0x8E, 0x8D, 0x89, 0x84, 0x04, 0x89, 0x44, 0x82, 0x07,
+    0x89, 0x44, 0x8B, 0x00, 0x89, 0x44, 0x82, 0x06, 0x86, 0x44, 0x8E, 0x81, 0x00, 0x89, 0x44, 0x82,
+    0x05, 0x83, 0x45, 0x83, 0x01, 0x89, 0x44, 0x82, 0x04, 0x81, 0x8E, 0x44, 0x86, 0x02, 0x89, 0x44,
+    0x82, 0x04, 0x8C, 0x44, 0x89, 0x03, 0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x8C, 0x04, 0x89, 0x44,
+    0x82, 0x02, 0x86, 0x44, 0x8E, 0x81, 0x04, 0x89, 0x44, 0x82, 0x01, 0x83, 0x45, 0x83, 0x05, 0x89,
+    0x44, 0x82, 0x00, 0x81, 0x8E, 0x44, 0x87, 0x06, 0x89, 0x44, 0x82, 0x00, 0x8C, 0x44, 0x8A, 0x07,
+    0x89, 0x44, 0x82, 0x88, 0x44, 0x8D, 0x08, 0x89, 0x44, 0x86, 0x44, 0x8E, 0x82, 0x08, 0x89, 0x4B,
+    0x81, 0x08, 0x89, 0x4B, 0x8A, 0x08, 0x89, 0x4C, 0x84, 0x07, 0x89, 0x46, 0x8E, 0x44, 0x8E, 0x07,
+    0x89, 0x45, 0x87, 0x00, 0x8D, 0x44, 0x89, 0x06, 0x89, 0x44, 0x84, 0x01, 0x84, 0x45, 0x83, 0x05,
+    0x89, 0x44, 0x82, 0x02, 0x8A, 0x44, 0x8D, 0x05, 0x89, 0x44, 0x82, 0x02, 0x81, 0x8E, 0x44, 0x87,
+    0x04, 0x89, 0x44, 0x82, 0x03, 0x85, 0x45, 0x82, 0x03, 0x89, 0x44, 0x82, 0x04, 0x8B, 0x44, 0x8B,
+    0x03, 0x89, 0x44, 0x82, 0x04, 0x82, 0x45, 0x86, 0x02, 0x89, 0x44, 0x82, 0x05, 0x87, 0x44, 0x8E,
+    0x81, 0x01, 0x89, 0x44, 0x82, 0x06, 0x8D, 0x44, 0x8A, 0x01, 0x89, 0x44, 0x82, 0x06, 0x83, 0x45,
+    0x84, 0x00, 0x89, 0x44, 0x82, 0x07, 0x89, 0x44, 0x8D, 0x00, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44,
+    0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44,
+    0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44,
+    0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44,
+    0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44,
+    0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44,
+    0x82, 0x0A, 0x89, 0x44, 0xFC, 0xAC, 0x82, 0x89, 0x4F, 0x82, 0x89, 0x4F, 0x82, 0x89, 0x4F, 0x82,
+    0x89, 0x4F, 0x82, 0x89, 0x46, 0x86, 0x0B, 0x89, 0x46, 0x86, 0x89, 0x46, 0x8B, 0x0B, 0x8E, 0x46,
+    0x86, 0x89, 0x47, 0x0A, 0x83, 0x47, 0x86, 0x89, 0x47, 0x85, 0x09, 0x89, 0x47, 0x86, 0x89, 0x47,
+    0x8A, 0x09, 0x8E, 0x47, 0x86, 0x89, 0x48, 0x08, 0x83, 0x48, 0x86, 0x89, 0x43, 0x8A, 0x43, 0x84,
+    0x07, 0x89, 0x42, 0x8E, 0x8B, 0x43, 0x86, 0x89, 0x43, 0x86, 0x43, 0x89, 0x07, 0x8E, 0x42, 0x89,
+    0x8B, 0x43, 0x86, 0x89, 0x43, 0x85, 0x8C, 0x42, 0x8E, 0x06, 0x83, 0x43, 0x84, 0x8C, 0x43, 0x86,
+    0x89, 0x43, 0x86, 0x87, 0x43, 0x83, 0x05, 0x88, 0x42, 0x8E, 0x00, 0x8D, 0x43, 0x86, 0x89, 0x43,
+    0x86, 0x82, 0x43, 0x88, 0x05, 0x8E, 0x42, 0x8A, 0x00, 0x8D, 0x43, 0x86, 0x89, 0x43, 0x87, 0x00,
+    0x8D, 0x42, 0x8D, 0x04, 0x83, 0x43, 0x84, 0x00, 0x8E, 0x43, 0x86, 0x89, 0x43, 0x88, 0x00, 0x89,
+    0x43, 0x82, 0x03, 0x88, 0x43, 0x01, 0x8E, 0x43, 0x86, 0x89, 0x43, 0x88, 0x00, 0x84, 0x43, 0x87,
+    0x03, 0x8D, 0x42, 0x8A, 0x01, 0x44, 0x86, 0x89, 0x43, 0x88, 0x01, 0x8E, 0x42, 0x8C, 0x02, 0x83,
+    0x43, 0x84, 0x01, 0x44, 0x86, 0x89, 0x43, 0x88, 0x01, 0x8A, 0x43, 0x81, 0x01, 0x88, 0x43, 0x02,
+    0x44, 0x86, 0x89, 0x43, 0x88, 0x01, 0x85, 0x43, 0x86, 0x01, 0x8D, 0x42, 0x8A, 0x02, 0x44, 0x86,
+    0x89, 0x43, 0x88, 0x02, 0x43, 0x8B, 0x00, 0x83, 0x43, 0x85, 0x02, 0x44, 0x86, 0x89, 0x43, 0x88,
+    0x02, 0x8B, 0x43, 0x00, 0x88, 0x43, 0x03, 0x44, 0x86, 0x89, 0x43, 0x88, 0x02, 0x86, 0x43, 0x85,
+    0x8D, 0x42, 0x8A, 0x03, 0x44, 0x86, 0x89, 0x43, 0x88, 0x02, 0x81, 0x43, 0x8C, 0x43, 0x85, 0x03,
+    0x44, 0x86, 0x89, 0x43, 0x88, 0x03, 0x8C, 0x47, 0x04, 0x44, 0x86, 0x89, 0x43, 0x88, 0x03, 0x87,
+    0x46, 0x8A, 0x04, 0x44, 0x86, 0x89, 0x43, 0x88, 0x03, 0x82, 0x46, 0x85, 0x04, 0x44, 0x86, 0x89,
+    0x43, 0x88, 0x04, 0x8D, 0x45, 0x05, 0x44, 0x86, 0x89, 0x43, 0x88, 0x04, 0x88, 0x44, 0x8A, 0x05,
+    0x44, 0x86, 0x89, 0x43, 0x88, 0x04, 0x83, 0x44, 0x85, 0x05, 0x44, 0x86, 0x89, 0x45, 0x8E, 0x0A,
+    0x8B, 0x43, 0x87, 0x89, 0x46, 0x88, 0x09, 0x8B, 0x43, 0x87, 0x89, 0x47, 0x82, 0x08, 0x8B, 0x43,
+    0x87, 0x89, 0x47, 0x8B, 0x08, 0x8B, 0x43, 0x87, 0x89, 0x48, 0x84, 0x07, 0x8B, 0x43, 0x87, 0x89,
+    0x48, 0x8D, 0x07, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x8E, 0x44, 0x87, 0x06, 0x8B, 0x43, 0x87, 0x89,
+    0x43, 0x86, 0x45, 0x81, 0x05, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x85, 0x88, 0x44, 0x89, 0x05, 0x8B,
+    0x43, 0x87, 0x89, 0x43, 0x85, 0x00, 0x8E, 0x44, 0x83, 0x04, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x86,
+    0x00, 0x85, 0x44, 0x8C, 0x04, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x87, 0x01, 0x8C, 0x44, 0x85, 0x03,
+    0x8B, 0x43, 0x87, 0x89, 0x43, 0x88, 0x01, 0x83, 0x44, 0x8E, 0x03, 0x8B, 0x43, 0x87, 0x89, 0x43,
+    0x88, 0x02, 0x8A, 0x44, 0x88, 0x02, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x88, 0x02, 0x81, 0x45, 0x82,
+    0x01, 0x8A, 0x43, 0x87, 0x89, 0x43, 0x88, 0x03, 0x87, 0x44, 0x8B, 0x01, 0x8A, 0x43, 0x87, 0x89,
+    0x43, 0x88, 0x04, 0x8D, 0x44, 0x84, 0x00, 0x89, 0x43, 0x87, 0x89, 0x43, 0x88, 0x04, 0x85, 0x44,
+    0x8D, 0x00, 0x88, 0x43, 0x87, 0x89, 0x43, 0x88, 0x05, 0x8B, 0x44, 0x87, 0x88, 0x43, 0x87, 0x89,
+    0x43, 0x88, 0x05, 0x82, 0x45, 0x88, 0x43, 0x87, 0x89, 0x43, 0x88, 0x06, 0x89, 0x49, 0x87, 0x89,
+    0x43, 0x88, 0x06, 0x81, 0x8E, 0x48, 0x87, 0x89, 0x43, 0x88, 0x07, 0x86, 0x48, 0x87, 0x89, 0x43,
+    0x88, 0x08, 0x8D, 0x47, 0x87, 0x89, 0x43, 0x88, 0x08, 0x84, 0x47, 0x87, 0x89, 0x43, 0x88, 0x09,
+    0x8B, 0x46, 0x87, 0x89, 0x43, 0x88, 0x09, 0x82, 0x46, 0x87, 0x06, 0x81, 0x85, 0x89, 0x8C, 0x8E,
+    0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x82, 0x0C, 0x81, 0x89, 0x4B, 0x8B, 0x83, 0x09, 0x85, 0x4F, 0x88,
+    0x07, 0x87, 0x51, 0x8A, 0x05, 0x84, 0x48, 0x9D, 0x8E, 0x47, 0x87, 0x04, 0x8E, 0x45, 0x8B, 0x83,
+    0x03, 0x82, 0x88, 0x46, 0x83, 0x02, 0x86, 0x45, 0x87, 0x07, 0x83, 0x45, 0x8A, 0x02, 0x8D, 0x44,
+    0x8A, 0x09, 0x86, 0x45, 0x81, 0x00, 0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x86, 0x00, 0x86, 0x44,
+    0x8B, 0x0B, 0x88, 0x44, 0x89, 0x00, 0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8D, 0x00, 0x8A, 0x44,
+    0x85, 0x0B, 0x81, 0x44, 0x8E, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8C, 0x44, 0x83, 0x0C,
+    0x45, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8A, 0x44, 0x85, 0x0B, 0x81, 0x44, 0x8E, 0x00,
+    0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8C, 0x00, 0x85, 0x44, 0x8C, 0x0B, 0x88, 0x44, 0x89, 0x00,
+    0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x85, 0x01, 0x8D, 0x44, 0x8A, 0x09, 0x86, 0x45, 0x81, 0x01,
+    0x86, 0x45, 0x87, 0x07, 0x84, 0x45, 0x8A, 0x03, 0x8E, 0x45, 0x8B, 0x84, 0x03, 0x82, 0x89, 0x46,
+    0x82, 0x03, 0x83, 0x48, 0x8E, 0x8D, 0x48, 0x87, 0x05, 0x86, 0x51, 0x8A, 0x07, 0x84, 0x4F, 0x87,
+    0x09, 0x81, 0x89, 0x4B, 0x8B, 0x83, 0x0C, 0x81, 0x85, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8D, 0x8A,
+    0x86, 0x82, 0x07, 0x89, 0x48, 0x8E, 0x8D, 0x8A, 0x87, 0x81, 0x04, 0x89, 0x4D, 0x89, 0x81, 0x02,
+    0x89, 0x4E, 0x8E, 0x81, 0x01, 0x89, 0x4F, 0x8D, 0x01, 0x89, 0x44, 0x8C, 0x9B, 0x8C, 0x8E, 0x46,
+    0x86, 0x00, 0x89, 0x44, 0x82, 0x03, 0x83, 0x8D, 0x44, 0x8C, 0x00, 0x89, 0x44, 0x82, 0x04, 0x81,
+    0x45, 0x00, 0x89, 0x44, 0x82, 0x05, 0x8C, 0x44, 0x81, 0x89, 0x44, 0x82, 0x05, 0x8A, 0x44, 0x82,
+    0x89, 0x44, 0x82, 0x05, 0x8C, 0x44, 0x00, 0x89, 0x44, 0x82, 0x04, 0x84, 0x44, 0x8E, 0x00, 0x89,
+    0x44, 0x82, 0x03, 0x86, 0x45, 0x89, 0x00, 0x89, 0x44, 0x8C, 0x9B, 0x8D, 0x47, 0x83, 0x00, 0x89,
+    0x4F, 0x89, 0x01, 0x89, 0x4E, 0x8A, 0x02, 0x89, 0x4C, 0x8E, 0x85, 0x03, 0x89, 0x48, 0x8E, 0x8C,
+    0x89, 0x84, 0x05, 0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x89,
+    0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x89,
+    0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x06, 0x81, 0x85, 0x89, 0x8C,
+    0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x82, 0x0C, 0x81, 0x89, 0x4B, 0x8B, 0x83, 0x09, 0x85, 0x4F,
+    0x88, 0x07, 0x87, 0x51, 0x8A, 0x05, 0x84, 0x48, 0x9D, 0x8E, 0x47, 0x87, 0x04, 0x8E, 0x45, 0x8B,
+    0x83, 0x03, 0x82, 0x88, 0x46, 0x83, 0x02, 0x86, 0x45, 0x87, 0x07, 0x83, 0x45, 0x8A, 0x02, 0x8D,
+    0x44, 0x8A, 0x09, 0x86, 0x45, 0x81, 0x00, 0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x86, 0x00, 0x86,
+    0x44, 0x8B, 0x0B, 0x88, 0x44, 0x89, 0x00, 0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8D, 0x00, 0x8A,
+    0x44, 0x85, 0x0B, 0x81, 0x44, 0x8E, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8C, 0x44, 0x83,
+    0x0C, 0x45, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8A, 0x44, 0x85, 0x0B, 0x81, 0x44, 0x8E,
+    0x00, 0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8C, 0x00, 0x85, 0x44, 0x8C, 0x0B, 0x88, 0x44, 0x8A,
+    0x00, 0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x86, 0x01, 0x8D, 0x44, 0x8A, 0x09, 0x86, 0x45, 0x81,
+    0x01, 0x86, 0x45, 0x87, 0x07, 0x84, 0x45, 0x8A, 0x03, 0x8E, 0x45, 0x8B, 0x84, 0x03, 0x82, 0x89,
+    0x46, 0x82, 0x03, 0x83, 0x48, 0x8E, 0x8D, 0x48, 0x88, 0x05, 0x86, 0x51, 0x8A, 0x07, 0x84, 0x4F,
+    0x88, 0x09, 0x81, 0x89, 0x4B, 0x8C, 0x83, 0x0C, 0x81, 0x85, 0x89, 0x8C, 0x8E, 0x46, 0x8D, 0x81,
+    0x12, 0x82, 0x8E, 0x44, 0x8D, 0x13, 0x83, 0x45, 0x8C, 0x13, 0x86, 0x45, 0x8B, 0x13, 0x88, 0x45,
+    0x89, 0x13, 0x8B, 0x45, 0x88, 0x13, 0x8D, 0x45, 0x86, 0x00, 0x89, 0x48, 0x8E, 0x8C, 0x89, 0x85,
+    0x08, 0x89, 0x4D, 0x89, 0x81, 0x05, 0x89, 0x4E, 0x8D, 0x82, 0x04, 0x89, 0x4F, 0x8D, 0x04, 0x89,
+    0x44, 0x8C, 0x9B, 0x8C, 0x47, 0x86, 0x03, 0x89, 0x44, 0x82, 0x03, 0x84, 0x8D, 0x44, 0x8C, 0x03,
+    0x89, 0x44, 0x82, 0x04, 0x81, 0x45, 0x03, 0x89, 0x44, 0x82, 0x05, 0x8B, 0x44, 0x81, 0x02, 0x89,
+    0x44, 0x82, 0x05, 0x8A, 0x44, 0x82, 0x02, 0x89, 0x44, 0x82, 0x05, 0x8D, 0x44, 0x03, 0x89, 0x44,
+    0x82, 0x04, 0x86, 0x44, 0x8C, 0x03, 0x89, 0x44, 0x82, 0x01, 0x81, 0x84, 0x89, 0x45, 0x85, 0x03,
+    0x89, 0x4F, 0x8A, 0x04, 0x89, 0x4E, 0x8B, 0x05, 0x89, 0x4D, 0x88, 0x06, 0x89, 0x4C, 0x85, 0x07,
+    0x89, 0x44, 0x8B, 0x9A, 0x8E, 0x43, 0x8E, 0x07, 0x89, 0x44, 0x82, 0x01, 0x84, 0x44, 0x89, 0x06,
+    0x89, 0x44, 0x82, 0x02, 0x89, 0x44, 0x84, 0x05, 0x89, 0x44, 0x82, 0x02, 0x81, 0x8E, 0x43, 0x8E,
+    0x81, 0x04, 0x89, 0x44, 0x82, 0x03, 0x85, 0x44, 0x8A, 0x04, 0x89, 0x44, 0x82, 0x04, 0x8B, 0x44,
+    0x85, 0x03, 0x89, 0x44, 0x82, 0x04, 0x82, 0x44, 0x8E, 0x81, 0x02, 0x89, 0x44, 0x82, 0x05, 0x87,
+    0x44, 0x8A, 0x02, 0x89, 0x44, 0x82, 0x06, 0x8D, 0x44, 0x85, 0x01, 0x89, 0x44, 0x82, 0x06, 0x83,
+    0x44, 0x8E, 0x81, 0x00, 0x89, 0x44, 0x82, 0x07, 0x89, 0x44, 0x8B, 0x00, 0x04, 0x82, 0x87, 0x8B,
+    0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x82, 0x05, 0x81, 0x8A, 0x4A, 0x8C, 0x86, 0x02, 0x81, 0x8D,
+    0x4D, 0x81, 0x01, 0x8C, 0x4D, 0x8A, 0x01, 0x85, 0x46, 0x8D, 0x8C, 0x8E, 0x44, 0x83, 0x01, 0x8A,
+    0x44, 0x8A, 0x81, 0x02, 0x81, 0x85, 0x8A, 0x40, 0x8C, 0x02, 0x8D, 0x43, 0x8E, 0x08, 0x82, 0x02,
+    0x8E, 0x43, 0x8B, 0x0C, 0x8D, 0x43, 0x8E, 0x81, 0x0B, 0x8A, 0x44, 0x8C, 0x82, 0x0A, 0x84, 0x46,
+    0x89, 0x81, 0x09, 0x8B, 0x47, 0x8A, 0x82, 0x07, 0x81, 0x8C, 0x48, 0x8A, 0x81, 0x07, 0x8A, 0x49,
+    0x86, 0x07, 0x84, 0x8C, 0x48, 0x88, 0x08, 0x84, 0x8B, 0x47, 0x85, 0x09, 0x83, 0x8B, 0x45, 0x8E,
+    0x0B, 0x86, 0x45, 0x83, 0x0B, 0x88, 0x44, 0x85, 0x0B, 0x84, 0x44, 0x86, 0x83, 0x8A, 0x84, 0x08,
+    0x86, 0x44, 0x94, 0x41, 0x8D, 0x88, 0x83, 0x04, 0x85, 0x8E, 0x44, 0x81, 0x84, 0x45, 0x8D, 0x8C,
+    0x8D, 0x8E, 0x45, 0x8B, 0x00, 0x84, 0x4F, 0x82, 0x00, 0x84, 0x4E, 0x84, 0x01, 0x81, 0x8A, 0x4B,
+    0x8B, 0x82, 0x04, 0x81, 0x85, 0x89, 0x8C, 0x8E, 0x42, 0x8D, 0x8B, 0x87, 0x82, 0x04, 0x83, 0x53,
+    0x84, 0x83, 0x53, 0x84, 0x83, 0x53, 0x84, 0x83, 0x53, 0x84, 0x82, 0xEC, 0x45, 0xEC, 0x83, 0x07,
+    0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F,
+    0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F,
+    0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F,
+    0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F,
+    0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F,
+    0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x07, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44,
+    0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88,
+    0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83,
+    0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44,
+    0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88,
+    0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83,
+    0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x84, 0x44, 0x88, 0x8B, 0x44,
+    0x09, 0x85, 0x44, 0x87, 0x8A, 0x44, 0x83, 0x08, 0x87, 0x44, 0x86, 0x88, 0x44, 0x88, 0x08, 0x8C,
+    0x44, 0x94, 0x45, 0x82, 0x06, 0x86, 0x45, 0x01, 0x8E, 0x44, 0x8E, 0x85, 0x03, 0x81, 0x88, 0x45,
+    0x89, 0x01, 0x85, 0x47, 0x8E, 0x8D, 0x8E, 0x47, 0x81, 0x02, 0x8A, 0x50, 0x85, 0x04, 0x8A, 0x4E,
+    0x85, 0x06, 0x85, 0x8D, 0x4A, 0x8A, 0x82, 0x09, 0x84, 0x88, 0x8C, 0x8E, 0x42, 0x8D, 0x8A, 0x87,
+    0x81, 0x05, 0x8D, 0x44, 0x0B, 0x84, 0x44, 0x88, 0x87, 0x44, 0x84, 0x0A, 0x89, 0x44, 0x83, 0x82,
+    0x44, 0x89, 0x0A, 0x8E, 0x43, 0x8D, 0x01, 0x8C, 0x43, 0x8E, 0x09, 0x83, 0x44, 0x88, 0x01, 0x87,
+    0x44, 0x83, 0x08, 0x88, 0x44, 0x82, 0x01, 0x82, 0x44, 0x88, 0x08, 0x8D, 0x43, 0x8D, 0x03, 0x8C,
+    0x43, 0x8D, 0x07, 0x83, 0x44, 0x87, 0x03, 0x87, 0x44, 0x83, 0x06, 0x88, 0x44, 0x82, 0x03, 0x81,
+    0x44, 0x88, 0x06, 0x8D, 0x43, 0x8C, 0x05, 0x8C, 0x43, 0x8D, 0x05, 0x82, 0x44, 0x87, 0x05, 0x86,
+    0x44, 0x82, 0x04, 0x87, 0x44, 0x81, 0x05, 0x81, 0x44, 0x87, 0x04, 0x8C, 0x43, 0x8C, 0x07, 0x8B,
+    0x43, 0x8C, 0x03, 0x81, 0x44, 0x86, 0x07, 0x86, 0x44, 0x81, 0x02, 0x87, 0x44, 0x81, 0x07, 0x81,
+    0x44, 0x86, 0x02, 0x8C, 0x43, 0x8B, 0x09, 0x8B, 0x43, 0x8B, 0x01, 0x81, 0x44, 0x86, 0x09, 0x86,
+    0x44, 0x01, 0x85, 0x44, 0x81, 0x09, 0x81, 0x44, 0x85, 0x00, 0x8A, 0x43, 0x8B, 0x0B, 0x8B, 0x43,
+    0x89, 0x00, 0x8E, 0x43, 0x85, 0x0B, 0x85, 0x43, 0x8D, 0x82, 0x44, 0x0D, 0x44, 0x87, 0x43, 0x8B,
+    0x0D, 0x8A, 0x43, 0x8D, 0x43, 0x85, 0x0D, 0x85, 0x48, 0x0F, 0x47, 0x8A, 0x0F, 0x8A, 0x46, 0x85,
+    0x0F, 0x84, 0x46, 0x11, 0x45, 0x8A, 0x08, 0x8D, 0x43, 0x8C, 0x08, 0x87, 0x44, 0x83, 0x08, 0x44,
+    0x99, 0x44, 0x08, 0x8B, 0x44, 0x87, 0x07, 0x84, 0x44, 0x95, 0x44, 0x83, 0x07, 0x45, 0x8B, 0x07,
+    0x88, 0x44, 0x91, 0x44, 0x87, 0x06, 0x84, 0x46, 0x07, 0x8B, 0x43, 0x8D, 0x01, 0x8D, 0x43, 0x8B,
+    0x06, 0x88, 0x46, 0x84, 0x06, 0x44, 0x89, 0x01, 0x89, 0x44, 0x06, 0x8C, 0x46, 0x88, 0x05, 0x83,
+    0x44, 0x85, 0x01, 0x85, 0x44, 0x83, 0x05, 0x47, 0x8C, 0x05, 0x87, 0x44, 0x81, 0x01, 0x81, 0x44,
+    0x86, 0x04, 0x84, 0x43, 0x8B, 0x43, 0x81, 0x04, 0x8A, 0x43, 0x8D, 0x03, 0x8D, 0x43, 0x8A, 0x04,
+    0x88, 0x43, 0x85, 0x43, 0x85, 0x04, 0x8E, 0x43, 0x89, 0x03, 0x89, 0x43, 0x8E, 0x04, 0x8D, 0x42,
+    0x8D, 0x82, 0x43, 0x89, 0x03, 0x82, 0x44, 0x84, 0x03, 0x84, 0x44, 0x82, 0x02, 0x81, 0x43, 0x8A,
+    0x00, 0x8E, 0x42, 0x8D, 0x03, 0x86, 0x44, 0x81, 0x03, 0x81, 0x44, 0x86, 0x02, 0x85, 0x43, 0x86,
+    0x00, 0x8B, 0x43, 0x81, 0x02, 0x89, 0x43, 0x8C, 0x05, 0x8C, 0x43, 0x89, 0x02, 0x89, 0x43, 0x83,
+    0x00, 0x87, 0x43, 0x85, 0x02, 0x8D, 0x43, 0x88, 0x05, 0x88, 0x43, 0x8D, 0x02, 0x8D, 0x42, 0x8E,
+    0x01, 0x83, 0x43, 0x89, 0x01, 0x81, 0x44, 0x84, 0x05, 0x84, 0x44, 0x81, 0x00, 0x81, 0x43, 0x8B,
+    0x02, 0x43, 0x8E, 0x01, 0x85, 0x44, 0x07, 0x44, 0x84, 0x00, 0x86, 0x43, 0x86, 0x02, 0x8B, 0x43,
+    0x82, 0x00, 0x88, 0x43, 0x8C, 0x07, 0x8C, 0x43, 0x88, 0x00, 0x8A, 0x43, 0x82, 0x02, 0x87, 0x43,
+    0x85, 0x00, 0x8C, 0x43, 0x88, 0x07, 0x88, 0x43, 0x8B, 0x00, 0x8D, 0x42, 0x8E, 0x03, 0x82, 0x43,
+    0x89, 0x00, 0x44, 0x84, 0x07, 0x84, 0x43, 0x8E, 0x00, 0x43, 0x8A, 0x04, 0x8E, 0x42, 0x8C, 0x82,
+    0x44, 0x09, 0x44, 0x84, 0x43, 0x86, 0x04, 0x8A, 0x42, 0x8E, 0x85, 0x43, 0x8C, 0x09, 0x8B, 0x43,
+    0x8A, 0x43, 0x82, 0x04, 0x86, 0x43, 0x89, 0x43, 0x88, 0x09, 0x87, 0x43, 0x8E, 0x42, 0x8E, 0x05,
+    0x82, 0x43, 0x8E, 0x43, 0x83, 0x09, 0x83, 0x47, 0x89, 0x06, 0x8E, 0x47, 0x0B, 0x47, 0x85, 0x06,
+    0x8A, 0x46, 0x8B, 0x0B, 0x8B, 0x46, 0x81, 0x06, 0x85, 0x46, 0x87, 0x0B, 0x87, 0x45, 0x8D, 0x07,
+    0x81, 0x46, 0x83, 0x0B, 0x83, 0x45, 0x89, 0x08, 0x8D, 0x45, 0x06, 0x82, 0x45, 0x83, 0x09, 0x8C,
+    0x44, 0x86, 0x01, 0x87, 0x44, 0x8C, 0x08, 0x86, 0x44, 0x8B, 0x03, 0x8C, 0x44, 0x86, 0x06, 0x81,
+    0x8E, 0x44, 0x82, 0x03, 0x82, 0x45, 0x81, 0x05, 0x89, 0x44, 0x87, 0x05, 0x88, 0x44, 0x8A, 0x04,
+    0x82, 0x44, 0x8D, 0x07, 0x8D, 0x44, 0x83, 0x03, 0x8C, 0x44, 0x83, 0x07, 0x83, 0x44, 0x8D, 0x02,
+    0x85, 0x44, 0x89, 0x09, 0x89, 0x44, 0x87, 0x01, 0x8E, 0x43, 0x8E, 0x0B, 0x8E, 0x44, 0x81, 0x88,
+    0x44, 0x84, 0x0B, 0x84, 0x44, 0x8B, 0x44, 0x8A, 0x0D, 0x8A, 0x48, 0x8E, 0x81, 0x0D, 0x81, 0x8E,
+    0x47, 0x86, 0x0F, 0x85, 0x46, 0x8B, 0x10, 0x84, 0x46, 0x85, 0x10, 0x8D, 0x46, 0x8E, 0x0F, 0x89,
+    0x48, 0x89, 0x0D, 0x83, 0x4A, 0x84, 0x0C, 0x8D, 0x44, 0x83, 0x44, 0x8E, 0x0B, 0x88, 0x44, 0x86,
+    0x00, 0x87, 0x44, 0x89, 0x09, 0x82, 0x44, 0x8C, 0x02, 0x8D, 0x44, 0x84, 0x08, 0x8C, 0x44, 0x83,
+    0x02, 0x83, 0x44, 0x8E, 0x81, 0x06, 0x87, 0x44, 0x88, 0x04, 0x89, 0x44, 0x8A, 0x05, 0x82, 0x44,
+    0x8E, 0x05, 0x81, 0x8E, 0x44, 0x85, 0x04, 0x8B, 0x44, 0x85, 0x06, 0x86, 0x44, 0x8E, 0x81, 0x02,
+    0x86, 0x44, 0x8B, 0x08, 0x8C, 0x44, 0x8A, 0x01, 0x81, 0x8E, 0x44, 0x81, 0x08, 0x82, 0x45, 0x85,
+    0x00, 0x8A, 0x44, 0x87, 0x0A, 0x88, 0x44, 0x8E, 0x81, 0x8B, 0x44, 0x87, 0x09, 0x8B, 0x44, 0x87,
+    0x83, 0x44, 0x8E, 0x08, 0x83, 0x44, 0x8D, 0x01, 0x8A, 0x44, 0x87, 0x07, 0x8C, 0x44, 0x85, 0x01,
+    0x82, 0x45, 0x81, 0x05, 0x84, 0x44, 0x8C, 0x03, 0x89, 0x44, 0x88, 0x05, 0x8C, 0x44, 0x84, 0x03,
+    0x81, 0x45, 0x81, 0x03, 0x84, 0x44, 0x8B, 0x05, 0x88, 0x44, 0x88, 0x03, 0x8C, 0x44, 0x82, 0x06,
+    0x8E, 0x44, 0x81, 0x01, 0x84, 0x44, 0x8A, 0x07, 0x86, 0x44, 0x88, 0x01, 0x8C, 0x44, 0x81, 0x08,
+    0x8D, 0x44, 0x81, 0x85, 0x44, 0x88, 0x09, 0x85, 0x44, 0x88, 0x8D, 0x43, 0x8E, 0x81, 0x0A, 0x8C,
+    0x49, 0x87, 0x0B, 0x84, 0x48, 0x8E, 0x0D, 0x8B, 0x47, 0x85, 0x0D, 0x83, 0x46, 0x8C, 0x0F, 0x8A,
+    0x45, 0x84, 0x0F, 0x82, 0x44, 0x8C, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11,
+    0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44,
+    0x8B, 0x11, 0x44, 0x8B, 0x08, 0x00, 0x8B, 0x51, 0x8C, 0x01, 0x8B, 0x51, 0x8C, 0x01, 0x8B, 0x51,
+    0x8C, 0x01, 0x8B, 0x51, 0x8B, 0x01, 0x88, 0xFC, 0xBC, 0x45, 0x83, 0x0D, 0x89, 0x44, 0x87, 0x0D,
+    0x84, 0x44, 0x8C, 0x0D, 0x81, 0x8E, 0x44, 0x82, 0x0D, 0x8B, 0x44, 0x86, 0x0D, 0x86, 0x44, 0x8B,
+    0x0D, 0x82, 0x44, 0x8E, 0x81, 0x0D, 0x8C, 0x44, 0x84, 0x0D, 0x88, 0x44, 0x89, 0x0D, 0x83, 0x44,
+    0x8D, 0x0E, 0x8E, 0x44, 0x83, 0x0D, 0x8A, 0x44, 0x87, 0x0D, 0x85, 0x44, 0x8C, 0x0D, 0x81, 0x8E,
+    0x44, 0x82, 0x0D, 0x8B, 0x44, 0x86, 0x0D, 0x87, 0x44, 0x8A, 0x0D, 0x82, 0x44, 0x8E, 0x81, 0x0D,
+    0x8D, 0x44, 0x84, 0x0D, 0x88, 0x45, 0xFC, 0xCC, 0x91, 0x53, 0x91, 0x53, 0x91, 0x53, 0x91, 0x53,
+    0x81, 0x85, 0x47, 0x8A, 0x85, 0x47, 0x8A, 0x85, 0x47, 0x8A, 0x85, 0x44, 0xAE, 0x89, 0x85, 0x43,
+    0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43,
+    0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43,
+    0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43,
+    0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43,
+    0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43,
+    0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43,
+    0x87, 0x03, 0x85, 0x44, 0xAE, 0x89, 0x85, 0x47, 0x8A, 0x85, 0x47, 0x8A, 0x85, 0x47, 0x8A, 0x89,
+    0x43, 0x88, 0x09, 0x83, 0x43, 0x8E, 0x0A, 0x8D, 0x43, 0x84, 0x09, 0x87, 0x43, 0x8A, 0x09, 0x81,
+    0x44, 0x81, 0x09, 0x8B, 0x43, 0x86, 0x09, 0x85, 0x43, 0x8C, 0x0A, 0x44, 0x82, 0x09, 0x89, 0x43,
+    0x88, 0x09, 0x83, 0x43, 0x8E, 0x0A, 0x8D, 0x43, 0x84, 0x09, 0x87, 0x43, 0x8A, 0x09, 0x81, 0x44,
+    0x81, 0x09, 0x8B, 0x43, 0x86, 0x09, 0x85, 0x43, 0x8C, 0x0A, 0x44, 0x82, 0x09, 0x89, 0x43, 0x88,
+    0x09, 0x83, 0x43, 0x8E, 0x0A, 0x8D, 0x43, 0x84, 0x09, 0x87, 0x43, 0x8A, 0x09, 0x81, 0x44, 0x81,
+    0x09, 0x8B, 0x43, 0x86, 0x09, 0x85, 0x43, 0x8C, 0x0A, 0x44, 0x82, 0x09, 0x89, 0x43, 0x88, 0x09,
+    0x83, 0x43, 0x8E, 0x0A, 0x8D, 0x43, 0x84, 0x00, 0x47, 0x8E, 0x00, 0x47, 0x8E, 0x00, 0x47, 0x8E,
+    0x00, 0xBE, 0x43, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E,
+    0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E,
+    0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E,
+    0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E,
+    0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E,
+    0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E,
+    0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x00, 0xBE, 0x43, 0x8E, 0x00, 0x47, 0x8E, 0x00,
+    0x47, 0x8E, 0x00, 0x47, 0x8E, 0x07, 0x8E, 0x41, 0x83, 0x0F, 0x87, 0x42, 0x8C, 0x0F, 0x8E, 0x43,
+    0x84, 0x0D, 0x86, 0x44, 0x8D, 0x0D, 0x8D, 0x45, 0x86, 0x0B, 0x85, 0x46, 0x8E, 0x0B, 0x8D, 0x42,
+    0x85, 0x8D, 0x42, 0x87, 0x09, 0x84, 0x42, 0x8E, 0x00, 0x85, 0x42, 0x8E, 0x81, 0x08, 0x8C, 0x42,
+    0x86, 0x01, 0x8C, 0x42, 0x88, 0x07, 0x84, 0x42, 0x8E, 0x02, 0x84, 0x43, 0x81, 0x06, 0x8B, 0x42,
+    0x88, 0x03, 0x8B, 0x42, 0x89, 0x05, 0x83, 0x43, 0x81, 0x03, 0x83, 0x43, 0x82, 0x04, 0x8B, 0x42,
+    0x89, 0x05, 0x8A, 0x42, 0x8B, 0x03, 0x82, 0x43, 0x82, 0x05, 0x82, 0x43, 0x83, 0x02, 0x8A, 0x42,
+    0x8A, 0x07, 0x89, 0x42, 0x8C, 0x01, 0x82, 0x43, 0x83, 0x07, 0x81, 0x43, 0x85, 0x00, 0x89, 0x42,
+    0x8C, 0x09, 0x89, 0x42, 0x8D, 0x00, 0x00, 0xF9, 0xE9, 0x86, 0x81, 0x4E, 0x8B, 0x81, 0x4E, 0x8B,
+    0x8A, 0x44, 0x8D, 0x04, 0x89, 0x44, 0x89, 0x04, 0x86, 0x44, 0x85, 0x04, 0x84, 0x8E, 0x43, 0x83,
+    0x04, 0x81, 0x8C, 0x42, 0x8E, 0x81, 0x05, 0x88, 0x42, 0x8C, 0x04, 0x84, 0x88, 0x8B, 0x8E, 0x42,
+    0x8D, 0x8A, 0x86, 0x06, 0x81, 0x88, 0x4B, 0x86, 0x04, 0x82, 0x4D, 0x88, 0x04, 0x8A, 0x4D, 0x83,
+    0x03, 0x83, 0x41, 0x8E, 0x89, 0x86, 0x93, 0x86, 0x8D, 0x44, 0x8A, 0x04, 0x87, 0x84, 0x05, 0x81,
+    0x8E, 0x43, 0x8E, 0x0D, 0x8A, 0x44, 0x0D, 0x88, 0x44, 0x81, 0x04, 0x84, 0x88, 0x8A, 0x8C, 0x8D,
+    0x8E, 0x47, 0x81, 0x02, 0x87, 0x8E, 0x4D, 0x81, 0x00, 0x81, 0x8C, 0x4F, 0x81, 0x00, 0x8A, 0x45,
+    0x8D, 0x88, 0x86, 0x95, 0x8A, 0x44, 0x91, 0x45, 0x85, 0x04, 0x88, 0x44, 0x81, 0x84, 0x44, 0x89,
+    0x05, 0x89, 0x44, 0x81, 0x86, 0x44, 0x86, 0x05, 0x8D, 0x44, 0x81, 0x85, 0x44, 0x89, 0x04, 0x87,
+    0x45, 0x81, 0x82, 0x45, 0x88, 0x83, 0x82, 0x84, 0x8B, 0x46, 0x81, 0x00, 0x8D, 0x50, 0x81, 0x00,
+    0x85, 0x4A, 0x84, 0x8B, 0x43, 0x81, 0x01, 0x87, 0x47, 0x8E, 0x84, 0x00, 0x85, 0x43, 0x81, 0x02,
+    0x82, 0x89, 0x8D, 0x41, 0x8E, 0x8B, 0x87, 0x81, 0x02, 0x43, 0x81, 0x00, 0x44, 0x8A, 0x0E, 0x44,
+    0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x89,
+    0x0E, 0x44, 0x89, 0x0E, 0x44, 0x89, 0x01, 0x86, 0x8B, 0x8E, 0x40, 0x8E, 0x8B, 0x86, 0x05, 0x44,
+    0x88, 0x82, 0x8D, 0x46, 0x8D, 0x82, 0x03, 0x44, 0x88, 0x8D, 0x48, 0x8E, 0x81, 0x02, 0x50, 0x8A,
+    0x02, 0x47, 0x8A, 0x88, 0x8A, 0x46, 0x83, 0x01, 0x45, 0x8D, 0x81, 0x02, 0x81, 0x8D, 0x44, 0x89,
+    0x01, 0x45, 0x83, 0x04, 0x83, 0x44, 0x8E, 0x01, 0x44, 0x8E, 0x06, 0x8C, 0x44, 0x81, 0x00, 0x44,
+    0x8B, 0x06, 0x89, 0x44, 0x83, 0x00, 0x44, 0x8A, 0x06, 0x87, 0x44, 0x84, 0x00, 0x44, 0x8A, 0x06,
+    0x87, 0x44, 0x85, 0x00, 0x44, 0x8A, 0x06, 0x87, 0x44, 0x84, 0x00, 0x44, 0x8C, 0x06, 0x89, 0x44,
+    0x83, 0x00, 0x45, 0x06, 0x8D, 0x44, 0x81, 0x00, 0x45, 0x85, 0x04, 0x84, 0x44, 0x8E, 0x01, 0x45,
+    0x8E, 0x83, 0x02, 0x82, 0x8E, 0x44, 0x89, 0x01, 0x47, 0x8B, 0x89, 0x8A, 0x46, 0x83, 0x01, 0x50,
+    0x8A, 0x02, 0x44, 0x88, 0x49, 0x8D, 0x81, 0x02, 0x43, 0x8D, 0x00, 0x84, 0x8E, 0x46, 0x8C, 0x81,
+    0x03, 0x43, 0x87, 0x01, 0x81, 0x87, 0x8C, 0x8E, 0x40, 0x8E, 0x8B, 0x85, 0x04, 0x05, 0x84, 0x88,
+    0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x84, 0x05, 0x83, 0x8C, 0x49, 0x8E, 0x82, 0x02, 0x86, 0x4B,
+    0x8E, 0x02, 0x84, 0x4C, 0x88, 0x02, 0x8E, 0x45, 0x8C, 0x99, 0x8C, 0x42, 0x82, 0x01, 0x86, 0x44,
+    0x8E, 0x83, 0x04, 0x85, 0x88, 0x02, 0x8B, 0x44, 0x85, 0x0A, 0x44, 0x8E, 0x0A, 0x82, 0x44, 0x8A,
+    0x0A, 0x83, 0x44, 0x88, 0x0A, 0x84, 0x44, 0x87, 0x0A, 0x83, 0x44, 0x88, 0x0A, 0x82, 0x44, 0x8A,
+    0x0B, 0x44, 0x8E, 0x0B, 0x8D, 0x44, 0x85, 0x07, 0x81, 0x01, 0x88, 0x44, 0x8E, 0x83, 0x04, 0x83,
+    0x8A, 0x8B, 0x01, 0x82, 0x46, 0x8C, 0x99, 0x8B, 0x8E, 0x41, 0x8B, 0x02, 0x88, 0x4C, 0x8B, 0x03,
+    0x8B, 0x4B, 0x8B, 0x04, 0x88, 0x4A, 0x87, 0x05, 0x81, 0x86, 0x8B, 0x8D, 0x42, 0x8E, 0x8B, 0x87,
+    0x81, 0x01, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89,
+    0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x88,
+    0x44, 0x81, 0x04, 0x85, 0x8A, 0x8E, 0x40, 0x8E, 0x8C, 0x87, 0x81, 0x00, 0x87, 0x44, 0x81, 0x02,
+    0x81, 0x8C, 0x46, 0x8E, 0x84, 0x85, 0x44, 0x81, 0x01, 0x81, 0x8D, 0x49, 0x87, 0x44, 0x81, 0x01,
+    0x89, 0x50, 0x81, 0x00, 0x82, 0x46, 0x8B, 0x8A, 0x8B, 0x47, 0x81, 0x00, 0x88, 0x44, 0x8E, 0x83,
+    0x02, 0x81, 0x8B, 0x45, 0x81, 0x00, 0x8D, 0x44, 0x84, 0x05, 0x8E, 0x44, 0x81, 0x00, 0x44, 0x8D,
+    0x06, 0x88, 0x44, 0x81, 0x82, 0x44, 0x89, 0x06, 0x85, 0x44, 0x81, 0x83, 0x44, 0x87, 0x06, 0x83,
+    0x44, 0x81, 0x84, 0x44, 0x87, 0x06, 0x83, 0x44, 0x81, 0x83, 0x44, 0x87, 0x06, 0x83, 0x44, 0x81,
+    0x83, 0x44, 0x89, 0x06, 0x84, 0x44, 0x81, 0x00, 0x44, 0x8C, 0x06, 0x87, 0x44, 0x81, 0x00, 0x8D,
+    0x44, 0x83, 0x05, 0x8D, 0x44, 0x81, 0x00, 0x89, 0x44, 0x8D, 0x81, 0x03, 0x88, 0x45, 0x81, 0x00,
+    0x83, 0x46, 0x8A, 0x88, 0x89, 0x8D, 0x46, 0x81, 0x01, 0x8A, 0x50, 0x81, 0x01, 0x81, 0x8D, 0x48,
+    0x8E, 0x84, 0x44, 0x81, 0x02, 0x82, 0x8C, 0x46, 0x8D, 0x82, 0x00, 0x8C, 0x43, 0x81, 0x04, 0x86,
+    0x8B, 0x8E, 0x40, 0x8E, 0x8C, 0x86, 0x02, 0x86, 0x43, 0x81, 0x05, 0x84, 0x89, 0x8D, 0x8E, 0x40,
+    0x8E, 0x8D, 0x89, 0x85, 0x08, 0x83, 0x8D, 0x48, 0x8D, 0x84, 0x05, 0x85, 0x4C, 0x86, 0x03, 0x83,
+    0x4E, 0x83, 0x02, 0x8E, 0x44, 0x88, 0x82, 0x00, 0x82, 0x87, 0x44, 0x8C, 0x01, 0x85, 0x44, 0x87,
+    0x04, 0x83, 0x44, 0x83, 0x00, 0x8B, 0x43, 0x8E, 0x06, 0x8B, 0x43, 0x88, 0x00, 0x44, 0x8A, 0x06,
+    0x88, 0x43, 0x8A, 0x82, 0x51, 0x8C, 0x83, 0x51, 0x8C, 0x84, 0x51, 0x8D, 0x83, 0x44, 0x8D, 0xFC,
+    0xBC, 0x89, 0x82, 0x44, 0x88, 0x0D, 0x44, 0x8B, 0x0D, 0x8B, 0x44, 0x82, 0x0C, 0x85, 0x44, 0x8D,
+    0x81, 0x07, 0x85, 0x87, 0x02, 0x8D, 0x45, 0x89, 0x85, 0x83, 0x84, 0x85, 0x87, 0x8B, 0x41, 0x8A,
+    0x02, 0x83, 0x4E, 0x8A, 0x03, 0x84, 0x8E, 0x4C, 0x8A, 0x04, 0x81, 0x8A, 0x4B, 0x87, 0x06, 0x82,
+    0x87, 0x8B, 0x8D, 0x42, 0x8E, 0x8C, 0x89, 0x85, 0x81, 0x01, 0x05, 0x81, 0x87, 0x8B, 0x8E, 0x41,
+    0x8E, 0x8D, 0x8A, 0x85, 0x81, 0x04, 0x84, 0x8E, 0x48, 0x83, 0x03, 0x82, 0x49, 0x8D, 0x04, 0x8A,
+    0x49, 0x88, 0x04, 0x8E, 0x44, 0x8D, 0x98, 0x8A, 0x8E, 0x82, 0x04, 0x44, 0x8D, 0x09, 0x81, 0x44,
+    0x89, 0x09, 0x82, 0x44, 0x88, 0x08, 0x85, 0x8D, 0x49, 0x87, 0x01, 0x82, 0x8D, 0x4B, 0x87, 0x01,
+    0x83, 0x4C, 0x87, 0x01, 0x83, 0x4C, 0x87, 0x02, 0x94, 0x85, 0x44, 0x8A, 0xB4, 0x81, 0x04, 0x82,
+    0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82,
+    0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82,
+    0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82,
+    0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x06, 0x04,
+    0x82, 0x88, 0x8B, 0x8E, 0x4B, 0x04, 0x89, 0x4F, 0x03, 0x8B, 0x50, 0x02, 0x87, 0x44, 0x8D, 0x88,
+    0x87, 0x8B, 0x45, 0x88, 0x84, 0x03, 0x8E, 0x43, 0x8C, 0x03, 0x87, 0x44, 0x81, 0x03, 0x82, 0x44,
+    0x84, 0x04, 0x44, 0x87, 0x03, 0x84, 0x44, 0x82, 0x04, 0x8C, 0x43, 0x89, 0x03, 0x84, 0x44, 0x81,
+    0x04, 0x8C, 0x43, 0x8A, 0x03, 0x82, 0x44, 0x84, 0x04, 0x44, 0x88, 0x04, 0x8D, 0x43, 0x8C, 0x03,
+    0x87, 0x44, 0x83, 0x04, 0x85, 0x44, 0x8D, 0x89, 0x88, 0x8B, 0x44, 0x8C, 0x06, 0x89, 0x4B, 0x8E,
+    0x82, 0x07, 0x85, 0x49, 0x8B, 0x81, 0x07, 0x81, 0x8B, 0x42, 0x8E, 0x41, 0x8E, 0x8C, 0x88, 0x83,
+    0x09, 0x8D, 0x42, 0x87, 0x0F, 0x85, 0x43, 0x84, 0x0F, 0x86, 0x44, 0x8B, 0x89, 0xC8, 0x86, 0x83,
+    0x06, 0x81, 0x4D, 0x8E, 0x86, 0x05, 0x85, 0x4E, 0x88, 0x04, 0x86, 0x8D, 0x4E, 0x82, 0x01, 0x83,
+    0x8E, 0x50, 0x88, 0x00, 0x82, 0x44, 0x88, 0x82, 0x04, 0x82, 0x86, 0x8E, 0x43, 0x8B, 0x00, 0x89,
+    0x43, 0x86, 0x08, 0x85, 0x43, 0x8B, 0x00, 0x8D, 0x43, 0x09, 0x84, 0x43, 0x8A, 0x00, 0x8D, 0x43,
+    0x83, 0x08, 0x8B, 0x43, 0x86, 0x00, 0x8B, 0x43, 0x8D, 0x83, 0x05, 0x85, 0x8D, 0x43, 0x8E, 0x81,
+    0x00, 0x85, 0x45, 0x8E, 0x8C, 0x9B, 0x8D, 0x46, 0x85, 0x02, 0x8A, 0x4F, 0x85, 0x04, 0x88, 0x4C,
+    0x8A, 0x82, 0x06, 0x81, 0x86, 0x8A, 0x8D, 0x8E, 0x41, 0x9E, 0x8B, 0x89, 0x85, 0x81, 0x05, 0x00,
+    0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44,
+    0x8A, 0x0E, 0x44, 0x89, 0x0E, 0x44, 0x89, 0x0E, 0x44, 0x88, 0x01, 0x85, 0x8B, 0x8E, 0x41, 0x8D,
+    0x89, 0x83, 0x04, 0x44, 0x87, 0x81, 0x8C, 0x47, 0x8A, 0x03, 0x44, 0x87, 0x8D, 0x49, 0x8A, 0x02,
+    0x51, 0x84, 0x01, 0x47, 0x8C, 0x99, 0x8D, 0x45, 0x8A, 0x01, 0x46, 0x85, 0x03, 0x88, 0x44, 0x8E,
+    0x01, 0x45, 0x87, 0x05, 0x8E, 0x44, 0x01, 0x45, 0x81, 0x05, 0x8A, 0x44, 0x81, 0x00, 0x44, 0x8D,
+    0x06, 0x89, 0x44, 0x82, 0x00, 0x44, 0x8B, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88,
+    0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82,
+    0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44,
+    0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06,
+    0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44,
+    0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x84, 0x8C, 0x40, 0x8E, 0x8A, 0x81, 0x00,
+    0x8E, 0x43, 0x89, 0x83, 0x44, 0x8D, 0x82, 0x44, 0x8C, 0x00, 0x8B, 0x43, 0x85, 0x01, 0x85, 0x88,
+    0x87, 0x82, 0x0F, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44,
+    0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A,
+    0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00,
+    0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44,
+    0x8A, 0x05, 0x84, 0x8C, 0x40, 0x8E, 0x8A, 0x81, 0x05, 0x8E, 0x43, 0x89, 0x04, 0x83, 0x44, 0x8D,
+    0x04, 0x82, 0x44, 0x8C, 0x05, 0x8B, 0x43, 0x85, 0x06, 0x85, 0x88, 0x87, 0x82, 0x1E, 0x44, 0x8A,
+    0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05,
+    0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44,
+    0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A,
+    0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x04,
+    0x81, 0x44, 0x8A, 0x04, 0x83, 0x44, 0x89, 0x04, 0x8A, 0x44, 0x88, 0x86, 0x8B, 0x99, 0x8D, 0x45,
+    0x84, 0x87, 0x48, 0x8E, 0x00, 0x87, 0x48, 0x84, 0x00, 0x87, 0x47, 0x85, 0x01, 0x84, 0x8B, 0x8E,
+    0x41, 0x8E, 0x8C, 0x87, 0x81, 0x02, 0x00, 0x44, 0x8A, 0x0F, 0x44, 0x8A, 0x0F, 0x44, 0x8A, 0x0F,
+    0x44, 0x8A, 0x0F, 0x44, 0x8A, 0x0F, 0x44, 0x8A, 0x0F, 0x44, 0x8A, 0x0F, 0x44, 0x8A, 0x0F, 0x44,
+    0x8A, 0x06, 0x8B, 0x44, 0x89, 0x01, 0x44, 0x8A, 0x05, 0x8A, 0x44, 0x8B, 0x02, 0x44, 0x8A, 0x04,
+    0x89, 0x44, 0x8C, 0x03, 0x44, 0x8A, 0x03, 0x87, 0x44, 0x8D, 0x81, 0x03, 0x44, 0x89, 0x02, 0x86,
+    0x44, 0x8E, 0x81, 0x04, 0x44, 0x89, 0x01, 0x85, 0x44, 0x8E, 0x82, 0x05, 0x44, 0x88, 0x00, 0x83,
+    0x45, 0x83, 0x06, 0x44, 0x87, 0x81, 0x8E, 0x44, 0x84, 0x07, 0x44, 0x86, 0x8B, 0x44, 0x85, 0x08,
+    0x44, 0x8D, 0x45, 0x82, 0x08, 0x4B, 0x8D, 0x08, 0x4C, 0x89, 0x07, 0x46, 0x9D, 0x44, 0x85, 0x06,
+    0x45, 0x8B, 0x00, 0x83, 0x44, 0x8E, 0x81, 0x05, 0x44, 0x8B, 0x02, 0x88, 0x44, 0x8C, 0x05, 0x44,
+    0x8A, 0x03, 0x8C, 0x44, 0x88, 0x04, 0x44, 0x8A, 0x03, 0x82, 0x45, 0x84, 0x03, 0x44, 0x8A, 0x04,
+    0x86, 0x44, 0x8E, 0x81, 0x02, 0x44, 0x8A, 0x05, 0x8B, 0x44, 0x8B, 0x02, 0x44, 0x8A, 0x05, 0x81,
+    0x8E, 0x44, 0x87, 0x01, 0x44, 0x8A, 0x06, 0x85, 0x45, 0x83, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A,
+    0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00,
+    0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44,
+    0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A,
+    0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00,
+    0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44,
+    0x8A, 0x00, 0x43, 0x86, 0x01, 0x81, 0x87, 0x8C, 0x8E, 0x40, 0x8E, 0x8C, 0x87, 0x82, 0x03, 0x81,
+    0x87, 0x8C, 0x8E, 0x40, 0x8E, 0x8C, 0x87, 0x81, 0x03, 0x43, 0x8A, 0x00, 0x84, 0x8E, 0x47, 0x86,
+    0x01, 0x86, 0x48, 0x85, 0x02, 0x43, 0x8E, 0x83, 0x4A, 0x84, 0x85, 0x4A, 0x83, 0x01, 0x5D, 0x8B,
+    0x01, 0x47, 0x8B, 0x89, 0x8A, 0x8E, 0x48, 0x8B, 0x88, 0x8A, 0x46, 0x81, 0x00, 0x46, 0x83, 0x02,
+    0x81, 0x8E, 0x45, 0x8E, 0x82, 0x02, 0x82, 0x45, 0x84, 0x00, 0x45, 0x86, 0x04, 0x87, 0x45, 0x84,
+    0x04, 0x88, 0x44, 0x86, 0x00, 0x45, 0x81, 0x04, 0x83, 0x44, 0x8E, 0x05, 0x85, 0x44, 0x87, 0x00,
+    0x44, 0x8D, 0x05, 0x82, 0x44, 0x8B, 0x05, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8B, 0x05, 0x81, 0x44,
+    0x89, 0x05, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8A, 0x05, 0x81, 0x44, 0x88, 0x05, 0x83, 0x44, 0x87,
+    0x00, 0x44, 0x8A, 0x05, 0x81, 0x44, 0x88, 0x05, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8A, 0x05, 0x81,
+    0x44, 0x88, 0x05, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8A, 0x05, 0x81, 0x44, 0x88, 0x05, 0x83, 0x44,
+    0x87, 0x00, 0x44, 0x8A, 0x05, 0x81, 0x44, 0x88, 0x05, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8A, 0x05,
+    0x81, 0x44, 0x88, 0x05, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8A, 0x05, 0x81, 0x44, 0x88, 0x05, 0x83,
+    0x44, 0x87, 0x00, 0x44, 0x8A, 0x05, 0x81, 0x44, 0x88, 0x05, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8A,
+    0x05, 0x81, 0x44, 0x88, 0x05, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8A, 0x05, 0x81, 0x44, 0x88, 0x05,
+    0x83, 0x44, 0x87, 0x00, 0x44, 0x8A, 0x05, 0x81, 0x44, 0x88, 0x05, 0x83, 0x44, 0x87, 0x00, 0x43,
+    0x86, 0x02, 0x86, 0x8B, 0x8E, 0x41, 0x8D, 0x89, 0x83, 0x04, 0x43, 0x8A, 0x00, 0x84, 0x8D, 0x47,
+    0x8A, 0x03, 0x43, 0x8E, 0x83, 0x4A, 0x8A, 0x02, 0x51, 0x84, 0x01, 0x47, 0x8C, 0x99, 0x8C, 0x45,
+    0x8A, 0x01, 0x46, 0x84, 0x03, 0x88, 0x44, 0x8E, 0x01, 0x45, 0x87, 0x05, 0x8E, 0x44, 0x01, 0x45,
+    0x81, 0x05, 0x8A, 0x44, 0x81, 0x00, 0x44, 0x8D, 0x06, 0x89, 0x44, 0x82, 0x00, 0x44, 0x8B, 0x06,
+    0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44,
+    0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00,
+    0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A,
+    0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88,
+    0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82,
+    0x05, 0x84, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x8B, 0x86, 0x09, 0x83, 0x8C, 0x49, 0x87, 0x06, 0x85,
+    0x4C, 0x8B, 0x04, 0x83, 0x4E, 0x8A, 0x03, 0x8D, 0x45, 0x8B, 0x89, 0x8A, 0x8D, 0x45, 0x85, 0x01,
+    0x85, 0x44, 0x8D, 0x82, 0x03, 0x88, 0x44, 0x8D, 0x01, 0x8B, 0x44, 0x83, 0x05, 0x8B, 0x44, 0x83,
+    0x00, 0x44, 0x8D, 0x06, 0x85, 0x44, 0x88, 0x82, 0x44, 0x8A, 0x06, 0x82, 0x44, 0x8A, 0x83, 0x44,
+    0x88, 0x07, 0x44, 0x8C, 0x84, 0x44, 0x87, 0x07, 0x44, 0x8C, 0x84, 0x44, 0x88, 0x07, 0x44, 0x8C,
+    0x82, 0x44, 0x8A, 0x06, 0x82, 0x44, 0x8A, 0x00, 0x44, 0x8D, 0x06, 0x85, 0x44, 0x87, 0x00, 0x8B,
+    0x44, 0x84, 0x05, 0x8B, 0x44, 0x84, 0x00, 0x85, 0x44, 0x8E, 0x82, 0x03, 0x87, 0x44, 0x8D, 0x02,
+    0x8C, 0x45, 0x8B, 0x99, 0x8D, 0x45, 0x86, 0x02, 0x82, 0x4E, 0x8B, 0x04, 0x84, 0x4C, 0x8B, 0x81,
+    0x05, 0x82, 0x8B, 0x49, 0x88, 0x09, 0x83, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x8B, 0x86, 0x81, 0x04,
+    0x00, 0x43, 0x8B, 0x02, 0x86, 0x8B, 0x8E, 0x40, 0x8E, 0x8B, 0x86, 0x05, 0x44, 0x00, 0x82, 0x8C,
+    0x46, 0x8D, 0x82, 0x03, 0x44, 0x85, 0x8D, 0x48, 0x8E, 0x81, 0x02, 0x50, 0x8B, 0x02, 0x47, 0x8A,
+    0x88, 0x8A, 0x8E, 0x45, 0x83, 0x01, 0x45, 0x8D, 0x81, 0x02, 0x81, 0x8C, 0x44, 0x89, 0x01, 0x45,
+    0x83, 0x04, 0x82, 0x44, 0x8E, 0x01, 0x44, 0x8E, 0x06, 0x8C, 0x44, 0x81, 0x00, 0x44, 0x8B, 0x06,
+    0x89, 0x44, 0x83, 0x00, 0x44, 0x8A, 0x06, 0x87, 0x44, 0x84, 0x00, 0x44, 0x8A, 0x06, 0x87, 0x44,
+    0x85, 0x00, 0x44, 0x8A, 0x06, 0x87, 0x44, 0x84, 0x00, 0x44, 0x8C, 0x06, 0x89, 0x44, 0x82, 0x00,
+    0x45, 0x06, 0x8C, 0x44, 0x81, 0x00, 0x45, 0x85, 0x04, 0x82, 0x44, 0x8D, 0x01, 0x45, 0x8E, 0x83,
+    0x02, 0x81, 0x8D, 0x44, 0x88, 0x01, 0x47, 0x8B, 0x89, 0x8A, 0x46, 0x82, 0x01, 0x50, 0x8A, 0x02,
+    0x44, 0x8B, 0x49, 0x8D, 0x81, 0x02, 0x44, 0x87, 0x84, 0x8E, 0x46, 0x8C, 0x81, 0x03, 0x44, 0x88,
+    0x00, 0x81, 0x87, 0x8C, 0x8E, 0x40, 0x8E, 0x8B, 0x85, 0x05, 0x44, 0x89, 0x0E, 0x44, 0x8A, 0x0E,
+    0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44,
+    0x8A, 0x0E, 0x44, 0x8A, 0x0D, 0x04, 0x85, 0x8A, 0x8E, 0x40, 0x8E, 0x8C, 0x87, 0x81, 0x01, 0x8C,
+    0x43, 0x81, 0x02, 0x81, 0x8B, 0x46, 0x8E, 0x84, 0x00, 0x44, 0x81, 0x01, 0x81, 0x8D, 0x49, 0x85,
+    0x44, 0x81, 0x01, 0x89, 0x50, 0x81, 0x00, 0x82, 0x46, 0x8B, 0x8A, 0x8B, 0x47, 0x81, 0x00, 0x88,
+    0x44, 0x8E, 0x82, 0x02, 0x81, 0x8B, 0x45, 0x81, 0x00, 0x8D, 0x44, 0x84, 0x05, 0x8E, 0x44, 0x81,
+    0x00, 0x44, 0x8E, 0x06, 0x88, 0x44, 0x81, 0x82, 0x44, 0x8A, 0x06, 0x85, 0x44, 0x81, 0x83, 0x44,
+    0x88, 0x06, 0x83, 0x44, 0x81, 0x84, 0x44, 0x87, 0x06, 0x83, 0x44, 0x81, 0x83, 0x44, 0x88, 0x06,
+    0x83, 0x44, 0x81, 0x83, 0x44, 0x89, 0x06, 0x84, 0x44, 0x81, 0x00, 0x44, 0x8D, 0x06, 0x87, 0x44,
+    0x81, 0x00, 0x8D, 0x44, 0x82, 0x05, 0x8C, 0x44, 0x81, 0x00, 0x89, 0x44, 0x8C, 0x81, 0x03, 0x87,
+    0x45, 0x81, 0x00, 0x83, 0x45, 0x8E, 0x89, 0x87, 0x88, 0x8C, 0x46, 0x81, 0x01, 0x8A, 0x50, 0x81,
+    0x01, 0x81, 0x8D, 0x48, 0x8E, 0x88, 0x44, 0x81, 0x02, 0x82, 0x8C, 0x46, 0x8D, 0x83, 0x87, 0x44,
+    0x81, 0x04, 0x86, 0x8B, 0x8E, 0x40, 0x8E, 0x8C, 0x86, 0x01, 0x88, 0x44, 0x81, 0x0D, 0x89, 0x44,
+    0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44,
+    0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44,
+    0x81, 0x00, 0x43, 0x85, 0x02, 0x83, 0x8A, 0x8E, 0x41, 0x85, 0x00, 0x43, 0x89, 0x01, 0x88, 0x44,
+    0x85, 0x00, 0x43, 0x8C, 0x00, 0x89, 0x45, 0x84, 0x00, 0x44, 0x86, 0x46, 0x83, 0x00, 0x4C, 0x81,
+    0x00, 0x47, 0x8D, 0x88, 0x95, 0x86, 0x01, 0x46, 0x86, 0x06, 0x45, 0x87, 0x07, 0x45, 0x08, 0x44,
+    0x8B, 0x08, 0x44, 0x8A, 0x08, 0x44, 0x8A, 0x08, 0x44, 0x8A, 0x08, 0x44, 0x8A, 0x08, 0x44, 0x8A,
+    0x08, 0x44, 0x8A, 0x08, 0x44, 0x8A, 0x08, 0x44, 0x8A, 0x08, 0x44, 0x8A, 0x08, 0x44, 0x8A, 0x08,
+    0x44, 0x8A, 0x07, 0x03, 0x85, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x85, 0x81, 0x03, 0x83,
+    0x8D, 0x4A, 0x8A, 0x01, 0x83, 0x4C, 0x8D, 0x01, 0x8D, 0x4C, 0x86, 0x00, 0x82, 0x44, 0x8D, 0x85,
+    0x93, 0x85, 0x89, 0x8E, 0x41, 0x01, 0x84, 0x44, 0x86, 0x05, 0x85, 0x86, 0x01, 0x83, 0x44, 0x8C,
+    0x81, 0x08, 0x81, 0x46, 0x88, 0x82, 0x07, 0x8A, 0x47, 0x8B, 0x85, 0x05, 0x81, 0x8D, 0x48, 0x8D,
+    0x85, 0x04, 0x81, 0x8A, 0x49, 0x8A, 0x05, 0x82, 0x8A, 0x48, 0x88, 0x06, 0x81, 0x87, 0x8E, 0x46,
+    0x81, 0x08, 0x87, 0x45, 0x85, 0x09, 0x85, 0x44, 0x86, 0x83, 0x89, 0x83, 0x06, 0x83, 0x44, 0x85,
+    0x84, 0x41, 0x8E, 0x89, 0x86, 0x83, 0x82, 0x83, 0x85, 0x8D, 0x44, 0x82, 0x84, 0x4D, 0x8B, 0x00,
+    0x84, 0x4C, 0x8E, 0x82, 0x00, 0x83, 0x4B, 0x8C, 0x82, 0x02, 0x81, 0x86, 0x8A, 0x8C, 0x8E, 0x42,
+    0x8E, 0x8C, 0x88, 0x83, 0x03, 0x04, 0x83, 0xA6, 0x81, 0x0A, 0x8B, 0x42, 0x83, 0x09, 0x81, 0x43,
+    0x83, 0x09, 0x87, 0x43, 0x83, 0x09, 0x8D, 0x43, 0x83, 0x07, 0x82, 0x8B, 0x4A, 0x01, 0x88, 0x4C,
+    0x00, 0x82, 0x4D, 0x00, 0x82, 0x4D, 0x01, 0x94, 0x89, 0x44, 0x86, 0xC4, 0x03, 0x86, 0x44, 0x83,
+    0x08, 0x86, 0x44, 0x83, 0x08, 0x86, 0x44, 0x83, 0x08, 0x86, 0x44, 0x83, 0x08, 0x86, 0x44, 0x83,
+    0x08, 0x86, 0x44, 0x83, 0x08, 0x86, 0x44, 0x83, 0x08, 0x86, 0x44, 0x83, 0x08, 0x86, 0x44, 0x83,
+    0x08, 0x86, 0x44, 0x84, 0x08, 0x85, 0x44, 0x8A, 0x08, 0x82, 0x45, 0x8C, 0x88, 0x89, 0x8B, 0x40,
+    0x84, 0x03, 0x8E, 0x49, 0x84, 0x03, 0x86, 0x49, 0x84, 0x04, 0x89, 0x48, 0x84, 0x05, 0x84, 0x8A,
+    0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x84, 0x00, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88,
+    0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82,
+    0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A,
+    0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88,
+    0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8B, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8B, 0x44, 0x82,
+    0x44, 0x88, 0x06, 0x8E, 0x44, 0x82, 0x44, 0x8A, 0x05, 0x81, 0x45, 0x81, 0x44, 0x8E, 0x05, 0x88,
+    0x45, 0x00, 0x45, 0x87, 0x03, 0x85, 0x46, 0x00, 0x8B, 0x45, 0x8C, 0x88, 0x89, 0x8C, 0x47, 0x00,
+    0x84, 0x51, 0x01, 0x8B, 0x4A, 0x83, 0x44, 0x02, 0x8B, 0x47, 0x8D, 0x83, 0x00, 0x8B, 0x43, 0x03,
+    0x84, 0x8A, 0x8D, 0x41, 0x8E, 0x8B, 0x86, 0x02, 0x87, 0x43, 0x8D, 0x44, 0x81, 0x07, 0x87, 0x44,
+    0x86, 0x87, 0x44, 0x86, 0x07, 0x8C, 0x44, 0x91, 0x44, 0x8C, 0x06, 0x82, 0x44, 0x8A, 0x01, 0x8A,
+    0x44, 0x81, 0x05, 0x87, 0x44, 0x84, 0x01, 0x84, 0x44, 0x86, 0x05, 0x8C, 0x43, 0x8E, 0x03, 0x8E,
+    0x43, 0x8C, 0x04, 0x81, 0x44, 0x88, 0x03, 0x88, 0x44, 0x81, 0x03, 0x87, 0x44, 0x82, 0x03, 0x82,
+    0x44, 0x86, 0x03, 0x8C, 0x43, 0x8C, 0x05, 0x8C, 0x43, 0x8C, 0x02, 0x81, 0x44, 0x86, 0x05, 0x86,
+    0x44, 0x81, 0x01, 0x87, 0x44, 0x81, 0x05, 0x81, 0x44, 0x86, 0x01, 0x8C, 0x43, 0x8A, 0x07, 0x8A,
+    0x43, 0x8C, 0x00, 0x81, 0x44, 0x84, 0x07, 0x84, 0x44, 0x00, 0x86, 0x43, 0x8E, 0x09, 0x8E, 0x43,
+    0x84, 0x8A, 0x43, 0x88, 0x09, 0x88, 0x43, 0x88, 0x8E, 0x43, 0x82, 0x09, 0x82, 0x43, 0x8A, 0x43,
+    0x8C, 0x0B, 0x8C, 0x47, 0x86, 0x0B, 0x86, 0x47, 0x81, 0x0B, 0x81, 0x46, 0x8A, 0x0D, 0x8A, 0x45,
+    0x84, 0x0D, 0x84, 0x44, 0x8E, 0x07, 0x87, 0x44, 0x82, 0x05, 0x8E, 0x44, 0x88, 0x05, 0x88, 0x44,
+    0x00, 0x83, 0x44, 0x86, 0x04, 0x83, 0x45, 0x8C, 0x05, 0x8C, 0x43, 0x8B, 0x01, 0x8E, 0x43, 0x8A,
+    0x04, 0x87, 0x46, 0x04, 0x81, 0x44, 0x87, 0x01, 0x8A, 0x43, 0x8E, 0x04, 0x8B, 0x46, 0x84, 0x03,
+    0x85, 0x44, 0x82, 0x01, 0x85, 0x44, 0x82, 0x03, 0x43, 0x8D, 0x42, 0x88, 0x03, 0x89, 0x43, 0x8E,
+    0x02, 0x81, 0x44, 0x86, 0x02, 0x83, 0x42, 0x8E, 0x87, 0x42, 0x8C, 0x03, 0x8D, 0x43, 0x89, 0x03,
+    0x8C, 0x43, 0x8A, 0x02, 0x87, 0x42, 0x8A, 0x83, 0x43, 0x02, 0x82, 0x44, 0x84, 0x03, 0x88, 0x43,
+    0x8E, 0x02, 0x8B, 0x42, 0x86, 0x00, 0x43, 0x83, 0x01, 0x86, 0x44, 0x04, 0x83, 0x44, 0x83, 0x01,
+    0x43, 0x83, 0x00, 0x8C, 0x42, 0x87, 0x01, 0x8A, 0x43, 0x8B, 0x05, 0x44, 0x87, 0x00, 0x83, 0x43,
+    0x01, 0x88, 0x42, 0x8B, 0x01, 0x8E, 0x43, 0x87, 0x05, 0x8A, 0x43, 0x8A, 0x00, 0x87, 0x42, 0x8B,
+    0x01, 0x85, 0x43, 0x00, 0x81, 0x44, 0x82, 0x05, 0x86, 0x43, 0x8D, 0x00, 0x8A, 0x42, 0x88, 0x01,
+    0x81, 0x43, 0x82, 0x84, 0x43, 0x8E, 0x06, 0x81, 0x44, 0x00, 0x8C, 0x42, 0x84, 0x02, 0x8D, 0x42,
+    0x84, 0x87, 0x43, 0x89, 0x07, 0x8D, 0x43, 0x83, 0x43, 0x81, 0x02, 0x89, 0x42, 0x87, 0x8A, 0x43,
+    0x85, 0x07, 0x88, 0x43, 0x87, 0x42, 0x8D, 0x03, 0x86, 0x42, 0x89, 0x8D, 0x43, 0x08, 0x84, 0x43,
+    0x8B, 0x42, 0x89, 0x03, 0x82, 0x42, 0x8C, 0x43, 0x8B, 0x09, 0x47, 0x86, 0x04, 0x47, 0x87, 0x09,
+    0x8B, 0x46, 0x82, 0x04, 0x8B, 0x46, 0x82, 0x09, 0x87, 0x45, 0x8E, 0x05, 0x88, 0x45, 0x8E, 0x0A,
+    0x82, 0x45, 0x8B, 0x05, 0x85, 0x45, 0x89, 0x0B, 0x8D, 0x44, 0x87, 0x05, 0x81, 0x45, 0x85, 0x05,
+    0x82, 0x45, 0x84, 0x05, 0x84, 0x45, 0x82, 0x00, 0x87, 0x44, 0x8D, 0x05, 0x8D, 0x44, 0x87, 0x02,
+    0x8D, 0x44, 0x87, 0x03, 0x87, 0x44, 0x8C, 0x03, 0x83, 0x45, 0x81, 0x01, 0x81, 0x45, 0x83, 0x04,
+    0x88, 0x44, 0x8A, 0x01, 0x8A, 0x44, 0x88, 0x06, 0x8D, 0x44, 0x83, 0x84, 0x44, 0x8D, 0x07, 0x83,
+    0x44, 0x9D, 0x44, 0x83, 0x08, 0x89, 0x49, 0x88, 0x0A, 0x8E, 0x47, 0x8D, 0x0B, 0x84, 0x47, 0x83,
+    0x0C, 0x8E, 0x45, 0x8E, 0x0C, 0x89, 0x47, 0x88, 0x0A, 0x83, 0x49, 0x83, 0x09, 0x8D, 0x49, 0x8D,
+    0x08, 0x88, 0x44, 0x88, 0x89, 0x44, 0x87, 0x06, 0x83, 0x44, 0x8E, 0x01, 0x8E, 0x44, 0x82, 0x05,
+    0x8D, 0x44, 0x85, 0x01, 0x85, 0x44, 0x8C, 0x04, 0x88, 0x44, 0x8B, 0x03, 0x8C, 0x44, 0x87, 0x02,
+    0x83, 0x45, 0x82, 0x03, 0x82, 0x45, 0x82, 0x01, 0x8C, 0x44, 0x88, 0x05, 0x89, 0x44, 0x8C, 0x00,
+    0x87, 0x44, 0x8D, 0x07, 0x8E, 0x44, 0x87, 0x8C, 0x44, 0x85, 0x07, 0x89, 0x44, 0x96, 0x44, 0x8B,
+    0x07, 0x8E, 0x44, 0x81, 0x00, 0x45, 0x06, 0x84, 0x44, 0x8A, 0x01, 0x8A, 0x44, 0x85, 0x05, 0x89,
+    0x44, 0x84, 0x01, 0x83, 0x44, 0x8A, 0x05, 0x8E, 0x43, 0x8E, 0x03, 0x8D, 0x44, 0x04, 0x83, 0x44,
+    0x89, 0x03, 0x87, 0x44, 0x85, 0x03, 0x88, 0x44, 0x83, 0x03, 0x81, 0x44, 0x8A, 0x03, 0x8D, 0x43,
+    0x8D, 0x05, 0x8A, 0x44, 0x02, 0x82, 0x44, 0x87, 0x05, 0x84, 0x44, 0x84, 0x01, 0x88, 0x44, 0x81,
+    0x06, 0x8E, 0x43, 0x89, 0x01, 0x8D, 0x43, 0x8B, 0x07, 0x87, 0x43, 0x8E, 0x00, 0x82, 0x44, 0x85,
+    0x07, 0x81, 0x44, 0x83, 0x87, 0x43, 0x8E, 0x09, 0x8B, 0x43, 0x87, 0x8B, 0x43, 0x89, 0x09, 0x85,
+    0x43, 0x8A, 0x8E, 0x43, 0x83, 0x0A, 0x8E, 0x42, 0x8D, 0x43, 0x8D, 0x0B, 0x88, 0x47, 0x87, 0x0B,
+    0x82, 0x47, 0x81, 0x0C, 0x8B, 0x45, 0x8B, 0x0D, 0x85, 0x45, 0x85, 0x0E, 0x8E, 0x44, 0x0F, 0x8E,
+    0x43, 0x89, 0x0E, 0x85, 0x44, 0x83, 0x0E, 0x8D, 0x43, 0x8D, 0x0D, 0x81, 0x8C, 0x44, 0x87, 0x09,
+    0x88, 0x8A, 0x89, 0x8B, 0x45, 0x8E, 0x0A, 0x8B, 0x48, 0x85, 0x0A, 0x8B, 0x47, 0x87, 0x0B, 0x8B,
+    0x45, 0x8E, 0x85, 0x0C, 0x88, 0x8E, 0x41, 0x8E, 0x8B, 0x86, 0x0D, 0x86, 0x4E, 0x81, 0x86, 0x4E,
+    0x81, 0x86, 0x4E, 0x81, 0x86, 0x4E, 0x00, 0x82, 0xF5, 0x8B, 0x44, 0x87, 0x08, 0x83, 0x44, 0x8C,
+    0x08, 0x81, 0x8E, 0x43, 0x8E, 0x81, 0x08, 0x8A, 0x44, 0x85, 0x08, 0x86, 0x44, 0x89, 0x08, 0x82,
+    0x44, 0x8D, 0x09, 0x8C, 0x44, 0x83, 0x08, 0x88, 0x44, 0x87, 0x08, 0x84, 0x44, 0x8B, 0x08, 0x81,
+    0x8E, 0x43, 0x8E, 0x81, 0x08, 0x8B, 0x44, 0x84, 0x08, 0x86, 0x44, 0x88, 0x08, 0x82, 0x45, 0xF5,
+    0x85, 0x82, 0x8D, 0x4E, 0x86, 0x4F, 0x86, 0x4F, 0x86, 0x4F, 0x86, 0x06, 0x81, 0x86, 0x8A, 0x8D,
+    0x8E, 0x40, 0x87, 0x05, 0x84, 0x45, 0x87, 0x04, 0x81, 0x46, 0x87, 0x04, 0x87, 0x46, 0x87, 0x04,
+    0x89, 0x44, 0x88, 0x84, 0x81, 0x04, 0x8A, 0x43, 0x88, 0x07, 0x8A, 0x43, 0x84, 0x07, 0x8A, 0x43,
+    0x83, 0x07, 0x8A, 0x43, 0x83, 0x07, 0x8A, 0x43, 0x83, 0x07, 0x8A, 0x43, 0x83, 0x07, 0x8B, 0x43,
+    0x83, 0x06, 0x81, 0x44, 0x83, 0x05, 0x83, 0x8C, 0x44, 0x03, 0x84, 0x8C, 0x8E, 0x45, 0x88, 0x03,
+    0x86, 0x46, 0x87, 0x04, 0x86, 0x44, 0x88, 0x81, 0x05, 0x86, 0x46, 0x88, 0x04, 0x85, 0x8C, 0x8E,
+    0x45, 0x89, 0x06, 0x84, 0x8D, 0x44, 0x81, 0x06, 0x81, 0x44, 0x83, 0x07, 0x8B, 0x43, 0x83, 0x07,
+    0x8A, 0x43, 0x83, 0x07, 0x8A, 0x43, 0x83, 0x07, 0x8A, 0x43, 0x83, 0x07, 0x8A, 0x43, 0x83, 0x07,
+    0x8A, 0x43, 0x84, 0x07, 0x8A, 0x43, 0x88, 0x07, 0x89, 0x44, 0x89, 0x84, 0x81, 0x04, 0x87, 0x46,
+    0x87, 0x04, 0x81, 0x46, 0x87, 0x05, 0x84, 0x45, 0x87, 0x06, 0x81, 0x86, 0x8A, 0x8D, 0x8E, 0x40,
+    0x87, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88,
+    0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89,
+    0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42,
+    0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88,
+    0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89,
+    0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42,
+    0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88,
+    0x89, 0x42, 0x88, 0x87, 0x40, 0x8E, 0x8D, 0x8B, 0x87, 0x81, 0x06, 0x87, 0x45, 0x86, 0x05, 0x87,
+    0x46, 0x81, 0x04, 0x87, 0x46, 0x87, 0x04, 0x81, 0x84, 0x88, 0x44, 0x89, 0x07, 0x88, 0x43, 0x8A,
+    0x07, 0x84, 0x43, 0x8A, 0x07, 0x84, 0x43, 0x8A, 0x07, 0x84, 0x43, 0x8A, 0x07, 0x84, 0x43, 0x8A,
+    0x07, 0x84, 0x43, 0x8A, 0x07, 0x84, 0x43, 0x8B, 0x07, 0x83, 0x43, 0x8E, 0x07, 0x81, 0x44, 0x8B,
+    0x82, 0x06, 0x88, 0x45, 0x8D, 0x8B, 0x84, 0x04, 0x87, 0x46, 0x86, 0x05, 0x81, 0x88, 0x44, 0x86,
+    0x04, 0x88, 0x46, 0x86, 0x03, 0x8A, 0x45, 0x8E, 0x8C, 0x84, 0x02, 0x81, 0x44, 0x8C, 0x83, 0x05,
+    0x83, 0x44, 0x81, 0x06, 0x84, 0x43, 0x8B, 0x07, 0x84, 0x43, 0x8A, 0x07, 0x84, 0x43, 0x8A, 0x07,
+    0x84, 0x43, 0x8A, 0x07, 0x84, 0x43, 0x8A, 0x07, 0x84, 0x43, 0x8A, 0x07, 0x89, 0x43, 0x8A, 0x04,
+    0x81, 0x84, 0x88, 0x44, 0x89, 0x04, 0x87, 0x46, 0x87, 0x04, 0x87, 0x46, 0x82, 0x04, 0x87, 0x45,
+    0x85, 0x05, 0x87, 0x41, 0x8D, 0x8B, 0x87, 0x81, 0x06, 0x15, 0x82, 0x89, 0x8E, 0x40, 0x8E, 0x8B,
+    0x85, 0x08, 0x86, 0x01, 0x84, 0x46, 0x8E, 0x86, 0x05, 0x85, 0x40, 0x81, 0x82, 0x49, 0x8E, 0x88,
+    0x83, 0x81, 0x83, 0x8A, 0x41, 0x81, 0x85, 0x51, 0x81, 0x85, 0x41, 0x88, 0x82, 0x81, 0x84, 0x8A,
+    0x49, 0x8C, 0x00, 0x85, 0x8E, 0x83, 0x04, 0x81, 0x89, 0x46, 0x8D, 0x81, 0x00, 0x84, 0x82, 0x07,
+    0x81, 0x88, 0x8C, 0x41, 0x8D, 0x87, 0x16, 0x00, 0x87, 0x8D, 0x40, 0x8D, 0x85, 0x00, 0x86, 0x44,
+    0x83, 0x8B, 0x44, 0x89, 0x8C, 0x44, 0x89, 0x88, 0x44, 0x86, 0x81, 0x8C, 0x42, 0x8B, 0x02, 0x82,
+    0x84, 0x82, 0x10, 0x87, 0xA8, 0x85, 0x01, 0x8E, 0x42, 0x8B, 0x01, 0x43, 0x8B, 0x01, 0x43, 0x8C,
+    0x00, 0x81, 0x43, 0x8D, 0x00, 0x82, 0x43, 0x8E, 0x00, 0x82, 0x44, 0x00, 0x83, 0x44, 0x00, 0x84,
+    0x44, 0x00, 0x85, 0x44, 0x81, 0x86, 0x44, 0x82, 0x87, 0x44, 0x83, 0x87, 0x44, 0x84, 0x88, 0x44,
+    0x84, 0x89, 0x44, 0x85, 0x8A, 0x44, 0x86, 0x8B, 0x44, 0x87, 0x8C, 0x44, 0x88, 0x8C, 0x44, 0x89,
+    0x07, 0x88, 0x41, 0x8C, 0x0D, 0x88, 0x41, 0x8C, 0x0D, 0x88, 0x41, 0x8C, 0x0B, 0x86, 0x8A, 0x8E,
+    0x42, 0x8E, 0x8C, 0x89, 0x85, 0x05, 0x86, 0x4A, 0x8E, 0x82, 0x02, 0x8A, 0x4B, 0x8D, 0x02, 0x88,
+    0x4C, 0x87, 0x01, 0x82, 0x46, 0x8B, 0x99, 0x8B, 0x42, 0x81, 0x01, 0x88, 0x44, 0x8E, 0x82, 0x04,
+    0x85, 0x87, 0x02, 0x8D, 0x44, 0x84, 0x09, 0x81, 0x44, 0x8D, 0x0A, 0x83, 0x44, 0x89, 0x0A, 0x84,
+    0x44, 0x87, 0x0A, 0x85, 0x44, 0x87, 0x0A, 0x84, 0x44, 0x87, 0x0A, 0x83, 0x44, 0x89, 0x0A, 0x81,
+    0x44, 0x8D, 0x0B, 0x8E, 0x44, 0x84, 0x0A, 0x89, 0x44, 0x8E, 0x83, 0x04, 0x82, 0x88, 0x89, 0x01,
+    0x82, 0x46, 0x8C, 0x9A, 0x8B, 0x8E, 0x41, 0x8A, 0x02, 0x88, 0x4C, 0x8A, 0x03, 0x8A, 0x4B, 0x8A,
+    0x04, 0x87, 0x4A, 0x88, 0x06, 0x86, 0x8A, 0x8E, 0x42, 0x8E, 0x8B, 0x87, 0x82, 0x09, 0x88, 0x41,
+    0x8C, 0x0D, 0x88, 0x41, 0x8C, 0x0D, 0x88, 0x41, 0x8C, 0x05, 0x06, 0x81, 0x87, 0x8B, 0x8E, 0x41,
+    0x8E, 0x8C, 0x89, 0x86, 0x81, 0x07, 0x86, 0x4A, 0x8B, 0x81, 0x04, 0x87, 0x4B, 0x8D, 0x04, 0x83,
+    0x4C, 0x86, 0x04, 0x8A, 0x45, 0x8C, 0x8A, 0x8B, 0x8D, 0x42, 0x05, 0x8E, 0x44, 0x84, 0x03, 0x81,
+    0x86, 0x87, 0x04, 0x81, 0x44, 0x8A, 0x0C, 0x82, 0x44, 0x87, 0x0C, 0x82, 0x44, 0x87, 0x0C, 0x82,
+    0x44, 0x87, 0x0C, 0x82, 0x44, 0x87, 0x09, 0x87, 0x4E, 0x86, 0x02, 0x87, 0x4E, 0x86, 0x02, 0x87,
+    0x4E, 0x86, 0x02, 0x87, 0x4E, 0x86, 0x03, 0x91, 0x83, 0x44, 0x87, 0xD1, 0x06, 0x82, 0x44, 0x87,
+    0x0C, 0x82, 0x44, 0x87, 0x0C, 0x83, 0x44, 0x85, 0x0C, 0x86, 0x44, 0x81, 0x0C, 0x8D, 0x43, 0x89,
+    0x0B, 0x81, 0x8C, 0x43, 0x89, 0x0B, 0x85, 0x45, 0xFD, 0xBD, 0x8C, 0x87, 0x52, 0x87, 0x52, 0x87,
+    0x52, 0x87, 0x52, 0x12, 0x81, 0x8D, 0x88, 0x08, 0x81, 0x8C, 0x89, 0x01, 0x81, 0x8D, 0x41, 0x88,
+    0x00, 0x86, 0x8A, 0x9C, 0x8A, 0x84, 0x81, 0x8C, 0x41, 0x89, 0x00, 0x8A, 0x4F, 0x85, 0x81, 0x8D,
+    0x4D, 0x88, 0x01, 0x81, 0x8D, 0x4B, 0x89, 0x03, 0x8C, 0x42, 0x8D, 0x84, 0x00, 0x81, 0x86, 0x43,
+    0x88, 0x02, 0x82, 0x42, 0x8E, 0x81, 0x03, 0x84, 0x42, 0x8E, 0x02, 0x86, 0x42, 0x87, 0x05, 0x8C,
+    0x42, 0x81, 0x01, 0x87, 0x42, 0x85, 0x05, 0x89, 0x42, 0x82, 0x01, 0x86, 0x42, 0x87, 0x05, 0x8C,
+    0x42, 0x81, 0x01, 0x83, 0x42, 0x8E, 0x81, 0x03, 0x84, 0x42, 0x8E, 0x03, 0x8C, 0x42, 0x8D, 0x84,
+    0x00, 0x81, 0x86, 0x43, 0x88, 0x02, 0x81, 0x8C, 0x4B, 0x88, 0x01, 0x81, 0x8C, 0x4D, 0x88, 0x00,
+    0x89, 0x4F, 0x84, 0x00, 0x8C, 0x41, 0x88, 0x81, 0x87, 0x8A, 0x8C, 0x8B, 0x89, 0x84, 0x81, 0x8D,
+    0x41, 0x88, 0x01, 0x81, 0x8C, 0x88, 0x08, 0x81, 0x8D, 0x88, 0x13, 0x8A, 0x44, 0x82, 0x07, 0x87,
+    0x44, 0x84, 0x82, 0x44, 0x89, 0x07, 0x8E, 0x43, 0x8C, 0x01, 0x8A, 0x44, 0x81, 0x05, 0x85, 0x44,
+    0x84, 0x01, 0x82, 0x44, 0x87, 0x05, 0x8C, 0x43, 0x8C, 0x03, 0x8A, 0x43, 0x8E, 0x04, 0x83, 0x44,
+    0x84, 0x03, 0x82, 0x44, 0x85, 0x03, 0x8A, 0x43, 0x8C, 0x05, 0x8A, 0x43, 0x8C, 0x02, 0x81, 0x44,
+    0x83, 0x05, 0x82, 0x44, 0x83, 0x01, 0x88, 0x43, 0x8B, 0x07, 0x8A, 0x43, 0x8A, 0x01, 0x8E, 0x43,
+    0x83, 0x07, 0x82, 0x44, 0x81, 0x86, 0x43, 0x8B, 0x09, 0x8A, 0x43, 0x88, 0x8D, 0x43, 0x83, 0x09,
+    0x82, 0x48, 0x8B, 0x0B, 0x8A, 0x47, 0x83, 0x0B, 0x82, 0x46, 0x8B, 0x09, 0x86, 0x4D, 0x06, 0x86,
+    0x4D, 0x06, 0x86, 0x4D, 0x06, 0x82, 0xB4, 0x8E, 0x43, 0x8A, 0xB4, 0x0B, 0x8D, 0x43, 0x87, 0x0F,
+    0x8D, 0x43, 0x87, 0x0A, 0x86, 0x4D, 0x06, 0x86, 0x4D, 0x06, 0x86, 0x4D, 0x06, 0x82, 0xB4, 0x8E,
+    0x43, 0x8A, 0xB4, 0x0B, 0x8D, 0x43, 0x87, 0x0F, 0x8D, 0x43, 0x87, 0x0F, 0x8D, 0x43, 0x87, 0x07,
+    0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89,
+    0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42,
+    0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x27, 0x89, 0x42,
+    0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88,
+    0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89,
+    0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x03, 0x83, 0x88, 0x8C, 0x8E,
+    0x41, 0x8D, 0x8B, 0x87, 0x82, 0x04, 0x8A, 0x49, 0x8D, 0x83, 0x01, 0x8C, 0x4B, 0x81, 0x00, 0x85,
+    0x43, 0x8E, 0x8A, 0x99, 0x8C, 0x42, 0x8A, 0x01, 0x8A, 0x42, 0x8E, 0x81, 0x03, 0x81, 0x87, 0x8E,
+    0x83, 0x01, 0x8B, 0x42, 0x8D, 0x0A, 0x89, 0x43, 0x86, 0x09, 0x83, 0x44, 0x8B, 0x83, 0x08, 0x88,
+    0x45, 0x8D, 0x86, 0x07, 0x89, 0x46, 0x8E, 0x86, 0x04, 0x85, 0x49, 0x8A, 0x02, 0x81, 0x43, 0x89,
+    0x85, 0x8C, 0x44, 0x89, 0x01, 0x87, 0x42, 0x8B, 0x02, 0x84, 0x8D, 0x43, 0x83, 0x00, 0x8A, 0x42,
+    0x86, 0x03, 0x82, 0x43, 0x88, 0x00, 0x8B, 0x42, 0x89, 0x04, 0x8B, 0x42, 0x89, 0x00, 0x88, 0x43,
+    0x85, 0x03, 0x8B, 0x42, 0x87, 0x00, 0x83, 0x44, 0x8B, 0x82, 0x00, 0x82, 0x43, 0x84, 0x01, 0x87,
+    0x45, 0x8B, 0x8E, 0x42, 0x8C, 0x03, 0x86, 0x48, 0x8D, 0x81, 0x04, 0x81, 0x89, 0x46, 0x8B, 0x81,
+    0x07, 0x87, 0x8D, 0x44, 0x8C, 0x09, 0x86, 0x8E, 0x43, 0x85, 0x09, 0x83, 0x43, 0x88, 0x00, 0x81,
+    0x08, 0x43, 0x89, 0x00, 0x40, 0x89, 0x84, 0x05, 0x86, 0x43, 0x86, 0x00, 0x43, 0x8B, 0x89, 0x88,
+    0x89, 0x8C, 0x44, 0x81, 0x00, 0x4C, 0x85, 0x01, 0x8C, 0x49, 0x8E, 0x84, 0x03, 0x83, 0x88, 0x8B,
+    0x8E, 0x42, 0x8D, 0x8A, 0x85, 0x03, 0x81, 0x8A, 0x8E, 0x8D, 0x85, 0x02, 0x85, 0x8D, 0x8E, 0x8A,
+    0x81, 0x89, 0x43, 0x82, 0x00, 0x82, 0x43, 0x8A, 0x8C, 0x43, 0x85, 0x00, 0x84, 0x43, 0x8D, 0x8A,
+    0x43, 0x82, 0x00, 0x82, 0x43, 0x8A, 0x81, 0x8B, 0x40, 0x8E, 0x86, 0x02, 0x86, 0x8E, 0x40, 0x8B,
+    0x81, 0x09, 0x85, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8B, 0x88, 0x83, 0x0F, 0x81, 0x88, 0x8E, 0x49,
+    0x8C, 0x85, 0x0C, 0x85, 0x8E, 0x43, 0x8E, 0x8B, 0x8A, 0x8B, 0x8C, 0x44, 0x8B, 0x81, 0x09, 0x88,
+    0x42, 0x8E, 0x87, 0x82, 0x05, 0x84, 0x8A, 0x42, 0x8E, 0x83, 0x07, 0x88, 0x42, 0x88, 0x0A, 0x82,
+    0x8C, 0x42, 0x83, 0x05, 0x86, 0x41, 0x8E, 0x84, 0x02, 0x82, 0x88, 0x8D, 0x8E, 0x40, 0x8E, 0x8C,
+    0x88, 0x83, 0x01, 0x89, 0x41, 0x8E, 0x81, 0x03, 0x82, 0x42, 0x83, 0x02, 0x88, 0x48, 0x8B, 0x01,
+    0x89, 0x41, 0x8B, 0x03, 0x8A, 0x41, 0x86, 0x02, 0x89, 0x49, 0x88, 0x02, 0x8C, 0x41, 0x84, 0x01,
+    0x82, 0x41, 0x8C, 0x02, 0x84, 0x44, 0x8A, 0x88, 0x89, 0x8C, 0x41, 0x81, 0x02, 0x83, 0x41, 0x8C,
+    0x01, 0x87, 0x41, 0x84, 0x02, 0x8C, 0x43, 0x83, 0x03, 0x81, 0x85, 0x04, 0x8B, 0x41, 0x81, 0x00,
+    0x8C, 0x40, 0x8E, 0x02, 0x81, 0x43, 0x87, 0x0B, 0x85, 0x41, 0x86, 0x00, 0x41, 0x8B, 0x02, 0x84,
+    0x43, 0x81, 0x0B, 0x81, 0x41, 0x89, 0x81, 0x41, 0x88, 0x02, 0x86, 0x42, 0x8E, 0x0D, 0x41, 0x8B,
+    0x82, 0x41, 0x88, 0x02, 0x86, 0x42, 0x8D, 0x0D, 0x8E, 0x40, 0x8B, 0x81, 0x41, 0x88, 0x02, 0x86,
+    0x42, 0x8E, 0x0D, 0x41, 0x8B, 0x00, 0x41, 0x8B, 0x02, 0x84, 0x43, 0x0C, 0x81, 0x41, 0x89, 0x00,
+    0x8C, 0x40, 0x8E, 0x02, 0x81, 0x43, 0x86, 0x0B, 0x85, 0x41, 0x86, 0x00, 0x88, 0x41, 0x84, 0x02,
+    0x8B, 0x42, 0x8E, 0x82, 0x04, 0x85, 0x81, 0x03, 0x8B, 0x41, 0x82, 0x00, 0x82, 0x41, 0x8C, 0x02,
+    0x83, 0x44, 0x8A, 0x88, 0x89, 0x8B, 0x41, 0x82, 0x02, 0x82, 0x41, 0x8C, 0x02, 0x8A, 0x41, 0x86,
+    0x02, 0x88, 0x49, 0x82, 0x02, 0x8C, 0x41, 0x84, 0x02, 0x82, 0x42, 0x83, 0x02, 0x87, 0x48, 0x82,
+    0x01, 0x88, 0x41, 0x8B, 0x04, 0x86, 0x41, 0x8E, 0x83, 0x02, 0x82, 0x88, 0x8C, 0x8E, 0x41, 0x8C,
+    0x88, 0x83, 0x01, 0x88, 0x41, 0x8E, 0x81, 0x05, 0x89, 0x42, 0x87, 0x0A, 0x82, 0x8B, 0x42, 0x83,
+    0x07, 0x88, 0x42, 0x8E, 0x87, 0x81, 0x05, 0x83, 0x89, 0x42, 0x8E, 0x83, 0x09, 0x85, 0x8E, 0x43,
+    0x8D, 0x8B, 0x9A, 0x8C, 0x44, 0x8C, 0x82, 0x0B, 0x81, 0x88, 0x4A, 0x8D, 0x85, 0x10, 0x85, 0x89,
+    0x8C, 0x8E, 0x41, 0x8E, 0x8B, 0x88, 0x83, 0x08, 0x02, 0x84, 0x89, 0x8C, 0x8E, 0x40, 0x8E, 0x8C,
+    0x86, 0x02, 0x82, 0x8D, 0x47, 0x8A, 0x02, 0x8D, 0x42, 0x8E, 0x44, 0x86, 0x01, 0x85, 0x8A, 0x85,
+    0x81, 0x01, 0x86, 0x42, 0x8B, 0x06, 0x81, 0x82, 0x8E, 0x41, 0x8E, 0x02, 0x87, 0x8B, 0x8E, 0x45,
+    0x8E, 0x00, 0x83, 0x8E, 0x48, 0x8E, 0x00, 0x8C, 0x42, 0x8A, 0x84, 0x82, 0x81, 0x8D, 0x41, 0x8E,
+    0x81, 0x42, 0x8C, 0x03, 0x42, 0x8E, 0x81, 0x42, 0x8D, 0x01, 0x81, 0x8B, 0x42, 0x8E, 0x00, 0x8D,
+    0x42, 0x8E, 0x8D, 0x44, 0x8E, 0x00, 0x85, 0x45, 0x8E, 0x83, 0x41, 0x8E, 0x01, 0x84, 0x8B, 0x41,
+    0x8D, 0x88, 0x81, 0x00, 0x8B, 0x40, 0x8E, 0x05, 0x81, 0x8C, 0x86, 0x06, 0x99, 0x81, 0x07, 0x8C,
+    0x41, 0x8D, 0x84, 0x03, 0x87, 0x42, 0x88, 0x05, 0x8A, 0x44, 0x83, 0x01, 0x84, 0x44, 0x89, 0x03,
+    0x88, 0x44, 0x86, 0x01, 0x82, 0x44, 0x8C, 0x03, 0x85, 0x44, 0x89, 0x01, 0x81, 0x8D, 0x43, 0x8E,
+    0x81, 0x02, 0x83, 0x44, 0x8B, 0x02, 0x8C, 0x44, 0x83, 0x02, 0x81, 0x8E, 0x43, 0x8D, 0x81, 0x01,
+    0x89, 0x44, 0x85, 0x03, 0x8C, 0x44, 0x82, 0x01, 0x87, 0x44, 0x88, 0x03, 0x86, 0x44, 0x88, 0x02,
+    0x44, 0x8E, 0x05, 0x8D, 0x44, 0x82, 0x01, 0x87, 0x44, 0x88, 0x04, 0x81, 0x8E, 0x43, 0x8D, 0x81,
+    0x01, 0x8A, 0x44, 0x85, 0x04, 0x83, 0x44, 0x8B, 0x02, 0x8C, 0x44, 0x83, 0x04, 0x85, 0x44, 0x89,
+    0x01, 0x81, 0x8E, 0x43, 0x8E, 0x81, 0x04, 0x88, 0x44, 0x86, 0x01, 0x82, 0x44, 0x8C, 0x05, 0x8A,
+    0x44, 0x83, 0x01, 0x84, 0x44, 0x88, 0x05, 0x8C, 0x41, 0x8D, 0x85, 0x03, 0x87, 0x42, 0x88, 0x81,
+    0x05, 0x81, 0x8C, 0x86, 0x06, 0x99, 0x81, 0x01, 0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x85, 0x51,
+    0x81, 0x85, 0x51, 0x81, 0x00, 0xF1, 0xD1, 0x43, 0x81, 0x0E, 0x43, 0x81, 0x0E, 0x43, 0x81, 0x0E,
+    0x43, 0x81, 0x0E, 0x43, 0x81, 0x0E, 0x43, 0x81, 0x0E, 0x43, 0x81, 0x8E, 0x48, 0x81, 0x8E, 0x48,
+    0x81, 0x8E, 0x48, 0x81, 0x8E, 0x48, 0x81, 0x88, 0xFA, 0x8A, 0x00, 0x09, 0x85, 0x89, 0x8C, 0x8E,
+    0x41, 0x8E, 0x8B, 0x88, 0x83, 0x0F, 0x81, 0x88, 0x8E, 0x49, 0x8C, 0x85, 0x0C, 0x85, 0x8E, 0x43,
+    0x8E, 0x8B, 0x8A, 0x8B, 0x8C, 0x44, 0x8B, 0x81, 0x09, 0x88, 0x42, 0x8E, 0x87, 0x82, 0x05, 0x84,
+    0x8A, 0x42, 0x8E, 0x83, 0x07, 0x88, 0x42, 0x88, 0x0A, 0x82, 0x8C, 0x42, 0x83, 0x05, 0x86, 0x41,
+    0x8E, 0x84, 0x00, 0x8E, 0x44, 0x8E, 0x8B, 0x87, 0x03, 0x89, 0x41, 0x8E, 0x81, 0x03, 0x82, 0x42,
+    0x83, 0x01, 0x8E, 0x47, 0x8E, 0x82, 0x02, 0x89, 0x41, 0x8B, 0x03, 0x8A, 0x41, 0x86, 0x02, 0x8E,
+    0x48, 0x8D, 0x03, 0x8C, 0x41, 0x84, 0x01, 0x82, 0x41, 0x8C, 0x03, 0x8E, 0x42, 0x86, 0x83, 0x89,
+    0x43, 0x83, 0x02, 0x83, 0x41, 0x8C, 0x01, 0x87, 0x41, 0x84, 0x03, 0x8E, 0x42, 0x85, 0x01, 0x8E,
+    0x42, 0x86, 0x03, 0x8B, 0x41, 0x81, 0x00, 0x8C, 0x40, 0x8E, 0x04, 0x8E, 0x42, 0x85, 0x01, 0x8D,
+    0x42, 0x86, 0x03, 0x85, 0x41, 0x86, 0x00, 0x41, 0x8B, 0x04, 0x8E, 0x42, 0x85, 0x00, 0x81, 0x43,
+    0x84, 0x03, 0x81, 0x41, 0x89, 0x81, 0x41, 0x88, 0x04, 0x8E, 0x42, 0x89, 0x87, 0x8D, 0x42, 0x8E,
+    0x05, 0x41, 0x8B, 0x82, 0x41, 0x88, 0x04, 0x8E, 0x48, 0x84, 0x05, 0x8E, 0x40, 0x8B, 0x81, 0x41,
+    0x88, 0x04, 0x8E, 0x47, 0x82, 0x06, 0x41, 0x8B, 0x00, 0x41, 0x8B, 0x04, 0x8E, 0x42, 0x8D, 0x8E,
+    0x42, 0x85, 0x05, 0x81, 0x41, 0x89, 0x00, 0x8C, 0x40, 0x8E, 0x04, 0x8E, 0x42, 0x85, 0x86, 0x42,
+    0x8E, 0x05, 0x85, 0x41, 0x86, 0x00, 0x88, 0x41, 0x84, 0x03, 0x8E, 0x42, 0x85, 0x00, 0x8D, 0x42,
+    0x88, 0x04, 0x8B, 0x41, 0x82, 0x00, 0x82, 0x41, 0x8C, 0x03, 0x8E, 0x42, 0x85, 0x00, 0x85, 0x43,
+    0x82, 0x02, 0x82, 0x41, 0x8C, 0x02, 0x8A, 0x41, 0x86, 0x02, 0x8E, 0x42, 0x85, 0x01, 0x8C, 0x42,
+    0x8B, 0x02, 0x8C, 0x41, 0x84, 0x02, 0x82, 0x42, 0x83, 0x01, 0x8E, 0x42, 0x85, 0x01, 0x84, 0x43,
+    0x85, 0x00, 0x88, 0x41, 0x8B, 0x04, 0x86, 0x41, 0x8E, 0x83, 0x00, 0x8E, 0x42, 0x85, 0x02, 0x8C,
+    0x42, 0x8E, 0x89, 0x41, 0x8E, 0x81, 0x05, 0x89, 0x42, 0x87, 0x0A, 0x82, 0x8B, 0x42, 0x83, 0x07,
+    0x88, 0x42, 0x8E, 0x87, 0x81, 0x05, 0x83, 0x89, 0x42, 0x8E, 0x83, 0x09, 0x85, 0x8E, 0x43, 0x8D,
+    0x8B, 0x9A, 0x8C, 0x44, 0x8C, 0x82, 0x0B, 0x81, 0x88, 0x4A, 0x8D, 0x85, 0x10, 0x85, 0x89, 0x8C,
+    0x8E, 0x41, 0x8E, 0x8B, 0x88, 0x83, 0x08, 0x81, 0xFB, 0xFB, 0xAB, 0x91, 0x52, 0x91, 0x52, 0x91,
+    0x52, 0x81, 0x03, 0x85, 0x8C, 0x8E, 0x40, 0x8C, 0x87, 0x81, 0x04, 0x81, 0x8C, 0x45, 0x8E, 0x83,
+    0x03, 0x8D, 0x48, 0x82, 0x01, 0x88, 0x43, 0x8A, 0x89, 0x8E, 0x42, 0x8C, 0x01, 0x8E, 0x41, 0x8E,
+    0x82, 0x02, 0x8C, 0x42, 0x83, 0x82, 0x42, 0x87, 0x03, 0x83, 0x42, 0x86, 0x84, 0x42, 0x84, 0x04,
+    0x42, 0x88, 0x83, 0x42, 0x87, 0x03, 0x83, 0x42, 0x86, 0x00, 0x42, 0x8E, 0x82, 0x02, 0x8C, 0x42,
+    0x83, 0x00, 0x89, 0x43, 0x8A, 0x89, 0x8E, 0x42, 0x8C, 0x01, 0x81, 0x8D, 0x48, 0x82, 0x02, 0x82,
+    0x8D, 0x45, 0x8E, 0x84, 0x05, 0x87, 0x8C, 0x41, 0x8D, 0x88, 0x81, 0x02, 0x07, 0xB3, 0x0E, 0x83,
+    0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83,
+    0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x07, 0x85, 0x51, 0x81, 0x85, 0x51,
+    0x81, 0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x00, 0xD1, 0x83, 0x42, 0x8E, 0xE1, 0x07, 0x83, 0x42,
+    0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42,
+    0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0F, 0xA3, 0x82, 0x08, 0xF1, 0xF1, 0x91, 0x00, 0x85, 0x51, 0x81,
+    0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x02, 0x84, 0x89, 0x8D, 0x41, 0x8E, 0x8A,
+    0x83, 0x03, 0x82, 0x8C, 0x47, 0x86, 0x02, 0x8D, 0x49, 0x82, 0x01, 0x84, 0x42, 0x8C, 0x89, 0x8D,
+    0x43, 0x87, 0x02, 0x86, 0x8D, 0x83, 0x02, 0x43, 0x88, 0x08, 0x43, 0x86, 0x07, 0x86, 0x43, 0x81,
+    0x06, 0x83, 0x43, 0x87, 0x06, 0x84, 0x43, 0x8A, 0x06, 0x85, 0x43, 0x8A, 0x06, 0x86, 0x43, 0x89,
+    0x06, 0x87, 0x43, 0x87, 0x06, 0x88, 0x43, 0x8E, 0xDB, 0x01, 0x4B, 0x01, 0x4B, 0x01, 0x4B, 0x00,
+    0x01, 0x85, 0x8A, 0x8D, 0x41, 0x8D, 0x89, 0x82, 0x01, 0x83, 0x8D, 0x47, 0x85, 0x00, 0x88, 0x49,
+    0x81, 0x00, 0x8C, 0x40, 0x8B, 0x85, 0x83, 0x86, 0x43, 0x85, 0x00, 0x82, 0x85, 0x03, 0x8B, 0x42,
+    0x83, 0x04, 0x81, 0x85, 0x42, 0x8C, 0x02, 0x86, 0x45, 0x89, 0x03, 0x86, 0x44, 0x89, 0x82, 0x03,
+    0x85, 0x46, 0x88, 0x06, 0x84, 0x8D, 0x42, 0x86, 0x06, 0x85, 0x42, 0x8B, 0x88, 0x81, 0x04, 0x85,
+    0x42, 0x8D, 0x8E, 0x40, 0x8A, 0x85, 0x93, 0x86, 0x8E, 0x42, 0x8A, 0x8E, 0x49, 0x84, 0x8C, 0x48,
+    0x87, 0x01, 0x85, 0x8A, 0x8D, 0x41, 0x8E, 0x8C, 0x88, 0x82, 0x01, 0x03, 0x8C, 0x44, 0x8A, 0x02,
+    0x88, 0x44, 0x89, 0x02, 0x85, 0x44, 0x87, 0x02, 0x83, 0x43, 0x8E, 0x84, 0x02, 0x81, 0x8E, 0x42,
+    0x8C, 0x81, 0x03, 0x8B, 0x42, 0x89, 0x05, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44,
+    0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06,
+    0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44,
+    0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00,
+    0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A,
+    0x06, 0x89, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x8A, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x8C,
+    0x44, 0x82, 0x00, 0x44, 0x8B, 0x06, 0x45, 0x82, 0x00, 0x45, 0x05, 0x86, 0x45, 0x82, 0x00, 0x45,
+    0x89, 0x03, 0x83, 0x46, 0x82, 0x00, 0x46, 0x8D, 0x98, 0x8B, 0x47, 0x82, 0x00, 0x52, 0x82, 0x00,
+    0x4C, 0x85, 0x8C, 0x43, 0x82, 0x00, 0x44, 0x8C, 0x45, 0x89, 0x00, 0x88, 0x43, 0x82, 0x00, 0x44,
+    0x88, 0x84, 0x8B, 0x41, 0x8C, 0x86, 0x01, 0x84, 0x43, 0x82, 0x00, 0x44, 0x88, 0x0E, 0x44, 0x89,
+    0x0E, 0x44, 0x89, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E,
+    0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0D, 0x03, 0x84, 0x89, 0x8D, 0x8E, 0x4A, 0x8A, 0x01, 0x81, 0x8C,
+    0x4E, 0x8A, 0x00, 0x81, 0x8D, 0x4F, 0x8A, 0x00, 0x89, 0x4A, 0x8E, 0x9B, 0x8C, 0x41, 0x8A, 0x81,
+    0x4B, 0x89, 0x01, 0x85, 0x41, 0x8A, 0x86, 0x4B, 0x89, 0x01, 0x85, 0x41, 0x8A, 0x89, 0x4B, 0x89,
+    0x01, 0x85, 0x41, 0x8A, 0x8C, 0x4B, 0x89, 0x01, 0x85, 0x41, 0x8A, 0x8D, 0x4B, 0x89, 0x01, 0x85,
+    0x41, 0x8A, 0x8E, 0x4B, 0x89, 0x01, 0x85, 0x41, 0x8A, 0x8D, 0x4B, 0x89, 0x01, 0x85, 0x41, 0x8A,
+    0x8C, 0x4B, 0x89, 0x01, 0x85, 0x41, 0x9A, 0x4B, 0x89, 0x01, 0x85, 0x41, 0x8A, 0x87, 0x4B, 0x89,
+    0x01, 0x85, 0x41, 0x8A, 0x82, 0x4B, 0x89, 0x01, 0x85, 0x41, 0x8A, 0x00, 0x8B, 0x4A, 0x89, 0x01,
+    0x85, 0x41, 0x8A, 0x00, 0x82, 0x4A, 0x89, 0x01, 0x85, 0x41, 0x8A, 0x01, 0x83, 0x8E, 0x48, 0x89,
+    0x01, 0x85, 0x41, 0x8A, 0x03, 0x86, 0x8B, 0x8E, 0x41, 0x9D, 0x41, 0x89, 0x01, 0x85, 0x41, 0x8A,
+    0x09, 0x86, 0x41, 0x89, 0x01, 0x85, 0x41, 0x8A, 0x09, 0x86, 0x41, 0x89, 0x01, 0x85, 0x41, 0x8A,
+    0x09, 0x86, 0x41, 0x89, 0x01, 0x85, 0x41, 0x8A, 0x09, 0x86, 0x41, 0x89, 0x01, 0x85, 0x41, 0x8A,
+    0x09, 0x86, 0x41, 0x89, 0x01, 0x85, 0x41, 0x8A, 0x09, 0x86, 0x41, 0x89, 0x01, 0x85, 0x41, 0x8A,
+    0x09, 0x86, 0x41, 0x89, 0x01, 0x85, 0x41, 0x8A, 0x09, 0x86, 0x41, 0x89, 0x01, 0x85, 0x41, 0x8A,
+    0x09, 0x86, 0x41, 0x89, 0x01, 0x85, 0x41, 0x8A, 0x09, 0x86, 0x41, 0x89, 0x01, 0x85, 0x41, 0x8A,
+    0x09, 0x86, 0x41, 0x89, 0x01, 0x85, 0x41, 0x8A, 0x09, 0x86, 0x41, 0x89, 0x01, 0x85, 0x41, 0x8A,
+    0x09, 0x86, 0x41, 0x89, 0x01, 0x85, 0x41, 0x8A, 0x09, 0x86, 0x41, 0x89, 0x01, 0x85, 0x41, 0x8A,
+    0x09, 0x86, 0x41, 0x89, 0x01, 0x85, 0x41, 0x8A, 0x00, 0x87, 0x8D, 0x40, 0x8D, 0x85, 0x00, 0x86,
+    0x44, 0x84, 0x8B, 0x44, 0x89, 0x8C, 0x44, 0x89, 0x88, 0x44, 0x86, 0x81, 0x8C, 0x42, 0x8A, 0x02,
+    0x82, 0x84, 0x82, 0x01, 0x01, 0x89, 0x42, 0x81, 0x02, 0x82, 0x42, 0x8D, 0x03, 0x88, 0x43, 0x8B,
+    0x82, 0x02, 0x81, 0x89, 0x43, 0x82, 0x03, 0x8C, 0x42, 0x8A, 0x94, 0x82, 0x83, 0x8E, 0x42, 0x9B,
+    0x46, 0x88, 0x8B, 0x45, 0x8D, 0x81, 0x87, 0x8D, 0x41, 0x8E, 0x8C, 0x87, 0x01, 0x04, 0x86, 0x42,
+    0x8D, 0x03, 0x89, 0x43, 0x8D, 0x01, 0x82, 0x8C, 0x44, 0x8D, 0x00, 0x84, 0x8E, 0x45, 0x8D, 0x81,
+    0x43, 0x8B, 0x42, 0x8D, 0x00, 0x84, 0x41, 0x84, 0x88, 0x42, 0x8D, 0x01, 0x85, 0x82, 0x00, 0x88,
+    0x42, 0x8D, 0x04, 0x89, 0x42, 0x8D, 0x04, 0x89, 0x42, 0x8D, 0x04, 0x89, 0x42, 0x8D, 0x04, 0x89,
+    0x42, 0x8D, 0x04, 0x89, 0x42, 0x8D, 0x04, 0x89, 0x42, 0x8D, 0x04, 0x89, 0x42, 0x8D, 0x04, 0x89,
+    0x42, 0x8D, 0x04, 0x89, 0x42, 0x8D, 0x02, 0x87, 0x8C, 0x8E, 0x40, 0x8E, 0x8A, 0x84, 0x03, 0x82,
+    0x8D, 0x46, 0x89, 0x02, 0x8D, 0x48, 0x88, 0x00, 0x86, 0x42, 0x8C, 0x83, 0x81, 0x85, 0x8E, 0x42,
+    0x81, 0x8B, 0x42, 0x82, 0x02, 0x87, 0x42, 0x86, 0x8D, 0x41, 0x8E, 0x03, 0x83, 0x42, 0x89, 0x8E,
+    0x41, 0x8D, 0x03, 0x82, 0x42, 0x8A, 0x8D, 0x41, 0x8E, 0x03, 0x83, 0x42, 0x89, 0x8A, 0x42, 0x82,
+    0x02, 0x87, 0x42, 0x86, 0x85, 0x42, 0x8C, 0x83, 0x81, 0x85, 0x43, 0x81, 0x00, 0x8C, 0x48, 0x88,
+    0x01, 0x81, 0x8C, 0x46, 0x8A, 0x04, 0x86, 0x8C, 0x8E, 0x40, 0x8E, 0x8B, 0x84, 0x02, 0x02, 0x86,
+    0x8C, 0x81, 0x05, 0x83, 0x8B, 0x86, 0x06, 0x85, 0x8D, 0x41, 0x8C, 0x03, 0x82, 0x8A, 0x42, 0x83,
+    0x04, 0x83, 0x44, 0x8A, 0x02, 0x8C, 0x43, 0x8E, 0x82, 0x04, 0x86, 0x44, 0x87, 0x01, 0x82, 0x8E,
+    0x43, 0x8D, 0x05, 0x89, 0x44, 0x85, 0x01, 0x83, 0x44, 0x8B, 0x05, 0x8C, 0x44, 0x83, 0x01, 0x86,
+    0x44, 0x88, 0x04, 0x81, 0x8E, 0x43, 0x8E, 0x81, 0x01, 0x89, 0x44, 0x86, 0x04, 0x82, 0x44, 0x8C,
+    0x02, 0x8B, 0x44, 0x83, 0x04, 0x88, 0x44, 0x86, 0x01, 0x82, 0x44, 0x8C, 0x03, 0x82, 0x44, 0x8C,
+    0x02, 0x8B, 0x44, 0x84, 0x02, 0x81, 0x8D, 0x43, 0x8E, 0x81, 0x01, 0x89, 0x44, 0x86, 0x03, 0x8C,
+    0x44, 0x83, 0x01, 0x86, 0x44, 0x88, 0x03, 0x89, 0x44, 0x85, 0x01, 0x83, 0x44, 0x8B, 0x03, 0x86,
+    0x44, 0x88, 0x01, 0x81, 0x8E, 0x43, 0x8D, 0x03, 0x83, 0x44, 0x8A, 0x02, 0x8C, 0x43, 0x8E, 0x82,
+    0x04, 0x85, 0x8D, 0x41, 0x8C, 0x03, 0x82, 0x8A, 0x42, 0x83, 0x07, 0x86, 0x8C, 0x81, 0x05, 0x83,
+    0x8B, 0x86, 0x05, 0x04, 0x84, 0x8E, 0x42, 0x09, 0x84, 0x43, 0x82, 0x09, 0x88, 0x44, 0x09, 0x8D,
+    0x42, 0x89, 0x08, 0x81, 0x8B, 0x45, 0x08, 0x86, 0x43, 0x81, 0x07, 0x83, 0x8E, 0x46, 0x08, 0x8E,
+    0x42, 0x87, 0x08, 0x8D, 0x42, 0x8B, 0x43, 0x07, 0x88, 0x42, 0x8E, 0x09, 0x83, 0x41, 0x86, 0x85,
+    0x43, 0x06, 0x81, 0x43, 0x85, 0x0A, 0x84, 0x83, 0x00, 0x86, 0x43, 0x06, 0x8A, 0x42, 0x8C, 0x0E,
+    0x86, 0x43, 0x05, 0x83, 0x43, 0x83, 0x0E, 0x87, 0x43, 0x05, 0x8C, 0x42, 0x8A, 0x0F, 0x87, 0x43,
+    0x04, 0x85, 0x43, 0x82, 0x0F, 0x87, 0x43, 0x04, 0x8D, 0x42, 0x89, 0x10, 0x87, 0x43, 0x03, 0x86,
+    0x42, 0x8E, 0x81, 0x03, 0x8D, 0x42, 0x8E, 0x07, 0x87, 0x43, 0x03, 0x8E, 0x42, 0x87, 0x03, 0x88,
+    0x43, 0x8E, 0x07, 0x87, 0x43, 0x02, 0x88, 0x42, 0x8D, 0x03, 0x83, 0x44, 0x8E, 0x07, 0x87, 0x43,
+    0x01, 0x82, 0x43, 0x85, 0x03, 0x8E, 0x44, 0x8E, 0x07, 0x87, 0x43, 0x01, 0x8A, 0x42, 0x8C, 0x03,
+    0x8A, 0x41, 0x8B, 0x42, 0x8E, 0x0D, 0x83, 0x43, 0x83, 0x02, 0x85, 0x41, 0x8C, 0x87, 0x42, 0x8E,
+    0x0D, 0x8C, 0x42, 0x8A, 0x02, 0x81, 0x8E, 0x41, 0x83, 0x88, 0x42, 0x8E, 0x0C, 0x85, 0x43, 0x82,
+    0x02, 0x8B, 0x41, 0x88, 0x00, 0x88, 0x42, 0x8E, 0x0C, 0x8D, 0x42, 0x88, 0x02, 0x86, 0x41, 0x8D,
+    0x01, 0x88, 0x42, 0x8E, 0x0B, 0x87, 0x42, 0x8E, 0x81, 0x01, 0x82, 0x42, 0x82, 0x01, 0x88, 0x42,
+    0x8E, 0x0A, 0x81, 0x8E, 0x42, 0x87, 0x02, 0x89, 0x4C, 0x83, 0x07, 0x88, 0x42, 0x8D, 0x03, 0x8A,
+    0x4C, 0x83, 0x06, 0x82, 0x43, 0x85, 0x03, 0x8A, 0x4C, 0x83, 0x06, 0x8A, 0x42, 0x8C, 0x04, 0x81,
+    0xD2, 0x89, 0x42, 0x8E, 0x92, 0x06, 0x83, 0x43, 0x83, 0x0B, 0x88, 0x42, 0x8E, 0x08, 0x8C, 0x42,
+    0x8A, 0x0C, 0x88, 0x42, 0x8E, 0x02, 0x04, 0x84, 0x8E, 0x42, 0x09, 0x84, 0x43, 0x82, 0x09, 0x88,
+    0x44, 0x09, 0x8D, 0x42, 0x89, 0x08, 0x81, 0x8B, 0x45, 0x08, 0x86, 0x43, 0x81, 0x07, 0x83, 0x8E,
+    0x46, 0x08, 0x8E, 0x42, 0x87, 0x08, 0x8D, 0x42, 0x8B, 0x43, 0x07, 0x88, 0x42, 0x8E, 0x09, 0x83,
+    0x41, 0x86, 0x85, 0x43, 0x06, 0x81, 0x43, 0x85, 0x0A, 0x84, 0x83, 0x00, 0x86, 0x43, 0x06, 0x8A,
+    0x42, 0x8C, 0x0E, 0x86, 0x43, 0x05, 0x83, 0x43, 0x83, 0x0E, 0x87, 0x43, 0x05, 0x8C, 0x42, 0x8A,
+    0x0F, 0x87, 0x43, 0x04, 0x85, 0x43, 0x82, 0x0F, 0x87, 0x43, 0x04, 0x8D, 0x42, 0x89, 0x10, 0x87,
+    0x43, 0x03, 0x86, 0x42, 0x8E, 0x81, 0x01, 0x85, 0x8A, 0x8D, 0x41, 0x8D, 0x89, 0x82, 0x06, 0x87,
+    0x43, 0x03, 0x8E, 0x42, 0x87, 0x00, 0x83, 0x8D, 0x47, 0x84, 0x05, 0x87, 0x43, 0x02, 0x88, 0x42,
+    0x8D, 0x00, 0x81, 0x49, 0x8E, 0x05, 0x87, 0x43, 0x01, 0x82, 0x43, 0x85, 0x01, 0x86, 0x42, 0x8B,
+    0x89, 0x8E, 0x43, 0x84, 0x04, 0x87, 0x43, 0x01, 0x8A, 0x42, 0x8C, 0x03, 0x89, 0x8C, 0x82, 0x01,
+    0x82, 0x43, 0x85, 0x0A, 0x83, 0x43, 0x83, 0x08, 0x82, 0x43, 0x83, 0x0A, 0x8C, 0x42, 0x8A, 0x09,
+    0x89, 0x42, 0x8D, 0x0A, 0x85, 0x43, 0x82, 0x08, 0x86, 0x43, 0x85, 0x0A, 0x8D, 0x42, 0x88, 0x08,
+    0x86, 0x43, 0x87, 0x0A, 0x87, 0x42, 0x8E, 0x81, 0x07, 0x87, 0x43, 0x88, 0x0A, 0x81, 0x8E, 0x42,
+    0x87, 0x07, 0x88, 0x43, 0x86, 0x0B, 0x88, 0x42, 0x8D, 0x07, 0x8A, 0x43, 0x84, 0x0B, 0x82, 0x43,
+    0x85, 0x06, 0x8B, 0x43, 0x8D, 0xCB, 0x89, 0x06, 0x8A, 0x42, 0x8C, 0x06, 0x82, 0x4A, 0x8D, 0x05,
+    0x83, 0x43, 0x83, 0x06, 0x82, 0x4A, 0x8D, 0x05, 0x8C, 0x42, 0x8A, 0x07, 0x82, 0x4A, 0x8D, 0x01,
+    0x81, 0x87, 0x8C, 0x8E, 0x41, 0x8C, 0x86, 0x0A, 0x8E, 0x42, 0x87, 0x05, 0x87, 0x47, 0x8D, 0x81,
+    0x07, 0x88, 0x42, 0x8D, 0x05, 0x81, 0x8E, 0x48, 0x89, 0x06, 0x82, 0x43, 0x85, 0x06, 0x84, 0x41,
+    0x88, 0x94, 0x8A, 0x42, 0x8E, 0x06, 0x8A, 0x42, 0x8C, 0x08, 0x85, 0x81, 0x02, 0x81, 0x42, 0x8D,
+    0x05, 0x83, 0x43, 0x83, 0x0C, 0x82, 0x8A, 0x42, 0x86, 0x05, 0x8C, 0x42, 0x8A, 0x0A, 0x8C, 0x44,
+    0x8D, 0x85, 0x05, 0x85, 0x43, 0x82, 0x0A, 0x8C, 0x43, 0x8E, 0x86, 0x06, 0x8D, 0x42, 0x88, 0x0B,
+    0x8C, 0x45, 0x8E, 0x83, 0x03, 0x87, 0x42, 0x8E, 0x81, 0x0E, 0x81, 0x87, 0x42, 0x8E, 0x02, 0x81,
+    0x8E, 0x42, 0x87, 0x11, 0x8B, 0x42, 0x85, 0x01, 0x88, 0x42, 0x8D, 0x0A, 0x83, 0x85, 0x05, 0x8C,
+    0x42, 0x86, 0x00, 0x82, 0x43, 0x85, 0x02, 0x84, 0x43, 0x87, 0x01, 0x85, 0x40, 0x8E, 0x88, 0x84,
+    0x82, 0x83, 0x89, 0x43, 0x84, 0x00, 0x8A, 0x42, 0x8C, 0x02, 0x81, 0x8E, 0x43, 0x87, 0x01, 0x85,
+    0x49, 0x8D, 0x00, 0x83, 0x43, 0x83, 0x02, 0x8A, 0x44, 0x87, 0x01, 0x84, 0x48, 0x8D, 0x82, 0x00,
+    0x8C, 0x42, 0x8A, 0x02, 0x86, 0x45, 0x87, 0x02, 0x81, 0x87, 0x8B, 0x8E, 0x41, 0x8E, 0x8B, 0x86,
+    0x01, 0x85, 0x43, 0x82, 0x01, 0x81, 0x41, 0x8D, 0x8E, 0x42, 0x87, 0x0D, 0x8D, 0x42, 0x88, 0x02,
+    0x8C, 0x41, 0x85, 0x8E, 0x42, 0x87, 0x0C, 0x87, 0x42, 0x8E, 0x02, 0x87, 0x41, 0x8C, 0x00, 0x43,
+    0x87, 0x0B, 0x81, 0x8E, 0x42, 0x86, 0x01, 0x82, 0x42, 0x82, 0x00, 0x43, 0x87, 0x0B, 0x89, 0x42,
+    0x8D, 0x02, 0x8D, 0x41, 0x86, 0x01, 0x43, 0x87, 0x0A, 0x82, 0x43, 0x84, 0x01, 0x88, 0x41, 0x8B,
+    0x02, 0x43, 0x87, 0x0A, 0x8B, 0x42, 0x8C, 0x02, 0x4C, 0x8C, 0x07, 0x83, 0x43, 0x83, 0x01, 0x81,
+    0x4C, 0x8C, 0x07, 0x8C, 0x42, 0x8A, 0x02, 0x81, 0x4C, 0x8C, 0x06, 0x85, 0x43, 0x81, 0x03, 0xE2,
+    0x43, 0x88, 0x82, 0x81, 0x06, 0x8E, 0x42, 0x88, 0x0B, 0x43, 0x87, 0x07, 0x87, 0x42, 0x8E, 0x0C,
+    0x43, 0x87, 0x01, 0x06, 0x85, 0x8D, 0x40, 0x8D, 0x87, 0x0B, 0x83, 0x44, 0x86, 0x0A, 0x89, 0x44,
+    0x8B, 0x0A, 0x89, 0x44, 0x8C, 0x0A, 0x86, 0x44, 0x89, 0x0B, 0x8A, 0x42, 0x8C, 0x81, 0x0C, 0x82,
+    0x84, 0x82, 0x31, 0x8A, 0x43, 0x83, 0x0B, 0x8B, 0x43, 0x83, 0x0B, 0x8E, 0x43, 0x81, 0x0A, 0x89,
+    0x43, 0x8E, 0x0A, 0x8B, 0x44, 0x87, 0x08, 0x82, 0x8D, 0x44, 0x8C, 0x08, 0x83, 0x45, 0x8B, 0x08,
+    0x83, 0x45, 0x89, 0x09, 0x8E, 0x44, 0x85, 0x09, 0x86, 0x44, 0x85, 0x0A, 0x8A, 0x43, 0x8C, 0x0B,
+    0x8C, 0x43, 0x88, 0x0B, 0x8D, 0x43, 0x89, 0x07, 0x81, 0x82, 0x01, 0x8B, 0x44, 0x83, 0x04, 0x85,
+    0x8B, 0x40, 0x8C, 0x01, 0x87, 0x45, 0x8B, 0x89, 0x8A, 0x8C, 0x44, 0x83, 0x00, 0x81, 0x8E, 0x4D,
+    0x8B, 0x01, 0x84, 0x4E, 0x81, 0x01, 0x83, 0x8D, 0x49, 0x8E, 0x88, 0x81, 0x04, 0x84, 0x89, 0x8C,
+    0x8E, 0x41, 0x8D, 0x8B, 0x87, 0x83, 0x03, 0x05, 0x88, 0x44, 0x8E, 0x81, 0x13, 0x87, 0x44, 0x8A,
+    0x14, 0x85, 0x44, 0x87, 0x14, 0x83, 0x8D, 0x43, 0x84, 0x14, 0x81, 0x8B, 0x43, 0x82, 0x15, 0x87,
+    0x42, 0x8D, 0x3F, 0x08, 0x89, 0x45, 0x8C, 0x12, 0x8E, 0x46, 0x82, 0x10, 0x84, 0x47, 0x87, 0x10,
+    0x8A, 0x47, 0x8D, 0x10, 0x44, 0x8D, 0x43, 0x83, 0x0E, 0x86, 0x43, 0x8C, 0x88, 0x43, 0x89, 0x0E,
+    0x8B, 0x43, 0x87, 0x84, 0x43, 0x8E, 0x0D, 0x81, 0x44, 0x83, 0x00, 0x8E, 0x43, 0x84, 0x0C, 0x87,
+    0x43, 0x8E, 0x01, 0x8A, 0x43, 0x8A, 0x0C, 0x8C, 0x43, 0x89, 0x01, 0x85, 0x44, 0x0B, 0x82, 0x44,
+    0x84, 0x02, 0x44, 0x85, 0x0A, 0x88, 0x44, 0x03, 0x8B, 0x43, 0x8B, 0x0A, 0x8D, 0x43, 0x8A, 0x03,
+    0x86, 0x44, 0x81, 0x08, 0x83, 0x44, 0x86, 0x03, 0x81, 0x44, 0x86, 0x08, 0x89, 0x44, 0x81, 0x04,
+    0x8C, 0x43, 0x8C, 0x08, 0x8E, 0x43, 0x8C, 0x05, 0x87, 0x44, 0x82, 0x06, 0x84, 0x51, 0x87, 0x06,
+    0x8A, 0x51, 0x8D, 0x06, 0x53, 0x83, 0x04, 0x85, 0x53, 0x88, 0x04, 0x8B, 0x44, 0xFD, 0x9D, 0x44,
+    0x8E, 0x03, 0x81, 0x44, 0x8E, 0x09, 0x8B, 0x44, 0x84, 0x02, 0x86, 0x44, 0x8A, 0x09, 0x86, 0x44,
+    0x89, 0x02, 0x8C, 0x44, 0x85, 0x09, 0x81, 0x45, 0x01, 0x81, 0x45, 0x0B, 0x8C, 0x44, 0x85, 0x00,
+    0x87, 0x44, 0x8A, 0x0B, 0x87, 0x44, 0x8A, 0x00, 0x8D, 0x44, 0x85, 0x0B, 0x82, 0x45, 0x81, 0x0C,
+    0x81, 0x8E, 0x44, 0x88, 0x12, 0x8A, 0x44, 0x87, 0x12, 0x87, 0x44, 0x85, 0x12, 0x84, 0x43, 0x8D,
+    0x83, 0x12, 0x82, 0x43, 0x8B, 0x81, 0x13, 0x8D, 0x42, 0x87, 0x3F, 0x0A, 0x89, 0x45, 0x8C, 0x12,
+    0x8E, 0x46, 0x82, 0x10, 0x84, 0x47, 0x87, 0x10, 0x8A, 0x47, 0x8D, 0x10, 0x44, 0x8D, 0x43, 0x83,
+    0x0E, 0x86, 0x43, 0x8C, 0x88, 0x43, 0x89, 0x0E, 0x8B, 0x43, 0x87, 0x84, 0x43, 0x8E, 0x0D, 0x81,
+    0x44, 0x83, 0x00, 0x8E, 0x43, 0x84, 0x0C, 0x87, 0x43, 0x8E, 0x01, 0x8A, 0x43, 0x8A, 0x0C, 0x8C,
+    0x43, 0x89, 0x01, 0x85, 0x44, 0x0B, 0x82, 0x44, 0x84, 0x02, 0x44, 0x85, 0x0A, 0x88, 0x44, 0x03,
+    0x8B, 0x43, 0x8B, 0x0A, 0x8D, 0x43, 0x8A, 0x03, 0x86, 0x44, 0x81, 0x08, 0x83, 0x44, 0x86, 0x03,
+    0x81, 0x44, 0x86, 0x08, 0x89, 0x44, 0x81, 0x04, 0x8C, 0x43, 0x8C, 0x08, 0x8E, 0x43, 0x8C, 0x05,
+    0x87, 0x44, 0x82, 0x06, 0x84, 0x51, 0x87, 0x06, 0x8A, 0x51, 0x8D, 0x06, 0x53, 0x83, 0x04, 0x85,
+    0x53, 0x88, 0x04, 0x8B, 0x44, 0xFD, 0x9D, 0x44, 0x8E, 0x03, 0x81, 0x44, 0x8E, 0x09, 0x8B, 0x44,
+    0x84, 0x02, 0x86, 0x44, 0x8A, 0x09, 0x86, 0x44, 0x89, 0x02, 0x8C, 0x44, 0x85, 0x09, 0x81, 0x45,
+    0x01, 0x81, 0x45, 0x0B, 0x8C, 0x44, 0x85, 0x00, 0x87, 0x44, 0x8A, 0x0B, 0x87, 0x44, 0x8A, 0x00,
+    0x8D, 0x44, 0x85, 0x0B, 0x82, 0x45, 0x81, 0x08, 0x88, 0x45, 0x8C, 0x11, 0x84, 0x47, 0x88, 0x0F,
+    0x82, 0x49, 0x85, 0x0D, 0x81, 0x8E, 0x43, 0x85, 0x84, 0x8E, 0x43, 0x84, 0x0B, 0x81, 0x8D, 0x42,
+    0x8D, 0x83, 0x01, 0x82, 0x8C, 0x43, 0x83, 0x0A, 0x8D, 0x42, 0x88, 0x05, 0x87, 0x43, 0x81, 0x3F,
+    0x03, 0x89, 0x45, 0x8C, 0x12, 0x8E, 0x46, 0x82, 0x10, 0x84, 0x47, 0x87, 0x10, 0x8A, 0x47, 0x8D,
+    0x10, 0x44, 0x8D, 0x43, 0x83, 0x0E, 0x86, 0x43, 0x8C, 0x88, 0x43, 0x89, 0x0E, 0x8B, 0x43, 0x87,
+    0x84, 0x43, 0x8E, 0x0D, 0x81, 0x44, 0x83, 0x00, 0x8E, 0x43, 0x84, 0x0C, 0x87, 0x43, 0x8E, 0x01,
+    0x8A, 0x43, 0x8A, 0x0C, 0x8C, 0x43, 0x89, 0x01, 0x85, 0x44, 0x0B, 0x82, 0x44, 0x84, 0x02, 0x44,
+    0x85, 0x0A, 0x88, 0x44, 0x03, 0x8B, 0x43, 0x8B, 0x0A, 0x8D, 0x43, 0x8A, 0x03, 0x86, 0x44, 0x81,
+    0x08, 0x83, 0x44, 0x86, 0x03, 0x81, 0x44, 0x86, 0x08, 0x89, 0x44, 0x81, 0x04, 0x8C, 0x43, 0x8C,
+    0x08, 0x8E, 0x43, 0x8C, 0x05, 0x87, 0x44, 0x82, 0x06, 0x84, 0x51, 0x87, 0x06, 0x8A, 0x51, 0x8D,
+    0x06, 0x53, 0x83, 0x04, 0x85, 0x53, 0x88, 0x04, 0x8B, 0x44, 0xFD, 0x9D, 0x44, 0x8E, 0x03, 0x81,
+    0x44, 0x8E, 0x09, 0x8B, 0x44, 0x84, 0x02, 0x86, 0x44, 0x8A, 0x09, 0x86, 0x44, 0x89, 0x02, 0x8C,
+    0x44, 0x85, 0x09, 0x81, 0x45, 0x01, 0x81, 0x45, 0x0B, 0x8C, 0x44, 0x85, 0x00, 0x87, 0x44, 0x8A,
+    0x0B, 0x87, 0x44, 0x8A, 0x00, 0x8D, 0x44, 0x85, 0x0B, 0x82, 0x45, 0x81, 0x06, 0x81, 0x88, 0x8E,
+    0x40, 0x8C, 0x85, 0x03, 0x81, 0x41, 0x8B, 0x0B, 0x81, 0x8D, 0x44, 0x8D, 0x84, 0x01, 0x89, 0x41,
+    0x89, 0x0B, 0x89, 0x47, 0x8E, 0x8D, 0x42, 0x84, 0x0A, 0x81, 0x42, 0x8E, 0x8D, 0x47, 0x8D, 0x0B,
+    0x85, 0x41, 0x8D, 0x01, 0x82, 0x8B, 0x45, 0x83, 0x0B, 0x87, 0x41, 0x85, 0x03, 0x83, 0x8B, 0x40,
+    0x8E, 0x8A, 0x82, 0x3F, 0x06, 0x89, 0x45, 0x8C, 0x12, 0x8E, 0x46, 0x82, 0x10, 0x84, 0x47, 0x87,
+    0x10, 0x8A, 0x47, 0x8D, 0x10, 0x44, 0x8D, 0x43, 0x83, 0x0E, 0x86, 0x43, 0x8C, 0x88, 0x43, 0x89,
+    0x0E, 0x8B, 0x43, 0x87, 0x84, 0x43, 0x8E, 0x0D, 0x81, 0x44, 0x83, 0x00, 0x8E, 0x43, 0x84, 0x0C,
+    0x87, 0x43, 0x8E, 0x01, 0x8A, 0x43, 0x8A, 0x0C, 0x8C, 0x43, 0x89, 0x01, 0x85, 0x44, 0x0B, 0x82,
+    0x44, 0x84, 0x02, 0x44, 0x85, 0x0A, 0x88, 0x44, 0x03, 0x8B, 0x43, 0x8B, 0x0A, 0x8D, 0x43, 0x8A,
+    0x03, 0x86, 0x44, 0x81, 0x08, 0x83, 0x44, 0x86, 0x03, 0x81, 0x44, 0x86, 0x08, 0x89, 0x44, 0x81,
+    0x04, 0x8C, 0x43, 0x8C, 0x08, 0x8E, 0x43, 0x8C, 0x05, 0x87, 0x44, 0x82, 0x06, 0x84, 0x51, 0x87,
+    0x06, 0x8A, 0x51, 0x8D, 0x06, 0x53, 0x83, 0x04, 0x85, 0x53, 0x88, 0x04, 0x8B, 0x44, 0xFD, 0x9D,
+    0x44, 0x8E, 0x03, 0x81, 0x44, 0x8E, 0x09, 0x8B, 0x44, 0x84, 0x02, 0x86, 0x44, 0x8A, 0x09, 0x86,
+    0x44, 0x89, 0x02, 0x8C, 0x44, 0x85, 0x09, 0x81, 0x45, 0x01, 0x81, 0x45, 0x0B, 0x8C, 0x44, 0x85,
+    0x00, 0x87, 0x44, 0x8A, 0x0B, 0x87, 0x44, 0x8A, 0x00, 0x8D, 0x44, 0x85, 0x0B, 0x82, 0x45, 0x81,
+    0x06, 0x84, 0x8D, 0x8E, 0x8B, 0x81, 0x02, 0x8A, 0x8E, 0x8D, 0x87, 0x0E, 0x43, 0x8B, 0x01, 0x88,
+    0x43, 0x84, 0x0C, 0x83, 0x43, 0x8E, 0x01, 0x8B, 0x43, 0x87, 0x0C, 0x81, 0x43, 0x8B, 0x01, 0x88,
+    0x43, 0x84, 0x0D, 0x85, 0x8D, 0x40, 0x8C, 0x82, 0x02, 0x8A, 0x40, 0x8E, 0x87, 0x3F, 0x21, 0x89,
+    0x45, 0x8C, 0x12, 0x8E, 0x46, 0x82, 0x10, 0x84, 0x47, 0x87, 0x10, 0x8A, 0x47, 0x8D, 0x10, 0x44,
+    0x8D, 0x43, 0x83, 0x0E, 0x86, 0x43, 0x8C, 0x88, 0x43, 0x89, 0x0E, 0x8B, 0x43, 0x87, 0x84, 0x43,
+    0x8E, 0x0D, 0x81, 0x44, 0x83, 0x00, 0x8E, 0x43, 0x84, 0x0C, 0x87, 0x43, 0x8E, 0x01, 0x8A, 0x43,
+    0x8A, 0x0C, 0x8C, 0x43, 0x89, 0x01, 0x85, 0x44, 0x0B, 0x82, 0x44, 0x84, 0x02, 0x44, 0x85, 0x0A,
+    0x88, 0x44, 0x03, 0x8B, 0x43, 0x8B, 0x0A, 0x8D, 0x43, 0x8A, 0x03, 0x86, 0x44, 0x81, 0x08, 0x83,
+    0x44, 0x86, 0x03, 0x81, 0x44, 0x86, 0x08, 0x89, 0x44, 0x81, 0x04, 0x8C, 0x43, 0x8C, 0x08, 0x8E,
+    0x43, 0x8C, 0x05, 0x87, 0x44, 0x82, 0x06, 0x84, 0x51, 0x87, 0x06, 0x8A, 0x51, 0x8D, 0x06, 0x53,
+    0x83, 0x04, 0x85, 0x53, 0x88, 0x04, 0x8B, 0x44, 0xFD, 0x9D, 0x44, 0x8E, 0x03, 0x81, 0x44, 0x8E,
+    0x09, 0x8B, 0x44, 0x84, 0x02, 0x86, 0x44, 0x8A, 0x09, 0x86, 0x44, 0x89, 0x02, 0x8C, 0x44, 0x85,
+    0x09, 0x81, 0x45, 0x01, 0x81, 0x45, 0x0B, 0x8C, 0x44, 0x85, 0x00, 0x87, 0x44, 0x8A, 0x0B, 0x87,
+    0x44, 0x8A, 0x00, 0x8D, 0x44, 0x85, 0x0B, 0x82, 0x45, 0x81, 0x0A, 0x82, 0x95, 0x82, 0x14, 0x81,
+    0x8B, 0x43, 0x8C, 0x82, 0x12, 0x8C, 0x45, 0x8E, 0x81, 0x10, 0x84, 0x41, 0x8E, 0x95, 0x8D, 0x41,
+    0x88, 0x10, 0x87, 0x41, 0x86, 0x01, 0x84, 0x41, 0x8B, 0x10, 0x87, 0x41, 0x85, 0x01, 0x83, 0x41,
+    0x8C, 0x10, 0x85, 0x41, 0x8C, 0x91, 0x8B, 0x41, 0x89, 0x11, 0x47, 0x82, 0x11, 0x47, 0x82, 0x10,
+    0x84, 0x47, 0x87, 0x10, 0x8A, 0x47, 0x8D, 0x10, 0x44, 0x8D, 0x43, 0x83, 0x0E, 0x86, 0x43, 0x8C,
+    0x88, 0x43, 0x89, 0x0E, 0x8B, 0x43, 0x87, 0x84, 0x43, 0x8E, 0x0D, 0x81, 0x44, 0x83, 0x00, 0x8E,
+    0x43, 0x84, 0x0C, 0x87, 0x43, 0x8E, 0x01, 0x8A, 0x43, 0x8A, 0x0C, 0x8C, 0x43, 0x89, 0x01, 0x85,
+    0x44, 0x0B, 0x82, 0x44, 0x84, 0x02, 0x44, 0x85, 0x0A, 0x88, 0x44, 0x03, 0x8B, 0x43, 0x8B, 0x0A,
+    0x8D, 0x43, 0x8A, 0x03, 0x86, 0x44, 0x81, 0x08, 0x83, 0x44, 0x86, 0x03, 0x81, 0x44, 0x86, 0x08,
+    0x89, 0x44, 0x81, 0x04, 0x8C, 0x43, 0x8C, 0x08, 0x8E, 0x43, 0x8C, 0x05, 0x87, 0x44, 0x82, 0x06,
+    0x84, 0x51, 0x87, 0x06, 0x8A, 0x51, 0x8D, 0x06, 0x53, 0x83, 0x04, 0x85, 0x53, 0x88, 0x04, 0x8B,
+    0x44, 0xFD, 0x9D, 0x44, 0x8E, 0x03, 0x81, 0x44, 0x8E, 0x09, 0x8B, 0x44, 0x84, 0x02, 0x86, 0x44,
+    0x8A, 0x09, 0x86, 0x44, 0x89, 0x02, 0x8C, 0x44, 0x85, 0x09, 0x81, 0x45, 0x01, 0x81, 0x45, 0x0B,
+    0x8C, 0x44, 0x85, 0x00, 0x87, 0x44, 0x8A, 0x0B, 0x87, 0x44, 0x8A, 0x00, 0x8D, 0x44, 0x85, 0x0B,
+    0x82, 0x45, 0x81, 0x0A, 0x81, 0x55, 0x0A, 0x88, 0x55, 0x0A, 0x8E, 0x55, 0x09, 0x86, 0x56, 0x09,
+    0x8D, 0x44, 0x9E, 0x44, 0x8D, 0xFB, 0x8B, 0x8A, 0x08, 0x85, 0x44, 0x82, 0x00, 0x84, 0x44, 0x87,
+    0x12, 0x8C, 0x43, 0x8B, 0x01, 0x84, 0x44, 0x87, 0x11, 0x83, 0x44, 0x84, 0x01, 0x84, 0x44, 0x87,
+    0x11, 0x8A, 0x43, 0x8D, 0x02, 0x84, 0x44, 0x87, 0x10, 0x82, 0x44, 0x87, 0x02, 0x84, 0x44, 0x87,
+    0x10, 0x89, 0x44, 0x81, 0x02, 0x84, 0x44, 0x87, 0x0F, 0x81, 0x44, 0x89, 0x03, 0x84, 0x4E, 0x84,
+    0x05, 0x87, 0x44, 0x82, 0x03, 0x84, 0x4E, 0x84, 0x05, 0x8E, 0x43, 0x8C, 0x04, 0x84, 0x4E, 0x84,
+    0x04, 0x85, 0x44, 0x85, 0x04, 0x84, 0x4E, 0x84, 0x04, 0x8D, 0x43, 0x8E, 0x05, 0x84, 0x44, 0x8D,
+    0xFB, 0x8B, 0x82, 0x03, 0x84, 0x51, 0x87, 0x0D, 0x8B, 0x51, 0x87, 0x0C, 0x82, 0x52, 0x87, 0x0C,
+    0x8A, 0x52, 0x87, 0x0B, 0x81, 0x44, 0x8E, 0xFD, 0x8D, 0x44, 0x87, 0x0B, 0x88, 0x44, 0x85, 0x07,
+    0x84, 0x44, 0x87, 0x0B, 0x8E, 0x43, 0x8D, 0x08, 0x84, 0x44, 0x8D, 0xFC, 0x8C, 0x8B, 0x00, 0x86,
+    0x44, 0x86, 0x08, 0x84, 0x4F, 0x00, 0x8D, 0x43, 0x8E, 0x09, 0x84, 0x4F, 0x85, 0x44, 0x88, 0x09,
+    0x84, 0x4F, 0x8C, 0x44, 0x81, 0x09, 0x84, 0x4F, 0x07, 0x85, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8C,
+    0x89, 0x85, 0x08, 0x88, 0x4B, 0x8A, 0x83, 0x03, 0x83, 0x8D, 0x4D, 0x8A, 0x02, 0x84, 0x4F, 0x83,
+    0x01, 0x82, 0x8E, 0x46, 0x8E, 0x9D, 0x44, 0x8D, 0x02, 0x8B, 0x45, 0x8B, 0x83, 0x03, 0x83, 0x88,
+    0x8E, 0x40, 0x87, 0x01, 0x84, 0x45, 0x87, 0x08, 0x85, 0x81, 0x01, 0x8B, 0x44, 0x8A, 0x0C, 0x81,
+    0x45, 0x81, 0x0C, 0x85, 0x44, 0x8B, 0x0D, 0x88, 0x44, 0x87, 0x0D, 0x8A, 0x44, 0x84, 0x0D, 0x8C,
+    0x44, 0x82, 0x0D, 0x8C, 0x44, 0x82, 0x0D, 0x8B, 0x44, 0x82, 0x0D, 0x8A, 0x44, 0x83, 0x0D, 0x89,
+    0x44, 0x86, 0x0D, 0x86, 0x44, 0x89, 0x0D, 0x83, 0x44, 0x8E, 0x0E, 0x8E, 0x44, 0x87, 0x0D, 0x88,
+    0x45, 0x84, 0x09, 0x81, 0x01, 0x81, 0x46, 0x89, 0x82, 0x04, 0x83, 0x87, 0x8C, 0x8D, 0x02, 0x86,
+    0x47, 0x8E, 0x8D, 0x8C, 0x8E, 0x43, 0x8D, 0x03, 0x8A, 0x4E, 0x8D, 0x04, 0x88, 0x4D, 0x8D, 0x05,
+    0x84, 0x8C, 0x4B, 0x8A, 0x07, 0x83, 0x87, 0x8B, 0x8D, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x85, 0x81,
+    0x0A, 0x88, 0x42, 0x82, 0x0E, 0x81, 0x42, 0x8E, 0x0F, 0x87, 0x43, 0x8B, 0x82, 0x0E, 0x81, 0x88,
+    0x43, 0x83, 0x0F, 0x8C, 0x42, 0x8A, 0x0B, 0x94, 0x82, 0x83, 0x8E, 0x42, 0x8B, 0x0B, 0x8A, 0x46,
+    0x88, 0x0B, 0x8A, 0x45, 0x8E, 0x81, 0x0B, 0x87, 0x8D, 0x41, 0x8E, 0x8C, 0x87, 0x81, 0x05, 0x00,
+    0x81, 0x8E, 0x44, 0x87, 0x09, 0x81, 0x8D, 0x44, 0x83, 0x0A, 0x8B, 0x43, 0x8E, 0x81, 0x0A, 0x88,
+    0x43, 0x8C, 0x0B, 0x85, 0x43, 0x8A, 0x0B, 0x82, 0x8C, 0x42, 0x86, 0x25, 0x89, 0x4E, 0x00, 0x89,
+    0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x44, 0x8C, 0xFB, 0x8B, 0x00, 0x89, 0x44,
+    0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44,
+    0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x4D,
+    0x85, 0x00, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x44, 0x8C, 0xFB, 0x83, 0x00, 0x89, 0x44, 0x82, 0x09,
+    0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09,
+    0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0xFC, 0x9C, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89,
+    0x4E, 0x00, 0x89, 0x4E, 0x00, 0x07, 0x82, 0x45, 0x85, 0x08, 0x8D, 0x44, 0x85, 0x08, 0x8A, 0x43,
+    0x8E, 0x83, 0x08, 0x87, 0x43, 0x8C, 0x81, 0x08, 0x84, 0x43, 0x89, 0x09, 0x81, 0x43, 0x85, 0x28,
+    0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x44, 0x8C, 0xFB,
+    0x8B, 0x00, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44,
+    0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x4D,
+    0x85, 0x00, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x44, 0x8C, 0xFB, 0x83, 0x00,
+    0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09,
+    0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0xFC, 0x9C, 0x00, 0x89, 0x4E, 0x00,
+    0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x03, 0x85, 0x45, 0x8E, 0x81, 0x06, 0x82,
+    0x8E, 0x46, 0x8B, 0x05, 0x81, 0x8D, 0x48, 0x88, 0x04, 0x8C, 0x43, 0x88, 0x82, 0x8D, 0x43, 0x87,
+    0x02, 0x8B, 0x42, 0x8E, 0x85, 0x02, 0x8A, 0x43, 0x86, 0x00, 0x8A, 0x42, 0x8B, 0x81, 0x04, 0x85,
+    0x8E, 0x42, 0x84, 0x21, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00,
+    0x89, 0x44, 0x8C, 0xFB, 0x8B, 0x00, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44,
+    0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x4D,
+    0x85, 0x00, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x44,
+    0x8C, 0xFB, 0x83, 0x00, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09,
+    0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0xFC, 0x9C,
+    0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x01, 0x82, 0x8B,
+    0x8E, 0x8C, 0x84, 0x02, 0x87, 0x8D, 0x8E, 0x89, 0x04, 0x8B, 0x43, 0x01, 0x83, 0x43, 0x88, 0x03,
+    0x8E, 0x43, 0x83, 0x00, 0x86, 0x43, 0x8B, 0x03, 0x8C, 0x43, 0x81, 0x00, 0x84, 0x43, 0x88, 0x03,
+    0x82, 0x8C, 0x40, 0x8D, 0x84, 0x02, 0x87, 0x8E, 0x40, 0x8A, 0x35, 0x89, 0x4E, 0x00, 0x89, 0x4E,
+    0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x44, 0x8C, 0xFB, 0x8B, 0x00, 0x89, 0x44, 0x82,
+    0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82,
+    0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x4D, 0x85,
+    0x00, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x44, 0x8C, 0xFB, 0x83, 0x00, 0x89, 0x44, 0x82, 0x09, 0x89,
+    0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89,
+    0x44, 0x82, 0x09, 0x89, 0x44, 0xFC, 0x9C, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E,
+    0x00, 0x89, 0x4E, 0x00, 0x00, 0x8D, 0x44, 0x89, 0x04, 0x81, 0x8C, 0x44, 0x85, 0x05, 0x89, 0x44,
+    0x82, 0x05, 0x86, 0x43, 0x8D, 0x81, 0x05, 0x83, 0x8E, 0x42, 0x8B, 0x06, 0x81, 0x8B, 0x42, 0x88,
+    0x1C, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82,
+    0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82,
+    0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82,
+    0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82,
+    0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82,
+    0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82,
+    0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82, 0x04, 0x89, 0x44, 0x82, 0x03, 0x8D, 0x44, 0x89,
+    0x02, 0x89, 0x44, 0x88, 0x02, 0x86, 0x44, 0x86, 0x02, 0x83, 0x43, 0x8E, 0x83, 0x02, 0x82, 0x8E,
+    0x42, 0x8C, 0x81, 0x03, 0x8C, 0x42, 0x88, 0x1B, 0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03,
+    0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03,
+    0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03,
+    0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03,
+    0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03,
+    0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03,
+    0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x82, 0x03,
+    0x89, 0x44, 0x82, 0x03, 0x03, 0x86, 0x45, 0x8E, 0x07, 0x82, 0x47, 0x8A, 0x05, 0x81, 0x8D, 0x48,
+    0x88, 0x04, 0x8C, 0x43, 0x87, 0x82, 0x8D, 0x43, 0x86, 0x02, 0x8C, 0x42, 0x8E, 0x84, 0x01, 0x81,
+    0x8A, 0x43, 0x85, 0x00, 0x8A, 0x42, 0x8A, 0x81, 0x04, 0x85, 0x8E, 0x42, 0x83, 0x26, 0x89, 0x44,
+    0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44,
+    0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44,
+    0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44,
+    0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44,
+    0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44,
+    0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44,
+    0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x04, 0x00, 0x83, 0x8C, 0x8E, 0x8C, 0x83,
+    0x02, 0x88, 0x9E, 0x89, 0x01, 0x8D, 0x42, 0x8E, 0x01, 0x85, 0x43, 0x86, 0x00, 0x44, 0x81, 0x00,
+    0x88, 0x43, 0x8A, 0x00, 0x8D, 0x42, 0x8E, 0x01, 0x86, 0x43, 0x87, 0x00, 0x83, 0x8C, 0x40, 0x8D,
+    0x83, 0x02, 0x89, 0x9E, 0x89, 0x2E, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44,
+    0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44,
+    0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44,
+    0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44,
+    0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44,
+    0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44,
+    0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44, 0x82, 0x06, 0x89, 0x44,
+    0x82, 0x02, 0x02, 0x89, 0x48, 0x8E, 0x8D, 0x8A, 0x87, 0x83, 0x0A, 0x89, 0x4D, 0x8D, 0x85, 0x08,
+    0x89, 0x4F, 0x8C, 0x82, 0x06, 0x89, 0x50, 0x8E, 0x84, 0x05, 0x89, 0x44, 0x8C, 0xAB, 0x8D, 0x47,
+    0x8E, 0x82, 0x04, 0x89, 0x44, 0x82, 0x04, 0x84, 0x8B, 0x45, 0x8D, 0x04, 0x89, 0x44, 0x82, 0x06,
+    0x87, 0x45, 0x86, 0x03, 0x89, 0x44, 0x82, 0x07, 0x89, 0x44, 0x8E, 0x03, 0x89, 0x44, 0x82, 0x08,
+    0x45, 0x83, 0x02, 0x89, 0x44, 0x82, 0x08, 0x89, 0x44, 0x87, 0x02, 0x89, 0x44, 0x82, 0x08, 0x85,
+    0x44, 0x8B, 0x82, 0x4B, 0x89, 0x04, 0x82, 0x44, 0x8C, 0x82, 0x4B, 0x89, 0x04, 0x81, 0x44, 0x8D,
+    0x82, 0x4B, 0x89, 0x04, 0x81, 0x44, 0x8E, 0x82, 0x4B, 0x89, 0x04, 0x81, 0x44, 0x8D, 0x81, 0x9B,
+    0x8E, 0x44, 0x8C, 0xAB, 0x86, 0x04, 0x83, 0x44, 0x8B, 0x02, 0x89, 0x44, 0x82, 0x08, 0x86, 0x44,
+    0x8A, 0x02, 0x89, 0x44, 0x82, 0x08, 0x8A, 0x44, 0x86, 0x02, 0x89, 0x44, 0x82, 0x07, 0x81, 0x45,
+    0x82, 0x02, 0x89, 0x44, 0x82, 0x07, 0x8B, 0x44, 0x8C, 0x03, 0x89, 0x44, 0x82, 0x06, 0x8A, 0x45,
+    0x84, 0x03, 0x89, 0x44, 0x82, 0x03, 0x81, 0x86, 0x8E, 0x45, 0x8B, 0x04, 0x89, 0x44, 0xBC, 0x8E,
+    0x47, 0x8D, 0x81, 0x04, 0x89, 0x50, 0x8D, 0x82, 0x05, 0x89, 0x4F, 0x8A, 0x07, 0x89, 0x4D, 0x8A,
+    0x83, 0x08, 0x89, 0x47, 0x8E, 0x8D, 0x8C, 0x88, 0x85, 0x81, 0x07, 0x06, 0x86, 0x8C, 0x40, 0x8E,
+    0x88, 0x81, 0x03, 0x8C, 0x41, 0x81, 0x09, 0x89, 0x44, 0x8E, 0x87, 0x01, 0x84, 0x41, 0x8E, 0x09,
+    0x84, 0x48, 0x8C, 0x42, 0x8A, 0x09, 0x8B, 0x42, 0x8C, 0x48, 0x83, 0x09, 0x42, 0x83, 0x01, 0x88,
+    0x45, 0x87, 0x09, 0x82, 0x41, 0x8A, 0x03, 0x81, 0x89, 0x8E, 0x40, 0x8C, 0x85, 0x38, 0x89, 0x45,
+    0x8E, 0x0A, 0x8B, 0x43, 0x87, 0x89, 0x46, 0x88, 0x09, 0x8B, 0x43, 0x87, 0x89, 0x47, 0x82, 0x08,
+    0x8B, 0x43, 0x87, 0x89, 0x47, 0x8B, 0x08, 0x8B, 0x43, 0x87, 0x89, 0x48, 0x84, 0x07, 0x8B, 0x43,
+    0x87, 0x89, 0x48, 0x8D, 0x07, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x8E, 0x44, 0x87, 0x06, 0x8B, 0x43,
+    0x87, 0x89, 0x43, 0x86, 0x45, 0x81, 0x05, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x85, 0x88, 0x44, 0x89,
+    0x05, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x85, 0x00, 0x8E, 0x44, 0x83, 0x04, 0x8B, 0x43, 0x87, 0x89,
+    0x43, 0x86, 0x00, 0x85, 0x44, 0x8C, 0x04, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x87, 0x01, 0x8C, 0x44,
+    0x85, 0x03, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x88, 0x01, 0x83, 0x44, 0x8E, 0x03, 0x8B, 0x43, 0x87,
+    0x89, 0x43, 0x88, 0x02, 0x8A, 0x44, 0x88, 0x02, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x88, 0x02, 0x81,
+    0x45, 0x82, 0x01, 0x8A, 0x43, 0x87, 0x89, 0x43, 0x88, 0x03, 0x87, 0x44, 0x8B, 0x01, 0x8A, 0x43,
+    0x87, 0x89, 0x43, 0x88, 0x04, 0x8D, 0x44, 0x84, 0x00, 0x89, 0x43, 0x87, 0x89, 0x43, 0x88, 0x04,
+    0x85, 0x44, 0x8D, 0x00, 0x88, 0x43, 0x87, 0x89, 0x43, 0x88, 0x05, 0x8B, 0x44, 0x87, 0x88, 0x43,
+    0x87, 0x89, 0x43, 0x88, 0x05, 0x82, 0x45, 0x88, 0x43, 0x87, 0x89, 0x43, 0x88, 0x06, 0x89, 0x49,
+    0x87, 0x89, 0x43, 0x88, 0x06, 0x81, 0x8E, 0x48, 0x87, 0x89, 0x43, 0x88, 0x07, 0x86, 0x48, 0x87,
+    0x89, 0x43, 0x88, 0x08, 0x8D, 0x47, 0x87, 0x89, 0x43, 0x88, 0x08, 0x84, 0x47, 0x87, 0x89, 0x43,
+    0x88, 0x09, 0x8B, 0x46, 0x87, 0x89, 0x43, 0x88, 0x09, 0x82, 0x46, 0x87, 0x05, 0x87, 0x44, 0x8E,
+    0x81, 0x13, 0x86, 0x44, 0x8B, 0x14, 0x84, 0x44, 0x88, 0x14, 0x82, 0x8D, 0x43, 0x85, 0x15, 0x8A,
+    0x43, 0x83, 0x15, 0x86, 0x42, 0x8E, 0x3F, 0x06, 0x81, 0x85, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8D,
+    0x8A, 0x86, 0x82, 0x0C, 0x81, 0x89, 0x4B, 0x8B, 0x83, 0x09, 0x85, 0x4F, 0x88, 0x07, 0x87, 0x51,
+    0x8A, 0x05, 0x84, 0x48, 0x9D, 0x8E, 0x47, 0x87, 0x04, 0x8E, 0x45, 0x8B, 0x83, 0x03, 0x82, 0x88,
+    0x46, 0x83, 0x02, 0x86, 0x45, 0x87, 0x07, 0x83, 0x45, 0x8A, 0x02, 0x8D, 0x44, 0x8A, 0x09, 0x86,
+    0x45, 0x81, 0x00, 0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x86, 0x00, 0x86, 0x44, 0x8B, 0x0B, 0x88,
+    0x44, 0x89, 0x00, 0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8D, 0x00, 0x8A, 0x44, 0x85, 0x0B, 0x81,
+    0x44, 0x8E, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8C, 0x44, 0x83, 0x0C, 0x45, 0x00, 0x8B,
+    0x44, 0x84, 0x0C, 0x45, 0x00, 0x8A, 0x44, 0x85, 0x0B, 0x81, 0x44, 0x8E, 0x00, 0x89, 0x44, 0x88,
+    0x0B, 0x84, 0x44, 0x8C, 0x00, 0x85, 0x44, 0x8C, 0x0B, 0x88, 0x44, 0x89, 0x00, 0x82, 0x45, 0x81,
+    0x0A, 0x8D, 0x44, 0x85, 0x01, 0x8D, 0x44, 0x8A, 0x09, 0x86, 0x45, 0x81, 0x01, 0x86, 0x45, 0x87,
+    0x07, 0x84, 0x45, 0x8A, 0x03, 0x8E, 0x45, 0x8B, 0x84, 0x03, 0x82, 0x89, 0x46, 0x82, 0x03, 0x83,
+    0x48, 0x8E, 0x8D, 0x48, 0x87, 0x05, 0x86, 0x51, 0x8A, 0x07, 0x84, 0x4F, 0x87, 0x09, 0x81, 0x89,
+    0x4B, 0x8B, 0x83, 0x0C, 0x81, 0x85, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x82, 0x07,
+    0x0D, 0x8C, 0x44, 0x8B, 0x12, 0x88, 0x44, 0x8A, 0x12, 0x84, 0x44, 0x87, 0x12, 0x82, 0x44, 0x84,
+    0x12, 0x81, 0x8D, 0x42, 0x8D, 0x82, 0x13, 0x8B, 0x42, 0x89, 0x3F, 0x08, 0x81, 0x85, 0x89, 0x8C,
+    0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x82, 0x0C, 0x81, 0x89, 0x4B, 0x8B, 0x83, 0x09, 0x85, 0x4F,
+    0x88, 0x07, 0x87, 0x51, 0x8A, 0x05, 0x84, 0x48, 0x9D, 0x8E, 0x47, 0x87, 0x04, 0x8E, 0x45, 0x8B,
+    0x83, 0x03, 0x82, 0x88, 0x46, 0x83, 0x02, 0x86, 0x45, 0x87, 0x07, 0x83, 0x45, 0x8A, 0x02, 0x8D,
+    0x44, 0x8A, 0x09, 0x86, 0x45, 0x81, 0x00, 0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x86, 0x00, 0x86,
+    0x44, 0x8B, 0x0B, 0x88, 0x44, 0x89, 0x00, 0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8D, 0x00, 0x8A,
+    0x44, 0x85, 0x0B, 0x81, 0x44, 0x8E, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8C, 0x44, 0x83,
+    0x0C, 0x45, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8A, 0x44, 0x85, 0x0B, 0x81, 0x44, 0x8E,
+    0x00, 0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8C, 0x00, 0x85, 0x44, 0x8C, 0x0B, 0x88, 0x44, 0x89,
+    0x00, 0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x85, 0x01, 0x8D, 0x44, 0x8A, 0x09, 0x86, 0x45, 0x81,
+    0x01, 0x86, 0x45, 0x87, 0x07, 0x84, 0x45, 0x8A, 0x03, 0x8E, 0x45, 0x8B, 0x84, 0x03, 0x82, 0x89,
+    0x46, 0x82, 0x03, 0x83, 0x48, 0x8E, 0x8D, 0x48, 0x87, 0x05, 0x86, 0x51, 0x8A, 0x07, 0x84, 0x4F,
+    0x87, 0x09, 0x81, 0x89, 0x4B, 0x8B, 0x83, 0x0C, 0x81, 0x85, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8D,
+    0x8A, 0x86, 0x82, 0x07, 0x08, 0x88, 0x45, 0x8C, 0x11, 0x84, 0x47, 0x88, 0x0F, 0x82, 0x8E, 0x48,
+    0x86, 0x0D, 0x81, 0x8E, 0x43, 0x85, 0x83, 0x8E, 0x43, 0x84, 0x0B, 0x81, 0x8D, 0x42, 0x8D, 0x83,
+    0x01, 0x82, 0x8C, 0x43, 0x84, 0x0A, 0x8C, 0x42, 0x89, 0x05, 0x86, 0x43, 0x81, 0x3F, 0x01, 0x81,
+    0x85, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x82, 0x0C, 0x81, 0x89, 0x4B, 0x8B, 0x83,
+    0x09, 0x85, 0x4F, 0x88, 0x07, 0x87, 0x51, 0x8A, 0x05, 0x84, 0x48, 0x9D, 0x8E, 0x47, 0x87, 0x04,
+    0x8E, 0x45, 0x8B, 0x83, 0x03, 0x82, 0x88, 0x46, 0x83, 0x02, 0x86, 0x45, 0x87, 0x07, 0x83, 0x45,
+    0x8A, 0x02, 0x8D, 0x44, 0x8A, 0x09, 0x86, 0x45, 0x81, 0x00, 0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44,
+    0x86, 0x00, 0x86, 0x44, 0x8B, 0x0B, 0x88, 0x44, 0x89, 0x00, 0x89, 0x44, 0x88, 0x0B, 0x84, 0x44,
+    0x8D, 0x00, 0x8A, 0x44, 0x85, 0x0B, 0x81, 0x44, 0x8E, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00,
+    0x8C, 0x44, 0x83, 0x0C, 0x45, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8A, 0x44, 0x85, 0x0B,
+    0x81, 0x44, 0x8E, 0x00, 0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8C, 0x00, 0x85, 0x44, 0x8C, 0x0B,
+    0x88, 0x44, 0x89, 0x00, 0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x85, 0x01, 0x8D, 0x44, 0x8A, 0x09,
+    0x86, 0x45, 0x81, 0x01, 0x86, 0x45, 0x87, 0x07, 0x84, 0x45, 0x8A, 0x03, 0x8E, 0x45, 0x8B, 0x84,
+    0x03, 0x82, 0x89, 0x46, 0x82, 0x03, 0x83, 0x48, 0x8E, 0x8D, 0x48, 0x87, 0x05, 0x86, 0x51, 0x8A,
+    0x07, 0x84, 0x4F, 0x87, 0x09, 0x81, 0x89, 0x4B, 0x8B, 0x83, 0x0C, 0x81, 0x85, 0x89, 0x8C, 0x8E,
+    0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x82, 0x07, 0x07, 0x88, 0x8E, 0x40, 0x8D, 0x86, 0x03, 0x81, 0x41,
+    0x8C, 0x0C, 0x8D, 0x44, 0x8D, 0x84, 0x01, 0x89, 0x41, 0x89, 0x0B, 0x89, 0x47, 0x8E, 0x8D, 0x42,
+    0x85, 0x0B, 0x42, 0x8E, 0x8C, 0x47, 0x8D, 0x0B, 0x84, 0x41, 0x8D, 0x01, 0x82, 0x8A, 0x45, 0x83,
+    0x0B, 0x87, 0x41, 0x86, 0x03, 0x83, 0x8B, 0x40, 0x8E, 0x8A, 0x82, 0x3F, 0x04, 0x81, 0x85, 0x89,
+    0x8C, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x82, 0x0C, 0x81, 0x89, 0x4B, 0x8B, 0x83, 0x09, 0x85,
+    0x4F, 0x88, 0x07, 0x87, 0x51, 0x8A, 0x05, 0x84, 0x48, 0x9D, 0x8E, 0x47, 0x87, 0x04, 0x8E, 0x45,
+    0x8B, 0x83, 0x03, 0x82, 0x88, 0x46, 0x83, 0x02, 0x86, 0x45, 0x87, 0x07, 0x83, 0x45, 0x8A, 0x02,
+    0x8D, 0x44, 0x8A, 0x09, 0x86, 0x45, 0x81, 0x00, 0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x86, 0x00,
+    0x86, 0x44, 0x8B, 0x0B, 0x88, 0x44, 0x89, 0x00, 0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8D, 0x00,
+    0x8A, 0x44, 0x85, 0x0B, 0x81, 0x44, 0x8E, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8C, 0x44,
+    0x83, 0x0C, 0x45, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8A, 0x44, 0x85, 0x0B, 0x81, 0x44,
+    0x8E, 0x00, 0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8C, 0x00, 0x85, 0x44, 0x8C, 0x0B, 0x88, 0x44,
+    0x89, 0x00, 0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x85, 0x01, 0x8D, 0x44, 0x8A, 0x09, 0x86, 0x45,
+    0x81, 0x01, 0x86, 0x45, 0x87, 0x07, 0x84, 0x45, 0x8A, 0x03, 0x8E, 0x45, 0x8B, 0x84, 0x03, 0x82,
+    0x89, 0x46, 0x82, 0x03, 0x83, 0x48, 0x8E, 0x8D, 0x48, 0x87, 0x05, 0x86, 0x51, 0x8A, 0x07, 0x84,
+    0x4F, 0x87, 0x09, 0x81, 0x89, 0x4B, 0x8B, 0x83, 0x0C, 0x81, 0x85, 0x89, 0x8C, 0x8E, 0x41, 0x8E,
+    0x8D, 0x8A, 0x86, 0x82, 0x07, 0x06, 0x84, 0x8C, 0x8E, 0x8B, 0x82, 0x02, 0x89, 0x8E, 0x8D, 0x87,
+    0x0E, 0x43, 0x8C, 0x01, 0x88, 0x43, 0x84, 0x0C, 0x82, 0x44, 0x01, 0x8A, 0x43, 0x87, 0x0D, 0x43,
+    0x8C, 0x01, 0x88, 0x43, 0x84, 0x0D, 0x84, 0x8D, 0x40, 0x8C, 0x82, 0x02, 0x8A, 0x40, 0x8E, 0x88,
+    0x3F, 0x1F, 0x81, 0x85, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x82, 0x0C, 0x81, 0x89,
+    0x4B, 0x8B, 0x83, 0x09, 0x85, 0x4F, 0x88, 0x07, 0x87, 0x51, 0x8A, 0x05, 0x84, 0x48, 0x9D, 0x8E,
+    0x47, 0x87, 0x04, 0x8E, 0x45, 0x8B, 0x83, 0x03, 0x82, 0x88, 0x46, 0x83, 0x02, 0x86, 0x45, 0x87,
+    0x07, 0x83, 0x45, 0x8A, 0x02, 0x8D, 0x44, 0x8A, 0x09, 0x86, 0x45, 0x81, 0x00, 0x82, 0x45, 0x81,
+    0x0A, 0x8D, 0x44, 0x86, 0x00, 0x86, 0x44, 0x8B, 0x0B, 0x88, 0x44, 0x89, 0x00, 0x89, 0x44, 0x88,
+    0x0B, 0x84, 0x44, 0x8D, 0x00, 0x8A, 0x44, 0x85, 0x0B, 0x81, 0x44, 0x8E, 0x00, 0x8B, 0x44, 0x84,
+    0x0C, 0x45, 0x00, 0x8C, 0x44, 0x83, 0x0C, 0x45, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8A,
+    0x44, 0x85, 0x0B, 0x81, 0x44, 0x8E, 0x00, 0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8C, 0x00, 0x85,
+    0x44, 0x8C, 0x0B, 0x88, 0x44, 0x89, 0x00, 0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x85, 0x01, 0x8D,
+    0x44, 0x8A, 0x09, 0x86, 0x45, 0x81, 0x01, 0x86, 0x45, 0x87, 0x07, 0x84, 0x45, 0x8A, 0x03, 0x8E,
+    0x45, 0x8B, 0x84, 0x03, 0x82, 0x89, 0x46, 0x82, 0x03, 0x83, 0x48, 0x8E, 0x8D, 0x48, 0x87, 0x05,
+    0x86, 0x51, 0x8A, 0x07, 0x84, 0x4F, 0x87, 0x09, 0x81, 0x89, 0x4B, 0x8B, 0x83, 0x0C, 0x81, 0x85,
+    0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x82, 0x07, 0x01, 0x84, 0x89, 0x08, 0x81, 0x8B,
+    0x81, 0x02, 0x83, 0x41, 0x8A, 0x06, 0x82, 0x8E, 0x40, 0x8D, 0x81, 0x00, 0x83, 0x43, 0x8A, 0x04,
+    0x82, 0x8E, 0x42, 0x8D, 0x81, 0x82, 0x8E, 0x43, 0x8A, 0x02, 0x82, 0x8E, 0x43, 0x8A, 0x01, 0x82,
+    0x8E, 0x43, 0x8A, 0x00, 0x82, 0x8E, 0x43, 0x8A, 0x03, 0x82, 0x8E, 0x43, 0x8B, 0x8E, 0x43, 0x8A,
+    0x05, 0x82, 0x8E, 0x47, 0x8A, 0x07, 0x82, 0x8E, 0x45, 0x8A, 0x09, 0x84, 0x44, 0x8D, 0x09, 0x82,
+    0x8E, 0x45, 0x89, 0x07, 0x82, 0x8E, 0x47, 0x89, 0x05, 0x82, 0x8E, 0x43, 0x8A, 0x8E, 0x43, 0x89,
+    0x03, 0x81, 0x8D, 0x43, 0x8A, 0x00, 0x82, 0x8E, 0x43, 0x89, 0x01, 0x81, 0x8D, 0x43, 0x8A, 0x02,
+    0x82, 0x8E, 0x43, 0x89, 0x00, 0x83, 0x43, 0x8A, 0x04, 0x82, 0x8E, 0x42, 0x8C, 0x01, 0x83, 0x41,
+    0x89, 0x06, 0x82, 0x8E, 0x40, 0x8C, 0x81, 0x02, 0x83, 0x89, 0x08, 0x82, 0x8B, 0x81, 0x01, 0x2E,
+    0x84, 0x8C, 0x82, 0x0A, 0x81, 0x85, 0x89, 0x8C, 0x8E, 0x42, 0x8D, 0x8B, 0x87, 0x82, 0x81, 0x8E,
+    0x41, 0x87, 0x07, 0x81, 0x89, 0x4B, 0x8E, 0x42, 0x8A, 0x06, 0x85, 0x50, 0x8E, 0x06, 0x87, 0x51,
+    0x8B, 0x05, 0x84, 0x48, 0x9D, 0x8E, 0x47, 0x87, 0x04, 0x8E, 0x45, 0x8B, 0x83, 0x03, 0x82, 0x8B,
+    0x46, 0x82, 0x02, 0x86, 0x45, 0x87, 0x05, 0x81, 0x8E, 0x46, 0x8A, 0x02, 0x8D, 0x44, 0x8A, 0x06,
+    0x8A, 0x48, 0x81, 0x00, 0x82, 0x45, 0x81, 0x05, 0x86, 0x42, 0x9D, 0x44, 0x85, 0x00, 0x86, 0x44,
+    0x8B, 0x05, 0x82, 0x43, 0x83, 0x88, 0x44, 0x89, 0x00, 0x89, 0x44, 0x88, 0x05, 0x8C, 0x42, 0x87,
+    0x00, 0x84, 0x44, 0x8C, 0x00, 0x8A, 0x44, 0x85, 0x04, 0x88, 0x42, 0x8C, 0x01, 0x81, 0x44, 0x8E,
+    0x00, 0x8B, 0x44, 0x84, 0x03, 0x83, 0x43, 0x82, 0x02, 0x45, 0x00, 0x8C, 0x44, 0x83, 0x03, 0x8D,
+    0x42, 0x85, 0x03, 0x45, 0x00, 0x8B, 0x44, 0x84, 0x02, 0x89, 0x42, 0x8A, 0x04, 0x45, 0x00, 0x8A,
+    0x44, 0x85, 0x01, 0x85, 0x42, 0x8E, 0x81, 0x03, 0x81, 0x44, 0x8E, 0x00, 0x89, 0x44, 0x88, 0x00,
+    0x81, 0x8E, 0x42, 0x84, 0x04, 0x84, 0x44, 0x8C, 0x00, 0x86, 0x44, 0x8B, 0x00, 0x8B, 0x42, 0x89,
+    0x05, 0x88, 0x44, 0x89, 0x00, 0x82, 0x45, 0x89, 0x42, 0x8D, 0x06, 0x8D, 0x44, 0x85, 0x01, 0x8D,
+    0x48, 0x83, 0x05, 0x86, 0x45, 0x81, 0x01, 0x86, 0x47, 0x87, 0x05, 0x84, 0x45, 0x8A, 0x03, 0x8E,
+    0x46, 0x84, 0x03, 0x82, 0x89, 0x46, 0x82, 0x03, 0x84, 0x48, 0x8E, 0x8D, 0x48, 0x87, 0x05, 0x87,
+    0x51, 0x8A, 0x06, 0x88, 0x50, 0x87, 0x06, 0x83, 0x4F, 0x8B, 0x83, 0x07, 0x86, 0x42, 0x86, 0x81,
+    0x86, 0x8A, 0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x82, 0x0A, 0x82, 0x9C, 0x19, 0x81, 0x14,
+    0x03, 0x8D, 0x44, 0x8A, 0x10, 0x8B, 0x44, 0x85, 0x10, 0x89, 0x44, 0x82, 0x10, 0x86, 0x43, 0x8D,
+    0x81, 0x10, 0x83, 0x8E, 0x42, 0x8C, 0x11, 0x81, 0x8B, 0x42, 0x88, 0x35, 0x8C, 0x44, 0x09, 0x83,
+    0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44,
+    0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88,
+    0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83,
+    0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44,
+    0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88,
+    0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x84,
+    0x44, 0x88, 0x8B, 0x44, 0x09, 0x85, 0x44, 0x87, 0x8A, 0x44, 0x83, 0x08, 0x87, 0x44, 0x86, 0x88,
+    0x44, 0x88, 0x08, 0x8C, 0x44, 0x94, 0x45, 0x82, 0x06, 0x86, 0x45, 0x01, 0x8E, 0x44, 0x8E, 0x85,
+    0x03, 0x81, 0x88, 0x45, 0x89, 0x01, 0x85, 0x47, 0x8E, 0x8D, 0x8E, 0x47, 0x81, 0x02, 0x8A, 0x50,
+    0x85, 0x04, 0x8A, 0x4E, 0x85, 0x06, 0x85, 0x8D, 0x4A, 0x8A, 0x82, 0x09, 0x84, 0x88, 0x8C, 0x8E,
+    0x42, 0x8D, 0x8A, 0x87, 0x81, 0x05, 0x0B, 0x8C, 0x44, 0x8A, 0x0E, 0x88, 0x44, 0x89, 0x0E, 0x85,
+    0x44, 0x87, 0x0E, 0x82, 0x43, 0x8E, 0x84, 0x0E, 0x81, 0x8E, 0x42, 0x8C, 0x82, 0x0F, 0x8B, 0x42,
+    0x89, 0x37, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44,
+    0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88,
+    0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83,
+    0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44,
+    0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88,
+    0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83,
+    0x44, 0x88, 0x8C, 0x44, 0x09, 0x84, 0x44, 0x88, 0x8B, 0x44, 0x09, 0x85, 0x44, 0x87, 0x8A, 0x44,
+    0x83, 0x08, 0x87, 0x44, 0x86, 0x88, 0x44, 0x88, 0x08, 0x8C, 0x44, 0x94, 0x45, 0x82, 0x06, 0x86,
+    0x45, 0x01, 0x8E, 0x44, 0x8E, 0x85, 0x03, 0x81, 0x88, 0x45, 0x89, 0x01, 0x85, 0x47, 0x8E, 0x8D,
+    0x8E, 0x47, 0x81, 0x02, 0x8A, 0x50, 0x85, 0x04, 0x8A, 0x4E, 0x85, 0x06, 0x85, 0x8D, 0x4A, 0x8A,
+    0x82, 0x09, 0x84, 0x88, 0x8C, 0x8E, 0x42, 0x8D, 0x8A, 0x87, 0x81, 0x05, 0x06, 0x84, 0x45, 0x8E,
+    0x81, 0x0C, 0x81, 0x8E, 0x46, 0x8C, 0x0C, 0x8C, 0x48, 0x89, 0x0A, 0x8B, 0x43, 0x88, 0x81, 0x8D,
+    0x43, 0x88, 0x08, 0x8A, 0x43, 0x85, 0x02, 0x89, 0x43, 0x87, 0x06, 0x89, 0x42, 0x8B, 0x82, 0x04,
+    0x84, 0x8D, 0x42, 0x85, 0x30, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44,
+    0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09,
+    0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C,
+    0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44,
+    0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09,
+    0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C,
+    0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x84, 0x44, 0x88, 0x8B, 0x44, 0x09, 0x85, 0x44,
+    0x87, 0x8A, 0x44, 0x83, 0x08, 0x87, 0x44, 0x86, 0x88, 0x44, 0x88, 0x08, 0x8C, 0x44, 0x94, 0x45,
+    0x82, 0x06, 0x86, 0x45, 0x01, 0x8E, 0x44, 0x8E, 0x85, 0x03, 0x81, 0x88, 0x45, 0x89, 0x01, 0x85,
+    0x47, 0x8E, 0x8D, 0x8E, 0x47, 0x81, 0x02, 0x8A, 0x50, 0x85, 0x04, 0x8A, 0x4E, 0x85, 0x06, 0x85,
+    0x8D, 0x4A, 0x8A, 0x82, 0x09, 0x84, 0x88, 0x8C, 0x8E, 0x42, 0x8D, 0x8A, 0x87, 0x81, 0x05, 0x04,
+    0x82, 0x8B, 0x8E, 0x8C, 0x84, 0x02, 0x87, 0x8D, 0x8E, 0x89, 0x0A, 0x8B, 0x43, 0x01, 0x84, 0x43,
+    0x88, 0x09, 0x8E, 0x43, 0x83, 0x00, 0x87, 0x43, 0x8B, 0x09, 0x8C, 0x43, 0x01, 0x84, 0x43, 0x88,
+    0x09, 0x82, 0x8C, 0x40, 0x8D, 0x84, 0x02, 0x88, 0x8E, 0x40, 0x8A, 0x3F, 0x0A, 0x8C, 0x44, 0x09,
+    0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C,
+    0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44,
+    0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09,
+    0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C,
+    0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44,
+    0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09,
+    0x84, 0x44, 0x88, 0x8B, 0x44, 0x09, 0x85, 0x44, 0x87, 0x8A, 0x44, 0x83, 0x08, 0x87, 0x44, 0x86,
+    0x88, 0x44, 0x88, 0x08, 0x8C, 0x44, 0x94, 0x45, 0x82, 0x06, 0x86, 0x45, 0x01, 0x8E, 0x44, 0x8E,
+    0x85, 0x03, 0x81, 0x88, 0x45, 0x89, 0x01, 0x85, 0x47, 0x8E, 0x8D, 0x8E, 0x47, 0x81, 0x02, 0x8A,
+    0x50, 0x85, 0x04, 0x8A, 0x4E, 0x85, 0x06, 0x85, 0x8D, 0x4A, 0x8A, 0x82, 0x09, 0x84, 0x88, 0x8C,
+    0x8E, 0x42, 0x8D, 0x8A, 0x87, 0x81, 0x05, 0x0B, 0x87, 0x44, 0x8E, 0x82, 0x0E, 0x83, 0x44, 0x8D,
+    0x82, 0x0E, 0x81, 0x8D, 0x43, 0x8B, 0x81, 0x0F, 0x8B, 0x43, 0x89, 0x10, 0x89, 0x43, 0x85, 0x10,
+    0x85, 0x42, 0x8D, 0x82, 0x39, 0x8B, 0x44, 0x87, 0x09, 0x8B, 0x44, 0x87, 0x83, 0x44, 0x8E, 0x08,
+    0x83, 0x44, 0x8D, 0x01, 0x8A, 0x44, 0x87, 0x07, 0x8C, 0x44, 0x85, 0x01, 0x82, 0x45, 0x81, 0x05,
+    0x84, 0x44, 0x8C, 0x03, 0x89, 0x44, 0x88, 0x05, 0x8C, 0x44, 0x84, 0x03, 0x81, 0x45, 0x81, 0x03,
+    0x84, 0x44, 0x8B, 0x05, 0x88, 0x44, 0x88, 0x03, 0x8C, 0x44, 0x82, 0x06, 0x8E, 0x44, 0x81, 0x01,
+    0x84, 0x44, 0x8A, 0x07, 0x86, 0x44, 0x88, 0x01, 0x8C, 0x44, 0x81, 0x08, 0x8D, 0x44, 0x81, 0x85,
+    0x44, 0x88, 0x09, 0x85, 0x44, 0x88, 0x8D, 0x43, 0x8E, 0x81, 0x0A, 0x8C, 0x49, 0x87, 0x0B, 0x84,
+    0x48, 0x8E, 0x0D, 0x8B, 0x47, 0x85, 0x0D, 0x83, 0x46, 0x8C, 0x0F, 0x8A, 0x45, 0x84, 0x0F, 0x82,
+    0x44, 0x8C, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44,
+    0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B,
+    0x08, 0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x82,
+    0x0C, 0x89, 0x48, 0x8E, 0x8D, 0x8A, 0x87, 0x81, 0x04, 0x89, 0x4D, 0x88, 0x03, 0x89, 0x4E, 0x8C,
+    0x02, 0x89, 0x4F, 0x8A, 0x01, 0x89, 0x44, 0x8B, 0x9A, 0x8B, 0x8E, 0x46, 0x83, 0x00, 0x89, 0x44,
+    0x82, 0x03, 0x84, 0x8E, 0x44, 0x8A, 0x00, 0x89, 0x44, 0x82, 0x04, 0x83, 0x44, 0x8E, 0x00, 0x89,
+    0x44, 0x82, 0x05, 0x8D, 0x44, 0x00, 0x89, 0x44, 0x82, 0x05, 0x8A, 0x44, 0x82, 0x89, 0x44, 0x82,
+    0x05, 0x8B, 0x44, 0x81, 0x89, 0x44, 0x82, 0x05, 0x8D, 0x44, 0x00, 0x89, 0x44, 0x82, 0x04, 0x84,
+    0x44, 0x8D, 0x00, 0x89, 0x44, 0x82, 0x03, 0x85, 0x45, 0x88, 0x00, 0x89, 0x44, 0x8B, 0x9A, 0x8B,
+    0x8E, 0x46, 0x81, 0x00, 0x89, 0x4F, 0x87, 0x01, 0x89, 0x4E, 0x89, 0x02, 0x89, 0x4C, 0x8E, 0x85,
+    0x03, 0x89, 0x48, 0x8E, 0x8C, 0x89, 0x85, 0x05, 0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C,
+    0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x05, 0x84, 0x89, 0x8C,
+    0x8E, 0x42, 0x8D, 0x8B, 0x88, 0x83, 0x0A, 0x86, 0x8E, 0x4A, 0x8D, 0x84, 0x07, 0x8A, 0x4E, 0x88,
+    0x05, 0x8A, 0x50, 0x86, 0x03, 0x84, 0x46, 0x8A, 0x88, 0x87, 0x89, 0x8D, 0x45, 0x8E, 0x03, 0x8A,
+    0x44, 0x8B, 0x81, 0x04, 0x86, 0x45, 0x81, 0x02, 0x8E, 0x43, 0x8E, 0x07, 0x8B, 0x44, 0x82, 0x02,
+    0x44, 0x8B, 0x07, 0x8B, 0x43, 0x8E, 0x03, 0x44, 0x8A, 0x06, 0x83, 0x44, 0x88, 0x03, 0x44, 0x8A,
+    0x05, 0x84, 0x8E, 0x43, 0x8D, 0x04, 0x44, 0x8A, 0x04, 0x87, 0x44, 0x8C, 0x81, 0x04, 0x44, 0x8A,
+    0x03, 0x89, 0x44, 0x89, 0x06, 0x44, 0x8A, 0x02, 0x84, 0x44, 0x87, 0x07, 0x44, 0x8A, 0x02, 0x8A,
+    0x44, 0x08, 0x44, 0x8A, 0x02, 0x8B, 0x44, 0x88, 0x07, 0x44, 0x8A, 0x02, 0x88, 0x45, 0x8C, 0x83,
+    0x05, 0x44, 0x8A, 0x02, 0x81, 0x8E, 0x46, 0x88, 0x04, 0x44, 0x8A, 0x03, 0x83, 0x8E, 0x46, 0x8D,
+    0x82, 0x02, 0x44, 0x8A, 0x04, 0x81, 0x8A, 0x46, 0x8E, 0x82, 0x01, 0x44, 0x8A, 0x06, 0x84, 0x8D,
+    0x45, 0x8D, 0x01, 0x44, 0x8A, 0x08, 0x88, 0x45, 0x85, 0x00, 0x44, 0x8A, 0x09, 0x87, 0x44, 0x89,
+    0x00, 0x44, 0x8A, 0x09, 0x82, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x01, 0x84, 0x82, 0x05, 0x85, 0x44,
+    0x89, 0x00, 0x44, 0x8A, 0x01, 0x87, 0x40, 0x8B, 0x86, 0x83, 0x81, 0x82, 0x85, 0x8E, 0x44, 0x86,
+    0x00, 0x44, 0x8A, 0x01, 0x87, 0x4C, 0x81, 0x00, 0x44, 0x8A, 0x01, 0x87, 0x4B, 0x86, 0x01, 0x44,
+    0x8A, 0x01, 0x87, 0x49, 0x8E, 0x85, 0x02, 0x44, 0x8A, 0x02, 0x84, 0x89, 0x8C, 0x8E, 0x41, 0x8E,
+    0x8D, 0x8A, 0x86, 0x03, 0x02, 0x85, 0x45, 0x82, 0x0C, 0x85, 0x44, 0x8C, 0x0D, 0x83, 0x8E, 0x43,
+    0x89, 0x0D, 0x81, 0x8C, 0x43, 0x87, 0x0E, 0x89, 0x43, 0x84, 0x0E, 0x85, 0x43, 0x81, 0x31, 0x84,
+    0x88, 0x8B, 0x8E, 0x42, 0x8D, 0x8A, 0x86, 0x06, 0x81, 0x88, 0x4B, 0x86, 0x04, 0x82, 0x4D, 0x88,
+    0x04, 0x8A, 0x4D, 0x83, 0x03, 0x83, 0x41, 0x8E, 0x89, 0x86, 0x93, 0x86, 0x8D, 0x44, 0x8A, 0x04,
+    0x87, 0x84, 0x05, 0x81, 0x8E, 0x43, 0x8E, 0x0D, 0x8A, 0x44, 0x0D, 0x88, 0x44, 0x81, 0x04, 0x84,
+    0x88, 0x8A, 0x8C, 0x8D, 0x8E, 0x47, 0x81, 0x02, 0x87, 0x8E, 0x4D, 0x81, 0x00, 0x81, 0x8C, 0x4F,
+    0x81, 0x00, 0x8A, 0x45, 0x8D, 0x88, 0x86, 0x95, 0x8A, 0x44, 0x91, 0x45, 0x85, 0x04, 0x88, 0x44,
+    0x81, 0x84, 0x44, 0x89, 0x05, 0x89, 0x44, 0x81, 0x86, 0x44, 0x86, 0x05, 0x8D, 0x44, 0x81, 0x85,
+    0x44, 0x89, 0x04, 0x87, 0x45, 0x81, 0x82, 0x45, 0x88, 0x83, 0x82, 0x84, 0x8B, 0x46, 0x81, 0x00,
+    0x8D, 0x50, 0x81, 0x00, 0x85, 0x4A, 0x84, 0x8B, 0x43, 0x81, 0x01, 0x87, 0x47, 0x8E, 0x84, 0x00,
+    0x85, 0x43, 0x81, 0x02, 0x82, 0x89, 0x8D, 0x41, 0x8E, 0x8B, 0x87, 0x81, 0x02, 0x43, 0x81, 0x0A,
+    0x8C, 0x44, 0x8A, 0x0B, 0x88, 0x44, 0x89, 0x0B, 0x85, 0x44, 0x87, 0x0B, 0x82, 0x43, 0x8E, 0x84,
+    0x0B, 0x81, 0x8E, 0x42, 0x8C, 0x82, 0x0C, 0x8B, 0x42, 0x89, 0x34, 0x84, 0x88, 0x8B, 0x8E, 0x42,
+    0x8D, 0x8A, 0x86, 0x06, 0x81, 0x88, 0x4B, 0x86, 0x04, 0x82, 0x4D, 0x88, 0x04, 0x8A, 0x4D, 0x83,
+    0x03, 0x83, 0x41, 0x8E, 0x89, 0x86, 0x93, 0x86, 0x8D, 0x44, 0x8A, 0x04, 0x87, 0x84, 0x05, 0x81,
+    0x8E, 0x43, 0x8E, 0x0D, 0x8A, 0x44, 0x0D, 0x88, 0x44, 0x81, 0x04, 0x84, 0x88, 0x8A, 0x8C, 0x8D,
+    0x8E, 0x47, 0x81, 0x02, 0x87, 0x8E, 0x4D, 0x81, 0x00, 0x81, 0x8C, 0x4F, 0x81, 0x00, 0x8A, 0x45,
+    0x8D, 0x88, 0x86, 0x95, 0x8A, 0x44, 0x91, 0x45, 0x85, 0x04, 0x88, 0x44, 0x81, 0x84, 0x44, 0x89,
+    0x05, 0x89, 0x44, 0x81, 0x86, 0x44, 0x86, 0x05, 0x8D, 0x44, 0x81, 0x85, 0x44, 0x89, 0x04, 0x87,
+    0x45, 0x81, 0x82, 0x45, 0x88, 0x83, 0x82, 0x84, 0x8B, 0x46, 0x81, 0x00, 0x8D, 0x50, 0x81, 0x00,
+    0x85, 0x4A, 0x84, 0x8B, 0x43, 0x81, 0x01, 0x87, 0x47, 0x8E, 0x84, 0x00, 0x85, 0x43, 0x81, 0x02,
+    0x82, 0x89, 0x8D, 0x41, 0x8E, 0x8B, 0x87, 0x81, 0x02, 0x43, 0x81, 0x05, 0x85, 0x45, 0x8E, 0x81,
+    0x09, 0x82, 0x8E, 0x46, 0x8B, 0x09, 0x8D, 0x48, 0x89, 0x07, 0x8B, 0x43, 0x88, 0x82, 0x8D, 0x43,
+    0x87, 0x05, 0x8B, 0x42, 0x8E, 0x85, 0x02, 0x8A, 0x43, 0x86, 0x03, 0x89, 0x42, 0x8B, 0x81, 0x04,
+    0x84, 0x8E, 0x42, 0x84, 0x2D, 0x84, 0x88, 0x8B, 0x8E, 0x42, 0x8D, 0x8A, 0x86, 0x06, 0x81, 0x88,
+    0x4B, 0x86, 0x04, 0x82, 0x4D, 0x88, 0x04, 0x8A, 0x4D, 0x83, 0x03, 0x83, 0x41, 0x8E, 0x89, 0x86,
+    0x93, 0x86, 0x8D, 0x44, 0x8A, 0x04, 0x87, 0x84, 0x05, 0x81, 0x8E, 0x43, 0x8E, 0x0D, 0x8A, 0x44,
+    0x0D, 0x88, 0x44, 0x81, 0x04, 0x84, 0x88, 0x8A, 0x8C, 0x8D, 0x8E, 0x47, 0x81, 0x02, 0x87, 0x8E,
+    0x4D, 0x81, 0x00, 0x81, 0x8C, 0x4F, 0x81, 0x00, 0x8A, 0x45, 0x8D, 0x88, 0x86, 0x95, 0x8A, 0x44,
+    0x91, 0x45, 0x85, 0x04, 0x88, 0x44, 0x81, 0x84, 0x44, 0x89, 0x05, 0x89, 0x44, 0x81, 0x86, 0x44,
+    0x86, 0x05, 0x8D, 0x44, 0x81, 0x85, 0x44, 0x89, 0x04, 0x87, 0x45, 0x81, 0x82, 0x45, 0x88, 0x83,
+    0x82, 0x84, 0x8B, 0x46, 0x81, 0x00, 0x8D, 0x50, 0x81, 0x00, 0x85, 0x4A, 0x84, 0x8B, 0x43, 0x81,
+    0x01, 0x87, 0x47, 0x8E, 0x84, 0x00, 0x85, 0x43, 0x81, 0x02, 0x82, 0x89, 0x8D, 0x41, 0x8E, 0x8B,
+    0x87, 0x81, 0x02, 0x43, 0x81, 0x04, 0x83, 0x8B, 0x41, 0x8A, 0x82, 0x03, 0x88, 0x41, 0x85, 0x04,
+    0x85, 0x45, 0x89, 0x81, 0x00, 0x81, 0x8E, 0x41, 0x82, 0x03, 0x81, 0x48, 0x8C, 0x42, 0x8E, 0x04,
+    0x87, 0x42, 0x8D, 0x8E, 0x47, 0x87, 0x04, 0x8B, 0x41, 0x87, 0x01, 0x85, 0x8E, 0x44, 0x8B, 0x05,
+    0x8E, 0x40, 0x8E, 0x04, 0x87, 0x8D, 0x40, 0x8D, 0x87, 0x30, 0x84, 0x88, 0x8B, 0x8E, 0x42, 0x8D,
+    0x8A, 0x86, 0x06, 0x81, 0x88, 0x4B, 0x86, 0x04, 0x82, 0x4D, 0x88, 0x04, 0x8A, 0x4D, 0x83, 0x03,
+    0x83, 0x41, 0x8E, 0x89, 0x86, 0x93, 0x86, 0x8D, 0x44, 0x8A, 0x04, 0x87, 0x84, 0x05, 0x81, 0x8E,
+    0x43, 0x8E, 0x0D, 0x8A, 0x44, 0x0D, 0x88, 0x44, 0x81, 0x04, 0x84, 0x88, 0x8A, 0x8C, 0x8D, 0x8E,
+    0x47, 0x81, 0x02, 0x87, 0x8E, 0x4D, 0x81, 0x00, 0x81, 0x8C, 0x4F, 0x81, 0x00, 0x8A, 0x45, 0x8D,
+    0x88, 0x86, 0x95, 0x8A, 0x44, 0x91, 0x45, 0x85, 0x04, 0x88, 0x44, 0x81, 0x84, 0x44, 0x89, 0x05,
+    0x89, 0x44, 0x81, 0x86, 0x44, 0x86, 0x05, 0x8D, 0x44, 0x81, 0x85, 0x44, 0x89, 0x04, 0x87, 0x45,
+    0x81, 0x82, 0x45, 0x88, 0x83, 0x82, 0x84, 0x8B, 0x46, 0x81, 0x00, 0x8D, 0x50, 0x81, 0x00, 0x85,
+    0x4A, 0x84, 0x8B, 0x43, 0x81, 0x01, 0x87, 0x47, 0x8E, 0x84, 0x00, 0x85, 0x43, 0x81, 0x02, 0x82,
+    0x89, 0x8D, 0x41, 0x8E, 0x8B, 0x87, 0x81, 0x02, 0x43, 0x81, 0x04, 0x89, 0x8E, 0x8D, 0x86, 0x02,
+    0x84, 0x8C, 0x8E, 0x8B, 0x82, 0x06, 0x87, 0x43, 0x83, 0x01, 0x43, 0x8C, 0x06, 0x8A, 0x43, 0x87,
+    0x00, 0x83, 0x44, 0x06, 0x88, 0x43, 0x84, 0x00, 0x81, 0x43, 0x8C, 0x07, 0x8A, 0x40, 0x8E, 0x87,
+    0x02, 0x85, 0x8D, 0x40, 0x8C, 0x82, 0x3F, 0x03, 0x84, 0x88, 0x8B, 0x8E, 0x42, 0x8D, 0x8A, 0x86,
+    0x06, 0x81, 0x88, 0x4B, 0x86, 0x04, 0x82, 0x4D, 0x88, 0x04, 0x8A, 0x4D, 0x83, 0x03, 0x83, 0x41,
+    0x8E, 0x89, 0x86, 0x93, 0x86, 0x8D, 0x44, 0x8A, 0x04, 0x87, 0x84, 0x05, 0x81, 0x8E, 0x43, 0x8E,
+    0x0D, 0x8A, 0x44, 0x0D, 0x88, 0x44, 0x81, 0x04, 0x84, 0x88, 0x8A, 0x8C, 0x8D, 0x8E, 0x47, 0x81,
+    0x02, 0x87, 0x8E, 0x4D, 0x81, 0x00, 0x81, 0x8C, 0x4F, 0x81, 0x00, 0x8A, 0x45, 0x8D, 0x88, 0x86,
+    0x95, 0x8A, 0x44, 0x91, 0x45, 0x85, 0x04, 0x88, 0x44, 0x81, 0x84, 0x44, 0x89, 0x05, 0x89, 0x44,
+    0x81, 0x86, 0x44, 0x86, 0x05, 0x8D, 0x44, 0x81, 0x85, 0x44, 0x89, 0x04, 0x87, 0x45, 0x81, 0x82,
+    0x45, 0x88, 0x83, 0x82, 0x84, 0x8B, 0x46, 0x81, 0x00, 0x8D, 0x50, 0x81, 0x00, 0x85, 0x4A, 0x84,
+    0x8B, 0x43, 0x81, 0x01, 0x87, 0x47, 0x8E, 0x84, 0x00, 0x85, 0x43, 0x81, 0x02, 0x82, 0x89, 0x8D,
+    0x41, 0x8E, 0x8B, 0x87, 0x81, 0x02, 0x43, 0x81, 0x07, 0x88, 0x8D, 0x40, 0x8E, 0x8A, 0x82, 0x0C,
+    0x8D, 0x45, 0x84, 0x0A, 0x88, 0x41, 0x8E, 0x8A, 0x8D, 0x41, 0x8E, 0x0A, 0x8D, 0x41, 0x82, 0x01,
+    0x8C, 0x41, 0x84, 0x09, 0x8E, 0x40, 0x8E, 0x02, 0x89, 0x41, 0x85, 0x09, 0x8D, 0x41, 0x82, 0x01,
+    0x8D, 0x41, 0x84, 0x09, 0x88, 0x41, 0x8E, 0x8A, 0x8D, 0x41, 0x8E, 0x0A, 0x81, 0x8D, 0x45, 0x84,
+    0x0B, 0x81, 0x88, 0x8D, 0x40, 0x8E, 0x8A, 0x83, 0x32, 0x84, 0x88, 0x8B, 0x8E, 0x42, 0x8D, 0x8A,
+    0x86, 0x06, 0x81, 0x88, 0x4B, 0x86, 0x04, 0x82, 0x4D, 0x88, 0x04, 0x8A, 0x4D, 0x83, 0x03, 0x83,
+    0x41, 0x8E, 0x89, 0x86, 0x93, 0x86, 0x8D, 0x44, 0x8A, 0x04, 0x87, 0x84, 0x05, 0x81, 0x8E, 0x43,
+    0x8E, 0x0D, 0x8A, 0x44, 0x0D, 0x88, 0x44, 0x81, 0x04, 0x84, 0x88, 0x8A, 0x8C, 0x8D, 0x8E, 0x47,
+    0x81, 0x02, 0x87, 0x8E, 0x4D, 0x81, 0x00, 0x81, 0x8C, 0x4F, 0x81, 0x00, 0x8A, 0x45, 0x8D, 0x88,
+    0x86, 0x95, 0x8A, 0x44, 0x91, 0x45, 0x85, 0x04, 0x88, 0x44, 0x81, 0x84, 0x44, 0x89, 0x05, 0x89,
+    0x44, 0x81, 0x86, 0x44, 0x86, 0x05, 0x8D, 0x44, 0x81, 0x85, 0x44, 0x89, 0x04, 0x87, 0x45, 0x81,
+    0x82, 0x45, 0x88, 0x83, 0x82, 0x84, 0x8B, 0x46, 0x81, 0x00, 0x8D, 0x50, 0x81, 0x00, 0x85, 0x4A,
+    0x84, 0x8B, 0x43, 0x81, 0x01, 0x87, 0x47, 0x8E, 0x84, 0x00, 0x85, 0x43, 0x81, 0x02, 0x82, 0x89,
+    0x8D, 0x41, 0x8E, 0x8B, 0x87, 0x81, 0x02, 0x43, 0x81, 0x04, 0x84, 0x89, 0x8C, 0x8E, 0x41, 0x8E,
+    0x8C, 0x88, 0x83, 0x03, 0x85, 0x8A, 0x8D, 0x8E, 0x40, 0x8E, 0x8C, 0x88, 0x82, 0x06, 0x81, 0x89,
+    0x4A, 0x8A, 0x00, 0x84, 0x8E, 0x48, 0x89, 0x05, 0x82, 0x4C, 0x8D, 0x4B, 0x8C, 0x05, 0x8A, 0x59,
+    0x8A, 0x04, 0x82, 0x41, 0x8C, 0x88, 0x85, 0x93, 0x86, 0x8E, 0x46, 0x8D, 0x85, 0x82, 0x00, 0x83,
+    0x8C, 0x44, 0x83, 0x04, 0x86, 0x82, 0x05, 0x82, 0x45, 0x8C, 0x05, 0x8D, 0x43, 0x8A, 0x0D, 0x8E,
+    0x44, 0x84, 0x05, 0x85, 0x43, 0x8E, 0x0D, 0x8E, 0x44, 0x06, 0x83, 0x44, 0x81, 0x04, 0x85, 0x88,
+    0x8B, 0x8C, 0x9E, 0x54, 0x82, 0x02, 0x88, 0x5B, 0x83, 0x00, 0x81, 0x8D, 0x5C, 0x83, 0x00, 0x8A,
+    0x45, 0x8C, 0x88, 0x86, 0x95, 0x8E, 0x44, 0xFC, 0xCC, 0x82, 0x81, 0x45, 0x84, 0x04, 0x8E, 0x43,
+    0x8E, 0x0D, 0x84, 0x44, 0x89, 0x05, 0x45, 0x81, 0x0C, 0x86, 0x44, 0x86, 0x04, 0x83, 0x45, 0x88,
+    0x0C, 0x85, 0x44, 0x89, 0x04, 0x8C, 0x46, 0x85, 0x07, 0x83, 0x89, 0x01, 0x82, 0x45, 0x87, 0x83,
+    0x82, 0x85, 0x8D, 0x48, 0x8B, 0x86, 0x84, 0x83, 0x84, 0x87, 0x89, 0x8E, 0x41, 0x02, 0x8D, 0x4C,
+    0x88, 0x4E, 0x02, 0x84, 0x4B, 0x86, 0x00, 0x84, 0x4D, 0x03, 0x85, 0x48, 0x8E, 0x84, 0x02, 0x82,
+    0x8C, 0x4A, 0x8C, 0x04, 0x81, 0x88, 0x8D, 0x42, 0x8D, 0x8A, 0x85, 0x06, 0x83, 0x88, 0x8C, 0x8E,
+    0x41, 0x8E, 0x8D, 0x8B, 0x87, 0x82, 0x02, 0x05, 0x84, 0x88, 0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x89,
+    0x84, 0x05, 0x83, 0x8C, 0x49, 0x8E, 0x82, 0x02, 0x86, 0x4B, 0x8E, 0x02, 0x84, 0x4C, 0x88, 0x02,
+    0x8E, 0x45, 0x8C, 0x99, 0x8C, 0x42, 0x82, 0x01, 0x86, 0x44, 0x8E, 0x83, 0x04, 0x85, 0x88, 0x02,
+    0x8B, 0x44, 0x85, 0x0A, 0x44, 0x8E, 0x0A, 0x82, 0x44, 0x8A, 0x0A, 0x83, 0x44, 0x88, 0x0A, 0x84,
+    0x44, 0x87, 0x0A, 0x83, 0x44, 0x88, 0x0A, 0x82, 0x44, 0x8A, 0x0B, 0x44, 0x8E, 0x0B, 0x8D, 0x44,
+    0x85, 0x07, 0x81, 0x01, 0x88, 0x44, 0x8E, 0x83, 0x04, 0x83, 0x8A, 0x8B, 0x01, 0x82, 0x46, 0x8C,
+    0x99, 0x8B, 0x8E, 0x41, 0x8B, 0x02, 0x88, 0x4C, 0x8B, 0x03, 0x8B, 0x4B, 0x8B, 0x04, 0x88, 0x4A,
+    0x87, 0x05, 0x81, 0x86, 0x8B, 0x8D, 0x42, 0x8E, 0x8B, 0x87, 0x81, 0x08, 0x86, 0x42, 0x84, 0x0C,
+    0x8E, 0x42, 0x81, 0x0B, 0x85, 0x43, 0x8C, 0x84, 0x0C, 0x87, 0x43, 0x85, 0x0C, 0x89, 0x42, 0x8D,
+    0x08, 0x83, 0x84, 0x92, 0x8C, 0x42, 0x8E, 0x08, 0x88, 0x46, 0x8B, 0x08, 0x88, 0x46, 0x82, 0x08,
+    0x85, 0x8D, 0x42, 0x8C, 0x88, 0x81, 0x04, 0x02, 0x84, 0x45, 0x83, 0x0C, 0x84, 0x44, 0x8E, 0x81,
+    0x0C, 0x82, 0x8D, 0x43, 0x8B, 0x0D, 0x81, 0x8B, 0x43, 0x88, 0x0E, 0x88, 0x43, 0x86, 0x0E, 0x84,
+    0x8E, 0x42, 0x82, 0x32, 0x84, 0x89, 0x8D, 0x8E, 0x40, 0x8E, 0x8D, 0x89, 0x85, 0x08, 0x83, 0x8D,
+    0x48, 0x8D, 0x84, 0x05, 0x85, 0x4C, 0x86, 0x03, 0x83, 0x4E, 0x83, 0x02, 0x8E, 0x44, 0x88, 0x82,
+    0x00, 0x82, 0x87, 0x44, 0x8C, 0x01, 0x85, 0x44, 0x87, 0x04, 0x83, 0x44, 0x83, 0x00, 0x8B, 0x43,
+    0x8E, 0x06, 0x8B, 0x43, 0x88, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x43, 0x8A, 0x82, 0x51, 0x8C, 0x83,
+    0x51, 0x8C, 0x84, 0x51, 0x8D, 0x83, 0x44, 0x8D, 0xFC, 0xBC, 0x89, 0x82, 0x44, 0x88, 0x0D, 0x44,
+    0x8B, 0x0D, 0x8B, 0x44, 0x82, 0x0C, 0x85, 0x44, 0x8D, 0x81, 0x07, 0x85, 0x87, 0x02, 0x8D, 0x45,
+    0x89, 0x85, 0x83, 0x84, 0x85, 0x87, 0x8B, 0x41, 0x8A, 0x02, 0x83, 0x4E, 0x8A, 0x03, 0x84, 0x8E,
+    0x4C, 0x8A, 0x04, 0x81, 0x8A, 0x4B, 0x87, 0x06, 0x82, 0x87, 0x8B, 0x8D, 0x42, 0x8E, 0x8C, 0x89,
+    0x85, 0x81, 0x01, 0x0A, 0x8B, 0x44, 0x8C, 0x0B, 0x86, 0x44, 0x8B, 0x0B, 0x83, 0x44, 0x88, 0x0B,
+    0x81, 0x8E, 0x43, 0x85, 0x0C, 0x8C, 0x42, 0x8D, 0x83, 0x0C, 0x89, 0x42, 0x8A, 0x81, 0x34, 0x84,
+    0x89, 0x8D, 0x8E, 0x40, 0x8E, 0x8D, 0x89, 0x85, 0x08, 0x83, 0x8D, 0x48, 0x8D, 0x84, 0x05, 0x85,
+    0x4C, 0x86, 0x03, 0x83, 0x4E, 0x83, 0x02, 0x8E, 0x44, 0x88, 0x82, 0x00, 0x82, 0x87, 0x44, 0x8C,
+    0x01, 0x85, 0x44, 0x87, 0x04, 0x83, 0x44, 0x83, 0x00, 0x8B, 0x43, 0x8E, 0x06, 0x8B, 0x43, 0x88,
+    0x00, 0x44, 0x8A, 0x06, 0x88, 0x43, 0x8A, 0x82, 0x51, 0x8C, 0x83, 0x51, 0x8C, 0x84, 0x51, 0x8D,
+    0x83, 0x44, 0x8D, 0xFC, 0xBC, 0x89, 0x82, 0x44, 0x88, 0x0D, 0x44, 0x8B, 0x0D, 0x8B, 0x44, 0x82,
+    0x0C, 0x85, 0x44, 0x8D, 0x81, 0x07, 0x85, 0x87, 0x02, 0x8D, 0x45, 0x89, 0x85, 0x83, 0x84, 0x85,
+    0x87, 0x8B, 0x41, 0x8A, 0x02, 0x83, 0x4E, 0x8A, 0x03, 0x84, 0x8E, 0x4C, 0x8A, 0x04, 0x81, 0x8A,
+    0x4B, 0x87, 0x06, 0x82, 0x87, 0x8B, 0x8D, 0x42, 0x8E, 0x8C, 0x89, 0x85, 0x81, 0x01, 0x05, 0x81,
+    0x8E, 0x45, 0x85, 0x0A, 0x8B, 0x46, 0x8E, 0x82, 0x08, 0x88, 0x48, 0x8D, 0x81, 0x06, 0x87, 0x43,
+    0x8C, 0x81, 0x89, 0x43, 0x8C, 0x05, 0x86, 0x43, 0x89, 0x02, 0x86, 0x43, 0x8B, 0x03, 0x84, 0x42,
+    0x8E, 0x84, 0x04, 0x82, 0x8B, 0x42, 0x89, 0x2E, 0x84, 0x89, 0x8D, 0x8E, 0x40, 0x8E, 0x8D, 0x89,
+    0x85, 0x08, 0x83, 0x8D, 0x48, 0x8D, 0x84, 0x05, 0x85, 0x4C, 0x86, 0x03, 0x83, 0x4E, 0x83, 0x02,
+    0x8E, 0x44, 0x88, 0x82, 0x00, 0x82, 0x87, 0x44, 0x8C, 0x01, 0x85, 0x44, 0x87, 0x04, 0x83, 0x44,
+    0x83, 0x00, 0x8B, 0x43, 0x8E, 0x06, 0x8B, 0x43, 0x88, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x43, 0x8A,
+    0x82, 0x51, 0x8C, 0x83, 0x51, 0x8C, 0x84, 0x51, 0x8D, 0x83, 0x44, 0x8D, 0xFC, 0xBC, 0x89, 0x82,
+    0x44, 0x88, 0x0D, 0x44, 0x8B, 0x0D, 0x8B, 0x44, 0x82, 0x0C, 0x85, 0x44, 0x8D, 0x81, 0x07, 0x85,
+    0x87, 0x02, 0x8D, 0x45, 0x89, 0x85, 0x83, 0x84, 0x85, 0x87, 0x8B, 0x41, 0x8A, 0x02, 0x83, 0x4E,
+    0x8A, 0x03, 0x84, 0x8E, 0x4C, 0x8A, 0x04, 0x81, 0x8A, 0x4B, 0x87, 0x06, 0x82, 0x87, 0x8B, 0x8D,
+    0x42, 0x8E, 0x8C, 0x89, 0x85, 0x81, 0x01, 0x04, 0x87, 0x9E, 0x89, 0x02, 0x82, 0x8B, 0x8E, 0x8C,
+    0x84, 0x06, 0x84, 0x43, 0x87, 0x01, 0x8C, 0x43, 0x06, 0x87, 0x43, 0x8A, 0x01, 0x44, 0x83, 0x05,
+    0x84, 0x43, 0x87, 0x01, 0x8D, 0x43, 0x07, 0x88, 0x9E, 0x8A, 0x02, 0x82, 0x8C, 0x40, 0x8D, 0x84,
+    0x3F, 0x04, 0x84, 0x89, 0x8D, 0x8E, 0x40, 0x8E, 0x8D, 0x89, 0x85, 0x08, 0x83, 0x8D, 0x48, 0x8D,
+    0x84, 0x05, 0x85, 0x4C, 0x86, 0x03, 0x83, 0x4E, 0x83, 0x02, 0x8E, 0x44, 0x88, 0x82, 0x00, 0x82,
+    0x87, 0x44, 0x8C, 0x01, 0x85, 0x44, 0x87, 0x04, 0x83, 0x44, 0x83, 0x00, 0x8B, 0x43, 0x8E, 0x06,
+    0x8B, 0x43, 0x88, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x43, 0x8A, 0x82, 0x51, 0x8C, 0x83, 0x51, 0x8C,
+    0x84, 0x51, 0x8D, 0x83, 0x44, 0x8D, 0xFC, 0xBC, 0x89, 0x82, 0x44, 0x88, 0x0D, 0x44, 0x8B, 0x0D,
+    0x8B, 0x44, 0x82, 0x0C, 0x85, 0x44, 0x8D, 0x81, 0x07, 0x85, 0x87, 0x02, 0x8D, 0x45, 0x89, 0x85,
+    0x83, 0x84, 0x85, 0x87, 0x8B, 0x41, 0x8A, 0x02, 0x83, 0x4E, 0x8A, 0x03, 0x84, 0x8E, 0x4C, 0x8A,
+    0x04, 0x81, 0x8A, 0x4B, 0x87, 0x06, 0x82, 0x87, 0x8B, 0x8D, 0x42, 0x8E, 0x8C, 0x89, 0x85, 0x81,
+    0x01, 0x8A, 0x44, 0x8C, 0x04, 0x89, 0x44, 0x88, 0x04, 0x87, 0x44, 0x85, 0x04, 0x84, 0x8E, 0x43,
+    0x82, 0x04, 0x82, 0x8C, 0x42, 0x8E, 0x81, 0x05, 0x89, 0x42, 0x8B, 0x1A, 0x44, 0x8A, 0x04, 0x44,
+    0x8A, 0x04, 0x44, 0x8A, 0x04, 0x44, 0x8A, 0x04, 0x44, 0x8A, 0x04, 0x44, 0x8A, 0x04, 0x44, 0x8A,
+    0x04, 0x44, 0x8A, 0x04, 0x44, 0x8A, 0x04, 0x44, 0x8A, 0x04, 0x44, 0x8A, 0x04, 0x44, 0x8A, 0x04,
+    0x44, 0x8A, 0x04, 0x44, 0x8A, 0x04, 0x44, 0x8A, 0x04, 0x44, 0x8A, 0x04, 0x44, 0x8A, 0x04, 0x44,
+    0x8A, 0x04, 0x44, 0x8A, 0x04, 0x44, 0x8A, 0x04, 0x44, 0x8A, 0x03, 0x84, 0x45, 0x83, 0x02, 0x81,
+    0x8E, 0x43, 0x8E, 0x83, 0x03, 0x8C, 0x43, 0x8D, 0x82, 0x03, 0x89, 0x43, 0x8A, 0x04, 0x87, 0x43,
+    0x87, 0x04, 0x83, 0x42, 0x8E, 0x83, 0x1E, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05,
+    0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44,
+    0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A,
+    0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05,
+    0x44, 0x8A, 0x05, 0x44, 0x8A, 0x04, 0x04, 0x8D, 0x45, 0x87, 0x07, 0x89, 0x47, 0x83, 0x05, 0x86,
+    0x48, 0x8E, 0x82, 0x03, 0x85, 0x43, 0x8D, 0x82, 0x88, 0x43, 0x8D, 0x81, 0x01, 0x84, 0x43, 0x8A,
+    0x02, 0x85, 0x8E, 0x42, 0x8C, 0x81, 0x82, 0x42, 0x8E, 0x85, 0x04, 0x81, 0x8A, 0x42, 0x8B, 0x27,
+    0x44, 0x8A, 0x0A, 0x44, 0x8A, 0x0A, 0x44, 0x8A, 0x0A, 0x44, 0x8A, 0x0A, 0x44, 0x8A, 0x0A, 0x44,
+    0x8A, 0x0A, 0x44, 0x8A, 0x0A, 0x44, 0x8A, 0x0A, 0x44, 0x8A, 0x0A, 0x44, 0x8A, 0x0A, 0x44, 0x8A,
+    0x0A, 0x44, 0x8A, 0x0A, 0x44, 0x8A, 0x0A, 0x44, 0x8A, 0x0A, 0x44, 0x8A, 0x0A, 0x44, 0x8A, 0x0A,
+    0x44, 0x8A, 0x0A, 0x44, 0x8A, 0x0A, 0x44, 0x8A, 0x0A, 0x44, 0x8A, 0x0A, 0x44, 0x8A, 0x04, 0x00,
+    0x88, 0x9E, 0x88, 0x02, 0x82, 0x8C, 0x8E, 0x8C, 0x83, 0x00, 0x85, 0x43, 0x86, 0x01, 0x8D, 0x42,
+    0x8E, 0x00, 0x88, 0x43, 0x89, 0x01, 0x44, 0x82, 0x85, 0x43, 0x86, 0x01, 0x8D, 0x42, 0x8E, 0x01,
+    0x88, 0x9E, 0x89, 0x02, 0x83, 0x8C, 0x40, 0x8D, 0x84, 0x2E, 0x44, 0x8A, 0x07, 0x44, 0x8A, 0x07,
+    0x44, 0x8A, 0x07, 0x44, 0x8A, 0x07, 0x44, 0x8A, 0x07, 0x44, 0x8A, 0x07, 0x44, 0x8A, 0x07, 0x44,
+    0x8A, 0x07, 0x44, 0x8A, 0x07, 0x44, 0x8A, 0x07, 0x44, 0x8A, 0x07, 0x44, 0x8A, 0x07, 0x44, 0x8A,
+    0x07, 0x44, 0x8A, 0x07, 0x44, 0x8A, 0x07, 0x44, 0x8A, 0x07, 0x44, 0x8A, 0x07, 0x44, 0x8A, 0x07,
+    0x44, 0x8A, 0x07, 0x44, 0x8A, 0x07, 0x44, 0x8A, 0x03, 0x06, 0x8B, 0x87, 0x05, 0x84, 0x89, 0x09,
+    0x85, 0x41, 0x8E, 0x86, 0x01, 0x81, 0x8A, 0x41, 0x86, 0x08, 0x8E, 0x43, 0x8C, 0x87, 0x43, 0x8E,
+    0x81, 0x06, 0x81, 0x8C, 0x49, 0x87, 0x09, 0x86, 0x46, 0x8C, 0x82, 0x0A, 0x85, 0x8E, 0x45, 0x8B,
+    0x09, 0x82, 0x8B, 0x48, 0x8A, 0x08, 0x88, 0x43, 0x8D, 0x89, 0x44, 0x87, 0x08, 0x8D, 0x41, 0x87,
+    0x01, 0x8A, 0x44, 0x82, 0x07, 0x84, 0x8B, 0x82, 0x03, 0x8D, 0x43, 0x8B, 0x0E, 0x83, 0x44, 0x83,
+    0x05, 0x82, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x89, 0x83, 0x8A, 0x43, 0x8A, 0x04, 0x8A, 0x48, 0x8A,
+    0x44, 0x02, 0x81, 0x8D, 0x4F, 0x84, 0x01, 0x8B, 0x50, 0x87, 0x00, 0x85, 0x45, 0x8A, 0x84, 0x93,
+    0x87, 0x8E, 0x45, 0x8A, 0x00, 0x8B, 0x44, 0x86, 0x04, 0x81, 0x8D, 0x44, 0x8B, 0x00, 0x44, 0x8D,
+    0x06, 0x85, 0x44, 0x8C, 0x82, 0x44, 0x89, 0x07, 0x44, 0x8C, 0x84, 0x44, 0x88, 0x07, 0x44, 0x8B,
+    0x84, 0x44, 0x88, 0x07, 0x44, 0x8A, 0x82, 0x44, 0x8A, 0x06, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8E,
+    0x06, 0x87, 0x44, 0x83, 0x00, 0x8A, 0x44, 0x88, 0x04, 0x81, 0x8E, 0x43, 0x8D, 0x01, 0x83, 0x45,
+    0x8B, 0x85, 0x93, 0x87, 0x8E, 0x44, 0x85, 0x02, 0x88, 0x4E, 0x8A, 0x04, 0x89, 0x4C, 0x8B, 0x06,
+    0x85, 0x8E, 0x49, 0x87, 0x09, 0x85, 0x89, 0x8D, 0x8E, 0x41, 0x8D, 0x8A, 0x86, 0x81, 0x04, 0x04,
+    0x85, 0x8C, 0x40, 0x8E, 0x88, 0x81, 0x03, 0x8C, 0x41, 0x81, 0x05, 0x88, 0x45, 0x87, 0x01, 0x84,
+    0x41, 0x8E, 0x05, 0x84, 0x48, 0x8C, 0x42, 0x8A, 0x05, 0x8B, 0x42, 0x8C, 0x48, 0x83, 0x05, 0x42,
+    0x83, 0x01, 0x88, 0x45, 0x87, 0x05, 0x82, 0x41, 0x8B, 0x03, 0x81, 0x89, 0x8E, 0x40, 0x8C, 0x85,
+    0x2F, 0x43, 0x86, 0x02, 0x86, 0x8B, 0x8E, 0x41, 0x8D, 0x89, 0x83, 0x04, 0x43, 0x8A, 0x00, 0x84,
+    0x8D, 0x47, 0x8A, 0x03, 0x43, 0x8E, 0x83, 0x4A, 0x8A, 0x02, 0x51, 0x84, 0x01, 0x47, 0x8C, 0x99,
+    0x8C, 0x45, 0x8A, 0x01, 0x46, 0x84, 0x03, 0x88, 0x44, 0x8E, 0x01, 0x45, 0x87, 0x05, 0x8E, 0x44,
+    0x01, 0x45, 0x81, 0x05, 0x8A, 0x44, 0x81, 0x00, 0x44, 0x8D, 0x06, 0x89, 0x44, 0x82, 0x00, 0x44,
+    0x8B, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06,
+    0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44,
+    0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00,
+    0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A,
+    0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88,
+    0x44, 0x82, 0x02, 0x86, 0x45, 0x82, 0x0D, 0x86, 0x44, 0x8C, 0x0E, 0x83, 0x8E, 0x43, 0x89, 0x0E,
+    0x82, 0x8C, 0x43, 0x86, 0x0F, 0x8A, 0x43, 0x84, 0x0F, 0x86, 0x42, 0x8E, 0x36, 0x84, 0x88, 0x8C,
+    0x8E, 0x41, 0x8D, 0x8B, 0x86, 0x09, 0x83, 0x8C, 0x49, 0x87, 0x06, 0x85, 0x4C, 0x8B, 0x04, 0x83,
+    0x4E, 0x8A, 0x03, 0x8D, 0x45, 0x8B, 0x89, 0x8A, 0x8D, 0x45, 0x85, 0x01, 0x85, 0x44, 0x8D, 0x82,
+    0x03, 0x88, 0x44, 0x8D, 0x01, 0x8B, 0x44, 0x83, 0x05, 0x8B, 0x44, 0x83, 0x00, 0x44, 0x8D, 0x06,
+    0x85, 0x44, 0x88, 0x82, 0x44, 0x8A, 0x06, 0x82, 0x44, 0x8A, 0x83, 0x44, 0x88, 0x07, 0x44, 0x8C,
+    0x84, 0x44, 0x87, 0x07, 0x44, 0x8C, 0x84, 0x44, 0x88, 0x07, 0x44, 0x8C, 0x82, 0x44, 0x8A, 0x06,
+    0x82, 0x44, 0x8A, 0x00, 0x44, 0x8D, 0x06, 0x85, 0x44, 0x87, 0x00, 0x8B, 0x44, 0x84, 0x05, 0x8B,
+    0x44, 0x84, 0x00, 0x85, 0x44, 0x8E, 0x82, 0x03, 0x87, 0x44, 0x8D, 0x02, 0x8C, 0x45, 0x8B, 0x99,
+    0x8D, 0x45, 0x86, 0x02, 0x82, 0x4E, 0x8B, 0x04, 0x84, 0x4C, 0x8B, 0x81, 0x05, 0x82, 0x8B, 0x49,
+    0x88, 0x09, 0x83, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x8B, 0x86, 0x81, 0x04, 0x0A, 0x85, 0x45, 0x83,
+    0x0B, 0x81, 0x8E, 0x43, 0x8E, 0x83, 0x0C, 0x8C, 0x43, 0x8C, 0x81, 0x0C, 0x8A, 0x43, 0x8A, 0x0D,
+    0x87, 0x43, 0x87, 0x0D, 0x83, 0x42, 0x8E, 0x83, 0x37, 0x84, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x8B,
+    0x86, 0x09, 0x83, 0x8C, 0x49, 0x87, 0x06, 0x85, 0x4C, 0x8B, 0x04, 0x83, 0x4E, 0x8A, 0x03, 0x8D,
+    0x45, 0x8B, 0x89, 0x8A, 0x8D, 0x45, 0x85, 0x01, 0x85, 0x44, 0x8D, 0x82, 0x03, 0x88, 0x44, 0x8D,
+    0x01, 0x8B, 0x44, 0x83, 0x05, 0x8B, 0x44, 0x83, 0x00, 0x44, 0x8D, 0x06, 0x85, 0x44, 0x88, 0x82,
+    0x44, 0x8A, 0x06, 0x82, 0x44, 0x8A, 0x83, 0x44, 0x88, 0x07, 0x44, 0x8C, 0x84, 0x44, 0x87, 0x07,
+    0x44, 0x8C, 0x84, 0x44, 0x88, 0x07, 0x44, 0x8C, 0x82, 0x44, 0x8A, 0x06, 0x82, 0x44, 0x8A, 0x00,
+    0x44, 0x8D, 0x06, 0x85, 0x44, 0x87, 0x00, 0x8B, 0x44, 0x84, 0x05, 0x8B, 0x44, 0x84, 0x00, 0x85,
+    0x44, 0x8E, 0x82, 0x03, 0x87, 0x44, 0x8D, 0x02, 0x8C, 0x45, 0x8B, 0x99, 0x8D, 0x45, 0x86, 0x02,
+    0x82, 0x4E, 0x8B, 0x04, 0x84, 0x4C, 0x8B, 0x81, 0x05, 0x82, 0x8B, 0x49, 0x88, 0x09, 0x83, 0x88,
+    0x8C, 0x8E, 0x41, 0x8D, 0x8B, 0x86, 0x81, 0x04, 0x06, 0x8D, 0x45, 0x86, 0x0B, 0x8A, 0x47, 0x82,
+    0x09, 0x87, 0x48, 0x8E, 0x81, 0x07, 0x86, 0x43, 0x8D, 0x81, 0x88, 0x43, 0x8C, 0x06, 0x85, 0x43,
+    0x8A, 0x02, 0x85, 0x43, 0x8C, 0x04, 0x83, 0x42, 0x8E, 0x85, 0x04, 0x81, 0x8A, 0x42, 0x8A, 0x31,
+    0x84, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x8B, 0x86, 0x09, 0x83, 0x8C, 0x49, 0x87, 0x06, 0x85, 0x4C,
+    0x8B, 0x04, 0x83, 0x4E, 0x8A, 0x03, 0x8D, 0x45, 0x8B, 0x89, 0x8A, 0x8D, 0x45, 0x85, 0x01, 0x85,
+    0x44, 0x8D, 0x82, 0x03, 0x88, 0x44, 0x8D, 0x01, 0x8B, 0x44, 0x83, 0x05, 0x8B, 0x44, 0x83, 0x00,
+    0x44, 0x8D, 0x06, 0x85, 0x44, 0x88, 0x82, 0x44, 0x8A, 0x06, 0x82, 0x44, 0x8A, 0x83, 0x44, 0x88,
+    0x07, 0x44, 0x8C, 0x84, 0x44, 0x87, 0x07, 0x44, 0x8C, 0x84, 0x44, 0x88, 0x07, 0x44, 0x8C, 0x82,
+    0x44, 0x8A, 0x06, 0x82, 0x44, 0x8A, 0x00, 0x44, 0x8D, 0x06, 0x85, 0x44, 0x87, 0x00, 0x8B, 0x44,
+    0x84, 0x05, 0x8B, 0x44, 0x84, 0x00, 0x85, 0x44, 0x8E, 0x82, 0x03, 0x87, 0x44, 0x8D, 0x02, 0x8C,
+    0x45, 0x8B, 0x99, 0x8D, 0x45, 0x86, 0x02, 0x82, 0x4E, 0x8B, 0x04, 0x84, 0x4C, 0x8B, 0x81, 0x05,
+    0x82, 0x8B, 0x49, 0x88, 0x09, 0x83, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x8B, 0x86, 0x81, 0x04, 0x04,
+    0x83, 0x8B, 0x41, 0x8A, 0x82, 0x03, 0x87, 0x41, 0x85, 0x05, 0x84, 0x45, 0x89, 0x81, 0x00, 0x81,
+    0x8E, 0x41, 0x83, 0x04, 0x81, 0x8E, 0x47, 0x8C, 0x42, 0x8E, 0x05, 0x86, 0x42, 0x8D, 0x8E, 0x47,
+    0x87, 0x05, 0x8B, 0x41, 0x88, 0x01, 0x85, 0x8D, 0x44, 0x8B, 0x06, 0x8D, 0x41, 0x04, 0x87, 0x8D,
+    0x40, 0x8D, 0x87, 0x34, 0x84, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x8B, 0x86, 0x09, 0x83, 0x8C, 0x49,
+    0x87, 0x06, 0x85, 0x4C, 0x8B, 0x04, 0x83, 0x4E, 0x8A, 0x03, 0x8D, 0x45, 0x8B, 0x89, 0x8A, 0x8D,
+    0x45, 0x85, 0x01, 0x85, 0x44, 0x8D, 0x82, 0x03, 0x88, 0x44, 0x8D, 0x01, 0x8B, 0x44, 0x83, 0x05,
+    0x8B, 0x44, 0x83, 0x00, 0x44, 0x8D, 0x06, 0x85, 0x44, 0x88, 0x82, 0x44, 0x8A, 0x06, 0x82, 0x44,
+    0x8A, 0x83, 0x44, 0x88, 0x07, 0x44, 0x8C, 0x84, 0x44, 0x87, 0x07, 0x44, 0x8C, 0x84, 0x44, 0x88,
+    0x07, 0x44, 0x8C, 0x82, 0x44, 0x8A, 0x06, 0x82, 0x44, 0x8A, 0x00, 0x44, 0x8D, 0x06, 0x85, 0x44,
+    0x87, 0x00, 0x8B, 0x44, 0x84, 0x05, 0x8B, 0x44, 0x84, 0x00, 0x85, 0x44, 0x8E, 0x82, 0x03, 0x87,
+    0x44, 0x8D, 0x02, 0x8C, 0x45, 0x8B, 0x99, 0x8D, 0x45, 0x86, 0x02, 0x82, 0x4E, 0x8B, 0x04, 0x84,
+    0x4C, 0x8B, 0x81, 0x05, 0x82, 0x8B, 0x49, 0x88, 0x09, 0x83, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x8B,
+    0x86, 0x81, 0x04, 0x04, 0x88, 0x9E, 0x88, 0x02, 0x83, 0x8C, 0x8E, 0x8C, 0x83, 0x07, 0x86, 0x43,
+    0x85, 0x01, 0x8E, 0x42, 0x8E, 0x07, 0x89, 0x43, 0x88, 0x00, 0x81, 0x44, 0x81, 0x06, 0x86, 0x43,
+    0x85, 0x01, 0x8E, 0x42, 0x8E, 0x08, 0x89, 0x9E, 0x88, 0x02, 0x84, 0x8D, 0x40, 0x8C, 0x83, 0x3F,
+    0x08, 0x84, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x8B, 0x86, 0x09, 0x83, 0x8C, 0x49, 0x87, 0x06, 0x85,
+    0x4C, 0x8B, 0x04, 0x83, 0x4E, 0x8A, 0x03, 0x8D, 0x45, 0x8B, 0x89, 0x8A, 0x8D, 0x45, 0x85, 0x01,
+    0x85, 0x44, 0x8D, 0x82, 0x03, 0x88, 0x44, 0x8D, 0x01, 0x8B, 0x44, 0x83, 0x05, 0x8B, 0x44, 0x83,
+    0x00, 0x44, 0x8D, 0x06, 0x85, 0x44, 0x88, 0x82, 0x44, 0x8A, 0x06, 0x82, 0x44, 0x8A, 0x83, 0x44,
+    0x88, 0x07, 0x44, 0x8C, 0x84, 0x44, 0x87, 0x07, 0x44, 0x8C, 0x84, 0x44, 0x88, 0x07, 0x44, 0x8C,
+    0x82, 0x44, 0x8A, 0x06, 0x82, 0x44, 0x8A, 0x00, 0x44, 0x8D, 0x06, 0x85, 0x44, 0x87, 0x00, 0x8B,
+    0x44, 0x84, 0x05, 0x8B, 0x44, 0x84, 0x00, 0x85, 0x44, 0x8E, 0x82, 0x03, 0x87, 0x44, 0x8D, 0x02,
+    0x8C, 0x45, 0x8B, 0x99, 0x8D, 0x45, 0x86, 0x02, 0x82, 0x4E, 0x8B, 0x04, 0x84, 0x4C, 0x8B, 0x81,
+    0x05, 0x82, 0x8B, 0x49, 0x88, 0x09, 0x83, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x8B, 0x86, 0x81, 0x04,
+    0x07, 0x8A, 0x40, 0x8E, 0x86, 0x0E, 0x88, 0x43, 0x82, 0x0D, 0x8B, 0x43, 0x85, 0x0D, 0x8A, 0x43,
+    0x85, 0x0D, 0x84, 0x42, 0x8E, 0x0F, 0x84, 0x88, 0x87, 0x81, 0x1B, 0x85, 0x51, 0x81, 0x85, 0x51,
+    0x81, 0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x00, 0xF1, 0xF1, 0x91, 0x1C, 0x8A, 0x40, 0x8E, 0x86,
+    0x0E, 0x88, 0x43, 0x82, 0x0D, 0x8B, 0x43, 0x85, 0x0D, 0x8A, 0x43, 0x85, 0x0D, 0x84, 0x42, 0x8E,
+    0x0F, 0x84, 0x89, 0x88, 0x81, 0x07, 0x0F, 0x84, 0x09, 0x84, 0x88, 0x8C, 0x8E, 0x40, 0x8E, 0x8D,
+    0x8A, 0x95, 0x40, 0x8C, 0x82, 0x05, 0x83, 0x8C, 0x4C, 0x81, 0x03, 0x85, 0x4D, 0x87, 0x03, 0x83,
+    0x4E, 0x89, 0x03, 0x8D, 0x45, 0x8B, 0x89, 0x8A, 0x8E, 0x45, 0x85, 0x01, 0x85, 0x44, 0x8D, 0x82,
+    0x02, 0x8A, 0x45, 0x8D, 0x01, 0x8B, 0x44, 0x83, 0x02, 0x85, 0x47, 0x83, 0x00, 0x44, 0x8D, 0x02,
+    0x81, 0x8E, 0x47, 0x87, 0x82, 0x44, 0x8A, 0x02, 0x8B, 0x42, 0x88, 0x44, 0x8A, 0x83, 0x44, 0x88,
+    0x01, 0x86, 0x42, 0x8B, 0x00, 0x44, 0x8C, 0x84, 0x44, 0x87, 0x00, 0x82, 0x42, 0x8E, 0x81, 0x00,
+    0x44, 0x8C, 0x83, 0x44, 0x88, 0x00, 0x8C, 0x42, 0x85, 0x01, 0x44, 0x8C, 0x82, 0x44, 0x8A, 0x88,
+    0x42, 0x8A, 0x01, 0x82, 0x44, 0x8A, 0x00, 0x44, 0x8E, 0x42, 0x8E, 0x81, 0x01, 0x85, 0x44, 0x87,
+    0x00, 0x8B, 0x47, 0x84, 0x02, 0x8B, 0x44, 0x84, 0x00, 0x85, 0x46, 0x88, 0x02, 0x87, 0x44, 0x8D,
+    0x02, 0x8D, 0x45, 0x8B, 0x99, 0x8D, 0x45, 0x86, 0x02, 0x82, 0x4E, 0x8B, 0x04, 0x8A, 0x4C, 0x8B,
+    0x81, 0x03, 0x84, 0x4C, 0x88, 0x05, 0x84, 0x8E, 0x41, 0x85, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x8B,
+    0x86, 0x81, 0x08, 0x89, 0x87, 0x23, 0x01, 0x84, 0x45, 0x83, 0x0C, 0x84, 0x44, 0x8E, 0x81, 0x0C,
+    0x82, 0x8D, 0x43, 0x8B, 0x0D, 0x81, 0x8B, 0x43, 0x88, 0x0E, 0x88, 0x43, 0x86, 0x0E, 0x84, 0x8E,
+    0x42, 0x82, 0x2D, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82,
+    0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A,
+    0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88,
+    0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82,
+    0x44, 0x88, 0x06, 0x8B, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8B, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8E,
+    0x44, 0x82, 0x44, 0x8A, 0x05, 0x81, 0x45, 0x81, 0x44, 0x8E, 0x05, 0x88, 0x45, 0x00, 0x45, 0x87,
+    0x03, 0x85, 0x46, 0x00, 0x8B, 0x45, 0x8C, 0x88, 0x89, 0x8C, 0x47, 0x00, 0x84, 0x51, 0x01, 0x8B,
+    0x4A, 0x83, 0x44, 0x02, 0x8B, 0x47, 0x8D, 0x83, 0x00, 0x8B, 0x43, 0x03, 0x84, 0x8A, 0x8D, 0x41,
+    0x8E, 0x8B, 0x86, 0x02, 0x87, 0x43, 0x0A, 0x8B, 0x44, 0x8B, 0x0B, 0x87, 0x44, 0x8A, 0x0B, 0x84,
+    0x44, 0x88, 0x0B, 0x82, 0x8E, 0x43, 0x85, 0x0B, 0x81, 0x8D, 0x42, 0x8D, 0x82, 0x0C, 0x8A, 0x42,
+    0x8A, 0x2F, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44,
+    0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44,
+    0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06,
+    0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44,
+    0x88, 0x06, 0x8B, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8B, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8E, 0x44,
+    0x82, 0x44, 0x8A, 0x05, 0x81, 0x45, 0x81, 0x44, 0x8E, 0x05, 0x88, 0x45, 0x00, 0x45, 0x87, 0x03,
+    0x85, 0x46, 0x00, 0x8B, 0x45, 0x8C, 0x88, 0x89, 0x8C, 0x47, 0x00, 0x84, 0x51, 0x01, 0x8B, 0x4A,
+    0x83, 0x44, 0x02, 0x8B, 0x47, 0x8D, 0x83, 0x00, 0x8B, 0x43, 0x03, 0x84, 0x8A, 0x8D, 0x41, 0x8E,
+    0x8B, 0x86, 0x02, 0x87, 0x43, 0x05, 0x83, 0x46, 0x82, 0x09, 0x81, 0x8E, 0x46, 0x8C, 0x09, 0x8C,
+    0x48, 0x8A, 0x07, 0x8B, 0x43, 0x89, 0x81, 0x8C, 0x43, 0x88, 0x05, 0x8A, 0x43, 0x86, 0x02, 0x89,
+    0x43, 0x87, 0x03, 0x88, 0x42, 0x8C, 0x82, 0x04, 0x84, 0x8D, 0x42, 0x85, 0x28, 0x82, 0x44, 0x88,
+    0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82,
+    0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A,
+    0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88,
+    0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8B, 0x44, 0x82,
+    0x44, 0x88, 0x06, 0x8B, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8E, 0x44, 0x82, 0x44, 0x8A, 0x05, 0x81,
+    0x45, 0x81, 0x44, 0x8E, 0x05, 0x88, 0x45, 0x00, 0x45, 0x87, 0x03, 0x85, 0x46, 0x00, 0x8B, 0x45,
+    0x8C, 0x88, 0x89, 0x8C, 0x47, 0x00, 0x84, 0x51, 0x01, 0x8B, 0x4A, 0x83, 0x44, 0x02, 0x8B, 0x47,
+    0x8D, 0x83, 0x00, 0x8B, 0x43, 0x03, 0x84, 0x8A, 0x8D, 0x41, 0x8E, 0x8B, 0x86, 0x02, 0x87, 0x43,
+    0x03, 0x82, 0x8B, 0x8E, 0x8C, 0x84, 0x02, 0x87, 0x8D, 0x8E, 0x89, 0x07, 0x8B, 0x43, 0x01, 0x83,
+    0x43, 0x88, 0x06, 0x8E, 0x43, 0x83, 0x00, 0x86, 0x43, 0x8B, 0x06, 0x8C, 0x43, 0x81, 0x00, 0x84,
+    0x43, 0x88, 0x06, 0x82, 0x8C, 0x40, 0x8D, 0x84, 0x02, 0x87, 0x8E, 0x40, 0x8A, 0x3F, 0x82, 0x44,
+    0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44,
+    0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06,
+    0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44,
+    0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8B, 0x44,
+    0x82, 0x44, 0x88, 0x06, 0x8B, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8E, 0x44, 0x82, 0x44, 0x8A, 0x05,
+    0x81, 0x45, 0x81, 0x44, 0x8E, 0x05, 0x88, 0x45, 0x00, 0x45, 0x87, 0x03, 0x85, 0x46, 0x00, 0x8B,
+    0x45, 0x8C, 0x88, 0x89, 0x8C, 0x47, 0x00, 0x84, 0x51, 0x01, 0x8B, 0x4A, 0x83, 0x44, 0x02, 0x8B,
+    0x47, 0x8D, 0x83, 0x00, 0x8B, 0x43, 0x03, 0x84, 0x8A, 0x8D, 0x41, 0x8E, 0x8B, 0x86, 0x02, 0x87,
+    0x43, 0x0A, 0x8B, 0x44, 0x8C, 0x0D, 0x86, 0x44, 0x8B, 0x0D, 0x83, 0x44, 0x88, 0x0D, 0x81, 0x8E,
+    0x43, 0x85, 0x0E, 0x8D, 0x42, 0x8D, 0x82, 0x0E, 0x89, 0x42, 0x8A, 0x35, 0x8C, 0x44, 0x85, 0x07,
+    0x89, 0x44, 0x96, 0x44, 0x8B, 0x07, 0x8E, 0x44, 0x81, 0x00, 0x45, 0x06, 0x84, 0x44, 0x8A, 0x01,
+    0x8A, 0x44, 0x85, 0x05, 0x89, 0x44, 0x84, 0x01, 0x83, 0x44, 0x8A, 0x05, 0x8E, 0x43, 0x8E, 0x03,
+    0x8D, 0x44, 0x04, 0x83, 0x44, 0x89, 0x03, 0x87, 0x44, 0x85, 0x03, 0x88, 0x44, 0x83, 0x03, 0x81,
+    0x44, 0x8A, 0x03, 0x8D, 0x43, 0x8D, 0x05, 0x8A, 0x44, 0x02, 0x82, 0x44, 0x87, 0x05, 0x84, 0x44,
+    0x84, 0x01, 0x88, 0x44, 0x81, 0x06, 0x8E, 0x43, 0x89, 0x01, 0x8D, 0x43, 0x8B, 0x07, 0x87, 0x43,
+    0x8E, 0x00, 0x82, 0x44, 0x85, 0x07, 0x81, 0x44, 0x83, 0x87, 0x43, 0x8E, 0x09, 0x8B, 0x43, 0x87,
+    0x8B, 0x43, 0x89, 0x09, 0x85, 0x43, 0x8A, 0x8E, 0x43, 0x83, 0x0A, 0x8E, 0x42, 0x8D, 0x43, 0x8D,
+    0x0B, 0x88, 0x47, 0x87, 0x0B, 0x82, 0x47, 0x81, 0x0C, 0x8B, 0x45, 0x8B, 0x0D, 0x85, 0x45, 0x85,
+    0x0E, 0x8E, 0x44, 0x0F, 0x8E, 0x43, 0x89, 0x0E, 0x85, 0x44, 0x83, 0x0E, 0x8D, 0x43, 0x8D, 0x0D,
+    0x81, 0x8C, 0x44, 0x87, 0x09, 0x88, 0x8A, 0x89, 0x8B, 0x45, 0x8E, 0x0A, 0x8B, 0x48, 0x85, 0x0A,
+    0x8B, 0x47, 0x87, 0x0B, 0x8B, 0x45, 0x8E, 0x85, 0x0C, 0x88, 0x8E, 0x41, 0x8E, 0x8B, 0x86, 0x0D,
+    0x00, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E,
+    0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x89, 0x0E, 0x44, 0x89, 0x01, 0x86, 0x8B, 0x8E, 0x40,
+    0x8E, 0x8B, 0x86, 0x05, 0x44, 0x88, 0x82, 0x8D, 0x46, 0x8D, 0x82, 0x03, 0x44, 0x87, 0x8D, 0x48,
+    0x8E, 0x81, 0x02, 0x50, 0x8A, 0x02, 0x47, 0x8A, 0x88, 0x8A, 0x8E, 0x45, 0x83, 0x01, 0x45, 0x8D,
+    0x81, 0x02, 0x81, 0x8C, 0x44, 0x89, 0x01, 0x45, 0x83, 0x04, 0x82, 0x44, 0x8E, 0x01, 0x44, 0x8E,
+    0x06, 0x8C, 0x44, 0x81, 0x00, 0x44, 0x8B, 0x06, 0x89, 0x44, 0x83, 0x00, 0x44, 0x8A, 0x06, 0x87,
+    0x44, 0x84, 0x00, 0x44, 0x8A, 0x06, 0x87, 0x44, 0x85, 0x00, 0x44, 0x8A, 0x06, 0x87, 0x44, 0x84,
+    0x00, 0x44, 0x8C, 0x06, 0x89, 0x44, 0x83, 0x00, 0x45, 0x06, 0x8C, 0x44, 0x81, 0x00, 0x45, 0x85,
+    0x04, 0x82, 0x44, 0x8E, 0x01, 0x45, 0x8E, 0x83, 0x02, 0x81, 0x8D, 0x44, 0x89, 0x01, 0x47, 0x8B,
+    0x89, 0x8A, 0x46, 0x83, 0x01, 0x50, 0x8B, 0x02, 0x44, 0x8C, 0x49, 0x8E, 0x81, 0x02, 0x44, 0x87,
+    0x85, 0x47, 0x8D, 0x82, 0x03, 0x44, 0x88, 0x00, 0x81, 0x88, 0x8C, 0x8E, 0x40, 0x8E, 0x8B, 0x86,
+    0x05, 0x44, 0x89, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E,
+    0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0D, 0x04, 0x87, 0x9E, 0x89,
+    0x02, 0x82, 0x8B, 0x8E, 0x8C, 0x84, 0x08, 0x84, 0x43, 0x87, 0x01, 0x8C, 0x43, 0x08, 0x87, 0x43,
+    0x8A, 0x01, 0x44, 0x83, 0x07, 0x84, 0x43, 0x87, 0x01, 0x8D, 0x43, 0x09, 0x88, 0x9E, 0x8A, 0x02,
+    0x82, 0x8C, 0x40, 0x8D, 0x84, 0x3F, 0x06, 0x8C, 0x44, 0x85, 0x07, 0x89, 0x44, 0x96, 0x44, 0x8B,
+    0x07, 0x8E, 0x44, 0x81, 0x00, 0x45, 0x06, 0x84, 0x44, 0x8A, 0x01, 0x8A, 0x44, 0x85, 0x05, 0x89,
+    0x44, 0x84, 0x01, 0x83, 0x44, 0x8A, 0x05, 0x8E, 0x43, 0x8E, 0x03, 0x8D, 0x44, 0x04, 0x83, 0x44,
+    0x89, 0x03, 0x87, 0x44, 0x85, 0x03, 0x88, 0x44, 0x83, 0x03, 0x81, 0x44, 0x8A, 0x03, 0x8D, 0x43,
+    0x8D, 0x05, 0x8A, 0x44, 0x02, 0x82, 0x44, 0x87, 0x05, 0x84, 0x44, 0x84, 0x01, 0x88, 0x44, 0x81,
+    0x06, 0x8E, 0x43, 0x89, 0x01, 0x8D, 0x43, 0x8B, 0x07, 0x87, 0x43, 0x8E, 0x00, 0x82, 0x44, 0x85,
+    0x07, 0x81, 0x44, 0x83, 0x87, 0x43, 0x8E, 0x09, 0x8B, 0x43, 0x87, 0x8B, 0x43, 0x89, 0x09, 0x85,
+    0x43, 0x8A, 0x8E, 0x43, 0x83, 0x0A, 0x8E, 0x42, 0x8D, 0x43, 0x8D, 0x0B, 0x88, 0x47, 0x87, 0x0B,
+    0x82, 0x47, 0x81, 0x0C, 0x8B, 0x45, 0x8B, 0x0D, 0x85, 0x45, 0x85, 0x0E, 0x8E, 0x44, 0x0F, 0x8E,
+    0x43, 0x89, 0x0E, 0x85, 0x44, 0x83, 0x0E, 0x8D, 0x43, 0x8D, 0x0D, 0x81, 0x8C, 0x44, 0x87, 0x09,
+    0x88, 0x8A, 0x89, 0x8B, 0x45, 0x8E, 0x0A, 0x8B, 0x48, 0x85, 0x0A, 0x8B, 0x47, 0x87, 0x0B, 0x8B,
+    0x45, 0x8E, 0x85, 0x0C, 0x88, 0x8E, 0x41, 0x8E, 0x8B, 0x86, 0x0D,
+};
+const GFXglyph OpenSans18BGlyphs[] = {
+    { 0, 0, 10, 0, 0, 0, 4 }, //  
+    { 7, 27, 11, 2, 27, 79, 4 }, // !
+    { 14, 10, 18, 2, 27, 63, 83 }, // "
+    { 24, 27, 25, 0, 27, 185, 146 }, // #
+    { 20, 31, 22, 1, 29, 202, 331 }, // $
+    { 33, 27, 34, 1, 27, 326, 533 }, // %
+    { 28, 27, 29, 1, 27, 213, 859 }, // &
+    { 6, 10, 10, 2, 27, 32, 1072 }, // '
+    { 11, 33, 13, 1, 27, 133, 1104 }, // (
+    { 11, 33, 13, 1, 27, 128, 1237 }, // )
+    { 19, 19, 21, 1, 29, 118, 1365 }, // *
+    { 20, 20, 22, 1, 23, 77, 1483 }, // +
+    { 8, 9, 11, 1, 4, 35, 1560 }, // ,
+    { 11, 5, 12, 1, 13, 16, 1595 }, // -
+    { 7, 7, 11, 2, 7, 29, 1611 }, // .
+    { 16, 27, 16, 0, 27, 109, 1640 }, // /
+    { 20, 27, 22, 1, 27, 187, 1749 }, // 0
+    { 14, 27, 22, 2, 27, 107, 1936 }, // 1
+    { 20, 27, 22, 1, 27, 140, 2043 }, // 2
+    { 20, 27, 22, 1, 27, 168, 2183 }, // 3
+    { 22, 27, 22, 0, 27, 154, 2351 }, // 4
+    { 19, 27, 22, 1, 27, 142, 2505 }, // 5
+    { 20, 27, 22, 1, 27, 178, 2647 }, // 6
+    { 20, 27, 22, 1, 27, 102, 2825 }, // 7
+    { 20, 27, 22, 1, 27, 195, 2927 }, // 8
+    { 20, 27, 22, 1, 27, 182, 3122 }, // 9
+    { 7, 21, 11, 2, 21, 56, 3304 }, // :
+    { 8, 26, 11, 1, 21, 67, 3360 }, // ;
+    { 20, 21, 22, 1, 24, 110, 3427 }, // <
+    { 20, 11, 22, 1, 19, 33, 3537 }, // =
+    { 20, 21, 22, 1, 24, 108, 3570 }, // >
+    { 18, 27, 18, 0, 27, 123, 3678 }, // ?
+    { 32, 30, 34, 1, 27, 361, 3801 }, // @
+    { 27, 27, 26, 0, 27, 172, 4162 }, // A
+    { 21, 27, 26, 3, 27, 176, 4334 }, // B
+    { 21, 27, 24, 2, 27, 153, 4510 }, // C
+    { 23, 27, 28, 3, 27, 191, 4663 }, // D
+    { 17, 27, 21, 3, 27, 105, 4854 }, // E
+    { 16, 27, 21, 3, 27, 97, 4959 }, // F
+    { 23, 27, 28, 2, 27, 182, 5056 }, // G
+    { 23, 27, 29, 3, 27, 173, 5238 }, // H
+    { 7, 27, 13, 3, 27, 81, 5411 }, // I
+    { 13, 35, 13, -3, 27, 152, 5492 }, // J
+    { 23, 27, 25, 3, 27, 206, 5644 }, // K
+    { 18, 27, 21, 3, 27, 105, 5850 }, // L
+    { 30, 27, 36, 3, 27, 297, 5955 }, // M
+    { 25, 27, 31, 3, 27, 238, 6252 }, // N
+    { 27, 27, 30, 2, 27, 201, 6490 }, // O
+    { 20, 27, 24, 3, 27, 152, 6691 }, // P
+    { 27, 33, 30, 2, 27, 223, 6843 }, // Q
+    { 23, 27, 25, 3, 27, 194, 7066 }, // R
+    { 19, 27, 21, 1, 27, 162, 7260 }, // S
+    { 22, 27, 22, 0, 27, 106, 7422 }, // T
+    { 23, 27, 29, 3, 27, 170, 7528 }, // U
+    { 25, 27, 25, 0, 27, 181, 7698 }, // V
+    { 37, 27, 37, 0, 27, 324, 7879 }, // W
+    { 26, 27, 25, 0, 27, 190, 8203 }, // X
+    { 24, 27, 24, 0, 27, 140, 8393 }, // Y
+    { 22, 27, 22, 0, 27, 108, 8533 }, // Z
+    { 10, 33, 13, 2, 27, 126, 8641 }, // [
+    { 16, 27, 16, 0, 27, 104, 8767 }, // '\\'
+    { 10, 33, 13, 0, 27, 126, 8871 }, // ]
+    { 21, 17, 20, 0, 27, 113, 8997 }, // ^
+    { 17, 3, 16, -1, -3, 10, 9110 }, // _
+    { 11, 6, 23, 6, 29, 26, 9120 }, // `
+    { 20, 21, 23, 1, 21, 145, 9146 }, // a
+    { 21, 29, 24, 2, 29, 178, 9291 }, // b
+    { 18, 21, 20, 1, 21, 117, 9469 }, // c
+    { 21, 29, 24, 1, 29, 200, 9586 }, // d
+    { 20, 21, 22, 1, 21, 128, 9786 }, // e
+    { 17, 29, 15, 0, 29, 133, 9914 }, // f
+    { 22, 30, 21, 0, 21, 208, 10047 }, // g
+    { 21, 29, 25, 2, 29, 169, 10255 }, // h
+    { 7, 29, 12, 2, 29, 89, 10424 }, // i
+    { 12, 38, 12, -3, 29, 133, 10513 }, // j
+    { 22, 29, 24, 2, 29, 164, 10646 }, // k
+    { 7, 29, 12, 2, 29, 87, 10810 }, // l
+    { 33, 21, 37, 2, 21, 237, 10897 }, // m
+    { 21, 21, 25, 2, 21, 146, 11134 }, // n
+    { 21, 21, 24, 1, 21, 144, 11280 }, // o
+    { 21, 30, 24, 2, 21, 181, 11424 }, // p
+    { 21, 30, 24, 1, 21, 204, 11605 }, // q
+    { 15, 21, 17, 2, 21, 82, 11809 }, // r
+    { 17, 21, 19, 1, 21, 130, 11891 }, // s
+    { 16, 26, 17, 0, 26, 114, 12021 }, // t
+    { 20, 21, 25, 2, 21, 131, 12135 }, // u
+    { 22, 21, 22, 0, 21, 140, 12266 }, // v
+    { 33, 21, 33, 0, 21, 250, 12406 }, // w
+    { 22, 21, 22, 0, 21, 135, 12656 }, // x
+    { 22, 30, 22, 0, 21, 180, 12791 }, // y
+    { 17, 21, 19, 1, 21, 80, 12971 }, // z
+    { 14, 33, 15, 0, 27, 150, 13051 }, // {
+    { 5, 38, 21, 8, 29, 114, 13201 }, // |
+    { 14, 33, 15, 1, 27, 150, 13315 }, // }
+    { 20, 9, 22, 1, 18, 62, 13465 }, // ~
+    { 0, 0, 10, 0, 0, 0, 13527 }, //  
+    { 7, 28, 11, 2, 21, 89, 13527 }, // ¡
+    { 18, 27, 22, 2, 27, 138, 13616 }, // ¢
+    { 20, 27, 22, 1, 27, 121, 13754 }, // £
+    { 18, 19, 22, 2, 23, 136, 13875 }, // ¤
+    { 22, 27, 22, 0, 27, 149, 14011 }, // ¥
+    { 5, 38, 21, 8, 29, 91, 14160 }, // ¦
+    { 16, 29, 18, 1, 29, 187, 14251 }, // §
+    { 13, 5, 23, 5, 29, 43, 14438 }, // ¨
+    { 29, 27, 32, 1, 27, 327, 14481 }, // ©
+    { 13, 13, 15, 0, 27, 95, 14808 }, // ª
+    { 21, 17, 23, 1, 19, 145, 14903 }, // «
+    { 20, 11, 22, 1, 15, 35, 15048 }, // ¬
+    { 11, 5, 12, 1, 13, 16, 15083 }, // ­
+    { 29, 27, 32, 1, 27, 348, 15099 }, // ®
+    { 21, 4, 19, -1, 33, 11, 15447 }, // ¯
+    { 14, 13, 16, 1, 28, 90, 15458 }, // °
+    { 20, 25, 22, 1, 25, 93, 15548 }, // ±
+    { 14, 16, 14, 0, 27, 71, 15641 }, // ²
+    { 12, 16, 14, 1, 27, 91, 15712 }, // ³
+    { 11, 6, 23, 6, 29, 28, 15803 }, // ´
+    { 21, 30, 25, 2, 21, 175, 15831 }, // µ
+    { 20, 34, 25, 2, 29, 258, 16006 }, // ¶
+    { 7, 7, 11, 2, 17, 28, 16264 }, // ·
+    { 9, 9, 8, -1, 0, 41, 16292 }, // ¸
+    { 10, 16, 14, 1, 27, 73, 16333 }, // ¹
+    { 13, 13, 15, 1, 27, 88, 16406 }, // º
+    { 21, 17, 23, 1, 19, 149, 16494 }, // »
+    { 32, 27, 33, 0, 27, 259, 16643 }, // ¼
+    { 32, 27, 33, 0, 27, 249, 16902 }, // ½
+    { 31, 27, 33, 1, 27, 292, 17151 }, // ¾
+    { 18, 28, 18, 1, 21, 132, 17443 }, // ¿
+    { 27, 35, 26, 0, 35, 200, 17575 }, // À
+    { 27, 35, 26, 0, 35, 200, 17775 }, // Á
+    { 27, 35, 26, 0, 35, 213, 17975 }, // Â
+    { 27, 35, 26, 0, 35, 228, 18188 }, // Ã
+    { 27, 35, 26, 0, 35, 218, 18416 }, // Ä
+    { 27, 34, 26, 0, 34, 217, 18634 }, // Å
+    { 34, 27, 36, 0, 27, 181, 18851 }, // Æ
+    { 21, 36, 24, 2, 27, 199, 19032 }, // Ç
+    { 17, 35, 21, 3, 35, 134, 19231 }, // È
+    { 17, 35, 21, 3, 35, 132, 19365 }, // É
+    { 17, 35, 21, 3, 35, 148, 19497 }, // Ê
+    { 17, 35, 21, 3, 35, 151, 19645 }, // Ë
+    { 12, 35, 13, -2, 35, 136, 19796 }, // Ì
+    { 11, 35, 13, 3, 35, 136, 19932 }, // Í
+    { 17, 35, 13, -2, 35, 150, 20068 }, // Î
+    { 14, 35, 13, -1, 35, 152, 20218 }, // Ï
+    { 26, 27, 28, 0, 27, 201, 20370 }, // Ð
+    { 25, 35, 31, 3, 35, 289, 20571 }, // Ñ
+    { 27, 35, 30, 2, 35, 228, 20860 }, // Ò
+    { 27, 35, 30, 2, 35, 228, 21088 }, // Ó
+    { 27, 35, 30, 2, 35, 243, 21316 }, // Ô
+    { 27, 35, 30, 2, 35, 254, 21559 }, // Õ
+    { 27, 35, 30, 2, 35, 245, 21813 }, // Ö
+    { 18, 17, 22, 2, 22, 133, 22058 }, // ×
+    { 27, 31, 30, 2, 29, 257, 22191 }, // Ø
+    { 23, 35, 29, 3, 35, 198, 22448 }, // Ù
+    { 23, 35, 29, 3, 35, 198, 22646 }, // Ú
+    { 23, 35, 29, 3, 35, 211, 22844 }, // Û
+    { 23, 35, 29, 3, 35, 216, 23055 }, // Ü
+    { 24, 35, 24, 0, 35, 170, 23271 }, // Ý
+    { 20, 27, 24, 3, 27, 155, 23441 }, // Þ
+    { 24, 29, 27, 2, 29, 232, 23596 }, // ß
+    { 20, 29, 23, 1, 29, 171, 23828 }, // à
+    { 20, 29, 23, 1, 29, 172, 23999 }, // á
+    { 20, 29, 23, 1, 29, 186, 24171 }, // â
+    { 20, 29, 23, 1, 29, 197, 24357 }, // ã
+    { 20, 29, 23, 1, 29, 190, 24554 }, // ä
+    { 20, 32, 23, 1, 32, 209, 24744 }, // å
+    { 33, 21, 35, 1, 21, 206, 24953 }, // æ
+    { 18, 30, 20, 1, 21, 160, 25159 }, // ç
+    { 20, 29, 22, 1, 29, 156, 25319 }, // è
+    { 20, 29, 22, 1, 29, 155, 25475 }, // é
+    { 20, 29, 22, 1, 29, 169, 25630 }, // ê
+    { 20, 29, 22, 1, 29, 170, 25799 }, // ë
+    { 11, 29, 12, -2, 29, 89, 25969 }, // ì
+    { 12, 29, 12, 2, 29, 92, 26058 }, // í
+    { 17, 29, 12, -3, 29, 105, 26150 }, // î
+    { 14, 29, 12, -1, 29, 106, 26255 }, // ï
+    { 21, 29, 24, 1, 29, 198, 26361 }, // ð
+    { 21, 29, 25, 2, 29, 195, 26559 }, // ñ
+    { 21, 29, 24, 1, 29, 170, 26754 }, // ò
+    { 21, 29, 24, 1, 29, 172, 26924 }, // ó
+    { 21, 29, 24, 1, 29, 183, 27096 }, // ô
+    { 21, 29, 24, 1, 29, 196, 27279 }, // õ
+    { 21, 29, 24, 1, 29, 189, 27475 }, // ö
+    { 20, 19, 22, 1, 22, 70, 27664 }, // ÷
+    { 21, 24, 24, 1, 22, 176, 27734 }, // ø
+    { 20, 29, 25, 2, 29, 160, 27910 }, // ù
+    { 20, 29, 25, 2, 29, 159, 28070 }, // ú
+    { 20, 29, 25, 2, 29, 171, 28229 }, // û
+    { 20, 29, 25, 2, 29, 177, 28400 }, // ü
+    { 22, 38, 22, 0, 29, 207, 28577 }, // ý
+    { 21, 38, 24, 2, 29, 204, 28784 }, // þ
+    { 22, 38, 22, 0, 29, 223, 28988 }, // ÿ
+};
+const UnicodeInterval OpenSans18BIntervals[] = {
+    { 0x20, 0x7E, 0x0 },
+    { 0xA0, 0xFF, 0x5F },
+};
+const GFXfont OpenSans18B = {
+    (uint8_t*)OpenSans18BBitmaps,
+    (GFXglyph*)OpenSans18BGlyphs,
+    (UnicodeInterval*)OpenSans18BIntervals,
+    2,
+    1,
+    51,
+    41,
+    -11,
+};
@@ -0,0 +1,1070 @@
+#pragma once
+// Generated by tools/fontsubset.py from opensans18b.h, do not edit
+#include "epd_driver.h"
+const uint8_t OpenSans18BBitmaps[14805] = {
+    0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x9C, 0x3D, 0xCC, 0xC9, 0x0D, 0x40, 0x00,
+    0x14, 0x00, 0xD1, 0x6F, 0x5F, 0xCA, 0x52, 0x85, 0x8B, 0x44, 0x09, 0xCA, 0xD0, 0x8D, 0x1A, 0x54,
+    0x40, 0x07, 0x74, 0x60, 0xDF, 0xC9, 0xF8, 0x71, 0x30, 0xC9, 0xBB, 0xCE, 0x05, 0xE1, 0x09, 0xC1,
+    0x01, 0xBE, 0xF2, 0x76, 0x70, 0x37, 0x70, 0x56, 0xB5, 0x80, 0x3D, 0x83, 0x35, 0x81, 0x39, 0x82,
+    0xA1, 0x64, 0x50, 0x3D, 0xDD, 0xA7, 0xA5, 0x91, 0x9A, 0x4A, 0xD2, 0x3C, 0x96, 0xBF, 0xC8, 0x94,
+    0x92, 0x42, 0xF4, 0xE5, 0xDE, 0xFA, 0xBD, 0x94, 0xBE, 0xAC, 0xEC, 0x49, 0xE4, 0x05, 0xBD, 0x11,
+    0x43, 0x6E, 0x78, 0x9C, 0x15, 0xC5, 0x41, 0x15, 0x80, 0x20, 0x00, 0x44, 0xC1, 0xBD, 0xFB, 0x84,
+    0x08, 0x44, 0x30, 0x02, 0x11, 0x88, 0x40, 0x04, 0x23, 0x18, 0xC1, 0x08, 0x56, 0x31, 0x8A, 0x11,
+    0x50, 0x40, 0xD4, 0xCB, 0x57, 0xE7, 0x32, 0x8D, 0x45, 0x0F, 0xE3, 0xC9, 0xAC, 0x9B, 0x58, 0x99,
+    0x74, 0x11, 0x0A, 0x51, 0x0D, 0x9F, 0x09, 0xAA, 0xB8, 0x1D, 0xAF, 0x82, 0x4D, 0x0C, 0xCA, 0x7F,
+    0x4E, 0x07, 0x66, 0xC3, 0x2A, 0xD1, 0xAF, 0x98, 0xAF, 0xEE, 0x05, 0x65, 0xA7, 0x2B, 0x7B, 0x78,
+    0x9C, 0x75, 0x8F, 0x5D, 0x0A, 0x82, 0x50, 0x14, 0x84, 0xA7, 0x1F, 0xFB, 0xA1, 0x28, 0x77, 0x52,
+    0x4B, 0x70, 0x27, 0xB5, 0x04, 0x77, 0xD2, 0x12, 0x6A, 0x05, 0xB5, 0x04, 0x97, 0x10, 0xF4, 0x2E,
+    0xFA, 0x1E, 0x24, 0x45, 0x94, 0x29, 0x3A, 0xDD, 0x3B, 0x76, 0xED, 0xC9, 0x81, 0x03, 0x1F, 0x87,
+    0xC3, 0x99, 0x19, 0x00, 0x78, 0x70, 0x81, 0x17, 0xA7, 0xB0, 0x7A, 0x72, 0x8E, 0x9C, 0x23, 0xF1,
+    0xDB, 0xEC, 0x4A, 0x0E, 0xC5, 0x85, 0xD9, 0xD5, 0xEC, 0x89, 0x2B, 0x0E, 0x7C, 0x66, 0x42, 0x90,
+    0x08, 0x18, 0x09, 0xD7, 0x4C, 0x10, 0x72, 0x27, 0xDE, 0xF2, 0x84, 0x03, 0x37, 0x3A, 0x76, 0x8A,
+    0x3A, 0xF9, 0x7A, 0xAB, 0x99, 0x69, 0x8E, 0x8A, 0x30, 0xC3, 0xE7, 0x17, 0x21, 0xE7, 0xC4, 0xDA,
+    0x89, 0x4B, 0x7A, 0xD6, 0x4E, 0x32, 0x51, 0x02, 0x9E, 0x95, 0xBD, 0xD5, 0xB8, 0x8B, 0x2F, 0x71,
+    0xC5, 0x44, 0x13, 0x9B, 0xAF, 0x29, 0x57, 0x6A, 0x69, 0x75, 0xE7, 0x52, 0x2D, 0x5D, 0xF3, 0xA2,
+    0x6D, 0xFE, 0xB7, 0x2D, 0xE8, 0xF9, 0xCE, 0xB6, 0x62, 0xBF, 0xB1, 0x6D, 0x9A, 0x87, 0xDC, 0x5B,
+    0xFA, 0x02, 0x1C, 0xF8, 0xA1, 0x55, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0xF8, 0xA6, 0xCF, 0x00,
+    0x05, 0x98, 0x2C, 0x87, 0x93, 0xFF, 0xFE, 0x9F, 0xCB, 0x64, 0x62, 0x60, 0x08, 0xF8, 0xFB, 0x1F,
+    0x04, 0xEE, 0xB3, 0x32, 0xFC, 0xFC, 0x0F, 0x01, 0xEC, 0x05, 0x50, 0xC6, 0x7F, 0xC6, 0x0F, 0x40,
+    0xE2, 0xEF, 0xFE, 0xBF, 0xFF, 0xF7, 0x33, 0x7C, 0xFE, 0xFF, 0x9F, 0x0B, 0xA8, 0xB7, 0xD9, 0x97,
+    0xE1, 0xEB, 0xFF, 0xFF, 0x2C, 0x10, 0x53, 0xBE, 0xFC, 0xFF, 0xCF, 0x01, 0x61, 0x7D, 0xFC, 0xFF,
+    0x7F, 0xFD, 0x0F, 0x30, 0x6B, 0x02, 0x48, 0x1F, 0x98, 0x25, 0x00, 0x32, 0xF8, 0xBD, 0x26, 0x88,
+    0xB9, 0x11, 0x6C, 0x9A, 0x35, 0x88, 0x79, 0x15, 0xCC, 0xE4, 0x04, 0x31, 0x97, 0x80, 0x58, 0xE7,
+    0x21, 0xAE, 0x82, 0x0B, 0x7E, 0xCB, 0xFF, 0xF3, 0xFF, 0x3F, 0x3F, 0xC4, 0xA5, 0x0B, 0xFE, 0xFF,
+    0xB7, 0x17, 0x04, 0xB3, 0x12, 0x80, 0xAC, 0xAF, 0xD9, 0x8C, 0x40, 0xD6, 0x86, 0xFF, 0xFF, 0xE5,
+    0xBF, 0xFE, 0xBF, 0x5F, 0xF5, 0x6B, 0xFD, 0xBF, 0xFF, 0xFF, 0x79, 0xBE, 0xC2, 0x5C, 0xCA, 0x02,
+    0x63, 0xE5, 0x33, 0x6C, 0x82, 0x30, 0xCE, 0x33, 0x33, 0x30, 0x04, 0xEE, 0x7C, 0xFB, 0xFF, 0x7D,
+    0x37, 0x33, 0xAE, 0x30, 0xC0, 0x64, 0x01, 0x00, 0x87, 0xAE, 0x94, 0xFF, 0x78, 0x9C, 0x55, 0x51,
+    0xCB, 0x51, 0x02, 0x41, 0x14, 0x6C, 0x40, 0x2D, 0x3E, 0xA2, 0x46, 0xA0, 0x55, 0x24, 0x20, 0x19,
+    0x48, 0x06, 0x72, 0xF7, 0xA0, 0x19, 0x48, 0x08, 0x66, 0xB0, 0x9B, 0x01, 0x56, 0x19, 0x80, 0x7B,
+    0xF0, 0x2C, 0x64, 0x20, 0x19, 0xB0, 0x67, 0x3D, 0xA0, 0x16, 0xCB, 0xBA, 0x02, 0xD3, 0xF4, 0x7B,
+    0x02, 0xB5, 0xBE, 0xAA, 0x99, 0x37, 0xD3, 0xF3, 0x3E, 0xFD, 0x7A, 0xD0, 0xFB, 0x98, 0xDD, 0xC0,
+    0x6C, 0xC2, 0xC8, 0x7D, 0x41, 0xB2, 0x69, 0x87, 0x9C, 0xE7, 0xE6, 0x06, 0xBA, 0xFB, 0xD3, 0x19,
+    0x79, 0x64, 0xC0, 0x27, 0x19, 0xC8, 0x2A, 0x10, 0x73, 0xEA, 0x19, 0x19, 0xA3, 0x3B, 0xB2, 0x0E,
+    0x7C, 0xF3, 0xD6, 0x81, 0x1F, 0x5E, 0x20, 0xF0, 0x18, 0x58, 0xDA, 0x06, 0xF3, 0xA7, 0x5A, 0x27,
+    0xE8, 0x92, 0x35, 0x07, 0x56, 0x6C, 0xE3, 0x57, 0xE0, 0x98, 0xCF, 0x7E, 0xC7, 0x5A, 0x40, 0x21,
+    0x20, 0x53, 0xEA, 0xBF, 0x88, 0x60, 0x85, 0x4B, 0x35, 0x06, 0x9C, 0xE1, 0x25, 0xBC, 0x1E, 0xEE,
+    0xBB, 0x7C, 0xF1, 0x3E, 0x16, 0x43, 0xD5, 0x99, 0x33, 0xEA, 0x8B, 0x47, 0xC1, 0x76, 0x6E, 0x9C,
+    0xEB, 0x48, 0x9D, 0x69, 0x87, 0x3C, 0xB0, 0x3B, 0x2F, 0xD1, 0x37, 0x37, 0x4C, 0x38, 0xD2, 0xA1,
+    0xB1, 0xB0, 0xA9, 0x2C, 0xB2, 0x35, 0xE7, 0xD5, 0x83, 0x26, 0x4A, 0xF9, 0x06, 0x74, 0xDF, 0xA5,
+    0xC7, 0x8A, 0xCD, 0x84, 0x44, 0xA2, 0x5E, 0x6E, 0x1A, 0xAF, 0x32, 0xD6, 0xB4, 0x8F, 0x02, 0xDD,
+    0x52, 0xE5, 0x4E, 0x04, 0xC4, 0x3B, 0x20, 0xD7, 0x74, 0xE5, 0x08, 0x17, 0xAB, 0x5C, 0xC3, 0xC5,
+    0x52, 0x97, 0x8A, 0x77, 0x81, 0x89, 0x75, 0x0D, 0xF4, 0x44, 0x33, 0xDB, 0x0A, 0xBF, 0x64, 0x4B,
+    0x7B, 0xE0, 0xD4, 0x98, 0xC2, 0xDF, 0xAA, 0xAE, 0xAE, 0xAC, 0xF1, 0xF7, 0x43, 0xC3, 0xDD, 0x87,
+    0x8C, 0x3C, 0x63, 0xB1, 0x15, 0xEB, 0xC9, 0xF5, 0xD8, 0x00, 0x4D, 0x8E, 0xD4, 0x70, 0x78, 0x9C,
+    0x3D, 0x90, 0xCD, 0x6D, 0xC2, 0x40, 0x14, 0x84, 0x07, 0x5B, 0xE1, 0x27, 0x52, 0x24, 0x0A, 0x00,
+    0xC1, 0x2D, 0x57, 0x77, 0x00, 0x1D, 0x24, 0x0D, 0x44, 0x50, 0x02, 0x35, 0x70, 0xE0, 0x0A, 0x1D,
+    0x50, 0x01, 0xE2, 0x9A, 0x1B, 0x88, 0x06, 0xA0, 0x00, 0x24, 0x23, 0xCE, 0x91, 0x0C, 0x49, 0x00,
+    0x41, 0x14, 0x0F, 0xF3, 0x76, 0xD7, 0xBC, 0xC3, 0x7A, 0xBF, 0xDD, 0xF7, 0x66, 0x66, 0x0D, 0x60,
+    0xF8, 0xC5, 0xD9, 0x13, 0x42, 0x4D, 0xA8, 0x4A, 0xE3, 0x40, 0x7F, 0x46, 0xEC, 0x78, 0x18, 0x38,
+    0x60, 0xEA, 0x69, 0x43, 0x4E, 0x47, 0x39, 0x19, 0x39, 0x3A, 0x92, 0x65, 0x7C, 0x93, 0x5E, 0x47,
+    0x9B, 0x12, 0x76, 0x05, 0x1D, 0xC8, 0xD8, 0x1A, 0xA2, 0x62, 0xAE, 0x26, 0xDD, 0xF4, 0xA1, 0xD9,
+    0x59, 0x91, 0xBD, 0xE0, 0x97, 0x33, 0x93, 0xC3, 0x73, 0xA0, 0x5F, 0xB3, 0x9B, 0x17, 0xC9, 0x96,
+    0x46, 0xE5, 0x00, 0xC9, 0xBF, 0xE0, 0x4D, 0x9B, 0x9B, 0x89, 0x9F, 0xEC, 0x2A, 0x53, 0x68, 0xAD,
+    0x48, 0x7C, 0xCC, 0x1E, 0xFA, 0xE4, 0xD8, 0xA6, 0xD2, 0xA1, 0xB0, 0x22, 0xDF, 0x96, 0x05, 0x6B,
+    0xE1, 0xAC, 0xF3, 0x8B, 0xB9, 0x9C, 0x2D, 0x4A, 0xD7, 0xB7, 0x47, 0xD0, 0x51, 0x15, 0xD8, 0x1B,
+    0x8C, 0x61, 0x77, 0x2F, 0x40, 0xDD, 0x6C, 0xF4, 0xFD, 0x21, 0x17, 0x31, 0x92, 0xAB, 0x6B, 0xB4,
+    0x97, 0x31, 0xDB, 0xBA, 0x31, 0x45, 0x7D, 0xE7, 0xA3, 0x16, 0x70, 0x83, 0x45, 0x35, 0x42, 0x4E,
+    0xF2, 0x43, 0xB2, 0xEB, 0x92, 0xF0, 0x33, 0xCF, 0x66, 0xAF, 0x68, 0xEB, 0xBF, 0x35, 0xEF, 0xB4,
+    0x6C, 0xCA, 0x2F, 0x78, 0x9C, 0x01, 0x1E, 0x00, 0xE1, 0xFF, 0xF7, 0xFF, 0x9F, 0xF6, 0xFF, 0x8F,
+    0xF5, 0xFF, 0x7F, 0xF4, 0xFF, 0x5F, 0xF3, 0xFF, 0x4F, 0xF1, 0xFF, 0x3F, 0xF0, 0xFF, 0x2F, 0xF0,
+    0xFF, 0x1F, 0xE0, 0xFF, 0x0F, 0xC0, 0xFF, 0x0E, 0x73, 0x45, 0x16, 0x36, 0x78, 0x9C, 0x5D, 0x8E,
+    0xCD, 0x0D, 0x01, 0x61, 0x18, 0x84, 0x1F, 0x89, 0x4F, 0xEC, 0x81, 0xE8, 0x44, 0x09, 0x74, 0xB0,
+    0x5B, 0xC2, 0x76, 0xA2, 0x04, 0x25, 0xD0, 0x81, 0x12, 0x28, 0x41, 0x09, 0x68, 0x60, 0x57, 0x58,
+    0x12, 0x0E, 0xE3, 0xDD, 0xF9, 0x92, 0x3D, 0xB8, 0xCC, 0x61, 0xFE, 0x61, 0x2D, 0x4D, 0xE0, 0xAA,
+    0x23, 0xF0, 0xD1, 0x92, 0x9E, 0x28, 0xE0, 0x24, 0x8D, 0xE0, 0xA9, 0x83, 0xE9, 0x12, 0x16, 0xD2,
+    0x1C, 0x2A, 0x8B, 0x7B, 0x29, 0xC1, 0xD9, 0x96, 0x56, 0x4D, 0x58, 0x1E, 0xCE, 0x77, 0xB6, 0xBF,
+    0xB4, 0x0D, 0x7C, 0x6B, 0xF3, 0x87, 0x99, 0xEF, 0xB4, 0x1B, 0xFC, 0x77, 0x67, 0x2F, 0xEE, 0x89,
+    0xCE, 0x31, 0xD4, 0xEE, 0x8F, 0xAD, 0x59, 0x08, 0x5F, 0xAD, 0x86, 0x40, 0x1E, 0x8B, 0xF9, 0xA9,
+    0x85, 0xF8, 0xC9, 0xCD, 0x1D, 0x71, 0x37, 0xFD, 0x00, 0x63, 0x24, 0x52, 0x9D, 0x78, 0x9C, 0x55,
+    0x8E, 0xD1, 0x0D, 0x82, 0x00, 0x0C, 0x44, 0x0F, 0xC1, 0x44, 0x7F, 0x84, 0x4D, 0x74, 0x03, 0xDD,
+    0x00, 0x47, 0x70, 0x13, 0x47, 0xD0, 0x11, 0xD8, 0x00, 0x36, 0xD0, 0x0D, 0x74, 0x03, 0xDC, 0x40,
+    0x12, 0x13, 0x21, 0xFA, 0xF1, 0x6C, 0xAB, 0x7C, 0xF8, 0xF3, 0x9A, 0xDC, 0xB5, 0x77, 0x1D, 0x58,
+    0x4A, 0xBA, 0xD2, 0x1A, 0x37, 0x30, 0xB3, 0xF1, 0x0E, 0xE9, 0x41, 0x6D, 0x3C, 0xC3, 0x44, 0xDA,
+    0x85, 0x51, 0xC0, 0x22, 0xEC, 0xB5, 0xB1, 0x67, 0x1F, 0x4B, 0x27, 0x63, 0xC7, 0xDD, 0x78, 0x83,
+    0x64, 0x3C, 0xA8, 0x20, 0x93, 0x8E, 0x30, 0xFD, 0xE7, 0x57, 0x6F, 0x20, 0xF5, 0x4E, 0xDF, 0xEF,
+    0x20, 0x72, 0x2E, 0xC6, 0x27, 0x87, 0xC8, 0x2F, 0x8D, 0x90, 0x4B, 0x5B, 0x98, 0x47, 0x64, 0x3A,
+    0x56, 0xBD, 0xBC, 0x7C, 0xF5, 0x93, 0xDB, 0xC4, 0xFF, 0xF0, 0x6F, 0x3E, 0x4F, 0x98, 0x53, 0x15,
+    0x78, 0x9C, 0x63, 0x60, 0x60, 0xF8, 0xF0, 0x7F, 0x3F, 0x03, 0x04, 0x3C, 0xF8, 0x3F, 0x1F, 0xCA,
+    0xBA, 0xF0, 0xBF, 0x1E, 0xCA, 0xDA, 0xF0, 0x3F, 0x1F, 0xCA, 0x9A, 0xF0, 0xDF, 0x1F, 0x44, 0x5D,
+    0xF6, 0x60, 0x28, 0xF8, 0xAF, 0xCF, 0x10, 0x78, 0x93, 0xE1, 0xEB, 0xFF, 0xFD, 0x65, 0xFF, 0xFD,
+    0x8F, 0xFF, 0xFF, 0xCF, 0xF8, 0xE3, 0x3F, 0x14, 0x30, 0xFF, 0x82, 0xB1, 0xD8, 0x76, 0xBC, 0x01,
+    0xD3, 0xEF, 0xF7, 0xB2, 0x32, 0x30, 0x08, 0xFC, 0xFD, 0xFF, 0x9F, 0x13, 0x6A, 0xC8, 0x7F, 0x88,
+    0x31, 0x0C, 0x5F, 0xFE, 0xCF, 0xFF, 0xFF, 0x9E, 0x11, 0xC8, 0x10, 0xF8, 0xF7, 0x5F, 0xEA, 0xFF,
+    0x7F, 0x6E, 0xB0, 0x5D, 0xFF, 0x99, 0x7F, 0x80, 0x6D, 0xFE, 0xF6, 0xFF, 0x3C, 0xC3, 0xC7, 0xFF,
+    0xFF, 0x99, 0x18, 0x18, 0x02, 0xFE, 0xC6, 0x03, 0x35, 0xD9, 0x80, 0x74, 0x24, 0xF0, 0x30, 0x28,
+    0xC4, 0x32, 0x20, 0x03, 0x00, 0x6E, 0xEE, 0x4F, 0xAF, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x30,
+    0x36, 0x66, 0x80, 0x00, 0x83, 0xFF, 0xEF, 0x29, 0x65, 0x7D, 0xFD, 0x0F, 0x05, 0xF2, 0xF8, 0x59,
+    0x02, 0x82, 0x82, 0x86, 0xFF, 0xDF, 0x0B, 0x0A, 0x0A, 0x32, 0x52, 0x68, 0x2F, 0x83, 0xB1, 0x32,
+    0x88, 0x04, 0x00, 0x5B, 0xC6, 0x42, 0xF8, 0x78, 0x9C, 0x01, 0x24, 0x00, 0xDB, 0xFF, 0x00, 0xFF,
+    0xFF, 0x6F, 0x30, 0xFF, 0xFF, 0x2F, 0x60, 0xFF, 0xFF, 0x0D, 0x90, 0xFF, 0xFF, 0x08, 0xC0, 0xFF,
+    0xFF, 0x02, 0xF0, 0xFF, 0xCF, 0x00, 0xF4, 0xFF, 0x5F, 0x00, 0xF7, 0xFF, 0x0E, 0x00, 0xFB, 0xFF,
+    0x07, 0x00, 0xA4, 0x35, 0x15, 0xA1, 0x78, 0x9C, 0xFB, 0xF7, 0x1F, 0x08, 0x18, 0xFF, 0x61, 0x90,
+    0x2B, 0x56, 0x01, 0x01, 0x03, 0x00, 0x87, 0xD9, 0x17, 0x3D, 0x78, 0x9C, 0x63, 0x70, 0x62, 0x62,
+    0x38, 0xF8, 0x7F, 0x3D, 0xC3, 0xCF, 0xFF, 0xFF, 0xD9, 0xFE, 0xFC, 0xFF, 0xCF, 0xF9, 0x1B, 0x88,
+    0xBF, 0xFD, 0xFF, 0xCF, 0x5C, 0xF0, 0x37, 0x96, 0x01, 0x00, 0xE0, 0x41, 0x10, 0x77, 0x78, 0x9C,
+    0x95, 0xCD, 0xCB, 0x09, 0x83, 0x50, 0x00, 0x44, 0xD1, 0x27, 0x12, 0x24, 0x88, 0x62, 0x07, 0xDA,
+    0x49, 0xEC, 0xC4, 0x74, 0x12, 0x4B, 0xB0, 0x83, 0xD8, 0x89, 0x76, 0xA2, 0x1D, 0x84, 0x88, 0x06,
+    0xF1, 0x77, 0x93, 0x79, 0x64, 0xA3, 0x3B, 0x67, 0x73, 0x36, 0x03, 0xD7, 0x98, 0xDF, 0x56, 0x32,
+    0x91, 0x40, 0x28, 0x0B, 0xB8, 0xCA, 0x16, 0x5C, 0x39, 0xD0, 0x08, 0x33, 0xF3, 0x10, 0x11, 0xC4,
+    0xF2, 0x0E, 0xBE, 0xAC, 0xE1, 0x22, 0x3B, 0x5E, 0xF6, 0x36, 0xF2, 0xB4, 0x6E, 0xDC, 0x44, 0x0A,
+    0x81, 0x2C, 0xC1, 0x93, 0x6F, 0x70, 0xE4, 0x87, 0xCA, 0xDE, 0x96, 0x7D, 0x3C, 0x3F, 0xC4, 0xFB,
+    0x7F, 0x7C, 0x3A, 0x17, 0xFF, 0x02, 0x16, 0xCD, 0x44, 0xF2, 0x78, 0x9C, 0x45, 0x8F, 0x4D, 0x0E,
+    0x01, 0x41, 0x10, 0x85, 0x9F, 0xF1, 0x33, 0x89, 0x49, 0x98, 0x1B, 0x8C, 0x03, 0x48, 0xC6, 0x0D,
+    0x66, 0x2F, 0x91, 0xB1, 0xB6, 0xE1, 0x08, 0x8E, 0xE0, 0x06, 0x1C, 0xC1, 0x09, 0xB0, 0x62, 0x87,
+    0x93, 0xB0, 0xB2, 0x26, 0xFE, 0x45, 0x66, 0x9E, 0xAA, 0xEE, 0x4C, 0xAB, 0x45, 0xF7, 0xD7, 0x9D,
+    0x7A, 0xAF, 0x5E, 0x01, 0xE1, 0x26, 0x3F, 0x74, 0xA1, 0xF5, 0xA2, 0x54, 0x5B, 0x60, 0xA6, 0xC0,
+    0xB3, 0x07, 0x3C, 0x0D, 0xB1, 0x01, 0xE4, 0xE4, 0xF6, 0x4B, 0x4E, 0x31, 0x22, 0x77, 0xE8, 0xC8,
+    0x13, 0x2B, 0x32, 0x32, 0x2D, 0xD5, 0x0B, 0x19, 0x00, 0x72, 0xD6, 0x6F, 0xA4, 0x0F, 0xEC, 0x45,
+    0xF2, 0x20, 0x2B, 0xC6, 0xAA, 0x29, 0xBE, 0x65, 0x60, 0x42, 0xC6, 0x6F, 0xB2, 0x04, 0x75, 0x48,
+    0x3E, 0x05, 0xA5, 0x8E, 0x86, 0xFF, 0x3F, 0xD7, 0x97, 0x8A, 0xD6, 0x33, 0xDA, 0xC4, 0xF9, 0x45,
+    0x57, 0xB2, 0x66, 0x67, 0xE8, 0x44, 0x33, 0x37, 0x98, 0x17, 0x59, 0xFC, 0xBE, 0xE6, 0x6B, 0xE5,
+    0xAA, 0xCB, 0xC8, 0x85, 0x64, 0x5E, 0x02, 0x77, 0xBB, 0x47, 0x0C, 0x8C, 0x2D, 0x89, 0x15, 0x4E,
+    0x0A, 0x3D, 0xDD, 0x3C, 0x5C, 0x67, 0xC7, 0x81, 0xDC, 0x3F, 0xB6, 0x70, 0x9B, 0xF1, 0x78, 0x9C,
+    0x63, 0x60, 0x60, 0x60, 0xF8, 0xF9, 0x7F, 0x3F, 0x90, 0x3C, 0xF8, 0x1F, 0x44, 0x19, 0xFC, 0x03,
+    0x53, 0xDF, 0xFE, 0x83, 0xA8, 0x05, 0xFF, 0x41, 0x94, 0xC2, 0x1F, 0x30, 0xF5, 0xE4, 0xFF, 0xFF,
+    0xF9, 0xFF, 0xFE, 0xEF, 0xFF, 0xF2, 0xFF, 0x3F, 0x07, 0x90, 0xD7, 0xF0, 0x3F, 0x9F, 0x01, 0xA4,
+    0xE4, 0x35, 0x33, 0x98, 0x12, 0x60, 0x00, 0x53, 0x0C, 0xF4, 0xA5, 0x00, 0x04, 0x37, 0x5C, 0xEC,
+    0x78, 0x9C, 0x63, 0x60, 0x70, 0x38, 0xF1, 0xEF, 0x7E, 0x35, 0x23, 0x03, 0x03, 0x43, 0xC0, 0xDF,
+    0xFF, 0x40, 0xD0, 0xCF, 0xC0, 0x20, 0xF0, 0xFB, 0x3F, 0x18, 0x70, 0x33, 0x3C, 0x82, 0x30, 0xFE,
+    0xCF, 0x67, 0x78, 0x08, 0x24, 0xEF, 0xFD, 0x03, 0x12, 0x4C, 0x06, 0xFF, 0xFF, 0x5B, 0x31, 0x18,
+    0x00, 0xD5, 0xB2, 0x33, 0x7C, 0xB5, 0x05, 0x6A, 0xFB, 0xF2, 0xFF, 0x3F, 0x17, 0x83, 0x03, 0x90,
+    0xC1, 0xF0, 0x01, 0xA4, 0x85, 0x01, 0xCA, 0xE2, 0x84, 0xB0, 0x3E, 0xFF, 0xFF, 0xCF, 0x06, 0x61,
+    0xFD, 0xFA, 0xFF, 0x9F, 0x11, 0xCC, 0x70, 0xF8, 0xFF, 0x7F, 0x3D, 0x44, 0x08, 0x68, 0xA8, 0x3C,
+    0x98, 0x21, 0x00, 0x34, 0x8E, 0x15, 0xCC, 0x3A, 0x08, 0x76, 0x01, 0x48, 0xE8, 0x0F, 0xCC, 0x8C,
+    0x83, 0x20, 0xFB, 0x61, 0x42, 0x1C, 0x60, 0xD6, 0xC5, 0xFF, 0xFF, 0xF3, 0xD1, 0x34, 0x02, 0x85,
+    0xFC, 0x61, 0x42, 0xEF, 0x99, 0x61, 0x42, 0xFF, 0xEF, 0x82, 0x40, 0xEE, 0x77, 0xA8, 0x3F, 0xFE,
+    0xD7, 0xE3, 0x67, 0x01, 0x00, 0xD9, 0x37, 0x87, 0xDF, 0x78, 0x9C, 0x35, 0xCF, 0xBD, 0x0E, 0x01,
+    0x51, 0x10, 0x05, 0xE0, 0xB3, 0xC2, 0x16, 0xB2, 0x09, 0x2F, 0x20, 0x4A, 0x95, 0xE0, 0x0D, 0xB6,
+    0x14, 0x4F, 0x21, 0x0A, 0x1D, 0x8D, 0x52, 0xAB, 0x57, 0x8A, 0x86, 0x5A, 0xA5, 0x57, 0xAC, 0x47,
+    0x58, 0x1D, 0x11, 0xF1, 0x13, 0x91, 0xE8, 0x44, 0xFC, 0xAD, 0x60, 0x8F, 0xD9, 0x9D, 0xDD, 0xD3,
+    0xCC, 0x97, 0xCC, 0xBD, 0x73, 0xEF, 0x00, 0xBD, 0x0D, 0xB7, 0x5D, 0x03, 0xC0, 0x99, 0x41, 0xC6,
+    0x06, 0x8E, 0xD4, 0xE4, 0x70, 0x88, 0x34, 0x87, 0x4D, 0xBA, 0xB3, 0x9F, 0x30, 0x81, 0x77, 0x0B,
+    0x28, 0xFB, 0x64, 0x0A, 0x75, 0xB9, 0x85, 0x17, 0x69, 0x22, 0xCC, 0x9D, 0x4C, 0xAA, 0x1E, 0xA4,
+    0xA1, 0xFA, 0xB1, 0x1F, 0xD6, 0xCA, 0x92, 0xB4, 0xA4, 0x3E, 0x83, 0x71, 0x53, 0x44, 0x1A, 0x25,
+    0x62, 0xED, 0x6A, 0xB1, 0xC8, 0xA2, 0xA8, 0xD1, 0x1C, 0x7C, 0xC9, 0x4B, 0xD8, 0x47, 0xF6, 0x43,
+    0xA6, 0x75, 0xDE, 0x95, 0xCC, 0xA8, 0x16, 0x64, 0x49, 0xB5, 0x17, 0xE9, 0x73, 0x37, 0x32, 0xBF,
+    0x2A, 0x08, 0x6C, 0xF9, 0x9F, 0xE5, 0xD1, 0x19, 0x4E, 0x04, 0x34, 0xBD, 0x68, 0x0F, 0x17, 0xB1,
+    0x2C, 0x9C, 0x14, 0x6D, 0x39, 0xDD, 0x59, 0xFB, 0x74, 0xAA, 0x82, 0x3F, 0x66, 0x64, 0x88, 0x88,
+    0x78, 0x9C, 0x63, 0x60, 0x00, 0x81, 0x3F, 0xFF, 0xEF, 0x33, 0x40, 0x40, 0xC1, 0x7F, 0x38, 0xF3,
+    0x13, 0x82, 0xF9, 0x17, 0xCE, 0x6C, 0xF8, 0x0F, 0x67, 0x7E, 0x46, 0x30, 0xFF, 0xFE, 0xFF, 0x07,
+    0x65, 0x36, 0xFC, 0xBF, 0xFF, 0x13, 0xCA, 0xFC, 0xFC, 0xDF, 0xFF, 0x17, 0x94, 0xF9, 0xF7, 0x3F,
+    0xD7, 0x6F, 0x08, 0x73, 0xC2, 0xFF, 0xF7, 0x8C, 0x50, 0xE6, 0x97, 0xFF, 0xF1, 0x50, 0x8B, 0x05,
+    0xFE, 0xFD, 0xE7, 0x86, 0x32, 0x17, 0x00, 0xE5, 0xA1, 0xCC, 0xAF, 0x40, 0x79, 0x08, 0x13, 0x2C,
+    0x0F, 0x61, 0x82, 0xE5, 0x21, 0xCC, 0x2F, 0xFF, 0x61, 0x40, 0xFE, 0x2B, 0x21, 0x66, 0x51, 0x39,
+    0x08, 0xFC, 0xFD, 0xFF, 0xBE, 0x9C, 0x9D, 0x01, 0xCD, 0xC7, 0x44, 0x32, 0x01, 0xC8, 0x49, 0x8C,
+    0x03, 0x78, 0x9C, 0x3D, 0xCD, 0x3F, 0x0E, 0x01, 0x41, 0x18, 0x05, 0xF0, 0x27, 0x6C, 0x23, 0xC1,
+    0x5E, 0xC0, 0x9F, 0x4E, 0xA1, 0xE0, 0x06, 0xB4, 0xAA, 0x75, 0x04, 0x37, 0x50, 0xB8, 0x80, 0x23,
+    0x38, 0x80, 0x1B, 0xE0, 0x0C, 0xAB, 0xD6, 0x88, 0x5A, 0x64, 0xDD, 0x60, 0x92, 0x09, 0xC5, 0x06,
+    0xF3, 0xCC, 0x7A, 0x93, 0x79, 0xD5, 0x2F, 0x33, 0xDF, 0xF7, 0x3E, 0x94, 0xFC, 0x67, 0x0C, 0xBC,
+    0xA3, 0x3E, 0x51, 0xDF, 0x28, 0x47, 0x73, 0xF7, 0xE9, 0x02, 0xE4, 0x0A, 0x0A, 0x99, 0x09, 0x03,
+    0x72, 0x2A, 0x4D, 0xC8, 0xBE, 0x34, 0x23, 0x3B, 0xD2, 0x82, 0xCC, 0x9D, 0xD9, 0xD5, 0x81, 0xA5,
+    0xEA, 0xF2, 0x1A, 0x36, 0x12, 0x7B, 0xD8, 0x06, 0x5D, 0x90, 0x96, 0xC5, 0xE1, 0x5C, 0xB1, 0x81,
+    0x14, 0x1A, 0x6E, 0xAA, 0xE1, 0x49, 0xB6, 0xA4, 0x47, 0x6C, 0x3D, 0x91, 0xED, 0xF8, 0x16, 0x7E,
+    0x5F, 0x7E, 0xC3, 0xCE, 0xC3, 0x6E, 0x62, 0x69, 0xF6, 0x55, 0x5F, 0x01, 0x1B, 0x6E, 0x64, 0x51,
+    0x09, 0xAE, 0xC2, 0xC8, 0x4F, 0xAF, 0x6F, 0xCE, 0x1C, 0x87, 0x1E, 0x3F, 0x75, 0x93, 0x8C, 0xD4,
+    0x78, 0x9C, 0x35, 0x8E, 0x3D, 0x0E, 0x01, 0x51, 0x14, 0x85, 0xCF, 0x10, 0x42, 0x82, 0xCC, 0x12,
+    0xAC, 0x00, 0xAD, 0xCA, 0x12, 0xD8, 0x01, 0xB1, 0x01, 0x6A, 0x12, 0x54, 0x42, 0xA2, 0xB0, 0x03,
+    0x0A, 0x5A, 0x63, 0x07, 0x1A, 0x8D, 0x6A, 0x7A, 0xCD, 0x90, 0xE8, 0x47, 0xFC, 0x8C, 0x9F, 0x98,
+    0x39, 0xEE, 0x7B, 0x8F, 0x5B, 0xBC, 0xFB, 0xE5, 0x9E, 0x73, 0xEF, 0x3B, 0x00, 0xD0, 0xDC, 0x47,
+    0xEC, 0x49, 0xC7, 0x96, 0x52, 0x33, 0x81, 0x39, 0x7F, 0x64, 0x7F, 0xFE, 0xB4, 0x96, 0xE6, 0x8E,
+    0x47, 0x1D, 0x20, 0x20, 0x5B, 0xD0, 0x15, 0xD1, 0x8B, 0x69, 0xA8, 0x91, 0x15, 0x33, 0x12, 0x5B,
+    0xCA, 0xD0, 0x99, 0x34, 0x22, 0x2E, 0xF4, 0xB1, 0x08, 0xBD, 0xB2, 0x5A, 0x75, 0xF5, 0xE9, 0x34,
+    0x1E, 0x74, 0xDE, 0x8A, 0x1C, 0x3C, 0xF9, 0xAB, 0xE4, 0x4B, 0x9E, 0xEE, 0x30, 0x22, 0xB3, 0x22,
+    0x55, 0x81, 0x23, 0x59, 0x94, 0x59, 0x02, 0x68, 0x90, 0x75, 0xF1, 0x59, 0x40, 0x9E, 0xEC, 0x07,
+    0x9A, 0x6C, 0xA1, 0xAB, 0x56, 0x4B, 0xA2, 0x1E, 0xC8, 0x0C, 0x30, 0x95, 0x1C, 0x03, 0x75, 0x14,
+    0x37, 0x32, 0x27, 0x0E, 0xAE, 0x76, 0x54, 0x89, 0xEE, 0xE6, 0x0B, 0x0F, 0x68, 0x1B, 0x2A, 0x48,
+    0xAE, 0x93, 0x82, 0x8D, 0xA5, 0x22, 0x2E, 0x43, 0x7F, 0x12, 0x07, 0xBE, 0x89, 0xF7, 0x97, 0xEE,
+    0x78, 0x9C, 0x7D, 0xCF, 0xC1, 0x0D, 0x82, 0x50, 0x10, 0x84, 0x61, 0x8D, 0x18, 0x0D, 0x18, 0x43,
+    0x07, 0xDA, 0x01, 0x25, 0x40, 0x27, 0xD0, 0x81, 0x25, 0x60, 0x09, 0x74, 0x60, 0x09, 0xD8, 0x89,
+    0x36, 0x60, 0xA4, 0x01, 0x0E, 0x62, 0x4C, 0x88, 0x51, 0x7F, 0x5F, 0x76, 0x7C, 0xEF, 0xE8, 0x9C,
+    0xBE, 0xEC, 0x61, 0x26, 0x0B, 0xBF, 0xD4, 0xFC, 0xD5, 0xC5, 0xD2, 0xC3, 0x66, 0x62, 0xE9, 0x20,
+    0x96, 0x1E, 0x30, 0x93, 0xDE, 0x9C, 0x84, 0x02, 0x4A, 0xE9, 0x08, 0x6B, 0xE9, 0x0E, 0x0B, 0xE9,
+    0x09, 0x53, 0xC3, 0x16, 0x0E, 0x3A, 0x35, 0x90, 0x49, 0x37, 0x48, 0xA4, 0x11, 0x22, 0xE9, 0xC3,
+    0x55, 0xA8, 0x60, 0x27, 0x9D, 0x43, 0xAF, 0x9B, 0x5F, 0x4A, 0x2F, 0xDF, 0xEB, 0xE6, 0xDB, 0x30,
+    0x9F, 0x4B, 0x03, 0xAC, 0xC2, 0xFC, 0xDC, 0x90, 0xE2, 0x7B, 0xF7, 0xEE, 0x41, 0xC3, 0x17, 0x6F,
+    0x49, 0x6D, 0xAA, 0x78, 0x9C, 0x2D, 0x8E, 0x3D, 0x0E, 0x01, 0x51, 0x14, 0x85, 0x0F, 0xE3, 0x2F,
+    0x7E, 0x92, 0xD9, 0x00, 0xD1, 0x2B, 0xA8, 0xB4, 0x34, 0x6A, 0x4B, 0x40, 0x62, 0x01, 0x56, 0x80,
+    0x42, 0x47, 0x62, 0x0B, 0xB3, 0x83, 0xB1, 0x03, 0x94, 0xAA, 0xE9, 0x35, 0x44, 0x24, 0xCA, 0x11,
+    0xC4, 0x64, 0x12, 0xE6, 0x38, 0x6F, 0xC6, 0xAD, 0xBE, 0x77, 0x73, 0xDE, 0x77, 0x2E, 0xD0, 0x3A,
+    0x44, 0xFE, 0x32, 0x0D, 0xA0, 0xFE, 0xA1, 0xC6, 0x4D, 0x01, 0x2F, 0xC6, 0x53, 0x85, 0x1D, 0x25,
+    0xB4, 0xC5, 0x84, 0x3C, 0xB5, 0x17, 0x42, 0x6B, 0x43, 0xD6, 0xE2, 0x48, 0x6E, 0x47, 0x16, 0x81,
+    0x33, 0x59, 0xD0, 0xAE, 0x04, 0xDC, 0xB5, 0x53, 0xAE, 0x09, 0xBC, 0xC9, 0xB4, 0x4D, 0xFA, 0x19,
+    0x3D, 0xDD, 0xF8, 0xE9, 0x7D, 0x8D, 0xCF, 0x68, 0x8C, 0x4E, 0x1D, 0xB8, 0x1A, 0xCA, 0x09, 0x70,
+    0x33, 0xD4, 0x10, 0xEC, 0x93, 0xB6, 0x2C, 0x6C, 0xA5, 0xA7, 0x3A, 0x67, 0x06, 0x99, 0xD7, 0x18,
+    0x6A, 0x99, 0x79, 0x90, 0x79, 0xE0, 0x42, 0x56, 0x02, 0xFA, 0x0A, 0x77, 0xC9, 0x4E, 0x68, 0xEC,
+    0x00, 0x39, 0x08, 0xE9, 0x09, 0xD4, 0xD9, 0x0F, 0x8C, 0x00, 0x8E, 0xEE, 0x78, 0xAA, 0xA9, 0x37,
+    0x96, 0xA6, 0xEC, 0xF0, 0x3F, 0x96, 0xFD, 0x49, 0x60, 0x00, 0xCC, 0x63, 0xF0, 0x2C, 0xFD, 0x1B,
+    0x1D, 0x23, 0x7F, 0x25, 0xF8, 0x01, 0x3E, 0xAA, 0xA3, 0xD7, 0x78, 0x9C, 0x35, 0x8E, 0x31, 0x4E,
+    0xC3, 0x50, 0x10, 0x44, 0x07, 0x39, 0x92, 0x45, 0x90, 0x2C, 0x37, 0x88, 0x22, 0x12, 0xA1, 0xA6,
+    0x20, 0xB4, 0xAE, 0xE0, 0x06, 0xF6, 0x0D, 0x9C, 0x8E, 0x92, 0x36, 0x65, 0x8E, 0x11, 0xA5, 0x81,
+    0x1E, 0x24, 0x68, 0xA8, 0xE1, 0x04, 0x09, 0xA2, 0x82, 0xCA, 0x07, 0x48, 0x11, 0x09, 0x24, 0x9C,
+    0x60, 0xC7, 0x8F, 0xFD, 0xDF, 0xF1, 0x14, 0xFF, 0x3F, 0x69, 0x67, 0x66, 0x57, 0xCA, 0xBE, 0x9A,
+    0x45, 0x22, 0xD3, 0xF5, 0x0E, 0xD3, 0xC0, 0xE8, 0xD7, 0x01, 0xEB, 0x40, 0x97, 0xB4, 0x3A, 0xD5,
+    0x9B, 0xBD, 0x0F, 0x15, 0xBC, 0xEA, 0x07, 0x2E, 0x74, 0x66, 0xDE, 0x60, 0x03, 0x3D, 0xE9, 0x1B,
+    0x0E, 0xFF, 0xC0, 0x62, 0xF7, 0x10, 0xD5, 0x14, 0x46, 0x63, 0x18, 0x56, 0x9E, 0x32, 0x48, 0x6D,
+    0x7A, 0xE0, 0xA7, 0x79, 0x09, 0x7D, 0xC9, 0x72, 0xB9, 0xA5, 0x96, 0x37, 0x9F, 0x56, 0x9A, 0x3F,
+    0xEF, 0x77, 0x90, 0xC6, 0x8D, 0xFB, 0x6E, 0xE1, 0x4A, 0x1F, 0x8E, 0x4E, 0xAC, 0x45, 0x7A, 0x69,
+    0x8A, 0xC4, 0xEE, 0x88, 0xE4, 0x35, 0x85, 0xA3, 0x96, 0xDE, 0x21, 0x6C, 0xA9, 0xF4, 0xFD, 0xED,
+    0xB2, 0x27, 0x0F, 0xF1, 0x16, 0x46, 0xD2, 0x7C, 0x32, 0xAB, 0xF1, 0x36, 0xDF, 0xCC, 0x9D, 0x3A,
+    0x0A, 0x3B, 0x3A, 0x77, 0xF6, 0x15, 0xC5, 0xE3, 0xB1, 0x83, 0x7F, 0x7A, 0xC7, 0x96, 0x3F, 0x78,
+    0x9C, 0x2B, 0xF8, 0x1B, 0xCB, 0xF0, 0xED, 0xFF, 0x7F, 0x96, 0xDF, 0xFF, 0xFF, 0x73, 0xFE, 0x01,
+    0xE2, 0x1F, 0xFF, 0xFF, 0xB3, 0x1D, 0xFC, 0xBF, 0x9E, 0x81, 0xC1, 0x89, 0x89, 0x01, 0x2F, 0x00,
+    0xCA, 0x83, 0xD4, 0xFD, 0x04, 0xAA, 0x07, 0xE9, 0x03, 0xE9, 0x07, 0x9A, 0xC3, 0x5C, 0x00, 0x34,
+    0x0F, 0x00, 0x87, 0xFA, 0x20, 0xED, 0x78, 0x9C, 0x63, 0xB8, 0x7E, 0x9F, 0x35, 0xE1, 0xFF, 0x7F,
+    0xFF, 0x0D, 0xFF, 0xFF, 0xCF, 0x3F, 0x00, 0xC4, 0x0D, 0xFF, 0xFF, 0xE7, 0x0B, 0xFC, 0xF9, 0xCF,
+    0xC5, 0xA0, 0xA0, 0xC2, 0x40, 0x34, 0x00, 0xEA, 0x31, 0xF8, 0xFF, 0x5F, 0x1F, 0x68, 0x0E, 0xEF,
+    0x84, 0xFF, 0xFF, 0x39, 0x80, 0xE6, 0x30, 0x7D, 0xF8, 0x7F, 0x9E, 0xE1, 0xCB, 0xFF, 0x78, 0x86,
+    0xEF, 0xFF, 0xF9, 0x18, 0x7E, 0xFF, 0x67, 0x67, 0x00, 0x00, 0x84, 0x3B, 0x25, 0xF9, 0x78, 0x9C,
+    0x63, 0x60, 0x80, 0x00, 0x01, 0x0E, 0x18, 0xE3, 0x87, 0x3C, 0x8C, 0xF1, 0x5F, 0x1E, 0xC6, 0x80,
+    0xB0, 0x40, 0x8C, 0xFF, 0xBC, 0x30, 0x46, 0x0C, 0x8C, 0xE1, 0x0D, 0x63, 0x58, 0xC1, 0x18, 0x9A,
+    0x20, 0xD5, 0x5F, 0xFE, 0xFF, 0x7F, 0x2F, 0x01, 0x36, 0xE0, 0xEB, 0xFF, 0xFF, 0xB2, 0x0C, 0x30,
+    0xD6, 0x7F, 0x4B, 0x30, 0x2B, 0xE1, 0x2F, 0x90, 0x99, 0x03, 0x66, 0x3A, 0xFC, 0x06, 0x32, 0xE7,
+    0x31, 0x81, 0x98, 0x0A, 0x3F, 0x81, 0xCC, 0xFD, 0xAC, 0x60, 0xCB, 0x9E, 0x03, 0x99, 0xEF, 0x21,
+    0xAE, 0xBA, 0xF6, 0x1F, 0xEA, 0x02, 0x06, 0x86, 0x2D, 0x70, 0x16, 0xC3, 0x24, 0x38, 0x8B, 0xA1,
+    0x50, 0x8E, 0x01, 0x0E, 0x00, 0xEC, 0xBB, 0x43, 0x54, 0x78, 0x9C, 0xFB, 0xFA, 0x1F, 0x0A, 0xE4,
+    0xBF, 0xE2, 0x65, 0x09, 0x08, 0x42, 0x01, 0x23, 0x03, 0x1C, 0x20, 0xC4, 0xF0, 0xEB, 0x45, 0xB0,
+    0x00, 0x13, 0x24, 0x49, 0x93, 0x78, 0x9C, 0x4B, 0x61, 0x80, 0x81, 0xAF, 0x79, 0x70, 0xD6, 0xFF,
+    0x3C, 0x38, 0x0B, 0xC6, 0xFC, 0xF2, 0x1F, 0xC6, 0x14, 0x78, 0x0E, 0x67, 0x32, 0x5C, 0x43, 0x30,
+    0x8F, 0x22, 0x98, 0x5B, 0x10, 0xCC, 0xC5, 0x40, 0x26, 0x1F, 0xDC, 0x04, 0x79, 0x30, 0x63, 0xEB,
+    0x7F, 0x08, 0x4B, 0xE0, 0x05, 0x90, 0xB1, 0x9F, 0x85, 0x81, 0xC1, 0xE1, 0x37, 0x90, 0x31, 0x9F,
+    0x89, 0x81, 0xA1, 0xF0, 0x2F, 0x90, 0x51, 0xC7, 0xC8, 0xC0, 0xB0, 0x08, 0x48, 0xFF, 0x8F, 0x81,
+    0xBA, 0xE0, 0xBF, 0x37, 0xCC, 0x2D, 0x9A, 0x50, 0x57, 0xBD, 0x67, 0x87, 0xBA, 0xEF, 0x28, 0x2B,
+    0x03, 0x06, 0x00, 0x00, 0xEA, 0x34, 0x44, 0xEF, 0x78, 0x9C, 0x85, 0x8F, 0x3D, 0x0E, 0x01, 0x61,
+    0x10, 0x86, 0x5F, 0xBB, 0x11, 0x44, 0x82, 0x5A, 0xA5, 0x53, 0xDA, 0x23, 0xAC, 0x1B, 0xEC, 0x0D,
+    0x1C, 0xC1, 0x15, 0x9C, 0x44, 0x54, 0x12, 0x89, 0xC2, 0x09, 0xD8, 0x1B, 0x70, 0x03, 0x1A, 0xA5,
+    0x88, 0xF8, 0x29, 0xD8, 0x78, 0x7C, 0x33, 0x4B, 0xED, 0x6D, 0x9E, 0x27, 0x93, 0x6F, 0xBE, 0x99,
+    0x51, 0x6F, 0x7E, 0x62, 0xDD, 0x97, 0xB2, 0x02, 0x4B, 0x43, 0x4F, 0x27, 0x5B, 0xDD, 0x4A, 0xA1,
+    0x9E, 0xC3, 0x72, 0xF1, 0x86, 0x56, 0xBA, 0xA9, 0x4A, 0x33, 0x18, 0x28, 0x92, 0x94, 0x98, 0x58,
+    0x52, 0x68, 0xBB, 0x84, 0x87, 0x4D, 0x63, 0x27, 0xFC, 0x15, 0x9B, 0x1C, 0x61, 0x64, 0x0C, 0x3D,
+    0x67, 0x2F, 0xBC, 0xA0, 0x6B, 0xCC, 0x60, 0xEC, 0x2D, 0x2B, 0xA8, 0xB9, 0xEC, 0xA0, 0xE2, 0x72,
+    0x00, 0xFD, 0xCD, 0x30, 0x2E, 0x39, 0x61, 0x1F, 0xB9, 0x5C, 0xBF, 0xA3, 0xF5, 0xF8, 0x2D, 0x73,
+    0x0F, 0x0B, 0xBB, 0x5C, 0xEC, 0x2A, 0x4B, 0x52, 0x4C, 0x0D, 0x1F, 0xDA, 0x5A, 0x54, 0x7A, 0x78,
+    0x9C, 0x4D, 0x51, 0x3D, 0x4F, 0xC2, 0x50, 0x14, 0xBD, 0x94, 0x12, 0x09, 0x06, 0xE9, 0x66, 0x5C,
+    0x2C, 0xBF, 0xC0, 0xF2, 0x0B, 0xC0, 0x7F, 0xA0, 0x6E, 0x6E, 0x6C, 0xC6, 0x0D, 0x5D, 0x89, 0x09,
+    0x1D, 0x1C, 0xDC, 0xD8, 0x8D, 0x89, 0x4E, 0x26, 0x4E, 0xB0, 0x3A, 0x68, 0x75, 0x72, 0xB3, 0xCE,
+    0xC6, 0x08, 0x6E, 0x12, 0x49, 0x0A, 0x8A, 0x1F, 0x25, 0xB4, 0xC7, 0xF3, 0x5E, 0xEB, 0xC7, 0x49,
+    0x5E, 0x6F, 0xCF, 0xBD, 0xA7, 0xE7, 0x9D, 0xDC, 0x8A, 0x10, 0xD6, 0xE9, 0x10, 0x8F, 0x4D, 0x43,
+    0x52, 0xAC, 0xCE, 0xA0, 0xE0, 0xE7, 0x12, 0x5A, 0x4E, 0x28, 0xE0, 0x65, 0x34, 0xFF, 0xE0, 0xEB,
+    0xD1, 0xC1, 0x39, 0x9F, 0x55, 0x45, 0x5D, 0xA0, 0x63, 0xB2, 0xAE, 0xCF, 0x10, 0x18, 0x7A, 0xEC,
+    0x67, 0xB5, 0x6E, 0x07, 0x28, 0x8A, 0x54, 0x80, 0x42, 0xEA, 0xFB, 0x8E, 0x96, 0xC8, 0x1D, 0x7C,
+    0x91, 0xDD, 0x17, 0xDC, 0x36, 0x4D, 0x17, 0x81, 0x6A, 0xDA, 0x4A, 0x49, 0xB4, 0x25, 0x46, 0x4E,
+    0x22, 0xCC, 0xC9, 0x54, 0xF3, 0x96, 0x7C, 0xA1, 0xC0, 0xCF, 0xD5, 0x0D, 0xC7, 0x5B, 0xCF, 0x68,
+    0xC8, 0x1B, 0x16, 0x5C, 0x74, 0xE4, 0x15, 0x7E, 0x86, 0x3E, 0x0D, 0x19, 0xC1, 0xEE, 0xB2, 0x84,
+    0x58, 0x16, 0xE9, 0xA3, 0xCE, 0xE3, 0xF4, 0x51, 0xA3, 0x45, 0x5E, 0x38, 0x5B, 0x53, 0x9C, 0x12,
+    0x01, 0x4C, 0xC5, 0x6B, 0xE4, 0xF6, 0x18, 0x25, 0x0B, 0x60, 0xC0, 0x31, 0xF9, 0x08, 0x25, 0xF2,
+    0x64, 0x3E, 0x81, 0x43, 0xE3, 0xA2, 0xD2, 0xC7, 0x8C, 0x40, 0x53, 0x47, 0x3E, 0x91, 0x57, 0x7E,
+    0x53, 0xFA, 0x33, 0x47, 0x9D, 0xC6, 0xD9, 0x2B, 0xC6, 0x9A, 0x20, 0xD8, 0x0E, 0x81, 0xDE, 0x0D,
+    0x3C, 0x66, 0xF3, 0xE4, 0x44, 0xC7, 0x8D, 0x78, 0x56, 0x94, 0xCE, 0xD0, 0xF9, 0xAB, 0x4F, 0x40,
+    0xC0, 0x7B, 0x22, 0xCC, 0x4B, 0xE5, 0x1E, 0x7B, 0x62, 0x0D, 0x7A, 0x4B, 0x7A, 0x09, 0x6D, 0xF9,
+    0x8F, 0xEE, 0xDF, 0x7E, 0x92, 0xF5, 0x46, 0x08, 0x16, 0x55, 0xDD, 0x18, 0x24, 0xFD, 0x6B, 0x9A,
+    0x5D, 0x1E, 0x9E, 0x0D, 0x7F, 0x75, 0x61, 0xFA, 0x3B, 0x7E, 0x78, 0x39, 0x6D, 0x78, 0x66, 0xEA,
+    0x63, 0xED, 0x3F, 0xC4, 0xC1, 0xC5, 0xA6, 0xB6, 0xFB, 0x06, 0xC7, 0x68, 0xE8, 0x4D, 0x78, 0x9C,
+    0x3D, 0xCF, 0xDB, 0x11, 0x01, 0x31, 0x14, 0xC6, 0xF1, 0xB8, 0x8F, 0xBB, 0x0E, 0xE8, 0x40, 0x09,
+    0xBC, 0x79, 0x54, 0x02, 0x1D, 0xD0, 0x01, 0x05, 0x98, 0xA1, 0x03, 0x3A, 0xA0, 0x04, 0x1D, 0xD0,
+    0x80, 0xA1, 0x83, 0x65, 0x58, 0x3B, 0x6E, 0xFB, 0x77, 0x4E, 0x36, 0x9B, 0xEF, 0x61, 0xB3, 0xBF,
+    0x4C, 0x72, 0x72, 0x8E, 0x31, 0xC6, 0xAC, 0x80, 0x9A, 0x49, 0x73, 0x11, 0x75, 0xBD, 0x1E, 0xA2,
+    0x99, 0xD7, 0x5B, 0x74, 0xF6, 0x92, 0x7F, 0xC8, 0x39, 0x8C, 0x61, 0x01, 0x65, 0xA7, 0x1D, 0x0C,
+    0xA0, 0xE1, 0x74, 0x93, 0x63, 0x31, 0x43, 0xA7, 0x88, 0x40, 0x0A, 0x6D, 0x9D, 0xBE, 0xAC, 0x4D,
+    0x08, 0x09, 0x3A, 0xC8, 0xA9, 0x2B, 0x14, 0xAC, 0xE6, 0xD0, 0xD4, 0x4A, 0x55, 0xAB, 0x23, 0x54,
+    0xF4, 0x95, 0xB6, 0xD5, 0x1D, 0x8A, 0xA6, 0x05, 0x13, 0xAB, 0x17, 0x64, 0xB4, 0xD4, 0xC1, 0x2A,
+    0xB6, 0x6B, 0x04, 0x59, 0x59, 0xFA, 0xA4, 0x29, 0x89, 0x36, 0x5E, 0x75, 0xD1, 0xD5, 0xAB, 0x27,
+    0x0A, 0xBD, 0x96, 0xA2, 0x0F, 0x9C, 0x34, 0x48, 0xB7, 0xFA, 0x50, 0x60, 0x4B, 0xCB, 0x6E, 0x5E,
+    0x9B, 0x48, 0xBA, 0x7F, 0xEA, 0xC0, 0x7B, 0x18, 0xA5, 0x53, 0x36, 0x93, 0x8F, 0xC6, 0x6E, 0x47,
+    0xDA, 0xB3, 0x66, 0xAA, 0x57, 0x7E, 0xE9, 0x60, 0x32, 0x26, 0x99, 0x3F, 0xCB, 0xE0, 0xA7, 0x36,
+    0x78, 0x9C, 0xFB, 0xF9, 0x1F, 0x08, 0xDE, 0xAD, 0x11, 0x63, 0x60, 0x60, 0xF8, 0xF9, 0x1F, 0x02,
+    0xB4, 0x10, 0xCC, 0xFF, 0xCC, 0x08, 0x26, 0x1F, 0x88, 0xB9, 0x67, 0xF7, 0x1F, 0x20, 0x33, 0x1F,
+    0xC4, 0x64, 0x62, 0x60, 0x78, 0xF2, 0xFF, 0xFF, 0x7E, 0x28, 0x33, 0xE0, 0xFF, 0xFF, 0xF3, 0x50,
+    0xA6, 0x00, 0x82, 0xA9, 0x80, 0x50, 0x50, 0xF0, 0xFF, 0x7F, 0x3D, 0x84, 0x69, 0xF0, 0xE3, 0xFF,
+    0x7F, 0x79, 0x84, 0xB9, 0xAC, 0x70, 0xA6, 0x35, 0xDC, 0xE2, 0xF7, 0x96, 0x48, 0x6E, 0xE0, 0x04,
+    0x31, 0x67, 0xCD, 0xDC, 0x09, 0x64, 0xF6, 0x43, 0x0D, 0x6B, 0x00, 0xB2, 0x19, 0x21, 0x4C, 0x86,
+    0xDF, 0x40, 0x23, 0xA0, 0xCC, 0xEF, 0xFF, 0xFF, 0xB3, 0x43, 0x99, 0x40, 0x3B, 0x38, 0xA0, 0xCC,
+    0xBF, 0xFF, 0xFF, 0xB3, 0x41, 0x98, 0x9B, 0x40, 0x3E, 0x02, 0x32, 0xCF, 0x9C, 0x79, 0x03, 0x64,
+    0xDD, 0x47, 0x58, 0xE1, 0x8F, 0xCD, 0x39, 0x36, 0x30, 0x37, 0xEC, 0xB3, 0x00, 0x9A, 0x02, 0x00,
+    0xC2, 0x59, 0xC8, 0x56, 0x78, 0x9C, 0x65, 0x90, 0x31, 0x0A, 0xC2, 0x40, 0x10, 0x45, 0xBF, 0xAE,
+    0x28, 0x2A, 0x48, 0x1A, 0x6B, 0xAF, 0x90, 0x23, 0xE4, 0x1A, 0x9E, 0xC3, 0x03, 0xC4, 0x4B, 0x58,
+    0xEB, 0x0D, 0xB4, 0xB3, 0xF4, 0x04, 0xDA, 0xD8, 0x1A, 0x22, 0x56, 0x16, 0x4A, 0x10, 0x51, 0x62,
+    0x12, 0xFC, 0xCE, 0x64, 0x07, 0x2D, 0x7C, 0xC5, 0xF2, 0x60, 0xF7, 0xEF, 0xF0, 0x07, 0x00, 0x66,
+    0x17, 0xEE, 0xC6, 0x50, 0x72, 0x2A, 0x4B, 0x07, 0xEC, 0xE9, 0xE9, 0x21, 0x32, 0xA3, 0xC3, 0x49,
+    0xCE, 0x2C, 0x21, 0x53, 0xA0, 0x24, 0x37, 0x0E, 0xE1, 0x39, 0xAE, 0xEF, 0x3B, 0x1A, 0x1E, 0x62,
+    0x25, 0x59, 0x78, 0x6E, 0xE4, 0xC8, 0xF4, 0x41, 0xF6, 0x4D, 0x73, 0x7B, 0x2A, 0x14, 0x64, 0xCB,
+    0xB4, 0x22, 0x9B, 0xFF, 0x5A, 0xFE, 0xB4, 0xD0, 0xE1, 0x9E, 0x17, 0xD9, 0x36, 0x7D, 0x92, 0x5D,
+    0xD3, 0x3B, 0x39, 0x30, 0x3D, 0x92, 0xB1, 0xE9, 0x94, 0x36, 0x23, 0x40, 0x20, 0x3A, 0x97, 0xEF,
+    0x26, 0x87, 0x3A, 0xC7, 0x6C, 0xFB, 0xD6, 0x16, 0x0B, 0xAB, 0x96, 0x7E, 0xBB, 0xD7, 0x1A, 0x55,
+    0x7E, 0x0F, 0x9A, 0x0D, 0xD7, 0x57, 0xD9, 0x4E, 0x03, 0x1F, 0x7A, 0xF9, 0x7F, 0x7A, 0x78, 0x9C,
+    0x6D, 0xD0, 0xB1, 0x0D, 0xC2, 0x30, 0x10, 0x05, 0x50, 0xC7, 0x16, 0x20, 0x11, 0x40, 0x59, 0x84,
+    0x55, 0xA0, 0xCD, 0x16, 0xF4, 0x54, 0xD9, 0x28, 0x14, 0x74, 0x30, 0x42, 0x10, 0x1D, 0x25, 0x8C,
+    0x60, 0x85, 0x08, 0xA4, 0x20, 0x25, 0x9F, 0xEF, 0xE0, 0xD3, 0xA5, 0xE0, 0x1A, 0x3F, 0xDB, 0x67,
+    0x9F, 0xCF, 0x2D, 0x18, 0xF7, 0xBD, 0x33, 0x8C, 0x16, 0x43, 0x3C, 0x26, 0x6A, 0x5C, 0xAD, 0x1A,
+    0x9B, 0xC1, 0xE7, 0x53, 0x47, 0x7B, 0x1B, 0xCC, 0xDD, 0x23, 0x27, 0xCB, 0x68, 0xF3, 0x06, 0x76,
+    0xE2, 0x82, 0x49, 0x62, 0xD3, 0x03, 0x4E, 0xCC, 0x71, 0x26, 0x7E, 0x01, 0xA9, 0xF8, 0x09, 0x2C,
+    0xC4, 0x35, 0x2F, 0x1D, 0x79, 0xF5, 0x6F, 0xBD, 0x19, 0x9D, 0x65, 0xE1, 0xB9, 0xF8, 0x03, 0x4C,
+    0xA3, 0x33, 0x3E, 0xCE, 0x46, 0x1F, 0xD8, 0x8D, 0xBC, 0x87, 0x29, 0xDB, 0x9F, 0xB3, 0x1B, 0x53,
+    0xD2, 0xE0, 0xAA, 0xEA, 0x43, 0xF7, 0x89, 0xF6, 0xBB, 0xD6, 0xDE, 0x4B, 0xFD, 0x93, 0xD2, 0x45,
+    0xFB, 0x4B, 0x9E, 0x84, 0x7A, 0x5F, 0xDA, 0x1A, 0xBB, 0x18, 0x78, 0x9C, 0xFB, 0xF9, 0x1F, 0x02,
+    0x18, 0x7E, 0xE2, 0x65, 0xEC, 0xD9, 0x0D, 0x04, 0x20, 0x06, 0x13, 0x03, 0x08, 0x90, 0xCA, 0x00,
+    0x81, 0x78, 0x02, 0x0C, 0x90, 0x15, 0xD6, 0xE4, 0x5B, 0x71, 0x06, 0x04, 0x08, 0xF8, 0x02, 0xC2,
+    0x00, 0x00, 0x52, 0xF1, 0x94, 0x36, 0x78, 0x9C, 0xFB, 0xF9, 0x1F, 0x02, 0x7E, 0xE2, 0xA6, 0x77,
+    0x83, 0x00, 0x90, 0x66, 0x64, 0x00, 0x02, 0x32, 0x68, 0x10, 0xF0, 0xC7, 0x43, 0x83, 0x8C, 0xB7,
+    0xA6, 0xC0, 0x7C, 0xAC, 0x34, 0x00, 0xBE, 0x1C, 0x7C, 0x05, 0x78, 0x9C, 0x4D, 0xCF, 0x31, 0x0A,
+    0xC2, 0x30, 0x14, 0x06, 0xE0, 0xBF, 0x2D, 0x5A, 0x11, 0x94, 0xDE, 0xC0, 0x1E, 0xA1, 0xB3, 0x83,
+    0xB8, 0x39, 0x8A, 0xA3, 0xA7, 0xD0, 0x23, 0x78, 0x04, 0x6F, 0xE0, 0x20, 0x38, 0x09, 0xF5, 0x04,
+    0xEA, 0x2A, 0x54, 0x70, 0x73, 0x11, 0x3C, 0x81, 0x28, 0x5A, 0x8A, 0xB6, 0xD6, 0xDF, 0xBC, 0x36,
+    0x81, 0x3E, 0x08, 0xF9, 0x48, 0xDE, 0xFB, 0x43, 0x00, 0x60, 0x74, 0xC8, 0xB9, 0x1D, 0x5B, 0x4A,
+    0x58, 0xB2, 0xA8, 0xD0, 0x06, 0xE6, 0xD4, 0x65, 0xC1, 0xCB, 0x35, 0x43, 0x60, 0x2F, 0xFB, 0xF5,
+    0x42, 0x0E, 0x81, 0x54, 0xB1, 0x0B, 0xF8, 0xE7, 0x16, 0x02, 0xC5, 0x9E, 0x24, 0xC0, 0xC2, 0x46,
+    0xD9, 0x46, 0x59, 0x0F, 0x72, 0xA2, 0x89, 0x98, 0x6C, 0x1B, 0xBF, 0xC9, 0x86, 0xB1, 0x8A, 0xA9,
+    0x19, 0x67, 0xA4, 0x83, 0x7E, 0xF1, 0x98, 0xFB, 0x95, 0x18, 0xED, 0xAC, 0xE2, 0xB4, 0xD2, 0xF3,
+    0x21, 0xEB, 0x08, 0xA2, 0x48, 0xF5, 0xBA, 0x09, 0xD9, 0x94, 0x8C, 0xA7, 0xB2, 0x5A, 0x1D, 0xE3,
+    0x13, 0xB9, 0x30, 0x9E, 0xCA, 0x90, 0xB6, 0xF7, 0x23, 0x77, 0x0E, 0xF0, 0x92, 0xA3, 0x58, 0xE2,
+    0x8E, 0x79, 0x71, 0x3D, 0x33, 0x5F, 0x97, 0xD6, 0xA4, 0x62, 0x3F, 0x2D, 0x29, 0x53, 0xF0, 0x57,
+    0x37, 0xDE, 0xD7, 0x03, 0xE0, 0x0F, 0x36, 0x9C, 0xAF, 0x0E, 0x78, 0x9C, 0xFB, 0xF9, 0xFF, 0x3F,
+    0x13, 0x03, 0x10, 0x7C, 0xFC, 0xFF, 0x9F, 0xEB, 0xE7, 0xC0, 0xB1, 0x61, 0x80, 0x58, 0xF6, 0xD9,
+    0x33, 0x40, 0xF0, 0x67, 0x60, 0xDD, 0x0C, 0x67, 0x03, 0x00, 0xAD, 0xB0, 0xB8, 0xA9, 0x78, 0x9C,
+    0xFB, 0xF9, 0xFF, 0x3F, 0xD3, 0x4F, 0x3A, 0x61, 0x00, 0x3E, 0xC2, 0x50, 0x44, 0x78, 0x9C, 0xD5,
+    0xCA, 0xA1, 0x0D, 0x80, 0x30, 0x14, 0x00, 0xD1, 0xFB, 0x58, 0x56, 0x40, 0xB0, 0x09, 0x9A, 0x29,
+    0xD9, 0xA9, 0xAA, 0x0A, 0x26, 0x20, 0x68, 0x08, 0xCD, 0xF1, 0xD3, 0x2D, 0x30, 0xF7, 0xCC, 0x01,
+    0xB7, 0x0E, 0xFC, 0x8E, 0x47, 0x23, 0x79, 0x35, 0x3B, 0xEB, 0x41, 0x50, 0x74, 0xA3, 0x9D, 0xEA,
+    0x42, 0xCB, 0x3A, 0x76, 0xAE, 0xE8, 0x4C, 0x50, 0xDD, 0xD7, 0xDC, 0x3F, 0x7D, 0x53, 0x6F, 0xD3,
+    0x78, 0x9C, 0x4D, 0xD0, 0xDD, 0x09, 0xC2, 0x30, 0x18, 0x85, 0xE1, 0x4F, 0xED, 0x8D, 0x8A, 0x8E,
+    0xA0, 0x1B, 0x88, 0x23, 0xB8, 0x81, 0x6E, 0x62, 0x37, 0x28, 0x38, 0x41, 0x37, 0x70, 0x04, 0x47,
+    0x70, 0x04, 0xDD, 0x40, 0x9C, 0x40, 0xB0, 0x20, 0xB4, 0xFE, 0xBC, 0xA6, 0xC9, 0xF9, 0x20, 0xB9,
+    0x7A, 0x6E, 0x5E, 0x92, 0x93, 0x16, 0x86, 0x66, 0x56, 0xC3, 0xD9, 0xDA, 0xE4, 0x17, 0x2C, 0xE4,
+    0x35, 0x30, 0x92, 0xEF, 0xB0, 0x37, 0xF9, 0x03, 0x63, 0x39, 0x94, 0x17, 0x93, 0x63, 0x99, 0x9C,
+    0xCA, 0xE4, 0x50, 0x56, 0x26, 0x87, 0x72, 0x22, 0x1F, 0xE0, 0x66, 0x72, 0x28, 0x57, 0xEE, 0x70,
+    0x96, 0x99, 0x4F, 0x99, 0x29, 0xDC, 0x3F, 0x98, 0xCB, 0xD5, 0x15, 0x8E, 0x72, 0xB1, 0xC9, 0xEE,
+    0xB5, 0x0E, 0x66, 0x6E, 0x3D, 0x22, 0x7A, 0x47, 0x5C, 0x91, 0xB6, 0xBC, 0x61, 0xEA, 0x7E, 0x66,
+    0x1B, 0x4B, 0x78, 0x0C, 0xFC, 0x4F, 0xBE, 0xFD, 0xB3, 0xE5, 0x06, 0xB6, 0xEE, 0xBA, 0xDF, 0xF0,
+    0x07, 0x75, 0x9A, 0xA9, 0xBC, 0x78, 0x9C, 0xFB, 0xF9, 0xFF, 0x3F, 0x13, 0x03, 0x08, 0xFC, 0x1C,
+    0xE2, 0x8C, 0x33, 0x20, 0xA0, 0x03, 0x64, 0x80, 0x81, 0x3E, 0x1E, 0x06, 0x00, 0x3F, 0x17, 0x69,
+    0x0A, 0x78, 0x9C, 0x45, 0xD0, 0xD1, 0x0D, 0x82, 0x30, 0x10, 0xC6, 0xF1, 0xC6, 0xA0, 0x46, 0x34,
+    0xE0, 0x06, 0xAE, 0xC0, 0x06, 0xBA, 0x81, 0x23, 0xE0, 0x06, 0x8C, 0x20, 0x1B, 0xD4, 0x0D, 0x1C,
+    0x01, 0x37, 0x70, 0x05, 0x5E, 0x7C, 0xC6, 0x0D, 0x34, 0x18, 0x83, 0x68, 0xE1, 0xF3, 0xEE, 0xCA,
+    0x29, 0x0F, 0x0D, 0xBF, 0x92, 0xFC, 0x5B, 0xAE, 0x05, 0x30, 0x31, 0xFC, 0x1C, 0xE8, 0x2D, 0x6B,
+    0x69, 0x99, 0x0B, 0xAF, 0xCA, 0x58, 0xF8, 0x50, 0xA6, 0xC2, 0x56, 0x59, 0x08, 0x7B, 0x25, 0x58,
+    0x09, 0x3C, 0x0B, 0x20, 0x90, 0xF0, 0xED, 0xC3, 0xCC, 0x80, 0x99, 0x84, 0x8F, 0xC2, 0xD4, 0x21,
+    0x92, 0xF0, 0xD6, 0xC9, 0xD7, 0x06, 0x6B, 0xE2, 0x0B, 0x51, 0x27, 0xAC, 0x61, 0x25, 0x1C, 0x0A,
+    0xF7, 0x25, 0x2A, 0x09, 0x07, 0x3D, 0xD3, 0xD2, 0x65, 0x47, 0x26, 0xA7, 0xE3, 0x3C, 0x37, 0xC0,
+    0xD4, 0x94, 0x74, 0x19, 0x39, 0xD7, 0xD2, 0xEE, 0x82, 0xC3, 0xCA, 0x37, 0x56, 0x14, 0x8E, 0x95,
+    0x4F, 0x64, 0xA6, 0x43, 0xA8, 0xBC, 0xE3, 0x4C, 0xE1, 0xB1, 0xF2, 0x04, 0x70, 0x58, 0xB9, 0x03,
+    0x2E, 0xFC, 0x97, 0x03, 0x97, 0x80, 0xE3, 0x19, 0x0C, 0x34, 0xCE, 0x4F, 0x48, 0xD9, 0x10, 0xC3,
+    0x3F, 0x6B, 0x70, 0xF8, 0xC7, 0xD2, 0x0F, 0x48, 0x99, 0xFB, 0xF1, 0x29, 0x13, 0x3F, 0x5C, 0xE2,
+    0x17, 0x4F, 0xD3, 0xF5, 0xDF, 0x78, 0x9C, 0x4D, 0xCF, 0xD1, 0x09, 0xC2, 0x50, 0x0C, 0x40, 0xD1,
+    0x28, 0x8A, 0x8A, 0x28, 0xDD, 0xC4, 0x11, 0x74, 0x03, 0xDD, 0xC0, 0x11, 0x1C, 0xA1, 0xFE, 0xF9,
+    0x69, 0x47, 0xE8, 0x08, 0x6E, 0xE0, 0x08, 0x76, 0x03, 0xDD, 0xA0, 0x50, 0x41, 0x2D, 0x8A, 0xD7,
+    0x3C, 0x68, 0x62, 0xDE, 0x47, 0xE0, 0x90, 0x70, 0xE1, 0xB5, 0x50, 0x4B, 0x7A, 0x27, 0x18, 0xB5,
+    0xC0, 0x38, 0x62, 0x11, 0x71, 0x8E, 0x60, 0x10, 0x31, 0x73, 0xD4, 0x90, 0x3B, 0x76, 0xBA, 0xEA,
+    0x19, 0xB6, 0x2F, 0x98, 0x38, 0x6E, 0xB0, 0xF4, 0xB3, 0x0D, 0x5C, 0x0C, 0xB9, 0x7C, 0x60, 0xD8,
+    0xE1, 0x28, 0x77, 0x98, 0x3B, 0x4A, 0x74, 0x18, 0x32, 0x8D, 0xF7, 0xCB, 0x0E, 0xF2, 0x84, 0xA9,
+    0xA3, 0x82, 0x75, 0x61, 0xD0, 0xF8, 0x75, 0x6F, 0x90, 0x37, 0x1C, 0x1C, 0x8D, 0xF6, 0x1C, 0x45,
+    0xFA, 0x88, 0x21, 0xFB, 0x06, 0xC8, 0x23, 0xA2, 0x8A, 0x58, 0x45, 0xA4, 0xF8, 0x1F, 0x4D, 0xC2,
+    0x0F, 0x8A, 0x70, 0xCF, 0xAF, 0x78, 0x9C, 0x5D, 0x50, 0xC9, 0x0D, 0xC2, 0x40, 0x0C, 0x1C, 0x91,
+    0x20, 0x10, 0xF0, 0x48, 0x07, 0xA4, 0x04, 0x4A, 0x48, 0x27, 0xE4, 0xCD, 0x07, 0x3A, 0x80, 0x0E,
+    0x78, 0xF1, 0xA6, 0x04, 0x4A, 0xA0, 0x04, 0x68, 0x80, 0xA4, 0x01, 0x24, 0x24, 0x2E, 0x71, 0x29,
+    0x83, 0xED, 0x4D, 0x60, 0x93, 0x79, 0x58, 0x3B, 0xF6, 0xFA, 0x98, 0x01, 0x10, 0xAD, 0x8E, 0xCC,
+    0x26, 0x2D, 0x18, 0xA2, 0x27, 0x15, 0xDB, 0xC0, 0xD8, 0x8D, 0x0E, 0x4B, 0x25, 0x33, 0x56, 0xE8,
+    0x09, 0xBB, 0xEA, 0xE3, 0x50, 0x48, 0x98, 0x0B, 0x2B, 0xAC, 0x25, 0x7E, 0x08, 0x0D, 0x90, 0x4A,
+    0xEC, 0x48, 0x72, 0x64, 0x5F, 0xF7, 0xE4, 0xC6, 0x86, 0xDD, 0xC9, 0x21, 0xCE, 0x1A, 0x14, 0x92,
+    0x9E, 0x6A, 0xAA, 0x6F, 0x6C, 0x41, 0xAE, 0x21, 0xAB, 0xBB, 0xC6, 0x12, 0x32, 0xC7, 0x8B, 0x6C,
+    0xBB, 0x93, 0xC8, 0x13, 0xDE, 0x64, 0xE8, 0x2E, 0x94, 0xA1, 0xF8, 0xE8, 0x9A, 0x1F, 0xAB, 0xD7,
+    0xEA, 0x7D, 0xFE, 0xCC, 0x9D, 0xEA, 0x19, 0xFC, 0xF7, 0xF9, 0xB7, 0x8C, 0x1B, 0x77, 0x56, 0x1A,
+    0x12, 0x27, 0x57, 0xF5, 0x85, 0x88, 0xD5, 0x1C, 0x31, 0xEA, 0xA2, 0xDA, 0x33, 0x96, 0xDA, 0xD3,
+    0x9A, 0x2F, 0xCE, 0x98, 0xB2, 0xD4, 0xF4, 0xD3, 0xF7, 0xFA, 0x0B, 0x90, 0x2D, 0xBA, 0x68, 0x78,
+    0x9C, 0xFB, 0xF9, 0x1F, 0x08, 0xEE, 0x55, 0x31, 0x32, 0x30, 0xFC, 0xFC, 0x0F, 0x06, 0xF3, 0x19,
+    0x61, 0xAC, 0xFF, 0x72, 0x70, 0xD6, 0x7D, 0x10, 0x6B, 0xCF, 0xE9, 0x7F, 0x40, 0x26, 0x1B, 0x90,
+    0xC5, 0xC4, 0x60, 0xF0, 0xF7, 0xFF, 0x7F, 0x1E, 0x30, 0x8B, 0xE1, 0xE3, 0xFF, 0xFF, 0xFC, 0x10,
+    0xD6, 0x81, 0xFF, 0xFF, 0xE5, 0x21, 0xAC, 0x05, 0xFF, 0xFF, 0xEB, 0xC3, 0xC5, 0xA0, 0xB2, 0x5F,
+    0xFE, 0xFF, 0xE7, 0x03, 0xB3, 0x12, 0x80, 0xA6, 0x70, 0x82, 0xCC, 0xBB, 0x0D, 0x32, 0x9A, 0x19,
+    0x66, 0xC7, 0x7C, 0xB8, 0x6D, 0x5C, 0x30, 0x56, 0x1C, 0xD4, 0x55, 0xE7, 0x3C, 0x19, 0xC0, 0x2C,
+    0xA0, 0x29, 0x0C, 0x34, 0x65, 0x01, 0x00, 0x82, 0x84, 0x95, 0x54, 0x78, 0x9C, 0x5D, 0x50, 0xC9,
+    0x0D, 0xC2, 0x40, 0x0C, 0x34, 0x24, 0x08, 0x44, 0x40, 0x4A, 0x07, 0xA4, 0x04, 0x4A, 0x48, 0x29,
+    0x79, 0xF3, 0x81, 0x0E, 0xA0, 0x03, 0x5E, 0xBC, 0x29, 0x21, 0x74, 0x40, 0x09, 0xA1, 0x01, 0x42,
+    0x03, 0x48, 0x48, 0x5C, 0x0A, 0x57, 0x06, 0xDB, 0x8B, 0x03, 0x61, 0x1E, 0xD6, 0x8E, 0x77, 0x77,
+    0xEC, 0x19, 0x22, 0x0A, 0x17, 0x7B, 0xE4, 0xA3, 0x26, 0x29, 0xC2, 0x1B, 0x04, 0x6B, 0x4F, 0xD9,
+    0x05, 0x0E, 0x73, 0x21, 0x13, 0x18, 0xBA, 0xCC, 0xCE, 0x72, 0xD8, 0x96, 0x5C, 0xA6, 0xCC, 0x4A,
+    0xFD, 0x12, 0x15, 0x4C, 0x3D, 0x4A, 0xB8, 0xB6, 0xB9, 0x39, 0xD4, 0xA7, 0x1B, 0x20, 0x55, 0xB1,
+    0x2B, 0x30, 0xA0, 0xA3, 0x14, 0x01, 0xB7, 0xC7, 0xD2, 0x0A, 0x94, 0xCD, 0x80, 0x25, 0xF1, 0xE8,
+    0x8E, 0xB2, 0x18, 0xD8, 0xD1, 0x1D, 0x68, 0xB9, 0x95, 0x80, 0x03, 0x3D, 0x00, 0xDF, 0x6D, 0xC8,
+    0xA2, 0xF4, 0x94, 0x31, 0x15, 0xAB, 0xDF, 0xD5, 0xFF, 0xFD, 0x6A, 0x66, 0xE2, 0xA7, 0x67, 0xF3,
+    0xD2, 0xBF, 0x5D, 0xEA, 0x7B, 0x9A, 0x87, 0xD8, 0xD9, 0x15, 0x7F, 0x3E, 0x45, 0x12, 0x0E, 0x07,
+    0x75, 0x12, 0xEF, 0xB9, 0x05, 0x93, 0xD4, 0x72, 0x71, 0xC1, 0x58, 0x66, 0x96, 0x67, 0xF6, 0x59,
+    0x57, 0xB2, 0x66, 0x73, 0x0D, 0x32, 0x44, 0xAC, 0xDC, 0xAF, 0x98, 0x28, 0x67, 0x5F, 0x26, 0xCA,
+    0xC1, 0x97, 0x16, 0x12, 0x52, 0x85, 0x15, 0xCC, 0x9A, 0xE2, 0x25, 0x1E, 0xDE, 0xB9, 0x51, 0xD1,
+    0x51, 0x78, 0x9C, 0xFB, 0xF9, 0x1F, 0x08, 0xCE, 0x45, 0x32, 0x80, 0xC0, 0xCF, 0xFF, 0x60, 0x30,
+    0x9F, 0x11, 0xC1, 0xFE, 0xAF, 0x8B, 0xC4, 0xBE, 0x0F, 0x61, 0xEF, 0x39, 0x0D, 0xE2, 0xB0, 0x81,
+    0xD9, 0x4C, 0x0C, 0x0E, 0x7F, 0xFF, 0xFF, 0xE7, 0x81, 0xB2, 0x19, 0x3E, 0xFE, 0xFF, 0xCF, 0x0F,
+    0x63, 0x6F, 0xF8, 0xFF, 0x5F, 0x1E, 0xC6, 0x5E, 0xF0, 0xFF, 0xBF, 0x3E, 0x8C, 0x7D, 0x01, 0x49,
+    0xCD, 0x37, 0xB8, 0x5E, 0x81, 0x29, 0x40, 0x33, 0x59, 0x11, 0x76, 0xAD, 0x47, 0xB2, 0x97, 0x1B,
+    0xC1, 0xEE, 0x47, 0x72, 0x27, 0x2B, 0x94, 0xBD, 0xFA, 0xD5, 0xFF, 0xFF, 0x7C, 0x50, 0x36, 0x93,
+    0x03, 0xD0, 0xFD, 0x30, 0x36, 0x88, 0x60, 0x81, 0xB1, 0x1F, 0xFE, 0xFF, 0x2F, 0x07, 0x63, 0x07,
+    0xC0, 0xCD, 0x07, 0xBA, 0xE1, 0x37, 0xCC, 0x5E, 0x20, 0xFB, 0x13, 0x58, 0x11, 0x84, 0x5D, 0x00,
+    0x56, 0x04, 0x61, 0x33, 0xFC, 0x05, 0x29, 0x82, 0xB2, 0x3F, 0x83, 0x14, 0x41, 0xD9, 0x13, 0xFE,
+    0xFF, 0xDF, 0xCF, 0x00, 0x00, 0x03, 0xE9, 0xB3, 0x12, 0x78, 0x9C, 0x3D, 0x8E, 0x31, 0x0A, 0xC2,
+    0x50, 0x10, 0x44, 0x27, 0x31, 0x8A, 0xA0, 0x88, 0x27, 0x10, 0x2B, 0x2D, 0x2C, 0xB4, 0xB4, 0xD3,
+    0x23, 0x24, 0x27, 0xD0, 0x03, 0x08, 0x1E, 0x49, 0x25, 0xB5, 0x58, 0x5A, 0x89, 0x58, 0x5A, 0xA9,
+    0xBD, 0x10, 0x0F, 0x20, 0xA4, 0x09, 0x22, 0x51, 0xFE, 0xB8, 0x7F, 0x17, 0x9C, 0xE2, 0xF3, 0x76,
+    0x98, 0xD9, 0xFD, 0x40, 0x77, 0xEF, 0xF2, 0x6D, 0x0F, 0x40, 0xBB, 0xA4, 0xD7, 0x02, 0xB8, 0xD1,
+    0x14, 0xE0, 0x6B, 0xB0, 0x43, 0x2C, 0x6F, 0xF6, 0x24, 0x27, 0x58, 0xCB, 0x18, 0x20, 0x29, 0x9B,
+    0xB8, 0x92, 0x2D, 0xE9, 0x21, 0xC4, 0x83, 0x6C, 0x40, 0x25, 0x5E, 0xC7, 0x48, 0x72, 0x97, 0x50,
+    0x69, 0x2A, 0xDD, 0x55, 0xA0, 0xF8, 0xF1, 0xCB, 0xD4, 0x3D, 0xE9, 0x5E, 0x75, 0xF5, 0xEE, 0x52,
+    0x93, 0x7A, 0xAF, 0xAE, 0xE8, 0xA3, 0x33, 0x2D, 0x8D, 0x04, 0x73, 0x5B, 0x3A, 0x17, 0xB3, 0x62,
+    0xF8, 0x26, 0xAB, 0x46, 0x05, 0x59, 0x4B, 0x23, 0x4F, 0x2F, 0x32, 0x2A, 0xB2, 0x31, 0x10, 0x3B,
+    0xF9, 0xBD, 0xF8, 0xD9, 0x5D, 0xE0, 0xE8, 0x13, 0xAA, 0xE1, 0x9F, 0x22, 0x6C, 0x0C, 0x06, 0x52,
+    0x4B, 0xCE, 0x8E, 0x87, 0xBE, 0xC0, 0x0F, 0x02, 0x74, 0x88, 0x5C, 0x78, 0x9C, 0xFB, 0xFC, 0x1F,
+    0x06, 0xFC, 0x3F, 0x13, 0x62, 0x1E, 0x3A, 0x73, 0xE6, 0x0C, 0x90, 0x06, 0x92, 0x36, 0x0C, 0x40,
+    0xF0, 0xEF, 0xFF, 0x7B, 0x06, 0x28, 0x18, 0x01, 0x4C, 0x00, 0x17, 0x30, 0x71, 0xF0, 0x78, 0x9C,
+    0xFB, 0xF3, 0xFF, 0x3F, 0x03, 0x08, 0x7C, 0xFE, 0xFF, 0x9F, 0xE3, 0xCF, 0x10, 0x66, 0x7F, 0x01,
+    0xB2, 0x7F, 0x43, 0xD9, 0x5F, 0xFF, 0xFF, 0x67, 0xFF, 0xF5, 0xFF, 0x3F, 0x33, 0x88, 0xFD, 0xFD,
+    0xFF, 0x7F, 0xB6, 0x1F, 0x40, 0x39, 0x10, 0x1B, 0xA8, 0x96, 0x05, 0xA8, 0x4E, 0x1F, 0xC8, 0x4C,
+    0xF8, 0x0F, 0x54, 0xFB, 0xE0, 0xFF, 0xFF, 0xF7, 0xAC, 0x0C, 0x02, 0x40, 0xE9, 0xF9, 0x0C, 0x01,
+    0x40, 0x81, 0xFF, 0xF7, 0xFE, 0x01, 0x09, 0x79, 0x06, 0x86, 0x5F, 0xFF, 0xA1, 0x80, 0x95, 0x81,
+    0x61, 0x01, 0x94, 0x19, 0x0F, 0x32, 0xE1, 0x2A, 0x98, 0xB9, 0x9E, 0x09, 0x6C, 0x4D, 0xCB, 0x9B,
+    0xFF, 0xF7, 0xAB, 0x18, 0x81, 0x0C, 0x00, 0x55, 0xFE, 0xA9, 0x7C, 0x78, 0x9C, 0x3D, 0x90, 0xEB,
+    0x55, 0xC2, 0x40, 0x10, 0x46, 0x27, 0xC6, 0xF7, 0xBB, 0x03, 0xEC, 0x40, 0x3B, 0xA0, 0x05, 0x3A,
+    0x08, 0x1D, 0x48, 0x07, 0xD8, 0x01, 0x25, 0x40, 0x07, 0xD8, 0x81, 0x74, 0x20, 0x1D, 0xC4, 0x12,
+    0x34, 0x0A, 0x51, 0x92, 0x70, 0xF9, 0x66, 0x92, 0x38, 0x3F, 0xF6, 0xEC, 0x9D, 0xC7, 0x3D, 0x3B,
+    0xDB, 0x80, 0x45, 0xFC, 0xC0, 0x79, 0x09, 0xC7, 0x01, 0x7F, 0x90, 0x16, 0x70, 0x11, 0xB0, 0x27,
+    0xB7, 0x15, 0xDC, 0xFA, 0xFD, 0x09, 0x66, 0x36, 0x81, 0xA1, 0xC3, 0x0B, 0x3C, 0xDA, 0x83, 0x67,
+    0x14, 0x6B, 0xB8, 0x31, 0xAB, 0xD5, 0xAB, 0xF8, 0x86, 0x33, 0x33, 0xE9, 0x52, 0xC1, 0x2F, 0x1C,
+    0x99, 0x7D, 0xC9, 0x2F, 0x68, 0x78, 0xD7, 0xB9, 0x8A, 0x66, 0x8D, 0x4E, 0x05, 0x63, 0xD7, 0xB8,
+    0x74, 0x20, 0xB8, 0x8F, 0x9C, 0xEA, 0xD7, 0xEE, 0xA9, 0xBC, 0x5B, 0x93, 0xA7, 0x0E, 0x5B, 0x48,
+    0xDC, 0x99, 0x38, 0x44, 0xB2, 0xE6, 0x2D, 0x5E, 0xF8, 0x0A, 0x57, 0x1A, 0x7C, 0x0E, 0x90, 0xEE,
+    0x6E, 0xD4, 0xCA, 0x42, 0x97, 0x2D, 0x54, 0x6D, 0x77, 0xAC, 0x98, 0x7F, 0xC0, 0x49, 0x0B, 0x1B,
+    0xF2, 0xA2, 0x5F, 0xDE, 0x3E, 0xA1, 0xEC, 0x64, 0x66, 0x1A, 0x68, 0xC8, 0x3A, 0x90, 0x4A, 0xC2,
+    0x0E, 0xCC, 0xE1, 0xB2, 0x87, 0x1D, 0xFF, 0xB2, 0xF8, 0xBF, 0x5E, 0x16, 0xBA, 0x65, 0x5C, 0x0E,
+    0x5E, 0x76, 0x8D, 0xCA, 0x78, 0x9C, 0x2D, 0x91, 0xDB, 0x59, 0x02, 0x41, 0x0C, 0x85, 0x8F, 0x17,
+    0x54, 0x3E, 0x05, 0xE9, 0x00, 0x3B, 0xC0, 0x0E, 0xB0, 0x03, 0xE8, 0x00, 0x3B, 0xC0, 0x0E, 0xA4,
+    0x03, 0xEC, 0xC0, 0xED, 0x00, 0x3A, 0x80, 0x0E, 0xA0, 0x03, 0xB6, 0x83, 0x05, 0x64, 0xC5, 0x05,
+    0xE1, 0x37, 0xC9, 0x98, 0x97, 0x64, 0x26, 0x33, 0x39, 0x97, 0x9C, 0x58, 0xC8, 0xE2, 0x0D, 0xBA,
+    0x9E, 0xD7, 0x50, 0xAF, 0xC0, 0xCB, 0x29, 0xBC, 0x7B, 0xDE, 0x41, 0xAD, 0x84, 0xAB, 0xD4, 0x9D,
+    0xF9, 0xD5, 0x0F, 0x5C, 0x6C, 0xE0, 0x36, 0x75, 0xE3, 0xF5, 0x91, 0x95, 0x96, 0x70, 0x9F, 0xBA,
+    0x5C, 0x5B, 0x86, 0x4F, 0x7D, 0xC0, 0xA3, 0x95, 0xBF, 0x76, 0x75, 0x27, 0x3D, 0xC3, 0x40, 0xFD,
+    0x04, 0x65, 0x37, 0x3C, 0x04, 0x70, 0x5B, 0x2D, 0x18, 0x4A, 0x2F, 0x70, 0xB4, 0x83, 0x32, 0x68,
+    0x48, 0x27, 0x26, 0xD2, 0x08, 0x4A, 0xFB, 0xA2, 0xDC, 0x68, 0x49, 0x15, 0x85, 0x0C, 0x64, 0xB5,
+    0xB5, 0xC1, 0xDA, 0x06, 0x88, 0xC1, 0x5F, 0x6A, 0xC3, 0x24, 0x37, 0x78, 0x7D, 0x1B, 0x2D, 0xD9,
+    0x89, 0x1B, 0x95, 0x0C, 0xA7, 0x7E, 0xAA, 0x42, 0xDE, 0xDC, 0xBF, 0x57, 0x74, 0x0D, 0xAC, 0x66,
+    0x83, 0xC7, 0x8A, 0xC9, 0x0D, 0x2B, 0x9B, 0x46, 0xA9, 0x6E, 0xF0, 0x3D, 0x05, 0x7E, 0xBB, 0xE5,
+    0x12, 0xA0, 0xD9, 0x4F, 0xBC, 0xAD, 0xEC, 0xBD, 0xFA, 0xBC, 0x23, 0x9D, 0x51, 0xF0, 0x75, 0x2D,
+    0xE3, 0xCC, 0x51, 0xF7, 0x0C, 0xE6, 0xA1, 0xCA, 0x15, 0xCF, 0x96, 0xCE, 0xCD, 0x88, 0xAD, 0x93,
+    0x76, 0x23, 0x56, 0xAC, 0x5D, 0x41, 0xCE, 0x62, 0x9B, 0x1C, 0x72, 0xF7, 0x76, 0xAE, 0x33, 0xA3,
+    0x28, 0x93, 0xEB, 0xEE, 0xF1, 0x81, 0x8E, 0x64, 0x18, 0x55, 0xD0, 0x0A, 0x43, 0xCE, 0x34, 0xA5,
+    0x27, 0xCF, 0xB1, 0x13, 0xB7, 0x2D, 0xF4, 0xEB, 0xCC, 0x3F, 0xAD, 0x64, 0x5F, 0xCD, 0xF2, 0x81,
+    0x64, 0x7A, 0xAC, 0x20, 0xF4, 0x9B, 0xF6, 0xB4, 0x1A, 0x8B, 0x3D, 0xEE, 0x4B, 0x78, 0x12, 0x0B,
+    0xB4, 0xF8, 0xF2, 0xB5, 0xC8, 0x7D, 0x4C, 0xB4, 0xFE, 0x00, 0xE1, 0xBC, 0x00, 0x05, 0x78, 0x9C,
+    0x3D, 0x90, 0xE9, 0x11, 0x01, 0x41, 0x10, 0x46, 0x5B, 0xAD, 0xA3, 0x9C, 0x25, 0x02, 0x64, 0x20,
+    0x04, 0x21, 0x48, 0x41, 0x06, 0x64, 0x80, 0x08, 0x6C, 0x06, 0x64, 0xB0, 0x21, 0x90, 0x81, 0x10,
+    0x94, 0x08, 0x54, 0x59, 0x94, 0xFB, 0xE9, 0xDE, 0x9E, 0xD1, 0xBF, 0xFA, 0xCD, 0x7C, 0x7D, 0x7D,
+    0x67, 0x18, 0x89, 0xC5, 0x1B, 0xAA, 0x33, 0xD8, 0x5B, 0x3E, 0x81, 0xAD, 0xBF, 0x28, 0x1C, 0x61,
+    0x28, 0x72, 0x86, 0xBE, 0xC2, 0x03, 0x6A, 0x22, 0x0B, 0xC8, 0x44, 0x06, 0x70, 0x30, 0xF5, 0x07,
+    0x12, 0xD9, 0x85, 0x3E, 0x39, 0xB4, 0xE5, 0x0A, 0x75, 0x83, 0x14, 0xE6, 0xF2, 0xE5, 0x54, 0x0C,
+    0xD0, 0x84, 0x25, 0x8C, 0x1D, 0x2E, 0xF0, 0x82, 0x86, 0xC3, 0x06, 0x8D, 0x53, 0xC9, 0xA1, 0xAB,
+    0x3A, 0xA6, 0x12, 0x42, 0x5B, 0xD1, 0x8C, 0xA0, 0x45, 0x54, 0x22, 0xE8, 0x58, 0x3A, 0x21, 0x4F,
+    0xAD, 0xC1, 0x3A, 0x40, 0x6E, 0x40, 0xF9, 0xAF, 0xCA, 0xA3, 0x4E, 0xD7, 0x9E, 0xCE, 0xA2, 0x4E,
+    0x0F, 0x6A, 0xD9, 0x6F, 0x39, 0x1C, 0x9F, 0x58, 0x5D, 0x4F, 0x73, 0x55, 0xAC, 0x8A, 0x8E, 0x99,
+    0xAB, 0x3A, 0xBE, 0x92, 0xCE, 0x7D, 0xF9, 0xF4, 0x9B, 0xE9, 0xDC, 0x22, 0xB1, 0xBB, 0x33, 0xB3,
+    0xC8, 0xCC, 0x31, 0x47, 0xA8, 0x3C, 0x0B, 0x8B, 0x34, 0xEE, 0xAA, 0xFB, 0x01, 0x47, 0x0C, 0x9A,
+    0xAB, 0x78, 0x9C, 0xBD, 0x8E, 0x59, 0x0D, 0x02, 0x41, 0x10, 0x44, 0x6B, 0x49, 0x08, 0x24, 0x1C,
+    0x16, 0x40, 0x02, 0x12, 0x70, 0xC0, 0x3A, 0x02, 0x07, 0x58, 0xC0, 0x01, 0x48, 0x58, 0x07, 0xE0,
+    0x84, 0x9B, 0x84, 0xF3, 0x51, 0xD3, 0x33, 0x58, 0xA0, 0x7E, 0xBA, 0x3A, 0xA9, 0xEA, 0x7E, 0x4F,
+    0xE8, 0xC8, 0xDA, 0xC0, 0xFC, 0x0C, 0xC3, 0xE4, 0x3D, 0x07, 0x2B, 0xEF, 0xC9, 0xBF, 0xA0, 0x3D,
+    0x06, 0x2A, 0x69, 0x0A, 0x5B, 0xE9, 0x0E, 0x5D, 0xA9, 0x81, 0x99, 0x74, 0x84, 0x91, 0x74, 0x81,
+    0x9E, 0xB4, 0x80, 0x65, 0xC4, 0x5B, 0x6E, 0x7D, 0x5C, 0x70, 0x7C, 0x9D, 0x2E, 0xDC, 0x5C, 0x68,
+    0x22, 0x28, 0xED, 0x3C, 0xAF, 0x71, 0x40, 0xAA, 0x5D, 0x78, 0xB3, 0xAF, 0x54, 0xDE, 0x94, 0x87,
+    0x71, 0xAF, 0x80, 0x04, 0x96, 0x01, 0xB2, 0x9F, 0x10, 0x00, 0x59, 0x8F, 0x00, 0xC8, 0x3A, 0x41,
+    0xFF, 0xE7, 0x0F, 0x01, 0xF3, 0x5F, 0xFF, 0x05, 0xFF, 0x96, 0x79, 0x25, 0x78, 0x9C, 0x85, 0xCF,
+    0xD1, 0x09, 0x82, 0x60, 0x14, 0xC5, 0x71, 0x2D, 0x31, 0xA2, 0x1E, 0x1A, 0x20, 0xAC, 0x0D, 0x6C,
+    0x03, 0x47, 0xC8, 0x4D, 0x6A, 0x83, 0x1C, 0xA1, 0x4D, 0x72, 0x84, 0x06, 0x08, 0x1A, 0x21, 0x9D,
+    0x20, 0x8A, 0x90, 0x28, 0xEC, 0xDF, 0xC5, 0x73, 0xEB, 0xD5, 0xF3, 0xF4, 0xE3, 0xDC, 0xEF, 0xC2,
+    0x77, 0x4B, 0x7E, 0x99, 0x96, 0x3D, 0x9C, 0x14, 0xA7, 0x2E, 0xC6, 0x61, 0xD0, 0x65, 0x0F, 0x3B,
+    0x29, 0x78, 0xD8, 0x53, 0x69, 0xF6, 0x81, 0x81, 0x68, 0xBB, 0x1B, 0x9F, 0x37, 0xB6, 0x2F, 0x2D,
+    0xE1, 0x1A, 0x8A, 0x47, 0x58, 0xFB, 0xFC, 0x09, 0x63, 0x69, 0x05, 0x17, 0x2F, 0x2B, 0xC8, 0x9C,
+    0x2F, 0x18, 0x49, 0x39, 0x9C, 0xBD, 0xAC, 0x21, 0x75, 0xBE, 0x21, 0x96, 0xB6, 0x70, 0xF0, 0xF2,
+    0x0E, 0x89, 0xB3, 0x85, 0x48, 0x2A, 0xEC, 0xFF, 0x3A, 0x64, 0x7E, 0xFB, 0xDF, 0xB6, 0xE8, 0xE5,
+    0x17, 0x4A, 0x0C, 0x93, 0x5D, 0x78, 0x9C, 0xFB, 0xFA, 0xFF, 0xFF, 0xFF, 0xF5, 0x5F, 0x91, 0x89,
+    0x77, 0xF3, 0xBE, 0xFE, 0xAF, 0x67, 0x60, 0x18, 0x38, 0x02, 0xEC, 0x02, 0x14, 0x57, 0x01, 0x00,
+    0x15, 0xB9, 0x62, 0x00, 0x78, 0x9C, 0xB5, 0xCE, 0xD1, 0x09, 0x40, 0x60, 0x18, 0x85, 0x61, 0x24,
+    0x49, 0x92, 0x0D, 0x8C, 0xC0, 0x26, 0x6C, 0xF2, 0xDB, 0x84, 0x4D, 0xD8, 0x84, 0x4D, 0x90, 0xA4,
+    0x3F, 0xE9, 0xD5, 0x77, 0x76, 0x70, 0x6E, 0x9E, 0x8B, 0xF7, 0xE6, 0x78, 0x86, 0xC0, 0x76, 0xB2,
+    0xC9, 0x15, 0x62, 0xB3, 0x87, 0xCC, 0x2C, 0xA1, 0x52, 0x78, 0x70, 0xF2, 0x62, 0x91, 0x3B, 0x44,
+    0xE6, 0x08, 0xA9, 0xD9, 0x40, 0xA1, 0xF0, 0xD2, 0xCA, 0x9B, 0x49, 0x1E, 0x10, 0x9A, 0x33, 0x24,
+    0x66, 0x07, 0xB9, 0x02, 0xD4, 0xD2, 0xFF, 0x71, 0xE1, 0x03, 0x91, 0xF8, 0x45, 0x01, 0x78, 0x9C,
+    0xFB, 0xF0, 0xFF, 0xFF, 0xFF, 0xF7, 0x1F, 0xE0, 0xC4, 0x83, 0x77, 0xFF, 0xFE, 0xBF, 0x67, 0x60,
+    0x78, 0x30, 0x70, 0x04, 0xD8, 0x05, 0x1F, 0x50, 0x5D, 0x05, 0x00, 0xFB, 0x0A, 0x6C, 0xBB, 0x78,
+    0x9C, 0x35, 0xCE, 0xFF, 0x0D, 0xC1, 0x60, 0x10, 0xC6, 0xF1, 0xC7, 0x8F, 0x90, 0x26, 0x65, 0x04,
+    0x6C, 0x60, 0x04, 0x1D, 0xC1, 0x06, 0x1D, 0xA1, 0xDD, 0x84, 0x11, 0x6C, 0xC0, 0x06, 0x6C, 0xC0,
+    0x06, 0x6C, 0x20, 0x8A, 0x26, 0x42, 0x7D, 0xDD, 0x7B, 0x7D, 0xDD, 0x1F, 0x4F, 0x3E, 0x77, 0xB9,
+    0x4B, 0x4E, 0x92, 0xBE, 0x0B, 0xC5, 0x2A, 0x39, 0xFE, 0x79, 0x81, 0x7E, 0x64, 0x0D, 0xA3, 0xC8,
+    0x06, 0x8A, 0x56, 0x4B, 0xE0, 0xDA, 0xF2, 0x44, 0xDE, 0x30, 0x74, 0x3E, 0x18, 0x3F, 0x99, 0x38,
+    0x3F, 0x0C, 0x0E, 0xAC, 0x82, 0x32, 0x5B, 0xCC, 0xA0, 0x63, 0xDC, 0x85, 0xC9, 0x9B, 0xC4, 0x78,
+    0x67, 0x1A, 0x62, 0xAE, 0x38, 0xD8, 0xB0, 0x97, 0x66, 0xD0, 0xF5, 0xEC, 0x59, 0xBF, 0x0D, 0xC7,
+    0x2F, 0x52, 0x55, 0xF8, 0x87, 0x37, 0x72, 0x6F, 0xAD, 0xD6, 0x9C, 0xF5, 0x03, 0x39, 0x7E, 0x40,
+    0x5D, 0x78, 0x9C, 0x9B, 0x30, 0x13, 0x02, 0xD8, 0x3E, 0xFE, 0x87, 0x00, 0x6E, 0x38, 0x03, 0x00,
+    0x0E, 0x64, 0x14, 0xB0, 0x78, 0x9C, 0xFB, 0xF5, 0xFF, 0x3F, 0x2F, 0x03, 0xC3, 0x84, 0xFF, 0xFF,
+    0xE7, 0x33, 0x30, 0x30, 0x7C, 0xFB, 0xFF, 0x9F, 0x95, 0x81, 0xC1, 0xE1, 0xDF, 0x7F, 0x7B, 0x20,
+    0xE7, 0xE0, 0xFF, 0xF7, 0x8C, 0x40, 0xEA, 0xC7, 0x7F, 0x1E, 0x00, 0x48, 0xF7, 0x10, 0x5B, 0x78,
+    0x9C, 0x63, 0x60, 0x70, 0xD8, 0xF1, 0xEF, 0xFF, 0x5A, 0x36, 0x06, 0x06, 0x86, 0xC6, 0xFF, 0x60,
+    0x00, 0x64, 0x7E, 0x82, 0xB0, 0xFA, 0x19, 0x18, 0x16, 0x40, 0x58, 0xFF, 0x99, 0x19, 0x0C, 0xFE,
+    0xCF, 0x33, 0x4B, 0xFE, 0xFB, 0xFF, 0x3F, 0x17, 0x03, 0x83, 0x3B, 0x50, 0xF1, 0xC3, 0xFF, 0xFF,
+    0xF9, 0x18, 0xC0, 0x00, 0xA8, 0x84, 0x1F, 0xC2, 0x6A, 0xF8, 0xFF, 0x5F, 0x9E, 0x81, 0xC1, 0x61,
+    0xC5, 0x9D, 0x7F, 0xFF, 0x41, 0xAC, 0x82, 0x7F, 0x10, 0xBD, 0xF2, 0x02, 0x7F, 0xA0, 0xA6, 0xC8,
+    0x83, 0x8C, 0xEB, 0x0D, 0x5B, 0x0A, 0x64, 0x7D, 0xFC, 0xFF, 0x3F, 0x1E, 0xA2, 0xE3, 0xCB, 0xFF,
+    0xFF, 0x9C, 0x0C, 0x0C, 0x13, 0x80, 0xAC, 0x6F, 0x60, 0xCB, 0x2F, 0x00, 0x59, 0x5F, 0xC1, 0x62,
+    0xDF, 0x81, 0x2C, 0xA0, 0x53, 0xFA, 0x95, 0xB7, 0x80, 0xF4, 0x5E, 0xF8, 0x0F, 0x33, 0x25, 0x00,
+    0x4C, 0xF9, 0xFF, 0x06, 0xDA, 0x01, 0x54, 0xF2, 0xFF, 0x3D, 0xCB, 0x57, 0x20, 0x4B, 0xE1, 0xE6,
+    0xFF, 0x7D, 0xE2, 0x0C, 0x1F, 0xFE, 0xCB, 0x03, 0x00, 0x84, 0xBF, 0x7F, 0x60, 0x78, 0x9C, 0xFB,
+    0xF0, 0xFF, 0x3F, 0x17, 0x03, 0x04, 0x7C, 0x20, 0x9B, 0xC9, 0x89, 0x9D, 0x99, 0xF0, 0xFA, 0x7D,
+    0x36, 0x84, 0xA9, 0xF1, 0xF7, 0xFF, 0xFF, 0xFF, 0xBA, 0x60, 0xE6, 0x0D, 0x20, 0xEB, 0xFF, 0x7B,
+    0x46, 0x10, 0x13, 0x02, 0xB8, 0xC0, 0xCC, 0xF5, 0x2B, 0x80, 0x84, 0x3D, 0x88, 0x79, 0x9F, 0x91,
+    0xE1, 0xE2, 0xFF, 0xFF, 0xF3, 0x41, 0x4C, 0x7B, 0x06, 0x06, 0x03, 0xA0, 0x62, 0x10, 0x93, 0x0F,
+    0x68, 0xD0, 0x9F, 0xFF, 0xFF, 0x19, 0x81, 0x4C, 0x6E, 0x20, 0xF3, 0xE7, 0xFF, 0xFF, 0xCC, 0x50,
+    0x37, 0x7C, 0xFF, 0xFF, 0x9F, 0x05, 0xC1, 0x64, 0x45, 0x15, 0xE5, 0x41, 0xA8, 0xE5, 0x07, 0x32,
+    0xFF, 0x42, 0x4C, 0x88, 0x67, 0x60, 0x70, 0x80, 0x9A, 0xFB, 0x9E, 0x99, 0xE1, 0x11, 0xD4, 0xB6,
+    0xFF, 0xFB, 0x57, 0xC2, 0xDC, 0x80, 0xE4, 0xB2, 0x1F, 0x20, 0xD6, 0x7D, 0x90, 0x7B, 0xEF, 0x3B,
+    0xFC, 0x03, 0x32, 0x65, 0x40, 0xBE, 0xA8, 0x67, 0x28, 0x7C, 0xF3, 0x3E, 0x1A, 0x68, 0x20, 0x00,
+    0xFB, 0xC0, 0xAA, 0x45, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x68, 0x79, 0xF3, 0xFF, 0x9C, 0x27, 0x03,
+    0x03, 0xC3, 0xE1, 0xFF, 0x20, 0xA0, 0xC7, 0x90, 0x00, 0xA6, 0xFF, 0xF3, 0x31, 0x7C, 0x81, 0x30,
+    0x38, 0x18, 0xFE, 0xFD, 0xFF, 0x7F, 0x7E, 0xE6, 0x9F, 0xFF, 0x4C, 0x40, 0x99, 0xF7, 0xCC, 0x0C,
+    0x0C, 0xAD, 0x0C, 0x1B, 0xFE, 0xFF, 0x8F, 0x67, 0x00, 0x81, 0x0F, 0x20, 0x75, 0x20, 0xF0, 0xE9,
+    0xFF, 0x7F, 0x2E, 0x30, 0xE3, 0x33, 0x48, 0x03, 0x08, 0x00, 0x75, 0xB3, 0xA3, 0x8A, 0xC0, 0xD5,
+    0xC0, 0x75, 0x5D, 0x80, 0x9A, 0xC3, 0xD8, 0x00, 0x31, 0x79, 0x31, 0xB7, 0xC2, 0x7F, 0x90, 0x5D,
+    0xAF, 0xFF, 0x73, 0x33, 0xFC, 0x80, 0xD8, 0xCE, 0x0D, 0xB2, 0x0C, 0xC2, 0x80, 0x0A, 0x01, 0x4D,
+    0x15, 0xD8, 0xF6, 0xF7, 0xFF, 0x3E, 0x71, 0x06, 0x00, 0xF2, 0xBF, 0x5D, 0xF4, 0x78, 0x9C, 0xAD,
+    0xCF, 0xC1, 0x0D, 0x01, 0x51, 0x10, 0x06, 0xE0, 0x99, 0x38, 0x88, 0x84, 0x44, 0x09, 0xDB, 0x80,
+    0x44, 0x07, 0x3A, 0x40, 0x09, 0x5B, 0x80, 0x12, 0x1C, 0xB6, 0x04, 0x47, 0x5D, 0x88, 0xAB, 0x0B,
+    0x25, 0x50, 0x81, 0x3B, 0x87, 0x27, 0x76, 0x65, 0xAD, 0x58, 0xBF, 0x7F, 0xE6, 0x6D, 0x88, 0xBB,
+    0x39, 0xCC, 0xFB, 0xF2, 0xF2, 0xF2, 0xBF, 0x19, 0x11, 0xAF, 0x0A, 0x50, 0xF9, 0x17, 0xEF, 0xCE,
+    0xE9, 0x29, 0xCC, 0xB5, 0x34, 0xF6, 0x9F, 0x00, 0xC6, 0x37, 0xE3, 0x01, 0x56, 0x7E, 0x5B, 0xA1,
+    0x29, 0x4D, 0xD8, 0xB6, 0x1B, 0x67, 0x06, 0x84, 0x96, 0xAC, 0x8D, 0x7B, 0x60, 0xC2, 0xB0, 0x17,
+    0x79, 0x01, 0x7A, 0x4D, 0xEE, 0x15, 0xE8, 0x90, 0x16, 0x96, 0x03, 0x6D, 0x92, 0x87, 0x16, 0x5F,
+    0xE6, 0x3F, 0xB4, 0xB7, 0x45, 0x4C, 0xE8, 0x92, 0x65, 0xCC, 0x1D, 0x91, 0x35, 0xB9, 0x00, 0x8E,
+    0x2A, 0x99, 0xFD, 0x36, 0x64, 0x5B, 0x2D, 0x6B, 0xA3, 0x3C, 0x3E, 0x93, 0xC5, 0x79, 0x83, 0x25,
+    0x48, 0x62, 0x5B, 0x0C, 0x76, 0xBE, 0x5B, 0x7A, 0x0E, 0x33, 0x49, 0xC9, 0x37, 0x82, 0xC2, 0xA8,
+    0xB2, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x98, 0xF2, 0xF6, 0xFD, 0x5C, 0x56, 0x06, 0x20, 0xB8, 0xFC,
+    0x1F, 0x08, 0xEE, 0xB3, 0x30, 0x30, 0x04, 0xFC, 0x07, 0x83, 0x7C, 0x06, 0x86, 0xCF, 0x10, 0xD6,
+    0x7F, 0x66, 0x86, 0x7F, 0xFF, 0xFF, 0x6B, 0x28, 0x7C, 0xFF, 0xFF, 0x9F, 0x07, 0x28, 0x59, 0xCF,
+    0xC0, 0x60, 0xF0, 0xFF, 0xBF, 0xFD, 0x86, 0xFF, 0xFF, 0xF9, 0x80, 0xDA, 0x7E, 0xFF, 0xEF, 0xFF,
+    0xF0, 0xFF, 0x3F, 0x17, 0x90, 0xF5, 0xE3, 0xFF, 0xFA, 0x4F, 0x50, 0x0D, 0xFF, 0xCF, 0x7F, 0x86,
+    0xB3, 0xBE, 0xC0, 0x58, 0xF7, 0x81, 0x62, 0x67, 0xCF, 0x80, 0xC0, 0x1C, 0xA0, 0x3A, 0x0E, 0x06,
+    0x30, 0x00, 0xEA, 0xE5, 0x86, 0xB0, 0x80, 0xE6, 0xE9, 0x43, 0x58, 0x40, 0x3B, 0xEE, 0x33, 0x82,
+    0x68, 0x76, 0x86, 0xBF, 0xFF, 0xFF, 0xCF, 0x37, 0x0D, 0xD9, 0x0E, 0x34, 0x1F, 0x66, 0x20, 0x17,
+    0x83, 0xC3, 0x3F, 0x18, 0x8B, 0x61, 0x21, 0x84, 0xC5, 0x0E, 0x54, 0x5C, 0x74, 0xFB, 0xFF, 0xFB,
+    0x39, 0xA2, 0x0C, 0x00, 0x7E, 0x96, 0x7F, 0x5F, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x28, 0x7C, 0xFD,
+    0xFF, 0x5E, 0x14, 0x23, 0x03, 0x83, 0xC3, 0xBF, 0xFF, 0x40, 0xC0, 0xCC, 0xC0, 0xF0, 0x09, 0x44,
+    0xDF, 0x67, 0x60, 0x60, 0xF8, 0x05, 0x62, 0xF4, 0x03, 0x19, 0x40, 0x99, 0xDE, 0x15, 0x7A, 0x40,
+    0x06, 0x44, 0x9C, 0x81, 0x41, 0xE0, 0xFF, 0xFF, 0xF9, 0x60, 0x86, 0x02, 0x44, 0x01, 0x03, 0xC3,
+    0x55, 0x90, 0xDA, 0xFF, 0xEC, 0x0C, 0x97, 0xFE, 0x43, 0x19, 0x9F, 0x31, 0x18, 0x0E, 0x21, 0xFF,
+    0xFF, 0xAF, 0x77, 0x71, 0x61, 0x44, 0xD2, 0x35, 0x38, 0x18, 0x00, 0xB9, 0xE7, 0x69, 0xE6, 0x78,
+    0x9C, 0x45, 0x8F, 0xB1, 0x4E, 0x02, 0x51, 0x10, 0x45, 0xEF, 0x4A, 0x44, 0x84, 0x42, 0x1B, 0x6B,
+    0xB6, 0x34, 0x16, 0xCA, 0x1F, 0x68, 0x69, 0x27, 0x7F, 0xA0, 0xA5, 0x9D, 0x9F, 0x60, 0x4B, 0xA1,
+    0xD1, 0x9E, 0x90, 0x50, 0x51, 0xD3, 0x49, 0x41, 0x22, 0x7F, 0x80, 0xBD, 0x85, 0x9D, 0x9D, 0xAE,
+    0x90, 0x20, 0x10, 0xF2, 0xF6, 0x30, 0xE3, 0x3E, 0xF0, 0x56, 0x67, 0x26, 0x33, 0x77, 0xEE, 0x48,
+    0xE9, 0x20, 0xC7, 0x75, 0x20, 0x2D, 0x21, 0x62, 0x9F, 0x2D, 0xCE, 0xE1, 0xF1, 0xC5, 0xE8, 0x52,
+    0xCA, 0x19, 0xCB, 0xEB, 0x44, 0x29, 0x5C, 0x49, 0x3F, 0xB0, 0xA7, 0x0B, 0x38, 0x93, 0x46, 0xB0,
+    0xEF, 0x58, 0xFF, 0xC3, 0xEA, 0xFF, 0x40, 0x45, 0x0A, 0x71, 0xAD, 0x24, 0xCD, 0xA0, 0x33, 0xC0,
+    0x6B, 0x3D, 0x17, 0x07, 0x4E, 0x0D, 0xBD, 0x0D, 0xAF, 0x89, 0xD1, 0xE1, 0x8A, 0x3C, 0x7B, 0x28,
+    0x79, 0xF3, 0x8D, 0x7B, 0x45, 0xCD, 0xDC, 0xAC, 0xD0, 0x2F, 0xB4, 0x5B, 0xAD, 0x5B, 0x9F, 0x98,
+    0x14, 0x0E, 0x59, 0x59, 0x6A, 0xC6, 0xB8, 0x4F, 0xD2, 0x4D, 0x88, 0xBC, 0xD3, 0xC8, 0x37, 0x5F,
+    0x54, 0xA6, 0x70, 0x2C, 0xA5, 0x9F, 0x50, 0x5B, 0x72, 0xE7, 0x3E, 0xB6, 0x51, 0x0B, 0xFE, 0xB4,
+    0x3C, 0x76, 0x35, 0x70, 0xEE, 0x68, 0x7F, 0x97, 0x57, 0x7C, 0x98, 0x7B, 0x33, 0x90, 0x25, 0x96,
+    0x2B, 0x1B, 0xBE, 0x9B, 0xC1, 0xB5, 0xBA, 0x1B, 0xAF, 0x5D, 0x69, 0x51, 0xD0, 0x89, 0xE7, 0xED,
+    0x7D, 0xF1, 0xDD, 0x3E, 0x32, 0x5A, 0x03, 0xAF, 0xF6, 0xB9, 0xA6, 0x78, 0x9C, 0xC5, 0xCC, 0x3D,
+    0x0E, 0x40, 0x40, 0x14, 0x45, 0x61, 0x3F, 0x91, 0x30, 0xA2, 0x56, 0x5A, 0x12, 0x3B, 0x62, 0x1B,
+    0x0A, 0x6B, 0xB0, 0x14, 0xA5, 0x45, 0x28, 0x4C, 0x89, 0xE0, 0x78, 0x6F, 0xA6, 0x55, 0x69, 0x9C,
+    0xEA, 0x2B, 0x6E, 0xAE, 0x05, 0x13, 0xF8, 0xEC, 0x67, 0x66, 0xAF, 0x4C, 0x9B, 0x85, 0x21, 0x76,
+    0x2C, 0x4F, 0x60, 0x74, 0x9C, 0xD1, 0x8C, 0xD2, 0x57, 0x3B, 0x4E, 0xFD, 0xA5, 0x0B, 0x65, 0x12,
+    0x74, 0xB0, 0x2A, 0x5B, 0x39, 0xBA, 0x41, 0x59, 0x09, 0x0F, 0x08, 0x85, 0x85, 0x70, 0x87, 0x48,
+    0x98, 0x0B, 0x37, 0x4F, 0xF3, 0x0B, 0x1F, 0x5C, 0x7A, 0xA1, 0x3F, 0x78, 0x9C, 0x73, 0xF8, 0xB3,
+    0x8E, 0xF1, 0xC1, 0xFF, 0xFF, 0x9C, 0x9F, 0xFF, 0xFF, 0xE7, 0xFD, 0xF4, 0xFF, 0x3F, 0xCF, 0x86,
+    0xFF, 0xFF, 0x59, 0x19, 0x5A, 0xD5, 0x19, 0x60, 0xE0, 0xC3, 0xFF, 0xFF, 0x5C, 0xD4, 0xC6, 0x00,
+    0x53, 0x36, 0x4C, 0x84, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x38, 0xF2, 0x5E, 0x8A, 0x81, 0x81, 0xE1,
+    0xDF, 0xFF, 0xF9, 0x0C, 0x0C, 0x06, 0xFF, 0xFF, 0xDF, 0x67, 0x60, 0x50, 0xF8, 0xFF, 0xFF, 0x3C,
+    0x50, 0xE4, 0xF7, 0xFF, 0x78, 0x20, 0x19, 0x50, 0xC1, 0xC4, 0x80, 0x0A, 0xFE, 0xFF, 0x5F, 0x3F,
+    0xD0, 0xA4, 0x00, 0x98, 0x04, 0xBA, 0x16, 0xE8, 0xE6, 0x05, 0xFF, 0xFF, 0xF7, 0x6F, 0x9B, 0xF9,
+    0xF7, 0xFF, 0x7F, 0xFF, 0xEF, 0xFF, 0x81, 0x80, 0x0F, 0x4C, 0xB2, 0x80, 0xC8, 0x78, 0x86, 0x2D,
+    0xFF, 0xDE, 0xD7, 0x30, 0x32, 0x00, 0x00, 0xE7, 0x7B, 0x67, 0x1E, 0x78, 0x9C, 0xB5, 0xCF, 0xC1,
+    0x09, 0xC2, 0x40, 0x10, 0x85, 0xE1, 0x8D, 0x04, 0x74, 0x8D, 0x07, 0x6F, 0xDE, 0xC4, 0x0E, 0xB4,
+    0x03, 0x5B, 0xB0, 0x03, 0x5B, 0xB0, 0x93, 0xB4, 0x60, 0x09, 0x9E, 0xBC, 0xC6, 0x46, 0x24, 0x25,
+    0x18, 0x10, 0x45, 0x11, 0xF3, 0x3B, 0xBB, 0x6F, 0x20, 0x15, 0x38, 0xA7, 0x8F, 0x65, 0xF7, 0xCD,
+    0xDB, 0x0E, 0xA6, 0x41, 0xD3, 0xFD, 0x81, 0x1F, 0x88, 0xE2, 0x11, 0x1A, 0x3F, 0x7D, 0xC3, 0x4C,
+    0x3C, 0x40, 0x5B, 0x24, 0xC6, 0xF0, 0x84, 0x65, 0x7E, 0x16, 0x77, 0x70, 0x1B, 0x65, 0x4E, 0xEE,
+    0xB0, 0x55, 0xD8, 0xA2, 0x87, 0x52, 0x3C, 0xC3, 0xDE, 0x57, 0x7C, 0x61, 0xED, 0xB4, 0x69, 0x07,
+    0x5A, 0xA0, 0x78, 0xD5, 0x65, 0x63, 0xB3, 0xB1, 0xDC, 0x22, 0xB3, 0x0A, 0xAF, 0x54, 0x41, 0x1D,
+    0x2E, 0x50, 0x3B, 0x57, 0xA4, 0x25, 0x2A, 0x99, 0xFB, 0x88, 0xA7, 0xA1, 0xFA, 0xDC, 0x6A, 0x8C,
+    0xFD, 0x6F, 0x0F, 0x2B, 0xF7, 0x03, 0x0A, 0x1B, 0x9B, 0x80, 0x78, 0x9C, 0xFB, 0xF0, 0xFF, 0x3F,
+    0xD7, 0x07, 0x3A, 0x63, 0x00, 0xD5, 0x22, 0x56, 0x19, 0x78, 0x9C, 0xFB, 0xF0, 0x3F, 0x9F, 0xA1,
+    0xF0, 0xCD, 0xFB, 0x1A, 0x26, 0x06, 0x81, 0xE3, 0xFF, 0xCE, 0x89, 0x33, 0x30, 0x7C, 0xF8, 0xBF,
+    0xDE, 0xE1, 0xDF, 0xFF, 0xFF, 0x40, 0xE1, 0x6F, 0x40, 0xF2, 0x3F, 0x2B, 0x50, 0xE0, 0xFD, 0x67,
+    0x10, 0xEB, 0x7F, 0x08, 0x98, 0xB4, 0x07, 0x0A, 0xA0, 0x80, 0xFD, 0x60, 0x81, 0xFD, 0x2B, 0x41,
+    0x9A, 0xFE, 0x77, 0xFF, 0x02, 0x12, 0x8C, 0x20, 0x01, 0x66, 0x86, 0x87, 0x40, 0x52, 0x8F, 0x41,
+    0x01, 0x48, 0xB2, 0x7C, 0x00, 0x99, 0xC7, 0x50, 0x00, 0x62, 0x32, 0x30, 0xFC, 0xF8, 0xFF, 0x9F,
+    0x0D, 0x28, 0x20, 0xCF, 0xC0, 0x60, 0xF0, 0xFF, 0xFF, 0x7B, 0x06, 0x06, 0x86, 0xAF, 0xFF, 0xFF,
+    0xB3, 0x03, 0x05, 0x78, 0x19, 0x40, 0x8A, 0xF7, 0x03, 0x05, 0x3E, 0x43, 0x04, 0xB8, 0x19, 0x18,
+    0x04, 0xFE, 0xFF, 0x9F, 0x8F, 0x10, 0xE0, 0x02, 0x0B, 0xF4, 0x0F, 0x39, 0x01, 0x00, 0xCF, 0x7E,
+    0xCE, 0x77, 0x78, 0x9C, 0xC5, 0xCA, 0xBD, 0x11, 0x40, 0x40, 0x10, 0x40, 0xE1, 0xF5, 0x13, 0x9D,
+    0x51, 0x83, 0x56, 0x74, 0xA0, 0x05, 0x1D, 0x28, 0x81, 0x36, 0x04, 0x6A, 0x50, 0x8A, 0x42, 0x04,
+    0x77, 0x33, 0x12, 0x0C, 0x9E, 0x5D, 0xF4, 0xE0, 0x45, 0x5F, 0xF0, 0x02, 0x8D, 0xD4, 0x33, 0x43,
+    0x22, 0x12, 0x18, 0xCB, 0x13, 0x18, 0x8D, 0x7E, 0xC1, 0x72, 0xCA, 0xAF, 0xEA, 0xE1, 0xD4, 0x1F,
+    0x76, 0x18, 0x53, 0xE9, 0xC0, 0x1B, 0x5B, 0x11, 0xB9, 0xC0, 0x58, 0x28, 0x77, 0x88, 0x94, 0xB9,
+    0x72, 0x83, 0x58, 0x99, 0x29, 0xD7, 0x97, 0xEE, 0x17, 0xDE, 0xDD, 0x5E, 0x88, 0xDD, 0x78, 0x9C,
+    0x63, 0x60, 0x60, 0x68, 0x79, 0xF3, 0x7F, 0x2F, 0x1B, 0x03, 0x08, 0x1C, 0xFE, 0x0F, 0x02, 0xEC,
+    0x40, 0x56, 0x00, 0x98, 0xF5, 0x7F, 0x3F, 0x90, 0xF9, 0x19, 0xC2, 0xFC, 0xCF, 0xC5, 0xC0, 0xF0,
+    0x17, 0x28, 0xB2, 0x12, 0x48, 0xC4, 0x83, 0xE4, 0xEF, 0x33, 0x31, 0x34, 0x00, 0x49, 0x86, 0x0D,
+    0xFF, 0xFF, 0xDB, 0x03, 0x95, 0xFD, 0xFE, 0xFF, 0x9F, 0xF9, 0xC3, 0xFF, 0xFF, 0xBC, 0x40, 0xE6,
+    0xD7, 0xFF, 0xFF, 0x39, 0x3E, 0x81, 0x35, 0x30, 0x80, 0x28, 0xA0, 0x01, 0x1C, 0x40, 0x26, 0x50,
+    0x92, 0xE7, 0x0B, 0xC4, 0x74, 0x28, 0x13, 0x26, 0x8A, 0xA4, 0x16, 0x61, 0x02, 0x3B, 0xD0, 0x5C,
+    0x7F, 0x88, 0xB9, 0x2C, 0x40, 0xDB, 0xDE, 0x33, 0x31, 0x14, 0x80, 0x6C, 0x63, 0xF8, 0x03, 0x74,
+    0xC3, 0x4C, 0xA0, 0x1B, 0xF2, 0xC1, 0x1A, 0xC0, 0x80, 0x9B, 0x81, 0xC1, 0x01, 0xEA, 0x5E, 0x46,
+    0xA0, 0x8E, 0x4D, 0x60, 0x26, 0x07, 0xD8, 0x47, 0xCD, 0x40, 0xBF, 0x89, 0x01, 0x69, 0x00, 0x1C,
+    0xAB, 0x81, 0xFE, 0x78, 0x9C, 0xFB, 0xF0, 0x7F, 0x3F, 0x43, 0xC2, 0xEB, 0xF7, 0xD9, 0x0C, 0x0C,
+    0x0C, 0x1F, 0xFE, 0xFF, 0x57, 0xF8, 0xF3, 0xFF, 0xFF, 0x7F, 0x5D, 0x30, 0xF3, 0x2A, 0x90, 0xF5,
+    0xFF, 0x3D, 0x23, 0x88, 0x09, 0x01, 0xDC, 0x60, 0xE6, 0xFA, 0x15, 0xFF, 0xFE, 0xFF, 0xB7, 0x07,
+    0x31, 0xEF, 0x33, 0x32, 0x1C, 0xFC, 0xFF, 0x7F, 0x3E, 0x88, 0x69, 0xCF, 0xC0, 0xA0, 0x00, 0x54,
+    0x0C, 0x62, 0xF2, 0x01, 0x0D, 0x02, 0x1A, 0xC2, 0xF8, 0x01, 0xA4, 0x81, 0x81, 0xE1, 0xE7, 0xFF,
+    0xFF, 0xCC, 0x40, 0x26, 0x17, 0x90, 0xF9, 0xFD, 0xFF, 0x7F, 0x16, 0x04, 0x93, 0x15, 0x55, 0x94,
+    0x07, 0xA2, 0x96, 0x09, 0xC8, 0xE4, 0x47, 0x98, 0x10, 0x0F, 0x36, 0xF7, 0x3E, 0xC8, 0xDC, 0xF7,
+    0xCC, 0x0C, 0x17, 0xFF, 0xFF, 0xEF, 0x07, 0xBB, 0x61, 0xFF, 0x4A, 0x20, 0xA1, 0x8F, 0x70, 0x19,
+    0x17, 0x88, 0xF9, 0x1B, 0xC4, 0xBA, 0x0F, 0x76, 0xAF, 0x3B, 0xD0, 0x89, 0xFF, 0x65, 0xC0, 0xBE,
+    0xE0, 0x28, 0x7C, 0xF3, 0x3E, 0x1A, 0xE2, 0x37, 0x4E, 0x06, 0x08, 0x80, 0x5A, 0x4C, 0x75, 0x26,
+    0x00, 0xDF, 0x30, 0xAD, 0x18, 0x78, 0x9C, 0xB5, 0xCE, 0xCD, 0x0D, 0x41, 0x41, 0x14, 0x05, 0xE0,
+    0x73, 0x6D, 0xFC, 0x24, 0x44, 0x09, 0xAF, 0x03, 0x1A, 0xD0, 0x02, 0x4A, 0x50, 0x80, 0x85, 0x02,
+    0x2C, 0xEC, 0x6C, 0x55, 0xA0, 0x07, 0x5B, 0x1B, 0x3A, 0x40, 0x1B, 0x2C, 0x46, 0x78, 0xC2, 0xE3,
+    0xC5, 0x71, 0xEE, 0x9B, 0x17, 0xD1, 0x80, 0x9B, 0xCC, 0xCC, 0x97, 0x99, 0xCC, 0xB9, 0x17, 0x18,
+    0x1E, 0xC3, 0xD4, 0xB6, 0xA4, 0xA1, 0xFD, 0x22, 0xD9, 0x3F, 0x3B, 0x0F, 0xF4, 0xBA, 0x39, 0x33,
+    0x96, 0x65, 0x89, 0xB6, 0xCD, 0xBA, 0xE0, 0x8C, 0x0C, 0x15, 0xAC, 0x9C, 0x7B, 0x72, 0x00, 0xE0,
+    0x2D, 0xEA, 0x6B, 0x4B, 0x7C, 0x88, 0x17, 0xB2, 0x21, 0x7A, 0xC2, 0x95, 0xAC, 0x89, 0x3A, 0x2C,
+    0x25, 0xAB, 0x25, 0x7F, 0x6E, 0xB5, 0xEA, 0x62, 0x1A, 0x13, 0x9A, 0xE2, 0x3D, 0xE6, 0x76, 0xC4,
+    0x5C, 0x5C, 0x90, 0x3B, 0xC3, 0xC4, 0xBB, 0x75, 0xB5, 0x2D, 0xE7, 0xB9, 0x13, 0xCF, 0xEF, 0x64,
+    0x71, 0xDE, 0xE0, 0x8D, 0x91, 0xF8, 0x63, 0xCF, 0x13, 0x80, 0xD1, 0x29, 0x8C, 0x8B, 0x71, 0x10,
+    0x2B, 0xFB, 0x23, 0x3F, 0x12, 0x4C, 0xAB, 0xFF, 0x78, 0x9C, 0xFB, 0xF0, 0x3F, 0x9E, 0xC1, 0xE0,
+    0xD5, 0x7F, 0xD6, 0x0F, 0xFF, 0xE7, 0x33, 0xFC, 0xF8, 0x0F, 0xA2, 0xCF, 0x4F, 0xF8, 0xFF, 0xFF,
+    0x3F, 0xCB, 0x87, 0xFF, 0xFF, 0xBF, 0x01, 0x69, 0x66, 0x20, 0x0D, 0x02, 0x8C, 0x20, 0xFA, 0x7E,
+    0x44, 0x2A, 0x03, 0x88, 0x66, 0x63, 0x60, 0x00, 0xD1, 0xF5, 0x0C, 0x10, 0x9A, 0x1F, 0x4A, 0x73,
+    0x43, 0x69, 0x2E, 0x5A, 0xD0, 0x00, 0xA0, 0x9E, 0x51, 0x9B, 0x78, 0x9C, 0x63, 0x60, 0x98, 0xFA,
+    0xE6, 0xFF, 0xB9, 0x48, 0x46, 0x06, 0x86, 0xCB, 0xFF, 0x41, 0x60, 0x3D, 0x83, 0x01, 0x98, 0xFE,
+    0x7F, 0x9F, 0xE1, 0x02, 0x84, 0x91, 0xCF, 0xF0, 0xE9, 0xFF, 0xFF, 0x58, 0xE3, 0xA9, 0xFF, 0xF8,
+    0x19, 0xBE, 0xFC, 0xFF, 0xCF, 0xC6, 0xC0, 0x10, 0xC0, 0xC6, 0xF0, 0xF9, 0xFF, 0x7F, 0x19, 0x06,
+    0x10, 0xF8, 0x08, 0x54, 0xA0, 0x01, 0x62, 0x2C, 0x00, 0x29, 0x8D, 0x06, 0x32, 0x04, 0xFE, 0x82,
+    0x58, 0xB1, 0x40, 0xD6, 0x42, 0xB0, 0x76, 0x2E, 0x20, 0x6B, 0x11, 0x88, 0xD1, 0x0F, 0x52, 0x56,
+    0xF8, 0x0F, 0xC8, 0x62, 0x04, 0xB1, 0x0A, 0x80, 0x0C, 0x56, 0xB0, 0x19, 0x5F, 0x81, 0xA6, 0x4E,
+    0x66, 0x06, 0x32, 0x80, 0xA6, 0xB2, 0x7E, 0x79, 0x9F, 0xA9, 0x1C, 0x0C, 0x34, 0x82, 0xE9, 0x0B,
+    0xC4, 0xF6, 0xFD, 0x0C, 0x50, 0x86, 0x1E, 0x48, 0x1A, 0x08, 0xCE, 0x33, 0x31, 0x08, 0x2C, 0x7B,
+    0xF3, 0xFF, 0x7D, 0x0F, 0x50, 0x07, 0x00, 0x7D, 0x9B, 0x6A, 0xF5, 0x78, 0x9C, 0x63, 0x60, 0x30,
+    0x48, 0x13, 0x63, 0x00, 0x81, 0x0D, 0xFF, 0xED, 0xC1, 0xF4, 0x47, 0x28, 0xFD, 0x1D, 0x4A, 0xFF,
+    0x85, 0xD0, 0x9B, 0xFE, 0x83, 0x00, 0x7F, 0xC3, 0x7F, 0x08, 0xFD, 0x09, 0x8D, 0x76, 0x98, 0xF2,
+    0xFF, 0x7F, 0xBE, 0x8B, 0x0B, 0x0B, 0x43, 0xC2, 0x7F, 0x88, 0x7A, 0x2A, 0xD0, 0xFE, 0x20, 0x3A,
+    0xE0, 0xFF, 0xFF, 0xF5, 0x20, 0x5A, 0x01, 0x68, 0x4B, 0xCF, 0x4E, 0xA0, 0xD0, 0x3F, 0x90, 0x7D,
+    0x40, 0xFA, 0x1B, 0x94, 0x9E, 0x00, 0xA5, 0x19, 0x96, 0xFC, 0x7B, 0x3F, 0x87, 0x05, 0x00, 0xE1,
+    0xE8, 0x5B, 0xB8, 0x78, 0x9C, 0xFB, 0xF4, 0xFF, 0x3F, 0x07, 0x03, 0x03, 0xC3, 0xAF, 0xFF, 0xFF,
+    0x3F, 0xD1, 0x9A, 0xF5, 0x1B, 0x0B, 0xEB, 0x1F, 0x98, 0xC5, 0xC5, 0xC0, 0x20, 0xF0, 0xFF, 0xFF,
+    0xFF, 0x8F, 0xFF, 0xFF, 0xF3, 0x31, 0x30, 0x34, 0x00, 0x59, 0x1F, 0xFE, 0xFF, 0xAF, 0x67, 0x60,
+    0xF8, 0x0A, 0x64, 0x6D, 0x00, 0xE2, 0x9E, 0x93, 0x40, 0xE2, 0xBF, 0xC3, 0x7F, 0x18, 0x00, 0xE9,
+    0x07, 0x82, 0xCF, 0x40, 0x16, 0x48, 0xFA, 0xBF, 0x2D, 0x90, 0x64, 0x60, 0x58, 0xF2, 0xF7, 0x7D,
+    0x36, 0x43, 0xC1, 0xFF, 0xFF, 0x00, 0x2D, 0x4E, 0x89, 0x33, 0x78, 0x9C, 0x25, 0x8E, 0xC1, 0x09,
+    0xC2, 0x40, 0x10, 0x45, 0xBF, 0x12, 0x82, 0x48, 0x90, 0x74, 0xA0, 0x1D, 0xD8, 0x82, 0x1D, 0xD8,
+    0x82, 0x1D, 0x68, 0x09, 0x76, 0x60, 0x0B, 0x1E, 0xBC, 0xDB, 0x82, 0x1D, 0xA4, 0x05, 0x8F, 0xDE,
+    0x42, 0x44, 0x8C, 0x84, 0xE8, 0xF3, 0xCF, 0xEE, 0x1C, 0x76, 0xDF, 0xB0, 0xB3, 0xEF, 0xCF, 0x17,
+    0x26, 0x92, 0x0E, 0xB0, 0xEF, 0xA1, 0x34, 0xDE, 0x60, 0xD9, 0x41, 0x65, 0x7C, 0xC2, 0xFC, 0xEC,
+    0xD6, 0xE8, 0xC7, 0x62, 0xE3, 0x21, 0xE3, 0x48, 0x2B, 0xFD, 0x68, 0xA4, 0x1A, 0x4E, 0xD2, 0x27,
+    0x14, 0x16, 0xAC, 0xD3, 0x87, 0x32, 0x04, 0x95, 0xF2, 0xD9, 0x25, 0xE5, 0x2E, 0x14, 0x7D, 0x0A,
+    0xAA, 0x43, 0x31, 0x72, 0xB5, 0x46, 0x03, 0x8D, 0xDB, 0x6D, 0xE0, 0x0B, 0x3C, 0xB4, 0x08, 0xBC,
+    0xC3, 0x05, 0x66, 0x81, 0x47, 0x78, 0xC0, 0x34, 0x70, 0x05, 0x43, 0x24, 0x2A, 0xE5, 0xE7, 0x3D,
+    0x5C, 0x6F, 0xF2, 0x76, 0x2E, 0x47, 0x31, 0xCF, 0xE8, 0x95, 0x29, 0x32, 0x7A, 0xE5, 0x36, 0xEE,
+    0x3F, 0x9E, 0xF0, 0x6B, 0xA1, 0x78, 0x9C, 0x2D, 0x90, 0xCB, 0x51, 0x42, 0x41, 0x10, 0x45, 0xAF,
+    0x3F, 0x40, 0x40, 0x20, 0x04, 0x33, 0xC0, 0x0C, 0xA8, 0x32, 0x02, 0x43, 0x30, 0x03, 0x58, 0xB0,
+    0x7F, 0x64, 0xA0, 0x19, 0xE0, 0xCE, 0x25, 0x64, 0x80, 0x19, 0xE0, 0xD6, 0x95, 0x66, 0x00, 0x25,
+    0x96, 0x4F, 0xF1, 0xE1, 0xF1, 0x76, 0x3F, 0x67, 0xD1, 0xFF, 0xE9, 0x73, 0x67, 0x4A, 0x38, 0x96,
+    0xDE, 0xE0, 0x4E, 0xD2, 0x17, 0x68, 0x07, 0x0D, 0x85, 0x5D, 0xBB, 0x50, 0xB1, 0x8A, 0x5E, 0x5B,
+    0x2A, 0x71, 0x4F, 0x03, 0x28, 0xF4, 0x00, 0x3D, 0xE9, 0xC7, 0x85, 0x53, 0xDD, 0xC0, 0xB0, 0x36,
+    0x82, 0x03, 0x2D, 0xDD, 0x47, 0xD3, 0x63, 0x63, 0x5D, 0xB1, 0x29, 0xE9, 0xEA, 0x19, 0xCE, 0x63,
+    0xD1, 0x42, 0x13, 0x16, 0x3B, 0xFA, 0x7A, 0x8F, 0x7B, 0x46, 0x6D, 0xB4, 0x64, 0xBC, 0x65, 0xA4,
+    0xCF, 0xD8, 0x1C, 0xC4, 0x13, 0x67, 0x4F, 0x06, 0xEC, 0x4D, 0x95, 0xB6, 0xD0, 0xF4, 0xFC, 0xCC,
+    0xC9, 0xAF, 0x8B, 0x0A, 0x6E, 0xBB, 0xA4, 0x63, 0xDA, 0x20, 0x81, 0xBA, 0x85, 0x8B, 0x3D, 0x2D,
+    0x67, 0xD7, 0x29, 0x29, 0xB8, 0xFD, 0xCA, 0xDB, 0x0F, 0x4C, 0x93, 0x2A, 0x47, 0x23, 0x38, 0xD2,
+    0x37, 0x8F, 0x70, 0xA6, 0x7C, 0x62, 0xC1, 0xAB, 0xCC, 0x7C, 0x49, 0xAA, 0xF4, 0xC1, 0x8A, 0xB9,
+    0xAC, 0xAA, 0x4A, 0x6A, 0x72, 0xAD, 0x3E, 0x5D, 0x91, 0x85, 0x25, 0x89, 0xFB, 0x77, 0x3E, 0x13,
+    0x12, 0x37, 0xAB, 0x9D, 0xCF, 0xA5, 0xA3, 0x8E, 0xE2, 0x1F, 0x6A, 0x6A, 0x70, 0x69, 0xA6, 0x9E,
+    0xA4, 0xFE, 0x01, 0xC9, 0x0B, 0xB9, 0x32, 0x78, 0x9C, 0x2D, 0x8D, 0xDB, 0x0D, 0x01, 0x51, 0x14,
+    0x45, 0x77, 0xC6, 0x07, 0x89, 0xA1, 0x05, 0x3A, 0xA0, 0x03, 0x1F, 0x0A, 0x50, 0x82, 0x16, 0x74,
+    0x30, 0x3A, 0xE0, 0x53, 0x17, 0x5A, 0x98, 0x0E, 0x68, 0x40, 0xE8, 0x40, 0xC6, 0x23, 0x1E, 0x09,
+    0xCB, 0x79, 0xB8, 0x1F, 0x27, 0x2B, 0x77, 0xED, 0xB3, 0xCF, 0x05, 0x66, 0x92, 0x6E, 0x30, 0x5A,
+    0xC0, 0xD1, 0xF0, 0x03, 0xED, 0x1C, 0xF6, 0xB1, 0x93, 0xAE, 0x30, 0x50, 0x03, 0x13, 0x69, 0x09,
+    0x5B, 0xBD, 0xA1, 0x93, 0xB1, 0x69, 0x2E, 0x78, 0xE2, 0x10, 0x5E, 0x5A, 0xE3, 0xCF, 0xBD, 0xF4,
+    0xE5, 0xEF, 0xA3, 0x3E, 0xBD, 0x74, 0x32, 0xEC, 0x27, 0xBE, 0x0C, 0x57, 0x41, 0xE3, 0x58, 0x6B,
+    0x39, 0xEE, 0x03, 0x7B, 0x8E, 0x4F, 0xD8, 0x40, 0x95, 0xFE, 0xEC, 0x7D, 0x45, 0xF8, 0xB9, 0xEE,
+    0x50, 0x86, 0xEF, 0xAA, 0xF6, 0x84, 0xEF, 0x17, 0x1A, 0xFA, 0xAC, 0xB3, 0xD3, 0xBA, 0xCB, 0x47,
+    0xF6, 0xD8, 0xC5, 0xEA, 0x07, 0xEA, 0x9B, 0x79, 0x20, 0x78, 0x9C, 0x3D, 0x8F, 0xBD, 0x6D, 0x02,
+    0x41, 0x14, 0x06, 0x3F, 0x84, 0x2D, 0x04, 0x16, 0x36, 0x1D, 0x40, 0x09, 0xEE, 0x00, 0x3A, 0x80,
+    0x0A, 0xA0, 0x00, 0x07, 0x04, 0x2E, 0x80, 0x2B, 0x81, 0x98, 0xE4, 0xE8, 0x00, 0x32, 0x87, 0xB4,
+    0x40, 0x07, 0x10, 0x93, 0x1C, 0xB6, 0x2C, 0x63, 0xC4, 0xCF, 0xF0, 0xDE, 0xBE, 0xD3, 0x6D, 0x34,
+    0x5A, 0xED, 0x8C, 0xBE, 0xBD, 0xC2, 0xB3, 0xA4, 0x39, 0x4C, 0xFF, 0xE0, 0xC5, 0x70, 0x0F, 0xDD,
+    0x23, 0xBC, 0x19, 0xFE, 0x42, 0x6B, 0x09, 0x13, 0xC3, 0x33, 0x3C, 0xBD, 0xC3, 0xCA, 0xF0, 0x4E,
+    0x21, 0xDD, 0x40, 0xB2, 0x8B, 0x5C, 0x3A, 0x79, 0x22, 0x83, 0xBE, 0xF4, 0x6D, 0x82, 0xB6, 0xD0,
+    0x96, 0x96, 0x9E, 0xF8, 0x81, 0x86, 0x34, 0x80, 0xA1, 0xFE, 0xA1, 0x96, 0xE4, 0xDC, 0xDC, 0x8D,
+    0x91, 0x79, 0x45, 0x2F, 0xE2, 0xEE, 0x7D, 0xC2, 0xAB, 0xE3, 0x1A, 0xBE, 0xA0, 0xE9, 0x38, 0x82,
+    0x03, 0xD4, 0x1D, 0xCD, 0xBB, 0xB1, 0x4B, 0xE4, 0x25, 0x66, 0x81, 0xD6, 0xA7, 0x1B, 0x68, 0x5E,
+    0x9A, 0x1F, 0x5E, 0xFA, 0x54, 0x78, 0xA8, 0xC2, 0x5C, 0xD5, 0x83, 0x7E, 0x89, 0x31, 0xD6, 0x4F,
+    0xE7, 0x9A, 0xC6, 0x4A, 0xD9, 0xE2, 0x82, 0x7F, 0xB1, 0x8C, 0xC6, 0xC2, 0xC0, 0x46, 0x85, 0xE3,
+    0x90, 0xB2, 0x7B, 0xF1, 0x51, 0x96, 0x1E, 0xB2, 0x05, 0x8D, 0x12, 0x78, 0x9C, 0x75, 0x8D, 0x41,
+    0x0A, 0x40, 0x60, 0x10, 0x46, 0x91, 0x48, 0x59, 0x38, 0x81, 0xDC, 0x84, 0x33, 0xA8, 0x7F, 0xCD,
+    0x4D, 0x1C, 0xC1, 0x15, 0x5C, 0xC2, 0x9A, 0x9B, 0xC8, 0x09, 0x14, 0x25, 0x25, 0x9E, 0x7F, 0x86,
+    0xAD, 0xD9, 0xBC, 0xD7, 0x37, 0xD3, 0x7C, 0x3B, 0xEF, 0xB8, 0xFB, 0xAF, 0x38, 0xA5, 0x31, 0xA6,
+    0x87, 0xC6, 0x91, 0xD9, 0x20, 0x16, 0x26, 0x37, 0x8B, 0x2B, 0xD2, 0x41, 0xA5, 0x1B, 0x7B, 0x1F,
+    0x09, 0x33, 0x98, 0x34, 0x18, 0x21, 0x57, 0x39, 0x20, 0x14, 0x16, 0x30, 0x68, 0x30, 0x43, 0xAA,
+    0x72, 0x82, 0x2F, 0xAC, 0xA1, 0xD5, 0x60, 0xB5, 0xDF, 0x6C, 0x9D, 0xF1, 0xAE, 0xAF, 0x3D, 0xE0,
+    0x5F, 0x1E, 0x5E, 0x79, 0x69, 0xAD, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x10, 0x58, 0xF6, 0xB6, 0x9E,
+    0x81, 0x81, 0xE1, 0xCB, 0xFF, 0xFF, 0x40, 0x4A, 0xE0, 0x3F, 0x98, 0x2A, 0x80, 0x50, 0x13, 0xFE,
+    0xFF, 0xEF, 0x17, 0x61, 0x60, 0x58, 0xF0, 0xFF, 0x3F, 0x07, 0x03, 0x98, 0x62, 0x81, 0x50, 0xCC,
+    0xB8, 0xA8, 0x0D, 0x10, 0xEA, 0x23, 0x98, 0x32, 0xF8, 0xF3, 0xFF, 0x3F, 0x03, 0xC3, 0x91, 0x7F,
+    0x40, 0x43, 0x18, 0x18, 0xBE, 0x01, 0x4D, 0x64, 0x07, 0x53, 0x12, 0x0C, 0x10, 0x1E, 0xD0, 0xC8,
+    0xA3, 0x40, 0xB9, 0xF9, 0x40, 0xAE, 0xC3, 0xDF, 0xFF, 0xFF, 0x19, 0xE1, 0xFA, 0x60, 0xA6, 0xE0,
+    0xB3, 0x08, 0xE1, 0x16, 0x90, 0xCB, 0x80, 0xEE, 0x9C, 0x2F, 0x02, 0x77, 0x35, 0xD4, 0x0F, 0x50,
+    0x1F, 0x81, 0xFD, 0x07, 0x00, 0xE8, 0xA7, 0x65, 0x7D, 0x78, 0x9C, 0xFB, 0xF9, 0x9F, 0xE3, 0x27,
+    0x7D, 0x11, 0x00, 0x37, 0x37, 0x4C, 0x01, 0x78, 0x9C, 0xFB, 0x7E, 0xAF, 0x9A, 0x91, 0x81, 0x81,
+    0xE1, 0xFB, 0xFF, 0xFF, 0xF9, 0x10, 0xEA, 0x3F, 0x23, 0x84, 0x62, 0x67, 0x60, 0x70, 0xFC, 0xF1,
+    0xFF, 0x3F, 0x27, 0x50, 0xB4, 0xE1, 0xFF, 0x7F, 0x2E, 0x20, 0xE5, 0x40, 0x14, 0xC5, 0x0D, 0xA4,
+    0x0C, 0xFE, 0xFF, 0xE7, 0x03, 0x52, 0x02, 0xFF, 0xFF, 0xEF, 0x67, 0x02, 0xD2, 0x40, 0x63, 0xEE,
+    0x7B, 0x33, 0x30, 0x14, 0xFC, 0x87, 0x58, 0xD2, 0x08, 0xA6, 0x1A, 0x20, 0xBC, 0x5F, 0xFF, 0xFF,
+    0xBF, 0xF7, 0x01, 0xA9, 0x3C, 0xCF, 0x0C, 0xD6, 0x27, 0x8F, 0x30, 0x85, 0x08, 0xFB, 0x26, 0x80,
+    0x29, 0xA8, 0x3B, 0xA1, 0xAE, 0x06, 0x51, 0x4C, 0x60, 0x2A, 0x1E, 0xE4, 0xA3, 0xFB, 0x60, 0xFF,
+    0x01, 0x00, 0x81, 0x52, 0x5F, 0x80, 0x78, 0x9C, 0x63, 0x60, 0x80, 0x83, 0x49, 0xFF, 0xF6, 0xB1,
+    0x82, 0x68, 0x36, 0x87, 0xFF, 0xFF, 0xFF, 0xBF, 0x67, 0x63, 0x60, 0x08, 0x90, 0xFF, 0xF4, 0x1F,
+    0xC4, 0xB4, 0x30, 0xFC, 0x25, 0xFF, 0xF5, 0x3F, 0x14, 0xC8, 0x7F, 0xED, 0x17, 0x5A, 0x02, 0x66,
+    0xF1, 0x3C, 0x65, 0x66, 0x60, 0x98, 0x08, 0x64, 0xDC, 0x67, 0x54, 0x01, 0xE9, 0x6B, 0xFC, 0x73,
+    0x9F, 0x1D, 0x61, 0x1A, 0x03, 0x00, 0xD7, 0x6E, 0x26, 0x84, 0x78, 0x9C, 0x63, 0x60, 0x38, 0xFA,
+    0xAF, 0x86, 0x91, 0x81, 0xE1, 0xE0, 0xFF, 0xFF, 0xFF, 0xED, 0x18, 0x18, 0xFE, 0x02, 0xA9, 0xFF,
+    0x4C, 0x0D, 0xFF, 0xFF, 0xCF, 0xFA, 0xF7, 0x9F, 0xE7, 0xC1, 0x7F, 0x3D, 0x86, 0x03, 0xFF, 0xED,
+    0x3F, 0xFD, 0x67, 0x67, 0x30, 0xF8, 0x9F, 0xFF, 0xE5, 0x3F, 0x0B, 0x03, 0xC3, 0xFF, 0xFE, 0xCF,
+    0x10, 0xDE, 0x07, 0x88, 0xDC, 0x04, 0x88, 0x4A, 0x01, 0x88, 0x3E, 0x86, 0x4B, 0x40, 0xD2, 0x8F,
+    0x81, 0x81, 0xE1, 0xF8, 0xFF, 0x5E, 0x46, 0x06, 0x00, 0x53, 0x31, 0x33, 0xDE, 0x78, 0x9C, 0x8D,
+    0x50, 0xC9, 0x0D, 0xC2, 0x40, 0x0C, 0xB4, 0x48, 0x10, 0x47, 0x78, 0xA4, 0x03, 0x52, 0x02, 0x25,
+    0xA4, 0x03, 0x4A, 0x20, 0x6F, 0x3E, 0xD0, 0x01, 0x74, 0xC0, 0x8B, 0x37, 0x25, 0x50, 0x02, 0x25,
+    0x00, 0x05, 0x90, 0x34, 0x80, 0x84, 0xC4, 0x25, 0x2E, 0x65, 0xB0, 0xD7, 0xD9, 0x6C, 0xC2, 0x8B,
+    0x79, 0xAC, 0x34, 0xF6, 0xDA, 0x9E, 0x19, 0x22, 0x83, 0x0F, 0x10, 0x90, 0xC5, 0x1C, 0x58, 0x97,
+    0x84, 0xAE, 0x40, 0xAB, 0x24, 0x11, 0x30, 0x74, 0xAD, 0x3D, 0xB2, 0x86, 0x63, 0x6F, 0x74, 0xE8,
+    0x1F, 0x84, 0xCB, 0x23, 0xD2, 0x71, 0x31, 0x18, 0x3E, 0x21, 0xD8, 0x78, 0x86, 0xDD, 0xA0, 0x58,
+    0x08, 0x99, 0xC2, 0xA2, 0xAB, 0x32, 0x80, 0x43, 0xCE, 0xCF, 0x8C, 0x59, 0x6E, 0x46, 0xA2, 0x07,
+    0x53, 0x8F, 0x12, 0xA8, 0xC4, 0x81, 0xF9, 0xBA, 0xB3, 0xEA, 0xEF, 0x40, 0x9F, 0xCE, 0xF2, 0x08,
+    0xB8, 0x3C, 0x91, 0x52, 0x60, 0x2D, 0xAE, 0x88, 0x4F, 0xB7, 0x0D, 0x8B, 0x81, 0x8C, 0x5E, 0x40,
+    0x53, 0x25, 0x01, 0x27, 0x36, 0x03, 0x5F, 0x15, 0xF2, 0x52, 0x89, 0xC7, 0x73, 0xAC, 0xDE, 0xAB,
+    0xCF, 0x55, 0x77, 0x6E, 0xC5, 0x4F, 0xCF, 0xDD, 0xAB, 0x6A, 0x19, 0xFD, 0xE8, 0xB4, 0x1E, 0x62,
+    0xB5, 0x2B, 0xFE, 0x7C, 0x8A, 0x24, 0x1C, 0x0E, 0xEA, 0x22, 0xDE, 0x53, 0x14, 0xDE, 0x93, 0x5A,
+    0x2E, 0x1A, 0x4C, 0xD1, 0xFA, 0xCD, 0xB3, 0x9A, 0xF5, 0x17, 0x4A, 0x06, 0xCA, 0xB4, 0x78, 0x9C,
+    0x7D, 0x8E, 0xBD, 0x0E, 0xC1, 0x60, 0x18, 0x85, 0xDF, 0x20, 0x15, 0x22, 0x74, 0x33, 0x56, 0xE2,
+    0x06, 0x3A, 0x59, 0xD9, 0x8C, 0x35, 0x59, 0x0D, 0x6E, 0xC0, 0x1D, 0xE0, 0x02, 0xA4, 0xBD, 0x02,
+    0xE9, 0x22, 0xB1, 0xD8, 0x0C, 0xA6, 0x4E, 0x76, 0x5D, 0x0C, 0x12, 0x91, 0xB8, 0x82, 0x22, 0xAA,
+    0xE2, 0xA7, 0xC7, 0x69, 0x3F, 0x56, 0x67, 0xF9, 0x9E, 0xBC, 0x39, 0x3F, 0x9F, 0x88, 0x73, 0xD0,
+    0x64, 0xED, 0x65, 0x44, 0x24, 0x42, 0x53, 0x80, 0x12, 0xE9, 0x81, 0xA1, 0x09, 0x54, 0x48, 0x77,
+    0x58, 0xBA, 0xBA, 0xB9, 0x41, 0x5E, 0xB6, 0x9B, 0xC4, 0xF7, 0x5F, 0xAD, 0x55, 0x8C, 0x85, 0x46,
+    0x18, 0x23, 0x15, 0xF1, 0xA2, 0xC8, 0x66, 0x89, 0x22, 0x64, 0xC5, 0xC4, 0xB4, 0xD1, 0x7F, 0x03,
+    0x45, 0x91, 0x36, 0xCD, 0x47, 0xA0, 0xAC, 0xF2, 0xAE, 0x1A, 0xA6, 0x46, 0x80, 0xC1, 0xBE, 0xF9,
+    0x3E, 0x46, 0x42, 0x83, 0x58, 0x65, 0x0D, 0xFD, 0xF5, 0x6D, 0x31, 0x92, 0xBA, 0x49, 0x77, 0x46,
+    0x3A, 0x03, 0x3D, 0x95, 0xB8, 0x02, 0x05, 0x11, 0x87, 0x74, 0x4B, 0xC7, 0x7D, 0x52, 0x98, 0xDE,
+    0x22, 0x12, 0xBF, 0x62, 0xD7, 0x97, 0x49, 0xD6, 0xC7, 0xAF, 0xA5, 0x93, 0x3E, 0xD6, 0x93, 0x1B,
+    0xB4, 0x20, 0xC8, 0x85, 0xA4, 0xDA, 0x0E, 0x5E, 0x55, 0x4E, 0x30, 0x3E, 0xC0, 0x37, 0x92, 0xE8,
+    0x78, 0x9C, 0x75, 0x90, 0x4D, 0x0E, 0x01, 0x41, 0x10, 0x85, 0xCB, 0x10, 0xD3, 0xF1, 0xB3, 0x75,
+    0x0E, 0x27, 0xC0, 0x0D, 0xB8, 0x81, 0x23, 0x70, 0x03, 0x12, 0x2E, 0x61, 0x67, 0x6B, 0x27, 0xF6,
+    0x93, 0x59, 0x38, 0x80, 0x23, 0x88, 0xBD, 0x64, 0xC4, 0x4F, 0x2C, 0x90, 0xE7, 0x55, 0x57, 0x09,
+    0x1B, 0x6F, 0xD1, 0xF5, 0xA5, 0xBA, 0xFA, 0x55, 0x55, 0x8B, 0x50, 0x03, 0x00, 0x65, 0x89, 0x3A,
+    0x00, 0x1D, 0x23, 0x79, 0x62, 0x57, 0x32, 0x5A, 0x02, 0x35, 0x4F, 0xDE, 0x31, 0x71, 0x6A, 0xA3,
+    0xF0, 0x37, 0x7F, 0x34, 0x3F, 0x22, 0xAB, 0x46, 0xDA, 0x42, 0x95, 0x7A, 0x27, 0x2A, 0x27, 0x5E,
+    0x0C, 0xD5, 0xF9, 0xC5, 0xCC, 0x8A, 0xC7, 0x50, 0xEF, 0xF7, 0x89, 0x4C, 0x79, 0xCA, 0x1A, 0xE8,
+    0xB2, 0xEC, 0xC1, 0xD1, 0x4E, 0x40, 0x93, 0x78, 0x03, 0xC2, 0xD9, 0x46, 0xD1, 0x40, 0x83, 0x40,
+    0xE4, 0x65, 0xE3, 0x6A, 0xEE, 0x8E, 0x9F, 0xEC, 0x4F, 0xED, 0xD7, 0x21, 0xA5, 0x6F, 0xDF, 0x7C,
+    0x2B, 0xEC, 0x56, 0x24, 0x32, 0xD6, 0x6E, 0xDC, 0x16, 0xF9, 0x82, 0x33, 0x8C, 0xE2, 0x83, 0xA8,
+    0xBA, 0x48, 0xCF, 0xE7, 0xD5, 0x8F, 0xD8, 0x44, 0x0C, 0x71, 0xA3, 0x19, 0x77, 0x6B, 0x31, 0xBE,
+    0x01, 0xAB, 0x45, 0x92, 0x74, 0x78, 0x9C, 0x55, 0xD1, 0xDD, 0x4D, 0x02, 0x41, 0x10, 0xC0, 0xF1,
+    0xF1, 0x40, 0x08, 0x8A, 0x42, 0x01, 0x24, 0xD0, 0x01, 0x25, 0xE8, 0x1B, 0x8F, 0xD2, 0x81, 0x76,
+    0x80, 0x1D, 0xC8, 0x93, 0x4F, 0x26, 0x47, 0x07, 0xD0, 0x01, 0x24, 0xBC, 0x13, 0x3A, 0xD0, 0x06,
+    0x0C, 0x74, 0x00, 0x44, 0xF1, 0xC2, 0x87, 0xF7, 0x77, 0x66, 0x6F, 0x6F, 0x91, 0x79, 0xB8, 0xBD,
+    0xDF, 0xEE, 0xDE, 0xEC, 0xCC, 0x9E, 0x88, 0xC8, 0x00, 0xA8, 0x4A, 0x1E, 0x4B, 0x55, 0x3B, 0xE8,
+    0x5B, 0xF5, 0x12, 0xB4, 0x57, 0x2D, 0x82, 0xF4, 0x1D, 0x0A, 0x1E, 0x4F, 0xF0, 0x06, 0x15, 0xAF,
+    0x09, 0x74, 0xE0, 0xD6, 0x6B, 0xA3, 0xDB, 0x52, 0x1E, 0xBC, 0x12, 0x56, 0x9A, 0x68, 0xEC, 0x75,
+    0x64, 0x28, 0x5B, 0xC8, 0xD0, 0x42, 0x77, 0xAD, 0xE1, 0xD2, 0xA9, 0x0F, 0x35, 0xCB, 0x74, 0xED,
+    0xF4, 0x01, 0x57, 0x76, 0x4A, 0xD3, 0xE9, 0x0B, 0x4A, 0x52, 0x87, 0x9E, 0xD3, 0x0E, 0x2E, 0x2C,
+    0xD5, 0xBB, 0x53, 0xEA, 0xC6, 0x04, 0x22, 0x1D, 0xEE, 0xC9, 0xA3, 0xAC, 0x1A, 0x05, 0xDD, 0xA8,
+    0xD6, 0x41, 0x77, 0xAA, 0x6D, 0x50, 0xAC, 0x3A, 0xC0, 0xA7, 0x05, 0x5A, 0xAD, 0x1D, 0xB4, 0x72,
+    0xA9, 0x75, 0xB6, 0x68, 0x45, 0x64, 0xD5, 0xFF, 0x58, 0xC3, 0x73, 0x78, 0xCC, 0xBB, 0xAC, 0x65,
+    0x0F, 0x0B, 0x37, 0x9D, 0x58, 0xCD, 0x16, 0xCF, 0xF6, 0xC9, 0x6F, 0xDE, 0x98, 0xB6, 0x69, 0xF5,
+    0xFA, 0x18, 0xD0, 0x90, 0x53, 0x1C, 0x16, 0xA7, 0x15, 0xBD, 0x81, 0xF6, 0xBF, 0xA5, 0x8D, 0xBF,
+    0x09, 0xF1, 0x37, 0x70, 0xAE, 0xF8, 0x35, 0x0A, 0xB2, 0x7F, 0x58, 0x0C, 0xEA, 0x9E, 0x49, 0xA6,
+    0xE9, 0x2C, 0x92, 0x3F, 0x94, 0xF8, 0xBD, 0x0E, 0x78, 0x9C, 0x3D, 0xCE, 0xBB, 0x0E, 0x01, 0x51,
+    0x10, 0x06, 0xE0, 0x3F, 0x6E, 0x09, 0x05, 0xDB, 0x29, 0x77, 0x13, 0xBD, 0xA8, 0xD4, 0x3A, 0x0A,
+    0x09, 0x95, 0x56, 0xA1, 0x52, 0xF1, 0x08, 0x3C, 0x80, 0xEC, 0x3E, 0x81, 0x68, 0x24, 0x1A, 0x9D,
+    0x42, 0xE5, 0x19, 0xB6, 0x95, 0x48, 0x44, 0xAB, 0x39, 0xEE, 0x0A, 0xEC, 0x6F, 0xF6, 0x9C, 0xC3,
+    0x34, 0xF3, 0x65, 0x32, 0x37, 0xA0, 0xB6, 0x8E, 0xB8, 0xCC, 0x00, 0x18, 0x53, 0x87, 0xF0, 0x62,
+    0xE4, 0x03, 0x33, 0x23, 0x26, 0x51, 0xE1, 0xB4, 0xDA, 0xFB, 0x90, 0x39, 0xA0, 0x2E, 0xCD, 0x07,
+    0x32, 0x0F, 0x1D, 0xD2, 0x52, 0x30, 0x1A, 0x91, 0x2E, 0x50, 0x5B, 0xEC, 0x22, 0xC6, 0x1A, 0x46,
+    0x66, 0xD6, 0x75, 0xDE, 0x76, 0x8B, 0x1B, 0xAF, 0x9B, 0x74, 0xE6, 0xA2, 0x33, 0xD9, 0x35, 0x13,
+    0x37, 0x32, 0x0B, 0x04, 0xA2, 0x87, 0x3E, 0x1E, 0x8A, 0xEE, 0xBA, 0xF6, 0x14, 0xC9, 0x2B, 0x7E,
+    0x69, 0x15, 0xCF, 0x86, 0xFC, 0x6D, 0x69, 0xEB, 0xD4, 0x7A, 0xC9, 0x0D, 0x69, 0xA1, 0x4A, 0xDD,
+    0x45, 0xDE, 0x96, 0x9B, 0x22, 0x4E, 0xF1, 0x07, 0x3A, 0x9E, 0x2A, 0x61, 0x10, 0xB0, 0x6C, 0x4B,
+    0x0F, 0xA6, 0xAD, 0x22, 0x65, 0xE1, 0x70, 0x6F, 0x05, 0xB2, 0xDF, 0x30, 0x92, 0x77, 0x07, 0x46,
+    0xD7, 0xBF, 0xBC, 0xA3, 0x6A, 0x7E, 0x01, 0x7A, 0xFB, 0x94, 0x97, 0x78, 0x9C, 0x7D, 0x90, 0x3D,
+    0x0E, 0x41, 0x51, 0x10, 0x85, 0x87, 0x27, 0x7E, 0x13, 0xD1, 0xE8, 0x24, 0x2C, 0xC1, 0x12, 0x6C,
+    0x43, 0x67, 0x07, 0x0A, 0x0B, 0x60, 0x07, 0x2A, 0x35, 0x3B, 0xA0, 0x53, 0xB2, 0x01, 0x22, 0xD1,
+    0x12, 0xA2, 0x52, 0x90, 0x17, 0x11, 0xF2, 0x3C, 0xE2, 0x73, 0xEF, 0xBB, 0x93, 0xA7, 0x90, 0x38,
+    0xC5, 0xCD, 0x97, 0x99, 0x7B, 0x66, 0x72, 0x46, 0xC4, 0x6A, 0x05, 0x43, 0x71, 0x7A, 0x40, 0xD6,
+    0x51, 0x0B, 0xDA, 0x5A, 0xBC, 0xE2, 0x7B, 0x8E, 0x6A, 0x6F, 0x2A, 0x5A, 0x9C, 0xD3, 0x97, 0xBF,
+    0x1A, 0x9C, 0x58, 0x36, 0x23, 0x0A, 0xB0, 0x1A, 0x9B, 0x19, 0x6B, 0x9C, 0xF2, 0xD2, 0x50, 0xC2,
+    0x93, 0x83, 0x79, 0xFD, 0x2D, 0xEC, 0x44, 0x9E, 0x30, 0xF3, 0xA4, 0x7E, 0xEC, 0x46, 0xFD, 0x8C,
+    0x35, 0x97, 0x65, 0x62, 0xBC, 0x3A, 0xF3, 0x02, 0x55, 0xC5, 0x1B, 0x14, 0x14, 0x03, 0xFD, 0x6A,
+    0x14, 0x42, 0x4A, 0xF1, 0x05, 0xC9, 0x5F, 0x7C, 0x7E, 0x31, 0xB4, 0xCB, 0xE3, 0xD8, 0x69, 0xC5,
+    0x3B, 0xE4, 0xE2, 0xDC, 0x14, 0x15, 0xF7, 0xD0, 0x55, 0xEC, 0xA1, 0x3B, 0x4A, 0x52, 0x32, 0x38,
+    0x34, 0xE3, 0x3A, 0x9B, 0xC8, 0x87, 0xBF, 0x78, 0xDB, 0x14, 0x23, 0x8D, 0xB6, 0x8B, 0xB3, 0x47,
+    0xD8, 0x78, 0xB9, 0x3B, 0x58, 0x6F, 0x7D, 0x7A, 0x36, 0xD7, 0x49, 0xC8, 0x07, 0x7B, 0x24, 0x90,
+    0x1E, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x82, 0x03, 0xFF, 0xFF, 0xEF, 0x07, 0xD1, 0x0C, 0xDF, 0xFF,
+    0xFF, 0xE7, 0x02, 0xD1, 0x0E, 0xFF, 0xFF, 0xD7, 0x83, 0x05, 0x1E, 0xFD, 0xFF, 0xCF, 0x02, 0xA2,
+    0x05, 0xFE, 0xFE, 0xD7, 0x05, 0x0B, 0x2C, 0xF8, 0xBF, 0x9E, 0x01, 0x07, 0x68, 0x79, 0xF3, 0xFF,
+    0x9C, 0x27, 0x90, 0x3E, 0xFC, 0x1F, 0x04, 0xF4, 0x18, 0x12, 0xC0, 0xF4, 0x7F, 0x3E, 0x86, 0x2F,
+    0x10, 0x06, 0x07, 0xC3, 0xBF, 0xFF, 0xFF, 0xCF, 0xCF, 0xFC, 0xF3, 0x9F, 0x09, 0x28, 0xF3, 0x9E,
+    0x99, 0x81, 0xA1, 0x95, 0x61, 0xC3, 0xFF, 0xFF, 0xF1, 0x60, 0xBD, 0x1F, 0x40, 0xEA, 0x40, 0xE0,
+    0x13, 0xD4, 0x05, 0x0C, 0x9F, 0x41, 0x1A, 0x40, 0x00, 0xA8, 0x9B, 0x1D, 0x55, 0x04, 0xAE, 0x06,
+    0xAE, 0xEB, 0x02, 0xD4, 0x1C, 0xC6, 0x06, 0x88, 0xC9, 0x8B, 0xB9, 0x15, 0xFE, 0x83, 0xEC, 0x7A,
+    0xFD, 0x9F, 0x9B, 0xE1, 0x07, 0xC4, 0x76, 0x6E, 0x90, 0x65, 0x10, 0x06, 0x54, 0x08, 0x68, 0xAA,
+    0xC0, 0xB6, 0xBF, 0xFF, 0xF7, 0x89, 0x33, 0x00, 0x00, 0x3E, 0xE8, 0x6E, 0x98, 0x78, 0x9C, 0xFB,
+    0xF9, 0x1F, 0x02, 0x18, 0x7E, 0xE2, 0x65, 0xEC, 0xD9, 0x0D, 0x04, 0x20, 0x06, 0x13, 0x03, 0x08,
+    0x90, 0xCA, 0x00, 0x81, 0x78, 0x02, 0x0C, 0x90, 0x15, 0xD6, 0xE4, 0x5B, 0x71, 0x06, 0x04, 0x08,
+    0xF8, 0x02, 0xC2, 0x80, 0xE8, 0x38, 0x0F, 0xA1, 0x37, 0xFC, 0xE7, 0x85, 0x0A, 0x40, 0x8D, 0x12,
+    0xF8, 0xBF, 0x1F, 0x22, 0xE0, 0xF0, 0x7F, 0x3D, 0x8C, 0xF1, 0x3F, 0x43, 0x03, 0xCC, 0xFA, 0xF7,
+    0xFF, 0xBF, 0x3D, 0x98, 0xF1, 0x15, 0xC6, 0x30, 0x78, 0xFD, 0x5E, 0x9A, 0x01, 0x00, 0x21, 0x21,
+    0xA8, 0xD0, 0x78, 0x9C, 0x3D, 0xCF, 0xBF, 0x0E, 0xC1, 0x50, 0x14, 0x06, 0xF0, 0xCF, 0x9F, 0xA6,
+    0x52, 0x22, 0x16, 0x7B, 0x47, 0x13, 0x16, 0x9B, 0x84, 0xD1, 0x68, 0xF0, 0x12, 0x26, 0x89, 0x17,
+    0xF0, 0x08, 0x0C, 0xC6, 0x8A, 0x78, 0x02, 0x36, 0x2F, 0x41, 0x0C, 0x46, 0xC3, 0xDD, 0x25, 0x72,
+    0x45, 0x45, 0x25, 0xE8, 0xE7, 0xB4, 0xB7, 0xED, 0xB7, 0xDC, 0x5F, 0xCE, 0x3D, 0xE7, 0xDC, 0x5C,
+    0x00, 0xCB, 0x9B, 0x5E, 0x59, 0x90, 0x9C, 0x29, 0x51, 0x45, 0x60, 0xC8, 0x38, 0x13, 0xC0, 0x37,
+    0x62, 0x01, 0x21, 0xD9, 0x70, 0x03, 0xB2, 0x22, 0x97, 0x33, 0xA0, 0x4D, 0xF6, 0x76, 0x64, 0x55,
+    0xC6, 0x3E, 0x9C, 0xDF, 0x49, 0x47, 0xF4, 0xE6, 0xF6, 0x91, 0x0C, 0xF0, 0xE4, 0x67, 0x7A, 0xA6,
+    0x52, 0x52, 0x3B, 0x1E, 0xA2, 0x78, 0xD2, 0x57, 0x42, 0x1C, 0x99, 0x2D, 0x1B, 0xC9, 0xBE, 0x96,
+    0x91, 0xBC, 0xA1, 0x72, 0xD1, 0x69, 0xE3, 0x47, 0xAE, 0x3B, 0xA3, 0xBD, 0xEC, 0x4F, 0x17, 0x3A,
+    0xE8, 0x87, 0xA9, 0xB0, 0x31, 0xB2, 0xA5, 0x79, 0x7A, 0xA1, 0xF6, 0xEA, 0x66, 0x01, 0x02, 0x9D,
+    0x37, 0x58, 0xB0, 0x99, 0x94, 0x5E, 0xB4, 0x12, 0x85, 0x3A, 0x41, 0x8D, 0x2A, 0x13, 0xC7, 0x03,
+    0xC3, 0x6F, 0xFC, 0xF3, 0x28, 0x7E, 0x26, 0xF7, 0xAA, 0xBB, 0xF8, 0x03, 0x8B, 0xCF, 0x94, 0x96,
+    0x78, 0x9C, 0x63, 0x98, 0xF0, 0xFF, 0xBF, 0x3E, 0x03, 0x04, 0x50, 0x9D, 0x79, 0x85, 0x09, 0xC6,
+    0x3C, 0xFF, 0x9F, 0x07, 0xC6, 0xFC, 0xFF, 0x3F, 0x1E, 0xC1, 0xDC, 0x8F, 0x60, 0xB2, 0x83, 0x99,
+    0xDF, 0x81, 0x2C, 0x29, 0x30, 0xEB, 0x32, 0x5C, 0x25, 0xC3, 0xEF, 0xFF, 0x70, 0x73, 0x3F, 0x21,
+    0x98, 0x0D, 0x08, 0x26, 0xC3, 0x74, 0xD2, 0x5C, 0x76, 0xFE, 0x0C, 0x08, 0x30, 0x41, 0x2C, 0x06,
+    0x01, 0xC2, 0x4C, 0x00, 0x4C, 0xC8, 0x75, 0x59, 0x78, 0x9C, 0x63, 0x98, 0xF0, 0xFF, 0xBF, 0x3C,
+    0x03, 0x03, 0x03, 0xD5, 0xA8, 0x7E, 0x2E, 0x30, 0xF5, 0xDF, 0x1F, 0x42, 0xDD, 0x87, 0x50, 0xFF,
+    0x59, 0x19, 0x2E, 0x03, 0x49, 0x5F, 0x30, 0xA7, 0x9E, 0x81, 0xE1, 0xCF, 0x7F, 0xB0, 0x86, 0xAF,
+    0x10, 0xEA, 0x00, 0x84, 0x32, 0xD8, 0x4D, 0x91, 0xED, 0x00, 0xAF, 0xBF, 0x5A, 0x0E, 0x78, 0x9C,
+    0x85, 0xD0, 0xCB, 0x09, 0x02, 0x41, 0x0C, 0x06, 0xE0, 0x28, 0x2B, 0x2A, 0xA2, 0x6C, 0x21, 0x82,
+    0x25, 0x68, 0x07, 0xDA, 0x81, 0x25, 0x58, 0xC2, 0x7A, 0xF3, 0xE8, 0x76, 0xE0, 0x76, 0xA0, 0x1D,
+    0x68, 0x07, 0x6E, 0x07, 0xDA, 0xC1, 0xC0, 0x08, 0x3E, 0x50, 0xFC, 0xCD, 0x30, 0x93, 0x6C, 0x6E,
+    0xE6, 0x30, 0xE4, 0x23, 0x21, 0x24, 0x43, 0x14, 0xE2, 0x04, 0xEC, 0x49, 0xE2, 0x09, 0xF4, 0x25,
+    0x5F, 0x00, 0x85, 0x16, 0x3C, 0x5C, 0x26, 0x79, 0xFE, 0xC5, 0x58, 0x0B, 0x07, 0xEC, 0xE8, 0x4F,
+    0xBC, 0x00, 0x97, 0x7A, 0xD1, 0x65, 0xA0, 0x67, 0x31, 0xB1, 0x38, 0x5A, 0x20, 0xB3, 0x18, 0x2A,
+    0x5C, 0x5C, 0x2C, 0x62, 0xC5, 0xA5, 0x96, 0x60, 0x19, 0xF7, 0x4F, 0xB8, 0x02, 0x53, 0x6D, 0xE3,
+    0x6B, 0xCE, 0x82, 0x82, 0x3E, 0x40, 0x27, 0x61, 0x4B, 0x37, 0x60, 0xA4, 0xA8, 0xC0, 0x8F, 0x20,
+    0xE7, 0xE1, 0xED, 0x2A, 0x81, 0x1E, 0xC0, 0x40, 0x51, 0x03, 0xF3, 0x52, 0xC0, 0xC3, 0x2F, 0x6B,
+    0x01, 0xBD, 0x81, 0x8D, 0xC2, 0xF3, 0x3C, 0x45, 0x19, 0x0E, 0x11, 0xF0, 0x37, 0x36, 0xA0, 0xBB,
+    0x45, 0x6D, 0x31, 0xB3, 0x08, 0xC3, 0x1B, 0xF8, 0x80, 0x1F, 0xCB, 0xAB, 0xE0, 0x53, 0x78, 0x9C,
+    0xC5, 0xCE, 0xB1, 0x0D, 0x82, 0x50, 0x10, 0x80, 0xE1, 0x43, 0x8D, 0x05, 0xC6, 0x19, 0x5C, 0xC1,
+    0x09, 0x8C, 0x1B, 0xB0, 0x82, 0x1B, 0x30, 0x82, 0x8E, 0x60, 0x6B, 0x41, 0x60, 0x83, 0x37, 0x82,
+    0x23, 0xBC, 0x19, 0xA8, 0x29, 0x20, 0x31, 0x31, 0x62, 0xC0, 0x9F, 0x3B, 0xDE, 0x6B, 0xAD, 0xF9,
+    0xAB, 0x2F, 0x97, 0xCB, 0xE5, 0x44, 0xB4, 0x0A, 0xBC, 0x84, 0xDE, 0xB0, 0x0B, 0x3A, 0x42, 0x19,
+    0x87, 0x35, 0x6C, 0x23, 0x07, 0x4E, 0x51, 0x77, 0x9E, 0x89, 0xFC, 0xAD, 0x23, 0x97, 0x4B, 0x43,
+    0xB1, 0x36, 0xBA, 0xF3, 0x08, 0x38, 0x63, 0xFB, 0xC2, 0x4A, 0x95, 0xB1, 0x6C, 0xA6, 0x7F, 0x0C,
+    0xB6, 0x61, 0xDC, 0xC8, 0x0D, 0x5A, 0xE3, 0x55, 0x0F, 0xFD, 0xC0, 0x78, 0x50, 0x7E, 0x21, 0x51,
+    0xEE, 0x95, 0x3D, 0xAC, 0xBA, 0xF0, 0xEA, 0x27, 0x30, 0x5D, 0x84, 0x13, 0xA3, 0xAF, 0x99, 0x83,
+    0x78, 0x9C, 0x75, 0x90, 0x31, 0x0A, 0xC2, 0x40, 0x10, 0x45, 0x27, 0x31, 0x06, 0x41, 0x11, 0x0F,
+    0x20, 0x92, 0x4A, 0x0B, 0x8B, 0x58, 0xDA, 0x88, 0x1E, 0x21, 0x39, 0x81, 0x1E, 0x40, 0xF0, 0x0A,
+    0xDE, 0x24, 0x8A, 0xB5, 0x58, 0x5A, 0x89, 0x58, 0x5A, 0xA9, 0xBD, 0x10, 0x0F, 0x20, 0xA4, 0x09,
+    0x22, 0x51, 0xF2, 0x9D, 0x9D, 0x31, 0x76, 0xFE, 0x62, 0xF7, 0xED, 0x30, 0xF3, 0xF7, 0xEF, 0x12,
+    0xB1, 0x1E, 0x80, 0x6F, 0x76, 0xF2, 0x80, 0xC4, 0x16, 0x3A, 0x03, 0x4D, 0x01, 0xCA, 0x10, 0x29,
+    0xCC, 0x01, 0x57, 0x29, 0xC5, 0x80, 0xFE, 0xCA, 0xDB, 0xE6, 0xC9, 0xBA, 0xCD, 0xD0, 0xC8, 0x60,
+    0x34, 0x25, 0xBA, 0x40, 0x65, 0xD1, 0x5B, 0x61, 0x43, 0x01, 0xAF, 0xF1, 0x1D, 0x18, 0xD2, 0x82,
+    0x8F, 0x16, 0x85, 0x59, 0xCD, 0xDC, 0x59, 0x37, 0x0E, 0x36, 0xDD, 0x80, 0x2A, 0x15, 0x39, 0x5A,
+    0x4A, 0xDC, 0x77, 0xD2, 0x6C, 0x23, 0x9E, 0x8D, 0x2C, 0xC1, 0x97, 0x31, 0x93, 0xEA, 0x41, 0x7C,
+    0x2D, 0x4D, 0xCC, 0x9A, 0x49, 0xA7, 0xDC, 0x57, 0x11, 0x34, 0xAD, 0x63, 0x19, 0xEA, 0x31, 0x26,
+    0x6A, 0x3A, 0xE1, 0x62, 0x49, 0xF1, 0x09, 0x94, 0x8B, 0xE7, 0xC1, 0x5D, 0x39, 0xDF, 0x8F, 0x71,
+    0xD2, 0xB8, 0x4F, 0x14, 0xE4, 0x9C, 0x9E, 0xEB, 0xF1, 0x95, 0x61, 0x6F, 0x3A, 0x44, 0xFE, 0x8F,
+    0x1C, 0x5A, 0x2A, 0x74, 0x79, 0x2C, 0x3C, 0xE6, 0xD8, 0x75, 0x18, 0x3E, 0xA5, 0xF1, 0x98, 0xC4,
+    0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x58, 0xF0, 0xFF, 0xFF, 0x7D, 0x06, 0x10, 0xF8, 0xFA, 0xFF,
+    0xBF, 0x34, 0x88, 0x56, 0xF8, 0xFF, 0x7F, 0x3E, 0x58, 0xE0, 0xE1, 0xFF, 0xFF, 0x6C, 0x60, 0xC6,
+    0x9F, 0xFF, 0x76, 0x60, 0xBA, 0xE1, 0xFF, 0x7E, 0x46, 0x06, 0xEC, 0x60, 0xEA, 0x9B, 0xFF, 0xE7,
+    0x22, 0x81, 0x92, 0x97, 0xFF, 0x83, 0xC0, 0x7A, 0x06, 0x03, 0x30, 0x0D, 0x34, 0xF9, 0x02, 0x84,
+    0x91, 0xCF, 0xF0, 0xE9, 0xFF, 0xFF, 0x58, 0xE3, 0xA9, 0xFF, 0xF8, 0x19, 0xBE, 0x80, 0x8D, 0x0D,
+    0x60, 0x63, 0xF8, 0xFC, 0xFF, 0xBF, 0x0C, 0x58, 0xF3, 0x47, 0xA0, 0x02, 0x0D, 0x06, 0x88, 0x5B,
+    0xFE, 0xFF, 0x8F, 0x06, 0x32, 0x04, 0xFE, 0x82, 0x58, 0xB1, 0x40, 0xD6, 0x42, 0xB0, 0x76, 0x2E,
+    0x20, 0x6B, 0x11, 0x88, 0xD1, 0x0F, 0x52, 0x56, 0xF8, 0x0F, 0xC8, 0x02, 0xBB, 0xA4, 0x00, 0xC8,
+    0x60, 0x85, 0xB9, 0x9E, 0x6D, 0x32, 0x33, 0x90, 0x01, 0x34, 0x95, 0xF5, 0xCB, 0xFB, 0x4C, 0xE5,
+    0x60, 0xA0, 0x11, 0x4C, 0x5F, 0x20, 0xB6, 0xEF, 0x67, 0x80, 0x32, 0xF4, 0x40, 0xD2, 0x40, 0x70,
+    0x9E, 0x89, 0x41, 0x60, 0xD9, 0x9B, 0xFF, 0xEF, 0x7B, 0x80, 0x3A, 0x00, 0xDB, 0xF0, 0x7B, 0x9A,
+    0x78, 0x9C, 0x85, 0x90, 0xDD, 0x0D, 0x01, 0x51, 0x10, 0x46, 0xC7, 0x4F, 0x88, 0xF0, 0xA0, 0x00,
+    0x41, 0x05, 0xE8, 0x80, 0x0E, 0x28, 0x41, 0x07, 0x74, 0x60, 0x4B, 0x50, 0x82, 0x0E, 0x28, 0x61,
+    0x0B, 0x90, 0x6C, 0x09, 0x4B, 0x05, 0x42, 0x44, 0x84, 0x70, 0x4C, 0x76, 0xE6, 0xDE, 0x37, 0xD9,
+    0xEF, 0xE9, 0x64, 0x32, 0x33, 0x39, 0x33, 0x22, 0x9A, 0x25, 0x50, 0x95, 0x22, 0x37, 0x18, 0x19,
+    0xC9, 0x87, 0xAC, 0x62, 0xB4, 0x83, 0x96, 0x17, 0x9F, 0xAC, 0x9C, 0x66, 0xE4, 0x35, 0xF9, 0x9B,
+    0x03, 0x21, 0x9D, 0x32, 0x6C, 0x27, 0xC7, 0x22, 0x8A, 0xBE, 0x70, 0x0B, 0x1B, 0xDF, 0x73, 0xD7,
+    0x56, 0xA3, 0xEE, 0x37, 0x4A, 0xEA, 0x6C, 0xB0, 0x78, 0xE8, 0xBC, 0xD1, 0x10, 0x2E, 0xEE, 0x9B,
+    0xC2, 0x3C, 0xFA, 0x06, 0xF5, 0x09, 0xE4, 0x5E, 0x3C, 0xC1, 0xD4, 0xF1, 0x05, 0x4D, 0xA3, 0x05,
+    0x64, 0x5E, 0x3C, 0xC3, 0xD8, 0xF1, 0x0D, 0x0D, 0xA3, 0x35, 0xEC, 0x25, 0x3E, 0xA9, 0x1F, 0x9F,
+    0x44, 0xDD, 0x28, 0x51, 0x7F, 0x3B, 0xA4, 0x77, 0x8D, 0xB7, 0x0D, 0x4A, 0xF1, 0x07, 0x1B, 0xD4,
+    0xA3, 0xD4, 0x78, 0x9C, 0x75, 0x8E, 0xC1, 0x09, 0xC2, 0x50, 0x10, 0x05, 0x5F, 0x82, 0xA8, 0x01,
+    0x0F, 0x56, 0x20, 0x36, 0x60, 0x0D, 0x5A, 0x82, 0x04, 0xFE, 0x59, 0x4B, 0xB0, 0x03, 0x4B, 0xB0,
+    0x05, 0x9B, 0xF0, 0x1C, 0x3B, 0x09, 0x56, 0x20, 0x28, 0x88, 0x22, 0x71, 0xFC, 0xBB, 0xEE, 0xD1,
+    0xEC, 0x65, 0x1E, 0x8F, 0x65, 0x67, 0x25, 0x69, 0x07, 0xD7, 0x22, 0x53, 0x77, 0x58, 0x18, 0xA7,
+    0x1D, 0x8D, 0x17, 0x67, 0x18, 0x1B, 0xF5, 0x62, 0xE3, 0x5C, 0xD3, 0x96, 0xFA, 0x37, 0x0F, 0x7E,
+    0x53, 0xF4, 0x07, 0xD5, 0x29, 0xA5, 0x13, 0xEC, 0x15, 0xAE, 0x89, 0xBB, 0x3E, 0x21, 0x3F, 0x12,
+    0x8E, 0xBC, 0x5F, 0x19, 0xE7, 0xD0, 0x2A, 0xBE, 0x58, 0x7A, 0x78, 0xC2, 0xC8, 0xB8, 0x82, 0xC6,
+    0x8B, 0x0B, 0xCC, 0x3C, 0xBC, 0x61, 0x60, 0xDC, 0xC2, 0xC1, 0x8B, 0x5B, 0xBE, 0x96, 0x75, 0xA9,
+    0xEC, 0xC2, 0x3E, 0xA4, 0x3F, 0x7C, 0x01, 0xAB, 0x69, 0x7A, 0x42, 0x78, 0x9C, 0x85, 0xD0, 0xCF,
+    0x0D, 0x41, 0x41, 0x10, 0xC7, 0xF1, 0xF1, 0x27, 0x44, 0x38, 0x28, 0x40, 0x70, 0x77, 0xA0, 0x03,
+    0x3A, 0xA0, 0x13, 0x6E, 0x8E, 0x5E, 0x07, 0x74, 0x42, 0x5E, 0x05, 0x0A, 0x90, 0x28, 0x01, 0x15,
+    0xBC, 0x10, 0x11, 0x21, 0x7C, 0x6D, 0xCC, 0xEC, 0x9C, 0xC8, 0x9B, 0xD3, 0x27, 0xBB, 0x3B, 0x93,
+    0xFD, 0x8D, 0x88, 0xC8, 0x68, 0x5E, 0x16, 0xAB, 0x3B, 0xCB, 0x48, 0xE0, 0x07, 0x5F, 0xEC, 0x23,
+    0xD3, 0xAC, 0x27, 0x7F, 0x6B, 0x43, 0xAC, 0x46, 0x1E, 0xEB, 0xC9, 0xEE, 0x5B, 0x81, 0x25, 0x6D,
+    0x5E, 0xC1, 0xC2, 0xE6, 0x5C, 0xC3, 0x53, 0x55, 0xF3, 0x0D, 0x45, 0x1F, 0x3E, 0xB5, 0xFB, 0x5B,
+    0xE8, 0x57, 0x75, 0x21, 0x2B, 0x28, 0xB7, 0x30, 0xF6, 0x40, 0xD4, 0x54, 0x03, 0x38, 0xD8, 0xE1,
+    0x11, 0x86, 0xC6, 0x07, 0x54, 0x55, 0x13, 0x3C, 0xDA, 0x09, 0xFA, 0xC6, 0x27, 0x54, 0x54, 0x33,
+    0x58, 0xDB, 0xE1, 0x05, 0xDA, 0xBE, 0x0F, 0x6C, 0x79, 0x49, 0xF8, 0xBF, 0x06, 0x69, 0x9D, 0x3D,
+    0x5B, 0x27, 0x97, 0x1F, 0x32, 0xBE, 0xA1, 0x2F, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x28, 0x0E, 0x67,
+    0x00, 0x83, 0x80, 0xFF, 0xFF, 0xB9, 0xC1, 0x8C, 0x03, 0xFF, 0xFF, 0xEB, 0x83, 0x19, 0x17, 0xFE,
+    0xFF, 0xB7, 0x07, 0x33, 0x26, 0xFC, 0xFF, 0xCF, 0x07, 0x66, 0x08, 0xBC, 0x3A, 0xCF, 0xCC, 0x80,
+    0x0D, 0x7C, 0xFB, 0x0F, 0x01, 0x8C, 0xB8, 0x19, 0x0C, 0x41, 0xA1, 0xA1, 0xA1, 0x5B, 0xFF, 0xFF,
+    0xAF, 0x07, 0x6B, 0xF8, 0xFC, 0xFF, 0x3F, 0x0F, 0xD8, 0xC4, 0x7F, 0xFF, 0xDF, 0x33, 0x82, 0x18,
+    0x0B, 0xFE, 0xFF, 0x8F, 0x87, 0x19, 0xC5, 0x09, 0xA2, 0x15, 0xFE, 0xFF, 0xBF, 0x0F, 0x73, 0x0F,
+    0xC4, 0x19, 0x3F, 0xFE, 0xFF, 0x67, 0x07, 0xD1, 0x0E, 0xFF, 0xFF, 0xEF, 0x07, 0x0B, 0x3C, 0xFC,
+    0xFF, 0x5F, 0x0E, 0xCC, 0xF8, 0xFD, 0xFF, 0x3F, 0x0B, 0x88, 0x4E, 0xF8, 0xFF, 0xBF, 0x1F, 0x2C,
+    0xF0, 0x09, 0x68, 0x1A, 0xD0, 0xBA, 0x50, 0xA6, 0xBF, 0x50, 0xDB, 0xD9, 0xFE, 0xE3, 0x66, 0x00,
+    0x00, 0xB0, 0xD3, 0x77, 0x32,
+};
+const GFXglyph OpenSans18BGlyphs[] = {
+    { 0, 0, 10, 0, 0, 8, 0 }, //  
+    { 7, 27, 11, 2, 27, 90, 8 }, // !
+    { 14, 10, 18, 2, 27, 77, 98 }, // "
+    { 24, 27, 25, 0, 27, 167, 175 }, // #
+    { 20, 31, 22, 1, 29, 182, 342 }, // $
+    { 33, 27, 34, 1, 27, 274, 524 }, // %
+    { 28, 27, 29, 1, 27, 229, 798 }, // &
+    { 6, 10, 10, 2, 27, 41, 1027 }, // '
+    { 11, 33, 13, 1, 27, 129, 1068 }, // (
+    { 11, 33, 13, 1, 27, 131, 1197 }, // )
+    { 19, 19, 21, 1, 29, 137, 1328 }, // *
+    { 20, 20, 22, 1, 23, 46, 1465 }, // +
+    { 8, 9, 11, 1, 4, 47, 1511 }, // ,
+    { 11, 5, 12, 1, 13, 20, 1558 }, // -
+    { 7, 7, 11, 2, 7, 36, 1578 }, // .
+    { 16, 27, 16, 0, 27, 108, 1614 }, // /
+    { 20, 27, 22, 1, 27, 180, 1722 }, // 0
+    { 14, 27, 22, 2, 27, 66, 1902 }, // 1
+    { 20, 27, 22, 1, 27, 153, 1968 }, // 2
+    { 20, 27, 22, 1, 27, 183, 2121 }, // 3
+    { 22, 27, 22, 0, 27, 113, 2304 }, // 4
+    { 19, 27, 22, 1, 27, 159, 2417 }, // 5
+    { 20, 27, 22, 1, 27, 192, 2576 }, // 6
+    { 20, 27, 22, 1, 27, 131, 2768 }, // 7
+    { 20, 27, 22, 1, 27, 199, 2899 }, // 8
+    { 20, 27, 22, 1, 27, 197, 3098 }, // 9
+    { 7, 21, 11, 2, 21, 55, 3295 }, // :
+    { 8, 26, 11, 1, 21, 72, 3350 }, // ;
+    { 20, 21, 22, 1, 24, 107, 3422 }, // <
+    { 20, 11, 22, 1, 19, 28, 3529 }, // =
+    { 20, 21, 22, 1, 24, 99, 3557 }, // >
+    { 18, 27, 18, 0, 27, 151, 3656 }, // ?
+    { 32, 30, 34, 1, 27, 319, 3807 }, // @
+    { 27, 27, 26, 0, 27, 194, 4126 }, // A
+    { 21, 27, 26, 3, 27, 148, 4320 }, // B
+    { 21, 27, 24, 2, 27, 170, 4468 }, // C
+    { 23, 27, 28, 3, 27, 156, 4638 }, // D
+    { 17, 27, 21, 3, 27, 44, 4794 }, // E
+    { 16, 27, 21, 3, 27, 36, 4838 }, // F
+    { 23, 27, 28, 2, 27, 192, 4874 }, // G
+    { 23, 27, 29, 3, 27, 36, 5066 }, // H
+    { 7, 27, 13, 3, 27, 15, 5102 }, // I
+    { 13, 35, 13, -3, 27, 67, 5117 }, // J
+    { 23, 27, 25, 3, 27, 149, 5184 }, // K
+    { 18, 27, 21, 3, 27, 28, 5333 }, // L
+    { 30, 27, 36, 3, 27, 196, 5361 }, // M
+    { 25, 27, 31, 3, 27, 144, 5557 }, // N
+    { 27, 27, 30, 2, 27, 186, 5701 }, // O
+    { 20, 27, 24, 3, 27, 108, 5887 }, // P
+    { 27, 33, 30, 2, 27, 214, 5995 }, // Q
+    { 23, 27, 25, 3, 27, 152, 6209 }, // R
+    { 19, 27, 21, 1, 27, 178, 6361 }, // S
+    { 22, 27, 22, 0, 27, 35, 6539 }, // T
+    { 23, 27, 29, 3, 27, 109, 6574 }, // U
+    { 25, 27, 25, 0, 27, 201, 6683 }, // V
+    { 37, 27, 37, 0, 27, 298, 6884 }, // W
+    { 26, 27, 25, 0, 27, 195, 7182 }, // X
+    { 24, 27, 24, 0, 27, 139, 7377 }, // Y
+    { 22, 27, 22, 0, 27, 137, 7516 }, // Z
+    { 10, 33, 13, 2, 27, 31, 7653 }, // [
+    { 16, 27, 16, 0, 27, 90, 7684 }, // '\\'
+    { 10, 33, 13, 0, 27, 33, 7774 }, // ]
+    { 21, 17, 20, 0, 27, 130, 7807 }, // ^
+    { 17, 3, 16, -1, -3, 19, 7937 }, // _
+    { 11, 6, 23, 6, 29, 43, 7956 }, // `
+    { 20, 21, 23, 1, 21, 158, 7999 }, // a
+    { 21, 29, 24, 2, 29, 151, 8157 }, // b
+    { 18, 21, 20, 1, 21, 121, 8308 }, // c
+    { 21, 29, 24, 1, 29, 164, 8429 }, // d
+    { 20, 21, 22, 1, 21, 151, 8593 }, // e
+    { 17, 29, 15, 0, 29, 87, 8744 }, // f
+    { 22, 30, 21, 0, 21, 220, 8831 }, // g
+    { 21, 29, 25, 2, 29, 96, 9051 }, // h
+    { 7, 29, 12, 2, 29, 41, 9147 }, // i
+    { 12, 38, 12, -3, 29, 87, 9188 }, // j
+    { 22, 29, 24, 2, 29, 143, 9275 }, // k
+    { 7, 29, 12, 2, 29, 15, 9418 }, // l
+    { 33, 21, 37, 2, 21, 137, 9433 }, // m
+    { 21, 21, 25, 2, 21, 92, 9570 }, // n
+    { 21, 21, 24, 1, 21, 149, 9662 }, // o
+    { 21, 30, 24, 2, 21, 162, 9811 }, // p
+    { 21, 30, 24, 1, 21, 163, 9973 }, // q
+    { 15, 21, 17, 2, 21, 66, 10136 }, // r
+    { 17, 21, 19, 1, 21, 145, 10202 }, // s
+    { 16, 26, 17, 0, 26, 88, 10347 }, // t
+    { 20, 21, 25, 2, 21, 87, 10435 }, // u
+    { 22, 21, 22, 0, 21, 155, 10522 }, // v
+    { 33, 21, 33, 0, 21, 226, 10677 }, // w
+    { 22, 21, 22, 0, 21, 146, 10903 }, // x
+    { 22, 30, 22, 0, 21, 194, 11049 }, // y
+    { 17, 21, 19, 1, 21, 107, 11243 }, // z
+    { 14, 33, 15, 0, 27, 115, 11350 }, // {
+    { 5, 38, 21, 8, 29, 14, 11465 }, // |
+    { 14, 33, 15, 1, 27, 111, 11479 }, // }
+    { 20, 9, 22, 1, 18, 68, 11590 }, // ~
+    { 14, 13, 16, 1, 28, 83, 11658 }, // °
+    { 27, 35, 30, 2, 35, 209, 11741 }, // Ó
+    { 20, 29, 23, 1, 29, 194, 11950 }, // ä
+    { 21, 29, 24, 1, 29, 181, 12144 }, // ó
+    { 27, 36, 26, 0, 27, 243, 12325 }, // Ą
+    { 20, 30, 23, 1, 21, 195, 12568 }, // ą
+    { 21, 35, 24, 2, 35, 198, 12763 }, // Ć
+    { 18, 29, 20, 1, 29, 156, 12961 }, // ć
+    { 17, 36, 21, 3, 27, 85, 13117 }, // Ę
+    { 20, 30, 22, 1, 21, 190, 13202 }, // ę
+    { 21, 27, 21, 0, 27, 72, 13392 }, // Ł
+    { 13, 29, 13, 0, 29, 54, 13464 }, // ł
+    { 25, 35, 31, 3, 35, 176, 13518 }, // Ń
+    { 21, 29, 25, 2, 29, 130, 13694 }, // ń
+    { 19, 35, 21, 1, 35, 208, 13824 }, // Ś
+    { 17, 29, 19, 1, 29, 176, 14032 }, // ś
+    { 22, 35, 22, 0, 35, 162, 14208 }, // Ź
+    { 17, 29, 19, 1, 29, 137, 14370 }, // ź
+    { 22, 35, 22, 0, 35, 157, 14507 }, // Ż
+    { 17, 29, 19, 1, 29, 141, 14664 }, // ż
+};
+const UnicodeInterval OpenSans18BIntervals[] = {
+    { 0x20, 0x7E, 0x0 },
+    { 0xB0, 0xB0, 0x5F },
+    { 0xD3, 0xD3, 0x60 },
+    { 0xE4, 0xE4, 0x61 },
+    { 0xF3, 0xF3, 0x62 },
+    { 0x104, 0x107, 0x63 },
+    { 0x118, 0x119, 0x67 },
+    { 0x141, 0x144, 0x69 },
+    { 0x15A, 0x15B, 0x6D },
+    { 0x179, 0x17C, 0x6F },
+};
+const GFXfont OpenSans18B = {
+    (uint8_t*)OpenSans18BBitmaps,
+    (GFXglyph*)OpenSans18BGlyphs,
+    (UnicodeInterval*)OpenSans18BIntervals,
+    10,
+    1,
+    51,
+    41,
+    -11,
+};
@@ -0,0 +1,1990 @@
+#pragma once
+// Generated by tools/fontencode.py raw from opensans18b_subset.h, do not edit
+#include "epd_driver.h"
+const uint8_t OpenSans18BBitmaps[29533] = {
+    0xFB, 0xFF, 0xFF, 0x0A, 0xFA, 0xFF, 0xFF, 0x09, 0xF9, 0xFF, 0xFF, 0x08, 0xF9, 0xFF, 0xFF, 0x07,
+    0xF8, 0xFF, 0xFF, 0x06, 0xF7, 0xFF, 0xFF, 0x05, 0xF6, 0xFF, 0xFF, 0x05, 0xF5, 0xFF, 0xFF, 0x04,
+    0xF4, 0xFF, 0xFF, 0x03, 0xF3, 0xFF, 0xFF, 0x02, 0xF2, 0xFF, 0xFF, 0x01, 0xF2, 0xFF, 0xFF, 0x00,
+    0xF1, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xEF, 0x00, 0xF0, 0xFF, 0xEF, 0x00, 0xE0, 0xFF, 0xDF, 0x00,
+    0xD0, 0xFF, 0xCF, 0x00, 0x60, 0x88, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x42, 0x02, 0x00, 0xC1, 0xFF, 0xAF, 0x00, 0xF9, 0xFF, 0xFF, 0x06, 0xFC, 0xFF, 0xFF, 0x09,
+    0xFB, 0xFF, 0xFF, 0x09, 0xF6, 0xFF, 0xFF, 0x03, 0x70, 0xFD, 0x5D, 0x00, 0xF7, 0xFF, 0x9F, 0x00,
+    0xFA, 0xFF, 0x6F, 0xF6, 0xFF, 0x8F, 0x00, 0xF9, 0xFF, 0x5F, 0xF5, 0xFF, 0x7F, 0x00, 0xF8, 0xFF,
+    0x4F, 0xF4, 0xFF, 0x5F, 0x00, 0xF7, 0xFF, 0x3F, 0xF3, 0xFF, 0x4F, 0x00, 0xF5, 0xFF, 0x1F, 0xF1,
+    0xFF, 0x3F, 0x00, 0xF4, 0xFF, 0x0F, 0xF0, 0xFF, 0x2F, 0x00, 0xF3, 0xFF, 0x0F, 0xF0, 0xFF, 0x1F,
+    0x00, 0xF2, 0xFF, 0x0E, 0xE0, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0x0D, 0xC0, 0xFF, 0x0E, 0x00, 0xF0,
+    0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0E, 0x00, 0xF6, 0xFF, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0x0C, 0x00, 0xF8, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0x09, 0x00, 0xFB, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x06, 0x00, 0xFE, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x03, 0x10, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x40, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xDF,
+    0x00, 0x70, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xAF, 0x00, 0xA0, 0xFF, 0x5F,
+    0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xEB, 0xEE, 0xFE, 0xFF, 0xEF, 0xEE, 0xFE, 0xFF, 0xEF,
+    0xEE, 0xAE, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0B, 0x00, 0xF9, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0x08, 0x00, 0xFD, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x05,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x40, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF2, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xD2, 0xDD, 0xFD, 0xFF, 0xDF, 0xDD, 0xFD, 0xFF, 0xDF, 0xDD,
+    0xDD, 0x06, 0x00, 0x00, 0xE0, 0xFF, 0x2F, 0x00, 0xF4, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0x0F, 0x00, 0xF7, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0C, 0x00,
+    0xFA, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00, 0xFD, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x05, 0x10, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0x02, 0x40, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x70,
+    0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x2F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xC9, 0xFE, 0xFF, 0xCE, 0x69, 0x02, 0x00, 0x00, 0x50,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x05, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x07, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0xFF,
+    0xFD, 0xBF, 0xFD, 0xFF, 0xBF, 0x00, 0xF3, 0xFF, 0xFF, 0x0A, 0xF6, 0x2F, 0x00, 0x83, 0x4D, 0x00,
+    0xF5, 0xFF, 0xFF, 0x04, 0xF6, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x08, 0xF6, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xAF, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0x29, 0x00,
+    0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x6F,
+    0xFC, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x2F, 0xA0, 0xFF, 0xFF, 0x3F, 0x11, 0x00,
+    0x00, 0x00, 0xF6, 0x2F, 0x60, 0xFF, 0xFF, 0x3F, 0xF5, 0x6B, 0x01, 0x00, 0xF6, 0x2F, 0xB0, 0xFF,
+    0xFF, 0x1F, 0xF5, 0xFF, 0xDF, 0x7A, 0xFA, 0xAF, 0xFE, 0xFF, 0xFF, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00,
+    0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x51, 0xB9, 0xED, 0xFF, 0xEF,
+    0x8B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xEB, 0xEF,
+    0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x90, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0x8F, 0x60, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xF2, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xFE, 0xFF, 0x0C, 0x00, 0x00, 0xFB, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0xFF, 0x0F, 0x00, 0xFB, 0xFF, 0x0E, 0x00, 0x30, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0D, 0x00, 0xFA, 0xFF, 0x0F, 0x00, 0xC0, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x0D, 0x00, 0xF9, 0xFF, 0x0F, 0x00, 0xF5, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0D, 0x00, 0xFA, 0xFF, 0x0F, 0x00, 0xFE, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x0F, 0x00, 0xFB, 0xFF, 0x0E, 0x70, 0xFF, 0xEF,
+    0x00, 0xB4, 0xFE, 0xBE, 0x05, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xFE, 0xFF, 0x0C, 0xF1, 0xFF,
+    0x6F, 0x90, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF4, 0xFF, 0x8F, 0x50, 0xFF, 0xFF, 0x08, 0xF9,
+    0xFF, 0x0D, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xE0, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x22,
+    0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xB0, 0xFF, 0xBF, 0x50, 0xFF, 0xFF, 0x09, 0xF6, 0xFF, 0x8F, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF,
+    0x0B, 0xF4, 0xFF, 0x3F, 0x80, 0xFF, 0xFF, 0x02, 0xE0, 0xFF, 0xCF, 0x00, 0x00, 0x30, 0xEA, 0xEF,
+    0x5B, 0x00, 0xFC, 0xFF, 0x0A, 0xB0, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xDF, 0x00, 0xA0, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0x8F, 0x00, 0xD0, 0xFF, 0xDF, 0x00, 0x90, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x0E, 0x00, 0xC0, 0xFF, 0xDF, 0x00, 0xA0, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x06, 0x00, 0xB0, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDF, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0xE0, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x4F, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x08, 0xF5,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xDF,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF5, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA3, 0xFE, 0xBE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xEC, 0xFF, 0xAD, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xD0, 0xFF, 0xFF, 0x9F, 0x86, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0x06, 0x00, 0xF2, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x01,
+    0x00, 0xE0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0x00, 0xF1,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x09, 0x00, 0xFB, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x3F, 0xC2, 0xFF, 0xFF, 0x5F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFD,
+    0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x03, 0x00, 0xF5, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x5F, 0x00, 0x60, 0xFF, 0xFF, 0x8F, 0x00, 0xC0, 0xFF, 0xFF, 0xDF, 0x82, 0xFF, 0xFF, 0xFF, 0x07,
+    0xD0, 0xFF, 0xFF, 0x1F, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0xF6, 0xFF, 0xFF, 0x8F, 0xF7, 0xFF,
+    0xFF, 0x0A, 0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
+    0x00, 0xF7, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xF6,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0xBF, 0x03, 0x00, 0x30, 0xF9, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xEF,
+    0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xE2, 0xFF,
+    0xFF, 0xCF, 0x01, 0x00, 0x00, 0x30, 0xB8, 0xFE, 0xEF, 0xAD, 0x27, 0x00, 0x20, 0xFE, 0xFF, 0xFF,
+    0x1D, 0xF7, 0xFF, 0x9F, 0xF6, 0xFF, 0x8F, 0xF5, 0xFF, 0x7F, 0xF4, 0xFF, 0x5F, 0xF3, 0xFF, 0x4F,
+    0xF1, 0xFF, 0x3F, 0xF0, 0xFF, 0x2F, 0xF0, 0xFF, 0x1F, 0xE0, 0xFF, 0x0F, 0xC0, 0xFF, 0x0E, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xE1, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x2F,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF4, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x4F, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0x09, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0xF0, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xAF,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x09, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x3F, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0x05, 0xF8, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xDF, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0xF3, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x04, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xD0,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF3, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x3F, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xC0,
+    0xFF, 0xDF, 0x01, 0x00, 0x00, 0xF7, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x48, 0x00,
+    0x70, 0xFF, 0x2F, 0x00, 0x51, 0xD9, 0x00, 0xF5, 0xFF, 0xBF, 0x76, 0xFF, 0x4F, 0xC7, 0xFF, 0xFF,
+    0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xB8, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xBD, 0x05, 0x00,
+    0x00, 0x10, 0xFD, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x9F, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x10, 0xFE,
+    0xFF, 0x1A, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x03, 0xF8, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xCF, 0x00, 0xF1, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x50, 0xFD, 0x5F, 0x00,
+    0x90, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x00, 0x20, 0x5D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x10, 0x11, 0x11, 0x31, 0xFF, 0xEF, 0x11, 0x11, 0x11, 0x01, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x23, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x6F, 0x30, 0xFF, 0xFF, 0x2F, 0x60, 0xFF, 0xFF, 0x0D, 0x90, 0xFF, 0xFF,
+    0x08, 0xC0, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xCF, 0x00, 0xF4, 0xFF, 0x5F, 0x00, 0xF7, 0xFF, 0x0E,
+    0x00, 0xFB, 0xFF, 0x07, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xA8, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x00, 0x00, 0x42, 0x02, 0x00, 0xC1, 0xFF, 0xAF, 0x00, 0xF9, 0xFF, 0xFF, 0x06, 0xFC,
+    0xFF, 0xFF, 0x09, 0xFB, 0xFF, 0xFF, 0x09, 0xF6, 0xFF, 0xFF, 0x03, 0x70, 0xFD, 0x5D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xEF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xB7, 0xFE, 0xDE, 0x4A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0xBE, 0xFB, 0xFF, 0xFF, 0x8F, 0x00, 0x60, 0xFF, 0xFF, 0xBF, 0x00, 0x30, 0xFE,
+    0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x05, 0xF0, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0xF3, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
+    0x0E, 0xF5, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x0F, 0xF7, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0x2F, 0xF8, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x3F, 0xF9,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x4F, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x5F, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x4F, 0xF8, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x4F, 0xF7, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0x3F, 0xF5, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0xF2, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0x0E, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0xA0,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x07, 0x50, 0xFF, 0xFF, 0xBF, 0x00, 0x20, 0xFE,
+    0xFF, 0xFF, 0x02, 0x00, 0xFD, 0xFF, 0xFF, 0xAE, 0xFB, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF4, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x10, 0xB6, 0xFD,
+    0xDF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xC1,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xE4,
+    0xFF, 0xFF, 0x9F, 0xFE, 0xFF, 0xBF, 0xF4, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xBF, 0x80, 0xFF, 0x6F,
+    0x00, 0xFF, 0xFF, 0xBF, 0x00, 0xEB, 0x03, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x10, 0x00, 0x00, 0xFF,
+    0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xBF, 0x00, 0x00, 0x40, 0xC8, 0xFE, 0xDF, 0x7B, 0x01, 0x00, 0x00, 0x00, 0x50, 0xFD, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0xDE, 0xFE,
+    0xFF, 0xFF, 0xFF, 0x02, 0x30, 0xFF, 0xFF, 0x3A, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0x07, 0x00, 0xF5,
+    0x3D, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x0A, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC1, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF,
+    0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x6D, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x84, 0xDC, 0xFF, 0xDE, 0x7B, 0x01, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x01, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0xE1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0xCF, 0xBA, 0xFD, 0xFF, 0xFF,
+    0xFF, 0x02, 0x00, 0xF9, 0x6D, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0x05, 0x00, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xD7, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x9E, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xDF, 0x4A, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x62, 0x66, 0x97, 0xFC, 0xFF, 0xFF, 0xEF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x2F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x1F, 0xD8, 0x27, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0x0C, 0xF8, 0xFF, 0xBE, 0x99,
+    0xA9, 0xFE, 0xFF, 0xFF, 0xFF, 0x06, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x6E, 0x00, 0x00, 0x00, 0x73, 0xDA, 0xFE, 0xFF, 0xBE, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFE, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xDF, 0xF9, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x4F, 0xFA, 0xFF, 0xDF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x0A, 0xFB, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xEF, 0x01, 0xFB, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x5F, 0x00, 0xFC, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0x0B, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xA0, 0xFF,
+    0xEF, 0x01, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x5F, 0x00, 0x00, 0xFC, 0xFF,
+    0xDF, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0x0B, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0xA0, 0xFF,
+    0xEF, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x72, 0x77, 0x77, 0x77, 0x77, 0x77, 0xFD, 0xFF, 0xEF, 0x77, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0xFE, 0xFF, 0xEF, 0xDD, 0xDD, 0xDD, 0xDD, 0x1D, 0x00, 0x00, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xBF, 0xFE,
+    0xEF, 0x9C, 0x03, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xCF, 0x00, 0x10, 0xF9, 0xDF, 0xAC, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x0A, 0xF2, 0x49, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0x05, 0xF2, 0xFF, 0xEF, 0xAB, 0xCA, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xF2, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x73, 0xDB, 0xFE, 0xEF,
+    0xAD, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xDA, 0xFE, 0xFF, 0x7E, 0x00, 0x00,
+    0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xB0, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x89, 0x88, 0x7A, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xDF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x3F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xEF, 0x00, 0xA4, 0xFD, 0xDF,
+    0x39, 0x00, 0x00, 0xF6, 0xFF, 0xCF, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF7, 0xFF, 0xAF,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x06, 0xF9, 0xFF, 0xFF, 0xFF, 0x7B, 0x86, 0xFE, 0xFF, 0xFF, 0x0D, 0xFA, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0xE1, 0xFF, 0xFF, 0x2F, 0xF9, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x5F, 0xF8,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x7F, 0xF6, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0x7F, 0xF3, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x5F, 0xE0, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x3F, 0x80, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0x0E, 0x10, 0xFF, 0xFF, 0xFF, 0xAE, 0xC9, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF5, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00,
+    0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xFD, 0xEF, 0x8C,
+    0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+    0xDD, 0xED, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xC9, 0xFE, 0xEF, 0x8B, 0x02, 0x00, 0x00, 0x00, 0x20, 0xFC, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x10,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x70, 0xFF, 0xFF, 0xDF, 0x36, 0x84, 0xFF,
+    0xFF, 0xFF, 0x03, 0xB0, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x06, 0xC0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x08, 0xB0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x06, 0x70, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x02, 0x10, 0xFF, 0xFF, 0xEF, 0x04,
+    0x70, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xCF, 0xFD, 0xFF, 0xFF, 0x1D, 0x00, 0x00,
+    0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0xC1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0x7E, 0xFC, 0xFF, 0xFF, 0x7F,
+    0x00, 0xB0, 0xFF, 0xFF, 0x8F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x04, 0xF2, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0xE2, 0xFF, 0xFF, 0x0D, 0xF7, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x3F, 0xF9,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x5F, 0xF9, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0x4F, 0xF7, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x2F, 0xF3, 0xFF, 0xFF,
+    0xBF, 0x45, 0x64, 0xFC, 0xFF, 0xFF, 0x0C, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x03, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x61, 0xDA, 0xFE, 0xEF, 0x8C, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xD9, 0xFE, 0xCE, 0x39, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x1B, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x30, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xAB, 0xFB, 0xFF, 0xFF, 0xBF,
+    0x00, 0xF3, 0xFF, 0xFF, 0x2E, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0x03, 0xF8, 0xFF, 0xFF, 0x04, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0x09, 0xFA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0E, 0xFC,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x1F, 0xFB, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0x4F, 0xFA, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x5F, 0xF7, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x5F, 0xF2, 0xFF, 0xFF, 0xCF, 0x67, 0xD8, 0xFF, 0xFF, 0xFF,
+    0x5F, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x10, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x6F, 0xFF, 0xFF, 0x3F, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0xB5, 0xFE, 0xDF, 0x39, 0x30, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xAF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x9A, 0x78, 0x98, 0xFC,
+    0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A,
+    0x00, 0x00, 0x00, 0x00, 0xEB, 0xFF, 0xDF, 0xAC, 0x15, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFD, 0x5D,
+    0x00, 0xF6, 0xFF, 0xFF, 0x04, 0xFB, 0xFF, 0xFF, 0x09, 0xFC, 0xFF, 0xFF, 0x09, 0xF8, 0xFF, 0xFF,
+    0x06, 0xC1, 0xFF, 0xAF, 0x00, 0x00, 0x42, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x02, 0x00, 0xC1, 0xFF, 0xAF, 0x00, 0xF9, 0xFF, 0xFF,
+    0x06, 0xFC, 0xFF, 0xFF, 0x09, 0xFB, 0xFF, 0xFF, 0x09, 0xF6, 0xFF, 0xFF, 0x03, 0x70, 0xFD, 0x5D,
+    0x00, 0x00, 0xD7, 0xDF, 0x05, 0x60, 0xFF, 0xFF, 0x4F, 0xB0, 0xFF, 0xFF, 0x9F, 0xC0, 0xFF, 0xFF,
+    0x9F, 0x80, 0xFF, 0xFF, 0x6F, 0x10, 0xFC, 0xFF, 0x0A, 0x00, 0x20, 0x24, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x6F, 0x30, 0xFF, 0xFF, 0x2F, 0x60, 0xFF, 0xFF,
+    0x0D, 0x90, 0xFF, 0xFF, 0x08, 0xC0, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xCF, 0x00, 0xF4, 0xFF, 0x5F,
+    0x00, 0xF7, 0xFF, 0x0E, 0x00, 0xFB, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x10, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x10, 0xF8, 0xFF, 0xFF, 0xFF, 0x4B, 0x00, 0x00, 0x00,
+    0x10, 0xF8, 0xFF, 0xFF, 0xFF, 0x3A, 0x00, 0x00, 0x00, 0x10, 0xF8, 0xFF, 0xFF, 0xFF, 0x29, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xEF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x39, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFD, 0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFB, 0xFF, 0xFF,
+    0xFF, 0x9E, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF9, 0xFF, 0xFF, 0xFF, 0xBF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xE7, 0xFF, 0xFF, 0xFF, 0xEF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x92, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71,
+    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x01, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x6E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xE7, 0xFF, 0xFF, 0xFF,
+    0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF,
+    0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x10, 0xE8, 0xFF, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x00, 0x40, 0xFB, 0xFF,
+    0xFF, 0xFF, 0x9F, 0x02, 0x00, 0x00, 0x71, 0xFD, 0xFF, 0xFF, 0xFF, 0x7E, 0x01, 0x00, 0x00, 0xA2,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x4B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xEF, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xA6, 0xED, 0xFF,
+    0xBE, 0x27, 0x00, 0x00, 0x50, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xFA, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xC0,
+    0xFF, 0xFF, 0xAC, 0xA9, 0xFE, 0xFF, 0xFF, 0x0E, 0x40, 0xBF, 0x05, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0x2F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x1A, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x41, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xDF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFC, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xA6, 0xEC, 0xFF, 0xDE, 0x7A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x9C, 0x88, 0xB9, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xAF, 0x04, 0x00, 0x00, 0x00, 0x50, 0xFC, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xD0,
+    0xFF, 0xCF, 0x00, 0x00, 0x71, 0xEB, 0xFF, 0xCE, 0x7A, 0x04, 0x80, 0xFF, 0xEF, 0x00, 0x00, 0xF5,
+    0xFF, 0x1F, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xFE, 0xFF, 0x05, 0x00, 0xFD,
+    0xFF, 0x07, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF8, 0xFF, 0x0A, 0x30, 0xFF,
+    0xFF, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x66, 0xE8, 0xFF, 0x6F, 0x00, 0xF3, 0xFF, 0x0E, 0x80, 0xFF,
+    0xAF, 0x00, 0xF2, 0xFF, 0xCF, 0x01, 0x00, 0xD0, 0xFF, 0x6F, 0x00, 0xF0, 0xFF, 0x1F, 0xB0, 0xFF,
+    0x6F, 0x00, 0xF9, 0xFF, 0x1E, 0x00, 0x00, 0xE0, 0xFF, 0x5F, 0x00, 0xE0, 0xFF, 0x2F, 0xE0, 0xFF,
+    0x3F, 0x00, 0xFD, 0xFF, 0x08, 0x00, 0x00, 0xF0, 0xFF, 0x4F, 0x00, 0xE0, 0xFF, 0x2F, 0xF0, 0xFF,
+    0x1F, 0x00, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0xE0, 0xFF, 0x1F, 0xF1, 0xFF,
+    0x0F, 0x10, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF1, 0xFF, 0x3F, 0x00, 0xF0, 0xFF, 0x0F, 0xF1, 0xFF,
+    0x0F, 0x00, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xF4, 0xFF, 0x2F, 0x00, 0xF2, 0xFF, 0x0D, 0xF0, 0xFF,
+    0x1F, 0x00, 0xFE, 0xFF, 0x07, 0x00, 0x00, 0xF9, 0xFF, 0x2F, 0x00, 0xF7, 0xFF, 0x08, 0xE0, 0xFF,
+    0x3F, 0x00, 0xFA, 0xFF, 0x1E, 0x00, 0x30, 0xFF, 0xFF, 0x5F, 0x00, 0xFD, 0xFF, 0x03, 0xC0, 0xFF,
+    0x7F, 0x00, 0xF4, 0xFF, 0xEF, 0x68, 0xF9, 0xFF, 0xFF, 0xDF, 0xC7, 0xFF, 0xBF, 0x00, 0x80, 0xFF,
+    0xBF, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x30, 0xFF,
+    0xFF, 0x02, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x3E, 0xE1, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0xFD,
+    0xFF, 0x0B, 0x00, 0x30, 0xDA, 0xFF, 0x7C, 0x00, 0x10, 0xE9, 0xDF, 0x19, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0xEF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x51, 0xE9, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC1, 0xFF, 0xFF, 0xFF, 0xBE, 0x9A, 0xA9, 0xEC, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x84, 0xDC, 0xFE, 0xEF, 0xBD, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x8C, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xEF, 0x00, 0xFA, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0x9F, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x4F,
+    0x00, 0xF0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0xB0,
+    0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0A, 0x00, 0x60, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x06, 0x00, 0x10, 0xFF, 0xFF, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0x04, 0x00, 0x60, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00,
+    0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0xF1, 0xFF,
+    0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0xF7, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xAF, 0x00, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x01, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xAC, 0x16,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xBB, 0xFC, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xBF, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xCF, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xCF, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xBF, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0x7F, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x30, 0xF8, 0xFF, 0xFF, 0x1F,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x39,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF9, 0xFF, 0xFF,
+    0x9A, 0x99, 0xB9, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0x01, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x05, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0x08, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x06, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xFF, 0x03, 0xF9, 0xFF, 0xFF, 0xCC, 0xCC, 0xEC,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3C, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xEC, 0xFF, 0xCE, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xE2, 0xFF,
+    0xFF, 0xFF, 0xEF, 0xDD, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x30,
+    0xE8, 0x7F, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0xB0, 0xFF,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x9F, 0x02, 0x00, 0x00,
+    0x73, 0xDC, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xEF, 0xCD, 0xFE, 0xFF, 0xDF, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xB7, 0xED, 0xFF, 0xCE, 0x59, 0x01, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE,
+    0x7A, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x05, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xBB, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xFF,
+    0x0D, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x6F, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xEF, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x03, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x0B, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0C, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0D, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0x0E, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0D, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0B, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF,
+    0xFF, 0x06, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x02, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xCF, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0x4F, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x10, 0xD6, 0xFF, 0xFF, 0xFF,
+    0x0B, 0x00, 0xF9, 0xFF, 0xFF, 0xCC, 0xCC, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xEF, 0xCD, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xBB, 0xBB, 0xBB, 0x3B, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF9, 0xFF, 0xFF, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x4F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x4F, 0xF9, 0xFF, 0xFF, 0xBB, 0xBB, 0xBB, 0xBB, 0x3B, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xC9, 0xFD,
+    0xFF, 0xBE, 0x59, 0x01, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF,
+    0x02, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x10, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
+    0xDC, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x3A, 0x00, 0x00, 0x20, 0xD7, 0x0D,
+    0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xB0, 0xFF, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x03, 0x00, 0x40, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0x02, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x07, 0xFB, 0xFF, 0xFF, 0x02, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFA, 0xFF, 0xFF,
+    0x03, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0x06, 0x00, 0x30, 0xCC,
+    0xCC, 0xFC, 0xFF, 0xFF, 0x07, 0xF6, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0x07, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x07, 0xD0, 0xFF, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x07, 0x70, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0x07, 0x10, 0xFE, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0x07, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xFD, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x20, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF,
+    0x03, 0x00, 0x00, 0x00, 0x20, 0xA6, 0xED, 0xFF, 0xEF, 0xAC, 0x47, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x0A, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0A, 0xF9, 0xFF, 0xFF, 0xCD, 0xCC, 0xCC, 0xCC, 0xCC, 0xFC, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x0A, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF,
+    0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF,
+    0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF,
+    0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF,
+    0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF,
+    0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF,
+    0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xDF, 0x00, 0x01, 0x00, 0xD2, 0xFF, 0xFF, 0x9F, 0x00, 0xFD,
+    0xED, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xFD, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x01, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0xD8, 0xFF, 0xDE, 0x49, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xBF, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1E, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x90, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0xF6,
+    0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x30, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0xE1, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0xFC, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x82, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x7F, 0xD0, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x04, 0x40, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0xFA,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0xE1, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0xF2, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xEF,
+    0x01, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x0A, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x4F, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0xDF, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCC,
+    0xCC, 0xCC, 0xCC, 0xCC, 0x2C, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF9, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0xFF, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0xAF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xEF, 0xFB,
+    0xFF, 0x6F, 0xF9, 0xFF, 0x6F, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x9F, 0xFB, 0xFF,
+    0x6F, 0xF9, 0xFF, 0x5F, 0xFC, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x4F, 0xFC, 0xFF, 0x6F,
+    0xF9, 0xFF, 0x6F, 0xF7, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0E, 0xFD, 0xFF, 0x6F, 0xF9,
+    0xFF, 0x6F, 0xF2, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x0A, 0xFD, 0xFF, 0x6F, 0xF9, 0xFF,
+    0x7F, 0xD0, 0xFF, 0xDF, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x04, 0xFE, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F,
+    0x90, 0xFF, 0xFF, 0x02, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x40,
+    0xFF, 0xFF, 0x07, 0x00, 0xD0, 0xFF, 0xAF, 0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0xFE,
+    0xFF, 0x0C, 0x00, 0xF3, 0xFF, 0x4F, 0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0xFA, 0xFF,
+    0x1F, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0xF5, 0xFF, 0x6F,
+    0x00, 0xFD, 0xFF, 0x0A, 0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0xF0, 0xFF, 0xBF, 0x30,
+    0xFF, 0xFF, 0x05, 0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0xB0, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0x60, 0xFF, 0xFF, 0xD5, 0xFF, 0xAF,
+    0x00, 0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0x10, 0xFF, 0xFF, 0xFC, 0xFF, 0x5F, 0x00,
+    0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFF,
+    0xFF, 0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xFF, 0xFF,
+    0x6F, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x6F,
+    0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x6F, 0xF9,
+    0xFF, 0x8F, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF,
+    0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xEF, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x5F, 0xF8, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x5F, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07,
+    0xF9, 0xFF, 0x6F, 0x50, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x7F,
+    0x00, 0xFC, 0xFF, 0xFF, 0x05, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0xF3, 0xFF,
+    0xFF, 0x0E, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0xA0, 0xFF, 0xFF, 0x8F, 0x00,
+    0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x02, 0xA0, 0xFF, 0xFF,
+    0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x0B, 0xA0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF,
+    0x8F, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x4F, 0x90, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xDF, 0x80, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+    0xFF, 0x87, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x07,
+    0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0x95, 0xEC, 0xFF, 0xDE, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFE, 0xFF, 0xFF, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x20, 0xF8, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xD0,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0xF2, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x6F, 0x00, 0xF6, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0xDF, 0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFA,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xF9, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xCF, 0x00, 0xF5, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x5F, 0x00, 0xD0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x20, 0xF9, 0xFF, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x95, 0xEC, 0xFF,
+    0xDE, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x7A, 0x01, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xF9,
+    0xFF, 0xFF, 0xBC, 0xCB, 0xFE, 0xFF, 0xFF, 0xFF, 0x06, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x30, 0xFD,
+    0xFF, 0xFF, 0x0C, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1F, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0x2F, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0F, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0x0E, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0xF9,
+    0xFF, 0xFF, 0xBC, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x49, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x95, 0xEC, 0xFF, 0xDE, 0x6A, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF,
+    0x03, 0x00, 0x20, 0xF8, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xD0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0x6F, 0x00, 0xF6, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F,
+    0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xDF, 0x00, 0xFA,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xFB, 0xFF, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0xCF, 0x00, 0xF5, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xAF,
+    0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x6F, 0x00, 0xD0,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF,
+    0x04, 0x00, 0x20, 0xF9, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x95, 0xEC, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0xFF, 0x6F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x40, 0xFD, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x10, 0x94, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xAB, 0xEA, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x40, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0xF9, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0xE1, 0xFF, 0xFF, 0x1E,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x50, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x70, 0xFF, 0xFF,
+    0xAF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x1E, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x20, 0xB7, 0xFE, 0xEF, 0xAD, 0x26, 0x00,
+    0x00, 0x00, 0x10, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xDF, 0xEC, 0xFF, 0xFF, 0x3F, 0x00, 0xA0, 0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x51,
+    0xFA, 0x0C, 0x00, 0xD0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xE0, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x9F,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x6F, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFB, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFB, 0xFF, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x06, 0xA3,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x04, 0xF4, 0xDF, 0x38, 0x00, 0x00, 0x50, 0xFE,
+    0xFF, 0xFF, 0x01, 0xF4, 0xFF, 0xFF, 0xDF, 0xDC, 0xFE, 0xFF, 0xFF, 0xBF, 0x00, 0xF4, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x51, 0xC9, 0xFE, 0xFF,
+    0xBD, 0x27, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F,
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x4F, 0xC2, 0xCC, 0xCC, 0xCC, 0xFF, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0x3C, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xFC, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x08, 0xFB, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x07, 0xFA, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0x06, 0xF8, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x04, 0xF4, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0xFF, 0xFF, 0xEF, 0x05, 0x00,
+    0x10, 0xF8, 0xFF, 0xFF, 0x9F, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFE, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xEC, 0xFF, 0xDF, 0x7A, 0x01, 0x00,
+    0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x08, 0xF7,
+    0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x03, 0xF2, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xDF, 0x00, 0xC0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xFF, 0xFF, 0x8F, 0x00, 0x70, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0x2F, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0x03, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0xFD, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x20, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0xCF, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0x01, 0x00, 0xF7, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x06, 0x00, 0xFC,
+    0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x0B, 0x10, 0xFF, 0xFF, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x50, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFF, 0xFF, 0x5F, 0xA0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0x9F, 0xE0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xDF, 0xF2,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xF7, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFD, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0x09, 0xF9, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x05, 0xF5, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xDF, 0x00, 0xD0, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x9F, 0x00,
+    0x90, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x30, 0xFF,
+    0xFF, 0x5F, 0x00, 0x50, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0x1F, 0x00, 0x10, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFB,
+    0xFF, 0x1F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0xFD, 0xFF, 0xAF, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0xF5, 0xFF, 0x5F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF9, 0xFF, 0xEF,
+    0x00, 0x00, 0xD0, 0xFF, 0xDF, 0xF2, 0xFF, 0x9F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x04, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0x02, 0x00, 0xF1, 0xFF, 0xAF, 0xE0, 0xFF, 0xDF, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0x6F, 0xB0, 0xFF, 0xFF, 0x01, 0x00,
+    0xF9, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x09, 0x00, 0xF9, 0xFF, 0x3F, 0x70, 0xFF,
+    0xFF, 0x05, 0x00, 0xFD, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0D, 0x00, 0xFD, 0xFF,
+    0x0E, 0x30, 0xFF, 0xFF, 0x09, 0x10, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x1F,
+    0x10, 0xFF, 0xFF, 0x0B, 0x00, 0xFF, 0xFF, 0x0E, 0x50, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x4F, 0x60, 0xFF, 0xFF, 0x06, 0x00, 0xFB, 0xFF, 0x2F, 0x80, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0x8F, 0xA0, 0xFF, 0xFF, 0x02, 0x00, 0xF7, 0xFF, 0x5F, 0xC0, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xBF, 0xD0, 0xFF, 0xEF, 0x00, 0x00, 0xF2, 0xFF,
+    0x9F, 0xF0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xEF, 0xF0, 0xFF, 0xAF, 0x00,
+    0x00, 0xE0, 0xFF, 0xCF, 0xF2, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xF4,
+    0xFF, 0x6F, 0x00, 0x00, 0xA0, 0xFF, 0xEF, 0xF5, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0xFA, 0xFF, 0x2F, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFE, 0xFF, 0x0E, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFE, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x06, 0x70,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0x06, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x03, 0x00, 0xC0, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0D, 0x00, 0xF5, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xFF, 0xFF, 0x7F, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
+    0x81, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0x6F, 0x70, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0C, 0x00,
+    0xFD, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0xF3, 0xFF, 0xFF,
+    0x1E, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xFB, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1E, 0x00, 0x60, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xAF, 0x00, 0xE1, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0xFF, 0x05, 0xFA, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0x1E, 0xFB, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x7F, 0xF3, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0D, 0xA0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0x05, 0x20, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x01, 0x40, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x08, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xD0,
+    0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x8F, 0xFD,
+    0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C,
+    0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0B, 0x80, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+    0xCC, 0x1C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF,
+    0xFF, 0xFF, 0xAF, 0xF5, 0xFF, 0xFF, 0xFF, 0xAF, 0xF5, 0xFF, 0xFF, 0xFF, 0xAF, 0xF5, 0xFF, 0xFF,
+    0xEE, 0x9E, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00,
+    0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00,
+    0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5,
+    0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF,
+    0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F,
+    0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00,
+    0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00,
+    0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xEE, 0x9E, 0xF5, 0xFF, 0xFF, 0xFF, 0xAF, 0xF5, 0xFF, 0xFF, 0xFF, 0xAF, 0xF5, 0xFF,
+    0xFF, 0xFF, 0xAF, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xAF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x4F, 0xF0, 0xFF, 0xFF, 0xFF, 0xEF,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xEF, 0xF0, 0xFF, 0xFF, 0xFF, 0xEF, 0xE0, 0xEE, 0xFE, 0xFF, 0xEF, 0x00,
+    0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00,
+    0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0,
+    0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF,
+    0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF,
+    0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00,
+    0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00,
+    0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0,
+    0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0x00, 0x00, 0xE0, 0xFF, 0xEF, 0xE0, 0xEE, 0xFE, 0xFF,
+    0xEF, 0xF0, 0xFF, 0xFF, 0xFF, 0xEF, 0xF0, 0xFF, 0xFF, 0xFF, 0xEF, 0xF0, 0xFF, 0xFF, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x5F, 0xFD, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0x0E, 0xF5, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x06, 0xC0, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xEF, 0x00, 0x40, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0x8F, 0x00, 0x00, 0xFB, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x1F, 0x00, 0x00, 0xF3,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x09, 0x00, 0x00, 0xA0, 0xFF, 0xBF, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x03, 0x00, 0xA0, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0x0C, 0x00, 0xF2, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x5F, 0x00,
+    0xF9, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDF, 0x00, 0x90, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x06, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xF1, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFA, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0xC1, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0C, 0x00, 0x00, 0x40, 0xB8, 0xFE, 0xFF,
+    0xAD, 0x06, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF2,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x03, 0x00, 0x30, 0xFF, 0x9E, 0x36, 0x63, 0xFD, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x47, 0x00,
+    0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x40, 0xA8, 0xDC, 0xFE,
+    0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xA0, 0xFF, 0xFF, 0xFF, 0x8D, 0x56, 0xA5, 0xFF,
+    0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0xF4, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0xF6, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x1F,
+    0xF5, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x1F, 0xF2, 0xFF, 0xFF, 0x8F, 0x23, 0xB4,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x50, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFB, 0xFF, 0x1F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0xF5,
+    0xFF, 0x1F, 0x00, 0x20, 0xD9, 0xFF, 0xBE, 0x17, 0x00, 0xF0, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09, 0x60, 0xEB, 0xEF, 0x6B, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x28, 0xFD, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xD8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x01, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xAF, 0xA8, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF0, 0xFF, 0xFF, 0xDF, 0x01,
+    0x00, 0xD1, 0xFF, 0xFF, 0x9F, 0x00, 0xF0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xEF,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0x04, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x05, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x04, 0xF0, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x01, 0xF0, 0xFF,
+    0xFF, 0x5F, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xEF, 0x00, 0xF0, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xE2,
+    0xFF, 0xFF, 0x9F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xBF, 0xA9, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xF0, 0xFF, 0xDF, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00,
+    0xF0, 0xFF, 0x7F, 0x00, 0x71, 0xEC, 0xEF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xEC,
+    0xFF, 0xCE, 0x49, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00,
+    0xFE, 0xFF, 0xFF, 0xCF, 0x99, 0xFC, 0xFF, 0x02, 0x60, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x85,
+    0x00, 0xB0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x80, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0xA3, 0x0B, 0x20, 0xFF, 0xFF, 0xFF, 0xCF,
+    0x99, 0xEB, 0xFF, 0x0B, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xB0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x10, 0xB6, 0xFD, 0xFF, 0xBE, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x50, 0xEA, 0xEF, 0x7C, 0x01, 0xF7, 0xFF, 0xFF, 0x01, 0x00, 0x10, 0xFC, 0xFF, 0xFF,
+    0xFF, 0x4E, 0xF5, 0xFF, 0xFF, 0x01, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
+    0x01, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF,
+    0xBF, 0xBA, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xB1, 0xFF, 0xFF,
+    0xFF, 0x01, 0xD0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xF2, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0x01, 0xF3, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x01, 0xF4, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x01, 0xF3, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x01, 0xF3, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x01, 0xF0,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x01, 0xD0, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
+    0x00, 0xFD, 0xFF, 0xFF, 0x01, 0x90, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x01,
+    0x30, 0xFF, 0xFF, 0xFF, 0xAF, 0x98, 0xFD, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFA, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF4, 0xFF, 0xFF,
+    0x01, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0x2D, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60, 0xEB,
+    0xEF, 0x6C, 0x00, 0x60, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x94, 0xED, 0xEF, 0x9D, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0xFE, 0xFF, 0xFF, 0x28, 0x20, 0xF7, 0xFF, 0xFF, 0x0C, 0x50, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0x3F, 0xB0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x8F, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xAF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xCF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF3, 0xFF, 0xFF, 0xCD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x9C, 0xF2,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF,
+    0xDF, 0x01, 0x00, 0x00, 0x00, 0x50, 0x07, 0x00, 0xFD, 0xFF, 0xFF, 0x9F, 0x35, 0x54, 0xB7, 0xFF,
+    0x0A, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x40, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x72, 0xDB, 0xFF, 0xEF, 0x9C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x71, 0xEB, 0xFF, 0xDE,
+    0x5A, 0x01, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFE,
+    0xFF, 0xFF, 0x8D, 0xA8, 0x2E, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xF3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x40, 0x54, 0xFF, 0xFF, 0xAF, 0x44, 0x44, 0x01, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xB8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00,
+    0xF7, 0xFF, 0xFF, 0x8D, 0xB7, 0xFF, 0xFF, 0xFF, 0x48, 0x00, 0x00, 0xFE, 0xFF, 0xCF, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0x01, 0x00, 0x20, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00,
+    0x40, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x09, 0x00, 0x40, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0x0A, 0x00, 0x20, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0xFD, 0xFF, 0xCF, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0x9D, 0xB8, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0x10, 0xFB,
+    0xFF, 0xFE, 0xEF, 0x8C, 0x03, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6,
+    0xFF, 0xFF, 0x9B, 0x88, 0x88, 0x68, 0x03, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x06, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0x60, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xF2, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x20, 0xE6, 0xFF, 0xFF, 0x0B,
+    0xF9, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x0B, 0xFD, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A, 0xFD, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0x06, 0xFB, 0xFF, 0xDF, 0x03, 0x00, 0x00, 0x50, 0xFD, 0xFF, 0xEF, 0x01, 0xF5, 0xFF, 0xFF, 0xEF,
+    0xBC, 0xDB, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x10, 0xA6,
+    0xED, 0xFF, 0xEE, 0x9B, 0x15, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0x08, 0x50, 0xEB, 0xFF, 0x9D, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x17, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x99, 0xFD, 0xFF, 0xFF, 0xAF, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x80, 0xFF, 0xFF,
+    0xEF, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02,
+    0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0x40, 0xFC, 0xAE, 0x01, 0xE0, 0xFF, 0xFF, 0x09, 0xF3,
+    0xFF, 0xFF, 0x0D, 0xF2, 0xFF, 0xFF, 0x0C, 0xB0, 0xFF, 0xFF, 0x05, 0x00, 0x85, 0x27, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0,
+    0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0,
+    0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0,
+    0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0,
+    0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0,
+    0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xC4, 0xEF,
+    0x1A, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x9F, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x50, 0x78, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x10, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0x8F, 0xB6, 0x99, 0xFD, 0xFF, 0xFF, 0x4F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x04, 0xF7, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xB4, 0xFE, 0xEF, 0x7C, 0x01, 0x00, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+    0xFF, 0x09, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xBF, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x0C, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x70, 0xFF, 0xFF,
+    0xDF, 0x01, 0x00, 0xF0, 0xFF, 0xFF, 0x09, 0x00, 0xF6, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x09, 0x50, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x08, 0xF3, 0xFF, 0xFF,
+    0x3F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x17, 0xFE, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0xB6, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
+    0x2F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xDD,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xBF, 0x30, 0xFF, 0xFF, 0xEF, 0x01, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0xF8, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0xC0, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x20, 0xFF, 0xFF, 0xFF,
+    0x04, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1E, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xBF, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFE,
+    0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x3F, 0xF0, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0x6F, 0x00, 0x71, 0xEC, 0xEF, 0x7C, 0x02, 0x00, 0x10, 0xC7, 0xFE, 0xCE,
+    0x17, 0x00, 0x00, 0xF0, 0xFF, 0xAF, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF6, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0xF0, 0xFF, 0xEF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xBF, 0xA9, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x8B, 0xFA, 0xFF, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xE1, 0xFF, 0xFF,
+    0xFF, 0x2E, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x04, 0xF0, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0xFF, 0x04, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x06, 0xF0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x10, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07,
+    0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0x07, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0x6F, 0x00, 0x60, 0xEB, 0xFF, 0x9D, 0x03,
+    0x00, 0x00, 0xF0, 0xFF, 0xAF, 0x40, 0xFD, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF0, 0xFF, 0xEF,
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x4F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xCF, 0x99, 0xFC, 0xFF, 0xFF, 0xAF, 0x00, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x04, 0x00, 0x80, 0xFF, 0xFF, 0xEF, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x01, 0xF0,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02,
+    0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x84, 0xEC, 0xFF, 0xBD, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xBF, 0xA9,
+    0xFD, 0xFF, 0xFF, 0x5F, 0x00, 0x50, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0x80, 0xFF, 0xFF, 0xDF, 0x00,
+    0xB0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x08, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0x0A, 0xF3, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x0C, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x07, 0xB0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0x04, 0x50, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x70, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFC,
+    0xFF, 0xFF, 0xBF, 0x99, 0xFD, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00,
+    0x00, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xEC, 0xFF,
+    0xBD, 0x16, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xBF, 0x00, 0x60, 0xEB, 0xEF, 0x6B, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xD5, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xAF, 0xA8, 0xFE, 0xFF, 0xFF, 0x3F, 0x00, 0xF0, 0xFF, 0xFF, 0xDF,
+    0x01, 0x00, 0xC1, 0xFF, 0xFF, 0x9F, 0x00, 0xF0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0xEF, 0x00, 0xF0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0x04, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x05, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x04, 0xF0, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0xF0,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xDF, 0x00, 0xF0, 0xFF, 0xFF, 0xEF, 0x03, 0x00,
+    0xD1, 0xFF, 0xFF, 0x8F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xBF, 0xA9, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF0, 0xFF, 0xFF, 0xFB, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xF0, 0xFF, 0xFF, 0x47, 0xFE, 0xFF, 0xFF, 0xFF, 0x1C, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x08, 0x71, 0xEC, 0xEF, 0x5B, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xEA, 0xEF, 0x7C, 0x01, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x10, 0xFB, 0xFF, 0xFF, 0xFF,
+    0x4E, 0xF0, 0xFF, 0xFF, 0x01, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0x01,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xBF,
+    0xBA, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0xB1, 0xFF, 0xFF, 0xFF,
+    0x01, 0xD0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF5, 0xFF,
+    0xFF, 0x01, 0xF3, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x01, 0xF4, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x01, 0xF3, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0x01, 0xF3, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x01, 0xF0, 0xFF,
+    0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x01, 0xD0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x01, 0x90, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x01, 0x30,
+    0xFF, 0xFF, 0xFF, 0x9E, 0x87, 0xFC, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xFF, 0xFF, 0x01,
+    0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0x3D, 0xF7, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60, 0xEB, 0xEF,
+    0x6C, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0x5F, 0x00, 0x30, 0xEA, 0xFF,
+    0x05, 0xF0, 0xFF, 0x9F, 0x00, 0xF8, 0xFF, 0xFF, 0x05, 0xF0, 0xFF, 0xCF, 0x90, 0xFF, 0xFF, 0xFF,
+    0x04, 0xF0, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xDF, 0x58, 0x65, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x95, 0xEC, 0xFF, 0xCE, 0x59, 0x01, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xAF, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xD0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF2, 0xFF, 0xFF, 0x5D, 0x33, 0x95, 0xFE, 0x0F, 0x00, 0xF4, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x50, 0x06, 0x00, 0xF3, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0x00,
+    0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x71, 0xFE, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x06, 0x93, 0x03, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0x05, 0xF4, 0xEF, 0x69, 0x23, 0x53, 0xFD, 0xFF, 0xFF, 0x02, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xBF, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0xF3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x10, 0xA6, 0xEC, 0xFF, 0xEF, 0x8C, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x66, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF2, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x40, 0x94, 0xFF, 0xFF, 0x6F, 0x44, 0x44, 0x04, 0x00, 0x60,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x8C, 0xB9, 0x4F, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xA4, 0xFE, 0xEF, 0x9C, 0x04, 0xF2, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
+    0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF,
+    0xFF, 0xFF, 0x8C, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x3D, 0xB0, 0xFF, 0xFF, 0x00, 0x00, 0xA4, 0xFD, 0xEF, 0x6B, 0x00, 0x70, 0xFF, 0xFF,
+    0xFD, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x6F, 0xF7, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0x0A, 0xA0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x04, 0x40, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0xEF, 0x00, 0x00, 0xFE, 0xFF, 0xCF, 0x00, 0x00, 0x10, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0x00, 0x70, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xF2, 0xFF,
+    0xFF, 0x06, 0x00, 0xC0, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0C, 0x00, 0xF1, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x1F, 0x00, 0xF7, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0x6F, 0x00, 0xFC, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xCF, 0x10, 0xFF,
+    0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x60, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0xFF, 0xFF, 0xA4, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xE8,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFA, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0xF3, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xBF, 0x00, 0xE0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x7F, 0x00, 0xA0, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x50, 0xFF, 0xFF, 0x2F, 0x00, 0x50, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x08, 0x00, 0x90, 0xFF, 0xFF, 0x0E, 0x00, 0x10, 0xFF, 0xFF, 0x6F,
+    0x00, 0x30, 0xFF, 0xEF, 0xF7, 0xFF, 0x0C, 0x00, 0xD0, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xFC, 0xFF,
+    0xAF, 0x00, 0x70, 0xFF, 0xAF, 0xF3, 0xFF, 0x0F, 0x00, 0xF2, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xF8,
+    0xFF, 0xEF, 0x00, 0xB0, 0xFF, 0x6F, 0xF0, 0xFF, 0x3F, 0x00, 0xF6, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0x3F, 0xC0, 0xFF, 0x7F, 0x00, 0xFA, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x07, 0xF3, 0xFF, 0x0F, 0x80, 0xFF, 0xBF, 0x00, 0xFE, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0A, 0xF7, 0xFF, 0x0B, 0x50, 0xFF, 0xFF, 0x10, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0D, 0xFA, 0xFF, 0x08, 0x10, 0xFF, 0xFF, 0x42, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x0F, 0xFC, 0xFF, 0x04, 0x00, 0xFD, 0xFF, 0x74, 0xFF,
+    0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x3F, 0xFF, 0xFF, 0x01, 0x00, 0xF9, 0xFF, 0xA7,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x7F, 0xFF, 0xDF, 0x00, 0x00, 0xF6, 0xFF,
+    0xD9, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xBF, 0xFF, 0x9F, 0x00, 0x00, 0xF2,
+    0xFF, 0xFC, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x2F, 0x70, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0xFF, 0x07, 0x00, 0xFD, 0xFF, 0xFF, 0x07, 0x00, 0x70, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x1F, 0x00, 0xF1, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xAF, 0x00, 0xFA, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x98, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xFF, 0xEF, 0x00, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xD0, 0xFF, 0xFF,
+    0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0B, 0x00, 0xC0, 0xFF, 0xFF,
+    0x7F, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x02, 0xC0, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x0C, 0xF7, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x6F, 0xF6, 0xFF,
+    0xFF, 0x0B, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0x0A, 0xA0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x04, 0x30,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x05, 0x00, 0x80, 0xFF, 0xFF, 0x3F, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0A, 0x00, 0xD0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0F,
+    0x00, 0xF2, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x4F, 0x00, 0xF8, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0xFE, 0xFF, 0x9F, 0x00, 0xFD, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xEF, 0x20, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x73, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xB7, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFD, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0x9A, 0xFB, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFE, 0xEF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF6,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x52, 0x55, 0x55, 0x55, 0xB5, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0x5F, 0x55, 0x55, 0x55, 0x55, 0x02, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x10, 0xA6, 0xED,
+    0x7F, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x8F, 0x14, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0x03, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x30, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0xC4, 0xFE, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x18, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xC5, 0xFE, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x40, 0xFD, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0x03, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0x9F, 0x14, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x10, 0xA6, 0xED,
+    0x7F, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08,
+    0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9,
+    0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF,
+    0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08,
+    0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9,
+    0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF,
+    0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08, 0xF9, 0xFF, 0x08,
+    0xF9, 0xFF, 0x08, 0xF7, 0xDE, 0x7B, 0x01, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x6F, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x41,
+    0xF8, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xDF, 0x4B, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0x6F, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xEF, 0x4C, 0x00, 0x10, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x41, 0xF8, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x5F,
+    0x00, 0x00, 0x00, 0xF7, 0xDF, 0x7B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFE, 0xBE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x00, 0x50, 0x1F, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x38, 0x31,
+    0xFA, 0x1F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0x8F, 0x12, 0xA4,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xE5, 0x03, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xDF, 0x01,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFC, 0xDF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xFE, 0x7C, 0x01, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF,
+    0x3E, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0x9A, 0xFE, 0xFF, 0x0C,
+    0xE0, 0xFF, 0x2E, 0x00, 0xC0, 0xFF, 0x3F, 0xF2, 0xFF, 0x07, 0x00, 0x30, 0xFF, 0x6F, 0xF4, 0xFF,
+    0x04, 0x00, 0x00, 0xFF, 0x8F, 0xF3, 0xFF, 0x07, 0x00, 0x30, 0xFF, 0x6F, 0xF0, 0xFF, 0x2E, 0x00,
+    0xC0, 0xFF, 0x3F, 0x90, 0xFF, 0xFF, 0x9A, 0xFE, 0xFF, 0x0C, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x02, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0x8D, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF,
+    0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xDF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x95, 0xEC, 0xFF, 0xDE, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFE, 0xFF,
+    0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x20, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x03, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0xD0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0xF2,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x6F, 0x00, 0xF6, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x00, 0xF9, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xDF, 0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x00, 0xF9,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xCF, 0x00, 0xF5, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9F, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x5F, 0x00, 0xD0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x1F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x20, 0xF9, 0xFF, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x95,
+    0xEC, 0xFF, 0xDE, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xDE, 0x06, 0x00, 0xC4,
+    0xBE, 0x02, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x3F, 0x00, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0x7F, 0x30, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x4F, 0x10, 0xFF, 0xFF, 0x0C,
+    0x00, 0x00, 0x00, 0xA0, 0xEF, 0x07, 0x00, 0xD5, 0xCF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xB8, 0xFE, 0xFF, 0xAD,
+    0x06, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF2, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x03, 0x00, 0x30, 0xFF, 0x9E, 0x36, 0x63, 0xFD, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x47, 0x00, 0x00,
+    0x00, 0xE1, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x40, 0xA8, 0xDC, 0xFE, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xA0, 0xFF, 0xFF, 0xFF, 0x8D, 0x56, 0xA5, 0xFF, 0xFF,
+    0x1F, 0xF1, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0xF4, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x1F, 0xF6, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x1F, 0xF5,
+    0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x1F, 0xF2, 0xFF, 0xFF, 0x8F, 0x23, 0xB4, 0xFF,
+    0xFF, 0xFF, 0x1F, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x50, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x4F, 0xFB, 0xFF, 0x1F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0xF5, 0xFF,
+    0x1F, 0x00, 0x20, 0xD9, 0xFF, 0xBE, 0x17, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x3E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xEC, 0xFF, 0xBD, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0xFD, 0xFF, 0xFF, 0xBF, 0xA9, 0xFD, 0xFF, 0xFF, 0x5F, 0x00, 0x50, 0xFF, 0xFF, 0xDF, 0x02, 0x00,
+    0x80, 0xFF, 0xFF, 0xDF, 0x00, 0xB0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x03,
+    0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x08, 0xF2, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0xF3, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x0C, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0C, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF2, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x07, 0xB0, 0xFF, 0xFF,
+    0x4F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x50, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x70, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0x99, 0xFD, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF2,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x83, 0xEC, 0xFF, 0xBD, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF,
+    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x8C, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xEF,
+    0x00, 0xFA, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x9F, 0x00, 0xF5,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x4F, 0x00, 0xF0, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0xB0, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0A, 0x00, 0x60, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x06, 0x00, 0x10, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x60, 0xFF,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00, 0xC0, 0xFF, 0xFF, 0x5F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0xF7, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0xAF, 0x00, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x1C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xDF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0x8F, 0x86, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFE, 0xBE,
+    0x02, 0x00, 0x00, 0x00, 0x40, 0xB8, 0xFE, 0xFF, 0xAD, 0x06, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x9E, 0x36, 0x63,
+    0xFD, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0x40, 0xA8, 0xDC, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x70, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
+    0xA0, 0xFF, 0xFF, 0xFF, 0x8D, 0x56, 0xA5, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0x5F, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0x1F, 0xF4, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0xF6, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x1F, 0xF5, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0x1F, 0xF2, 0xFF, 0xFF, 0x8F, 0x23, 0xB4, 0xFF, 0xFF, 0xFF, 0x1F, 0xD0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFB, 0xFF, 0x1F,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0xF5, 0xFF, 0x1F, 0x00, 0x20, 0xD9, 0xFF, 0xBE, 0x17,
+    0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xEF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x69, 0x48,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xEA, 0xEF, 0x4C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE,
+    0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xEC, 0xFF, 0xCE, 0x59, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00, 0xD3, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x03, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xEF, 0xDD, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFB, 0xFF,
+    0xFF, 0xBF, 0x03, 0x00, 0x30, 0xE8, 0x7F, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x15, 0x00, 0xB0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x02, 0x00, 0x00, 0x73, 0xDC, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xEF, 0xCD, 0xFE,
+    0xFF, 0xDF, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x30, 0xB7, 0xED, 0xFF, 0xCE, 0x59, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xEC, 0xFF, 0xCE, 0x49, 0x00,
+    0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xFE, 0xFF, 0xFF, 0xCF,
+    0x99, 0xFC, 0xFF, 0x02, 0x60, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x85, 0x00, 0xB0, 0xFF, 0xFF,
+    0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0xFF,
+    0xFF, 0xEF, 0x03, 0x00, 0x00, 0xA3, 0x0B, 0x20, 0xFF, 0xFF, 0xFF, 0xCF, 0x99, 0xEB, 0xFF, 0x0B,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0B, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x10, 0xB6, 0xFD,
+    0xFF, 0xBE, 0x17, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xBB, 0xBB, 0xBB, 0xBB,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF9, 0xFF, 0xFF, 0xBC, 0xBB,
+    0xBB, 0xBB, 0x3B, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC,
+    0xCC, 0xCC, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x68, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xEB, 0xEF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x94, 0xED, 0xEF, 0x9D, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04, 0x00, 0x00, 0x50, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0xFE, 0xFF, 0xFF, 0x28, 0x20, 0xF7, 0xFF, 0xFF, 0x0C, 0x50, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0x3F, 0xB0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x8F, 0xF0, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xAF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF3, 0xFF, 0xFF, 0xCD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x9C,
+    0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x50, 0x07, 0x00, 0xFD, 0xFF, 0xFF, 0x9F, 0x35, 0x54, 0xB7,
+    0xFF, 0x0A, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x40, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0x72, 0xDB, 0xFF, 0xEF, 0x9C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0xEF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0x69, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xEA, 0xEF, 0x3C, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0x2F, 0xD4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xCF, 0xFF, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xCF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+    0x02, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x90, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x02, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x90, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x90,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x8F, 0x0A,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x90, 0xFF, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x30, 0xBB, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x90,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xEF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFE, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0x07, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF,
+    0xEF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x6F, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x5F, 0xF8, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x5F, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xB0, 0xFF,
+    0xFF, 0x07, 0xF9, 0xFF, 0x6F, 0x50, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9,
+    0xFF, 0x7F, 0x00, 0xFC, 0xFF, 0xFF, 0x05, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00,
+    0xF3, 0xFF, 0xFF, 0x0E, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0xA0, 0xFF, 0xFF,
+    0x8F, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x02, 0xA0,
+    0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x0B, 0xA0, 0xFF, 0xFF, 0x07,
+    0xF9, 0xFF, 0x8F, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x4F, 0x90, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xDF, 0x80, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0xFF, 0x07, 0xF9, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6,
+    0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x6F, 0x00, 0x60, 0xEB, 0xFF, 0x9D, 0x03,
+    0x00, 0x00, 0xF0, 0xFF, 0xAF, 0x40, 0xFD, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF0, 0xFF, 0xEF,
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x4F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xCF, 0x99, 0xFC, 0xFF, 0xFF, 0xAF, 0x00, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x04, 0x00, 0x80, 0xFF, 0xFF, 0xEF, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x01, 0xF0,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02,
+    0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xEF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xB7, 0xFE, 0xEF, 0xAD, 0x26, 0x00, 0x00, 0x00, 0x10, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x6C, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFC, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xDF, 0xEC, 0xFF, 0xFF, 0x3F, 0x00,
+    0xA0, 0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x51, 0xFA, 0x0C, 0x00, 0xD0, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0xE0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0xFF, 0xAF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFC, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFB, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xFB, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x06, 0xA3, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x04,
+    0xF4, 0xDF, 0x38, 0x00, 0x00, 0x50, 0xFE, 0xFF, 0xFF, 0x01, 0xF4, 0xFF, 0xFF, 0xDF, 0xDC, 0xFE,
+    0xFF, 0xFF, 0xBF, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xF4, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B,
+    0x00, 0x00, 0x00, 0x51, 0xC9, 0xFE, 0xFF, 0xBD, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xBF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xEC, 0xFF, 0xCE, 0x59, 0x01, 0x00, 0x00, 0xD3, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xD0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF2, 0xFF, 0xFF, 0x5D, 0x33, 0x95, 0xFE, 0x0F,
+    0x00, 0xF4, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x50, 0x06, 0x00, 0xF3, 0xFF, 0xFF, 0x1C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x5B, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0xA1,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x71, 0xFE, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x06, 0x93, 0x03, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x05, 0xF4, 0xEF, 0x69, 0x23, 0x53, 0xFD, 0xFF, 0xFF, 0x02, 0xF4, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x10, 0xA6, 0xEC, 0xFF, 0xEF, 0x8C, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xCF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xDF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0C, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xB0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x80, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xEF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xDF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xCC,
+    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x1C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x1F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0xDF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x01, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF6, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x52, 0x55,
+    0x55, 0x55, 0xB5, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x5F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE1, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x5F, 0x55, 0x55,
+    0x55, 0x55, 0x02, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x40, 0x77, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xB2, 0xEF, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C,
+    0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x80, 0xCC, 0xCC, 0xCC, 0xCC,
+    0xCC, 0xCC, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x1E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x1C, 0xF1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x73, 0x57, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xEA, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x01, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x52, 0x55, 0x55, 0x55, 0xB5, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xEF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF2, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x02, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06,
+};
+const GFXglyph OpenSans18BGlyphs[] = {
+    { 0, 0, 10, 0, 0, 0, 0 }, //  
+    { 7, 27, 11, 2, 27, 108, 0 }, // !
+    { 14, 10, 18, 2, 27, 70, 108 }, // "
+    { 24, 27, 25, 0, 27, 324, 178 }, // #
+    { 20, 31, 22, 1, 29, 310, 502 }, // $
+    { 33, 27, 34, 1, 27, 459, 812 }, // %
+    { 28, 27, 29, 1, 27, 378, 1271 }, // &
+    { 6, 10, 10, 2, 27, 30, 1649 }, // '
+    { 11, 33, 13, 1, 27, 198, 1679 }, // (
+    { 11, 33, 13, 1, 27, 198, 1877 }, // )
+    { 19, 19, 21, 1, 29, 190, 2075 }, // *
+    { 20, 20, 22, 1, 23, 200, 2265 }, // +
+    { 8, 9, 11, 1, 4, 36, 2465 }, // ,
+    { 11, 5, 12, 1, 13, 30, 2501 }, // -
+    { 7, 7, 11, 2, 7, 28, 2531 }, // .
+    { 16, 27, 16, 0, 27, 216, 2559 }, // /
+    { 20, 27, 22, 1, 27, 270, 2775 }, // 0
+    { 14, 27, 22, 2, 27, 189, 3045 }, // 1
+    { 20, 27, 22, 1, 27, 270, 3234 }, // 2
+    { 20, 27, 22, 1, 27, 270, 3504 }, // 3
+    { 22, 27, 22, 0, 27, 297, 3774 }, // 4
+    { 19, 27, 22, 1, 27, 270, 4071 }, // 5
+    { 20, 27, 22, 1, 27, 270, 4341 }, // 6
+    { 20, 27, 22, 1, 27, 270, 4611 }, // 7
+    { 20, 27, 22, 1, 27, 270, 4881 }, // 8
+    { 20, 27, 22, 1, 27, 270, 5151 }, // 9
+    { 7, 21, 11, 2, 21, 84, 5421 }, // :
+    { 8, 26, 11, 1, 21, 104, 5505 }, // ;
+    { 20, 21, 22, 1, 24, 210, 5609 }, // <
+    { 20, 11, 22, 1, 19, 110, 5819 }, // =
+    { 20, 21, 22, 1, 24, 210, 5929 }, // >
+    { 18, 27, 18, 0, 27, 243, 6139 }, // ?
+    { 32, 30, 34, 1, 27, 480, 6382 }, // @
+    { 27, 27, 26, 0, 27, 378, 6862 }, // A
+    { 21, 27, 26, 3, 27, 297, 7240 }, // B
+    { 21, 27, 24, 2, 27, 297, 7537 }, // C
+    { 23, 27, 28, 3, 27, 324, 7834 }, // D
+    { 17, 27, 21, 3, 27, 243, 8158 }, // E
+    { 16, 27, 21, 3, 27, 216, 8401 }, // F
+    { 23, 27, 28, 2, 27, 324, 8617 }, // G
+    { 23, 27, 29, 3, 27, 324, 8941 }, // H
+    { 7, 27, 13, 3, 27, 108, 9265 }, // I
+    { 13, 35, 13, -3, 27, 245, 9373 }, // J
+    { 23, 27, 25, 3, 27, 324, 9618 }, // K
+    { 18, 27, 21, 3, 27, 243, 9942 }, // L
+    { 30, 27, 36, 3, 27, 405, 10185 }, // M
+    { 25, 27, 31, 3, 27, 351, 10590 }, // N
+    { 27, 27, 30, 2, 27, 378, 10941 }, // O
+    { 20, 27, 24, 3, 27, 270, 11319 }, // P
+    { 27, 33, 30, 2, 27, 462, 11589 }, // Q
+    { 23, 27, 25, 3, 27, 324, 12051 }, // R
+    { 19, 27, 21, 1, 27, 270, 12375 }, // S
+    { 22, 27, 22, 0, 27, 297, 12645 }, // T
+    { 23, 27, 29, 3, 27, 324, 12942 }, // U
+    { 25, 27, 25, 0, 27, 351, 13266 }, // V
+    { 37, 27, 37, 0, 27, 513, 13617 }, // W
+    { 26, 27, 25, 0, 27, 351, 14130 }, // X
+    { 24, 27, 24, 0, 27, 324, 14481 }, // Y
+    { 22, 27, 22, 0, 27, 297, 14805 }, // Z
+    { 10, 33, 13, 2, 27, 165, 15102 }, // [
+    { 16, 27, 16, 0, 27, 216, 15267 }, // '\\'
+    { 10, 33, 13, 0, 27, 165, 15483 }, // ]
+    { 21, 17, 20, 0, 27, 187, 15648 }, // ^
+    { 17, 3, 16, -1, -3, 27, 15835 }, // _
+    { 11, 6, 23, 6, 29, 36, 15862 }, // `
+    { 20, 21, 23, 1, 21, 210, 15898 }, // a
+    { 21, 29, 24, 2, 29, 319, 16108 }, // b
+    { 18, 21, 20, 1, 21, 189, 16427 }, // c
+    { 21, 29, 24, 1, 29, 319, 16616 }, // d
+    { 20, 21, 22, 1, 21, 210, 16935 }, // e
+    { 17, 29, 15, 0, 29, 261, 17145 }, // f
+    { 22, 30, 21, 0, 21, 330, 17406 }, // g
+    { 21, 29, 25, 2, 29, 319, 17736 }, // h
+    { 7, 29, 12, 2, 29, 116, 18055 }, // i
+    { 12, 38, 12, -3, 29, 228, 18171 }, // j
+    { 22, 29, 24, 2, 29, 319, 18399 }, // k
+    { 7, 29, 12, 2, 29, 116, 18718 }, // l
+    { 33, 21, 37, 2, 21, 357, 18834 }, // m
+    { 21, 21, 25, 2, 21, 231, 19191 }, // n
+    { 21, 21, 24, 1, 21, 231, 19422 }, // o
+    { 21, 30, 24, 2, 21, 330, 19653 }, // p
+    { 21, 30, 24, 1, 21, 330, 19983 }, // q
+    { 15, 21, 17, 2, 21, 168, 20313 }, // r
+    { 17, 21, 19, 1, 21, 189, 20481 }, // s
+    { 16, 26, 17, 0, 26, 208, 20670 }, // t
+    { 20, 21, 25, 2, 21, 210, 20878 }, // u
+    { 22, 21, 22, 0, 21, 231, 21088 }, // v
+    { 33, 21, 33, 0, 21, 357, 21319 }, // w
+    { 22, 21, 22, 0, 21, 231, 21676 }, // x
+    { 22, 30, 22, 0, 21, 330, 21907 }, // y
+    { 17, 21, 19, 1, 21, 189, 22237 }, // z
+    { 14, 33, 15, 0, 27, 231, 22426 }, // {
+    { 5, 38, 21, 8, 29, 114, 22657 }, // |
+    { 14, 33, 15, 1, 27, 231, 22771 }, // }
+    { 20, 9, 22, 1, 18, 90, 23002 }, // ~
+    { 14, 13, 16, 1, 28, 91, 23092 }, // °
+    { 27, 35, 30, 2, 35, 490, 23183 }, // Ó
+    { 20, 29, 23, 1, 29, 290, 23673 }, // ä
+    { 21, 29, 24, 1, 29, 319, 23963 }, // ó
+    { 27, 36, 26, 0, 27, 504, 24282 }, // Ą
+    { 20, 30, 23, 1, 21, 300, 24786 }, // ą
+    { 21, 35, 24, 2, 35, 385, 25086 }, // Ć
+    { 18, 29, 20, 1, 29, 261, 25471 }, // ć
+    { 17, 36, 21, 3, 27, 324, 25732 }, // Ę
+    { 20, 30, 22, 1, 21, 300, 26056 }, // ę
+    { 21, 27, 21, 0, 27, 297, 26356 }, // Ł
+    { 13, 29, 13, 0, 29, 203, 26653 }, // ł
+    { 25, 35, 31, 3, 35, 455, 26856 }, // Ń
+    { 21, 29, 25, 2, 29, 319, 27311 }, // ń
+    { 19, 35, 21, 1, 35, 350, 27630 }, // Ś
+    { 17, 29, 19, 1, 29, 261, 27980 }, // ś
+    { 22, 35, 22, 0, 35, 385, 28241 }, // Ź
+    { 17, 29, 19, 1, 29, 261, 28626 }, // ź
+    { 22, 35, 22, 0, 35, 385, 28887 }, // Ż
+    { 17, 29, 19, 1, 29, 261, 29272 }, // ż
+};
+const UnicodeInterval OpenSans18BIntervals[] = {
+    { 0x20, 0x7E, 0x0 },
+    { 0xB0, 0xB0, 0x5F },
+    { 0xD3, 0xD3, 0x60 },
+    { 0xE4, 0xE4, 0x61 },
+    { 0xF3, 0xF3, 0x62 },
+    { 0x104, 0x107, 0x63 },
+    { 0x118, 0x119, 0x67 },
+    { 0x141, 0x144, 0x69 },
+    { 0x15A, 0x15B, 0x6D },
+    { 0x179, 0x17C, 0x6F },
+};
+const GFXfont OpenSans18B = {
+    (uint8_t*)OpenSans18BBitmaps,
+    (GFXglyph*)OpenSans18BGlyphs,
+    (UnicodeInterval*)OpenSans18BIntervals,
+    10,
+    0,
+    51,
+    41,
+    -11,
+};
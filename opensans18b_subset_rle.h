@@ -0,0 +1,1192 @@
+#pragma once
+// Generated by tools/fontencode.py rle from opensans18b_subset.h, do not edit
+#include "epd_driver.h"
+const uint8_t OpenSans18BBitmaps[16768] = {
+    0x52, 0x4C, 0x45, 0x34, 0x8B, 0x44, 0x9A, 0x44, 0x99, 0x44, 0x88, 0x89, 0x44, 0x87, 0x88, 0x44,
+    0x86, 0x87, 0x44, 0x85, 0x86, 0x44, 0x95, 0x44, 0x94, 0x44, 0x93, 0x44, 0x92, 0x44, 0x81, 0x82,
+    0x44, 0x00, 0x81, 0x44, 0x01, 0x43, 0x8E, 0x01, 0x43, 0x8E, 0x01, 0x8E, 0x42, 0x8D, 0x01, 0x8D,
+    0x42, 0x8C, 0x01, 0x86, 0xA8, 0x85, 0x10, 0x82, 0x84, 0x82, 0x01, 0x81, 0x8C, 0x42, 0x8A, 0x00,
+    0x89, 0x44, 0x86, 0x8C, 0x44, 0x89, 0x8B, 0x44, 0x89, 0x86, 0x44, 0x83, 0x00, 0x87, 0x8D, 0x40,
+    0x8D, 0x85, 0x00, 0x87, 0x43, 0x89, 0x01, 0x8A, 0x43, 0x96, 0x43, 0x88, 0x01, 0x89, 0x43, 0x95,
+    0x43, 0x87, 0x01, 0x88, 0x43, 0x94, 0x43, 0x85, 0x01, 0x87, 0x43, 0x93, 0x43, 0x84, 0x01, 0x85,
+    0x43, 0x91, 0x43, 0x83, 0x01, 0x84, 0x43, 0x01, 0x43, 0x82, 0x01, 0x83, 0x43, 0x01, 0x43, 0x81,
+    0x01, 0x82, 0x42, 0x8E, 0x01, 0x8E, 0x42, 0x03, 0x42, 0x8D, 0x01, 0x8C, 0x41, 0x8E, 0x03, 0x42,
+    0x8B, 0x00, 0x07, 0x82, 0x42, 0x8E, 0x02, 0x86, 0x42, 0x89, 0x0A, 0x84, 0x42, 0x8C, 0x02, 0x88,
+    0x42, 0x86, 0x0A, 0x87, 0x42, 0x89, 0x02, 0x8B, 0x42, 0x84, 0x0A, 0x8A, 0x42, 0x86, 0x02, 0x8E,
+    0x42, 0x81, 0x0A, 0x8D, 0x42, 0x83, 0x01, 0x81, 0x42, 0x8E, 0x0B, 0x43, 0x02, 0x84, 0x42, 0x8B,
+    0x0A, 0x83, 0x42, 0x8D, 0x02, 0x87, 0x42, 0x88, 0x0A, 0x86, 0x42, 0x8A, 0x02, 0x8A, 0x42, 0x85,
+    0x05, 0x8D, 0x53, 0x8B, 0x01, 0x8D, 0x53, 0x8B, 0x01, 0x8D, 0x53, 0x8B, 0x01, 0x8B, 0xBE, 0x43,
+    0xBE, 0x43, 0xBE, 0x8A, 0x05, 0x84, 0x42, 0x8B, 0x02, 0x89, 0x42, 0x86, 0x0A, 0x88, 0x42, 0x88,
+    0x02, 0x8D, 0x42, 0x83, 0x0A, 0x8B, 0x42, 0x85, 0x02, 0x43, 0x0B, 0x8E, 0x42, 0x81, 0x01, 0x84,
+    0x42, 0x8C, 0x05, 0x82, 0x54, 0x87, 0x00, 0x82, 0x54, 0x87, 0x00, 0x82, 0x54, 0x87, 0x00, 0x82,
+    0xBD, 0x43, 0xBD, 0x43, 0xCD, 0x86, 0x05, 0x8E, 0x42, 0x82, 0x01, 0x84, 0x42, 0x8C, 0x0A, 0x81,
+    0x43, 0x02, 0x87, 0x42, 0x89, 0x0A, 0x84, 0x42, 0x8C, 0x02, 0x8A, 0x42, 0x86, 0x0A, 0x87, 0x42,
+    0x88, 0x02, 0x8D, 0x42, 0x83, 0x0A, 0x8A, 0x42, 0x85, 0x01, 0x81, 0x43, 0x0B, 0x8D, 0x42, 0x82,
+    0x01, 0x84, 0x42, 0x8C, 0x0B, 0x43, 0x02, 0x87, 0x42, 0x89, 0x07, 0x07, 0x86, 0x41, 0x82, 0x0F,
+    0x86, 0x41, 0x82, 0x0F, 0x86, 0x41, 0x82, 0x0C, 0x84, 0x89, 0x8C, 0x8E, 0x42, 0x8E, 0x8C, 0x89,
+    0x86, 0x82, 0x05, 0x85, 0x8D, 0x4B, 0x8D, 0x85, 0x02, 0x89, 0x4E, 0x87, 0x01, 0x87, 0x4F, 0x81,
+    0x01, 0x46, 0x8D, 0x41, 0x8B, 0x8D, 0x43, 0x8B, 0x01, 0x83, 0x44, 0x8A, 0x00, 0x86, 0x41, 0x82,
+    0x01, 0x83, 0x88, 0x8D, 0x84, 0x01, 0x85, 0x44, 0x84, 0x00, 0x86, 0x41, 0x82, 0x07, 0x84, 0x44,
+    0x88, 0x00, 0x86, 0x41, 0x82, 0x07, 0x81, 0x45, 0x8A, 0x88, 0x41, 0x82, 0x08, 0x89, 0x48, 0x82,
+    0x08, 0x81, 0x8D, 0x47, 0x8E, 0x89, 0x82, 0x07, 0x81, 0x8B, 0x49, 0x8B, 0x83, 0x07, 0x85, 0x8D,
+    0x49, 0x89, 0x08, 0x84, 0x8A, 0x48, 0x8C, 0x09, 0x86, 0x48, 0x89, 0x08, 0x86, 0x41, 0x86, 0x8C,
+    0x45, 0x08, 0x86, 0x41, 0x82, 0x00, 0x8A, 0x44, 0x83, 0x91, 0x05, 0x86, 0x41, 0x82, 0x00, 0x86,
+    0x44, 0x83, 0x85, 0x40, 0x8B, 0x86, 0x81, 0x02, 0x86, 0x41, 0x82, 0x00, 0x8B, 0x44, 0x81, 0x85,
+    0x43, 0x8D, 0x8A, 0x87, 0x8A, 0x41, 0x8A, 0x8E, 0x44, 0x8C, 0x00, 0x85, 0x50, 0x84, 0x00, 0x85,
+    0x4F, 0x86, 0x01, 0x82, 0x8B, 0x4C, 0x8C, 0x83, 0x04, 0x81, 0x85, 0x89, 0x8B, 0x8D, 0x8E, 0x42,
+    0x8E, 0x8B, 0x88, 0x83, 0x0C, 0x86, 0x41, 0x82, 0x0F, 0x86, 0x41, 0x82, 0x0F, 0x86, 0x41, 0x82,
+    0x0F, 0x86, 0x41, 0x82, 0x07, 0x02, 0x84, 0x8B, 0x8E, 0x40, 0x8E, 0x8B, 0x85, 0x0A, 0x8D, 0x42,
+    0x88, 0x08, 0x89, 0x46, 0x8A, 0x08, 0x87, 0x42, 0x8E, 0x81, 0x07, 0x87, 0x48, 0x88, 0x06, 0x81,
+    0x43, 0x86, 0x08, 0x44, 0x8E, 0x44, 0x82, 0x05, 0x89, 0x42, 0x8D, 0x08, 0x85, 0x43, 0x88, 0x00,
+    0x86, 0x43, 0x88, 0x04, 0x82, 0x43, 0x85, 0x08, 0x88, 0x43, 0x81, 0x01, 0x8E, 0x42, 0x8C, 0x04,
+    0x8B, 0x42, 0x8C, 0x09, 0x8B, 0x43, 0x02, 0x8B, 0x42, 0x8E, 0x03, 0x83, 0x43, 0x83, 0x09, 0x8C,
+    0x42, 0x8D, 0x02, 0x8A, 0x43, 0x03, 0x8C, 0x42, 0x8A, 0x0A, 0x8D, 0x42, 0x8D, 0x02, 0x89, 0x43,
+    0x02, 0x85, 0x43, 0x81, 0x0A, 0x8C, 0x42, 0x8D, 0x02, 0x8A, 0x43, 0x02, 0x8E, 0x42, 0x88, 0x0B,
+    0x8B, 0x43, 0x02, 0x8B, 0x42, 0x8E, 0x01, 0x87, 0x42, 0x8E, 0x01, 0x84, 0x8B, 0x8E, 0x40, 0x8E,
+    0x8B, 0x85, 0x03, 0x88, 0x43, 0x81, 0x01, 0x8E, 0x42, 0x8C, 0x00, 0x81, 0x43, 0x86, 0x00, 0x89,
+    0x46, 0x8A, 0x02, 0x84, 0x43, 0x88, 0x00, 0x85, 0x43, 0x88, 0x00, 0x89, 0x42, 0x8D, 0x00, 0x87,
+    0x48, 0x88, 0x02, 0x8E, 0x43, 0x8E, 0x44, 0x92, 0x43, 0x84, 0x00, 0x4A, 0x82, 0x01, 0x85, 0x48,
+    0x89, 0x00, 0x8B, 0x42, 0x8B, 0x00, 0x85, 0x43, 0x89, 0x00, 0x86, 0x43, 0x88, 0x02, 0x87, 0x46,
+    0x8B, 0x00, 0x84, 0x43, 0x83, 0x00, 0x88, 0x43, 0x82, 0x01, 0x8E, 0x42, 0x8C, 0x03, 0x83, 0x8A,
+    0x8E, 0x40, 0x8E, 0x8B, 0x85, 0x01, 0x8C, 0x42, 0x8A, 0x01, 0x8B, 0x43, 0x02, 0x8B, 0x42, 0x8E,
+    0x0B, 0x86, 0x43, 0x81, 0x01, 0x8C, 0x42, 0x8D, 0x02, 0x8A, 0x43, 0x0B, 0x8E, 0x42, 0x88, 0x02,
+    0x8D, 0x42, 0x8D, 0x02, 0x89, 0x43, 0x0A, 0x87, 0x42, 0x8E, 0x03, 0x8C, 0x42, 0x8D, 0x02, 0x8A,
+    0x43, 0x09, 0x81, 0x43, 0x86, 0x03, 0x8B, 0x43, 0x02, 0x8B, 0x42, 0x8E, 0x09, 0x89, 0x42, 0x8D,
+    0x04, 0x88, 0x43, 0x81, 0x01, 0x8E, 0x42, 0x8C, 0x08, 0x82, 0x43, 0x84, 0x04, 0x84, 0x43, 0x88,
+    0x00, 0x85, 0x43, 0x88, 0x08, 0x8B, 0x42, 0x8B, 0x06, 0x8E, 0x43, 0x8D, 0x44, 0x82, 0x07, 0x84,
+    0x43, 0x82, 0x06, 0x85, 0x48, 0x89, 0x08, 0x8D, 0x42, 0x89, 0x08, 0x87, 0x46, 0x8B, 0x08, 0x86,
+    0x43, 0x81, 0x09, 0x83, 0x8A, 0x8E, 0x40, 0x8E, 0x8B, 0x85, 0x03, 0x05, 0x82, 0x88, 0x8C, 0x8E,
+    0x41, 0x8D, 0x8A, 0x85, 0x11, 0x89, 0x48, 0x8D, 0x83, 0x0E, 0x8B, 0x4B, 0x83, 0x0C, 0x87, 0x4C,
+    0x8D, 0x0C, 0x8D, 0x44, 0x89, 0x86, 0x88, 0x8E, 0x44, 0x82, 0x0A, 0x81, 0x44, 0x86, 0x02, 0x82,
+    0x44, 0x85, 0x0A, 0x82, 0x44, 0x81, 0x03, 0x8E, 0x43, 0x85, 0x0B, 0x44, 0x83, 0x02, 0x81, 0x44,
+    0x82, 0x0B, 0x8D, 0x43, 0x89, 0x02, 0x8B, 0x43, 0x8D, 0x0C, 0x87, 0x44, 0x83, 0x82, 0x8C, 0x44,
+    0x85, 0x0D, 0x8E, 0x43, 0x8E, 0x45, 0x8A, 0x0E, 0x84, 0x49, 0x8A, 0x10, 0x8C, 0x47, 0x86, 0x0F,
+    0x83, 0x8D, 0x47, 0x84, 0x05, 0x8A, 0x44, 0x83, 0x02, 0x85, 0x49, 0x8E, 0x83, 0x04, 0x44, 0x8E,
+    0x02, 0x83, 0x4C, 0x85, 0x02, 0x86, 0x44, 0x88, 0x02, 0x8C, 0x44, 0x8D, 0x82, 0x88, 0x45, 0x87,
+    0x01, 0x8D, 0x44, 0x81, 0x01, 0x82, 0x45, 0x81, 0x01, 0x86, 0x45, 0x88, 0x87, 0x44, 0x8A, 0x02,
+    0x86, 0x44, 0x89, 0x03, 0x84, 0x4B, 0x82, 0x02, 0x87, 0x44, 0x88, 0x04, 0x82, 0x8E, 0x48, 0x88,
+    0x03, 0x86, 0x44, 0x8D, 0x05, 0x81, 0x8D, 0x46, 0x8D, 0x04, 0x83, 0x45, 0x8B, 0x83, 0x03, 0x83,
+    0x89, 0x46, 0x82, 0x05, 0x8E, 0x46, 0x8E, 0x8C, 0x8D, 0x49, 0x8A, 0x05, 0x85, 0x54, 0x8B, 0x05,
+    0x86, 0x54, 0x8C, 0x81, 0x04, 0x83, 0x8D, 0x4A, 0x8D, 0x85, 0x82, 0x8E, 0x44, 0x8C, 0x81, 0x05,
+    0x83, 0x88, 0x8B, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x87, 0x82, 0x02, 0x82, 0x8E, 0x44, 0x8D, 0x81,
+    0x87, 0x43, 0x89, 0x86, 0x43, 0x88, 0x85, 0x43, 0x87, 0x84, 0x43, 0x85, 0x83, 0x43, 0x84, 0x81,
+    0x43, 0x83, 0x00, 0x43, 0x82, 0x00, 0x43, 0x81, 0x00, 0x8E, 0x42, 0x01, 0x8C, 0x41, 0x8E, 0x00,
+    0x04, 0x84, 0x43, 0x86, 0x03, 0x81, 0x8E, 0x42, 0x8B, 0x04, 0x8A, 0x43, 0x82, 0x03, 0x84, 0x43,
+    0x89, 0x04, 0x8C, 0x43, 0x81, 0x03, 0x84, 0x43, 0x8A, 0x04, 0x8A, 0x43, 0x84, 0x03, 0x81, 0x43,
+    0x8E, 0x04, 0x85, 0x43, 0x89, 0x04, 0x8A, 0x43, 0x85, 0x04, 0x8D, 0x43, 0x81, 0x04, 0x43, 0x8E,
+    0x04, 0x83, 0x43, 0x8B, 0x04, 0x85, 0x43, 0x8A, 0x04, 0x86, 0x43, 0x88, 0x04, 0x87, 0x43, 0x87,
+    0x04, 0x87, 0x43, 0x87, 0x04, 0x87, 0x43, 0x87, 0x04, 0x86, 0x43, 0x88, 0x04, 0x85, 0x43, 0x89,
+    0x04, 0x83, 0x43, 0x8B, 0x04, 0x81, 0x43, 0x8E, 0x05, 0x8E, 0x43, 0x81, 0x04, 0x8A, 0x43, 0x84,
+    0x04, 0x86, 0x43, 0x89, 0x04, 0x81, 0x43, 0x8D, 0x05, 0x8B, 0x43, 0x83, 0x04, 0x85, 0x43, 0x89,
+    0x05, 0x8D, 0x43, 0x81, 0x04, 0x85, 0x43, 0x88, 0x05, 0x8B, 0x43, 0x82, 0x04, 0x82, 0x8E, 0x42,
+    0x8B, 0x05, 0x84, 0x43, 0x85, 0x88, 0x43, 0x82, 0x05, 0x8D, 0x42, 0x8D, 0x05, 0x84, 0x43, 0x88,
+    0x05, 0x8B, 0x43, 0x82, 0x04, 0x83, 0x43, 0x8A, 0x05, 0x8C, 0x43, 0x82, 0x04, 0x86, 0x43, 0x88,
+    0x04, 0x81, 0x43, 0x8E, 0x05, 0x8B, 0x43, 0x83, 0x04, 0x87, 0x43, 0x87, 0x04, 0x83, 0x43, 0x8B,
+    0x05, 0x43, 0x8E, 0x05, 0x8E, 0x43, 0x81, 0x04, 0x8C, 0x43, 0x82, 0x04, 0x8A, 0x43, 0x84, 0x04,
+    0x89, 0x43, 0x85, 0x04, 0x89, 0x43, 0x85, 0x04, 0x89, 0x43, 0x85, 0x04, 0x8A, 0x43, 0x84, 0x04,
+    0x8B, 0x43, 0x83, 0x04, 0x8D, 0x43, 0x81, 0x04, 0x44, 0x04, 0x83, 0x43, 0x8C, 0x04, 0x86, 0x43,
+    0x88, 0x04, 0x8B, 0x43, 0x84, 0x04, 0x44, 0x04, 0x85, 0x43, 0x89, 0x04, 0x8C, 0x43, 0x83, 0x03,
+    0x83, 0x43, 0x8B, 0x04, 0x8A, 0x43, 0x83, 0x03, 0x83, 0x43, 0x89, 0x04, 0x8C, 0x42, 0x8D, 0x81,
+    0x03, 0x87, 0x43, 0x83, 0x04, 0x06, 0x43, 0x8B, 0x0D, 0x8E, 0x42, 0x89, 0x0D, 0x8D, 0x42, 0x87,
+    0x0D, 0x8B, 0x42, 0x86, 0x0D, 0x89, 0x42, 0x84, 0x06, 0x83, 0x8D, 0x88, 0x84, 0x02, 0x87, 0x42,
+    0x82, 0x01, 0x81, 0x85, 0x89, 0x8D, 0x00, 0x85, 0x43, 0x8B, 0x86, 0x87, 0x42, 0x84, 0x87, 0x8C,
+    0x43, 0x81, 0x88, 0x50, 0x83, 0x8A, 0x50, 0x86, 0x88, 0x8B, 0x8C, 0x8E, 0x4A, 0x8E, 0x8D, 0x8B,
+    0x85, 0x04, 0x81, 0x8D, 0x44, 0x89, 0x0A, 0x89, 0x46, 0x84, 0x08, 0x84, 0x43, 0x89, 0x42, 0x8E,
+    0x81, 0x06, 0x81, 0x8E, 0x42, 0x8A, 0x81, 0x43, 0x8B, 0x06, 0x8B, 0x43, 0x83, 0x00, 0x88, 0x43,
+    0x87, 0x04, 0x86, 0x43, 0x8C, 0x01, 0x81, 0x44, 0x82, 0x04, 0x85, 0x8D, 0x41, 0x85, 0x02, 0x89,
+    0x41, 0x8C, 0x83, 0x07, 0x86, 0x8C, 0x03, 0x82, 0x8D, 0x85, 0x17, 0x07, 0xB3, 0x0E, 0x83, 0x42,
+    0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42,
+    0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x07, 0x85, 0x51, 0x81, 0x85, 0x51, 0x81,
+    0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x00, 0xD1, 0x83, 0x42, 0x8E, 0xE1, 0x07, 0x83, 0x42, 0x8E,
+    0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E, 0x0E, 0x83, 0x42, 0x8E,
+    0x0E, 0x83, 0x42, 0x8E, 0x0F, 0xA3, 0x82, 0x07, 0x01, 0x44, 0x86, 0x00, 0x83, 0x44, 0x82, 0x00,
+    0x86, 0x43, 0x8D, 0x01, 0x89, 0x43, 0x88, 0x01, 0x8C, 0x43, 0x82, 0x01, 0x43, 0x8C, 0x01, 0x84,
+    0x43, 0x85, 0x01, 0x87, 0x42, 0x8E, 0x02, 0x8B, 0x42, 0x87, 0x02, 0x8E, 0x48, 0x81, 0x8E, 0x48,
+    0x81, 0x8E, 0x48, 0x81, 0x8E, 0x48, 0x81, 0x88, 0xFA, 0x8A, 0x00, 0x01, 0x82, 0x84, 0x82, 0x01,
+    0x81, 0x8C, 0x42, 0x8A, 0x00, 0x89, 0x44, 0x86, 0x8C, 0x44, 0x89, 0x8B, 0x44, 0x89, 0x86, 0x44,
+    0x83, 0x00, 0x87, 0x8D, 0x40, 0x8D, 0x85, 0x00, 0x09, 0x8D, 0x43, 0x85, 0x08, 0x82, 0x43, 0x8E,
+    0x09, 0x89, 0x43, 0x89, 0x09, 0x8E, 0x43, 0x83, 0x08, 0x85, 0x43, 0x8D, 0x09, 0x8B, 0x43, 0x87,
+    0x08, 0x81, 0x44, 0x81, 0x08, 0x86, 0x43, 0x8B, 0x09, 0x8C, 0x43, 0x85, 0x08, 0x82, 0x43, 0x8E,
+    0x09, 0x88, 0x43, 0x89, 0x09, 0x8E, 0x43, 0x83, 0x08, 0x84, 0x43, 0x8D, 0x09, 0x8A, 0x43, 0x87,
+    0x08, 0x81, 0x44, 0x81, 0x08, 0x86, 0x43, 0x8B, 0x09, 0x8C, 0x43, 0x85, 0x08, 0x82, 0x43, 0x8E,
+    0x09, 0x88, 0x43, 0x89, 0x09, 0x8E, 0x43, 0x83, 0x08, 0x84, 0x43, 0x8D, 0x09, 0x8A, 0x43, 0x87,
+    0x08, 0x81, 0x44, 0x81, 0x08, 0x86, 0x43, 0x8B, 0x09, 0x8C, 0x43, 0x85, 0x08, 0x82, 0x43, 0x8E,
+    0x09, 0x88, 0x43, 0x89, 0x09, 0x04, 0x81, 0x87, 0x8B, 0x8E, 0x40, 0x8E, 0x8D, 0x8A, 0x84, 0x09,
+    0x87, 0x48, 0x8C, 0x82, 0x06, 0x89, 0x4A, 0x8E, 0x82, 0x04, 0x86, 0x4C, 0x8E, 0x04, 0x8E, 0x44,
+    0x8E, 0x9B, 0x45, 0x88, 0x02, 0x86, 0x44, 0x8B, 0x02, 0x83, 0x8E, 0x44, 0x02, 0x8B, 0x44, 0x81,
+    0x03, 0x86, 0x44, 0x85, 0x01, 0x44, 0x8B, 0x05, 0x44, 0x8A, 0x00, 0x83, 0x44, 0x87, 0x05, 0x8C,
+    0x43, 0x8E, 0x00, 0x85, 0x44, 0x84, 0x05, 0x89, 0x44, 0x00, 0x87, 0x44, 0x83, 0x05, 0x88, 0x44,
+    0x82, 0x88, 0x44, 0x81, 0x05, 0x86, 0x44, 0x83, 0x89, 0x44, 0x81, 0x05, 0x86, 0x44, 0x84, 0x89,
+    0x44, 0x81, 0x05, 0x86, 0x44, 0x85, 0x89, 0x44, 0x81, 0x05, 0x86, 0x44, 0x84, 0x88, 0x44, 0x81,
+    0x05, 0x86, 0x44, 0x84, 0x87, 0x44, 0x82, 0x05, 0x88, 0x44, 0x83, 0x85, 0x44, 0x84, 0x05, 0x89,
+    0x44, 0x81, 0x82, 0x44, 0x86, 0x05, 0x8C, 0x43, 0x8E, 0x01, 0x44, 0x8A, 0x05, 0x44, 0x8B, 0x01,
+    0x8A, 0x44, 0x81, 0x03, 0x86, 0x44, 0x87, 0x01, 0x85, 0x44, 0x8B, 0x02, 0x82, 0x8E, 0x44, 0x82,
+    0x02, 0x8D, 0x44, 0x8E, 0x8A, 0x8B, 0x45, 0x8A, 0x03, 0x84, 0x4D, 0x82, 0x04, 0x87, 0x4B, 0x84,
+    0x06, 0x85, 0x8E, 0x47, 0x8D, 0x84, 0x08, 0x81, 0x86, 0x8B, 0x8D, 0x41, 0x8D, 0x8A, 0x85, 0x05,
+    0x07, 0x89, 0x43, 0x8B, 0x05, 0x81, 0x8C, 0x44, 0x8B, 0x04, 0x83, 0x8E, 0x45, 0x8B, 0x03, 0x86,
+    0x47, 0x8B, 0x02, 0x8A, 0x48, 0x8B, 0x00, 0x82, 0x8C, 0x49, 0x8B, 0x84, 0x8E, 0x44, 0x89, 0x8E,
+    0x43, 0x8B, 0x84, 0x44, 0x88, 0x00, 0x44, 0x8B, 0x00, 0x88, 0x42, 0x86, 0x01, 0x44, 0x8B, 0x01,
+    0x8B, 0x8E, 0x83, 0x02, 0x44, 0x8B, 0x02, 0x81, 0x03, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44,
+    0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B,
+    0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07,
+    0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x07, 0x44, 0x8B, 0x04, 0x84, 0x88, 0x8C, 0x8E,
+    0x41, 0x8D, 0x8B, 0x87, 0x81, 0x07, 0x85, 0x8D, 0x49, 0x88, 0x04, 0x81, 0x8B, 0x4C, 0x8B, 0x02,
+    0x82, 0x8E, 0x4E, 0x89, 0x01, 0x81, 0x8E, 0x45, 0x8E, 0x8D, 0x8E, 0x46, 0x82, 0x01, 0x83, 0x43,
+    0x8A, 0x83, 0x02, 0x83, 0x8D, 0x44, 0x87, 0x02, 0x85, 0x40, 0x8D, 0x83, 0x05, 0x84, 0x44, 0x8A,
+    0x03, 0x84, 0x08, 0x44, 0x8B, 0x0D, 0x44, 0x89, 0x0C, 0x83, 0x44, 0x86, 0x0C, 0x8A, 0x44, 0x81,
+    0x0B, 0x84, 0x44, 0x8A, 0x0B, 0x81, 0x8E, 0x44, 0x81, 0x0A, 0x81, 0x8D, 0x44, 0x85, 0x0A, 0x81,
+    0x8C, 0x44, 0x88, 0x0A, 0x81, 0x8C, 0x44, 0x89, 0x0A, 0x81, 0x8C, 0x44, 0x89, 0x0A, 0x81, 0x8C,
+    0x44, 0x88, 0x0A, 0x81, 0x8D, 0x44, 0x86, 0x0A, 0x81, 0x8D, 0x44, 0x85, 0x0A, 0x81, 0x8D, 0x44,
+    0x84, 0x0A, 0x81, 0x8D, 0x43, 0x8E, 0x83, 0x0A, 0x81, 0x8D, 0x45, 0xFD, 0xAD, 0x86, 0x87, 0x51,
+    0x97, 0x51, 0x97, 0x51, 0x97, 0x51, 0x87, 0x03, 0x84, 0x88, 0x8C, 0x8D, 0x41, 0x8E, 0x8D, 0x8B,
+    0x87, 0x81, 0x06, 0x88, 0x8E, 0x4A, 0x89, 0x81, 0x02, 0x83, 0x8E, 0x4D, 0x8D, 0x81, 0x01, 0x81,
+    0x8E, 0x4E, 0x8B, 0x02, 0x84, 0x44, 0x8C, 0x8A, 0x8B, 0x8D, 0x46, 0x82, 0x02, 0x89, 0x40, 0x8D,
+    0x86, 0x04, 0x83, 0x8E, 0x44, 0x85, 0x03, 0x86, 0x07, 0x87, 0x44, 0x86, 0x0C, 0x84, 0x44, 0x84,
+    0x0C, 0x85, 0x44, 0x81, 0x0C, 0x8D, 0x43, 0x88, 0x09, 0x81, 0x83, 0x87, 0x8D, 0x43, 0x8C, 0x06,
+    0x86, 0x49, 0x8A, 0x07, 0x86, 0x46, 0x8E, 0x89, 0x82, 0x08, 0x86, 0x47, 0x8D, 0x8A, 0x84, 0x07,
+    0x86, 0x4A, 0x8D, 0x82, 0x05, 0x82, 0xA6, 0x87, 0x89, 0x8C, 0x45, 0x8E, 0x82, 0x0B, 0x81, 0x8B,
+    0x44, 0x8A, 0x0C, 0x81, 0x45, 0x0D, 0x8D, 0x44, 0x82, 0x0C, 0x8E, 0x44, 0x82, 0x81, 0x0A, 0x83,
+    0x45, 0x81, 0x88, 0x8D, 0x87, 0x82, 0x06, 0x84, 0x8E, 0x44, 0x8C, 0x00, 0x88, 0x42, 0x8E, 0x8B,
+    0xA9, 0x8A, 0x8E, 0x46, 0x86, 0x00, 0x88, 0x4F, 0x8C, 0x01, 0x88, 0x4E, 0x8C, 0x02, 0x85, 0x8E,
+    0x4B, 0x8E, 0x86, 0x05, 0x83, 0x87, 0x8A, 0x8D, 0x8E, 0x42, 0x8E, 0x8B, 0x88, 0x84, 0x05, 0x0B,
+    0x8C, 0x43, 0x8D, 0x0E, 0x87, 0x44, 0x8D, 0x0D, 0x82, 0x45, 0x8D, 0x0D, 0x8D, 0x45, 0x8D, 0x0C,
+    0x88, 0x46, 0x8D, 0x0B, 0x83, 0x47, 0x8D, 0x0B, 0x8D, 0x42, 0x8E, 0x43, 0x8D, 0x0A, 0x88, 0x42,
+    0x8D, 0x89, 0x43, 0x8D, 0x09, 0x83, 0x43, 0x84, 0x8A, 0x43, 0x8D, 0x09, 0x8D, 0x42, 0x8A, 0x00,
+    0x8B, 0x43, 0x8D, 0x08, 0x89, 0x42, 0x8E, 0x81, 0x00, 0x8B, 0x43, 0x8D, 0x07, 0x84, 0x43, 0x85,
+    0x01, 0x8C, 0x43, 0x8D, 0x06, 0x81, 0x8E, 0x42, 0x8B, 0x02, 0x8C, 0x43, 0x8D, 0x06, 0x8A, 0x42,
+    0x8E, 0x81, 0x02, 0x8C, 0x43, 0x8D, 0x05, 0x85, 0x43, 0x85, 0x03, 0x8C, 0x43, 0x8D, 0x04, 0x81,
+    0x8E, 0x42, 0x8B, 0x04, 0x8C, 0x43, 0x8D, 0x04, 0x8A, 0x42, 0x8E, 0x81, 0x04, 0x8C, 0x43, 0x8D,
+    0x03, 0x84, 0x53, 0x81, 0x85, 0x53, 0x81, 0x85, 0x53, 0x81, 0x85, 0x53, 0x81, 0x82, 0xF7, 0xA7,
+    0x8D, 0x43, 0x8E, 0xA7, 0x0C, 0x8C, 0x43, 0x8D, 0x0F, 0x8C, 0x43, 0x8D, 0x0F, 0x8C, 0x43, 0x8D,
+    0x0F, 0x8C, 0x43, 0x8D, 0x0F, 0x8C, 0x43, 0x8D, 0x03, 0x01, 0x89, 0x4D, 0x82, 0x02, 0x8B, 0x4D,
+    0x82, 0x02, 0x8C, 0x4D, 0x82, 0x02, 0x8D, 0x4D, 0x82, 0x02, 0x8E, 0x43, 0x8E, 0xFD, 0x8D, 0x81,
+    0x02, 0x44, 0x86, 0x0C, 0x44, 0x84, 0x0B, 0x82, 0x44, 0x83, 0x0B, 0x83, 0x44, 0x81, 0x0B, 0x84,
+    0x44, 0x0C, 0x85, 0x44, 0x8B, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x83, 0x04, 0x86, 0x4C, 0x8B, 0x81,
+    0x02, 0x88, 0x4D, 0x8E, 0x81, 0x01, 0x89, 0x4E, 0x8C, 0x01, 0x81, 0x89, 0x41, 0x8D, 0x8C, 0x9A,
+    0x8C, 0x47, 0x84, 0x02, 0x81, 0x06, 0x86, 0x45, 0x8A, 0x0B, 0x84, 0x44, 0x8D, 0x0C, 0x8E, 0x44,
+    0x0C, 0x8C, 0x43, 0x8E, 0x0C, 0x8E, 0x43, 0x8D, 0x0B, 0x85, 0x44, 0x8A, 0x82, 0x40, 0x89, 0x84,
+    0x06, 0x86, 0x45, 0x85, 0x82, 0x43, 0x8E, 0x8B, 0x9A, 0x8C, 0x46, 0x8D, 0x00, 0x82, 0x4F, 0x84,
+    0x00, 0x82, 0x4E, 0x85, 0x01, 0x81, 0x8D, 0x4B, 0x8B, 0x82, 0x04, 0x83, 0x87, 0x8B, 0x8D, 0x8E,
+    0x41, 0x8E, 0x8D, 0x8A, 0x87, 0x82, 0x04, 0x07, 0x82, 0x86, 0x8A, 0x8D, 0x8E, 0x42, 0x8E, 0x87,
+    0x07, 0x84, 0x8C, 0x48, 0x89, 0x06, 0x8A, 0x4A, 0x89, 0x04, 0x81, 0x8C, 0x4B, 0x89, 0x04, 0x8B,
+    0x46, 0x8C, 0x89, 0xA8, 0x8A, 0x87, 0x03, 0x86, 0x45, 0x86, 0x0B, 0x8E, 0x43, 0x8D, 0x82, 0x0B,
+    0x85, 0x44, 0x83, 0x0C, 0x8B, 0x43, 0x88, 0x0D, 0x44, 0x82, 0x0C, 0x82, 0x43, 0x8E, 0x01, 0x84,
+    0x8A, 0x8D, 0x41, 0x8D, 0x89, 0x83, 0x03, 0x86, 0x43, 0x8C, 0x00, 0x8A, 0x47, 0x89, 0x02, 0x87,
+    0x43, 0x9A, 0x49, 0x8A, 0x01, 0x88, 0x50, 0x86, 0x00, 0x89, 0x46, 0x8B, 0x87, 0x86, 0x88, 0x8E,
+    0x44, 0x8D, 0x00, 0x8A, 0x45, 0x84, 0x03, 0x81, 0x8E, 0x44, 0x82, 0x89, 0x44, 0x85, 0x05, 0x86,
+    0x44, 0x85, 0x88, 0x44, 0x81, 0x05, 0x82, 0x44, 0x87, 0x86, 0x44, 0x81, 0x05, 0x81, 0x44, 0x87,
+    0x83, 0x44, 0x85, 0x05, 0x83, 0x44, 0x85, 0x00, 0x8E, 0x43, 0x8C, 0x05, 0x89, 0x44, 0x83, 0x00,
+    0x88, 0x44, 0x8A, 0x03, 0x84, 0x44, 0x8E, 0x01, 0x81, 0x45, 0x8E, 0x8A, 0x89, 0x8C, 0x45, 0x88,
+    0x02, 0x85, 0x4D, 0x8D, 0x04, 0x87, 0x4B, 0x8E, 0x82, 0x05, 0x84, 0x8E, 0x48, 0x8B, 0x81, 0x08,
+    0x85, 0x8A, 0x8D, 0x41, 0x8E, 0x8C, 0x88, 0x83, 0x04, 0x52, 0x87, 0x52, 0x87, 0x52, 0x87, 0x52,
+    0x87, 0xFD, 0xCD, 0x8E, 0x44, 0x81, 0x0C, 0x8E, 0x43, 0x8A, 0x0C, 0x85, 0x44, 0x83, 0x0C, 0x8D,
+    0x43, 0x8C, 0x0C, 0x84, 0x44, 0x85, 0x0C, 0x8B, 0x43, 0x8E, 0x0C, 0x83, 0x44, 0x87, 0x0C, 0x8A,
+    0x44, 0x81, 0x0B, 0x82, 0x44, 0x89, 0x0C, 0x89, 0x44, 0x82, 0x0B, 0x81, 0x44, 0x8B, 0x0C, 0x88,
+    0x44, 0x84, 0x0C, 0x8E, 0x43, 0x8D, 0x0C, 0x86, 0x44, 0x86, 0x0C, 0x8D, 0x43, 0x8E, 0x0C, 0x85,
+    0x44, 0x88, 0x0C, 0x8C, 0x44, 0x81, 0x0B, 0x84, 0x44, 0x8A, 0x0C, 0x8B, 0x44, 0x83, 0x0B, 0x82,
+    0x44, 0x8C, 0x0C, 0x8A, 0x44, 0x85, 0x0B, 0x81, 0x44, 0x8D, 0x0C, 0x88, 0x44, 0x87, 0x09, 0x04,
+    0x83, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8B, 0x88, 0x82, 0x07, 0x82, 0x8C, 0x49, 0x8A, 0x81, 0x04,
+    0x84, 0x4C, 0x8D, 0x81, 0x02, 0x81, 0x8E, 0x4D, 0x8B, 0x02, 0x87, 0x44, 0x8D, 0x86, 0x83, 0x84,
+    0x88, 0x45, 0x83, 0x01, 0x8B, 0x43, 0x8E, 0x81, 0x03, 0x84, 0x44, 0x86, 0x01, 0x8C, 0x43, 0x8A,
+    0x05, 0x8E, 0x43, 0x88, 0x01, 0x8B, 0x43, 0x8B, 0x05, 0x44, 0x86, 0x01, 0x87, 0x44, 0x82, 0x03,
+    0x86, 0x44, 0x82, 0x01, 0x81, 0x44, 0x8E, 0x84, 0x01, 0x87, 0x44, 0x8A, 0x03, 0x86, 0x45, 0x8C,
+    0x8D, 0x44, 0x8D, 0x81, 0x04, 0x87, 0x4A, 0x8B, 0x81, 0x06, 0x84, 0x8E, 0x47, 0x86, 0x08, 0x87,
+    0x8E, 0x47, 0x8B, 0x82, 0x05, 0x81, 0x8C, 0x4B, 0x85, 0x03, 0x81, 0x8D, 0x44, 0x8E, 0x87, 0x8C,
+    0x45, 0x87, 0x02, 0x8B, 0x44, 0x88, 0x02, 0x86, 0x45, 0x84, 0x00, 0x82, 0x44, 0x87, 0x04, 0x82,
+    0x8E, 0x43, 0x8D, 0x00, 0x87, 0x43, 0x8E, 0x06, 0x84, 0x44, 0x83, 0x89, 0x43, 0x8A, 0x07, 0x44,
+    0x85, 0x89, 0x43, 0x8C, 0x06, 0x81, 0x44, 0x84, 0x87, 0x44, 0x85, 0x05, 0x8A, 0x44, 0x82, 0x83,
+    0x45, 0x8B, 0x85, 0x94, 0x86, 0x8C, 0x44, 0x8C, 0x01, 0x8A, 0x4F, 0x83, 0x01, 0x81, 0x8C, 0x4D,
+    0x85, 0x04, 0x88, 0x4A, 0x8C, 0x83, 0x06, 0x81, 0x86, 0x8A, 0x8D, 0x8E, 0x41, 0x8E, 0x8C, 0x88,
+    0x83, 0x04, 0x04, 0x85, 0x89, 0x8D, 0x8E, 0x40, 0x8E, 0x8C, 0x89, 0x83, 0x08, 0x84, 0x8D, 0x48,
+    0x8B, 0x81, 0x05, 0x86, 0x4B, 0x8E, 0x83, 0x03, 0x83, 0x4D, 0x8E, 0x81, 0x02, 0x8C, 0x45, 0x8B,
+    0x8A, 0x8B, 0x45, 0x8B, 0x01, 0x83, 0x44, 0x8E, 0x82, 0x02, 0x82, 0x8D, 0x44, 0x83, 0x00, 0x88,
+    0x44, 0x84, 0x04, 0x82, 0x44, 0x89, 0x00, 0x8A, 0x44, 0x06, 0x8A, 0x43, 0x8E, 0x00, 0x8C, 0x43,
+    0x8D, 0x06, 0x86, 0x44, 0x81, 0x8B, 0x43, 0x8D, 0x06, 0x85, 0x44, 0x84, 0x8A, 0x44, 0x81, 0x05,
+    0x8A, 0x44, 0x85, 0x87, 0x44, 0x8A, 0x04, 0x88, 0x45, 0x85, 0x82, 0x45, 0x8C, 0x87, 0x86, 0x88,
+    0x8D, 0x46, 0x85, 0x00, 0x8B, 0x50, 0x84, 0x00, 0x81, 0x8E, 0x49, 0x86, 0x44, 0x83, 0x01, 0x82,
+    0x8D, 0x47, 0x87, 0x81, 0x44, 0x81, 0x03, 0x85, 0x8B, 0x8E, 0x41, 0x8D, 0x89, 0x83, 0x00, 0x83,
+    0x43, 0x8E, 0x0D, 0x88, 0x43, 0x8B, 0x0D, 0x8D, 0x43, 0x87, 0x0C, 0x87, 0x44, 0x81, 0x0B, 0x85,
+    0x44, 0x8A, 0x0A, 0x81, 0x89, 0x45, 0x82, 0x03, 0x8A, 0x89, 0x88, 0x87, 0x88, 0x89, 0x8C, 0x46,
+    0x87, 0x04, 0x8E, 0x4B, 0x89, 0x05, 0x8E, 0x4A, 0x87, 0x06, 0x8E, 0x48, 0x8A, 0x82, 0x07, 0x8B,
+    0x8E, 0x42, 0x8D, 0x8C, 0x8A, 0x85, 0x81, 0x07, 0x00, 0x87, 0x8D, 0x40, 0x8D, 0x85, 0x00, 0x86,
+    0x44, 0x84, 0x8B, 0x44, 0x89, 0x8C, 0x44, 0x89, 0x88, 0x44, 0x86, 0x81, 0x8C, 0x42, 0x8A, 0x02,
+    0x82, 0x84, 0x82, 0x34, 0x82, 0x84, 0x82, 0x01, 0x81, 0x8C, 0x42, 0x8A, 0x00, 0x89, 0x44, 0x86,
+    0x8C, 0x44, 0x89, 0x8B, 0x44, 0x89, 0x86, 0x44, 0x83, 0x00, 0x87, 0x8D, 0x40, 0x8D, 0x85, 0x00,
+    0x01, 0x87, 0x8D, 0x40, 0x8D, 0x85, 0x01, 0x86, 0x44, 0x84, 0x00, 0x8B, 0x44, 0x89, 0x00, 0x8C,
+    0x44, 0x89, 0x00, 0x88, 0x44, 0x86, 0x00, 0x81, 0x8C, 0x42, 0x8A, 0x03, 0x82, 0x84, 0x82, 0x3F,
+    0x13, 0x44, 0x86, 0x00, 0x83, 0x44, 0x82, 0x00, 0x86, 0x43, 0x8D, 0x01, 0x89, 0x43, 0x88, 0x01,
+    0x8C, 0x43, 0x82, 0x01, 0x43, 0x8C, 0x01, 0x84, 0x43, 0x85, 0x01, 0x87, 0x42, 0x8E, 0x02, 0x8B,
+    0x42, 0x87, 0x02, 0x10, 0x81, 0x88, 0x0F, 0x81, 0x88, 0x41, 0x81, 0x0C, 0x81, 0x88, 0x43, 0x81,
+    0x0A, 0x81, 0x88, 0x45, 0x81, 0x08, 0x81, 0x88, 0x46, 0x8D, 0x07, 0x81, 0x88, 0x46, 0x8C, 0x85,
+    0x06, 0x81, 0x88, 0x46, 0x8B, 0x84, 0x06, 0x81, 0x88, 0x46, 0x8A, 0x83, 0x06, 0x81, 0x88, 0x46,
+    0x89, 0x82, 0x07, 0x84, 0x45, 0x8E, 0x88, 0x81, 0x09, 0x85, 0x44, 0x8D, 0x81, 0x0B, 0x85, 0x46,
+    0x89, 0x83, 0x0A, 0x86, 0x8D, 0x46, 0x8C, 0x86, 0x0A, 0x84, 0x8B, 0x46, 0x8E, 0x89, 0x82, 0x09,
+    0x82, 0x89, 0x47, 0x8B, 0x85, 0x09, 0x81, 0x87, 0x8E, 0x46, 0x8E, 0x88, 0x0A, 0x86, 0x8D, 0x46,
+    0x81, 0x0B, 0x84, 0x8B, 0x44, 0x81, 0x0D, 0x82, 0x89, 0x42, 0x81, 0x0F, 0x81, 0x87, 0x8E, 0x81,
+    0x13, 0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x00, 0xF1, 0xF1,
+    0x91, 0x15, 0xF1, 0xF1, 0x91, 0x00, 0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x85, 0x51, 0x81, 0x85,
+    0x51, 0x81, 0x84, 0x86, 0x11, 0x85, 0x40, 0x8E, 0x86, 0x0F, 0x85, 0x42, 0x8E, 0x86, 0x0D, 0x85,
+    0x44, 0x8E, 0x86, 0x0B, 0x84, 0x46, 0x8E, 0x86, 0x0A, 0x81, 0x87, 0x8E, 0x45, 0x8E, 0x86, 0x0B,
+    0x86, 0x8D, 0x45, 0x8E, 0x86, 0x0B, 0x85, 0x8C, 0x45, 0x8E, 0x86, 0x0B, 0x84, 0x8B, 0x45, 0x8E,
+    0x86, 0x0B, 0x83, 0x8A, 0x45, 0x8E, 0x0C, 0x84, 0x45, 0x81, 0x09, 0x85, 0x8B, 0x46, 0x81, 0x06,
+    0x81, 0x88, 0x8E, 0x46, 0x8B, 0x84, 0x05, 0x84, 0x8B, 0x47, 0x89, 0x82, 0x04, 0x81, 0x87, 0x8D,
+    0x46, 0x8E, 0x87, 0x81, 0x04, 0x82, 0x8A, 0x47, 0x8C, 0x85, 0x07, 0x85, 0x46, 0x8B, 0x84, 0x09,
+    0x85, 0x44, 0x89, 0x82, 0x0B, 0x85, 0x41, 0x8E, 0x87, 0x0E, 0x85, 0x8C, 0x85, 0x24, 0x02, 0x82,
+    0x86, 0x8A, 0x8D, 0x8E, 0x41, 0x8E, 0x8B, 0x87, 0x82, 0x04, 0x85, 0x8C, 0x4A, 0x89, 0x02, 0x8A,
+    0x4D, 0x8C, 0x01, 0x84, 0x4E, 0x88, 0x01, 0x8C, 0x43, 0x8C, 0x8A, 0x89, 0x8A, 0x8E, 0x44, 0x8E,
+    0x01, 0x84, 0x40, 0x8B, 0x85, 0x05, 0x8A, 0x44, 0x82, 0x01, 0x82, 0x07, 0x83, 0x44, 0x82, 0x0A,
+    0x84, 0x44, 0x0B, 0x8C, 0x43, 0x8B, 0x09, 0x81, 0x8C, 0x44, 0x83, 0x08, 0x85, 0x8E, 0x44, 0x85,
+    0x08, 0x8A, 0x44, 0x8E, 0x83, 0x08, 0x8B, 0x44, 0x8A, 0x81, 0x08, 0x85, 0x44, 0x86, 0x0A, 0x8B,
+    0x43, 0x87, 0x0B, 0x8D, 0x43, 0x81, 0x0B, 0x8E, 0x43, 0x3F, 0x03, 0x81, 0x84, 0x83, 0x0D, 0x88,
+    0x42, 0x8D, 0x82, 0x0A, 0x83, 0x44, 0x8B, 0x0A, 0x86, 0x45, 0x0A, 0x85, 0x44, 0x8E, 0x0A, 0x81,
+    0x44, 0x89, 0x0B, 0x83, 0x8C, 0x40, 0x8E, 0x89, 0x07, 0x0A, 0x81, 0x86, 0x8A, 0x8C, 0x8E, 0x41,
+    0x8E, 0x8D, 0x8A, 0x87, 0x82, 0x11, 0x84, 0x8C, 0x4B, 0x8C, 0x85, 0x0D, 0x82, 0x8C, 0x4F, 0x8B,
+    0x81, 0x0A, 0x86, 0x46, 0x8C, 0x89, 0x98, 0x89, 0x8B, 0x45, 0x8E, 0x83, 0x08, 0x88, 0x44, 0x8A,
+    0x84, 0x07, 0x85, 0x8C, 0x43, 0x8E, 0x82, 0x06, 0x86, 0x43, 0x8C, 0x83, 0x0B, 0x87, 0x43, 0x8D,
+    0x05, 0x83, 0x43, 0x8A, 0x0E, 0x85, 0x43, 0x87, 0x04, 0x8D, 0x42, 0x8C, 0x03, 0x81, 0x87, 0x8B,
+    0x8E, 0x41, 0x8E, 0x8C, 0x8A, 0x87, 0x84, 0x01, 0x88, 0x42, 0x8E, 0x03, 0x85, 0x43, 0x81, 0x02,
+    0x87, 0x4A, 0x88, 0x01, 0x8E, 0x42, 0x85, 0x02, 0x8D, 0x42, 0x87, 0x02, 0x8A, 0x4B, 0x87, 0x01,
+    0x88, 0x42, 0x8A, 0x01, 0x83, 0x43, 0x02, 0x88, 0x44, 0x89, 0x96, 0x88, 0x8E, 0x42, 0x86, 0x01,
+    0x83, 0x42, 0x8E, 0x01, 0x88, 0x42, 0x8A, 0x01, 0x82, 0x43, 0x8C, 0x81, 0x03, 0x8D, 0x42, 0x86,
+    0x02, 0x43, 0x81, 0x00, 0x8B, 0x42, 0x86, 0x01, 0x89, 0x42, 0x8E, 0x81, 0x04, 0x8E, 0x42, 0x85,
+    0x02, 0x8E, 0x42, 0x82, 0x00, 0x8E, 0x42, 0x83, 0x01, 0x8D, 0x42, 0x88, 0x05, 0x43, 0x84, 0x02,
+    0x8E, 0x42, 0x82, 0x00, 0x43, 0x81, 0x01, 0x43, 0x84, 0x05, 0x43, 0x83, 0x02, 0x8E, 0x42, 0x91,
+    0x43, 0x01, 0x81, 0x43, 0x83, 0x04, 0x81, 0x43, 0x83, 0x02, 0x43, 0x00, 0x81, 0x43, 0x02, 0x43,
+    0x84, 0x04, 0x84, 0x43, 0x82, 0x01, 0x82, 0x42, 0x8D, 0x01, 0x43, 0x81, 0x01, 0x8E, 0x42, 0x87,
+    0x04, 0x89, 0x43, 0x82, 0x01, 0x87, 0x42, 0x88, 0x01, 0x8E, 0x42, 0x83, 0x01, 0x8A, 0x42, 0x8E,
+    0x81, 0x02, 0x83, 0x44, 0x85, 0x01, 0x8D, 0x42, 0x83, 0x01, 0x8C, 0x42, 0x87, 0x01, 0x84, 0x43,
+    0x8E, 0x88, 0x86, 0x89, 0x45, 0x8D, 0x87, 0x8C, 0x42, 0x8B, 0x02, 0x88, 0x42, 0x8B, 0x02, 0x8A,
+    0x49, 0x8D, 0x46, 0x8E, 0x82, 0x02, 0x83, 0x43, 0x82, 0x02, 0x8A, 0x46, 0x8E, 0x83, 0x81, 0x8E,
+    0x44, 0x8E, 0x83, 0x04, 0x8D, 0x42, 0x8B, 0x03, 0x83, 0x8A, 0x8D, 0x41, 0x8C, 0x87, 0x02, 0x81,
+    0x89, 0x8E, 0x40, 0x8D, 0x89, 0x81, 0x05, 0x85, 0x43, 0x88, 0x1A, 0x8B, 0x43, 0x8A, 0x0E, 0x81,
+    0x0A, 0x8D, 0x43, 0x8E, 0x87, 0x81, 0x07, 0x81, 0x85, 0x89, 0x8E, 0x8A, 0x0A, 0x81, 0x8C, 0x45,
+    0x8E, 0x8B, 0x8A, 0x99, 0x8A, 0x8C, 0x8E, 0x43, 0x8A, 0x0C, 0x89, 0x50, 0x8A, 0x0D, 0x82, 0x89,
+    0x4D, 0x8B, 0x84, 0x0F, 0x81, 0x84, 0x88, 0x8C, 0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8B, 0x88, 0x85,
+    0x81, 0x08, 0x08, 0x89, 0x45, 0x8C, 0x12, 0x8E, 0x46, 0x82, 0x10, 0x84, 0x47, 0x87, 0x10, 0x8A,
+    0x47, 0x8D, 0x10, 0x44, 0x8D, 0x43, 0x83, 0x0E, 0x86, 0x43, 0x8C, 0x88, 0x43, 0x89, 0x0E, 0x8B,
+    0x43, 0x87, 0x84, 0x43, 0x8E, 0x0D, 0x81, 0x44, 0x83, 0x00, 0x8E, 0x43, 0x84, 0x0C, 0x87, 0x43,
+    0x8E, 0x01, 0x8A, 0x43, 0x8A, 0x0C, 0x8C, 0x43, 0x89, 0x01, 0x85, 0x44, 0x0B, 0x82, 0x44, 0x84,
+    0x02, 0x44, 0x85, 0x0A, 0x88, 0x44, 0x03, 0x8B, 0x43, 0x8B, 0x0A, 0x8D, 0x43, 0x8A, 0x03, 0x86,
+    0x44, 0x81, 0x08, 0x83, 0x44, 0x86, 0x03, 0x81, 0x44, 0x86, 0x08, 0x89, 0x44, 0x81, 0x04, 0x8C,
+    0x43, 0x8C, 0x08, 0x8E, 0x43, 0x8C, 0x05, 0x87, 0x44, 0x82, 0x06, 0x84, 0x51, 0x87, 0x06, 0x8A,
+    0x51, 0x8D, 0x06, 0x53, 0x83, 0x04, 0x85, 0x53, 0x88, 0x04, 0x8B, 0x44, 0xFD, 0x9D, 0x44, 0x8E,
+    0x03, 0x81, 0x44, 0x8E, 0x09, 0x8B, 0x44, 0x84, 0x02, 0x86, 0x44, 0x8A, 0x09, 0x86, 0x44, 0x89,
+    0x02, 0x8C, 0x44, 0x85, 0x09, 0x81, 0x45, 0x01, 0x81, 0x45, 0x0B, 0x8C, 0x44, 0x85, 0x00, 0x87,
+    0x44, 0x8A, 0x0B, 0x87, 0x44, 0x8A, 0x00, 0x8D, 0x44, 0x85, 0x0B, 0x82, 0x45, 0x81, 0x89, 0x48,
+    0x9E, 0x8C, 0x8A, 0x86, 0x81, 0x04, 0x89, 0x4E, 0x8A, 0x82, 0x02, 0x89, 0x50, 0x83, 0x01, 0x89,
+    0x50, 0x8E, 0x01, 0x89, 0x44, 0x8C, 0xAB, 0x8C, 0x47, 0x86, 0x00, 0x89, 0x44, 0x82, 0x04, 0x84,
+    0x8E, 0x44, 0x8B, 0x00, 0x89, 0x44, 0x82, 0x05, 0x85, 0x44, 0x8C, 0x00, 0x89, 0x44, 0x82, 0x05,
+    0x81, 0x44, 0x8C, 0x00, 0x89, 0x44, 0x82, 0x05, 0x82, 0x44, 0x8B, 0x00, 0x89, 0x44, 0x82, 0x05,
+    0x87, 0x44, 0x87, 0x00, 0x89, 0x44, 0x82, 0x03, 0x83, 0x88, 0x45, 0x81, 0x00, 0x89, 0x50, 0x85,
+    0x01, 0x89, 0x4E, 0x8B, 0x83, 0x02, 0x89, 0x4D, 0x8E, 0x89, 0x83, 0x02, 0x89, 0x50, 0x89, 0x01,
+    0x89, 0x44, 0x8A, 0xB9, 0x8B, 0x46, 0x88, 0x00, 0x89, 0x44, 0x82, 0x05, 0x88, 0x45, 0x81, 0x89,
+    0x44, 0x82, 0x06, 0x8B, 0x44, 0x85, 0x89, 0x44, 0x82, 0x06, 0x87, 0x44, 0x87, 0x89, 0x44, 0x82,
+    0x06, 0x88, 0x44, 0x88, 0x89, 0x44, 0x82, 0x06, 0x8D, 0x44, 0x86, 0x89, 0x44, 0x82, 0x04, 0x82,
+    0x8B, 0x45, 0x83, 0x89, 0x44, 0xCC, 0x8E, 0x46, 0x8D, 0x00, 0x89, 0x51, 0x84, 0x00, 0x89, 0x50,
+    0x85, 0x01, 0x89, 0x4E, 0x8C, 0x83, 0x02, 0x89, 0x4A, 0x8E, 0x8B, 0x88, 0x83, 0x04, 0x07, 0x85,
+    0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x85, 0x08, 0x88, 0x4B, 0x8A, 0x83, 0x03, 0x83, 0x8D,
+    0x4D, 0x8A, 0x02, 0x84, 0x4F, 0x83, 0x01, 0x82, 0x8E, 0x46, 0x8E, 0x9D, 0x44, 0x8D, 0x02, 0x8B,
+    0x45, 0x8B, 0x83, 0x03, 0x83, 0x88, 0x8E, 0x40, 0x87, 0x01, 0x84, 0x45, 0x87, 0x08, 0x85, 0x81,
+    0x01, 0x8B, 0x44, 0x8A, 0x0C, 0x81, 0x45, 0x81, 0x0C, 0x85, 0x44, 0x8B, 0x0D, 0x88, 0x44, 0x87,
+    0x0D, 0x8A, 0x44, 0x84, 0x0D, 0x8C, 0x44, 0x82, 0x0D, 0x8C, 0x44, 0x82, 0x0D, 0x8B, 0x44, 0x82,
+    0x0D, 0x8A, 0x44, 0x83, 0x0D, 0x89, 0x44, 0x86, 0x0D, 0x86, 0x44, 0x89, 0x0D, 0x83, 0x44, 0x8E,
+    0x0E, 0x8E, 0x44, 0x87, 0x0D, 0x88, 0x45, 0x84, 0x09, 0x81, 0x01, 0x81, 0x46, 0x89, 0x82, 0x04,
+    0x83, 0x87, 0x8C, 0x8D, 0x02, 0x86, 0x47, 0x8E, 0x8D, 0x8C, 0x8E, 0x43, 0x8D, 0x03, 0x8A, 0x4E,
+    0x8D, 0x04, 0x88, 0x4D, 0x8D, 0x05, 0x84, 0x8C, 0x4B, 0x8A, 0x07, 0x83, 0x87, 0x8B, 0x8D, 0x8E,
+    0x41, 0x8E, 0x8C, 0x89, 0x85, 0x81, 0x01, 0x89, 0x48, 0x8E, 0x8D, 0x8A, 0x87, 0x83, 0x07, 0x89,
+    0x4D, 0x8D, 0x85, 0x05, 0x89, 0x4F, 0x8C, 0x82, 0x03, 0x89, 0x50, 0x8E, 0x84, 0x02, 0x89, 0x44,
+    0x8C, 0xAB, 0x8D, 0x47, 0x8E, 0x82, 0x01, 0x89, 0x44, 0x82, 0x04, 0x84, 0x8B, 0x45, 0x8D, 0x01,
+    0x89, 0x44, 0x82, 0x06, 0x86, 0x45, 0x86, 0x00, 0x89, 0x44, 0x82, 0x07, 0x88, 0x44, 0x8E, 0x00,
+    0x89, 0x44, 0x82, 0x08, 0x8E, 0x44, 0x83, 0x89, 0x44, 0x82, 0x08, 0x89, 0x44, 0x87, 0x89, 0x44,
+    0x82, 0x08, 0x85, 0x44, 0x8B, 0x89, 0x44, 0x82, 0x08, 0x82, 0x44, 0x8C, 0x89, 0x44, 0x82, 0x08,
+    0x81, 0x44, 0x8D, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8E, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44,
+    0x8D, 0x89, 0x44, 0x82, 0x08, 0x83, 0x44, 0x8B, 0x89, 0x44, 0x82, 0x08, 0x86, 0x44, 0x8A, 0x89,
+    0x44, 0x82, 0x08, 0x8A, 0x44, 0x86, 0x89, 0x44, 0x82, 0x07, 0x81, 0x45, 0x82, 0x89, 0x44, 0x82,
+    0x07, 0x8B, 0x44, 0x8C, 0x00, 0x89, 0x44, 0x82, 0x06, 0x8A, 0x45, 0x84, 0x00, 0x89, 0x44, 0x82,
+    0x03, 0x81, 0x86, 0x8D, 0x45, 0x8B, 0x01, 0x89, 0x44, 0xBC, 0x8E, 0x47, 0x8D, 0x81, 0x01, 0x89,
+    0x50, 0x8D, 0x82, 0x02, 0x89, 0x4F, 0x8A, 0x04, 0x89, 0x4D, 0x8A, 0x83, 0x05, 0x89, 0x47, 0x8E,
+    0x8D, 0x8C, 0x88, 0x85, 0x81, 0x07, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89,
+    0x4E, 0x00, 0x89, 0x44, 0x8C, 0xFB, 0x8B, 0x00, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09,
+    0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09,
+    0x89, 0x4D, 0x85, 0x00, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x4D, 0x85, 0x00,
+    0x89, 0x44, 0x8C, 0xFB, 0x83, 0x00, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44,
+    0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44,
+    0xFC, 0x9C, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89,
+    0x4E, 0x89, 0x4E, 0x89, 0x4E, 0x89, 0x4E, 0x89, 0x44, 0xFB, 0x9B, 0x89, 0x44, 0x81, 0x08, 0x89,
+    0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08, 0x89,
+    0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08, 0x89, 0x4D, 0x84, 0x89, 0x4D, 0x84, 0x89, 0x4D, 0x84,
+    0x89, 0x4D, 0x84, 0x89, 0x44, 0xFB, 0x8B, 0x83, 0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08,
+    0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08,
+    0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08, 0x89, 0x44, 0x81, 0x08,
+    0x07, 0x81, 0x85, 0x89, 0x8C, 0x8D, 0x42, 0x8E, 0x8B, 0x89, 0x85, 0x81, 0x07, 0x83, 0x8A, 0x4C,
+    0x8A, 0x82, 0x04, 0x89, 0x4F, 0x81, 0x02, 0x81, 0x8D, 0x4F, 0x8A, 0x03, 0x8C, 0x48, 0x8D, 0x8C,
+    0x8D, 0x44, 0x84, 0x02, 0x8A, 0x46, 0x8A, 0x83, 0x04, 0x82, 0x87, 0x9D, 0x02, 0x83, 0x45, 0x8E,
+    0x83, 0x09, 0x81, 0x02, 0x8B, 0x45, 0x82, 0x0E, 0x45, 0x86, 0x0E, 0x84, 0x44, 0x8E, 0x0F, 0x88,
+    0x44, 0x88, 0x0F, 0x8A, 0x44, 0x85, 0x0F, 0x8B, 0x44, 0x83, 0x03, 0x84, 0x49, 0x87, 0x8C, 0x44,
+    0x82, 0x03, 0x84, 0x49, 0x87, 0x8B, 0x44, 0x82, 0x03, 0x84, 0x49, 0x87, 0x8A, 0x44, 0x83, 0x03,
+    0x84, 0x49, 0x87, 0x89, 0x44, 0x86, 0x03, 0x83, 0xCC, 0x44, 0x87, 0x86, 0x44, 0x8A, 0x08, 0x82,
+    0x44, 0x87, 0x82, 0x45, 0x81, 0x07, 0x82, 0x44, 0x87, 0x00, 0x8D, 0x44, 0x89, 0x07, 0x82, 0x44,
+    0x87, 0x00, 0x87, 0x45, 0x87, 0x06, 0x82, 0x44, 0x87, 0x00, 0x81, 0x8E, 0x45, 0x8B, 0x83, 0x04,
+    0x83, 0x44, 0x87, 0x01, 0x84, 0x48, 0x8D, 0x8C, 0x8D, 0x46, 0x87, 0x02, 0x88, 0x51, 0x87, 0x03,
+    0x86, 0x50, 0x87, 0x04, 0x82, 0x8A, 0x4D, 0x8B, 0x83, 0x06, 0x82, 0x86, 0x8A, 0x8D, 0x8E, 0x42,
+    0x8E, 0x8C, 0x8A, 0x87, 0x84, 0x02, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82,
+    0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81,
+    0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A,
+    0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44,
+    0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08,
+    0x81, 0x44, 0x8A, 0x89, 0x54, 0x8A, 0x89, 0x54, 0x8A, 0x89, 0x54, 0x8A, 0x89, 0x54, 0x8A, 0x89,
+    0x44, 0x8D, 0xFC, 0x9C, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82,
+    0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81,
+    0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A,
+    0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44,
+    0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08, 0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x08,
+    0x81, 0x44, 0x8A, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89,
+    0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44,
+    0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82,
+    0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89,
+    0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44, 0x82, 0x89, 0x44,
+    0x82, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82,
+    0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82,
+    0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82,
+    0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82,
+    0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82,
+    0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82,
+    0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x89, 0x44, 0x82, 0x05, 0x8A, 0x44, 0x81,
+    0x05, 0x8C, 0x44, 0x05, 0x82, 0x44, 0x8D, 0x00, 0x81, 0x02, 0x82, 0x8D, 0x44, 0x89, 0x00, 0x8D,
+    0x40, 0x8D, 0x8E, 0x46, 0x83, 0x00, 0x8D, 0x48, 0x8B, 0x01, 0x8D, 0x47, 0x8E, 0x81, 0x01, 0x8D,
+    0x46, 0x8C, 0x81, 0x02, 0x88, 0x8D, 0x41, 0x8E, 0x8D, 0x89, 0x84, 0x04, 0x89, 0x44, 0x82, 0x07,
+    0x89, 0x44, 0x8B, 0x00, 0x89, 0x44, 0x82, 0x06, 0x86, 0x44, 0x8E, 0x81, 0x00, 0x89, 0x44, 0x82,
+    0x05, 0x83, 0x45, 0x83, 0x01, 0x89, 0x44, 0x82, 0x04, 0x81, 0x8E, 0x44, 0x86, 0x02, 0x89, 0x44,
+    0x82, 0x04, 0x8C, 0x44, 0x89, 0x03, 0x89, 0x44, 0x82, 0x03, 0x89, 0x44, 0x8C, 0x04, 0x89, 0x44,
+    0x82, 0x02, 0x86, 0x44, 0x8E, 0x81, 0x04, 0x89, 0x44, 0x82, 0x01, 0x83, 0x45, 0x83, 0x05, 0x89,
+    0x44, 0x82, 0x00, 0x81, 0x8E, 0x44, 0x87, 0x06, 0x89, 0x44, 0x82, 0x00, 0x8C, 0x44, 0x8A, 0x07,
+    0x89, 0x44, 0x82, 0x88, 0x44, 0x8D, 0x08, 0x89, 0x44, 0x86, 0x44, 0x8E, 0x82, 0x08, 0x89, 0x4B,
+    0x81, 0x08, 0x89, 0x4B, 0x8A, 0x08, 0x89, 0x4C, 0x84, 0x07, 0x89, 0x46, 0x8E, 0x44, 0x8E, 0x07,
+    0x89, 0x45, 0x87, 0x00, 0x8D, 0x44, 0x89, 0x06, 0x89, 0x44, 0x84, 0x01, 0x84, 0x45, 0x83, 0x05,
+    0x89, 0x44, 0x82, 0x02, 0x8A, 0x44, 0x8D, 0x05, 0x89, 0x44, 0x82, 0x02, 0x81, 0x8E, 0x44, 0x87,
+    0x04, 0x89, 0x44, 0x82, 0x03, 0x85, 0x45, 0x82, 0x03, 0x89, 0x44, 0x82, 0x04, 0x8B, 0x44, 0x8B,
+    0x03, 0x89, 0x44, 0x82, 0x04, 0x82, 0x45, 0x86, 0x02, 0x89, 0x44, 0x82, 0x05, 0x87, 0x44, 0x8E,
+    0x81, 0x01, 0x89, 0x44, 0x82, 0x06, 0x8D, 0x44, 0x8A, 0x01, 0x89, 0x44, 0x82, 0x06, 0x83, 0x45,
+    0x84, 0x00, 0x89, 0x44, 0x82, 0x07, 0x89, 0x44, 0x8D, 0x00, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44,
+    0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44,
+    0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44,
+    0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44,
+    0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44,
+    0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44, 0x82, 0x0A, 0x89, 0x44,
+    0x82, 0x0A, 0x89, 0x44, 0xFC, 0xAC, 0x82, 0x89, 0x4F, 0x82, 0x89, 0x4F, 0x82, 0x89, 0x4F, 0x82,
+    0x89, 0x4F, 0x82, 0x89, 0x46, 0x86, 0x0B, 0x89, 0x46, 0x86, 0x89, 0x46, 0x8B, 0x0B, 0x8E, 0x46,
+    0x86, 0x89, 0x47, 0x0A, 0x83, 0x47, 0x86, 0x89, 0x47, 0x85, 0x09, 0x89, 0x47, 0x86, 0x89, 0x47,
+    0x8A, 0x09, 0x8E, 0x47, 0x86, 0x89, 0x48, 0x08, 0x83, 0x48, 0x86, 0x89, 0x43, 0x8A, 0x43, 0x84,
+    0x07, 0x89, 0x42, 0x8E, 0x8B, 0x43, 0x86, 0x89, 0x43, 0x86, 0x43, 0x89, 0x07, 0x8E, 0x42, 0x89,
+    0x8B, 0x43, 0x86, 0x89, 0x43, 0x85, 0x8C, 0x42, 0x8E, 0x06, 0x83, 0x43, 0x84, 0x8C, 0x43, 0x86,
+    0x89, 0x43, 0x86, 0x87, 0x43, 0x83, 0x05, 0x88, 0x42, 0x8E, 0x00, 0x8D, 0x43, 0x86, 0x89, 0x43,
+    0x86, 0x82, 0x43, 0x88, 0x05, 0x8E, 0x42, 0x8A, 0x00, 0x8D, 0x43, 0x86, 0x89, 0x43, 0x87, 0x00,
+    0x8D, 0x42, 0x8D, 0x04, 0x83, 0x43, 0x84, 0x00, 0x8E, 0x43, 0x86, 0x89, 0x43, 0x88, 0x00, 0x89,
+    0x43, 0x82, 0x03, 0x88, 0x43, 0x01, 0x8E, 0x43, 0x86, 0x89, 0x43, 0x88, 0x00, 0x84, 0x43, 0x87,
+    0x03, 0x8D, 0x42, 0x8A, 0x01, 0x44, 0x86, 0x89, 0x43, 0x88, 0x01, 0x8E, 0x42, 0x8C, 0x02, 0x83,
+    0x43, 0x84, 0x01, 0x44, 0x86, 0x89, 0x43, 0x88, 0x01, 0x8A, 0x43, 0x81, 0x01, 0x88, 0x43, 0x02,
+    0x44, 0x86, 0x89, 0x43, 0x88, 0x01, 0x85, 0x43, 0x86, 0x01, 0x8D, 0x42, 0x8A, 0x02, 0x44, 0x86,
+    0x89, 0x43, 0x88, 0x02, 0x43, 0x8B, 0x00, 0x83, 0x43, 0x85, 0x02, 0x44, 0x86, 0x89, 0x43, 0x88,
+    0x02, 0x8B, 0x43, 0x00, 0x88, 0x43, 0x03, 0x44, 0x86, 0x89, 0x43, 0x88, 0x02, 0x86, 0x43, 0x85,
+    0x8D, 0x42, 0x8A, 0x03, 0x44, 0x86, 0x89, 0x43, 0x88, 0x02, 0x81, 0x43, 0x8C, 0x43, 0x85, 0x03,
+    0x44, 0x86, 0x89, 0x43, 0x88, 0x03, 0x8C, 0x47, 0x04, 0x44, 0x86, 0x89, 0x43, 0x88, 0x03, 0x87,
+    0x46, 0x8A, 0x04, 0x44, 0x86, 0x89, 0x43, 0x88, 0x03, 0x82, 0x46, 0x85, 0x04, 0x44, 0x86, 0x89,
+    0x43, 0x88, 0x04, 0x8D, 0x45, 0x05, 0x44, 0x86, 0x89, 0x43, 0x88, 0x04, 0x88, 0x44, 0x8A, 0x05,
+    0x44, 0x86, 0x89, 0x43, 0x88, 0x04, 0x83, 0x44, 0x85, 0x05, 0x44, 0x86, 0x89, 0x45, 0x8E, 0x0A,
+    0x8B, 0x43, 0x87, 0x89, 0x46, 0x88, 0x09, 0x8B, 0x43, 0x87, 0x89, 0x47, 0x82, 0x08, 0x8B, 0x43,
+    0x87, 0x89, 0x47, 0x8B, 0x08, 0x8B, 0x43, 0x87, 0x89, 0x48, 0x84, 0x07, 0x8B, 0x43, 0x87, 0x89,
+    0x48, 0x8D, 0x07, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x8E, 0x44, 0x87, 0x06, 0x8B, 0x43, 0x87, 0x89,
+    0x43, 0x86, 0x45, 0x81, 0x05, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x85, 0x88, 0x44, 0x89, 0x05, 0x8B,
+    0x43, 0x87, 0x89, 0x43, 0x85, 0x00, 0x8E, 0x44, 0x83, 0x04, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x86,
+    0x00, 0x85, 0x44, 0x8C, 0x04, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x87, 0x01, 0x8C, 0x44, 0x85, 0x03,
+    0x8B, 0x43, 0x87, 0x89, 0x43, 0x88, 0x01, 0x83, 0x44, 0x8E, 0x03, 0x8B, 0x43, 0x87, 0x89, 0x43,
+    0x88, 0x02, 0x8A, 0x44, 0x88, 0x02, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x88, 0x02, 0x81, 0x45, 0x82,
+    0x01, 0x8A, 0x43, 0x87, 0x89, 0x43, 0x88, 0x03, 0x87, 0x44, 0x8B, 0x01, 0x8A, 0x43, 0x87, 0x89,
+    0x43, 0x88, 0x04, 0x8D, 0x44, 0x84, 0x00, 0x89, 0x43, 0x87, 0x89, 0x43, 0x88, 0x04, 0x85, 0x44,
+    0x8D, 0x00, 0x88, 0x43, 0x87, 0x89, 0x43, 0x88, 0x05, 0x8B, 0x44, 0x87, 0x88, 0x43, 0x87, 0x89,
+    0x43, 0x88, 0x05, 0x82, 0x45, 0x88, 0x43, 0x87, 0x89, 0x43, 0x88, 0x06, 0x89, 0x49, 0x87, 0x89,
+    0x43, 0x88, 0x06, 0x81, 0x8E, 0x48, 0x87, 0x89, 0x43, 0x88, 0x07, 0x86, 0x48, 0x87, 0x89, 0x43,
+    0x88, 0x08, 0x8D, 0x47, 0x87, 0x89, 0x43, 0x88, 0x08, 0x84, 0x47, 0x87, 0x89, 0x43, 0x88, 0x09,
+    0x8B, 0x46, 0x87, 0x89, 0x43, 0x88, 0x09, 0x82, 0x46, 0x87, 0x06, 0x81, 0x85, 0x89, 0x8C, 0x8E,
+    0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x82, 0x0C, 0x81, 0x89, 0x4B, 0x8B, 0x83, 0x09, 0x85, 0x4F, 0x88,
+    0x07, 0x87, 0x51, 0x8A, 0x05, 0x84, 0x48, 0x9D, 0x8E, 0x47, 0x87, 0x04, 0x8E, 0x45, 0x8B, 0x83,
+    0x03, 0x82, 0x88, 0x46, 0x83, 0x02, 0x86, 0x45, 0x87, 0x07, 0x83, 0x45, 0x8A, 0x02, 0x8D, 0x44,
+    0x8A, 0x09, 0x86, 0x45, 0x81, 0x00, 0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x86, 0x00, 0x86, 0x44,
+    0x8B, 0x0B, 0x88, 0x44, 0x89, 0x00, 0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8D, 0x00, 0x8A, 0x44,
+    0x85, 0x0B, 0x81, 0x44, 0x8E, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8C, 0x44, 0x83, 0x0C,
+    0x45, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8A, 0x44, 0x85, 0x0B, 0x81, 0x44, 0x8E, 0x00,
+    0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8C, 0x00, 0x85, 0x44, 0x8C, 0x0B, 0x88, 0x44, 0x89, 0x00,
+    0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x85, 0x01, 0x8D, 0x44, 0x8A, 0x09, 0x86, 0x45, 0x81, 0x01,
+    0x86, 0x45, 0x87, 0x07, 0x84, 0x45, 0x8A, 0x03, 0x8E, 0x45, 0x8B, 0x84, 0x03, 0x82, 0x89, 0x46,
+    0x82, 0x03, 0x83, 0x48, 0x8E, 0x8D, 0x48, 0x87, 0x05, 0x86, 0x51, 0x8A, 0x07, 0x84, 0x4F, 0x87,
+    0x09, 0x81, 0x89, 0x4B, 0x8B, 0x83, 0x0C, 0x81, 0x85, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8D, 0x8A,
+    0x86, 0x82, 0x07, 0x89, 0x48, 0x8E, 0x8D, 0x8A, 0x87, 0x81, 0x04, 0x89, 0x4D, 0x89, 0x81, 0x02,
+    0x89, 0x4E, 0x8E, 0x81, 0x01, 0x89, 0x4F, 0x8D, 0x01, 0x89, 0x44, 0x8C, 0x9B, 0x8C, 0x8E, 0x46,
+    0x86, 0x00, 0x89, 0x44, 0x82, 0x03, 0x83, 0x8D, 0x44, 0x8C, 0x00, 0x89, 0x44, 0x82, 0x04, 0x81,
+    0x45, 0x00, 0x89, 0x44, 0x82, 0x05, 0x8C, 0x44, 0x81, 0x89, 0x44, 0x82, 0x05, 0x8A, 0x44, 0x82,
+    0x89, 0x44, 0x82, 0x05, 0x8C, 0x44, 0x00, 0x89, 0x44, 0x82, 0x04, 0x84, 0x44, 0x8E, 0x00, 0x89,
+    0x44, 0x82, 0x03, 0x86, 0x45, 0x89, 0x00, 0x89, 0x44, 0x8C, 0x9B, 0x8D, 0x47, 0x83, 0x00, 0x89,
+    0x4F, 0x89, 0x01, 0x89, 0x4E, 0x8A, 0x02, 0x89, 0x4C, 0x8E, 0x85, 0x03, 0x89, 0x48, 0x8E, 0x8C,
+    0x89, 0x84, 0x05, 0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x89,
+    0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x89,
+    0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x82, 0x0C, 0x06, 0x81, 0x85, 0x89, 0x8C,
+    0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x82, 0x0C, 0x81, 0x89, 0x4B, 0x8B, 0x83, 0x09, 0x85, 0x4F,
+    0x88, 0x07, 0x87, 0x51, 0x8A, 0x05, 0x84, 0x48, 0x9D, 0x8E, 0x47, 0x87, 0x04, 0x8E, 0x45, 0x8B,
+    0x83, 0x03, 0x82, 0x88, 0x46, 0x83, 0x02, 0x86, 0x45, 0x87, 0x07, 0x83, 0x45, 0x8A, 0x02, 0x8D,
+    0x44, 0x8A, 0x09, 0x86, 0x45, 0x81, 0x00, 0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x86, 0x00, 0x86,
+    0x44, 0x8B, 0x0B, 0x88, 0x44, 0x89, 0x00, 0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8D, 0x00, 0x8A,
+    0x44, 0x85, 0x0B, 0x81, 0x44, 0x8E, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8C, 0x44, 0x83,
+    0x0C, 0x45, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8A, 0x44, 0x85, 0x0B, 0x81, 0x44, 0x8E,
+    0x00, 0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8C, 0x00, 0x85, 0x44, 0x8C, 0x0B, 0x88, 0x44, 0x8A,
+    0x00, 0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x86, 0x01, 0x8D, 0x44, 0x8A, 0x09, 0x86, 0x45, 0x81,
+    0x01, 0x86, 0x45, 0x87, 0x07, 0x84, 0x45, 0x8A, 0x03, 0x8E, 0x45, 0x8B, 0x84, 0x03, 0x82, 0x89,
+    0x46, 0x82, 0x03, 0x83, 0x48, 0x8E, 0x8D, 0x48, 0x88, 0x05, 0x86, 0x51, 0x8A, 0x07, 0x84, 0x4F,
+    0x88, 0x09, 0x81, 0x89, 0x4B, 0x8C, 0x83, 0x0C, 0x81, 0x85, 0x89, 0x8C, 0x8E, 0x46, 0x8D, 0x81,
+    0x12, 0x82, 0x8E, 0x44, 0x8D, 0x13, 0x83, 0x45, 0x8C, 0x13, 0x86, 0x45, 0x8B, 0x13, 0x88, 0x45,
+    0x89, 0x13, 0x8B, 0x45, 0x88, 0x13, 0x8D, 0x45, 0x86, 0x00, 0x89, 0x48, 0x8E, 0x8C, 0x89, 0x85,
+    0x08, 0x89, 0x4D, 0x89, 0x81, 0x05, 0x89, 0x4E, 0x8D, 0x82, 0x04, 0x89, 0x4F, 0x8D, 0x04, 0x89,
+    0x44, 0x8C, 0x9B, 0x8C, 0x47, 0x86, 0x03, 0x89, 0x44, 0x82, 0x03, 0x84, 0x8D, 0x44, 0x8C, 0x03,
+    0x89, 0x44, 0x82, 0x04, 0x81, 0x45, 0x03, 0x89, 0x44, 0x82, 0x05, 0x8B, 0x44, 0x81, 0x02, 0x89,
+    0x44, 0x82, 0x05, 0x8A, 0x44, 0x82, 0x02, 0x89, 0x44, 0x82, 0x05, 0x8D, 0x44, 0x03, 0x89, 0x44,
+    0x82, 0x04, 0x86, 0x44, 0x8C, 0x03, 0x89, 0x44, 0x82, 0x01, 0x81, 0x84, 0x89, 0x45, 0x85, 0x03,
+    0x89, 0x4F, 0x8A, 0x04, 0x89, 0x4E, 0x8B, 0x05, 0x89, 0x4D, 0x88, 0x06, 0x89, 0x4C, 0x85, 0x07,
+    0x89, 0x44, 0x8B, 0x9A, 0x8E, 0x43, 0x8E, 0x07, 0x89, 0x44, 0x82, 0x01, 0x84, 0x44, 0x89, 0x06,
+    0x89, 0x44, 0x82, 0x02, 0x89, 0x44, 0x84, 0x05, 0x89, 0x44, 0x82, 0x02, 0x81, 0x8E, 0x43, 0x8E,
+    0x81, 0x04, 0x89, 0x44, 0x82, 0x03, 0x85, 0x44, 0x8A, 0x04, 0x89, 0x44, 0x82, 0x04, 0x8B, 0x44,
+    0x85, 0x03, 0x89, 0x44, 0x82, 0x04, 0x82, 0x44, 0x8E, 0x81, 0x02, 0x89, 0x44, 0x82, 0x05, 0x87,
+    0x44, 0x8A, 0x02, 0x89, 0x44, 0x82, 0x06, 0x8D, 0x44, 0x85, 0x01, 0x89, 0x44, 0x82, 0x06, 0x83,
+    0x44, 0x8E, 0x81, 0x00, 0x89, 0x44, 0x82, 0x07, 0x89, 0x44, 0x8B, 0x00, 0x04, 0x82, 0x87, 0x8B,
+    0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x82, 0x05, 0x81, 0x8A, 0x4A, 0x8C, 0x86, 0x02, 0x81, 0x8D,
+    0x4D, 0x81, 0x01, 0x8C, 0x4D, 0x8A, 0x01, 0x85, 0x46, 0x8D, 0x8C, 0x8E, 0x44, 0x83, 0x01, 0x8A,
+    0x44, 0x8A, 0x81, 0x02, 0x81, 0x85, 0x8A, 0x40, 0x8C, 0x02, 0x8D, 0x43, 0x8E, 0x08, 0x82, 0x02,
+    0x8E, 0x43, 0x8B, 0x0C, 0x8D, 0x43, 0x8E, 0x81, 0x0B, 0x8A, 0x44, 0x8C, 0x82, 0x0A, 0x84, 0x46,
+    0x89, 0x81, 0x09, 0x8B, 0x47, 0x8A, 0x82, 0x07, 0x81, 0x8C, 0x48, 0x8A, 0x81, 0x07, 0x8A, 0x49,
+    0x86, 0x07, 0x84, 0x8C, 0x48, 0x88, 0x08, 0x84, 0x8B, 0x47, 0x85, 0x09, 0x83, 0x8B, 0x45, 0x8E,
+    0x0B, 0x86, 0x45, 0x83, 0x0B, 0x88, 0x44, 0x85, 0x0B, 0x84, 0x44, 0x86, 0x83, 0x8A, 0x84, 0x08,
+    0x86, 0x44, 0x94, 0x41, 0x8D, 0x88, 0x83, 0x04, 0x85, 0x8E, 0x44, 0x81, 0x84, 0x45, 0x8D, 0x8C,
+    0x8D, 0x8E, 0x45, 0x8B, 0x00, 0x84, 0x4F, 0x82, 0x00, 0x84, 0x4E, 0x84, 0x01, 0x81, 0x8A, 0x4B,
+    0x8B, 0x82, 0x04, 0x81, 0x85, 0x89, 0x8C, 0x8E, 0x42, 0x8D, 0x8B, 0x87, 0x82, 0x04, 0x83, 0x53,
+    0x84, 0x83, 0x53, 0x84, 0x83, 0x53, 0x84, 0x83, 0x53, 0x84, 0x82, 0xEC, 0x45, 0xEC, 0x83, 0x07,
+    0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F,
+    0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F,
+    0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F,
+    0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F,
+    0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x0F,
+    0x8E, 0x43, 0x8E, 0x0F, 0x8E, 0x43, 0x8E, 0x07, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44,
+    0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88,
+    0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83,
+    0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44,
+    0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88,
+    0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x83,
+    0x44, 0x88, 0x8C, 0x44, 0x09, 0x83, 0x44, 0x88, 0x8C, 0x44, 0x09, 0x84, 0x44, 0x88, 0x8B, 0x44,
+    0x09, 0x85, 0x44, 0x87, 0x8A, 0x44, 0x83, 0x08, 0x87, 0x44, 0x86, 0x88, 0x44, 0x88, 0x08, 0x8C,
+    0x44, 0x94, 0x45, 0x82, 0x06, 0x86, 0x45, 0x01, 0x8E, 0x44, 0x8E, 0x85, 0x03, 0x81, 0x88, 0x45,
+    0x89, 0x01, 0x85, 0x47, 0x8E, 0x8D, 0x8E, 0x47, 0x81, 0x02, 0x8A, 0x50, 0x85, 0x04, 0x8A, 0x4E,
+    0x85, 0x06, 0x85, 0x8D, 0x4A, 0x8A, 0x82, 0x09, 0x84, 0x88, 0x8C, 0x8E, 0x42, 0x8D, 0x8A, 0x87,
+    0x81, 0x05, 0x8D, 0x44, 0x0B, 0x84, 0x44, 0x88, 0x87, 0x44, 0x84, 0x0A, 0x89, 0x44, 0x83, 0x82,
+    0x44, 0x89, 0x0A, 0x8E, 0x43, 0x8D, 0x01, 0x8C, 0x43, 0x8E, 0x09, 0x83, 0x44, 0x88, 0x01, 0x87,
+    0x44, 0x83, 0x08, 0x88, 0x44, 0x82, 0x01, 0x82, 0x44, 0x88, 0x08, 0x8D, 0x43, 0x8D, 0x03, 0x8C,
+    0x43, 0x8D, 0x07, 0x83, 0x44, 0x87, 0x03, 0x87, 0x44, 0x83, 0x06, 0x88, 0x44, 0x82, 0x03, 0x81,
+    0x44, 0x88, 0x06, 0x8D, 0x43, 0x8C, 0x05, 0x8C, 0x43, 0x8D, 0x05, 0x82, 0x44, 0x87, 0x05, 0x86,
+    0x44, 0x82, 0x04, 0x87, 0x44, 0x81, 0x05, 0x81, 0x44, 0x87, 0x04, 0x8C, 0x43, 0x8C, 0x07, 0x8B,
+    0x43, 0x8C, 0x03, 0x81, 0x44, 0x86, 0x07, 0x86, 0x44, 0x81, 0x02, 0x87, 0x44, 0x81, 0x07, 0x81,
+    0x44, 0x86, 0x02, 0x8C, 0x43, 0x8B, 0x09, 0x8B, 0x43, 0x8B, 0x01, 0x81, 0x44, 0x86, 0x09, 0x86,
+    0x44, 0x01, 0x85, 0x44, 0x81, 0x09, 0x81, 0x44, 0x85, 0x00, 0x8A, 0x43, 0x8B, 0x0B, 0x8B, 0x43,
+    0x89, 0x00, 0x8E, 0x43, 0x85, 0x0B, 0x85, 0x43, 0x8D, 0x82, 0x44, 0x0D, 0x44, 0x87, 0x43, 0x8B,
+    0x0D, 0x8A, 0x43, 0x8D, 0x43, 0x85, 0x0D, 0x85, 0x48, 0x0F, 0x47, 0x8A, 0x0F, 0x8A, 0x46, 0x85,
+    0x0F, 0x84, 0x46, 0x11, 0x45, 0x8A, 0x08, 0x8D, 0x43, 0x8C, 0x08, 0x87, 0x44, 0x83, 0x08, 0x44,
+    0x99, 0x44, 0x08, 0x8B, 0x44, 0x87, 0x07, 0x84, 0x44, 0x95, 0x44, 0x83, 0x07, 0x45, 0x8B, 0x07,
+    0x88, 0x44, 0x91, 0x44, 0x87, 0x06, 0x84, 0x46, 0x07, 0x8B, 0x43, 0x8D, 0x01, 0x8D, 0x43, 0x8B,
+    0x06, 0x88, 0x46, 0x84, 0x06, 0x44, 0x89, 0x01, 0x89, 0x44, 0x06, 0x8C, 0x46, 0x88, 0x05, 0x83,
+    0x44, 0x85, 0x01, 0x85, 0x44, 0x83, 0x05, 0x47, 0x8C, 0x05, 0x87, 0x44, 0x81, 0x01, 0x81, 0x44,
+    0x86, 0x04, 0x84, 0x43, 0x8B, 0x43, 0x81, 0x04, 0x8A, 0x43, 0x8D, 0x03, 0x8D, 0x43, 0x8A, 0x04,
+    0x88, 0x43, 0x85, 0x43, 0x85, 0x04, 0x8E, 0x43, 0x89, 0x03, 0x89, 0x43, 0x8E, 0x04, 0x8D, 0x42,
+    0x8D, 0x82, 0x43, 0x89, 0x03, 0x82, 0x44, 0x84, 0x03, 0x84, 0x44, 0x82, 0x02, 0x81, 0x43, 0x8A,
+    0x00, 0x8E, 0x42, 0x8D, 0x03, 0x86, 0x44, 0x81, 0x03, 0x81, 0x44, 0x86, 0x02, 0x85, 0x43, 0x86,
+    0x00, 0x8B, 0x43, 0x81, 0x02, 0x89, 0x43, 0x8C, 0x05, 0x8C, 0x43, 0x89, 0x02, 0x89, 0x43, 0x83,
+    0x00, 0x87, 0x43, 0x85, 0x02, 0x8D, 0x43, 0x88, 0x05, 0x88, 0x43, 0x8D, 0x02, 0x8D, 0x42, 0x8E,
+    0x01, 0x83, 0x43, 0x89, 0x01, 0x81, 0x44, 0x84, 0x05, 0x84, 0x44, 0x81, 0x00, 0x81, 0x43, 0x8B,
+    0x02, 0x43, 0x8E, 0x01, 0x85, 0x44, 0x07, 0x44, 0x84, 0x00, 0x86, 0x43, 0x86, 0x02, 0x8B, 0x43,
+    0x82, 0x00, 0x88, 0x43, 0x8C, 0x07, 0x8C, 0x43, 0x88, 0x00, 0x8A, 0x43, 0x82, 0x02, 0x87, 0x43,
+    0x85, 0x00, 0x8C, 0x43, 0x88, 0x07, 0x88, 0x43, 0x8B, 0x00, 0x8D, 0x42, 0x8E, 0x03, 0x82, 0x43,
+    0x89, 0x00, 0x44, 0x84, 0x07, 0x84, 0x43, 0x8E, 0x00, 0x43, 0x8A, 0x04, 0x8E, 0x42, 0x8C, 0x82,
+    0x44, 0x09, 0x44, 0x84, 0x43, 0x86, 0x04, 0x8A, 0x42, 0x8E, 0x85, 0x43, 0x8C, 0x09, 0x8B, 0x43,
+    0x8A, 0x43, 0x82, 0x04, 0x86, 0x43, 0x89, 0x43, 0x88, 0x09, 0x87, 0x43, 0x8E, 0x42, 0x8E, 0x05,
+    0x82, 0x43, 0x8E, 0x43, 0x83, 0x09, 0x83, 0x47, 0x89, 0x06, 0x8E, 0x47, 0x0B, 0x47, 0x85, 0x06,
+    0x8A, 0x46, 0x8B, 0x0B, 0x8B, 0x46, 0x81, 0x06, 0x85, 0x46, 0x87, 0x0B, 0x87, 0x45, 0x8D, 0x07,
+    0x81, 0x46, 0x83, 0x0B, 0x83, 0x45, 0x89, 0x08, 0x8D, 0x45, 0x06, 0x82, 0x45, 0x83, 0x09, 0x8C,
+    0x44, 0x86, 0x01, 0x87, 0x44, 0x8C, 0x08, 0x86, 0x44, 0x8B, 0x03, 0x8C, 0x44, 0x86, 0x06, 0x81,
+    0x8E, 0x44, 0x82, 0x03, 0x82, 0x45, 0x81, 0x05, 0x89, 0x44, 0x87, 0x05, 0x88, 0x44, 0x8A, 0x04,
+    0x82, 0x44, 0x8D, 0x07, 0x8D, 0x44, 0x83, 0x03, 0x8C, 0x44, 0x83, 0x07, 0x83, 0x44, 0x8D, 0x02,
+    0x85, 0x44, 0x89, 0x09, 0x89, 0x44, 0x87, 0x01, 0x8E, 0x43, 0x8E, 0x0B, 0x8E, 0x44, 0x81, 0x88,
+    0x44, 0x84, 0x0B, 0x84, 0x44, 0x8B, 0x44, 0x8A, 0x0D, 0x8A, 0x48, 0x8E, 0x81, 0x0D, 0x81, 0x8E,
+    0x47, 0x86, 0x0F, 0x85, 0x46, 0x8B, 0x10, 0x84, 0x46, 0x85, 0x10, 0x8D, 0x46, 0x8E, 0x0F, 0x89,
+    0x48, 0x89, 0x0D, 0x83, 0x4A, 0x84, 0x0C, 0x8D, 0x44, 0x83, 0x44, 0x8E, 0x0B, 0x88, 0x44, 0x86,
+    0x00, 0x87, 0x44, 0x89, 0x09, 0x82, 0x44, 0x8C, 0x02, 0x8D, 0x44, 0x84, 0x08, 0x8C, 0x44, 0x83,
+    0x02, 0x83, 0x44, 0x8E, 0x81, 0x06, 0x87, 0x44, 0x88, 0x04, 0x89, 0x44, 0x8A, 0x05, 0x82, 0x44,
+    0x8E, 0x05, 0x81, 0x8E, 0x44, 0x85, 0x04, 0x8B, 0x44, 0x85, 0x06, 0x86, 0x44, 0x8E, 0x81, 0x02,
+    0x86, 0x44, 0x8B, 0x08, 0x8C, 0x44, 0x8A, 0x01, 0x81, 0x8E, 0x44, 0x81, 0x08, 0x82, 0x45, 0x85,
+    0x00, 0x8A, 0x44, 0x87, 0x0A, 0x88, 0x44, 0x8E, 0x81, 0x8B, 0x44, 0x87, 0x09, 0x8B, 0x44, 0x87,
+    0x83, 0x44, 0x8E, 0x08, 0x83, 0x44, 0x8D, 0x01, 0x8A, 0x44, 0x87, 0x07, 0x8C, 0x44, 0x85, 0x01,
+    0x82, 0x45, 0x81, 0x05, 0x84, 0x44, 0x8C, 0x03, 0x89, 0x44, 0x88, 0x05, 0x8C, 0x44, 0x84, 0x03,
+    0x81, 0x45, 0x81, 0x03, 0x84, 0x44, 0x8B, 0x05, 0x88, 0x44, 0x88, 0x03, 0x8C, 0x44, 0x82, 0x06,
+    0x8E, 0x44, 0x81, 0x01, 0x84, 0x44, 0x8A, 0x07, 0x86, 0x44, 0x88, 0x01, 0x8C, 0x44, 0x81, 0x08,
+    0x8D, 0x44, 0x81, 0x85, 0x44, 0x88, 0x09, 0x85, 0x44, 0x88, 0x8D, 0x43, 0x8E, 0x81, 0x0A, 0x8C,
+    0x49, 0x87, 0x0B, 0x84, 0x48, 0x8E, 0x0D, 0x8B, 0x47, 0x85, 0x0D, 0x83, 0x46, 0x8C, 0x0F, 0x8A,
+    0x45, 0x84, 0x0F, 0x82, 0x44, 0x8C, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11,
+    0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44, 0x8B, 0x11, 0x44,
+    0x8B, 0x11, 0x44, 0x8B, 0x08, 0x00, 0x8B, 0x51, 0x8C, 0x01, 0x8B, 0x51, 0x8C, 0x01, 0x8B, 0x51,
+    0x8C, 0x01, 0x8B, 0x51, 0x8B, 0x01, 0x88, 0xFC, 0xBC, 0x45, 0x83, 0x0D, 0x89, 0x44, 0x87, 0x0D,
+    0x84, 0x44, 0x8C, 0x0D, 0x81, 0x8E, 0x44, 0x82, 0x0D, 0x8B, 0x44, 0x86, 0x0D, 0x86, 0x44, 0x8B,
+    0x0D, 0x82, 0x44, 0x8E, 0x81, 0x0D, 0x8C, 0x44, 0x84, 0x0D, 0x88, 0x44, 0x89, 0x0D, 0x83, 0x44,
+    0x8D, 0x0E, 0x8E, 0x44, 0x83, 0x0D, 0x8A, 0x44, 0x87, 0x0D, 0x85, 0x44, 0x8C, 0x0D, 0x81, 0x8E,
+    0x44, 0x82, 0x0D, 0x8B, 0x44, 0x86, 0x0D, 0x87, 0x44, 0x8A, 0x0D, 0x82, 0x44, 0x8E, 0x81, 0x0D,
+    0x8D, 0x44, 0x84, 0x0D, 0x88, 0x45, 0xFC, 0xCC, 0x91, 0x53, 0x91, 0x53, 0x91, 0x53, 0x91, 0x53,
+    0x81, 0x85, 0x47, 0x8A, 0x85, 0x47, 0x8A, 0x85, 0x47, 0x8A, 0x85, 0x44, 0xAE, 0x89, 0x85, 0x43,
+    0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43,
+    0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43,
+    0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43,
+    0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43,
+    0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43,
+    0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43, 0x87, 0x03, 0x85, 0x43,
+    0x87, 0x03, 0x85, 0x44, 0xAE, 0x89, 0x85, 0x47, 0x8A, 0x85, 0x47, 0x8A, 0x85, 0x47, 0x8A, 0x89,
+    0x43, 0x88, 0x09, 0x83, 0x43, 0x8E, 0x0A, 0x8D, 0x43, 0x84, 0x09, 0x87, 0x43, 0x8A, 0x09, 0x81,
+    0x44, 0x81, 0x09, 0x8B, 0x43, 0x86, 0x09, 0x85, 0x43, 0x8C, 0x0A, 0x44, 0x82, 0x09, 0x89, 0x43,
+    0x88, 0x09, 0x83, 0x43, 0x8E, 0x0A, 0x8D, 0x43, 0x84, 0x09, 0x87, 0x43, 0x8A, 0x09, 0x81, 0x44,
+    0x81, 0x09, 0x8B, 0x43, 0x86, 0x09, 0x85, 0x43, 0x8C, 0x0A, 0x44, 0x82, 0x09, 0x89, 0x43, 0x88,
+    0x09, 0x83, 0x43, 0x8E, 0x0A, 0x8D, 0x43, 0x84, 0x09, 0x87, 0x43, 0x8A, 0x09, 0x81, 0x44, 0x81,
+    0x09, 0x8B, 0x43, 0x86, 0x09, 0x85, 0x43, 0x8C, 0x0A, 0x44, 0x82, 0x09, 0x89, 0x43, 0x88, 0x09,
+    0x83, 0x43, 0x8E, 0x0A, 0x8D, 0x43, 0x84, 0x00, 0x47, 0x8E, 0x00, 0x47, 0x8E, 0x00, 0x47, 0x8E,
+    0x00, 0xBE, 0x43, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E,
+    0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E,
+    0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E,
+    0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E,
+    0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E,
+    0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E,
+    0x04, 0x8E, 0x42, 0x8E, 0x04, 0x8E, 0x42, 0x8E, 0x00, 0xBE, 0x43, 0x8E, 0x00, 0x47, 0x8E, 0x00,
+    0x47, 0x8E, 0x00, 0x47, 0x8E, 0x07, 0x8E, 0x41, 0x83, 0x0F, 0x87, 0x42, 0x8C, 0x0F, 0x8E, 0x43,
+    0x84, 0x0D, 0x86, 0x44, 0x8D, 0x0D, 0x8D, 0x45, 0x86, 0x0B, 0x85, 0x46, 0x8E, 0x0B, 0x8D, 0x42,
+    0x85, 0x8D, 0x42, 0x87, 0x09, 0x84, 0x42, 0x8E, 0x00, 0x85, 0x42, 0x8E, 0x81, 0x08, 0x8C, 0x42,
+    0x86, 0x01, 0x8C, 0x42, 0x88, 0x07, 0x84, 0x42, 0x8E, 0x02, 0x84, 0x43, 0x81, 0x06, 0x8B, 0x42,
+    0x88, 0x03, 0x8B, 0x42, 0x89, 0x05, 0x83, 0x43, 0x81, 0x03, 0x83, 0x43, 0x82, 0x04, 0x8B, 0x42,
+    0x89, 0x05, 0x8A, 0x42, 0x8B, 0x03, 0x82, 0x43, 0x82, 0x05, 0x82, 0x43, 0x83, 0x02, 0x8A, 0x42,
+    0x8A, 0x07, 0x89, 0x42, 0x8C, 0x01, 0x82, 0x43, 0x83, 0x07, 0x81, 0x43, 0x85, 0x00, 0x89, 0x42,
+    0x8C, 0x09, 0x89, 0x42, 0x8D, 0x00, 0x00, 0xF9, 0xE9, 0x86, 0x81, 0x4E, 0x8B, 0x81, 0x4E, 0x8B,
+    0x8A, 0x44, 0x8D, 0x04, 0x89, 0x44, 0x89, 0x04, 0x86, 0x44, 0x85, 0x04, 0x84, 0x8E, 0x43, 0x83,
+    0x04, 0x81, 0x8C, 0x42, 0x8E, 0x81, 0x05, 0x88, 0x42, 0x8C, 0x04, 0x84, 0x88, 0x8B, 0x8E, 0x42,
+    0x8D, 0x8A, 0x86, 0x06, 0x81, 0x88, 0x4B, 0x86, 0x04, 0x82, 0x4D, 0x88, 0x04, 0x8A, 0x4D, 0x83,
+    0x03, 0x83, 0x41, 0x8E, 0x89, 0x86, 0x93, 0x86, 0x8D, 0x44, 0x8A, 0x04, 0x87, 0x84, 0x05, 0x81,
+    0x8E, 0x43, 0x8E, 0x0D, 0x8A, 0x44, 0x0D, 0x88, 0x44, 0x81, 0x04, 0x84, 0x88, 0x8A, 0x8C, 0x8D,
+    0x8E, 0x47, 0x81, 0x02, 0x87, 0x8E, 0x4D, 0x81, 0x00, 0x81, 0x8C, 0x4F, 0x81, 0x00, 0x8A, 0x45,
+    0x8D, 0x88, 0x86, 0x95, 0x8A, 0x44, 0x91, 0x45, 0x85, 0x04, 0x88, 0x44, 0x81, 0x84, 0x44, 0x89,
+    0x05, 0x89, 0x44, 0x81, 0x86, 0x44, 0x86, 0x05, 0x8D, 0x44, 0x81, 0x85, 0x44, 0x89, 0x04, 0x87,
+    0x45, 0x81, 0x82, 0x45, 0x88, 0x83, 0x82, 0x84, 0x8B, 0x46, 0x81, 0x00, 0x8D, 0x50, 0x81, 0x00,
+    0x85, 0x4A, 0x84, 0x8B, 0x43, 0x81, 0x01, 0x87, 0x47, 0x8E, 0x84, 0x00, 0x85, 0x43, 0x81, 0x02,
+    0x82, 0x89, 0x8D, 0x41, 0x8E, 0x8B, 0x87, 0x81, 0x02, 0x43, 0x81, 0x00, 0x44, 0x8A, 0x0E, 0x44,
+    0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x89,
+    0x0E, 0x44, 0x89, 0x0E, 0x44, 0x89, 0x01, 0x86, 0x8B, 0x8E, 0x40, 0x8E, 0x8B, 0x86, 0x05, 0x44,
+    0x88, 0x82, 0x8D, 0x46, 0x8D, 0x82, 0x03, 0x44, 0x88, 0x8D, 0x48, 0x8E, 0x81, 0x02, 0x50, 0x8A,
+    0x02, 0x47, 0x8A, 0x88, 0x8A, 0x46, 0x83, 0x01, 0x45, 0x8D, 0x81, 0x02, 0x81, 0x8D, 0x44, 0x89,
+    0x01, 0x45, 0x83, 0x04, 0x83, 0x44, 0x8E, 0x01, 0x44, 0x8E, 0x06, 0x8C, 0x44, 0x81, 0x00, 0x44,
+    0x8B, 0x06, 0x89, 0x44, 0x83, 0x00, 0x44, 0x8A, 0x06, 0x87, 0x44, 0x84, 0x00, 0x44, 0x8A, 0x06,
+    0x87, 0x44, 0x85, 0x00, 0x44, 0x8A, 0x06, 0x87, 0x44, 0x84, 0x00, 0x44, 0x8C, 0x06, 0x89, 0x44,
+    0x83, 0x00, 0x45, 0x06, 0x8D, 0x44, 0x81, 0x00, 0x45, 0x85, 0x04, 0x84, 0x44, 0x8E, 0x01, 0x45,
+    0x8E, 0x83, 0x02, 0x82, 0x8E, 0x44, 0x89, 0x01, 0x47, 0x8B, 0x89, 0x8A, 0x46, 0x83, 0x01, 0x50,
+    0x8A, 0x02, 0x44, 0x88, 0x49, 0x8D, 0x81, 0x02, 0x43, 0x8D, 0x00, 0x84, 0x8E, 0x46, 0x8C, 0x81,
+    0x03, 0x43, 0x87, 0x01, 0x81, 0x87, 0x8C, 0x8E, 0x40, 0x8E, 0x8B, 0x85, 0x04, 0x05, 0x84, 0x88,
+    0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x84, 0x05, 0x83, 0x8C, 0x49, 0x8E, 0x82, 0x02, 0x86, 0x4B,
+    0x8E, 0x02, 0x84, 0x4C, 0x88, 0x02, 0x8E, 0x45, 0x8C, 0x99, 0x8C, 0x42, 0x82, 0x01, 0x86, 0x44,
+    0x8E, 0x83, 0x04, 0x85, 0x88, 0x02, 0x8B, 0x44, 0x85, 0x0A, 0x44, 0x8E, 0x0A, 0x82, 0x44, 0x8A,
+    0x0A, 0x83, 0x44, 0x88, 0x0A, 0x84, 0x44, 0x87, 0x0A, 0x83, 0x44, 0x88, 0x0A, 0x82, 0x44, 0x8A,
+    0x0B, 0x44, 0x8E, 0x0B, 0x8D, 0x44, 0x85, 0x07, 0x81, 0x01, 0x88, 0x44, 0x8E, 0x83, 0x04, 0x83,
+    0x8A, 0x8B, 0x01, 0x82, 0x46, 0x8C, 0x99, 0x8B, 0x8E, 0x41, 0x8B, 0x02, 0x88, 0x4C, 0x8B, 0x03,
+    0x8B, 0x4B, 0x8B, 0x04, 0x88, 0x4A, 0x87, 0x05, 0x81, 0x86, 0x8B, 0x8D, 0x42, 0x8E, 0x8B, 0x87,
+    0x81, 0x01, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89,
+    0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x88,
+    0x44, 0x81, 0x04, 0x85, 0x8A, 0x8E, 0x40, 0x8E, 0x8C, 0x87, 0x81, 0x00, 0x87, 0x44, 0x81, 0x02,
+    0x81, 0x8C, 0x46, 0x8E, 0x84, 0x85, 0x44, 0x81, 0x01, 0x81, 0x8D, 0x49, 0x87, 0x44, 0x81, 0x01,
+    0x89, 0x50, 0x81, 0x00, 0x82, 0x46, 0x8B, 0x8A, 0x8B, 0x47, 0x81, 0x00, 0x88, 0x44, 0x8E, 0x83,
+    0x02, 0x81, 0x8B, 0x45, 0x81, 0x00, 0x8D, 0x44, 0x84, 0x05, 0x8E, 0x44, 0x81, 0x00, 0x44, 0x8D,
+    0x06, 0x88, 0x44, 0x81, 0x82, 0x44, 0x89, 0x06, 0x85, 0x44, 0x81, 0x83, 0x44, 0x87, 0x06, 0x83,
+    0x44, 0x81, 0x84, 0x44, 0x87, 0x06, 0x83, 0x44, 0x81, 0x83, 0x44, 0x87, 0x06, 0x83, 0x44, 0x81,
+    0x83, 0x44, 0x89, 0x06, 0x84, 0x44, 0x81, 0x00, 0x44, 0x8C, 0x06, 0x87, 0x44, 0x81, 0x00, 0x8D,
+    0x44, 0x83, 0x05, 0x8D, 0x44, 0x81, 0x00, 0x89, 0x44, 0x8D, 0x81, 0x03, 0x88, 0x45, 0x81, 0x00,
+    0x83, 0x46, 0x8A, 0x88, 0x89, 0x8D, 0x46, 0x81, 0x01, 0x8A, 0x50, 0x81, 0x01, 0x81, 0x8D, 0x48,
+    0x8E, 0x84, 0x44, 0x81, 0x02, 0x82, 0x8C, 0x46, 0x8D, 0x82, 0x00, 0x8C, 0x43, 0x81, 0x04, 0x86,
+    0x8B, 0x8E, 0x40, 0x8E, 0x8C, 0x86, 0x02, 0x86, 0x43, 0x81, 0x05, 0x84, 0x89, 0x8D, 0x8E, 0x40,
+    0x8E, 0x8D, 0x89, 0x85, 0x08, 0x83, 0x8D, 0x48, 0x8D, 0x84, 0x05, 0x85, 0x4C, 0x86, 0x03, 0x83,
+    0x4E, 0x83, 0x02, 0x8E, 0x44, 0x88, 0x82, 0x00, 0x82, 0x87, 0x44, 0x8C, 0x01, 0x85, 0x44, 0x87,
+    0x04, 0x83, 0x44, 0x83, 0x00, 0x8B, 0x43, 0x8E, 0x06, 0x8B, 0x43, 0x88, 0x00, 0x44, 0x8A, 0x06,
+    0x88, 0x43, 0x8A, 0x82, 0x51, 0x8C, 0x83, 0x51, 0x8C, 0x84, 0x51, 0x8D, 0x83, 0x44, 0x8D, 0xFC,
+    0xBC, 0x89, 0x82, 0x44, 0x88, 0x0D, 0x44, 0x8B, 0x0D, 0x8B, 0x44, 0x82, 0x0C, 0x85, 0x44, 0x8D,
+    0x81, 0x07, 0x85, 0x87, 0x02, 0x8D, 0x45, 0x89, 0x85, 0x83, 0x84, 0x85, 0x87, 0x8B, 0x41, 0x8A,
+    0x02, 0x83, 0x4E, 0x8A, 0x03, 0x84, 0x8E, 0x4C, 0x8A, 0x04, 0x81, 0x8A, 0x4B, 0x87, 0x06, 0x82,
+    0x87, 0x8B, 0x8D, 0x42, 0x8E, 0x8C, 0x89, 0x85, 0x81, 0x01, 0x05, 0x81, 0x87, 0x8B, 0x8E, 0x41,
+    0x8E, 0x8D, 0x8A, 0x85, 0x81, 0x04, 0x84, 0x8E, 0x48, 0x83, 0x03, 0x82, 0x49, 0x8D, 0x04, 0x8A,
+    0x49, 0x88, 0x04, 0x8E, 0x44, 0x8D, 0x98, 0x8A, 0x8E, 0x82, 0x04, 0x44, 0x8D, 0x09, 0x81, 0x44,
+    0x89, 0x09, 0x82, 0x44, 0x88, 0x08, 0x85, 0x8D, 0x49, 0x87, 0x01, 0x82, 0x8D, 0x4B, 0x87, 0x01,
+    0x83, 0x4C, 0x87, 0x01, 0x83, 0x4C, 0x87, 0x02, 0x94, 0x85, 0x44, 0x8A, 0xB4, 0x81, 0x04, 0x82,
+    0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82,
+    0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82,
+    0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82,
+    0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x09, 0x82, 0x44, 0x88, 0x06, 0x04,
+    0x82, 0x88, 0x8B, 0x8E, 0x4B, 0x04, 0x89, 0x4F, 0x03, 0x8B, 0x50, 0x02, 0x87, 0x44, 0x8D, 0x88,
+    0x87, 0x8B, 0x45, 0x88, 0x84, 0x03, 0x8E, 0x43, 0x8C, 0x03, 0x87, 0x44, 0x81, 0x03, 0x82, 0x44,
+    0x84, 0x04, 0x44, 0x87, 0x03, 0x84, 0x44, 0x82, 0x04, 0x8C, 0x43, 0x89, 0x03, 0x84, 0x44, 0x81,
+    0x04, 0x8C, 0x43, 0x8A, 0x03, 0x82, 0x44, 0x84, 0x04, 0x44, 0x88, 0x04, 0x8D, 0x43, 0x8C, 0x03,
+    0x87, 0x44, 0x83, 0x04, 0x85, 0x44, 0x8D, 0x89, 0x88, 0x8B, 0x44, 0x8C, 0x06, 0x89, 0x4B, 0x8E,
+    0x82, 0x07, 0x85, 0x49, 0x8B, 0x81, 0x07, 0x81, 0x8B, 0x42, 0x8E, 0x41, 0x8E, 0x8C, 0x88, 0x83,
+    0x09, 0x8D, 0x42, 0x87, 0x0F, 0x85, 0x43, 0x84, 0x0F, 0x86, 0x44, 0x8B, 0x89, 0xC8, 0x86, 0x83,
+    0x06, 0x81, 0x4D, 0x8E, 0x86, 0x05, 0x85, 0x4E, 0x88, 0x04, 0x86, 0x8D, 0x4E, 0x82, 0x01, 0x83,
+    0x8E, 0x50, 0x88, 0x00, 0x82, 0x44, 0x88, 0x82, 0x04, 0x82, 0x86, 0x8E, 0x43, 0x8B, 0x00, 0x89,
+    0x43, 0x86, 0x08, 0x85, 0x43, 0x8B, 0x00, 0x8D, 0x43, 0x09, 0x84, 0x43, 0x8A, 0x00, 0x8D, 0x43,
+    0x83, 0x08, 0x8B, 0x43, 0x86, 0x00, 0x8B, 0x43, 0x8D, 0x83, 0x05, 0x85, 0x8D, 0x43, 0x8E, 0x81,
+    0x00, 0x85, 0x45, 0x8E, 0x8C, 0x9B, 0x8D, 0x46, 0x85, 0x02, 0x8A, 0x4F, 0x85, 0x04, 0x88, 0x4C,
+    0x8A, 0x82, 0x06, 0x81, 0x86, 0x8A, 0x8D, 0x8E, 0x41, 0x9E, 0x8B, 0x89, 0x85, 0x81, 0x05, 0x00,
+    0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44,
+    0x8A, 0x0E, 0x44, 0x89, 0x0E, 0x44, 0x89, 0x0E, 0x44, 0x88, 0x01, 0x85, 0x8B, 0x8E, 0x41, 0x8D,
+    0x89, 0x83, 0x04, 0x44, 0x87, 0x81, 0x8C, 0x47, 0x8A, 0x03, 0x44, 0x87, 0x8D, 0x49, 0x8A, 0x02,
+    0x51, 0x84, 0x01, 0x47, 0x8C, 0x99, 0x8D, 0x45, 0x8A, 0x01, 0x46, 0x85, 0x03, 0x88, 0x44, 0x8E,
+    0x01, 0x45, 0x87, 0x05, 0x8E, 0x44, 0x01, 0x45, 0x81, 0x05, 0x8A, 0x44, 0x81, 0x00, 0x44, 0x8D,
+    0x06, 0x89, 0x44, 0x82, 0x00, 0x44, 0x8B, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88,
+    0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82,
+    0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44,
+    0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06,
+    0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44,
+    0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x84, 0x8C, 0x40, 0x8E, 0x8A, 0x81, 0x00,
+    0x8E, 0x43, 0x89, 0x83, 0x44, 0x8D, 0x82, 0x44, 0x8C, 0x00, 0x8B, 0x43, 0x85, 0x01, 0x85, 0x88,
+    0x87, 0x82, 0x0F, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44,
+    0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A,
+    0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00,
+    0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44,
+    0x8A, 0x05, 0x84, 0x8C, 0x40, 0x8E, 0x8A, 0x81, 0x05, 0x8E, 0x43, 0x89, 0x04, 0x83, 0x44, 0x8D,
+    0x04, 0x82, 0x44, 0x8C, 0x05, 0x8B, 0x43, 0x85, 0x06, 0x85, 0x88, 0x87, 0x82, 0x1E, 0x44, 0x8A,
+    0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05,
+    0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44,
+    0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A,
+    0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x05, 0x44, 0x8A, 0x04,
+    0x81, 0x44, 0x8A, 0x04, 0x83, 0x44, 0x89, 0x04, 0x8A, 0x44, 0x88, 0x86, 0x8B, 0x99, 0x8D, 0x45,
+    0x84, 0x87, 0x48, 0x8E, 0x00, 0x87, 0x48, 0x84, 0x00, 0x87, 0x47, 0x85, 0x01, 0x84, 0x8B, 0x8E,
+    0x41, 0x8E, 0x8C, 0x87, 0x81, 0x02, 0x00, 0x44, 0x8A, 0x0F, 0x44, 0x8A, 0x0F, 0x44, 0x8A, 0x0F,
+    0x44, 0x8A, 0x0F, 0x44, 0x8A, 0x0F, 0x44, 0x8A, 0x0F, 0x44, 0x8A, 0x0F, 0x44, 0x8A, 0x0F, 0x44,
+    0x8A, 0x06, 0x8B, 0x44, 0x89, 0x01, 0x44, 0x8A, 0x05, 0x8A, 0x44, 0x8B, 0x02, 0x44, 0x8A, 0x04,
+    0x89, 0x44, 0x8C, 0x03, 0x44, 0x8A, 0x03, 0x87, 0x44, 0x8D, 0x81, 0x03, 0x44, 0x89, 0x02, 0x86,
+    0x44, 0x8E, 0x81, 0x04, 0x44, 0x89, 0x01, 0x85, 0x44, 0x8E, 0x82, 0x05, 0x44, 0x88, 0x00, 0x83,
+    0x45, 0x83, 0x06, 0x44, 0x87, 0x81, 0x8E, 0x44, 0x84, 0x07, 0x44, 0x86, 0x8B, 0x44, 0x85, 0x08,
+    0x44, 0x8D, 0x45, 0x82, 0x08, 0x4B, 0x8D, 0x08, 0x4C, 0x89, 0x07, 0x46, 0x9D, 0x44, 0x85, 0x06,
+    0x45, 0x8B, 0x00, 0x83, 0x44, 0x8E, 0x81, 0x05, 0x44, 0x8B, 0x02, 0x88, 0x44, 0x8C, 0x05, 0x44,
+    0x8A, 0x03, 0x8C, 0x44, 0x88, 0x04, 0x44, 0x8A, 0x03, 0x82, 0x45, 0x84, 0x03, 0x44, 0x8A, 0x04,
+    0x86, 0x44, 0x8E, 0x81, 0x02, 0x44, 0x8A, 0x05, 0x8B, 0x44, 0x8B, 0x02, 0x44, 0x8A, 0x05, 0x81,
+    0x8E, 0x44, 0x87, 0x01, 0x44, 0x8A, 0x06, 0x85, 0x45, 0x83, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A,
+    0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00,
+    0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44,
+    0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A,
+    0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00,
+    0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44, 0x8A, 0x00, 0x44,
+    0x8A, 0x00, 0x43, 0x86, 0x01, 0x81, 0x87, 0x8C, 0x8E, 0x40, 0x8E, 0x8C, 0x87, 0x82, 0x03, 0x81,
+    0x87, 0x8C, 0x8E, 0x40, 0x8E, 0x8C, 0x87, 0x81, 0x03, 0x43, 0x8A, 0x00, 0x84, 0x8E, 0x47, 0x86,
+    0x01, 0x86, 0x48, 0x85, 0x02, 0x43, 0x8E, 0x83, 0x4A, 0x84, 0x85, 0x4A, 0x83, 0x01, 0x5D, 0x8B,
+    0x01, 0x47, 0x8B, 0x89, 0x8A, 0x8E, 0x48, 0x8B, 0x88, 0x8A, 0x46, 0x81, 0x00, 0x46, 0x83, 0x02,
+    0x81, 0x8E, 0x45, 0x8E, 0x82, 0x02, 0x82, 0x45, 0x84, 0x00, 0x45, 0x86, 0x04, 0x87, 0x45, 0x84,
+    0x04, 0x88, 0x44, 0x86, 0x00, 0x45, 0x81, 0x04, 0x83, 0x44, 0x8E, 0x05, 0x85, 0x44, 0x87, 0x00,
+    0x44, 0x8D, 0x05, 0x82, 0x44, 0x8B, 0x05, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8B, 0x05, 0x81, 0x44,
+    0x89, 0x05, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8A, 0x05, 0x81, 0x44, 0x88, 0x05, 0x83, 0x44, 0x87,
+    0x00, 0x44, 0x8A, 0x05, 0x81, 0x44, 0x88, 0x05, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8A, 0x05, 0x81,
+    0x44, 0x88, 0x05, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8A, 0x05, 0x81, 0x44, 0x88, 0x05, 0x83, 0x44,
+    0x87, 0x00, 0x44, 0x8A, 0x05, 0x81, 0x44, 0x88, 0x05, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8A, 0x05,
+    0x81, 0x44, 0x88, 0x05, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8A, 0x05, 0x81, 0x44, 0x88, 0x05, 0x83,
+    0x44, 0x87, 0x00, 0x44, 0x8A, 0x05, 0x81, 0x44, 0x88, 0x05, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8A,
+    0x05, 0x81, 0x44, 0x88, 0x05, 0x83, 0x44, 0x87, 0x00, 0x44, 0x8A, 0x05, 0x81, 0x44, 0x88, 0x05,
+    0x83, 0x44, 0x87, 0x00, 0x44, 0x8A, 0x05, 0x81, 0x44, 0x88, 0x05, 0x83, 0x44, 0x87, 0x00, 0x43,
+    0x86, 0x02, 0x86, 0x8B, 0x8E, 0x41, 0x8D, 0x89, 0x83, 0x04, 0x43, 0x8A, 0x00, 0x84, 0x8D, 0x47,
+    0x8A, 0x03, 0x43, 0x8E, 0x83, 0x4A, 0x8A, 0x02, 0x51, 0x84, 0x01, 0x47, 0x8C, 0x99, 0x8C, 0x45,
+    0x8A, 0x01, 0x46, 0x84, 0x03, 0x88, 0x44, 0x8E, 0x01, 0x45, 0x87, 0x05, 0x8E, 0x44, 0x01, 0x45,
+    0x81, 0x05, 0x8A, 0x44, 0x81, 0x00, 0x44, 0x8D, 0x06, 0x89, 0x44, 0x82, 0x00, 0x44, 0x8B, 0x06,
+    0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44,
+    0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00,
+    0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A,
+    0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88,
+    0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82,
+    0x05, 0x84, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x8B, 0x86, 0x09, 0x83, 0x8C, 0x49, 0x87, 0x06, 0x85,
+    0x4C, 0x8B, 0x04, 0x83, 0x4E, 0x8A, 0x03, 0x8D, 0x45, 0x8B, 0x89, 0x8A, 0x8D, 0x45, 0x85, 0x01,
+    0x85, 0x44, 0x8D, 0x82, 0x03, 0x88, 0x44, 0x8D, 0x01, 0x8B, 0x44, 0x83, 0x05, 0x8B, 0x44, 0x83,
+    0x00, 0x44, 0x8D, 0x06, 0x85, 0x44, 0x88, 0x82, 0x44, 0x8A, 0x06, 0x82, 0x44, 0x8A, 0x83, 0x44,
+    0x88, 0x07, 0x44, 0x8C, 0x84, 0x44, 0x87, 0x07, 0x44, 0x8C, 0x84, 0x44, 0x88, 0x07, 0x44, 0x8C,
+    0x82, 0x44, 0x8A, 0x06, 0x82, 0x44, 0x8A, 0x00, 0x44, 0x8D, 0x06, 0x85, 0x44, 0x87, 0x00, 0x8B,
+    0x44, 0x84, 0x05, 0x8B, 0x44, 0x84, 0x00, 0x85, 0x44, 0x8E, 0x82, 0x03, 0x87, 0x44, 0x8D, 0x02,
+    0x8C, 0x45, 0x8B, 0x99, 0x8D, 0x45, 0x86, 0x02, 0x82, 0x4E, 0x8B, 0x04, 0x84, 0x4C, 0x8B, 0x81,
+    0x05, 0x82, 0x8B, 0x49, 0x88, 0x09, 0x83, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x8B, 0x86, 0x81, 0x04,
+    0x00, 0x43, 0x8B, 0x02, 0x86, 0x8B, 0x8E, 0x40, 0x8E, 0x8B, 0x86, 0x05, 0x44, 0x00, 0x82, 0x8C,
+    0x46, 0x8D, 0x82, 0x03, 0x44, 0x85, 0x8D, 0x48, 0x8E, 0x81, 0x02, 0x50, 0x8B, 0x02, 0x47, 0x8A,
+    0x88, 0x8A, 0x8E, 0x45, 0x83, 0x01, 0x45, 0x8D, 0x81, 0x02, 0x81, 0x8C, 0x44, 0x89, 0x01, 0x45,
+    0x83, 0x04, 0x82, 0x44, 0x8E, 0x01, 0x44, 0x8E, 0x06, 0x8C, 0x44, 0x81, 0x00, 0x44, 0x8B, 0x06,
+    0x89, 0x44, 0x83, 0x00, 0x44, 0x8A, 0x06, 0x87, 0x44, 0x84, 0x00, 0x44, 0x8A, 0x06, 0x87, 0x44,
+    0x85, 0x00, 0x44, 0x8A, 0x06, 0x87, 0x44, 0x84, 0x00, 0x44, 0x8C, 0x06, 0x89, 0x44, 0x82, 0x00,
+    0x45, 0x06, 0x8C, 0x44, 0x81, 0x00, 0x45, 0x85, 0x04, 0x82, 0x44, 0x8D, 0x01, 0x45, 0x8E, 0x83,
+    0x02, 0x81, 0x8D, 0x44, 0x88, 0x01, 0x47, 0x8B, 0x89, 0x8A, 0x46, 0x82, 0x01, 0x50, 0x8A, 0x02,
+    0x44, 0x8B, 0x49, 0x8D, 0x81, 0x02, 0x44, 0x87, 0x84, 0x8E, 0x46, 0x8C, 0x81, 0x03, 0x44, 0x88,
+    0x00, 0x81, 0x87, 0x8C, 0x8E, 0x40, 0x8E, 0x8B, 0x85, 0x05, 0x44, 0x89, 0x0E, 0x44, 0x8A, 0x0E,
+    0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44, 0x8A, 0x0E, 0x44,
+    0x8A, 0x0E, 0x44, 0x8A, 0x0D, 0x04, 0x85, 0x8A, 0x8E, 0x40, 0x8E, 0x8C, 0x87, 0x81, 0x01, 0x8C,
+    0x43, 0x81, 0x02, 0x81, 0x8B, 0x46, 0x8E, 0x84, 0x00, 0x44, 0x81, 0x01, 0x81, 0x8D, 0x49, 0x85,
+    0x44, 0x81, 0x01, 0x89, 0x50, 0x81, 0x00, 0x82, 0x46, 0x8B, 0x8A, 0x8B, 0x47, 0x81, 0x00, 0x88,
+    0x44, 0x8E, 0x82, 0x02, 0x81, 0x8B, 0x45, 0x81, 0x00, 0x8D, 0x44, 0x84, 0x05, 0x8E, 0x44, 0x81,
+    0x00, 0x44, 0x8E, 0x06, 0x88, 0x44, 0x81, 0x82, 0x44, 0x8A, 0x06, 0x85, 0x44, 0x81, 0x83, 0x44,
+    0x88, 0x06, 0x83, 0x44, 0x81, 0x84, 0x44, 0x87, 0x06, 0x83, 0x44, 0x81, 0x83, 0x44, 0x88, 0x06,
+    0x83, 0x44, 0x81, 0x83, 0x44, 0x89, 0x06, 0x84, 0x44, 0x81, 0x00, 0x44, 0x8D, 0x06, 0x87, 0x44,
+    0x81, 0x00, 0x8D, 0x44, 0x82, 0x05, 0x8C, 0x44, 0x81, 0x00, 0x89, 0x44, 0x8C, 0x81, 0x03, 0x87,
+    0x45, 0x81, 0x00, 0x83, 0x45, 0x8E, 0x89, 0x87, 0x88, 0x8C, 0x46, 0x81, 0x01, 0x8A, 0x50, 0x81,
+    0x01, 0x81, 0x8D, 0x48, 0x8E, 0x88, 0x44, 0x81, 0x02, 0x82, 0x8C, 0x46, 0x8D, 0x83, 0x87, 0x44,
+    0x81, 0x04, 0x86, 0x8B, 0x8E, 0x40, 0x8E, 0x8C, 0x86, 0x01, 0x88, 0x44, 0x81, 0x0D, 0x89, 0x44,
+    0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44,
+    0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44, 0x81, 0x0D, 0x89, 0x44,
+    0x81, 0x00, 0x43, 0x85, 0x02, 0x83, 0x8A, 0x8E, 0x41, 0x85, 0x00, 0x43, 0x89, 0x01, 0x88, 0x44,
+    0x85, 0x00, 0x43, 0x8C, 0x00, 0x89, 0x45, 0x84, 0x00, 0x44, 0x86, 0x46, 0x83, 0x00, 0x4C, 0x81,
+    0x00, 0x47, 0x8D, 0x88, 0x95, 0x86, 0x01, 0x46, 0x86, 0x06, 0x45, 0x87, 0x07, 0x45, 0x08, 0x44,
+    0x8B, 0x08, 0x44, 0x8A, 0x08, 0x44, 0x8A, 0x08, 0x44, 0x8A, 0x08, 0x44, 0x8A, 0x08, 0x44, 0x8A,
+    0x08, 0x44, 0x8A, 0x08, 0x44, 0x8A, 0x08, 0x44, 0x8A, 0x08, 0x44, 0x8A, 0x08, 0x44, 0x8A, 0x08,
+    0x44, 0x8A, 0x07, 0x03, 0x85, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x85, 0x81, 0x03, 0x83,
+    0x8D, 0x4A, 0x8A, 0x01, 0x83, 0x4C, 0x8D, 0x01, 0x8D, 0x4C, 0x86, 0x00, 0x82, 0x44, 0x8D, 0x85,
+    0x93, 0x85, 0x89, 0x8E, 0x41, 0x01, 0x84, 0x44, 0x86, 0x05, 0x85, 0x86, 0x01, 0x83, 0x44, 0x8C,
+    0x81, 0x08, 0x81, 0x46, 0x88, 0x82, 0x07, 0x8A, 0x47, 0x8B, 0x85, 0x05, 0x81, 0x8D, 0x48, 0x8D,
+    0x85, 0x04, 0x81, 0x8A, 0x49, 0x8A, 0x05, 0x82, 0x8A, 0x48, 0x88, 0x06, 0x81, 0x87, 0x8E, 0x46,
+    0x81, 0x08, 0x87, 0x45, 0x85, 0x09, 0x85, 0x44, 0x86, 0x83, 0x89, 0x83, 0x06, 0x83, 0x44, 0x85,
+    0x84, 0x41, 0x8E, 0x89, 0x86, 0x83, 0x82, 0x83, 0x85, 0x8D, 0x44, 0x82, 0x84, 0x4D, 0x8B, 0x00,
+    0x84, 0x4C, 0x8E, 0x82, 0x00, 0x83, 0x4B, 0x8C, 0x82, 0x02, 0x81, 0x86, 0x8A, 0x8C, 0x8E, 0x42,
+    0x8E, 0x8C, 0x88, 0x83, 0x03, 0x04, 0x83, 0xA6, 0x81, 0x0A, 0x8B, 0x42, 0x83, 0x09, 0x81, 0x43,
+    0x83, 0x09, 0x87, 0x43, 0x83, 0x09, 0x8D, 0x43, 0x83, 0x07, 0x82, 0x8B, 0x4A, 0x01, 0x88, 0x4C,
+    0x00, 0x82, 0x4D, 0x00, 0x82, 0x4D, 0x01, 0x94, 0x89, 0x44, 0x86, 0xC4, 0x03, 0x86, 0x44, 0x83,
+    0x08, 0x86, 0x44, 0x83, 0x08, 0x86, 0x44, 0x83, 0x08, 0x86, 0x44, 0x83, 0x08, 0x86, 0x44, 0x83,
+    0x08, 0x86, 0x44, 0x83, 0x08, 0x86, 0x44, 0x83, 0x08, 0x86, 0x44, 0x83, 0x08, 0x86, 0x44, 0x83,
+    0x08, 0x86, 0x44, 0x84, 0x08, 0x85, 0x44, 0x8A, 0x08, 0x82, 0x45, 0x8C, 0x88, 0x89, 0x8B, 0x40,
+    0x84, 0x03, 0x8E, 0x49, 0x84, 0x03, 0x86, 0x49, 0x84, 0x04, 0x89, 0x48, 0x84, 0x05, 0x84, 0x8A,
+    0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x84, 0x00, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88,
+    0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82,
+    0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A,
+    0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8A, 0x44, 0x82, 0x44, 0x88,
+    0x06, 0x8A, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8B, 0x44, 0x82, 0x44, 0x88, 0x06, 0x8B, 0x44, 0x82,
+    0x44, 0x88, 0x06, 0x8E, 0x44, 0x82, 0x44, 0x8A, 0x05, 0x81, 0x45, 0x81, 0x44, 0x8E, 0x05, 0x88,
+    0x45, 0x00, 0x45, 0x87, 0x03, 0x85, 0x46, 0x00, 0x8B, 0x45, 0x8C, 0x88, 0x89, 0x8C, 0x47, 0x00,
+    0x84, 0x51, 0x01, 0x8B, 0x4A, 0x83, 0x44, 0x02, 0x8B, 0x47, 0x8D, 0x83, 0x00, 0x8B, 0x43, 0x03,
+    0x84, 0x8A, 0x8D, 0x41, 0x8E, 0x8B, 0x86, 0x02, 0x87, 0x43, 0x8D, 0x44, 0x81, 0x07, 0x87, 0x44,
+    0x86, 0x87, 0x44, 0x86, 0x07, 0x8C, 0x44, 0x91, 0x44, 0x8C, 0x06, 0x82, 0x44, 0x8A, 0x01, 0x8A,
+    0x44, 0x81, 0x05, 0x87, 0x44, 0x84, 0x01, 0x84, 0x44, 0x86, 0x05, 0x8C, 0x43, 0x8E, 0x03, 0x8E,
+    0x43, 0x8C, 0x04, 0x81, 0x44, 0x88, 0x03, 0x88, 0x44, 0x81, 0x03, 0x87, 0x44, 0x82, 0x03, 0x82,
+    0x44, 0x86, 0x03, 0x8C, 0x43, 0x8C, 0x05, 0x8C, 0x43, 0x8C, 0x02, 0x81, 0x44, 0x86, 0x05, 0x86,
+    0x44, 0x81, 0x01, 0x87, 0x44, 0x81, 0x05, 0x81, 0x44, 0x86, 0x01, 0x8C, 0x43, 0x8A, 0x07, 0x8A,
+    0x43, 0x8C, 0x00, 0x81, 0x44, 0x84, 0x07, 0x84, 0x44, 0x00, 0x86, 0x43, 0x8E, 0x09, 0x8E, 0x43,
+    0x84, 0x8A, 0x43, 0x88, 0x09, 0x88, 0x43, 0x88, 0x8E, 0x43, 0x82, 0x09, 0x82, 0x43, 0x8A, 0x43,
+    0x8C, 0x0B, 0x8C, 0x47, 0x86, 0x0B, 0x86, 0x47, 0x81, 0x0B, 0x81, 0x46, 0x8A, 0x0D, 0x8A, 0x45,
+    0x84, 0x0D, 0x84, 0x44, 0x8E, 0x07, 0x87, 0x44, 0x82, 0x05, 0x8E, 0x44, 0x88, 0x05, 0x88, 0x44,
+    0x00, 0x83, 0x44, 0x86, 0x04, 0x83, 0x45, 0x8C, 0x05, 0x8C, 0x43, 0x8B, 0x01, 0x8E, 0x43, 0x8A,
+    0x04, 0x87, 0x46, 0x04, 0x81, 0x44, 0x87, 0x01, 0x8A, 0x43, 0x8E, 0x04, 0x8B, 0x46, 0x84, 0x03,
+    0x85, 0x44, 0x82, 0x01, 0x85, 0x44, 0x82, 0x03, 0x43, 0x8D, 0x42, 0x88, 0x03, 0x89, 0x43, 0x8E,
+    0x02, 0x81, 0x44, 0x86, 0x02, 0x83, 0x42, 0x8E, 0x87, 0x42, 0x8C, 0x03, 0x8D, 0x43, 0x89, 0x03,
+    0x8C, 0x43, 0x8A, 0x02, 0x87, 0x42, 0x8A, 0x83, 0x43, 0x02, 0x82, 0x44, 0x84, 0x03, 0x88, 0x43,
+    0x8E, 0x02, 0x8B, 0x42, 0x86, 0x00, 0x43, 0x83, 0x01, 0x86, 0x44, 0x04, 0x83, 0x44, 0x83, 0x01,
+    0x43, 0x83, 0x00, 0x8C, 0x42, 0x87, 0x01, 0x8A, 0x43, 0x8B, 0x05, 0x44, 0x87, 0x00, 0x83, 0x43,
+    0x01, 0x88, 0x42, 0x8B, 0x01, 0x8E, 0x43, 0x87, 0x05, 0x8A, 0x43, 0x8A, 0x00, 0x87, 0x42, 0x8B,
+    0x01, 0x85, 0x43, 0x00, 0x81, 0x44, 0x82, 0x05, 0x86, 0x43, 0x8D, 0x00, 0x8A, 0x42, 0x88, 0x01,
+    0x81, 0x43, 0x82, 0x84, 0x43, 0x8E, 0x06, 0x81, 0x44, 0x00, 0x8C, 0x42, 0x84, 0x02, 0x8D, 0x42,
+    0x84, 0x87, 0x43, 0x89, 0x07, 0x8D, 0x43, 0x83, 0x43, 0x81, 0x02, 0x89, 0x42, 0x87, 0x8A, 0x43,
+    0x85, 0x07, 0x88, 0x43, 0x87, 0x42, 0x8D, 0x03, 0x86, 0x42, 0x89, 0x8D, 0x43, 0x08, 0x84, 0x43,
+    0x8B, 0x42, 0x89, 0x03, 0x82, 0x42, 0x8C, 0x43, 0x8B, 0x09, 0x47, 0x86, 0x04, 0x47, 0x87, 0x09,
+    0x8B, 0x46, 0x82, 0x04, 0x8B, 0x46, 0x82, 0x09, 0x87, 0x45, 0x8E, 0x05, 0x88, 0x45, 0x8E, 0x0A,
+    0x82, 0x45, 0x8B, 0x05, 0x85, 0x45, 0x89, 0x0B, 0x8D, 0x44, 0x87, 0x05, 0x81, 0x45, 0x85, 0x05,
+    0x82, 0x45, 0x84, 0x05, 0x84, 0x45, 0x82, 0x00, 0x87, 0x44, 0x8D, 0x05, 0x8D, 0x44, 0x87, 0x02,
+    0x8D, 0x44, 0x87, 0x03, 0x87, 0x44, 0x8C, 0x03, 0x83, 0x45, 0x81, 0x01, 0x81, 0x45, 0x83, 0x04,
+    0x88, 0x44, 0x8A, 0x01, 0x8A, 0x44, 0x88, 0x06, 0x8D, 0x44, 0x83, 0x84, 0x44, 0x8D, 0x07, 0x83,
+    0x44, 0x9D, 0x44, 0x83, 0x08, 0x89, 0x49, 0x88, 0x0A, 0x8E, 0x47, 0x8D, 0x0B, 0x84, 0x47, 0x83,
+    0x0C, 0x8E, 0x45, 0x8E, 0x0C, 0x89, 0x47, 0x88, 0x0A, 0x83, 0x49, 0x83, 0x09, 0x8D, 0x49, 0x8D,
+    0x08, 0x88, 0x44, 0x88, 0x89, 0x44, 0x87, 0x06, 0x83, 0x44, 0x8E, 0x01, 0x8E, 0x44, 0x82, 0x05,
+    0x8D, 0x44, 0x85, 0x01, 0x85, 0x44, 0x8C, 0x04, 0x88, 0x44, 0x8B, 0x03, 0x8C, 0x44, 0x87, 0x02,
+    0x83, 0x45, 0x82, 0x03, 0x82, 0x45, 0x82, 0x01, 0x8C, 0x44, 0x88, 0x05, 0x89, 0x44, 0x8C, 0x00,
+    0x87, 0x44, 0x8D, 0x07, 0x8E, 0x44, 0x87, 0x8C, 0x44, 0x85, 0x07, 0x89, 0x44, 0x96, 0x44, 0x8B,
+    0x07, 0x8E, 0x44, 0x81, 0x00, 0x45, 0x06, 0x84, 0x44, 0x8A, 0x01, 0x8A, 0x44, 0x85, 0x05, 0x89,
+    0x44, 0x84, 0x01, 0x83, 0x44, 0x8A, 0x05, 0x8E, 0x43, 0x8E, 0x03, 0x8D, 0x44, 0x04, 0x83, 0x44,
+    0x89, 0x03, 0x87, 0x44, 0x85, 0x03, 0x88, 0x44, 0x83, 0x03, 0x81, 0x44, 0x8A, 0x03, 0x8D, 0x43,
+    0x8D, 0x05, 0x8A, 0x44, 0x02, 0x82, 0x44, 0x87, 0x05, 0x84, 0x44, 0x84, 0x01, 0x88, 0x44, 0x81,
+    0x06, 0x8E, 0x43, 0x89, 0x01, 0x8D, 0x43, 0x8B, 0x07, 0x87, 0x43, 0x8E, 0x00, 0x82, 0x44, 0x85,
+    0x07, 0x81, 0x44, 0x83, 0x87, 0x43, 0x8E, 0x09, 0x8B, 0x43, 0x87, 0x8B, 0x43, 0x89, 0x09, 0x85,
+    0x43, 0x8A, 0x8E, 0x43, 0x83, 0x0A, 0x8E, 0x42, 0x8D, 0x43, 0x8D, 0x0B, 0x88, 0x47, 0x87, 0x0B,
+    0x82, 0x47, 0x81, 0x0C, 0x8B, 0x45, 0x8B, 0x0D, 0x85, 0x45, 0x85, 0x0E, 0x8E, 0x44, 0x0F, 0x8E,
+    0x43, 0x89, 0x0E, 0x85, 0x44, 0x83, 0x0E, 0x8D, 0x43, 0x8D, 0x0D, 0x81, 0x8C, 0x44, 0x87, 0x09,
+    0x88, 0x8A, 0x89, 0x8B, 0x45, 0x8E, 0x0A, 0x8B, 0x48, 0x85, 0x0A, 0x8B, 0x47, 0x87, 0x0B, 0x8B,
+    0x45, 0x8E, 0x85, 0x0C, 0x88, 0x8E, 0x41, 0x8E, 0x8B, 0x86, 0x0D, 0x86, 0x4E, 0x81, 0x86, 0x4E,
+    0x81, 0x86, 0x4E, 0x81, 0x86, 0x4E, 0x00, 0x82, 0xF5, 0x8B, 0x44, 0x87, 0x08, 0x83, 0x44, 0x8C,
+    0x08, 0x81, 0x8E, 0x43, 0x8E, 0x81, 0x08, 0x8A, 0x44, 0x85, 0x08, 0x86, 0x44, 0x89, 0x08, 0x82,
+    0x44, 0x8D, 0x09, 0x8C, 0x44, 0x83, 0x08, 0x88, 0x44, 0x87, 0x08, 0x84, 0x44, 0x8B, 0x08, 0x81,
+    0x8E, 0x43, 0x8E, 0x81, 0x08, 0x8B, 0x44, 0x84, 0x08, 0x86, 0x44, 0x88, 0x08, 0x82, 0x45, 0xF5,
+    0x85, 0x82, 0x8D, 0x4E, 0x86, 0x4F, 0x86, 0x4F, 0x86, 0x4F, 0x86, 0x06, 0x81, 0x86, 0x8A, 0x8D,
+    0x8E, 0x40, 0x87, 0x05, 0x84, 0x45, 0x87, 0x04, 0x81, 0x46, 0x87, 0x04, 0x87, 0x46, 0x87, 0x04,
+    0x89, 0x44, 0x88, 0x84, 0x81, 0x04, 0x8A, 0x43, 0x88, 0x07, 0x8A, 0x43, 0x84, 0x07, 0x8A, 0x43,
+    0x83, 0x07, 0x8A, 0x43, 0x83, 0x07, 0x8A, 0x43, 0x83, 0x07, 0x8A, 0x43, 0x83, 0x07, 0x8B, 0x43,
+    0x83, 0x06, 0x81, 0x44, 0x83, 0x05, 0x83, 0x8C, 0x44, 0x03, 0x84, 0x8C, 0x8E, 0x45, 0x88, 0x03,
+    0x86, 0x46, 0x87, 0x04, 0x86, 0x44, 0x88, 0x81, 0x05, 0x86, 0x46, 0x88, 0x04, 0x85, 0x8C, 0x8E,
+    0x45, 0x89, 0x06, 0x84, 0x8D, 0x44, 0x81, 0x06, 0x81, 0x44, 0x83, 0x07, 0x8B, 0x43, 0x83, 0x07,
+    0x8A, 0x43, 0x83, 0x07, 0x8A, 0x43, 0x83, 0x07, 0x8A, 0x43, 0x83, 0x07, 0x8A, 0x43, 0x83, 0x07,
+    0x8A, 0x43, 0x84, 0x07, 0x8A, 0x43, 0x88, 0x07, 0x89, 0x44, 0x89, 0x84, 0x81, 0x04, 0x87, 0x46,
+    0x87, 0x04, 0x81, 0x46, 0x87, 0x05, 0x84, 0x45, 0x87, 0x06, 0x81, 0x86, 0x8A, 0x8D, 0x8E, 0x40,
+    0x87, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88,
+    0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89,
+    0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42,
+    0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88,
+    0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89,
+    0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42,
+    0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88, 0x89, 0x42, 0x88,
+    0x89, 0x42, 0x88, 0x87, 0x40, 0x8E, 0x8D, 0x8B, 0x87, 0x81, 0x06, 0x87, 0x45, 0x86, 0x05, 0x87,
+    0x46, 0x81, 0x04, 0x87, 0x46, 0x87, 0x04, 0x81, 0x84, 0x88, 0x44, 0x89, 0x07, 0x88, 0x43, 0x8A,
+    0x07, 0x84, 0x43, 0x8A, 0x07, 0x84, 0x43, 0x8A, 0x07, 0x84, 0x43, 0x8A, 0x07, 0x84, 0x43, 0x8A,
+    0x07, 0x84, 0x43, 0x8A, 0x07, 0x84, 0x43, 0x8B, 0x07, 0x83, 0x43, 0x8E, 0x07, 0x81, 0x44, 0x8B,
+    0x82, 0x06, 0x88, 0x45, 0x8D, 0x8B, 0x84, 0x04, 0x87, 0x46, 0x86, 0x05, 0x81, 0x88, 0x44, 0x86,
+    0x04, 0x88, 0x46, 0x86, 0x03, 0x8A, 0x45, 0x8E, 0x8C, 0x84, 0x02, 0x81, 0x44, 0x8C, 0x83, 0x05,
+    0x83, 0x44, 0x81, 0x06, 0x84, 0x43, 0x8B, 0x07, 0x84, 0x43, 0x8A, 0x07, 0x84, 0x43, 0x8A, 0x07,
+    0x84, 0x43, 0x8A, 0x07, 0x84, 0x43, 0x8A, 0x07, 0x84, 0x43, 0x8A, 0x07, 0x89, 0x43, 0x8A, 0x04,
+    0x81, 0x84, 0x88, 0x44, 0x89, 0x04, 0x87, 0x46, 0x87, 0x04, 0x87, 0x46, 0x82, 0x04, 0x87, 0x45,
+    0x85, 0x05, 0x87, 0x41, 0x8D, 0x8B, 0x87, 0x81, 0x06, 0x15, 0x82, 0x89, 0x8E, 0x40, 0x8E, 0x8B,
+    0x85, 0x08, 0x86, 0x01, 0x84, 0x46, 0x8E, 0x86, 0x05, 0x85, 0x40, 0x81, 0x82, 0x49, 0x8E, 0x88,
+    0x83, 0x81, 0x83, 0x8A, 0x41, 0x81, 0x85, 0x51, 0x81, 0x85, 0x41, 0x88, 0x82, 0x81, 0x84, 0x8A,
+    0x49, 0x8C, 0x00, 0x85, 0x8E, 0x83, 0x04, 0x81, 0x89, 0x46, 0x8D, 0x81, 0x00, 0x84, 0x82, 0x07,
+    0x81, 0x88, 0x8C, 0x41, 0x8D, 0x87, 0x16, 0x03, 0x85, 0x8C, 0x8E, 0x40, 0x8C, 0x87, 0x81, 0x04,
+    0x81, 0x8C, 0x45, 0x8E, 0x83, 0x03, 0x8D, 0x48, 0x82, 0x01, 0x88, 0x43, 0x8A, 0x89, 0x8E, 0x42,
+    0x8C, 0x01, 0x8E, 0x41, 0x8E, 0x82, 0x02, 0x8C, 0x42, 0x83, 0x82, 0x42, 0x87, 0x03, 0x83, 0x42,
+    0x86, 0x84, 0x42, 0x84, 0x04, 0x42, 0x88, 0x83, 0x42, 0x87, 0x03, 0x83, 0x42, 0x86, 0x00, 0x42,
+    0x8E, 0x82, 0x02, 0x8C, 0x42, 0x83, 0x00, 0x89, 0x43, 0x8A, 0x89, 0x8E, 0x42, 0x8C, 0x01, 0x81,
+    0x8D, 0x48, 0x82, 0x02, 0x82, 0x8D, 0x45, 0x8E, 0x84, 0x05, 0x87, 0x8C, 0x41, 0x8D, 0x88, 0x81,
+    0x02, 0x0D, 0x8C, 0x44, 0x8B, 0x12, 0x88, 0x44, 0x8A, 0x12, 0x84, 0x44, 0x87, 0x12, 0x82, 0x44,
+    0x84, 0x12, 0x81, 0x8D, 0x42, 0x8D, 0x82, 0x13, 0x8B, 0x42, 0x89, 0x3F, 0x08, 0x81, 0x85, 0x89,
+    0x8C, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x82, 0x0C, 0x81, 0x89, 0x4B, 0x8B, 0x83, 0x09, 0x85,
+    0x4F, 0x88, 0x07, 0x87, 0x51, 0x8A, 0x05, 0x84, 0x48, 0x9D, 0x8E, 0x47, 0x87, 0x04, 0x8E, 0x45,
+    0x8B, 0x83, 0x03, 0x82, 0x88, 0x46, 0x83, 0x02, 0x86, 0x45, 0x87, 0x07, 0x83, 0x45, 0x8A, 0x02,
+    0x8D, 0x44, 0x8A, 0x09, 0x86, 0x45, 0x81, 0x00, 0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x86, 0x00,
+    0x86, 0x44, 0x8B, 0x0B, 0x88, 0x44, 0x89, 0x00, 0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8D, 0x00,
+    0x8A, 0x44, 0x85, 0x0B, 0x81, 0x44, 0x8E, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8C, 0x44,
+    0x83, 0x0C, 0x45, 0x00, 0x8B, 0x44, 0x84, 0x0C, 0x45, 0x00, 0x8A, 0x44, 0x85, 0x0B, 0x81, 0x44,
+    0x8E, 0x00, 0x89, 0x44, 0x88, 0x0B, 0x84, 0x44, 0x8C, 0x00, 0x85, 0x44, 0x8C, 0x0B, 0x88, 0x44,
+    0x89, 0x00, 0x82, 0x45, 0x81, 0x0A, 0x8D, 0x44, 0x85, 0x01, 0x8D, 0x44, 0x8A, 0x09, 0x86, 0x45,
+    0x81, 0x01, 0x86, 0x45, 0x87, 0x07, 0x84, 0x45, 0x8A, 0x03, 0x8E, 0x45, 0x8B, 0x84, 0x03, 0x82,
+    0x89, 0x46, 0x82, 0x03, 0x83, 0x48, 0x8E, 0x8D, 0x48, 0x87, 0x05, 0x86, 0x51, 0x8A, 0x07, 0x84,
+    0x4F, 0x87, 0x09, 0x81, 0x89, 0x4B, 0x8B, 0x83, 0x0C, 0x81, 0x85, 0x89, 0x8C, 0x8E, 0x41, 0x8E,
+    0x8D, 0x8A, 0x86, 0x82, 0x07, 0x04, 0x89, 0x8E, 0x8D, 0x86, 0x02, 0x84, 0x8C, 0x8E, 0x8B, 0x82,
+    0x06, 0x87, 0x43, 0x83, 0x01, 0x43, 0x8C, 0x06, 0x8A, 0x43, 0x87, 0x00, 0x83, 0x44, 0x06, 0x88,
+    0x43, 0x84, 0x00, 0x81, 0x43, 0x8C, 0x07, 0x8A, 0x40, 0x8E, 0x87, 0x02, 0x85, 0x8D, 0x40, 0x8C,
+    0x82, 0x3F, 0x03, 0x84, 0x88, 0x8B, 0x8E, 0x42, 0x8D, 0x8A, 0x86, 0x06, 0x81, 0x88, 0x4B, 0x86,
+    0x04, 0x82, 0x4D, 0x88, 0x04, 0x8A, 0x4D, 0x83, 0x03, 0x83, 0x41, 0x8E, 0x89, 0x86, 0x93, 0x86,
+    0x8D, 0x44, 0x8A, 0x04, 0x87, 0x84, 0x05, 0x81, 0x8E, 0x43, 0x8E, 0x0D, 0x8A, 0x44, 0x0D, 0x88,
+    0x44, 0x81, 0x04, 0x84, 0x88, 0x8A, 0x8C, 0x8D, 0x8E, 0x47, 0x81, 0x02, 0x87, 0x8E, 0x4D, 0x81,
+    0x00, 0x81, 0x8C, 0x4F, 0x81, 0x00, 0x8A, 0x45, 0x8D, 0x88, 0x86, 0x95, 0x8A, 0x44, 0x91, 0x45,
+    0x85, 0x04, 0x88, 0x44, 0x81, 0x84, 0x44, 0x89, 0x05, 0x89, 0x44, 0x81, 0x86, 0x44, 0x86, 0x05,
+    0x8D, 0x44, 0x81, 0x85, 0x44, 0x89, 0x04, 0x87, 0x45, 0x81, 0x82, 0x45, 0x88, 0x83, 0x82, 0x84,
+    0x8B, 0x46, 0x81, 0x00, 0x8D, 0x50, 0x81, 0x00, 0x85, 0x4A, 0x84, 0x8B, 0x43, 0x81, 0x01, 0x87,
+    0x47, 0x8E, 0x84, 0x00, 0x85, 0x43, 0x81, 0x02, 0x82, 0x89, 0x8D, 0x41, 0x8E, 0x8B, 0x87, 0x81,
+    0x02, 0x43, 0x81, 0x0A, 0x85, 0x45, 0x83, 0x0B, 0x81, 0x8E, 0x43, 0x8E, 0x83, 0x0C, 0x8C, 0x43,
+    0x8C, 0x81, 0x0C, 0x8A, 0x43, 0x8A, 0x0D, 0x87, 0x43, 0x87, 0x0D, 0x83, 0x42, 0x8E, 0x83, 0x37,
+    0x84, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x8B, 0x86, 0x09, 0x83, 0x8C, 0x49, 0x87, 0x06, 0x85, 0x4C,
+    0x8B, 0x04, 0x83, 0x4E, 0x8A, 0x03, 0x8D, 0x45, 0x8B, 0x89, 0x8A, 0x8D, 0x45, 0x85, 0x01, 0x85,
+    0x44, 0x8D, 0x82, 0x03, 0x88, 0x44, 0x8D, 0x01, 0x8B, 0x44, 0x83, 0x05, 0x8B, 0x44, 0x83, 0x00,
+    0x44, 0x8D, 0x06, 0x85, 0x44, 0x88, 0x82, 0x44, 0x8A, 0x06, 0x82, 0x44, 0x8A, 0x83, 0x44, 0x88,
+    0x07, 0x44, 0x8C, 0x84, 0x44, 0x87, 0x07, 0x44, 0x8C, 0x84, 0x44, 0x88, 0x07, 0x44, 0x8C, 0x82,
+    0x44, 0x8A, 0x06, 0x82, 0x44, 0x8A, 0x00, 0x44, 0x8D, 0x06, 0x85, 0x44, 0x87, 0x00, 0x8B, 0x44,
+    0x84, 0x05, 0x8B, 0x44, 0x84, 0x00, 0x85, 0x44, 0x8E, 0x82, 0x03, 0x87, 0x44, 0x8D, 0x02, 0x8C,
+    0x45, 0x8B, 0x99, 0x8D, 0x45, 0x86, 0x02, 0x82, 0x4E, 0x8B, 0x04, 0x84, 0x4C, 0x8B, 0x81, 0x05,
+    0x82, 0x8B, 0x49, 0x88, 0x09, 0x83, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x8B, 0x86, 0x81, 0x04, 0x08,
+    0x89, 0x45, 0x8C, 0x12, 0x8E, 0x46, 0x82, 0x10, 0x84, 0x47, 0x87, 0x10, 0x8A, 0x47, 0x8D, 0x10,
+    0x44, 0x8D, 0x43, 0x83, 0x0E, 0x86, 0x43, 0x8C, 0x88, 0x43, 0x89, 0x0E, 0x8B, 0x43, 0x87, 0x84,
+    0x43, 0x8E, 0x0D, 0x81, 0x44, 0x83, 0x00, 0x8E, 0x43, 0x84, 0x0C, 0x87, 0x43, 0x8E, 0x01, 0x8A,
+    0x43, 0x8A, 0x0C, 0x8C, 0x43, 0x89, 0x01, 0x85, 0x44, 0x0B, 0x82, 0x44, 0x84, 0x02, 0x44, 0x85,
+    0x0A, 0x88, 0x44, 0x03, 0x8B, 0x43, 0x8B, 0x0A, 0x8D, 0x43, 0x8A, 0x03, 0x86, 0x44, 0x81, 0x08,
+    0x83, 0x44, 0x86, 0x03, 0x81, 0x44, 0x86, 0x08, 0x89, 0x44, 0x81, 0x04, 0x8C, 0x43, 0x8C, 0x08,
+    0x8E, 0x43, 0x8C, 0x05, 0x87, 0x44, 0x82, 0x06, 0x84, 0x51, 0x87, 0x06, 0x8A, 0x51, 0x8D, 0x06,
+    0x53, 0x83, 0x04, 0x85, 0x53, 0x88, 0x04, 0x8B, 0x44, 0xFD, 0x9D, 0x44, 0x8E, 0x03, 0x81, 0x44,
+    0x8E, 0x09, 0x8B, 0x44, 0x84, 0x02, 0x86, 0x44, 0x8A, 0x09, 0x86, 0x44, 0x89, 0x02, 0x8C, 0x44,
+    0x85, 0x09, 0x81, 0x45, 0x01, 0x81, 0x45, 0x0B, 0x8C, 0x44, 0x85, 0x00, 0x87, 0x44, 0x8A, 0x0B,
+    0x87, 0x44, 0x8A, 0x00, 0x8D, 0x44, 0x85, 0x0B, 0x82, 0x45, 0x81, 0x12, 0x89, 0x41, 0x8C, 0x81,
+    0x14, 0x8B, 0x41, 0x8D, 0x81, 0x14, 0x88, 0x42, 0x82, 0x14, 0x81, 0x42, 0x8B, 0x15, 0x83, 0x42,
+    0x8B, 0x15, 0x83, 0x43, 0x88, 0x86, 0x88, 0x82, 0x12, 0x8E, 0x45, 0x84, 0x12, 0x85, 0x45, 0x84,
+    0x13, 0x83, 0x8B, 0x8E, 0x40, 0x8E, 0x8B, 0x82, 0x01, 0x04, 0x84, 0x88, 0x8B, 0x8E, 0x42, 0x8D,
+    0x8A, 0x86, 0x06, 0x81, 0x88, 0x4B, 0x86, 0x04, 0x82, 0x4D, 0x88, 0x04, 0x8A, 0x4D, 0x83, 0x03,
+    0x83, 0x41, 0x8E, 0x89, 0x86, 0x93, 0x86, 0x8D, 0x44, 0x8A, 0x04, 0x87, 0x84, 0x05, 0x81, 0x8E,
+    0x43, 0x8E, 0x0D, 0x8A, 0x44, 0x0D, 0x88, 0x44, 0x81, 0x04, 0x84, 0x88, 0x8A, 0x8C, 0x8D, 0x8E,
+    0x47, 0x81, 0x02, 0x87, 0x8E, 0x4D, 0x81, 0x00, 0x81, 0x8C, 0x4F, 0x81, 0x00, 0x8A, 0x45, 0x8D,
+    0x88, 0x86, 0x95, 0x8A, 0x44, 0x91, 0x45, 0x85, 0x04, 0x88, 0x44, 0x81, 0x84, 0x44, 0x89, 0x05,
+    0x89, 0x44, 0x81, 0x86, 0x44, 0x86, 0x05, 0x8D, 0x44, 0x81, 0x85, 0x44, 0x89, 0x04, 0x87, 0x45,
+    0x81, 0x82, 0x45, 0x88, 0x83, 0x82, 0x84, 0x8B, 0x46, 0x81, 0x00, 0x8D, 0x50, 0x81, 0x00, 0x85,
+    0x4A, 0x84, 0x8B, 0x43, 0x81, 0x01, 0x87, 0x47, 0x8E, 0x84, 0x00, 0x85, 0x43, 0x81, 0x02, 0x82,
+    0x89, 0x8D, 0x41, 0x8E, 0x8B, 0x87, 0x81, 0x02, 0x43, 0x81, 0x0D, 0x87, 0x41, 0x8E, 0x82, 0x0D,
+    0x89, 0x41, 0x8E, 0x82, 0x0D, 0x86, 0x42, 0x85, 0x0E, 0x8E, 0x41, 0x8E, 0x0E, 0x81, 0x42, 0x8D,
+    0x0F, 0x43, 0x89, 0x86, 0x88, 0x84, 0x0B, 0x8C, 0x45, 0x86, 0x0B, 0x83, 0x45, 0x86, 0x0C, 0x82,
+    0x8A, 0x8E, 0x40, 0x8E, 0x8C, 0x84, 0x0C, 0x8D, 0x44, 0x89, 0x0C, 0x89, 0x44, 0x88, 0x0C, 0x86,
+    0x44, 0x86, 0x0C, 0x83, 0x43, 0x8E, 0x83, 0x0C, 0x82, 0x8E, 0x42, 0x8C, 0x81, 0x0D, 0x8C, 0x42,
+    0x88, 0x38, 0x85, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x85, 0x08, 0x88, 0x4B, 0x8A, 0x83,
+    0x03, 0x83, 0x8D, 0x4D, 0x8A, 0x02, 0x84, 0x4F, 0x83, 0x01, 0x82, 0x8E, 0x46, 0x8E, 0x9D, 0x44,
+    0x8D, 0x02, 0x8B, 0x45, 0x8B, 0x83, 0x03, 0x83, 0x88, 0x8E, 0x40, 0x87, 0x01, 0x84, 0x45, 0x87,
+    0x08, 0x85, 0x81, 0x01, 0x8B, 0x44, 0x8A, 0x0C, 0x81, 0x45, 0x81, 0x0C, 0x85, 0x44, 0x8B, 0x0D,
+    0x88, 0x44, 0x87, 0x0D, 0x8A, 0x44, 0x84, 0x0D, 0x8C, 0x44, 0x82, 0x0D, 0x8C, 0x44, 0x82, 0x0D,
+    0x8B, 0x44, 0x82, 0x0D, 0x8A, 0x44, 0x83, 0x0D, 0x89, 0x44, 0x86, 0x0D, 0x86, 0x44, 0x89, 0x0D,
+    0x83, 0x44, 0x8E, 0x0E, 0x8E, 0x44, 0x87, 0x0D, 0x88, 0x45, 0x84, 0x09, 0x81, 0x01, 0x81, 0x46,
+    0x89, 0x82, 0x04, 0x83, 0x87, 0x8C, 0x8D, 0x02, 0x86, 0x47, 0x8E, 0x8D, 0x8C, 0x8E, 0x43, 0x8D,
+    0x03, 0x8A, 0x4E, 0x8D, 0x04, 0x88, 0x4D, 0x8D, 0x05, 0x84, 0x8C, 0x4B, 0x8A, 0x07, 0x83, 0x87,
+    0x8B, 0x8D, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x85, 0x81, 0x01, 0x0A, 0x8C, 0x44, 0x8B, 0x09, 0x87,
+    0x44, 0x8A, 0x09, 0x84, 0x44, 0x87, 0x09, 0x82, 0x8E, 0x43, 0x84, 0x09, 0x81, 0x8D, 0x42, 0x8D,
+    0x82, 0x0A, 0x8A, 0x42, 0x8A, 0x2F, 0x84, 0x88, 0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x84, 0x05,
+    0x83, 0x8C, 0x49, 0x8E, 0x82, 0x02, 0x86, 0x4B, 0x8E, 0x02, 0x84, 0x4C, 0x88, 0x02, 0x8E, 0x45,
+    0x8C, 0x99, 0x8C, 0x42, 0x82, 0x01, 0x86, 0x44, 0x8E, 0x83, 0x04, 0x85, 0x88, 0x02, 0x8B, 0x44,
+    0x85, 0x0A, 0x44, 0x8E, 0x0A, 0x82, 0x44, 0x8A, 0x0A, 0x83, 0x44, 0x88, 0x0A, 0x84, 0x44, 0x87,
+    0x0A, 0x83, 0x44, 0x88, 0x0A, 0x82, 0x44, 0x8A, 0x0B, 0x44, 0x8E, 0x0B, 0x8D, 0x44, 0x85, 0x07,
+    0x81, 0x01, 0x88, 0x44, 0x8E, 0x83, 0x04, 0x83, 0x8A, 0x8B, 0x01, 0x82, 0x46, 0x8C, 0x99, 0x8B,
+    0x8E, 0x41, 0x8B, 0x02, 0x88, 0x4C, 0x8B, 0x03, 0x8B, 0x4B, 0x8B, 0x04, 0x88, 0x4A, 0x87, 0x05,
+    0x81, 0x86, 0x8B, 0x8D, 0x42, 0x8E, 0x8B, 0x87, 0x81, 0x01, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00,
+    0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x44, 0x8C, 0xFB, 0x8B, 0x00, 0x89, 0x44, 0x82, 0x09,
+    0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09,
+    0x89, 0x44, 0x82, 0x09, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x4D, 0x85, 0x00, 0x89, 0x4D, 0x85, 0x00,
+    0x89, 0x4D, 0x85, 0x00, 0x89, 0x44, 0x8C, 0xFB, 0x83, 0x00, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44,
+    0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44, 0x82, 0x09, 0x89, 0x44,
+    0x82, 0x09, 0x89, 0x44, 0xFC, 0x9C, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00, 0x89, 0x4E, 0x00,
+    0x89, 0x4E, 0x0A, 0x89, 0x41, 0x8C, 0x0B, 0x8B, 0x41, 0x8D, 0x0B, 0x89, 0x42, 0x82, 0x0A, 0x81,
+    0x42, 0x8B, 0x0B, 0x84, 0x42, 0x8A, 0x0B, 0x84, 0x43, 0x88, 0x86, 0x88, 0x82, 0x08, 0x8E, 0x45,
+    0x83, 0x08, 0x85, 0x45, 0x83, 0x09, 0x83, 0x8B, 0x8E, 0x40, 0x8E, 0x8B, 0x81, 0x00, 0x05, 0x84,
+    0x89, 0x8D, 0x8E, 0x40, 0x8E, 0x8D, 0x89, 0x85, 0x08, 0x83, 0x8D, 0x48, 0x8D, 0x84, 0x05, 0x85,
+    0x4C, 0x86, 0x03, 0x83, 0x4E, 0x83, 0x02, 0x8E, 0x44, 0x88, 0x82, 0x00, 0x82, 0x87, 0x44, 0x8C,
+    0x01, 0x85, 0x44, 0x87, 0x04, 0x83, 0x44, 0x83, 0x00, 0x8B, 0x43, 0x8E, 0x06, 0x8B, 0x43, 0x88,
+    0x00, 0x44, 0x8A, 0x06, 0x88, 0x43, 0x8A, 0x82, 0x51, 0x8C, 0x83, 0x51, 0x8C, 0x84, 0x51, 0x8D,
+    0x83, 0x44, 0x8D, 0xFC, 0xBC, 0x89, 0x82, 0x44, 0x88, 0x0D, 0x44, 0x8B, 0x0D, 0x8B, 0x44, 0x82,
+    0x0C, 0x85, 0x44, 0x8D, 0x81, 0x07, 0x85, 0x87, 0x02, 0x8D, 0x45, 0x89, 0x85, 0x83, 0x84, 0x85,
+    0x87, 0x8B, 0x41, 0x8A, 0x02, 0x83, 0x4E, 0x8A, 0x03, 0x84, 0x8E, 0x4C, 0x8A, 0x04, 0x81, 0x8A,
+    0x4B, 0x87, 0x06, 0x82, 0x87, 0x8B, 0x8D, 0x42, 0x8E, 0x8C, 0x89, 0x85, 0x81, 0x0D, 0x87, 0x41,
+    0x8E, 0x82, 0x0D, 0x89, 0x41, 0x8E, 0x82, 0x0D, 0x86, 0x42, 0x85, 0x0E, 0x8E, 0x41, 0x8E, 0x0E,
+    0x81, 0x42, 0x8D, 0x0E, 0x81, 0x43, 0x89, 0x86, 0x88, 0x84, 0x0B, 0x8C, 0x45, 0x86, 0x0B, 0x83,
+    0x45, 0x86, 0x0C, 0x82, 0x8A, 0x8E, 0x40, 0x8E, 0x8C, 0x83, 0x01, 0x02, 0x89, 0x44, 0x82, 0x0D,
+    0x89, 0x44, 0x82, 0x0D, 0x89, 0x44, 0x82, 0x0D, 0x89, 0x44, 0x82, 0x0D, 0x89, 0x44, 0x82, 0x0D,
+    0x89, 0x44, 0x82, 0x0D, 0x89, 0x44, 0x82, 0x0D, 0x89, 0x44, 0x82, 0x0D, 0x89, 0x44, 0x82, 0x84,
+    0x8D, 0x82, 0x0A, 0x89, 0x44, 0x8C, 0x41, 0x8C, 0x0A, 0x89, 0x48, 0x85, 0x09, 0x89, 0x48, 0x8B,
+    0x09, 0x89, 0x47, 0x87, 0x09, 0x87, 0x46, 0x8A, 0x81, 0x08, 0x83, 0x8D, 0x46, 0x85, 0x0A, 0x8B,
+    0x47, 0x82, 0x0A, 0x82, 0x47, 0x82, 0x0B, 0x88, 0x46, 0x82, 0x0C, 0x87, 0x89, 0x44, 0x82, 0x0D,
+    0x89, 0x44, 0x82, 0x0D, 0x89, 0x44, 0x82, 0x0D, 0x89, 0x44, 0x82, 0x0D, 0x89, 0x44, 0xFC, 0xAC,
+    0x82, 0x02, 0x89, 0x4F, 0x82, 0x02, 0x89, 0x4F, 0x82, 0x02, 0x89, 0x4F, 0x82, 0x02, 0x89, 0x4F,
+    0x82, 0x02, 0x89, 0x44, 0x81, 0x05, 0x89, 0x44, 0x81, 0x05, 0x89, 0x44, 0x81, 0x05, 0x89, 0x44,
+    0x81, 0x05, 0x89, 0x44, 0x81, 0x05, 0x89, 0x44, 0x81, 0x05, 0x89, 0x44, 0x81, 0x05, 0x89, 0x44,
+    0x81, 0x05, 0x89, 0x44, 0x81, 0x05, 0x89, 0x44, 0x81, 0x05, 0x89, 0x44, 0x81, 0x05, 0x89, 0x44,
+    0x88, 0x8A, 0x04, 0x89, 0x46, 0x84, 0x03, 0x89, 0x46, 0x8D, 0x03, 0x89, 0x47, 0x85, 0x01, 0x83,
+    0x8D, 0x45, 0x8D, 0x84, 0x01, 0x89, 0x46, 0x87, 0x02, 0x8C, 0x47, 0x81, 0x02, 0x85, 0x47, 0x81,
+    0x03, 0x8C, 0x46, 0x81, 0x03, 0x83, 0x9B, 0x44, 0x81, 0x05, 0x89, 0x44, 0x81, 0x05, 0x89, 0x44,
+    0x81, 0x05, 0x89, 0x44, 0x81, 0x05, 0x89, 0x44, 0x81, 0x05, 0x89, 0x44, 0x81, 0x05, 0x89, 0x44,
+    0x81, 0x05, 0x89, 0x44, 0x81, 0x05, 0x89, 0x44, 0x81, 0x02, 0x0C, 0x8C, 0x44, 0x8A, 0x10, 0x88,
+    0x44, 0x89, 0x10, 0x85, 0x44, 0x87, 0x10, 0x82, 0x43, 0x8E, 0x84, 0x10, 0x81, 0x8E, 0x42, 0x8C,
+    0x82, 0x11, 0x8B, 0x42, 0x89, 0x3C, 0x89, 0x45, 0x8E, 0x0A, 0x8B, 0x43, 0x87, 0x89, 0x46, 0x88,
+    0x09, 0x8B, 0x43, 0x87, 0x89, 0x47, 0x82, 0x08, 0x8B, 0x43, 0x87, 0x89, 0x47, 0x8B, 0x08, 0x8B,
+    0x43, 0x87, 0x89, 0x48, 0x84, 0x07, 0x8B, 0x43, 0x87, 0x89, 0x48, 0x8D, 0x07, 0x8B, 0x43, 0x87,
+    0x89, 0x43, 0x8E, 0x44, 0x87, 0x06, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x86, 0x45, 0x81, 0x05, 0x8B,
+    0x43, 0x87, 0x89, 0x43, 0x85, 0x88, 0x44, 0x89, 0x05, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x85, 0x00,
+    0x8E, 0x44, 0x83, 0x04, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x86, 0x00, 0x85, 0x44, 0x8C, 0x04, 0x8B,
+    0x43, 0x87, 0x89, 0x43, 0x87, 0x01, 0x8C, 0x44, 0x85, 0x03, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x88,
+    0x01, 0x83, 0x44, 0x8E, 0x03, 0x8B, 0x43, 0x87, 0x89, 0x43, 0x88, 0x02, 0x8A, 0x44, 0x88, 0x02,
+    0x8B, 0x43, 0x87, 0x89, 0x43, 0x88, 0x02, 0x81, 0x45, 0x82, 0x01, 0x8A, 0x43, 0x87, 0x89, 0x43,
+    0x88, 0x03, 0x87, 0x44, 0x8B, 0x01, 0x8A, 0x43, 0x87, 0x89, 0x43, 0x88, 0x04, 0x8D, 0x44, 0x84,
+    0x00, 0x89, 0x43, 0x87, 0x89, 0x43, 0x88, 0x04, 0x85, 0x44, 0x8D, 0x00, 0x88, 0x43, 0x87, 0x89,
+    0x43, 0x88, 0x05, 0x8B, 0x44, 0x87, 0x88, 0x43, 0x87, 0x89, 0x43, 0x88, 0x05, 0x82, 0x45, 0x88,
+    0x43, 0x87, 0x89, 0x43, 0x88, 0x06, 0x89, 0x49, 0x87, 0x89, 0x43, 0x88, 0x06, 0x81, 0x8E, 0x48,
+    0x87, 0x89, 0x43, 0x88, 0x07, 0x86, 0x48, 0x87, 0x89, 0x43, 0x88, 0x08, 0x8D, 0x47, 0x87, 0x89,
+    0x43, 0x88, 0x08, 0x84, 0x47, 0x87, 0x89, 0x43, 0x88, 0x09, 0x8B, 0x46, 0x87, 0x89, 0x43, 0x88,
+    0x09, 0x82, 0x46, 0x87, 0x0A, 0x8A, 0x44, 0x8C, 0x0C, 0x86, 0x44, 0x8B, 0x0C, 0x83, 0x44, 0x89,
+    0x0C, 0x81, 0x8E, 0x43, 0x86, 0x0D, 0x8C, 0x42, 0x8E, 0x83, 0x0D, 0x89, 0x42, 0x8B, 0x81, 0x32,
+    0x43, 0x86, 0x02, 0x86, 0x8B, 0x8E, 0x41, 0x8D, 0x89, 0x83, 0x04, 0x43, 0x8A, 0x00, 0x84, 0x8D,
+    0x47, 0x8A, 0x03, 0x43, 0x8E, 0x83, 0x4A, 0x8A, 0x02, 0x51, 0x84, 0x01, 0x47, 0x8C, 0x99, 0x8C,
+    0x45, 0x8A, 0x01, 0x46, 0x84, 0x03, 0x88, 0x44, 0x8E, 0x01, 0x45, 0x87, 0x05, 0x8E, 0x44, 0x01,
+    0x45, 0x81, 0x05, 0x8A, 0x44, 0x81, 0x00, 0x44, 0x8D, 0x06, 0x89, 0x44, 0x82, 0x00, 0x44, 0x8B,
+    0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88,
+    0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82,
+    0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44,
+    0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06,
+    0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44, 0x82, 0x00, 0x44, 0x8A, 0x06, 0x88, 0x44,
+    0x82, 0x09, 0x86, 0x45, 0x82, 0x09, 0x82, 0x44, 0x8E, 0x82, 0x0A, 0x8D, 0x43, 0x8C, 0x81, 0x0A,
+    0x8A, 0x43, 0x89, 0x0B, 0x88, 0x43, 0x86, 0x0B, 0x84, 0x42, 0x8D, 0x83, 0x31, 0x82, 0x87, 0x8B,
+    0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x82, 0x05, 0x81, 0x8A, 0x4A, 0x8C, 0x86, 0x02, 0x81, 0x8D,
+    0x4D, 0x81, 0x01, 0x8C, 0x4D, 0x8A, 0x01, 0x85, 0x46, 0x8D, 0x8C, 0x8E, 0x44, 0x83, 0x01, 0x8A,
+    0x44, 0x8A, 0x81, 0x02, 0x81, 0x85, 0x8A, 0x40, 0x8C, 0x02, 0x8D, 0x43, 0x8E, 0x08, 0x82, 0x02,
+    0x8E, 0x43, 0x8B, 0x0C, 0x8D, 0x43, 0x8E, 0x81, 0x0B, 0x8A, 0x44, 0x8C, 0x82, 0x0A, 0x84, 0x46,
+    0x89, 0x81, 0x09, 0x8B, 0x47, 0x8A, 0x82, 0x07, 0x81, 0x8C, 0x48, 0x8A, 0x81, 0x07, 0x8A, 0x49,
+    0x86, 0x07, 0x84, 0x8C, 0x48, 0x88, 0x08, 0x84, 0x8B, 0x47, 0x85, 0x09, 0x83, 0x8B, 0x45, 0x8E,
+    0x0B, 0x86, 0x45, 0x83, 0x0B, 0x88, 0x44, 0x85, 0x0B, 0x84, 0x44, 0x86, 0x83, 0x8A, 0x84, 0x08,
+    0x86, 0x44, 0x94, 0x41, 0x8D, 0x88, 0x83, 0x04, 0x85, 0x8E, 0x44, 0x81, 0x84, 0x45, 0x8D, 0x8C,
+    0x8D, 0x8E, 0x45, 0x8B, 0x00, 0x84, 0x4F, 0x82, 0x00, 0x84, 0x4E, 0x84, 0x01, 0x81, 0x8A, 0x4B,
+    0x8B, 0x82, 0x04, 0x81, 0x85, 0x89, 0x8C, 0x8E, 0x42, 0x8D, 0x8B, 0x87, 0x82, 0x04, 0x08, 0x8A,
+    0x44, 0x8D, 0x08, 0x85, 0x44, 0x8B, 0x81, 0x07, 0x82, 0x44, 0x89, 0x08, 0x81, 0x8E, 0x43, 0x86,
+    0x09, 0x8C, 0x42, 0x8E, 0x83, 0x09, 0x88, 0x42, 0x8B, 0x81, 0x2B, 0x85, 0x89, 0x8C, 0x8E, 0x41,
+    0x8E, 0x8C, 0x89, 0x85, 0x81, 0x03, 0x83, 0x8D, 0x4A, 0x8A, 0x01, 0x83, 0x4C, 0x8D, 0x01, 0x8D,
+    0x4C, 0x86, 0x00, 0x82, 0x44, 0x8D, 0x85, 0x93, 0x85, 0x89, 0x8E, 0x41, 0x01, 0x84, 0x44, 0x86,
+    0x05, 0x85, 0x86, 0x01, 0x83, 0x44, 0x8C, 0x81, 0x08, 0x81, 0x46, 0x88, 0x82, 0x07, 0x8A, 0x47,
+    0x8B, 0x85, 0x05, 0x81, 0x8D, 0x48, 0x8D, 0x85, 0x04, 0x81, 0x8A, 0x49, 0x8A, 0x05, 0x82, 0x8A,
+    0x48, 0x88, 0x06, 0x81, 0x87, 0x8E, 0x46, 0x81, 0x08, 0x87, 0x45, 0x85, 0x09, 0x85, 0x44, 0x86,
+    0x83, 0x89, 0x83, 0x06, 0x83, 0x44, 0x85, 0x84, 0x41, 0x8E, 0x89, 0x86, 0x83, 0x82, 0x83, 0x85,
+    0x8D, 0x44, 0x82, 0x84, 0x4D, 0x8B, 0x00, 0x84, 0x4C, 0x8E, 0x82, 0x00, 0x83, 0x4B, 0x8C, 0x82,
+    0x02, 0x81, 0x86, 0x8A, 0x8C, 0x8E, 0x42, 0x8E, 0x8C, 0x88, 0x83, 0x03, 0x0A, 0x86, 0x45, 0x82,
+    0x0C, 0x82, 0x44, 0x8E, 0x82, 0x0D, 0x8D, 0x43, 0x8C, 0x81, 0x0D, 0x8A, 0x43, 0x89, 0x0E, 0x88,
+    0x43, 0x86, 0x0E, 0x84, 0x42, 0x8D, 0x83, 0x35, 0x8B, 0x51, 0x8C, 0x01, 0x8B, 0x51, 0x8C, 0x01,
+    0x8B, 0x51, 0x8C, 0x01, 0x8B, 0x51, 0x8B, 0x01, 0x88, 0xFC, 0xBC, 0x45, 0x83, 0x0D, 0x89, 0x44,
+    0x87, 0x0D, 0x84, 0x44, 0x8C, 0x0D, 0x81, 0x8E, 0x44, 0x82, 0x0D, 0x8B, 0x44, 0x86, 0x0D, 0x86,
+    0x44, 0x8B, 0x0D, 0x82, 0x44, 0x8E, 0x81, 0x0D, 0x8C, 0x44, 0x84, 0x0D, 0x88, 0x44, 0x89, 0x0D,
+    0x83, 0x44, 0x8D, 0x0E, 0x8E, 0x44, 0x83, 0x0D, 0x8A, 0x44, 0x87, 0x0D, 0x85, 0x44, 0x8C, 0x0D,
+    0x81, 0x8E, 0x44, 0x82, 0x0D, 0x8B, 0x44, 0x86, 0x0D, 0x87, 0x44, 0x8A, 0x0D, 0x82, 0x44, 0x8E,
+    0x81, 0x0D, 0x8D, 0x44, 0x84, 0x0D, 0x88, 0x45, 0xFC, 0xCC, 0x91, 0x53, 0x91, 0x53, 0x91, 0x53,
+    0x91, 0x53, 0x81, 0x08, 0x87, 0x44, 0x8E, 0x81, 0x07, 0x83, 0x44, 0x8D, 0x82, 0x07, 0x81, 0x8D,
+    0x43, 0x8B, 0x81, 0x08, 0x8C, 0x43, 0x88, 0x09, 0x89, 0x43, 0x85, 0x09, 0x85, 0x42, 0x8D, 0x82,
+    0x27, 0x86, 0x4E, 0x81, 0x86, 0x4E, 0x81, 0x86, 0x4E, 0x81, 0x86, 0x4E, 0x00, 0x82, 0xF5, 0x8B,
+    0x44, 0x87, 0x08, 0x83, 0x44, 0x8C, 0x08, 0x81, 0x8E, 0x43, 0x8E, 0x81, 0x08, 0x8A, 0x44, 0x85,
+    0x08, 0x86, 0x44, 0x89, 0x08, 0x82, 0x44, 0x8D, 0x09, 0x8C, 0x44, 0x83, 0x08, 0x88, 0x44, 0x87,
+    0x08, 0x84, 0x44, 0x8B, 0x08, 0x81, 0x8E, 0x43, 0x8E, 0x81, 0x08, 0x8B, 0x44, 0x84, 0x08, 0x86,
+    0x44, 0x88, 0x08, 0x82, 0x45, 0xF5, 0x85, 0x82, 0x8D, 0x4E, 0x86, 0x4F, 0x86, 0x4F, 0x86, 0x4F,
+    0x86, 0x08, 0x84, 0x97, 0x84, 0x10, 0x88, 0x43, 0x88, 0x0F, 0x45, 0x0F, 0x45, 0x0F, 0x8D, 0x43,
+    0x8C, 0x0F, 0x82, 0x8B, 0x40, 0x8E, 0x8B, 0x82, 0x34, 0x8B, 0x51, 0x8C, 0x01, 0x8B, 0x51, 0x8C,
+    0x01, 0x8B, 0x51, 0x8C, 0x01, 0x8B, 0x51, 0x8B, 0x01, 0x88, 0xFC, 0xBC, 0x45, 0x83, 0x0D, 0x89,
+    0x44, 0x87, 0x0D, 0x84, 0x44, 0x8C, 0x0D, 0x81, 0x8E, 0x44, 0x82, 0x0D, 0x8B, 0x44, 0x86, 0x0D,
+    0x86, 0x44, 0x8B, 0x0D, 0x82, 0x44, 0x8E, 0x81, 0x0D, 0x8C, 0x44, 0x84, 0x0D, 0x88, 0x44, 0x89,
+    0x0D, 0x83, 0x44, 0x8D, 0x0E, 0x8E, 0x44, 0x83, 0x0D, 0x8A, 0x44, 0x87, 0x0D, 0x85, 0x44, 0x8C,
+    0x0D, 0x81, 0x8E, 0x44, 0x82, 0x0D, 0x8B, 0x44, 0x86, 0x0D, 0x87, 0x44, 0x8A, 0x0D, 0x82, 0x44,
+    0x8E, 0x81, 0x0D, 0x8D, 0x44, 0x84, 0x0D, 0x88, 0x45, 0xFC, 0xCC, 0x91, 0x53, 0x91, 0x53, 0x91,
+    0x53, 0x91, 0x53, 0x81, 0x05, 0x83, 0x97, 0x85, 0x0B, 0x85, 0x43, 0x8B, 0x0A, 0x8C, 0x44, 0x82,
+    0x09, 0x8D, 0x44, 0x83, 0x09, 0x89, 0x43, 0x8E, 0x0A, 0x81, 0x8A, 0x8E, 0x40, 0x8C, 0x83, 0x27,
+    0x86, 0x4E, 0x81, 0x86, 0x4E, 0x81, 0x86, 0x4E, 0x81, 0x86, 0x4E, 0x00, 0x82, 0xF5, 0x8B, 0x44,
+    0x87, 0x08, 0x83, 0x44, 0x8C, 0x08, 0x81, 0x8E, 0x43, 0x8E, 0x81, 0x08, 0x8A, 0x44, 0x85, 0x08,
+    0x86, 0x44, 0x89, 0x08, 0x82, 0x44, 0x8D, 0x09, 0x8C, 0x44, 0x83, 0x08, 0x88, 0x44, 0x87, 0x08,
+    0x84, 0x44, 0x8B, 0x08, 0x81, 0x8E, 0x43, 0x8E, 0x81, 0x08, 0x8B, 0x44, 0x84, 0x08, 0x86, 0x44,
+    0x88, 0x08, 0x82, 0x45, 0xF5, 0x85, 0x82, 0x8D, 0x4E, 0x86, 0x4F, 0x86, 0x4F, 0x86, 0x4F, 0x86,
+};
+const GFXglyph OpenSans18BGlyphs[] = {
+    { 0, 0, 10, 0, 0, 0, 4 }, //  
+    { 7, 27, 11, 2, 27, 79, 4 }, // !
+    { 14, 10, 18, 2, 27, 63, 83 }, // "
+    { 24, 27, 25, 0, 27, 185, 146 }, // #
+    { 20, 31, 22, 1, 29, 202, 331 }, // $
+    { 33, 27, 34, 1, 27, 326, 533 }, // %
+    { 28, 27, 29, 1, 27, 213, 859 }, // &
+    { 6, 10, 10, 2, 27, 32, 1072 }, // '
+    { 11, 33, 13, 1, 27, 133, 1104 }, // (
+    { 11, 33, 13, 1, 27, 128, 1237 }, // )
+    { 19, 19, 21, 1, 29, 118, 1365 }, // *
+    { 20, 20, 22, 1, 23, 77, 1483 }, // +
+    { 8, 9, 11, 1, 4, 35, 1560 }, // ,
+    { 11, 5, 12, 1, 13, 16, 1595 }, // -
+    { 7, 7, 11, 2, 7, 29, 1611 }, // .
+    { 16, 27, 16, 0, 27, 109, 1640 }, // /
+    { 20, 27, 22, 1, 27, 187, 1749 }, // 0
+    { 14, 27, 22, 2, 27, 107, 1936 }, // 1
+    { 20, 27, 22, 1, 27, 140, 2043 }, // 2
+    { 20, 27, 22, 1, 27, 168, 2183 }, // 3
+    { 22, 27, 22, 0, 27, 154, 2351 }, // 4
+    { 19, 27, 22, 1, 27, 142, 2505 }, // 5
+    { 20, 27, 22, 1, 27, 178, 2647 }, // 6
+    { 20, 27, 22, 1, 27, 102, 2825 }, // 7
+    { 20, 27, 22, 1, 27, 195, 2927 }, // 8
+    { 20, 27, 22, 1, 27, 182, 3122 }, // 9
+    { 7, 21, 11, 2, 21, 56, 3304 }, // :
+    { 8, 26, 11, 1, 21, 67, 3360 }, // ;
+    { 20, 21, 22, 1, 24, 110, 3427 }, // <
+    { 20, 11, 22, 1, 19, 33, 3537 }, // =
+    { 20, 21, 22, 1, 24, 108, 3570 }, // >
+    { 18, 27, 18, 0, 27, 123, 3678 }, // ?
+    { 32, 30, 34, 1, 27, 361, 3801 }, // @
+    { 27, 27, 26, 0, 27, 172, 4162 }, // A
+    { 21, 27, 26, 3, 27, 176, 4334 }, // B
+    { 21, 27, 24, 2, 27, 153, 4510 }, // C
+    { 23, 27, 28, 3, 27, 191, 4663 }, // D
+    { 17, 27, 21, 3, 27, 105, 4854 }, // E
+    { 16, 27, 21, 3, 27, 97, 4959 }, // F
+    { 23, 27, 28, 2, 27, 182, 5056 }, // G
+    { 23, 27, 29, 3, 27, 173, 5238 }, // H
+    { 7, 27, 13, 3, 27, 81, 5411 }, // I
+    { 13, 35, 13, -3, 27, 152, 5492 }, // J
+    { 23, 27, 25, 3, 27, 206, 5644 }, // K
+    { 18, 27, 21, 3, 27, 105, 5850 }, // L
+    { 30, 27, 36, 3, 27, 297, 5955 }, // M
+    { 25, 27, 31, 3, 27, 238, 6252 }, // N
+    { 27, 27, 30, 2, 27, 201, 6490 }, // O
+    { 20, 27, 24, 3, 27, 152, 6691 }, // P
+    { 27, 33, 30, 2, 27, 223, 6843 }, // Q
+    { 23, 27, 25, 3, 27, 194, 7066 }, // R
+    { 19, 27, 21, 1, 27, 162, 7260 }, // S
+    { 22, 27, 22, 0, 27, 106, 7422 }, // T
+    { 23, 27, 29, 3, 27, 170, 7528 }, // U
+    { 25, 27, 25, 0, 27, 181, 7698 }, // V
+    { 37, 27, 37, 0, 27, 324, 7879 }, // W
+    { 26, 27, 25, 0, 27, 190, 8203 }, // X
+    { 24, 27, 24, 0, 27, 140, 8393 }, // Y
+    { 22, 27, 22, 0, 27, 108, 8533 }, // Z
+    { 10, 33, 13, 2, 27, 126, 8641 }, // [
+    { 16, 27, 16, 0, 27, 104, 8767 }, // '\\'
+    { 10, 33, 13, 0, 27, 126, 8871 }, // ]
+    { 21, 17, 20, 0, 27, 113, 8997 }, // ^
+    { 17, 3, 16, -1, -3, 10, 9110 }, // _
+    { 11, 6, 23, 6, 29, 26, 9120 }, // `
+    { 20, 21, 23, 1, 21, 145, 9146 }, // a
+    { 21, 29, 24, 2, 29, 178, 9291 }, // b
+    { 18, 21, 20, 1, 21, 117, 9469 }, // c
+    { 21, 29, 24, 1, 29, 200, 9586 }, // d
+    { 20, 21, 22, 1, 21, 128, 9786 }, // e
+    { 17, 29, 15, 0, 29, 133, 9914 }, // f
+    { 22, 30, 21, 0, 21, 208, 10047 }, // g
+    { 21, 29, 25, 2, 29, 169, 10255 }, // h
+    { 7, 29, 12, 2, 29, 89, 10424 }, // i
+    { 12, 38, 12, -3, 29, 133, 10513 }, // j
+    { 22, 29, 24, 2, 29, 164, 10646 }, // k
+    { 7, 29, 12, 2, 29, 87, 10810 }, // l
+    { 33, 21, 37, 2, 21, 237, 10897 }, // m
+    { 21, 21, 25, 2, 21, 146, 11134 }, // n
+    { 21, 21, 24, 1, 21, 144, 11280 }, // o
+    { 21, 30, 24, 2, 21, 181, 11424 }, // p
+    { 21, 30, 24, 1, 21, 204, 11605 }, // q
+    { 15, 21, 17, 2, 21, 82, 11809 }, // r
+    { 17, 21, 19, 1, 21, 130, 11891 }, // s
+    { 16, 26, 17, 0, 26, 114, 12021 }, // t
+    { 20, 21, 25, 2, 21, 131, 12135 }, // u
+    { 22, 21, 22, 0, 21, 140, 12266 }, // v
+    { 33, 21, 33, 0, 21, 250, 12406 }, // w
+    { 22, 21, 22, 0, 21, 135, 12656 }, // x
+    { 22, 30, 22, 0, 21, 180, 12791 }, // y
+    { 17, 21, 19, 1, 21, 80, 12971 }, // z
+    { 14, 33, 15, 0, 27, 150, 13051 }, // {
+    { 5, 38, 21, 8, 29, 114, 13201 }, // |
+    { 14, 33, 15, 1, 27, 150, 13315 }, // }
+    { 20, 9, 22, 1, 18, 62, 13465 }, // ~
+    { 14, 13, 16, 1, 28, 90, 13527 }, // °
+    { 27, 35, 30, 2, 35, 228, 13617 }, // Ó
+    { 20, 29, 23, 1, 29, 190, 13845 }, // ä
+    { 21, 29, 24, 1, 29, 172, 14035 }, // ó
+    { 27, 36, 26, 0, 27, 218, 14207 }, // Ą
+    { 20, 30, 23, 1, 21, 189, 14425 }, // ą
+    { 21, 35, 24, 2, 35, 180, 14614 }, // Ć
+    { 18, 29, 20, 1, 29, 144, 14794 }, // ć
+    { 17, 36, 21, 3, 27, 148, 14938 }, // Ę
+    { 20, 30, 22, 1, 21, 173, 15086 }, // ę
+    { 21, 27, 21, 0, 27, 118, 15259 }, // Ł
+    { 13, 29, 13, 0, 29, 121, 15377 }, // ł
+    { 25, 35, 31, 3, 35, 266, 15498 }, // Ń
+    { 21, 29, 25, 2, 29, 173, 15764 }, // ń
+    { 19, 35, 21, 1, 35, 189, 15937 }, // Ś
+    { 17, 29, 19, 1, 29, 158, 16126 }, // ś
+    { 22, 35, 22, 0, 35, 135, 16284 }, // Ź
+    { 17, 29, 19, 1, 29, 110, 16419 }, // ź
+    { 22, 35, 22, 0, 35, 131, 16529 }, // Ż
+    { 17, 29, 19, 1, 29, 108, 16660 }, // ż
+};
+const UnicodeInterval OpenSans18BIntervals[] = {
+    { 0x20, 0x7E, 0x0 },
+    { 0xB0, 0xB0, 0x5F },
+    { 0xD3, 0xD3, 0x60 },
+    { 0xE4, 0xE4, 0x61 },
+    { 0xF3, 0xF3, 0x62 },
+    { 0x104, 0x107, 0x63 },
+    { 0x118, 0x119, 0x67 },
+    { 0x141, 0x144, 0x69 },
+    { 0x15A, 0x15B, 0x6D },
+    { 0x179, 0x17C, 0x6F },
+};
+const GFXfont OpenSans18B = {
+    (uint8_t*)OpenSans18BBitmaps,
+    (GFXglyph*)OpenSans18BGlyphs,
+    (UnicodeInterval*)OpenSans18BIntervals,
+    10,
+    1,
+    51,
+    41,
+    -11,
+};
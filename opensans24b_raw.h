@@ -0,0 +1,5660 @@
+#pragma once
+// Generated by tools/fontencode.py raw from opensans24b.h, do not edit
+#include "epd_driver.h"
+const uint8_t OpenSans24BBitmaps[87156] = {
+    0xF0, 0xFF, 0xFF, 0xFF, 0x6F, 0xF0, 0xFF, 0xFF, 0xFF, 0x5F, 0xE0, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0,
+    0xFF, 0xFF, 0xFF, 0x3F, 0xD0, 0xFF, 0xFF, 0xFF, 0x2F, 0xC0, 0xFF, 0xFF, 0xFF, 0x1F, 0xB0, 0xFF,
+    0xFF, 0xFF, 0x1F, 0xA0, 0xFF, 0xFF, 0xFF, 0x0F, 0x90, 0xFF, 0xFF, 0xFF, 0x0F, 0x90, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x80, 0xFF, 0xFF, 0xFF, 0x0D, 0x70, 0xFF, 0xFF, 0xFF, 0x0D, 0x60, 0xFF, 0xFF, 0xFF,
+    0x0C, 0x50, 0xFF, 0xFF, 0xFF, 0x0B, 0x40, 0xFF, 0xFF, 0xFF, 0x0A, 0x40, 0xFF, 0xFF, 0xFF, 0x09,
+    0x30, 0xFF, 0xFF, 0xFF, 0x09, 0x20, 0xFF, 0xFF, 0xFF, 0x08, 0x10, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xFE,
+    0xFF, 0xFF, 0x04, 0x00, 0xFD, 0xFF, 0xFF, 0x03, 0x00, 0x86, 0x88, 0x88, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x43, 0x02,
+    0x00, 0x00, 0xFA, 0xFF, 0xCF, 0x01, 0x90, 0xFF, 0xFF, 0xFF, 0x0D, 0xF0, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x6F, 0xF1, 0xFF, 0xFF, 0xFF, 0x5F, 0xD0, 0xFF, 0xFF, 0xFF, 0x2F, 0x50,
+    0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xC4, 0xFF, 0x7D, 0x00, 0xFB, 0xFF, 0xFF, 0x0F, 0x00, 0xF6, 0xFF,
+    0xFF, 0x5F, 0xFA, 0xFF, 0xFF, 0x0F, 0x00, 0xF5, 0xFF, 0xFF, 0x3F, 0xF8, 0xFF, 0xFF, 0x0D, 0x00,
+    0xF4, 0xFF, 0xFF, 0x2F, 0xF7, 0xFF, 0xFF, 0x0C, 0x00, 0xF2, 0xFF, 0xFF, 0x1F, 0xF6, 0xFF, 0xFF,
+    0x0B, 0x00, 0xF1, 0xFF, 0xFF, 0x0F, 0xF5, 0xFF, 0xFF, 0x0A, 0x00, 0xF0, 0xFF, 0xFF, 0x0E, 0xF4,
+    0xFF, 0xFF, 0x08, 0x00, 0xF0, 0xFF, 0xFF, 0x0D, 0xF2, 0xFF, 0xFF, 0x07, 0x00, 0xE0, 0xFF, 0xFF,
+    0x0C, 0xF1, 0xFF, 0xFF, 0x06, 0x00, 0xC0, 0xFF, 0xFF, 0x0B, 0xF0, 0xFF, 0xFF, 0x05, 0x00, 0xB0,
+    0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x04, 0x00, 0xA0, 0xFF, 0xFF, 0x08, 0xD0, 0xFF, 0xFF, 0x02,
+    0x00, 0x90, 0xFF, 0xFF, 0x07, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x70, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xDF, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0xAF, 0x00, 0x00, 0xF7, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0xFF, 0x7F, 0x00, 0x00, 0xFA, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xFD, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0E, 0x00, 0x30, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0x0B, 0x00, 0x60, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x08, 0x00, 0x90, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x05, 0x00, 0xD0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x20, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x20, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x20, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x20, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x20, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x11,
+    0x11, 0x21, 0xFF, 0xFF, 0x4F, 0x11, 0x11, 0xFF, 0xFF, 0x5F, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0x0F, 0x00, 0x20, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0x0D, 0x00, 0x60, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0x0A, 0x00, 0x90, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xD0, 0xFF, 0xFF, 0x07, 0x00, 0xC0, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x04, 0x00, 0xF0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0x2F, 0x00, 0x20, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0x0E, 0x00, 0x50, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0x0B, 0x00, 0x80, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xB0, 0xFF, 0xFF, 0x08, 0x00, 0xB0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0xFF, 0xFF, 0x06, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0x03, 0x00, 0xF1, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0xDF, 0x00, 0x00, 0xF7, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xAF, 0x00, 0x00, 0xFA, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0x7F, 0x00, 0x00, 0xFD, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xB9, 0xFE, 0xFF, 0xDF, 0xAC, 0x47, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x05, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x2F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x7D, 0xF8, 0xFF, 0x42, 0x96, 0xFD, 0xFF, 0x05, 0x00, 0xFB, 0xFF, 0xFF,
+    0xDF, 0x00, 0xF5, 0xFF, 0x00, 0x00, 0x20, 0xC7, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x8F, 0x00, 0xF5,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0x00, 0xF5, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x06, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xCF, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xD5, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x09, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x09, 0xEC, 0x38, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xAE, 0x26, 0x00, 0xF5, 0xFF, 0x50, 0xFD,
+    0xFF, 0xFF, 0xFF, 0x03, 0xFC, 0xFF, 0xFF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x60, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x8E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x74, 0xCA, 0xED, 0xFF, 0xFF, 0xBD, 0x48, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xDA, 0xFF, 0xAD, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0xFF, 0xBF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0xDF, 0x33, 0xFD, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x4F, 0x00, 0xF4, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0x0F, 0x00, 0xF0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x0D, 0x00, 0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x30, 0xFF,
+    0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x0B, 0x00, 0xB0, 0xFF,
+    0xFF, 0x6F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0x0B, 0x00, 0xA0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x0B, 0x00, 0xA0, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0xFD, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x0B, 0x00,
+    0xB0, 0xFF, 0xFF, 0x6F, 0x00, 0x70, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0x0D, 0x00, 0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0xE0, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0xFF, 0x3F,
+    0x00, 0xF8, 0xFF, 0xFF, 0x05, 0x00, 0xA5, 0xFD, 0xDF, 0x4A, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x4F, 0x00, 0xF4, 0xFF, 0xFF, 0x0F, 0x10, 0xFF, 0xFF, 0xCF, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x1B, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xDF, 0x22, 0xFD, 0xFF, 0xFF, 0x0B, 0xA0, 0xFF, 0xFF, 0x3F,
+    0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x05, 0xF3, 0xFF, 0xFF, 0x0A, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xFB, 0xFF, 0xFF, 0x02, 0xF5, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x40, 0xFF, 0xFF,
+    0x9F, 0x00, 0xFB, 0xFF, 0xFF, 0x3D, 0xD3, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xFF,
+    0xFF, 0xCF, 0x02, 0xD0, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0xFF, 0x04, 0x40, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x40, 0xDA, 0xFF, 0xAD, 0x05, 0x00, 0xF6, 0xFF, 0xFF, 0x07, 0x20, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0xFF, 0xEF, 0x00, 0x50, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0D, 0x00, 0x70,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x04, 0x00, 0x70, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0xFB, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x04, 0x40, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2D, 0xD2, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA4, 0xFD, 0xDF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72,
+    0xDB, 0xFE, 0xDF, 0x7B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0xFE, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xB0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x7F, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x9F,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0x4F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xE0,
+    0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xEF, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0x09,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0xF5, 0xFF, 0xFF,
+    0xFF, 0xAF, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00,
+    0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0x44, 0x64, 0xEA, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x50, 0xFE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00,
+    0x00, 0x81, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x01, 0x00, 0x00, 0x00, 0x40, 0xB8, 0xED, 0xFF, 0xDE, 0x8B, 0x04, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1D, 0xFB, 0xFF, 0xFF, 0x0F, 0xFA, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x0D, 0xF7,
+    0xFF, 0xFF, 0x0C, 0xF6, 0xFF, 0xFF, 0x0B, 0xF5, 0xFF, 0xFF, 0x0A, 0xF4, 0xFF, 0xFF, 0x08, 0xF2,
+    0xFF, 0xFF, 0x07, 0xF1, 0xFF, 0xFF, 0x06, 0xF0, 0xFF, 0xFF, 0x05, 0xF0, 0xFF, 0xFF, 0x04, 0xD0,
+    0xFF, 0xFF, 0x02, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xF2, 0xFF,
+    0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0xFF, 0x03, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+    0xFF, 0x0C, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFE,
+    0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00,
+    0xE0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x1F, 0xF3, 0xFF, 0xFF, 0x1E, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xDF, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x90,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x6F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x16, 0x00,
+    0x00, 0x00, 0xFD, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x84, 0x00, 0xB0, 0xFF, 0x8D, 0x04, 0x00, 0xFB,
+    0xFF, 0x0F, 0x00, 0x72, 0xFB, 0xFF, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x6A, 0xFB, 0xFF, 0x5D, 0xE9,
+    0xFF, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x04, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF5, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x83, 0xA9, 0xCB, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xBC, 0x8A, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xAF, 0x80, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x3F, 0x10,
+    0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF8, 0xFF, 0xFF,
+    0x5F, 0x00, 0x00, 0x00, 0x20, 0xFB, 0xFF, 0xFF, 0x04, 0x00, 0xE1, 0xFF, 0xFF, 0x5D, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xFB, 0xDF, 0x00, 0x00, 0x70, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x6A, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x88, 0x88, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x54, 0x55, 0x55, 0x55, 0x95, 0xFF,
+    0xFF, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xBB, 0xBB, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0xF4, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x09, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x70, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF5, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x10, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x01, 0x00, 0x10, 0x43, 0x02, 0x00, 0x00, 0xFA, 0xFF, 0xCF, 0x01, 0x90,
+    0xFF, 0xFF, 0xFF, 0x0D, 0xF0, 0xFF, 0xFF, 0xFF, 0x3F, 0xF1, 0xFF, 0xFF, 0xFF, 0x6F, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x5F, 0xD0, 0xFF, 0xFF, 0xFF, 0x2F, 0x50, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xC4, 0xFF,
+    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xD0, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x5F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x83, 0xEB, 0xFF, 0xCE, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF,
+    0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0xFF, 0x8F, 0x23, 0xD5, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x04, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xF2, 0xFF,
+    0xFF, 0xFF, 0x07, 0x40, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x0C,
+    0x80, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0F, 0xB0, 0xFF, 0xFF,
+    0xFF, 0x0C, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x3F, 0xD0, 0xFF, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x6F, 0xF0, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xF0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
+    0x9F, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xAF, 0xF2, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF2, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xCF, 0xF2, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0xCF, 0xF2, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0xBF, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xBF, 0xF0,
+    0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xAF, 0xF0, 0xFF, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xD0, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+    0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x6F, 0xA0, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0xFF, 0xFF, 0x4F, 0x70, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x30, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0xFE, 0xFF,
+    0xFF, 0x9F, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x7F, 0x12, 0xC4, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F,
+    0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xEB, 0xFF, 0xDF, 0x6A, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xBB, 0xFF, 0xFF, 0xFF, 0x0A, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xBF, 0xB0, 0xFF, 0xFF, 0xFF, 0x0A, 0x10, 0xFE, 0xFF, 0xFF, 0x09, 0xC0, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0xF3, 0xFF, 0x6F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x60, 0xEF, 0x03, 0x00, 0xD0,
+    0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x17, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x95, 0xEB,
+    0xFF, 0xEF, 0x8B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0x7B, 0x55, 0xD7,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xE2, 0xFF, 0xFF, 0x19, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0x0B, 0x00, 0x30, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x62, 0xC9, 0xED, 0xFF, 0xCE, 0x6A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0B, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x7B, 0x23, 0x32, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x60, 0xFF, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x73, 0xFC, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xCC, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x8F, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x6F, 0xF1, 0x4A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x2F, 0xF1, 0xFF, 0xAE, 0x36, 0x01, 0x00, 0x41, 0xE8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0D, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x04, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x40, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x8E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x73, 0xCA, 0xEE, 0xFF, 0xEE, 0xAC, 0x37, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xCF, 0xFA, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0xFF, 0x4F, 0xFB, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF2, 0xFF, 0xFF, 0x0B, 0xFC, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0x02, 0xFC, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x8F, 0x00,
+    0xFD, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0D, 0x00, 0xFD, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x04, 0x00, 0xFE, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xCF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF2, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF2, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xD1, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+    0xDD, 0xDD, 0xFF, 0xFF, 0xFF, 0xEF, 0xDD, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x56, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xBC, 0xFD, 0xFF, 0xCE, 0x48, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x09, 0x00, 0x60, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x81, 0x9C, 0x46, 0x12, 0x32, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xE9, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF,
+    0xFF, 0x8F, 0x00, 0xF9, 0xFF, 0xAE, 0x47, 0x23, 0x32, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0x81, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xA7, 0xEC, 0xFF, 0xEF, 0xCD, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x73, 0xCA, 0xFE, 0xFF, 0xEF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x37, 0x01, 0x00, 0x10, 0x23, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xDF, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF,
+    0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x02, 0x20, 0xC8, 0xFE, 0xDE,
+    0x6A, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0xE0, 0xFF, 0xFF, 0xDF, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF0, 0xFF,
+    0xFF, 0xBF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0xFF, 0x4F, 0xF3, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x8F, 0xF3,
+    0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xCF, 0xF2, 0xFF, 0xFF, 0xFF,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xDF, 0xF1, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xEF, 0xE0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xEF, 0xB0, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xDF,
+    0x70, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xBF, 0x30, 0xFF, 0xFF,
+    0xFF, 0x6F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x8F, 0x02, 0x51, 0xFC,
+    0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x06, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x30, 0xFD, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xDA, 0xFE, 0xEF, 0x8C, 0x04, 0x00,
+    0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0x53, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xEC, 0xFF, 0xDE, 0x8B, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xDF, 0x8A, 0xFB, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFE, 0xFF, 0xFF, 0xEF, 0x04, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF,
+    0x06, 0x00, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFF,
+    0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0A, 0x10, 0xFF, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xFE, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0xB0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xF9, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0xFF, 0x02, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x2C, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xFB, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x10, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xA9, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x1B, 0x00, 0xC3, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x02, 0x40, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x0B, 0xB0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x3F, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x8F, 0xF2, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xBF, 0xF3, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0xFF, 0xCF, 0xF2, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0xBF, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x9F, 0xC0,
+    0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0x3F, 0x60, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xBF, 0x99, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x5F, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x00,
+    0x00, 0x00, 0x60, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xA7, 0xED, 0xFF, 0xDE, 0x8B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA6, 0xED,
+    0xFF, 0xBE, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x39, 0x21, 0xC5,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xFF, 0x05, 0xF0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x0B, 0xF2,
+    0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x1F, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x4F, 0xF5, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0xAF, 0xF4, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xBF,
+    0xF3, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xCF, 0xF0, 0xFF, 0xFF,
+    0xFF, 0x0D, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xCF, 0xB0, 0xFF, 0xFF, 0xFF, 0xCF, 0x03,
+    0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDC, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xAF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0x9F, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF4, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xC2, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x04, 0xF6, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x94, 0xEC, 0xEF, 0xAD, 0x05,
+    0x00, 0xF9, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x1E, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x52, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0xE0, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xE0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA0, 0xED, 0xFF, 0xFF, 0xCE, 0x69, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5,
+    0xFF, 0x7D, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x5F, 0xF1, 0xFF, 0xFF, 0xFF, 0x6F, 0xF0, 0xFF, 0xFF, 0xFF, 0x3F, 0x80, 0xFF, 0xFF, 0xFF,
+    0x0C, 0x00, 0xF9, 0xFF, 0xBF, 0x01, 0x00, 0x10, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x43, 0x02, 0x00, 0x00, 0xFA, 0xFF, 0xCF, 0x01, 0x90, 0xFF, 0xFF, 0xFF,
+    0x0D, 0xF0, 0xFF, 0xFF, 0xFF, 0x3F, 0xF1, 0xFF, 0xFF, 0xFF, 0x6F, 0xF1, 0xFF, 0xFF, 0xFF, 0x5F,
+    0xD0, 0xFF, 0xFF, 0xFF, 0x2F, 0x50, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xC4, 0xFF, 0x7D, 0x00, 0x00,
+    0x50, 0xFC, 0xDF, 0x07, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF,
+    0x02, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1B, 0x00, 0x00,
+    0x00, 0x41, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xF4, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x70, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF2,
+    0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA2, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2,
+    0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x81, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFB, 0xFF,
+    0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF9, 0xFF, 0xFF, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xE7, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x02, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x6E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xE7, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xCF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x01, 0x00, 0x00, 0x00, 0x30, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xEF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFD, 0xFF, 0xDF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0xBF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x96, 0xDC, 0xFE, 0xEF, 0x8C, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x71, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x05, 0x00, 0x00, 0x92, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x7F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x20, 0xFF,
+    0xFF, 0x8D, 0x25, 0x00, 0x62, 0xFD, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xFA, 0x39, 0x00, 0x00, 0x00,
+    0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x24, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFB, 0xDF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x96, 0xDC, 0xFE, 0xEF, 0xBD, 0x48,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFD, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE,
+    0xAB, 0xBA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF,
+    0xFF, 0xFF, 0xBF, 0x16, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0x9F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xEF, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x1C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x61, 0xDA, 0xFE, 0xEF, 0xAC, 0x48, 0x01, 0x00, 0xF8,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x02, 0xD0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x30,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x60, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xFC,
+    0xFF, 0xDF, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xFE,
+    0xFF, 0x9F, 0x00, 0x20, 0xFF, 0xFF, 0x6F, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xDF, 0x79, 0x97, 0xFC,
+    0xFF, 0xFF, 0x02, 0x00, 0xFA, 0xFF, 0xDF, 0x00, 0x70, 0xFF, 0xFF, 0x0F, 0x00, 0xB0, 0xFF, 0xFF,
+    0xEF, 0x04, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x01, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF,
+    0x0B, 0x00, 0xF3, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x01, 0x00, 0xF3, 0xFF,
+    0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x06, 0x00, 0xF9, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x04, 0xF2, 0xFF, 0xFF, 0x04, 0x00, 0xFE, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x05, 0xF5, 0xFF, 0xFF, 0x01,
+    0x10, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xEF, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x05, 0xF6, 0xFF, 0xFF, 0x00, 0x30, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xEF,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x04, 0xF7, 0xFF, 0xFF, 0x00, 0x40, 0xFF, 0xFF, 0x6F, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x03, 0xF8, 0xFF, 0xEF, 0x00, 0x40,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x01,
+    0xF7, 0xFF, 0xFF, 0x00, 0x30, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0xF6, 0xFF, 0xDF, 0x00, 0xF6, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0x70, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xFB, 0xFF, 0x9F, 0x00, 0xF5, 0xFF, 0xFF, 0x02, 0x00, 0xFD,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xDF, 0x00, 0x10, 0xFF, 0xFF, 0x4F, 0x00, 0xF3,
+    0xFF, 0xFF, 0x05, 0x00, 0xF8, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x03, 0xA0,
+    0xFF, 0xFF, 0x0D, 0x00, 0xF0, 0xFF, 0xFF, 0x09, 0x00, 0xF1, 0xFF, 0xFF, 0xEF, 0x79, 0xE9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8E, 0xFB, 0xFF, 0xFF, 0x05, 0x00, 0xC0, 0xFF, 0xFF, 0x0E, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0x5F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x1D, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x60, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0x01,
+    0xA0, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x61,
+    0xEB, 0xFF, 0x9D, 0x04, 0x00, 0x00, 0xB5, 0xFE, 0xAE, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF,
+    0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x36, 0x00, 0x00, 0x00, 0x00, 0x31, 0xA6, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xBC, 0xCB, 0xEC, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xA7, 0xEC, 0xFF, 0xFF,
+    0xDE, 0x8B, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x8F, 0xFF,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x3B, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0x06, 0xFE, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xB0, 0xFF, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xDF, 0x00, 0xF5, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x8F, 0x00, 0xF0, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x5C, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0xFF, 0xFF, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF7, 0xFF,
+    0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xFD, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0xFF, 0x05, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x9B, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x34, 0x33, 0x43, 0x96, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xBF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xEF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x52,
+    0xFB, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x04, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x17, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x41, 0xFA, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0x05, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF6,
+    0xFF, 0xFF, 0xFF, 0x09, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0xFF, 0x0C, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0E,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0E, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0D, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x0B, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xFF, 0x44, 0x44, 0x44, 0x85,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xAF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x1E, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xEF, 0xAD, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x85, 0xDB, 0xFE, 0xEF, 0x9C, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFA, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x8D, 0x56, 0x75, 0xFB, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xFF,
+    0x02, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x20, 0xC7, 0x0C, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x56, 0x65, 0xB8, 0xFE, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xFA, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xB8, 0xFD, 0xFF,
+    0xEE, 0xAC, 0x37, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xBD, 0x69, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x34, 0x33, 0x53, 0xA6, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x70, 0xFE,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xD2,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xFE, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xA3, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x44, 0x44, 0x65, 0xD9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xAC, 0x37, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x34, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x03, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xB8, 0xED, 0xFF, 0xEF, 0xAD, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x16, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0x56, 0x65, 0xC9, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x51, 0xEC, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF,
+    0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0xFF,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0xF6, 0xFF, 0xFF, 0xFF, 0x03, 0x90, 0xFF,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x50, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x10, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xFB,
+    0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xD0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x30,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x56, 0x55, 0x97, 0xFC, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x50, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x27, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xA7, 0xEC, 0xFF, 0xEF, 0xCE, 0x9A, 0x36, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x45, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0xFD, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x98, 0x57, 0x96,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xFB,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00,
+    0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B,
+    0x00, 0x00, 0x00, 0xB6, 0xED, 0xFF, 0xCD, 0x38, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x0B, 0xF8, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0xC0, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x01, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x4F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF2, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x01, 0xFD, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xEF, 0x45, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0xFA, 0xFF, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xEF, 0x01,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x0D, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x02,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x08, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0xCD, 0xFF, 0xFF, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x7E,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xF8, 0xFF, 0xFF, 0x2E, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x2D,
+    0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x0F, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0x38, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x33, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x1F,
+    0xF3, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0x40, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xF8, 0xFF, 0xFF, 0x1F, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x8F, 0x50,
+    0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x2F, 0xA0, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0x3F, 0x50, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x3F, 0x50, 0xFF, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0E, 0x60, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x3F,
+    0x00, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x09, 0x60, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0xFB, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x04, 0x60,
+    0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0xF6, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xFF,
+    0xFF, 0xEF, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0xF1, 0xFF, 0xFF,
+    0x1F, 0x00, 0x50, 0xFF, 0xFF, 0x9F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x4F,
+    0x00, 0xC0, 0xFF, 0xFF, 0x6F, 0x00, 0xA0, 0xFF, 0xFF, 0x4F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x80, 0xFF, 0xFF, 0xBF, 0x00, 0xF0, 0xFF, 0xFF, 0x0E, 0x00, 0x60,
+    0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x00, 0xF4, 0xFF,
+    0xFF, 0x09, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xFE, 0xFF,
+    0xFF, 0x05, 0xFA, 0xFF, 0xFF, 0x04, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x0A, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x4E, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
+    0x4F, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xA0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF,
+    0x02, 0xF8, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x1E, 0xFE, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xA0, 0xFF,
+    0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x0F, 0xF6, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x0F, 0xD0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x1F, 0x40, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x1F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x2F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x90, 0xFF, 0xFF,
+    0xFF, 0x8F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x10, 0xFE,
+    0xFF, 0xFF, 0xFF, 0x02, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x3F, 0x00,
+    0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF,
+    0x4F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x06, 0x80, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF,
+    0xFF, 0x4F, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0E, 0x80, 0xFF, 0xFF, 0xFF, 0x02, 0xF8,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x8F, 0x70, 0xFF, 0xFF, 0xFF, 0x02,
+    0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x62, 0xFF, 0xFF, 0xFF,
+    0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x5B, 0xFF, 0xFF,
+    0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF,
+    0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x96, 0xDC, 0xFF, 0xFF, 0xBD, 0x59, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E,
+    0x56, 0x65, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x5E, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0xDF, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x02, 0x90, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x05, 0xC0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x08, 0xE0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0C, 0xF0, 0xFF, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0D, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x0D, 0xF0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2,
+    0xFF, 0xFF, 0xFF, 0x0D, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0C, 0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x0A, 0xB0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x08, 0x80, 0xFF, 0xFF, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x05, 0x50, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x7F, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x67, 0x76,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x96, 0xEC, 0xFF, 0xFF, 0xBD, 0x58, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xBD, 0x48, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x01, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xDF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x34, 0x33, 0x64, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0E, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0x1F, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x0B, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xFF, 0x34, 0x43, 0x85, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x01, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1A, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x9C, 0x16, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x96, 0xDC,
+    0xFF, 0xFF, 0xBD, 0x59, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x4F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x56, 0x65, 0xE9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+    0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x1E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x10, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
+    0x90, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0xFF, 0x05, 0xC0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x08, 0xE0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0C, 0xF0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0D, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0D,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0xFF, 0x0C, 0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0x0A, 0xB0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x08, 0x80, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x05, 0x50, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x67, 0x76, 0xFA, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFD, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x96, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x04,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xAC, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x34, 0x43,
+    0x75, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0xF2, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF,
+    0x0F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0C,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x42, 0xF9, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x23, 0x22,
+    0xFB, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x70, 0xFF,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xFD, 0xFF,
+    0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF,
+    0x4F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xEF,
+    0x01, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x30,
+    0xB7, 0xED, 0xFF, 0xDE, 0x7A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x39, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D,
+    0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xFB, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x02, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0x55, 0xA7, 0xFD, 0xFF, 0xBF, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x20, 0xD7, 0x5F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF2, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x7F,
+    0xAA, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x6F, 0xFB, 0xDF, 0x27, 0x00,
+    0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0x2F, 0xFB, 0xFF, 0xFF, 0xAE, 0x57, 0x44, 0x95, 0xFE,
+    0xFF, 0xFF, 0xFF, 0x0D, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06,
+    0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xFB, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x00, 0x00, 0x50, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x85, 0xDB, 0xFE, 0xFF, 0xCE, 0x69, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+    0x44, 0x44, 0x44, 0x44, 0x84, 0xFF, 0xFF, 0xFF, 0x7F, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF,
+    0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF,
+    0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF,
+    0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF,
+    0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFB, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFB, 0xFF, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x8F, 0xF9, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x5F, 0xF4, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0xF0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x0D, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x79, 0x65, 0xA7,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xC8, 0xED, 0xFF, 0xDE, 0x7A, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x05, 0xF7, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xFF, 0xAF, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0xFF, 0xFF, 0x5F, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xD0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF2, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xF9, 0xFF, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xFE, 0xFF,
+    0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A, 0x20, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x0E, 0x70,
+    0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x2F,
+    0xB0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0x6F, 0xF0, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xAF, 0xF3, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0xFF, 0xFF, 0xEF, 0xF6, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0xF9, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xBF, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0xFF, 0x0B, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xFD, 0xFF, 0xFF,
+    0x6F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0xFF, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xDF, 0xF9, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xAF, 0xF6, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x7F, 0xF3, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0xD0, 0xFF, 0xFF, 0x4F, 0xF0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x1F, 0xC0, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF,
+    0x0F, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x0D, 0x90, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x0A,
+    0x50, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x06, 0x10, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xF2,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xBF, 0x00, 0x20, 0xFF, 0xFF,
+    0xFF, 0x02, 0x00, 0xFD, 0xFF, 0xFF, 0x08, 0x00, 0xF6, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x00, 0x60, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x0C,
+    0x00, 0xF9, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x02, 0xA0,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x0F, 0x00, 0xFD, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x06, 0xE0, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0x3F, 0x10, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF,
+    0x09, 0xF2, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x7F, 0x40, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x0C, 0xF5, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xAF, 0x70, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xDF, 0xA0, 0xFF, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x2F, 0xFB, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0x5F, 0xFD, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0xFF, 0xFC, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x03, 0x40, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0xFF,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0xF2, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xFC, 0xFF, 0xFF, 0xDF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xEF, 0x50, 0xFF, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xBF, 0xD0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x2F, 0x40, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x1E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x1E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xFA, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x1E, 0xFB, 0xFF, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x0E, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x06, 0xA0, 0xFF, 0xFF, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x20, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0x6F, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0xFF, 0xFF, 0xEF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0x06, 0xF3, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0xFF, 0xFF, 0xFF, 0x0E, 0xFB, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x04, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x04, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0x41, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xE4, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x9F, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x03,
+    0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0C, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x05, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xF8, 0xFF, 0xFF, 0x2D, 0x22, 0x22, 0x00, 0xF8, 0xFF,
+    0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0x2D, 0x22, 0x22, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x05, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x05, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xD0, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xFF, 0xFF, 0xFF, 0x02, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x21, 0x22, 0x62, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x21, 0x22,
+    0x62, 0xFF, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x01, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xB5, 0xFF,
+    0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xEF, 0x30, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x7F, 0x00, 0xFA, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x1F, 0x00, 0xF2, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x09, 0x00, 0xA0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0x02, 0x00, 0x20, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x20, 0xFF,
+    0xFF, 0x9F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0x02, 0x00, 0x20, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0x00,
+    0xA0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0xF1, 0xFF,
+    0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xBF, 0x00, 0xF9, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x03, 0x60, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x46, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFC, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xC1, 0xFF,
+    0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xFD, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x51, 0xB8, 0xED, 0xFF, 0xDE, 0x7A, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00,
+    0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x9C, 0x98, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF6, 0x8E, 0x03, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x41, 0xA7, 0xCB, 0xED, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x30, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x79,
+    0x66, 0xF5, 0xFF, 0xFF, 0xFF, 0x07, 0xF5, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x07, 0xFA, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07,
+    0xFC, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x07, 0xFD, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0x07, 0xFB, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xD2, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xFF, 0xCF, 0x78, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x07, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x07, 0xA0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xFE, 0xFF, 0xFF, 0x07, 0x10, 0xFD, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x02, 0xF9, 0xFF, 0xFF, 0x07, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A,
+    0x00, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x93, 0xEC, 0xFF, 0xCE, 0x28, 0x00, 0x00, 0xE0, 0xFF,
+    0xFF, 0x07, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x04, 0x00, 0xA5, 0xED, 0xDF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x03, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x52, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x02, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0A, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x01, 0x50, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x02, 0xF1, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x04, 0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0xFF, 0x04, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x04, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x03, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x02, 0xF1, 0xFF, 0xFF, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0xE2, 0xFF,
+    0xFF, 0xFF, 0x7F, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x02, 0x61, 0xFE, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xF1, 0xFF,
+    0xFF, 0xEF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x7F,
+    0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x2F, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0C, 0x00, 0x10, 0xB6, 0xFD,
+    0xDF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xDB, 0xFE, 0xEF, 0xAC, 0x26,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00,
+    0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x2F, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x20, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x6D, 0x01, 0x31, 0xB6, 0xFF, 0x05, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x1E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x4E, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0x02, 0x21, 0x95, 0xFE, 0x4F, 0x00, 0x00, 0xFE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x4F, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0x30, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x20, 0xA6, 0xED,
+    0xFF, 0xEF, 0x9B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x71, 0xDC, 0xEF, 0xAD, 0x04,
+    0x00, 0xF9, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x03, 0xF8, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xF6, 0xFF, 0xFF, 0xCF, 0x00,
+    0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0x00, 0xF6, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x12, 0x83, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0xD0, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xCF,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xCF, 0xF4, 0xFF, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xCF, 0xF7, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xCF, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0xCF, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0xCF, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xCF, 0xFB, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xCF, 0xFA, 0xFF, 0xFF, 0xDF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xCF, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xCF, 0xF8, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0xCF, 0xF5, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xCF, 0xF2,
+    0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xCF, 0xD0, 0xFF, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xCF, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0x00,
+    0x51, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF4, 0xFF, 0xFF, 0xCF, 0x00, 0x10, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xD0, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xBF, 0x01, 0x70, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x82, 0xEC, 0xEF, 0x9C, 0x03, 0x00,
+    0x20, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x84, 0xDC, 0xFF, 0xDE, 0x6A, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x8E, 0x55, 0xC7, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x04, 0x90,
+    0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x0E, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x2F, 0xF6, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0x4F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFB, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x5F, 0xF9, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x61, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x10, 0xB6,
+    0xDF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x99, 0xBA, 0xFE, 0xFF, 0xDF, 0x00, 0x00,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x10, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xC9, 0xFE, 0xFF, 0xDE, 0x8B, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x71, 0xDA, 0xFE, 0xEF, 0xAD, 0x37, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xF2, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x51, 0x06, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x99, 0x99, 0xFF, 0xFF, 0xFF, 0xDF, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xEC, 0xFF, 0xBE, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xEF,
+    0x89, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x10,
+    0xFC, 0xFF, 0xFF, 0xEF, 0x59, 0x01, 0x00, 0xF6, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xF2, 0xFF,
+    0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
+    0x03, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x10,
+    0xFD, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xEF, 0x9A, 0xFA, 0xFF, 0xFF,
+    0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC1, 0xFF, 0xFF, 0xEE, 0xFF, 0xDE, 0x7A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xDF, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
+    0x9C, 0x05, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
+    0x05, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x50,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xFB, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xA0, 0xFF, 0xFF, 0xFF, 0x4B, 0x01,
+    0x00, 0x00, 0x20, 0xB5, 0xFF, 0xFF, 0xFF, 0x3F, 0xF4, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x5F, 0xFA, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0x4F, 0xFC, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF,
+    0xFF, 0x2F, 0xFD, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0E,
+    0xFB, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0x08, 0xF7, 0xFF,
+    0xFF, 0xFF, 0x39, 0x00, 0x00, 0x10, 0x95, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xEF, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0x20, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x96, 0xEC, 0xFF, 0xEF, 0xCE, 0x7A, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x04, 0x00, 0xA4, 0xED, 0xEF, 0x9D, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x03, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x52, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x5F, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x03, 0x10, 0xF8, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0x10, 0xD9, 0xEF, 0x2A, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x01,
+    0xF3, 0xFF, 0xFF, 0xFF, 0x08, 0xF5, 0xFF, 0xFF, 0xFF, 0x0A, 0xF4, 0xFF, 0xFF, 0xFF, 0x09, 0xE0,
+    0xFF, 0xFF, 0xFF, 0x04, 0x30, 0xFD, 0xFF, 0x7F, 0x00, 0x00, 0x20, 0x34, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFD, 0xAE, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x42, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x3F, 0x51, 0x02, 0x20, 0xF9,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0xF3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x06, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1D, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x81, 0xDB, 0xFE, 0xEF,
+    0x7B, 0x01, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x1D, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0xFF, 0x3F, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x04, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x03, 0xD1, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x02, 0xFB, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x81, 0xFF,
+    0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x01, 0xF7, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x09, 0x00,
+    0xB0, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x10, 0xFE,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x09, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x0D, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0x9F, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xB7, 0xFE, 0xDF, 0x8C,
+    0x03, 0x00, 0x00, 0x00, 0x71, 0xEB, 0xFF, 0xCE, 0x28, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0C,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x1F, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x10, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0xF1, 0xFF, 0xFF, 0x6F, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDF, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x5F, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+    0x01, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x16, 0x00, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF1, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x04, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x0F, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF,
+    0x5F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF,
+    0x5F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA6, 0xFD, 0xEF, 0x9D, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0C,
+    0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x1F, 0xA0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x6F, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x5F, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x03, 0x10, 0xF7, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x73, 0xDB, 0xFE, 0xDF, 0x7B, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0xD0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B,
+    0x01, 0x51, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0xFF, 0xFF, 0xEF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x02, 0xF7, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x06,
+    0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0A, 0xFB, 0xFF, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0B, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x09, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x08, 0xF6, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0xFF, 0x06, 0xF3, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x02,
+    0xE0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xEF, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x10, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x4C, 0x01, 0x41, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0xEB, 0xFF, 0xDE, 0x7B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA5, 0xED, 0xDF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x2F,
+    0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x7F, 0x50, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xDF, 0xF3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x02, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0B, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x01, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x02, 0xF1, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x04, 0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0xFF, 0x04, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x04, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x02, 0xF1, 0xFF, 0xFF, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0xFF, 0x7F, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x02, 0x51, 0xFD, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x02, 0xF7,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x04, 0x10, 0xB6, 0xFD,
+    0xDF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x71, 0xEC, 0xEF, 0x9D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x03, 0xA0, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x5F, 0xE0, 0xFF, 0xFF, 0xCF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF,
+    0xFF, 0xCF, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x10,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x70, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x5C, 0x12, 0x73, 0xFE, 0xFF, 0xFF, 0xFF, 0xCF, 0xC0, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xCF, 0xF1, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0xFF, 0xCF, 0xF4, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xCF,
+    0xF7, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xCF, 0xF9, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xCF, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xCF, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0xCF, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0xCF, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xCF, 0xF9, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xCF, 0xF8, 0xFF, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xCF, 0xF5, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xCF, 0xF2, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF,
+    0xFF, 0xCF, 0xD0, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xCF, 0x70,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x00, 0x30, 0xFB, 0xFF, 0xFF, 0xFF, 0xCF, 0x10, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF8,
+    0xFF, 0xFF, 0xCF, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xF8, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0xFA, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x82, 0xEC, 0xFF, 0x9D, 0x04, 0x00, 0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFD, 0xEF, 0x08,
+    0xF1, 0xFF, 0xFF, 0x0A, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x08, 0xF1, 0xFF, 0xFF, 0x0E, 0x10, 0xFC,
+    0xFF, 0xFF, 0xFF, 0x07, 0xF1, 0xFF, 0xFF, 0x3F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xF1, 0xFF,
+    0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x03, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x48, 0x01, 0x10, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xA7, 0xED, 0xFF, 0xDE, 0x8B, 0x04, 0x00, 0x00, 0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x5B, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x70,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xAE, 0x88, 0xDA, 0xFF, 0xFF, 0x4F, 0x00,
+    0xFA, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x61, 0xFC, 0x0D, 0x00, 0xFB, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xAF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x06, 0x00,
+    0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x07, 0x00, 0x00, 0x00, 0xE2, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x3E, 0x00, 0x00, 0x00, 0x10, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0E, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0xFF, 0xFF, 0xFF, 0x0D, 0xFB, 0x8D, 0x03, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0x0B,
+    0xFB, 0xFF, 0xFF, 0x9C, 0x78, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F,
+    0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xD6, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x62, 0xCA, 0xFE, 0xFF, 0xEF, 0x9C, 0x16, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0xDD, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x60, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0C, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xFD, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C,
+    0x98, 0xB9, 0xFF, 0xFF, 0xFF, 0xAF, 0x99, 0x99, 0x99, 0x07, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x62, 0x1A,
+    0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1E, 0x00, 0x00, 0x00, 0x10, 0xB7, 0xFE, 0xFF, 0xCE, 0x59, 0x00, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF,
+    0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
+    0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xD0, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xA6, 0xFF, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x60, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x20, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x10, 0xA6, 0xED, 0xFF, 0xAD, 0x05, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x03, 0xF6, 0xFF, 0xFF, 0xFF, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xDF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFA, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0xFF, 0x0C, 0x50, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xFF, 0x1F, 0xA0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF,
+    0xFF, 0x5F, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0x9F, 0xF2, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xDF,
+    0xF6, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xF8,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x02, 0xF1, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xDF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
+    0x09, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0x9F, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x4F, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xFE,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x6F, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xEF, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0xD0, 0xFF, 0xFF, 0x09, 0xFE, 0xFF, 0xAF, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF1, 0xFF, 0xFF,
+    0x05, 0xFA, 0xFF, 0xEF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x00, 0xF6, 0xFF, 0xFF, 0x01, 0xF7, 0xFF, 0xFF, 0x02, 0x00, 0xFD, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xFA, 0xFF, 0xDF, 0x00, 0xF3, 0xFF, 0xFF,
+    0x06, 0x20, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x2F, 0x00, 0xFE,
+    0xFF, 0xAF, 0x00, 0xF0, 0xFF, 0xFF, 0x0A, 0x50, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0xFF, 0x6F, 0x20, 0xFF, 0xFF, 0x6F, 0x00, 0xB0, 0xFF, 0xFF, 0x0D, 0x90, 0xFF, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x9F, 0x50, 0xFF, 0xFF, 0x2F, 0x00, 0x70,
+    0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xCF,
+    0x80, 0xFF, 0xFF, 0x0E, 0x00, 0x40, 0xFF, 0xFF, 0x3F, 0xF0, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xEF, 0xA0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xFF, 0xFF, 0x6F, 0xF2,
+    0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0xFC, 0xFF, 0x9F, 0xF5, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF5, 0xFF,
+    0xEF, 0xFA, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x3F, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+    0xE1, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF,
+    0xFF, 0xFF, 0x3F, 0x40, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0xFF, 0xCF, 0xD0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xEF, 0xF3, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x6F, 0x70, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x02, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0xFF, 0x8F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xFC, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x03, 0xF6, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0x7F, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0xFF, 0x1F, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0xFF, 0x05, 0x00, 0xFA, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF,
+    0x0B, 0x00, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x0F,
+    0x50, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x5F, 0xA0,
+    0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x9F, 0xE0, 0xFF,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xDF, 0xF3, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x10, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xDB, 0xFF, 0xDE, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x7F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xE0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x90, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xFB, 0xFF, 0xFF,
+    0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xCF, 0xBB, 0xBB, 0xBB, 0xBB,
+    0xBB, 0x9B, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xEF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xB9,
+    0xED, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xDF, 0x59, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x30, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x0F, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x6B, 0x01, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0xFF, 0x7B, 0x01, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x30, 0xF9, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6,
+    0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xDF, 0x6A, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xB9, 0xED, 0xBF, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF,
+    0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F,
+    0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE,
+    0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF,
+    0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F,
+    0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE,
+    0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF,
+    0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F,
+    0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE,
+    0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFF, 0xDE, 0x8B, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0xA8, 0xFE, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x5C, 0x02, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x20, 0xC8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x30, 0xC8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x6D,
+    0x02, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF,
+    0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xA8, 0xFE,
+    0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xDE, 0x8B, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xEB, 0xEF, 0x8C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x05, 0x20, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x06, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xDF, 0x06, 0x00, 0x00, 0x50, 0xFE, 0x06, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x7A, 0x75, 0xFC, 0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x06, 0xFD, 0xFF, 0x69, 0x86, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xFD,
+    0x1B, 0x00, 0x00, 0x20, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x9D, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xB6, 0xFE, 0xDF, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0x7D, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x09, 0xD0, 0xFF, 0xFF,
+    0xFF, 0x2F, 0xF1, 0xFF, 0xFF, 0xFF, 0x5F, 0xF1, 0xFF, 0xFF, 0xFF, 0x6F, 0xF0, 0xFF, 0xFF, 0xFF,
+    0x3F, 0x90, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0xF9, 0xFF, 0xCF, 0x02, 0x00, 0x10, 0x44, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x87, 0x88, 0x88, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0xFF,
+    0xFF, 0xFF, 0x03, 0x10, 0xFF, 0xFF, 0xFF, 0x04, 0x20, 0xFF, 0xFF, 0xFF, 0x04, 0x30, 0xFF, 0xFF,
+    0xFF, 0x05, 0x40, 0xFF, 0xFF, 0xFF, 0x06, 0x50, 0xFF, 0xFF, 0xFF, 0x07, 0x50, 0xFF, 0xFF, 0xFF,
+    0x08, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x70, 0xFF, 0xFF, 0xFF, 0x0A, 0x80, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x90, 0xFF, 0xFF, 0xFF, 0x0B, 0xA0, 0xFF, 0xFF, 0xFF, 0x0C, 0xB0, 0xFF, 0xFF, 0xFF, 0x0D, 0xB0,
+    0xFF, 0xFF, 0xFF, 0x0E, 0xC0, 0xFF, 0xFF, 0xFF, 0x0F, 0xD0, 0xFF, 0xFF, 0xFF, 0x0F, 0xE0, 0xFF,
+    0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 0xFF, 0x2F, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x3F, 0xF1, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFC, 0xFF, 0xFF, 0xBD,
+    0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x01, 0x00,
+    0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x40, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x5F, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x01, 0x10, 0x94, 0xFE, 0x09, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x01, 0x00, 0x00, 0x00, 0x10, 0x77, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x13, 0x21, 0x74,
+    0xFB, 0x9F, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00,
+    0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x00, 0x00, 0x00, 0x10, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x85, 0xFC, 0xFF, 0xFF, 0xAD, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xEC, 0xFF, 0xDE,
+    0x8B, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C,
+    0x01, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x9F, 0x13, 0x31, 0xA6, 0xFE,
+    0x0C, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x50, 0x04, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x55, 0x55, 0xFB, 0xFF, 0xFF,
+    0xDF, 0x55, 0x55, 0x55, 0x55, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC4, 0xFF, 0xFF, 0xFF, 0x5B, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x35, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x20, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0xE2, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x9F, 0x00, 0x20, 0xFE, 0xFF, 0x0B, 0xA4, 0xFD, 0xFF, 0x7C, 0x30, 0xFF, 0xFF, 0x09, 0xE0,
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x8F, 0x70, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xDF, 0x01, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00,
+    0x70, 0xFF, 0xFF, 0xDF, 0x15, 0x20, 0xF9, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x1D,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xBF, 0x00, 0x00, 0xF5, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xEF, 0x00, 0x00,
+    0xF6, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xEF, 0x00, 0x00, 0xF5, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0xEF, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xBF, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x70, 0xFF, 0xFF, 0xDF, 0x15, 0x20, 0xF8, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xCF, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xD0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x10, 0xFD, 0xFF, 0x0A, 0xA5,
+    0xFE, 0xFF, 0x7C, 0x41, 0xFF, 0xFF, 0x08, 0x00, 0xD1, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0x8F, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x9F, 0x00, 0x90, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x10, 0xFF, 0xFF, 0xFF,
+    0x6F, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xF8, 0xFF,
+    0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xFE, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x0E, 0x60, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x6F, 0xD0, 0xFF, 0xFF, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xDF, 0xF4, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x55, 0x55, 0xF8, 0xFF,
+    0xFF, 0xDF, 0x55, 0x55, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x51, 0x55, 0x55, 0xF8, 0xFF, 0xFF, 0xDF, 0x55, 0x55, 0x45, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF,
+    0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F,
+    0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE,
+    0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF,
+    0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF,
+    0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F,
+    0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE,
+    0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0xFE, 0xFF, 0x7F, 0x00, 0x00,
+    0x10, 0xA6, 0xED, 0xFF, 0xCE, 0x69, 0x01, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x16, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xFD, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x80, 0xFF, 0xFF, 0xFF, 0xBE, 0xBA, 0xFD, 0xFF, 0xFF, 0x0A,
+    0xD0, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x10, 0xC5, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x73, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFD, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x02, 0x50, 0xFF, 0xFF, 0x7F, 0x10, 0xE7, 0xFF, 0xFF, 0xFF, 0x0D, 0xB0, 0xFF,
+    0xFF, 0x0C, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x5F, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0xAF, 0xF0, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xCF, 0xF0, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xCF, 0xB0, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0xFD, 0xFF, 0xAF,
+    0x50, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x40, 0xFF, 0xFF, 0x6F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x8E,
+    0xE5, 0xFF, 0xFF, 0x1F, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0x00, 0x10, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xCF, 0x95, 0x02, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xBF, 0xF6, 0xCF,
+    0x27, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0x7F, 0xF6, 0xFF, 0xFF, 0xBE, 0x9A, 0xDA, 0xFF, 0xFF,
+    0xFF, 0x1F, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xF6, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x71, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00,
+    0x00, 0x30, 0xA7, 0xED, 0xFF, 0xDE, 0x7A, 0x02, 0x00, 0x00, 0x00, 0x62, 0x47, 0x00, 0x00, 0x00,
+    0x73, 0x47, 0x00, 0x50, 0xFF, 0xFF, 0x0B, 0x00, 0x70, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0x6F,
+    0x00, 0xF1, 0xFF, 0xFF, 0x4F, 0xF2, 0xFF, 0xFF, 0x9F, 0x00, 0xF4, 0xFF, 0xFF, 0x8F, 0xF1, 0xFF,
+    0xFF, 0x8F, 0x00, 0xF3, 0xFF, 0xFF, 0x6F, 0xB0, 0xFF, 0xFF, 0x2F, 0x00, 0xD0, 0xFF, 0xFF, 0x1E,
+    0x10, 0xE9, 0xCF, 0x03, 0x00, 0x20, 0xEA, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xA7, 0xED, 0xFF, 0xCE, 0x69, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x81, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0xDF, 0x8A, 0x87, 0xB9, 0xFE, 0xFF, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x7D, 0x01, 0x00, 0x00, 0x00,
+    0x40, 0xF9, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xAF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x50, 0xDA, 0xFE, 0xDE, 0x6A, 0x01, 0x00, 0xD1, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0xC0, 0xFF, 0x9F, 0x00, 0x00, 0x60, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x04, 0x10,
+    0xFE, 0xFF, 0x05, 0x00, 0x00, 0xF5, 0xFF, 0x0B, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0B, 0x00, 0xF2, 0xFF, 0x0E, 0x00, 0x00, 0xFD, 0xFF, 0x01, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x70, 0xFF, 0x7F, 0x00, 0x40, 0xFF, 0x8F, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xAC, 0xCA, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xFE, 0xEF, 0x00, 0xA0, 0xFF, 0x1F,
+    0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x40, 0x5B, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x03,
+    0xF0, 0xFF, 0x0A, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0x09, 0xF2, 0xFF, 0x05, 0x00, 0x50, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0C, 0xF5, 0xFF, 0x02, 0x00, 0x90, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0xF7, 0xFF, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x0F, 0xF8, 0xFF, 0x00, 0x00,
+    0xB0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x1F, 0xF8,
+    0xEF, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0x1F, 0xF7, 0xFF, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0x0F, 0xF6, 0xFF, 0x02, 0x00, 0x80, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0xF3, 0xFF, 0x05, 0x00, 0x50, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0C, 0xF0, 0xFF, 0x0A, 0x00, 0x10,
+    0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x09, 0xA0, 0xFF,
+    0x0F, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x20, 0xB7, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0x04, 0x50, 0xFF, 0x7F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xAC, 0xCA, 0xFE, 0xDF, 0x00, 0x00,
+    0x00, 0xFE, 0xEF, 0x00, 0x00, 0xFD, 0xFF, 0x01, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0x70, 0xFF, 0x7F, 0x00, 0x00, 0xF6, 0xFF, 0x0B, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xF2, 0xFF, 0x0E, 0x00, 0x00, 0xC0, 0xFF, 0x8F, 0x00, 0x00,
+    0x50, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x10, 0xFD, 0xFF, 0x05, 0x00, 0x00, 0x20, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x50, 0xD9, 0xFE, 0xEF, 0x7B, 0x02, 0x00, 0xD1, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0xFF,
+    0x1D, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xF8, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x6D, 0x01, 0x00, 0x00,
+    0x00, 0x30, 0xF8, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0xFF,
+    0xDF, 0x8A, 0x77, 0xB8, 0xFE, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x81, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xB7, 0xED, 0xFF, 0xCE, 0x69, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xEC, 0xFF, 0xAE, 0x04, 0x00, 0x20, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x30, 0xFF, 0xFF,
+    0xDF, 0xFE, 0xFF, 0xFF, 0x5F, 0x00, 0xFB, 0x49, 0x00, 0x10, 0xFC, 0xFF, 0xAF, 0x00, 0x11, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x21, 0xF3, 0xFF, 0xFF, 0x00, 0x30, 0xB8,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF,
+    0xFF, 0xCE, 0xFB, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x06, 0x00, 0xE0, 0xFF, 0xFF, 0xFC, 0xFF, 0x6F,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFD, 0xFF, 0x3F, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFC, 0xFF, 0x7F,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xBC, 0xFE, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x7F, 0xFE, 0xFF, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFA, 0xFF, 0x00, 0x92, 0xFD,
+    0xDF, 0x28, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC1,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0x00, 0xFC, 0xDF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x90, 0xFF, 0xFF, 0xCF, 0x03, 0x00,
+    0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x90,
+    0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0xFF, 0x05, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x8F, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xA0, 0xFF,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0xF7, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0xFF, 0x06, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xEF, 0x01, 0x00,
+    0xF7, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xA0, 0xFF,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xFD, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00,
+    0xE1, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0xA0, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0xAF, 0x02, 0x00, 0x00, 0x00, 0xFC, 0xDF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xC1, 0x06, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0xF5, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x06, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x9F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xA7, 0xED, 0xFF, 0xCE, 0x69, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0xDF, 0x8A,
+    0x87, 0xB9, 0xFE, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0x7D, 0x01, 0x00, 0x00, 0x00, 0x40, 0xF9, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xEF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0xAF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF,
+    0x1D, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x08, 0xC0, 0xFF, 0xFF, 0xFF, 0xEF, 0x8C, 0x03, 0x00,
+    0x00, 0xD1, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x9F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xBF, 0x01, 0x00, 0x10, 0xFE, 0xFF, 0x05, 0x00, 0x00, 0xF5, 0xFF, 0x0B, 0x00, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0xF2, 0xFF, 0x0E, 0x00, 0x00, 0xFD, 0xFF, 0x01,
+    0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x70, 0xFF, 0x7F, 0x00, 0x40,
+    0xFF, 0x8F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1D, 0x83, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xFE,
+    0xEF, 0x00, 0xA0, 0xFF, 0x1F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0D, 0x00, 0xFA, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0xF7, 0xFF, 0x03, 0xF0, 0xFF, 0x0A, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0D, 0x00, 0xF7,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF1, 0xFF, 0x09, 0xF2, 0xFF, 0x05, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
+    0x0D, 0x00, 0xF7, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xC0, 0xFF, 0x0C, 0xF5, 0xFF, 0x02, 0x00, 0x00,
+    0xC0, 0xFF, 0xFF, 0x0D, 0x00, 0xFB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0xF7, 0xFF,
+    0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1D, 0x83, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0x1F, 0xF8, 0xEF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x1F, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x0F, 0xF6, 0xFF, 0x02, 0x00, 0x00, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0xF3, 0xFF, 0x05,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0D, 0xFB, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0C,
+    0xF0, 0xFF, 0x0A, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0D, 0xF3, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0x09, 0xA0, 0xFF, 0x0F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0D, 0xA0, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0x04, 0x50, 0xFF, 0x7F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0D, 0x20,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xFE, 0xEF, 0x00, 0x00, 0xFD, 0xFF, 0x01, 0x00, 0xC0, 0xFF,
+    0xFF, 0x0D, 0x00, 0xF8, 0xFF, 0xFF, 0x06, 0x00, 0x70, 0xFF, 0x7F, 0x00, 0x00, 0xF6, 0xFF, 0x0B,
+    0x00, 0xC0, 0xFF, 0xFF, 0x0D, 0x00, 0xF1, 0xFF, 0xFF, 0x1E, 0x00, 0xF2, 0xFF, 0x0E, 0x00, 0x00,
+    0xC0, 0xFF, 0x8F, 0x00, 0xC0, 0xFF, 0xFF, 0x0D, 0x00, 0x70, 0xFF, 0xFF, 0xAF, 0x10, 0xFD, 0xFF,
+    0x05, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x07, 0xC0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
+    0xD5, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xFE, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF,
+    0xFF, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x30, 0xF8, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xFD, 0xFF, 0xFF, 0xDF, 0x8A, 0x77, 0xB8, 0xFE, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xB7, 0xED,
+    0xFF, 0xCE, 0x69, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x02, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x02, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x02, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x50, 0xEB, 0xFF, 0x7C, 0x01, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x6F, 0x00, 0xB0, 0xFF, 0xFF, 0xDF, 0xBA, 0xFF, 0xFF, 0xFF, 0x02, 0xF2, 0xFF, 0xFF,
+    0x05, 0x00, 0xD2, 0xFF, 0xFF, 0x09, 0xF7, 0xFF, 0x7F, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x0E, 0xFA,
+    0xFF, 0x0F, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x0F, 0xFB, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0x1F, 0xFA, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x1F, 0xF8, 0xFF, 0x7F, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0x0E, 0xF3, 0xFF, 0xFF, 0x05, 0x00, 0xD2, 0xFF, 0xFF, 0x09, 0xC0, 0xFF, 0xFF, 0xDF,
+    0xBA, 0xFF, 0xFF, 0xFF, 0x02, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xEB, 0xFF, 0x8C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x88, 0x88,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x54, 0x55, 0x55, 0x55,
+    0x95, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xBB, 0xBB, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x02, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xA5, 0xED, 0xEF, 0x8C, 0x01,
+    0x00, 0x00, 0x00, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x06, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xB0, 0xFF, 0xFF,
+    0xBD, 0xFE, 0xFF, 0xFF, 0x5F, 0x00, 0x10, 0xFE, 0x3C, 0x00, 0xB0, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x83, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0x01, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x02, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFA, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00,
+    0x10, 0xB6, 0xFD, 0xEF, 0x6B, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0xE3,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x30,
+    0xFF, 0xAF, 0x35, 0xD5, 0xFF, 0xFF, 0x1F, 0x00, 0xB7, 0x02, 0x00, 0x30, 0xFF, 0xFF, 0x3F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0x10, 0xE6, 0xFF, 0xFF, 0x04, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x00, 0x00,
+    0x30, 0xEE, 0xFE, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFF, 0xFF, 0x5F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xEF, 0xC9,
+    0x04, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0xF9, 0xDF, 0x58, 0x33, 0xB5, 0xFF, 0xFF, 0xAF, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0xC3,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x82, 0xEB, 0xFF, 0xDE, 0x6A, 0x01, 0x00, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00,
+    0x00, 0xFD, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xAF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF,
+    0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF,
+    0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF,
+    0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x01, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D,
+    0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x00, 0x82, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
+    0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0xFF, 0xFF, 0xFF, 0x01, 0xF1,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x21, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF,
+    0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0xFE, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x13,
+    0xD8, 0xFF, 0x8D, 0x01, 0x00, 0xFA, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x61, 0xDA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x10, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xEF, 0xEE, 0xFF, 0xFF, 0x07, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x08, 0x00, 0xF7, 0xFF, 0x07, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00,
+    0xF7, 0xFF, 0x07, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF7, 0xFF,
+    0x07, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0xF0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0xF1, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x08, 0x00, 0xF7, 0xFF, 0x07, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00,
+    0xF7, 0xFF, 0x07, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF7, 0xFF,
+    0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0xB0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x70, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x10, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00,
+    0xF7, 0xFF, 0x07, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF7, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x83, 0xEC, 0xFF, 0xCE, 0xFC, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00,
+    0xF7, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00, 0xF7, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00,
+    0xF7, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00, 0xF7, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0xC5, 0xFF, 0x7D, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0x09, 0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0xF1, 0xFF, 0xFF, 0xFF, 0x5F, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x6F, 0xF0, 0xFF, 0xFF, 0xFF, 0x3F, 0x80, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xF9, 0xFF, 0xBF,
+    0x01, 0x00, 0x10, 0x44, 0x02, 0x00, 0x00, 0xF1, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x6F,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0xDF, 0x07, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x50,
+    0xFD, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x2F,
+    0x57, 0x23, 0xF4, 0xFF, 0xFF, 0x1F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x06, 0xFE, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xC8, 0xFE, 0xEF, 0x8C, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xD2, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x04, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x04, 0xF4, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x04, 0xF3, 0xFF, 0xBF, 0xF6, 0xFF, 0xFF, 0x04, 0x50,
+    0xFF, 0x0A, 0xF7, 0xFF, 0xFF, 0x04, 0x00, 0x77, 0x00, 0xF7, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x04, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x71, 0xEB, 0xEF, 0x8D, 0x02, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0B, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xB0, 0xFF, 0xFF, 0x3C,
+    0x10, 0xF8, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0x01, 0x00, 0xA0, 0xFF, 0xFF, 0x07, 0xF5, 0xFF,
+    0xAF, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0B, 0xF8, 0xFF, 0x7F, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x0E,
+    0xF9, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xF9, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0x0F, 0xF8, 0xFF, 0x7F, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x0E, 0xF5, 0xFF, 0xAF, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0x0B, 0xF1, 0xFF, 0xFF, 0x01, 0x00, 0xA0, 0xFF, 0xFF, 0x07, 0xA0, 0xFF, 0xFF,
+    0x3C, 0x10, 0xF8, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x50, 0xFE, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0xEB, 0xEF, 0x9D, 0x03, 0x00, 0x00, 0x00, 0x10, 0xB8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC5, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xC4,
+    0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x10, 0xFD, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF,
+    0xFF, 0x6F, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0x03, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x1E, 0x00,
+    0x70, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x0B, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x50, 0xFF, 0xFF,
+    0xFF, 0x6F, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x09,
+    0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x60, 0xFF, 0xFF, 0xFF,
+    0x5F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0xE5, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE7, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x9F, 0xF8, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0xFF, 0x09, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0xFE, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0x02, 0x00, 0x70, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x00, 0xF1, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x00, 0xF9, 0xFF,
+    0xFF, 0x04, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF,
+    0xFF, 0x02, 0x20, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x50, 0xFF, 0xEF, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0xA0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xE1, 0xFF, 0xBD,
+    0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0xF3, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0xFA, 0xFF, 0xB6, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0x01, 0x00, 0x50, 0xFF, 0xDF, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xE1, 0xFF, 0x5F, 0xC0, 0xFF,
+    0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0xFA, 0xFF, 0x0A, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6,
+    0xFF, 0xFF, 0x06, 0x00, 0x40, 0xFF, 0xEF, 0x01, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xDF, 0x00, 0x00, 0xE0, 0xFF, 0x5F, 0x00, 0xC0, 0xFF, 0xFF,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xF9, 0xFF,
+    0x0B, 0x00, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x0C, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x03, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0xD1, 0xFF, 0xFF, 0x1F, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF,
+    0x9F, 0xF8, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0xFF, 0x09, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0xFB, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0x02, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0x07, 0x00, 0x61, 0xDB, 0xFF, 0xBE, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x00, 0x70, 0xFF, 0xFF, 0x5F, 0x40, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x00, 0xF1, 0xFF, 0xFF,
+    0x0D, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0x02, 0x00, 0xF9, 0xFF, 0xFF, 0x04, 0x10, 0xFE, 0xFF, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x20, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xF3, 0xAF, 0x02, 0x10,
+    0xFE, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0xA0, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x60, 0x05, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02,
+    0xF3, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xEF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x5F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0xEF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x20, 0xC7, 0xFE, 0xDF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x20, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x8E, 0x34, 0xF7, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00,
+    0xF2, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x01, 0x00, 0x70, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF8, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF,
+    0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xEE, 0xFE, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0x1F,
+    0x00, 0x10, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0x7F, 0x00, 0xA0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x0C, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xAF, 0x00, 0xF3, 0xFF, 0xFF, 0x0A, 0x00, 0x10, 0xFE,
+    0xFF, 0xFF, 0x0C, 0x00, 0xAC, 0x02, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x9F, 0x00, 0xFB, 0xFF, 0xFF,
+    0x02, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xFD, 0xCF, 0x47, 0x32, 0xD6, 0xFF, 0xFF, 0x6F,
+    0x40, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xFD, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xD0, 0xFF, 0xFF, 0x1E, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0x0C, 0x00,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xF6, 0xFF, 0xFF, 0x07, 0x00, 0x90, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0C, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0xFE, 0xFF, 0xEF, 0x00,
+    0x00, 0xF4, 0xFF, 0xF9, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x94, 0xEC, 0xFF, 0xCE, 0x5A, 0x00, 0x70,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xFE, 0xFF, 0xF2, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0C, 0x00, 0x90, 0xFF, 0xAF, 0xF0, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x04, 0x00, 0xF3, 0xFF, 0x1F, 0xF0,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
+    0xFD, 0xFF, 0x06, 0xF1, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF,
+    0xFF, 0x2F, 0x00, 0x80, 0xFF, 0xBF, 0x00, 0xF1, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x09, 0x00, 0xF3, 0xFF, 0x2F, 0x00, 0xF1, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0x00, 0xFD, 0xFF, 0x06, 0x00, 0xF1,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x8F, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF,
+    0x0E, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0x06, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xDF, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x11,
+    0x11, 0x11, 0x11, 0xF2, 0xFF, 0xFF, 0x1C, 0x11, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xAF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x30, 0xF9, 0x0E, 0x00, 0xF2, 0xFF, 0xFF, 0xFF,
+    0x6E, 0x02, 0x20, 0x95, 0xFE, 0xFF, 0x6F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x70, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x8D, 0x02, 0x00, 0x00, 0x00, 0x00, 0x72, 0xDA, 0xFE, 0xEF, 0x9C, 0x26, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF,
+    0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFC, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3B, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x06, 0xFE, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x02, 0xF9,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xDF,
+    0x00, 0xF5, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0x8F, 0x00, 0xF0, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0xF2, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x6F, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x5C,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0x10, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x09, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xB0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE,
+    0xFF, 0xEF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xB0, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3B, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x06, 0xFE, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xDF, 0x00, 0xF5, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x8F, 0x00, 0xF0,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x3F,
+    0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0C, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x5C, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x75, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x10, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00,
+    0xC0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF,
+    0x4F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0x9F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x25, 0xFD, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x4E, 0x00, 0xB1, 0xFF, 0xFF, 0xEF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x20, 0xFC, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x3B, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xFF, 0xFF, 0xFF, 0x06, 0xFE, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xDF, 0x00, 0xF5, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x8F, 0x00, 0xF0, 0xFF, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0xB0, 0xFF, 0xFF,
+    0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x60,
+    0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x5C, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0xFF, 0xFF,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF2, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x9F, 0x00,
+    0xF7, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFD, 0x9E, 0x02, 0x00, 0x00, 0x60,
+    0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x8F, 0x00,
+    0x00, 0xC0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x7E, 0x01, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0xFF, 0xEF, 0x03, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0x4F, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC5, 0xEF, 0x5B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3B, 0xFF,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF,
+    0x06, 0xFE, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF,
+    0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xDF, 0x00, 0xF5, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x8F, 0x00, 0xF0, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x10, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0xFF, 0x5C, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0x03, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFD, 0xFF,
+    0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x57, 0x00, 0x00, 0x00, 0x62, 0x47, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0C, 0x00, 0x60, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x7F, 0x00, 0xF0, 0xFF, 0xFF,
+    0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xAF, 0x00, 0xF3,
+    0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x9F,
+    0x00, 0xF2, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0x3F, 0x00, 0xC0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE8, 0xCF, 0x04, 0x00, 0x10, 0xE9, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3B, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x06, 0xFE, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x02, 0xF9,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xDF,
+    0x00, 0xF5, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0x8F, 0x00, 0xF0, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0xF2, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x6F, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x5C,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0x10, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x09, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xB0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x51, 0x88, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xAF, 0x00, 0xF4, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x90,
+    0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x0E,
+    0x00, 0x70, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0xFF, 0x1F, 0x00, 0xA0, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xBF, 0x02, 0xF6, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x3B, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x06, 0xFE, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xDF, 0x00, 0xF5, 0xFF, 0xFF, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x8F, 0x00, 0xF0, 0xFF, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0xB0,
+    0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x0E,
+    0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C,
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x5C, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x60, 0xFF, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xC0, 0xFF,
+    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00,
+    0xF2, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF,
+    0x9F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x78, 0xC7, 0xFF, 0xFF, 0xFF, 0x3E,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xCF, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x5F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x0E, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xA0, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF,
+    0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0xFF, 0x3E, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0x55, 0x55, 0x55, 0xC5, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF,
+    0x4E, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x02, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x70, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xE0, 0xFF, 0xFF,
+    0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0A, 0xF5, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xFC, 0xFF, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xDB, 0xFE, 0xEF, 0x9C, 0x26, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xF2,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8D, 0x56, 0x75, 0xFB, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xFF, 0x02, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x1E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
+    0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x5F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xC7, 0x0C, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x56, 0x65, 0xB8,
+    0xFE, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0C, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xB8, 0xFD, 0xFF, 0xEE, 0xAC, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFD, 0xFF, 0xEF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFB, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x23, 0xD3, 0xFF,
+    0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xFE, 0xEF, 0x9C, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE3, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF,
+    0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xCF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xD1, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xDF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x04, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xDF,
+    0x01, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0xDF, 0x52, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x10, 0xFD, 0xFF,
+    0xFF, 0x1B, 0x00, 0xE4, 0xFF, 0xFF, 0xAF, 0x00, 0xD1, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x10, 0xFB,
+    0xFF, 0xFF, 0x0A, 0xFA, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x50, 0xFE, 0xFF, 0x6F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x03, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x73, 0x37, 0x00, 0x00, 0x00, 0x74, 0x37, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x09,
+    0x00, 0xA0, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x3F, 0x00, 0xF4, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x6F, 0x00, 0xF7, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0x5F, 0x00, 0xF6, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0E, 0x00, 0xE1, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x20, 0xEA, 0xBE, 0x02, 0x00, 0x30, 0xFB, 0xAE, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0xF8, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0x34, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF4, 0xFF, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF,
+    0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xDF,
+    0x02, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x8F, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x2D, 0x00, 0x00,
+    0x00, 0x00, 0xFD, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0xEF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x16, 0xFD, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x4E, 0x00, 0xB1, 0xFF, 0xFF, 0xEF, 0x02, 0x80, 0xFF, 0xFF, 0xBF,
+    0x01, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x2E, 0xF4, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x20, 0xFB,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x61, 0x57, 0x00, 0x00, 0x00, 0x62, 0x47, 0x00, 0x40, 0xFF, 0xFF,
+    0x0C, 0x00, 0x60, 0xFF, 0xFF, 0x0C, 0xD0, 0xFF, 0xFF, 0x7F, 0x00, 0xF0, 0xFF, 0xFF, 0x6F, 0xF0,
+    0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0x9F, 0xF0, 0xFF, 0xFF, 0x9F, 0x00, 0xF1, 0xFF, 0xFF,
+    0x8F, 0x90, 0xFF, 0xFF, 0x3F, 0x00, 0xC0, 0xFF, 0xFF, 0x2F, 0x00, 0xE8, 0xCF, 0x04, 0x00, 0x10,
+    0xE9, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x9B, 0x16, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x4F, 0x33, 0x33,
+    0x65, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x80,
+    0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x08, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x0C,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF,
+    0x0E, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
+    0xFF, 0x0F, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0xFF, 0x1F, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xC0,
+    0xFF, 0xFF, 0xFF, 0x1F, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0xC0, 0xFF, 0xFF, 0xFF, 0x1F, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+    0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x0F, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0x32, 0x93, 0xFF, 0xFF, 0xFF, 0x4F, 0x33, 0x33, 0x02,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x30, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x4F, 0x44, 0x54, 0x96, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x39,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0x7A, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xD8, 0xEF, 0x2A, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0x19,
+    0x00, 0x00, 0xFB, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x17, 0x70, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0x3E, 0x30, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFF, 0x05, 0x00, 0x30, 0xFC, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0x00, 0x00, 0x00, 0x50, 0xFC, 0xCE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF,
+    0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF,
+    0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x1E, 0xFE, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x0F, 0xF6,
+    0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x0F,
+    0xD0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF,
+    0x1F, 0x40, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF,
+    0xFF, 0x1F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02, 0xF8,
+    0xFF, 0xFF, 0x2F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x02,
+    0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF,
+    0x02, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0xA0, 0xFF, 0xFF,
+    0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xA0, 0xFF,
+    0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x90,
+    0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0x90, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF,
+    0x06, 0x80, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x80, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0x8F, 0x70, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x62, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x5B, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF,
+    0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF,
+    0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
+    0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x96, 0xDC,
+    0xFF, 0xFF, 0xBD, 0x59, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x4F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x56, 0x65, 0xE9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+    0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x1E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x10, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
+    0x90, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0xFF, 0x05, 0xC0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x08, 0xE0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0C, 0xF0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0D, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0D,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0xFF, 0x0C, 0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0x0A, 0xB0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x08, 0x80, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x05, 0x50, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x67, 0x76, 0xFA, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x96, 0xEC, 0xFF, 0xFF, 0xBD, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x2E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF,
+    0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF,
+    0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x96, 0xDC, 0xFF, 0xFF, 0xBD, 0x59,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00,
+    0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x56, 0x65, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
+    0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x90, 0xFF, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x05, 0xC0, 0xFF,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x08,
+    0xE0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2,
+    0xFF, 0xFF, 0xFF, 0x0C, 0xF0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0D, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0xF0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0D, 0xF0, 0xFF, 0xFF, 0xFF,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0C, 0xE0, 0xFF,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xB0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x08, 0x80, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0xFF, 0xFF, 0x05, 0x50, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xCF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x67, 0x76, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFC, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x96, 0xEC, 0xFF, 0xFF, 0xBD, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x2E, 0xF5, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xCF, 0x01, 0x30,
+    0xFE, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0x3D, 0x00, 0x00, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x96, 0xDC, 0xFF, 0xFF, 0xBD, 0x59, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x9E, 0x56, 0x65, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF,
+    0xFF, 0xFF, 0x7F, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x90, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x05, 0xC0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x08, 0xE0, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0C,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0xFF, 0x0D, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x0D, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0xF0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0D, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0C, 0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x0A, 0xB0, 0xFF, 0xFF, 0xFF,
+    0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x08, 0x80, 0xFF,
+    0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x05,
+    0x50, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9E, 0x67, 0x76, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xAF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x96, 0xEC, 0xFF, 0xFF,
+    0xBD, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xEA, 0xDF,
+    0x07, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xEF, 0x05, 0x00, 0x20, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x04, 0xC1, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x1B, 0x50, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0x00, 0x00, 0x70, 0xFE, 0xFF, 0xFF,
+    0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x81,
+    0xFD, 0xAE, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x96, 0xDC, 0xFF, 0xFF, 0xBD, 0x59, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E,
+    0x56, 0x65, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x5E, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0xDF, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x02, 0x90, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x05, 0xC0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x08, 0xE0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0C, 0xF0, 0xFF, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0D, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x0D, 0xF0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2,
+    0xFF, 0xFF, 0xFF, 0x0D, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0C, 0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x0A, 0xB0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x08, 0x80, 0xFF, 0xFF, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x05, 0x50, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x7F, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x67, 0x76,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x96, 0xEC, 0xFF, 0xFF, 0xBD, 0x58, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x77, 0x03, 0x00, 0x00, 0x40, 0x67,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x8F, 0x00, 0x00,
+    0xFB, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF,
+    0x02, 0x50, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0x05, 0x80, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0xFF, 0x04, 0x70, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0xFF, 0xDF, 0x00, 0x20, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xEE, 0x1A, 0x00, 0x00, 0xC3, 0xEF, 0x1A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x96, 0xDC,
+    0xFF, 0xFF, 0xBD, 0x59, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x4F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x56, 0x65, 0xE9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+    0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x1E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x10, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
+    0x90, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0xFF, 0x05, 0xC0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x08, 0xE0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0C, 0xF0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0D, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0D,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0xFF, 0x0C, 0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0x0A, 0xB0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x08, 0x80, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x05, 0x50, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x67, 0x76, 0xFA, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x96, 0xEC, 0xFF, 0xFF, 0xBD, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xF4, 0x1D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xBF, 0x00, 0x00, 0x40, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0x0C, 0x00, 0xF3, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xCF, 0x00,
+    0xF7, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xDF, 0x01, 0x80, 0xFF, 0xFF, 0xFF,
+    0x1D, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xDF, 0x01, 0xF9, 0xFF,
+    0xFF, 0xDF, 0x01, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xAD, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xDF, 0x01, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xDF, 0x01, 0xF8, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x70, 0xFF, 0xFF, 0xFF,
+    0x1D, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0xF6, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xDF, 0x01, 0xF3, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xBF, 0x00,
+    0x30, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x0B, 0x00, 0x00, 0xF3, 0x1D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xBF, 0x00, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xAF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x96, 0xDC,
+    0xFF, 0xEF, 0xBD, 0x48, 0x00, 0xD0, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x3F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x56, 0x65, 0xE9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x1E,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x10, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
+    0x90, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x0A, 0xFB, 0xFF, 0xFF,
+    0xFF, 0x05, 0xC0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xEF, 0x01, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x08, 0xE0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x4F,
+    0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0C, 0xF0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0xDF, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0xFC, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0D,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x80, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0xFF, 0x0C, 0xE0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xF3, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0x0A, 0xB0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xFD, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x08, 0x80, 0xFF, 0xFF, 0xFF, 0x8F, 0x90, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x05, 0x50, 0xFF, 0xFF, 0xFF, 0xEF, 0xF4, 0xFF, 0xFF,
+    0x06, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x67, 0x76, 0xFA, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF,
+    0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xFB, 0xFF, 0x1E, 0x10, 0x96, 0xEC, 0xFF, 0xFF, 0xBD, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x8F, 0xFB, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF,
+    0xFF, 0x8F, 0xF9, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF,
+    0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x5F,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0xF0,
+    0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x0D, 0xB0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x20, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x79, 0x65, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xC8, 0xED, 0xFF, 0xDE,
+    0x7A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xEF, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFB, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xF9, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0x5F, 0xF4, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF,
+    0x2F, 0xF0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x0D,
+    0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x20,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x79, 0x65, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x10, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xC8, 0xED,
+    0xFF, 0xDE, 0x7A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xDF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0xEF, 0x52, 0xFF, 0xFF, 0xFF, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0x1C, 0x00, 0xE3, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0xDF, 0x03, 0x00, 0x00, 0x00, 0x50, 0xFE, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFB, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x8F, 0xF9, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0xFF, 0x5F, 0xF4, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
+    0xFF, 0xFF, 0x2F, 0xF0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x0D, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x07, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x79, 0x65, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x10,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51,
+    0xC8, 0xED, 0xFF, 0xDE, 0x7A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x37,
+    0x00, 0x00, 0x00, 0x74, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x08,
+    0x00, 0xB0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x2F, 0x00,
+    0xF5, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF8,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x4F, 0x00, 0xF7, 0xFF,
+    0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0D, 0x00, 0xF2, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xEB, 0xAE, 0x01, 0x00, 0x30, 0xFC, 0xAE, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xFC, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFB, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x8F, 0xF9, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x5F, 0xF4, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0xFF, 0xFF, 0xFF, 0x2F, 0xF0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x0D, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x07, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x79, 0x65, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x51, 0xC8, 0xED, 0xFF, 0xDE, 0x7A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFE, 0xFF, 0xEF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x0E, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x06, 0xA0, 0xFF, 0xFF, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x20, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0x6F, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0xFF, 0xFF, 0xEF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0x06, 0xF3, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0xFF, 0xFF, 0xFF, 0x0E, 0xFB, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xEF, 0xCD, 0x59, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x9F, 0x01, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x23, 0x22, 0x63, 0xFA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF,
+    0xFF, 0x09, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x0E, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x2F, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x0F,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x0C, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0x08, 0xF8, 0xFF, 0xFF, 0xFF, 0x12, 0x21,
+    0x63, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xAF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xAD,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x73, 0xDA, 0xFE, 0xFF, 0xCE, 0x7A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0x00, 0x00, 0x61, 0xFD, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0xE0, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xDF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x02, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0x08,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x0B,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0C,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0B,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xBD, 0x04, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x09,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xFD, 0xFF, 0x7B, 0x56, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x10, 0xA6, 0xEC, 0xFF, 0xEF, 0xAC, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3,
+    0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xFF,
+    0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xB8, 0xED, 0xFF, 0xDE, 0x7A, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x9C, 0x98, 0xFC, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0xF6, 0x8E, 0x03, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x41, 0xA7, 0xCB, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xC2, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x79, 0x66, 0xF5, 0xFF, 0xFF,
+    0xFF, 0x07, 0xF5, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xFA,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x07, 0xFD, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF,
+    0xFF, 0xFF, 0x07, 0xFB, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xCF, 0x78, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF2, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x07, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x2E, 0xFE, 0xFF, 0xFF, 0x07, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02,
+    0xF9, 0xFF, 0xFF, 0x07, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0xF4, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x93, 0xEC, 0xFF, 0xCE, 0x28, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x51, 0xB8, 0xED, 0xFF, 0xDE, 0x7A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x08, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x9C, 0x98, 0xFC, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0xF6, 0x8E, 0x03, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x41, 0xA7, 0xCB, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xB5, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x07, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x79, 0x66, 0xF5, 0xFF, 0xFF, 0xFF, 0x07,
+    0xF5, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xFA, 0xFF, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0x07, 0xFD, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF,
+    0x07, 0xFB, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x78, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x07, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x2E, 0xFE, 0xFF, 0xFF, 0x07, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0xF9, 0xFF,
+    0xFF, 0x07, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0xF4, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x93, 0xEC, 0xFF, 0xCE, 0x28, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xEF, 0x52, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x10, 0xFD,
+    0xFF, 0xFF, 0x1C, 0x00, 0xE3, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x8F, 0x00,
+    0x00, 0x10, 0xFA, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF9, 0xFF, 0xDF, 0x03, 0x00, 0x00, 0x00, 0x50,
+    0xFE, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x51, 0xB8, 0xED, 0xFF, 0xDE, 0x7A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
+    0x00, 0xFD, 0xFF, 0xFF, 0x9C, 0x98, 0xFC, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF6, 0x8E,
+    0x03, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x41, 0xA7, 0xCB, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x07, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x07, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x79, 0x66, 0xF5, 0xFF, 0xFF, 0xFF, 0x07, 0xF5, 0xFF,
+    0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xFA, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xFF, 0x07, 0xFD, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0x07, 0xFB,
+    0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x78, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x07, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xFE,
+    0xFF, 0xFF, 0x07, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0xF9, 0xFF, 0xFF, 0x07,
+    0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x93,
+    0xEC, 0xFF, 0xCE, 0x28, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x80, 0xFD, 0xAE,
+    0x03, 0x00, 0x00, 0x30, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xAF, 0x01, 0x00,
+    0x90, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x01, 0xF6, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x04,
+    0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0xB2, 0xFF,
+    0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0x6C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51,
+    0xB8, 0xED, 0xFF, 0xDE, 0x7A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFD,
+    0xFF, 0xFF, 0x9C, 0x98, 0xFC, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF6, 0x8E, 0x03, 0x00,
+    0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6,
+    0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x41, 0xA7,
+    0xCB, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x07, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xD0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x79, 0x66, 0xF5, 0xFF, 0xFF, 0xFF, 0x07, 0xF5, 0xFF, 0xFF, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xFA, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x07, 0xFE, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x07,
+    0xFD, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0x07, 0xFB, 0xFF, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xFF, 0xCF, 0x78,
+    0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
+    0xFF, 0xFF, 0xFF, 0x07, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xFE, 0xFF, 0xFF,
+    0x07, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0xF9, 0xFF, 0xFF, 0x07, 0x00, 0xA1,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x93, 0xEC, 0xFF,
+    0xCE, 0x28, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x61, 0x57, 0x00, 0x00, 0x00,
+    0x62, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x0D, 0x00, 0x50, 0xFF, 0xFF, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x8F, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
+    0xFF, 0xAF, 0x00, 0xF1, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x4F, 0x00,
+    0xB0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xCF, 0x05, 0x00, 0x10, 0xE9, 0xCF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xB8, 0xED,
+    0xFF, 0xDE, 0x7A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x03, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF,
+    0x9C, 0x98, 0xFC, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF6, 0x8E, 0x03, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x41, 0xA7, 0xCB, 0xED,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x07, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+    0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xD0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xBF, 0x79, 0x66, 0xF5, 0xFF, 0xFF, 0xFF, 0x07, 0xF5, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xFA, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x07, 0xFE, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x07, 0xFD, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0x07, 0xFB, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xFF, 0xCF, 0x78, 0xC8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
+    0xFF, 0x07, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xFE, 0xFF, 0xFF, 0x07, 0x10,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0xF9, 0xFF, 0xFF, 0x07, 0x00, 0xA1, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x93, 0xEC, 0xFF, 0xCE, 0x28,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xFE, 0xAE, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0x7A, 0xFC, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x7F,
+    0x00, 0xB0, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x1F, 0x00, 0x50, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x1F, 0x00, 0x60, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x6F, 0x00, 0xB0, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0x79, 0xFC, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xFE, 0xAE, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51,
+    0xB8, 0xED, 0xFF, 0xDE, 0x7A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFD,
+    0xFF, 0xFF, 0x9C, 0x98, 0xFC, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF6, 0x8E, 0x03, 0x00,
+    0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6,
+    0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x41, 0xA7,
+    0xCB, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x07, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xD0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x79, 0x66, 0xF5, 0xFF, 0xFF, 0xFF, 0x07, 0xF5, 0xFF, 0xFF, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xFA, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x07, 0xFE, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x07,
+    0xFD, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0x07, 0xFB, 0xFF, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xFF, 0xCF, 0x78,
+    0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
+    0xFF, 0xFF, 0xFF, 0x07, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xFE, 0xFF, 0xFF,
+    0x07, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0xF9, 0xFF, 0xFF, 0x07, 0x00, 0xA1,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0xF4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x93, 0xEC, 0xFF,
+    0xCE, 0x28, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x51, 0xB8, 0xED, 0xFF, 0xCE,
+    0x48, 0x00, 0x00, 0x00, 0x50, 0xC9, 0xFE, 0xEF, 0x8C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04,
+    0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0xFC, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x50, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0xFD, 0xFF, 0xEF, 0x9B, 0xA8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x56,
+    0x95, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF6, 0x7C, 0x02, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0x51, 0xA8, 0xDB, 0xEE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x30, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xBF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x78, 0x66, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xF5, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x01, 0xFB, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x00,
+    0x00, 0x00, 0x10, 0x95, 0xFE, 0x02, 0xF7, 0xFF, 0xFF, 0xFF, 0xBF, 0x78, 0xD9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x99, 0xBA, 0xFE, 0xFF, 0xFF, 0x02, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x10,
+    0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xAF, 0x02, 0x00, 0x00, 0x50, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00,
+    0x00, 0x81, 0xEC, 0xFF, 0xDE, 0x7A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x30, 0xB8, 0xFE, 0xFF, 0xDF,
+    0x9C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xDB, 0xFE, 0xEF, 0xAC, 0x26, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0xC1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x20, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x6D, 0x01, 0x31, 0xB6, 0xFF, 0x05, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x61, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x50, 0x4E, 0x00,
+    0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0x02, 0x21, 0x95, 0xFE, 0x4F, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x30, 0xFA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x20, 0xA6, 0xED, 0xFF, 0xEF,
+    0x9B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF9, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x24, 0xB2, 0xFF, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFE, 0xEF, 0xAD, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xAF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xDC, 0xFF, 0xDE, 0x6A, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x20, 0xFE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x8E, 0x55, 0xC7, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF,
+    0x04, 0x90, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x0E, 0xF3, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x2F, 0xF6, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0xFF, 0x4F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x5F, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFB,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFB, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xF9, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00,
+    0x10, 0xB6, 0xDF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x99, 0xBA, 0xFE, 0xFF, 0xDF,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x10,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xC9, 0xFE, 0xFF, 0xDE, 0x8B, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xDC, 0xFF, 0xDE, 0x6A, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x8E, 0x55, 0xC7, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x04, 0x90,
+    0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x0E, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x2F, 0xF6, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0x4F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFB, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x5F, 0xF9, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x61, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x10, 0xB6,
+    0xDF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x99, 0xBA, 0xFE, 0xFF, 0xDF, 0x00, 0x00,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x10, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xC9, 0xFE, 0xFF, 0xDE, 0x8B, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x17, 0xFC, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x5F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xDC, 0xFF, 0xDE, 0x6A, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x8E, 0x55, 0xC7, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0x20, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x04, 0x90, 0xFF, 0xFF,
+    0xFF, 0x1E, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0x0E, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x2F, 0xF6, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF,
+    0x4F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFA, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x5F, 0xF9, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x61, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x10, 0xB6, 0xDF, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x99, 0xBA, 0xFE, 0xFF, 0xDF, 0x00, 0x00, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xC9, 0xFE, 0xFF, 0xDE, 0x8B, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x67, 0x01, 0x00, 0x00, 0x50, 0x67, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF,
+    0x3F, 0x00, 0x20, 0xFE, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xDF, 0x00, 0xA0,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x00, 0xD0, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0x8F, 0x00, 0x60, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5,
+    0xDF, 0x08, 0x00, 0x00, 0xD7, 0xDF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x84, 0xDC, 0xFF, 0xDE, 0x6A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x8E, 0x55, 0xC7, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x20, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x04, 0x90, 0xFF, 0xFF, 0xFF, 0x1E,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0A, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xFF, 0xFF, 0x0E, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0x2F, 0xF6, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x4F, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFA, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x6F, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F,
+    0xF9, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x10, 0xB6, 0xDF, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x99, 0xBA, 0xFE, 0xFF, 0xDF, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x61, 0xC9, 0xFE, 0xFF, 0xDE, 0x8B, 0x04, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF,
+    0x3F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF,
+    0xDF, 0x02, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xEF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xBF, 0x90, 0xFF, 0xFF,
+    0xFF, 0x08, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0xFF, 0x7F, 0x00, 0xF3, 0xFF,
+    0xFF, 0x4E, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0x06, 0xFE, 0xFF, 0xAF, 0x01, 0x00, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x75,
+    0x16, 0x00, 0x00, 0x00, 0x75, 0x16, 0x00, 0xC0, 0xFF, 0xFF, 0x04, 0x00, 0xE1, 0xFF, 0xEF, 0x03,
+    0xF7, 0xFF, 0xFF, 0x0D, 0x00, 0xFA, 0xFF, 0xFF, 0x0C, 0xFA, 0xFF, 0xFF, 0x1F, 0x00, 0xFC, 0xFF,
+    0xFF, 0x0F, 0xF9, 0xFF, 0xFF, 0x0F, 0x00, 0xFB, 0xFF, 0xFF, 0x0E, 0xF3, 0xFF, 0xFF, 0x09, 0x00,
+    0xF6, 0xFF, 0xFF, 0x08, 0x50, 0xFC, 0x8E, 0x00, 0x00, 0x60, 0xFD, 0x7D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x05, 0x00, 0x00, 0x00, 0x10, 0x5A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xDF, 0x05, 0x00, 0x00, 0xF6, 0xEF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xCF, 0x03, 0xC3, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xDF, 0xFC, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x08, 0xC0, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0x2C, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x69, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x40, 0xC8, 0xFE, 0xEF, 0x8C,
+    0x03, 0xFE, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x50, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF8,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x30, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xCF, 0x89, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xB0, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x02, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0x09, 0xF5, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x0A, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x0B, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0xFF, 0x0A, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x09,
+    0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x08, 0xF9, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x02, 0xF4, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xDF, 0x03, 0x00, 0x00, 0xE3, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xCF, 0x89, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00,
+    0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xE8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xDC,
+    0xFF, 0xDE, 0x7B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFD, 0xAE, 0x03, 0x00,
+    0x00, 0x30, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x90,
+    0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x01, 0xF6, 0xFF, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0x04, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x7F,
+    0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x1F, 0x00, 0x00,
+    0x00, 0xB4, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xFD, 0xEF, 0x9D, 0x05, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x0C, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0x1F, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0x6F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x03, 0x10,
+    0xF7, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF,
+    0xFF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x01,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xFF, 0x01, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x10, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xDF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFA, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xDB, 0xFE, 0xDF,
+    0x7B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00,
+    0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x20, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x4B, 0x01, 0x51, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0xFF, 0xEF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x02, 0xF7, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0xFF, 0x06, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x08,
+    0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0A, 0xFB, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0B, 0xFB, 0xFF, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x09, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x08, 0xF6, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0xFF, 0x06, 0xF3, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x02, 0xE0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xEF, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x10, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x4C, 0x01, 0x41, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xEB, 0xFF, 0xDE, 0x7B, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF,
+    0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x73, 0xDB, 0xFE, 0xDF, 0x7B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xCF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1C, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0x01, 0x51, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xEF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x02, 0xF7, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x06, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0xFF, 0x0A, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0B,
+    0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0xFA, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x09, 0xF9, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x08, 0xF6, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x06, 0xF3, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x02, 0xE0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0xFF, 0xFF, 0xEF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF,
+    0x8F, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x01, 0x41, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xCF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xEB, 0xFF, 0xDE, 0x7B, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0xFF, 0x08, 0xFB, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x6F,
+    0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xDF, 0x03, 0x00, 0x00,
+    0xE5, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x10, 0xFA,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x73, 0xDB, 0xFE, 0xDF, 0x7B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x07, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0x01, 0x51, 0xFC, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x8F, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xEF, 0x00, 0xF3, 0xFF,
+    0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x02, 0xF7, 0xFF, 0xFF, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x06, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0A, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0xFF, 0xFF, 0x0B, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
+    0xFF, 0x0A, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x09,
+    0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x08, 0xF6, 0xFF,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x06, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x02, 0xE0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xEF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x01, 0x41, 0xFC, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xEB,
+    0xFF, 0xDE, 0x7B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFC, 0xAE, 0x03, 0x00,
+    0x00, 0x30, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x90,
+    0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x02, 0xF5, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0x05, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x8F,
+    0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0xB4, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xDB, 0xFE, 0xDF, 0x7B, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0x01, 0x51,
+    0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xA0, 0xFF,
+    0xFF, 0xFF, 0x8F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
+    0xEF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x02,
+    0xF7, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x06, 0xF9, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0xFF, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0A, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0B, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0xFF, 0x09, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x08, 0xF6, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x06,
+    0xF3, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x02, 0xE0, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xEF, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C,
+    0x01, 0x41, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D,
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x83, 0xEB, 0xFF, 0xDE, 0x7B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0x57, 0x00, 0x00, 0x00, 0x61, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0x2E,
+    0x00, 0x30, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xAF, 0x00, 0xD0,
+    0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xEF, 0x00, 0xF0, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xCF, 0x00, 0xE0, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x6F, 0x00, 0x90, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD7, 0xDF, 0x06, 0x00, 0x00, 0xD8, 0xDF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xDB, 0xFE, 0xDF,
+    0x7B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00,
+    0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x20, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x4B, 0x01, 0x51, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0xFF, 0xEF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0x02, 0xF7, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF,
+    0xFF, 0x06, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x08,
+    0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0A, 0xFB, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0B, 0xFB, 0xFF, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x09, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x08, 0xF6, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0xFF, 0xFF, 0x06, 0xF3, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x02, 0xE0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xEF, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x10, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x4C, 0x01, 0x41, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xEB, 0xFF, 0xDE, 0x7B, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFE, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x06, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8,
+    0xCF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x25, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x73, 0xDB, 0xFE, 0xDF, 0x7B, 0x02, 0xFD, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0xC1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x06, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0x01, 0x61, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0xF3, 0xFF,
+    0xFF, 0xFF, 0x07, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF7, 0xFF, 0xFF, 0xFF,
+    0x02, 0x00, 0xA0, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x06, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0xFF, 0xFF, 0xEF, 0x00, 0x10, 0xFE, 0xFF,
+    0x7F, 0xF0, 0xFF, 0xFF, 0xFF, 0x09, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0xA0, 0xFF, 0xFF, 0x0C, 0xE0,
+    0xFF, 0xFF, 0xFF, 0x0A, 0xFB, 0xFF, 0xFF, 0xDF, 0x00, 0xF5, 0xFF, 0xFF, 0x02, 0xE0, 0xFF, 0xFF,
+    0xFF, 0x0A, 0xFA, 0xFF, 0xFF, 0xEF, 0x10, 0xFE, 0xFF, 0x7F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x09,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0x0C, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x08, 0xF6, 0xFF,
+    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x02, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x06, 0xF2, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x02, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xEF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x41, 0xFC, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0x4F, 0x73, 0xEB,
+    0xFF, 0xDE, 0x7B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC1, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF,
+    0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
+    0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xF3, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x93, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0xFF, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x60, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
+    0x04, 0x20, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x10, 0xA6, 0xED, 0xFF, 0xAD, 0x05, 0x00, 0x00, 0xFE,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF,
+    0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
+    0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
+    0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x93, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0xFF, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x8F, 0x60, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x20,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x10, 0xA6, 0xED, 0xFF, 0xAD, 0x05, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x17, 0xFC, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x5F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF,
+    0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
+    0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x06, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xA6, 0xFF, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0x60, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x20, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x10, 0xA6, 0xED, 0xFF, 0xAD, 0x05, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x61, 0x57, 0x00, 0x00, 0x00, 0x62, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF,
+    0x0D, 0x00, 0x50, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x8F, 0x00, 0xF0,
+    0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xAF,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xAF, 0x00, 0xF1, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0x4F, 0x00, 0xB0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8,
+    0xCF, 0x05, 0x00, 0x10, 0xE9, 0xCF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xF3, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x90,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xA6, 0xFF, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x60, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x20, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x10, 0xA6, 0xED, 0xFF, 0xAD, 0x05, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF,
+    0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xBF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x03,
+    0xF6, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xF0,
+    0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x30, 0xFF, 0xFF,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0F, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xF0,
+    0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF5, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xFA, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xFF, 0xFF, 0xFF, 0x5F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x0F, 0x50, 0xFF, 0xFF, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x5F, 0xA0, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x9F, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xDF, 0xF3, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x02, 0x10, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xDB, 0xFF, 0xDE, 0x5A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xA5, 0xFD, 0xDF, 0x6B,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x62, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D,
+    0x01, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00,
+    0xC0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x20, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0xFF, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x02,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x04, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x04, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x05, 0xF1, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x04, 0xF1, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xF6,
+    0xFF, 0xFF, 0xFF, 0x04, 0xF1, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x02, 0xF1, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x7E, 0x02, 0x51, 0xFD, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x03, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x04, 0x20, 0xB7, 0xFD, 0xDF, 0x6B, 0x01, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x76, 0x05, 0x00, 0x00, 0x20, 0x76,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xCF, 0x00, 0x00, 0xF6, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0B, 0x20, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0A, 0x10, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x03, 0x00, 0xFB, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xFE, 0x4C, 0x00, 0x00, 0x91, 0xFE, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x03, 0xF6, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF5,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xFA, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0xFF, 0x0F, 0x50, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0xFF, 0x5F, 0xA0, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0x9F, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
+    0xDF, 0xF3, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF,
+    0xF6, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFB,
+    0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x10, 0xC5, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xDB, 0xFF, 0xDE, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+const GFXglyph OpenSans24BGlyphs[] = {
+    { 0, 0, 13, 0, 0, 0, 0 }, //  
+    { 10, 37, 14, 2, 36, 185, 0 }, // !
+    { 18, 13, 24, 3, 36, 117, 185 }, // "
+    { 31, 36, 32, 1, 36, 576, 302 }, // #
+    { 25, 41, 29, 2, 38, 533, 878 }, // $
+    { 43, 36, 45, 1, 36, 792, 1411 }, // %
+    { 36, 36, 38, 2, 36, 648, 2203 }, // &
+    { 8, 13, 13, 3, 36, 52, 2851 }, // '
+    { 14, 44, 17, 2, 36, 308, 2903 }, // (
+    { 14, 44, 17, 1, 36, 308, 3211 }, // )
+    { 25, 24, 27, 1, 38, 312, 3519 }, // *
+    { 25, 25, 29, 2, 30, 325, 3831 }, // +
+    { 11, 12, 15, 1, 6, 72, 4156 }, // ,
+    { 14, 7, 16, 1, 16, 49, 4228 }, // -
+    { 10, 9, 14, 2, 8, 45, 4277 }, // .
+    { 21, 36, 21, 0, 36, 396, 4322 }, // /
+    { 26, 36, 29, 1, 36, 468, 4718 }, // 0
+    { 19, 36, 29, 2, 36, 360, 5186 }, // 1
+    { 26, 36, 29, 1, 36, 468, 5546 }, // 2
+    { 26, 36, 29, 1, 36, 468, 6014 }, // 3
+    { 28, 36, 29, 0, 36, 504, 6482 }, // 4
+    { 25, 36, 29, 2, 36, 468, 6986 }, // 5
+    { 26, 36, 29, 1, 36, 468, 7454 }, // 6
+    { 26, 36, 29, 1, 36, 468, 7922 }, // 7
+    { 26, 36, 29, 1, 36, 468, 8390 }, // 8
+    { 26, 36, 29, 1, 36, 468, 8858 }, // 9
+    { 10, 29, 14, 2, 28, 145, 9326 }, // :
+    { 11, 34, 15, 1, 28, 204, 9471 }, // ;
+    { 25, 28, 29, 2, 32, 364, 9675 }, // <
+    { 25, 15, 29, 2, 25, 195, 10039 }, // =
+    { 25, 28, 29, 2, 32, 364, 10234 }, // >
+    { 23, 37, 24, 0, 36, 444, 10598 }, // ?
+    { 41, 40, 45, 2, 36, 840, 11042 }, // @
+    { 35, 36, 35, 0, 36, 648, 11882 }, // A
+    { 27, 36, 34, 4, 36, 504, 12530 }, // B
+    { 29, 36, 32, 2, 36, 540, 13034 }, // C
+    { 31, 36, 37, 4, 36, 576, 13574 }, // D
+    { 22, 36, 28, 4, 36, 396, 14150 }, // E
+    { 21, 36, 27, 4, 36, 396, 14546 }, // F
+    { 31, 36, 36, 2, 36, 576, 14942 }, // G
+    { 30, 36, 38, 4, 36, 540, 15518 }, // H
+    { 9, 36, 17, 4, 36, 180, 16058 }, // I
+    { 17, 46, 17, -4, 36, 414, 16238 }, // J
+    { 30, 36, 33, 4, 36, 540, 16652 }, // K
+    { 23, 36, 28, 4, 36, 432, 17192 }, // L
+    { 39, 36, 47, 4, 36, 720, 17624 }, // M
+    { 33, 36, 41, 4, 36, 612, 18344 }, // N
+    { 35, 36, 40, 2, 36, 648, 18956 }, // O
+    { 26, 36, 31, 4, 36, 468, 19604 }, // P
+    { 35, 44, 40, 2, 36, 792, 20072 }, // Q
+    { 30, 36, 33, 4, 36, 540, 20864 }, // R
+    { 24, 36, 28, 2, 36, 432, 21404 }, // S
+    { 27, 36, 29, 1, 36, 504, 21836 }, // T
+    { 30, 36, 38, 4, 36, 540, 22340 }, // U
+    { 33, 36, 33, 0, 36, 612, 22880 }, // V
+    { 49, 36, 48, 0, 36, 900, 23492 }, // W
+    { 34, 36, 33, 0, 36, 612, 24392 }, // X
+    { 32, 36, 31, 0, 36, 576, 25004 }, // Y
+    { 27, 36, 29, 1, 36, 504, 25580 }, // Z
+    { 13, 44, 17, 3, 36, 308, 26084 }, // [
+    { 21, 36, 21, 0, 36, 396, 26392 }, // '\\'
+    { 13, 44, 17, 1, 36, 308, 26788 }, // ]
+    { 27, 23, 27, 0, 36, 322, 27096 }, // ^
+    { 22, 4, 21, -1, -4, 44, 27418 }, // _
+    { 15, 8, 30, 8, 38, 64, 27462 }, // `
+    { 25, 28, 30, 2, 28, 364, 27526 }, // a
+    { 27, 38, 32, 3, 38, 532, 27890 }, // b
+    { 23, 28, 26, 2, 28, 336, 28422 }, // c
+    { 26, 38, 32, 2, 38, 494, 28758 }, // d
+    { 26, 28, 30, 2, 28, 364, 29252 }, // e
+    { 21, 38, 19, 1, 38, 418, 29616 }, // f
+    { 28, 40, 28, 0, 28, 560, 30034 }, // g
+    { 27, 38, 33, 3, 38, 532, 30594 }, // h
+    { 9, 38, 15, 3, 38, 190, 31126 }, // i
+    { 16, 50, 15, -4, 38, 400, 31316 }, // j
+    { 28, 38, 31, 3, 38, 532, 31716 }, // k
+    { 9, 38, 15, 3, 38, 190, 32248 }, // l
+    { 43, 28, 49, 3, 28, 616, 32438 }, // m
+    { 27, 28, 33, 3, 28, 392, 33054 }, // n
+    { 27, 28, 31, 2, 28, 392, 33446 }, // o
+    { 27, 40, 32, 3, 28, 560, 33838 }, // p
+    { 26, 40, 32, 2, 28, 520, 34398 }, // q
+    { 19, 28, 23, 3, 28, 280, 34918 }, // r
+    { 21, 28, 25, 2, 28, 308, 35198 }, // s
+    { 20, 33, 22, 1, 33, 330, 35506 }, // t
+    { 26, 27, 33, 3, 27, 351, 35836 }, // u
+    { 29, 27, 28, 0, 27, 405, 36187 }, // v
+    { 43, 27, 43, 0, 27, 594, 36592 }, // w
+    { 29, 27, 29, 0, 27, 405, 37186 }, // x
+    { 29, 39, 28, 0, 27, 585, 37591 }, // y
+    { 22, 27, 24, 1, 27, 297, 38176 }, // z
+    { 18, 44, 20, 0, 36, 396, 38473 }, // {
+    { 6, 49, 28, 11, 38, 147, 38869 }, // |
+    { 17, 44, 20, 2, 36, 396, 39016 }, // }
+    { 25, 11, 29, 2, 23, 143, 39412 }, // ~
+    { 0, 0, 13, 0, 0, 0, 39555 }, //  
+    { 10, 36, 14, 2, 27, 180, 39555 }, // ¡
+    { 23, 36, 29, 3, 36, 432, 39735 }, // ¢
+    { 26, 36, 29, 2, 36, 468, 40167 }, // £
+    { 24, 23, 29, 2, 29, 276, 40635 }, // ¤
+    { 29, 36, 29, 0, 36, 540, 40911 }, // ¥
+    { 6, 49, 28, 11, 38, 147, 41451 }, // ¦
+    { 20, 38, 24, 2, 38, 380, 41598 }, // §
+    { 18, 7, 30, 6, 38, 63, 41978 }, // ¨
+    { 38, 36, 42, 2, 36, 684, 42041 }, // ©
+    { 16, 18, 19, 1, 36, 144, 42725 }, // ª
+    { 27, 23, 31, 2, 25, 322, 42869 }, // «
+    { 25, 14, 29, 2, 20, 182, 43191 }, // ¬
+    { 14, 7, 16, 1, 16, 49, 43373 }, // ­
+    { 38, 36, 42, 2, 36, 684, 43422 }, // ®
+    { 27, 5, 25, -1, 43, 70, 44106 }, // ¯
+    { 18, 17, 21, 2, 36, 153, 44176 }, // °
+    { 25, 32, 29, 2, 32, 416, 44329 }, // ±
+    { 17, 22, 19, 1, 36, 198, 44745 }, // ²
+    { 16, 22, 19, 1, 36, 176, 44943 }, // ³
+    { 15, 8, 30, 8, 38, 64, 45119 }, // ´
+    { 27, 39, 33, 3, 27, 546, 45183 }, // µ
+    { 27, 44, 33, 2, 38, 616, 45729 }, // ¶
+    { 10, 9, 14, 2, 22, 45, 46345 }, // ·
+    { 12, 12, 10, -1, 0, 72, 46390 }, // ¸
+    { 13, 22, 19, 2, 36, 154, 46462 }, // ¹
+    { 17, 18, 19, 1, 36, 162, 46616 }, // º
+    { 27, 23, 31, 2, 25, 322, 46778 }, // »
+    { 41, 36, 44, 1, 36, 756, 47100 }, // ¼
+    { 41, 36, 44, 1, 36, 756, 47856 }, // ½
+    { 40, 36, 44, 2, 36, 720, 48612 }, // ¾
+    { 23, 37, 24, 1, 27, 444, 49332 }, // ¿
+    { 35, 46, 35, 0, 46, 828, 49776 }, // À
+    { 35, 46, 35, 0, 46, 828, 50604 }, // Á
+    { 35, 46, 35, 0, 46, 828, 51432 }, // Â
+    { 35, 46, 35, 0, 46, 828, 52260 }, // Ã
+    { 35, 46, 35, 0, 46, 828, 53088 }, // Ä
+    { 35, 45, 35, 0, 45, 810, 53916 }, // Å
+    { 45, 36, 48, 0, 36, 828, 54726 }, // Æ
+    { 29, 48, 32, 2, 36, 720, 55554 }, // Ç
+    { 22, 46, 28, 4, 46, 506, 56274 }, // È
+    { 22, 46, 28, 4, 46, 506, 56780 }, // É
+    { 22, 46, 28, 4, 46, 506, 57286 }, // Ê
+    { 22, 46, 28, 4, 46, 506, 57792 }, // Ë
+    { 15, 46, 17, -2, 46, 368, 58298 }, // Ì
+    { 15, 46, 17, 4, 46, 368, 58666 }, // Í
+    { 22, 46, 17, -3, 46, 506, 59034 }, // Î
+    { 18, 46, 17, -1, 46, 414, 59540 }, // Ï
+    { 34, 36, 37, 1, 36, 612, 59954 }, // Ð
+    { 33, 46, 41, 4, 46, 782, 60566 }, // Ñ
+    { 35, 46, 40, 2, 46, 828, 61348 }, // Ò
+    { 35, 46, 40, 2, 46, 828, 62176 }, // Ó
+    { 35, 46, 40, 2, 46, 828, 63004 }, // Ô
+    { 35, 46, 40, 2, 46, 828, 63832 }, // Õ
+    { 35, 46, 40, 2, 46, 828, 64660 }, // Ö
+    { 23, 23, 29, 3, 29, 276, 65488 }, // ×
+    { 35, 40, 40, 2, 38, 720, 65764 }, // Ø
+    { 30, 46, 38, 4, 46, 690, 66484 }, // Ù
+    { 30, 46, 38, 4, 46, 690, 67174 }, // Ú
+    { 30, 46, 38, 4, 46, 690, 67864 }, // Û
+    { 30, 46, 38, 4, 46, 690, 68554 }, // Ü
+    { 32, 46, 31, 0, 46, 736, 69244 }, // Ý
+    { 26, 36, 31, 4, 36, 468, 69980 }, // Þ
+    { 31, 38, 36, 3, 38, 608, 70448 }, // ß
+    { 25, 38, 30, 2, 38, 494, 71056 }, // à
+    { 25, 38, 30, 2, 38, 494, 71550 }, // á
+    { 25, 38, 30, 2, 38, 494, 72044 }, // â
+    { 25, 38, 30, 2, 38, 494, 72538 }, // ã
+    { 25, 38, 30, 2, 38, 494, 73032 }, // ä
+    { 25, 42, 30, 2, 42, 546, 73526 }, // å
+    { 42, 28, 46, 2, 28, 588, 74072 }, // æ
+    { 23, 40, 26, 2, 28, 480, 74660 }, // ç
+    { 26, 38, 30, 2, 38, 494, 75140 }, // è
+    { 26, 38, 30, 2, 38, 494, 75634 }, // é
+    { 26, 38, 30, 2, 38, 494, 76128 }, // ê
+    { 26, 38, 30, 2, 38, 494, 76622 }, // ë
+    { 15, 38, 15, -3, 38, 304, 77116 }, // ì
+    { 15, 38, 15, 3, 38, 304, 77420 }, // í
+    { 22, 38, 15, -3, 38, 418, 77724 }, // î
+    { 18, 38, 15, -1, 38, 342, 78142 }, // ï
+    { 27, 38, 31, 2, 38, 532, 78484 }, // ð
+    { 27, 38, 33, 3, 38, 532, 79016 }, // ñ
+    { 27, 38, 31, 2, 38, 532, 79548 }, // ò
+    { 27, 38, 31, 2, 38, 532, 80080 }, // ó
+    { 27, 38, 31, 2, 38, 532, 80612 }, // ô
+    { 27, 38, 31, 2, 38, 532, 81144 }, // õ
+    { 27, 38, 31, 2, 38, 532, 81676 }, // ö
+    { 25, 26, 29, 2, 30, 338, 82208 }, // ÷
+    { 27, 31, 31, 2, 29, 434, 82546 }, // ø
+    { 26, 38, 33, 3, 38, 494, 82980 }, // ù
+    { 26, 38, 33, 3, 38, 494, 83474 }, // ú
+    { 26, 38, 33, 3, 38, 494, 83968 }, // û
+    { 26, 38, 33, 3, 38, 494, 84462 }, // ü
+    { 29, 50, 28, 0, 38, 750, 84956 }, // ý
+    { 27, 50, 32, 3, 38, 700, 85706 }, // þ
+    { 29, 50, 28, 0, 38, 750, 86406 }, // ÿ
+};
+const UnicodeInterval OpenSans24BIntervals[] = {
+    { 0x20, 0x7E, 0x0 },
+    { 0xA0, 0xFF, 0x5F },
+};
+const GFXfont OpenSans24B = {
+    (uint8_t*)OpenSans24BBitmaps,
+    (GFXglyph*)OpenSans24BGlyphs,
+    (UnicodeInterval*)OpenSans24BIntervals,
+    2,
+    0,
+    68,
+    54,
+    -15,
+};
@@ -0,0 +1,2661 @@
+#pragma once
+// Generated by tools/fontencode.py rle from opensans24b.h, do not edit
+#include "epd_driver.h"
+const uint8_t OpenSans24BBitmaps[39174] = {
+    0x52, 0x4C, 0x45, 0x34, 0x00, 0x47, 0x86, 0x00, 0x47, 0x85, 0x00, 0x8E, 0x46, 0x84, 0x00, 0x8D,
+    0x46, 0x83, 0x00, 0x8D, 0x46, 0x82, 0x00, 0x8C, 0x46, 0x81, 0x00, 0x8B, 0x46, 0x81, 0x00, 0x8A,
+    0x46, 0x01, 0x89, 0x46, 0x01, 0x89, 0x45, 0x8E, 0x01, 0x88, 0x45, 0x8D, 0x01, 0x87, 0x45, 0x8D,
+    0x01, 0x86, 0x45, 0x8C, 0x01, 0x85, 0x45, 0x8B, 0x01, 0x84, 0x45, 0x8A, 0x01, 0x84, 0x45, 0x89,
+    0x01, 0x83, 0x45, 0x89, 0x01, 0x82, 0x45, 0x88, 0x01, 0x81, 0x45, 0x87, 0x02, 0x45, 0x86, 0x02,
+    0x45, 0x85, 0x02, 0x45, 0x84, 0x02, 0x8E, 0x44, 0x84, 0x02, 0x8D, 0x44, 0x83, 0x02, 0x86, 0xC8,
+    0x81, 0x21, 0x81, 0x83, 0x84, 0x82, 0x04, 0x8A, 0x43, 0x8C, 0x81, 0x01, 0x89, 0x45, 0x8D, 0x01,
+    0x47, 0x83, 0x81, 0x47, 0x86, 0x81, 0x47, 0x85, 0x00, 0x8D, 0x46, 0x82, 0x00, 0x85, 0x45, 0x89,
+    0x02, 0x84, 0x8C, 0x41, 0x8D, 0x87, 0x01, 0x8B, 0x45, 0x02, 0x86, 0x45, 0x85, 0x8A, 0x45, 0x02,
+    0x85, 0x45, 0x83, 0x88, 0x44, 0x8D, 0x02, 0x84, 0x45, 0x82, 0x87, 0x44, 0x8C, 0x02, 0x82, 0x45,
+    0x81, 0x86, 0x44, 0x8B, 0x02, 0x81, 0x45, 0x00, 0x85, 0x44, 0x8A, 0x03, 0x44, 0x8E, 0x00, 0x84,
+    0x44, 0x88, 0x03, 0x44, 0x8D, 0x00, 0x82, 0x44, 0x87, 0x03, 0x8E, 0x43, 0x8C, 0x00, 0x81, 0x44,
+    0x86, 0x03, 0x8C, 0x43, 0x8B, 0x01, 0x44, 0x85, 0x03, 0x8B, 0x43, 0x8A, 0x01, 0x44, 0x84, 0x03,
+    0x8A, 0x43, 0x88, 0x01, 0x8D, 0x43, 0x82, 0x03, 0x89, 0x43, 0x87, 0x01, 0x8C, 0x43, 0x81, 0x03,
+    0x87, 0x43, 0x86, 0x00, 0x09, 0x84, 0x44, 0x03, 0x81, 0x44, 0x82, 0x0D, 0x87, 0x43, 0x8D, 0x03,
+    0x84, 0x44, 0x0E, 0x8A, 0x43, 0x8A, 0x03, 0x87, 0x43, 0x8C, 0x0E, 0x8D, 0x43, 0x87, 0x03, 0x8A,
+    0x43, 0x89, 0x0E, 0x44, 0x84, 0x03, 0x8D, 0x43, 0x86, 0x0D, 0x83, 0x44, 0x81, 0x03, 0x44, 0x83,
+    0x0D, 0x86, 0x43, 0x8E, 0x03, 0x83, 0x44, 0x0E, 0x89, 0x43, 0x8B, 0x03, 0x86, 0x43, 0x8D, 0x0E,
+    0x8D, 0x43, 0x88, 0x03, 0x89, 0x43, 0x8A, 0x0E, 0x44, 0x85, 0x03, 0x8D, 0x43, 0x87, 0x06, 0x82,
+    0x5B, 0x83, 0x00, 0x82, 0x5B, 0x83, 0x00, 0x82, 0x5B, 0x83, 0x00, 0x82, 0x5B, 0x83, 0x00, 0x82,
+    0x5B, 0x83, 0x01, 0xC1, 0x82, 0x44, 0x84, 0xB1, 0x44, 0x85, 0xD1, 0x07, 0x84, 0x44, 0x03, 0x82,
+    0x44, 0x81, 0x0D, 0x87, 0x43, 0x8D, 0x03, 0x86, 0x43, 0x8E, 0x0E, 0x8A, 0x43, 0x8A, 0x03, 0x89,
+    0x43, 0x8B, 0x0E, 0x8D, 0x43, 0x87, 0x03, 0x8C, 0x43, 0x88, 0x0E, 0x44, 0x84, 0x03, 0x44, 0x85,
+    0x07, 0x8E, 0x5A, 0x88, 0x01, 0x8E, 0x5A, 0x88, 0x01, 0x8E, 0x5A, 0x88, 0x01, 0x8E, 0x5A, 0x88,
+    0x01, 0x8E, 0x5A, 0x88, 0x06, 0x83, 0x44, 0x82, 0x02, 0x82, 0x44, 0x83, 0x0D, 0x85, 0x43, 0x8E,
+    0x03, 0x85, 0x44, 0x0E, 0x88, 0x43, 0x8B, 0x03, 0x88, 0x43, 0x8D, 0x0E, 0x8B, 0x43, 0x88, 0x03,
+    0x8B, 0x43, 0x8A, 0x0E, 0x8E, 0x43, 0x86, 0x03, 0x8E, 0x43, 0x87, 0x0D, 0x81, 0x44, 0x83, 0x02,
+    0x81, 0x44, 0x84, 0x0D, 0x84, 0x44, 0x03, 0x84, 0x44, 0x81, 0x0D, 0x87, 0x43, 0x8D, 0x03, 0x87,
+    0x43, 0x8E, 0x0E, 0x89, 0x43, 0x8A, 0x03, 0x8A, 0x43, 0x8B, 0x0E, 0x8C, 0x43, 0x87, 0x03, 0x8D,
+    0x43, 0x88, 0x0A, 0x09, 0x85, 0x42, 0x14, 0x85, 0x42, 0x14, 0x85, 0x42, 0x14, 0x85, 0x42, 0x11,
+    0x85, 0x89, 0x8B, 0x8E, 0x43, 0x8D, 0x8C, 0x8A, 0x87, 0x84, 0x08, 0x82, 0x8A, 0x4E, 0x8B, 0x85,
+    0x04, 0x88, 0x52, 0x8E, 0x02, 0x8B, 0x53, 0x89, 0x01, 0x88, 0x54, 0x82, 0x00, 0x82, 0x54, 0x8C,
+    0x01, 0x88, 0x46, 0x8D, 0x87, 0x88, 0x42, 0x82, 0x84, 0x86, 0x89, 0x8D, 0x42, 0x85, 0x01, 0x8B,
+    0x45, 0x8D, 0x01, 0x85, 0x42, 0x04, 0x82, 0x87, 0x8C, 0x02, 0x8D, 0x45, 0x88, 0x01, 0x85, 0x42,
+    0x0A, 0x8C, 0x45, 0x8B, 0x01, 0x85, 0x42, 0x0A, 0x8A, 0x46, 0x86, 0x00, 0x85, 0x42, 0x0A, 0x85,
+    0x47, 0x8C, 0x89, 0x42, 0x0B, 0x8E, 0x4B, 0x0B, 0x84, 0x4B, 0x8A, 0x83, 0x0A, 0x86, 0x4C, 0x8D,
+    0x86, 0x09, 0x84, 0x8E, 0x4C, 0x8E, 0x86, 0x08, 0x81, 0x89, 0x4D, 0x8D, 0x83, 0x08, 0x81, 0x88,
+    0x8E, 0x4C, 0x85, 0x0A, 0x86, 0x8C, 0x4B, 0x83, 0x0A, 0x85, 0x4B, 0x8D, 0x0A, 0x85, 0x42, 0x85,
+    0x8D, 0x47, 0x83, 0x09, 0x85, 0x42, 0x01, 0x8A, 0x46, 0x87, 0x09, 0x85, 0x42, 0x02, 0x8D, 0x45,
+    0x89, 0x84, 0x08, 0x85, 0x42, 0x02, 0x8C, 0x45, 0x89, 0x8C, 0x8E, 0x88, 0x83, 0x05, 0x85, 0x42,
+    0x01, 0x81, 0x46, 0x87, 0x8C, 0x42, 0x8E, 0x8A, 0x86, 0x82, 0x01, 0x85, 0x42, 0x00, 0x85, 0x8D,
+    0x46, 0x83, 0x8C, 0x47, 0x9D, 0x4B, 0x8D, 0x00, 0x8C, 0x55, 0x84, 0x00, 0x8C, 0x54, 0x87, 0x01,
+    0x8C, 0x52, 0x8E, 0x85, 0x03, 0x86, 0x8C, 0x4E, 0x8E, 0x88, 0x81, 0x07, 0x84, 0x87, 0x8A, 0x8C,
+    0x8D, 0x8E, 0x43, 0x8D, 0x8B, 0x88, 0x84, 0x10, 0x85, 0x42, 0x14, 0x85, 0x42, 0x14, 0x85, 0x42,
+    0x14, 0x85, 0x42, 0x14, 0x85, 0x42, 0x0A, 0x04, 0x85, 0x8A, 0x8D, 0x41, 0x8D, 0x8A, 0x84, 0x0E,
+    0x8D, 0x44, 0x81, 0x0A, 0x83, 0x8D, 0x47, 0x8B, 0x81, 0x0B, 0x86, 0x44, 0x87, 0x0A, 0x82, 0x8E,
+    0x49, 0x8D, 0x81, 0x0A, 0x8E, 0x43, 0x8E, 0x0B, 0x8C, 0x4B, 0x8A, 0x09, 0x87, 0x44, 0x85, 0x0A,
+    0x85, 0x4D, 0x84, 0x07, 0x81, 0x44, 0x8D, 0x0B, 0x8B, 0x44, 0x8D, 0x93, 0x8D, 0x44, 0x8A, 0x07,
+    0x89, 0x44, 0x84, 0x0B, 0x45, 0x84, 0x01, 0x84, 0x45, 0x06, 0x82, 0x44, 0x8B, 0x0B, 0x82, 0x45,
+    0x03, 0x45, 0x82, 0x05, 0x8B, 0x44, 0x82, 0x0B, 0x85, 0x44, 0x8D, 0x03, 0x8C, 0x44, 0x85, 0x04,
+    0x83, 0x44, 0x89, 0x0C, 0x86, 0x44, 0x8B, 0x03, 0x8B, 0x44, 0x86, 0x04, 0x8C, 0x44, 0x81, 0x0C,
+    0x87, 0x44, 0x8B, 0x03, 0x8A, 0x44, 0x87, 0x03, 0x85, 0x44, 0x88, 0x0D, 0x87, 0x44, 0x8B, 0x03,
+    0x8A, 0x44, 0x87, 0x03, 0x8D, 0x43, 0x8E, 0x0E, 0x86, 0x44, 0x8B, 0x03, 0x8B, 0x44, 0x86, 0x02,
+    0x87, 0x44, 0x86, 0x0E, 0x85, 0x44, 0x8D, 0x03, 0x8C, 0x44, 0x85, 0x02, 0x8E, 0x43, 0x8D, 0x0F,
+    0x82, 0x45, 0x03, 0x45, 0x83, 0x01, 0x88, 0x44, 0x85, 0x02, 0x85, 0x8A, 0x8D, 0x41, 0x8D, 0x8A,
+    0x84, 0x05, 0x45, 0x84, 0x01, 0x84, 0x45, 0x01, 0x81, 0x44, 0x8C, 0x01, 0x83, 0x8D, 0x47, 0x8B,
+    0x81, 0x03, 0x8A, 0x44, 0x8D, 0x92, 0x8D, 0x44, 0x8B, 0x01, 0x8A, 0x44, 0x83, 0x00, 0x82, 0x8E,
+    0x49, 0x8D, 0x81, 0x02, 0x83, 0x4D, 0x85, 0x00, 0x83, 0x44, 0x8A, 0x01, 0x8C, 0x4B, 0x8A, 0x03,
+    0x8A, 0x4B, 0x8C, 0x01, 0x8B, 0x44, 0x82, 0x00, 0x85, 0x4D, 0x84, 0x02, 0x81, 0x8D, 0x49, 0x8E,
+    0x82, 0x00, 0x84, 0x44, 0x89, 0x01, 0x8B, 0x44, 0x8D, 0x93, 0x8D, 0x44, 0x8A, 0x03, 0x81, 0x8B,
+    0x47, 0x8C, 0x82, 0x01, 0x8D, 0x44, 0x81, 0x01, 0x45, 0x84, 0x01, 0x84, 0x45, 0x05, 0x84, 0x8A,
+    0x8D, 0x41, 0x8D, 0x8A, 0x85, 0x02, 0x86, 0x44, 0x87, 0x01, 0x82, 0x45, 0x03, 0x45, 0x82, 0x0F,
+    0x8E, 0x43, 0x8E, 0x02, 0x85, 0x44, 0x8D, 0x03, 0x8C, 0x44, 0x85, 0x0E, 0x87, 0x44, 0x85, 0x02,
+    0x86, 0x44, 0x8B, 0x03, 0x8B, 0x44, 0x86, 0x0D, 0x81, 0x44, 0x8D, 0x03, 0x87, 0x44, 0x8B, 0x03,
+    0x8A, 0x44, 0x87, 0x0D, 0x89, 0x44, 0x84, 0x03, 0x87, 0x44, 0x8B, 0x03, 0x8A, 0x44, 0x87, 0x0C,
+    0x82, 0x44, 0x8B, 0x04, 0x86, 0x44, 0x8B, 0x03, 0x8B, 0x44, 0x86, 0x0C, 0x8B, 0x44, 0x82, 0x04,
+    0x85, 0x44, 0x8D, 0x03, 0x8C, 0x44, 0x85, 0x0B, 0x83, 0x44, 0x89, 0x05, 0x82, 0x45, 0x03, 0x45,
+    0x83, 0x0B, 0x8C, 0x44, 0x81, 0x06, 0x45, 0x84, 0x01, 0x84, 0x45, 0x0B, 0x85, 0x44, 0x88, 0x07,
+    0x8A, 0x44, 0x8D, 0x92, 0x8D, 0x44, 0x8B, 0x0B, 0x8D, 0x43, 0x8E, 0x08, 0x83, 0x4D, 0x85, 0x0A,
+    0x86, 0x44, 0x86, 0x09, 0x8A, 0x4B, 0x8C, 0x0B, 0x8E, 0x43, 0x8D, 0x0A, 0x81, 0x8D, 0x49, 0x8E,
+    0x82, 0x0A, 0x88, 0x44, 0x85, 0x0B, 0x81, 0x8B, 0x47, 0x8C, 0x82, 0x0A, 0x81, 0x44, 0x8C, 0x0E,
+    0x84, 0x8A, 0x8D, 0x41, 0x8D, 0x8A, 0x85, 0x04, 0x07, 0x82, 0x87, 0x8B, 0x8D, 0x8E, 0x41, 0x8D,
+    0x8B, 0x87, 0x82, 0x16, 0x82, 0x8B, 0x4A, 0x8A, 0x81, 0x13, 0x85, 0x4E, 0x83, 0x11, 0x85, 0x50,
+    0x82, 0x0F, 0x81, 0x8E, 0x50, 0x8B, 0x0F, 0x87, 0x47, 0x8E, 0x8C, 0x8E, 0x47, 0x81, 0x0E, 0x8C,
+    0x45, 0x8D, 0x83, 0x02, 0x86, 0x46, 0x85, 0x0E, 0x8E, 0x45, 0x83, 0x04, 0x8A, 0x45, 0x87, 0x0E,
+    0x8E, 0x45, 0x05, 0x86, 0x45, 0x86, 0x0E, 0x8D, 0x45, 0x05, 0x88, 0x45, 0x84, 0x0E, 0x8B, 0x45,
+    0x85, 0x03, 0x81, 0x8E, 0x45, 0x81, 0x0E, 0x86, 0x45, 0x8C, 0x02, 0x81, 0x8C, 0x45, 0x8A, 0x0F,
+    0x81, 0x46, 0x87, 0x00, 0x84, 0x8E, 0x46, 0x82, 0x10, 0x88, 0x46, 0x8C, 0x47, 0x86, 0x12, 0x8D,
+    0x4D, 0x88, 0x13, 0x83, 0x4C, 0x86, 0x15, 0x8C, 0x49, 0x8D, 0x83, 0x14, 0x84, 0x8E, 0x49, 0x8B,
+    0x08, 0x8D, 0x45, 0x8E, 0x04, 0x88, 0x4C, 0x85, 0x06, 0x83, 0x46, 0x89, 0x03, 0x89, 0x4E, 0x86,
+    0x05, 0x88, 0x46, 0x84, 0x02, 0x86, 0x50, 0x88, 0x04, 0x8E, 0x45, 0x8E, 0x03, 0x8E, 0x46, 0x8E,
+    0x83, 0x86, 0x47, 0x89, 0x02, 0x86, 0x46, 0x87, 0x02, 0x86, 0x46, 0x8E, 0x82, 0x01, 0x85, 0x47,
+    0x8A, 0x01, 0x8D, 0x46, 0x81, 0x02, 0x8B, 0x46, 0x85, 0x03, 0x84, 0x47, 0x8B, 0x87, 0x46, 0x89,
+    0x03, 0x8E, 0x46, 0x05, 0x83, 0x8E, 0x4E, 0x81, 0x03, 0x46, 0x8D, 0x06, 0x82, 0x8E, 0x4C, 0x87,
+    0x04, 0x47, 0x07, 0x82, 0x8D, 0x4A, 0x8D, 0x05, 0x8D, 0x46, 0x86, 0x07, 0x81, 0x8D, 0x49, 0x83,
+    0x05, 0x8B, 0x47, 0x86, 0x07, 0x87, 0x48, 0x87, 0x06, 0x86, 0x48, 0x8D, 0x87, 0xA4, 0x86, 0x8A,
+    0x8E, 0x49, 0x8B, 0x07, 0x8E, 0x5A, 0x8C, 0x06, 0x85, 0x5B, 0x8C, 0x06, 0x86, 0x5B, 0x8C, 0x81,
+    0x05, 0x85, 0x8E, 0x50, 0x8B, 0x86, 0x47, 0x8D, 0x81, 0x05, 0x81, 0x88, 0x8E, 0x4C, 0x8A, 0x83,
+    0x01, 0x84, 0x47, 0x8D, 0x81, 0x07, 0x84, 0x88, 0x8B, 0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8B, 0x88,
+    0x84, 0x05, 0x84, 0x47, 0x8D, 0x81, 0x8B, 0x45, 0x00, 0x8A, 0x45, 0x00, 0x88, 0x44, 0x8D, 0x00,
+    0x87, 0x44, 0x8C, 0x00, 0x86, 0x44, 0x8B, 0x00, 0x85, 0x44, 0x8A, 0x00, 0x84, 0x44, 0x88, 0x00,
+    0x82, 0x44, 0x87, 0x00, 0x81, 0x44, 0x86, 0x01, 0x44, 0x85, 0x01, 0x44, 0x84, 0x01, 0x8D, 0x43,
+    0x82, 0x01, 0x8C, 0x43, 0x81, 0x00, 0x05, 0x81, 0x8E, 0x44, 0x82, 0x05, 0x8C, 0x44, 0x87, 0x05,
+    0x87, 0x44, 0x8C, 0x05, 0x82, 0x45, 0x84, 0x05, 0x8B, 0x44, 0x8B, 0x05, 0x83, 0x45, 0x83, 0x05,
+    0x8B, 0x44, 0x8C, 0x05, 0x82, 0x45, 0x85, 0x05, 0x88, 0x44, 0x8E, 0x06, 0x8E, 0x44, 0x89, 0x05,
+    0x84, 0x45, 0x83, 0x05, 0x88, 0x45, 0x06, 0x8D, 0x44, 0x8B, 0x05, 0x81, 0x45, 0x87, 0x05, 0x84,
+    0x45, 0x84, 0x05, 0x87, 0x45, 0x81, 0x05, 0x89, 0x44, 0x8E, 0x06, 0x8B, 0x44, 0x8C, 0x06, 0x8D,
+    0x44, 0x8A, 0x06, 0x8E, 0x44, 0x89, 0x06, 0x45, 0x88, 0x06, 0x45, 0x88, 0x06, 0x45, 0x88, 0x06,
+    0x45, 0x88, 0x06, 0x8E, 0x44, 0x89, 0x06, 0x8D, 0x44, 0x8A, 0x06, 0x8C, 0x44, 0x8C, 0x06, 0x8A,
+    0x44, 0x8E, 0x06, 0x88, 0x45, 0x06, 0x85, 0x45, 0x83, 0x05, 0x81, 0x45, 0x86, 0x06, 0x8E, 0x44,
+    0x8A, 0x06, 0x89, 0x44, 0x8E, 0x06, 0x85, 0x45, 0x83, 0x06, 0x45, 0x88, 0x06, 0x8A, 0x44, 0x8E,
+    0x06, 0x83, 0x45, 0x84, 0x06, 0x8C, 0x44, 0x8B, 0x06, 0x84, 0x45, 0x82, 0x06, 0x8C, 0x44, 0x8A,
+    0x06, 0x83, 0x45, 0x83, 0x06, 0x88, 0x44, 0x8C, 0x07, 0x8C, 0x44, 0x86, 0x06, 0x81, 0x8E, 0x44,
+    0x81, 0x83, 0x44, 0x8E, 0x81, 0x06, 0x88, 0x44, 0x8B, 0x07, 0x8D, 0x44, 0x86, 0x06, 0x85, 0x45,
+    0x81, 0x06, 0x8C, 0x44, 0x8A, 0x06, 0x84, 0x45, 0x82, 0x06, 0x8D, 0x44, 0x8A, 0x06, 0x86, 0x45,
+    0x81, 0x06, 0x45, 0x87, 0x06, 0x8A, 0x44, 0x8D, 0x06, 0x84, 0x45, 0x83, 0x06, 0x45, 0x87, 0x06,
+    0x8C, 0x44, 0x8C, 0x06, 0x88, 0x45, 0x06, 0x85, 0x45, 0x83, 0x05, 0x82, 0x45, 0x86, 0x06, 0x45,
+    0x88, 0x06, 0x8D, 0x44, 0x8A, 0x06, 0x8B, 0x44, 0x8C, 0x06, 0x8A, 0x44, 0x8D, 0x06, 0x89, 0x44,
+    0x8D, 0x06, 0x89, 0x44, 0x8E, 0x06, 0x89, 0x44, 0x8E, 0x06, 0x89, 0x44, 0x8E, 0x06, 0x8A, 0x44,
+    0x8D, 0x06, 0x8B, 0x44, 0x8C, 0x06, 0x8D, 0x44, 0x8A, 0x06, 0x8E, 0x44, 0x89, 0x05, 0x81, 0x45,
+    0x87, 0x05, 0x84, 0x45, 0x84, 0x05, 0x87, 0x45, 0x06, 0x8B, 0x44, 0x8D, 0x06, 0x45, 0x88, 0x05,
+    0x84, 0x45, 0x84, 0x05, 0x89, 0x44, 0x8E, 0x06, 0x8E, 0x44, 0x89, 0x05, 0x85, 0x45, 0x82, 0x05,
+    0x8C, 0x44, 0x8B, 0x05, 0x83, 0x45, 0x83, 0x05, 0x8B, 0x44, 0x8B, 0x05, 0x84, 0x45, 0x82, 0x05,
+    0x8D, 0x44, 0x87, 0x05, 0x87, 0x44, 0x8B, 0x05, 0x82, 0x44, 0x8E, 0x81, 0x05, 0x08, 0x88, 0x44,
+    0x8B, 0x11, 0x86, 0x44, 0x8A, 0x11, 0x85, 0x44, 0x88, 0x11, 0x83, 0x44, 0x86, 0x11, 0x81, 0x44,
+    0x84, 0x12, 0x44, 0x82, 0x09, 0x85, 0x86, 0x81, 0x05, 0x8D, 0x43, 0x06, 0x84, 0x88, 0x01, 0x8B,
+    0x41, 0x8D, 0x88, 0x84, 0x02, 0x8B, 0x43, 0x02, 0x82, 0x87, 0x8B, 0x42, 0x01, 0x8D, 0x45, 0x8A,
+    0x86, 0x8B, 0x42, 0x8D, 0x85, 0x89, 0x8E, 0x45, 0x82, 0x00, 0x56, 0x84, 0x82, 0x56, 0x87, 0x85,
+    0x56, 0x89, 0x83, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8E, 0x4A, 0x8E, 0x8D, 0x8C, 0x8B, 0x8A, 0x88,
+    0x85, 0x07, 0x89, 0x46, 0x8C, 0x0E, 0x84, 0x48, 0x88, 0x0C, 0x82, 0x8E, 0x43, 0x8E, 0x44, 0x84,
+    0x0B, 0x8C, 0x44, 0x83, 0x44, 0x8E, 0x81, 0x09, 0x89, 0x44, 0x8A, 0x00, 0x88, 0x44, 0x8C, 0x08,
+    0x85, 0x45, 0x83, 0x00, 0x81, 0x45, 0x89, 0x06, 0x82, 0x45, 0x8B, 0x02, 0x88, 0x45, 0x85, 0x05,
+    0x82, 0x8B, 0x44, 0x84, 0x02, 0x81, 0x8E, 0x43, 0x8D, 0x85, 0x07, 0x83, 0x8B, 0x41, 0x8D, 0x04,
+    0x87, 0x41, 0x8E, 0x86, 0x0B, 0x83, 0x8A, 0x86, 0x05, 0x8D, 0x87, 0x1F, 0x08, 0x83, 0xB8, 0x87,
+    0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12,
+    0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x09, 0x8D, 0x56, 0x86, 0x8D,
+    0x56, 0x86, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x84, 0xF5, 0x89, 0x44, 0xF5,
+    0x85, 0x82, 0x08, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86,
+    0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x84, 0xCB, 0x09, 0x01, 0x81,
+    0x46, 0x81, 0x01, 0x84, 0x45, 0x8E, 0x02, 0x87, 0x45, 0x8A, 0x02, 0x8A, 0x45, 0x84, 0x02, 0x8D,
+    0x44, 0x8E, 0x03, 0x45, 0x89, 0x02, 0x83, 0x45, 0x83, 0x02, 0x87, 0x44, 0x8D, 0x03, 0x8A, 0x44,
+    0x86, 0x03, 0x8E, 0x44, 0x03, 0x82, 0x44, 0x89, 0x03, 0x85, 0x44, 0x82, 0x03, 0x88, 0x4B, 0x89,
+    0x88, 0x4B, 0x89, 0x88, 0x4B, 0x89, 0x88, 0x4B, 0x89, 0x88, 0x4B, 0x89, 0x88, 0x4B, 0x89, 0x00,
+    0xF1, 0xB1, 0x00, 0x02, 0x81, 0x83, 0x84, 0x82, 0x04, 0x8A, 0x43, 0x8C, 0x81, 0x01, 0x89, 0x45,
+    0x8D, 0x01, 0x47, 0x83, 0x81, 0x47, 0x86, 0x81, 0x47, 0x85, 0x00, 0x8D, 0x46, 0x82, 0x00, 0x85,
+    0x45, 0x89, 0x02, 0x84, 0x8C, 0x41, 0x8D, 0x87, 0x01, 0x0C, 0x88, 0x45, 0x83, 0x0C, 0x8E, 0x44,
+    0x8D, 0x0C, 0x84, 0x45, 0x87, 0x0C, 0x8A, 0x45, 0x81, 0x0C, 0x45, 0x8B, 0x0C, 0x86, 0x45, 0x85,
+    0x0C, 0x8C, 0x45, 0x0C, 0x82, 0x45, 0x8A, 0x0C, 0x88, 0x45, 0x84, 0x0C, 0x8D, 0x44, 0x8E, 0x0C,
+    0x83, 0x45, 0x88, 0x0C, 0x89, 0x45, 0x82, 0x0C, 0x45, 0x8C, 0x0C, 0x85, 0x45, 0x86, 0x0C, 0x8B,
+    0x45, 0x81, 0x0B, 0x81, 0x45, 0x8A, 0x0C, 0x87, 0x45, 0x84, 0x0C, 0x8D, 0x44, 0x8E, 0x0C, 0x83,
+    0x45, 0x89, 0x0C, 0x89, 0x45, 0x83, 0x0C, 0x8E, 0x44, 0x8D, 0x0C, 0x84, 0x45, 0x87, 0x0C, 0x8A,
+    0x45, 0x81, 0x0B, 0x81, 0x45, 0x8B, 0x0C, 0x86, 0x45, 0x85, 0x0C, 0x8C, 0x45, 0x0C, 0x82, 0x45,
+    0x89, 0x0C, 0x88, 0x45, 0x83, 0x0C, 0x8E, 0x44, 0x8D, 0x0C, 0x84, 0x45, 0x88, 0x0C, 0x8A, 0x45,
+    0x82, 0x0C, 0x45, 0x8C, 0x0C, 0x85, 0x45, 0x86, 0x0C, 0x8B, 0x45, 0x81, 0x0B, 0x81, 0x45, 0x8A,
+    0x0C, 0x87, 0x45, 0x84, 0x0C, 0x07, 0x83, 0x88, 0x8B, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x85, 0x0D,
+    0x83, 0x8C, 0x49, 0x8E, 0x85, 0x0A, 0x86, 0x4D, 0x8A, 0x08, 0x86, 0x4F, 0x8B, 0x06, 0x83, 0x51,
+    0x88, 0x05, 0x8C, 0x52, 0x82, 0x03, 0x84, 0x47, 0x88, 0x83, 0x82, 0x85, 0x8D, 0x46, 0x8A, 0x03,
+    0x8B, 0x46, 0x84, 0x04, 0x8C, 0x46, 0x81, 0x02, 0x46, 0x8A, 0x05, 0x82, 0x46, 0x87, 0x01, 0x84,
+    0x46, 0x83, 0x06, 0x8C, 0x45, 0x8C, 0x01, 0x88, 0x46, 0x07, 0x87, 0x46, 0x01, 0x8B, 0x45, 0x8C,
+    0x07, 0x84, 0x46, 0x83, 0x00, 0x8D, 0x45, 0x89, 0x07, 0x81, 0x46, 0x86, 0x00, 0x46, 0x88, 0x08,
+    0x46, 0x88, 0x00, 0x46, 0x86, 0x08, 0x8E, 0x45, 0x89, 0x81, 0x46, 0x85, 0x08, 0x8D, 0x45, 0x8A,
+    0x82, 0x46, 0x85, 0x08, 0x8C, 0x45, 0x8B, 0x82, 0x46, 0x84, 0x08, 0x8C, 0x45, 0x8C, 0x82, 0x46,
+    0x84, 0x08, 0x8C, 0x45, 0x8C, 0x82, 0x46, 0x85, 0x08, 0x8C, 0x45, 0x8B, 0x81, 0x46, 0x85, 0x08,
+    0x8D, 0x45, 0x8B, 0x00, 0x46, 0x86, 0x08, 0x8E, 0x45, 0x8A, 0x00, 0x46, 0x87, 0x08, 0x46, 0x88,
+    0x00, 0x8D, 0x45, 0x89, 0x07, 0x81, 0x46, 0x86, 0x00, 0x8A, 0x45, 0x8B, 0x07, 0x83, 0x46, 0x84,
+    0x00, 0x87, 0x45, 0x8E, 0x07, 0x87, 0x46, 0x81, 0x00, 0x83, 0x46, 0x83, 0x06, 0x8B, 0x45, 0x8D,
+    0x02, 0x8E, 0x45, 0x89, 0x05, 0x82, 0x46, 0x89, 0x02, 0x89, 0x46, 0x84, 0x04, 0x8C, 0x46, 0x84,
+    0x02, 0x82, 0x47, 0x87, 0x82, 0x81, 0x84, 0x8C, 0x46, 0x8D, 0x04, 0x8A, 0x52, 0x85, 0x04, 0x81,
+    0x8E, 0x50, 0x8C, 0x06, 0x83, 0x4F, 0x8E, 0x81, 0x07, 0x84, 0x8E, 0x4C, 0x8D, 0x82, 0x09, 0x81,
+    0x8A, 0x4A, 0x88, 0x0D, 0x82, 0x87, 0x8B, 0x8E, 0x42, 0x8D, 0x8A, 0x86, 0x81, 0x06, 0x0A, 0x84,
+    0x8E, 0x44, 0x8A, 0x09, 0x86, 0x46, 0x8A, 0x08, 0x8A, 0x47, 0x8A, 0x06, 0x81, 0x8C, 0x48, 0x8A,
+    0x05, 0x83, 0x8E, 0x49, 0x8A, 0x04, 0x86, 0x4B, 0x8A, 0x03, 0x89, 0x4C, 0x8A, 0x01, 0x81, 0x8C,
+    0x4D, 0x8A, 0x00, 0x83, 0x8E, 0x46, 0x9B, 0x45, 0x8A, 0x00, 0x8C, 0x46, 0x8B, 0x00, 0x8B, 0x45,
+    0x8A, 0x00, 0x81, 0x8E, 0x44, 0x89, 0x01, 0x8C, 0x45, 0x8A, 0x01, 0x83, 0x43, 0x86, 0x02, 0x8C,
+    0x45, 0x8A, 0x02, 0x86, 0x40, 0x8E, 0x83, 0x03, 0x8D, 0x45, 0x8A, 0x03, 0x87, 0x81, 0x04, 0x8D,
+    0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x0A, 0x8E,
+    0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x0A, 0x8E,
+    0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x0A, 0x8E,
+    0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x0A, 0x8E,
+    0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x0A, 0x8E,
+    0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x0A, 0x8E, 0x45, 0x8A, 0x07, 0x85, 0x89, 0x8B, 0x8E, 0x42,
+    0x8E, 0x8B, 0x88, 0x83, 0x0B, 0x82, 0x89, 0x4B, 0x8C, 0x84, 0x08, 0x89, 0x4F, 0x89, 0x05, 0x83,
+    0x8E, 0x51, 0x8A, 0x03, 0x86, 0x54, 0x86, 0x02, 0x8B, 0x54, 0x8E, 0x81, 0x01, 0x81, 0x8D, 0x46,
+    0x8B, 0x87, 0x95, 0x87, 0x8D, 0x47, 0x86, 0x02, 0x82, 0x8E, 0x43, 0x89, 0x81, 0x05, 0x89, 0x46,
+    0x8B, 0x03, 0x83, 0x41, 0x8C, 0x82, 0x08, 0x8E, 0x45, 0x8D, 0x04, 0x86, 0x89, 0x0A, 0x8A, 0x45,
+    0x8E, 0x11, 0x89, 0x45, 0x8D, 0x11, 0x8A, 0x45, 0x8C, 0x11, 0x8D, 0x45, 0x89, 0x10, 0x83, 0x46,
+    0x84, 0x10, 0x8B, 0x45, 0x8E, 0x10, 0x86, 0x46, 0x86, 0x0F, 0x82, 0x46, 0x8D, 0x0F, 0x81, 0x8E,
+    0x46, 0x83, 0x0E, 0x81, 0x8D, 0x46, 0x87, 0x0F, 0x8C, 0x46, 0x8A, 0x0F, 0x8C, 0x46, 0x8A, 0x0F,
+    0x8B, 0x46, 0x8B, 0x0F, 0x8B, 0x46, 0x8A, 0x0F, 0x8B, 0x46, 0x8A, 0x0F, 0x8B, 0x46, 0x89, 0x0F,
+    0x8B, 0x46, 0x88, 0x0F, 0x8B, 0x46, 0x86, 0x0F, 0x8B, 0x46, 0x85, 0x0F, 0x8B, 0x46, 0x84, 0x0F,
+    0x8B, 0x46, 0x8A, 0xF5, 0xE5, 0x00, 0x8B, 0x57, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58,
+    0x00, 0x58, 0x05, 0x82, 0x86, 0x89, 0x8C, 0x8D, 0x8E, 0x41, 0x8E, 0x8C, 0x8A, 0x86, 0x81, 0x0A,
+    0x86, 0x8C, 0x4C, 0x8B, 0x83, 0x06, 0x86, 0x8E, 0x50, 0x89, 0x04, 0x8B, 0x53, 0x8B, 0x03, 0x86,
+    0x54, 0x87, 0x03, 0x8B, 0x53, 0x8E, 0x03, 0x81, 0x44, 0x8B, 0x87, 0x83, 0x92, 0x83, 0x87, 0x8D,
+    0x47, 0x84, 0x03, 0x86, 0x41, 0x88, 0x81, 0x07, 0x8C, 0x46, 0x87, 0x04, 0x88, 0x82, 0x09, 0x82,
+    0x46, 0x88, 0x11, 0x8E, 0x45, 0x87, 0x11, 0x8E, 0x45, 0x85, 0x11, 0x46, 0x81, 0x10, 0x86, 0x45,
+    0x8A, 0x10, 0x85, 0x45, 0x8E, 0x81, 0x0C, 0x81, 0x83, 0x87, 0x8C, 0x46, 0x84, 0x08, 0x89, 0x4C,
+    0x8D, 0x83, 0x09, 0x89, 0x4A, 0x8E, 0x87, 0x0B, 0x89, 0x49, 0x88, 0x82, 0x0C, 0x89, 0x4B, 0x8E,
+    0x89, 0x82, 0x09, 0x89, 0x4E, 0x88, 0x08, 0x87, 0xAC, 0x8D, 0x8E, 0x4A, 0x8B, 0x0E, 0x82, 0x85,
+    0x8B, 0x47, 0x88, 0x10, 0x85, 0x47, 0x81, 0x10, 0x8A, 0x46, 0x85, 0x10, 0x85, 0x46, 0x88, 0x10,
+    0x85, 0x46, 0x89, 0x10, 0x87, 0x46, 0x88, 0x00, 0x81, 0x0E, 0x8D, 0x46, 0x86, 0x81, 0x40, 0x8A,
+    0x84, 0x0B, 0x8A, 0x47, 0x82, 0x81, 0x42, 0x8E, 0x8A, 0x86, 0x83, 0x81, 0x02, 0x81, 0x84, 0x88,
+    0x8E, 0x47, 0x8D, 0x00, 0x81, 0x56, 0x84, 0x00, 0x81, 0x55, 0x8A, 0x01, 0x81, 0x54, 0x8A, 0x02,
+    0x81, 0x53, 0x87, 0x04, 0x84, 0x8A, 0x4E, 0x8E, 0x88, 0x81, 0x08, 0x83, 0x87, 0x8A, 0x8C, 0x9E,
+    0x41, 0x9E, 0x8C, 0x8A, 0x87, 0x83, 0x07, 0x0F, 0x8C, 0x45, 0x87, 0x12, 0x87, 0x46, 0x87, 0x11,
+    0x82, 0x47, 0x87, 0x11, 0x8C, 0x47, 0x87, 0x10, 0x87, 0x48, 0x87, 0x0F, 0x82, 0x49, 0x87, 0x0F,
+    0x8C, 0x49, 0x87, 0x0E, 0x87, 0x4A, 0x87, 0x0D, 0x82, 0x44, 0x8E, 0x45, 0x87, 0x0D, 0x8C, 0x43,
+    0x8C, 0x8A, 0x45, 0x87, 0x0C, 0x87, 0x44, 0x84, 0x8B, 0x45, 0x87, 0x0B, 0x82, 0x44, 0x8B, 0x00,
+    0x8C, 0x45, 0x87, 0x0B, 0x8C, 0x44, 0x82, 0x00, 0x8C, 0x45, 0x87, 0x0A, 0x87, 0x44, 0x88, 0x01,
+    0x8D, 0x45, 0x87, 0x09, 0x82, 0x44, 0x8D, 0x02, 0x8D, 0x45, 0x87, 0x09, 0x8C, 0x44, 0x84, 0x02,
+    0x8E, 0x45, 0x87, 0x08, 0x86, 0x44, 0x8A, 0x03, 0x8E, 0x45, 0x87, 0x07, 0x82, 0x44, 0x8E, 0x81,
+    0x03, 0x8E, 0x45, 0x87, 0x07, 0x8B, 0x44, 0x85, 0x04, 0x8E, 0x45, 0x87, 0x06, 0x86, 0x44, 0x8B,
+    0x05, 0x8E, 0x45, 0x87, 0x05, 0x82, 0x45, 0x82, 0x05, 0x8E, 0x45, 0x87, 0x05, 0x8B, 0x44, 0x87,
+    0x06, 0x8E, 0x45, 0x87, 0x04, 0x86, 0x44, 0x8C, 0x07, 0x8E, 0x45, 0x87, 0x03, 0x81, 0x59, 0x8C,
+    0x82, 0x59, 0x8C, 0x82, 0x59, 0x8C, 0x82, 0x59, 0x8C, 0x82, 0x59, 0x8C, 0x81, 0xFD, 0xED, 0x46,
+    0x8E, 0xAD, 0x8A, 0x0F, 0x8E, 0x45, 0x87, 0x13, 0x8E, 0x45, 0x87, 0x13, 0x8E, 0x45, 0x87, 0x13,
+    0x8E, 0x45, 0x87, 0x13, 0x8E, 0x45, 0x87, 0x13, 0x8E, 0x45, 0x87, 0x13, 0x8E, 0x45, 0x87, 0x03,
+    0x01, 0x88, 0x51, 0x8D, 0x04, 0x89, 0x51, 0x8D, 0x04, 0x8A, 0x51, 0x8D, 0x04, 0x8C, 0x51, 0x8D,
+    0x04, 0x8D, 0x51, 0x8D, 0x04, 0x8E, 0x51, 0x8D, 0x04, 0x46, 0x87, 0xF6, 0xA6, 0x85, 0x04, 0x46,
+    0x10, 0x82, 0x45, 0x8E, 0x10, 0x83, 0x45, 0x8D, 0x10, 0x84, 0x45, 0x8B, 0x10, 0x85, 0x45, 0x8A,
+    0x10, 0x86, 0x45, 0x88, 0x10, 0x87, 0x45, 0x8C, 0x8B, 0x8D, 0x42, 0x8E, 0x8C, 0x88, 0x84, 0x07,
+    0x89, 0x4F, 0x8D, 0x86, 0x05, 0x8A, 0x51, 0x8A, 0x04, 0x8B, 0x52, 0x8B, 0x03, 0x8C, 0x53, 0x89,
+    0x02, 0x86, 0x8E, 0x53, 0x82, 0x02, 0x81, 0x88, 0x8C, 0x89, 0x86, 0x84, 0x82, 0x81, 0x82, 0x83,
+    0x86, 0x8B, 0x48, 0x89, 0x0E, 0x83, 0x8D, 0x46, 0x8D, 0x0F, 0x82, 0x47, 0x81, 0x0F, 0x89, 0x46,
+    0x83, 0x0F, 0x86, 0x46, 0x84, 0x0F, 0x85, 0x46, 0x83, 0x0F, 0x86, 0x46, 0x82, 0x0F, 0x8A, 0x46,
+    0x00, 0x82, 0x0D, 0x82, 0x46, 0x8C, 0x00, 0x89, 0x8E, 0x87, 0x82, 0x09, 0x83, 0x8E, 0x46, 0x88,
+    0x00, 0x89, 0x42, 0x8E, 0x8A, 0x87, 0x84, 0x83, 0x92, 0x83, 0x86, 0x8B, 0x48, 0x81, 0x00, 0x89,
+    0x54, 0x88, 0x01, 0x89, 0x53, 0x8C, 0x02, 0x89, 0x52, 0x8D, 0x81, 0x02, 0x89, 0x51, 0x89, 0x04,
+    0x81, 0x88, 0x8E, 0x4D, 0x8A, 0x83, 0x08, 0x83, 0x87, 0x8A, 0x8C, 0x8E, 0x42, 0x8E, 0x8D, 0x8C,
+    0x88, 0x85, 0x81, 0x07, 0x0B, 0x83, 0x87, 0x8A, 0x8C, 0x8E, 0x43, 0x8E, 0x8C, 0x84, 0x0A, 0x82,
+    0x89, 0x8E, 0x4A, 0x87, 0x09, 0x89, 0x4D, 0x87, 0x07, 0x83, 0x8D, 0x4E, 0x87, 0x06, 0x83, 0x50,
+    0x87, 0x05, 0x82, 0x4C, 0x9E, 0x42, 0x87, 0x05, 0x8C, 0x47, 0x8D, 0x87, 0x83, 0x81, 0x03, 0x81,
+    0x83, 0x82, 0x04, 0x87, 0x46, 0x8D, 0x84, 0x0F, 0x8E, 0x45, 0x8B, 0x10, 0x86, 0x45, 0x8D, 0x11,
+    0x8C, 0x45, 0x83, 0x10, 0x81, 0x45, 0x8B, 0x11, 0x85, 0x45, 0x86, 0x11, 0x89, 0x45, 0x82, 0x01,
+    0x82, 0x88, 0x8C, 0x8E, 0x40, 0x8E, 0x8D, 0x8A, 0x86, 0x81, 0x05, 0x8C, 0x45, 0x01, 0x88, 0x49,
+    0x87, 0x04, 0x8E, 0x44, 0x8D, 0x00, 0x8B, 0x4B, 0x8B, 0x03, 0x45, 0x8B, 0x89, 0x4D, 0x8A, 0x01,
+    0x81, 0x56, 0x86, 0x00, 0x82, 0x4A, 0x8E, 0x8C, 0x8D, 0x48, 0x8D, 0x00, 0x83, 0x48, 0x8B, 0x83,
+    0x03, 0x87, 0x47, 0x84, 0x83, 0x47, 0x89, 0x06, 0x85, 0x46, 0x88, 0x83, 0x46, 0x8C, 0x08, 0x8C,
+    0x45, 0x8C, 0x82, 0x46, 0x86, 0x08, 0x88, 0x45, 0x8D, 0x81, 0x46, 0x84, 0x08, 0x86, 0x45, 0x8E,
+    0x00, 0x8E, 0x45, 0x85, 0x08, 0x85, 0x45, 0x8E, 0x00, 0x8B, 0x45, 0x88, 0x08, 0x87, 0x45, 0x8D,
+    0x00, 0x87, 0x45, 0x8D, 0x08, 0x8A, 0x45, 0x8B, 0x00, 0x83, 0x46, 0x86, 0x06, 0x81, 0x46, 0x88,
+    0x01, 0x8C, 0x46, 0x83, 0x05, 0x8B, 0x46, 0x84, 0x01, 0x85, 0x47, 0x88, 0x82, 0x00, 0x81, 0x85,
+    0x8C, 0x46, 0x8D, 0x03, 0x8C, 0x53, 0x86, 0x03, 0x81, 0x8E, 0x51, 0x8B, 0x05, 0x83, 0x50, 0x8D,
+    0x81, 0x06, 0x83, 0x8D, 0x4D, 0x8B, 0x81, 0x09, 0x88, 0x4A, 0x8E, 0x86, 0x0D, 0x85, 0x8A, 0x8D,
+    0x8E, 0x41, 0x8E, 0x8C, 0x88, 0x84, 0x06, 0x8A, 0x58, 0x8A, 0x58, 0x8A, 0x58, 0x8A, 0x58, 0x8A,
+    0x58, 0x8A, 0x57, 0x89, 0x83, 0xF5, 0xF5, 0x87, 0x46, 0x83, 0x10, 0x89, 0x45, 0x8C, 0x10, 0x81,
+    0x46, 0x85, 0x10, 0x87, 0x45, 0x8E, 0x11, 0x8E, 0x45, 0x87, 0x10, 0x86, 0x46, 0x81, 0x10, 0x8D,
+    0x45, 0x89, 0x10, 0x84, 0x46, 0x82, 0x10, 0x8B, 0x45, 0x8B, 0x10, 0x83, 0x46, 0x84, 0x10, 0x8A,
+    0x45, 0x8D, 0x10, 0x81, 0x46, 0x87, 0x10, 0x88, 0x46, 0x11, 0x46, 0x89, 0x10, 0x87, 0x46, 0x82,
+    0x10, 0x8E, 0x45, 0x8B, 0x10, 0x85, 0x46, 0x84, 0x10, 0x8C, 0x45, 0x8D, 0x10, 0x84, 0x46, 0x86,
+    0x10, 0x8B, 0x46, 0x10, 0x82, 0x46, 0x88, 0x10, 0x89, 0x46, 0x82, 0x0F, 0x81, 0x46, 0x8B, 0x10,
+    0x88, 0x46, 0x84, 0x10, 0x8E, 0x45, 0x8D, 0x10, 0x86, 0x46, 0x86, 0x10, 0x8D, 0x45, 0x8E, 0x10,
+    0x85, 0x46, 0x88, 0x10, 0x8C, 0x46, 0x81, 0x0F, 0x83, 0x46, 0x8A, 0x0C, 0x07, 0x85, 0x89, 0x8C,
+    0x8E, 0x41, 0x8E, 0x8D, 0x8B, 0x88, 0x83, 0x0C, 0x88, 0x8E, 0x4A, 0x8D, 0x85, 0x08, 0x83, 0x8E,
+    0x4E, 0x8B, 0x06, 0x84, 0x51, 0x8C, 0x04, 0x81, 0x8E, 0x52, 0x89, 0x03, 0x88, 0x47, 0x8D, 0x8A,
+    0x88, 0x8B, 0x48, 0x81, 0x02, 0x8E, 0x45, 0x8E, 0x84, 0x03, 0x81, 0x89, 0x46, 0x86, 0x02, 0x46,
+    0x85, 0x06, 0x8C, 0x45, 0x89, 0x01, 0x81, 0x46, 0x07, 0x87, 0x45, 0x8A, 0x01, 0x81, 0x46, 0x07,
+    0x87, 0x45, 0x89, 0x02, 0x8E, 0x45, 0x84, 0x06, 0x8B, 0x45, 0x87, 0x02, 0x89, 0x45, 0x8D, 0x05,
+    0x84, 0x46, 0x82, 0x02, 0x82, 0x46, 0x8C, 0x82, 0x02, 0x85, 0x46, 0x8A, 0x04, 0x89, 0x47, 0x88,
+    0x83, 0x8B, 0x46, 0x8E, 0x81, 0x05, 0x8B, 0x4F, 0x8E, 0x83, 0x07, 0x8B, 0x4D, 0x8C, 0x82, 0x09,
+    0x88, 0x4A, 0x8E, 0x86, 0x0B, 0x82, 0x8C, 0x49, 0x8D, 0x84, 0x0A, 0x88, 0x4D, 0x8A, 0x81, 0x06,
+    0x81, 0x8C, 0x4F, 0x8E, 0x83, 0x04, 0x81, 0x8D, 0x47, 0x89, 0x8A, 0x48, 0x83, 0x03, 0x8B, 0x46,
+    0x8B, 0x81, 0x01, 0x83, 0x8C, 0x46, 0x8E, 0x82, 0x01, 0x84, 0x46, 0x88, 0x05, 0x88, 0x46, 0x8B,
+    0x01, 0x8B, 0x45, 0x8A, 0x07, 0x86, 0x46, 0x83, 0x00, 0x46, 0x81, 0x08, 0x8B, 0x45, 0x88, 0x82,
+    0x45, 0x8C, 0x09, 0x85, 0x45, 0x8B, 0x83, 0x45, 0x8C, 0x09, 0x83, 0x45, 0x8C, 0x82, 0x45, 0x8E,
+    0x09, 0x86, 0x45, 0x8B, 0x00, 0x46, 0x87, 0x08, 0x8D, 0x45, 0x89, 0x00, 0x8C, 0x46, 0x87, 0x05,
+    0x82, 0x8C, 0x46, 0x83, 0x00, 0x86, 0x48, 0x8B, 0x99, 0x8A, 0x8D, 0x47, 0x8D, 0x02, 0x8C, 0x54,
+    0x83, 0x02, 0x82, 0x8E, 0x52, 0x85, 0x04, 0x81, 0x8C, 0x4F, 0x8E, 0x84, 0x07, 0x86, 0x8D, 0x4B,
+    0x8E, 0x88, 0x0B, 0x82, 0x87, 0x8A, 0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8B, 0x88, 0x84, 0x06, 0x06,
+    0x81, 0x86, 0x8A, 0x8D, 0x8E, 0x41, 0x8E, 0x8B, 0x88, 0x82, 0x0C, 0x81, 0x89, 0x4A, 0x8C, 0x84,
+    0x09, 0x84, 0x8E, 0x4D, 0x89, 0x07, 0x85, 0x50, 0x8B, 0x05, 0x83, 0x52, 0x89, 0x04, 0x8C, 0x53,
+    0x85, 0x02, 0x84, 0x47, 0x89, 0x83, 0x81, 0x82, 0x85, 0x8C, 0x46, 0x8D, 0x02, 0x8B, 0x46, 0x85,
+    0x05, 0x8A, 0x46, 0x85, 0x01, 0x46, 0x8A, 0x07, 0x8D, 0x45, 0x8B, 0x00, 0x82, 0x46, 0x83, 0x07,
+    0x84, 0x46, 0x81, 0x84, 0x46, 0x09, 0x46, 0x84, 0x85, 0x45, 0x8E, 0x09, 0x8C, 0x45, 0x87, 0x85,
+    0x46, 0x09, 0x8B, 0x45, 0x8A, 0x84, 0x46, 0x81, 0x08, 0x8D, 0x45, 0x8B, 0x83, 0x46, 0x85, 0x07,
+    0x83, 0x46, 0x8C, 0x00, 0x46, 0x8D, 0x06, 0x82, 0x8E, 0x46, 0x8C, 0x00, 0x8B, 0x46, 0x8C, 0x83,
+    0x03, 0x86, 0x48, 0x8C, 0x00, 0x85, 0x48, 0x8E, 0x8C, 0x8D, 0x4A, 0x8C, 0x01, 0x8D, 0x55, 0x8A,
+    0x01, 0x82, 0x4E, 0x85, 0x45, 0x89, 0x02, 0x84, 0x4C, 0x94, 0x45, 0x87, 0x03, 0x82, 0x8C, 0x48,
+    0x8E, 0x84, 0x00, 0x86, 0x45, 0x85, 0x05, 0x84, 0x89, 0x8C, 0x8E, 0x40, 0x8E, 0x8D, 0x8A, 0x85,
+    0x02, 0x89, 0x45, 0x82, 0x11, 0x8E, 0x44, 0x8E, 0x11, 0x83, 0x45, 0x8A, 0x11, 0x8B, 0x45, 0x85,
+    0x10, 0x85, 0x45, 0x8E, 0x10, 0x84, 0x46, 0x88, 0x0F, 0x88, 0x46, 0x8E, 0x81, 0x04, 0x84, 0x82,
+    0x04, 0x82, 0x85, 0x89, 0x8E, 0x47, 0x86, 0x05, 0x8E, 0x42, 0x9E, 0x4B, 0x8A, 0x06, 0x8E, 0x4F,
+    0x8B, 0x07, 0x8E, 0x4E, 0x89, 0x08, 0x8E, 0x4C, 0x8E, 0x85, 0x09, 0x8E, 0x4A, 0x8C, 0x86, 0x0B,
+    0x8A, 0x8D, 0x8E, 0x43, 0x8E, 0x8C, 0x89, 0x86, 0x82, 0x0A, 0x01, 0x85, 0x8C, 0x41, 0x8D, 0x87,
+    0x02, 0x86, 0x45, 0x89, 0x01, 0x8E, 0x46, 0x82, 0x81, 0x47, 0x85, 0x81, 0x47, 0x86, 0x00, 0x47,
+    0x83, 0x00, 0x88, 0x45, 0x8C, 0x02, 0x89, 0x43, 0x8B, 0x81, 0x03, 0x81, 0x94, 0x82, 0x3F, 0x33,
+    0x81, 0x83, 0x84, 0x82, 0x04, 0x8A, 0x43, 0x8C, 0x81, 0x01, 0x89, 0x45, 0x8D, 0x01, 0x47, 0x83,
+    0x81, 0x47, 0x86, 0x81, 0x47, 0x85, 0x00, 0x8D, 0x46, 0x82, 0x00, 0x85, 0x45, 0x89, 0x02, 0x84,
+    0x8C, 0x41, 0x8D, 0x87, 0x01, 0x02, 0x85, 0x8C, 0x41, 0x8D, 0x87, 0x03, 0x86, 0x45, 0x89, 0x02,
+    0x8E, 0x46, 0x82, 0x00, 0x81, 0x47, 0x85, 0x00, 0x81, 0x47, 0x86, 0x01, 0x47, 0x83, 0x01, 0x88,
+    0x45, 0x8C, 0x03, 0x89, 0x43, 0x8B, 0x81, 0x04, 0x81, 0x94, 0x82, 0x3F, 0x3F, 0x13, 0x81, 0x46,
+    0x81, 0x01, 0x84, 0x45, 0x8E, 0x02, 0x87, 0x45, 0x8A, 0x02, 0x8A, 0x45, 0x84, 0x02, 0x8D, 0x44,
+    0x8E, 0x03, 0x45, 0x89, 0x02, 0x83, 0x45, 0x83, 0x02, 0x87, 0x44, 0x8D, 0x03, 0x8A, 0x44, 0x86,
+    0x03, 0x8E, 0x44, 0x03, 0x82, 0x44, 0x89, 0x03, 0x85, 0x44, 0x82, 0x03, 0x2E, 0x82, 0x8A, 0x86,
+    0x13, 0x82, 0x8A, 0x41, 0x86, 0x11, 0x82, 0x8A, 0x43, 0x86, 0x0F, 0x82, 0x8A, 0x45, 0x86, 0x0D,
+    0x82, 0x8A, 0x47, 0x86, 0x0B, 0x82, 0x8A, 0x49, 0x85, 0x09, 0x82, 0x8A, 0x49, 0x8A, 0x82, 0x08,
+    0x82, 0x8A, 0x49, 0x89, 0x81, 0x08, 0x82, 0x8A, 0x48, 0x8E, 0x87, 0x81, 0x08, 0x82, 0x8A, 0x48,
+    0x8D, 0x86, 0x09, 0x82, 0x8A, 0x48, 0x8C, 0x85, 0x09, 0x82, 0x8A, 0x48, 0x8B, 0x84, 0x0B, 0x8D,
+    0x47, 0x8A, 0x83, 0x0D, 0x8D, 0x46, 0x84, 0x0F, 0x8D, 0x47, 0x8C, 0x85, 0x0D, 0x89, 0x49, 0x8E,
+    0x88, 0x81, 0x0B, 0x81, 0x88, 0x8E, 0x49, 0x8B, 0x84, 0x0C, 0x86, 0x8D, 0x49, 0x8D, 0x87, 0x81,
+    0x0B, 0x84, 0x8B, 0x4A, 0x8A, 0x83, 0x0B, 0x82, 0x8A, 0x4A, 0x8D, 0x86, 0x0B, 0x81, 0x88, 0x8E,
+    0x4A, 0x84, 0x0C, 0x86, 0x8D, 0x48, 0x86, 0x0E, 0x84, 0x8B, 0x46, 0x86, 0x10, 0x82, 0x89, 0x44,
+    0x86, 0x12, 0x81, 0x87, 0x8E, 0x41, 0x86, 0x15, 0x85, 0x8C, 0x86, 0x18, 0x8D, 0x56, 0x86, 0x8D,
+    0x56, 0x86, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x84, 0xF5, 0xF5, 0xE5, 0x82,
+    0x3F, 0x0A, 0x84, 0xF5, 0xF5, 0xE5, 0x82, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86,
+    0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x18, 0x8B, 0x86, 0x16, 0x8D, 0x40, 0x8E, 0x86, 0x14, 0x8D,
+    0x42, 0x8E, 0x86, 0x12, 0x8D, 0x44, 0x8E, 0x86, 0x10, 0x8D, 0x46, 0x8E, 0x86, 0x0E, 0x8C, 0x48,
+    0x8E, 0x86, 0x0D, 0x86, 0x8D, 0x48, 0x8E, 0x86, 0x0D, 0x85, 0x8C, 0x48, 0x8E, 0x86, 0x0D, 0x83,
+    0x8B, 0x48, 0x8E, 0x86, 0x0D, 0x82, 0x8A, 0x48, 0x8E, 0x86, 0x0D, 0x81, 0x88, 0x48, 0x8E, 0x86,
+    0x0D, 0x81, 0x87, 0x8E, 0x47, 0x8E, 0x86, 0x0E, 0x86, 0x8D, 0x47, 0x86, 0x0F, 0x8B, 0x46, 0x86,
+    0x0C, 0x82, 0x88, 0x8E, 0x47, 0x86, 0x0A, 0x84, 0x8B, 0x49, 0x8E, 0x83, 0x07, 0x81, 0x87, 0x8E,
+    0x49, 0x8C, 0x85, 0x07, 0x83, 0x8A, 0x4A, 0x8A, 0x83, 0x07, 0x86, 0x8D, 0x49, 0x8E, 0x88, 0x81,
+    0x06, 0x83, 0x89, 0x4A, 0x8D, 0x86, 0x08, 0x8A, 0x4A, 0x8C, 0x84, 0x0A, 0x8D, 0x48, 0x8A, 0x83,
+    0x0C, 0x8D, 0x45, 0x8E, 0x88, 0x81, 0x0E, 0x8D, 0x43, 0x8D, 0x86, 0x11, 0x8D, 0x41, 0x8B, 0x84,
+    0x13, 0x8C, 0x89, 0x82, 0x2E, 0x04, 0x82, 0x86, 0x89, 0x8C, 0x8D, 0x8E, 0x41, 0x8E, 0x8C, 0x88,
+    0x84, 0x07, 0x81, 0x87, 0x8D, 0x4B, 0x8D, 0x85, 0x03, 0x82, 0x89, 0x50, 0x8B, 0x02, 0x8A, 0x52,
+    0x8C, 0x01, 0x82, 0x53, 0x87, 0x01, 0x8A, 0x53, 0x01, 0x82, 0x43, 0x8D, 0x88, 0x85, 0x82, 0x01,
+    0x82, 0x86, 0x8D, 0x46, 0x85, 0x01, 0x8A, 0x40, 0x89, 0x83, 0x08, 0x8D, 0x45, 0x88, 0x01, 0x91,
+    0x0A, 0x88, 0x45, 0x8A, 0x0E, 0x87, 0x45, 0x89, 0x0E, 0x8A, 0x45, 0x87, 0x0D, 0x82, 0x46, 0x83,
+    0x0C, 0x81, 0x8D, 0x45, 0x8D, 0x0C, 0x83, 0x8E, 0x46, 0x84, 0x0B, 0x87, 0x47, 0x87, 0x0B, 0x8B,
+    0x47, 0x87, 0x0B, 0x8C, 0x47, 0x85, 0x0B, 0x8B, 0x46, 0x8D, 0x82, 0x0B, 0x85, 0x46, 0x89, 0x0D,
+    0x8C, 0x45, 0x87, 0x0D, 0x81, 0x45, 0x8B, 0x0E, 0x82, 0x45, 0x85, 0x0E, 0x84, 0x45, 0x83, 0x0E,
+    0x84, 0x45, 0x83, 0x3F, 0x2D, 0x83, 0x84, 0x82, 0x11, 0x89, 0x43, 0x8C, 0x82, 0x0E, 0x87, 0x45,
+    0x8E, 0x0E, 0x8E, 0x46, 0x85, 0x0D, 0x47, 0x87, 0x0D, 0x47, 0x87, 0x0D, 0x8C, 0x46, 0x83, 0x0D,
+    0x84, 0x45, 0x8A, 0x0F, 0x83, 0x8B, 0x41, 0x8D, 0x87, 0x09, 0x0E, 0x82, 0x86, 0x89, 0x8C, 0x8D,
+    0x8E, 0x41, 0x8E, 0x8D, 0x8B, 0x88, 0x84, 0x18, 0x81, 0x88, 0x8D, 0x4D, 0x8A, 0x83, 0x13, 0x81,
+    0x89, 0x52, 0x8C, 0x82, 0x10, 0x86, 0x56, 0x88, 0x0E, 0x8B, 0x48, 0x8E, 0x8C, 0x8B, 0x9A, 0x8B,
+    0x8D, 0x48, 0x8B, 0x0B, 0x81, 0x8D, 0x46, 0x8B, 0x86, 0x81, 0x07, 0x84, 0x8A, 0x46, 0x8B, 0x09,
+    0x81, 0x8D, 0x45, 0x89, 0x82, 0x0C, 0x82, 0x8B, 0x45, 0x8A, 0x08, 0x8C, 0x44, 0x8E, 0x84, 0x10,
+    0x86, 0x45, 0x85, 0x06, 0x89, 0x44, 0x8C, 0x81, 0x12, 0x85, 0x44, 0x8E, 0x81, 0x04, 0x83, 0x44,
+    0x8D, 0x81, 0x04, 0x81, 0x86, 0x8A, 0x8D, 0x8E, 0x41, 0x8E, 0x8C, 0x8A, 0x88, 0x84, 0x81, 0x02,
+    0x88, 0x44, 0x87, 0x04, 0x8D, 0x44, 0x82, 0x03, 0x81, 0x88, 0x4C, 0x8C, 0x82, 0x01, 0x8D, 0x43,
+    0x8E, 0x03, 0x84, 0x44, 0x87, 0x03, 0x83, 0x8E, 0x4E, 0x83, 0x01, 0x86, 0x44, 0x84, 0x02, 0x8C,
+    0x43, 0x8D, 0x03, 0x83, 0x50, 0x83, 0x02, 0x8E, 0x43, 0x89, 0x01, 0x82, 0x44, 0x86, 0x02, 0x81,
+    0x8E, 0x45, 0x8D, 0x89, 0x97, 0x89, 0x8C, 0x44, 0x82, 0x02, 0x8A, 0x43, 0x8D, 0x01, 0x87, 0x44,
+    0x03, 0x8B, 0x44, 0x8E, 0x84, 0x04, 0x86, 0x44, 0x81, 0x02, 0x85, 0x44, 0x01, 0x8C, 0x43, 0x8B,
+    0x02, 0x83, 0x44, 0x8E, 0x82, 0x05, 0x87, 0x44, 0x81, 0x02, 0x83, 0x44, 0x83, 0x00, 0x44, 0x86,
+    0x02, 0x89, 0x44, 0x86, 0x06, 0x88, 0x44, 0x03, 0x81, 0x44, 0x84, 0x82, 0x44, 0x84, 0x02, 0x8E,
+    0x43, 0x8E, 0x07, 0x89, 0x44, 0x04, 0x44, 0x95, 0x44, 0x81, 0x01, 0x81, 0x44, 0x8A, 0x07, 0x8A,
+    0x43, 0x8E, 0x04, 0x44, 0x85, 0x86, 0x44, 0x02, 0x83, 0x44, 0x87, 0x07, 0x8B, 0x43, 0x8E, 0x04,
+    0x44, 0x84, 0x87, 0x44, 0x02, 0x84, 0x44, 0x86, 0x07, 0x8C, 0x43, 0x8D, 0x03, 0x81, 0x44, 0x83,
+    0x88, 0x43, 0x8E, 0x02, 0x84, 0x44, 0x86, 0x07, 0x44, 0x8C, 0x03, 0x83, 0x44, 0x81, 0x87, 0x44,
+    0x02, 0x83, 0x44, 0x87, 0x06, 0x82, 0x44, 0x8C, 0x03, 0x86, 0x43, 0x8D, 0x00, 0x86, 0x44, 0x02,
+    0x81, 0x44, 0x8A, 0x06, 0x87, 0x44, 0x8C, 0x03, 0x8B, 0x43, 0x89, 0x00, 0x85, 0x44, 0x82, 0x02,
+    0x8D, 0x44, 0x81, 0x05, 0x8E, 0x44, 0x8D, 0x02, 0x81, 0x44, 0x84, 0x00, 0x83, 0x44, 0x85, 0x02,
+    0x88, 0x44, 0x8B, 0x04, 0x8A, 0x46, 0x83, 0x01, 0x8A, 0x43, 0x8D, 0x02, 0x44, 0x89, 0x02, 0x81,
+    0x45, 0x8E, 0x89, 0x87, 0x89, 0x8E, 0x47, 0x8E, 0x88, 0x8B, 0x44, 0x85, 0x02, 0x8C, 0x43, 0x8E,
+    0x03, 0x86, 0x58, 0x8B, 0x03, 0x87, 0x44, 0x85, 0x03, 0x89, 0x4A, 0x8E, 0x82, 0x87, 0x48, 0x8D,
+    0x81, 0x03, 0x81, 0x44, 0x8D, 0x04, 0x86, 0x8E, 0x47, 0x8B, 0x81, 0x01, 0x8A, 0x46, 0x8B, 0x81,
+    0x05, 0x8A, 0x44, 0x88, 0x04, 0x81, 0x86, 0x8B, 0x8E, 0x41, 0x8D, 0x89, 0x84, 0x04, 0x85, 0x8B,
+    0x8E, 0x40, 0x8E, 0x8A, 0x84, 0x07, 0x82, 0x45, 0x85, 0x21, 0x88, 0x45, 0x87, 0x21, 0x8C, 0x45,
+    0x8B, 0x83, 0x0F, 0x83, 0x88, 0x89, 0x0C, 0x81, 0x8D, 0x46, 0x8C, 0x86, 0x83, 0x07, 0x81, 0x83,
+    0x86, 0x8A, 0x8E, 0x41, 0x8B, 0x0D, 0x81, 0x8C, 0x49, 0x8D, 0x8C, 0x9B, 0x9C, 0x8E, 0x46, 0x8B,
+    0x0F, 0x89, 0x56, 0x8B, 0x10, 0x83, 0x8C, 0x54, 0x8A, 0x12, 0x83, 0x8A, 0x4F, 0x8E, 0x89, 0x83,
+    0x16, 0x83, 0x87, 0x8A, 0x8C, 0x8E, 0x43, 0x8E, 0x8D, 0x8B, 0x88, 0x86, 0x82, 0x0C, 0x0B, 0x89,
+    0x48, 0x18, 0x8E, 0x48, 0x85, 0x16, 0x84, 0x49, 0x8B, 0x16, 0x8A, 0x4A, 0x81, 0x15, 0x4B, 0x86,
+    0x14, 0x85, 0x4B, 0x8C, 0x14, 0x8A, 0x45, 0x88, 0x45, 0x82, 0x13, 0x45, 0x8B, 0x83, 0x45, 0x87,
+    0x12, 0x86, 0x45, 0x86, 0x00, 0x8E, 0x44, 0x8D, 0x12, 0x8B, 0x45, 0x82, 0x00, 0x89, 0x45, 0x82,
+    0x10, 0x81, 0x45, 0x8D, 0x01, 0x85, 0x45, 0x88, 0x10, 0x86, 0x45, 0x88, 0x02, 0x45, 0x8E, 0x10,
+    0x8C, 0x45, 0x83, 0x02, 0x8B, 0x45, 0x83, 0x0E, 0x82, 0x45, 0x8E, 0x03, 0x86, 0x45, 0x89, 0x0E,
+    0x87, 0x45, 0x8A, 0x03, 0x81, 0x45, 0x8E, 0x0E, 0x8D, 0x45, 0x85, 0x04, 0x8C, 0x45, 0x84, 0x0C,
+    0x82, 0x46, 0x05, 0x87, 0x45, 0x8A, 0x0C, 0x88, 0x45, 0x8B, 0x05, 0x82, 0x46, 0x0C, 0x8E, 0x45,
+    0x86, 0x06, 0x8D, 0x45, 0x85, 0x0A, 0x83, 0x46, 0x81, 0x06, 0x88, 0x45, 0x8B, 0x0A, 0x89, 0x45,
+    0x8C, 0x07, 0x83, 0x46, 0x81, 0x09, 0x8E, 0x56, 0x86, 0x08, 0x84, 0x57, 0x8C, 0x08, 0x8A, 0x58,
+    0x81, 0x07, 0x59, 0x87, 0x06, 0x85, 0x59, 0x8C, 0x06, 0x8A, 0x5A, 0x82, 0x05, 0x46, 0x8C, 0xF5,
+    0xB5, 0x87, 0x46, 0x88, 0x04, 0x86, 0x46, 0x86, 0x0C, 0x8E, 0x45, 0x8D, 0x04, 0x8B, 0x46, 0x81,
+    0x0C, 0x89, 0x46, 0x83, 0x02, 0x81, 0x46, 0x8C, 0x0D, 0x84, 0x46, 0x89, 0x02, 0x86, 0x46, 0x88,
+    0x0E, 0x46, 0x8E, 0x02, 0x8C, 0x46, 0x83, 0x0E, 0x8B, 0x46, 0x84, 0x00, 0x82, 0x46, 0x8E, 0x0F,
+    0x86, 0x46, 0x89, 0x00, 0x87, 0x46, 0x89, 0x0F, 0x81, 0x47, 0x00, 0x8D, 0x46, 0x84, 0x10, 0x8C,
+    0x46, 0x85, 0x88, 0x4C, 0x8E, 0x8D, 0x8B, 0x89, 0x86, 0x82, 0x06, 0x88, 0x52, 0x8D, 0x86, 0x04,
+    0x88, 0x54, 0x8D, 0x82, 0x02, 0x88, 0x56, 0x83, 0x01, 0x88, 0x56, 0x8D, 0x01, 0x88, 0x57, 0x86,
+    0x00, 0x88, 0x46, 0x84, 0xB3, 0x84, 0x86, 0x89, 0x8E, 0x47, 0x8B, 0x00, 0x88, 0x46, 0x81, 0x07,
+    0x8A, 0x46, 0x8E, 0x00, 0x88, 0x46, 0x81, 0x08, 0x47, 0x00, 0x88, 0x46, 0x81, 0x08, 0x8C, 0x46,
+    0x00, 0x88, 0x46, 0x81, 0x08, 0x8C, 0x45, 0x8E, 0x00, 0x88, 0x46, 0x81, 0x08, 0x8E, 0x45, 0x8B,
+    0x00, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x86, 0x00, 0x88, 0x46, 0x81, 0x04, 0x82, 0x85, 0x8B,
+    0x46, 0x8E, 0x01, 0x88, 0x56, 0x84, 0x01, 0x88, 0x54, 0x8E, 0x84, 0x02, 0x88, 0x52, 0x8D, 0x85,
+    0x04, 0x88, 0x53, 0x8D, 0x87, 0x81, 0x02, 0x88, 0x55, 0x8E, 0x84, 0x01, 0x88, 0x57, 0x83, 0x00,
+    0x88, 0x46, 0x81, 0x04, 0x81, 0x84, 0x8A, 0x47, 0x8D, 0x00, 0x88, 0x46, 0x81, 0x07, 0x83, 0x8E,
+    0x46, 0x85, 0x88, 0x46, 0x81, 0x08, 0x86, 0x46, 0x89, 0x88, 0x46, 0x81, 0x09, 0x46, 0x8C, 0x88,
+    0x46, 0x81, 0x09, 0x8E, 0x45, 0x8E, 0x88, 0x46, 0x81, 0x09, 0x46, 0x8E, 0x88, 0x46, 0x81, 0x08,
+    0x82, 0x46, 0x8D, 0x88, 0x46, 0x81, 0x08, 0x89, 0x46, 0x8B, 0x88, 0x46, 0x81, 0x07, 0x87, 0x47,
+    0x87, 0x88, 0x46, 0xD4, 0x85, 0x88, 0x8D, 0x48, 0x82, 0x88, 0x57, 0x8A, 0x00, 0x88, 0x56, 0x8E,
+    0x81, 0x00, 0x88, 0x55, 0x8E, 0x83, 0x01, 0x88, 0x54, 0x8C, 0x82, 0x02, 0x88, 0x52, 0x8D, 0x86,
+    0x04, 0x88, 0x4D, 0x8E, 0x8D, 0x8A, 0x87, 0x83, 0x06, 0x0B, 0x85, 0x88, 0x8B, 0x8D, 0x8E, 0x41,
+    0x8E, 0x8C, 0x89, 0x86, 0x82, 0x0D, 0x82, 0x8A, 0x4C, 0x8E, 0x88, 0x82, 0x09, 0x89, 0x51, 0x8B,
+    0x06, 0x83, 0x8E, 0x52, 0x8B, 0x05, 0x84, 0x54, 0x85, 0x04, 0x82, 0x54, 0x8E, 0x05, 0x8D, 0x48,
+    0x8D, 0x88, 0x86, 0x95, 0x87, 0x8B, 0x44, 0x88, 0x04, 0x87, 0x47, 0x8E, 0x84, 0x07, 0x85, 0x8C,
+    0x41, 0x82, 0x03, 0x81, 0x47, 0x8D, 0x81, 0x0A, 0x82, 0x86, 0x04, 0x87, 0x46, 0x8E, 0x81, 0x12,
+    0x8E, 0x46, 0x86, 0x12, 0x83, 0x46, 0x8D, 0x13, 0x87, 0x46, 0x88, 0x13, 0x8A, 0x46, 0x83, 0x13,
+    0x8D, 0x46, 0x14, 0x46, 0x8D, 0x14, 0x46, 0x8C, 0x13, 0x81, 0x46, 0x8B, 0x13, 0x81, 0x46, 0x8B,
+    0x14, 0x46, 0x8C, 0x14, 0x46, 0x8C, 0x14, 0x8E, 0x46, 0x14, 0x8C, 0x46, 0x81, 0x13, 0x89, 0x46,
+    0x85, 0x13, 0x86, 0x46, 0x8B, 0x13, 0x81, 0x47, 0x82, 0x13, 0x8C, 0x46, 0x8B, 0x13, 0x86, 0x47,
+    0x89, 0x13, 0x8E, 0x47, 0x8B, 0x82, 0x08, 0x82, 0x87, 0x9C, 0x04, 0x85, 0x49, 0x8C, 0x88, 0x86,
+    0x95, 0x86, 0x88, 0x8B, 0x8E, 0x42, 0x8C, 0x05, 0x8A, 0x54, 0x8C, 0x06, 0x8C, 0x53, 0x8C, 0x07,
+    0x8B, 0x52, 0x8C, 0x08, 0x87, 0x51, 0x8C, 0x09, 0x82, 0x89, 0x4E, 0x89, 0x83, 0x0C, 0x84, 0x88,
+    0x8B, 0x8D, 0x42, 0x9E, 0x8C, 0x8A, 0x87, 0x83, 0x04, 0x88, 0x4B, 0x8E, 0x8D, 0x8B, 0x89, 0x86,
+    0x81, 0x0B, 0x88, 0x51, 0x8C, 0x86, 0x09, 0x88, 0x53, 0x8E, 0x86, 0x07, 0x88, 0x55, 0x8C, 0x81,
+    0x05, 0x88, 0x56, 0x8E, 0x82, 0x04, 0x88, 0x57, 0x8E, 0x82, 0x03, 0x88, 0x46, 0x84, 0xB3, 0x85,
+    0x86, 0x8A, 0x8E, 0x48, 0x8D, 0x03, 0x88, 0x46, 0x81, 0x07, 0x87, 0x8E, 0x47, 0x88, 0x02, 0x88,
+    0x46, 0x81, 0x08, 0x82, 0x8D, 0x47, 0x82, 0x01, 0x88, 0x46, 0x81, 0x09, 0x81, 0x8E, 0x46, 0x89,
+    0x01, 0x88, 0x46, 0x81, 0x0A, 0x85, 0x47, 0x01, 0x88, 0x46, 0x81, 0x0B, 0x8E, 0x46, 0x84, 0x00,
+    0x88, 0x46, 0x81, 0x0B, 0x87, 0x46, 0x88, 0x00, 0x88, 0x46, 0x81, 0x0B, 0x83, 0x46, 0x8C, 0x00,
+    0x88, 0x46, 0x81, 0x0C, 0x46, 0x8E, 0x00, 0x88, 0x46, 0x81, 0x0C, 0x8E, 0x46, 0x00, 0x88, 0x46,
+    0x81, 0x0C, 0x8D, 0x46, 0x81, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x46, 0x81, 0x88, 0x46, 0x81, 0x0C,
+    0x8C, 0x46, 0x81, 0x88, 0x46, 0x81, 0x0C, 0x8D, 0x46, 0x00, 0x88, 0x46, 0x81, 0x0C, 0x8E, 0x46,
+    0x00, 0x88, 0x46, 0x81, 0x0B, 0x81, 0x46, 0x8D, 0x00, 0x88, 0x46, 0x81, 0x0B, 0x85, 0x46, 0x8A,
+    0x00, 0x88, 0x46, 0x81, 0x0B, 0x89, 0x46, 0x87, 0x00, 0x88, 0x46, 0x81, 0x0A, 0x81, 0x47, 0x82,
+    0x00, 0x88, 0x46, 0x81, 0x0A, 0x89, 0x46, 0x8D, 0x01, 0x88, 0x46, 0x81, 0x09, 0x84, 0x47, 0x86,
+    0x01, 0x88, 0x46, 0x81, 0x08, 0x85, 0x47, 0x8E, 0x02, 0x88, 0x46, 0x81, 0x06, 0x83, 0x8A, 0x48,
+    0x85, 0x02, 0x88, 0x46, 0xB4, 0x85, 0x86, 0x89, 0x8D, 0x49, 0x8A, 0x03, 0x88, 0x57, 0x8C, 0x04,
+    0x88, 0x56, 0x8C, 0x81, 0x04, 0x88, 0x55, 0x88, 0x06, 0x88, 0x53, 0x8C, 0x83, 0x07, 0x88, 0x50,
+    0x8E, 0x89, 0x83, 0x09, 0x88, 0x4B, 0x8D, 0x8C, 0x8A, 0x87, 0x83, 0x0C, 0x88, 0x53, 0x00, 0x88,
+    0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x46,
+    0x84, 0xF3, 0xB3, 0x00, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C,
+    0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C,
+    0x88, 0x52, 0x82, 0x00, 0x88, 0x52, 0x82, 0x00, 0x88, 0x52, 0x82, 0x00, 0x88, 0x52, 0x82, 0x00,
+    0x88, 0x52, 0x82, 0x00, 0x88, 0x52, 0x82, 0x00, 0x88, 0x46, 0x84, 0xF3, 0xA3, 0x01, 0x88, 0x46,
+    0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46,
+    0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46,
+    0xF4, 0xC4, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88,
+    0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x88, 0x53, 0x88, 0x53, 0x88, 0x53, 0x88, 0x53, 0x88,
+    0x53, 0x88, 0x46, 0xF3, 0xC3, 0x88, 0x46, 0x0C, 0x88, 0x46, 0x0C, 0x88, 0x46, 0x0C, 0x88, 0x46,
+    0x0C, 0x88, 0x46, 0x0C, 0x88, 0x46, 0x0C, 0x88, 0x46, 0x0C, 0x88, 0x46, 0x0C, 0x88, 0x46, 0x0C,
+    0x88, 0x52, 0x00, 0x88, 0x52, 0x00, 0x88, 0x52, 0x00, 0x88, 0x52, 0x00, 0x88, 0x52, 0x00, 0x88,
+    0x52, 0x00, 0x88, 0x46, 0xF2, 0xB2, 0x00, 0x88, 0x46, 0x0C, 0x88, 0x46, 0x0C, 0x88, 0x46, 0x0C,
+    0x88, 0x46, 0x0C, 0x88, 0x46, 0x0C, 0x88, 0x46, 0x0C, 0x88, 0x46, 0x0C, 0x88, 0x46, 0x0C, 0x88,
+    0x46, 0x0C, 0x88, 0x46, 0x0C, 0x88, 0x46, 0x0C, 0x88, 0x46, 0x0C, 0x88, 0x46, 0x0C, 0x0C, 0x85,
+    0x88, 0x8B, 0x8D, 0x8E, 0x42, 0x8E, 0x8D, 0x8A, 0x88, 0x84, 0x0E, 0x84, 0x8B, 0x4E, 0x8C, 0x86,
+    0x81, 0x08, 0x84, 0x8D, 0x52, 0x8E, 0x07, 0x89, 0x54, 0x89, 0x05, 0x81, 0x8C, 0x55, 0x83, 0x05,
+    0x8C, 0x55, 0x8C, 0x05, 0x8A, 0x4A, 0x8B, 0x87, 0x86, 0x95, 0x86, 0x89, 0x8C, 0x43, 0x85, 0x04,
+    0x86, 0x48, 0x8E, 0x86, 0x08, 0x81, 0x85, 0x8C, 0x8E, 0x05, 0x8E, 0x47, 0x8B, 0x0D, 0x81, 0x04,
+    0x87, 0x47, 0x8A, 0x14, 0x8D, 0x46, 0x8D, 0x14, 0x83, 0x47, 0x83, 0x14, 0x87, 0x46, 0x8C, 0x15,
+    0x8B, 0x46, 0x85, 0x15, 0x8D, 0x46, 0x81, 0x15, 0x46, 0x8E, 0x16, 0x46, 0x8C, 0x06, 0x4D, 0x83,
+    0x81, 0x46, 0x8B, 0x06, 0x4D, 0x83, 0x81, 0x46, 0x8B, 0x06, 0x4D, 0x83, 0x00, 0x46, 0x8C, 0x06,
+    0x4D, 0x83, 0x00, 0x46, 0x8D, 0x06, 0x4D, 0x83, 0x00, 0x8E, 0x46, 0x06, 0x4D, 0x83, 0x00, 0x8C,
+    0x46, 0x82, 0x05, 0xD4, 0x86, 0x46, 0x83, 0x00, 0x89, 0x46, 0x86, 0x0B, 0x83, 0x46, 0x83, 0x00,
+    0x85, 0x46, 0x8C, 0x0B, 0x83, 0x46, 0x83, 0x00, 0x81, 0x47, 0x84, 0x0A, 0x83, 0x46, 0x83, 0x01,
+    0x8B, 0x46, 0x8D, 0x0A, 0x83, 0x46, 0x83, 0x01, 0x85, 0x47, 0x8C, 0x09, 0x83, 0x46, 0x83, 0x02,
+    0x8D, 0x47, 0x8D, 0x85, 0x07, 0x83, 0x46, 0x83, 0x02, 0x83, 0x49, 0x8E, 0x89, 0x86, 0xA5, 0x87,
+    0x89, 0x8C, 0x46, 0x83, 0x03, 0x88, 0x58, 0x83, 0x04, 0x8A, 0x57, 0x83, 0x05, 0x89, 0x56, 0x83,
+    0x06, 0x85, 0x8E, 0x54, 0x83, 0x08, 0x87, 0x8D, 0x4F, 0x8C, 0x87, 0x82, 0x0B, 0x83, 0x87, 0x8A,
+    0x8C, 0x8E, 0x42, 0x9E, 0x8C, 0x8A, 0x89, 0x86, 0x83, 0x04, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45,
+    0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88,
+    0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81,
+    0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C,
+    0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B,
+    0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46,
+    0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x5B, 0x8B, 0x88,
+    0x5B, 0x8B, 0x88, 0x5B, 0x8B, 0x88, 0x5B, 0x8B, 0x88, 0x5B, 0x8B, 0x88, 0x5B, 0x8B, 0x88, 0x46,
+    0x85, 0xF4, 0xC4, 0x8D, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81,
+    0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C,
+    0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B,
+    0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46,
+    0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C,
+    0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45,
+    0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88, 0x46, 0x81, 0x0C, 0x8C, 0x45, 0x8B, 0x88,
+    0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46,
+    0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81,
+    0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88,
+    0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46,
+    0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81,
+    0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88,
+    0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07,
+    0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07,
+    0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07,
+    0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07,
+    0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07,
+    0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07,
+    0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07,
+    0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07,
+    0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x07,
+    0x88, 0x46, 0x08, 0x88, 0x46, 0x08, 0x8A, 0x45, 0x8E, 0x08, 0x8E, 0x45, 0x8D, 0x07, 0x84, 0x46,
+    0x89, 0x06, 0x81, 0x8D, 0x46, 0x86, 0x00, 0x88, 0x89, 0x87, 0x85, 0x86, 0x89, 0x48, 0x81, 0x00,
+    0x8B, 0x4C, 0x8A, 0x01, 0x8B, 0x4C, 0x81, 0x01, 0x8B, 0x4B, 0x85, 0x02, 0x8B, 0x4A, 0x86, 0x03,
+    0x8B, 0x48, 0x8B, 0x83, 0x04, 0x86, 0x8B, 0x8D, 0x8E, 0x41, 0x8D, 0x8C, 0x88, 0x83, 0x06, 0x88,
+    0x46, 0x81, 0x0A, 0x8A, 0x46, 0x8B, 0x00, 0x88, 0x46, 0x81, 0x09, 0x87, 0x46, 0x8D, 0x81, 0x00,
+    0x88, 0x46, 0x81, 0x08, 0x84, 0x47, 0x83, 0x01, 0x88, 0x46, 0x81, 0x07, 0x82, 0x8E, 0x46, 0x85,
+    0x02, 0x88, 0x46, 0x81, 0x07, 0x8C, 0x46, 0x89, 0x03, 0x88, 0x46, 0x81, 0x06, 0x8A, 0x46, 0x8C,
+    0x04, 0x88, 0x46, 0x81, 0x05, 0x86, 0x46, 0x8E, 0x81, 0x04, 0x88, 0x46, 0x81, 0x04, 0x83, 0x47,
+    0x84, 0x05, 0x88, 0x46, 0x81, 0x03, 0x81, 0x8E, 0x46, 0x87, 0x06, 0x88, 0x46, 0x81, 0x03, 0x8C,
+    0x46, 0x8A, 0x07, 0x88, 0x46, 0x81, 0x02, 0x89, 0x46, 0x8D, 0x08, 0x88, 0x46, 0x81, 0x01, 0x85,
+    0x47, 0x82, 0x08, 0x88, 0x46, 0x81, 0x00, 0x82, 0x47, 0x85, 0x09, 0x88, 0x46, 0x81, 0x00, 0x8D,
+    0x46, 0x88, 0x0A, 0x88, 0x46, 0x81, 0x88, 0x46, 0x8C, 0x0B, 0x88, 0x46, 0x85, 0x46, 0x8E, 0x81,
+    0x0B, 0x88, 0x46, 0x8E, 0x46, 0x8E, 0x81, 0x0B, 0x88, 0x4F, 0x8A, 0x0B, 0x88, 0x50, 0x84, 0x0A,
+    0x88, 0x50, 0x8D, 0x0A, 0x88, 0x51, 0x88, 0x09, 0x88, 0x47, 0x8E, 0x85, 0x84, 0x47, 0x82, 0x08,
+    0x88, 0x46, 0x8C, 0x81, 0x01, 0x8A, 0x46, 0x8C, 0x08, 0x88, 0x46, 0x81, 0x02, 0x81, 0x47, 0x86,
+    0x07, 0x88, 0x46, 0x81, 0x03, 0x87, 0x46, 0x8E, 0x81, 0x06, 0x88, 0x46, 0x81, 0x04, 0x8D, 0x46,
+    0x8A, 0x06, 0x88, 0x46, 0x81, 0x04, 0x83, 0x47, 0x84, 0x05, 0x88, 0x46, 0x81, 0x05, 0x89, 0x46,
+    0x8D, 0x05, 0x88, 0x46, 0x81, 0x05, 0x81, 0x8E, 0x46, 0x88, 0x04, 0x88, 0x46, 0x81, 0x06, 0x86,
+    0x47, 0x82, 0x03, 0x88, 0x46, 0x81, 0x07, 0x8C, 0x46, 0x8C, 0x03, 0x88, 0x46, 0x81, 0x07, 0x82,
+    0x47, 0x86, 0x02, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x8E, 0x81, 0x01, 0x88, 0x46, 0x81, 0x09,
+    0x8E, 0x46, 0x8A, 0x01, 0x88, 0x46, 0x81, 0x09, 0x85, 0x47, 0x84, 0x00, 0x88, 0x46, 0x81, 0x0A,
+    0x8B, 0x46, 0x8D, 0x00, 0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D,
+    0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D,
+    0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D,
+    0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D,
+    0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D,
+    0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D,
+    0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D,
+    0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0x81, 0x0D, 0x88, 0x46, 0xF4, 0xD4, 0x82, 0x88, 0x54, 0x98,
+    0x54, 0x98, 0x54, 0x98, 0x54, 0x98, 0x54, 0x98, 0x54, 0x88, 0x88, 0x48, 0x8E, 0x10, 0x8D, 0x48,
+    0x8A, 0x88, 0x49, 0x84, 0x0E, 0x82, 0x49, 0x8A, 0x88, 0x49, 0x89, 0x0E, 0x87, 0x49, 0x8A, 0x88,
+    0x49, 0x8D, 0x0E, 0x8C, 0x49, 0x8A, 0x88, 0x4A, 0x82, 0x0C, 0x81, 0x4A, 0x8A, 0x88, 0x4A, 0x87,
+    0x0C, 0x87, 0x4A, 0x8A, 0x88, 0x4A, 0x8C, 0x0C, 0x8C, 0x4A, 0x8A, 0x88, 0x4B, 0x81, 0x0A, 0x81,
+    0x4B, 0x8A, 0x88, 0x44, 0x8D, 0x8C, 0x44, 0x86, 0x0A, 0x86, 0x44, 0x89, 0x45, 0x8A, 0x88, 0x44,
+    0x8E, 0x87, 0x44, 0x8B, 0x0A, 0x8B, 0x44, 0x84, 0x45, 0x8A, 0x88, 0x44, 0x8E, 0x82, 0x45, 0x09,
+    0x81, 0x44, 0x8D, 0x82, 0x45, 0x8A, 0x88, 0x45, 0x00, 0x8D, 0x44, 0x85, 0x08, 0x86, 0x44, 0x88,
+    0x83, 0x45, 0x8A, 0x88, 0x45, 0x00, 0x88, 0x44, 0x8A, 0x08, 0x8B, 0x44, 0x93, 0x45, 0x8A, 0x88,
+    0x45, 0x81, 0x83, 0x44, 0x8E, 0x07, 0x81, 0x44, 0x8E, 0x00, 0x84, 0x45, 0x8A, 0x88, 0x45, 0x81,
+    0x00, 0x8E, 0x44, 0x83, 0x06, 0x85, 0x44, 0x88, 0x00, 0x85, 0x45, 0x8A, 0x88, 0x45, 0x82, 0x00,
+    0x8A, 0x44, 0x88, 0x06, 0x8B, 0x44, 0x83, 0x00, 0x85, 0x45, 0x8A, 0x88, 0x45, 0x83, 0x00, 0x85,
+    0x44, 0x8D, 0x06, 0x44, 0x8E, 0x01, 0x86, 0x45, 0x8A, 0x88, 0x45, 0x83, 0x01, 0x45, 0x82, 0x04,
+    0x85, 0x44, 0x89, 0x01, 0x86, 0x45, 0x8A, 0x88, 0x45, 0x83, 0x01, 0x8B, 0x44, 0x87, 0x04, 0x8A,
+    0x44, 0x84, 0x01, 0x86, 0x45, 0x8A, 0x88, 0x45, 0x83, 0x01, 0x86, 0x44, 0x8C, 0x04, 0x44, 0x8E,
+    0x02, 0x86, 0x45, 0x8A, 0x88, 0x45, 0x84, 0x01, 0x81, 0x45, 0x81, 0x02, 0x85, 0x44, 0x89, 0x02,
+    0x86, 0x45, 0x8A, 0x88, 0x45, 0x84, 0x02, 0x8C, 0x44, 0x86, 0x02, 0x8A, 0x44, 0x84, 0x02, 0x86,
+    0x45, 0x8A, 0x88, 0x45, 0x84, 0x02, 0x88, 0x44, 0x8B, 0x02, 0x44, 0x8E, 0x03, 0x86, 0x45, 0x8A,
+    0x88, 0x45, 0x84, 0x02, 0x83, 0x45, 0x01, 0x84, 0x44, 0x89, 0x03, 0x86, 0x45, 0x8A, 0x88, 0x45,
+    0x84, 0x03, 0x8E, 0x44, 0x85, 0x00, 0x8A, 0x44, 0x84, 0x03, 0x86, 0x45, 0x8A, 0x88, 0x45, 0x84,
+    0x03, 0x89, 0x44, 0x8A, 0x00, 0x8E, 0x44, 0x04, 0x86, 0x45, 0x8A, 0x88, 0x45, 0x84, 0x03, 0x84,
+    0x44, 0x8E, 0x84, 0x44, 0x8A, 0x04, 0x86, 0x45, 0x8A, 0x88, 0x45, 0x84, 0x04, 0x45, 0x8D, 0x44,
+    0x84, 0x04, 0x86, 0x45, 0x8A, 0x88, 0x45, 0x84, 0x04, 0x8A, 0x4A, 0x05, 0x86, 0x45, 0x8A, 0x88,
+    0x45, 0x84, 0x04, 0x85, 0x49, 0x8A, 0x05, 0x86, 0x45, 0x8A, 0x88, 0x45, 0x84, 0x04, 0x81, 0x49,
+    0x85, 0x05, 0x86, 0x45, 0x8A, 0x88, 0x45, 0x84, 0x05, 0x8C, 0x48, 0x06, 0x86, 0x45, 0x8A, 0x88,
+    0x45, 0x84, 0x05, 0x87, 0x47, 0x8A, 0x06, 0x86, 0x45, 0x8A, 0x88, 0x45, 0x84, 0x05, 0x82, 0x47,
+    0x85, 0x06, 0x86, 0x45, 0x8A, 0x88, 0x45, 0x84, 0x06, 0x8D, 0x46, 0x07, 0x86, 0x45, 0x8A, 0x88,
+    0x45, 0x84, 0x06, 0x88, 0x45, 0x8B, 0x07, 0x86, 0x45, 0x8A, 0x88, 0x48, 0x85, 0x0D, 0x8A, 0x45,
+    0x82, 0x88, 0x48, 0x8D, 0x0D, 0x8A, 0x45, 0x82, 0x88, 0x49, 0x87, 0x0C, 0x8A, 0x45, 0x82, 0x88,
+    0x4A, 0x81, 0x0B, 0x8A, 0x45, 0x82, 0x88, 0x4A, 0x89, 0x0B, 0x8A, 0x45, 0x82, 0x88, 0x4B, 0x83,
+    0x0A, 0x8A, 0x45, 0x82, 0x88, 0x4B, 0x8C, 0x0A, 0x8A, 0x45, 0x82, 0x88, 0x4C, 0x85, 0x09, 0x8A,
+    0x45, 0x82, 0x88, 0x4C, 0x8E, 0x09, 0x8A, 0x45, 0x82, 0x88, 0x44, 0x8D, 0x89, 0x46, 0x87, 0x08,
+    0x8A, 0x45, 0x82, 0x88, 0x44, 0x8E, 0x81, 0x8E, 0x46, 0x81, 0x07, 0x8A, 0x45, 0x82, 0x88, 0x45,
+    0x00, 0x86, 0x46, 0x8A, 0x07, 0x8A, 0x45, 0x82, 0x88, 0x45, 0x01, 0x8D, 0x46, 0x83, 0x06, 0x8A,
+    0x45, 0x82, 0x88, 0x45, 0x81, 0x00, 0x84, 0x46, 0x8C, 0x06, 0x8A, 0x45, 0x82, 0x88, 0x45, 0x81,
+    0x01, 0x8B, 0x46, 0x85, 0x05, 0x8A, 0x45, 0x82, 0x88, 0x45, 0x82, 0x01, 0x82, 0x46, 0x8E, 0x05,
+    0x8A, 0x45, 0x82, 0x88, 0x45, 0x83, 0x02, 0x89, 0x46, 0x88, 0x04, 0x8A, 0x45, 0x82, 0x88, 0x45,
+    0x83, 0x02, 0x81, 0x8E, 0x46, 0x82, 0x03, 0x8A, 0x45, 0x82, 0x88, 0x45, 0x83, 0x03, 0x87, 0x46,
+    0x8A, 0x03, 0x8A, 0x45, 0x82, 0x88, 0x45, 0x83, 0x04, 0x8D, 0x46, 0x83, 0x02, 0x89, 0x45, 0x82,
+    0x88, 0x45, 0x84, 0x04, 0x84, 0x46, 0x8D, 0x02, 0x89, 0x45, 0x82, 0x88, 0x45, 0x84, 0x05, 0x8B,
+    0x46, 0x86, 0x01, 0x88, 0x45, 0x82, 0x88, 0x45, 0x84, 0x05, 0x82, 0x46, 0x8E, 0x01, 0x88, 0x45,
+    0x82, 0x88, 0x45, 0x84, 0x06, 0x89, 0x46, 0x88, 0x00, 0x87, 0x45, 0x82, 0x88, 0x45, 0x84, 0x06,
+    0x81, 0x47, 0x82, 0x86, 0x45, 0x82, 0x88, 0x45, 0x84, 0x07, 0x87, 0x46, 0x8B, 0x85, 0x45, 0x82,
+    0x88, 0x45, 0x84, 0x08, 0x8D, 0x46, 0x89, 0x45, 0x82, 0x88, 0x45, 0x84, 0x08, 0x85, 0x4D, 0x82,
+    0x88, 0x45, 0x84, 0x09, 0x8B, 0x4C, 0x82, 0x88, 0x45, 0x84, 0x09, 0x82, 0x4C, 0x82, 0x88, 0x45,
+    0x84, 0x0A, 0x89, 0x4B, 0x82, 0x88, 0x45, 0x84, 0x0A, 0x81, 0x4B, 0x82, 0x88, 0x45, 0x84, 0x0B,
+    0x87, 0x4A, 0x82, 0x88, 0x45, 0x84, 0x0C, 0x8D, 0x49, 0x82, 0x88, 0x45, 0x84, 0x0C, 0x85, 0x49,
+    0x82, 0x88, 0x45, 0x84, 0x0D, 0x8C, 0x48, 0x82, 0x0A, 0x81, 0x86, 0x89, 0x8C, 0x8D, 0x43, 0x8D,
+    0x8B, 0x89, 0x85, 0x81, 0x12, 0x85, 0x8C, 0x4D, 0x8B, 0x84, 0x0E, 0x83, 0x8D, 0x51, 0x8B, 0x82,
+    0x0B, 0x87, 0x55, 0x85, 0x09, 0x88, 0x57, 0x86, 0x07, 0x87, 0x59, 0x84, 0x05, 0x83, 0x49, 0x8E,
+    0x89, 0x86, 0x95, 0x86, 0x89, 0x8E, 0x48, 0x8E, 0x81, 0x04, 0x8C, 0x47, 0x8E, 0x85, 0x07, 0x86,
+    0x8E, 0x47, 0x89, 0x03, 0x84, 0x47, 0x8D, 0x81, 0x09, 0x82, 0x8E, 0x47, 0x81, 0x02, 0x8B, 0x46,
+    0x8E, 0x81, 0x0B, 0x82, 0x47, 0x87, 0x01, 0x81, 0x47, 0x86, 0x0D, 0x88, 0x46, 0x8D, 0x01, 0x85,
+    0x46, 0x8E, 0x0E, 0x81, 0x47, 0x82, 0x00, 0x89, 0x46, 0x88, 0x0F, 0x8B, 0x46, 0x85, 0x00, 0x8C,
+    0x46, 0x84, 0x0F, 0x88, 0x46, 0x88, 0x00, 0x8E, 0x46, 0x81, 0x0F, 0x85, 0x46, 0x8A, 0x00, 0x47,
+    0x10, 0x82, 0x46, 0x8C, 0x00, 0x46, 0x8E, 0x10, 0x82, 0x46, 0x8D, 0x81, 0x46, 0x8D, 0x10, 0x81,
+    0x46, 0x8D, 0x81, 0x46, 0x8D, 0x10, 0x81, 0x46, 0x8D, 0x00, 0x46, 0x8E, 0x10, 0x82, 0x46, 0x8D,
+    0x00, 0x47, 0x10, 0x82, 0x46, 0x8C, 0x00, 0x8E, 0x46, 0x82, 0x0F, 0x85, 0x46, 0x8A, 0x00, 0x8B,
+    0x46, 0x84, 0x0F, 0x88, 0x46, 0x88, 0x00, 0x88, 0x46, 0x89, 0x0F, 0x8C, 0x46, 0x85, 0x00, 0x85,
+    0x46, 0x8E, 0x0E, 0x81, 0x47, 0x81, 0x01, 0x47, 0x85, 0x0D, 0x89, 0x46, 0x8D, 0x02, 0x8A, 0x46,
+    0x8E, 0x81, 0x0B, 0x83, 0x47, 0x87, 0x02, 0x84, 0x47, 0x8C, 0x81, 0x09, 0x82, 0x8E, 0x47, 0x81,
+    0x03, 0x8C, 0x47, 0x8E, 0x85, 0x07, 0x87, 0x48, 0x88, 0x04, 0x82, 0x49, 0x8E, 0x89, 0x87, 0x96,
+    0x87, 0x8A, 0x49, 0x8E, 0x06, 0x86, 0x59, 0x83, 0x07, 0x88, 0x57, 0x85, 0x09, 0x87, 0x54, 0x8E,
+    0x84, 0x0B, 0x83, 0x8C, 0x51, 0x8B, 0x82, 0x0E, 0x85, 0x8C, 0x4D, 0x8A, 0x83, 0x12, 0x81, 0x86,
+    0x89, 0x8C, 0x8E, 0x43, 0x8D, 0x8B, 0x88, 0x85, 0x81, 0x09, 0x88, 0x4B, 0x8E, 0x8D, 0x8B, 0x88,
+    0x84, 0x07, 0x88, 0x50, 0x8E, 0x89, 0x81, 0x04, 0x88, 0x52, 0x8E, 0x85, 0x03, 0x88, 0x54, 0x86,
+    0x02, 0x88, 0x55, 0x84, 0x01, 0x88, 0x55, 0x8D, 0x01, 0x88, 0x46, 0x84, 0xA3, 0x84, 0x86, 0x8A,
+    0x48, 0x85, 0x00, 0x88, 0x46, 0x81, 0x05, 0x82, 0x8D, 0x46, 0x8A, 0x00, 0x88, 0x46, 0x81, 0x06,
+    0x82, 0x46, 0x8E, 0x00, 0x88, 0x46, 0x81, 0x07, 0x8B, 0x46, 0x00, 0x88, 0x46, 0x81, 0x07, 0x88,
+    0x46, 0x81, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x07, 0x89, 0x46, 0x00,
+    0x88, 0x46, 0x81, 0x07, 0x8D, 0x46, 0x00, 0x88, 0x46, 0x81, 0x06, 0x86, 0x46, 0x8B, 0x00, 0x88,
+    0x46, 0x81, 0x05, 0x86, 0x47, 0x87, 0x00, 0x88, 0x46, 0x84, 0x93, 0x84, 0x85, 0x88, 0x8D, 0x48,
+    0x81, 0x00, 0x88, 0x55, 0x88, 0x01, 0x88, 0x54, 0x8D, 0x02, 0x88, 0x53, 0x8D, 0x81, 0x02, 0x88,
+    0x52, 0x8A, 0x81, 0x03, 0x88, 0x50, 0x8B, 0x84, 0x05, 0x88, 0x4A, 0x8E, 0x8D, 0x8C, 0x89, 0x86,
+    0x81, 0x07, 0x88, 0x46, 0x81, 0x10, 0x88, 0x46, 0x81, 0x10, 0x88, 0x46, 0x81, 0x10, 0x88, 0x46,
+    0x81, 0x10, 0x88, 0x46, 0x81, 0x10, 0x88, 0x46, 0x81, 0x10, 0x88, 0x46, 0x81, 0x10, 0x88, 0x46,
+    0x81, 0x10, 0x88, 0x46, 0x81, 0x10, 0x88, 0x46, 0x81, 0x10, 0x88, 0x46, 0x81, 0x10, 0x88, 0x46,
+    0x81, 0x10, 0x88, 0x46, 0x81, 0x10, 0x0A, 0x81, 0x86, 0x89, 0x8C, 0x8D, 0x43, 0x8D, 0x8B, 0x89,
+    0x85, 0x81, 0x12, 0x85, 0x8C, 0x4D, 0x8B, 0x84, 0x0E, 0x83, 0x8D, 0x51, 0x8B, 0x82, 0x0B, 0x87,
+    0x55, 0x85, 0x09, 0x88, 0x57, 0x86, 0x07, 0x87, 0x59, 0x84, 0x05, 0x83, 0x49, 0x8E, 0x89, 0x86,
+    0x95, 0x86, 0x89, 0x8E, 0x48, 0x8E, 0x81, 0x04, 0x8C, 0x47, 0x8E, 0x85, 0x07, 0x86, 0x8E, 0x47,
+    0x89, 0x03, 0x84, 0x47, 0x8D, 0x81, 0x09, 0x82, 0x8E, 0x47, 0x81, 0x02, 0x8B, 0x46, 0x8E, 0x81,
+    0x0B, 0x82, 0x47, 0x87, 0x01, 0x81, 0x47, 0x86, 0x0D, 0x88, 0x46, 0x8D, 0x01, 0x85, 0x46, 0x8E,
+    0x0E, 0x81, 0x47, 0x82, 0x00, 0x89, 0x46, 0x88, 0x0F, 0x8B, 0x46, 0x85, 0x00, 0x8C, 0x46, 0x84,
+    0x0F, 0x88, 0x46, 0x88, 0x00, 0x8E, 0x46, 0x81, 0x0F, 0x85, 0x46, 0x8A, 0x00, 0x47, 0x10, 0x82,
+    0x46, 0x8C, 0x00, 0x46, 0x8E, 0x10, 0x82, 0x46, 0x8D, 0x81, 0x46, 0x8D, 0x10, 0x81, 0x46, 0x8D,
+    0x81, 0x46, 0x8D, 0x10, 0x81, 0x46, 0x8D, 0x00, 0x46, 0x8E, 0x10, 0x82, 0x46, 0x8D, 0x00, 0x47,
+    0x10, 0x82, 0x46, 0x8C, 0x00, 0x8E, 0x46, 0x82, 0x0F, 0x85, 0x46, 0x8A, 0x00, 0x8B, 0x46, 0x84,
+    0x0F, 0x88, 0x46, 0x88, 0x00, 0x88, 0x46, 0x89, 0x0F, 0x8C, 0x46, 0x85, 0x00, 0x85, 0x46, 0x8E,
+    0x0E, 0x81, 0x47, 0x81, 0x01, 0x47, 0x85, 0x0D, 0x89, 0x46, 0x8C, 0x02, 0x8A, 0x46, 0x8E, 0x81,
+    0x0B, 0x83, 0x47, 0x87, 0x02, 0x84, 0x47, 0x8C, 0x81, 0x09, 0x82, 0x8E, 0x47, 0x81, 0x03, 0x8C,
+    0x47, 0x8E, 0x85, 0x07, 0x87, 0x48, 0x88, 0x04, 0x82, 0x49, 0x8E, 0x89, 0x87, 0x96, 0x87, 0x8A,
+    0x49, 0x8D, 0x06, 0x86, 0x59, 0x83, 0x07, 0x88, 0x57, 0x84, 0x09, 0x87, 0x54, 0x8E, 0x84, 0x0B,
+    0x83, 0x8D, 0x51, 0x8A, 0x81, 0x0E, 0x85, 0x8C, 0x4E, 0x86, 0x12, 0x81, 0x86, 0x89, 0x8C, 0x8E,
+    0x49, 0x8E, 0x82, 0x18, 0x82, 0x47, 0x8D, 0x81, 0x18, 0x85, 0x47, 0x8C, 0x19, 0x88, 0x47, 0x8B,
+    0x19, 0x8A, 0x47, 0x8A, 0x19, 0x8D, 0x47, 0x88, 0x18, 0x82, 0x8E, 0x47, 0x87, 0x18, 0x84, 0x48,
+    0x85, 0x18, 0x86, 0x48, 0x84, 0x88, 0x4A, 0x8E, 0x8D, 0x8C, 0x8A, 0x87, 0x83, 0x0B, 0x88, 0x50,
+    0x8E, 0x88, 0x81, 0x08, 0x88, 0x52, 0x8E, 0x86, 0x07, 0x88, 0x54, 0x87, 0x06, 0x88, 0x55, 0x85,
+    0x05, 0x88, 0x55, 0x8E, 0x05, 0x88, 0x46, 0x84, 0x93, 0x84, 0x85, 0x87, 0x8C, 0x48, 0x86, 0x04,
+    0x88, 0x46, 0x81, 0x05, 0x82, 0x8D, 0x46, 0x8B, 0x04, 0x88, 0x46, 0x81, 0x06, 0x82, 0x47, 0x04,
+    0x88, 0x46, 0x81, 0x07, 0x8B, 0x46, 0x04, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x82, 0x03, 0x88,
+    0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x03, 0x88, 0x46, 0x81, 0x07, 0x8B, 0x46, 0x04, 0x88, 0x46,
+    0x81, 0x06, 0x82, 0x46, 0x8C, 0x04, 0x88, 0x46, 0x81, 0x05, 0x81, 0x8C, 0x46, 0x86, 0x04, 0x88,
+    0x46, 0x81, 0x02, 0x82, 0x84, 0x89, 0x47, 0x8E, 0x05, 0x88, 0x55, 0x85, 0x05, 0x88, 0x54, 0x88,
+    0x06, 0x88, 0x53, 0x87, 0x07, 0x88, 0x51, 0x8C, 0x83, 0x08, 0x88, 0x50, 0x8C, 0x0A, 0x88, 0x51,
+    0x85, 0x09, 0x88, 0x46, 0x83, 0xA2, 0x8B, 0x45, 0x8E, 0x81, 0x08, 0x88, 0x46, 0x81, 0x02, 0x81,
+    0x46, 0x8A, 0x08, 0x88, 0x46, 0x81, 0x03, 0x87, 0x46, 0x84, 0x07, 0x88, 0x46, 0x81, 0x04, 0x8D,
+    0x45, 0x8E, 0x81, 0x06, 0x88, 0x46, 0x81, 0x04, 0x83, 0x46, 0x8A, 0x06, 0x88, 0x46, 0x81, 0x05,
+    0x89, 0x46, 0x84, 0x05, 0x88, 0x46, 0x81, 0x05, 0x81, 0x8E, 0x45, 0x8E, 0x81, 0x04, 0x88, 0x46,
+    0x81, 0x06, 0x86, 0x46, 0x8A, 0x04, 0x88, 0x46, 0x81, 0x07, 0x8C, 0x46, 0x84, 0x03, 0x88, 0x46,
+    0x81, 0x07, 0x82, 0x46, 0x8E, 0x81, 0x02, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x8A, 0x02, 0x88,
+    0x46, 0x81, 0x09, 0x8E, 0x46, 0x85, 0x01, 0x88, 0x46, 0x81, 0x09, 0x85, 0x46, 0x8E, 0x81, 0x00,
+    0x88, 0x46, 0x81, 0x0A, 0x8B, 0x46, 0x8A, 0x00, 0x06, 0x83, 0x87, 0x8B, 0x8D, 0x8E, 0x41, 0x8E,
+    0x8D, 0x8A, 0x87, 0x83, 0x09, 0x85, 0x8D, 0x4B, 0x8E, 0x89, 0x83, 0x04, 0x81, 0x8B, 0x50, 0x8D,
+    0x82, 0x01, 0x81, 0x8C, 0x52, 0x02, 0x8B, 0x52, 0x89, 0x01, 0x84, 0x53, 0x82, 0x01, 0x8B, 0x47,
+    0x8A, 0x86, 0x95, 0x87, 0x8A, 0x8D, 0x43, 0x8B, 0x02, 0x46, 0x8E, 0x82, 0x06, 0x82, 0x87, 0x8D,
+    0x40, 0x85, 0x01, 0x82, 0x46, 0x86, 0x0A, 0x83, 0x02, 0x83, 0x46, 0x82, 0x0E, 0x84, 0x46, 0x83,
+    0x0E, 0x82, 0x46, 0x89, 0x0F, 0x47, 0x88, 0x0E, 0x8A, 0x47, 0x8D, 0x84, 0x0C, 0x83, 0x49, 0x8C,
+    0x84, 0x0B, 0x88, 0x4A, 0x8D, 0x85, 0x0A, 0x8B, 0x4B, 0x8D, 0x84, 0x09, 0x8A, 0x4C, 0x8A, 0x81,
+    0x08, 0x86, 0x8E, 0x4B, 0x8E, 0x83, 0x08, 0x81, 0x88, 0x4C, 0x84, 0x09, 0x81, 0x88, 0x4A, 0x8E,
+    0x81, 0x0B, 0x87, 0x8E, 0x48, 0x89, 0x0D, 0x88, 0x48, 0x81, 0x0D, 0x84, 0x47, 0x84, 0x0E, 0x85,
+    0x46, 0x87, 0x0F, 0x46, 0x88, 0x0F, 0x8E, 0x45, 0x87, 0x9A, 0x83, 0x0B, 0x82, 0x46, 0x86, 0x8B,
+    0x41, 0x8D, 0x87, 0x82, 0x07, 0x81, 0x8C, 0x46, 0x82, 0x8B, 0x44, 0x8E, 0x8A, 0x87, 0x85, 0x94,
+    0x85, 0x89, 0x8E, 0x46, 0x8D, 0x00, 0x8B, 0x54, 0x86, 0x00, 0x8B, 0x53, 0x8B, 0x01, 0x8B, 0x52,
+    0x8C, 0x02, 0x8A, 0x51, 0x89, 0x04, 0x85, 0x8B, 0x4D, 0x8B, 0x83, 0x08, 0x85, 0x88, 0x8B, 0x8D,
+    0x8E, 0x42, 0x8E, 0x8C, 0x89, 0x86, 0x81, 0x06, 0x7F, 0x7F, 0x61, 0xF4, 0x84, 0x88, 0x46, 0x87,
+    0xF4, 0x84, 0x08, 0x85, 0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85,
+    0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85,
+    0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85,
+    0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85,
+    0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85,
+    0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85,
+    0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x11, 0x85,
+    0x46, 0x84, 0x11, 0x85, 0x46, 0x84, 0x08, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C,
+    0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C,
+    0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46,
+    0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C,
+    0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C,
+    0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46,
+    0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C,
+    0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C,
+    0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8B, 0x45, 0x8D, 0x0D, 0x46,
+    0x88, 0x8B, 0x45, 0x8E, 0x0C, 0x81, 0x46, 0x88, 0x89, 0x46, 0x81, 0x0B, 0x84, 0x46, 0x87, 0x88,
+    0x46, 0x84, 0x0B, 0x88, 0x46, 0x85, 0x84, 0x46, 0x8A, 0x0B, 0x8E, 0x46, 0x82, 0x00, 0x47, 0x84,
+    0x09, 0x88, 0x46, 0x8D, 0x01, 0x8B, 0x47, 0x86, 0x07, 0x89, 0x47, 0x87, 0x01, 0x82, 0x48, 0x8E,
+    0x89, 0x87, 0x85, 0x86, 0x87, 0x8A, 0x48, 0x8E, 0x03, 0x89, 0x57, 0x85, 0x04, 0x8C, 0x55, 0x88,
+    0x05, 0x81, 0x8C, 0x53, 0x88, 0x08, 0x88, 0x50, 0x8E, 0x85, 0x0A, 0x82, 0x89, 0x4C, 0x8D, 0x87,
+    0x0E, 0x81, 0x85, 0x88, 0x8C, 0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x87, 0x83, 0x08, 0x8D, 0x45,
+    0x8C, 0x0F, 0x84, 0x46, 0x85, 0x87, 0x46, 0x81, 0x0E, 0x89, 0x46, 0x00, 0x82, 0x46, 0x86, 0x0E,
+    0x8E, 0x45, 0x8A, 0x01, 0x8D, 0x45, 0x8B, 0x0D, 0x83, 0x46, 0x85, 0x01, 0x87, 0x46, 0x81, 0x0C,
+    0x88, 0x46, 0x02, 0x82, 0x46, 0x85, 0x0C, 0x8D, 0x45, 0x8A, 0x03, 0x8D, 0x45, 0x8A, 0x0B, 0x83,
+    0x46, 0x84, 0x03, 0x87, 0x46, 0x0B, 0x88, 0x46, 0x04, 0x82, 0x46, 0x84, 0x0A, 0x8D, 0x45, 0x8A,
+    0x05, 0x8C, 0x45, 0x89, 0x09, 0x82, 0x46, 0x84, 0x05, 0x87, 0x45, 0x8E, 0x09, 0x87, 0x45, 0x8E,
+    0x06, 0x82, 0x46, 0x83, 0x08, 0x8C, 0x45, 0x89, 0x07, 0x8C, 0x45, 0x88, 0x07, 0x81, 0x46, 0x84,
+    0x07, 0x87, 0x45, 0x8D, 0x07, 0x86, 0x45, 0x8E, 0x08, 0x82, 0x46, 0x82, 0x06, 0x8B, 0x45, 0x89,
+    0x09, 0x8C, 0x45, 0x87, 0x06, 0x46, 0x84, 0x09, 0x87, 0x45, 0x8C, 0x05, 0x85, 0x45, 0x8E, 0x0A,
+    0x81, 0x46, 0x81, 0x04, 0x8A, 0x45, 0x89, 0x0B, 0x8C, 0x45, 0x86, 0x04, 0x46, 0x84, 0x0B, 0x87,
+    0x45, 0x8B, 0x03, 0x84, 0x45, 0x8E, 0x0C, 0x81, 0x46, 0x81, 0x02, 0x89, 0x45, 0x89, 0x0D, 0x8C,
+    0x45, 0x85, 0x02, 0x8E, 0x45, 0x83, 0x0D, 0x86, 0x45, 0x8A, 0x01, 0x82, 0x45, 0x8E, 0x0E, 0x81,
+    0x45, 0x8E, 0x01, 0x87, 0x45, 0x89, 0x0F, 0x8C, 0x45, 0x82, 0x00, 0x8B, 0x45, 0x83, 0x0F, 0x86,
+    0x45, 0x86, 0x00, 0x45, 0x8E, 0x10, 0x81, 0x45, 0x8A, 0x83, 0x45, 0x88, 0x11, 0x8C, 0x44, 0x8E,
+    0x86, 0x45, 0x83, 0x11, 0x86, 0x45, 0x8B, 0x44, 0x8E, 0x12, 0x81, 0x4B, 0x88, 0x13, 0x8B, 0x4A,
+    0x83, 0x13, 0x86, 0x49, 0x8D, 0x14, 0x81, 0x49, 0x88, 0x15, 0x8B, 0x48, 0x83, 0x15, 0x86, 0x47,
+    0x8D, 0x16, 0x81, 0x47, 0x88, 0x0B, 0x8E, 0x45, 0x89, 0x0B, 0x88, 0x45, 0x8E, 0x0B, 0x83, 0x46,
+    0x83, 0x89, 0x45, 0x8C, 0x0B, 0x8C, 0x46, 0x82, 0x0A, 0x87, 0x46, 0x00, 0x85, 0x46, 0x0B, 0x47,
+    0x86, 0x0A, 0x8B, 0x45, 0x8B, 0x00, 0x81, 0x46, 0x84, 0x09, 0x84, 0x47, 0x8A, 0x0A, 0x8E, 0x45,
+    0x87, 0x01, 0x8D, 0x45, 0x87, 0x09, 0x88, 0x47, 0x8E, 0x09, 0x82, 0x46, 0x83, 0x01, 0x89, 0x45,
+    0x8B, 0x09, 0x8C, 0x48, 0x82, 0x08, 0x86, 0x46, 0x02, 0x85, 0x46, 0x08, 0x81, 0x49, 0x86, 0x08,
+    0x89, 0x45, 0x8B, 0x02, 0x81, 0x46, 0x83, 0x07, 0x85, 0x49, 0x8B, 0x08, 0x8D, 0x45, 0x87, 0x03,
+    0x8D, 0x45, 0x86, 0x07, 0x89, 0x49, 0x8E, 0x07, 0x81, 0x46, 0x83, 0x03, 0x89, 0x45, 0x8A, 0x07,
+    0x8D, 0x44, 0x8C, 0x44, 0x83, 0x06, 0x84, 0x45, 0x8E, 0x04, 0x85, 0x45, 0x8E, 0x06, 0x81, 0x44,
+    0x8D, 0x89, 0x44, 0x87, 0x06, 0x88, 0x45, 0x8B, 0x04, 0x81, 0x46, 0x81, 0x05, 0x85, 0x44, 0x8A,
+    0x86, 0x44, 0x8B, 0x06, 0x8C, 0x45, 0x87, 0x05, 0x8D, 0x45, 0x85, 0x05, 0x89, 0x44, 0x87, 0x83,
+    0x45, 0x06, 0x46, 0x83, 0x05, 0x89, 0x45, 0x89, 0x05, 0x8D, 0x44, 0x84, 0x00, 0x45, 0x83, 0x04,
+    0x83, 0x45, 0x8E, 0x06, 0x85, 0x45, 0x8C, 0x04, 0x81, 0x45, 0x81, 0x00, 0x8C, 0x44, 0x87, 0x04,
+    0x87, 0x45, 0x8A, 0x06, 0x81, 0x46, 0x04, 0x86, 0x44, 0x8D, 0x01, 0x89, 0x44, 0x8B, 0x04, 0x8B,
+    0x45, 0x86, 0x07, 0x8D, 0x45, 0x84, 0x03, 0x8A, 0x44, 0x8A, 0x01, 0x85, 0x45, 0x04, 0x8E, 0x45,
+    0x82, 0x07, 0x89, 0x45, 0x88, 0x03, 0x8E, 0x44, 0x86, 0x01, 0x81, 0x45, 0x84, 0x02, 0x82, 0x45,
+    0x8E, 0x08, 0x85, 0x45, 0x8B, 0x02, 0x82, 0x45, 0x82, 0x02, 0x8D, 0x44, 0x88, 0x02, 0x86, 0x45,
+    0x8A, 0x08, 0x81, 0x46, 0x02, 0x86, 0x44, 0x8E, 0x03, 0x89, 0x44, 0x8C, 0x02, 0x89, 0x45, 0x86,
+    0x09, 0x8D, 0x45, 0x82, 0x01, 0x8A, 0x44, 0x8A, 0x03, 0x85, 0x45, 0x02, 0x8D, 0x45, 0x82, 0x09,
+    0x88, 0x45, 0x86, 0x01, 0x8E, 0x44, 0x86, 0x03, 0x81, 0x45, 0x83, 0x00, 0x81, 0x45, 0x8E, 0x0A,
+    0x84, 0x45, 0x89, 0x00, 0x82, 0x45, 0x82, 0x04, 0x8C, 0x44, 0x87, 0x00, 0x84, 0x45, 0x8A, 0x0A,
+    0x81, 0x45, 0x8C, 0x00, 0x85, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8A, 0x00, 0x87, 0x45, 0x86, 0x0B,
+    0x8C, 0x45, 0x00, 0x88, 0x44, 0x89, 0x05, 0x84, 0x44, 0x8D, 0x00, 0x8A, 0x45, 0x82, 0x0B, 0x88,
+    0x45, 0x82, 0x8B, 0x44, 0x85, 0x06, 0x45, 0x00, 0x8D, 0x44, 0x8E, 0x0C, 0x84, 0x45, 0x85, 0x8D,
+    0x44, 0x81, 0x06, 0x8C, 0x44, 0x83, 0x45, 0x8A, 0x0D, 0x45, 0x88, 0x44, 0x8D, 0x07, 0x88, 0x44,
+    0x88, 0x45, 0x86, 0x0D, 0x8C, 0x44, 0x8D, 0x44, 0x89, 0x07, 0x84, 0x44, 0x8C, 0x45, 0x82, 0x0D,
+    0x88, 0x4A, 0x85, 0x08, 0x4A, 0x8E, 0x0E, 0x84, 0x4A, 0x81, 0x08, 0x8C, 0x49, 0x8A, 0x0F, 0x49,
+    0x8D, 0x09, 0x88, 0x49, 0x86, 0x0F, 0x8C, 0x48, 0x89, 0x09, 0x84, 0x49, 0x82, 0x0F, 0x88, 0x48,
+    0x85, 0x0A, 0x48, 0x8E, 0x10, 0x84, 0x48, 0x81, 0x0A, 0x8B, 0x47, 0x8A, 0x11, 0x47, 0x8D, 0x0B,
+    0x87, 0x47, 0x86, 0x08, 0x00, 0x8E, 0x46, 0x86, 0x0D, 0x8E, 0x46, 0x83, 0x01, 0x84, 0x46, 0x8E,
+    0x81, 0x0B, 0x88, 0x46, 0x88, 0x03, 0x8A, 0x46, 0x89, 0x0A, 0x82, 0x46, 0x8E, 0x04, 0x81, 0x8E,
+    0x46, 0x83, 0x09, 0x8B, 0x46, 0x84, 0x05, 0x86, 0x46, 0x8C, 0x08, 0x84, 0x46, 0x8A, 0x07, 0x8B,
+    0x46, 0x85, 0x07, 0x8D, 0x46, 0x81, 0x07, 0x82, 0x46, 0x8E, 0x06, 0x86, 0x46, 0x86, 0x09, 0x87,
+    0x46, 0x88, 0x04, 0x81, 0x8E, 0x45, 0x8C, 0x0B, 0x8D, 0x46, 0x82, 0x03, 0x89, 0x46, 0x82, 0x0B,
+    0x83, 0x46, 0x8B, 0x02, 0x83, 0x46, 0x88, 0x0D, 0x89, 0x46, 0x85, 0x01, 0x8C, 0x45, 0x8D, 0x0F,
+    0x8E, 0x45, 0x8E, 0x00, 0x85, 0x46, 0x84, 0x0F, 0x84, 0x46, 0x88, 0x8E, 0x45, 0x8A, 0x11, 0x8A,
+    0x4C, 0x8E, 0x81, 0x11, 0x81, 0x8E, 0x4B, 0x86, 0x13, 0x86, 0x4A, 0x8C, 0x15, 0x8C, 0x49, 0x82,
+    0x15, 0x85, 0x48, 0x88, 0x16, 0x8D, 0x48, 0x8B, 0x15, 0x87, 0x4A, 0x86, 0x13, 0x82, 0x4C, 0x81,
+    0x12, 0x8B, 0x4C, 0x8B, 0x11, 0x86, 0x46, 0x8B, 0x46, 0x86, 0x0F, 0x81, 0x8E, 0x45, 0x8B, 0x00,
+    0x8D, 0x46, 0x81, 0x0E, 0x8A, 0x46, 0x82, 0x00, 0x84, 0x46, 0x8B, 0x0D, 0x84, 0x46, 0x87, 0x02,
+    0x8A, 0x46, 0x86, 0x0C, 0x8E, 0x45, 0x8D, 0x03, 0x81, 0x46, 0x8E, 0x81, 0x0A, 0x89, 0x46, 0x84,
+    0x04, 0x87, 0x46, 0x8B, 0x09, 0x83, 0x46, 0x8A, 0x06, 0x8D, 0x46, 0x85, 0x08, 0x8D, 0x46, 0x81,
+    0x06, 0x83, 0x46, 0x8E, 0x81, 0x06, 0x87, 0x46, 0x87, 0x08, 0x8A, 0x46, 0x8B, 0x05, 0x82, 0x46,
+    0x8D, 0x09, 0x81, 0x47, 0x85, 0x04, 0x8C, 0x46, 0x83, 0x0A, 0x86, 0x46, 0x8E, 0x81, 0x02, 0x86,
+    0x46, 0x8A, 0x0C, 0x8C, 0x46, 0x8A, 0x01, 0x81, 0x46, 0x8E, 0x81, 0x0C, 0x83, 0x47, 0x85, 0x00,
+    0x8A, 0x46, 0x86, 0x0E, 0x89, 0x46, 0x8E, 0x81, 0x8B, 0x46, 0x87, 0x0C, 0x83, 0x46, 0x8E, 0x00,
+    0x83, 0x46, 0x8E, 0x0C, 0x8B, 0x46, 0x86, 0x01, 0x8A, 0x46, 0x87, 0x0A, 0x83, 0x46, 0x8D, 0x02,
+    0x82, 0x46, 0x8E, 0x0A, 0x8B, 0x46, 0x85, 0x03, 0x89, 0x46, 0x87, 0x08, 0x83, 0x46, 0x8C, 0x04,
+    0x81, 0x46, 0x8E, 0x08, 0x8B, 0x46, 0x83, 0x05, 0x88, 0x46, 0x87, 0x06, 0x83, 0x46, 0x8B, 0x06,
+    0x81, 0x8E, 0x45, 0x8E, 0x06, 0x8B, 0x46, 0x82, 0x07, 0x87, 0x46, 0x87, 0x04, 0x83, 0x46, 0x89,
+    0x09, 0x8E, 0x45, 0x8E, 0x04, 0x8B, 0x46, 0x81, 0x09, 0x86, 0x46, 0x86, 0x02, 0x83, 0x46, 0x88,
+    0x0B, 0x8D, 0x45, 0x8E, 0x02, 0x8B, 0x45, 0x8E, 0x81, 0x0B, 0x85, 0x46, 0x86, 0x00, 0x83, 0x46,
+    0x87, 0x0D, 0x8C, 0x45, 0x8E, 0x00, 0x8B, 0x45, 0x8E, 0x0E, 0x84, 0x46, 0x8A, 0x46, 0x85, 0x0F,
+    0x8B, 0x4C, 0x8D, 0x10, 0x83, 0x4C, 0x84, 0x11, 0x8A, 0x4A, 0x8C, 0x12, 0x82, 0x4A, 0x83, 0x13,
+    0x89, 0x48, 0x8A, 0x14, 0x81, 0x48, 0x82, 0x15, 0x88, 0x46, 0x89, 0x16, 0x82, 0x46, 0x85, 0x16,
+    0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85, 0x16,
+    0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85, 0x16,
+    0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85, 0x16,
+    0x82, 0x46, 0x85, 0x0B, 0x85, 0x58, 0x84, 0x85, 0x58, 0x84, 0x85, 0x58, 0x84, 0x85, 0x58, 0x84,
+    0x85, 0x58, 0x84, 0x85, 0x57, 0x8D, 0x00, 0x81, 0xF4, 0xF4, 0x8E, 0x46, 0x83, 0x10, 0x88, 0x46,
+    0x88, 0x10, 0x83, 0x46, 0x8C, 0x11, 0x8D, 0x46, 0x82, 0x10, 0x89, 0x46, 0x87, 0x10, 0x84, 0x46,
+    0x8B, 0x10, 0x81, 0x8E, 0x46, 0x81, 0x10, 0x8A, 0x46, 0x86, 0x10, 0x85, 0x46, 0x8B, 0x10, 0x81,
+    0x46, 0x8E, 0x81, 0x10, 0x8B, 0x46, 0x85, 0x10, 0x87, 0x46, 0x8A, 0x10, 0x82, 0x46, 0x8E, 0x11,
+    0x8C, 0x46, 0x84, 0x10, 0x88, 0x46, 0x89, 0x10, 0x83, 0x46, 0x8D, 0x11, 0x8D, 0x46, 0x83, 0x10,
+    0x89, 0x46, 0x88, 0x10, 0x84, 0x46, 0x8C, 0x11, 0x8E, 0x46, 0x82, 0x10, 0x8A, 0x46, 0x87, 0x10,
+    0x85, 0x46, 0x8B, 0x10, 0x81, 0x8E, 0x46, 0x81, 0x10, 0x8B, 0x46, 0x89, 0xF4, 0xF4, 0x83, 0x86,
+    0x58, 0x9C, 0x58, 0x9C, 0x58, 0x9C, 0x58, 0x9C, 0x58, 0x9C, 0x58, 0x8C, 0x88, 0x4A, 0x85, 0x88,
+    0x4A, 0x85, 0x88, 0x4A, 0x85, 0x88, 0x4A, 0x85, 0x88, 0x4A, 0x85, 0x88, 0x44, 0x8D, 0xC2, 0x00,
+    0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05,
+    0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05,
+    0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05,
+    0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05,
+    0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05,
+    0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05,
+    0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05,
+    0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05, 0x88, 0x44, 0x8D, 0x05,
+    0x88, 0x44, 0x8D, 0xC2, 0x00, 0x88, 0x4A, 0x85, 0x88, 0x4A, 0x85, 0x88, 0x4A, 0x85, 0x88, 0x4A,
+    0x85, 0x88, 0x4A, 0x85, 0x88, 0x45, 0x83, 0x0C, 0x82, 0x45, 0x89, 0x0D, 0x8C, 0x45, 0x0D, 0x86,
+    0x45, 0x85, 0x0C, 0x81, 0x45, 0x8B, 0x0D, 0x8A, 0x45, 0x81, 0x0C, 0x84, 0x45, 0x87, 0x0D, 0x8E,
+    0x44, 0x8D, 0x0D, 0x89, 0x45, 0x83, 0x0C, 0x83, 0x45, 0x89, 0x0D, 0x8D, 0x44, 0x8E, 0x0D, 0x87,
+    0x45, 0x84, 0x0C, 0x81, 0x45, 0x8A, 0x0D, 0x8B, 0x45, 0x81, 0x0C, 0x85, 0x45, 0x86, 0x0D, 0x45,
+    0x8C, 0x0D, 0x89, 0x45, 0x82, 0x0C, 0x83, 0x45, 0x88, 0x0D, 0x8D, 0x44, 0x8E, 0x0D, 0x88, 0x45,
+    0x84, 0x0C, 0x82, 0x45, 0x8A, 0x0D, 0x8C, 0x45, 0x0D, 0x86, 0x45, 0x85, 0x0D, 0x45, 0x8B, 0x0D,
+    0x8A, 0x45, 0x81, 0x0C, 0x84, 0x45, 0x87, 0x0D, 0x8E, 0x44, 0x8D, 0x0D, 0x88, 0x45, 0x83, 0x0C,
+    0x82, 0x45, 0x89, 0x0D, 0x8C, 0x44, 0x8E, 0x0D, 0x87, 0x45, 0x85, 0x0C, 0x81, 0x45, 0x8B, 0x0D,
+    0x8B, 0x45, 0x81, 0x0C, 0x85, 0x45, 0x86, 0x0D, 0x8E, 0x44, 0x8C, 0x0D, 0x89, 0x45, 0x82, 0x8C,
+    0x4A, 0x81, 0x8C, 0x4A, 0x81, 0x8C, 0x4A, 0x81, 0x8C, 0x4A, 0x81, 0x8C, 0x4A, 0x91, 0xB2, 0x86,
+    0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85,
+    0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85,
+    0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85,
+    0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85,
+    0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85,
+    0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85,
+    0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85,
+    0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85, 0x45, 0x81, 0x04, 0x85,
+    0x45, 0x91, 0xB2, 0x86, 0x45, 0x81, 0x8C, 0x4A, 0x81, 0x8C, 0x4A, 0x81, 0x8C, 0x4A, 0x81, 0x8C,
+    0x4A, 0x81, 0x8C, 0x4A, 0x81, 0x09, 0x85, 0x42, 0x8A, 0x15, 0x8C, 0x43, 0x83, 0x13, 0x84, 0x44,
+    0x8B, 0x13, 0x8B, 0x45, 0x83, 0x11, 0x83, 0x46, 0x8C, 0x11, 0x8A, 0x47, 0x84, 0x0F, 0x82, 0x48,
+    0x8C, 0x0F, 0x89, 0x43, 0x8E, 0x44, 0x85, 0x0D, 0x81, 0x44, 0x85, 0x8B, 0x43, 0x8D, 0x0D, 0x88,
+    0x43, 0x8E, 0x00, 0x83, 0x44, 0x86, 0x0C, 0x8E, 0x43, 0x87, 0x01, 0x8A, 0x43, 0x8E, 0x0B, 0x87,
+    0x44, 0x81, 0x01, 0x82, 0x44, 0x87, 0x0A, 0x8E, 0x43, 0x89, 0x03, 0x8A, 0x43, 0x8E, 0x09, 0x86,
+    0x44, 0x82, 0x03, 0x82, 0x44, 0x87, 0x08, 0x8D, 0x43, 0x8B, 0x05, 0x8A, 0x44, 0x81, 0x06, 0x85,
+    0x44, 0x84, 0x05, 0x82, 0x44, 0x88, 0x06, 0x8C, 0x43, 0x8D, 0x07, 0x8A, 0x44, 0x81, 0x04, 0x83,
+    0x44, 0x86, 0x07, 0x82, 0x44, 0x89, 0x04, 0x8B, 0x43, 0x8E, 0x09, 0x8A, 0x44, 0x82, 0x02, 0x82,
+    0x44, 0x87, 0x09, 0x82, 0x44, 0x8A, 0x02, 0x8A, 0x44, 0x81, 0x0A, 0x89, 0x44, 0x82, 0x00, 0x81,
+    0x44, 0x89, 0x0B, 0x82, 0x44, 0x8B, 0x00, 0x89, 0x44, 0x82, 0x0C, 0x89, 0x44, 0x83, 0x00, 0xF6,
+    0xF6, 0xB6, 0x84, 0x81, 0x53, 0x8A, 0x81, 0x53, 0x8A, 0x81, 0x53, 0x8A, 0x8C, 0x46, 0x8C, 0x05,
+    0x81, 0x8C, 0x46, 0x87, 0x06, 0x8A, 0x46, 0x83, 0x06, 0x88, 0x45, 0x8E, 0x81, 0x06, 0x85, 0x45,
+    0x8C, 0x07, 0x82, 0x8D, 0x44, 0x89, 0x08, 0x8B, 0x44, 0x87, 0x08, 0x87, 0x44, 0x82, 0x05, 0x81,
+    0x85, 0x88, 0x8B, 0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x87, 0x82, 0x09, 0x85, 0x8B, 0x4C, 0x8C,
+    0x83, 0x05, 0x82, 0x8E, 0x50, 0x88, 0x05, 0x8D, 0x51, 0x88, 0x04, 0x85, 0x52, 0x83, 0x04, 0x8D,
+    0x44, 0x8C, 0x89, 0x88, 0x89, 0x8C, 0x47, 0x8B, 0x04, 0x86, 0x40, 0x8E, 0x88, 0x83, 0x05, 0x83,
+    0x47, 0x05, 0x85, 0x09, 0x86, 0x46, 0x83, 0x0F, 0x81, 0x46, 0x85, 0x10, 0x46, 0x86, 0x10, 0x46,
+    0x87, 0x05, 0x81, 0x84, 0x87, 0x8A, 0x8B, 0x8C, 0x8D, 0x9E, 0x48, 0x87, 0x03, 0x85, 0x8B, 0x51,
+    0x87, 0x01, 0x82, 0x8C, 0x53, 0x87, 0x00, 0x83, 0x8E, 0x54, 0x87, 0x00, 0x8D, 0x48, 0x8B, 0x89,
+    0x87, 0x96, 0x85, 0x46, 0x87, 0x85, 0x47, 0x87, 0x06, 0x46, 0x87, 0x8A, 0x46, 0x85, 0x07, 0x46,
+    0x87, 0x8C, 0x45, 0x8E, 0x07, 0x81, 0x46, 0x87, 0x8E, 0x45, 0x8C, 0x07, 0x85, 0x46, 0x87, 0x8D,
+    0x45, 0x8E, 0x06, 0x81, 0x8D, 0x46, 0x87, 0x8B, 0x46, 0x86, 0x04, 0x82, 0x8D, 0x47, 0x87, 0x88,
+    0x47, 0x8C, 0x88, 0x87, 0x88, 0x8C, 0x49, 0x87, 0x82, 0x4F, 0x8E, 0x45, 0x87, 0x00, 0x8A, 0x4D,
+    0x8E, 0x82, 0x8E, 0x44, 0x87, 0x00, 0x81, 0x8D, 0x4B, 0x8E, 0x82, 0x00, 0x89, 0x44, 0x87, 0x01,
+    0x81, 0x8A, 0x49, 0x8A, 0x81, 0x01, 0x84, 0x44, 0x87, 0x03, 0x83, 0x89, 0x8C, 0x8E, 0x41, 0x8E,
+    0x8C, 0x88, 0x82, 0x04, 0x8E, 0x43, 0x87, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81,
+    0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81,
+    0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81,
+    0x46, 0x84, 0x02, 0x85, 0x8A, 0x8D, 0x8E, 0x40, 0x8D, 0x8B, 0x86, 0x06, 0x81, 0x46, 0x83, 0x00,
+    0x83, 0x8D, 0x47, 0x8E, 0x85, 0x04, 0x81, 0x46, 0x82, 0x85, 0x4B, 0x88, 0x03, 0x81, 0x46, 0x85,
+    0x4D, 0x86, 0x02, 0x81, 0x56, 0x82, 0x01, 0x81, 0x56, 0x8A, 0x01, 0x81, 0x48, 0x8D, 0x85, 0x81,
+    0x01, 0x85, 0x8E, 0x47, 0x81, 0x00, 0x81, 0x47, 0x8C, 0x05, 0x81, 0x8D, 0x46, 0x87, 0x00, 0x81,
+    0x47, 0x82, 0x06, 0x84, 0x46, 0x8C, 0x00, 0x81, 0x46, 0x8D, 0x08, 0x8D, 0x46, 0x00, 0x81, 0x46,
+    0x89, 0x08, 0x88, 0x46, 0x82, 0x81, 0x46, 0x87, 0x08, 0x85, 0x46, 0x84, 0x81, 0x46, 0x86, 0x08,
+    0x84, 0x46, 0x84, 0x81, 0x46, 0x85, 0x08, 0x83, 0x46, 0x85, 0x81, 0x46, 0x86, 0x08, 0x83, 0x46,
+    0x85, 0x81, 0x46, 0x86, 0x08, 0x84, 0x46, 0x84, 0x81, 0x46, 0x88, 0x08, 0x86, 0x46, 0x83, 0x81,
+    0x46, 0x8A, 0x08, 0x89, 0x46, 0x82, 0x81, 0x46, 0x8E, 0x08, 0x8E, 0x46, 0x00, 0x81, 0x47, 0x85,
+    0x06, 0x85, 0x46, 0x8C, 0x00, 0x81, 0x47, 0x8E, 0x81, 0x04, 0x82, 0x8E, 0x46, 0x87, 0x00, 0x81,
+    0x48, 0x8E, 0x87, 0x82, 0x00, 0x81, 0x86, 0x8E, 0x47, 0x81, 0x00, 0x81, 0x56, 0x8A, 0x01, 0x81,
+    0x56, 0x81, 0x01, 0x81, 0x45, 0x8E, 0x8B, 0x4D, 0x86, 0x02, 0x81, 0x45, 0x87, 0x00, 0x8A, 0x4B,
+    0x87, 0x03, 0x81, 0x45, 0x82, 0x01, 0x87, 0x48, 0x8D, 0x84, 0x04, 0x81, 0x44, 0x8C, 0x03, 0x81,
+    0x86, 0x8B, 0x8D, 0x41, 0x8D, 0x8A, 0x85, 0x06, 0x07, 0x83, 0x87, 0x8B, 0x8D, 0x8E, 0x41, 0x8E,
+    0x8C, 0x8A, 0x86, 0x82, 0x08, 0x86, 0x8D, 0x4B, 0x8D, 0x86, 0x04, 0x81, 0x8C, 0x4E, 0x8E, 0x03,
+    0x82, 0x8E, 0x4F, 0x88, 0x03, 0x8D, 0x50, 0x82, 0x02, 0x8A, 0x50, 0x8B, 0x02, 0x82, 0x47, 0x8D,
+    0x86, 0x81, 0x00, 0x81, 0x83, 0x86, 0x8B, 0x41, 0x85, 0x02, 0x8A, 0x46, 0x8C, 0x07, 0x81, 0x86,
+    0x03, 0x47, 0x81, 0x0C, 0x83, 0x46, 0x88, 0x0D, 0x87, 0x46, 0x83, 0x0D, 0x89, 0x46, 0x0E, 0x8A,
+    0x45, 0x8E, 0x0E, 0x8B, 0x45, 0x8D, 0x0E, 0x8B, 0x45, 0x8D, 0x0E, 0x8A, 0x45, 0x8E, 0x0E, 0x89,
+    0x46, 0x0E, 0x88, 0x46, 0x83, 0x0D, 0x85, 0x46, 0x88, 0x0D, 0x81, 0x46, 0x8E, 0x81, 0x0A, 0x81,
+    0x01, 0x8D, 0x46, 0x8B, 0x08, 0x85, 0x8E, 0x84, 0x01, 0x86, 0x47, 0x8D, 0x86, 0x82, 0x00, 0x81,
+    0x82, 0x85, 0x89, 0x8E, 0x41, 0x84, 0x02, 0x8E, 0x51, 0x84, 0x02, 0x84, 0x51, 0x84, 0x03, 0x88,
+    0x50, 0x84, 0x04, 0x87, 0x4F, 0x84, 0x05, 0x83, 0x8A, 0x4B, 0x8E, 0x86, 0x08, 0x82, 0x86, 0x8A,
+    0x8D, 0x8E, 0x42, 0x8E, 0x8B, 0x89, 0x84, 0x03, 0x11, 0x8B, 0x45, 0x8C, 0x11, 0x8B, 0x45, 0x8C,
+    0x11, 0x8B, 0x45, 0x8C, 0x11, 0x8B, 0x45, 0x8C, 0x11, 0x8B, 0x45, 0x8C, 0x11, 0x8B, 0x45, 0x8C,
+    0x11, 0x8B, 0x45, 0x8C, 0x11, 0x8B, 0x45, 0x8C, 0x11, 0x8B, 0x45, 0x8C, 0x11, 0x8A, 0x45, 0x8C,
+    0x05, 0x81, 0x87, 0x8C, 0x8D, 0x40, 0x8E, 0x8D, 0x8A, 0x84, 0x02, 0x89, 0x45, 0x8C, 0x04, 0x88,
+    0x48, 0x8D, 0x83, 0x00, 0x88, 0x45, 0x8C, 0x03, 0x8C, 0x4B, 0x85, 0x86, 0x45, 0x8C, 0x02, 0x8B,
+    0x4D, 0x87, 0x45, 0x8C, 0x01, 0x86, 0x55, 0x8C, 0x00, 0x81, 0x56, 0x8C, 0x00, 0x87, 0x47, 0x8C,
+    0x85, 0x82, 0x81, 0x83, 0x88, 0x48, 0x8C, 0x00, 0x8D, 0x46, 0x8B, 0x05, 0x81, 0x8D, 0x46, 0x8C,
+    0x81, 0x46, 0x8E, 0x07, 0x84, 0x46, 0x8C, 0x84, 0x46, 0x88, 0x08, 0x8D, 0x45, 0x8C, 0x87, 0x46,
+    0x83, 0x08, 0x88, 0x45, 0x8C, 0x89, 0x46, 0x09, 0x86, 0x45, 0x8C, 0x8A, 0x45, 0x8E, 0x09, 0x84,
+    0x45, 0x8C, 0x8B, 0x45, 0x8D, 0x09, 0x83, 0x45, 0x8C, 0x8B, 0x45, 0x8D, 0x09, 0x83, 0x45, 0x8C,
+    0x8A, 0x45, 0x8D, 0x09, 0x84, 0x45, 0x8C, 0x89, 0x46, 0x09, 0x85, 0x45, 0x8C, 0x88, 0x46, 0x82,
+    0x08, 0x87, 0x45, 0x8C, 0x85, 0x46, 0x86, 0x08, 0x8B, 0x45, 0x8C, 0x82, 0x46, 0x8D, 0x07, 0x82,
+    0x46, 0x8C, 0x00, 0x8D, 0x46, 0x88, 0x06, 0x8B, 0x46, 0x8C, 0x00, 0x87, 0x47, 0x8A, 0x83, 0x01,
+    0x81, 0x85, 0x8C, 0x47, 0x8C, 0x00, 0x81, 0x56, 0x8C, 0x01, 0x87, 0x55, 0x8C, 0x02, 0x8C, 0x4C,
+    0x8D, 0x84, 0x45, 0x8C, 0x02, 0x81, 0x8D, 0x4A, 0x8E, 0x82, 0x00, 0x8D, 0x44, 0x8C, 0x04, 0x89,
+    0x48, 0x8B, 0x81, 0x01, 0x87, 0x44, 0x8C, 0x05, 0x82, 0x88, 0x8C, 0x8E, 0x40, 0x8E, 0x8C, 0x89,
+    0x83, 0x03, 0x82, 0x44, 0x8C, 0x07, 0x84, 0x88, 0x8C, 0x8D, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x81,
+    0x0C, 0x86, 0x8E, 0x4A, 0x89, 0x81, 0x08, 0x81, 0x8C, 0x4D, 0x8E, 0x84, 0x06, 0x82, 0x8E, 0x50,
+    0x85, 0x05, 0x8D, 0x52, 0x82, 0x03, 0x8A, 0x46, 0x8E, 0x88, 0x95, 0x87, 0x8C, 0x46, 0x8C, 0x02,
+    0x82, 0x46, 0x8C, 0x81, 0x04, 0x86, 0x46, 0x84, 0x01, 0x89, 0x45, 0x8E, 0x81, 0x06, 0x88, 0x45,
+    0x8A, 0x01, 0x46, 0x87, 0x07, 0x81, 0x45, 0x8E, 0x00, 0x83, 0x46, 0x83, 0x08, 0x8C, 0x45, 0x82,
+    0x86, 0x46, 0x09, 0x8A, 0x45, 0x84, 0x89, 0x57, 0x85, 0x8A, 0x57, 0x86, 0x8B, 0x57, 0x86, 0x8B,
+    0x57, 0x86, 0x8A, 0x57, 0x85, 0x89, 0x45, 0x8D, 0x11, 0x87, 0x46, 0x11, 0x83, 0x46, 0x84, 0x11,
+    0x46, 0x8C, 0x11, 0x89, 0x46, 0x87, 0x0B, 0x81, 0x86, 0x02, 0x82, 0x47, 0x8A, 0x82, 0x06, 0x81,
+    0x86, 0x8B, 0x40, 0x8D, 0x03, 0x89, 0x48, 0x8C, 0xA9, 0x8A, 0x8B, 0x8E, 0x43, 0x8D, 0x04, 0x8C,
+    0x52, 0x8D, 0x04, 0x81, 0x8C, 0x51, 0x8D, 0x06, 0x89, 0x50, 0x8D, 0x07, 0x83, 0x8B, 0x4D, 0x8A,
+    0x83, 0x09, 0x81, 0x86, 0x89, 0x8C, 0x8E, 0x42, 0x8E, 0x8D, 0x8B, 0x88, 0x84, 0x04, 0x07, 0x81,
+    0x87, 0x8A, 0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x87, 0x83, 0x07, 0x89, 0x4B, 0x87, 0x05, 0x8D,
+    0x4C, 0x82, 0x04, 0x89, 0x4C, 0x8C, 0x04, 0x82, 0x4D, 0x86, 0x04, 0x87, 0x4D, 0x81, 0x04, 0x8A,
+    0x46, 0x8A, 0x81, 0x01, 0x81, 0x85, 0x86, 0x05, 0x8C, 0x45, 0x8E, 0x0C, 0x8D, 0x45, 0x8A, 0x0C,
+    0x8E, 0x45, 0x88, 0x0C, 0x8E, 0x45, 0x88, 0x0A, 0x83, 0x8B, 0x4D, 0x02, 0x83, 0x8B, 0x4F, 0x02,
+    0x51, 0x02, 0x51, 0x02, 0x51, 0x02, 0xB9, 0x46, 0x8D, 0xD9, 0x06, 0x8E, 0x45, 0x88, 0x0C, 0x8E,
+    0x45, 0x88, 0x0C, 0x8E, 0x45, 0x88, 0x0C, 0x8E, 0x45, 0x88, 0x0C, 0x8E, 0x45, 0x88, 0x0C, 0x8E,
+    0x45, 0x88, 0x0C, 0x8E, 0x45, 0x88, 0x0C, 0x8E, 0x45, 0x88, 0x0C, 0x8E, 0x45, 0x88, 0x0C, 0x8E,
+    0x45, 0x88, 0x0C, 0x8E, 0x45, 0x88, 0x0C, 0x8E, 0x45, 0x88, 0x0C, 0x8E, 0x45, 0x88, 0x0C, 0x8E,
+    0x45, 0x88, 0x0C, 0x8E, 0x45, 0x88, 0x0C, 0x8E, 0x45, 0x88, 0x0C, 0x8E, 0x45, 0x88, 0x0C, 0x8E,
+    0x45, 0x88, 0x0C, 0x8E, 0x45, 0x88, 0x0C, 0x8E, 0x45, 0x88, 0x0C, 0x8E, 0x45, 0x88, 0x08, 0x07,
+    0x85, 0x88, 0x8C, 0x8E, 0x41, 0x8E, 0x8B, 0x87, 0x83, 0x0F, 0x87, 0x8E, 0x52, 0x8A, 0x03, 0x81,
+    0x8C, 0x54, 0x8A, 0x03, 0x8C, 0x55, 0x8A, 0x02, 0x88, 0x46, 0x8E, 0x89, 0x88, 0x8A, 0x4B, 0x89,
+    0x01, 0x81, 0x46, 0x89, 0x03, 0x81, 0x8C, 0x45, 0x8E, 0x89, 0x85, 0x81, 0x02, 0x86, 0x45, 0x8D,
+    0x05, 0x82, 0x45, 0x8B, 0x05, 0x89, 0x45, 0x88, 0x06, 0x8C, 0x45, 0x83, 0x04, 0x8B, 0x45, 0x85,
+    0x06, 0x89, 0x45, 0x87, 0x04, 0x8C, 0x45, 0x84, 0x06, 0x89, 0x45, 0x88, 0x04, 0x8B, 0x45, 0x85,
+    0x06, 0x8A, 0x45, 0x87, 0x04, 0x89, 0x45, 0x88, 0x06, 0x8D, 0x45, 0x86, 0x04, 0x85, 0x45, 0x8E,
+    0x05, 0x83, 0x46, 0x81, 0x05, 0x8E, 0x45, 0x8A, 0x03, 0x81, 0x8D, 0x45, 0x8C, 0x06, 0x86, 0x46,
+    0x8E, 0x8A, 0x89, 0x8A, 0x47, 0x83, 0x07, 0x8A, 0x50, 0x87, 0x09, 0x88, 0x4E, 0x87, 0x0B, 0x89,
+    0x4B, 0x8B, 0x82, 0x0A, 0x81, 0x8C, 0x43, 0x9E, 0x41, 0x8E, 0x8D, 0x8A, 0x87, 0x82, 0x0C, 0x8D,
+    0x43, 0x8C, 0x14, 0x86, 0x44, 0x87, 0x14, 0x89, 0x44, 0x8D, 0x85, 0x81, 0x12, 0x88, 0x4E, 0x8E,
+    0x8C, 0x89, 0x85, 0x07, 0x82, 0x52, 0x8E, 0x85, 0x06, 0x86, 0x53, 0x87, 0x06, 0x86, 0x53, 0x83,
+    0x03, 0x85, 0x8D, 0x54, 0x8C, 0x02, 0x8B, 0x57, 0x81, 0x00, 0x8A, 0x45, 0x8B, 0x84, 0x81, 0x05,
+    0x82, 0x85, 0x8B, 0x46, 0x83, 0x84, 0x45, 0x87, 0x0B, 0x8A, 0x45, 0x85, 0x8A, 0x44, 0x8D, 0x0C,
+    0x84, 0x45, 0x84, 0x8C, 0x44, 0x89, 0x0C, 0x85, 0x45, 0x82, 0x8D, 0x44, 0x8B, 0x0C, 0x8C, 0x44,
+    0x8E, 0x00, 0x8B, 0x45, 0x84, 0x09, 0x81, 0x8B, 0x45, 0x88, 0x00, 0x87, 0x46, 0x89, 0x83, 0x04,
+    0x81, 0x85, 0x89, 0x46, 0x8E, 0x81, 0x00, 0x81, 0x49, 0x8E, 0x8D, 0x8E, 0x4A, 0x85, 0x02, 0x86,
+    0x55, 0x85, 0x04, 0x86, 0x52, 0x8C, 0x83, 0x06, 0x82, 0x8A, 0x4E, 0x8B, 0x84, 0x0A, 0x81, 0x86,
+    0x89, 0x8C, 0x8E, 0x42, 0x9E, 0x8C, 0x8A, 0x87, 0x84, 0x08, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46,
+    0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46,
+    0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46,
+    0x84, 0x11, 0x81, 0x46, 0x84, 0x02, 0x84, 0x8A, 0x8D, 0x8E, 0x40, 0x8E, 0x8D, 0x89, 0x85, 0x05,
+    0x81, 0x46, 0x83, 0x00, 0x83, 0x8D, 0x48, 0x8D, 0x84, 0x03, 0x81, 0x46, 0x82, 0x85, 0x4C, 0x87,
+    0x02, 0x81, 0x46, 0x84, 0x4E, 0x84, 0x01, 0x81, 0x56, 0x8E, 0x01, 0x81, 0x57, 0x85, 0x00, 0x81,
+    0x49, 0x89, 0x83, 0x01, 0x81, 0x88, 0x47, 0x8A, 0x00, 0x81, 0x48, 0x84, 0x05, 0x87, 0x46, 0x8E,
+    0x00, 0x81, 0x47, 0x88, 0x07, 0x8E, 0x46, 0x00, 0x81, 0x47, 0x81, 0x07, 0x89, 0x46, 0x91, 0x46,
+    0x8D, 0x08, 0x86, 0x46, 0x91, 0x46, 0x89, 0x08, 0x85, 0x46, 0x91, 0x46, 0x87, 0x08, 0x85, 0x46,
+    0x91, 0x46, 0x86, 0x08, 0x85, 0x46, 0x91, 0x46, 0x86, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08,
+    0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46,
+    0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46,
+    0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08,
+    0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46,
+    0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x81, 0x00, 0x81, 0x89, 0x8D, 0x40,
+    0x8E, 0x8A, 0x82, 0x01, 0x8C, 0x45, 0x81, 0x83, 0x46, 0x88, 0x85, 0x46, 0x8A, 0x84, 0x46, 0x89,
+    0x00, 0x8E, 0x45, 0x84, 0x00, 0x83, 0x8D, 0x43, 0x87, 0x03, 0x82, 0x84, 0x83, 0x1D, 0x81, 0x46,
+    0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85,
+    0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81,
+    0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46,
+    0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85,
+    0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x07,
+    0x81, 0x89, 0x8D, 0x40, 0x8E, 0x8A, 0x82, 0x08, 0x8C, 0x45, 0x81, 0x06, 0x83, 0x46, 0x88, 0x06,
+    0x85, 0x46, 0x8A, 0x06, 0x84, 0x46, 0x89, 0x07, 0x8E, 0x45, 0x84, 0x07, 0x83, 0x8D, 0x43, 0x87,
+    0x0A, 0x82, 0x84, 0x83, 0x39, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85,
+    0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85,
+    0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85,
+    0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85,
+    0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85,
+    0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85,
+    0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85,
+    0x06, 0x81, 0x46, 0x85, 0x06, 0x81, 0x46, 0x85, 0x06, 0x82, 0x46, 0x85, 0x06, 0x84, 0x46, 0x85,
+    0x06, 0x8B, 0x46, 0x83, 0x81, 0x85, 0x82, 0x01, 0x82, 0x89, 0x47, 0x81, 0x83, 0x4C, 0x8D, 0x00,
+    0x83, 0x4C, 0x86, 0x00, 0x83, 0x4B, 0x8C, 0x01, 0x83, 0x4A, 0x8D, 0x81, 0x01, 0x83, 0x49, 0x8A,
+    0x03, 0x81, 0x88, 0x8B, 0x8D, 0x8E, 0x41, 0x8E, 0x8B, 0x87, 0x81, 0x04, 0x81, 0x46, 0x85, 0x12,
+    0x81, 0x46, 0x85, 0x12, 0x81, 0x46, 0x85, 0x12, 0x81, 0x46, 0x85, 0x12, 0x81, 0x46, 0x85, 0x12,
+    0x81, 0x46, 0x85, 0x12, 0x81, 0x46, 0x85, 0x12, 0x81, 0x46, 0x85, 0x12, 0x81, 0x46, 0x85, 0x12,
+    0x81, 0x46, 0x85, 0x12, 0x81, 0x46, 0x85, 0x12, 0x81, 0x46, 0x85, 0x08, 0x88, 0x46, 0x8D, 0x91,
+    0x46, 0x85, 0x07, 0x87, 0x46, 0x8D, 0x81, 0x00, 0x81, 0x46, 0x85, 0x06, 0x86, 0x46, 0x8E, 0x82,
+    0x01, 0x81, 0x46, 0x85, 0x05, 0x85, 0x46, 0x8E, 0x82, 0x02, 0x81, 0x46, 0x85, 0x04, 0x84, 0x47,
+    0x83, 0x03, 0x81, 0x46, 0x85, 0x03, 0x83, 0x47, 0x84, 0x04, 0x81, 0x46, 0x85, 0x02, 0x82, 0x8E,
+    0x46, 0x85, 0x05, 0x81, 0x46, 0x84, 0x01, 0x82, 0x8E, 0x46, 0x86, 0x06, 0x81, 0x46, 0x83, 0x00,
+    0x81, 0x8D, 0x46, 0x87, 0x07, 0x81, 0x46, 0x82, 0x00, 0x8B, 0x46, 0x88, 0x08, 0x81, 0x46, 0x81,
+    0x88, 0x46, 0x89, 0x09, 0x81, 0x46, 0x85, 0x46, 0x8C, 0x0A, 0x81, 0x4F, 0x82, 0x09, 0x81, 0x4F,
+    0x8C, 0x09, 0x81, 0x50, 0x89, 0x08, 0x81, 0x51, 0x85, 0x07, 0x81, 0x48, 0x8D, 0x85, 0x47, 0x82,
+    0x06, 0x81, 0x47, 0x8B, 0x81, 0x00, 0x87, 0x46, 0x8D, 0x06, 0x81, 0x46, 0x89, 0x03, 0x8B, 0x46,
+    0x89, 0x05, 0x81, 0x46, 0x85, 0x03, 0x81, 0x8E, 0x46, 0x85, 0x04, 0x81, 0x46, 0x85, 0x04, 0x84,
+    0x47, 0x82, 0x03, 0x81, 0x46, 0x85, 0x05, 0x89, 0x46, 0x8D, 0x03, 0x81, 0x46, 0x85, 0x06, 0x8D,
+    0x46, 0x89, 0x02, 0x81, 0x46, 0x85, 0x06, 0x82, 0x47, 0x85, 0x01, 0x81, 0x46, 0x85, 0x07, 0x86,
+    0x47, 0x82, 0x00, 0x81, 0x46, 0x85, 0x08, 0x8A, 0x46, 0x8D, 0x00, 0x81, 0x46, 0x85, 0x08, 0x81,
+    0x8E, 0x46, 0x89, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81,
+    0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46,
+    0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85,
+    0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81,
+    0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46,
+    0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85,
+    0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x81,
+    0x46, 0x85, 0x81, 0x46, 0x85, 0x0A, 0x81, 0x87, 0x8B, 0x8E, 0x41, 0x8D, 0x8C, 0x88, 0x83, 0x06,
+    0x81, 0x87, 0x8B, 0x8E, 0x41, 0x8E, 0x8C, 0x88, 0x82, 0x04, 0x81, 0x44, 0x8C, 0x02, 0x87, 0x49,
+    0x8B, 0x81, 0x03, 0x89, 0x49, 0x8B, 0x81, 0x02, 0x81, 0x45, 0x81, 0x00, 0x8B, 0x4B, 0x8E, 0x82,
+    0x00, 0x81, 0x8D, 0x4B, 0x8E, 0x81, 0x01, 0x81, 0x45, 0x86, 0x89, 0x4D, 0x8D, 0x00, 0x8B, 0x4D,
+    0x8C, 0x01, 0x81, 0x67, 0x85, 0x00, 0x81, 0x67, 0x8B, 0x00, 0x81, 0x49, 0x87, 0x81, 0x01, 0x84,
+    0x8E, 0x49, 0x8E, 0x86, 0x81, 0x01, 0x85, 0x8E, 0x47, 0x00, 0x81, 0x48, 0x82, 0x04, 0x82, 0x48,
+    0x8E, 0x82, 0x04, 0x82, 0x47, 0x82, 0x81, 0x47, 0x87, 0x06, 0x89, 0x47, 0x86, 0x06, 0x89, 0x46,
+    0x84, 0x81, 0x47, 0x07, 0x85, 0x47, 0x07, 0x85, 0x46, 0x85, 0x81, 0x46, 0x8C, 0x07, 0x82, 0x46,
+    0x8B, 0x07, 0x83, 0x46, 0x85, 0x81, 0x46, 0x89, 0x07, 0x81, 0x46, 0x88, 0x07, 0x82, 0x46, 0x85,
+    0x81, 0x46, 0x87, 0x07, 0x81, 0x46, 0x86, 0x07, 0x81, 0x46, 0x85, 0x81, 0x46, 0x86, 0x07, 0x81,
+    0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x81, 0x46, 0x86, 0x07, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46,
+    0x85, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x07,
+    0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x07, 0x81,
+    0x46, 0x85, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85,
+    0x07, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x07,
+    0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x81, 0x46,
+    0x85, 0x07, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85,
+    0x07, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x81,
+    0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46,
+    0x85, 0x07, 0x81, 0x46, 0x85, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85, 0x07, 0x81, 0x46, 0x85,
+    0x0B, 0x86, 0x8A, 0x8D, 0x41, 0x8E, 0x8D, 0x89, 0x85, 0x05, 0x81, 0x44, 0x8C, 0x02, 0x86, 0x8E,
+    0x48, 0x8E, 0x85, 0x03, 0x81, 0x45, 0x81, 0x00, 0x8A, 0x4C, 0x87, 0x02, 0x81, 0x45, 0x86, 0x88,
+    0x4E, 0x85, 0x01, 0x81, 0x56, 0x8E, 0x01, 0x81, 0x57, 0x85, 0x00, 0x81, 0x49, 0x88, 0x83, 0x01,
+    0x81, 0x87, 0x47, 0x8A, 0x00, 0x81, 0x48, 0x84, 0x05, 0x86, 0x46, 0x8E, 0x00, 0x81, 0x47, 0x88,
+    0x07, 0x8D, 0x46, 0x00, 0x81, 0x47, 0x81, 0x07, 0x89, 0x46, 0x91, 0x46, 0x8C, 0x08, 0x86, 0x46,
+    0x91, 0x46, 0x89, 0x08, 0x85, 0x46, 0x91, 0x46, 0x87, 0x08, 0x85, 0x46, 0x91, 0x46, 0x86, 0x08,
+    0x85, 0x46, 0x91, 0x46, 0x86, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46,
+    0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46,
+    0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08,
+    0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46,
+    0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46,
+    0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x81, 0x07, 0x83, 0x87, 0x8B, 0x8D, 0x8E, 0x41, 0x8D, 0x8B,
+    0x87, 0x82, 0x0D, 0x85, 0x8D, 0x4A, 0x8C, 0x84, 0x09, 0x81, 0x8C, 0x4E, 0x8A, 0x07, 0x82, 0x8E,
+    0x50, 0x8C, 0x81, 0x05, 0x8D, 0x52, 0x8B, 0x04, 0x8A, 0x54, 0x87, 0x02, 0x82, 0x47, 0x8B, 0x84,
+    0x81, 0x00, 0x81, 0x85, 0x8C, 0x47, 0x81, 0x01, 0x89, 0x46, 0x89, 0x06, 0x8A, 0x46, 0x88, 0x01,
+    0x46, 0x8D, 0x08, 0x8E, 0x45, 0x8E, 0x00, 0x83, 0x46, 0x87, 0x08, 0x88, 0x46, 0x82, 0x87, 0x46,
+    0x82, 0x08, 0x84, 0x46, 0x86, 0x89, 0x46, 0x09, 0x81, 0x46, 0x88, 0x8A, 0x45, 0x8E, 0x0A, 0x46,
+    0x8A, 0x8B, 0x45, 0x8D, 0x0A, 0x8E, 0x45, 0x9B, 0x45, 0x8D, 0x0A, 0x8E, 0x45, 0x9A, 0x45, 0x8E,
+    0x0A, 0x46, 0x99, 0x46, 0x09, 0x81, 0x46, 0x88, 0x86, 0x46, 0x83, 0x08, 0x84, 0x46, 0x86, 0x83,
+    0x46, 0x87, 0x08, 0x88, 0x46, 0x82, 0x00, 0x8E, 0x45, 0x8E, 0x08, 0x8E, 0x45, 0x8E, 0x01, 0x88,
+    0x46, 0x89, 0x06, 0x8A, 0x46, 0x88, 0x01, 0x81, 0x47, 0x8C, 0x84, 0x81, 0x00, 0x81, 0x84, 0x8C,
+    0x47, 0x81, 0x02, 0x87, 0x54, 0x88, 0x04, 0x8C, 0x52, 0x8C, 0x05, 0x81, 0x8C, 0x50, 0x8D, 0x81,
+    0x07, 0x8A, 0x4E, 0x8B, 0x0A, 0x84, 0x8C, 0x4A, 0x8C, 0x84, 0x0D, 0x83, 0x88, 0x8B, 0x8E, 0x41,
+    0x8E, 0x8D, 0x8B, 0x87, 0x83, 0x07, 0x0B, 0x85, 0x8A, 0x8D, 0x8E, 0x40, 0x8D, 0x8B, 0x86, 0x06,
+    0x81, 0x45, 0x82, 0x01, 0x83, 0x8D, 0x47, 0x8E, 0x85, 0x04, 0x81, 0x45, 0x87, 0x00, 0x85, 0x4B,
+    0x88, 0x03, 0x81, 0x45, 0x8D, 0x83, 0x4D, 0x87, 0x02, 0x81, 0x56, 0x82, 0x01, 0x81, 0x56, 0x8B,
+    0x01, 0x81, 0x48, 0x8D, 0x85, 0x81, 0x01, 0x84, 0x8C, 0x47, 0x82, 0x00, 0x81, 0x47, 0x8C, 0x06,
+    0x8C, 0x46, 0x87, 0x00, 0x81, 0x47, 0x82, 0x06, 0x82, 0x46, 0x8C, 0x00, 0x81, 0x46, 0x8D, 0x08,
+    0x8C, 0x46, 0x00, 0x81, 0x46, 0x89, 0x08, 0x88, 0x46, 0x82, 0x81, 0x46, 0x87, 0x08, 0x85, 0x46,
+    0x84, 0x81, 0x46, 0x86, 0x08, 0x84, 0x46, 0x84, 0x81, 0x46, 0x85, 0x08, 0x83, 0x46, 0x85, 0x81,
+    0x46, 0x86, 0x08, 0x83, 0x46, 0x85, 0x81, 0x46, 0x86, 0x08, 0x84, 0x46, 0x85, 0x81, 0x46, 0x88,
+    0x08, 0x86, 0x46, 0x84, 0x81, 0x46, 0x8A, 0x08, 0x88, 0x46, 0x82, 0x81, 0x46, 0x8E, 0x08, 0x8D,
+    0x46, 0x00, 0x81, 0x47, 0x85, 0x06, 0x83, 0x46, 0x8B, 0x00, 0x81, 0x47, 0x8E, 0x81, 0x05, 0x8D,
+    0x46, 0x87, 0x00, 0x81, 0x48, 0x8E, 0x87, 0x82, 0x00, 0x81, 0x85, 0x8D, 0x47, 0x81, 0x00, 0x81,
+    0x56, 0x8A, 0x01, 0x81, 0x56, 0x81, 0x01, 0x81, 0x46, 0x8B, 0x4D, 0x85, 0x02, 0x81, 0x46, 0x81,
+    0x8A, 0x4B, 0x87, 0x03, 0x81, 0x46, 0x82, 0x00, 0x87, 0x48, 0x8D, 0x84, 0x04, 0x81, 0x46, 0x84,
+    0x01, 0x81, 0x86, 0x8B, 0x8D, 0x41, 0x8D, 0x8A, 0x85, 0x06, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46,
+    0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46,
+    0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46,
+    0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x05, 0x81, 0x87, 0x8C, 0x8E, 0x40,
+    0x8E, 0x8D, 0x89, 0x84, 0x0F, 0x88, 0x48, 0x8D, 0x83, 0x01, 0x8A, 0x44, 0x8C, 0x03, 0x8C, 0x4B,
+    0x85, 0x00, 0x8E, 0x44, 0x8C, 0x02, 0x8B, 0x4D, 0x85, 0x45, 0x8C, 0x01, 0x86, 0x55, 0x8C, 0x00,
+    0x81, 0x8E, 0x55, 0x8C, 0x00, 0x87, 0x47, 0x8C, 0x85, 0x82, 0x81, 0x83, 0x87, 0x8E, 0x47, 0x8C,
+    0x00, 0x8C, 0x46, 0x8A, 0x05, 0x81, 0x8D, 0x46, 0x8C, 0x81, 0x46, 0x8E, 0x07, 0x84, 0x46, 0x8C,
+    0x84, 0x46, 0x88, 0x08, 0x8D, 0x45, 0x8C, 0x87, 0x46, 0x83, 0x08, 0x88, 0x45, 0x8C, 0x89, 0x46,
+    0x09, 0x86, 0x45, 0x8C, 0x8A, 0x45, 0x8E, 0x09, 0x84, 0x45, 0x8C, 0x8B, 0x45, 0x8D, 0x09, 0x83,
+    0x45, 0x8C, 0x8B, 0x45, 0x8D, 0x09, 0x83, 0x45, 0x8C, 0x8A, 0x45, 0x8E, 0x09, 0x83, 0x45, 0x8C,
+    0x89, 0x46, 0x09, 0x85, 0x45, 0x8C, 0x88, 0x46, 0x82, 0x08, 0x87, 0x45, 0x8C, 0x85, 0x46, 0x86,
+    0x08, 0x8A, 0x45, 0x8C, 0x82, 0x46, 0x8C, 0x07, 0x81, 0x46, 0x8C, 0x00, 0x8D, 0x46, 0x86, 0x06,
+    0x8A, 0x46, 0x8C, 0x00, 0x87, 0x47, 0x88, 0x81, 0x02, 0x83, 0x8B, 0x47, 0x8C, 0x00, 0x81, 0x49,
+    0x8E, 0x8D, 0x4A, 0x8C, 0x01, 0x88, 0x55, 0x8C, 0x02, 0x8C, 0x4C, 0x8D, 0x88, 0x45, 0x8C, 0x02,
+    0x81, 0x8D, 0x4A, 0x8E, 0x82, 0x88, 0x45, 0x8C, 0x04, 0x89, 0x48, 0x8B, 0x81, 0x00, 0x8A, 0x45,
+    0x8C, 0x05, 0x82, 0x88, 0x8C, 0x8E, 0x41, 0x8D, 0x89, 0x84, 0x02, 0x8B, 0x45, 0x8C, 0x11, 0x8B,
+    0x45, 0x8C, 0x11, 0x8B, 0x45, 0x8C, 0x11, 0x8B, 0x45, 0x8C, 0x11, 0x8B, 0x45, 0x8C, 0x11, 0x8B,
+    0x45, 0x8C, 0x11, 0x8B, 0x45, 0x8C, 0x11, 0x8B, 0x45, 0x8C, 0x11, 0x8B, 0x45, 0x8C, 0x11, 0x8B,
+    0x45, 0x8C, 0x11, 0x8B, 0x45, 0x8C, 0x11, 0x8B, 0x45, 0x8C, 0x11, 0x8B, 0x45, 0x8C, 0x0B, 0x82,
+    0x89, 0x8D, 0x41, 0x8E, 0x88, 0x81, 0x44, 0x8A, 0x03, 0x89, 0x45, 0x88, 0x81, 0x44, 0x8E, 0x01,
+    0x81, 0x8C, 0x46, 0x87, 0x81, 0x45, 0x83, 0x00, 0x8C, 0x47, 0x86, 0x81, 0x45, 0x87, 0x88, 0x48,
+    0x84, 0x81, 0x50, 0x83, 0x81, 0x50, 0x82, 0x81, 0x49, 0x8E, 0x88, 0x84, 0x81, 0x01, 0x81, 0x00,
+    0x81, 0x48, 0x8B, 0x81, 0x06, 0x81, 0x47, 0x8B, 0x08, 0x81, 0x47, 0x82, 0x08, 0x81, 0x46, 0x8B,
+    0x09, 0x81, 0x46, 0x87, 0x09, 0x81, 0x46, 0x86, 0x09, 0x81, 0x46, 0x85, 0x09, 0x81, 0x46, 0x85,
+    0x09, 0x81, 0x46, 0x85, 0x09, 0x81, 0x46, 0x85, 0x09, 0x81, 0x46, 0x85, 0x09, 0x81, 0x46, 0x85,
+    0x09, 0x81, 0x46, 0x85, 0x09, 0x81, 0x46, 0x85, 0x09, 0x81, 0x46, 0x85, 0x09, 0x81, 0x46, 0x85,
+    0x09, 0x81, 0x46, 0x85, 0x09, 0x81, 0x46, 0x85, 0x09, 0x81, 0x46, 0x85, 0x09, 0x81, 0x46, 0x85,
+    0x09, 0x04, 0x82, 0x87, 0x8A, 0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8B, 0x88, 0x84, 0x06, 0x84, 0x8C,
+    0x4C, 0x8B, 0x85, 0x02, 0x88, 0x50, 0x87, 0x00, 0x87, 0x51, 0x91, 0x51, 0x8A, 0x00, 0x87, 0x46,
+    0x8E, 0x8A, 0x98, 0x8A, 0x8D, 0x44, 0x84, 0x00, 0x8A, 0x45, 0x8E, 0x81, 0x04, 0x81, 0x86, 0x8C,
+    0x40, 0x8D, 0x01, 0x8B, 0x45, 0x8B, 0x08, 0x82, 0x83, 0x01, 0x8A, 0x46, 0x83, 0x0B, 0x88, 0x47,
+    0x89, 0x81, 0x09, 0x84, 0x49, 0x8A, 0x84, 0x08, 0x8C, 0x4A, 0x8D, 0x86, 0x06, 0x82, 0x8E, 0x4B,
+    0x8E, 0x87, 0x05, 0x82, 0x8E, 0x4C, 0x8D, 0x82, 0x05, 0x88, 0x4C, 0x8E, 0x83, 0x05, 0x81, 0x88,
+    0x8E, 0x4A, 0x8D, 0x08, 0x86, 0x8C, 0x49, 0x86, 0x09, 0x84, 0x8C, 0x47, 0x8B, 0x0B, 0x86, 0x46,
+    0x8D, 0x0C, 0x89, 0x45, 0x8E, 0x86, 0x83, 0x0A, 0x87, 0x45, 0x8D, 0x8B, 0x40, 0x8D, 0x88, 0x83,
+    0x06, 0x81, 0x8D, 0x45, 0x9B, 0x44, 0x8C, 0x89, 0x88, 0x87, 0x88, 0x8A, 0x47, 0x86, 0x8B, 0x51,
+    0x8E, 0x81, 0x8B, 0x51, 0x85, 0x00, 0x8B, 0x50, 0x85, 0x01, 0x86, 0x8D, 0x4D, 0x8B, 0x82, 0x04,
+    0x82, 0x86, 0x8A, 0x8C, 0x8E, 0x43, 0x8E, 0x8C, 0x89, 0x86, 0x81, 0x04, 0x05, 0x89, 0xBD, 0x82,
+    0x0C, 0x81, 0x44, 0x82, 0x0C, 0x87, 0x44, 0x82, 0x0C, 0x8D, 0x44, 0x82, 0x0B, 0x83, 0x45, 0x82,
+    0x0B, 0x89, 0x45, 0x82, 0x09, 0x81, 0x89, 0x4D, 0x8C, 0x01, 0x86, 0x8E, 0x4E, 0x8C, 0x00, 0x8B,
+    0x50, 0x8C, 0x00, 0x8D, 0x50, 0x8C, 0x00, 0x8D, 0x50, 0x8C, 0x00, 0x88, 0x99, 0x8B, 0x46, 0x8A,
+    0xD9, 0x87, 0x03, 0x84, 0x46, 0x82, 0x0A, 0x84, 0x46, 0x82, 0x0A, 0x84, 0x46, 0x82, 0x0A, 0x84,
+    0x46, 0x82, 0x0A, 0x84, 0x46, 0x82, 0x0A, 0x84, 0x46, 0x82, 0x0A, 0x84, 0x46, 0x82, 0x0A, 0x84,
+    0x46, 0x82, 0x0A, 0x84, 0x46, 0x82, 0x0A, 0x84, 0x46, 0x82, 0x0A, 0x84, 0x46, 0x82, 0x0A, 0x84,
+    0x46, 0x82, 0x0A, 0x84, 0x46, 0x83, 0x0A, 0x83, 0x46, 0x87, 0x0A, 0x81, 0x47, 0x86, 0x02, 0x82,
+    0x86, 0x8A, 0x81, 0x03, 0x8E, 0x4D, 0x81, 0x03, 0x89, 0x4D, 0x81, 0x03, 0x82, 0x4D, 0x81, 0x04,
+    0x87, 0x4C, 0x81, 0x05, 0x87, 0x4A, 0x8E, 0x81, 0x06, 0x81, 0x87, 0x8B, 0x8E, 0x42, 0x8E, 0x8C,
+    0x89, 0x85, 0x01, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83,
+    0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87,
+    0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83,
+    0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83,
+    0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87,
+    0x46, 0x83, 0x46, 0x83, 0x08, 0x88, 0x46, 0x83, 0x46, 0x83, 0x08, 0x89, 0x46, 0x83, 0x46, 0x83,
+    0x08, 0x8B, 0x46, 0x83, 0x46, 0x84, 0x08, 0x8E, 0x46, 0x83, 0x46, 0x86, 0x07, 0x82, 0x47, 0x82,
+    0x46, 0x8A, 0x07, 0x89, 0x47, 0x81, 0x47, 0x83, 0x05, 0x84, 0x48, 0x00, 0x8D, 0x46, 0x8E, 0x86,
+    0x02, 0x83, 0x89, 0x49, 0x00, 0x89, 0x57, 0x00, 0x82, 0x57, 0x01, 0x89, 0x4E, 0x86, 0x8A, 0x45,
+    0x02, 0x8B, 0x4C, 0x88, 0x00, 0x86, 0x45, 0x03, 0x88, 0x49, 0x8E, 0x84, 0x01, 0x82, 0x45, 0x04,
+    0x81, 0x86, 0x8A, 0x8D, 0x8E, 0x41, 0x8D, 0x8A, 0x85, 0x04, 0x8E, 0x44, 0x8C, 0x45, 0x8E, 0x0B,
+    0x88, 0x46, 0x83, 0x86, 0x46, 0x84, 0x0A, 0x8D, 0x45, 0x8D, 0x00, 0x81, 0x46, 0x8A, 0x09, 0x83,
+    0x46, 0x87, 0x01, 0x8A, 0x46, 0x09, 0x88, 0x46, 0x81, 0x01, 0x84, 0x46, 0x85, 0x08, 0x8E, 0x45,
+    0x8B, 0x03, 0x8E, 0x45, 0x8A, 0x07, 0x83, 0x46, 0x85, 0x03, 0x87, 0x46, 0x07, 0x89, 0x45, 0x8E,
+    0x04, 0x81, 0x46, 0x85, 0x06, 0x8E, 0x45, 0x88, 0x05, 0x8B, 0x45, 0x8B, 0x05, 0x84, 0x46, 0x82,
+    0x05, 0x85, 0x46, 0x81, 0x04, 0x89, 0x45, 0x8C, 0x07, 0x8E, 0x45, 0x86, 0x04, 0x8E, 0x45, 0x86,
+    0x07, 0x89, 0x45, 0x8B, 0x03, 0x84, 0x46, 0x08, 0x82, 0x46, 0x81, 0x02, 0x8A, 0x45, 0x8A, 0x09,
+    0x8C, 0x45, 0x86, 0x02, 0x46, 0x83, 0x09, 0x86, 0x45, 0x8C, 0x01, 0x85, 0x45, 0x8D, 0x0A, 0x81,
+    0x46, 0x81, 0x00, 0x8A, 0x45, 0x87, 0x0B, 0x8A, 0x45, 0x85, 0x00, 0x8E, 0x45, 0x81, 0x0B, 0x84,
+    0x45, 0x89, 0x82, 0x45, 0x8B, 0x0D, 0x8D, 0x44, 0x8D, 0x86, 0x45, 0x85, 0x0D, 0x87, 0x45, 0x88,
+    0x44, 0x8E, 0x0E, 0x81, 0x45, 0x8C, 0x44, 0x88, 0x0F, 0x8B, 0x4A, 0x82, 0x0F, 0x85, 0x49, 0x8C,
+    0x11, 0x8E, 0x48, 0x86, 0x11, 0x88, 0x48, 0x12, 0x82, 0x47, 0x89, 0x13, 0x8C, 0x46, 0x83, 0x09,
+    0x86, 0x46, 0x08, 0x8C, 0x46, 0x8A, 0x07, 0x81, 0x46, 0x82, 0x81, 0x46, 0x84, 0x07, 0x47, 0x8E,
+    0x07, 0x86, 0x45, 0x8D, 0x01, 0x8C, 0x45, 0x89, 0x06, 0x84, 0x48, 0x82, 0x06, 0x8A, 0x45, 0x89,
+    0x01, 0x88, 0x45, 0x8D, 0x06, 0x88, 0x48, 0x86, 0x06, 0x8E, 0x45, 0x84, 0x01, 0x83, 0x46, 0x81,
+    0x05, 0x8D, 0x48, 0x8A, 0x05, 0x83, 0x46, 0x03, 0x8E, 0x45, 0x85, 0x04, 0x81, 0x44, 0x8E, 0x43,
+    0x8E, 0x05, 0x87, 0x45, 0x8B, 0x03, 0x8A, 0x45, 0x89, 0x04, 0x85, 0x44, 0x86, 0x44, 0x82, 0x04,
+    0x8C, 0x45, 0x86, 0x03, 0x85, 0x45, 0x8E, 0x04, 0x89, 0x43, 0x8C, 0x82, 0x44, 0x86, 0x04, 0x46,
+    0x82, 0x03, 0x81, 0x46, 0x82, 0x03, 0x8D, 0x43, 0x89, 0x00, 0x8E, 0x43, 0x8A, 0x03, 0x84, 0x45,
+    0x8D, 0x05, 0x8C, 0x45, 0x86, 0x02, 0x81, 0x44, 0x85, 0x00, 0x8A, 0x43, 0x8E, 0x03, 0x89, 0x45,
+    0x88, 0x05, 0x87, 0x45, 0x8A, 0x02, 0x86, 0x44, 0x81, 0x00, 0x87, 0x44, 0x82, 0x02, 0x8D, 0x45,
+    0x84, 0x05, 0x83, 0x45, 0x8E, 0x02, 0x8A, 0x43, 0x8D, 0x01, 0x83, 0x44, 0x86, 0x01, 0x82, 0x46,
+    0x07, 0x8E, 0x45, 0x82, 0x01, 0x8E, 0x43, 0x8A, 0x02, 0x44, 0x8A, 0x01, 0x85, 0x45, 0x8A, 0x07,
+    0x8A, 0x45, 0x86, 0x00, 0x82, 0x44, 0x86, 0x02, 0x8B, 0x43, 0x8D, 0x01, 0x89, 0x45, 0x86, 0x07,
+    0x85, 0x45, 0x89, 0x00, 0x85, 0x44, 0x82, 0x02, 0x87, 0x44, 0x01, 0x8C, 0x45, 0x81, 0x07, 0x81,
+    0x45, 0x8C, 0x00, 0x88, 0x43, 0x8E, 0x03, 0x84, 0x44, 0x83, 0x00, 0x45, 0x8C, 0x09, 0x8C, 0x44,
+    0x8E, 0x00, 0x8A, 0x43, 0x8B, 0x04, 0x44, 0x86, 0x82, 0x45, 0x88, 0x09, 0x87, 0x45, 0x81, 0x8D,
+    0x43, 0x87, 0x04, 0x8C, 0x43, 0x89, 0x85, 0x45, 0x83, 0x09, 0x83, 0x45, 0x84, 0x44, 0x83, 0x04,
+    0x88, 0x43, 0x8B, 0x87, 0x44, 0x8E, 0x0B, 0x8E, 0x44, 0x88, 0x44, 0x05, 0x85, 0x43, 0x8E, 0x8A,
+    0x44, 0x8A, 0x0B, 0x89, 0x44, 0x8C, 0x43, 0x8C, 0x05, 0x81, 0x44, 0x8D, 0x44, 0x85, 0x0B, 0x85,
+    0x49, 0x88, 0x06, 0x8E, 0x49, 0x81, 0x0B, 0x81, 0x49, 0x84, 0x06, 0x8A, 0x48, 0x8C, 0x0D, 0x8C,
+    0x48, 0x81, 0x06, 0x87, 0x48, 0x87, 0x0D, 0x87, 0x47, 0x8D, 0x07, 0x83, 0x48, 0x82, 0x0D, 0x82,
+    0x47, 0x89, 0x08, 0x47, 0x8E, 0x0F, 0x8E, 0x46, 0x86, 0x08, 0x8C, 0x46, 0x89, 0x07, 0x81, 0x8E,
+    0x46, 0x87, 0x08, 0x88, 0x46, 0x8D, 0x01, 0x84, 0x47, 0x82, 0x06, 0x82, 0x47, 0x83, 0x02, 0x8A,
+    0x46, 0x8B, 0x06, 0x8C, 0x46, 0x89, 0x03, 0x81, 0x8E, 0x46, 0x85, 0x04, 0x86, 0x46, 0x8D, 0x05,
+    0x84, 0x46, 0x8E, 0x03, 0x81, 0x8E, 0x46, 0x83, 0x06, 0x8A, 0x46, 0x89, 0x02, 0x8A, 0x46, 0x88,
+    0x07, 0x81, 0x8E, 0x46, 0x83, 0x00, 0x84, 0x46, 0x8D, 0x09, 0x84, 0x46, 0x8C, 0x00, 0x8D, 0x46,
+    0x83, 0x0A, 0x8A, 0x46, 0x8D, 0x46, 0x88, 0x0B, 0x81, 0x8E, 0x4C, 0x8D, 0x0D, 0x84, 0x4C, 0x83,
+    0x0E, 0x8A, 0x4A, 0x88, 0x0F, 0x81, 0x8E, 0x48, 0x8C, 0x11, 0x8B, 0x48, 0x89, 0x10, 0x85, 0x4A,
+    0x83, 0x0E, 0x81, 0x8E, 0x4A, 0x8D, 0x0E, 0x8B, 0x4C, 0x89, 0x0C, 0x86, 0x4E, 0x84, 0x0A, 0x81,
+    0x46, 0x8E, 0x83, 0x46, 0x8E, 0x0A, 0x8B, 0x46, 0x86, 0x00, 0x87, 0x46, 0x89, 0x08, 0x86, 0x46,
+    0x8C, 0x02, 0x8D, 0x46, 0x84, 0x06, 0x81, 0x47, 0x82, 0x02, 0x83, 0x46, 0x8E, 0x06, 0x8B, 0x46,
+    0x88, 0x04, 0x89, 0x46, 0x89, 0x04, 0x86, 0x46, 0x8D, 0x05, 0x81, 0x8E, 0x46, 0x84, 0x02, 0x81,
+    0x47, 0x84, 0x06, 0x85, 0x46, 0x8E, 0x81, 0x01, 0x8B, 0x46, 0x8A, 0x08, 0x8B, 0x46, 0x8A, 0x00,
+    0x86, 0x46, 0x8E, 0x81, 0x08, 0x82, 0x47, 0x85, 0x8C, 0x46, 0x85, 0x0A, 0x8B, 0x46, 0x83, 0x86,
+    0x46, 0x8A, 0x09, 0x81, 0x46, 0x8D, 0x01, 0x47, 0x09, 0x86, 0x46, 0x87, 0x01, 0x89, 0x46, 0x85,
+    0x08, 0x8B, 0x46, 0x81, 0x01, 0x83, 0x46, 0x8A, 0x08, 0x46, 0x8B, 0x03, 0x8C, 0x46, 0x07, 0x85,
+    0x46, 0x85, 0x03, 0x86, 0x46, 0x85, 0x06, 0x8B, 0x46, 0x05, 0x46, 0x8A, 0x06, 0x46, 0x89, 0x05,
+    0x89, 0x46, 0x05, 0x85, 0x46, 0x83, 0x05, 0x82, 0x46, 0x85, 0x04, 0x8A, 0x45, 0x8D, 0x07, 0x8C,
+    0x45, 0x8B, 0x04, 0x46, 0x87, 0x07, 0x86, 0x46, 0x03, 0x85, 0x46, 0x81, 0x08, 0x46, 0x85, 0x02,
+    0x8A, 0x45, 0x8B, 0x09, 0x89, 0x45, 0x8B, 0x02, 0x46, 0x85, 0x09, 0x82, 0x46, 0x01, 0x85, 0x45,
+    0x8E, 0x0B, 0x8C, 0x45, 0x85, 0x00, 0x8A, 0x45, 0x89, 0x0B, 0x86, 0x45, 0x89, 0x00, 0x8E, 0x45,
+    0x83, 0x0C, 0x8E, 0x44, 0x8D, 0x83, 0x45, 0x8D, 0x0D, 0x89, 0x45, 0x86, 0x45, 0x87, 0x0D, 0x82,
+    0x45, 0x8B, 0x45, 0x81, 0x0E, 0x8C, 0x4A, 0x8B, 0x0F, 0x85, 0x4A, 0x85, 0x10, 0x8E, 0x48, 0x8E,
+    0x11, 0x89, 0x48, 0x88, 0x11, 0x82, 0x48, 0x82, 0x12, 0x8C, 0x46, 0x8C, 0x13, 0x85, 0x46, 0x86,
+    0x13, 0x85, 0x46, 0x81, 0x13, 0x8A, 0x45, 0x8A, 0x13, 0x82, 0x46, 0x84, 0x13, 0x8B, 0x45, 0x8E,
+    0x13, 0x88, 0x46, 0x87, 0x0C, 0x81, 0x82, 0x01, 0x81, 0x85, 0x8C, 0x47, 0x81, 0x0C, 0x84, 0x4C,
+    0x87, 0x0D, 0x84, 0x4B, 0x8C, 0x0E, 0x84, 0x4A, 0x8D, 0x81, 0x0E, 0x84, 0x49, 0x8C, 0x81, 0x0F,
+    0x84, 0x47, 0x8E, 0x86, 0x11, 0x82, 0x8B, 0x8D, 0x41, 0x8E, 0x8D, 0x8A, 0x85, 0x12, 0x00, 0x8E,
+    0x52, 0x87, 0x00, 0x8E, 0x52, 0x87, 0x00, 0x8E, 0x52, 0x87, 0x00, 0x8E, 0x52, 0x87, 0x00, 0x8E,
+    0x52, 0x87, 0x00, 0x89, 0xFB, 0xAB, 0x46, 0x8E, 0x81, 0x0B, 0x89, 0x46, 0x83, 0x0B, 0x85, 0x46,
+    0x87, 0x0B, 0x82, 0x46, 0x8B, 0x0C, 0x8D, 0x45, 0x8E, 0x81, 0x0B, 0x89, 0x46, 0x83, 0x0B, 0x85,
+    0x46, 0x87, 0x0B, 0x82, 0x46, 0x8B, 0x0C, 0x8D, 0x45, 0x8E, 0x81, 0x0B, 0x89, 0x46, 0x84, 0x0B,
+    0x85, 0x46, 0x87, 0x0B, 0x82, 0x46, 0x8B, 0x0C, 0x8C, 0x45, 0x8E, 0x81, 0x0B, 0x89, 0x46, 0x84,
+    0x0B, 0x85, 0x46, 0x88, 0x0B, 0x82, 0x46, 0x8B, 0x0C, 0x8C, 0x46, 0x8C, 0xFB, 0xAB, 0x89, 0x88,
+    0x53, 0x8E, 0x8A, 0x53, 0x8E, 0x8A, 0x53, 0x8E, 0x8A, 0x53, 0x8E, 0x8A, 0x53, 0x8E, 0x0A, 0x85,
+    0x89, 0x8B, 0x8D, 0x8E, 0x40, 0x8B, 0x08, 0x87, 0x46, 0x8B, 0x07, 0x8A, 0x47, 0x8B, 0x06, 0x84,
+    0x48, 0x8B, 0x06, 0x8A, 0x48, 0x8B, 0x06, 0x8E, 0x46, 0x8D, 0x89, 0x85, 0x06, 0x46, 0x86, 0x09,
+    0x45, 0x8B, 0x0A, 0x45, 0x88, 0x0A, 0x45, 0x87, 0x0A, 0x45, 0x87, 0x0A, 0x45, 0x87, 0x0A, 0x45,
+    0x87, 0x0A, 0x45, 0x87, 0x0A, 0x45, 0x87, 0x09, 0x81, 0x45, 0x87, 0x09, 0x85, 0x45, 0x86, 0x08,
+    0x82, 0x8E, 0x45, 0x84, 0x06, 0x83, 0x88, 0x47, 0x04, 0x83, 0x4A, 0x86, 0x04, 0x84, 0x49, 0x86,
+    0x05, 0x84, 0x46, 0x8B, 0x86, 0x81, 0x06, 0x84, 0x46, 0x8B, 0x87, 0x81, 0x06, 0x84, 0x49, 0x87,
+    0x05, 0x83, 0x4A, 0x88, 0x07, 0x83, 0x89, 0x47, 0x81, 0x08, 0x83, 0x8E, 0x45, 0x85, 0x09, 0x86,
+    0x45, 0x87, 0x09, 0x81, 0x45, 0x87, 0x0A, 0x45, 0x87, 0x0A, 0x45, 0x87, 0x0A, 0x45, 0x87, 0x0A,
+    0x45, 0x87, 0x0A, 0x45, 0x87, 0x0A, 0x45, 0x87, 0x0A, 0x45, 0x88, 0x0A, 0x45, 0x8B, 0x0A, 0x46,
+    0x86, 0x09, 0x8E, 0x46, 0x8D, 0x8A, 0x86, 0x06, 0x8A, 0x48, 0x8B, 0x06, 0x84, 0x48, 0x8B, 0x07,
+    0x8A, 0x47, 0x8B, 0x08, 0x87, 0x46, 0x8B, 0x0A, 0x85, 0x89, 0x8B, 0x8D, 0x8E, 0x40, 0x8B, 0x8E,
+    0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43,
+    0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87,
+    0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E,
+    0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43,
+    0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87,
+    0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E,
+    0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43,
+    0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87,
+    0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E,
+    0x43, 0x87, 0x41, 0x8E, 0x8D, 0x8B, 0x88, 0x84, 0x09, 0x46, 0x8E, 0x86, 0x07, 0x48, 0x87, 0x06,
+    0x49, 0x81, 0x05, 0x49, 0x87, 0x05, 0x88, 0x8A, 0x8E, 0x46, 0x89, 0x08, 0x8A, 0x45, 0x8A, 0x09,
+    0x45, 0x8B, 0x09, 0x8D, 0x44, 0x8B, 0x09, 0x8C, 0x44, 0x8B, 0x09, 0x8C, 0x44, 0x8B, 0x09, 0x8C,
+    0x44, 0x8B, 0x09, 0x8C, 0x44, 0x8B, 0x09, 0x8C, 0x44, 0x8B, 0x09, 0x8C, 0x44, 0x8B, 0x09, 0x8C,
+    0x44, 0x8C, 0x09, 0x8B, 0x45, 0x09, 0x89, 0x45, 0x8A, 0x08, 0x84, 0x46, 0x8C, 0x85, 0x82, 0x06,
+    0x8B, 0x49, 0x8E, 0x05, 0x89, 0x49, 0x06, 0x82, 0x88, 0x8C, 0x46, 0x06, 0x83, 0x88, 0x8C, 0x46,
+    0x04, 0x81, 0x8B, 0x49, 0x04, 0x8C, 0x49, 0x8E, 0x03, 0x86, 0x46, 0x8D, 0x86, 0x82, 0x05, 0x8A,
+    0x45, 0x8A, 0x08, 0x8B, 0x45, 0x81, 0x08, 0x8C, 0x44, 0x8C, 0x09, 0x8C, 0x44, 0x8B, 0x09, 0x8C,
+    0x44, 0x8B, 0x09, 0x8C, 0x44, 0x8B, 0x09, 0x8C, 0x44, 0x8B, 0x09, 0x8C, 0x44, 0x8B, 0x09, 0x8C,
+    0x44, 0x8B, 0x09, 0x8D, 0x44, 0x8B, 0x08, 0x81, 0x45, 0x8B, 0x08, 0x8A, 0x45, 0x8A, 0x05, 0x88,
+    0x8A, 0x8E, 0x46, 0x89, 0x05, 0x49, 0x87, 0x05, 0x49, 0x82, 0x05, 0x48, 0x87, 0x06, 0x46, 0x8E,
+    0x86, 0x07, 0x41, 0x8E, 0x8D, 0x8B, 0x88, 0x84, 0x09, 0x1B, 0x85, 0x8B, 0x8E, 0x40, 0x8E, 0x8C,
+    0x88, 0x83, 0x0B, 0x82, 0x85, 0x00, 0x82, 0x8C, 0x47, 0x8D, 0x85, 0x08, 0x82, 0x8D, 0x86, 0x82,
+    0x8E, 0x4A, 0x8D, 0x86, 0x05, 0x85, 0x8E, 0x40, 0x86, 0x8C, 0x4E, 0x8A, 0x87, 0x85, 0x87, 0x8C,
+    0x42, 0x86, 0x8D, 0x56, 0x86, 0x8D, 0x42, 0x89, 0x96, 0x88, 0x8D, 0x4E, 0x85, 0x8D, 0x40, 0x8B,
+    0x81, 0x04, 0x82, 0x8A, 0x4B, 0x89, 0x00, 0x8D, 0x89, 0x08, 0x82, 0x89, 0x48, 0x88, 0x01, 0x87,
+    0x0B, 0x81, 0x86, 0x8B, 0x8E, 0x41, 0x8D, 0x89, 0x82, 0x1B, 0x01, 0x84, 0x8C, 0x41, 0x8D, 0x87,
+    0x02, 0x85, 0x45, 0x89, 0x01, 0x8D, 0x46, 0x82, 0x81, 0x47, 0x85, 0x81, 0x47, 0x86, 0x00, 0x47,
+    0x83, 0x00, 0x89, 0x45, 0x8D, 0x02, 0x89, 0x43, 0x8C, 0x82, 0x03, 0x81, 0x94, 0x82, 0x22, 0x87,
+    0xC8, 0x03, 0x45, 0x81, 0x02, 0x45, 0x82, 0x02, 0x45, 0x83, 0x01, 0x81, 0x45, 0x84, 0x01, 0x82,
+    0x45, 0x84, 0x01, 0x83, 0x45, 0x85, 0x01, 0x84, 0x45, 0x86, 0x01, 0x85, 0x45, 0x87, 0x01, 0x85,
+    0x45, 0x88, 0x01, 0x86, 0x45, 0x89, 0x01, 0x87, 0x45, 0x8A, 0x01, 0x88, 0x45, 0x8A, 0x01, 0x89,
+    0x45, 0x8B, 0x01, 0x8A, 0x45, 0x8C, 0x01, 0x8B, 0x45, 0x8D, 0x01, 0x8B, 0x45, 0x8E, 0x01, 0x8C,
+    0x46, 0x01, 0x8D, 0x46, 0x01, 0x8E, 0x46, 0x01, 0x47, 0x81, 0x00, 0x47, 0x82, 0x81, 0x47, 0x83,
+    0x81, 0x47, 0x84, 0x09, 0x84, 0x43, 0x81, 0x10, 0x84, 0x43, 0x81, 0x10, 0x84, 0x43, 0x81, 0x10,
+    0x84, 0x43, 0x81, 0x0E, 0x85, 0x88, 0x8C, 0x44, 0x8D, 0x8B, 0x88, 0x84, 0x08, 0x88, 0x8E, 0x4B,
+    0x8E, 0x89, 0x81, 0x03, 0x84, 0x8E, 0x4F, 0x82, 0x02, 0x84, 0x50, 0x8B, 0x02, 0x82, 0x51, 0x85,
+    0x02, 0x8B, 0x50, 0x8E, 0x02, 0x84, 0x47, 0x8E, 0x86, 0x81, 0x01, 0x81, 0x84, 0x89, 0x8E, 0x40,
+    0x89, 0x02, 0x89, 0x46, 0x8C, 0x08, 0x84, 0x82, 0x02, 0x8E, 0x46, 0x82, 0x0C, 0x81, 0x46, 0x8B,
+    0x0D, 0x84, 0x46, 0x86, 0x0D, 0x86, 0x46, 0x83, 0x0D, 0x87, 0x46, 0x82, 0x0D, 0x88, 0x46, 0x81,
+    0x0D, 0x87, 0x46, 0x82, 0x0D, 0x86, 0x46, 0x83, 0x0D, 0x85, 0x46, 0x86, 0x0D, 0x82, 0x46, 0x8B,
+    0x0E, 0x47, 0x83, 0x0D, 0x8A, 0x46, 0x8D, 0x81, 0x07, 0x81, 0x97, 0x01, 0x84, 0x47, 0x8E, 0x87,
+    0x83, 0x91, 0x82, 0x84, 0x87, 0x8B, 0x41, 0x89, 0x02, 0x8C, 0x51, 0x89, 0x02, 0x82, 0x51, 0x89,
+    0x03, 0x85, 0x50, 0x89, 0x04, 0x84, 0x8E, 0x4E, 0x89, 0x05, 0x81, 0x89, 0x8E, 0x4B, 0x8B, 0x83,
+    0x08, 0x85, 0x88, 0x8C, 0x44, 0x8D, 0x8A, 0x86, 0x81, 0x0C, 0x84, 0x43, 0x81, 0x10, 0x84, 0x43,
+    0x81, 0x10, 0x84, 0x43, 0x81, 0x10, 0x84, 0x43, 0x81, 0x10, 0x84, 0x43, 0x81, 0x06, 0x09, 0x84,
+    0x88, 0x8C, 0x8E, 0x41, 0x8E, 0x8D, 0x8B, 0x88, 0x85, 0x81, 0x0B, 0x85, 0x8D, 0x4B, 0x8C, 0x86,
+    0x81, 0x07, 0x89, 0x4F, 0x86, 0x06, 0x88, 0x50, 0x06, 0x83, 0x50, 0x89, 0x06, 0x8B, 0x50, 0x83,
+    0x05, 0x81, 0x47, 0x89, 0x83, 0x91, 0x83, 0x86, 0x8A, 0x8E, 0x40, 0x8C, 0x06, 0x85, 0x46, 0x88,
+    0x07, 0x85, 0x84, 0x06, 0x87, 0x46, 0x11, 0x88, 0x45, 0x8C, 0x11, 0x89, 0x45, 0x8C, 0x11, 0x89,
+    0x45, 0x8C, 0x11, 0x89, 0x45, 0x8C, 0x11, 0x89, 0x45, 0x8C, 0x11, 0x89, 0x45, 0x8C, 0x0D, 0x53,
+    0x8E, 0x04, 0x53, 0x8E, 0x04, 0x53, 0x8E, 0x04, 0x53, 0x8E, 0x04, 0x53, 0x8E, 0x04, 0xB5, 0x8B,
+    0x45, 0x8D, 0xF5, 0x84, 0x08, 0x89, 0x45, 0x8C, 0x11, 0x89, 0x45, 0x8C, 0x11, 0x89, 0x45, 0x8B,
+    0x11, 0x8A, 0x45, 0x8A, 0x11, 0x8C, 0x45, 0x88, 0x10, 0x81, 0x46, 0x82, 0x10, 0x88, 0x45, 0x89,
+    0x10, 0x87, 0x45, 0x8A, 0x0F, 0x84, 0x8C, 0x45, 0x8B, 0xF5, 0xF5, 0x83, 0x58, 0x89, 0x58, 0x89,
+    0x58, 0x89, 0x58, 0x89, 0x58, 0x89, 0x58, 0x89, 0x02, 0x82, 0x89, 0x0D, 0x84, 0x88, 0x04, 0x82,
+    0x8E, 0x40, 0x8B, 0x0B, 0x83, 0x41, 0x89, 0x02, 0x82, 0x8E, 0x42, 0x8B, 0x00, 0x84, 0x8A, 0x8D,
+    0x42, 0x8C, 0x87, 0x00, 0x83, 0x43, 0x89, 0x01, 0x8E, 0x44, 0x8E, 0x47, 0x8E, 0x45, 0x88, 0x00,
+    0x87, 0x53, 0x8D, 0x81, 0x01, 0x86, 0x51, 0x8D, 0x81, 0x03, 0x86, 0x4F, 0x8D, 0x81, 0x04, 0x87,
+    0x44, 0x8D, 0x85, 0x81, 0x00, 0x82, 0x89, 0x45, 0x81, 0x04, 0x8D, 0x43, 0x8D, 0x81, 0x04, 0x84,
+    0x44, 0x87, 0x03, 0x82, 0x44, 0x82, 0x06, 0x88, 0x43, 0x8B, 0x03, 0x85, 0x43, 0x8C, 0x07, 0x83,
+    0x43, 0x8E, 0x03, 0x86, 0x43, 0x8A, 0x07, 0x81, 0x43, 0x8E, 0x03, 0x85, 0x43, 0x8C, 0x07, 0x82,
+    0x43, 0x8E, 0x03, 0x82, 0x44, 0x82, 0x06, 0x88, 0x43, 0x8B, 0x04, 0x8E, 0x43, 0x8C, 0x05, 0x84,
+    0x44, 0x87, 0x04, 0x87, 0x44, 0x8D, 0x85, 0x81, 0x00, 0x82, 0x88, 0x45, 0x81, 0x04, 0x86, 0x4F,
+    0x8D, 0x04, 0x85, 0x51, 0x8C, 0x02, 0x86, 0x53, 0x8C, 0x81, 0x00, 0x8D, 0x54, 0x86, 0x00, 0x81,
+    0x8D, 0x42, 0x8A, 0x00, 0x85, 0x8A, 0x8E, 0x42, 0x8C, 0x87, 0x81, 0x84, 0x43, 0x88, 0x02, 0x81,
+    0x8D, 0x40, 0x8A, 0x0B, 0x84, 0x41, 0x88, 0x04, 0x81, 0x88, 0x0D, 0x84, 0x87, 0x02, 0x89, 0x46,
+    0x81, 0x0A, 0x88, 0x46, 0x91, 0x46, 0x88, 0x0A, 0x8E, 0x45, 0x89, 0x01, 0x89, 0x45, 0x8E, 0x09,
+    0x86, 0x46, 0x81, 0x01, 0x81, 0x46, 0x86, 0x08, 0x8D, 0x45, 0x88, 0x03, 0x88, 0x45, 0x8D, 0x07,
+    0x84, 0x46, 0x81, 0x03, 0x81, 0x46, 0x84, 0x06, 0x8B, 0x45, 0x87, 0x05, 0x88, 0x45, 0x8B, 0x05,
+    0x82, 0x45, 0x8E, 0x06, 0x81, 0x46, 0x82, 0x04, 0x8A, 0x45, 0x87, 0x07, 0x88, 0x45, 0x89, 0x03,
+    0x81, 0x45, 0x8E, 0x08, 0x81, 0x46, 0x81, 0x02, 0x88, 0x45, 0x86, 0x09, 0x87, 0x45, 0x87, 0x02,
+    0x8E, 0x44, 0x8D, 0x0B, 0x8E, 0x44, 0x8E, 0x01, 0x86, 0x45, 0x85, 0x0B, 0x87, 0x45, 0x86, 0x00,
+    0x8D, 0x44, 0x8D, 0x0D, 0x8E, 0x44, 0x8D, 0x84, 0x45, 0x85, 0x0D, 0x87, 0x45, 0x8E, 0x44, 0x8C,
+    0x0F, 0x8E, 0x4A, 0x84, 0x0F, 0x86, 0x49, 0x8C, 0x11, 0x8E, 0x48, 0x84, 0x0C, 0x84, 0x51, 0x8C,
+    0x08, 0x84, 0x51, 0x8C, 0x08, 0x84, 0x51, 0x8C, 0x08, 0x84, 0x51, 0x8C, 0x08, 0x81, 0xC5, 0x88,
+    0x45, 0x8D, 0xC5, 0x84, 0x0E, 0x84, 0x45, 0x8C, 0x14, 0x84, 0x45, 0x8C, 0x14, 0x84, 0x45, 0x8C,
+    0x0E, 0x84, 0x51, 0x8C, 0x08, 0x84, 0x51, 0x8C, 0x08, 0x84, 0x51, 0x8C, 0x08, 0x84, 0x51, 0x8C,
+    0x08, 0x81, 0xC5, 0x88, 0x45, 0x8D, 0xC5, 0x84, 0x0E, 0x84, 0x45, 0x8C, 0x14, 0x84, 0x45, 0x8C,
+    0x14, 0x84, 0x45, 0x8C, 0x14, 0x84, 0x45, 0x8C, 0x14, 0x84, 0x45, 0x8C, 0x0A, 0x8E, 0x43, 0x87,
+    0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E,
+    0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43,
+    0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87,
+    0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x35, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87,
+    0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E,
+    0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43,
+    0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87,
+    0x8E, 0x43, 0x87, 0x8E, 0x43, 0x87, 0x04, 0x81, 0x86, 0x8A, 0x8D, 0x8E, 0x41, 0x8E, 0x8C, 0x89,
+    0x86, 0x81, 0x05, 0x81, 0x89, 0x4B, 0x8C, 0x86, 0x81, 0x01, 0x82, 0x8D, 0x4E, 0x88, 0x01, 0x8D,
+    0x4F, 0x81, 0x00, 0x88, 0x45, 0x8E, 0x8B, 0x8A, 0x8B, 0x8D, 0x44, 0x8A, 0x01, 0x8D, 0x44, 0x88,
+    0x04, 0x81, 0x85, 0x8C, 0x41, 0x83, 0x01, 0x45, 0x08, 0x83, 0x87, 0x02, 0x45, 0x0D, 0x8D, 0x44,
+    0x8A, 0x0C, 0x88, 0x45, 0x8D, 0x84, 0x0A, 0x81, 0x8E, 0x46, 0x8D, 0x86, 0x09, 0x83, 0x8E, 0x48,
+    0x89, 0x81, 0x07, 0x82, 0x4A, 0x88, 0x05, 0x81, 0x8C, 0x4B, 0x8D, 0x82, 0x03, 0x8B, 0x44, 0x8D,
+    0x47, 0x8E, 0x82, 0x01, 0x85, 0x44, 0x87, 0x00, 0x81, 0x87, 0x8E, 0x45, 0x8D, 0x01, 0x8B, 0x43,
+    0x8C, 0x04, 0x87, 0x45, 0x85, 0x00, 0x8E, 0x43, 0x87, 0x05, 0x86, 0x44, 0x8A, 0x00, 0x44, 0x88,
+    0x06, 0x8D, 0x43, 0x8C, 0x00, 0x44, 0x8E, 0x06, 0x8B, 0x43, 0x8C, 0x00, 0x8B, 0x44, 0x8C, 0x81,
+    0x04, 0x8D, 0x43, 0x8A, 0x00, 0x85, 0x46, 0x87, 0x02, 0x84, 0x44, 0x86, 0x01, 0x8B, 0x46, 0x8E,
+    0x88, 0x85, 0x8E, 0x44, 0x81, 0x01, 0x81, 0x8C, 0x4D, 0x85, 0x04, 0x87, 0x4B, 0x86, 0x06, 0x81,
+    0x89, 0x49, 0x87, 0x08, 0x81, 0x87, 0x8E, 0x47, 0x88, 0x0A, 0x85, 0x8D, 0x46, 0x83, 0x0B, 0x86,
+    0x45, 0x89, 0x0C, 0x87, 0x44, 0x8C, 0x0C, 0x83, 0x44, 0x8C, 0x85, 0x89, 0x82, 0x09, 0x85, 0x44,
+    0x8B, 0x86, 0x41, 0x8C, 0x87, 0x82, 0x05, 0x83, 0x8E, 0x44, 0x87, 0x86, 0x44, 0x8E, 0x8B, 0x8A,
+    0x89, 0x8A, 0x8D, 0x46, 0x81, 0x86, 0x50, 0x85, 0x00, 0x86, 0x4F, 0x86, 0x01, 0x81, 0x87, 0x8E,
+    0x4B, 0x8B, 0x82, 0x05, 0x83, 0x87, 0x8A, 0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x87, 0x82, 0x04,
+    0x01, 0x82, 0x86, 0x87, 0x84, 0x05, 0x83, 0x97, 0x84, 0x02, 0x85, 0x43, 0x8B, 0x03, 0x87, 0x43,
+    0x8A, 0x01, 0x45, 0x86, 0x01, 0x81, 0x45, 0x84, 0x82, 0x45, 0x89, 0x01, 0x84, 0x45, 0x88, 0x81,
+    0x45, 0x88, 0x01, 0x83, 0x45, 0x86, 0x00, 0x8B, 0x44, 0x82, 0x02, 0x8D, 0x43, 0x8E, 0x81, 0x00,
+    0x81, 0x89, 0x8E, 0x40, 0x8C, 0x83, 0x03, 0x82, 0x8A, 0x8E, 0x40, 0x8B, 0x83, 0x00, 0x0C, 0x83,
+    0x87, 0x8A, 0x8D, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x86, 0x81, 0x16, 0x81, 0x88, 0x8E, 0x4B, 0x8B,
+    0x84, 0x13, 0x88, 0x50, 0x8C, 0x83, 0x0F, 0x83, 0x8D, 0x45, 0x8D, 0x8A, 0x88, 0x87, 0x88, 0x89,
+    0x8B, 0x8E, 0x45, 0x89, 0x0D, 0x85, 0x44, 0x8D, 0x87, 0x81, 0x07, 0x84, 0x89, 0x44, 0x8C, 0x81,
+    0x0A, 0x86, 0x43, 0x8E, 0x85, 0x0C, 0x81, 0x89, 0x43, 0x8E, 0x81, 0x08, 0x84, 0x43, 0x8A, 0x81,
+    0x0F, 0x84, 0x8E, 0x42, 0x8D, 0x81, 0x06, 0x82, 0x43, 0x88, 0x05, 0x85, 0x8A, 0x8D, 0x8E, 0x40,
+    0x8E, 0x8D, 0x8A, 0x86, 0x81, 0x02, 0x81, 0x8D, 0x42, 0x8A, 0x06, 0x8C, 0x42, 0x89, 0x04, 0x86,
+    0x8E, 0x49, 0x8B, 0x84, 0x01, 0x81, 0x8E, 0x42, 0x85, 0x04, 0x85, 0x42, 0x8B, 0x04, 0x89, 0x4C,
+    0x8B, 0x02, 0x82, 0x42, 0x8E, 0x04, 0x8D, 0x42, 0x81, 0x03, 0x88, 0x4D, 0x83, 0x03, 0x87, 0x42,
+    0x87, 0x02, 0x84, 0x42, 0x88, 0x03, 0x83, 0x46, 0x8C, 0x9A, 0x8C, 0x42, 0x8C, 0x05, 0x8E, 0x41,
+    0x8E, 0x02, 0x8A, 0x42, 0x81, 0x03, 0x8B, 0x44, 0x8D, 0x83, 0x04, 0x84, 0x8B, 0x85, 0x05, 0x87,
+    0x42, 0x83, 0x01, 0x42, 0x8A, 0x03, 0x81, 0x45, 0x82, 0x0E, 0x81, 0x42, 0x89, 0x00, 0x82, 0x42,
+    0x85, 0x03, 0x85, 0x44, 0x88, 0x10, 0x8C, 0x41, 0x8C, 0x00, 0x85, 0x42, 0x82, 0x03, 0x89, 0x44,
+    0x82, 0x10, 0x88, 0x42, 0x00, 0x87, 0x42, 0x04, 0x8A, 0x44, 0x11, 0x86, 0x42, 0x00, 0x88, 0x42,
+    0x04, 0x8B, 0x43, 0x8E, 0x11, 0x85, 0x42, 0x81, 0x88, 0x41, 0x8E, 0x04, 0x8B, 0x43, 0x8E, 0x11,
+    0x85, 0x42, 0x81, 0x87, 0x42, 0x04, 0x8A, 0x44, 0x11, 0x86, 0x42, 0x00, 0x86, 0x42, 0x82, 0x03,
+    0x88, 0x44, 0x82, 0x10, 0x88, 0x42, 0x00, 0x83, 0x42, 0x85, 0x03, 0x85, 0x44, 0x87, 0x10, 0x8C,
+    0x41, 0x8C, 0x01, 0x42, 0x8A, 0x03, 0x81, 0x44, 0x8E, 0x81, 0x0E, 0x81, 0x42, 0x89, 0x01, 0x8A,
+    0x42, 0x04, 0x8A, 0x44, 0x8C, 0x82, 0x04, 0x82, 0x87, 0x8B, 0x05, 0x87, 0x42, 0x84, 0x01, 0x85,
+    0x42, 0x87, 0x03, 0x82, 0x46, 0x8C, 0x9A, 0x8C, 0x8E, 0x41, 0x8D, 0x05, 0x8E, 0x41, 0x8E, 0x03,
+    0x8D, 0x42, 0x81, 0x03, 0x86, 0x4C, 0x8D, 0x04, 0x87, 0x42, 0x87, 0x03, 0x86, 0x42, 0x8B, 0x04,
+    0x88, 0x4B, 0x8D, 0x03, 0x82, 0x42, 0x8E, 0x05, 0x8C, 0x42, 0x88, 0x04, 0x85, 0x8D, 0x49, 0x8A,
+    0x02, 0x81, 0x8D, 0x42, 0x85, 0x05, 0x82, 0x43, 0x87, 0x05, 0x85, 0x89, 0x8D, 0x8E, 0x41, 0x8E,
+    0x8B, 0x87, 0x82, 0x02, 0x81, 0x8D, 0x42, 0x8B, 0x07, 0x85, 0x43, 0x8A, 0x10, 0x83, 0x8E, 0x42,
+    0x8D, 0x81, 0x08, 0x86, 0x43, 0x8E, 0x85, 0x0C, 0x81, 0x88, 0x43, 0x8E, 0x82, 0x0A, 0x85, 0x44,
+    0x8D, 0x86, 0x81, 0x07, 0x83, 0x88, 0x44, 0x8D, 0x81, 0x0C, 0x83, 0x8D, 0x45, 0x8D, 0x8A, 0x88,
+    0x97, 0x88, 0x8B, 0x8E, 0x45, 0x89, 0x10, 0x88, 0x50, 0x8D, 0x84, 0x12, 0x81, 0x88, 0x8E, 0x4B,
+    0x8C, 0x85, 0x17, 0x83, 0x87, 0x8B, 0x8D, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x86, 0x81, 0x0C, 0x03,
+    0x85, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8A, 0x84, 0x03, 0x82, 0x89, 0x49, 0x8B, 0x81, 0x01, 0x8A,
+    0x4B, 0x8B, 0x01, 0x83, 0x44, 0x8D, 0x8E, 0x45, 0x85, 0x01, 0x8B, 0x40, 0x89, 0x84, 0x02, 0x81,
+    0x8C, 0x43, 0x8A, 0x01, 0x91, 0x05, 0x82, 0x43, 0x8E, 0x07, 0x81, 0x82, 0x83, 0x44, 0x02, 0x83,
+    0x88, 0x8B, 0x8E, 0x48, 0x00, 0x81, 0x8B, 0x4C, 0x00, 0x8D, 0x45, 0x8E, 0x8C, 0x8B, 0x44, 0x87,
+    0x44, 0x86, 0x03, 0x8E, 0x43, 0x8C, 0x43, 0x86, 0x04, 0x44, 0x8D, 0x43, 0x83, 0x03, 0x86, 0x44,
+    0x8C, 0x43, 0x87, 0x02, 0x85, 0x45, 0x88, 0x44, 0x8C, 0x8B, 0x8E, 0x46, 0x82, 0x49, 0x87, 0x8E,
+    0x42, 0x00, 0x85, 0x47, 0x87, 0x00, 0x8A, 0x42, 0x01, 0x82, 0x89, 0x8D, 0x41, 0x8D, 0x88, 0x82,
+    0x01, 0x86, 0x42, 0x07, 0x85, 0x8C, 0x83, 0x08, 0x81, 0x8C, 0x86, 0x0A, 0x83, 0x42, 0x8A, 0x82,
+    0x06, 0x8C, 0x41, 0x8D, 0x85, 0x07, 0x81, 0x8E, 0x44, 0x89, 0x81, 0x03, 0x89, 0x44, 0x8C, 0x83,
+    0x05, 0x8B, 0x45, 0x8D, 0x81, 0x02, 0x86, 0x46, 0x84, 0x04, 0x89, 0x46, 0x82, 0x02, 0x83, 0x46,
+    0x88, 0x04, 0x86, 0x46, 0x85, 0x02, 0x81, 0x8E, 0x45, 0x8B, 0x04, 0x83, 0x46, 0x88, 0x03, 0x8C,
+    0x45, 0x8D, 0x04, 0x81, 0x8E, 0x45, 0x8B, 0x03, 0x8A, 0x46, 0x82, 0x04, 0x8C, 0x45, 0x8E, 0x81,
+    0x02, 0x87, 0x46, 0x85, 0x04, 0x89, 0x46, 0x83, 0x02, 0x84, 0x46, 0x88, 0x04, 0x86, 0x46, 0x86,
+    0x02, 0x82, 0x8E, 0x45, 0x8B, 0x05, 0x46, 0x8C, 0x03, 0x89, 0x46, 0x82, 0x05, 0x87, 0x46, 0x86,
+    0x02, 0x82, 0x46, 0x8B, 0x06, 0x8A, 0x46, 0x83, 0x02, 0x84, 0x46, 0x88, 0x06, 0x8C, 0x45, 0x8E,
+    0x81, 0x02, 0x87, 0x46, 0x85, 0x05, 0x81, 0x8E, 0x45, 0x8B, 0x03, 0x8A, 0x46, 0x82, 0x05, 0x83,
+    0x46, 0x88, 0x03, 0x8D, 0x45, 0x8D, 0x06, 0x86, 0x46, 0x85, 0x02, 0x82, 0x8E, 0x45, 0x8B, 0x06,
+    0x89, 0x46, 0x82, 0x02, 0x84, 0x46, 0x88, 0x06, 0x8C, 0x45, 0x8D, 0x81, 0x02, 0x87, 0x46, 0x84,
+    0x05, 0x81, 0x8E, 0x44, 0x89, 0x81, 0x03, 0x8A, 0x44, 0x8C, 0x83, 0x06, 0x83, 0x42, 0x8A, 0x82,
+    0x06, 0x8C, 0x41, 0x8D, 0x85, 0x09, 0x85, 0x8C, 0x83, 0x08, 0x81, 0x8C, 0x86, 0x03, 0x8D, 0x56,
+    0x86, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x84, 0xF5, 0xF5,
+    0x95, 0x44, 0x86, 0x12, 0x44, 0x86, 0x12, 0x44, 0x86, 0x12, 0x44, 0x86, 0x12, 0x44, 0x86, 0x12,
+    0x44, 0x86, 0x12, 0x44, 0x86, 0x12, 0x44, 0x86, 0x12, 0x44, 0x86, 0x88, 0x4B, 0x89, 0x88, 0x4B,
+    0x89, 0x88, 0x4B, 0x89, 0x88, 0x4B, 0x89, 0x88, 0x4B, 0x89, 0x88, 0x4B, 0x89, 0x00, 0xF1, 0xB1,
+    0x00, 0x0C, 0x83, 0x87, 0x8A, 0x8D, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x86, 0x81, 0x16, 0x81, 0x88,
+    0x8E, 0x4B, 0x8B, 0x84, 0x13, 0x88, 0x50, 0x8C, 0x83, 0x0F, 0x83, 0x8D, 0x45, 0x8D, 0x8A, 0x88,
+    0x87, 0x88, 0x89, 0x8B, 0x8E, 0x45, 0x89, 0x0D, 0x85, 0x44, 0x8D, 0x87, 0x81, 0x07, 0x84, 0x89,
+    0x44, 0x8C, 0x81, 0x0A, 0x86, 0x43, 0x8E, 0x85, 0x0C, 0x81, 0x89, 0x43, 0x8E, 0x81, 0x08, 0x84,
+    0x43, 0x8A, 0x81, 0x0F, 0x84, 0x8E, 0x42, 0x8D, 0x81, 0x06, 0x82, 0x43, 0x88, 0x01, 0x8C, 0x46,
+    0x8E, 0x8C, 0x88, 0x83, 0x04, 0x81, 0x8D, 0x42, 0x8A, 0x06, 0x8C, 0x42, 0x89, 0x02, 0x8C, 0x4A,
+    0x8B, 0x81, 0x03, 0x81, 0x8E, 0x42, 0x85, 0x04, 0x85, 0x42, 0x8B, 0x03, 0x8C, 0x4B, 0x8D, 0x81,
+    0x03, 0x82, 0x42, 0x8E, 0x04, 0x8D, 0x42, 0x81, 0x03, 0x8C, 0x4C, 0x88, 0x04, 0x87, 0x42, 0x87,
+    0x02, 0x84, 0x42, 0x88, 0x04, 0x8C, 0x43, 0x8D, 0x81, 0x83, 0x88, 0x44, 0x8E, 0x05, 0x8E, 0x41,
+    0x8E, 0x02, 0x8A, 0x42, 0x81, 0x04, 0x8C, 0x43, 0x8D, 0x02, 0x8A, 0x44, 0x82, 0x04, 0x87, 0x42,
+    0x83, 0x01, 0x42, 0x8A, 0x05, 0x8C, 0x43, 0x8D, 0x02, 0x87, 0x44, 0x83, 0x04, 0x81, 0x42, 0x89,
+    0x00, 0x82, 0x42, 0x85, 0x05, 0x8C, 0x43, 0x8D, 0x02, 0x87, 0x44, 0x82, 0x05, 0x8C, 0x41, 0x8C,
+    0x00, 0x85, 0x42, 0x82, 0x05, 0x8C, 0x43, 0x8D, 0x02, 0x8B, 0x44, 0x06, 0x88, 0x42, 0x00, 0x87,
+    0x42, 0x06, 0x8C, 0x43, 0x8D, 0x81, 0x83, 0x88, 0x44, 0x8B, 0x06, 0x86, 0x42, 0x00, 0x88, 0x42,
+    0x06, 0x8C, 0x4C, 0x83, 0x06, 0x85, 0x42, 0x81, 0x88, 0x41, 0x8E, 0x06, 0x8C, 0x4B, 0x85, 0x07,
+    0x85, 0x42, 0x81, 0x87, 0x42, 0x06, 0x8C, 0x49, 0x8E, 0x81, 0x08, 0x86, 0x42, 0x00, 0x86, 0x42,
+    0x82, 0x05, 0x8C, 0x4A, 0x85, 0x08, 0x88, 0x42, 0x00, 0x83, 0x42, 0x85, 0x05, 0x8C, 0x43, 0x8D,
+    0x00, 0x8B, 0x43, 0x8E, 0x81, 0x07, 0x8C, 0x41, 0x8C, 0x01, 0x42, 0x8A, 0x05, 0x8C, 0x43, 0x8D,
+    0x00, 0x83, 0x44, 0x89, 0x06, 0x81, 0x42, 0x89, 0x01, 0x8A, 0x42, 0x05, 0x8C, 0x43, 0x8D, 0x01,
+    0x8A, 0x44, 0x83, 0x05, 0x87, 0x42, 0x84, 0x01, 0x85, 0x42, 0x87, 0x04, 0x8C, 0x43, 0x8D, 0x01,
+    0x82, 0x44, 0x8C, 0x05, 0x8E, 0x41, 0x8E, 0x03, 0x8D, 0x42, 0x81, 0x03, 0x8C, 0x43, 0x8D, 0x02,
+    0x88, 0x44, 0x86, 0x03, 0x87, 0x42, 0x87, 0x03, 0x86, 0x42, 0x8B, 0x03, 0x8C, 0x43, 0x8D, 0x02,
+    0x81, 0x44, 0x8E, 0x81, 0x01, 0x82, 0x42, 0x8E, 0x05, 0x8C, 0x42, 0x88, 0x02, 0x8C, 0x43, 0x8D,
+    0x03, 0x87, 0x44, 0x8A, 0x00, 0x81, 0x8D, 0x42, 0x85, 0x05, 0x82, 0x43, 0x87, 0x01, 0x8C, 0x43,
+    0x8D, 0x04, 0x8E, 0x44, 0x85, 0x8D, 0x42, 0x8B, 0x07, 0x85, 0x43, 0x8A, 0x10, 0x83, 0x8E, 0x42,
+    0x8D, 0x81, 0x08, 0x86, 0x43, 0x8E, 0x85, 0x0C, 0x81, 0x88, 0x43, 0x8E, 0x82, 0x0A, 0x85, 0x44,
+    0x8D, 0x86, 0x81, 0x07, 0x83, 0x88, 0x44, 0x8D, 0x81, 0x0C, 0x83, 0x8D, 0x45, 0x8D, 0x8A, 0x88,
+    0x97, 0x88, 0x8B, 0x8E, 0x45, 0x89, 0x10, 0x88, 0x50, 0x8D, 0x84, 0x12, 0x81, 0x88, 0x8E, 0x4B,
+    0x8C, 0x85, 0x17, 0x83, 0x87, 0x8B, 0x8D, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x86, 0x81, 0x0C, 0x82,
+    0xFE, 0xFE, 0xFE, 0x8E, 0x92, 0x58, 0x92, 0x58, 0x92, 0x58, 0x92, 0x58, 0x82, 0x04, 0x85, 0x8B,
+    0x8E, 0x41, 0x8C, 0x87, 0x81, 0x07, 0x82, 0x8D, 0x47, 0x86, 0x05, 0x84, 0x4A, 0x89, 0x03, 0x81,
+    0x8E, 0x4B, 0x86, 0x02, 0x8B, 0x44, 0x8D, 0x8A, 0x8B, 0x45, 0x82, 0x00, 0x82, 0x44, 0x85, 0x02,
+    0x82, 0x8D, 0x43, 0x89, 0x00, 0x87, 0x43, 0x87, 0x04, 0x82, 0x43, 0x8E, 0x00, 0x8A, 0x43, 0x06,
+    0x8A, 0x43, 0x00, 0x8B, 0x42, 0x8E, 0x06, 0x88, 0x43, 0x81, 0x8A, 0x43, 0x06, 0x8A, 0x43, 0x81,
+    0x88, 0x43, 0x87, 0x04, 0x81, 0x43, 0x8E, 0x00, 0x83, 0x44, 0x85, 0x02, 0x82, 0x8D, 0x43, 0x89,
+    0x01, 0x8C, 0x44, 0x8D, 0x8A, 0x8B, 0x45, 0x82, 0x01, 0x83, 0x4C, 0x87, 0x03, 0x85, 0x4A, 0x8A,
+    0x05, 0x83, 0x8D, 0x47, 0x87, 0x08, 0x86, 0x8B, 0x8E, 0x41, 0x8C, 0x88, 0x81, 0x04, 0x08, 0x83,
+    0xB8, 0x87, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86,
+    0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x09, 0x8D, 0x56,
+    0x86, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x84, 0xF5, 0x89,
+    0x44, 0xF5, 0x85, 0x82, 0x08, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44,
+    0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x86, 0x44, 0x12, 0x84, 0xCB, 0x22,
+    0x84, 0xF5, 0xF5, 0xE5, 0x82, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x8D, 0x56,
+    0x86, 0x8D, 0x56, 0x86, 0x03, 0x85, 0x8A, 0x8D, 0x8E, 0x40, 0x8E, 0x8C, 0x88, 0x81, 0x05, 0x87,
+    0x8E, 0x48, 0x86, 0x02, 0x82, 0x8D, 0x4B, 0x86, 0x01, 0x88, 0x4C, 0x8E, 0x02, 0x8B, 0x43, 0x8D,
+    0x8B, 0x8E, 0x45, 0x85, 0x01, 0x81, 0x8E, 0x40, 0x8C, 0x83, 0x02, 0x8B, 0x44, 0x87, 0x02, 0x83,
+    0x88, 0x04, 0x85, 0x44, 0x88, 0x09, 0x87, 0x44, 0x86, 0x09, 0x8C, 0x44, 0x82, 0x08, 0x86, 0x44,
+    0x8B, 0x08, 0x84, 0x45, 0x82, 0x07, 0x83, 0x45, 0x85, 0x07, 0x83, 0x45, 0x87, 0x07, 0x83, 0x45,
+    0x87, 0x07, 0x83, 0x45, 0x86, 0x07, 0x84, 0x45, 0x85, 0x07, 0x84, 0x45, 0x84, 0x07, 0x84, 0x46,
+    0xFE, 0x81, 0x8A, 0x4E, 0x82, 0x8A, 0x4E, 0x82, 0x8A, 0x4E, 0x82, 0x8A, 0x4E, 0x82, 0x02, 0x81,
+    0x86, 0x8B, 0x8D, 0x41, 0x8E, 0x8B, 0x86, 0x04, 0x81, 0x89, 0x48, 0x8E, 0x83, 0x01, 0x83, 0x8E,
+    0x4B, 0x83, 0x01, 0x8D, 0x4B, 0x8C, 0x01, 0x83, 0x42, 0x8A, 0x85, 0x83, 0x85, 0x8D, 0x44, 0x81,
+    0x01, 0x87, 0x8B, 0x82, 0x03, 0x83, 0x44, 0x83, 0x09, 0x44, 0x82, 0x08, 0x84, 0x43, 0x8E, 0x07,
+    0x81, 0x86, 0x8E, 0x43, 0x84, 0x03, 0x83, 0x47, 0x8E, 0x84, 0x04, 0x83, 0x46, 0x87, 0x06, 0x83,
+    0x47, 0x8C, 0x84, 0x04, 0x83, 0xAE, 0x46, 0x88, 0x08, 0x82, 0x89, 0x44, 0x85, 0x09, 0x8A, 0x43,
+    0x8B, 0x81, 0x08, 0x88, 0x43, 0x8E, 0x89, 0x8C, 0x84, 0x06, 0x8C, 0x43, 0x8D, 0x89, 0x41, 0x8D,
+    0x88, 0x85, 0x93, 0x85, 0x8B, 0x44, 0x8A, 0x89, 0x4D, 0x84, 0x89, 0x4C, 0x89, 0x00, 0x83, 0x8C,
+    0x4A, 0x88, 0x03, 0x82, 0x88, 0x8B, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x81, 0x02, 0x04, 0x87,
+    0x47, 0x81, 0x03, 0x83, 0x46, 0x8E, 0x83, 0x04, 0x8D, 0x45, 0x8D, 0x82, 0x04, 0x8B, 0x45, 0x8B,
+    0x81, 0x04, 0x88, 0x45, 0x89, 0x05, 0x85, 0x45, 0x86, 0x05, 0x83, 0x44, 0x8D, 0x83, 0x06, 0x8D,
+    0x43, 0x8A, 0x81, 0x07, 0x81, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46,
+    0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08,
+    0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46,
+    0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46,
+    0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08,
+    0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x86, 0x46, 0x91, 0x46, 0x85, 0x08, 0x87, 0x46, 0x91, 0x46,
+    0x85, 0x08, 0x89, 0x46, 0x91, 0x46, 0x86, 0x08, 0x8B, 0x46, 0x91, 0x46, 0x88, 0x08, 0x47, 0x91,
+    0x46, 0x8D, 0x07, 0x87, 0x47, 0x91, 0x47, 0x85, 0x05, 0x83, 0x48, 0x91, 0x48, 0x87, 0x81, 0x01,
+    0x82, 0x88, 0x49, 0x91, 0x58, 0x91, 0x51, 0x8E, 0x45, 0x91, 0x50, 0x8A, 0x86, 0x45, 0x91, 0x4F,
+    0x8E, 0x81, 0x82, 0x45, 0x91, 0x46, 0x86, 0x46, 0x8E, 0x83, 0x01, 0x8E, 0x44, 0x91, 0x46, 0x83,
+    0x81, 0x88, 0x8D, 0x41, 0x8D, 0x88, 0x81, 0x02, 0x8A, 0x44, 0x91, 0x46, 0x84, 0x11, 0x81, 0x46,
+    0x84, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46,
+    0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46,
+    0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x05, 0x81, 0x86, 0x8A, 0x8D, 0x8E,
+    0x4E, 0x87, 0x04, 0x88, 0x53, 0x87, 0x02, 0x81, 0x8C, 0x54, 0x87, 0x02, 0x8C, 0x55, 0x87, 0x01,
+    0x87, 0x4F, 0xAE, 0x43, 0x87, 0x01, 0x4F, 0x88, 0x02, 0x87, 0x42, 0x87, 0x00, 0x85, 0x4F, 0x88,
+    0x02, 0x87, 0x42, 0x87, 0x00, 0x8A, 0x4F, 0x88, 0x02, 0x87, 0x42, 0x87, 0x00, 0x8D, 0x4F, 0x88,
+    0x02, 0x87, 0x42, 0x87, 0x00, 0x50, 0x88, 0x02, 0x87, 0x42, 0x87, 0x81, 0x50, 0x88, 0x02, 0x87,
+    0x42, 0x87, 0x82, 0x50, 0x88, 0x02, 0x87, 0x42, 0x87, 0x83, 0x50, 0x88, 0x02, 0x87, 0x42, 0x87,
+    0x83, 0x50, 0x88, 0x02, 0x87, 0x42, 0x87, 0x82, 0x50, 0x88, 0x02, 0x87, 0x42, 0x87, 0x81, 0x50,
+    0x88, 0x02, 0x87, 0x42, 0x87, 0x00, 0x8E, 0x4F, 0x88, 0x02, 0x87, 0x42, 0x87, 0x00, 0x8B, 0x4F,
+    0x88, 0x02, 0x87, 0x42, 0x87, 0x00, 0x87, 0x4F, 0x88, 0x02, 0x87, 0x42, 0x87, 0x00, 0x81, 0x4F,
+    0x88, 0x02, 0x87, 0x42, 0x87, 0x01, 0x8A, 0x4E, 0x88, 0x02, 0x87, 0x42, 0x87, 0x01, 0x81, 0x8E,
+    0x4D, 0x88, 0x02, 0x87, 0x42, 0x87, 0x02, 0x83, 0x8E, 0x4C, 0x88, 0x02, 0x87, 0x42, 0x87, 0x03,
+    0x82, 0x8B, 0x4B, 0x88, 0x02, 0x87, 0x42, 0x87, 0x05, 0x83, 0x88, 0x8C, 0x8E, 0x41, 0x8E, 0x9C,
+    0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87, 0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87,
+    0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87, 0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87,
+    0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87, 0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87,
+    0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87, 0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87,
+    0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87, 0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87,
+    0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87, 0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87,
+    0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87, 0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87,
+    0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87, 0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87,
+    0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87, 0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87,
+    0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x0D, 0x87, 0x42, 0x88, 0x02, 0x87, 0x42, 0x87, 0x01, 0x85,
+    0x8C, 0x41, 0x8D, 0x87, 0x02, 0x86, 0x45, 0x89, 0x01, 0x8E, 0x46, 0x82, 0x81, 0x47, 0x85, 0x81,
+    0x47, 0x86, 0x00, 0x47, 0x83, 0x00, 0x88, 0x45, 0x8C, 0x02, 0x89, 0x43, 0x8B, 0x81, 0x03, 0x81,
+    0x94, 0x82, 0x02, 0x01, 0x81, 0x43, 0x8B, 0x05, 0x89, 0x43, 0x86, 0x04, 0x81, 0x44, 0x8D, 0x87,
+    0x03, 0x87, 0x46, 0x8C, 0x81, 0x03, 0x85, 0x8D, 0x44, 0x8A, 0x04, 0x81, 0x8E, 0x44, 0x81, 0x04,
+    0x8B, 0x44, 0x82, 0x87, 0x85, 0x83, 0x82, 0x84, 0x45, 0x81, 0x8E, 0x48, 0x8D, 0x00, 0x8E, 0x48,
+    0x86, 0x00, 0x8E, 0x47, 0x88, 0x01, 0x88, 0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x88, 0x82, 0x02, 0x05,
+    0x82, 0x8D, 0x43, 0x84, 0x04, 0x85, 0x45, 0x84, 0x03, 0x88, 0x46, 0x84, 0x01, 0x81, 0x8B, 0x47,
+    0x84, 0x00, 0x82, 0x8D, 0x48, 0x94, 0x44, 0x8E, 0x44, 0x84, 0x83, 0x43, 0x8B, 0x86, 0x44, 0x84,
+    0x00, 0x85, 0x41, 0x8A, 0x00, 0x87, 0x44, 0x84, 0x01, 0x97, 0x01, 0x87, 0x44, 0x84, 0x05, 0x88,
+    0x44, 0x84, 0x05, 0x88, 0x44, 0x84, 0x05, 0x88, 0x44, 0x84, 0x05, 0x88, 0x44, 0x84, 0x05, 0x88,
+    0x44, 0x84, 0x05, 0x88, 0x44, 0x84, 0x05, 0x88, 0x44, 0x84, 0x05, 0x88, 0x44, 0x84, 0x05, 0x88,
+    0x44, 0x84, 0x05, 0x88, 0x44, 0x84, 0x05, 0x88, 0x44, 0x84, 0x05, 0x88, 0x44, 0x84, 0x05, 0x88,
+    0x44, 0x84, 0x03, 0x81, 0x87, 0x8B, 0x8E, 0x40, 0x8E, 0x8D, 0x88, 0x82, 0x06, 0x86, 0x48, 0x89,
+    0x04, 0x87, 0x4A, 0x8B, 0x02, 0x83, 0x4C, 0x88, 0x01, 0x8B, 0x43, 0x8C, 0x83, 0x00, 0x81, 0x88,
+    0x44, 0x91, 0x44, 0x81, 0x03, 0x8A, 0x43, 0x87, 0x85, 0x43, 0x8A, 0x04, 0x84, 0x43, 0x8B, 0x88,
+    0x43, 0x87, 0x04, 0x81, 0x43, 0x8E, 0x89, 0x43, 0x85, 0x05, 0x44, 0x89, 0x43, 0x85, 0x05, 0x44,
+    0x88, 0x43, 0x87, 0x04, 0x81, 0x43, 0x8E, 0x85, 0x43, 0x8A, 0x04, 0x84, 0x43, 0x8B, 0x81, 0x44,
+    0x81, 0x03, 0x8A, 0x43, 0x87, 0x00, 0x8A, 0x43, 0x8C, 0x83, 0x00, 0x81, 0x88, 0x44, 0x81, 0x00,
+    0x82, 0x4C, 0x89, 0x02, 0x86, 0x4A, 0x8C, 0x04, 0x85, 0x8E, 0x47, 0x8A, 0x07, 0x87, 0x8B, 0x8E,
+    0x40, 0x8E, 0x8D, 0x89, 0x83, 0x03, 0x02, 0x81, 0x88, 0x8B, 0x09, 0x85, 0x8C, 0x82, 0x09, 0x87,
+    0x8E, 0x41, 0x88, 0x06, 0x84, 0x8C, 0x41, 0x8D, 0x07, 0x85, 0x8E, 0x44, 0x85, 0x03, 0x82, 0x8B,
+    0x44, 0x8B, 0x06, 0x88, 0x46, 0x83, 0x02, 0x83, 0x46, 0x88, 0x06, 0x8B, 0x45, 0x8E, 0x81, 0x02,
+    0x86, 0x46, 0x85, 0x05, 0x81, 0x8D, 0x45, 0x8C, 0x03, 0x89, 0x46, 0x82, 0x05, 0x83, 0x46, 0x89,
+    0x03, 0x8C, 0x45, 0x8D, 0x81, 0x05, 0x85, 0x46, 0x86, 0x02, 0x81, 0x8E, 0x45, 0x8B, 0x06, 0x89,
+    0x46, 0x83, 0x02, 0x83, 0x46, 0x89, 0x06, 0x8C, 0x45, 0x8E, 0x81, 0x02, 0x87, 0x46, 0x86, 0x05,
+    0x81, 0x8E, 0x45, 0x8C, 0x03, 0x8A, 0x46, 0x83, 0x05, 0x86, 0x46, 0x86, 0x02, 0x81, 0x46, 0x8B,
+    0x04, 0x81, 0x8E, 0x45, 0x8D, 0x03, 0x8A, 0x46, 0x84, 0x04, 0x8C, 0x45, 0x8E, 0x82, 0x02, 0x87,
+    0x46, 0x86, 0x04, 0x89, 0x46, 0x84, 0x02, 0x83, 0x46, 0x89, 0x04, 0x85, 0x46, 0x86, 0x02, 0x81,
+    0x8E, 0x45, 0x8C, 0x04, 0x83, 0x46, 0x89, 0x03, 0x8C, 0x45, 0x8E, 0x81, 0x03, 0x81, 0x8D, 0x45,
+    0x8C, 0x03, 0x89, 0x46, 0x83, 0x04, 0x8B, 0x45, 0x8E, 0x81, 0x02, 0x86, 0x46, 0x85, 0x04, 0x88,
+    0x46, 0x83, 0x02, 0x83, 0x46, 0x88, 0x05, 0x85, 0x8E, 0x44, 0x86, 0x03, 0x82, 0x8B, 0x44, 0x8B,
+    0x08, 0x87, 0x8E, 0x41, 0x88, 0x06, 0x84, 0x8C, 0x41, 0x8D, 0x81, 0x09, 0x81, 0x88, 0x8B, 0x09,
+    0x85, 0x8D, 0x82, 0x07, 0x05, 0x83, 0x8E, 0x43, 0x82, 0x0C, 0x8A, 0x44, 0x82, 0x0C, 0x86, 0x45,
+    0x82, 0x0B, 0x83, 0x44, 0x8A, 0x0C, 0x89, 0x46, 0x82, 0x0B, 0x8C, 0x44, 0x81, 0x0A, 0x81, 0x8C,
+    0x47, 0x82, 0x0A, 0x85, 0x44, 0x88, 0x0A, 0x83, 0x8E, 0x48, 0x82, 0x0A, 0x8D, 0x43, 0x8E, 0x0A,
+    0x86, 0x44, 0x8E, 0x44, 0x82, 0x09, 0x86, 0x44, 0x86, 0x0A, 0x85, 0x43, 0x89, 0x88, 0x44, 0x82,
+    0x09, 0x8E, 0x43, 0x8D, 0x0C, 0x87, 0x41, 0x89, 0x00, 0x89, 0x44, 0x82, 0x08, 0x88, 0x44, 0x85,
+    0x0D, 0x89, 0x86, 0x01, 0x89, 0x44, 0x82, 0x07, 0x81, 0x44, 0x8C, 0x12, 0x8A, 0x44, 0x82, 0x07,
+    0x89, 0x44, 0x83, 0x12, 0x8A, 0x44, 0x82, 0x06, 0x82, 0x44, 0x8A, 0x13, 0x8A, 0x44, 0x82, 0x06,
+    0x8B, 0x44, 0x82, 0x13, 0x8A, 0x44, 0x82, 0x05, 0x84, 0x44, 0x89, 0x14, 0x8A, 0x44, 0x82, 0x05,
+    0x8C, 0x44, 0x81, 0x14, 0x8A, 0x44, 0x82, 0x04, 0x85, 0x44, 0x87, 0x04, 0x82, 0x45, 0x09, 0x8A,
+    0x44, 0x82, 0x04, 0x8E, 0x43, 0x8E, 0x05, 0x8B, 0x45, 0x09, 0x8A, 0x44, 0x82, 0x03, 0x87, 0x44,
+    0x85, 0x04, 0x86, 0x46, 0x09, 0x8A, 0x44, 0x82, 0x02, 0x81, 0x44, 0x8D, 0x04, 0x81, 0x47, 0x09,
+    0x8A, 0x44, 0x82, 0x02, 0x89, 0x44, 0x84, 0x04, 0x8B, 0x47, 0x09, 0x8A, 0x44, 0x82, 0x01, 0x82,
+    0x44, 0x8B, 0x04, 0x85, 0x42, 0x8E, 0x44, 0x09, 0x8A, 0x44, 0x82, 0x01, 0x8A, 0x44, 0x82, 0x03,
+    0x81, 0x8E, 0x41, 0x8D, 0x8B, 0x44, 0x09, 0x8A, 0x44, 0x82, 0x00, 0x83, 0x44, 0x89, 0x04, 0x8A,
+    0x42, 0x86, 0x8B, 0x44, 0x11, 0x8C, 0x44, 0x81, 0x03, 0x85, 0x42, 0x8D, 0x00, 0x8C, 0x44, 0x10,
+    0x85, 0x44, 0x88, 0x03, 0x81, 0x8E, 0x42, 0x85, 0x00, 0x8C, 0x44, 0x10, 0x8D, 0x43, 0x8E, 0x04,
+    0x8A, 0x42, 0x8A, 0x01, 0x8C, 0x44, 0x0F, 0x86, 0x44, 0x86, 0x03, 0x84, 0x42, 0x8E, 0x81, 0x01,
+    0x8C, 0x44, 0x0F, 0x8E, 0x43, 0x8D, 0x04, 0x8E, 0x42, 0x85, 0x02, 0x8C, 0x44, 0x0E, 0x88, 0x44,
+    0x85, 0x03, 0x89, 0x42, 0x8B, 0x03, 0x8C, 0x44, 0x0D, 0x81, 0x44, 0x8C, 0x03, 0x81, 0x51, 0x81,
+    0x09, 0x89, 0x44, 0x83, 0x03, 0x82, 0x51, 0x81, 0x08, 0x82, 0x44, 0x8A, 0x04, 0x82, 0x51, 0x81,
+    0x08, 0x8B, 0x44, 0x82, 0x04, 0x82, 0x51, 0x81, 0x07, 0x84, 0x44, 0x89, 0x06, 0xF1, 0x81, 0x8D,
+    0x44, 0xA1, 0x08, 0x8C, 0x44, 0x81, 0x0F, 0x8C, 0x44, 0x0A, 0x85, 0x44, 0x87, 0x10, 0x8C, 0x44,
+    0x0A, 0x8E, 0x43, 0x8E, 0x11, 0x8C, 0x44, 0x03, 0x05, 0x83, 0x8E, 0x43, 0x82, 0x0C, 0x8A, 0x44,
+    0x82, 0x0C, 0x86, 0x45, 0x82, 0x0B, 0x83, 0x44, 0x8A, 0x0C, 0x89, 0x46, 0x82, 0x0B, 0x8C, 0x44,
+    0x81, 0x0A, 0x81, 0x8C, 0x47, 0x82, 0x0A, 0x85, 0x44, 0x88, 0x0A, 0x83, 0x8E, 0x48, 0x82, 0x0A,
+    0x8D, 0x43, 0x8E, 0x0A, 0x86, 0x44, 0x8E, 0x44, 0x82, 0x09, 0x86, 0x44, 0x86, 0x0A, 0x85, 0x43,
+    0x89, 0x88, 0x44, 0x82, 0x09, 0x8E, 0x43, 0x8D, 0x0C, 0x87, 0x41, 0x89, 0x00, 0x89, 0x44, 0x82,
+    0x08, 0x88, 0x44, 0x85, 0x0D, 0x89, 0x86, 0x01, 0x89, 0x44, 0x82, 0x07, 0x81, 0x44, 0x8C, 0x12,
+    0x8A, 0x44, 0x82, 0x07, 0x89, 0x44, 0x83, 0x12, 0x8A, 0x44, 0x82, 0x06, 0x82, 0x44, 0x8A, 0x13,
+    0x8A, 0x44, 0x82, 0x06, 0x8B, 0x44, 0x82, 0x13, 0x8A, 0x44, 0x82, 0x05, 0x84, 0x44, 0x89, 0x14,
+    0x8A, 0x44, 0x82, 0x05, 0x8C, 0x44, 0x81, 0x14, 0x8A, 0x44, 0x82, 0x04, 0x85, 0x44, 0x87, 0x02,
+    0x81, 0x86, 0x8B, 0x8D, 0x41, 0x8E, 0x8B, 0x86, 0x09, 0x8A, 0x44, 0x82, 0x04, 0x8E, 0x43, 0x8E,
+    0x01, 0x81, 0x89, 0x48, 0x8E, 0x83, 0x07, 0x8A, 0x44, 0x82, 0x03, 0x87, 0x44, 0x85, 0x00, 0x84,
+    0x8E, 0x4B, 0x82, 0x06, 0x8A, 0x44, 0x82, 0x02, 0x81, 0x44, 0x8D, 0x01, 0x8C, 0x4C, 0x8B, 0x06,
+    0x8A, 0x44, 0x82, 0x02, 0x89, 0x44, 0x84, 0x01, 0x81, 0x8E, 0x43, 0x8D, 0x8B, 0x46, 0x81, 0x05,
+    0x8A, 0x44, 0x82, 0x01, 0x82, 0x44, 0x8B, 0x03, 0x83, 0x41, 0x8A, 0x82, 0x01, 0x81, 0x8E, 0x44,
+    0x83, 0x05, 0x8A, 0x44, 0x82, 0x01, 0x8A, 0x44, 0x82, 0x04, 0x86, 0x85, 0x04, 0x89, 0x44, 0x84,
+    0x05, 0x8A, 0x44, 0x82, 0x00, 0x83, 0x44, 0x89, 0x0C, 0x8B, 0x44, 0x82, 0x0D, 0x8C, 0x44, 0x81,
+    0x0B, 0x81, 0x44, 0x8E, 0x0D, 0x85, 0x44, 0x88, 0x0C, 0x8A, 0x44, 0x87, 0x0D, 0x8D, 0x43, 0x8E,
+    0x0C, 0x88, 0x44, 0x8D, 0x0D, 0x86, 0x44, 0x86, 0x0B, 0x87, 0x44, 0x8E, 0x82, 0x0D, 0x8E, 0x43,
+    0x8D, 0x0B, 0x86, 0x45, 0x83, 0x0D, 0x88, 0x44, 0x85, 0x0A, 0x87, 0x45, 0x84, 0x0D, 0x81, 0x44,
+    0x8C, 0x0A, 0x87, 0x45, 0x83, 0x0E, 0x89, 0x44, 0x83, 0x09, 0x87, 0x44, 0x8E, 0x82, 0x0E, 0x82,
+    0x44, 0x8A, 0x09, 0x87, 0x44, 0x8D, 0x82, 0x0F, 0x8B, 0x44, 0x82, 0x08, 0x87, 0x45, 0xFE, 0x8C,
+    0x07, 0x84, 0x44, 0x89, 0x09, 0x8E, 0x4D, 0x8E, 0x07, 0x8C, 0x44, 0x81, 0x09, 0x8E, 0x4D, 0x8E,
+    0x06, 0x85, 0x44, 0x87, 0x0A, 0x8E, 0x4D, 0x8E, 0x06, 0x8E, 0x43, 0x8E, 0x0B, 0x8E, 0x4D, 0x8E,
+    0x02, 0x82, 0x87, 0x8C, 0x8E, 0x41, 0x8D, 0x8A, 0x85, 0x0E, 0x8E, 0x43, 0x8E, 0x07, 0x82, 0x8B,
+    0x48, 0x8C, 0x81, 0x0B, 0x87, 0x44, 0x85, 0x06, 0x86, 0x4B, 0x8D, 0x0A, 0x81, 0x44, 0x8C, 0x07,
+    0x83, 0x4C, 0x88, 0x09, 0x89, 0x44, 0x84, 0x08, 0x87, 0x41, 0x8E, 0x88, 0x84, 0x83, 0x87, 0x44,
+    0x8D, 0x08, 0x82, 0x44, 0x8B, 0x0A, 0x8B, 0x89, 0x81, 0x03, 0x87, 0x44, 0x08, 0x8A, 0x44, 0x82,
+    0x11, 0x84, 0x43, 0x8E, 0x07, 0x83, 0x44, 0x89, 0x12, 0x88, 0x43, 0x8A, 0x07, 0x8C, 0x44, 0x81,
+    0x10, 0x82, 0x88, 0x43, 0x8E, 0x81, 0x06, 0x85, 0x44, 0x88, 0x0D, 0x87, 0x47, 0x8C, 0x82, 0x07,
+    0x8D, 0x43, 0x8E, 0x0E, 0x87, 0x46, 0x84, 0x08, 0x86, 0x44, 0x86, 0x0E, 0x87, 0x47, 0x8A, 0x82,
+    0x06, 0x8E, 0x43, 0x8D, 0x0F, 0x87, 0xAE, 0x46, 0x84, 0x04, 0x88, 0x44, 0x84, 0x14, 0x84, 0x8B,
+    0x44, 0x81, 0x02, 0x81, 0x44, 0x8C, 0x17, 0x8E, 0x43, 0x87, 0x02, 0x8A, 0x44, 0x83, 0x03, 0x85,
+    0x44, 0x8C, 0x02, 0x81, 0x08, 0x8C, 0x43, 0x8A, 0x01, 0x83, 0x44, 0x8A, 0x03, 0x81, 0x8E, 0x44,
+    0x8C, 0x02, 0x8C, 0x8A, 0x82, 0x05, 0x81, 0x44, 0x89, 0x01, 0x8B, 0x44, 0x82, 0x03, 0x8A, 0x45,
+    0x8C, 0x02, 0x8D, 0x41, 0x8C, 0x87, 0x84, 0x82, 0x83, 0x86, 0x8D, 0x44, 0x86, 0x00, 0x84, 0x44,
+    0x88, 0x03, 0x84, 0x46, 0x8C, 0x02, 0x8D, 0x4D, 0x81, 0x00, 0x8D, 0x43, 0x8E, 0x81, 0x02, 0x81,
+    0x8E, 0x46, 0x8C, 0x02, 0x8D, 0x4C, 0x86, 0x00, 0x86, 0x44, 0x87, 0x03, 0x89, 0x47, 0x8C, 0x02,
+    0x86, 0x8E, 0x49, 0x8E, 0x85, 0x01, 0x8E, 0x43, 0x8E, 0x03, 0x84, 0x42, 0x89, 0x44, 0x8C, 0x04,
+    0x84, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x8A, 0x85, 0x02, 0x87, 0x44, 0x85, 0x03, 0x8E, 0x42,
+    0x82, 0x44, 0x8C, 0x10, 0x81, 0x44, 0x8C, 0x03, 0x89, 0x42, 0x8A, 0x00, 0x44, 0x8C, 0x10, 0x89,
+    0x44, 0x84, 0x02, 0x83, 0x43, 0x81, 0x00, 0x44, 0x8C, 0x0F, 0x82, 0x44, 0x8B, 0x03, 0x8D, 0x42,
+    0x86, 0x00, 0x81, 0x44, 0x8C, 0x0F, 0x8A, 0x44, 0x82, 0x02, 0x88, 0x42, 0x8B, 0x01, 0x81, 0x44,
+    0x8C, 0x0E, 0x83, 0x44, 0x89, 0x02, 0x83, 0x43, 0x82, 0x01, 0x81, 0x44, 0x8C, 0x0E, 0x8C, 0x44,
+    0x81, 0x02, 0x8D, 0x42, 0x86, 0x02, 0x81, 0x44, 0x8C, 0x0D, 0x85, 0x44, 0x88, 0x02, 0x85, 0x50,
+    0x8C, 0x0A, 0x8D, 0x43, 0x8E, 0x03, 0x86, 0x50, 0x8C, 0x09, 0x86, 0x44, 0x86, 0x03, 0x86, 0x50,
+    0x8C, 0x09, 0x8E, 0x43, 0x8D, 0x04, 0x86, 0x50, 0x8C, 0x08, 0x88, 0x44, 0x84, 0x05, 0xF1, 0x82,
+    0x44, 0x8C, 0xA1, 0x07, 0x81, 0x44, 0x8B, 0x0E, 0x81, 0x44, 0x8C, 0x0A, 0x8A, 0x44, 0x83, 0x0E,
+    0x81, 0x44, 0x8C, 0x09, 0x82, 0x44, 0x8A, 0x0F, 0x81, 0x44, 0x8C, 0x02, 0x09, 0x86, 0x8D, 0x41,
+    0x8C, 0x85, 0x0F, 0x88, 0x45, 0x86, 0x0D, 0x81, 0x46, 0x8E, 0x0D, 0x84, 0x47, 0x82, 0x0C, 0x85,
+    0x47, 0x82, 0x0C, 0x83, 0x47, 0x0E, 0x8C, 0x45, 0x89, 0x0E, 0x81, 0x8B, 0x43, 0x8A, 0x11, 0x82,
+    0x94, 0x81, 0x3F, 0x16, 0x45, 0x86, 0x0F, 0x45, 0x86, 0x0E, 0x82, 0x45, 0x85, 0x0E, 0x87, 0x45,
+    0x84, 0x0D, 0x83, 0x46, 0x0D, 0x84, 0x46, 0x8A, 0x0C, 0x87, 0x47, 0x81, 0x0B, 0x8B, 0x47, 0x84,
+    0x0A, 0x81, 0x8D, 0x47, 0x84, 0x0A, 0x81, 0x8D, 0x46, 0x8E, 0x83, 0x0B, 0x8C, 0x46, 0x8B, 0x81,
+    0x0B, 0x87, 0x46, 0x89, 0x0D, 0x8E, 0x45, 0x89, 0x0D, 0x83, 0x46, 0x0E, 0x86, 0x45, 0x8B, 0x0E,
+    0x87, 0x45, 0x89, 0x0E, 0x87, 0x45, 0x8A, 0x0A, 0x81, 0x83, 0x01, 0x85, 0x46, 0x82, 0x07, 0x83,
+    0x89, 0x40, 0x8E, 0x01, 0x82, 0x46, 0x8E, 0x86, 0x82, 0x01, 0x82, 0x85, 0x89, 0x8E, 0x43, 0x86,
+    0x01, 0x8C, 0x52, 0x8D, 0x01, 0x84, 0x53, 0x85, 0x01, 0x88, 0x52, 0x8C, 0x02, 0x87, 0x50, 0x8A,
+    0x83, 0x03, 0x83, 0x8B, 0x4B, 0x8D, 0x88, 0x82, 0x07, 0x82, 0x87, 0x8A, 0x8D, 0x8E, 0x41, 0x8E,
+    0x8C, 0x89, 0x86, 0x82, 0x04, 0x07, 0x8A, 0x46, 0x8E, 0x1A, 0x8A, 0x46, 0x89, 0x1A, 0x88, 0x46,
+    0x85, 0x1A, 0x86, 0x46, 0x82, 0x1A, 0x83, 0x8E, 0x44, 0x8D, 0x81, 0x1A, 0x81, 0x8C, 0x44, 0x8B,
+    0x1C, 0x89, 0x44, 0x89, 0x1C, 0x85, 0x44, 0x84, 0x3F, 0x1D, 0x89, 0x48, 0x18, 0x8E, 0x48, 0x85,
+    0x16, 0x84, 0x49, 0x8B, 0x16, 0x8A, 0x4A, 0x81, 0x15, 0x4B, 0x86, 0x14, 0x85, 0x4B, 0x8C, 0x14,
+    0x8A, 0x45, 0x88, 0x45, 0x82, 0x13, 0x45, 0x8B, 0x83, 0x45, 0x87, 0x12, 0x86, 0x45, 0x86, 0x00,
+    0x8E, 0x44, 0x8D, 0x12, 0x8B, 0x45, 0x82, 0x00, 0x89, 0x45, 0x82, 0x10, 0x81, 0x45, 0x8D, 0x01,
+    0x85, 0x45, 0x88, 0x10, 0x86, 0x45, 0x88, 0x02, 0x45, 0x8E, 0x10, 0x8C, 0x45, 0x83, 0x02, 0x8B,
+    0x45, 0x83, 0x0E, 0x82, 0x45, 0x8E, 0x03, 0x86, 0x45, 0x89, 0x0E, 0x87, 0x45, 0x8A, 0x03, 0x81,
+    0x45, 0x8E, 0x0E, 0x8D, 0x45, 0x85, 0x04, 0x8C, 0x45, 0x84, 0x0C, 0x82, 0x46, 0x05, 0x87, 0x45,
+    0x8A, 0x0C, 0x88, 0x45, 0x8B, 0x05, 0x82, 0x46, 0x0C, 0x8E, 0x45, 0x86, 0x06, 0x8D, 0x45, 0x85,
+    0x0A, 0x83, 0x46, 0x81, 0x06, 0x88, 0x45, 0x8B, 0x0A, 0x89, 0x45, 0x8C, 0x07, 0x83, 0x46, 0x81,
+    0x09, 0x8E, 0x56, 0x86, 0x08, 0x84, 0x57, 0x8C, 0x08, 0x8A, 0x58, 0x81, 0x07, 0x59, 0x87, 0x06,
+    0x85, 0x59, 0x8C, 0x06, 0x8A, 0x5A, 0x82, 0x05, 0x46, 0x8C, 0xF5, 0xB5, 0x87, 0x46, 0x88, 0x04,
+    0x86, 0x46, 0x86, 0x0C, 0x8E, 0x45, 0x8D, 0x04, 0x8B, 0x46, 0x81, 0x0C, 0x89, 0x46, 0x83, 0x02,
+    0x81, 0x46, 0x8C, 0x0D, 0x84, 0x46, 0x89, 0x02, 0x86, 0x46, 0x88, 0x0E, 0x46, 0x8E, 0x02, 0x8C,
+    0x46, 0x83, 0x0E, 0x8B, 0x46, 0x84, 0x00, 0x82, 0x46, 0x8E, 0x0F, 0x86, 0x46, 0x89, 0x00, 0x87,
+    0x46, 0x89, 0x0F, 0x81, 0x47, 0x00, 0x8D, 0x46, 0x84, 0x10, 0x8C, 0x46, 0x85, 0x11, 0x86, 0x47,
+    0x83, 0x17, 0x82, 0x47, 0x84, 0x18, 0x8C, 0x45, 0x8E, 0x83, 0x18, 0x89, 0x45, 0x8C, 0x81, 0x18,
+    0x86, 0x45, 0x8A, 0x19, 0x83, 0x45, 0x87, 0x19, 0x82, 0x8E, 0x43, 0x8E, 0x84, 0x1A, 0x8B, 0x43,
+    0x8C, 0x81, 0x3F, 0x20, 0x89, 0x48, 0x18, 0x8E, 0x48, 0x85, 0x16, 0x84, 0x49, 0x8B, 0x16, 0x8A,
+    0x4A, 0x81, 0x15, 0x4B, 0x86, 0x14, 0x85, 0x4B, 0x8C, 0x14, 0x8A, 0x45, 0x88, 0x45, 0x82, 0x13,
+    0x45, 0x8B, 0x83, 0x45, 0x87, 0x12, 0x86, 0x45, 0x86, 0x00, 0x8E, 0x44, 0x8D, 0x12, 0x8B, 0x45,
+    0x82, 0x00, 0x89, 0x45, 0x82, 0x10, 0x81, 0x45, 0x8D, 0x01, 0x85, 0x45, 0x88, 0x10, 0x86, 0x45,
+    0x88, 0x02, 0x45, 0x8E, 0x10, 0x8C, 0x45, 0x83, 0x02, 0x8B, 0x45, 0x83, 0x0E, 0x82, 0x45, 0x8E,
+    0x03, 0x86, 0x45, 0x89, 0x0E, 0x87, 0x45, 0x8A, 0x03, 0x81, 0x45, 0x8E, 0x0E, 0x8D, 0x45, 0x85,
+    0x04, 0x8C, 0x45, 0x84, 0x0C, 0x82, 0x46, 0x05, 0x87, 0x45, 0x8A, 0x0C, 0x88, 0x45, 0x8B, 0x05,
+    0x82, 0x46, 0x0C, 0x8E, 0x45, 0x86, 0x06, 0x8D, 0x45, 0x85, 0x0A, 0x83, 0x46, 0x81, 0x06, 0x88,
+    0x45, 0x8B, 0x0A, 0x89, 0x45, 0x8C, 0x07, 0x83, 0x46, 0x81, 0x09, 0x8E, 0x56, 0x86, 0x08, 0x84,
+    0x57, 0x8C, 0x08, 0x8A, 0x58, 0x81, 0x07, 0x59, 0x87, 0x06, 0x85, 0x59, 0x8C, 0x06, 0x8A, 0x5A,
+    0x82, 0x05, 0x46, 0x8C, 0xF5, 0xB5, 0x87, 0x46, 0x88, 0x04, 0x86, 0x46, 0x86, 0x0C, 0x8E, 0x45,
+    0x8D, 0x04, 0x8B, 0x46, 0x81, 0x0C, 0x89, 0x46, 0x83, 0x02, 0x81, 0x46, 0x8C, 0x0D, 0x84, 0x46,
+    0x89, 0x02, 0x86, 0x46, 0x88, 0x0E, 0x46, 0x8E, 0x02, 0x8C, 0x46, 0x83, 0x0E, 0x8B, 0x46, 0x84,
+    0x00, 0x82, 0x46, 0x8E, 0x0F, 0x86, 0x46, 0x89, 0x00, 0x87, 0x46, 0x89, 0x0F, 0x81, 0x47, 0x00,
+    0x8D, 0x46, 0x84, 0x10, 0x8C, 0x46, 0x85, 0x0B, 0x87, 0x47, 0x8D, 0x17, 0x82, 0x49, 0x8A, 0x15,
+    0x81, 0x8D, 0x4A, 0x86, 0x14, 0x8B, 0x45, 0x8E, 0x45, 0x84, 0x12, 0x8A, 0x45, 0x85, 0x82, 0x8D,
+    0x45, 0x83, 0x10, 0x89, 0x44, 0x8E, 0x84, 0x01, 0x81, 0x8B, 0x44, 0x8E, 0x82, 0x0E, 0x88, 0x44,
+    0x8B, 0x81, 0x04, 0x87, 0x44, 0x8E, 0x82, 0x0C, 0x84, 0x44, 0x86, 0x07, 0x82, 0x8C, 0x43, 0x8C,
+    0x3F, 0x18, 0x89, 0x48, 0x18, 0x8E, 0x48, 0x85, 0x16, 0x84, 0x49, 0x8B, 0x16, 0x8A, 0x4A, 0x81,
+    0x15, 0x4B, 0x86, 0x14, 0x85, 0x4B, 0x8C, 0x14, 0x8A, 0x45, 0x88, 0x45, 0x82, 0x13, 0x45, 0x8B,
+    0x83, 0x45, 0x87, 0x12, 0x86, 0x45, 0x86, 0x00, 0x8E, 0x44, 0x8D, 0x12, 0x8B, 0x45, 0x82, 0x00,
+    0x89, 0x45, 0x82, 0x10, 0x81, 0x45, 0x8D, 0x01, 0x85, 0x45, 0x88, 0x10, 0x86, 0x45, 0x88, 0x02,
+    0x45, 0x8E, 0x10, 0x8C, 0x45, 0x83, 0x02, 0x8B, 0x45, 0x83, 0x0E, 0x82, 0x45, 0x8E, 0x03, 0x86,
+    0x45, 0x89, 0x0E, 0x87, 0x45, 0x8A, 0x03, 0x81, 0x45, 0x8E, 0x0E, 0x8D, 0x45, 0x85, 0x04, 0x8C,
+    0x45, 0x84, 0x0C, 0x82, 0x46, 0x05, 0x87, 0x45, 0x8A, 0x0C, 0x88, 0x45, 0x8B, 0x05, 0x82, 0x46,
+    0x0C, 0x8E, 0x45, 0x86, 0x06, 0x8D, 0x45, 0x85, 0x0A, 0x83, 0x46, 0x81, 0x06, 0x88, 0x45, 0x8B,
+    0x0A, 0x89, 0x45, 0x8C, 0x07, 0x83, 0x46, 0x81, 0x09, 0x8E, 0x56, 0x86, 0x08, 0x84, 0x57, 0x8C,
+    0x08, 0x8A, 0x58, 0x81, 0x07, 0x59, 0x87, 0x06, 0x85, 0x59, 0x8C, 0x06, 0x8A, 0x5A, 0x82, 0x05,
+    0x46, 0x8C, 0xF5, 0xB5, 0x87, 0x46, 0x88, 0x04, 0x86, 0x46, 0x86, 0x0C, 0x8E, 0x45, 0x8D, 0x04,
+    0x8B, 0x46, 0x81, 0x0C, 0x89, 0x46, 0x83, 0x02, 0x81, 0x46, 0x8C, 0x0D, 0x84, 0x46, 0x89, 0x02,
+    0x86, 0x46, 0x88, 0x0E, 0x46, 0x8E, 0x02, 0x8C, 0x46, 0x83, 0x0E, 0x8B, 0x46, 0x84, 0x00, 0x82,
+    0x46, 0x8E, 0x0F, 0x86, 0x46, 0x89, 0x00, 0x87, 0x46, 0x89, 0x0F, 0x81, 0x47, 0x00, 0x8D, 0x46,
+    0x84, 0x10, 0x8C, 0x46, 0x85, 0x09, 0x81, 0x89, 0x8D, 0x40, 0x8E, 0x89, 0x82, 0x05, 0x86, 0x42,
+    0x85, 0x0F, 0x84, 0x46, 0x88, 0x04, 0x8C, 0x42, 0x83, 0x0E, 0x82, 0x48, 0x8E, 0x87, 0x81, 0x00,
+    0x88, 0x43, 0x0F, 0x8B, 0x50, 0x8A, 0x0E, 0x82, 0x51, 0x83, 0x0E, 0x87, 0x42, 0x8E, 0x83, 0x00,
+    0x83, 0x8B, 0x48, 0x89, 0x0F, 0x8A, 0x42, 0x84, 0x03, 0x84, 0x8C, 0x45, 0x8A, 0x10, 0x8C, 0x41,
+    0x8E, 0x06, 0x85, 0x8C, 0x40, 0x8E, 0x8B, 0x85, 0x3F, 0x1C, 0x89, 0x48, 0x18, 0x8E, 0x48, 0x85,
+    0x16, 0x84, 0x49, 0x8B, 0x16, 0x8A, 0x4A, 0x81, 0x15, 0x4B, 0x86, 0x14, 0x85, 0x4B, 0x8C, 0x14,
+    0x8A, 0x45, 0x88, 0x45, 0x82, 0x13, 0x45, 0x8B, 0x83, 0x45, 0x87, 0x12, 0x86, 0x45, 0x86, 0x00,
+    0x8E, 0x44, 0x8D, 0x12, 0x8B, 0x45, 0x82, 0x00, 0x89, 0x45, 0x82, 0x10, 0x81, 0x45, 0x8D, 0x01,
+    0x85, 0x45, 0x88, 0x10, 0x86, 0x45, 0x88, 0x02, 0x45, 0x8E, 0x10, 0x8C, 0x45, 0x83, 0x02, 0x8B,
+    0x45, 0x83, 0x0E, 0x82, 0x45, 0x8E, 0x03, 0x86, 0x45, 0x89, 0x0E, 0x87, 0x45, 0x8A, 0x03, 0x81,
+    0x45, 0x8E, 0x0E, 0x8D, 0x45, 0x85, 0x04, 0x8C, 0x45, 0x84, 0x0C, 0x82, 0x46, 0x05, 0x87, 0x45,
+    0x8A, 0x0C, 0x88, 0x45, 0x8B, 0x05, 0x82, 0x46, 0x0C, 0x8E, 0x45, 0x86, 0x06, 0x8D, 0x45, 0x85,
+    0x0A, 0x83, 0x46, 0x81, 0x06, 0x88, 0x45, 0x8B, 0x0A, 0x89, 0x45, 0x8C, 0x07, 0x83, 0x46, 0x81,
+    0x09, 0x8E, 0x56, 0x86, 0x08, 0x84, 0x57, 0x8C, 0x08, 0x8A, 0x58, 0x81, 0x07, 0x59, 0x87, 0x06,
+    0x85, 0x59, 0x8C, 0x06, 0x8A, 0x5A, 0x82, 0x05, 0x46, 0x8C, 0xF5, 0xB5, 0x87, 0x46, 0x88, 0x04,
+    0x86, 0x46, 0x86, 0x0C, 0x8E, 0x45, 0x8D, 0x04, 0x8B, 0x46, 0x81, 0x0C, 0x89, 0x46, 0x83, 0x02,
+    0x81, 0x46, 0x8C, 0x0D, 0x84, 0x46, 0x89, 0x02, 0x86, 0x46, 0x88, 0x0E, 0x46, 0x8E, 0x02, 0x8C,
+    0x46, 0x83, 0x0E, 0x8B, 0x46, 0x84, 0x00, 0x82, 0x46, 0x8E, 0x0F, 0x86, 0x46, 0x89, 0x00, 0x87,
+    0x46, 0x89, 0x0F, 0x81, 0x47, 0x00, 0x8D, 0x46, 0x84, 0x10, 0x8C, 0x46, 0x85, 0x09, 0x81, 0x86,
+    0x87, 0x85, 0x05, 0x82, 0x86, 0x87, 0x84, 0x13, 0x84, 0x43, 0x8C, 0x03, 0x86, 0x43, 0x8B, 0x12,
+    0x8D, 0x44, 0x87, 0x02, 0x45, 0x86, 0x11, 0x45, 0x8A, 0x01, 0x83, 0x45, 0x89, 0x11, 0x45, 0x89,
+    0x01, 0x82, 0x45, 0x88, 0x11, 0x89, 0x44, 0x83, 0x02, 0x8C, 0x44, 0x82, 0x12, 0x88, 0x8E, 0x40,
+    0x8C, 0x84, 0x03, 0x81, 0x89, 0x8E, 0x40, 0x8C, 0x83, 0x3F, 0x3E, 0x89, 0x48, 0x18, 0x8E, 0x48,
+    0x85, 0x16, 0x84, 0x49, 0x8B, 0x16, 0x8A, 0x4A, 0x81, 0x15, 0x4B, 0x86, 0x14, 0x85, 0x4B, 0x8C,
+    0x14, 0x8A, 0x45, 0x88, 0x45, 0x82, 0x13, 0x45, 0x8B, 0x83, 0x45, 0x87, 0x12, 0x86, 0x45, 0x86,
+    0x00, 0x8E, 0x44, 0x8D, 0x12, 0x8B, 0x45, 0x82, 0x00, 0x89, 0x45, 0x82, 0x10, 0x81, 0x45, 0x8D,
+    0x01, 0x85, 0x45, 0x88, 0x10, 0x86, 0x45, 0x88, 0x02, 0x45, 0x8E, 0x10, 0x8C, 0x45, 0x83, 0x02,
+    0x8B, 0x45, 0x83, 0x0E, 0x82, 0x45, 0x8E, 0x03, 0x86, 0x45, 0x89, 0x0E, 0x87, 0x45, 0x8A, 0x03,
+    0x81, 0x45, 0x8E, 0x0E, 0x8D, 0x45, 0x85, 0x04, 0x8C, 0x45, 0x84, 0x0C, 0x82, 0x46, 0x05, 0x87,
+    0x45, 0x8A, 0x0C, 0x88, 0x45, 0x8B, 0x05, 0x82, 0x46, 0x0C, 0x8E, 0x45, 0x86, 0x06, 0x8D, 0x45,
+    0x85, 0x0A, 0x83, 0x46, 0x81, 0x06, 0x88, 0x45, 0x8B, 0x0A, 0x89, 0x45, 0x8C, 0x07, 0x83, 0x46,
+    0x81, 0x09, 0x8E, 0x56, 0x86, 0x08, 0x84, 0x57, 0x8C, 0x08, 0x8A, 0x58, 0x81, 0x07, 0x59, 0x87,
+    0x06, 0x85, 0x59, 0x8C, 0x06, 0x8A, 0x5A, 0x82, 0x05, 0x46, 0x8C, 0xF5, 0xB5, 0x87, 0x46, 0x88,
+    0x04, 0x86, 0x46, 0x86, 0x0C, 0x8E, 0x45, 0x8D, 0x04, 0x8B, 0x46, 0x81, 0x0C, 0x89, 0x46, 0x83,
+    0x02, 0x81, 0x46, 0x8C, 0x0D, 0x84, 0x46, 0x89, 0x02, 0x86, 0x46, 0x88, 0x0E, 0x46, 0x8E, 0x02,
+    0x8C, 0x46, 0x83, 0x0E, 0x8B, 0x46, 0x84, 0x00, 0x82, 0x46, 0x8E, 0x0F, 0x86, 0x46, 0x89, 0x00,
+    0x87, 0x46, 0x89, 0x0F, 0x81, 0x47, 0x00, 0x8D, 0x46, 0x84, 0x10, 0x8C, 0x46, 0x85, 0x0D, 0x81,
+    0x85, 0x98, 0x86, 0x82, 0x1B, 0x87, 0x45, 0x8B, 0x81, 0x18, 0x88, 0x47, 0x8E, 0x81, 0x16, 0x83,
+    0x44, 0x8E, 0x43, 0x8B, 0x16, 0x89, 0x42, 0x8A, 0x01, 0x84, 0x43, 0x81, 0x15, 0x8C, 0x42, 0x03,
+    0x89, 0x42, 0x85, 0x15, 0x8D, 0x41, 0x8E, 0x03, 0x87, 0x42, 0x86, 0x15, 0x8C, 0x42, 0x81, 0x02,
+    0x8A, 0x42, 0x85, 0x15, 0x88, 0x42, 0x8B, 0x82, 0x00, 0x86, 0x43, 0x81, 0x15, 0x82, 0x49, 0x8B,
+    0x17, 0x49, 0x86, 0x16, 0x84, 0x49, 0x8B, 0x16, 0x8A, 0x4A, 0x81, 0x15, 0x4B, 0x86, 0x14, 0x85,
+    0x4B, 0x8C, 0x14, 0x8A, 0x45, 0x88, 0x45, 0x82, 0x13, 0x45, 0x8B, 0x83, 0x45, 0x87, 0x12, 0x86,
+    0x45, 0x86, 0x00, 0x8E, 0x44, 0x8D, 0x12, 0x8B, 0x45, 0x82, 0x00, 0x89, 0x45, 0x82, 0x10, 0x81,
+    0x45, 0x8D, 0x01, 0x85, 0x45, 0x88, 0x10, 0x86, 0x45, 0x88, 0x02, 0x45, 0x8E, 0x10, 0x8C, 0x45,
+    0x83, 0x02, 0x8B, 0x45, 0x83, 0x0E, 0x82, 0x45, 0x8E, 0x03, 0x86, 0x45, 0x89, 0x0E, 0x87, 0x45,
+    0x8A, 0x03, 0x81, 0x45, 0x8E, 0x0E, 0x8D, 0x45, 0x85, 0x04, 0x8C, 0x45, 0x84, 0x0C, 0x82, 0x46,
+    0x05, 0x87, 0x45, 0x8A, 0x0C, 0x88, 0x45, 0x8B, 0x05, 0x82, 0x46, 0x0C, 0x8E, 0x45, 0x86, 0x06,
+    0x8D, 0x45, 0x85, 0x0A, 0x83, 0x46, 0x81, 0x06, 0x88, 0x45, 0x8B, 0x0A, 0x89, 0x45, 0x8C, 0x07,
+    0x83, 0x46, 0x81, 0x09, 0x8E, 0x56, 0x86, 0x08, 0x84, 0x57, 0x8C, 0x08, 0x8A, 0x58, 0x81, 0x07,
+    0x59, 0x87, 0x06, 0x85, 0x59, 0x8C, 0x06, 0x8A, 0x5A, 0x82, 0x05, 0x46, 0x8C, 0xF5, 0xB5, 0x87,
+    0x46, 0x88, 0x04, 0x86, 0x46, 0x86, 0x0C, 0x8E, 0x45, 0x8D, 0x04, 0x8B, 0x46, 0x81, 0x0C, 0x89,
+    0x46, 0x83, 0x02, 0x81, 0x46, 0x8C, 0x0D, 0x84, 0x46, 0x89, 0x02, 0x86, 0x46, 0x88, 0x0E, 0x46,
+    0x8E, 0x02, 0x8C, 0x46, 0x83, 0x0E, 0x8B, 0x46, 0x84, 0x00, 0x82, 0x46, 0x8E, 0x0F, 0x86, 0x46,
+    0x89, 0x00, 0x87, 0x46, 0x89, 0x0F, 0x81, 0x47, 0x00, 0x8D, 0x46, 0x84, 0x10, 0x8C, 0x46, 0x85,
+    0x0E, 0x83, 0x5B, 0x8A, 0x0E, 0x8A, 0x5B, 0x8A, 0x0D, 0x82, 0x5C, 0x8A, 0x0D, 0x89, 0x5C, 0x8A,
+    0x0C, 0x81, 0x5D, 0x8A, 0x0C, 0x87, 0x5D, 0x8A, 0x0C, 0x8E, 0x45, 0x88, 0x97, 0x8C, 0x45, 0x8E,
+    0xF3, 0xC3, 0x82, 0x0B, 0x85, 0x45, 0x8C, 0x02, 0x8A, 0x45, 0x8E, 0x19, 0x8C, 0x45, 0x85, 0x02,
+    0x8A, 0x45, 0x8E, 0x18, 0x83, 0x45, 0x8E, 0x03, 0x8A, 0x45, 0x8E, 0x18, 0x8A, 0x45, 0x88, 0x03,
+    0x8A, 0x45, 0x8E, 0x17, 0x82, 0x46, 0x81, 0x03, 0x8A, 0x45, 0x8E, 0x17, 0x89, 0x45, 0x8B, 0x04,
+    0x8A, 0x45, 0x8E, 0x17, 0x46, 0x84, 0x04, 0x8A, 0x45, 0x8E, 0x16, 0x87, 0x45, 0x8D, 0x05, 0x8A,
+    0x52, 0x8C, 0x09, 0x8E, 0x45, 0x86, 0x05, 0x8A, 0x52, 0x8C, 0x08, 0x85, 0x46, 0x06, 0x8A, 0x52,
+    0x8C, 0x08, 0x8C, 0x45, 0x89, 0x06, 0x8A, 0x52, 0x8C, 0x07, 0x83, 0x46, 0x82, 0x06, 0x8A, 0x52,
+    0x8C, 0x07, 0x8A, 0x45, 0x8B, 0x07, 0x8A, 0x52, 0x8C, 0x06, 0x82, 0x46, 0x85, 0x07, 0x8A, 0x45,
+    0x8E, 0xF3, 0xB3, 0x82, 0x06, 0x89, 0x56, 0x8E, 0x13, 0x57, 0x8E, 0x12, 0x87, 0x57, 0x8E, 0x12,
+    0x8E, 0x57, 0x8E, 0x11, 0x85, 0x58, 0x8E, 0x11, 0x8C, 0x58, 0x8E, 0x10, 0x83, 0x46, 0x87, 0xF5,
+    0xA5, 0x8C, 0x45, 0x8E, 0x10, 0x8A, 0x45, 0x8D, 0x0B, 0x8A, 0x45, 0x8E, 0x0F, 0x82, 0x46, 0x87,
+    0x0B, 0x8A, 0x45, 0x8E, 0xF4, 0xC4, 0x82, 0x01, 0x88, 0x46, 0x81, 0x0B, 0x8A, 0x53, 0x8A, 0x01,
+    0x46, 0x89, 0x0C, 0x8A, 0x53, 0x8A, 0x00, 0x87, 0x46, 0x82, 0x0C, 0x8A, 0x53, 0x8A, 0x00, 0x8E,
+    0x45, 0x8B, 0x0D, 0x8A, 0x53, 0x8A, 0x85, 0x46, 0x85, 0x0D, 0x8A, 0x53, 0x8A, 0x8C, 0x45, 0x8E,
+    0x0E, 0x8A, 0x53, 0x8A, 0x0B, 0x85, 0x88, 0x8B, 0x8D, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x86, 0x82,
+    0x0D, 0x82, 0x8A, 0x4C, 0x8E, 0x88, 0x82, 0x09, 0x89, 0x51, 0x8B, 0x06, 0x83, 0x8E, 0x52, 0x8B,
+    0x05, 0x84, 0x54, 0x85, 0x04, 0x82, 0x54, 0x8E, 0x05, 0x8D, 0x48, 0x8D, 0x88, 0x86, 0x95, 0x87,
+    0x8B, 0x44, 0x88, 0x04, 0x87, 0x47, 0x8E, 0x84, 0x07, 0x85, 0x8C, 0x41, 0x82, 0x03, 0x81, 0x47,
+    0x8D, 0x81, 0x0A, 0x82, 0x86, 0x04, 0x87, 0x46, 0x8E, 0x81, 0x12, 0x8E, 0x46, 0x86, 0x12, 0x83,
+    0x46, 0x8D, 0x13, 0x87, 0x46, 0x88, 0x13, 0x8A, 0x46, 0x83, 0x13, 0x8D, 0x46, 0x14, 0x46, 0x8D,
+    0x14, 0x46, 0x8C, 0x13, 0x81, 0x46, 0x8B, 0x13, 0x81, 0x46, 0x8B, 0x14, 0x46, 0x8C, 0x14, 0x46,
+    0x8C, 0x14, 0x8E, 0x46, 0x14, 0x8C, 0x46, 0x81, 0x13, 0x89, 0x46, 0x85, 0x13, 0x86, 0x46, 0x8B,
+    0x13, 0x81, 0x47, 0x82, 0x13, 0x8C, 0x46, 0x8B, 0x13, 0x86, 0x47, 0x89, 0x13, 0x8E, 0x47, 0x8B,
+    0x82, 0x08, 0x82, 0x87, 0x9C, 0x04, 0x85, 0x49, 0x8C, 0x88, 0x86, 0x95, 0x86, 0x88, 0x8B, 0x8E,
+    0x42, 0x8C, 0x05, 0x8A, 0x54, 0x8C, 0x06, 0x8C, 0x53, 0x8C, 0x07, 0x8B, 0x52, 0x8C, 0x08, 0x87,
+    0x51, 0x8C, 0x09, 0x82, 0x89, 0x4E, 0x89, 0x83, 0x0C, 0x84, 0x88, 0x8B, 0x8D, 0x42, 0x9E, 0x8C,
+    0x8A, 0x87, 0x83, 0x11, 0x8D, 0x42, 0x8E, 0x16, 0x85, 0x43, 0x89, 0x16, 0x8D, 0x43, 0x8E, 0x88,
+    0x81, 0x13, 0x84, 0x46, 0x8D, 0x82, 0x14, 0x84, 0x8B, 0x44, 0x8D, 0x16, 0x8C, 0x44, 0x84, 0x15,
+    0x88, 0x44, 0x86, 0x10, 0x96, 0x83, 0x82, 0x83, 0x8D, 0x44, 0x84, 0x10, 0x8B, 0x49, 0x81, 0x10,
+    0x8B, 0x48, 0x89, 0x11, 0x8B, 0x47, 0x8A, 0x12, 0x86, 0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x89, 0x83,
+    0x09, 0x01, 0x88, 0x46, 0x8E, 0x81, 0x0C, 0x89, 0x46, 0x8B, 0x0D, 0x87, 0x46, 0x87, 0x0D, 0x85,
+    0x46, 0x83, 0x0D, 0x83, 0x8E, 0x44, 0x8E, 0x81, 0x0D, 0x81, 0x8B, 0x44, 0x8C, 0x0F, 0x88, 0x44,
+    0x8A, 0x0F, 0x84, 0x8E, 0x43, 0x85, 0x30, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00,
+    0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x46, 0x84, 0xF3, 0xB3, 0x00, 0x88,
+    0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88,
+    0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x52, 0x82, 0x00, 0x88,
+    0x52, 0x82, 0x00, 0x88, 0x52, 0x82, 0x00, 0x88, 0x52, 0x82, 0x00, 0x88, 0x52, 0x82, 0x00, 0x88,
+    0x52, 0x82, 0x00, 0x88, 0x46, 0x84, 0xF3, 0xA3, 0x01, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81,
+    0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81,
+    0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0xF4, 0xC4, 0x00, 0x88, 0x53,
+    0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00,
+    0x0A, 0x84, 0x47, 0x85, 0x0B, 0x8D, 0x46, 0x86, 0x0B, 0x8A, 0x46, 0x84, 0x0B, 0x87, 0x45, 0x8E,
+    0x82, 0x0B, 0x84, 0x45, 0x8C, 0x81, 0x0B, 0x82, 0x8E, 0x44, 0x89, 0x0C, 0x81, 0x8D, 0x44, 0x85,
+    0x0D, 0x89, 0x43, 0x8D, 0x82, 0x34, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88,
+    0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x46, 0x84, 0xF3, 0xB3, 0x00, 0x88, 0x46,
+    0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46,
+    0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x52, 0x82, 0x00, 0x88, 0x52,
+    0x82, 0x00, 0x88, 0x52, 0x82, 0x00, 0x88, 0x52, 0x82, 0x00, 0x88, 0x52, 0x82, 0x00, 0x88, 0x52,
+    0x82, 0x00, 0x88, 0x46, 0x84, 0xF3, 0xA3, 0x01, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C,
+    0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C,
+    0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0xF4, 0xC4, 0x00, 0x88, 0x53, 0x00,
+    0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x05,
+    0x8C, 0x47, 0x88, 0x0A, 0x88, 0x49, 0x84, 0x08, 0x84, 0x4A, 0x8E, 0x82, 0x06, 0x82, 0x45, 0x8E,
+    0x45, 0x8D, 0x81, 0x04, 0x81, 0x8E, 0x44, 0x8D, 0x82, 0x85, 0x45, 0x8C, 0x03, 0x81, 0x8D, 0x44,
+    0x8B, 0x81, 0x01, 0x84, 0x8E, 0x44, 0x8A, 0x01, 0x81, 0x8D, 0x44, 0x87, 0x04, 0x81, 0x8B, 0x44,
+    0x8A, 0x00, 0x8A, 0x43, 0x8C, 0x83, 0x07, 0x85, 0x8E, 0x43, 0x86, 0x2B, 0x88, 0x53, 0x00, 0x88,
+    0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x46,
+    0x84, 0xF3, 0xB3, 0x00, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C,
+    0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C,
+    0x88, 0x52, 0x82, 0x00, 0x88, 0x52, 0x82, 0x00, 0x88, 0x52, 0x82, 0x00, 0x88, 0x52, 0x82, 0x00,
+    0x88, 0x52, 0x82, 0x00, 0x88, 0x52, 0x82, 0x00, 0x88, 0x46, 0x84, 0xF3, 0xA3, 0x01, 0x88, 0x46,
+    0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46,
+    0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46,
+    0xF4, 0xC4, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88,
+    0x53, 0x00, 0x88, 0x53, 0x00, 0x03, 0x83, 0x97, 0x83, 0x05, 0x84, 0x97, 0x83, 0x06, 0x88, 0x43,
+    0x89, 0x03, 0x8A, 0x43, 0x88, 0x04, 0x82, 0x45, 0x83, 0x01, 0x84, 0x45, 0x82, 0x03, 0x84, 0x45,
+    0x86, 0x01, 0x87, 0x45, 0x85, 0x03, 0x83, 0x45, 0x85, 0x01, 0x86, 0x45, 0x84, 0x04, 0x8D, 0x43,
+    0x8E, 0x02, 0x81, 0x8E, 0x43, 0x8D, 0x05, 0x82, 0x8A, 0x9E, 0x8B, 0x82, 0x03, 0x83, 0x8B, 0x40,
+    0x8E, 0x8A, 0x81, 0x3F, 0x04, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53,
+    0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x46, 0x84, 0xF3, 0xB3, 0x00, 0x88, 0x46, 0x81,
+    0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81,
+    0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x52, 0x82, 0x00, 0x88, 0x52, 0x82,
+    0x00, 0x88, 0x52, 0x82, 0x00, 0x88, 0x52, 0x82, 0x00, 0x88, 0x52, 0x82, 0x00, 0x88, 0x52, 0x82,
+    0x00, 0x88, 0x46, 0x84, 0xF3, 0xA3, 0x01, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88,
+    0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88,
+    0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0xF4, 0xC4, 0x00, 0x88, 0x53, 0x00, 0x88,
+    0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x88, 0x53, 0x00, 0x84, 0x47,
+    0x84, 0x05, 0x85, 0x46, 0x8E, 0x81, 0x05, 0x84, 0x46, 0x8B, 0x06, 0x82, 0x8D, 0x45, 0x87, 0x06,
+    0x81, 0x8B, 0x45, 0x84, 0x07, 0x88, 0x45, 0x82, 0x07, 0x85, 0x44, 0x8D, 0x81, 0x07, 0x82, 0x8C,
+    0x43, 0x89, 0x23, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x04, 0x88, 0x47, 0x81, 0x03, 0x83, 0x46, 0x8E, 0x83, 0x03, 0x81, 0x8E, 0x45, 0x8D,
+    0x82, 0x04, 0x8B, 0x45, 0x8B, 0x05, 0x88, 0x45, 0x88, 0x05, 0x85, 0x45, 0x85, 0x05, 0x83, 0x44,
+    0x8D, 0x82, 0x06, 0x8D, 0x43, 0x8A, 0x26, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x88,
+    0x46, 0x81, 0x05, 0x88, 0x46, 0x81, 0x05, 0x05, 0x86, 0x47, 0x8E, 0x0A, 0x82, 0x49, 0x8A, 0x09,
+    0x8D, 0x4A, 0x87, 0x07, 0x8B, 0x45, 0x8E, 0x45, 0x84, 0x05, 0x8A, 0x45, 0x86, 0x81, 0x8D, 0x45,
+    0x83, 0x03, 0x88, 0x44, 0x8E, 0x84, 0x01, 0x81, 0x8B, 0x44, 0x8E, 0x82, 0x01, 0x88, 0x44, 0x8B,
+    0x81, 0x04, 0x87, 0x44, 0x8E, 0x82, 0x84, 0x44, 0x86, 0x07, 0x82, 0x8B, 0x43, 0x8C, 0x32, 0x88,
+    0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88,
+    0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88,
+    0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88,
+    0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88,
+    0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88,
+    0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88,
+    0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88,
+    0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88,
+    0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x0C, 0x88, 0x46, 0x81, 0x05, 0x01,
+    0x81, 0x86, 0x87, 0x85, 0x05, 0x82, 0x86, 0x87, 0x84, 0x02, 0x84, 0x43, 0x8C, 0x03, 0x86, 0x43,
+    0x8C, 0x01, 0x8D, 0x44, 0x87, 0x02, 0x45, 0x86, 0x00, 0x45, 0x8B, 0x01, 0x82, 0x45, 0x89, 0x00,
+    0x45, 0x89, 0x01, 0x81, 0x45, 0x88, 0x00, 0x89, 0x44, 0x83, 0x02, 0x8C, 0x44, 0x82, 0x01, 0x88,
+    0x8E, 0x40, 0x8C, 0x84, 0x03, 0x81, 0x89, 0x8E, 0x40, 0x8C, 0x83, 0x3B, 0x88, 0x46, 0x81, 0x08,
+    0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08,
+    0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08,
+    0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08,
+    0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08,
+    0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08,
+    0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08,
+    0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08,
+    0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08,
+    0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x08, 0x88, 0x46, 0x81, 0x03, 0x02, 0x88, 0x4B, 0x8E,
+    0x8D, 0x8B, 0x89, 0x86, 0x81, 0x0E, 0x88, 0x51, 0x8C, 0x86, 0x0C, 0x88, 0x53, 0x8E, 0x86, 0x0A,
+    0x88, 0x55, 0x8C, 0x81, 0x08, 0x88, 0x56, 0x8E, 0x82, 0x07, 0x88, 0x57, 0x8E, 0x82, 0x06, 0x88,
+    0x46, 0x84, 0xB3, 0x85, 0x86, 0x8A, 0x8E, 0x48, 0x8D, 0x06, 0x88, 0x46, 0x81, 0x07, 0x87, 0x8E,
+    0x47, 0x88, 0x05, 0x88, 0x46, 0x81, 0x08, 0x82, 0x8D, 0x47, 0x82, 0x04, 0x88, 0x46, 0x81, 0x09,
+    0x82, 0x47, 0x89, 0x04, 0x88, 0x46, 0x81, 0x0A, 0x86, 0x47, 0x04, 0x88, 0x46, 0x81, 0x0B, 0x8E,
+    0x46, 0x84, 0x03, 0x88, 0x46, 0x81, 0x0B, 0x88, 0x46, 0x88, 0x03, 0x88, 0x46, 0x81, 0x0B, 0x84,
+    0x46, 0x8C, 0x03, 0x88, 0x46, 0x81, 0x0C, 0x46, 0x8E, 0x00, 0x8D, 0x4E, 0x8D, 0x07, 0x8E, 0x46,
+    0x00, 0x8D, 0x4E, 0x8D, 0x07, 0x8D, 0x46, 0x81, 0x8D, 0x4E, 0x8D, 0x07, 0x8C, 0x46, 0x81, 0x8D,
+    0x4E, 0x8D, 0x07, 0x8C, 0x46, 0x81, 0x8D, 0x4E, 0x8D, 0x07, 0x8D, 0x46, 0x00, 0x8D, 0x4E, 0x8D,
+    0x07, 0x8E, 0x46, 0x00, 0x82, 0x93, 0x89, 0x46, 0x84, 0xB3, 0x82, 0x06, 0x81, 0x46, 0x8D, 0x03,
+    0x88, 0x46, 0x81, 0x0B, 0x85, 0x46, 0x8A, 0x03, 0x88, 0x46, 0x81, 0x0B, 0x89, 0x46, 0x87, 0x03,
+    0x88, 0x46, 0x81, 0x0A, 0x81, 0x47, 0x82, 0x03, 0x88, 0x46, 0x81, 0x0A, 0x89, 0x46, 0x8D, 0x04,
+    0x88, 0x46, 0x81, 0x09, 0x84, 0x47, 0x86, 0x04, 0x88, 0x46, 0x81, 0x08, 0x86, 0x47, 0x8E, 0x05,
+    0x88, 0x46, 0x81, 0x06, 0x83, 0x8B, 0x48, 0x85, 0x05, 0x88, 0x46, 0xB4, 0x85, 0x86, 0x89, 0x8D,
+    0x49, 0x8A, 0x06, 0x88, 0x57, 0x8C, 0x07, 0x88, 0x56, 0x8C, 0x81, 0x07, 0x88, 0x55, 0x88, 0x09,
+    0x88, 0x53, 0x8C, 0x83, 0x0A, 0x88, 0x50, 0x8E, 0x89, 0x83, 0x0C, 0x88, 0x4B, 0x8D, 0x8C, 0x8A,
+    0x87, 0x83, 0x0C, 0x08, 0x81, 0x88, 0x8D, 0x40, 0x8E, 0x8A, 0x82, 0x05, 0x85, 0x42, 0x86, 0x0D,
+    0x83, 0x8E, 0x45, 0x89, 0x81, 0x03, 0x8B, 0x42, 0x84, 0x0C, 0x81, 0x8E, 0x47, 0x8E, 0x87, 0x81,
+    0x00, 0x87, 0x43, 0x0D, 0x8A, 0x50, 0x8B, 0x0C, 0x81, 0x51, 0x84, 0x0C, 0x86, 0x42, 0x8E, 0x83,
+    0x00, 0x83, 0x8A, 0x48, 0x8A, 0x0D, 0x89, 0x42, 0x85, 0x03, 0x83, 0x8C, 0x45, 0x8B, 0x0E, 0x8B,
+    0x42, 0x06, 0x85, 0x8C, 0x40, 0x8E, 0x8C, 0x85, 0x3F, 0x0B, 0x88, 0x48, 0x85, 0x0D, 0x8A, 0x45,
+    0x82, 0x88, 0x48, 0x8D, 0x0D, 0x8A, 0x45, 0x82, 0x88, 0x49, 0x87, 0x0C, 0x8A, 0x45, 0x82, 0x88,
+    0x4A, 0x81, 0x0B, 0x8A, 0x45, 0x82, 0x88, 0x4A, 0x89, 0x0B, 0x8A, 0x45, 0x82, 0x88, 0x4B, 0x83,
+    0x0A, 0x8A, 0x45, 0x82, 0x88, 0x4B, 0x8C, 0x0A, 0x8A, 0x45, 0x82, 0x88, 0x4C, 0x85, 0x09, 0x8A,
+    0x45, 0x82, 0x88, 0x4C, 0x8E, 0x09, 0x8A, 0x45, 0x82, 0x88, 0x44, 0x8D, 0x89, 0x46, 0x87, 0x08,
+    0x8A, 0x45, 0x82, 0x88, 0x44, 0x8E, 0x81, 0x8E, 0x46, 0x81, 0x07, 0x8A, 0x45, 0x82, 0x88, 0x45,
+    0x00, 0x86, 0x46, 0x8A, 0x07, 0x8A, 0x45, 0x82, 0x88, 0x45, 0x01, 0x8D, 0x46, 0x83, 0x06, 0x8A,
+    0x45, 0x82, 0x88, 0x45, 0x81, 0x00, 0x84, 0x46, 0x8C, 0x06, 0x8A, 0x45, 0x82, 0x88, 0x45, 0x81,
+    0x01, 0x8B, 0x46, 0x85, 0x05, 0x8A, 0x45, 0x82, 0x88, 0x45, 0x82, 0x01, 0x82, 0x46, 0x8E, 0x05,
+    0x8A, 0x45, 0x82, 0x88, 0x45, 0x83, 0x02, 0x89, 0x46, 0x88, 0x04, 0x8A, 0x45, 0x82, 0x88, 0x45,
+    0x83, 0x02, 0x81, 0x8E, 0x46, 0x82, 0x03, 0x8A, 0x45, 0x82, 0x88, 0x45, 0x83, 0x03, 0x87, 0x46,
+    0x8A, 0x03, 0x8A, 0x45, 0x82, 0x88, 0x45, 0x83, 0x04, 0x8D, 0x46, 0x83, 0x02, 0x89, 0x45, 0x82,
+    0x88, 0x45, 0x84, 0x04, 0x84, 0x46, 0x8D, 0x02, 0x89, 0x45, 0x82, 0x88, 0x45, 0x84, 0x05, 0x8B,
+    0x46, 0x86, 0x01, 0x88, 0x45, 0x82, 0x88, 0x45, 0x84, 0x05, 0x82, 0x46, 0x8E, 0x01, 0x88, 0x45,
+    0x82, 0x88, 0x45, 0x84, 0x06, 0x89, 0x46, 0x88, 0x00, 0x87, 0x45, 0x82, 0x88, 0x45, 0x84, 0x06,
+    0x81, 0x47, 0x82, 0x86, 0x45, 0x82, 0x88, 0x45, 0x84, 0x07, 0x87, 0x46, 0x8B, 0x85, 0x45, 0x82,
+    0x88, 0x45, 0x84, 0x08, 0x8D, 0x46, 0x89, 0x45, 0x82, 0x88, 0x45, 0x84, 0x08, 0x85, 0x4D, 0x82,
+    0x88, 0x45, 0x84, 0x09, 0x8B, 0x4C, 0x82, 0x88, 0x45, 0x84, 0x09, 0x82, 0x4C, 0x82, 0x88, 0x45,
+    0x84, 0x0A, 0x89, 0x4B, 0x82, 0x88, 0x45, 0x84, 0x0A, 0x81, 0x4B, 0x82, 0x88, 0x45, 0x84, 0x0B,
+    0x87, 0x4A, 0x82, 0x88, 0x45, 0x84, 0x0C, 0x8D, 0x49, 0x82, 0x88, 0x45, 0x84, 0x0C, 0x85, 0x49,
+    0x82, 0x88, 0x45, 0x84, 0x0D, 0x8C, 0x48, 0x82, 0x08, 0x8E, 0x46, 0x8A, 0x19, 0x82, 0x8D, 0x46,
+    0x85, 0x19, 0x81, 0x8C, 0x46, 0x82, 0x1A, 0x89, 0x45, 0x8D, 0x1B, 0x87, 0x45, 0x8A, 0x1B, 0x84,
+    0x8E, 0x44, 0x87, 0x1B, 0x81, 0x8C, 0x44, 0x85, 0x1C, 0x88, 0x44, 0x3F, 0x1C, 0x81, 0x86, 0x89,
+    0x8C, 0x8D, 0x43, 0x8D, 0x8B, 0x89, 0x85, 0x81, 0x12, 0x85, 0x8C, 0x4D, 0x8B, 0x84, 0x0E, 0x83,
+    0x8D, 0x51, 0x8B, 0x82, 0x0B, 0x87, 0x55, 0x85, 0x09, 0x88, 0x57, 0x86, 0x07, 0x87, 0x59, 0x84,
+    0x05, 0x83, 0x49, 0x8E, 0x89, 0x86, 0x95, 0x86, 0x89, 0x8E, 0x48, 0x8E, 0x81, 0x04, 0x8C, 0x47,
+    0x8E, 0x85, 0x07, 0x86, 0x8E, 0x47, 0x89, 0x03, 0x84, 0x47, 0x8D, 0x81, 0x09, 0x82, 0x8E, 0x47,
+    0x81, 0x02, 0x8B, 0x46, 0x8E, 0x81, 0x0B, 0x82, 0x47, 0x87, 0x01, 0x81, 0x47, 0x86, 0x0D, 0x88,
+    0x46, 0x8D, 0x01, 0x85, 0x46, 0x8E, 0x0E, 0x81, 0x47, 0x82, 0x00, 0x89, 0x46, 0x88, 0x0F, 0x8B,
+    0x46, 0x85, 0x00, 0x8C, 0x46, 0x84, 0x0F, 0x88, 0x46, 0x88, 0x00, 0x8E, 0x46, 0x81, 0x0F, 0x85,
+    0x46, 0x8A, 0x00, 0x47, 0x10, 0x82, 0x46, 0x8C, 0x00, 0x46, 0x8E, 0x10, 0x82, 0x46, 0x8D, 0x81,
+    0x46, 0x8D, 0x10, 0x81, 0x46, 0x8D, 0x81, 0x46, 0x8D, 0x10, 0x81, 0x46, 0x8D, 0x00, 0x46, 0x8E,
+    0x10, 0x82, 0x46, 0x8D, 0x00, 0x47, 0x10, 0x82, 0x46, 0x8C, 0x00, 0x8E, 0x46, 0x82, 0x0F, 0x85,
+    0x46, 0x8A, 0x00, 0x8B, 0x46, 0x84, 0x0F, 0x88, 0x46, 0x88, 0x00, 0x88, 0x46, 0x89, 0x0F, 0x8C,
+    0x46, 0x85, 0x00, 0x85, 0x46, 0x8E, 0x0E, 0x81, 0x47, 0x81, 0x01, 0x47, 0x85, 0x0D, 0x89, 0x46,
+    0x8D, 0x02, 0x8A, 0x46, 0x8E, 0x81, 0x0B, 0x83, 0x47, 0x87, 0x02, 0x84, 0x47, 0x8C, 0x81, 0x09,
+    0x82, 0x8E, 0x47, 0x81, 0x03, 0x8C, 0x47, 0x8E, 0x85, 0x07, 0x87, 0x48, 0x88, 0x04, 0x82, 0x49,
+    0x8E, 0x89, 0x87, 0x96, 0x87, 0x8A, 0x49, 0x8E, 0x06, 0x86, 0x59, 0x83, 0x07, 0x88, 0x57, 0x85,
+    0x09, 0x87, 0x54, 0x8E, 0x84, 0x0B, 0x83, 0x8C, 0x51, 0x8B, 0x82, 0x0E, 0x85, 0x8C, 0x4D, 0x8A,
+    0x83, 0x12, 0x81, 0x86, 0x89, 0x8C, 0x8E, 0x43, 0x8D, 0x8B, 0x88, 0x85, 0x81, 0x09, 0x12, 0x88,
+    0x46, 0x8E, 0x81, 0x17, 0x83, 0x46, 0x8E, 0x82, 0x17, 0x81, 0x8E, 0x45, 0x8D, 0x81, 0x18, 0x8B,
+    0x45, 0x8B, 0x19, 0x88, 0x45, 0x88, 0x19, 0x86, 0x45, 0x85, 0x19, 0x83, 0x44, 0x8D, 0x82, 0x1A,
+    0x8E, 0x43, 0x8A, 0x3F, 0x1F, 0x81, 0x86, 0x89, 0x8C, 0x8D, 0x43, 0x8D, 0x8B, 0x89, 0x85, 0x81,
+    0x12, 0x85, 0x8C, 0x4D, 0x8B, 0x84, 0x0E, 0x83, 0x8D, 0x51, 0x8B, 0x82, 0x0B, 0x87, 0x55, 0x85,
+    0x09, 0x88, 0x57, 0x86, 0x07, 0x87, 0x59, 0x84, 0x05, 0x83, 0x49, 0x8E, 0x89, 0x86, 0x95, 0x86,
+    0x89, 0x8E, 0x48, 0x8E, 0x81, 0x04, 0x8C, 0x47, 0x8E, 0x85, 0x07, 0x86, 0x8E, 0x47, 0x89, 0x03,
+    0x84, 0x47, 0x8D, 0x81, 0x09, 0x82, 0x8E, 0x47, 0x81, 0x02, 0x8B, 0x46, 0x8E, 0x81, 0x0B, 0x82,
+    0x47, 0x87, 0x01, 0x81, 0x47, 0x86, 0x0D, 0x88, 0x46, 0x8D, 0x01, 0x85, 0x46, 0x8E, 0x0E, 0x81,
+    0x47, 0x82, 0x00, 0x89, 0x46, 0x88, 0x0F, 0x8B, 0x46, 0x85, 0x00, 0x8C, 0x46, 0x84, 0x0F, 0x88,
+    0x46, 0x88, 0x00, 0x8E, 0x46, 0x81, 0x0F, 0x85, 0x46, 0x8A, 0x00, 0x47, 0x10, 0x82, 0x46, 0x8C,
+    0x00, 0x46, 0x8E, 0x10, 0x82, 0x46, 0x8D, 0x81, 0x46, 0x8D, 0x10, 0x81, 0x46, 0x8D, 0x81, 0x46,
+    0x8D, 0x10, 0x81, 0x46, 0x8D, 0x00, 0x46, 0x8E, 0x10, 0x82, 0x46, 0x8D, 0x00, 0x47, 0x10, 0x82,
+    0x46, 0x8C, 0x00, 0x8E, 0x46, 0x82, 0x0F, 0x85, 0x46, 0x8A, 0x00, 0x8B, 0x46, 0x84, 0x0F, 0x88,
+    0x46, 0x88, 0x00, 0x88, 0x46, 0x89, 0x0F, 0x8C, 0x46, 0x85, 0x00, 0x85, 0x46, 0x8E, 0x0E, 0x81,
+    0x47, 0x81, 0x01, 0x47, 0x85, 0x0D, 0x89, 0x46, 0x8D, 0x02, 0x8A, 0x46, 0x8E, 0x81, 0x0B, 0x83,
+    0x47, 0x87, 0x02, 0x84, 0x47, 0x8C, 0x81, 0x09, 0x82, 0x8E, 0x47, 0x81, 0x03, 0x8C, 0x47, 0x8E,
+    0x85, 0x07, 0x87, 0x48, 0x88, 0x04, 0x82, 0x49, 0x8E, 0x89, 0x87, 0x96, 0x87, 0x8A, 0x49, 0x8E,
+    0x06, 0x86, 0x59, 0x83, 0x07, 0x88, 0x57, 0x85, 0x09, 0x87, 0x54, 0x8E, 0x84, 0x0B, 0x83, 0x8C,
+    0x51, 0x8B, 0x82, 0x0E, 0x85, 0x8C, 0x4D, 0x8A, 0x83, 0x12, 0x81, 0x86, 0x89, 0x8C, 0x8E, 0x43,
+    0x8D, 0x8B, 0x88, 0x85, 0x81, 0x09, 0x0C, 0x8C, 0x47, 0x89, 0x17, 0x87, 0x49, 0x84, 0x15, 0x84,
+    0x4B, 0x82, 0x13, 0x82, 0x8E, 0x44, 0x8E, 0x45, 0x8D, 0x81, 0x11, 0x81, 0x8E, 0x44, 0x8E, 0x82,
+    0x85, 0x45, 0x8C, 0x10, 0x81, 0x8D, 0x44, 0x8C, 0x81, 0x01, 0x83, 0x8E, 0x44, 0x8B, 0x0E, 0x81,
+    0x8C, 0x44, 0x88, 0x04, 0x81, 0x8B, 0x44, 0x8A, 0x0D, 0x8A, 0x43, 0x8D, 0x83, 0x07, 0x85, 0x8E,
+    0x43, 0x87, 0x3F, 0x16, 0x81, 0x86, 0x89, 0x8C, 0x8D, 0x43, 0x8D, 0x8B, 0x89, 0x85, 0x81, 0x12,
+    0x85, 0x8C, 0x4D, 0x8B, 0x84, 0x0E, 0x83, 0x8D, 0x51, 0x8B, 0x82, 0x0B, 0x87, 0x55, 0x85, 0x09,
+    0x88, 0x57, 0x86, 0x07, 0x87, 0x59, 0x84, 0x05, 0x83, 0x49, 0x8E, 0x89, 0x86, 0x95, 0x86, 0x89,
+    0x8E, 0x48, 0x8E, 0x81, 0x04, 0x8C, 0x47, 0x8E, 0x85, 0x07, 0x86, 0x8E, 0x47, 0x89, 0x03, 0x84,
+    0x47, 0x8D, 0x81, 0x09, 0x82, 0x8E, 0x47, 0x81, 0x02, 0x8B, 0x46, 0x8E, 0x81, 0x0B, 0x82, 0x47,
+    0x87, 0x01, 0x81, 0x47, 0x86, 0x0D, 0x88, 0x46, 0x8D, 0x01, 0x85, 0x46, 0x8E, 0x0E, 0x81, 0x47,
+    0x82, 0x00, 0x89, 0x46, 0x88, 0x0F, 0x8B, 0x46, 0x85, 0x00, 0x8C, 0x46, 0x84, 0x0F, 0x88, 0x46,
+    0x88, 0x00, 0x8E, 0x46, 0x81, 0x0F, 0x85, 0x46, 0x8A, 0x00, 0x47, 0x10, 0x82, 0x46, 0x8C, 0x00,
+    0x46, 0x8E, 0x10, 0x82, 0x46, 0x8D, 0x81, 0x46, 0x8D, 0x10, 0x81, 0x46, 0x8D, 0x81, 0x46, 0x8D,
+    0x10, 0x81, 0x46, 0x8D, 0x00, 0x46, 0x8E, 0x10, 0x82, 0x46, 0x8D, 0x00, 0x47, 0x10, 0x82, 0x46,
+    0x8C, 0x00, 0x8E, 0x46, 0x82, 0x0F, 0x85, 0x46, 0x8A, 0x00, 0x8B, 0x46, 0x84, 0x0F, 0x88, 0x46,
+    0x88, 0x00, 0x88, 0x46, 0x89, 0x0F, 0x8C, 0x46, 0x85, 0x00, 0x85, 0x46, 0x8E, 0x0E, 0x81, 0x47,
+    0x81, 0x01, 0x47, 0x85, 0x0D, 0x89, 0x46, 0x8D, 0x02, 0x8A, 0x46, 0x8E, 0x81, 0x0B, 0x83, 0x47,
+    0x87, 0x02, 0x84, 0x47, 0x8C, 0x81, 0x09, 0x82, 0x8E, 0x47, 0x81, 0x03, 0x8C, 0x47, 0x8E, 0x85,
+    0x07, 0x87, 0x48, 0x88, 0x04, 0x82, 0x49, 0x8E, 0x89, 0x87, 0x96, 0x87, 0x8A, 0x49, 0x8E, 0x06,
+    0x86, 0x59, 0x83, 0x07, 0x88, 0x57, 0x85, 0x09, 0x87, 0x54, 0x8E, 0x84, 0x0B, 0x83, 0x8C, 0x51,
+    0x8B, 0x82, 0x0E, 0x85, 0x8C, 0x4D, 0x8A, 0x83, 0x12, 0x81, 0x86, 0x89, 0x8C, 0x8E, 0x43, 0x8D,
+    0x8B, 0x88, 0x85, 0x81, 0x09, 0x0A, 0x83, 0x8A, 0x8E, 0x40, 0x8D, 0x87, 0x06, 0x8B, 0x42, 0x10,
+    0x88, 0x45, 0x8E, 0x85, 0x03, 0x82, 0x42, 0x8D, 0x0F, 0x86, 0x48, 0x8C, 0x84, 0x00, 0x81, 0x8C,
+    0x42, 0x8A, 0x0E, 0x81, 0x51, 0x85, 0x0E, 0x87, 0x50, 0x8E, 0x0F, 0x8C, 0x42, 0x8B, 0x81, 0x00,
+    0x85, 0x8D, 0x48, 0x84, 0x0F, 0x42, 0x8E, 0x04, 0x87, 0x8E, 0x45, 0x86, 0x0F, 0x82, 0x42, 0x89,
+    0x05, 0x81, 0x88, 0x8D, 0x40, 0x8E, 0x8A, 0x82, 0x3F, 0x1A, 0x81, 0x86, 0x89, 0x8C, 0x8D, 0x43,
+    0x8D, 0x8B, 0x89, 0x85, 0x81, 0x12, 0x85, 0x8C, 0x4D, 0x8B, 0x84, 0x0E, 0x83, 0x8D, 0x51, 0x8B,
+    0x82, 0x0B, 0x87, 0x55, 0x85, 0x09, 0x88, 0x57, 0x86, 0x07, 0x87, 0x59, 0x84, 0x05, 0x83, 0x49,
+    0x8E, 0x89, 0x86, 0x95, 0x86, 0x89, 0x8E, 0x48, 0x8E, 0x81, 0x04, 0x8C, 0x47, 0x8E, 0x85, 0x07,
+    0x86, 0x8E, 0x47, 0x89, 0x03, 0x84, 0x47, 0x8D, 0x81, 0x09, 0x82, 0x8E, 0x47, 0x81, 0x02, 0x8B,
+    0x46, 0x8E, 0x81, 0x0B, 0x82, 0x47, 0x87, 0x01, 0x81, 0x47, 0x86, 0x0D, 0x88, 0x46, 0x8D, 0x01,
+    0x85, 0x46, 0x8E, 0x0E, 0x81, 0x47, 0x82, 0x00, 0x89, 0x46, 0x88, 0x0F, 0x8B, 0x46, 0x85, 0x00,
+    0x8C, 0x46, 0x84, 0x0F, 0x88, 0x46, 0x88, 0x00, 0x8E, 0x46, 0x81, 0x0F, 0x85, 0x46, 0x8A, 0x00,
+    0x47, 0x10, 0x82, 0x46, 0x8C, 0x00, 0x46, 0x8E, 0x10, 0x82, 0x46, 0x8D, 0x81, 0x46, 0x8D, 0x10,
+    0x81, 0x46, 0x8D, 0x81, 0x46, 0x8D, 0x10, 0x81, 0x46, 0x8D, 0x00, 0x46, 0x8E, 0x10, 0x82, 0x46,
+    0x8D, 0x00, 0x47, 0x10, 0x82, 0x46, 0x8C, 0x00, 0x8E, 0x46, 0x82, 0x0F, 0x85, 0x46, 0x8A, 0x00,
+    0x8B, 0x46, 0x84, 0x0F, 0x88, 0x46, 0x88, 0x00, 0x88, 0x46, 0x89, 0x0F, 0x8C, 0x46, 0x85, 0x00,
+    0x85, 0x46, 0x8E, 0x0E, 0x81, 0x47, 0x81, 0x01, 0x47, 0x85, 0x0D, 0x89, 0x46, 0x8D, 0x02, 0x8A,
+    0x46, 0x8E, 0x81, 0x0B, 0x83, 0x47, 0x87, 0x02, 0x84, 0x47, 0x8C, 0x81, 0x09, 0x82, 0x8E, 0x47,
+    0x81, 0x03, 0x8C, 0x47, 0x8E, 0x85, 0x07, 0x87, 0x48, 0x88, 0x04, 0x82, 0x49, 0x8E, 0x89, 0x87,
+    0x96, 0x87, 0x8A, 0x49, 0x8E, 0x06, 0x86, 0x59, 0x83, 0x07, 0x88, 0x57, 0x85, 0x09, 0x87, 0x54,
+    0x8E, 0x84, 0x0B, 0x83, 0x8C, 0x51, 0x8B, 0x82, 0x0E, 0x85, 0x8C, 0x4D, 0x8A, 0x83, 0x12, 0x81,
+    0x86, 0x89, 0x8C, 0x8E, 0x43, 0x8D, 0x8B, 0x88, 0x85, 0x81, 0x09, 0x0A, 0x83, 0x97, 0x83, 0x05,
+    0x84, 0x87, 0x86, 0x82, 0x13, 0x89, 0x43, 0x88, 0x03, 0x8B, 0x43, 0x87, 0x11, 0x83, 0x45, 0x82,
+    0x01, 0x85, 0x45, 0x81, 0x10, 0x85, 0x45, 0x85, 0x01, 0x88, 0x45, 0x84, 0x10, 0x84, 0x45, 0x84,
+    0x01, 0x87, 0x45, 0x83, 0x11, 0x8E, 0x43, 0x8D, 0x02, 0x82, 0x44, 0x8C, 0x12, 0x82, 0x8B, 0x9E,
+    0x8A, 0x81, 0x03, 0x83, 0x8C, 0x40, 0x8E, 0x8A, 0x81, 0x3F, 0x3C, 0x81, 0x86, 0x89, 0x8C, 0x8D,
+    0x43, 0x8D, 0x8B, 0x89, 0x85, 0x81, 0x12, 0x85, 0x8C, 0x4D, 0x8B, 0x84, 0x0E, 0x83, 0x8D, 0x51,
+    0x8B, 0x82, 0x0B, 0x87, 0x55, 0x85, 0x09, 0x88, 0x57, 0x86, 0x07, 0x87, 0x59, 0x84, 0x05, 0x83,
+    0x49, 0x8E, 0x89, 0x86, 0x95, 0x86, 0x89, 0x8E, 0x48, 0x8E, 0x81, 0x04, 0x8C, 0x47, 0x8E, 0x85,
+    0x07, 0x86, 0x8E, 0x47, 0x89, 0x03, 0x84, 0x47, 0x8D, 0x81, 0x09, 0x82, 0x8E, 0x47, 0x81, 0x02,
+    0x8B, 0x46, 0x8E, 0x81, 0x0B, 0x82, 0x47, 0x87, 0x01, 0x81, 0x47, 0x86, 0x0D, 0x88, 0x46, 0x8D,
+    0x01, 0x85, 0x46, 0x8E, 0x0E, 0x81, 0x47, 0x82, 0x00, 0x89, 0x46, 0x88, 0x0F, 0x8B, 0x46, 0x85,
+    0x00, 0x8C, 0x46, 0x84, 0x0F, 0x88, 0x46, 0x88, 0x00, 0x8E, 0x46, 0x81, 0x0F, 0x85, 0x46, 0x8A,
+    0x00, 0x47, 0x10, 0x82, 0x46, 0x8C, 0x00, 0x46, 0x8E, 0x10, 0x82, 0x46, 0x8D, 0x81, 0x46, 0x8D,
+    0x10, 0x81, 0x46, 0x8D, 0x81, 0x46, 0x8D, 0x10, 0x81, 0x46, 0x8D, 0x00, 0x46, 0x8E, 0x10, 0x82,
+    0x46, 0x8D, 0x00, 0x47, 0x10, 0x82, 0x46, 0x8C, 0x00, 0x8E, 0x46, 0x82, 0x0F, 0x85, 0x46, 0x8A,
+    0x00, 0x8B, 0x46, 0x84, 0x0F, 0x88, 0x46, 0x88, 0x00, 0x88, 0x46, 0x89, 0x0F, 0x8C, 0x46, 0x85,
+    0x00, 0x85, 0x46, 0x8E, 0x0E, 0x81, 0x47, 0x81, 0x01, 0x47, 0x85, 0x0D, 0x89, 0x46, 0x8D, 0x02,
+    0x8A, 0x46, 0x8E, 0x81, 0x0B, 0x83, 0x47, 0x87, 0x02, 0x84, 0x47, 0x8C, 0x81, 0x09, 0x82, 0x8E,
+    0x47, 0x81, 0x03, 0x8C, 0x47, 0x8E, 0x85, 0x07, 0x87, 0x48, 0x88, 0x04, 0x82, 0x49, 0x8E, 0x89,
+    0x87, 0x96, 0x87, 0x8A, 0x49, 0x8E, 0x06, 0x86, 0x59, 0x83, 0x07, 0x88, 0x57, 0x85, 0x09, 0x87,
+    0x54, 0x8E, 0x84, 0x0B, 0x83, 0x8C, 0x51, 0x8B, 0x82, 0x0E, 0x85, 0x8C, 0x4D, 0x8A, 0x83, 0x12,
+    0x81, 0x86, 0x89, 0x8C, 0x8E, 0x43, 0x8D, 0x8B, 0x88, 0x85, 0x81, 0x09, 0x02, 0x84, 0x81, 0x0C,
+    0x85, 0x05, 0x84, 0x40, 0x8D, 0x81, 0x0A, 0x87, 0x40, 0x8B, 0x03, 0x84, 0x42, 0x8D, 0x81, 0x08,
+    0x87, 0x42, 0x8C, 0x01, 0x83, 0x44, 0x8D, 0x81, 0x06, 0x88, 0x44, 0x8C, 0x00, 0x87, 0x45, 0x8D,
+    0x81, 0x04, 0x88, 0x45, 0x8D, 0x81, 0x00, 0x88, 0x45, 0x8D, 0x81, 0x02, 0x88, 0x45, 0x8D, 0x81,
+    0x02, 0x88, 0x45, 0x8D, 0x81, 0x00, 0x89, 0x45, 0x8D, 0x81, 0x04, 0x88, 0x45, 0x8D, 0x8A, 0x45,
+    0x8D, 0x81, 0x06, 0x88, 0x4B, 0x8D, 0x81, 0x08, 0x88, 0x49, 0x8D, 0x81, 0x0A, 0x88, 0x47, 0x8D,
+    0x81, 0x0C, 0x8C, 0x46, 0x83, 0x0C, 0x88, 0x47, 0x8D, 0x81, 0x0A, 0x88, 0x49, 0x8D, 0x81, 0x08,
+    0x88, 0x4B, 0x8D, 0x81, 0x06, 0x87, 0x45, 0x8D, 0x89, 0x45, 0x8D, 0x81, 0x04, 0x87, 0x45, 0x8D,
+    0x81, 0x00, 0x88, 0x45, 0x8D, 0x81, 0x02, 0x87, 0x45, 0x8D, 0x81, 0x02, 0x88, 0x45, 0x8D, 0x81,
+    0x00, 0x86, 0x45, 0x8D, 0x81, 0x04, 0x88, 0x45, 0x8D, 0x81, 0x83, 0x44, 0x8D, 0x81, 0x06, 0x88,
+    0x44, 0x8B, 0x01, 0x83, 0x42, 0x8D, 0x81, 0x08, 0x87, 0x42, 0x8B, 0x03, 0x83, 0x40, 0x8D, 0x81,
+    0x0A, 0x87, 0x40, 0x8B, 0x05, 0x83, 0x81, 0x0C, 0x85, 0x03, 0x1B, 0x82, 0x20, 0x83, 0x40, 0x8A,
+    0x81, 0x0E, 0x81, 0x86, 0x89, 0x8C, 0x8D, 0x42, 0x8E, 0x8D, 0x8B, 0x88, 0x84, 0x02, 0x8D, 0x41,
+    0x8E, 0x85, 0x0B, 0x85, 0x8C, 0x4D, 0x9A, 0x44, 0x81, 0x08, 0x83, 0x8D, 0x55, 0x86, 0x08, 0x87,
+    0x56, 0x8B, 0x08, 0x88, 0x57, 0x86, 0x07, 0x87, 0x59, 0x83, 0x05, 0x83, 0x49, 0x8E, 0x89, 0x86,
+    0x95, 0x86, 0x89, 0x8E, 0x48, 0x8E, 0x05, 0x8C, 0x47, 0x8E, 0x85, 0x07, 0x8B, 0x48, 0x88, 0x03,
+    0x84, 0x47, 0x8D, 0x81, 0x07, 0x83, 0x4A, 0x81, 0x02, 0x8B, 0x46, 0x8E, 0x81, 0x08, 0x8D, 0x4A,
+    0x87, 0x01, 0x81, 0x47, 0x86, 0x08, 0x89, 0x4B, 0x8D, 0x01, 0x85, 0x46, 0x8E, 0x08, 0x84, 0x44,
+    0x86, 0x47, 0x82, 0x00, 0x89, 0x46, 0x88, 0x07, 0x81, 0x8E, 0x43, 0x8A, 0x00, 0x8B, 0x46, 0x85,
+    0x00, 0x8C, 0x46, 0x84, 0x07, 0x8A, 0x43, 0x8E, 0x81, 0x00, 0x88, 0x46, 0x88, 0x00, 0x8E, 0x46,
+    0x81, 0x06, 0x85, 0x44, 0x84, 0x01, 0x84, 0x46, 0x8A, 0x00, 0x47, 0x06, 0x81, 0x44, 0x89, 0x02,
+    0x82, 0x46, 0x8C, 0x00, 0x46, 0x8E, 0x06, 0x8B, 0x43, 0x8D, 0x03, 0x81, 0x46, 0x8D, 0x81, 0x46,
+    0x8D, 0x05, 0x87, 0x44, 0x83, 0x03, 0x81, 0x46, 0x8D, 0x81, 0x46, 0x8D, 0x04, 0x82, 0x44, 0x88,
+    0x04, 0x81, 0x46, 0x8D, 0x00, 0x46, 0x8E, 0x04, 0x8C, 0x43, 0x8D, 0x05, 0x82, 0x46, 0x8D, 0x00,
+    0x47, 0x03, 0x88, 0x44, 0x82, 0x05, 0x82, 0x46, 0x8C, 0x00, 0x8E, 0x46, 0x81, 0x01, 0x83, 0x44,
+    0x87, 0x06, 0x85, 0x46, 0x8A, 0x00, 0x8B, 0x46, 0x84, 0x01, 0x8D, 0x43, 0x8C, 0x07, 0x88, 0x46,
+    0x88, 0x00, 0x88, 0x46, 0x88, 0x00, 0x89, 0x44, 0x82, 0x07, 0x8C, 0x46, 0x85, 0x00, 0x85, 0x46,
+    0x8E, 0x84, 0x44, 0x86, 0x07, 0x81, 0x47, 0x81, 0x00, 0x81, 0x4C, 0x8B, 0x08, 0x89, 0x46, 0x8D,
+    0x02, 0x8B, 0x4A, 0x8E, 0x81, 0x07, 0x83, 0x47, 0x87, 0x02, 0x84, 0x4A, 0x85, 0x07, 0x82, 0x8E,
+    0x47, 0x81, 0x03, 0x8C, 0x48, 0x8C, 0x07, 0x87, 0x48, 0x88, 0x04, 0x83, 0x49, 0x8E, 0x89, 0x87,
+    0x96, 0x87, 0x8A, 0x49, 0x8E, 0x06, 0x87, 0x59, 0x83, 0x07, 0x89, 0x57, 0x85, 0x08, 0x8B, 0x55,
+    0x8E, 0x84, 0x08, 0x86, 0x55, 0x8B, 0x82, 0x08, 0x81, 0x44, 0x9B, 0x4D, 0x8A, 0x83, 0x0A, 0x81,
+    0x8B, 0x42, 0x8E, 0x81, 0x00, 0x81, 0x86, 0x89, 0x8C, 0x8E, 0x43, 0x8D, 0x8B, 0x88, 0x85, 0x81,
+    0x0E, 0x86, 0x41, 0x85, 0x1F, 0x81, 0x87, 0x1A, 0x04, 0x8B, 0x46, 0x8C, 0x15, 0x8B, 0x46, 0x88,
+    0x15, 0x8A, 0x46, 0x84, 0x15, 0x87, 0x45, 0x8E, 0x81, 0x15, 0x84, 0x45, 0x8C, 0x16, 0x82, 0x8D,
+    0x44, 0x8A, 0x17, 0x8A, 0x44, 0x88, 0x17, 0x86, 0x44, 0x82, 0x3F, 0x05, 0x8C, 0x45, 0x8C, 0x0D,
+    0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45,
+    0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88,
+    0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D,
+    0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45,
+    0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88,
+    0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D,
+    0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45,
+    0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88,
+    0x8B, 0x45, 0x8D, 0x0D, 0x46, 0x88, 0x8B, 0x45, 0x8E, 0x0C, 0x81, 0x46, 0x88, 0x89, 0x46, 0x81,
+    0x0B, 0x84, 0x46, 0x87, 0x88, 0x46, 0x84, 0x0B, 0x88, 0x46, 0x85, 0x84, 0x46, 0x8A, 0x0B, 0x8E,
+    0x46, 0x82, 0x00, 0x47, 0x84, 0x09, 0x88, 0x46, 0x8D, 0x01, 0x8B, 0x47, 0x86, 0x07, 0x89, 0x47,
+    0x87, 0x01, 0x82, 0x48, 0x8E, 0x89, 0x87, 0x85, 0x86, 0x87, 0x8A, 0x48, 0x8E, 0x03, 0x89, 0x57,
+    0x85, 0x04, 0x8C, 0x55, 0x88, 0x05, 0x81, 0x8C, 0x53, 0x88, 0x08, 0x88, 0x50, 0x8E, 0x85, 0x0A,
+    0x82, 0x89, 0x4C, 0x8D, 0x87, 0x0E, 0x81, 0x85, 0x88, 0x8C, 0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8A,
+    0x87, 0x83, 0x08, 0x0F, 0x8D, 0x46, 0x8A, 0x13, 0x89, 0x46, 0x8B, 0x13, 0x85, 0x46, 0x89, 0x13,
+    0x82, 0x46, 0x86, 0x14, 0x8D, 0x44, 0x8E, 0x84, 0x14, 0x8B, 0x44, 0x8C, 0x82, 0x14, 0x89, 0x44,
+    0x8A, 0x15, 0x83, 0x44, 0x86, 0x3F, 0x08, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C,
+    0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C,
+    0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46,
+    0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C,
+    0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C,
+    0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46,
+    0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C,
+    0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C,
+    0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8B, 0x45, 0x8D, 0x0D, 0x46,
+    0x88, 0x8B, 0x45, 0x8E, 0x0C, 0x81, 0x46, 0x88, 0x89, 0x46, 0x81, 0x0B, 0x84, 0x46, 0x87, 0x88,
+    0x46, 0x84, 0x0B, 0x88, 0x46, 0x85, 0x84, 0x46, 0x8A, 0x0B, 0x8E, 0x46, 0x82, 0x00, 0x47, 0x84,
+    0x09, 0x88, 0x46, 0x8D, 0x01, 0x8B, 0x47, 0x86, 0x07, 0x89, 0x47, 0x87, 0x01, 0x82, 0x48, 0x8E,
+    0x89, 0x87, 0x85, 0x86, 0x87, 0x8A, 0x48, 0x8E, 0x03, 0x89, 0x57, 0x85, 0x04, 0x8C, 0x55, 0x88,
+    0x05, 0x81, 0x8C, 0x53, 0x88, 0x08, 0x88, 0x50, 0x8E, 0x85, 0x0A, 0x82, 0x89, 0x4C, 0x8D, 0x87,
+    0x0E, 0x81, 0x85, 0x88, 0x8C, 0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x87, 0x83, 0x08, 0x09, 0x8C,
+    0x47, 0x89, 0x12, 0x87, 0x49, 0x84, 0x10, 0x84, 0x4B, 0x82, 0x0E, 0x82, 0x8E, 0x44, 0x8E, 0x45,
+    0x8D, 0x81, 0x0C, 0x81, 0x8E, 0x44, 0x8E, 0x82, 0x85, 0x45, 0x8C, 0x0B, 0x81, 0x8D, 0x44, 0x8C,
+    0x81, 0x01, 0x83, 0x8E, 0x44, 0x8B, 0x09, 0x81, 0x8C, 0x44, 0x88, 0x04, 0x81, 0x8B, 0x44, 0x8A,
+    0x08, 0x8A, 0x43, 0x8D, 0x83, 0x07, 0x85, 0x8E, 0x43, 0x87, 0x3F, 0x8C, 0x45, 0x8C, 0x0D, 0x46,
+    0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C,
+    0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C,
+    0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46,
+    0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C,
+    0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C,
+    0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46,
+    0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C,
+    0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8B,
+    0x45, 0x8D, 0x0D, 0x46, 0x88, 0x8B, 0x45, 0x8E, 0x0C, 0x81, 0x46, 0x88, 0x89, 0x46, 0x81, 0x0B,
+    0x84, 0x46, 0x87, 0x88, 0x46, 0x84, 0x0B, 0x88, 0x46, 0x85, 0x84, 0x46, 0x8A, 0x0B, 0x8E, 0x46,
+    0x82, 0x00, 0x47, 0x84, 0x09, 0x88, 0x46, 0x8D, 0x01, 0x8B, 0x47, 0x86, 0x07, 0x89, 0x47, 0x87,
+    0x01, 0x82, 0x48, 0x8E, 0x89, 0x87, 0x85, 0x86, 0x87, 0x8A, 0x48, 0x8E, 0x03, 0x89, 0x57, 0x85,
+    0x04, 0x8C, 0x55, 0x88, 0x05, 0x81, 0x8C, 0x53, 0x88, 0x08, 0x88, 0x50, 0x8E, 0x85, 0x0A, 0x82,
+    0x89, 0x4C, 0x8D, 0x87, 0x0E, 0x81, 0x85, 0x88, 0x8C, 0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x87,
+    0x83, 0x08, 0x07, 0x83, 0x97, 0x83, 0x05, 0x84, 0x87, 0x86, 0x82, 0x0E, 0x89, 0x43, 0x88, 0x03,
+    0x8B, 0x43, 0x87, 0x0C, 0x83, 0x45, 0x82, 0x01, 0x85, 0x45, 0x81, 0x0B, 0x85, 0x45, 0x85, 0x01,
+    0x88, 0x45, 0x84, 0x0B, 0x84, 0x45, 0x84, 0x01, 0x87, 0x45, 0x83, 0x0C, 0x8E, 0x43, 0x8D, 0x02,
+    0x82, 0x44, 0x8C, 0x0D, 0x82, 0x8B, 0x9E, 0x8A, 0x81, 0x03, 0x83, 0x8C, 0x40, 0x8E, 0x8A, 0x81,
+    0x3F, 0x20, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45,
+    0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88,
+    0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D,
+    0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45,
+    0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88,
+    0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D,
+    0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45,
+    0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88,
+    0x8C, 0x45, 0x8C, 0x0D, 0x46, 0x88, 0x8B, 0x45, 0x8D, 0x0D, 0x46, 0x88, 0x8B, 0x45, 0x8E, 0x0C,
+    0x81, 0x46, 0x88, 0x89, 0x46, 0x81, 0x0B, 0x84, 0x46, 0x87, 0x88, 0x46, 0x84, 0x0B, 0x88, 0x46,
+    0x85, 0x84, 0x46, 0x8A, 0x0B, 0x8E, 0x46, 0x82, 0x00, 0x47, 0x84, 0x09, 0x88, 0x46, 0x8D, 0x01,
+    0x8B, 0x47, 0x86, 0x07, 0x89, 0x47, 0x87, 0x01, 0x82, 0x48, 0x8E, 0x89, 0x87, 0x85, 0x86, 0x87,
+    0x8A, 0x48, 0x8E, 0x03, 0x89, 0x57, 0x85, 0x04, 0x8C, 0x55, 0x88, 0x05, 0x81, 0x8C, 0x53, 0x88,
+    0x08, 0x88, 0x50, 0x8E, 0x85, 0x0A, 0x82, 0x89, 0x4C, 0x8D, 0x87, 0x0E, 0x81, 0x85, 0x88, 0x8C,
+    0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x87, 0x83, 0x08, 0x0F, 0x85, 0x47, 0x83, 0x14, 0x81, 0x8E,
+    0x46, 0x85, 0x15, 0x8C, 0x45, 0x8E, 0x83, 0x15, 0x88, 0x45, 0x8D, 0x82, 0x15, 0x85, 0x45, 0x8B,
+    0x16, 0x83, 0x45, 0x88, 0x16, 0x81, 0x8E, 0x43, 0x8E, 0x84, 0x17, 0x8A, 0x43, 0x8C, 0x82, 0x3F,
+    0x0D, 0x8B, 0x46, 0x87, 0x0C, 0x83, 0x46, 0x8E, 0x00, 0x83, 0x46, 0x8E, 0x0C, 0x8B, 0x46, 0x86,
+    0x01, 0x8A, 0x46, 0x87, 0x0A, 0x83, 0x46, 0x8D, 0x02, 0x82, 0x46, 0x8E, 0x0A, 0x8B, 0x46, 0x85,
+    0x03, 0x89, 0x46, 0x87, 0x08, 0x83, 0x46, 0x8C, 0x04, 0x81, 0x46, 0x8E, 0x08, 0x8B, 0x46, 0x83,
+    0x05, 0x88, 0x46, 0x87, 0x06, 0x83, 0x46, 0x8B, 0x06, 0x81, 0x8E, 0x45, 0x8E, 0x06, 0x8B, 0x46,
+    0x82, 0x07, 0x87, 0x46, 0x87, 0x04, 0x83, 0x46, 0x89, 0x09, 0x8E, 0x45, 0x8E, 0x04, 0x8B, 0x46,
+    0x81, 0x09, 0x86, 0x46, 0x86, 0x02, 0x83, 0x46, 0x88, 0x0B, 0x8D, 0x45, 0x8E, 0x02, 0x8B, 0x45,
+    0x8E, 0x81, 0x0B, 0x85, 0x46, 0x86, 0x00, 0x83, 0x46, 0x87, 0x0D, 0x8C, 0x45, 0x8E, 0x00, 0x8B,
+    0x45, 0x8E, 0x0E, 0x84, 0x46, 0x8A, 0x46, 0x85, 0x0F, 0x8B, 0x4C, 0x8D, 0x10, 0x83, 0x4C, 0x84,
+    0x11, 0x8A, 0x4A, 0x8C, 0x12, 0x82, 0x4A, 0x83, 0x13, 0x89, 0x48, 0x8A, 0x14, 0x81, 0x48, 0x82,
+    0x15, 0x88, 0x46, 0x89, 0x16, 0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85,
+    0x16, 0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85,
+    0x16, 0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85,
+    0x16, 0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85, 0x16, 0x82, 0x46, 0x85, 0x0B, 0x88, 0x46, 0x81,
+    0x10, 0x88, 0x46, 0x81, 0x10, 0x88, 0x46, 0x81, 0x10, 0x88, 0x46, 0x81, 0x10, 0x88, 0x46, 0x81,
+    0x10, 0x88, 0x46, 0x81, 0x10, 0x88, 0x4B, 0x8E, 0x8D, 0x8C, 0x89, 0x85, 0x07, 0x88, 0x51, 0x89,
+    0x81, 0x04, 0x88, 0x52, 0x8E, 0x85, 0x03, 0x88, 0x54, 0x86, 0x02, 0x88, 0x55, 0x84, 0x01, 0x88,
+    0x55, 0x8C, 0x01, 0x88, 0x46, 0x83, 0xA2, 0x83, 0x86, 0x8A, 0x48, 0x84, 0x00, 0x88, 0x46, 0x81,
+    0x05, 0x82, 0x8E, 0x46, 0x89, 0x00, 0x88, 0x46, 0x81, 0x06, 0x83, 0x46, 0x8E, 0x00, 0x88, 0x46,
+    0x81, 0x07, 0x8C, 0x46, 0x00, 0x88, 0x46, 0x81, 0x07, 0x88, 0x46, 0x81, 0x88, 0x46, 0x81, 0x07,
+    0x88, 0x46, 0x82, 0x88, 0x46, 0x81, 0x07, 0x89, 0x46, 0x00, 0x88, 0x46, 0x81, 0x07, 0x8D, 0x46,
+    0x00, 0x88, 0x46, 0x81, 0x06, 0x84, 0x46, 0x8C, 0x00, 0x88, 0x46, 0x81, 0x05, 0x83, 0x8E, 0x46,
+    0x88, 0x00, 0x88, 0x46, 0x82, 0x91, 0x82, 0x83, 0x86, 0x8B, 0x48, 0x82, 0x00, 0x88, 0x55, 0x8A,
+    0x01, 0x88, 0x54, 0x8E, 0x81, 0x01, 0x88, 0x53, 0x8E, 0x82, 0x02, 0x88, 0x52, 0x8C, 0x82, 0x03,
+    0x88, 0x50, 0x8D, 0x86, 0x05, 0x88, 0x4B, 0x8E, 0x8D, 0x8A, 0x87, 0x83, 0x07, 0x88, 0x46, 0x81,
+    0x10, 0x88, 0x46, 0x81, 0x10, 0x88, 0x46, 0x81, 0x10, 0x88, 0x46, 0x81, 0x10, 0x88, 0x46, 0x81,
+    0x10, 0x88, 0x46, 0x81, 0x10, 0x88, 0x46, 0x81, 0x10, 0x07, 0x83, 0x87, 0x8A, 0x8D, 0x8E, 0x42,
+    0x8E, 0x8C, 0x8A, 0x87, 0x83, 0x0F, 0x87, 0x8D, 0x4C, 0x8E, 0x88, 0x81, 0x0A, 0x83, 0x8D, 0x51,
+    0x86, 0x08, 0x85, 0x54, 0x89, 0x06, 0x83, 0x56, 0x87, 0x05, 0x8D, 0x49, 0x9D, 0x4A, 0x8E, 0x04,
+    0x85, 0x47, 0x8B, 0x84, 0x03, 0x81, 0x86, 0x8D, 0x47, 0x85, 0x03, 0x8A, 0x46, 0x88, 0x08, 0x8C,
+    0x46, 0x87, 0x03, 0x8E, 0x45, 0x8D, 0x09, 0x83, 0x46, 0x87, 0x03, 0x46, 0x88, 0x09, 0x82, 0x46,
+    0x84, 0x02, 0x81, 0x46, 0x86, 0x09, 0x87, 0x46, 0x03, 0x81, 0x46, 0x85, 0x08, 0x83, 0x46, 0x87,
+    0x03, 0x81, 0x46, 0x85, 0x07, 0x84, 0x8E, 0x45, 0x8B, 0x04, 0x81, 0x46, 0x85, 0x06, 0x88, 0x46,
+    0x8B, 0x05, 0x81, 0x46, 0x85, 0x05, 0x8B, 0x46, 0x89, 0x06, 0x81, 0x46, 0x85, 0x04, 0x8B, 0x46,
+    0x85, 0x07, 0x81, 0x46, 0x85, 0x03, 0x85, 0x45, 0x8E, 0x82, 0x08, 0x81, 0x46, 0x85, 0x03, 0x8B,
+    0x45, 0x89, 0x09, 0x81, 0x46, 0x85, 0x03, 0x8D, 0x45, 0x8D, 0x09, 0x81, 0x46, 0x85, 0x03, 0x8D,
+    0x46, 0x8D, 0x83, 0x07, 0x81, 0x46, 0x85, 0x03, 0x89, 0x48, 0x88, 0x06, 0x81, 0x46, 0x85, 0x03,
+    0x82, 0x49, 0x8E, 0x84, 0x04, 0x81, 0x46, 0x85, 0x04, 0x84, 0x4A, 0x89, 0x03, 0x81, 0x46, 0x85,
+    0x05, 0x83, 0x8D, 0x49, 0x8D, 0x82, 0x01, 0x81, 0x46, 0x85, 0x07, 0x88, 0x49, 0x8D, 0x81, 0x00,
+    0x81, 0x46, 0x85, 0x08, 0x82, 0x8B, 0x48, 0x8B, 0x00, 0x81, 0x46, 0x85, 0x0A, 0x84, 0x8E, 0x47,
+    0x83, 0x81, 0x46, 0x85, 0x0B, 0x81, 0x8C, 0x46, 0x88, 0x81, 0x46, 0x85, 0x0C, 0x82, 0x46, 0x8B,
+    0x81, 0x46, 0x85, 0x0D, 0x8E, 0x45, 0x8C, 0x81, 0x46, 0x85, 0x02, 0x82, 0x09, 0x46, 0x8B, 0x81,
+    0x46, 0x85, 0x02, 0x8D, 0x8B, 0x84, 0x06, 0x87, 0x46, 0x89, 0x81, 0x46, 0x85, 0x02, 0x8D, 0x42,
+    0x8B, 0x87, 0x86, 0x85, 0x87, 0x8C, 0x47, 0x85, 0x81, 0x46, 0x85, 0x02, 0x8D, 0x4F, 0x8E, 0x00,
+    0x81, 0x46, 0x85, 0x02, 0x8D, 0x4F, 0x85, 0x00, 0x81, 0x46, 0x85, 0x02, 0x8D, 0x4E, 0x86, 0x01,
+    0x81, 0x46, 0x85, 0x02, 0x88, 0x4C, 0x8B, 0x82, 0x02, 0x81, 0x46, 0x85, 0x03, 0x81, 0x86, 0x8A,
+    0x8C, 0x8E, 0x42, 0x8E, 0x8C, 0x8A, 0x87, 0x81, 0x04, 0x02, 0x81, 0x47, 0x88, 0x0F, 0x83, 0x8E,
+    0x46, 0x83, 0x0F, 0x82, 0x8D, 0x45, 0x8E, 0x81, 0x10, 0x8B, 0x45, 0x8B, 0x11, 0x88, 0x45, 0x88,
+    0x11, 0x85, 0x45, 0x85, 0x11, 0x82, 0x8D, 0x44, 0x83, 0x12, 0x8A, 0x43, 0x8D, 0x3E, 0x81, 0x85,
+    0x88, 0x8B, 0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x87, 0x82, 0x09, 0x85, 0x8B, 0x4C, 0x8C, 0x83,
+    0x05, 0x82, 0x8E, 0x50, 0x88, 0x05, 0x8D, 0x51, 0x88, 0x04, 0x85, 0x52, 0x83, 0x04, 0x8D, 0x44,
+    0x8C, 0x89, 0x88, 0x89, 0x8C, 0x47, 0x8B, 0x04, 0x86, 0x40, 0x8E, 0x88, 0x83, 0x05, 0x83, 0x47,
+    0x05, 0x85, 0x09, 0x86, 0x46, 0x83, 0x0F, 0x81, 0x46, 0x85, 0x10, 0x46, 0x86, 0x10, 0x46, 0x87,
+    0x05, 0x81, 0x84, 0x87, 0x8A, 0x8B, 0x8C, 0x8D, 0x9E, 0x48, 0x87, 0x03, 0x85, 0x8B, 0x51, 0x87,
+    0x01, 0x82, 0x8C, 0x53, 0x87, 0x00, 0x83, 0x8E, 0x54, 0x87, 0x00, 0x8D, 0x48, 0x8B, 0x89, 0x87,
+    0x96, 0x85, 0x46, 0x87, 0x85, 0x47, 0x87, 0x06, 0x46, 0x87, 0x8A, 0x46, 0x85, 0x07, 0x46, 0x87,
+    0x8C, 0x45, 0x8E, 0x07, 0x81, 0x46, 0x87, 0x8E, 0x45, 0x8C, 0x07, 0x85, 0x46, 0x87, 0x8D, 0x45,
+    0x8E, 0x06, 0x81, 0x8D, 0x46, 0x87, 0x8B, 0x46, 0x86, 0x04, 0x82, 0x8D, 0x47, 0x87, 0x88, 0x47,
+    0x8C, 0x88, 0x87, 0x88, 0x8C, 0x49, 0x87, 0x82, 0x4F, 0x8E, 0x45, 0x87, 0x00, 0x8A, 0x4D, 0x8E,
+    0x82, 0x8E, 0x44, 0x87, 0x00, 0x81, 0x8D, 0x4B, 0x8E, 0x82, 0x00, 0x89, 0x44, 0x87, 0x01, 0x81,
+    0x8A, 0x49, 0x8A, 0x81, 0x01, 0x84, 0x44, 0x87, 0x03, 0x83, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8C,
+    0x88, 0x82, 0x04, 0x8E, 0x43, 0x87, 0x0D, 0x8D, 0x46, 0x8B, 0x0E, 0x88, 0x46, 0x8B, 0x0E, 0x84,
+    0x46, 0x89, 0x0E, 0x81, 0x8E, 0x45, 0x87, 0x0F, 0x8C, 0x45, 0x84, 0x0F, 0x8A, 0x44, 0x8D, 0x82,
+    0x0F, 0x88, 0x44, 0x8A, 0x10, 0x82, 0x44, 0x86, 0x3F, 0x01, 0x81, 0x85, 0x88, 0x8B, 0x8D, 0x8E,
+    0x41, 0x8E, 0x8D, 0x8A, 0x87, 0x82, 0x09, 0x85, 0x8B, 0x4C, 0x8C, 0x83, 0x05, 0x82, 0x8E, 0x50,
+    0x88, 0x05, 0x8D, 0x51, 0x88, 0x04, 0x85, 0x52, 0x83, 0x04, 0x8D, 0x44, 0x8C, 0x89, 0x88, 0x89,
+    0x8C, 0x47, 0x8B, 0x04, 0x86, 0x40, 0x8E, 0x88, 0x83, 0x05, 0x83, 0x47, 0x05, 0x85, 0x09, 0x86,
+    0x46, 0x83, 0x0F, 0x81, 0x46, 0x85, 0x10, 0x46, 0x86, 0x10, 0x46, 0x87, 0x05, 0x81, 0x84, 0x87,
+    0x8A, 0x8B, 0x8C, 0x8D, 0x9E, 0x48, 0x87, 0x03, 0x85, 0x8B, 0x51, 0x87, 0x01, 0x82, 0x8C, 0x53,
+    0x87, 0x00, 0x83, 0x8E, 0x54, 0x87, 0x00, 0x8D, 0x48, 0x8B, 0x89, 0x87, 0x96, 0x85, 0x46, 0x87,
+    0x85, 0x47, 0x87, 0x06, 0x46, 0x87, 0x8A, 0x46, 0x85, 0x07, 0x46, 0x87, 0x8C, 0x45, 0x8E, 0x07,
+    0x81, 0x46, 0x87, 0x8E, 0x45, 0x8C, 0x07, 0x85, 0x46, 0x87, 0x8D, 0x45, 0x8E, 0x06, 0x81, 0x8D,
+    0x46, 0x87, 0x8B, 0x46, 0x86, 0x04, 0x82, 0x8D, 0x47, 0x87, 0x88, 0x47, 0x8C, 0x88, 0x87, 0x88,
+    0x8C, 0x49, 0x87, 0x82, 0x4F, 0x8E, 0x45, 0x87, 0x00, 0x8A, 0x4D, 0x8E, 0x82, 0x8E, 0x44, 0x87,
+    0x00, 0x81, 0x8D, 0x4B, 0x8E, 0x82, 0x00, 0x89, 0x44, 0x87, 0x01, 0x81, 0x8A, 0x49, 0x8A, 0x81,
+    0x01, 0x84, 0x44, 0x87, 0x03, 0x83, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x88, 0x82, 0x04, 0x8E,
+    0x43, 0x87, 0x07, 0x8C, 0x47, 0x89, 0x0D, 0x87, 0x49, 0x85, 0x0B, 0x84, 0x4B, 0x82, 0x09, 0x82,
+    0x8E, 0x44, 0x8E, 0x45, 0x8D, 0x81, 0x07, 0x81, 0x8D, 0x44, 0x8E, 0x82, 0x85, 0x45, 0x8C, 0x06,
+    0x81, 0x8D, 0x44, 0x8C, 0x81, 0x01, 0x83, 0x8E, 0x44, 0x8B, 0x05, 0x8C, 0x44, 0x88, 0x04, 0x81,
+    0x8A, 0x44, 0x8A, 0x03, 0x89, 0x43, 0x8D, 0x83, 0x07, 0x85, 0x8E, 0x43, 0x87, 0x38, 0x81, 0x85,
+    0x88, 0x8B, 0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x87, 0x82, 0x09, 0x85, 0x8B, 0x4C, 0x8C, 0x83,
+    0x05, 0x82, 0x8E, 0x50, 0x88, 0x05, 0x8D, 0x51, 0x88, 0x04, 0x85, 0x52, 0x83, 0x04, 0x8D, 0x44,
+    0x8C, 0x89, 0x88, 0x89, 0x8C, 0x47, 0x8B, 0x04, 0x86, 0x40, 0x8E, 0x88, 0x83, 0x05, 0x83, 0x47,
+    0x05, 0x85, 0x09, 0x86, 0x46, 0x83, 0x0F, 0x81, 0x46, 0x85, 0x10, 0x46, 0x86, 0x10, 0x46, 0x87,
+    0x05, 0x81, 0x84, 0x87, 0x8A, 0x8B, 0x8C, 0x8D, 0x9E, 0x48, 0x87, 0x03, 0x85, 0x8B, 0x51, 0x87,
+    0x01, 0x82, 0x8C, 0x53, 0x87, 0x00, 0x83, 0x8E, 0x54, 0x87, 0x00, 0x8D, 0x48, 0x8B, 0x89, 0x87,
+    0x96, 0x85, 0x46, 0x87, 0x85, 0x47, 0x87, 0x06, 0x46, 0x87, 0x8A, 0x46, 0x85, 0x07, 0x46, 0x87,
+    0x8C, 0x45, 0x8E, 0x07, 0x81, 0x46, 0x87, 0x8E, 0x45, 0x8C, 0x07, 0x85, 0x46, 0x87, 0x8D, 0x45,
+    0x8E, 0x06, 0x81, 0x8D, 0x46, 0x87, 0x8B, 0x46, 0x86, 0x04, 0x82, 0x8D, 0x47, 0x87, 0x88, 0x47,
+    0x8C, 0x88, 0x87, 0x88, 0x8C, 0x49, 0x87, 0x82, 0x4F, 0x8E, 0x45, 0x87, 0x00, 0x8A, 0x4D, 0x8E,
+    0x82, 0x8E, 0x44, 0x87, 0x00, 0x81, 0x8D, 0x4B, 0x8E, 0x82, 0x00, 0x89, 0x44, 0x87, 0x01, 0x81,
+    0x8A, 0x49, 0x8A, 0x81, 0x01, 0x84, 0x44, 0x87, 0x03, 0x83, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8C,
+    0x88, 0x82, 0x04, 0x8E, 0x43, 0x87, 0x06, 0x88, 0x8D, 0x40, 0x8E, 0x8A, 0x83, 0x05, 0x83, 0x42,
+    0x87, 0x05, 0x82, 0x8E, 0x45, 0x8A, 0x81, 0x03, 0x89, 0x42, 0x85, 0x05, 0x8E, 0x48, 0x88, 0x81,
+    0x00, 0x86, 0x43, 0x81, 0x04, 0x88, 0x50, 0x8D, 0x05, 0x51, 0x86, 0x04, 0x84, 0x43, 0x84, 0x00,
+    0x82, 0x89, 0x48, 0x8B, 0x05, 0x88, 0x42, 0x87, 0x03, 0x82, 0x8B, 0x45, 0x8C, 0x81, 0x05, 0x8A,
+    0x42, 0x81, 0x05, 0x84, 0x8B, 0x41, 0x8C, 0x86, 0x3C, 0x81, 0x85, 0x88, 0x8B, 0x8D, 0x8E, 0x41,
+    0x8E, 0x8D, 0x8A, 0x87, 0x82, 0x09, 0x85, 0x8B, 0x4C, 0x8C, 0x83, 0x05, 0x82, 0x8E, 0x50, 0x88,
+    0x05, 0x8D, 0x51, 0x88, 0x04, 0x85, 0x52, 0x83, 0x04, 0x8D, 0x44, 0x8C, 0x89, 0x88, 0x89, 0x8C,
+    0x47, 0x8B, 0x04, 0x86, 0x40, 0x8E, 0x88, 0x83, 0x05, 0x83, 0x47, 0x05, 0x85, 0x09, 0x86, 0x46,
+    0x83, 0x0F, 0x81, 0x46, 0x85, 0x10, 0x46, 0x86, 0x10, 0x46, 0x87, 0x05, 0x81, 0x84, 0x87, 0x8A,
+    0x8B, 0x8C, 0x8D, 0x9E, 0x48, 0x87, 0x03, 0x85, 0x8B, 0x51, 0x87, 0x01, 0x82, 0x8C, 0x53, 0x87,
+    0x00, 0x83, 0x8E, 0x54, 0x87, 0x00, 0x8D, 0x48, 0x8B, 0x89, 0x87, 0x96, 0x85, 0x46, 0x87, 0x85,
+    0x47, 0x87, 0x06, 0x46, 0x87, 0x8A, 0x46, 0x85, 0x07, 0x46, 0x87, 0x8C, 0x45, 0x8E, 0x07, 0x81,
+    0x46, 0x87, 0x8E, 0x45, 0x8C, 0x07, 0x85, 0x46, 0x87, 0x8D, 0x45, 0x8E, 0x06, 0x81, 0x8D, 0x46,
+    0x87, 0x8B, 0x46, 0x86, 0x04, 0x82, 0x8D, 0x47, 0x87, 0x88, 0x47, 0x8C, 0x88, 0x87, 0x88, 0x8C,
+    0x49, 0x87, 0x82, 0x4F, 0x8E, 0x45, 0x87, 0x00, 0x8A, 0x4D, 0x8E, 0x82, 0x8E, 0x44, 0x87, 0x00,
+    0x81, 0x8D, 0x4B, 0x8E, 0x82, 0x00, 0x89, 0x44, 0x87, 0x01, 0x81, 0x8A, 0x49, 0x8A, 0x81, 0x01,
+    0x84, 0x44, 0x87, 0x03, 0x83, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x88, 0x82, 0x04, 0x8E, 0x43,
+    0x87, 0x05, 0x81, 0x86, 0x87, 0x85, 0x05, 0x82, 0x86, 0x87, 0x84, 0x09, 0x83, 0x43, 0x8D, 0x03,
+    0x85, 0x43, 0x8C, 0x08, 0x8C, 0x44, 0x88, 0x02, 0x45, 0x87, 0x07, 0x45, 0x8B, 0x01, 0x82, 0x45,
+    0x8A, 0x07, 0x8E, 0x44, 0x8A, 0x01, 0x81, 0x45, 0x89, 0x07, 0x89, 0x44, 0x84, 0x02, 0x8B, 0x44,
+    0x83, 0x08, 0x88, 0x8E, 0x40, 0x8C, 0x85, 0x03, 0x81, 0x89, 0x8E, 0x40, 0x8C, 0x84, 0x3F, 0x14,
+    0x81, 0x85, 0x88, 0x8B, 0x8D, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x87, 0x82, 0x09, 0x85, 0x8B, 0x4C,
+    0x8C, 0x83, 0x05, 0x82, 0x8E, 0x50, 0x88, 0x05, 0x8D, 0x51, 0x88, 0x04, 0x85, 0x52, 0x83, 0x04,
+    0x8D, 0x44, 0x8C, 0x89, 0x88, 0x89, 0x8C, 0x47, 0x8B, 0x04, 0x86, 0x40, 0x8E, 0x88, 0x83, 0x05,
+    0x83, 0x47, 0x05, 0x85, 0x09, 0x86, 0x46, 0x83, 0x0F, 0x81, 0x46, 0x85, 0x10, 0x46, 0x86, 0x10,
+    0x46, 0x87, 0x05, 0x81, 0x84, 0x87, 0x8A, 0x8B, 0x8C, 0x8D, 0x9E, 0x48, 0x87, 0x03, 0x85, 0x8B,
+    0x51, 0x87, 0x01, 0x82, 0x8C, 0x53, 0x87, 0x00, 0x83, 0x8E, 0x54, 0x87, 0x00, 0x8D, 0x48, 0x8B,
+    0x89, 0x87, 0x96, 0x85, 0x46, 0x87, 0x85, 0x47, 0x87, 0x06, 0x46, 0x87, 0x8A, 0x46, 0x85, 0x07,
+    0x46, 0x87, 0x8C, 0x45, 0x8E, 0x07, 0x81, 0x46, 0x87, 0x8E, 0x45, 0x8C, 0x07, 0x85, 0x46, 0x87,
+    0x8D, 0x45, 0x8E, 0x06, 0x81, 0x8D, 0x46, 0x87, 0x8B, 0x46, 0x86, 0x04, 0x82, 0x8D, 0x47, 0x87,
+    0x88, 0x47, 0x8C, 0x88, 0x87, 0x88, 0x8C, 0x49, 0x87, 0x82, 0x4F, 0x8E, 0x45, 0x87, 0x00, 0x8A,
+    0x4D, 0x8E, 0x82, 0x8E, 0x44, 0x87, 0x00, 0x81, 0x8D, 0x4B, 0x8E, 0x82, 0x00, 0x89, 0x44, 0x87,
+    0x01, 0x81, 0x8A, 0x49, 0x8A, 0x81, 0x01, 0x84, 0x44, 0x87, 0x03, 0x83, 0x89, 0x8C, 0x8E, 0x41,
+    0x8E, 0x8C, 0x88, 0x82, 0x04, 0x8E, 0x43, 0x87, 0x09, 0x86, 0x8C, 0x8E, 0x40, 0x8E, 0x8A, 0x83,
+    0x0F, 0x81, 0x8C, 0x46, 0x88, 0x0E, 0x8B, 0x48, 0x87, 0x0C, 0x83, 0x43, 0x8A, 0x87, 0x8C, 0x43,
+    0x81, 0x0B, 0x88, 0x42, 0x87, 0x02, 0x8B, 0x42, 0x86, 0x0B, 0x8A, 0x42, 0x81, 0x02, 0x85, 0x42,
+    0x88, 0x0B, 0x8A, 0x42, 0x81, 0x02, 0x86, 0x42, 0x88, 0x0B, 0x88, 0x42, 0x86, 0x02, 0x8B, 0x42,
+    0x85, 0x0B, 0x84, 0x43, 0x89, 0x87, 0x8C, 0x43, 0x81, 0x0C, 0x8B, 0x48, 0x88, 0x0D, 0x81, 0x8C,
+    0x46, 0x89, 0x10, 0x86, 0x8C, 0x8E, 0x40, 0x8E, 0x8A, 0x84, 0x3F, 0x81, 0x85, 0x88, 0x8B, 0x8D,
+    0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x87, 0x82, 0x09, 0x85, 0x8B, 0x4C, 0x8C, 0x83, 0x05, 0x82, 0x8E,
+    0x50, 0x88, 0x05, 0x8D, 0x51, 0x88, 0x04, 0x85, 0x52, 0x83, 0x04, 0x8D, 0x44, 0x8C, 0x89, 0x88,
+    0x89, 0x8C, 0x47, 0x8B, 0x04, 0x86, 0x40, 0x8E, 0x88, 0x83, 0x05, 0x83, 0x47, 0x05, 0x85, 0x09,
+    0x86, 0x46, 0x83, 0x0F, 0x81, 0x46, 0x85, 0x10, 0x46, 0x86, 0x10, 0x46, 0x87, 0x05, 0x81, 0x84,
+    0x87, 0x8A, 0x8B, 0x8C, 0x8D, 0x9E, 0x48, 0x87, 0x03, 0x85, 0x8B, 0x51, 0x87, 0x01, 0x82, 0x8C,
+    0x53, 0x87, 0x00, 0x83, 0x8E, 0x54, 0x87, 0x00, 0x8D, 0x48, 0x8B, 0x89, 0x87, 0x96, 0x85, 0x46,
+    0x87, 0x85, 0x47, 0x87, 0x06, 0x46, 0x87, 0x8A, 0x46, 0x85, 0x07, 0x46, 0x87, 0x8C, 0x45, 0x8E,
+    0x07, 0x81, 0x46, 0x87, 0x8E, 0x45, 0x8C, 0x07, 0x85, 0x46, 0x87, 0x8D, 0x45, 0x8E, 0x06, 0x81,
+    0x8D, 0x46, 0x87, 0x8B, 0x46, 0x86, 0x04, 0x82, 0x8D, 0x47, 0x87, 0x88, 0x47, 0x8C, 0x88, 0x87,
+    0x88, 0x8C, 0x49, 0x87, 0x82, 0x4F, 0x8E, 0x45, 0x87, 0x00, 0x8A, 0x4D, 0x8E, 0x82, 0x8E, 0x44,
+    0x87, 0x00, 0x81, 0x8D, 0x4B, 0x8E, 0x82, 0x00, 0x89, 0x44, 0x87, 0x01, 0x81, 0x8A, 0x49, 0x8A,
+    0x81, 0x01, 0x84, 0x44, 0x87, 0x03, 0x83, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x88, 0x82, 0x04,
+    0x8E, 0x43, 0x87, 0x05, 0x81, 0x85, 0x88, 0x8B, 0x8D, 0x8E, 0x41, 0x8E, 0x8C, 0x88, 0x84, 0x06,
+    0x85, 0x89, 0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x88, 0x84, 0x0A, 0x86, 0x8C, 0x4B, 0x8D, 0x85, 0x02,
+    0x87, 0x8E, 0x49, 0x8D, 0x84, 0x06, 0x82, 0x8E, 0x4F, 0x89, 0x82, 0x8C, 0x4D, 0x89, 0x06, 0x8D,
+    0x61, 0x8A, 0x05, 0x85, 0x62, 0x87, 0x05, 0x8D, 0x43, 0x8E, 0x8B, 0x89, 0x88, 0x8A, 0x8D, 0x4B,
+    0x8B, 0x86, 0x95, 0x89, 0x47, 0x81, 0x04, 0x86, 0x40, 0x8C, 0x87, 0x82, 0x05, 0x86, 0x48, 0x8E,
+    0x83, 0x04, 0x82, 0x8D, 0x45, 0x89, 0x05, 0x83, 0x09, 0x8B, 0x47, 0x84, 0x06, 0x83, 0x46, 0x10,
+    0x87, 0x46, 0x8B, 0x08, 0x8B, 0x45, 0x83, 0x0F, 0x87, 0x46, 0x87, 0x08, 0x87, 0x45, 0x87, 0x0F,
+    0x87, 0x46, 0x84, 0x08, 0x85, 0x45, 0x89, 0x05, 0x81, 0x85, 0x88, 0x8A, 0x8B, 0x8D, 0xAE, 0x59,
+    0x8A, 0x03, 0x86, 0x8C, 0x62, 0x8B, 0x01, 0x83, 0x8D, 0x64, 0x8B, 0x00, 0x83, 0x66, 0x8B, 0x00,
+    0x8D, 0x48, 0x8B, 0x88, 0x87, 0x96, 0x8A, 0x57, 0x8A, 0x85, 0x47, 0x86, 0x05, 0x87, 0x46, 0x81,
+    0x10, 0x8A, 0x46, 0x85, 0x06, 0x87, 0x46, 0x84, 0x10, 0x8C, 0x45, 0x8E, 0x07, 0x88, 0x46, 0x88,
+    0x10, 0x8E, 0x45, 0x8C, 0x07, 0x8D, 0x46, 0x8E, 0x81, 0x0F, 0x8D, 0x45, 0x8E, 0x06, 0x85, 0x48,
+    0x8B, 0x0C, 0x85, 0x81, 0x00, 0x8B, 0x46, 0x86, 0x04, 0x86, 0x4A, 0x8C, 0x83, 0x06, 0x81, 0x85,
+    0x89, 0x8E, 0x40, 0x82, 0x00, 0x87, 0x47, 0x8B, 0x88, 0x87, 0x89, 0x8D, 0x4D, 0x8D, 0x8A, 0x99,
+    0x8A, 0x8B, 0x8E, 0x44, 0x82, 0x00, 0x82, 0x51, 0x86, 0x8C, 0x52, 0x82, 0x01, 0x88, 0x4F, 0x87,
+    0x00, 0x81, 0x8D, 0x51, 0x82, 0x02, 0x8B, 0x4D, 0x85, 0x02, 0x81, 0x8B, 0x50, 0x82, 0x03, 0x88,
+    0x4A, 0x8A, 0x82, 0x05, 0x85, 0x8D, 0x4C, 0x8C, 0x85, 0x05, 0x81, 0x88, 0x8C, 0x8E, 0x41, 0x8E,
+    0x8D, 0x8A, 0x87, 0x82, 0x09, 0x83, 0x88, 0x8B, 0x8E, 0x43, 0x8D, 0x8C, 0x89, 0x85, 0x81, 0x03,
+    0x07, 0x83, 0x87, 0x8B, 0x8D, 0x8E, 0x41, 0x8E, 0x8C, 0x8A, 0x86, 0x82, 0x08, 0x86, 0x8D, 0x4B,
+    0x8D, 0x86, 0x04, 0x81, 0x8C, 0x4E, 0x8E, 0x03, 0x82, 0x8E, 0x4F, 0x88, 0x03, 0x8D, 0x50, 0x82,
+    0x02, 0x8A, 0x50, 0x8B, 0x02, 0x82, 0x47, 0x8D, 0x86, 0x81, 0x00, 0x81, 0x83, 0x86, 0x8B, 0x41,
+    0x85, 0x02, 0x8A, 0x46, 0x8C, 0x07, 0x81, 0x86, 0x03, 0x47, 0x81, 0x0C, 0x83, 0x46, 0x88, 0x0D,
+    0x87, 0x46, 0x83, 0x0D, 0x89, 0x46, 0x0E, 0x8A, 0x45, 0x8E, 0x0E, 0x8B, 0x45, 0x8D, 0x0E, 0x8B,
+    0x45, 0x8D, 0x0E, 0x8A, 0x45, 0x8E, 0x0E, 0x89, 0x46, 0x0E, 0x88, 0x46, 0x83, 0x0D, 0x85, 0x46,
+    0x88, 0x0D, 0x81, 0x46, 0x8E, 0x81, 0x0A, 0x81, 0x01, 0x8D, 0x46, 0x8B, 0x08, 0x85, 0x8E, 0x84,
+    0x01, 0x86, 0x47, 0x8D, 0x86, 0x82, 0x00, 0x81, 0x82, 0x85, 0x89, 0x8E, 0x41, 0x84, 0x02, 0x8E,
+    0x51, 0x84, 0x02, 0x84, 0x51, 0x84, 0x03, 0x88, 0x50, 0x84, 0x04, 0x87, 0x4F, 0x84, 0x05, 0x83,
+    0x8A, 0x4B, 0x8E, 0x86, 0x08, 0x82, 0x86, 0x8A, 0x8D, 0x8E, 0x42, 0x8E, 0x8B, 0x89, 0x84, 0x0C,
+    0x89, 0x43, 0x83, 0x0F, 0x82, 0x43, 0x8D, 0x10, 0x89, 0x44, 0x8A, 0x82, 0x0D, 0x81, 0x8E, 0x46,
+    0x85, 0x0E, 0x82, 0x89, 0x45, 0x82, 0x0F, 0x88, 0x44, 0x88, 0x0F, 0x84, 0x44, 0x8A, 0x0A, 0x84,
+    0x86, 0x84, 0x92, 0x8B, 0x44, 0x88, 0x0A, 0x87, 0x49, 0x85, 0x0A, 0x87, 0x48, 0x8D, 0x0B, 0x87,
+    0x47, 0x8D, 0x82, 0x0B, 0x83, 0x8B, 0x8E, 0x41, 0x8E, 0x8D, 0x8A, 0x85, 0x07, 0x03, 0x8E, 0x46,
+    0x8A, 0x10, 0x81, 0x8D, 0x46, 0x85, 0x10, 0x81, 0x8C, 0x46, 0x82, 0x11, 0x89, 0x45, 0x8D, 0x12,
+    0x86, 0x45, 0x8A, 0x12, 0x83, 0x8E, 0x44, 0x87, 0x12, 0x81, 0x8C, 0x44, 0x85, 0x13, 0x88, 0x44,
+    0x3F, 0x03, 0x84, 0x88, 0x8C, 0x8D, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x81, 0x0C, 0x86, 0x8E, 0x4A,
+    0x89, 0x81, 0x08, 0x81, 0x8C, 0x4D, 0x8E, 0x84, 0x06, 0x82, 0x8E, 0x50, 0x85, 0x05, 0x8D, 0x52,
+    0x82, 0x03, 0x8A, 0x46, 0x8E, 0x88, 0x95, 0x87, 0x8C, 0x46, 0x8C, 0x02, 0x82, 0x46, 0x8C, 0x81,
+    0x04, 0x86, 0x46, 0x84, 0x01, 0x89, 0x45, 0x8E, 0x81, 0x06, 0x88, 0x45, 0x8A, 0x01, 0x46, 0x87,
+    0x07, 0x81, 0x45, 0x8E, 0x00, 0x83, 0x46, 0x83, 0x08, 0x8C, 0x45, 0x82, 0x86, 0x46, 0x09, 0x8A,
+    0x45, 0x84, 0x89, 0x57, 0x85, 0x8A, 0x57, 0x86, 0x8B, 0x57, 0x86, 0x8B, 0x57, 0x86, 0x8A, 0x57,
+    0x85, 0x89, 0x45, 0x8D, 0x11, 0x87, 0x46, 0x11, 0x83, 0x46, 0x84, 0x11, 0x46, 0x8C, 0x11, 0x89,
+    0x46, 0x87, 0x0B, 0x81, 0x86, 0x02, 0x82, 0x47, 0x8A, 0x82, 0x06, 0x81, 0x86, 0x8B, 0x40, 0x8D,
+    0x03, 0x89, 0x48, 0x8C, 0xA9, 0x8A, 0x8B, 0x8E, 0x43, 0x8D, 0x04, 0x8C, 0x52, 0x8D, 0x04, 0x81,
+    0x8C, 0x51, 0x8D, 0x06, 0x89, 0x50, 0x8D, 0x07, 0x83, 0x8B, 0x4D, 0x8A, 0x83, 0x09, 0x81, 0x86,
+    0x89, 0x8C, 0x8E, 0x42, 0x8E, 0x8D, 0x8B, 0x88, 0x84, 0x04, 0x0D, 0x8A, 0x46, 0x8E, 0x0F, 0x85,
+    0x46, 0x8D, 0x81, 0x0E, 0x82, 0x46, 0x8B, 0x81, 0x0F, 0x8D, 0x45, 0x89, 0x10, 0x8B, 0x45, 0x86,
+    0x10, 0x88, 0x44, 0x8E, 0x83, 0x10, 0x85, 0x44, 0x8C, 0x81, 0x11, 0x44, 0x88, 0x3F, 0x06, 0x84,
+    0x88, 0x8C, 0x8D, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x81, 0x0C, 0x86, 0x8E, 0x4A, 0x89, 0x81, 0x08,
+    0x81, 0x8C, 0x4D, 0x8E, 0x84, 0x06, 0x82, 0x8E, 0x50, 0x85, 0x05, 0x8D, 0x52, 0x82, 0x03, 0x8A,
+    0x46, 0x8E, 0x88, 0x95, 0x87, 0x8C, 0x46, 0x8C, 0x02, 0x82, 0x46, 0x8C, 0x81, 0x04, 0x86, 0x46,
+    0x84, 0x01, 0x89, 0x45, 0x8E, 0x81, 0x06, 0x88, 0x45, 0x8A, 0x01, 0x46, 0x87, 0x07, 0x81, 0x45,
+    0x8E, 0x00, 0x83, 0x46, 0x83, 0x08, 0x8C, 0x45, 0x82, 0x86, 0x46, 0x09, 0x8A, 0x45, 0x84, 0x89,
+    0x57, 0x85, 0x8A, 0x57, 0x86, 0x8B, 0x57, 0x86, 0x8B, 0x57, 0x86, 0x8A, 0x57, 0x85, 0x89, 0x45,
+    0x8D, 0x11, 0x87, 0x46, 0x11, 0x83, 0x46, 0x84, 0x11, 0x46, 0x8C, 0x11, 0x89, 0x46, 0x87, 0x0B,
+    0x81, 0x86, 0x02, 0x82, 0x47, 0x8A, 0x82, 0x06, 0x81, 0x86, 0x8B, 0x40, 0x8D, 0x03, 0x89, 0x48,
+    0x8C, 0xA9, 0x8A, 0x8B, 0x8E, 0x43, 0x8D, 0x04, 0x8C, 0x52, 0x8D, 0x04, 0x81, 0x8C, 0x51, 0x8D,
+    0x06, 0x89, 0x50, 0x8D, 0x07, 0x83, 0x8B, 0x4D, 0x8A, 0x83, 0x09, 0x81, 0x86, 0x89, 0x8C, 0x8E,
+    0x42, 0x8E, 0x8D, 0x8B, 0x88, 0x84, 0x04, 0x07, 0x85, 0x47, 0x8E, 0x81, 0x0D, 0x81, 0x8E, 0x48,
+    0x8B, 0x0D, 0x8C, 0x4A, 0x88, 0x0B, 0x8A, 0x45, 0x8E, 0x45, 0x86, 0x09, 0x88, 0x45, 0x87, 0x81,
+    0x8C, 0x45, 0x84, 0x07, 0x87, 0x45, 0x85, 0x02, 0x8A, 0x45, 0x83, 0x05, 0x86, 0x44, 0x8C, 0x82,
+    0x04, 0x86, 0x44, 0x8E, 0x83, 0x03, 0x83, 0x44, 0x87, 0x07, 0x81, 0x8B, 0x43, 0x8E, 0x3D, 0x84,
+    0x88, 0x8C, 0x8D, 0x41, 0x8E, 0x8D, 0x8A, 0x86, 0x81, 0x0C, 0x86, 0x8E, 0x4A, 0x89, 0x81, 0x08,
+    0x81, 0x8C, 0x4D, 0x8E, 0x84, 0x06, 0x82, 0x8E, 0x50, 0x85, 0x05, 0x8D, 0x52, 0x82, 0x03, 0x8A,
+    0x46, 0x8E, 0x88, 0x95, 0x87, 0x8C, 0x46, 0x8C, 0x02, 0x82, 0x46, 0x8C, 0x81, 0x04, 0x86, 0x46,
+    0x84, 0x01, 0x89, 0x45, 0x8E, 0x81, 0x06, 0x88, 0x45, 0x8A, 0x01, 0x46, 0x87, 0x07, 0x81, 0x45,
+    0x8E, 0x00, 0x83, 0x46, 0x83, 0x08, 0x8C, 0x45, 0x82, 0x86, 0x46, 0x09, 0x8A, 0x45, 0x84, 0x89,
+    0x57, 0x85, 0x8A, 0x57, 0x86, 0x8B, 0x57, 0x86, 0x8B, 0x57, 0x86, 0x8A, 0x57, 0x85, 0x89, 0x45,
+    0x8D, 0x11, 0x87, 0x46, 0x11, 0x83, 0x46, 0x84, 0x11, 0x46, 0x8C, 0x11, 0x89, 0x46, 0x87, 0x0B,
+    0x81, 0x86, 0x02, 0x82, 0x47, 0x8A, 0x82, 0x06, 0x81, 0x86, 0x8B, 0x40, 0x8D, 0x03, 0x89, 0x48,
+    0x8C, 0xA9, 0x8A, 0x8B, 0x8E, 0x43, 0x8D, 0x04, 0x8C, 0x52, 0x8D, 0x04, 0x81, 0x8C, 0x51, 0x8D,
+    0x06, 0x89, 0x50, 0x8D, 0x07, 0x83, 0x8B, 0x4D, 0x8A, 0x83, 0x09, 0x81, 0x86, 0x89, 0x8C, 0x8E,
+    0x42, 0x8E, 0x8D, 0x8B, 0x88, 0x84, 0x04, 0x06, 0x85, 0x87, 0x86, 0x81, 0x05, 0x85, 0x87, 0x86,
+    0x81, 0x09, 0x81, 0x8D, 0x43, 0x83, 0x02, 0x82, 0x8E, 0x42, 0x8E, 0x82, 0x08, 0x88, 0x44, 0x8D,
+    0x02, 0x8A, 0x44, 0x8B, 0x08, 0x8B, 0x45, 0x02, 0x8D, 0x45, 0x08, 0x8A, 0x45, 0x02, 0x8C, 0x44,
+    0x8D, 0x08, 0x84, 0x44, 0x88, 0x02, 0x86, 0x44, 0x87, 0x09, 0x85, 0x8D, 0x40, 0x8D, 0x88, 0x04,
+    0x87, 0x8D, 0x40, 0x8D, 0x87, 0x3F, 0x1A, 0x84, 0x88, 0x8C, 0x8D, 0x41, 0x8E, 0x8D, 0x8A, 0x86,
+    0x81, 0x0C, 0x86, 0x8E, 0x4A, 0x89, 0x81, 0x08, 0x81, 0x8C, 0x4D, 0x8E, 0x84, 0x06, 0x82, 0x8E,
+    0x50, 0x85, 0x05, 0x8D, 0x52, 0x82, 0x03, 0x8A, 0x46, 0x8E, 0x88, 0x95, 0x87, 0x8C, 0x46, 0x8C,
+    0x02, 0x82, 0x46, 0x8C, 0x81, 0x04, 0x86, 0x46, 0x84, 0x01, 0x89, 0x45, 0x8E, 0x81, 0x06, 0x88,
+    0x45, 0x8A, 0x01, 0x46, 0x87, 0x07, 0x81, 0x45, 0x8E, 0x00, 0x83, 0x46, 0x83, 0x08, 0x8C, 0x45,
+    0x82, 0x86, 0x46, 0x09, 0x8A, 0x45, 0x84, 0x89, 0x57, 0x85, 0x8A, 0x57, 0x86, 0x8B, 0x57, 0x86,
+    0x8B, 0x57, 0x86, 0x8A, 0x57, 0x85, 0x89, 0x45, 0x8D, 0x11, 0x87, 0x46, 0x11, 0x83, 0x46, 0x84,
+    0x11, 0x46, 0x8C, 0x11, 0x89, 0x46, 0x87, 0x0B, 0x81, 0x86, 0x02, 0x82, 0x47, 0x8A, 0x82, 0x06,
+    0x81, 0x86, 0x8B, 0x40, 0x8D, 0x03, 0x89, 0x48, 0x8C, 0xA9, 0x8A, 0x8B, 0x8E, 0x43, 0x8D, 0x04,
+    0x8C, 0x52, 0x8D, 0x04, 0x81, 0x8C, 0x51, 0x8D, 0x06, 0x89, 0x50, 0x8D, 0x07, 0x83, 0x8B, 0x4D,
+    0x8A, 0x83, 0x09, 0x81, 0x86, 0x89, 0x8C, 0x8E, 0x42, 0x8E, 0x8D, 0x8B, 0x88, 0x84, 0x04, 0x85,
+    0x47, 0x83, 0x05, 0x86, 0x46, 0x8D, 0x06, 0x85, 0x46, 0x8A, 0x06, 0x83, 0x8E, 0x45, 0x86, 0x06,
+    0x81, 0x8C, 0x45, 0x83, 0x07, 0x89, 0x44, 0x8E, 0x82, 0x07, 0x85, 0x44, 0x8D, 0x08, 0x82, 0x8D,
+    0x43, 0x88, 0x32, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81,
+    0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81,
+    0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81,
+    0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81,
+    0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81,
+    0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81,
+    0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x04, 0x81,
+    0x47, 0x88, 0x04, 0x8B, 0x46, 0x89, 0x04, 0x87, 0x46, 0x87, 0x04, 0x84, 0x46, 0x84, 0x04, 0x82,
+    0x8E, 0x44, 0x8D, 0x82, 0x05, 0x8D, 0x44, 0x8B, 0x81, 0x05, 0x8B, 0x44, 0x88, 0x06, 0x86, 0x43,
+    0x8E, 0x84, 0x34, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81,
+    0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81,
+    0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81,
+    0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81,
+    0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81,
+    0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81,
+    0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x81, 0x46, 0x85, 0x05, 0x04,
+    0x81, 0x48, 0x84, 0x0A, 0x8B, 0x48, 0x8E, 0x81, 0x08, 0x88, 0x4A, 0x8C, 0x07, 0x85, 0x45, 0x8E,
+    0x45, 0x8A, 0x05, 0x84, 0x45, 0x8B, 0x00, 0x89, 0x45, 0x88, 0x03, 0x83, 0x45, 0x88, 0x02, 0x87,
+    0x45, 0x87, 0x01, 0x83, 0x44, 0x8E, 0x84, 0x04, 0x83, 0x8D, 0x44, 0x86, 0x00, 0x8E, 0x43, 0x8A,
+    0x81, 0x07, 0x88, 0x44, 0x82, 0x3F, 0x07, 0x81, 0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81,
+    0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81,
+    0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81,
+    0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81,
+    0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81,
+    0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81,
+    0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81, 0x46, 0x85, 0x0C, 0x81,
+    0x46, 0x85, 0x06, 0x01, 0x85, 0x87, 0x86, 0x81, 0x05, 0x85, 0x87, 0x86, 0x81, 0x02, 0x8C, 0x43,
+    0x84, 0x02, 0x81, 0x8E, 0x42, 0x8E, 0x83, 0x00, 0x87, 0x44, 0x8D, 0x02, 0x8A, 0x44, 0x8C, 0x00,
+    0x8A, 0x45, 0x81, 0x01, 0x8C, 0x45, 0x00, 0x89, 0x45, 0x02, 0x8B, 0x44, 0x8E, 0x00, 0x83, 0x44,
+    0x89, 0x02, 0x86, 0x44, 0x88, 0x01, 0x85, 0x8C, 0x40, 0x8E, 0x88, 0x04, 0x86, 0x8D, 0x40, 0x8D,
+    0x87, 0x3F, 0x0D, 0x81, 0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81,
+    0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81,
+    0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81,
+    0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81,
+    0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81,
+    0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81,
+    0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x08, 0x81, 0x46, 0x85, 0x04, 0x07,
+    0x81, 0x8C, 0x85, 0x07, 0x81, 0x8A, 0x85, 0x0C, 0x8A, 0x41, 0x8D, 0x85, 0x04, 0x86, 0x41, 0x8E,
+    0x0B, 0x83, 0x44, 0x8C, 0x83, 0x00, 0x83, 0x8C, 0x43, 0x89, 0x0A, 0x8C, 0x46, 0x8B, 0x46, 0x83,
+    0x08, 0x81, 0x8B, 0x4C, 0x8E, 0x85, 0x0B, 0x84, 0x8E, 0x49, 0x89, 0x81, 0x0D, 0x81, 0x8D, 0x47,
+    0x89, 0x0E, 0x84, 0x8D, 0x49, 0x87, 0x0B, 0x81, 0x8A, 0x4C, 0x86, 0x0A, 0x89, 0x45, 0x8D, 0x8C,
+    0x46, 0x83, 0x09, 0x81, 0x8E, 0x43, 0x88, 0x01, 0x8C, 0x45, 0x8D, 0x0A, 0x85, 0x41, 0x8C, 0x82,
+    0x02, 0x81, 0x8E, 0x45, 0x88, 0x0A, 0x89, 0x86, 0x05, 0x83, 0x46, 0x82, 0x12, 0x88, 0x45, 0x89,
+    0x08, 0x84, 0x88, 0x8C, 0x8E, 0x41, 0x8E, 0x8C, 0x88, 0x83, 0x00, 0x8E, 0x45, 0x81, 0x05, 0x85,
+    0x8D, 0x49, 0x8B, 0x88, 0x45, 0x86, 0x04, 0x8A, 0x4C, 0x8D, 0x45, 0x8B, 0x03, 0x8C, 0x55, 0x02,
+    0x89, 0x56, 0x83, 0x00, 0x83, 0x48, 0x8C, 0x89, 0x88, 0x89, 0x8C, 0x49, 0x85, 0x00, 0x8B, 0x46,
+    0x8C, 0x82, 0x04, 0x83, 0x8D, 0x47, 0x88, 0x81, 0x46, 0x8D, 0x07, 0x81, 0x8E, 0x46, 0x89, 0x85,
+    0x46, 0x86, 0x08, 0x86, 0x46, 0x8A, 0x88, 0x46, 0x81, 0x08, 0x81, 0x46, 0x8B, 0x8A, 0x45, 0x8E,
+    0x0A, 0x46, 0x8A, 0x8B, 0x45, 0x8D, 0x0A, 0x8E, 0x45, 0x89, 0x8B, 0x45, 0x8D, 0x0A, 0x46, 0x88,
+    0x89, 0x46, 0x09, 0x81, 0x46, 0x86, 0x88, 0x46, 0x82, 0x08, 0x85, 0x46, 0x82, 0x84, 0x46, 0x87,
+    0x08, 0x8A, 0x45, 0x8E, 0x01, 0x46, 0x8E, 0x81, 0x06, 0x83, 0x46, 0x88, 0x01, 0x88, 0x46, 0x8D,
+    0x83, 0x04, 0x83, 0x8E, 0x46, 0x81, 0x01, 0x81, 0x8E, 0x47, 0x8C, 0x89, 0x88, 0x89, 0x8C, 0x47,
+    0x88, 0x03, 0x84, 0x53, 0x8C, 0x05, 0x86, 0x51, 0x8C, 0x81, 0x06, 0x84, 0x8E, 0x4E, 0x8A, 0x09,
+    0x81, 0x88, 0x8E, 0x4A, 0x8C, 0x84, 0x0D, 0x84, 0x88, 0x8C, 0x8D, 0x41, 0x8E, 0x8D, 0x8B, 0x87,
+    0x83, 0x07, 0x06, 0x88, 0x8D, 0x40, 0x8E, 0x8A, 0x83, 0x05, 0x83, 0x42, 0x87, 0x07, 0x82, 0x8E,
+    0x45, 0x8A, 0x81, 0x03, 0x89, 0x42, 0x85, 0x07, 0x8E, 0x48, 0x88, 0x81, 0x00, 0x86, 0x43, 0x81,
+    0x06, 0x88, 0x50, 0x8D, 0x07, 0x51, 0x86, 0x06, 0x84, 0x43, 0x84, 0x00, 0x82, 0x89, 0x48, 0x8B,
+    0x07, 0x88, 0x42, 0x87, 0x03, 0x82, 0x8B, 0x45, 0x8C, 0x81, 0x07, 0x8A, 0x42, 0x81, 0x05, 0x84,
+    0x8B, 0x41, 0x8C, 0x86, 0x3F, 0x08, 0x86, 0x8A, 0x8D, 0x41, 0x8E, 0x8D, 0x89, 0x85, 0x05, 0x81,
+    0x44, 0x8C, 0x02, 0x86, 0x8E, 0x48, 0x8E, 0x85, 0x03, 0x81, 0x45, 0x81, 0x00, 0x8A, 0x4C, 0x87,
+    0x02, 0x81, 0x45, 0x86, 0x88, 0x4E, 0x85, 0x01, 0x81, 0x56, 0x8E, 0x01, 0x81, 0x57, 0x85, 0x00,
+    0x81, 0x49, 0x88, 0x83, 0x01, 0x81, 0x87, 0x47, 0x8A, 0x00, 0x81, 0x48, 0x84, 0x05, 0x86, 0x46,
+    0x8E, 0x00, 0x81, 0x47, 0x88, 0x07, 0x8D, 0x46, 0x00, 0x81, 0x47, 0x81, 0x07, 0x89, 0x46, 0x91,
+    0x46, 0x8C, 0x08, 0x86, 0x46, 0x91, 0x46, 0x89, 0x08, 0x85, 0x46, 0x91, 0x46, 0x87, 0x08, 0x85,
+    0x46, 0x91, 0x46, 0x86, 0x08, 0x85, 0x46, 0x91, 0x46, 0x86, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85,
+    0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91,
+    0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85,
+    0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85,
+    0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x91,
+    0x46, 0x85, 0x08, 0x85, 0x46, 0x91, 0x46, 0x85, 0x08, 0x85, 0x46, 0x81, 0x02, 0x81, 0x47, 0x87,
+    0x11, 0x83, 0x8E, 0x46, 0x83, 0x11, 0x82, 0x8D, 0x45, 0x8D, 0x12, 0x81, 0x8B, 0x45, 0x8A, 0x13,
+    0x89, 0x45, 0x87, 0x13, 0x86, 0x45, 0x85, 0x13, 0x83, 0x8D, 0x44, 0x83, 0x13, 0x81, 0x8A, 0x43,
+    0x8D, 0x3F, 0x06, 0x83, 0x87, 0x8B, 0x8D, 0x8E, 0x41, 0x8D, 0x8B, 0x87, 0x82, 0x0D, 0x85, 0x8D,
+    0x4A, 0x8C, 0x84, 0x09, 0x81, 0x8C, 0x4E, 0x8A, 0x07, 0x82, 0x8E, 0x50, 0x8C, 0x81, 0x05, 0x8D,
+    0x52, 0x8B, 0x04, 0x8A, 0x54, 0x87, 0x02, 0x82, 0x47, 0x8B, 0x84, 0x81, 0x00, 0x81, 0x85, 0x8C,
+    0x47, 0x81, 0x01, 0x89, 0x46, 0x89, 0x06, 0x8A, 0x46, 0x88, 0x01, 0x46, 0x8D, 0x08, 0x8E, 0x45,
+    0x8E, 0x00, 0x83, 0x46, 0x87, 0x08, 0x88, 0x46, 0x82, 0x87, 0x46, 0x82, 0x08, 0x84, 0x46, 0x86,
+    0x89, 0x46, 0x09, 0x81, 0x46, 0x88, 0x8A, 0x45, 0x8E, 0x0A, 0x46, 0x8A, 0x8B, 0x45, 0x8D, 0x0A,
+    0x8E, 0x45, 0x9B, 0x45, 0x8D, 0x0A, 0x8E, 0x45, 0x9A, 0x45, 0x8E, 0x0A, 0x46, 0x99, 0x46, 0x09,
+    0x81, 0x46, 0x88, 0x86, 0x46, 0x83, 0x08, 0x84, 0x46, 0x86, 0x83, 0x46, 0x87, 0x08, 0x88, 0x46,
+    0x82, 0x00, 0x8E, 0x45, 0x8E, 0x08, 0x8E, 0x45, 0x8E, 0x01, 0x88, 0x46, 0x89, 0x06, 0x8A, 0x46,
+    0x88, 0x01, 0x81, 0x47, 0x8C, 0x84, 0x81, 0x00, 0x81, 0x84, 0x8C, 0x47, 0x81, 0x02, 0x87, 0x54,
+    0x88, 0x04, 0x8C, 0x52, 0x8C, 0x05, 0x81, 0x8C, 0x50, 0x8D, 0x81, 0x07, 0x8A, 0x4E, 0x8B, 0x0A,
+    0x84, 0x8C, 0x4A, 0x8C, 0x84, 0x0D, 0x83, 0x88, 0x8B, 0x8E, 0x41, 0x8E, 0x8D, 0x8B, 0x87, 0x83,
+    0x07, 0x0D, 0x83, 0x47, 0x85, 0x10, 0x8D, 0x46, 0x87, 0x10, 0x8A, 0x46, 0x85, 0x10, 0x86, 0x45,
+    0x8E, 0x83, 0x10, 0x83, 0x45, 0x8C, 0x81, 0x10, 0x81, 0x8E, 0x44, 0x89, 0x12, 0x8D, 0x44, 0x86,
+    0x12, 0x88, 0x43, 0x8D, 0x83, 0x3F, 0x08, 0x83, 0x87, 0x8B, 0x8D, 0x8E, 0x41, 0x8D, 0x8B, 0x87,
+    0x82, 0x0D, 0x85, 0x8D, 0x4A, 0x8C, 0x84, 0x09, 0x81, 0x8C, 0x4E, 0x8A, 0x07, 0x82, 0x8E, 0x50,
+    0x8C, 0x81, 0x05, 0x8D, 0x52, 0x8B, 0x04, 0x8A, 0x54, 0x87, 0x02, 0x82, 0x47, 0x8B, 0x84, 0x81,
+    0x00, 0x81, 0x85, 0x8C, 0x47, 0x81, 0x01, 0x89, 0x46, 0x89, 0x06, 0x8A, 0x46, 0x88, 0x01, 0x46,
+    0x8D, 0x08, 0x8E, 0x45, 0x8E, 0x00, 0x83, 0x46, 0x87, 0x08, 0x88, 0x46, 0x82, 0x87, 0x46, 0x82,
+    0x08, 0x84, 0x46, 0x86, 0x89, 0x46, 0x09, 0x81, 0x46, 0x88, 0x8A, 0x45, 0x8E, 0x0A, 0x46, 0x8A,
+    0x8B, 0x45, 0x8D, 0x0A, 0x8E, 0x45, 0x9B, 0x45, 0x8D, 0x0A, 0x8E, 0x45, 0x9A, 0x45, 0x8E, 0x0A,
+    0x46, 0x99, 0x46, 0x09, 0x81, 0x46, 0x88, 0x86, 0x46, 0x83, 0x08, 0x84, 0x46, 0x86, 0x83, 0x46,
+    0x87, 0x08, 0x88, 0x46, 0x82, 0x00, 0x8E, 0x45, 0x8E, 0x08, 0x8E, 0x45, 0x8E, 0x01, 0x88, 0x46,
+    0x89, 0x06, 0x8A, 0x46, 0x88, 0x01, 0x81, 0x47, 0x8C, 0x84, 0x81, 0x00, 0x81, 0x84, 0x8C, 0x47,
+    0x81, 0x02, 0x87, 0x54, 0x88, 0x04, 0x8C, 0x52, 0x8C, 0x05, 0x81, 0x8C, 0x50, 0x8D, 0x81, 0x07,
+    0x8A, 0x4E, 0x8B, 0x0A, 0x84, 0x8C, 0x4A, 0x8C, 0x84, 0x0D, 0x83, 0x88, 0x8B, 0x8E, 0x41, 0x8E,
+    0x8D, 0x8B, 0x87, 0x83, 0x07, 0x07, 0x84, 0x48, 0x82, 0x0E, 0x81, 0x8D, 0x48, 0x8C, 0x0E, 0x8B,
+    0x4A, 0x8A, 0x0C, 0x88, 0x45, 0x8E, 0x45, 0x87, 0x0A, 0x87, 0x45, 0x88, 0x00, 0x8B, 0x45, 0x85,
+    0x08, 0x86, 0x45, 0x86, 0x02, 0x89, 0x45, 0x84, 0x06, 0x85, 0x44, 0x8D, 0x83, 0x04, 0x85, 0x8E,
+    0x44, 0x84, 0x04, 0x81, 0x44, 0x88, 0x07, 0x81, 0x8A, 0x44, 0x3F, 0x00, 0x83, 0x87, 0x8B, 0x8D,
+    0x8E, 0x41, 0x8D, 0x8B, 0x87, 0x82, 0x0D, 0x85, 0x8D, 0x4A, 0x8C, 0x84, 0x09, 0x81, 0x8C, 0x4E,
+    0x8A, 0x07, 0x82, 0x8E, 0x50, 0x8C, 0x81, 0x05, 0x8D, 0x52, 0x8B, 0x04, 0x8A, 0x54, 0x87, 0x02,
+    0x82, 0x47, 0x8B, 0x84, 0x81, 0x00, 0x81, 0x85, 0x8C, 0x47, 0x81, 0x01, 0x89, 0x46, 0x89, 0x06,
+    0x8A, 0x46, 0x88, 0x01, 0x46, 0x8D, 0x08, 0x8E, 0x45, 0x8E, 0x00, 0x83, 0x46, 0x87, 0x08, 0x88,
+    0x46, 0x82, 0x87, 0x46, 0x82, 0x08, 0x84, 0x46, 0x86, 0x89, 0x46, 0x09, 0x81, 0x46, 0x88, 0x8A,
+    0x45, 0x8E, 0x0A, 0x46, 0x8A, 0x8B, 0x45, 0x8D, 0x0A, 0x8E, 0x45, 0x9B, 0x45, 0x8D, 0x0A, 0x8E,
+    0x45, 0x9A, 0x45, 0x8E, 0x0A, 0x46, 0x99, 0x46, 0x09, 0x81, 0x46, 0x88, 0x86, 0x46, 0x83, 0x08,
+    0x84, 0x46, 0x86, 0x83, 0x46, 0x87, 0x08, 0x88, 0x46, 0x82, 0x00, 0x8E, 0x45, 0x8E, 0x08, 0x8E,
+    0x45, 0x8E, 0x01, 0x88, 0x46, 0x89, 0x06, 0x8A, 0x46, 0x88, 0x01, 0x81, 0x47, 0x8C, 0x84, 0x81,
+    0x00, 0x81, 0x84, 0x8C, 0x47, 0x81, 0x02, 0x87, 0x54, 0x88, 0x04, 0x8C, 0x52, 0x8C, 0x05, 0x81,
+    0x8C, 0x50, 0x8D, 0x81, 0x07, 0x8A, 0x4E, 0x8B, 0x0A, 0x84, 0x8C, 0x4A, 0x8C, 0x84, 0x0D, 0x83,
+    0x88, 0x8B, 0x8E, 0x41, 0x8E, 0x8D, 0x8B, 0x87, 0x83, 0x07, 0x06, 0x87, 0x8C, 0x40, 0x8E, 0x8A,
+    0x83, 0x05, 0x83, 0x42, 0x88, 0x07, 0x82, 0x8D, 0x45, 0x8A, 0x81, 0x03, 0x89, 0x42, 0x86, 0x07,
+    0x8D, 0x48, 0x88, 0x82, 0x00, 0x85, 0x43, 0x82, 0x06, 0x88, 0x50, 0x8D, 0x07, 0x8E, 0x50, 0x86,
+    0x06, 0x83, 0x43, 0x85, 0x00, 0x82, 0x89, 0x48, 0x8C, 0x07, 0x87, 0x42, 0x88, 0x03, 0x82, 0x8B,
+    0x45, 0x8C, 0x81, 0x07, 0x89, 0x42, 0x82, 0x05, 0x84, 0x8B, 0x41, 0x8C, 0x87, 0x3F, 0x04, 0x83,
+    0x87, 0x8B, 0x8D, 0x8E, 0x41, 0x8D, 0x8B, 0x87, 0x82, 0x0D, 0x85, 0x8D, 0x4A, 0x8C, 0x84, 0x09,
+    0x81, 0x8C, 0x4E, 0x8A, 0x07, 0x82, 0x8E, 0x50, 0x8C, 0x81, 0x05, 0x8D, 0x52, 0x8B, 0x04, 0x8A,
+    0x54, 0x87, 0x02, 0x82, 0x47, 0x8B, 0x84, 0x81, 0x00, 0x81, 0x85, 0x8C, 0x47, 0x81, 0x01, 0x89,
+    0x46, 0x89, 0x06, 0x8A, 0x46, 0x88, 0x01, 0x46, 0x8D, 0x08, 0x8E, 0x45, 0x8E, 0x00, 0x83, 0x46,
+    0x87, 0x08, 0x88, 0x46, 0x82, 0x87, 0x46, 0x82, 0x08, 0x84, 0x46, 0x86, 0x89, 0x46, 0x09, 0x81,
+    0x46, 0x88, 0x8A, 0x45, 0x8E, 0x0A, 0x46, 0x8A, 0x8B, 0x45, 0x8D, 0x0A, 0x8E, 0x45, 0x9B, 0x45,
+    0x8D, 0x0A, 0x8E, 0x45, 0x9A, 0x45, 0x8E, 0x0A, 0x46, 0x99, 0x46, 0x09, 0x81, 0x46, 0x88, 0x86,
+    0x46, 0x83, 0x08, 0x84, 0x46, 0x86, 0x83, 0x46, 0x87, 0x08, 0x88, 0x46, 0x82, 0x00, 0x8E, 0x45,
+    0x8E, 0x08, 0x8E, 0x45, 0x8E, 0x01, 0x88, 0x46, 0x89, 0x06, 0x8A, 0x46, 0x88, 0x01, 0x81, 0x47,
+    0x8C, 0x84, 0x81, 0x00, 0x81, 0x84, 0x8C, 0x47, 0x81, 0x02, 0x87, 0x54, 0x88, 0x04, 0x8C, 0x52,
+    0x8C, 0x05, 0x81, 0x8C, 0x50, 0x8D, 0x81, 0x07, 0x8A, 0x4E, 0x8B, 0x0A, 0x84, 0x8C, 0x4A, 0x8C,
+    0x84, 0x0D, 0x83, 0x88, 0x8B, 0x8E, 0x41, 0x8E, 0x8D, 0x8B, 0x87, 0x83, 0x07, 0x06, 0x86, 0x87,
+    0x85, 0x05, 0x81, 0x86, 0x87, 0x85, 0x0B, 0x82, 0x8E, 0x42, 0x8E, 0x82, 0x02, 0x83, 0x43, 0x8D,
+    0x81, 0x09, 0x8A, 0x44, 0x8A, 0x02, 0x8D, 0x44, 0x89, 0x09, 0x8D, 0x44, 0x8E, 0x02, 0x45, 0x8C,
+    0x09, 0x8C, 0x44, 0x8C, 0x02, 0x8E, 0x44, 0x8B, 0x09, 0x86, 0x44, 0x86, 0x02, 0x89, 0x44, 0x85,
+    0x0A, 0x87, 0x8D, 0x40, 0x8D, 0x86, 0x04, 0x88, 0x8D, 0x40, 0x8D, 0x85, 0x3F, 0x1E, 0x83, 0x87,
+    0x8B, 0x8D, 0x8E, 0x41, 0x8D, 0x8B, 0x87, 0x82, 0x0D, 0x85, 0x8D, 0x4A, 0x8C, 0x84, 0x09, 0x81,
+    0x8C, 0x4E, 0x8A, 0x07, 0x82, 0x8E, 0x50, 0x8C, 0x81, 0x05, 0x8D, 0x52, 0x8B, 0x04, 0x8A, 0x54,
+    0x87, 0x02, 0x82, 0x47, 0x8B, 0x84, 0x81, 0x00, 0x81, 0x85, 0x8C, 0x47, 0x81, 0x01, 0x89, 0x46,
+    0x89, 0x06, 0x8A, 0x46, 0x88, 0x01, 0x46, 0x8D, 0x08, 0x8E, 0x45, 0x8E, 0x00, 0x83, 0x46, 0x87,
+    0x08, 0x88, 0x46, 0x82, 0x87, 0x46, 0x82, 0x08, 0x84, 0x46, 0x86, 0x89, 0x46, 0x09, 0x81, 0x46,
+    0x88, 0x8A, 0x45, 0x8E, 0x0A, 0x46, 0x8A, 0x8B, 0x45, 0x8D, 0x0A, 0x8E, 0x45, 0x9B, 0x45, 0x8D,
+    0x0A, 0x8E, 0x45, 0x9A, 0x45, 0x8E, 0x0A, 0x46, 0x99, 0x46, 0x09, 0x81, 0x46, 0x88, 0x86, 0x46,
+    0x83, 0x08, 0x84, 0x46, 0x86, 0x83, 0x46, 0x87, 0x08, 0x88, 0x46, 0x82, 0x00, 0x8E, 0x45, 0x8E,
+    0x08, 0x8E, 0x45, 0x8E, 0x01, 0x88, 0x46, 0x89, 0x06, 0x8A, 0x46, 0x88, 0x01, 0x81, 0x47, 0x8C,
+    0x84, 0x81, 0x00, 0x81, 0x84, 0x8C, 0x47, 0x81, 0x02, 0x87, 0x54, 0x88, 0x04, 0x8C, 0x52, 0x8C,
+    0x05, 0x81, 0x8C, 0x50, 0x8D, 0x81, 0x07, 0x8A, 0x4E, 0x8B, 0x0A, 0x84, 0x8C, 0x4A, 0x8C, 0x84,
+    0x0D, 0x83, 0x88, 0x8B, 0x8E, 0x41, 0x8E, 0x8D, 0x8B, 0x87, 0x83, 0x07, 0x09, 0x88, 0x8D, 0x40,
+    0x8C, 0x83, 0x12, 0x89, 0x44, 0x81, 0x11, 0x45, 0x87, 0x10, 0x81, 0x45, 0x89, 0x11, 0x45, 0x88,
+    0x11, 0x8C, 0x44, 0x84, 0x11, 0x82, 0x8E, 0x42, 0x88, 0x14, 0x84, 0x85, 0x82, 0x3C, 0x8D, 0x56,
+    0x86, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x8D, 0x56, 0x86, 0x84, 0xF5, 0xF5,
+    0xE5, 0x82, 0x3B, 0x88, 0x8E, 0x40, 0x8C, 0x83, 0x12, 0x89, 0x44, 0x81, 0x11, 0x45, 0x87, 0x10,
+    0x81, 0x45, 0x89, 0x11, 0x45, 0x88, 0x11, 0x8C, 0x44, 0x84, 0x11, 0x83, 0x8E, 0x42, 0x88, 0x14,
+    0x84, 0x85, 0x82, 0x0A, 0x13, 0x83, 0x85, 0x0C, 0x83, 0x87, 0x8B, 0x8D, 0x8E, 0x41, 0x8D, 0x8B,
+    0x87, 0x82, 0x00, 0x8D, 0x40, 0x8A, 0x09, 0x85, 0x8D, 0x4A, 0x8E, 0x42, 0x8E, 0x83, 0x05, 0x81,
+    0x8C, 0x51, 0x84, 0x04, 0x82, 0x8E, 0x51, 0x88, 0x05, 0x8D, 0x52, 0x8B, 0x04, 0x8A, 0x54, 0x86,
+    0x02, 0x82, 0x47, 0x8B, 0x84, 0x81, 0x00, 0x81, 0x86, 0x48, 0x81, 0x01, 0x89, 0x46, 0x89, 0x04,
+    0x89, 0x48, 0x87, 0x01, 0x46, 0x8D, 0x04, 0x84, 0x49, 0x8E, 0x00, 0x83, 0x46, 0x87, 0x03, 0x81,
+    0x8E, 0x4A, 0x82, 0x87, 0x46, 0x82, 0x03, 0x8A, 0x43, 0x8E, 0x46, 0x86, 0x89, 0x46, 0x03, 0x85,
+    0x44, 0x84, 0x46, 0x88, 0x8A, 0x45, 0x8E, 0x02, 0x81, 0x8E, 0x43, 0x87, 0x00, 0x46, 0x89, 0x8B,
+    0x45, 0x8D, 0x02, 0x8A, 0x43, 0x8C, 0x01, 0x8E, 0x45, 0x8A, 0x8B, 0x45, 0x8D, 0x01, 0x85, 0x44,
+    0x82, 0x01, 0x8E, 0x45, 0x9A, 0x45, 0x8E, 0x00, 0x81, 0x8E, 0x43, 0x87, 0x02, 0x46, 0x99, 0x46,
+    0x00, 0x8B, 0x43, 0x8C, 0x02, 0x81, 0x46, 0x88, 0x86, 0x46, 0x89, 0x44, 0x82, 0x02, 0x84, 0x46,
+    0x86, 0x82, 0x4B, 0x86, 0x03, 0x88, 0x46, 0x82, 0x00, 0x8E, 0x49, 0x8B, 0x04, 0x8E, 0x45, 0x8E,
+    0x01, 0x88, 0x48, 0x8E, 0x81, 0x03, 0x8A, 0x46, 0x88, 0x01, 0x81, 0x48, 0x89, 0x81, 0x00, 0x81,
+    0x84, 0x8C, 0x47, 0x81, 0x02, 0x88, 0x54, 0x88, 0x04, 0x8B, 0x52, 0x8C, 0x05, 0x83, 0x51, 0x8D,
+    0x81, 0x05, 0x8C, 0x50, 0x8B, 0x06, 0x87, 0x4F, 0x8C, 0x84, 0x07, 0x81, 0x8A, 0x42, 0x84, 0x83,
+    0x87, 0x8B, 0x8E, 0x41, 0x8E, 0x8D, 0x8B, 0x87, 0x83, 0x0B, 0x85, 0x8E, 0x8A, 0x18, 0x91, 0x13,
+    0x02, 0x8E, 0x46, 0x8A, 0x10, 0x81, 0x8D, 0x46, 0x85, 0x10, 0x81, 0x8C, 0x46, 0x82, 0x11, 0x89,
+    0x45, 0x8D, 0x12, 0x86, 0x45, 0x8A, 0x12, 0x83, 0x8E, 0x44, 0x87, 0x12, 0x81, 0x8C, 0x44, 0x85,
+    0x13, 0x88, 0x44, 0x3F, 0x16, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87,
+    0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83,
+    0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83,
+    0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87,
+    0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83,
+    0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x88, 0x46, 0x83, 0x46, 0x83, 0x08, 0x89, 0x46, 0x83,
+    0x46, 0x83, 0x08, 0x8B, 0x46, 0x83, 0x46, 0x84, 0x08, 0x8E, 0x46, 0x83, 0x46, 0x86, 0x07, 0x82,
+    0x47, 0x82, 0x46, 0x8A, 0x07, 0x89, 0x47, 0x81, 0x47, 0x83, 0x05, 0x84, 0x48, 0x00, 0x8D, 0x46,
+    0x8E, 0x86, 0x02, 0x83, 0x89, 0x49, 0x00, 0x89, 0x57, 0x00, 0x82, 0x57, 0x01, 0x89, 0x4E, 0x86,
+    0x8A, 0x45, 0x02, 0x8B, 0x4C, 0x88, 0x00, 0x86, 0x45, 0x03, 0x88, 0x49, 0x8E, 0x84, 0x01, 0x82,
+    0x45, 0x04, 0x81, 0x86, 0x8A, 0x8D, 0x8E, 0x41, 0x8D, 0x8A, 0x85, 0x04, 0x8E, 0x44, 0x0D, 0x87,
+    0x47, 0x82, 0x0E, 0x82, 0x46, 0x8E, 0x83, 0x0F, 0x8D, 0x45, 0x8D, 0x82, 0x0F, 0x8A, 0x45, 0x8C,
+    0x81, 0x0F, 0x87, 0x45, 0x89, 0x10, 0x84, 0x45, 0x86, 0x10, 0x82, 0x44, 0x8E, 0x83, 0x11, 0x8C,
+    0x43, 0x8B, 0x81, 0x3F, 0x17, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87,
+    0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83,
+    0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83,
+    0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87,
+    0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83,
+    0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x88, 0x46, 0x83, 0x46, 0x83, 0x08, 0x89, 0x46, 0x83,
+    0x46, 0x83, 0x08, 0x8B, 0x46, 0x83, 0x46, 0x84, 0x08, 0x8E, 0x46, 0x83, 0x46, 0x86, 0x07, 0x82,
+    0x47, 0x82, 0x46, 0x8A, 0x07, 0x89, 0x47, 0x81, 0x47, 0x83, 0x05, 0x84, 0x48, 0x00, 0x8D, 0x46,
+    0x8E, 0x86, 0x02, 0x83, 0x89, 0x49, 0x00, 0x89, 0x57, 0x00, 0x82, 0x57, 0x01, 0x89, 0x4E, 0x86,
+    0x8A, 0x45, 0x02, 0x8B, 0x4C, 0x88, 0x00, 0x86, 0x45, 0x03, 0x88, 0x49, 0x8E, 0x84, 0x01, 0x82,
+    0x45, 0x04, 0x81, 0x86, 0x8A, 0x8D, 0x8E, 0x41, 0x8D, 0x8A, 0x85, 0x04, 0x8E, 0x44, 0x07, 0x85,
+    0x47, 0x8E, 0x81, 0x0D, 0x81, 0x8E, 0x48, 0x8B, 0x0D, 0x8C, 0x4A, 0x88, 0x0B, 0x8A, 0x45, 0x8E,
+    0x45, 0x86, 0x09, 0x88, 0x45, 0x87, 0x81, 0x8C, 0x45, 0x84, 0x07, 0x87, 0x45, 0x85, 0x02, 0x8A,
+    0x45, 0x83, 0x05, 0x86, 0x44, 0x8C, 0x82, 0x04, 0x86, 0x44, 0x8E, 0x83, 0x03, 0x83, 0x44, 0x87,
+    0x07, 0x81, 0x8B, 0x43, 0x8E, 0x3F, 0x0F, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83,
+    0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83,
+    0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87,
+    0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83,
+    0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83,
+    0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x88, 0x46, 0x83, 0x46, 0x83, 0x08, 0x89,
+    0x46, 0x83, 0x46, 0x83, 0x08, 0x8B, 0x46, 0x83, 0x46, 0x84, 0x08, 0x8E, 0x46, 0x83, 0x46, 0x86,
+    0x07, 0x82, 0x47, 0x82, 0x46, 0x8A, 0x07, 0x89, 0x47, 0x81, 0x47, 0x83, 0x05, 0x84, 0x48, 0x00,
+    0x8D, 0x46, 0x8E, 0x86, 0x02, 0x83, 0x89, 0x49, 0x00, 0x89, 0x57, 0x00, 0x82, 0x57, 0x01, 0x89,
+    0x4E, 0x86, 0x8A, 0x45, 0x02, 0x8B, 0x4C, 0x88, 0x00, 0x86, 0x45, 0x03, 0x88, 0x49, 0x8E, 0x84,
+    0x01, 0x82, 0x45, 0x04, 0x81, 0x86, 0x8A, 0x8D, 0x8E, 0x41, 0x8D, 0x8A, 0x85, 0x04, 0x8E, 0x44,
+    0x05, 0x81, 0x86, 0x87, 0x85, 0x05, 0x82, 0x86, 0x87, 0x84, 0x0A, 0x83, 0x43, 0x8D, 0x03, 0x85,
+    0x43, 0x8C, 0x09, 0x8C, 0x44, 0x88, 0x02, 0x45, 0x87, 0x08, 0x45, 0x8B, 0x01, 0x82, 0x45, 0x8A,
+    0x08, 0x8E, 0x44, 0x8A, 0x01, 0x81, 0x45, 0x89, 0x08, 0x89, 0x44, 0x84, 0x02, 0x8B, 0x44, 0x83,
+    0x09, 0x88, 0x8E, 0x40, 0x8C, 0x85, 0x03, 0x81, 0x89, 0x8E, 0x40, 0x8C, 0x84, 0x3F, 0x2C, 0x83,
+    0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87,
+    0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83,
+    0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83,
+    0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87,
+    0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83, 0x08, 0x87, 0x46, 0x83, 0x46, 0x83,
+    0x08, 0x88, 0x46, 0x83, 0x46, 0x83, 0x08, 0x89, 0x46, 0x83, 0x46, 0x83, 0x08, 0x8B, 0x46, 0x83,
+    0x46, 0x84, 0x08, 0x8E, 0x46, 0x83, 0x46, 0x86, 0x07, 0x82, 0x47, 0x82, 0x46, 0x8A, 0x07, 0x89,
+    0x47, 0x81, 0x47, 0x83, 0x05, 0x84, 0x48, 0x00, 0x8D, 0x46, 0x8E, 0x86, 0x02, 0x83, 0x89, 0x49,
+    0x00, 0x89, 0x57, 0x00, 0x82, 0x57, 0x01, 0x89, 0x4E, 0x86, 0x8A, 0x45, 0x02, 0x8B, 0x4C, 0x88,
+    0x00, 0x86, 0x45, 0x03, 0x88, 0x49, 0x8E, 0x84, 0x01, 0x82, 0x45, 0x04, 0x81, 0x86, 0x8A, 0x8D,
+    0x8E, 0x41, 0x8D, 0x8A, 0x85, 0x04, 0x8E, 0x44, 0x0D, 0x81, 0x8E, 0x46, 0x88, 0x12, 0x8B, 0x46,
+    0x89, 0x12, 0x87, 0x46, 0x87, 0x12, 0x83, 0x46, 0x85, 0x12, 0x81, 0x8E, 0x44, 0x8E, 0x83, 0x13,
+    0x8C, 0x44, 0x8B, 0x81, 0x13, 0x8A, 0x44, 0x88, 0x14, 0x85, 0x43, 0x8E, 0x84, 0x3F, 0x23, 0x8C,
+    0x46, 0x85, 0x0A, 0x8B, 0x46, 0x83, 0x86, 0x46, 0x8A, 0x09, 0x81, 0x46, 0x8D, 0x01, 0x47, 0x09,
+    0x86, 0x46, 0x87, 0x01, 0x89, 0x46, 0x85, 0x08, 0x8B, 0x46, 0x81, 0x01, 0x83, 0x46, 0x8A, 0x08,
+    0x46, 0x8B, 0x03, 0x8C, 0x46, 0x07, 0x85, 0x46, 0x85, 0x03, 0x86, 0x46, 0x85, 0x06, 0x8B, 0x46,
+    0x05, 0x46, 0x8A, 0x06, 0x46, 0x89, 0x05, 0x89, 0x46, 0x05, 0x85, 0x46, 0x83, 0x05, 0x82, 0x46,
+    0x85, 0x04, 0x8A, 0x45, 0x8D, 0x07, 0x8C, 0x45, 0x8B, 0x04, 0x46, 0x87, 0x07, 0x86, 0x46, 0x03,
+    0x85, 0x46, 0x81, 0x08, 0x46, 0x85, 0x02, 0x8A, 0x45, 0x8B, 0x09, 0x89, 0x45, 0x8B, 0x02, 0x46,
+    0x85, 0x09, 0x82, 0x46, 0x01, 0x85, 0x45, 0x8E, 0x0B, 0x8C, 0x45, 0x85, 0x00, 0x8A, 0x45, 0x89,
+    0x0B, 0x86, 0x45, 0x89, 0x00, 0x8E, 0x45, 0x83, 0x0C, 0x8E, 0x44, 0x8D, 0x83, 0x45, 0x8D, 0x0D,
+    0x89, 0x45, 0x86, 0x45, 0x87, 0x0D, 0x82, 0x45, 0x8B, 0x45, 0x81, 0x0E, 0x8C, 0x4A, 0x8B, 0x0F,
+    0x85, 0x4A, 0x85, 0x10, 0x8E, 0x48, 0x8E, 0x11, 0x89, 0x48, 0x88, 0x11, 0x82, 0x48, 0x82, 0x12,
+    0x8C, 0x46, 0x8C, 0x13, 0x85, 0x46, 0x86, 0x13, 0x85, 0x46, 0x81, 0x13, 0x8A, 0x45, 0x8A, 0x13,
+    0x82, 0x46, 0x84, 0x13, 0x8B, 0x45, 0x8E, 0x13, 0x88, 0x46, 0x87, 0x0C, 0x81, 0x82, 0x01, 0x81,
+    0x85, 0x8C, 0x47, 0x81, 0x0C, 0x84, 0x4C, 0x87, 0x0D, 0x84, 0x4B, 0x8C, 0x0E, 0x84, 0x4A, 0x8D,
+    0x81, 0x0E, 0x84, 0x49, 0x8C, 0x81, 0x0F, 0x84, 0x47, 0x8E, 0x86, 0x11, 0x82, 0x8B, 0x8D, 0x41,
+    0x8E, 0x8D, 0x8A, 0x85, 0x12, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85,
+    0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85,
+    0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x84,
+    0x02, 0x85, 0x8A, 0x8D, 0x41, 0x8D, 0x8B, 0x86, 0x06, 0x81, 0x46, 0x83, 0x00, 0x83, 0x8E, 0x47,
+    0x8E, 0x85, 0x04, 0x81, 0x46, 0x82, 0x86, 0x4B, 0x88, 0x03, 0x81, 0x46, 0x84, 0x4D, 0x86, 0x02,
+    0x81, 0x56, 0x82, 0x01, 0x81, 0x56, 0x8A, 0x01, 0x81, 0x48, 0x8D, 0x85, 0x81, 0x01, 0x84, 0x8C,
+    0x47, 0x81, 0x00, 0x81, 0x47, 0x8C, 0x06, 0x8C, 0x46, 0x87, 0x00, 0x81, 0x47, 0x82, 0x06, 0x82,
+    0x46, 0x8C, 0x00, 0x81, 0x46, 0x8D, 0x08, 0x8C, 0x46, 0x00, 0x81, 0x46, 0x89, 0x08, 0x88, 0x46,
+    0x82, 0x81, 0x46, 0x87, 0x08, 0x85, 0x46, 0x84, 0x81, 0x46, 0x86, 0x08, 0x84, 0x46, 0x84, 0x81,
+    0x46, 0x85, 0x08, 0x83, 0x46, 0x85, 0x81, 0x46, 0x86, 0x08, 0x83, 0x46, 0x85, 0x81, 0x46, 0x86,
+    0x08, 0x84, 0x46, 0x84, 0x81, 0x46, 0x88, 0x08, 0x86, 0x46, 0x84, 0x81, 0x46, 0x8A, 0x08, 0x88,
+    0x46, 0x82, 0x81, 0x46, 0x8E, 0x08, 0x8D, 0x46, 0x00, 0x81, 0x47, 0x85, 0x06, 0x83, 0x46, 0x8C,
+    0x00, 0x81, 0x47, 0x8E, 0x81, 0x05, 0x8D, 0x46, 0x87, 0x00, 0x81, 0x48, 0x8E, 0x87, 0x82, 0x00,
+    0x81, 0x85, 0x8D, 0x47, 0x82, 0x00, 0x81, 0x56, 0x8B, 0x01, 0x81, 0x56, 0x82, 0x01, 0x81, 0x46,
+    0x8D, 0x4D, 0x87, 0x02, 0x81, 0x46, 0x82, 0x8C, 0x4B, 0x88, 0x03, 0x81, 0x46, 0x83, 0x00, 0x88,
+    0x48, 0x8E, 0x85, 0x04, 0x81, 0x46, 0x84, 0x01, 0x82, 0x87, 0x8B, 0x8D, 0x41, 0x8D, 0x8B, 0x86,
+    0x81, 0x05, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46,
+    0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46,
+    0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46, 0x85, 0x11, 0x81, 0x46,
+    0x85, 0x11, 0x06, 0x81, 0x86, 0x87, 0x85, 0x05, 0x82, 0x86, 0x87, 0x84, 0x0D, 0x84, 0x43, 0x8C,
+    0x03, 0x86, 0x43, 0x8C, 0x0C, 0x8D, 0x44, 0x88, 0x02, 0x45, 0x86, 0x0B, 0x45, 0x8B, 0x01, 0x82,
+    0x45, 0x8A, 0x0B, 0x45, 0x8A, 0x01, 0x81, 0x45, 0x88, 0x0B, 0x89, 0x44, 0x83, 0x02, 0x8B, 0x44,
+    0x83, 0x0C, 0x88, 0x8E, 0x40, 0x8C, 0x84, 0x03, 0x81, 0x89, 0x8E, 0x40, 0x8C, 0x84, 0x3F, 0x3A,
+    0x8C, 0x46, 0x85, 0x0A, 0x8B, 0x46, 0x83, 0x86, 0x46, 0x8A, 0x09, 0x81, 0x46, 0x8D, 0x01, 0x47,
+    0x09, 0x86, 0x46, 0x87, 0x01, 0x89, 0x46, 0x85, 0x08, 0x8B, 0x46, 0x81, 0x01, 0x83, 0x46, 0x8A,
+    0x08, 0x46, 0x8B, 0x03, 0x8C, 0x46, 0x07, 0x85, 0x46, 0x85, 0x03, 0x86, 0x46, 0x85, 0x06, 0x8B,
+    0x46, 0x05, 0x46, 0x8A, 0x06, 0x46, 0x89, 0x05, 0x89, 0x46, 0x05, 0x85, 0x46, 0x83, 0x05, 0x82,
+    0x46, 0x85, 0x04, 0x8A, 0x45, 0x8D, 0x07, 0x8C, 0x45, 0x8B, 0x04, 0x46, 0x87, 0x07, 0x86, 0x46,
+    0x03, 0x85, 0x46, 0x81, 0x08, 0x46, 0x85, 0x02, 0x8A, 0x45, 0x8B, 0x09, 0x89, 0x45, 0x8B, 0x02,
+    0x46, 0x85, 0x09, 0x82, 0x46, 0x01, 0x85, 0x45, 0x8E, 0x0B, 0x8C, 0x45, 0x85, 0x00, 0x8A, 0x45,
+    0x89, 0x0B, 0x86, 0x45, 0x89, 0x00, 0x8E, 0x45, 0x83, 0x0C, 0x8E, 0x44, 0x8D, 0x83, 0x45, 0x8D,
+    0x0D, 0x89, 0x45, 0x86, 0x45, 0x87, 0x0D, 0x82, 0x45, 0x8B, 0x45, 0x81, 0x0E, 0x8C, 0x4A, 0x8B,
+    0x0F, 0x85, 0x4A, 0x85, 0x10, 0x8E, 0x48, 0x8E, 0x11, 0x89, 0x48, 0x88, 0x11, 0x82, 0x48, 0x82,
+    0x12, 0x8C, 0x46, 0x8C, 0x13, 0x85, 0x46, 0x86, 0x13, 0x85, 0x46, 0x81, 0x13, 0x8A, 0x45, 0x8A,
+    0x13, 0x82, 0x46, 0x84, 0x13, 0x8B, 0x45, 0x8E, 0x13, 0x88, 0x46, 0x87, 0x0C, 0x81, 0x82, 0x01,
+    0x81, 0x85, 0x8C, 0x47, 0x81, 0x0C, 0x84, 0x4C, 0x87, 0x0D, 0x84, 0x4B, 0x8C, 0x0E, 0x84, 0x4A,
+    0x8D, 0x81, 0x0E, 0x84, 0x49, 0x8C, 0x81, 0x0F, 0x84, 0x47, 0x8E, 0x86, 0x11, 0x82, 0x8B, 0x8D,
+    0x41, 0x8E, 0x8D, 0x8A, 0x85, 0x12,
+};
+const GFXglyph OpenSans24BGlyphs[] = {
+    { 0, 0, 13, 0, 0, 0, 4 }, //  
+    { 10, 37, 14, 2, 36, 131, 4 }, // !
+    { 18, 13, 24, 3, 36, 93, 135 }, // "
+    { 31, 36, 32, 1, 36, 239, 228 }, // #
+    { 25, 41, 29, 2, 38, 244, 467 }, // $
+    { 43, 36, 45, 1, 36, 433, 711 }, // %
+    { 36, 36, 38, 2, 36, 286, 1144 }, // &
+    { 8, 13, 13, 3, 36, 48, 1430 }, // '
+    { 14, 44, 17, 2, 36, 171, 1478 }, // (
+    { 14, 44, 17, 1, 36, 172, 1649 }, // )
+    { 25, 24, 27, 1, 38, 159, 1821 }, // *
+    { 25, 25, 29, 2, 30, 82, 1980 }, // +
+    { 11, 12, 15, 1, 6, 47, 2062 }, // ,
+    { 14, 7, 16, 1, 16, 22, 2109 }, // -
+    { 10, 9, 14, 2, 8, 38, 2131 }, // .
+    { 21, 36, 21, 0, 36, 140, 2169 }, // /
+    { 26, 36, 29, 1, 36, 249, 2309 }, // 0
+    { 19, 36, 29, 2, 36, 172, 2558 }, // 1
+    { 26, 36, 29, 1, 36, 168, 2730 }, // 2
+    { 26, 36, 29, 1, 36, 213, 2898 }, // 3
+    { 28, 36, 29, 0, 36, 201, 3111 }, // 4
+    { 25, 36, 29, 2, 36, 196, 3312 }, // 5
+    { 26, 36, 29, 1, 36, 243, 3508 }, // 6
+    { 26, 36, 29, 1, 36, 133, 3751 }, // 7
+    { 26, 36, 29, 1, 36, 259, 3884 }, // 8
+    { 26, 36, 29, 1, 36, 235, 4143 }, // 9
+    { 10, 29, 14, 2, 28, 75, 4378 }, // :
+    { 11, 34, 15, 1, 28, 87, 4453 }, // ;
+    { 25, 28, 29, 2, 32, 144, 4540 }, // <
+    { 25, 15, 29, 2, 25, 42, 4684 }, // =
+    { 25, 28, 29, 2, 32, 143, 4726 }, // >
+    { 23, 37, 24, 0, 36, 165, 4869 }, // ?
+    { 41, 40, 45, 2, 36, 484, 5034 }, // @
+    { 35, 36, 35, 0, 36, 228, 5518 }, // A
+    { 27, 36, 34, 4, 36, 231, 5746 }, // B
+    { 29, 36, 32, 2, 36, 192, 5977 }, // C
+    { 31, 36, 37, 4, 36, 259, 6169 }, // D
+    { 22, 36, 28, 4, 36, 137, 6428 }, // E
+    { 21, 36, 27, 4, 36, 105, 6565 }, // F
+    { 31, 36, 36, 2, 36, 236, 6670 }, // G
+    { 30, 36, 38, 4, 36, 229, 6906 }, // H
+    { 9, 36, 17, 4, 36, 108, 7135 }, // I
+    { 17, 46, 17, -4, 36, 196, 7243 }, // J
+    { 30, 36, 33, 4, 36, 277, 7439 }, // K
+    { 23, 36, 28, 4, 36, 134, 7716 }, // L
+    { 39, 36, 47, 4, 36, 416, 7850 }, // M
+    { 33, 36, 41, 4, 36, 318, 8266 }, // N
+    { 35, 36, 40, 2, 36, 274, 8584 }, // O
+    { 26, 36, 31, 4, 36, 204, 8858 }, // P
+    { 35, 44, 40, 2, 36, 303, 9062 }, // Q
+    { 30, 36, 33, 4, 36, 259, 9365 }, // R
+    { 24, 36, 28, 2, 36, 208, 9624 }, // S
+    { 27, 36, 29, 1, 36, 127, 9832 }, // T
+    { 30, 36, 38, 4, 36, 231, 9959 }, // U
+    { 33, 36, 33, 0, 36, 248, 10190 }, // V
+    { 49, 36, 48, 0, 36, 446, 10438 }, // W
+    { 34, 36, 33, 0, 36, 260, 10884 }, // X
+    { 32, 36, 31, 0, 36, 204, 11144 }, // Y
+    { 27, 36, 29, 1, 36, 136, 11348 }, // Z
+    { 13, 44, 17, 3, 36, 168, 11484 }, // [
+    { 21, 36, 21, 0, 36, 139, 11652 }, // '\\'
+    { 13, 44, 17, 1, 36, 166, 11791 }, // ]
+    { 27, 23, 27, 0, 36, 153, 11957 }, // ^
+    { 22, 4, 21, -1, -4, 14, 12110 }, // _
+    { 15, 8, 30, 8, 38, 34, 12124 }, // `
+    { 25, 28, 30, 2, 28, 201, 12158 }, // a
+    { 27, 38, 32, 3, 38, 257, 12359 }, // b
+    { 23, 28, 26, 2, 28, 160, 12616 }, // c
+    { 26, 38, 32, 2, 38, 253, 12776 }, // d
+    { 26, 28, 30, 2, 28, 169, 13029 }, // e
+    { 21, 38, 19, 1, 38, 161, 13198 }, // f
+    { 28, 40, 28, 0, 28, 283, 13359 }, // g
+    { 27, 38, 33, 3, 38, 225, 13642 }, // h
+    { 9, 38, 15, 3, 38, 116, 13867 }, // i
+    { 16, 50, 15, -4, 38, 205, 13983 }, // j
+    { 28, 38, 31, 3, 38, 247, 14188 }, // k
+    { 9, 38, 15, 3, 38, 114, 14435 }, // l
+    { 43, 28, 49, 3, 28, 315, 14549 }, // m
+    { 27, 28, 33, 3, 28, 183, 14864 }, // n
+    { 27, 28, 31, 2, 28, 191, 15047 }, // o
+    { 27, 40, 32, 3, 28, 260, 15238 }, // p
+    { 26, 40, 32, 2, 28, 260, 15498 }, // q
+    { 19, 28, 23, 3, 28, 131, 15758 }, // r
+    { 21, 28, 25, 2, 28, 171, 15889 }, // s
+    { 20, 33, 22, 1, 33, 151, 16060 }, // t
+    { 26, 27, 33, 3, 27, 169, 16211 }, // u
+    { 29, 27, 28, 0, 27, 180, 16380 }, // v
+    { 43, 27, 43, 0, 27, 334, 16560 }, // w
+    { 29, 27, 29, 0, 27, 186, 16894 }, // x
+    { 29, 39, 28, 0, 27, 230, 17080 }, // y
+    { 22, 27, 24, 1, 27, 112, 17310 }, // z
+    { 18, 44, 20, 0, 36, 177, 17422 }, // {
+    { 6, 49, 28, 11, 38, 147, 17599 }, // |
+    { 17, 44, 20, 2, 36, 183, 17746 }, // }
+    { 25, 11, 29, 2, 23, 81, 17929 }, // ~
+    { 0, 0, 13, 0, 0, 0, 18010 }, //  
+    { 10, 36, 14, 2, 27, 121, 18010 }, // ¡
+    { 23, 36, 29, 3, 36, 187, 18131 }, // ¢
+    { 26, 36, 29, 2, 36, 154, 18318 }, // £
+    { 24, 23, 29, 2, 29, 182, 18472 }, // ¤
+    { 29, 36, 29, 0, 36, 207, 18654 }, // ¥
+    { 6, 49, 28, 11, 38, 121, 18861 }, // ¦
+    { 20, 38, 24, 2, 38, 250, 18982 }, // §
+    { 18, 7, 30, 6, 38, 62, 19232 }, // ¨
+    { 38, 36, 42, 2, 36, 433, 19294 }, // ©
+    { 16, 18, 19, 1, 36, 116, 19727 }, // ª
+    { 27, 23, 31, 2, 25, 203, 19843 }, // «
+    { 25, 14, 29, 2, 20, 45, 20046 }, // ¬
+    { 14, 7, 16, 1, 16, 22, 20091 }, // ­
+    { 38, 36, 42, 2, 36, 462, 20113 }, // ®
+    { 27, 5, 25, -1, 43, 14, 20575 }, // ¯
+    { 18, 17, 21, 2, 36, 113, 20589 }, // °
+    { 25, 32, 29, 2, 32, 102, 20702 }, // ±
+    { 17, 22, 19, 1, 36, 106, 20804 }, // ²
+    { 16, 22, 19, 1, 36, 128, 20910 }, // ³
+    { 15, 8, 30, 8, 38, 38, 21038 }, // ´
+    { 27, 39, 33, 3, 27, 214, 21076 }, // µ
+    { 27, 44, 33, 2, 38, 340, 21290 }, // ¶
+    { 10, 9, 14, 2, 22, 37, 21630 }, // ·
+    { 12, 12, 10, -1, 0, 60, 21667 }, // ¸
+    { 13, 22, 19, 2, 36, 99, 21727 }, // ¹
+    { 17, 18, 19, 1, 36, 116, 21826 }, // º
+    { 27, 23, 31, 2, 25, 206, 21942 }, // »
+    { 41, 36, 44, 1, 36, 356, 22148 }, // ¼
+    { 41, 36, 44, 1, 36, 360, 22504 }, // ½
+    { 40, 36, 44, 2, 36, 396, 22864 }, // ¾
+    { 23, 37, 24, 1, 27, 169, 23260 }, // ¿
+    { 35, 46, 35, 0, 46, 264, 23429 }, // À
+    { 35, 46, 35, 0, 46, 266, 23693 }, // Á
+    { 35, 46, 35, 0, 46, 286, 23959 }, // Â
+    { 35, 46, 35, 0, 46, 296, 24245 }, // Ã
+    { 35, 46, 35, 0, 46, 289, 24541 }, // Ä
+    { 35, 45, 35, 0, 45, 290, 24830 }, // Å
+    { 45, 36, 48, 0, 36, 244, 25120 }, // Æ
+    { 29, 48, 32, 2, 36, 253, 25364 }, // Ç
+    { 22, 46, 28, 4, 46, 175, 25617 }, // È
+    { 22, 46, 28, 4, 46, 175, 25792 }, // É
+    { 22, 46, 28, 4, 46, 198, 25967 }, // Ê
+    { 22, 46, 28, 4, 46, 201, 26165 }, // Ë
+    { 15, 46, 17, -2, 46, 180, 26366 }, // Ì
+    { 15, 46, 17, 4, 46, 181, 26546 }, // Í
+    { 22, 46, 17, -3, 46, 200, 26727 }, // Î
+    { 18, 46, 17, -1, 46, 205, 26927 }, // Ï
+    { 34, 36, 37, 1, 36, 263, 27132 }, // Ð
+    { 33, 46, 41, 4, 46, 389, 27395 }, // Ñ
+    { 35, 46, 40, 2, 46, 310, 27784 }, // Ò
+    { 35, 46, 40, 2, 46, 312, 28094 }, // Ó
+    { 35, 46, 40, 2, 46, 335, 28406 }, // Ô
+    { 35, 46, 40, 2, 46, 342, 28741 }, // Õ
+    { 35, 46, 40, 2, 46, 337, 29083 }, // Ö
+    { 23, 23, 29, 3, 29, 174, 29420 }, // ×
+    { 35, 40, 40, 2, 38, 350, 29594 }, // Ø
+    { 30, 46, 38, 4, 46, 267, 29944 }, // Ù
+    { 30, 46, 38, 4, 46, 267, 30211 }, // Ú
+    { 30, 46, 38, 4, 46, 292, 30478 }, // Û
+    { 30, 46, 38, 4, 46, 295, 30770 }, // Ü
+    { 32, 46, 31, 0, 46, 244, 31065 }, // Ý
+    { 26, 36, 31, 4, 36, 204, 31309 }, // Þ
+    { 31, 38, 36, 3, 38, 320, 31513 }, // ß
+    { 25, 38, 30, 2, 38, 237, 31833 }, // à
+    { 25, 38, 30, 2, 38, 236, 32070 }, // á
+    { 25, 38, 30, 2, 38, 260, 32306 }, // â
+    { 25, 38, 30, 2, 38, 267, 32566 }, // ã
+    { 25, 38, 30, 2, 38, 263, 32833 }, // ä
+    { 25, 42, 30, 2, 42, 283, 33096 }, // å
+    { 42, 28, 46, 2, 28, 285, 33379 }, // æ
+    { 23, 40, 26, 2, 28, 221, 33664 }, // ç
+    { 26, 38, 30, 2, 38, 205, 33885 }, // è
+    { 26, 38, 30, 2, 38, 205, 34090 }, // é
+    { 26, 38, 30, 2, 38, 224, 34295 }, // ê
+    { 26, 38, 30, 2, 38, 232, 34519 }, // ë
+    { 15, 38, 15, -3, 38, 143, 34751 }, // ì
+    { 15, 38, 15, 3, 38, 145, 34894 }, // í
+    { 22, 38, 15, -3, 38, 164, 35039 }, // î
+    { 18, 38, 15, -1, 38, 172, 35203 }, // ï
+    { 27, 38, 31, 2, 38, 275, 35375 }, // ð
+    { 27, 38, 33, 3, 38, 250, 35650 }, // ñ
+    { 27, 38, 31, 2, 38, 229, 35900 }, // ò
+    { 27, 38, 31, 2, 38, 228, 36129 }, // ó
+    { 27, 38, 31, 2, 38, 245, 36357 }, // ô
+    { 27, 38, 31, 2, 38, 259, 36602 }, // õ
+    { 27, 38, 31, 2, 38, 255, 36861 }, // ö
+    { 25, 26, 29, 2, 30, 88, 37116 }, // ÷
+    { 27, 31, 31, 2, 29, 236, 37204 }, // ø
+    { 26, 38, 33, 3, 38, 206, 37440 }, // ù
+    { 26, 38, 33, 3, 38, 208, 37646 }, // ú
+    { 26, 38, 33, 3, 38, 226, 37854 }, // û
+    { 26, 38, 33, 3, 38, 232, 38080 }, // ü
+    { 29, 50, 28, 0, 38, 269, 38312 }, // ý
+    { 27, 50, 32, 3, 38, 301, 38581 }, // þ
+    { 29, 50, 28, 0, 38, 292, 38882 }, // ÿ
+};
+const UnicodeInterval OpenSans24BIntervals[] = {
+    { 0x20, 0x7E, 0x0 },
+    { 0xA0, 0xFF, 0x5F },
+};
+const GFXfont OpenSans24B = {
+    (uint8_t*)OpenSans24BBitmaps,
+    (GFXglyph*)OpenSans24BGlyphs,
+    (UnicodeInterval*)OpenSans24BIntervals,
+    2,
+    1,
+    68,
+    54,
+    -15,
+};
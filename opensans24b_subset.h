@@ -0,0 +1,1344 @@
+#pragma once
+// Generated by tools/fontsubset.py from opensans24b.h, do not edit
+#include "epd_driver.h"
+const uint8_t OpenSans24BBitmaps[19188] = {
+    0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x9C, 0xFB, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x0F, 0x40, 0x22, 0xFE, 0x01, 0x90, 0xF0, 0xBF, 0x00, 0x24, 0xEC, 0x41, 0x84, 0xFE, 0x01, 0x20,
+    0x21, 0xBF, 0x01, 0x44, 0x2C, 0x00, 0x12, 0xFC, 0x13, 0x60, 0x04, 0x5F, 0x03, 0x90, 0xE0, 0x2D,
+    0x00, 0x11, 0x09, 0x40, 0x82, 0x27, 0x00, 0x48, 0x70, 0x3B, 0x00, 0x09, 0x2E, 0x10, 0xC1, 0x69,
+    0x00, 0x22, 0x14, 0x80, 0x04, 0x87, 0x00, 0x90, 0x60, 0x67, 0x00, 0x12, 0x6C, 0x20, 0x82, 0x15,
+    0x44, 0xB0, 0x30, 0xFC, 0x03, 0x11, 0x7F, 0xFF, 0xFF, 0x67, 0x66, 0x68, 0xEB, 0xE8, 0x60, 0x64,
+    0x40, 0x03, 0x02, 0xCE, 0x4C, 0x0C, 0x0C, 0xBF, 0xFE, 0x9F, 0x67, 0x04, 0x59, 0xC4, 0x0B, 0x72,
+    0x95, 0xFD, 0x47, 0x90, 0xFB, 0x40, 0x44, 0x3C, 0xD8, 0x55, 0x20, 0xDB, 0x38, 0x19, 0x8E, 0xFC,
+    0xAF, 0x65, 0x00, 0x00, 0x88, 0x28, 0x72, 0xE4, 0x78, 0x9C, 0x15, 0xCA, 0xDB, 0x11, 0x43, 0x00,
+    0x00, 0x44, 0xD1, 0x8D, 0x21, 0x8C, 0x67, 0x09, 0x4A, 0x50, 0x82, 0x52, 0xB4, 0xA0, 0x14, 0x25,
+    0x28, 0x21, 0x25, 0xA4, 0x84, 0x94, 0xA0, 0x04, 0x31, 0x88, 0x89, 0x8F, 0x6B, 0xFD, 0xED, 0xEC,
+    0xB9, 0x27, 0x54, 0xDA, 0xA1, 0xFB, 0xDF, 0x63, 0x83, 0xF6, 0x80, 0x42, 0x2B, 0x34, 0x3F, 0xC8,
+    0xB5, 0x40, 0x6D, 0xCE, 0xF4, 0xB5, 0x9B, 0x53, 0xCD, 0x50, 0x9A, 0x93, 0x7B, 0x14, 0xE6, 0x58,
+    0x93, 0x43, 0xF3, 0x53, 0x6F, 0x87, 0x7E, 0x23, 0xBD, 0x1C, 0x7A, 0x84, 0x1A, 0x1D, 0x7E, 0x20,
+    0xD0, 0xE0, 0xD0, 0xFC, 0x50, 0xEF, 0xF0, 0x02, 0x38, 0x36, 0x4C, 0x2E, 0x78, 0x9C, 0xA5, 0x91,
+    0xED, 0x0D, 0x01, 0x41, 0x14, 0x45, 0xC7, 0xE7, 0x6E, 0x08, 0x32, 0x15, 0x58, 0x15, 0xD0, 0x01,
+    0x1D, 0xD8, 0x0E, 0xE8, 0x80, 0x0E, 0x6C, 0x07, 0x74, 0x40, 0x07, 0xB6, 0x03, 0x3A, 0xA0, 0x03,
+    0x3A, 0x60, 0x13, 0xC9, 0x86, 0xE0, 0x9A, 0x3B, 0x1F, 0xBB, 0xF6, 0xF7, 0xDE, 0x1F, 0x93, 0x39,
+    0x37, 0x99, 0xCC, 0xC9, 0x7B, 0x42, 0xA8, 0x3C, 0x00, 0x21, 0x12, 0xA0, 0x2A, 0x4C, 0x52, 0x5C,
+    0x6C, 0x69, 0xF2, 0xC2, 0x9E, 0xE5, 0xC9, 0xF1, 0x07, 0x2B, 0x96, 0x5B, 0xC7, 0xC0, 0x94, 0xE5,
+    0xC2, 0xE2, 0x08, 0xE8, 0xB3, 0x1C, 0x5B, 0x9E, 0x03, 0x5D, 0x96, 0x3D, 0xCB, 0x1B, 0xA0, 0xCD,
+    0xB2, 0x63, 0xF9, 0x0C, 0xF8, 0x2C, 0x5B, 0x96, 0xEF, 0x40, 0x83, 0xA5, 0xA7, 0xEE, 0x01, 0x0A,
+    0xA9, 0x95, 0x65, 0x21, 0xE5, 0x40, 0xE9, 0x4A, 0x09, 0xCC, 0xA4, 0x94, 0xFC, 0x6E, 0x42, 0xB3,
+    0x40, 0x3B, 0xEB, 0x2C, 0x69, 0xA6, 0x9D, 0x4D, 0x76, 0x34, 0xD3, 0xCE, 0x99, 0xAE, 0x27, 0x8E,
+    0x74, 0xCE, 0x74, 0xEB, 0xC6, 0x59, 0xE5, 0x5B, 0xF8, 0xCE, 0x2F, 0xCD, 0x7A, 0x9A, 0x43, 0xEA,
+    0xB9, 0x69, 0x86, 0x34, 0x0B, 0xF3, 0x69, 0x46, 0x34, 0x8B, 0xF2, 0x69, 0xC6, 0x7C, 0x16, 0xE7,
+    0xD3, 0xBC, 0x02, 0x4D, 0x1E, 0x9E, 0xE5, 0x84, 0x53, 0x48, 0xE8, 0x6C, 0xA2, 0xF7, 0xAC, 0x8E,
+    0xCA, 0xFF, 0xF2, 0x53, 0xDC, 0xDC, 0x72, 0x9F, 0x5C, 0xFE, 0x0B, 0x07, 0xC7, 0x6F, 0x2E, 0xFF,
+    0x83, 0xB5, 0xA1, 0x1F, 0x66, 0xC1, 0x15, 0xBF, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x82, 0xAF, 0xFF,
+    0x19, 0x10, 0x80, 0x28, 0x4E, 0xC0, 0xCE, 0x7F, 0xFF, 0xEF, 0xAF, 0x71, 0x07, 0xB3, 0x17, 0xFD,
+    0x87, 0x80, 0xFD, 0xAC, 0x0C, 0x0C, 0x0D, 0xFF, 0x61, 0xE0, 0x3D, 0x03, 0xC3, 0x6F, 0x38, 0x67,
+    0x3E, 0x92, 0xC4, 0x7F, 0x7D, 0x86, 0x4F, 0x08, 0x0E, 0x0F, 0xC3, 0x0F, 0x20, 0x59, 0xFB, 0xE3,
+    0xBF, 0xD3, 0xB4, 0xBF, 0xFF, 0x59, 0x41, 0x5A, 0xEE, 0x83, 0xED, 0x51, 0x38, 0xCE, 0xC0, 0xF0,
+    0xF7, 0xFF, 0xFF, 0x7E, 0xB8, 0xA5, 0x7F, 0x80, 0x16, 0xC0, 0x39, 0xBF, 0x80, 0x7A, 0xD8, 0x60,
+    0x9C, 0xAF, 0x40, 0xCE, 0xF9, 0x9F, 0x50, 0xCE, 0x03, 0x88, 0xB1, 0x10, 0x8E, 0x03, 0x84, 0x63,
+    0x05, 0xE1, 0x7D, 0x83, 0xF0, 0x72, 0x21, 0x52, 0xFF, 0x20, 0xBC, 0x3C, 0x30, 0x6F, 0x22, 0xD4,
+    0x35, 0xB6, 0x60, 0x5E, 0x23, 0x54, 0x8E, 0x15, 0xCC, 0x4B, 0xF8, 0x03, 0xE6, 0xD8, 0x23, 0x2C,
+    0x03, 0xB9, 0x11, 0xCA, 0xB9, 0x0A, 0xE2, 0x31, 0xC3, 0x42, 0x07, 0xE4, 0x2C, 0x76, 0x18, 0xE7,
+    0x02, 0x90, 0xC3, 0xC9, 0x02, 0xE5, 0x1C, 0x00, 0x71, 0xDE, 0x58, 0x40, 0x38, 0x1F, 0x41, 0xCA,
+    0xFE, 0xFC, 0x5F, 0xA7, 0x06, 0xE4, 0x04, 0xFC, 0x05, 0x19, 0x00, 0xB2, 0xE2, 0xFE, 0x5F, 0xA8,
+    0xD1, 0x7F, 0x10, 0xA1, 0xE3, 0x8F, 0xCC, 0x61, 0x47, 0xE2, 0xC4, 0xC1, 0xDD, 0xF5, 0xFF, 0x7F,
+    0x1F, 0x23, 0xC8, 0x92, 0x92, 0x53, 0x6F, 0xFF, 0xFF, 0xDF, 0xEB, 0x41, 0x5A, 0x34, 0xE2, 0xE0,
+    0x00, 0x00, 0xFE, 0x36, 0x0C, 0xDB, 0x78, 0x9C, 0x65, 0x52, 0x3B, 0x52, 0x02, 0x51, 0x10, 0x1C,
+    0x54, 0x44, 0xC5, 0x0F, 0xB9, 0x65, 0x49, 0x19, 0xFB, 0xAB, 0x32, 0xB6, 0x20, 0x36, 0x91, 0xD8,
+    0x04, 0x6F, 0x20, 0x37, 0xD0, 0x1B, 0xE8, 0x0D, 0x24, 0xD0, 0xD0, 0x12, 0x4F, 0x00, 0x37, 0x00,
+    0x25, 0x33, 0x59, 0xCA, 0x0B, 0xA0, 0x20, 0xA2, 0xF2, 0x69, 0xA7, 0x67, 0x96, 0x2D, 0x5C, 0x26,
+    0x79, 0xBD, 0x3D, 0x3B, 0x9F, 0x9E, 0x19, 0x91, 0xC2, 0x2B, 0x1E, 0x16, 0xC4, 0x6D, 0x04, 0x24,
+    0x0C, 0x1C, 0x2A, 0x42, 0xD5, 0xF1, 0x39, 0x70, 0xE9, 0xEE, 0x37, 0xD0, 0xB6, 0x0C, 0xB7, 0x80,
+    0x75, 0x67, 0x87, 0xC6, 0x3E, 0x1A, 0xEE, 0x03, 0x49, 0x03, 0x05, 0xB8, 0x31, 0x73, 0x06, 0x08,
+    0xFC, 0xD7, 0x8A, 0xA2, 0x23, 0x4D, 0xBD, 0xA2, 0xF8, 0x06, 0x38, 0x75, 0xF6, 0x9D, 0xE8, 0x13,
+    0xD8, 0x50, 0xDC, 0x01, 0xD2, 0xCE, 0x76, 0x48, 0xA8, 0xEB, 0x40, 0xF1, 0x00, 0x98, 0x73, 0xB6,
+    0x07, 0xAC, 0x49, 0x0D, 0x28, 0x6A, 0x8F, 0xC0, 0x6D, 0xD8, 0xF7, 0x17, 0xA3, 0x34, 0xF9, 0x85,
+    0xD0, 0xB7, 0x1D, 0xB2, 0x7D, 0xB2, 0x65, 0xEB, 0x5E, 0xC3, 0x96, 0x66, 0xD9, 0x11, 0xDA, 0x32,
+    0x93, 0xA1, 0x64, 0x69, 0xE2, 0xD5, 0x5A, 0x44, 0xF2, 0xBF, 0xB3, 0x9C, 0x7C, 0x53, 0xEE, 0xFD,
+    0x28, 0x38, 0x99, 0x56, 0xA1, 0x72, 0xEB, 0xD2, 0xA4, 0xF8, 0x4D, 0x61, 0xA1, 0x60, 0x47, 0x15,
+    0xA7, 0x15, 0xE4, 0xB2, 0x63, 0xB2, 0x41, 0x82, 0xAD, 0x9B, 0x25, 0xBB, 0x3A, 0x8B, 0x9A, 0x63,
+    0x9D, 0xC9, 0xAF, 0x81, 0xBA, 0xC9, 0xED, 0x39, 0xAB, 0x23, 0x7A, 0x36, 0xB0, 0x9F, 0xA7, 0x5C,
+    0xF5, 0x1C, 0x37, 0x6D, 0xD8, 0x99, 0x01, 0x7F, 0x9D, 0x6B, 0x50, 0x2E, 0xE7, 0xAC, 0x6E, 0x68,
+    0x17, 0x79, 0xDD, 0x66, 0x92, 0x6A, 0x52, 0x59, 0x23, 0x10, 0x4D, 0x4E, 0x64, 0xAC, 0x72, 0x0B,
+    0xB6, 0x8B, 0xE1, 0x64, 0x4D, 0x42, 0xB9, 0x45, 0xAE, 0xB8, 0x6A, 0x53, 0x5E, 0x0C, 0xD9, 0x0F,
+    0xCA, 0x2D, 0x19, 0xAB, 0x4D, 0xA5, 0x42, 0xF6, 0x87, 0xFB, 0x8C, 0xB3, 0x59, 0xFB, 0x8E, 0x67,
+    0xA8, 0xD8, 0xE2, 0xE2, 0xD5, 0x54, 0xEE, 0xB2, 0x45, 0x78, 0x67, 0xF3, 0xD1, 0x01, 0xF1, 0xD2,
+    0xA6, 0x54, 0xF8, 0x01, 0x5D, 0xF3, 0xD5, 0x42, 0x7B, 0x2F, 0x96, 0x9C, 0xD6, 0x08, 0xAF, 0xAE,
+    0xEB, 0xD3, 0x29, 0x46, 0xCB, 0xB3, 0xB2, 0x65, 0x67, 0x57, 0x27, 0x72, 0xFD, 0xEA, 0x32, 0xBC,
+    0x65, 0xB4, 0x7D, 0x0C, 0x57, 0x51, 0xD0, 0x13, 0xD9, 0xDD, 0x48, 0x6E, 0x18, 0x24, 0x77, 0xA3,
+    0xE0, 0x4C, 0x9F, 0x3F, 0x0C, 0x5D, 0x6D, 0x8F, 0x78, 0x9C, 0x4D, 0x92, 0x3B, 0x4E, 0xC3, 0x40,
+    0x10, 0x86, 0xFF, 0x10, 0x20, 0x3C, 0x22, 0x94, 0x0B, 0x44, 0xE1, 0x04, 0x88, 0x1A, 0x09, 0xE1,
+    0x82, 0x3E, 0xB9, 0x41, 0x90, 0xA0, 0xA3, 0x00, 0xD1, 0x46, 0x51, 0xA0, 0xA6, 0xE0, 0x08, 0x1C,
+    0x21, 0x88, 0x8A, 0x12, 0x2E, 0x00, 0x88, 0x16, 0x09, 0x47, 0x82, 0x0A, 0x09, 0xA5, 0xE1, 0x1D,
+    0xE2, 0x61, 0x5E, 0xBB, 0xEB, 0x29, 0xC6, 0xEB, 0xCF, 0x33, 0xFF, 0xCE, 0xBF, 0x5E, 0x00, 0x38,
+    0x7A, 0x2C, 0xF2, 0xDE, 0x0C, 0x52, 0x5C, 0x92, 0xC4, 0xB0, 0x12, 0x41, 0x87, 0x2C, 0xB6, 0x22,
+    0xF9, 0x70, 0x42, 0xA1, 0xAF, 0x51, 0x04, 0xB2, 0xEC, 0xE4, 0x50, 0x5E, 0x6E, 0x05, 0xB7, 0x9C,
+    0x5C, 0xF3, 0x7A, 0x13, 0x3B, 0x9C, 0xBB, 0x4E, 0x46, 0xBC, 0xAE, 0x02, 0xBF, 0x44, 0x83, 0x12,
+    0xE1, 0xC7, 0x27, 0xD1, 0x81, 0x93, 0x7B, 0x23, 0xDF, 0x44, 0x6D, 0x27, 0x17, 0x4C, 0xE6, 0x74,
+    0xC7, 0xA0, 0x2C, 0x9A, 0x75, 0xDC, 0x70, 0x5E, 0x0A, 0xF3, 0xF0, 0x7A, 0x90, 0x15, 0xA5, 0x09,
+    0x45, 0x81, 0xFE, 0x28, 0x09, 0x9B, 0xB4, 0xC4, 0x42, 0x24, 0xEB, 0x06, 0x52, 0x09, 0x20, 0x2D,
+    0x94, 0x57, 0x13, 0x78, 0x49, 0x36, 0xA7, 0x44, 0x63, 0xE0, 0xD8, 0x9A, 0xBA, 0xDE, 0x7F, 0x0E,
+    0xFC, 0xB8, 0xF0, 0xBC, 0x7D, 0x6C, 0xEB, 0x80, 0x1A, 0x67, 0x66, 0x71, 0x45, 0xF3, 0x78, 0x57,
+    0xD0, 0xA2, 0xB8, 0xA5, 0x9A, 0xE6, 0x35, 0x3D, 0xD9, 0xA1, 0x08, 0x53, 0x05, 0x13, 0x35, 0x9A,
+    0x49, 0x51, 0xCF, 0x84, 0x0B, 0x3B, 0x8C, 0x67, 0x57, 0x63, 0xFF, 0x32, 0x1C, 0x93, 0x55, 0x3F,
+    0xFF, 0x9A, 0x12, 0xA9, 0xC1, 0x83, 0x82, 0xDC, 0xC6, 0x94, 0x51, 0xD0, 0x98, 0x86, 0xBF, 0x38,
+    0x09, 0x26, 0xBF, 0xBC, 0x49, 0x77, 0xA7, 0xFE, 0xF6, 0xDE, 0x6B, 0x74, 0x37, 0xA2, 0x72, 0xDC,
+    0x95, 0xEE, 0x81, 0x47, 0x3D, 0xB4, 0xA5, 0x22, 0xBE, 0x33, 0x9D, 0x78, 0x13, 0xF6, 0x25, 0x35,
+    0xB9, 0xE8, 0xC4, 0xD1, 0x06, 0xDE, 0x65, 0x22, 0xB9, 0x58, 0xD9, 0xD5, 0x1B, 0x3D, 0x9D, 0xCE,
+    0xC2, 0xDC, 0x35, 0xFF, 0x01, 0x3E, 0xD2, 0x5E, 0xFB, 0x78, 0x9C, 0x0D, 0xC3, 0xDB, 0x0D, 0x40,
+    0x30, 0x00, 0x00, 0xC0, 0x68, 0x14, 0xF1, 0x88, 0xFD, 0xB7, 0x31, 0x82, 0x51, 0x54, 0x68, 0x85,
+    0x8F, 0xD3, 0x4B, 0xEE, 0x63, 0x7D, 0xEB, 0x87, 0xA5, 0x30, 0x67, 0xA6, 0x9B, 0xF1, 0x62, 0x38,
+    0xE9, 0x13, 0xDD, 0x41, 0xAC, 0xDB, 0x9D, 0xB0, 0xD1, 0xFC, 0x19, 0x10, 0x26, 0x6A, 0x78, 0x9C,
+    0x75, 0x90, 0xD9, 0x11, 0x41, 0x51, 0x10, 0x44, 0xBB, 0xA8, 0xB2, 0x3C, 0x8A, 0x10, 0x84, 0x40,
+    0x06, 0x64, 0x40, 0x06, 0x42, 0x20, 0x03, 0x42, 0x90, 0x09, 0x19, 0x90, 0x01, 0x21, 0x10, 0x81,
+    0xB2, 0x95, 0xDD, 0xD1, 0xCF, 0x3C, 0xFE, 0x7C, 0x9D, 0xBA, 0x33, 0xD3, 0x3D, 0x3D, 0x57, 0xD2,
+    0x06, 0x9A, 0x92, 0x1E, 0x50, 0x94, 0x86, 0xB0, 0xF4, 0x63, 0x0F, 0x5D, 0xE3, 0x0E, 0x15, 0xA9,
+    0x05, 0xE4, 0xA5, 0xD9, 0xAF, 0xD5, 0x37, 0x2E, 0x50, 0x33, 0x5E, 0x50, 0x96, 0x3A, 0x31, 0x31,
+    0x36, 0x5C, 0x5B, 0xC1, 0xDC, 0xD8, 0xC1, 0xC8, 0x38, 0x86, 0xD5, 0x19, 0x1A, 0xC6, 0x35, 0x64,
+    0x36, 0xAE, 0x1A, 0x4F, 0x48, 0x7E, 0x26, 0xB2, 0xBA, 0xF4, 0x0F, 0xD9, 0x48, 0x26, 0x78, 0x84,
+    0xFC, 0x16, 0x66, 0x8E, 0x52, 0x37, 0x4E, 0xD0, 0x8E, 0xB5, 0x03, 0x63, 0x0D, 0x53, 0x63, 0x02,
+    0x5B, 0xA3, 0x17, 0x01, 0xBF, 0x6E, 0x99, 0xF0, 0x10, 0xD1, 0x16, 0x91, 0x37, 0x3D, 0x22, 0x17,
+    0xE6, 0x49, 0x34, 0x53, 0xBB, 0x71, 0x5C, 0x9D, 0x56, 0x0B, 0xFA, 0x7C, 0x56, 0xE3, 0x0D, 0xB0,
+    0x8D, 0x8B, 0x55, 0x78, 0x9C, 0x65, 0xD0, 0xDB, 0x0D, 0x41, 0x41, 0x14, 0x85, 0xE1, 0x09, 0x82,
+    0xB8, 0x44, 0x07, 0x94, 0x40, 0x07, 0x74, 0xA0, 0x14, 0x3A, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A,
+    0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x1C, 0xC7, 0x25, 0xE1, 0xE4, 0xB7, 0x62, 0x4D, 0x8E, 0x07, 0x4F,
+    0x5F, 0x32, 0x7B, 0xF6, 0x9E, 0xB5, 0xE7, 0x0A, 0xED, 0x10, 0xC2, 0x14, 0x36, 0x22, 0x64, 0x50,
+    0x16, 0x37, 0xE8, 0x88, 0x2D, 0xAC, 0xC4, 0x00, 0x28, 0xB8, 0x58, 0x13, 0x77, 0x17, 0xCF, 0x30,
+    0x11, 0x4B, 0x38, 0xC4, 0x3B, 0x45, 0x29, 0x2A, 0xE2, 0x0D, 0x0D, 0xF1, 0x84, 0x96, 0xC7, 0xF5,
+    0x45, 0x02, 0x23, 0x37, 0xCE, 0xC4, 0xDE, 0xC3, 0xD7, 0xB0, 0xFB, 0x8D, 0x99, 0xE7, 0x9C, 0xFE,
+    0x88, 0x57, 0x62, 0x43, 0x6C, 0x3F, 0xC2, 0x42, 0x5C, 0x1C, 0x26, 0x85, 0xA1, 0x78, 0xF8, 0xD9,
+    0x17, 0x34, 0x1D, 0xA9, 0xEA, 0x80, 0xA5, 0x7C, 0x56, 0x6C, 0x53, 0xB0, 0xAE, 0xD3, 0xD6, 0x43,
+    0xE8, 0x79, 0x85, 0xB5, 0xBF, 0x22, 0x75, 0x29, 0xFB, 0xEE, 0x33, 0xF6, 0x59, 0xE2, 0xCF, 0xFA,
+    0x00, 0x7C, 0x64, 0x8F, 0xD5, 0x78, 0x9C, 0x5D, 0x8F, 0x41, 0x0A, 0x41, 0x51, 0x14, 0x86, 0x4F,
+    0x7A, 0x92, 0x28, 0x46, 0x86, 0xB2, 0x03, 0x76, 0xC0, 0x0E, 0xD8, 0x80, 0x18, 0x1B, 0x20, 0x73,
+    0xA5, 0x18, 0x29, 0xB1, 0x0D, 0x23, 0x16, 0xA0, 0x2C, 0xC0, 0x80, 0x15, 0x10, 0x33, 0x33, 0x91,
+    0xA2, 0x8B, 0xCF, 0xB9, 0x8F, 0x77, 0xBD, 0x9C, 0xC1, 0x39, 0xFF, 0xD7, 0x3D, 0xF7, 0xBF, 0xF7,
+    0x17, 0x11, 0xE9, 0xC1, 0x52, 0x82, 0xAA, 0xC3, 0xCC, 0x41, 0x05, 0xC6, 0x0E, 0x0A, 0xD0, 0x72,
+    0x90, 0x86, 0xB2, 0x03, 0x81, 0xFC, 0x67, 0x3F, 0xA3, 0xED, 0x49, 0x4A, 0xFB, 0x40, 0xE6, 0x8C,
+    0x3C, 0x31, 0x0A, 0x1D, 0x83, 0x6C, 0x80, 0x86, 0xA1, 0x7A, 0xD4, 0x19, 0x39, 0xF1, 0x2B, 0xEF,
+    0x1C, 0x82, 0xD8, 0x35, 0x04, 0xF1, 0xFE, 0x74, 0xF5, 0xF2, 0xD5, 0x76, 0x31, 0x8C, 0x5A, 0xFB,
+    0xBB, 0xEA, 0xE4, 0xF7, 0xC9, 0x92, 0x3D, 0x08, 0x3E, 0x77, 0x00, 0xDD, 0xF4, 0x3E, 0xF0, 0x80,
+    0x0B, 0x64, 0x7D, 0x3D, 0xD1, 0x34, 0x1A, 0x6F, 0xED, 0x83, 0x9A, 0x17, 0xD3, 0xD6, 0x58, 0x75,
+    0x4E, 0x67, 0x42, 0x6E, 0x50, 0xB3, 0x60, 0xEC, 0xE5, 0x3D, 0x54, 0xFD, 0x9C, 0x66, 0x27, 0xD2,
+    0xA6, 0xF9, 0x4D, 0xDD, 0xD0, 0xD6, 0x95, 0xFF, 0x7A, 0x03, 0x60, 0x1D, 0x85, 0xAE, 0x78, 0x9C,
+    0x63, 0x60, 0x60, 0x60, 0x30, 0xE8, 0xE8, 0x60, 0x67, 0x80, 0x81, 0x84, 0xFF, 0xFF, 0xF9, 0xE9,
+    0xCA, 0xF9, 0xFB, 0x1F, 0x01, 0xD8, 0xC8, 0xE1, 0x84, 0x84, 0x86, 0x86, 0x4E, 0xFD, 0xFF, 0x3F,
+    0x1E, 0x48, 0x85, 0x32, 0xD1, 0xD3, 0x0B, 0x0E, 0xBB, 0x77, 0x73, 0x83, 0x19, 0x00, 0x59, 0xDD,
+    0x6D, 0xB9, 0x78, 0x9C, 0x15, 0xC9, 0xC1, 0x0D, 0x40, 0x30, 0x00, 0x40, 0xD1, 0x8F, 0x93, 0x8B,
+    0xAE, 0x62, 0x13, 0xA3, 0xD4, 0x48, 0x36, 0x30, 0x52, 0xBB, 0x81, 0x10, 0xD2, 0x44, 0x22, 0xBF,
+    0x75, 0x79, 0x97, 0xC7, 0xA9, 0x76, 0xDC, 0x7A, 0x40, 0xD1, 0x1D, 0x5E, 0x5D, 0xE0, 0xD3, 0x09,
+    0x5A, 0x8E, 0xCC, 0xCD, 0x81, 0x55, 0x13, 0x6C, 0x1A, 0x21, 0x6B, 0x80, 0xEB, 0x4F, 0x1E, 0xED,
+    0xA1, 0x02, 0xF8, 0x01, 0x27, 0x30, 0x78, 0x9C, 0xFB, 0xF1, 0x1F, 0x04, 0xE6, 0xFF, 0x20, 0x4C,
+    0x09, 0x08, 0x82, 0x00, 0x23, 0x00, 0x6B, 0xFA, 0x27, 0xD3, 0x78, 0x9C, 0x63, 0x10, 0x70, 0x66,
+    0x62, 0x60, 0xF8, 0xF5, 0xFF, 0x3C, 0xE3, 0x84, 0xFF, 0xFF, 0xFF, 0xF3, 0x7E, 0x00, 0x12, 0xF6,
+    0x1F, 0x81, 0x44, 0x3E, 0x88, 0x88, 0xBF, 0x00, 0x24, 0xF4, 0x03, 0x80, 0x04, 0x27, 0xC3, 0x91,
+    0xFF, 0xB5, 0x0C, 0x00, 0x71, 0xF1, 0x1D, 0x21, 0x78, 0x9C, 0x7D, 0xD0, 0xD9, 0x11, 0x41, 0x41,
+    0x10, 0x46, 0xE1, 0xB1, 0xEF, 0x4B, 0x06, 0x64, 0x40, 0x06, 0x64, 0x40, 0x06, 0x64, 0x40, 0x06,
+    0x64, 0x70, 0x65, 0x40, 0x06, 0x64, 0x40, 0x06, 0x64, 0x40, 0x06, 0xF6, 0x7D, 0x39, 0x9A, 0x6E,
+    0x6E, 0x79, 0x31, 0x4F, 0x5F, 0xD5, 0x9C, 0xA9, 0xA9, 0xFA, 0x9D, 0x7B, 0x9D, 0x2E, 0x10, 0x7A,
+    0xCB, 0x2D, 0x60, 0xAE, 0x72, 0x3B, 0xE8, 0x18, 0x2F, 0x50, 0x30, 0x4A, 0x9A, 0x52, 0x35, 0x85,
+    0x11, 0xE5, 0x44, 0x68, 0xF7, 0x1B, 0x18, 0x1A, 0x4F, 0x50, 0x33, 0xDE, 0x21, 0xAB, 0x2A, 0x4B,
+    0x1A, 0x57, 0xF6, 0x84, 0x41, 0xE5, 0x0A, 0xA6, 0x96, 0xEE, 0xA1, 0x65, 0xBC, 0x7E, 0xBF, 0xCD,
+    0x4B, 0x9A, 0x54, 0xB6, 0x85, 0x61, 0xE5, 0x0C, 0x96, 0x96, 0x6E, 0xA1, 0x6F, 0x3C, 0x43, 0xC5,
+    0xF8, 0x80, 0x8C, 0xAA, 0x2A, 0xAF, 0x62, 0xCA, 0x81, 0x30, 0xA0, 0x5C, 0xC3, 0xD8, 0xD2, 0x03,
+    0x34, 0x8C, 0x37, 0xC8, 0xA9, 0x8A, 0x92, 0x26, 0xDC, 0xFF, 0x8D, 0x3C, 0x7F, 0xA3, 0x92, 0xBF,
+    0x51, 0x5A, 0x55, 0x17, 0x46, 0x95, 0xA3, 0x9F, 0x6F, 0x3F, 0x1B, 0x1D, 0xFD, 0x8D, 0x9E, 0xCF,
+    0xC4, 0x79, 0xCC, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x68, 0x7E, 0xFD, 0xFF, 0x5C, 0x24, 0x03,
+    0x04, 0x1C, 0xFE, 0x0F, 0x02, 0x71, 0x60, 0x76, 0xC2, 0x7F, 0x08, 0xE0, 0x02, 0x71, 0xBE, 0x41,
+    0x39, 0xFB, 0x81, 0x6C, 0x83, 0xFF, 0x30, 0xC0, 0xC1, 0xC0, 0x70, 0x00, 0xCE, 0xD1, 0x67, 0x60,
+    0xF8, 0x02, 0xA4, 0xFA, 0x95, 0xAF, 0x02, 0xC9, 0xF5, 0x0C, 0x0C, 0xBF, 0x81, 0x14, 0x0B, 0x03,
+    0xC3, 0x1F, 0x20, 0xC5, 0xC8, 0x00, 0x11, 0x62, 0xF8, 0x04, 0xA4, 0xD9, 0x1D, 0x80, 0x84, 0x3D,
+    0x03, 0x44, 0x2B, 0x4F, 0x03, 0x90, 0xE0, 0x07, 0x72, 0x0A, 0x40, 0xF4, 0x06, 0x90, 0x08, 0x90,
+    0x03, 0x56, 0x71, 0x01, 0x48, 0x70, 0x02, 0x39, 0x02, 0x40, 0x3A, 0xFF, 0x03, 0xC4, 0x36, 0x06,
+    0x90, 0x41, 0xFD, 0x20, 0x0E, 0x1B, 0x88, 0xF3, 0xEF, 0xFF, 0xFF, 0xF9, 0x1F, 0x81, 0x1C, 0x56,
+    0x10, 0xE7, 0x2F, 0xD0, 0x8A, 0x4F, 0x30, 0x0E, 0xD0, 0xD6, 0xFD, 0x9F, 0x20, 0x0E, 0x00, 0x73,
+    0xCE, 0x63, 0x70, 0xE0, 0xCA, 0x90, 0x0D, 0xD8, 0x8F, 0x6C, 0xF4, 0x7A, 0x10, 0x87, 0x1D, 0x66,
+    0x29, 0x8A, 0x73, 0x16, 0x00, 0x09, 0x6E, 0x68, 0x50, 0xF8, 0x83, 0x9C, 0xCE, 0x07, 0xF5, 0x82,
+    0xBC, 0x01, 0xD4, 0x73, 0x20, 0xAF, 0xF0, 0x82, 0x1D, 0x08, 0xF5, 0x36, 0x27, 0xC3, 0x4F, 0x44,
+    0x80, 0xB0, 0x80, 0x85, 0xEA, 0x85, 0x8E, 0x00, 0xC9, 0xFB, 0x0C, 0x0C, 0x0B, 0xE0, 0x81, 0x18,
+    0x0F, 0xB4, 0xE0, 0x1F, 0x8C, 0x03, 0x0A, 0x8A, 0xCF, 0x50, 0xF6, 0x7B, 0x46, 0x50, 0xB8, 0x40,
+    0xA5, 0x74, 0xC1, 0x11, 0xB4, 0x10, 0xCC, 0xEE, 0x87, 0x46, 0x5D, 0xD1, 0xEB, 0xFF, 0xF7, 0xB3,
+    0x40, 0x8A, 0x00, 0x3C, 0x37, 0x11, 0x26, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x02, 0x87, 0x7F, 0xFF,
+    0xFF, 0x73, 0x81, 0x18, 0x0C, 0xDF, 0xFE, 0x43, 0x59, 0x0B, 0xFE, 0x43, 0x59, 0x02, 0x7F, 0x60,
+    0xAC, 0xC7, 0xFF, 0xA1, 0xAC, 0x84, 0xFF, 0x30, 0xD6, 0x4F, 0x18, 0xEB, 0xE0, 0x7F, 0x28, 0xCB,
+    0x00, 0x68, 0xD4, 0xFF, 0xDD, 0x20, 0xD6, 0x01, 0x20, 0xB1, 0x7F, 0x03, 0x88, 0x25, 0x00, 0x14,
+    0xE3, 0x3C, 0x00, 0x56, 0xF7, 0xF9, 0x7F, 0x3E, 0x03, 0x84, 0x95, 0xF0, 0x9E, 0x99, 0xE1, 0x02,
+    0xC4, 0x14, 0x71, 0x06, 0x18, 0x0B, 0x08, 0x1E, 0x0C, 0x4F, 0x16, 0x00, 0x43, 0x49, 0xA8, 0x1E,
+    0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x98, 0xFA, 0xFA, 0xFF, 0xFB, 0x6E, 0x66, 0x06, 0x10, 0x50,
+    0xF8, 0xF9, 0x1F, 0x04, 0xCE, 0xB3, 0x80, 0x38, 0x10, 0xF6, 0xFF, 0xFF, 0xF3, 0x81, 0xEC, 0xC7,
+    0xFF, 0x61, 0x80, 0x8B, 0x21, 0x01, 0xCE, 0xFE, 0x9F, 0xCF, 0xB0, 0x01, 0xC1, 0x79, 0xCF, 0x28,
+    0xF0, 0x17, 0x48, 0x55, 0x87, 0x5E, 0x07, 0xF1, 0xD8, 0x18, 0x1E, 0xFD, 0xFF, 0x2F, 0x09, 0x35,
+    0x86, 0x9B, 0xC1, 0xE0, 0xBF, 0x0E, 0xC8, 0xCC, 0x07, 0x40, 0x0E, 0x2F, 0x03, 0xC3, 0x34, 0xB0,
+    0x6D, 0x0B, 0x80, 0x1C, 0x3E, 0x06, 0x28, 0x98, 0x00, 0x91, 0x61, 0x80, 0xCB, 0xF0, 0xC0, 0x38,
+    0x17, 0x80, 0x1C, 0x4E, 0x18, 0xE7, 0x33, 0x90, 0xC3, 0x02, 0xE3, 0xFC, 0x06, 0x5A, 0x0A, 0x63,
+    0x27, 0x80, 0x9D, 0x03, 0x05, 0x9F, 0x90, 0x0C, 0x13, 0xF8, 0x07, 0xE4, 0x30, 0x43, 0x39, 0x17,
+    0x81, 0xEC, 0x7A, 0x98, 0xAA, 0x3F, 0x60, 0xEF, 0x40, 0xC0, 0x01, 0x20, 0x7B, 0x3D, 0x92, 0xB9,
+    0x40, 0x27, 0x43, 0xC0, 0x06, 0x74, 0x09, 0x2E, 0x24, 0x89, 0xF9, 0xC8, 0x12, 0x1C, 0x48, 0x12,
+    0xF9, 0xC8, 0x12, 0xAC, 0x48, 0x12, 0xFE, 0xC8, 0x12, 0x51, 0xA1, 0x10, 0x80, 0x14, 0x88, 0xFF,
+    0xFF, 0x7F, 0xA0, 0x94, 0x03, 0x00, 0x76, 0xD4, 0xED, 0xED, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x48,
+    0x3A, 0xF9, 0xF6, 0xFF, 0xB9, 0x2C, 0x46, 0x06, 0x10, 0x38, 0xF6, 0x1F, 0x0C, 0xF6, 0x33, 0x03,
+    0xD9, 0xCF, 0xFE, 0x43, 0xC1, 0x7C, 0x06, 0x86, 0x0D, 0xFF, 0xE1, 0x80, 0x9B, 0x21, 0x01, 0xC1,
+    0xA9, 0x67, 0x60, 0xF8, 0x0D, 0xE7, 0xBC, 0x67, 0x60, 0xF8, 0xF8, 0xFF, 0x7F, 0xB5, 0xB2, 0xD1,
+    0x75, 0x10, 0x8F, 0x05, 0xA8, 0x4E, 0x02, 0x64, 0xE6, 0x1F, 0x20, 0x87, 0x9D, 0x81, 0x41, 0x03,
+    0x6C, 0xC1, 0x27, 0x20, 0x87, 0x83, 0x01, 0x0A, 0x1E, 0x40, 0x64, 0x10, 0x1C, 0x56, 0x18, 0xE7,
+    0x03, 0x90, 0xC3, 0x08, 0xE3, 0x7C, 0xFB, 0xFF, 0x7F, 0x3D, 0x8C, 0x1D, 0x00, 0x94, 0x90, 0x83,
+    0x30, 0x05, 0x8A, 0xFF, 0x80, 0xAD, 0x01, 0x82, 0x9F, 0x10, 0x07, 0xD8, 0x32, 0x20, 0x38, 0x75,
+    0x0C, 0x08, 0x4E, 0x3F, 0x13, 0x12, 0xE7, 0xFF, 0x7B, 0x4D, 0x24, 0x0E, 0xD4, 0x35, 0xC7, 0xCF,
+    0xBC, 0x85, 0x78, 0x1C, 0x6A, 0x8D, 0xC2, 0xD6, 0xFF, 0xC8, 0x0E, 0xFD, 0x0A, 0xE4, 0xC8, 0xC3,
+    0x38, 0x0B, 0x80, 0x9C, 0x78, 0x64, 0xF7, 0xF4, 0x23, 0x73, 0xE6, 0xC3, 0x38, 0x05, 0x20, 0x19,
+    0x01, 0x28, 0xE7, 0x02, 0x90, 0x93, 0xFF, 0xD1, 0x0B, 0xC2, 0xF9, 0x05, 0xE4, 0xE8, 0x7F, 0xFC,
+    0xBF, 0xCE, 0x8C, 0x91, 0xC1, 0xF1, 0x05, 0xC8, 0x1E, 0xDE, 0x8F, 0x88, 0x10, 0xFD, 0xCF, 0x82,
+    0xC4, 0x59, 0xCF, 0x80, 0xC4, 0xE1, 0x42, 0xE2, 0x00, 0xC3, 0xDD, 0xE1, 0x17, 0x94, 0xDD, 0x07,
+    0x0E, 0xA8, 0xE2, 0x53, 0xEF, 0xFE, 0xBF, 0x5B, 0x63, 0x0E, 0x62, 0x02, 0x00, 0xE5, 0x4A, 0xEE,
+    0x80, 0x78, 0x9C, 0xAD, 0xD0, 0xC1, 0x09, 0x83, 0x40, 0x10, 0x85, 0xE1, 0x41, 0x12, 0x3C, 0x48,
+    0x5A, 0xB0, 0x85, 0x94, 0x62, 0x0B, 0x29, 0x21, 0x1D, 0x58, 0x82, 0x95, 0x04, 0x4B, 0xB0, 0x84,
+    0x25, 0x05, 0x58, 0x43, 0xC8, 0x1E, 0x75, 0xE3, 0xF8, 0xA2, 0xEC, 0x9B, 0xF1, 0x1A, 0x32, 0xA7,
+    0xF9, 0xE0, 0x87, 0x59, 0x56, 0x64, 0x9F, 0xA4, 0xDA, 0x4A, 0x9E, 0xBB, 0x7A, 0xC5, 0x83, 0x92,
+    0xD7, 0x37, 0x34, 0xC5, 0x83, 0x92, 0xD7, 0x16, 0x52, 0x08, 0x17, 0x53, 0xD2, 0x30, 0x51, 0x08,
+    0x9B, 0x99, 0x42, 0x58, 0xD9, 0xCB, 0xB0, 0x15, 0x14, 0xC2, 0x4E, 0x3E, 0x59, 0x08, 0x2F, 0x26,
+    0x44, 0x27, 0xC9, 0x17, 0x6E, 0xAA, 0xBD, 0x50, 0x08, 0x6B, 0x13, 0x2E, 0x9D, 0x29, 0x84, 0x83,
+    0x50, 0x08, 0xAF, 0x26, 0x84, 0x25, 0x85, 0x30, 0x08, 0xF5, 0x56, 0x37, 0x21, 0xFE, 0xA8, 0xE7,
+    0xB8, 0x0F, 0xF6, 0xD7, 0xF8, 0xC8, 0x7F, 0xB8, 0xF8, 0x9F, 0xFF, 0xAB, 0x56, 0x30, 0xAC, 0xF0,
+    0x4C, 0x78, 0x9C, 0x63, 0xF8, 0xF1, 0x1F, 0x0A, 0xEE, 0x33, 0x30, 0x30, 0xFC, 0x44, 0xE6, 0xFC,
+    0x42, 0xE6, 0xFC, 0x41, 0xE6, 0xFC, 0x45, 0xE6, 0xFC, 0x43, 0xE6, 0x00, 0xA9, 0xFA, 0x34, 0x10,
+    0x08, 0x83, 0x70, 0xF8, 0x19, 0xA0, 0x40, 0x01, 0xC8, 0xE1, 0x83, 0x71, 0x0C, 0x80, 0x1C, 0x5E,
+    0x18, 0xC7, 0x01, 0xC8, 0xE1, 0x86, 0x71, 0x02, 0x80, 0x1C, 0x2E, 0x18, 0x27, 0x01, 0xC8, 0xE1,
+    0x80, 0x71, 0x0A, 0x80, 0x9C, 0x3D, 0x7F, 0xFF, 0x9F, 0xF3, 0x00, 0x71, 0x26, 0xC0, 0xEC, 0xCC,
+    0x05, 0x72, 0x16, 0xC0, 0x38, 0x20, 0x9D, 0x1B, 0xE0, 0x9C, 0xFD, 0x0C, 0x0C, 0x07, 0xE0, 0x9C,
+    0xFF, 0x9C, 0x0C, 0x09, 0x70, 0x87, 0xFE, 0xD7, 0x67, 0x60, 0x68, 0x9C, 0xE3, 0x26, 0x64, 0xB4,
+    0x0D, 0xC4, 0x99, 0x0F, 0xB3, 0xE1, 0x32, 0xD4, 0x0F, 0x70, 0xF7, 0xFE, 0x67, 0x84, 0xF1, 0x40,
+    0xE1, 0xC2, 0x0C, 0xE3, 0x7C, 0x03, 0x72, 0x58, 0x60, 0x9C, 0xAF, 0xE8, 0x32, 0x4C, 0x30, 0x0E,
+    0x28, 0xF8, 0x18, 0x98, 0x10, 0xA6, 0x9D, 0x67, 0x78, 0xA9, 0x0E, 0xE6, 0x3C, 0x06, 0x72, 0xFA,
+    0x81, 0x46, 0xAE, 0x73, 0x57, 0x86, 0xB8, 0x40, 0x1E, 0x11, 0xEE, 0x20, 0x0F, 0x23, 0x38, 0xE7,
+    0x91, 0x62, 0xE4, 0xBF, 0x2C, 0x12, 0x07, 0xE4, 0xE6, 0x46, 0xA8, 0x7F, 0xD6, 0x83, 0xAD, 0x37,
+    0x58, 0xFE, 0xE6, 0xFF, 0xFB, 0xB3, 0x11, 0x60, 0x17, 0x03, 0x00, 0xD7, 0x3F, 0xF9, 0x16, 0x78,
+    0x9C, 0x4D, 0x90, 0x3D, 0x6E, 0x02, 0x41, 0x0C, 0x85, 0xDF, 0xF2, 0x27, 0x24, 0x40, 0xDA, 0x0B,
+    0x20, 0x21, 0x71, 0x01, 0x3A, 0x0A, 0x0A, 0x2E, 0x10, 0x09, 0xB8, 0x46, 0x9A, 0x44, 0xCA, 0x01,
+    0xC8, 0x01, 0x90, 0x36, 0x37, 0xC8, 0x11, 0xE0, 0x06, 0x50, 0x22, 0x0A, 0x28, 0xD2, 0x51, 0x64,
+    0xD3, 0xD2, 0x64, 0x13, 0x50, 0x7E, 0x88, 0x60, 0x1D, 0xBF, 0x59, 0x8F, 0x76, 0x5D, 0xCC, 0xBC,
+    0x4F, 0x33, 0xB6, 0x9F, 0x0D, 0x30, 0x1E, 0x36, 0xA9, 0x24, 0x37, 0x4E, 0x76, 0x0E, 0xC2, 0x98,
+    0x3A, 0x38, 0x4B, 0x0E, 0x2F, 0x92, 0x43, 0x4F, 0x0A, 0x70, 0xCC, 0xE4, 0xBB, 0x83, 0x8B, 0xAA,
+    0xB8, 0x1F, 0x20, 0xEC, 0x02, 0xF7, 0xD4, 0x15, 0x64, 0xF1, 0xA6, 0xD0, 0x30, 0x8D, 0x6F, 0x7D,
+    0xF0, 0x9A, 0x29, 0x43, 0xAF, 0xC3, 0xE2, 0xAF, 0xB1, 0x42, 0xCD, 0xC3, 0x93, 0x42, 0xA9, 0xB3,
+    0x4E, 0x5F, 0x6F, 0x03, 0x60, 0xA5, 0x80, 0x5F, 0x33, 0xA0, 0x95, 0xE3, 0x45, 0xE6, 0xA1, 0x81,
+    0x0F, 0x91, 0xA5, 0xB9, 0x9E, 0xE3, 0x53, 0xF2, 0xA8, 0x65, 0x36, 0xB7, 0x57, 0x9E, 0xAD, 0x13,
+    0xCF, 0x01, 0xF0, 0xA3, 0xD7, 0x88, 0xF0, 0x6C, 0xFD, 0x22, 0x42, 0xD3, 0x6C, 0xED, 0x8E, 0xDE,
+    0x81, 0xF6, 0x8A, 0x59, 0xAD, 0x62, 0xEE, 0x13, 0x8E, 0x53, 0x25, 0x7C, 0x29, 0xB0, 0x7B, 0x9D,
+    0xA0, 0xE5, 0x62, 0x4E, 0xDD, 0x22, 0xFC, 0xA9, 0x15, 0x2E, 0xEA, 0xCE, 0xE6, 0x8A, 0xDC, 0x72,
+    0xCA, 0x00, 0xBF, 0x8F, 0x98, 0x28, 0x51, 0x69, 0x72, 0x71, 0xDF, 0x57, 0x05, 0xA3, 0x08, 0x53,
+    0xAF, 0x97, 0x9A, 0x7A, 0xF2, 0xD0, 0xE6, 0xE2, 0xAF, 0xF6, 0x10, 0xB0, 0xC3, 0xA3, 0xD3, 0x89,
+    0xED, 0x68, 0xBC, 0x4F, 0x93, 0x19, 0x0D, 0xFE, 0x03, 0x3E, 0x05, 0x0C, 0x5D, 0x78, 0x9C, 0xA5,
+    0xD0, 0xCB, 0x0D, 0x41, 0x61, 0x10, 0xC5, 0xF1, 0x1B, 0xF1, 0x7E, 0x84, 0x0E, 0x94, 0x40, 0x07,
+    0x74, 0x40, 0x22, 0xF6, 0x3A, 0x60, 0x63, 0x4D, 0x07, 0x74, 0x40, 0x09, 0x3A, 0xA0, 0x04, 0x1D,
+    0xB8, 0x1D, 0x88, 0x37, 0xD7, 0x63, 0x1C, 0xB9, 0xFE, 0x32, 0x7B, 0xB3, 0x3A, 0xBF, 0xCC, 0x97,
+    0x7C, 0x27, 0x13, 0x99, 0x9B, 0xE8, 0x4F, 0xCC, 0x3A, 0xDD, 0x78, 0x86, 0x42, 0x23, 0xF8, 0xCE,
+    0x54, 0x28, 0x82, 0x9D, 0x90, 0x02, 0x17, 0xB3, 0x2D, 0x39, 0x78, 0x99, 0x8D, 0xC8, 0x3D, 0xBD,
+    0xAA, 0x82, 0xB5, 0x90, 0x03, 0x47, 0x21, 0x01, 0xEE, 0x66, 0x4B, 0x72, 0x5D, 0x8B, 0x16, 0x98,
+    0x0B, 0x25, 0xFF, 0x65, 0x06, 0x5C, 0x85, 0xDF, 0x97, 0x9F, 0xCA, 0xE4, 0x81, 0x50, 0x03, 0xA1,
+    0x50, 0x00, 0x27, 0x21, 0x09, 0x1E, 0x66, 0x1B, 0x72, 0x53, 0x8B, 0x3E, 0x58, 0x08, 0x65, 0xB0,
+    0x17, 0xB2, 0xE0, 0xE6, 0x2A, 0x57, 0xCC, 0x55, 0x1E, 0xFB, 0xCA, 0xA1, 0xAF, 0x7C, 0x16, 0xD2,
+    0xE0, 0xE9, 0xAE, 0xD4, 0xD6, 0x62, 0x02, 0x56, 0xFE, 0x4A, 0x07, 0x21, 0x1F, 0xC7, 0x37, 0x6A,
+    0x73, 0xC1, 0xE1, 0x78, 0x9C, 0x4D, 0x51, 0x3B, 0x4E, 0xC3, 0x50, 0x10, 0x1C, 0xE2, 0xF0, 0x71,
+    0x00, 0xE1, 0x1A, 0x24, 0xC4, 0x01, 0x72, 0x00, 0xBA, 0x70, 0x01, 0x04, 0x37, 0x48, 0x4E, 0x80,
+    0xB8, 0x01, 0xD4, 0x50, 0x98, 0x86, 0x82, 0x8A, 0x12, 0x51, 0x91, 0x1B, 0x04, 0x85, 0x03, 0x20,
+    0x5A, 0x0A, 0x22, 0xA0, 0x49, 0x11, 0xE4, 0x08, 0x08, 0x4A, 0x64, 0xCC, 0x63, 0x66, 0xDF, 0x73,
+    0xE4, 0x29, 0xF6, 0xCD, 0xF8, 0xED, 0xBE, 0x9D, 0x5D, 0x03, 0xC0, 0xE5, 0xC8, 0xBD, 0x9C, 0x47,
+    0x30, 0x0C, 0x9D, 0x30, 0x58, 0x14, 0x7F, 0x77, 0x1E, 0x3D, 0xF2, 0x3D, 0x57, 0x62, 0x0D, 0x78,
+    0x9D, 0x8B, 0x6B, 0x60, 0xAA, 0xFC, 0xB3, 0x5C, 0x6A, 0x01, 0x7F, 0xCE, 0x65, 0x75, 0x24, 0x33,
+    0x8A, 0x25, 0x30, 0xB4, 0x59, 0x7A, 0xCF, 0x33, 0x4E, 0x18, 0x36, 0x28, 0x8E, 0x79, 0x36, 0xAA,
+    0x22, 0x56, 0xCD, 0x01, 0x45, 0x97, 0x62, 0x19, 0xAC, 0x1C, 0x50, 0x7C, 0x53, 0xD4, 0xF0, 0xC9,
+    0xD8, 0xC4, 0x21, 0xE3, 0x1D, 0x70, 0xA1, 0x0E, 0xBB, 0xEA, 0xB3, 0xCD, 0x84, 0x3C, 0x18, 0xC8,
+    0xA2, 0x50, 0xEA, 0x2C, 0x57, 0x98, 0x1A, 0x3F, 0xF2, 0xF3, 0xF4, 0x4D, 0xEC, 0x1B, 0x3F, 0x0D,
+    0x69, 0x9B, 0xE4, 0xC9, 0x6F, 0xE5, 0x81, 0x27, 0x91, 0x5B, 0x85, 0x96, 0x7F, 0x79, 0x0B, 0x0F,
+    0xBA, 0xAA, 0x69, 0xEA, 0x34, 0x3C, 0xB9, 0xAA, 0x2E, 0x0D, 0x8A, 0x8E, 0xF2, 0xC6, 0x36, 0xAE,
+    0x37, 0x92, 0xD2, 0xE7, 0xA3, 0x75, 0x98, 0x70, 0x59, 0x5F, 0xA5, 0x10, 0xE1, 0x4D, 0x66, 0xE2,
+    0x87, 0x37, 0x63, 0x9B, 0x90, 0x28, 0xB8, 0x38, 0x6D, 0xE5, 0x24, 0x18, 0x6C, 0x75, 0x6C, 0xCD,
+    0x57, 0xCF, 0x3A, 0xD6, 0x51, 0x5A, 0x23, 0x22, 0xBC, 0xCD, 0x79, 0xBB, 0xEA, 0xBA, 0x2E, 0x23,
+    0x85, 0xE7, 0x2B, 0xD6, 0x61, 0xE7, 0xE6, 0x83, 0xBF, 0x51, 0xDF, 0xFF, 0x01, 0x3B, 0xF3, 0x1E,
+    0x99, 0x78, 0x9C, 0x4D, 0x90, 0x3D, 0x4E, 0xC2, 0x41, 0x10, 0xC5, 0x1F, 0xE0, 0x9F, 0x04, 0x89,
+    0x84, 0x13, 0x60, 0xE8, 0xE8, 0xA0, 0xB5, 0xF3, 0x00, 0x26, 0x1A, 0x2F, 0x80, 0xAD, 0xA7, 0xE0,
+    0x08, 0x34, 0xF6, 0x50, 0xD1, 0x11, 0x38, 0x01, 0x26, 0x26, 0xB6, 0xAE, 0x07, 0x30, 0x81, 0x10,
+    0x1B, 0x13, 0xC9, 0x1A, 0x3E, 0x0C, 0xA8, 0x30, 0xBE, 0x99, 0xFF, 0x2E, 0xF0, 0x8A, 0x99, 0xF9,
+    0xED, 0xC7, 0xCC, 0xDB, 0x05, 0x50, 0xEE, 0xCD, 0x64, 0x54, 0x83, 0xA9, 0xBC, 0x11, 0xD5, 0x95,
+    0xC1, 0xBB, 0xA4, 0x2A, 0xB0, 0xBE, 0x09, 0xB5, 0x3C, 0x12, 0x16, 0x11, 0x74, 0xEB, 0x6F, 0x0F,
+    0x4D, 0x5C, 0x6A, 0xBA, 0xA8, 0x3E, 0x33, 0x8E, 0x31, 0xB4, 0x25, 0xE0, 0x87, 0x39, 0xF9, 0x62,
+    0x38, 0x25, 0xBC, 0x32, 0x17, 0xE7, 0x0C, 0x39, 0x82, 0x1E, 0x3F, 0x5F, 0x32, 0xD8, 0x38, 0xE6,
+    0xEB, 0x95, 0x88, 0x37, 0x60, 0xD7, 0xD6, 0x2A, 0xEE, 0xFC, 0x8A, 0x0C, 0xF4, 0x58, 0x46, 0x61,
+    0x4B, 0x0F, 0x6A, 0x20, 0x61, 0xDD, 0x60, 0x76, 0xDA, 0xFA, 0x8C, 0x30, 0x55, 0xD0, 0xA1, 0x2E,
+    0x87, 0x3B, 0x35, 0xE2, 0xCC, 0xB4, 0x7F, 0x33, 0x73, 0x4E, 0x2F, 0x46, 0x0D, 0x30, 0x0F, 0x15,
+    0x67, 0x74, 0x52, 0xDB, 0x9C, 0xCE, 0x19, 0x2D, 0xE0, 0xC9, 0x6E, 0x9D, 0x7C, 0xA7, 0xEE, 0x1F,
+    0x3E, 0x7D, 0x3F, 0x01, 0xBF, 0xA5, 0x8E, 0xA8, 0x9D, 0x48, 0x29, 0xD6, 0x8D, 0xF0, 0x2E, 0xD3,
+    0x30, 0xD8, 0x32, 0xED, 0x9F, 0x12, 0x1E, 0xDA, 0x8E, 0xB0, 0x26, 0x54, 0xB8, 0x96, 0x05, 0x6E,
+    0x3F, 0x74, 0x56, 0x1E, 0x98, 0x88, 0xDF, 0x05, 0x67, 0x0A, 0x41, 0xC5, 0x23, 0xE8, 0xE0, 0x00,
+    0x3E, 0x39, 0x80, 0xCB, 0x5B, 0xD3, 0xEE, 0x4C, 0xE4, 0xE5, 0x3E, 0x6B, 0xF5, 0x3F, 0x56, 0x80,
+    0x0D, 0x22, 0x78, 0x9C, 0x63, 0x38, 0xFA, 0xBF, 0x96, 0x21, 0xE1, 0xFF, 0xFF, 0xFF, 0x9C, 0x0F,
+    0x80, 0x84, 0xFE, 0x47, 0x20, 0x11, 0x0F, 0x22, 0xF2, 0x3F, 0x00, 0x09, 0xFB, 0x06, 0x20, 0xC1,
+    0xC3, 0xF0, 0xF3, 0xFF, 0x7E, 0x46, 0x06, 0x01, 0x17, 0x26, 0x06, 0x72, 0x81, 0x80, 0x33, 0x50,
+    0xEF, 0xAF, 0xFF, 0xE7, 0x19, 0x27, 0x00, 0xCD, 0xE3, 0x05, 0x9B, 0x0C, 0xB6, 0x03, 0x6C, 0xDB,
+    0x05, 0x90, 0xBD, 0x01, 0x20, 0x17, 0x30, 0x1C, 0x01, 0xBA, 0x05, 0x00, 0xAE, 0xE8, 0x3A, 0x41,
+    0x78, 0x9C, 0xAD, 0x8E, 0xB1, 0x0D, 0x82, 0x50, 0x00, 0x05, 0x0F, 0x8C, 0x1A, 0x1B, 0xB4, 0xA7,
+    0x75, 0x00, 0x57, 0x70, 0x02, 0xDD, 0x44, 0x46, 0x71, 0x03, 0xD9, 0x80, 0x51, 0x18, 0x01, 0x37,
+    0x30, 0x1A, 0x50, 0x42, 0xD0, 0xF3, 0x7F, 0x66, 0xE0, 0x15, 0xD7, 0xBC, 0xE2, 0x8E, 0xF3, 0xD8,
+    0xAC, 0xE1, 0xAD, 0x37, 0xF8, 0xA9, 0xE9, 0x2E, 0xC0, 0xE5, 0xC4, 0x15, 0x91, 0x0B, 0x7A, 0xAD,
+    0xE1, 0xAA, 0x39, 0x70, 0xDC, 0x33, 0xF7, 0x9E, 0xC1, 0x92, 0xD0, 0xEA, 0x03, 0x3E, 0x5A, 0xC1,
+    0xA0, 0x27, 0xF8, 0x6A, 0x46, 0x6C, 0xD8, 0x70, 0x98, 0x42, 0x0A, 0x6D, 0xA0, 0xD4, 0x0B, 0xDC,
+    0x75, 0x0B, 0xAF, 0x78, 0xD2, 0x85, 0x6E, 0xF8, 0x03, 0x23, 0x7B, 0x43, 0xE7, 0x78, 0x9C, 0x63,
+    0x60, 0xC0, 0x0E, 0x16, 0xB1, 0x21, 0xB1, 0xFF, 0xB3, 0x21, 0xB1, 0x11, 0x1C, 0x20, 0x1B, 0xCE,
+    0x01, 0xB1, 0x61, 0x1C, 0x30, 0xFB, 0x3F, 0x2B, 0x12, 0x5B, 0x0B, 0x89, 0x2D, 0x89, 0x60, 0xBF,
+    0x17, 0x47, 0xB0, 0xEF, 0xB3, 0x21, 0xD8, 0xE7, 0x91, 0xF4, 0xEE, 0x67, 0x81, 0x18, 0xFA, 0x17,
+    0xC8, 0x5E, 0xCF, 0xCC, 0x80, 0xE0, 0xB0, 0x30, 0x20, 0x71, 0xA0, 0x3A, 0x18, 0x18, 0x7E, 0x82,
+    0xCD, 0x95, 0x80, 0x70, 0x04, 0x5E, 0x80, 0x6D, 0xF4, 0x86, 0xCA, 0x5D, 0x03, 0xF3, 0x6A, 0x19,
+    0x21, 0xBC, 0x2D, 0x60, 0x1E, 0xCC, 0x48, 0x88, 0xDB, 0xA0, 0x8E, 0x60, 0x68, 0xFC, 0x07, 0xE6,
+    0x42, 0xAD, 0x48, 0xF8, 0x8B, 0xE4, 0x39, 0x06, 0x87, 0xDF, 0x48, 0x1C, 0x06, 0x85, 0x9F, 0x48,
+    0x1C, 0x06, 0x81, 0xE7, 0x48, 0x1C, 0x06, 0x86, 0xA3, 0xC8, 0x1C, 0x06, 0x06, 0x00, 0xC8, 0x43,
+    0x77, 0x3B, 0x78, 0x9C, 0xFB, 0xFB, 0x1F, 0x01, 0xD8, 0xFE, 0x92, 0xC1, 0x09, 0x09, 0x45, 0x00,
+    0x26, 0x06, 0xE2, 0x00, 0x8A, 0x1E, 0x72, 0x2C, 0x45, 0xE1, 0x00, 0x00, 0x20, 0x72, 0x7F, 0xAB,
+    0x78, 0x9C, 0x63, 0x60, 0x40, 0x02, 0xD9, 0xC8, 0x9C, 0xBF, 0x79, 0xC8, 0x9C, 0xFF, 0x79, 0xC8,
+    0x1C, 0x24, 0x1E, 0x90, 0x83, 0xE0, 0xFD, 0xF9, 0x8F, 0xC4, 0x4B, 0xF8, 0x8B, 0xCC, 0x0B, 0x40,
+    0x91, 0x33, 0xF8, 0x8D, 0xCC, 0x53, 0xF8, 0x85, 0xCC, 0x13, 0xF8, 0x81, 0xC2, 0x7B, 0x8E, 0xCC,
+    0x63, 0xB8, 0x06, 0xE2, 0xB1, 0xC1, 0x78, 0xBF, 0x11, 0x1C, 0x85, 0x17, 0x08, 0x19, 0x07, 0xB0,
+    0xE9, 0xEF, 0x99, 0x41, 0xEC, 0xC2, 0x7F, 0x20, 0xF6, 0x79, 0x56, 0x10, 0x7B, 0x31, 0x88, 0xF9,
+    0x7F, 0x3D, 0x33, 0xDC, 0xA0, 0xFF, 0x7D, 0x8C, 0x20, 0xC7, 0xFC, 0x04, 0xB3, 0x73, 0xC1, 0x7A,
+    0xC1, 0x4E, 0xF9, 0xEF, 0x83, 0xF0, 0xDC, 0x7F, 0x2B, 0x84, 0x4F, 0xDF, 0x4B, 0x20, 0xBC, 0x7D,
+    0x1F, 0xEE, 0x0A, 0x86, 0xBF, 0xFB, 0x59, 0x10, 0xA1, 0x33, 0x87, 0x89, 0x01, 0x07, 0x00, 0x00,
+    0xBB, 0xC1, 0x75, 0x1F, 0x78, 0x9C, 0x63, 0x60, 0x50, 0x98, 0x76, 0xE7, 0xDF, 0xFB, 0x1E, 0x16,
+    0x06, 0x20, 0x28, 0xFC, 0xFB, 0x1F, 0x04, 0xEE, 0xB3, 0x32, 0x30, 0x4C, 0xFA, 0x0F, 0x05, 0xFB,
+    0x19, 0x18, 0x7E, 0xC1, 0xD8, 0xFF, 0x79, 0x18, 0x3E, 0xC1, 0xD9, 0xF5, 0x0C, 0x0B, 0xE0, 0xEC,
+    0xFF, 0x0C, 0x0A, 0xFF, 0xFF, 0xF7, 0xAA, 0x32, 0x24, 0x81, 0x0C, 0x60, 0x65, 0xF8, 0x65, 0x09,
+    0x32, 0xED, 0x02, 0x90, 0xCD, 0xC1, 0x20, 0x08, 0x62, 0x32, 0x34, 0x00, 0xD9, 0x5C, 0x0C, 0x10,
+    0x50, 0x00, 0x64, 0x73, 0x42, 0xD9, 0x20, 0x23, 0xD8, 0xA1, 0x6C, 0x90, 0xD1, 0xCC, 0x10, 0xA6,
+    0x00, 0xD0, 0x9C, 0xFB, 0x50, 0xE1, 0xC7, 0x40, 0x61, 0x7F, 0x84, 0x4E, 0x98, 0xF2, 0xDF, 0x60,
+    0x27, 0x80, 0xC1, 0x81, 0xFF, 0x60, 0x5B, 0xE1, 0xC2, 0xBA, 0x10, 0x66, 0x00, 0x90, 0x39, 0x9F,
+    0x01, 0xA1, 0x04, 0x66, 0xCF, 0x47, 0xB0, 0xA7, 0xE0, 0x76, 0xC6, 0xC3, 0xD8, 0x5F, 0xFE, 0xFF,
+    0xB7, 0xC7, 0xC6, 0x26, 0x19, 0x18, 0xA8, 0xC0, 0x99, 0x13, 0xFE, 0xFF, 0xD7, 0x81, 0xB1, 0xBF,
+    0xFF, 0xFF, 0xFF, 0x1E, 0xC6, 0xFE, 0x87, 0x70, 0x31, 0x03, 0x92, 0xA7, 0x50, 0xD8, 0x7F, 0x10,
+    0xE1, 0x01, 0x72, 0xCF, 0x7A, 0xB8, 0xF1, 0xBF, 0xEF, 0x43, 0x94, 0x00, 0x00, 0x82, 0x18, 0x9A,
+    0x1C, 0x78, 0x9C, 0x5D, 0x53, 0x3D, 0x4F, 0x1B, 0x41, 0x14, 0x7C, 0xC7, 0x19, 0x08, 0xB1, 0x00,
+    0x57, 0x54, 0x89, 0xE4, 0x8A, 0x92, 0x98, 0x86, 0x9A, 0x92, 0x0E, 0xFE, 0x01, 0xE4, 0x17, 0xE0,
+    0x96, 0x2A, 0x49, 0x1D, 0x89, 0x8F, 0x06, 0xD2, 0x24, 0x20, 0x81, 0xA0, 0x00, 0x01, 0x42, 0xA2,
+    0x41, 0x44, 0x46, 0xA2, 0x44, 0x82, 0xA4, 0x45, 0x28, 0x4E, 0x1B, 0x25, 0xD2, 0xF1, 0x6D, 0xC0,
+    0xE6, 0x26, 0x33, 0xEB, 0x5D, 0xCE, 0x30, 0x92, 0xEF, 0xDE, 0xCE, 0xBE, 0x9B, 0x9D, 0xF7, 0xDE,
+    0xDA, 0xCC, 0xA1, 0x38, 0x7F, 0x96, 0x26, 0xDF, 0x47, 0xAC, 0x15, 0x9F, 0x1E, 0xE1, 0xB0, 0x15,
+    0x67, 0xDC, 0x1C, 0x02, 0x4E, 0xDA, 0x02, 0x37, 0x81, 0x0C, 0x33, 0x81, 0xAC, 0x6B, 0x75, 0xBC,
+    0xBE, 0xE7, 0x34, 0xF2, 0x4D, 0xEE, 0x27, 0xC3, 0x4A, 0x9F, 0xA2, 0x15, 0x45, 0x8E, 0x2B, 0x30,
+    0x61, 0xD1, 0x4B, 0xED, 0x90, 0x7D, 0xAD, 0xE0, 0x00, 0x48, 0x72, 0x41, 0xE9, 0x16, 0x18, 0xD7,
+    0xFB, 0x1E, 0x78, 0xF3, 0xE4, 0x63, 0x8C, 0x19, 0x91, 0x59, 0x09, 0xA8, 0xF2, 0xF5, 0xFE, 0x34,
+    0x4D, 0x36, 0x46, 0x22, 0xBB, 0x03, 0x3A, 0xCD, 0x7E, 0x00, 0xEF, 0xE8, 0x3E, 0xD8, 0xE4, 0xB2,
+    0xC7, 0xEC, 0x5A, 0x5B, 0xA5, 0xD4, 0xDB, 0x8C, 0xE9, 0x79, 0xD4, 0xAC, 0x81, 0xAA, 0xD9, 0x55,
+    0xF0, 0x1E, 0x5B, 0x8A, 0x45, 0x2B, 0x02, 0x93, 0x56, 0x60, 0x62, 0x75, 0x6A, 0xA1, 0x01, 0xB4,
+    0xD9, 0x03, 0x93, 0xCA, 0x40, 0xAF, 0x6D, 0x37, 0x5D, 0xD1, 0x4F, 0x64, 0x37, 0x80, 0x5C, 0xE6,
+    0xF5, 0xF5, 0x00, 0xFD, 0xD4, 0x44, 0x32, 0x8E, 0xCF, 0x81, 0x0E, 0x59, 0xED, 0x20, 0x49, 0x3B,
+    0x66, 0x17, 0x40, 0xEE, 0x92, 0x3F, 0x8A, 0x27, 0xBE, 0x0C, 0x33, 0x66, 0xB5, 0x53, 0x22, 0x2A,
+    0xB0, 0xBB, 0x22, 0x1F, 0xB4, 0x27, 0x92, 0xE2, 0x2A, 0xEA, 0x43, 0xB3, 0x85, 0x4D, 0x32, 0x47,
+    0x71, 0x1B, 0x96, 0x2D, 0xF3, 0x96, 0xA9, 0x19, 0xDF, 0x71, 0x37, 0x90, 0x2C, 0xD3, 0xD5, 0x11,
+    0xD5, 0xB2, 0xCF, 0x8B, 0x8E, 0xBC, 0x65, 0xBA, 0x34, 0xFD, 0x41, 0x65, 0x47, 0xD6, 0x59, 0xE6,
+    0x8D, 0x4A, 0x7B, 0x94, 0x6B, 0xFB, 0xCD, 0x5A, 0x95, 0x30, 0x2A, 0x89, 0x76, 0xB9, 0xCE, 0xCB,
+    0x11, 0xCF, 0x58, 0x02, 0xBA, 0xE5, 0xA0, 0x4B, 0x27, 0x26, 0x53, 0x7F, 0xD4, 0xA5, 0xE9, 0xBA,
+    0x92, 0x0E, 0xD4, 0xD4, 0xD6, 0xC1, 0x6B, 0x9C, 0x65, 0x37, 0xA9, 0x7B, 0xB7, 0x1C, 0xA8, 0xE9,
+    0xF9, 0xD6, 0x24, 0x4C, 0xC7, 0x13, 0xEA, 0x7C, 0x25, 0x5A, 0x72, 0x4F, 0x57, 0x30, 0x5E, 0x71,
+    0x6E, 0x7F, 0xF1, 0x95, 0x1D, 0xDD, 0x4D, 0x37, 0xDD, 0xB4, 0x2F, 0xFD, 0xA4, 0x9F, 0xE1, 0x23,
+    0xDC, 0x50, 0x5F, 0x80, 0x93, 0xA9, 0x84, 0x6B, 0x59, 0xFA, 0x62, 0xD9, 0xFD, 0x3A, 0x19, 0x52,
+    0x34, 0xB8, 0x9A, 0x56, 0x3C, 0x59, 0x68, 0xC8, 0x48, 0x75, 0xFF, 0xE8, 0xDF, 0xD3, 0x9D, 0x23,
+    0x66, 0x9F, 0x3B, 0xF7, 0x38, 0xCC, 0xC8, 0xAD, 0xEC, 0xAC, 0xE5, 0xC0, 0x7D, 0x6B, 0xF9, 0x23,
+    0x58, 0x69, 0x8D, 0x82, 0xBF, 0x3E, 0xF7, 0xFB, 0xE5, 0x7F, 0x01, 0xBA, 0xA1, 0xF7, 0x78, 0x9C,
+    0x55, 0x92, 0xC9, 0x71, 0x02, 0x31, 0x10, 0x45, 0x85, 0xD9, 0x0A, 0xB3, 0x14, 0x19, 0x40, 0x06,
+    0x70, 0xF7, 0xC1, 0x64, 0x80, 0x2F, 0xDC, 0x7C, 0x20, 0x03, 0xB8, 0xF8, 0x4E, 0x06, 0x90, 0x01,
+    0x64, 0x00, 0x19, 0x40, 0x06, 0x90, 0x01, 0xCE, 0x00, 0xEC, 0x02, 0x8C, 0xD9, 0xBE, 0xBB, 0x5B,
+    0x52, 0xAB, 0xFD, 0xAB, 0x66, 0x46, 0x7A, 0x1A, 0x69, 0x34, 0xAF, 0xE5, 0x1C, 0xE7, 0x17, 0x14,
+    0x67, 0xF3, 0x60, 0x92, 0x37, 0xA0, 0xC3, 0x00, 0x65, 0x43, 0x66, 0x42, 0x1A, 0x86, 0xEC, 0x85,
+    0x0C, 0x0C, 0x39, 0x0A, 0x59, 0x1B, 0x72, 0x01, 0xC6, 0x84, 0x9E, 0x12, 0xA1, 0xDE, 0x0B, 0x5D,
+    0x45, 0x05, 0x7D, 0xEA, 0x15, 0x68, 0x03, 0x55, 0x25, 0x0B, 0x9E, 0x41, 0x9B, 0x6C, 0x29, 0xF9,
+    0x02, 0xB6, 0xBC, 0xFA, 0x58, 0xC9, 0x89, 0x3B, 0xB4, 0x83, 0x9D, 0x92, 0x1B, 0xF0, 0x2A, 0x53,
+    0xB3, 0x01, 0x34, 0xA9, 0x5D, 0x93, 0xE5, 0x4B, 0x81, 0x0C, 0xA9, 0xFD, 0xEC, 0xEA, 0xC2, 0x7D,
+    0x36, 0xFE, 0xBF, 0x69, 0x6E, 0x37, 0x90, 0x6F, 0xEF, 0xE6, 0x07, 0x98, 0x07, 0x72, 0x06, 0x96,
+    0x69, 0x20, 0xE8, 0x1A, 0xA4, 0xC9, 0x94, 0x76, 0x50, 0x33, 0x52, 0x69, 0x13, 0x6A, 0x55, 0xCC,
+    0x88, 0x73, 0x9F, 0x48, 0xF1, 0xD2, 0x0E, 0x86, 0xAC, 0xA3, 0xAE, 0x94, 0x4C, 0xD0, 0x95, 0xC2,
+    0xD2, 0xDE, 0xFE, 0x91, 0x8A, 0x56, 0x26, 0xA6, 0x15, 0x2A, 0xF3, 0xDE, 0xE3, 0x7C, 0xC0, 0x4B,
+    0x3B, 0xB1, 0x64, 0xDD, 0xFC, 0x96, 0x1E, 0xD7, 0xF8, 0x05, 0x7F, 0x1E, 0xB2, 0xA2, 0x25, 0x96,
+    0xEE, 0x20, 0xD2, 0xFA, 0x48, 0xC6, 0xF7, 0x22, 0x6D, 0x05, 0x96, 0x9C, 0xAA, 0xD4, 0x15, 0x2B,
+    0x51, 0x26, 0xBF, 0x3F, 0x65, 0x73, 0x2A, 0xBC, 0x2E, 0x27, 0xED, 0x4E, 0xB7, 0x9C, 0x29, 0x13,
+    0xF2, 0x7F, 0xAD, 0xF0, 0x21, 0x86, 0x78, 0x9C, 0xFB, 0xF1, 0x1F, 0x0C, 0xEE, 0xCD, 0x56, 0x63,
+    0x00, 0x82, 0x1F, 0xFF, 0x61, 0x20, 0x17, 0x85, 0xF7, 0x5F, 0x17, 0x85, 0xF7, 0x9F, 0x19, 0x85,
+    0xC7, 0x8B, 0xC2, 0xCB, 0x07, 0xF3, 0x4C, 0x8C, 0x9D, 0xA7, 0xFD, 0x03, 0xD2, 0xFB, 0xC1, 0x3C,
+    0x46, 0xA0, 0x69, 0x0B, 0x80, 0xF4, 0x7B, 0x38, 0x8F, 0x01, 0xA4, 0x14, 0xC1, 0xFB, 0x83, 0xCE,
+    0x43, 0x52, 0xF9, 0x0F, 0xD9, 0x94, 0x06, 0xB8, 0x0D, 0x40, 0x5E, 0xD0, 0x6F, 0x20, 0xCD, 0x87,
+    0x62, 0x3B, 0x0B, 0x32, 0xCF, 0x0F, 0xD9, 0xD5, 0xB1, 0x28, 0x3E, 0xBA, 0x2F, 0x8E, 0xE2, 0xA3,
+    0xF7, 0x28, 0xFA, 0xFE, 0xDB, 0xC3, 0x6C, 0x70, 0xFC, 0x05, 0x52, 0x0B, 0xB7, 0xDD, 0x00, 0xE4,
+    0x25, 0x56, 0xB8, 0xCB, 0xBE, 0x01, 0x19, 0x9C, 0x70, 0xDE, 0x07, 0x20, 0x83, 0x07, 0xCE, 0x7B,
+    0x00, 0x72, 0x1A, 0x8A, 0x1C, 0x82, 0xF7, 0x09, 0x14, 0x68, 0x70, 0xDE, 0x4F, 0x20, 0x83, 0x1B,
+    0xC6, 0x2B, 0x00, 0x59, 0xCF, 0x0E, 0xE2, 0xB9, 0xB8, 0xB8, 0xB4, 0xFE, 0x05, 0xF1, 0x98, 0x90,
+    0x5D, 0xB6, 0x1E, 0xC5, 0x9D, 0x72, 0x28, 0x7E, 0x40, 0x89, 0x15, 0x1D, 0x1C, 0xB1, 0xF9, 0x7E,
+    0xAD, 0x39, 0xC8, 0x52, 0x00, 0xE8, 0x81, 0x5F, 0x16, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x81, 0xD6,
+    0xDB, 0xFF, 0xDE, 0xCF, 0x51, 0x63, 0x80, 0x00, 0x85, 0x5F, 0xFF, 0xC1, 0xA0, 0x8F, 0x09, 0xCC,
+    0xFD, 0xF9, 0x1F, 0x0A, 0xF6, 0x83, 0x78, 0x8F, 0xFF, 0x23, 0x73, 0x1D, 0xE0, 0xBC, 0xFF, 0xF1,
+    0x40, 0xEE, 0x27, 0x04, 0x97, 0x0F, 0xC8, 0xFD, 0x0B, 0x62, 0xF4, 0x86, 0x95, 0xFE, 0xFE, 0xFF,
+    0x9F, 0x83, 0x81, 0xA1, 0x00, 0xC4, 0xF3, 0x03, 0x99, 0x71, 0xF4, 0x3F, 0xD0, 0xE4, 0x8F, 0x40,
+    0xDE, 0x7D, 0x46, 0xB0, 0x0D, 0x49, 0x40, 0xFC, 0x1D, 0xC8, 0x95, 0x63, 0x80, 0x83, 0x7F, 0x40,
+    0x2E, 0x1B, 0x9C, 0x67, 0x00, 0x52, 0x8B, 0x90, 0x04, 0x99, 0xD4, 0x8F, 0xE0, 0x2E, 0x00, 0x72,
+    0xED, 0x11, 0xDC, 0x0B, 0x40, 0x2E, 0x3F, 0x82, 0xFB, 0x01, 0xC8, 0xE5, 0x45, 0xE5, 0xF2, 0x20,
+    0xB8, 0x20, 0x57, 0x70, 0xE3, 0xE4, 0xA2, 0x29, 0x46, 0xE3, 0x3E, 0x40, 0xB5, 0xE8, 0x00, 0x90,
+    0x2B, 0x8F, 0xE0, 0x4E, 0x80, 0x86, 0x09, 0x14, 0x24, 0xC0, 0x02, 0x10, 0x02, 0x04, 0x40, 0x81,
+    0xC1, 0x84, 0xE0, 0xFF, 0x41, 0xB5, 0xF8, 0x1B, 0x90, 0x3B, 0x1F, 0xD5, 0xA6, 0xFF, 0xDA, 0x20,
+    0x96, 0xC2, 0x71, 0xA0, 0x03, 0x02, 0xC0, 0x21, 0xDC, 0x13, 0x96, 0xBA, 0xE3, 0x1F, 0xD8, 0x3D,
+    0xBF, 0x10, 0xC1, 0xCE, 0x03, 0x75, 0x08, 0x12, 0x97, 0xE1, 0x37, 0x2A, 0xB7, 0x00, 0x95, 0xCB,
+    0x30, 0x09, 0xCA, 0x9B, 0xCF, 0x0C, 0xB1, 0xCC, 0x61, 0xC7, 0xDF, 0xFF, 0xEF, 0xD6, 0x98, 0x03,
+    0x59, 0x00, 0xFB, 0xF3, 0xDC, 0x16, 0x78, 0x9C, 0xFB, 0xF1, 0x1F, 0x04, 0xDE, 0xEF, 0xCD, 0x64,
+    0x64, 0x00, 0x83, 0x1F, 0xFF, 0xA1, 0xE0, 0x3C, 0x1B, 0x2A, 0xFF, 0xFF, 0x7B, 0x36, 0x54, 0xFE,
+    0xFF, 0xF3, 0x8C, 0xA8, 0xFC, 0xFF, 0x7A, 0x68, 0xFC, 0xF7, 0x4C, 0x10, 0xBE, 0x89, 0x71, 0xF0,
+    0xB2, 0x7F, 0x20, 0x01, 0x5E, 0x08, 0x1F, 0xA4, 0xAF, 0x00, 0x24, 0xD0, 0x8F, 0xE0, 0x33, 0x5C,
+    0x02, 0x29, 0x60, 0x42, 0xF0, 0x05, 0x40, 0x0A, 0x38, 0x11, 0x7C, 0x86, 0xAF, 0x40, 0x16, 0x3F,
+    0x12, 0xFF, 0x01, 0x90, 0xE5, 0x8F, 0xC4, 0x2F, 0x00, 0x1B, 0x88, 0xE0, 0x1B, 0x80, 0x9C, 0x88,
+    0xC4, 0x67, 0x00, 0xB9, 0x08, 0x99, 0x0F, 0xB2, 0x00, 0x99, 0xFF, 0x17, 0xC4, 0x44, 0xE2, 0xFF,
+    0x21, 0xC0, 0xFF, 0x8B, 0xA6, 0x1F, 0xCD, 0x3C, 0x01, 0x20, 0xEB, 0x3E, 0x12, 0x3F, 0x00, 0xC8,
+    0x5A, 0x8F, 0xC4, 0x9F, 0x00, 0x64, 0xD5, 0x23, 0xF1, 0x3F, 0x02, 0x59, 0xFA, 0x48, 0xFC, 0x9F,
+    0xE0, 0x00, 0x83, 0xF3, 0x1D, 0x40, 0xE1, 0xC3, 0x86, 0xE0, 0x7F, 0x05, 0x7B, 0x07, 0xCE, 0x5F,
+    0x0C, 0x92, 0x8E, 0x87, 0xF0, 0x5D, 0x5C, 0x52, 0x6F, 0x82, 0x23, 0x80, 0x0B, 0x35, 0x3E, 0xCE,
+    0xA3, 0xC5, 0x8F, 0x0C, 0x2A, 0xBF, 0x1F, 0x35, 0x7E, 0xCF, 0x33, 0xA3, 0xF0, 0xE7, 0x31, 0x23,
+    0xA5, 0x87, 0xFB, 0x6B, 0xCC, 0x21, 0x7E, 0x66, 0x00, 0x00, 0x6C, 0xA4, 0x4A, 0x05, 0x78, 0x9C,
+    0xFB, 0xF1, 0x1F, 0x06, 0xF8, 0x7F, 0x90, 0xCF, 0x34, 0x31, 0x06, 0x01, 0x66, 0x10, 0x93, 0x91,
+    0x01, 0x0C, 0xA8, 0xC3, 0x84, 0x00, 0x26, 0x0A, 0x98, 0x10, 0x97, 0x51, 0xC9, 0x39, 0xD8, 0x99,
+    0x2E, 0x60, 0xC0, 0x42, 0x41, 0xF0, 0x41, 0x99, 0x00, 0x28, 0x3C, 0xFE, 0xDD, 0x78, 0x9C, 0xFB,
+    0xF1, 0x1F, 0x06, 0xF8, 0x7F, 0x90, 0xCF, 0x34, 0x06, 0x03, 0x66, 0x10, 0x93, 0x01, 0x02, 0x68,
+    0xC9, 0x84, 0x00, 0x4A, 0x98, 0x4A, 0x60, 0x40, 0x53, 0x47, 0x92, 0xC1, 0x04, 0x00, 0xAF, 0xBD,
+    0xD8, 0x88, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x81, 0x80, 0x1D, 0x6F, 0xFF, 0xBF, 0x5F, 0xEB, 0xC1,
+    0x00, 0x05, 0x5B, 0xFE, 0x43, 0xC0, 0x79, 0x31, 0x30, 0xF7, 0xCA, 0x7F, 0x18, 0x78, 0x0F, 0xE2,
+    0x4E, 0x80, 0x73, 0xFF, 0xCF, 0x07, 0x72, 0x05, 0xFE, 0x20, 0xF8, 0xF6, 0x40, 0xFE, 0x01, 0x04,
+    0xF7, 0x3F, 0x0F, 0x90, 0xFF, 0x0B, 0xCC, 0xAA, 0x0E, 0x4B, 0x3D, 0xF9, 0xFF, 0x3F, 0x2B, 0x03,
+    0x43, 0x02, 0xD8, 0x1C, 0x36, 0x90, 0x41, 0x81, 0x6F, 0x80, 0xC4, 0x03, 0x10, 0x9F, 0x1B, 0x62,
+    0xAF, 0x00, 0x10, 0x7F, 0x07, 0x72, 0xD7, 0x33, 0x20, 0xC0, 0x5F, 0x20, 0x9F, 0x17, 0xC1, 0x35,
+    0x00, 0x29, 0x67, 0x46, 0xF0, 0x0B, 0x40, 0xCE, 0x44, 0x52, 0xBE, 0x01, 0xC8, 0x8F, 0x47, 0xE2,
+    0x5F, 0x00, 0xF2, 0xE5, 0x91, 0xF8, 0x1F, 0x80, 0x7C, 0x3E, 0x34, 0x3E, 0xC8, 0x95, 0x50, 0x07,
+    0x33, 0x7F, 0x84, 0xBA, 0x06, 0x17, 0x1F, 0x5D, 0xFD, 0x07, 0xA8, 0xF3, 0x60, 0x7C, 0x90, 0x77,
+    0xF8, 0x91, 0xF8, 0xA0, 0xD0, 0xD0, 0x07, 0xF2, 0x5D, 0x5C, 0x5C, 0xBE, 0x81, 0xF8, 0xA0, 0xC0,
+    0xCB, 0x87, 0x58, 0xFD, 0x19, 0xC4, 0x0F, 0x40, 0xB8, 0x1F, 0xCC, 0x17, 0x00, 0xE9, 0x62, 0x41,
+    0xF0, 0x19, 0x7E, 0xC3, 0xFD, 0x0F, 0xE1, 0x7F, 0x85, 0x6B, 0x80, 0xF0, 0x41, 0x1E, 0xFC, 0x1F,
+    0x8B, 0xE0, 0x83, 0x03, 0xE8, 0xFF, 0xBC, 0xB0, 0xD0, 0xE9, 0x7F, 0x20, 0x21, 0xF5, 0x03, 0x29,
+    0x3E, 0x40, 0xFC, 0x05, 0x68, 0x7C, 0x86, 0x9F, 0x68, 0xFC, 0x80, 0x7F, 0xA8, 0x7C, 0x86, 0x82,
+    0xBF, 0x50, 0xDE, 0x79, 0x75, 0x68, 0x24, 0x2C, 0x7F, 0xF3, 0xFF, 0xFD, 0xB9, 0x59, 0x66, 0x40,
+    0x26, 0x00, 0x20, 0x5C, 0x33, 0x78, 0x78, 0x9C, 0xFB, 0xF1, 0xFF, 0xFF, 0x7F, 0x46, 0x06, 0x30,
+    0xF8, 0xF3, 0xFF, 0xFF, 0xFE, 0x1F, 0xC3, 0x83, 0x8B, 0x00, 0xD4, 0xE6, 0xBA, 0xBA, 0x80, 0xC1,
+    0xDF, 0xC1, 0xE5, 0x5F, 0xDA, 0x70, 0x01, 0xFE, 0x68, 0x40, 0x6B, 0x78, 0x9C, 0xFB, 0xF1, 0xFF,
+    0xFF, 0x7F, 0xC6, 0x1F, 0x43, 0x8B, 0x00, 0x00, 0xB1, 0xD6, 0x8E, 0x99, 0x78, 0x9C, 0x63, 0x60,
+    0x60, 0x60, 0xF8, 0xF1, 0xFF, 0xFF, 0x7F, 0x46, 0x86, 0x51, 0x06, 0x51, 0x0C, 0x06, 0x14, 0xC6,
+    0xAF, 0xFF, 0xFF, 0xDF, 0x83, 0x19, 0xFF, 0xFE, 0xFF, 0xBF, 0x0F, 0xA2, 0x1D, 0x80, 0x32, 0xF3,
+    0x41, 0x8C, 0x8B, 0x40, 0x46, 0x3E, 0xC3, 0x8C, 0xF0, 0x69, 0x40, 0xFA, 0xBF, 0x3C, 0xC3, 0xEF,
+    0xFF, 0x60, 0xC0, 0x05, 0x63, 0x30, 0x42, 0x19, 0xF1, 0x0C, 0x50, 0x06, 0x1B, 0x94, 0x61, 0x0D,
+    0xD4, 0xBB, 0xED, 0xED, 0xFF, 0xB3, 0x16, 0x20, 0x43, 0x00, 0x01, 0xFB, 0xC3, 0x3B, 0x78, 0x9C,
+    0x75, 0xD1, 0xCD, 0x0D, 0xC2, 0x30, 0x0C, 0x05, 0x60, 0x17, 0x15, 0xA8, 0x80, 0x4A, 0x0C, 0x80,
+    0xAA, 0x6E, 0xC0, 0x08, 0x9C, 0x38, 0xC3, 0x06, 0xB0, 0x01, 0x5D, 0x81, 0x09, 0x60, 0x03, 0x46,
+    0x60, 0x05, 0x36, 0xE8, 0x08, 0xB0, 0x41, 0xC5, 0xAF, 0x0A, 0x88, 0x86, 0xE7, 0x88, 0xBC, 0x28,
+    0x07, 0x2A, 0xC5, 0xF6, 0x77, 0x49, 0x6D, 0xA7, 0x36, 0xC6, 0x44, 0xA2, 0xDF, 0x0B, 0x55, 0xBF,
+    0x76, 0x2C, 0x50, 0x1C, 0x23, 0xF2, 0x86, 0x62, 0x22, 0x8E, 0x79, 0x83, 0xA2, 0x4D, 0x1E, 0x90,
+    0x77, 0x42, 0xEA, 0x45, 0x03, 0x72, 0x89, 0x54, 0x45, 0xE4, 0x15, 0x69, 0x26, 0x8E, 0x43, 0xBD,
+    0xA8, 0x4B, 0xEA, 0x45, 0x7B, 0x21, 0x9F, 0x88, 0x29, 0x39, 0x47, 0x30, 0x2D, 0xF2, 0x82, 0xB0,
+    0x10, 0xF2, 0x83, 0x90, 0x90, 0x6B, 0x9C, 0x52, 0xC8, 0x3B, 0x4E, 0xE6, 0xD9, 0x84, 0x34, 0xEE,
+    0xAF, 0x9E, 0x26, 0x0E, 0x99, 0x86, 0xDC, 0x90, 0xD5, 0x34, 0xE8, 0x6A, 0xE4, 0x86, 0x77, 0x23,
+    0x9C, 0x11, 0x57, 0x9E, 0xC5, 0x6F, 0x19, 0x6E, 0x1B, 0xDA, 0x75, 0x4F, 0xFE, 0x2C, 0x47, 0xB6,
+    0xFA, 0x06, 0x9E, 0x76, 0x59, 0x89, 0xDF, 0xF3, 0x03, 0x79, 0x2C, 0xC1, 0x2B, 0x94, 0x9E, 0xB9,
+    0x36, 0xD6, 0x21, 0x6D, 0x91, 0x79, 0x9E, 0xEC, 0xD0, 0xA4, 0x5D, 0x6E, 0x4C, 0xCA, 0x5B, 0x87,
+    0xFE, 0x02, 0xA4, 0xAB, 0x2A, 0x8B, 0x78, 0x9C, 0xFB, 0xF1, 0xFF, 0xFF, 0x7F, 0x46, 0x06, 0x08,
+    0xF8, 0x31, 0xCA, 0xA6, 0x3A, 0xDB, 0x05, 0x02, 0x98, 0x40, 0x6C, 0x28, 0xE0, 0xA0, 0x84, 0x0D,
+    0x00, 0x25, 0xF3, 0xBA, 0x76, 0x78, 0x9C, 0x5D, 0xD2, 0xEF, 0x4D, 0xC2, 0x50, 0x14, 0x05, 0xF0,
+    0x17, 0x23, 0x31, 0xA2, 0x01, 0x37, 0x28, 0x0B, 0xF8, 0x27, 0xF1, 0x8B, 0xDF, 0x70, 0x02, 0xE8,
+    0x06, 0xB0, 0x81, 0x4E, 0x60, 0xDC, 0xC0, 0x11, 0xE8, 0x06, 0xB8, 0x81, 0x2C, 0x60, 0xE2, 0x06,
+    0xB8, 0x01, 0x2A, 0x8A, 0x20, 0xCA, 0xE1, 0xDC, 0x77, 0xEF, 0xB3, 0xF7, 0xD1, 0xA4, 0xED, 0xED,
+    0x2F, 0x69, 0x4F, 0x7B, 0x5E, 0x97, 0xE0, 0xD6, 0x0A, 0xB6, 0xFD, 0xC9, 0x55, 0x73, 0x29, 0xC7,
+    0xBE, 0x51, 0x07, 0xB5, 0x8D, 0xCC, 0x6E, 0x9D, 0x4D, 0xCD, 0x26, 0xCE, 0xB0, 0xA7, 0xF6, 0xEE,
+    0xED, 0x40, 0xED, 0xDB, 0xDB, 0xB1, 0xDA, 0xAF, 0xB7, 0x22, 0xD2, 0x09, 0xFE, 0xED, 0x19, 0xB8,
+    0x89, 0x36, 0xE4, 0x1B, 0x98, 0xDD, 0x01, 0x4F, 0xD1, 0x1E, 0xF9, 0xA6, 0x66, 0x67, 0x3C, 0xA7,
+    0xD8, 0x53, 0xB3, 0x36, 0xBF, 0xA8, 0x21, 0xB6, 0x00, 0xAE, 0x92, 0x71, 0x6F, 0x8A, 0xAD, 0x81,
+    0x4B, 0xB3, 0x62, 0xAE, 0x2D, 0x30, 0x76, 0x76, 0x9D, 0xEC, 0x15, 0xE8, 0xD2, 0x4A, 0xE0, 0xA1,
+    0x34, 0x3B, 0xAF, 0x78, 0xA1, 0xB1, 0xDD, 0x64, 0x32, 0x48, 0x0B, 0x6F, 0x7C, 0xC4, 0x30, 0x59,
+    0xD0, 0x16, 0xBE, 0x80, 0xC3, 0xDA, 0xD6, 0xB1, 0x85, 0x1F, 0x60, 0xBF, 0xB6, 0x45, 0x6C, 0x81,
+    0xB1, 0x21, 0x59, 0x5F, 0x3E, 0xA0, 0x90, 0xD8, 0x91, 0xB3, 0x89, 0xB4, 0x50, 0xC9, 0x54, 0xDB,
+    0xBD, 0xB4, 0x20, 0xB1, 0xCE, 0x2E, 0xA4, 0x85, 0x4F, 0xC6, 0x3A, 0x0B, 0x1B, 0xB6, 0x20, 0xB1,
+    0xDE, 0x56, 0x9C, 0x36, 0xD2, 0x98, 0x33, 0xDE, 0xD7, 0x03, 0xC6, 0x99, 0xF1, 0xF9, 0xD3, 0x38,
+    0x38, 0xAB, 0xE2, 0xE2, 0xB4, 0x33, 0x2B, 0x75, 0xC1, 0x32, 0xD3, 0x55, 0x6C, 0x64, 0xA6, 0xAB,
+    0x1D, 0x72, 0x93, 0xBF, 0x62, 0xBC, 0x63, 0x1F, 0x9C, 0x07, 0x3B, 0xF6, 0xA2, 0xB1, 0x99, 0xB1,
+    0x05, 0x1C, 0x25, 0xDB, 0x02, 0xC2, 0xEA, 0xB0, 0xA5, 0x78, 0x9C, 0x5D, 0xD0, 0xD1, 0x0D, 0x01,
+    0x41, 0x14, 0x85, 0xE1, 0x6B, 0x13, 0x12, 0x12, 0x4C, 0x05, 0x94, 0xA0, 0x84, 0xD5, 0x81, 0x7D,
+    0xF7, 0xA6, 0x02, 0x1D, 0xD0, 0x81, 0x69, 0x40, 0xE8, 0xC8, 0x76, 0xA0, 0x87, 0x7D, 0x60, 0x13,
+    0x62, 0xCD, 0xDC, 0x99, 0xCB, 0xD9, 0x73, 0x9F, 0x4E, 0xBE, 0x97, 0x3F, 0xB9, 0x6D, 0x17, 0x6E,
+    0x28, 0x7A, 0xD7, 0x30, 0x8B, 0x36, 0xC2, 0x94, 0xE1, 0xC0, 0xD0, 0x0D, 0x18, 0xC6, 0x0C, 0x25,
+    0xC3, 0x8D, 0x21, 0x85, 0x11, 0x66, 0x08, 0x67, 0x0B, 0x1B, 0x2C, 0x3E, 0x39, 0x6C, 0x30, 0x7F,
+    0x84, 0x31, 0x41, 0xA8, 0x73, 0xD8, 0x60, 0xB9, 0xCE, 0xE1, 0x1F, 0xC8, 0x2B, 0x85, 0x0D, 0x56,
+    0xD2, 0xA4, 0xB0, 0x41, 0x29, 0x3E, 0xAC, 0x13, 0x82, 0x8B, 0xE1, 0x02, 0x40, 0x9E, 0x1A, 0x06,
+    0x48, 0x61, 0x9F, 0x61, 0x23, 0x12, 0xC3, 0x77, 0x04, 0x0D, 0x8F, 0x8E, 0x00, 0x1A, 0x46, 0xD0,
+    0xF0, 0x1E, 0xC0, 0xC5, 0xA7, 0xEC, 0x00, 0x34, 0xBC, 0x45, 0x88, 0xE1, 0x0B, 0x42, 0x95, 0x5E,
+    0xF9, 0x07, 0x0D, 0xF7, 0xA0, 0x61, 0xF0, 0x0C, 0x8E, 0x41, 0xC3, 0x3D, 0xA8, 0x19, 0x2A, 0x06,
+    0x79, 0x2B, 0x7C, 0x01, 0xD8, 0x5C, 0x6D, 0xB7, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x02, 0x81, 0x69,
+    0x77, 0xFE, 0xFF, 0xDF, 0x1B, 0xC9, 0xC8, 0x00, 0x03, 0x01, 0x7F, 0xFE, 0x83, 0xC1, 0x7E, 0x16,
+    0xA8, 0x80, 0xC1, 0xDF, 0xFF, 0x50, 0xB0, 0x9F, 0x09, 0x22, 0xF2, 0xFD, 0x3F, 0x1C, 0xC4, 0x83,
+    0x05, 0x1A, 0xFE, 0x23, 0x01, 0x36, 0x34, 0x25, 0xFF, 0xFF, 0xFB, 0x83, 0x4C, 0x01, 0xB3, 0xE6,
+    0x85, 0xA5, 0xBE, 0x04, 0xD1, 0xEF, 0x81, 0xF6, 0x1D, 0x00, 0x31, 0xE2, 0x40, 0x8A, 0x9F, 0x81,
+    0x58, 0x9C, 0x0C, 0x0C, 0x5F, 0x80, 0xD4, 0x7D, 0xB0, 0x4B, 0x14, 0xFE, 0x01, 0x99, 0xF2, 0x0C,
+    0x0C, 0xBF, 0x81, 0x94, 0x1C, 0xC4, 0xD2, 0x4F, 0x40, 0x66, 0x3D, 0x83, 0x00, 0xDC, 0x06, 0x88,
+    0xAD, 0xF7, 0x19, 0x02, 0x40, 0xC6, 0x41, 0x9D, 0x0A, 0x96, 0x65, 0x9A, 0x00, 0x24, 0xFA, 0x61,
+    0xDE, 0x01, 0x99, 0xC0, 0x7A, 0x00, 0xEA, 0x08, 0x30, 0xF8, 0x01, 0xE4, 0x70, 0x3C, 0x80, 0x98,
+    0x0F, 0x01, 0x5F, 0x81, 0x1C, 0xAE, 0x0F, 0x40, 0x82, 0x1F, 0x26, 0x02, 0xB2, 0x8C, 0x07, 0x24,
+    0xC2, 0x87, 0x2C, 0xC2, 0xFB, 0x11, 0x44, 0xC0, 0x44, 0x3E, 0x62, 0x17, 0xC1, 0xD4, 0x85, 0x69,
+    0x32, 0xC8, 0x76, 0x7D, 0x14, 0xDB, 0x37, 0x60, 0xB8, 0x10, 0xE4, 0xBB, 0xF9, 0x30, 0x11, 0x50,
+    0x9C, 0xB0, 0x62, 0xF8, 0x94, 0x91, 0x01, 0x44, 0xB2, 0x42, 0x44, 0x26, 0x80, 0x43, 0x83, 0xE1,
+    0x17, 0x22, 0xC4, 0x3E, 0x83, 0x43, 0x0C, 0x1C, 0xAA, 0xE7, 0x51, 0x42, 0x15, 0x11, 0xF2, 0xE0,
+    0x68, 0xE2, 0x00, 0xCA, 0x40, 0x62, 0x27, 0xBD, 0xEC, 0xD7, 0x7F, 0x98, 0x25, 0xDF, 0x90, 0x63,
+    0xD0, 0x1E, 0x23, 0x96, 0x59, 0xD1, 0x53, 0x82, 0x1F, 0x34, 0xB5, 0xFC, 0x41, 0x4F, 0x2D, 0xF0,
+    0x14, 0xB5, 0x9E, 0x19, 0xE6, 0x1D, 0x60, 0xAA, 0x7B, 0x03, 0x4C, 0x75, 0x11, 0x90, 0x54, 0x07,
+    0x00, 0xAA, 0x89, 0x48, 0x5D, 0x78, 0x9C, 0xFB, 0xF1, 0x1F, 0x04, 0xDE, 0xEF, 0xF5, 0x60, 0x00,
+    0x82, 0x1F, 0xFF, 0xA1, 0x60, 0x1E, 0x23, 0x12, 0xE7, 0x7F, 0x1C, 0x32, 0xE7, 0x3F, 0x1B, 0x32,
+    0xC7, 0x1F, 0x99, 0x73, 0x1F, 0xCC, 0x31, 0x31, 0x4E, 0xF9, 0x05, 0xE2, 0xB1, 0x82, 0x38, 0x40,
+    0x73, 0x14, 0xFE, 0x02, 0x69, 0x2E, 0x28, 0x87, 0xE1, 0x13, 0x90, 0xE6, 0x83, 0x71, 0x36, 0x00,
+    0x69, 0x7E, 0x18, 0xA7, 0x01, 0x48, 0xCB, 0x63, 0xE5, 0x4C, 0x40, 0x56, 0x76, 0x01, 0x99, 0xF3,
+    0x0D, 0x48, 0x73, 0x43, 0x39, 0x09, 0x20, 0x4B, 0xD9, 0xC1, 0x2E, 0x70, 0x6E, 0x05, 0xD9, 0xF9,
+    0x9F, 0x11, 0xC9, 0x6D, 0xFD, 0xC8, 0x0E, 0xE5, 0x45, 0xE2, 0xDC, 0x67, 0x44, 0xE2, 0x48, 0x21,
+    0xF9, 0xD4, 0x1B, 0x1E, 0x20, 0xF7, 0xE6, 0x88, 0xC1, 0x42, 0x07, 0x64, 0x29, 0xC3, 0x60, 0xE7,
+    0x00, 0x00, 0xB2, 0xF3, 0x07, 0x97, 0x78, 0x9C, 0x6D, 0x52, 0xCB, 0x4D, 0x03, 0x41, 0x0C, 0x75,
+    0xA2, 0x5D, 0xF2, 0x51, 0x80, 0x54, 0x00, 0x54, 0x00, 0x74, 0x00, 0x15, 0x40, 0x4E, 0x48, 0x5C,
+    0xC8, 0x09, 0xD1, 0x01, 0x57, 0xE8, 0x00, 0x4E, 0x39, 0x02, 0x1D, 0x40, 0x03, 0x68, 0xD3, 0x41,
+    0x1A, 0x40, 0x0A, 0xE2, 0x80, 0x84, 0x84, 0x04, 0x09, 0x5F, 0x11, 0x82, 0xF1, 0xF3, 0xAC, 0x37,
+    0x33, 0x3B, 0x79, 0x07, 0x8F, 0xE7, 0x8D, 0xC7, 0x7F, 0x22, 0x41, 0xBB, 0x77, 0xC7, 0x7C, 0xBB,
+    0x5F, 0x21, 0x43, 0xE7, 0x97, 0x15, 0x59, 0x92, 0x13, 0x9B, 0x53, 0xCE, 0x91, 0x55, 0x1D, 0xF3,
+    0xC5, 0x05, 0xBA, 0x4A, 0x9C, 0xB2, 0x87, 0x85, 0x92, 0x09, 0xF3, 0x2E, 0xBC, 0xA8, 0x76, 0xB1,
+    0x77, 0xF8, 0x84, 0xF3, 0x45, 0xE2, 0xF5, 0xA1, 0x1C, 0xC0, 0xF8, 0x11, 0x5A, 0x83, 0xE8, 0x5D,
+    0x8E, 0xA1, 0x66, 0xB2, 0xF6, 0x27, 0xEA, 0x2A, 0xD1, 0x44, 0x8E, 0x15, 0x17, 0x74, 0x2C, 0xEA,
+    0x09, 0xB5, 0x8B, 0x08, 0x2E, 0xEA, 0x90, 0x3A, 0x70, 0x97, 0xA7, 0xAA, 0xAF, 0xD5, 0x73, 0x11,
+    0x67, 0x56, 0x0E, 0x3C, 0xA4, 0xFD, 0x3C, 0x09, 0xC5, 0xB7, 0x5C, 0xEA, 0xF7, 0xCE, 0xBF, 0xC3,
+    0x87, 0x5C, 0x9A, 0xAF, 0x22, 0x96, 0x8D, 0x41, 0xB0, 0x16, 0x98, 0x25, 0x9F, 0x59, 0x1C, 0x41,
+    0x18, 0x33, 0x9A, 0xCF, 0xC4, 0xBF, 0x62, 0xCF, 0x88, 0xBE, 0x11, 0x44, 0xBF, 0x89, 0x32, 0x44,
+    0x75, 0x97, 0xC6, 0x60, 0x26, 0x69, 0x54, 0x69, 0x85, 0x20, 0x53, 0xC7, 0xA0, 0xEA, 0x01, 0xD1,
+    0xCF, 0xAC, 0x63, 0x6F, 0xDA, 0x31, 0xED, 0xEA, 0x20, 0xE8, 0xEA, 0xAC, 0xF3, 0x3A, 0xA6, 0xBA,
+    0xBC, 0xB8, 0xE9, 0x1C, 0x1D, 0xE3, 0xBB, 0x34, 0x55, 0xF0, 0xE9, 0x4F, 0x70, 0x2B, 0x9A, 0x72,
+    0x52, 0xDE, 0x84, 0x9D, 0xF2, 0xB6, 0x5C, 0xDB, 0x4E, 0xD9, 0x46, 0xD9, 0xDC, 0x90, 0x7E, 0xEF,
+    0x59, 0x99, 0x75, 0xF2, 0x31, 0x2E, 0xE6, 0x6F, 0x40, 0xC9, 0xDC, 0x0A, 0x8C, 0xD0, 0x9C, 0x2C,
+    0x60, 0xAE, 0x60, 0xD4, 0x0C, 0xA8, 0xA9, 0xBF, 0x02, 0x8A, 0x07, 0x18, 0xD5, 0x7C, 0x66, 0x1B,
+    0x4C, 0x37, 0x30, 0xD2, 0x9A, 0x93, 0x7F, 0x90, 0x2B, 0x70, 0x14, 0x78, 0x9C, 0xFB, 0xF1, 0x1F,
+    0x04, 0xEE, 0xAD, 0x31, 0x67, 0x00, 0x83, 0x1F, 0xFF, 0xA1, 0xA0, 0x8F, 0x11, 0x85, 0xFB, 0x3F,
+    0x0F, 0x95, 0xFB, 0x9F, 0x1D, 0x95, 0x1B, 0x8F, 0xCA, 0x7D, 0x0F, 0xE5, 0x9A, 0x38, 0x97, 0xFE,
+    0x01, 0xF1, 0xD9, 0x20, 0x5C, 0xA0, 0x99, 0x0A, 0x7F, 0x81, 0x34, 0x37, 0x9C, 0xCB, 0xF0, 0x09,
+    0x48, 0xF3, 0x23, 0xB8, 0x1B, 0x50, 0xB9, 0x0D, 0x40, 0x5A, 0x1F, 0x95, 0x2B, 0x8F, 0x53, 0x31,
+    0xC8, 0x28, 0x1E, 0x38, 0x57, 0xE0, 0x0F, 0xB2, 0xBD, 0x4E, 0x3F, 0x91, 0x5C, 0x85, 0xDD, 0xCD,
+    0x1C, 0x28, 0xDC, 0x7A, 0x14, 0xFF, 0x9E, 0x67, 0x46, 0xE1, 0xF2, 0xA0, 0x86, 0x55, 0x3C, 0x9C,
+    0xAB, 0xAC, 0xF4, 0x1B, 0x68, 0x0D, 0x3C, 0xE8, 0x18, 0x19, 0x3E, 0x02, 0x49, 0x2E, 0x04, 0xB7,
+    0x00, 0x48, 0xFA, 0x23, 0xB8, 0x0C, 0x7F, 0xA1, 0xAA, 0xA1, 0xDC, 0xCF, 0x50, 0xD5, 0x50, 0xEE,
+    0x04, 0xA8, 0x6A, 0x98, 0x8F, 0xFE, 0x41, 0x54, 0xC3, 0xFC, 0xFB, 0x0D, 0xA2, 0x1A, 0xC6, 0x3D,
+    0x00, 0x51, 0x0D, 0xE3, 0x2A, 0xFC, 0x07, 0xAB, 0x86, 0x71, 0xC1, 0x0C, 0x2E, 0x04, 0xF7, 0x01,
+    0xD8, 0xDD, 0x70, 0x6E, 0x00, 0x58, 0x35, 0x9C, 0xCB, 0xF0, 0x1B, 0xA4, 0x1A, 0x00, 0xB8, 0xC2,
+    0x3B, 0xB8, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x30, 0xD8, 0xFE, 0xF6, 0xFF, 0xBD, 0x2A, 0x66, 0x06,
+    0x20, 0x08, 0xF8, 0xFB, 0x1F, 0x04, 0xDE, 0x5B, 0x32, 0x30, 0x08, 0xFC, 0xFE, 0x0F, 0x05, 0xBA,
+    0x0C, 0x07, 0x61, 0xCC, 0xFF, 0xFC, 0x0C, 0x70, 0xE1, 0xFF, 0x9C, 0x0E, 0x70, 0xE6, 0x7F, 0xA6,
+    0x0D, 0x20, 0x32, 0x2B, 0x74, 0xF9, 0xDF, 0xFF, 0xFB, 0x19, 0x3E, 0x00, 0x99, 0x7A, 0x40, 0xD3,
+    0x14, 0xAE, 0xC7, 0x33, 0x7C, 0x02, 0xB2, 0xD9, 0x40, 0x46, 0x33, 0x30, 0x33, 0x7C, 0x06, 0x29,
+    0x64, 0x80, 0x80, 0x2F, 0x40, 0x36, 0x33, 0x94, 0x0D, 0x52, 0xC3, 0x09, 0x65, 0x83, 0xF4, 0xF6,
+    0x43, 0xD9, 0x0B, 0x40, 0x66, 0xFA, 0x42, 0xD8, 0x06, 0x60, 0x6B, 0x7C, 0x20, 0x9C, 0x1F, 0x60,
+    0x4E, 0x2C, 0x98, 0xBD, 0x01, 0xE2, 0x00, 0x88, 0xB2, 0x5F, 0x10, 0x8E, 0x14, 0x88, 0x9D, 0xF0,
+    0x0F, 0xE2, 0x17, 0xB0, 0x2D, 0x8D, 0x10, 0x09, 0x7F, 0x06, 0x04, 0xE7, 0x3D, 0x23, 0x98, 0x53,
+    0x00, 0x56, 0x06, 0xB5, 0xBE, 0x01, 0xC4, 0x96, 0x47, 0x72, 0xA2, 0x3F, 0x94, 0x1D, 0x00, 0x64,
+    0xD7, 0x43, 0xD9, 0x0C, 0x48, 0x4E, 0x64, 0x00, 0xEA, 0xAE, 0x5F, 0x05, 0xF1, 0x88, 0x02, 0x50,
+    0x3C, 0xFF, 0xF7, 0x7D, 0x75, 0x10, 0x1B, 0x14, 0x62, 0xFA, 0xC0, 0xA0, 0x5A, 0x17, 0xEE, 0x32,
+    0x15, 0x64, 0x01, 0x2F, 0x22, 0xD8, 0xFE, 0xB3, 0x21, 0xD8, 0xFB, 0x91, 0x82, 0x93, 0x07, 0xE6,
+    0xFA, 0xFF, 0xFF, 0xE7, 0x03, 0x2D, 0x84, 0x4A, 0xEC, 0x07, 0x9B, 0xDD, 0x7A, 0xFB, 0xDF, 0xFF,
+    0x73, 0x99, 0x20, 0x07, 0x03, 0x00, 0xB7, 0x25, 0xEA, 0x89, 0x78, 0x9C, 0xFB, 0xFF, 0x1F, 0x09,
+    0xF0, 0xFF, 0xA7, 0x0A, 0xCF, 0x05, 0x08, 0x5A, 0x80, 0x8C, 0x7A, 0x10, 0x83, 0x85, 0x01, 0x08,
+    0x02, 0x80, 0x3C, 0x7F, 0x06, 0x18, 0x18, 0xE5, 0x0D, 0x3C, 0x0F, 0x00, 0x8C, 0x5C, 0xBC, 0xDD,
+    0x78, 0x9C, 0xFB, 0xF3, 0xFF, 0xFF, 0x79, 0x06, 0x08, 0xF8, 0xFF, 0xFF, 0x7F, 0xFF, 0x9F, 0x51,
+    0x2E, 0xB9, 0xDC, 0xDF, 0xFF, 0xFF, 0xDF, 0x47, 0xE5, 0xBE, 0x87, 0xF0, 0x04, 0x40, 0xDC, 0x9F,
+    0x40, 0x82, 0x11, 0xCC, 0x75, 0x00, 0xB2, 0xEA, 0x7F, 0x00, 0x09, 0x16, 0x30, 0xB7, 0x01, 0xC8,
+    0x8A, 0xFF, 0x02, 0x24, 0xB8, 0xC0, 0xDC, 0x07, 0x40, 0x96, 0xFE, 0x07, 0x20, 0xE1, 0x0F, 0xE6,
+    0x82, 0xD4, 0xF1, 0x6E, 0x00, 0x12, 0xFF, 0xD9, 0x80, 0xBC, 0x09, 0x20, 0x06, 0xBB, 0x02, 0x88,
+    0x7C, 0x5F, 0x99, 0xBA, 0x1C, 0x4C, 0x33, 0x30, 0x80, 0x8C, 0x86, 0x81, 0x78, 0x06, 0x86, 0x03,
+    0x48, 0x5C, 0x0E, 0xA0, 0xED, 0x7F, 0xE0, 0xBC, 0x7E, 0x98, 0x7D, 0x60, 0xF0, 0x9E, 0x15, 0x6C,
+    0xC3, 0x24, 0x08, 0xEF, 0x3E, 0x3B, 0xD4, 0xED, 0x81, 0x27, 0xDE, 0xFE, 0xBF, 0x57, 0xC5, 0x0C,
+    0x62, 0x02, 0x00, 0x06, 0xC9, 0x1C, 0xAD, 0x78, 0x9C, 0x4D, 0x90, 0xF9, 0x19, 0x01, 0x31, 0x10,
+    0xC5, 0x9F, 0xFB, 0x3E, 0x3A, 0xA0, 0x03, 0x3A, 0x50, 0x02, 0x1D, 0xD0, 0x01, 0x25, 0xE8, 0x40,
+    0x09, 0x74, 0x40, 0x07, 0x74, 0x40, 0x07, 0x4A, 0x58, 0xBB, 0x7C, 0x8E, 0xCF, 0x31, 0xE6, 0x48,
+    0x76, 0x33, 0x7F, 0x64, 0x26, 0x2F, 0xC9, 0xFC, 0x32, 0xEF, 0x4B, 0x74, 0x84, 0x8B, 0x1B, 0x11,
+    0x95, 0x1E, 0xBC, 0xE4, 0x9C, 0xF0, 0xE2, 0x1A, 0x09, 0x2F, 0x65, 0x27, 0xFC, 0x88, 0xB6, 0x38,
+    0xB1, 0xD0, 0xB0, 0xFD, 0x90, 0xCB, 0x29, 0x16, 0xBC, 0xF6, 0x4C, 0x58, 0x72, 0xD9, 0x41, 0x5F,
+    0x65, 0x0D, 0xB9, 0x5C, 0x07, 0xBE, 0xF2, 0x50, 0xE3, 0xCA, 0x42, 0x11, 0x10, 0x8C, 0x09, 0x4F,
+    0xAB, 0x12, 0xD3, 0x91, 0xDE, 0x3D, 0xB0, 0x50, 0x93, 0xBD, 0x74, 0x1B, 0x73, 0x16, 0x4C, 0x1B,
+    0x41, 0x21, 0x07, 0x23, 0x84, 0x57, 0x3F, 0x44, 0x2B, 0xC9, 0xB1, 0x6F, 0xC6, 0x98, 0xB3, 0xE4,
+    0x3B, 0x51, 0xA4, 0xCD, 0x05, 0x93, 0xE7, 0xFC, 0x26, 0x5A, 0xC3, 0xBF, 0xAD, 0x70, 0x76, 0x10,
+    0xEB, 0xDE, 0x04, 0x26, 0x9E, 0x86, 0xAE, 0x8D, 0xB7, 0xF1, 0x10, 0xC5, 0xCC, 0x81, 0x4B, 0xFA,
+    0x63, 0xC1, 0xEC, 0xD5, 0xBF, 0xC8, 0x19, 0x15, 0xAB, 0x8B, 0x2F, 0x0F, 0x31, 0x4C, 0x49, 0xFC,
+    0x1B, 0x39, 0x61, 0x26, 0xC6, 0xF4, 0x53, 0x88, 0x61, 0xDA, 0x8B, 0x0C, 0xA2, 0x98, 0xC1, 0x8E,
+    0x85, 0x82, 0x17, 0x78, 0x8A, 0xF9, 0x25, 0x83, 0x28, 0x66, 0x7B, 0x75, 0x33, 0x7B, 0x4C, 0x74,
+    0xCF, 0x20, 0x86, 0x79, 0x67, 0x10, 0xC3, 0x70, 0x54, 0x53, 0x41, 0xAC, 0x08, 0x21, 0x8A, 0x71,
+    0xB6, 0x05, 0xD3, 0x04, 0x10, 0x40, 0x7E, 0x15, 0x40, 0x0C, 0x43, 0xAD, 0x40, 0xE8, 0x06, 0x90,
+    0x3F, 0x7B, 0x54, 0xF6, 0xC9, 0x78, 0x9C, 0x3D, 0x53, 0xED, 0x41, 0xC2, 0x50, 0x0C, 0x7C, 0x82,
+    0x56, 0x51, 0x90, 0x6E, 0x00, 0x1B, 0xE0, 0x06, 0xB0, 0x01, 0x6C, 0x80, 0x1B, 0xC8, 0x06, 0xB8,
+    0x01, 0x6C, 0x00, 0x1B, 0xE0, 0x06, 0xB2, 0x81, 0x6C, 0x50, 0x36, 0x40, 0x81, 0x4A, 0x91, 0x8F,
+    0x98, 0xBB, 0xE4, 0xF5, 0xFD, 0x78, 0x4D, 0x9A, 0x8F, 0xDE, 0x5D, 0xD2, 0xAB, 0xC8, 0x2C, 0xF0,
+    0x14, 0x22, 0x1B, 0xB3, 0x76, 0x22, 0x52, 0x3D, 0x8A, 0x7C, 0x99, 0x7B, 0x56, 0xB7, 0x42, 0xEB,
+    0xA0, 0x56, 0xC8, 0x71, 0xF1, 0xA8, 0x21, 0x09, 0xAD, 0x93, 0xC8, 0x67, 0xF8, 0x51, 0xF7, 0x16,
+    0x5E, 0x0F, 0x81, 0x47, 0x06, 0xAE, 0x22, 0xE3, 0xB0, 0x52, 0xF7, 0x1E, 0xDE, 0x3B, 0x02, 0xCF,
+    0xB0, 0xDA, 0x6A, 0x74, 0xC3, 0x54, 0xEF, 0x27, 0xB8, 0x4B, 0x04, 0x3A, 0xB0, 0x5E, 0xD5, 0x68,
+    0x86, 0x01, 0x6F, 0x3D, 0xE8, 0x29, 0x6F, 0xB0, 0x2C, 0x37, 0x65, 0x9D, 0x1E, 0xA0, 0xD0, 0x6F,
+    0xEA, 0xF1, 0xEE, 0x17, 0xCF, 0x3B, 0x22, 0xB0, 0x89, 0xB5, 0x55, 0xBE, 0x58, 0xC0, 0xD5, 0x84,
+    0x33, 0x5F, 0x84, 0xBD, 0x25, 0xE4, 0xF6, 0xD0, 0x96, 0xD9, 0xD1, 0x00, 0x16, 0xD6, 0x12, 0x85,
+    0x37, 0x01, 0x20, 0x16, 0xBF, 0x06, 0xF0, 0x0C, 0x1A, 0xF6, 0xA9, 0x3B, 0x42, 0x19, 0xEF, 0x0C,
+    0xA0, 0xC3, 0x01, 0xB8, 0x1A, 0xE3, 0xFD, 0x6F, 0xBE, 0x79, 0x71, 0xA2, 0x20, 0x52, 0x67, 0xC7,
+    0xD6, 0x92, 0x3D, 0x46, 0x2E, 0x4D, 0x6A, 0x0C, 0xB5, 0x7F, 0x63, 0xCA, 0xAF, 0x7E, 0x44, 0x31,
+    0x15, 0x67, 0x3F, 0x84, 0x3F, 0x4D, 0x1B, 0x50, 0xE9, 0x75, 0x94, 0x5F, 0x41, 0x4E, 0xA8, 0x68,
+    0x92, 0x52, 0xE9, 0x6D, 0x1C, 0x58, 0x8E, 0x06, 0x6D, 0xA6, 0x69, 0xF1, 0x03, 0x9A, 0x92, 0x31,
+    0x89, 0x40, 0xD1, 0x0D, 0x8B, 0xEB, 0xB8, 0xA8, 0x11, 0x89, 0x54, 0xE6, 0x4C, 0xCB, 0x81, 0xE3,
+    0xE2, 0xEA, 0x73, 0x42, 0xC9, 0x9A, 0x69, 0x5A, 0xDC, 0x4D, 0xE3, 0xBC, 0x38, 0xD3, 0xDA, 0x96,
+    0x69, 0x20, 0xD2, 0x2B, 0x27, 0x8C, 0x94, 0xBA, 0x36, 0x69, 0xB0, 0x78, 0x31, 0x2A, 0x77, 0x02,
+    0xA2, 0x35, 0x0B, 0xEA, 0xA2, 0xD9, 0xD9, 0xBC, 0xDC, 0x22, 0xC8, 0xDC, 0x39, 0x51, 0x49, 0xE8,
+    0xB7, 0x2A, 0xF7, 0x0E, 0x83, 0x19, 0x5E, 0xA8, 0x3D, 0x8A, 0x77, 0x91, 0x46, 0x08, 0x2A, 0xEA,
+    0x44, 0x7B, 0x78, 0x71, 0x11, 0x69, 0x10, 0x4B, 0xE6, 0x1B, 0xBC, 0xE7, 0x7C, 0x3B, 0x1E, 0xE0,
+    0xAA, 0xC9, 0xD0, 0x8B, 0x4B, 0x1A, 0xBE, 0x9C, 0xD2, 0x2A, 0xB7, 0xCE, 0x69, 0xF8, 0x3A, 0x83,
+    0x46, 0x2C, 0x4E, 0x62, 0x00, 0x3F, 0x00, 0x68, 0xC4, 0xE2, 0x4A, 0x0C, 0x14, 0x62, 0x0B, 0xE1,
+    0xC5, 0x91, 0x06, 0xB1, 0x18, 0x0D, 0xFE, 0x1A, 0x25, 0x0D, 0xC3, 0x92, 0x99, 0x79, 0x88, 0x9B,
+    0x1D, 0xFE, 0x01, 0x41, 0xAD, 0xBB, 0x76, 0x78, 0x9C, 0x4D, 0x92, 0xDB, 0x51, 0x02, 0x41, 0x10,
+    0x45, 0x1B, 0x84, 0x55, 0x41, 0x2C, 0x23, 0x00, 0x33, 0xC0, 0x0C, 0x20, 0x03, 0xCC, 0x40, 0x33,
+    0xD0, 0x0C, 0x30, 0x03, 0x0D, 0xC1, 0x0C, 0xD6, 0x0C, 0xD6, 0x0C, 0x24, 0x03, 0xF5, 0x8F, 0x3F,
+    0x4A, 0xB1, 0xB4, 0x10, 0xA4, 0xBD, 0xB7, 0x7B, 0x5E, 0x53, 0xB5, 0xD3, 0x3D, 0xA7, 0xF7, 0x6E,
+    0x3F, 0x66, 0xDF, 0x54, 0xF5, 0x46, 0x7C, 0xED, 0xE1, 0x1F, 0x4C, 0xB1, 0xAD, 0x5A, 0x76, 0xBE,
+    0x83, 0x7B, 0x2F, 0xF2, 0x0B, 0x73, 0x6C, 0xE0, 0x13, 0xDE, 0xA9, 0xC8, 0x3B, 0xCC, 0xC4, 0xC0,
+    0x16, 0x5E, 0x47, 0xE4, 0x1A, 0xE6, 0x85, 0x67, 0x8A, 0xEB, 0x18, 0xE8, 0xC2, 0x2E, 0x60, 0x47,
+    0x85, 0x54, 0xBE, 0x61, 0x2B, 0x82, 0x5B, 0xFF, 0xF8, 0xD9, 0x3E, 0x48, 0x45, 0xFE, 0x40, 0xDA,
+    0xF2, 0x80, 0x7D, 0xEC, 0x60, 0x0D, 0xB7, 0x6F, 0xFB, 0x91, 0x03, 0xC6, 0xAE, 0x64, 0xA7, 0xFA,
+    0x2A, 0xB9, 0xE4, 0xD5, 0x25, 0xE8, 0x2C, 0x82, 0x2F, 0x1C, 0x96, 0x78, 0x7A, 0x11, 0x3C, 0xAA,
+    0xAD, 0xD0, 0x92, 0x78, 0xC6, 0xA2, 0xE9, 0x50, 0x93, 0xEA, 0x49, 0x06, 0xCF, 0x06, 0xDA, 0x19,
+    0x30, 0x05, 0xAB, 0x4D, 0x8B, 0x7D, 0x69, 0x53, 0x80, 0x1F, 0x93, 0x54, 0xE9, 0x7C, 0xEE, 0x69,
+    0x47, 0x09, 0x3C, 0x39, 0xC8, 0x1A, 0x66, 0xDD, 0x16, 0x1A, 0xD6, 0xD5, 0x2C, 0x0A, 0x0D, 0x2B,
+    0x1F, 0x4F, 0x0B, 0x0D, 0x7B, 0x3B, 0xB4, 0xEB, 0xA8, 0x52, 0xF7, 0x98, 0xC4, 0x07, 0xC0, 0x30,
+    0xCD, 0x67, 0xE6, 0xA3, 0x6D, 0xD2, 0x04, 0x7B, 0x61, 0xB4, 0xDD, 0x38, 0xE3, 0x56, 0x08, 0x50,
+    0xC3, 0x57, 0xE7, 0x31, 0x19, 0x35, 0xBC, 0xA7, 0x81, 0x95, 0xA3, 0xAE, 0xD9, 0xF1, 0xA7, 0x48,
+    0x05, 0x0F, 0xED, 0xAE, 0xEB, 0x3C, 0xA6, 0xBA, 0x48, 0x2F, 0x17, 0xA6, 0x29, 0x0A, 0x94, 0x0D,
+    0x83, 0xFF, 0x2D, 0xC9, 0x0F, 0x88, 0x78, 0x9C, 0xDD, 0x8F, 0xFD, 0x0D, 0x41, 0x51, 0x0C, 0xC5,
+    0xEB, 0x23, 0x84, 0x20, 0x26, 0x10, 0x1B, 0x78, 0x1B, 0xB0, 0xC9, 0xB3, 0x81, 0x11, 0xD8, 0xC0,
+    0x08, 0xDE, 0x06, 0x6C, 0xC0, 0x06, 0x46, 0x60, 0x83, 0x17, 0xB9, 0x11, 0x91, 0x1B, 0xAA, 0xA7,
+    0x55, 0xDD, 0x41, 0xFF, 0xE8, 0x3D, 0xBF, 0xE4, 0x9E, 0x93, 0x9E, 0xCC, 0xCC, 0x5D, 0xD2, 0x49,
+    0x22, 0x47, 0xBA, 0x8C, 0xB3, 0xC8, 0x4E, 0x25, 0x6B, 0xAD, 0x58, 0x88, 0xBA, 0xD0, 0x54, 0x76,
+    0xAD, 0x7C, 0x10, 0x55, 0x12, 0x3D, 0x3D, 0x00, 0xCE, 0x01, 0xD1, 0xCD, 0x03, 0x60, 0x6F, 0x11,
+    0x6D, 0xBE, 0x01, 0xB0, 0x1F, 0xE5, 0x1D, 0xBF, 0x2D, 0x00, 0xF6, 0x19, 0xFE, 0x3D, 0x2C, 0x00,
+    0xF6, 0x1E, 0xF8, 0x6A, 0x01, 0xB0, 0x37, 0xC0, 0x4B, 0x11, 0x2B, 0xB5, 0x6F, 0xED, 0xAE, 0x17,
+    0x02, 0x60, 0x9F, 0x18, 0xDF, 0x71, 0x67, 0x8A, 0x1E, 0x27, 0x04, 0x64, 0x3F, 0x93, 0x68, 0x21,
+    0xBC, 0xB7, 0x63, 0xA3, 0x98, 0xCC, 0xD0, 0x39, 0x19, 0xB7, 0x9D, 0x2B, 0xC5, 0xB3, 0xA3, 0x76,
+    0x66, 0x9E, 0xFF, 0x58, 0x3B, 0x73, 0x3F, 0x18, 0x9D, 0xB9, 0x19, 0x8C, 0xCE, 0xBB, 0x40, 0x0D,
+    0x28, 0xFF, 0x93, 0x3F, 0x34, 0xEA, 0xCE, 0x71, 0x78, 0x9C, 0xAD, 0xD0, 0xEB, 0x0D, 0xC1, 0x60,
+    0x18, 0xC5, 0xF1, 0x52, 0xB7, 0x44, 0x89, 0x09, 0x18, 0xA1, 0x36, 0x40, 0xD2, 0x01, 0x8C, 0x62,
+    0x03, 0x36, 0x60, 0x03, 0x36, 0x60, 0x03, 0x23, 0xE8, 0x06, 0x22, 0xB1, 0x80, 0x4B, 0xC5, 0xA5,
+    0x2E, 0xFF, 0x37, 0x3C, 0x27, 0xF5, 0xBD, 0xE7, 0xDB, 0x2F, 0xE7, 0x49, 0xDE, 0xBC, 0x27, 0x79,
+    0x67, 0x52, 0x4A, 0x72, 0xD0, 0xD6, 0x1B, 0x44, 0xDF, 0xEC, 0x51, 0xCF, 0xB3, 0x5C, 0x51, 0xCD,
+    0xD0, 0x05, 0x1B, 0x55, 0x31, 0x0A, 0xA5, 0x1B, 0xAA, 0x1A, 0xFA, 0x60, 0xAD, 0x6A, 0x87, 0x3A,
+    0xD2, 0x1D, 0x55, 0x0C, 0xC3, 0xBF, 0xC3, 0x03, 0x6A, 0x4B, 0x0F, 0x54, 0x36, 0x8C, 0xC0, 0x52,
+    0xD5, 0x11, 0x35, 0xA5, 0xD4, 0x7D, 0xC6, 0x30, 0x01, 0x73, 0x55, 0x27, 0xD4, 0x90, 0x9E, 0xC8,
+    0x37, 0xCC, 0xC0, 0x54, 0xD5, 0x19, 0x05, 0xD2, 0x0B, 0x15, 0x0D, 0x0B, 0x30, 0x56, 0xE5, 0x46,
+    0xAB, 0x1B, 0x5A, 0xEE, 0xB0, 0x60, 0x5A, 0xB9, 0xA7, 0x7F, 0x2B, 0x46, 0xFE, 0x25, 0xBB, 0x75,
+    0x90, 0xE6, 0xA2, 0x0F, 0xD4, 0x7E, 0x00, 0x6C, 0x78, 0x9C, 0xFB, 0xF1, 0x1F, 0x04, 0x58, 0x7F,
+    0xE0, 0xA7, 0x74, 0x95, 0x94, 0x18, 0x80, 0x14, 0x2F, 0x03, 0xC3, 0xB0, 0xA6, 0xA0, 0xDE, 0x24,
+    0x14, 0x20, 0x00, 0x36, 0x14, 0xA2, 0xDF, 0x78, 0x9C, 0x75, 0xD0, 0xE9, 0x0D, 0x41, 0x61, 0x14,
+    0x84, 0x61, 0xBB, 0xD8, 0x75, 0x70, 0x75, 0x40, 0x07, 0x74, 0x40, 0x07, 0x74, 0x40, 0x07, 0x74,
+    0x40, 0x07, 0x74, 0x70, 0x75, 0x40, 0x07, 0x74, 0x40, 0x07, 0x76, 0xAE, 0xF5, 0x75, 0xE4, 0x1B,
+    0xB9, 0x7F, 0x38, 0xBF, 0x9E, 0x4C, 0x26, 0x39, 0xC9, 0x04, 0x50, 0x8F, 0xB8, 0xDB, 0xC3, 0x58,
+    0x9C, 0x03, 0x62, 0xC7, 0x98, 0x74, 0x2C, 0x1B, 0x73, 0x8A, 0x6F, 0xE0, 0x89, 0x47, 0xE8, 0x8B,
+    0x6B, 0x58, 0x89, 0x23, 0x2B, 0xC7, 0x1D, 0x6B, 0xC6, 0x8C, 0xE2, 0x27, 0x14, 0xC5, 0x0B, 0x34,
+    0xC5, 0x1D, 0xF8, 0xE2, 0xD4, 0xCA, 0x51, 0xC7, 0x96, 0x31, 0xA5, 0xD8, 0x98, 0x17, 0xAF, 0x50,
+    0x15, 0x0F, 0x30, 0x14, 0x97, 0xB0, 0x11, 0x07, 0x56, 0x4E, 0x38, 0x56, 0x8C, 0x59, 0xC5, 0x0F,
+    0x28, 0x89, 0x67, 0x68, 0x8B, 0x5B, 0x98, 0x89, 0x93, 0xF0, 0x75, 0xC3, 0x98, 0x56, 0xFC, 0x82,
+    0x82, 0x18, 0xFC, 0x5B, 0xEB, 0xFB, 0xBA, 0xF7, 0x7B, 0xAD, 0x7B, 0xB8, 0xD6, 0x09, 0xBA, 0xA2,
+    0xAD, 0xB5, 0x10, 0x3F, 0x6B, 0xC5, 0xDE, 0x92, 0x6D, 0x79, 0xAC, 0x78, 0x9C, 0xFB, 0xF3, 0x1F,
+    0x04, 0x18, 0xFF, 0xE0, 0xA1, 0x14, 0x95, 0x92, 0x40, 0x14, 0x03, 0x43, 0xC0, 0xB0, 0xA6, 0xA0,
+    0xDE, 0xC4, 0x17, 0x12, 0x50, 0x0A, 0x00, 0x06, 0x9F, 0xAC, 0xB7, 0x78, 0x9C, 0x55, 0xCF, 0xDF,
+    0x11, 0xC1, 0x40, 0x10, 0xC7, 0xF1, 0x23, 0xE3, 0x4F, 0x32, 0x68, 0x81, 0x0E, 0xE8, 0x80, 0x0E,
+    0xE8, 0x84, 0x0E, 0xD2, 0x82, 0x0E, 0xA4, 0x04, 0x2F, 0x9E, 0xA3, 0x03, 0x2D, 0xE8, 0x20, 0x83,
+    0x61, 0x08, 0xF2, 0xB5, 0xB7, 0x77, 0x97, 0x8C, 0x7D, 0xD9, 0xFB, 0xCC, 0xDC, 0xED, 0xFE, 0xCE,
+    0x18, 0xA9, 0x3B, 0x89, 0x69, 0xEA, 0xC3, 0xBC, 0xC1, 0x02, 0xF2, 0x46, 0x7B, 0x20, 0xAA, 0x75,
+    0x13, 0x0D, 0x6A, 0x95, 0xA2, 0x65, 0xC0, 0x44, 0xC0, 0x29, 0x68, 0x0B, 0x15, 0x74, 0xBC, 0x2E,
+    0x70, 0x80, 0xA1, 0xD7, 0x93, 0x62, 0x06, 0x6B, 0xAF, 0x8A, 0x54, 0x06, 0x15, 0x0E, 0x1B, 0x18,
+    0x9B, 0x2B, 0xF4, 0x54, 0x67, 0x88, 0x4D, 0x06, 0x23, 0xD5, 0x03, 0xDA, 0x76, 0x4B, 0xAA, 0xFA,
+    0x6A, 0x48, 0x49, 0xD0, 0x92, 0xB6, 0x72, 0x39, 0xE4, 0x61, 0x5F, 0xDA, 0xD1, 0xAD, 0xCA, 0xEC,
+    0x2C, 0x8D, 0xDC, 0x75, 0xF1, 0x76, 0xD2, 0xDE, 0x7E, 0x53, 0xF9, 0x37, 0x4C, 0x1E, 0x26, 0xE1,
+    0xBE, 0x66, 0x9F, 0xDA, 0xC8, 0x71, 0xF8, 0x57, 0x6E, 0x5E, 0xF6, 0xBA, 0x96, 0x9C, 0xA2, 0x1F,
+    0x88, 0x69, 0x72, 0x23, 0x78, 0x9C, 0x4B, 0x48, 0x83, 0x01, 0xB7, 0x8F, 0xFF, 0x61, 0x60, 0x3D,
+    0x76, 0x26, 0x00, 0xC5, 0xE3, 0x24, 0x02, 0x78, 0x9C, 0xFB, 0xF3, 0xFF, 0xFF, 0x7F, 0x1E, 0x06,
+    0x06, 0x86, 0x83, 0x40, 0xBA, 0x1E, 0x48, 0x33, 0xFC, 0x02, 0x32, 0x98, 0x81, 0x74, 0x03, 0x90,
+    0x96, 0x03, 0x09, 0x7C, 0xFD, 0xFF, 0xFF, 0x3C, 0x88, 0x56, 0xF8, 0xFB, 0xFF, 0x3F, 0x27, 0x88,
+    0xB1, 0x01, 0xAA, 0x92, 0xE1, 0xFB, 0xFF, 0xFF, 0x4C, 0x00, 0xF3, 0xE6, 0x1C, 0xE2, 0x78, 0x9C,
+    0x63, 0x60, 0x60, 0x08, 0xDC, 0xF1, 0xF6, 0xFF, 0xBD, 0x2A, 0x26, 0x06, 0x10, 0xD8, 0xFA, 0x1F,
+    0x0C, 0xCE, 0x33, 0x03, 0xD9, 0x8F, 0xFE, 0x43, 0x41, 0x3F, 0x90, 0x73, 0x01, 0xC6, 0xF9, 0xCF,
+    0xC1, 0xC0, 0x10, 0x00, 0xE7, 0xD8, 0x03, 0xA5, 0xFE, 0xFE, 0xFF, 0x3F, 0x67, 0xC6, 0x1F, 0x20,
+    0x67, 0x3F, 0x90, 0xF3, 0xAD, 0x0F, 0xA8, 0xD5, 0x00, 0x24, 0x05, 0xE4, 0x04, 0x80, 0xCD, 0xFC,
+    0x06, 0xE4, 0x30, 0x33, 0x40, 0xC1, 0x47, 0x20, 0x87, 0x15, 0xC6, 0xF9, 0x00, 0xE4, 0xB0, 0x21,
+    0x73, 0xD8, 0x81, 0xB4, 0xE3, 0xF2, 0xD3, 0x6F, 0xFF, 0xFD, 0x87, 0x70, 0xB6, 0xC2, 0x2D, 0x62,
+    0x67, 0x38, 0xF4, 0x1F, 0xC1, 0x31, 0xF8, 0x87, 0xC4, 0x01, 0x3B, 0x6D, 0x7F, 0x65, 0xDA, 0x57,
+    0x10, 0x07, 0x44, 0xD4, 0xC3, 0x4C, 0xFB, 0x05, 0xB5, 0x0C, 0xCC, 0x01, 0xBA, 0xF0, 0x3D, 0xCC,
+    0x05, 0xEC, 0x40, 0xFD, 0xE7, 0x41, 0x1C, 0xB0, 0x9E, 0xBF, 0x10, 0x19, 0x81, 0xBF, 0x20, 0xCE,
+    0x6F, 0x88, 0x9B, 0x2E, 0x81, 0x8D, 0xFE, 0x01, 0x0A, 0x8B, 0x8A, 0x13, 0x10, 0x7B, 0x3E, 0x41,
+    0x2D, 0x7C, 0x0F, 0xE2, 0x2C, 0x80, 0x72, 0xF4, 0x80, 0x26, 0xB1, 0x83, 0x75, 0x02, 0x25, 0x98,
+    0x7E, 0x82, 0x1C, 0xBA, 0x10, 0xCC, 0x91, 0x62, 0xF8, 0x02, 0xF6, 0xC2, 0xE4, 0x37, 0xFF, 0xCF,
+    0x69, 0x30, 0x30, 0x3C, 0x00, 0x72, 0x00, 0x6F, 0xD1, 0xE4, 0x5C, 0x78, 0x9C, 0xFB, 0xF8, 0xFF,
+    0xFF, 0x7F, 0x56, 0x06, 0x18, 0xF8, 0x38, 0xE0, 0x3C, 0x16, 0x86, 0xA5, 0x6F, 0xEF, 0x67, 0xC3,
+    0x78, 0xCC, 0x97, 0x81, 0xC4, 0xFF, 0x38, 0x28, 0x2F, 0xE8, 0x3F, 0x18, 0x70, 0x40, 0x78, 0x5F,
+    0x21, 0xBC, 0x7C, 0x08, 0x0F, 0x06, 0x98, 0x50, 0x78, 0x5C, 0x10, 0x5E, 0x2C, 0x63, 0xC0, 0x3F,
+    0x20, 0x25, 0x0F, 0xE6, 0x9D, 0x07, 0x9A, 0x76, 0x11, 0x48, 0xD7, 0x83, 0x79, 0xFA, 0x40, 0x9E,
+    0x03, 0x58, 0x14, 0xC4, 0xE3, 0x05, 0x59, 0xFC, 0x17, 0xC8, 0x00, 0xF3, 0x38, 0x41, 0xBC, 0x1F,
+    0x20, 0x43, 0x41, 0x3C, 0x76, 0x10, 0x0F, 0x64, 0x29, 0x0B, 0x88, 0xC7, 0x06, 0xE2, 0x7D, 0x81,
+    0xF1, 0xC0, 0x7E, 0xF8, 0x0C, 0x62, 0xC0, 0xE5, 0x50, 0x79, 0x70, 0x95, 0x1C, 0x20, 0xDE, 0x37,
+    0x90, 0xD7, 0x3E, 0x82, 0xDD, 0x07, 0x04, 0x3F, 0x61, 0x36, 0xF0, 0x81, 0x78, 0xFF, 0x60, 0xB6,
+    0xC7, 0x03, 0x39, 0x01, 0x70, 0x97, 0xBD, 0x67, 0x64, 0x60, 0x78, 0x04, 0x77, 0xF5, 0xFF, 0x3A,
+    0xA6, 0x44, 0x84, 0x8F, 0xD0, 0x7C, 0x0B, 0x05, 0x8C, 0x20, 0xDE, 0xFB, 0xDF, 0xC8, 0xA1, 0x54,
+    0xBF, 0x00, 0xC2, 0x63, 0x07, 0xF3, 0xF4, 0x19, 0xBE, 0x83, 0x38, 0xBE, 0x90, 0xD0, 0xE5, 0x61,
+    0x10, 0xD8, 0xF6, 0xF7, 0x7E, 0x14, 0xC8, 0x09, 0x00, 0x8E, 0x6F, 0x26, 0x16, 0x78, 0x9C, 0x6D,
+    0xCF, 0x3D, 0x0E, 0xC1, 0x41, 0x10, 0x05, 0xF0, 0xE7, 0x33, 0x12, 0x8D, 0x13, 0xB0, 0x1A, 0x2D,
+    0x2E, 0x82, 0x23, 0x70, 0x00, 0x95, 0x0B, 0xB8, 0x81, 0x4A, 0xA5, 0x51, 0xA9, 0xFE, 0xB5, 0x56,
+    0x9C, 0x80, 0x4A, 0xA3, 0x70, 0x02, 0x59, 0x82, 0xF8, 0x4A, 0x76, 0xCC, 0xCE, 0xEE, 0x26, 0x53,
+    0x98, 0xEA, 0x57, 0xEC, 0xBC, 0x7D, 0x03, 0x00, 0x93, 0xA3, 0xB3, 0x59, 0x0B, 0x7E, 0x0E, 0x24,
+    0x33, 0x66, 0x6E, 0x03, 0xC9, 0x02, 0xC6, 0x45, 0xCF, 0x80, 0x7D, 0x24, 0xB5, 0x81, 0x4F, 0x72,
+    0x15, 0x46, 0xD6, 0x72, 0xDD, 0x35, 0x95, 0xB0, 0x64, 0xEE, 0x7C, 0xDA, 0x08, 0xB8, 0xB0, 0x1B,
+    0x08, 0x73, 0x63, 0x57, 0xA2, 0x9F, 0xEC, 0x42, 0xF4, 0x9B, 0x1D, 0xE9, 0x23, 0x6D, 0xF2, 0x97,
+    0xE8, 0xF4, 0xCF, 0xFA, 0x8D, 0xDE, 0x7D, 0xA9, 0xCC, 0x87, 0xFA, 0xEB, 0xCA, 0xAE, 0x8B, 0x6A,
+    0x52, 0x7F, 0xE3, 0x39, 0xE8, 0x61, 0x28, 0x9D, 0xF3, 0xCD, 0xB9, 0xEB, 0x03, 0xE9, 0x44, 0x62,
+    0xDF, 0x95, 0xA7, 0xCA, 0xD2, 0x3A, 0xB9, 0x13, 0xAE, 0xB7, 0x65, 0x9F, 0x66, 0x56, 0x67, 0xB2,
+    0x8B, 0x22, 0xF0, 0x03, 0x8B, 0x68, 0xA4, 0x1B, 0x78, 0x9C, 0xBD, 0xD0, 0x41, 0x0E, 0xC1, 0x40,
+    0x14, 0x06, 0xE0, 0xA1, 0x22, 0x36, 0xA4, 0x71, 0x02, 0x27, 0x70, 0x00, 0x2B, 0x57, 0xB0, 0x97,
+    0xB8, 0x42, 0xDD, 0x40, 0x38, 0x00, 0x07, 0x70, 0x05, 0x49, 0x6F, 0x50, 0x37, 0x18, 0xF6, 0x92,
+    0x5E, 0x40, 0xD2, 0xA0, 0x8A, 0x6A, 0xF3, 0xFC, 0xFF, 0x8C, 0x56, 0xC3, 0xDE, 0x5B, 0xBC, 0xCC,
+    0xD7, 0x34, 0xEF, 0xFD, 0x33, 0x4A, 0xBD, 0xEB, 0x29, 0xA2, 0xD5, 0xBF, 0x91, 0x5A, 0x4C, 0x0F,
+    0xD1, 0xA6, 0xA1, 0x1E, 0x06, 0x33, 0x41, 0x85, 0xCE, 0xDD, 0x20, 0x23, 0x64, 0x92, 0x10, 0xBE,
+    0xD8, 0xBA, 0x11, 0x89, 0x94, 0xA5, 0x5D, 0xA9, 0xC0, 0x63, 0x1F, 0x77, 0x17, 0x06, 0x3B, 0xB4,
+    0x00, 0xF3, 0xF7, 0xC4, 0x09, 0xAD, 0x03, 0x0C, 0x89, 0x18, 0xAD, 0xC5, 0x04, 0x39, 0x80, 0x89,
+    0xE2, 0x10, 0x5C, 0x8A, 0x14, 0x62, 0xB2, 0x71, 0x29, 0xF2, 0x45, 0x06, 0xF8, 0x5F, 0x23, 0x79,
+    0x68, 0x70, 0xF9, 0x46, 0x5A, 0x20, 0xAE, 0x0E, 0xB8, 0x02, 0x98, 0x28, 0x75, 0x82, 0xA9, 0xF1,
+    0x41, 0x9A, 0xC5, 0x1B, 0x9C, 0x81, 0x36, 0xCE, 0xBD, 0x22, 0xE8, 0x12, 0xF0, 0xCB, 0x2B, 0x0C,
+    0xD4, 0x28, 0xFB, 0xB9, 0x1C, 0xA7, 0x7C, 0xB0, 0xB5, 0x87, 0x90, 0x4B, 0x95, 0x9B, 0x1B, 0xF4,
+    0x77, 0xE6, 0xDD, 0x56, 0x3C, 0x07, 0x35, 0xCF, 0x3E, 0xEF, 0xFC, 0x18, 0xAD, 0x1D, 0x2E, 0xD2,
+    0x2F, 0xBE, 0x16, 0x20, 0xAC, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x68, 0xB9, 0xF3, 0xFF, 0x5E,
+    0x16, 0x23, 0x03, 0x18, 0x3C, 0xFB, 0x0F, 0x02, 0xF3, 0xC1, 0xBC, 0x83, 0xFF, 0x21, 0xC0, 0x0F,
+    0xC8, 0x56, 0xF8, 0x07, 0xE5, 0xFC, 0x67, 0x65, 0x60, 0xB8, 0x00, 0x63, 0xFF, 0xD7, 0x67, 0x60,
+    0xF8, 0x05, 0xA4, 0xFA, 0x42, 0x8F, 0x03, 0xC9, 0xF3, 0x0C, 0x0A, 0x20, 0x12, 0xA8, 0xF7, 0x1B,
+    0x90, 0x66, 0x99, 0x00, 0x24, 0xE4, 0x80, 0x5A, 0x1B, 0x80, 0x34, 0xD7, 0x07, 0x20, 0xC1, 0x0E,
+    0xE4, 0x08, 0x00, 0x69, 0xBE, 0xCF, 0x40, 0x82, 0x19, 0x64, 0xC3, 0x1F, 0xA0, 0x09, 0x20, 0xB5,
+    0x60, 0xAB, 0x81, 0x06, 0xF9, 0xFF, 0xFC, 0x8F, 0x00, 0xF1, 0xBF, 0x90, 0x38, 0xF9, 0xBF, 0x71,
+    0x72, 0x90, 0x95, 0xC5, 0x03, 0x0D, 0xB8, 0xCF, 0x00, 0x03, 0xDF, 0x61, 0x46, 0x83, 0x00, 0xC8,
+    0x52, 0x16, 0x18, 0x07, 0xE4, 0x1C, 0x1E, 0x18, 0x07, 0xE4, 0xD0, 0x7A, 0x08, 0x33, 0x11, 0xEC,
+    0x85, 0xFF, 0x5A, 0x20, 0x97, 0x6E, 0x03, 0x1A, 0x04, 0x76, 0xCF, 0x9C, 0x99, 0xBB, 0xFE, 0x81,
+    0x4C, 0x3D, 0x00, 0xB7, 0x06, 0xC8, 0x11, 0xF8, 0x83, 0xC4, 0x01, 0x1B, 0x01, 0xE7, 0x30, 0x6C,
+    0x86, 0x72, 0xAC, 0x20, 0x66, 0x9E, 0xFC, 0xF7, 0xFF, 0x5E, 0x37, 0xD0, 0x6A, 0x00, 0x3A, 0x45,
+    0xDF, 0x0B, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x28, 0xBC, 0xF5, 0xEF, 0xFD, 0x5A, 0x73, 0x20,
+    0x83, 0x61, 0xC2, 0x7F, 0x30, 0x60, 0x07, 0x32, 0xFF, 0x42, 0x98, 0x4C, 0x70, 0xC1, 0xF3, 0x40,
+    0xC1, 0x4F, 0x10, 0x66, 0x3E, 0x90, 0xF9, 0x1D, 0xC2, 0x94, 0x07, 0x32, 0x7F, 0x01, 0x69, 0x29,
+    0x86, 0x40, 0x36, 0x20, 0xF3, 0xCF, 0xFF, 0xFF, 0xEF, 0x19, 0x20, 0x00, 0x68, 0xC0, 0x7A, 0x28,
+    0xF3, 0xDF, 0xFF, 0xFF, 0xFD, 0x18, 0xCC, 0xCD, 0x10, 0x03, 0xFE, 0x23, 0x58, 0x40, 0xE6, 0x7F,
+    0x42, 0xCC, 0x99, 0x33, 0x81, 0xD4, 0xFD, 0x99, 0x33, 0x67, 0xE2, 0x34, 0x77, 0xB8, 0x31, 0x01,
+    0x83, 0x9B, 0xB6, 0xF8, 0x78, 0x9C, 0x4D, 0x90, 0x3B, 0x4E, 0x03, 0x41, 0x10, 0x44, 0x6B, 0x31,
+    0xC6, 0xFC, 0xB5, 0x09, 0x31, 0xBE, 0x01, 0x21, 0x42, 0x42, 0xE2, 0x00, 0x0E, 0x4C, 0x4A, 0xB4,
+    0x3E, 0x87, 0x13, 0x3B, 0x21, 0x20, 0x82, 0x04, 0x02, 0x84, 0x04, 0x37, 0x40, 0x04, 0xA4, 0x18,
+    0x2E, 0x00, 0x9C, 0x00, 0x93, 0x91, 0x18, 0x46, 0xE6, 0x63, 0xE4, 0xCF, 0xAA, 0xA9, 0xEE, 0x99,
+    0x1D, 0xB6, 0xA5, 0x9D, 0xD9, 0x37, 0x9F, 0x9A, 0xAA, 0x06, 0x80, 0xC3, 0x81, 0xDC, 0x6D, 0x23,
+    0xD4, 0x9B, 0x14, 0x75, 0x0D, 0x3C, 0x48, 0x99, 0x66, 0x65, 0xEA, 0x72, 0x74, 0x47, 0x13, 0xA3,
+    0x4B, 0x0C, 0x39, 0x2E, 0x21, 0xE5, 0x09, 0x77, 0x90, 0x60, 0x24, 0xD2, 0xA7, 0xD4, 0xA7, 0x48,
+    0x8F, 0xD3, 0x58, 0xE4, 0x98, 0xD3, 0x3D, 0x8F, 0x54, 0x80, 0xA9, 0x48, 0x46, 0x3A, 0x21, 0xD5,
+    0x4C, 0xB2, 0x19, 0x68, 0x31, 0xEE, 0x5D, 0xF9, 0xBD, 0x70, 0xEF, 0x99, 0xB4, 0x00, 0xFC, 0x50,
+    0x9A, 0xF4, 0x45, 0x4A, 0x80, 0x57, 0x4E, 0xCB, 0x48, 0x73, 0x91, 0x27, 0x2E, 0xB6, 0xD4, 0xCB,
+    0xB9, 0x7A, 0xD9, 0xD3, 0x08, 0x93, 0xC2, 0x65, 0x4D, 0xA9, 0x1B, 0xA0, 0xE3, 0xF3, 0x8D, 0x0D,
+    0x7A, 0x73, 0x06, 0xCC, 0xF7, 0x21, 0x2F, 0x6D, 0x0F, 0xC8, 0x4D, 0x2C, 0x54, 0x2B, 0xDE, 0x80,
+    0x37, 0xD8, 0xDF, 0x88, 0x54, 0x48, 0xBA, 0x8B, 0x2A, 0xA9, 0x1E, 0xBB, 0xE2, 0x14, 0x47, 0x11,
+    0x3B, 0xC1, 0x5A, 0xA8, 0x0A, 0xF6, 0xF3, 0x7F, 0x5A, 0xD5, 0xB4, 0xB1, 0x36, 0x35, 0x73, 0x83,
+    0xC1, 0xEA, 0xB7, 0x9A, 0xE2, 0x3B, 0x3E, 0xCE, 0x2C, 0x19, 0xBF, 0x35, 0x4F, 0x5C, 0x6F, 0xCE,
+    0xB4, 0xD3, 0x56, 0x6C, 0xC9, 0x16, 0x15, 0x57, 0x3C, 0x71, 0x7D, 0x7D, 0xEA, 0xDB, 0x09, 0xDC,
+    0x68, 0x43, 0x7F, 0x39, 0xEC, 0x00, 0xE9, 0xA9, 0x5A, 0x4B, 0x86, 0xE6, 0xF0, 0xDD, 0x9E, 0xCB,
+    0xCA, 0xBE, 0xA4, 0x5A, 0x36, 0xBD, 0xAB, 0x89, 0x8A, 0x0E, 0x36, 0x4C, 0x2C, 0x3D, 0x1B, 0x88,
+    0x7B, 0x6C, 0xCF, 0xEB, 0xFF, 0x1F, 0x6B, 0xCA, 0x42, 0x48, 0x78, 0x9C, 0xFB, 0xF8, 0xFF, 0xFF,
+    0x7F, 0x56, 0x06, 0x18, 0xF8, 0x38, 0x00, 0x3C, 0x16, 0x34, 0xDE, 0x92, 0xB7, 0xEF, 0xE7, 0xB2,
+    0x42, 0x79, 0xCC, 0x97, 0x81, 0xC4, 0xFF, 0xFB, 0x2C, 0x10, 0x5E, 0xD0, 0x7F, 0x30, 0xA8, 0x87,
+    0xF0, 0xBE, 0x40, 0x78, 0x40, 0x1D, 0x1F, 0xFF, 0x23, 0x00, 0x1F, 0x0A, 0x2F, 0x1E, 0xC2, 0x9B,
+    0xCF, 0x2C, 0xF0, 0x03, 0x48, 0xAD, 0x87, 0xF0, 0x80, 0xA6, 0x15, 0x00, 0xA9, 0xF7, 0x60, 0x5E,
+    0x3F, 0xC8, 0xE2, 0x7F, 0x40, 0x06, 0x98, 0x27, 0x0F, 0xE2, 0xFD, 0x04, 0x32, 0x18, 0x41, 0x3C,
+    0x5E, 0x10, 0xEF, 0x1B, 0x8C, 0xC7, 0x09, 0xE2, 0x7D, 0x85, 0xF1, 0xD8, 0x51, 0x78, 0x6C, 0x78,
+    0x78, 0xAC, 0x43, 0x8E, 0x07, 0x00, 0xE3, 0x8F, 0x19, 0x5E, 0x78, 0x9C, 0x13, 0xB8, 0xF9, 0x5E,
+    0x8B, 0xE1, 0xC0, 0xFF, 0xFF, 0xFF, 0x19, 0x3F, 0x03, 0x09, 0x8E, 0xAF, 0x40, 0x82, 0xEB, 0x0B,
+    0x90, 0xE0, 0x7C, 0x00, 0x24, 0x58, 0x0C, 0xFE, 0xFE, 0xAF, 0x67, 0x60, 0x50, 0x30, 0x61, 0x40,
+    0x07, 0x1F, 0x81, 0xB2, 0xAC, 0x03, 0x4F, 0x00, 0x00, 0x18, 0x89, 0x83, 0x30, 0x78, 0x9C, 0x63,
+    0x60, 0x60, 0x60, 0x98, 0xF8, 0x77, 0x1D, 0x13, 0x90, 0x62, 0xF8, 0xF3, 0xFF, 0xBF, 0x3C, 0x90,
+    0x32, 0xF8, 0xFF, 0xFF, 0x7F, 0x3F, 0x90, 0x0E, 0x00, 0xD2, 0xEB, 0x81, 0xB4, 0x03, 0x90, 0x9E,
+    0x0F, 0x92, 0xFF, 0xF7, 0xFF, 0xBF, 0x3F, 0x88, 0xBE, 0xFC, 0xFF, 0x3F, 0x3B, 0x88, 0x66, 0x70,
+    0x62, 0x66, 0xC0, 0x03, 0x04, 0x80, 0xFA, 0xE2, 0x47, 0x00, 0xAD, 0x00, 0xA5, 0x1D, 0xA0, 0xF4,
+    0x06, 0x20, 0x6D, 0x1F, 0xC8, 0xA4, 0xF0, 0x13, 0x48, 0xCB, 0x7F, 0xFE, 0x0F, 0x06, 0xBC, 0x50,
+    0x9A, 0x0D, 0x42, 0x9F, 0x67, 0x80, 0xD0, 0xB2, 0x10, 0x1A, 0x18, 0xCA, 0x8D, 0xB7, 0xFF, 0xBD,
+    0xAF, 0x66, 0x64, 0x60, 0x00, 0x00, 0xE8, 0x13, 0xAE, 0x34, 0x78, 0x9C, 0xFB, 0xF8, 0xFF, 0xFF,
+    0x7F, 0x56, 0x06, 0x18, 0xF8, 0x38, 0x18, 0x79, 0x3F, 0x80, 0x0C, 0x59, 0x18, 0xAF, 0x00, 0x48,
+    0xDF, 0x67, 0x84, 0xF1, 0xBE, 0x01, 0x69, 0x3D, 0x98, 0xCA, 0x00, 0x20, 0xF5, 0x9E, 0x09, 0xC6,
+    0xFB, 0x02, 0xA4, 0xEC, 0x61, 0xA6, 0x18, 0x00, 0xC9, 0xFF, 0x2C, 0x30, 0xDE, 0x23, 0x20, 0x19,
+    0x0F, 0xB5, 0x81, 0x45, 0xE1, 0x1F, 0x90, 0x64, 0x83, 0xF2, 0x98, 0x2F, 0x02, 0x89, 0x7A, 0x98,
+    0xED, 0x4C, 0xBF, 0x81, 0x04, 0x07, 0x8C, 0xD7, 0x08, 0xC4, 0xF3, 0xE1, 0x2E, 0xFB, 0x0A, 0xC4,
+    0x3C, 0x70, 0x1E, 0x08, 0xE8, 0xA3, 0xF0, 0xCE, 0xA3, 0xF0, 0xFE, 0x73, 0xA2, 0xF0, 0xE2, 0xE1,
+    0xBC, 0x58, 0x10, 0xC1, 0x04, 0xE5, 0xED, 0x67, 0xFC, 0x0E, 0x24, 0x79, 0xA1, 0x3C, 0x4E, 0x86,
+    0x0D, 0x50, 0x1B, 0x21, 0xAE, 0x16, 0xF8, 0x07, 0xF1, 0x18, 0x92, 0xFF, 0xF4, 0xE1, 0xBC, 0x09,
+    0xA0, 0x60, 0x41, 0x84, 0xD9, 0x5F, 0xB0, 0x7E, 0x18, 0xEF, 0x13, 0xD8, 0x4A, 0x18, 0x2F, 0x01,
+    0x6C, 0x25, 0x3C, 0x74, 0x7F, 0x81, 0xAC, 0x84, 0xF3, 0x1E, 0x82, 0xAC, 0x04, 0x00, 0x77, 0xC3,
+    0x0B, 0x64, 0x78, 0x9C, 0xFB, 0xF8, 0xFF, 0xFF, 0x7F, 0xD6, 0x8F, 0x43, 0x95, 0x00, 0x00, 0x45,
+    0xCD, 0x96, 0x13, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x02, 0x81, 0xED, 0xFF, 0xEE, 0xF7, 0x30, 0x03,
+    0x19, 0x85, 0xAF, 0xFF, 0x9F, 0xD3, 0x00, 0xD2, 0x1F, 0xFF, 0xFF, 0xE7, 0x61, 0xF8, 0xFE, 0x1F,
+    0x08, 0xF6, 0x33, 0x32, 0x4C, 0x00, 0xD1, 0xFF, 0xA5, 0xC1, 0xA2, 0xF2, 0x1B, 0xC0, 0x9C, 0xFF,
+    0x7A, 0x02, 0x7F, 0xC1, 0xF4, 0x7B, 0x46, 0x90, 0x68, 0xFE, 0x4F, 0x88, 0xE8, 0x7D, 0xA8, 0x2C,
+    0x50, 0xF3, 0xC7, 0xFF, 0x98, 0x20, 0x1E, 0xAB, 0xE8, 0x7E, 0x88, 0x68, 0x3D, 0xA3, 0xC3, 0x3F,
+    0xB0, 0x89, 0x62, 0x0C, 0x4F, 0x41, 0x34, 0x44, 0x94, 0x89, 0x81, 0xE1, 0x13, 0xD8, 0x3E, 0x06,
+    0x06, 0x05, 0x30, 0x1F, 0x24, 0x5A, 0x0F, 0x74, 0x21, 0xD8, 0x51, 0x6C, 0x40, 0x06, 0xC8, 0x6A,
+    0x16, 0x90, 0x28, 0x3F, 0x90, 0x13, 0x00, 0xD6, 0x09, 0x04, 0x5F, 0x81, 0x34, 0xEB, 0x47, 0xB0,
+    0x4B, 0x20, 0x3A, 0xF7, 0x83, 0x44, 0x3F, 0xC3, 0x44, 0x39, 0x41, 0x9E, 0x06, 0xD2, 0xFD, 0x20,
+    0xD1, 0x4F, 0x30, 0x51, 0x76, 0xA8, 0x68, 0x3E, 0x03, 0x24, 0x08, 0x20, 0xA2, 0x6C, 0x50, 0xD1,
+    0x78, 0x22, 0x44, 0x59, 0x47, 0x45, 0x71, 0x88, 0x02, 0x00, 0x7A, 0x78, 0x65, 0xFA, 0x78, 0x9C,
+    0x63, 0x60, 0x00, 0x81, 0x65, 0x7F, 0xDF, 0xCF, 0x65, 0x05, 0xD2, 0x1F, 0xFF, 0xFF, 0xE7, 0x61,
+    0x78, 0xF6, 0x1F, 0x08, 0xDE, 0xB3, 0x82, 0x79, 0xF2, 0x0B, 0xFE, 0x83, 0x41, 0x3D, 0x98, 0x97,
+    0xFF, 0x03, 0xC2, 0xFB, 0xCF, 0x0A, 0xE2, 0xC1, 0x01, 0x1F, 0x0A, 0x2F, 0x1E, 0xC2, 0xEB, 0x67,
+    0x16, 0xF8, 0x0E, 0xA4, 0xD6, 0x43, 0x78, 0x2C, 0x0C, 0x0C, 0x09, 0x20, 0x53, 0xC1, 0xBC, 0x7E,
+    0x90, 0x95, 0x7F, 0x81, 0x0C, 0x30, 0x4F, 0x1E, 0xC4, 0xFB, 0x09, 0x64, 0x30, 0x82, 0x78, 0x3C,
+    0x20, 0xDE, 0x37, 0x18, 0x8F, 0x13, 0xC4, 0xFB, 0x0A, 0xE3, 0xB1, 0xA3, 0xF0, 0xD8, 0xF0, 0xF0,
+    0x58, 0x87, 0x1C, 0x0F, 0x00, 0xF2, 0x38, 0xEB, 0xE0, 0x78, 0x9C, 0x55, 0x90, 0x41, 0x0E, 0xC1,
+    0x50, 0x10, 0x86, 0xA7, 0x08, 0x55, 0x21, 0x3D, 0x00, 0xD1, 0xAB, 0x58, 0xB3, 0x71, 0x16, 0xCB,
+    0x6E, 0x24, 0x0E, 0xC0, 0x0D, 0xB8, 0x81, 0x23, 0x20, 0xB1, 0xAF, 0x8D, 0x95, 0x44, 0xED, 0x2D,
+    0x10, 0xA2, 0x54, 0xD3, 0xF1, 0xCF, 0x6B, 0xFB, 0x78, 0xFF, 0xE2, 0x9F, 0xF9, 0x92, 0x99, 0x79,
+    0x33, 0x8F, 0x88, 0x68, 0x74, 0x48, 0x43, 0xBF, 0x44, 0x99, 0xF6, 0x2C, 0x0A, 0x2A, 0x0A, 0x36,
+    0x9C, 0x69, 0x29, 0xE0, 0xA5, 0x39, 0x71, 0x1B, 0xB4, 0x2B, 0x80, 0x57, 0xA0, 0x58, 0x13, 0xD7,
+    0xC8, 0x93, 0xD0, 0xB7, 0x86, 0x09, 0x42, 0x97, 0x66, 0xF0, 0x39, 0x4A, 0x16, 0x88, 0x53, 0xBA,
+    0xC2, 0x9B, 0x32, 0x0D, 0xC3, 0x2E, 0x74, 0x57, 0xF5, 0xD0, 0x0B, 0x49, 0x29, 0x12, 0x13, 0x7A,
+    0x20, 0xA9, 0xBE, 0x61, 0x6A, 0x89, 0x1B, 0x12, 0x3B, 0x96, 0x72, 0x91, 0x0C, 0x70, 0x3E, 0xCC,
+    0xA1, 0xA2, 0x13, 0xA8, 0x61, 0x90, 0x63, 0x54, 0xD6, 0xCD, 0x29, 0x4F, 0x58, 0x59, 0xBF, 0x60,
+    0xBE, 0x2E, 0xCD, 0x2D, 0xBD, 0xD9, 0xD8, 0xD8, 0xDA, 0x95, 0x8B, 0x06, 0x56, 0x2F, 0xBB, 0x88,
+    0xA2, 0xDF, 0xB5, 0x36, 0xD1, 0x5A, 0x43, 0x80, 0x06, 0x37, 0x29, 0xA8, 0x43, 0x79, 0x7F, 0xF1,
+    0x49, 0xD0, 0xF6, 0xFF, 0x77, 0x89, 0x26, 0x67, 0x3E, 0xFA, 0x6A, 0xA1, 0x2F, 0x19, 0x79, 0xE3,
+    0x59, 0x78, 0x9C, 0xCD, 0xD0, 0xCB, 0x09, 0xC2, 0x40, 0x10, 0x06, 0xE0, 0x49, 0x48, 0x4C, 0x8C,
+    0x28, 0x76, 0xA0, 0x1D, 0x68, 0x09, 0x36, 0x20, 0xE8, 0x55, 0xD0, 0x14, 0x60, 0x0F, 0xA6, 0x16,
+    0x0F, 0xB6, 0x90, 0xAB, 0x76, 0xA0, 0x60, 0x01, 0xA9, 0x40, 0x24, 0x18, 0x1F, 0xA0, 0x61, 0xDC,
+    0x7F, 0xC6, 0x0D, 0x6C, 0x07, 0xCE, 0x65, 0xF7, 0xDB, 0xC7, 0xCC, 0xEE, 0x10, 0x21, 0x76, 0x97,
+    0x62, 0x8D, 0xB1, 0x64, 0x1E, 0xD1, 0x99, 0x4D, 0xAC, 0x54, 0xD9, 0x8C, 0x25, 0x62, 0x51, 0x71,
+    0x53, 0x65, 0xA2, 0x26, 0x7C, 0x47, 0x1D, 0xD5, 0xD2, 0x9B, 0x7C, 0x18, 0xE9, 0xA0, 0xA3, 0xC9,
+    0x76, 0x90, 0x8B, 0xA5, 0xAC, 0x11, 0x0D, 0x65, 0x15, 0xEA, 0xA2, 0x30, 0x8E, 0x8A, 0xDA, 0xD0,
+    0x0B, 0x49, 0xA1, 0x08, 0xBA, 0x9B, 0x49, 0x00, 0xB5, 0xA0, 0xCA, 0x2A, 0x84, 0xF0, 0xA0, 0xB0,
+    0xD9, 0x73, 0x55, 0x59, 0xC5, 0xD0, 0xC3, 0xDE, 0x4B, 0x9C, 0x0A, 0x3D, 0xA8, 0xB6, 0xD5, 0x53,
+    0x83, 0xB1, 0x19, 0xF7, 0xA2, 0xAB, 0x47, 0x74, 0x6A, 0x5E, 0xCD, 0x1B, 0x7F, 0x8E, 0x83, 0x03,
+    0xE7, 0xB7, 0x89, 0x23, 0x4F, 0xF4, 0x56, 0xA4, 0xDA, 0xA5, 0xAD, 0x2A, 0x52, 0xF9, 0x4F, 0x60,
+    0xAA, 0xDD, 0xE5, 0xA0, 0x9F, 0xD7, 0xC5, 0xE2, 0xD7, 0x79, 0xFD, 0x11, 0xFD, 0xB7, 0xBE, 0x85,
+    0x80, 0x2A, 0x67, 0x78, 0x9C, 0xCD, 0xD0, 0xDF, 0x09, 0xC2, 0x40, 0x0C, 0x06, 0xF0, 0x68, 0x45,
+    0x7C, 0x10, 0x29, 0x3E, 0x39, 0x85, 0x38, 0x82, 0x83, 0x08, 0x8E, 0xA0, 0xE2, 0x02, 0xE2, 0x04,
+    0x2E, 0x20, 0x74, 0x03, 0xDD, 0xC0, 0x6E, 0x70, 0xBA, 0x80, 0x75, 0x80, 0x42, 0xD1, 0xFA, 0xB7,
+    0xB5, 0xC6, 0xEF, 0xBB, 0x83, 0x52, 0x9C, 0xC0, 0x3C, 0x84, 0xFC, 0x8E, 0x23, 0x97, 0x9C, 0x88,
+    0xCC, 0xE2, 0x64, 0xDD, 0x10, 0x17, 0x0B, 0x45, 0x44, 0x5E, 0xA0, 0x6A, 0x44, 0xDE, 0x84, 0x8E,
+    0x4F, 0xC4, 0x56, 0x5D, 0xDC, 0x88, 0xBB, 0x96, 0x61, 0xFC, 0x4F, 0x05, 0x53, 0xE6, 0x51, 0x77,
+    0xCE, 0x33, 0x13, 0x22, 0x6D, 0xD0, 0xF3, 0x40, 0x9C, 0x91, 0x3A, 0xC0, 0x90, 0xB8, 0x22, 0xB5,
+    0xF8, 0x5C, 0x01, 0x3C, 0x00, 0x8F, 0x78, 0x02, 0x2F, 0xC0, 0x0E, 0x82, 0x27, 0x4C, 0xA6, 0x9A,
+    0x58, 0xE0, 0xBE, 0xC9, 0x31, 0x97, 0x45, 0xFA, 0x8B, 0xF2, 0x5A, 0x5A, 0x6D, 0xC0, 0x41, 0xD1,
+    0x51, 0xEB, 0x04, 0xDE, 0x30, 0x38, 0xD0, 0x26, 0x81, 0xFB, 0xE6, 0x02, 0xB4, 0x51, 0xFB, 0x1C,
+    0x67, 0x8F, 0x34, 0x01, 0x82, 0x72, 0x85, 0x9E, 0x0C, 0x72, 0xBB, 0x9C, 0x5D, 0xEB, 0xE8, 0x96,
+    0xE3, 0x80, 0xE5, 0xA6, 0x12, 0xBA, 0x22, 0xE2, 0xD4, 0xE2, 0x17, 0x16, 0x7D, 0x0B, 0x59, 0xB1,
+    0xDE, 0xD5, 0x32, 0x0B, 0x59, 0xC6, 0x8A, 0xEF, 0xCD, 0x1D, 0x5C, 0xFC, 0x21, 0xBE, 0xC8, 0x85,
+    0x24, 0xE1, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x81, 0x49, 0x7F, 0xDF, 0x73, 0x7C, 0xFC, 0xFF, 0x9F,
+    0x8B, 0x61, 0xC2, 0xFF, 0xFF, 0xFF, 0x41, 0x2C, 0x3E, 0x81, 0x3F, 0x40, 0x16, 0x3B, 0x90, 0x65,
+    0x7F, 0x00, 0xC8, 0xF8, 0xCF, 0x06, 0x64, 0xD5, 0xFF, 0x00, 0xB1, 0x58, 0x3E, 0xFE, 0x87, 0x02,
+    0x66, 0x38, 0x8B, 0x09, 0xCC, 0x7A, 0xEF, 0xC1, 0x28, 0xC0, 0x00, 0x66, 0x49, 0x83, 0xCC, 0x04,
+    0xB1, 0xF6, 0x33, 0xC0, 0x58, 0xFA, 0x70, 0x16, 0x37, 0x9C, 0xC5, 0x0E, 0x67, 0xB1, 0xC1, 0x59,
+    0xAC, 0x83, 0x84, 0x05, 0x00, 0xC4, 0x57, 0x89, 0x82, 0x78, 0x9C, 0x63, 0x60, 0x50, 0x58, 0xFE,
+    0xF6, 0xFF, 0xBD, 0x6E, 0x16, 0x06, 0x06, 0x06, 0x87, 0x3F, 0xFF, 0xC1, 0x20, 0x9A, 0x81, 0xE1,
+    0xC7, 0x7F, 0x28, 0x60, 0x2F, 0x80, 0xB1, 0xFE, 0x33, 0x7E, 0x84, 0xB1, 0xD6, 0x33, 0x7C, 0x07,
+    0x92, 0xEB, 0x3A, 0x6E, 0xFD, 0xFF, 0xEF, 0xCF, 0xF0, 0xEB, 0xFF, 0xFF, 0xF7, 0x8C, 0x0C, 0x0C,
+    0x89, 0x7F, 0x78, 0x19, 0x7E, 0xFF, 0xFF, 0xBF, 0x1F, 0x68, 0x0E, 0x83, 0x02, 0x33, 0x48, 0xF4,
+    0x3F, 0x33, 0x03, 0x18, 0x80, 0xCC, 0x9A, 0xCF, 0x08, 0x66, 0x7E, 0x01, 0xEB, 0x06, 0xD9, 0xC5,
+    0x70, 0x00, 0x6C, 0xD2, 0x7D, 0x36, 0x90, 0xF2, 0x7F, 0x60, 0xF6, 0x7B, 0x76, 0x20, 0xFB, 0x11,
+    0xC4, 0x86, 0xFB, 0x4C, 0x0C, 0x70, 0x47, 0xD8, 0x01, 0x99, 0x02, 0x2F, 0x20, 0xC2, 0x60, 0x53,
+    0x8E, 0x81, 0xD9, 0x6C, 0x60, 0xF6, 0x11, 0x10, 0x93, 0x1B, 0x62, 0xD1, 0x37, 0x20, 0x93, 0x17,
+    0xC2, 0x9C, 0x00, 0x64, 0xF2, 0x99, 0x81, 0x99, 0x20, 0x0F, 0xF0, 0xFE, 0xEE, 0x05, 0x39, 0xE6,
+    0x22, 0x48, 0x2D, 0xD0, 0x91, 0x73, 0x2A, 0x56, 0x80, 0x4D, 0xF8, 0x0D, 0xF3, 0xD0, 0x7B, 0x46,
+    0x38, 0x33, 0x9E, 0x01, 0xCE, 0x64, 0x65, 0xB8, 0x06, 0x65, 0x69, 0x03, 0x35, 0x27, 0x9D, 0xFA,
+    0xF7, 0xFF, 0xFD, 0x1C, 0x31, 0x20, 0x0B, 0x00, 0xDE, 0x2A, 0xB7, 0xB0, 0x78, 0x9C, 0x63, 0x60,
+    0x60, 0xB8, 0x79, 0x57, 0x97, 0x01, 0x0C, 0x04, 0xFE, 0xFF, 0xD7, 0x87, 0xB0, 0x0A, 0xE0, 0xAC,
+    0x0B, 0x70, 0xD6, 0x67, 0x38, 0xEB, 0x27, 0x8C, 0x35, 0xF1, 0x3F, 0x04, 0xF0, 0x24, 0xFC, 0x83,
+    0xB1, 0x7E, 0xFF, 0x87, 0xB1, 0xFE, 0x62, 0x61, 0xCD, 0xD8, 0x09, 0x24, 0xD7, 0xCF, 0x9C, 0x39,
+    0x93, 0x9D, 0xC1, 0xE1, 0x3F, 0xCC, 0x14, 0xFA, 0xB3, 0xEC, 0xC1, 0x2C, 0x03, 0x20, 0xAB, 0x1E,
+    0xE6, 0xF1, 0xFF, 0xFF, 0xD9, 0x18, 0x92, 0xA4, 0x18, 0x18, 0xA0, 0x1E, 0x91, 0x07, 0xFB, 0x12,
+    0xCA, 0xFA, 0x04, 0x67, 0x15, 0xC0, 0x59, 0x0C, 0xDF, 0xC1, 0x2C, 0x39, 0x90, 0xEE, 0xED, 0xFF,
+    0xFE, 0x9F, 0x8B, 0x64, 0x00, 0x00, 0x2F, 0x8B, 0x9C, 0x48, 0x78, 0x9C, 0xFB, 0xFC, 0xFF, 0xFF,
+    0x7F, 0x66, 0x06, 0x20, 0xF8, 0x0E, 0x64, 0x7C, 0x1E, 0x0A, 0x9C, 0x1F, 0xC8, 0x9C, 0x9F, 0xC8,
+    0x9C, 0xDF, 0x50, 0x0E, 0x0B, 0x88, 0xF3, 0x0F, 0xCA, 0x61, 0x03, 0xB2, 0x15, 0x80, 0xF4, 0xFF,
+    0x4F, 0x40, 0xCC, 0x05, 0xE4, 0x4C, 0x00, 0x71, 0x3E, 0x02, 0xB1, 0x3D, 0x90, 0xF3, 0x05, 0xC4,
+    0xB9, 0x00, 0xC4, 0xEF, 0xD9, 0x18, 0x26, 0x83, 0xD8, 0xFF, 0xC1, 0xD2, 0x30, 0xA0, 0x80, 0xCC,
+    0x01, 0x5B, 0x06, 0x02, 0xCB, 0x40, 0x9C, 0x0D, 0x10, 0x76, 0x7F, 0x02, 0x88, 0x03, 0x76, 0xD4,
+    0xFF, 0xF7, 0x2C, 0x0A, 0x60, 0x8E, 0xC0, 0xB2, 0xB7, 0xFF, 0xD7, 0xB2, 0x82, 0x9D, 0x00, 0x00,
+    0x84, 0xCF, 0xE8, 0x82, 0x78, 0x9C, 0x3D, 0x91, 0xEB, 0x95, 0x41, 0x41, 0x10, 0x84, 0xCB, 0x6B,
+    0xAD, 0xC5, 0xDA, 0x0C, 0x6C, 0x06, 0x64, 0x60, 0x43, 0x90, 0x01, 0x19, 0x90, 0x01, 0x19, 0x90,
+    0x01, 0x19, 0xAC, 0x0C, 0xC8, 0x80, 0x0C, 0xC8, 0xC0, 0xF1, 0x7E, 0x5D, 0x5A, 0x55, 0xCF, 0x50,
+    0x3F, 0xBA, 0xFB, 0xBB, 0xA7, 0xA7, 0x66, 0xBA, 0x6F, 0x62, 0xB6, 0x86, 0xEB, 0x6C, 0x66, 0x99,
+    0x23, 0x43, 0xD6, 0xF1, 0x6E, 0xB6, 0xC4, 0x86, 0xF8, 0x25, 0xAA, 0xB3, 0xE8, 0x61, 0xCC, 0x58,
+    0x11, 0xF6, 0x59, 0x54, 0xF1, 0xC7, 0xD8, 0x12, 0xAE, 0x58, 0x14, 0x81, 0x87, 0xD9, 0xBF, 0x70,
+    0x47, 0xCC, 0x01, 0x27, 0x26, 0xE1, 0x25, 0x5C, 0xB1, 0x09, 0x5F, 0xD5, 0x35, 0x60, 0x9A, 0x84,
+    0x33, 0xF2, 0xA8, 0x11, 0x9B, 0xEE, 0x88, 0x21, 0x53, 0x09, 0xA1, 0xAB, 0x13, 0x8C, 0x3F, 0xA2,
+    0xC7, 0x14, 0xD8, 0x47, 0x47, 0x6C, 0x59, 0xA4, 0x70, 0x8D, 0xF7, 0x61, 0xE6, 0x6D, 0x0C, 0x0D,
+    0xC7, 0xB6, 0x4C, 0x64, 0x58, 0x76, 0xFC, 0x91, 0xB5, 0x9E, 0x9E, 0x0F, 0x83, 0xF2, 0x58, 0x6B,
+    0xE5, 0x06, 0x2E, 0x9A, 0x8E, 0xB6, 0x6E, 0xEF, 0x5A, 0x70, 0xEE, 0x63, 0x9C, 0x8B, 0xEA, 0xB2,
+    0x91, 0x9B, 0xF9, 0x8E, 0x28, 0xAF, 0xC4, 0xEC, 0x33, 0x22, 0x6E, 0x26, 0xA5, 0x5F, 0x78, 0x10,
+    0xCD, 0x5F, 0xE4, 0xCF, 0xD7, 0x18, 0x51, 0xDA, 0x5A, 0xD8, 0x9F, 0xEB, 0x57, 0x58, 0x78, 0x23,
+    0x12, 0xFD, 0x00, 0xAF, 0x9E, 0x7B, 0x71, 0xB6, 0x06, 0x78, 0x9C, 0x3D, 0x91, 0xFD, 0x51, 0xC2,
+    0x40, 0x10, 0xC5, 0x17, 0x14, 0x19, 0xE3, 0x00, 0x76, 0x20, 0x05, 0x38, 0x83, 0x1D, 0x60, 0x07,
+    0xA6, 0x03, 0x4B, 0xC0, 0x0E, 0xA4, 0x03, 0xE9, 0x20, 0x74, 0xA0, 0x1D, 0x60, 0x07, 0x68, 0x05,
+    0xD8, 0x41, 0xFC, 0x20, 0x80, 0x99, 0xC0, 0xF3, 0xBD, 0xDD, 0xC3, 0xFB, 0x23, 0xD9, 0xDD, 0xBB,
+    0xDB, 0xF7, 0xDB, 0x77, 0x1B, 0x00, 0xC6, 0xF5, 0xCA, 0xFF, 0xB3, 0x82, 0x2F, 0x06, 0x6D, 0x7D,
+    0x4E, 0x99, 0x7C, 0xF2, 0x5F, 0xAA, 0xBA, 0x01, 0x56, 0x7E, 0xE6, 0x9C, 0xC9, 0x1A, 0x3A, 0xC3,
+    0xA0, 0x06, 0x0A, 0x9B, 0x32, 0xE9, 0x31, 0xD9, 0xA9, 0x7A, 0xC6, 0xE0, 0x00, 0xDC, 0xD9, 0x0D,
+    0x93, 0x2B, 0x26, 0x7B, 0x55, 0x33, 0xF3, 0x7C, 0xE0, 0x7B, 0xF7, 0x66, 0x97, 0xEC, 0x0A, 0xF4,
+    0xCD, 0x1E, 0x58, 0xBD, 0x48, 0x7D, 0x2C, 0x07, 0x26, 0xC0, 0x28, 0x58, 0xD8, 0xA8, 0x72, 0xED,
+    0x19, 0x70, 0xCD, 0x8D, 0x60, 0x69, 0x27, 0x3E, 0x7B, 0x23, 0xC9, 0x41, 0xC0, 0x6B, 0x81, 0x1D,
+    0xAF, 0x70, 0xAF, 0x53, 0xEB, 0xD2, 0x2F, 0xF0, 0x64, 0xD1, 0x3E, 0x13, 0x7B, 0x6B, 0xAB, 0x4B,
+    0x7B, 0x81, 0x05, 0x4A, 0x9F, 0x9A, 0x2B, 0xFB, 0xE1, 0xA5, 0x61, 0x80, 0x39, 0xDA, 0xC8, 0xD4,
+    0x93, 0x42, 0x59, 0x1E, 0xD4, 0x8E, 0x36, 0x19, 0x4A, 0xFF, 0x85, 0x53, 0xCE, 0xD2, 0x84, 0x42,
+    0x2B, 0x72, 0x9D, 0xA7, 0xC2, 0x40, 0xDA, 0xAD, 0x64, 0xDD, 0x72, 0xAA, 0xDE, 0xB7, 0xC0, 0x98,
+    0x5D, 0x96, 0x96, 0x9C, 0x2D, 0xE7, 0x3E, 0x26, 0xDB, 0x7C, 0x07, 0x58, 0xA0, 0xBD, 0x03, 0x5D,
+    0xB3, 0x06, 0x05, 0xDB, 0x8D, 0xBD, 0x2A, 0x34, 0x4E, 0x74, 0x22, 0x37, 0x17, 0x5B, 0xB7, 0x28,
+    0xA1, 0xED, 0xFC, 0x99, 0x2A, 0x94, 0x75, 0x02, 0xF3, 0x21, 0x1B, 0xD7, 0xA0, 0x2E, 0x47, 0xEB,
+    0x44, 0xB5, 0x92, 0xE1, 0xD2, 0xF8, 0x50, 0x10, 0x60, 0xE1, 0x9A, 0x0F, 0x3F, 0x57, 0x10, 0x60,
+    0xE1, 0x9A, 0xBF, 0x92, 0x68, 0xF0, 0x98, 0xAA, 0x9E, 0xF4, 0x12, 0x8D, 0xDE, 0xC3, 0x97, 0x7C,
+    0xF2, 0xD7, 0x37, 0xE0, 0x1F, 0xCC, 0xD1, 0xC2, 0x92, 0xE6, 0xB8, 0xFD, 0x07, 0xE8, 0x73, 0x3A,
+    0xC5, 0x78, 0x9C, 0x4D, 0xD0, 0xDB, 0x0D, 0x82, 0x40, 0x10, 0x05, 0xD0, 0x1B, 0x5D, 0x13, 0x8D,
+    0x8F, 0x50, 0x01, 0xB1, 0x13, 0xE8, 0x44, 0x3B, 0xD0, 0x0E, 0xB4, 0x03, 0xED, 0xC0, 0x12, 0xB0,
+    0x13, 0xEC, 0xC0, 0x50, 0x81, 0x89, 0x46, 0x3E, 0x88, 0xB8, 0xCE, 0x73, 0x91, 0x8F, 0x99, 0xBD,
+    0x93, 0x93, 0x1D, 0xA0, 0x89, 0x31, 0x1E, 0x40, 0xCF, 0x91, 0x0E, 0x77, 0x94, 0x54, 0xE3, 0x88,
+    0xE2, 0x93, 0x7A, 0x01, 0x74, 0xD4, 0xE6, 0x14, 0x3F, 0xD4, 0x67, 0x40, 0x43, 0x6D, 0x03, 0x6C,
+    0xC5, 0x42, 0xF4, 0x43, 0xA7, 0x05, 0xDF, 0xD1, 0x89, 0xE2, 0x3A, 0xE5, 0x28, 0xF3, 0xD2, 0xAC,
+    0xEA, 0xFA, 0xE6, 0x56, 0x75, 0xEF, 0x56, 0x75, 0xB2, 0xAA, 0x07, 0xAB, 0x3A, 0x59, 0xD3, 0xB5,
+    0x27, 0x5C, 0x39, 0x5E, 0x52, 0x7C, 0x0B, 0x1E, 0x5B, 0xCA, 0xBE, 0x12, 0x97, 0xFF, 0x76, 0xD0,
+    0xAD, 0xC6, 0x18, 0xD4, 0xF2, 0x27, 0xBD, 0xA8, 0xAC, 0x92, 0xDD, 0xED, 0x93, 0x66, 0xBB, 0x40,
+    0x6F, 0x3A, 0xD3, 0x9F, 0xE5, 0x9A, 0xED, 0x09, 0x38, 0x9B, 0x6E, 0x75, 0xA5, 0x2C, 0x0F, 0x6A,
+    0x83, 0xBD, 0x5A, 0x2E, 0xB6, 0xF2, 0x05, 0x95, 0xD8, 0x9C, 0xE3, 0x9A, 0xD9, 0xE4, 0x07, 0x28,
+    0xDE, 0xCE, 0x4D, 0x78, 0x9C, 0x55, 0x91, 0x5D, 0xAE, 0x01, 0x41, 0x10, 0x85, 0x6B, 0xC8, 0x10,
+    0x3F, 0x17, 0x0B, 0x90, 0xB0, 0x03, 0x76, 0xC0, 0x0E, 0x78, 0xBE, 0x2F, 0xAC, 0xC0, 0x16, 0x2C,
+    0xE1, 0xDA, 0x01, 0x3B, 0x60, 0x07, 0x9E, 0xAC, 0x42, 0x62, 0xEC, 0x80, 0x44, 0x4C, 0xC4, 0x48,
+    0xDA, 0x39, 0x5D, 0xFD, 0x73, 0xA7, 0x1F, 0xAA, 0xEA, 0x9B, 0xCC, 0x7C, 0xDD, 0xA7, 0xE7, 0x63,
+    0x8C, 0x49, 0x85, 0xAB, 0xC0, 0x54, 0xCD, 0x51, 0x9A, 0xA4, 0x1E, 0x86, 0x4C, 0xEE, 0xA8, 0x5D,
+    0xE2, 0x12, 0xC3, 0x5A, 0x36, 0xA8, 0x0B, 0xE2, 0x01, 0xC3, 0x40, 0xC6, 0xA8, 0x7B, 0x22, 0x5F,
+    0x6B, 0x89, 0x7C, 0xD0, 0x88, 0x4F, 0x75, 0xE6, 0x4E, 0x5D, 0xE8, 0xE3, 0xBB, 0x53, 0xA3, 0x6D,
+    0xD1, 0x36, 0xAA, 0x9E, 0xA3, 0x4D, 0x80, 0x43, 0x55, 0xEF, 0xD0, 0x7E, 0xE8, 0x80, 0xEB, 0xA8,
+    0xDF, 0xD4, 0x89, 0xB9, 0x75, 0x50, 0x9C, 0xF8, 0x0D, 0x53, 0x79, 0xDB, 0x77, 0x9C, 0xAB, 0x25,
+    0xFE, 0x70, 0xD6, 0xD5, 0xA5, 0xB8, 0x63, 0x91, 0xAE, 0x05, 0xC5, 0x0D, 0x45, 0xB8, 0xB6, 0x57,
+    0x86, 0x55, 0xC4, 0x98, 0x3D, 0x18, 0x56, 0x82, 0x2B, 0x67, 0x58, 0x09, 0xAE, 0x82, 0x61, 0x25,
+    0xB8, 0x34, 0xAC, 0xAE, 0xA7, 0xC5, 0xD4, 0x23, 0xB5, 0xE6, 0xE6, 0xC9, 0xBA, 0xCC, 0x5F, 0x40,
+    0xBA, 0xCC, 0x28, 0xA0, 0x75, 0xB5, 0x23, 0xD2, 0x55, 0x2B, 0x63, 0x12, 0xF1, 0xED, 0xEE, 0x3A,
+    0xAA, 0x66, 0x11, 0x0F, 0x31, 0x2C, 0xD7, 0xCB, 0x5F, 0x1B, 0xFE, 0x63, 0xA5, 0x77, 0x32, 0xD1,
+    0x34, 0xB5, 0xE7, 0x0D, 0xE9, 0x1C, 0xB6, 0x4B, 0x98, 0x25, 0x25, 0xEC, 0xCB, 0x7F, 0x5C, 0xC5,
+    0x23, 0x9C, 0xCD, 0xE5, 0x37, 0xEE, 0xF9, 0x05, 0x47, 0xD1, 0xF0, 0x06, 0x78, 0x9C, 0x7B, 0xF0,
+    0x1F, 0x06, 0xEA, 0x1F, 0x90, 0xC0, 0x9C, 0xB0, 0x1B, 0x04, 0x7E, 0x03, 0x99, 0x72, 0x0C, 0x60,
+    0xF0, 0x13, 0xC8, 0x64, 0x06, 0xB3, 0x02, 0x40, 0xF2, 0x10, 0xC1, 0x4F, 0x40, 0x26, 0x37, 0x84,
+    0xF9, 0xF7, 0xFF, 0xFF, 0xF7, 0x8C, 0x60, 0xD6, 0x04, 0xA0, 0xA0, 0x3D, 0x44, 0xF0, 0x2B, 0x90,
+    0xC9, 0x0E, 0x66, 0x29, 0x00, 0x59, 0xFB, 0x21, 0x82, 0x17, 0x50, 0x0D, 0x65, 0xC1, 0x63, 0xE8,
+    0x1F, 0x14, 0x43, 0xFD, 0x11, 0x86, 0x72, 0xA0, 0x1B, 0x7A, 0x00, 0xC8, 0x3C, 0x0F, 0x76, 0xF3,
+    0xEC, 0x1F, 0x70, 0x5F, 0xBC, 0xFF, 0x45, 0x02, 0x13, 0x00, 0x72, 0x08, 0xB5, 0xBA, 0x78, 0x9C,
+    0x63, 0x60, 0x00, 0x82, 0x80, 0x9D, 0x6F, 0xF7, 0x83, 0xE8, 0x82, 0xFF, 0xFF, 0xFF, 0x83, 0x19,
+    0xBF, 0xA0, 0x0C, 0x87, 0xFF, 0x50, 0xC6, 0x02, 0x18, 0xE3, 0x01, 0x90, 0xBE, 0x1F, 0x09, 0x64,
+    0x7C, 0x00, 0x32, 0xD8, 0x18, 0x20, 0x0C, 0xB0, 0x1E, 0x10, 0xA3, 0x1F, 0xC6, 0xA8, 0x27, 0x9D,
+    0xF1, 0x11, 0xC6, 0xF8, 0xFA, 0xFF, 0x7F, 0x3E, 0x88, 0x56, 0xF8, 0xF7, 0xFF, 0xBF, 0x3F, 0x90,
+    0x36, 0xF8, 0x01, 0xB4, 0x8A, 0x9F, 0x81, 0xE1, 0x33, 0xC8, 0x0D, 0x20, 0x3B, 0xBF, 0x80, 0x68,
+    0x90, 0x12, 0x10, 0x23, 0x9B, 0x11, 0xCA, 0xA8, 0x86, 0x31, 0xC0, 0xC6, 0x40, 0x14, 0x73, 0x80,
+    0xB4, 0xFF, 0x04, 0x32, 0xE4, 0x41, 0x06, 0x1A, 0x00, 0x0D, 0x8C, 0x07, 0x5B, 0xF1, 0x0D, 0xC3,
+    0x52, 0xF2, 0xDC, 0x8C, 0xEC, 0x65, 0x78, 0x20, 0x40, 0x82, 0x05, 0x1C, 0x50, 0x59, 0xC8, 0x41,
+    0x07, 0x0F, 0x4C, 0x78, 0xF0, 0x22, 0x02, 0x1C, 0x1C, 0x05, 0x00, 0xC2, 0xD0, 0xB2, 0x0E, 0x78,
+    0x9C, 0xFB, 0xF7, 0xBF, 0xFE, 0xDF, 0x20, 0x43, 0x00, 0x4B, 0x47, 0x79, 0xBD, 0x78, 0x9C, 0xFB,
+    0x7F, 0xAF, 0x9B, 0x85, 0x01, 0x04, 0xFE, 0xFF, 0xFF, 0xFF, 0x9E, 0x0D, 0xCA, 0xF8, 0x5F, 0x0F,
+    0x63, 0xFC, 0x67, 0x84, 0x31, 0xD8, 0x81, 0x8C, 0x15, 0xFF, 0x80, 0x0C, 0x4E, 0x90, 0xDC, 0x02,
+    0x20, 0x83, 0x0B, 0xA6, 0x8F, 0x1B, 0xCC, 0xF8, 0x0B, 0x63, 0xFC, 0x21, 0x97, 0xC1, 0x03, 0x66,
+    0xFC, 0xFE, 0xFF, 0x9F, 0x1F, 0xCC, 0xF8, 0xF9, 0xFF, 0xFF, 0x7A, 0x30, 0xE3, 0x0B, 0xD0, 0x8E,
+    0x18, 0x26, 0x20, 0x63, 0x03, 0xD8, 0x25, 0x7C, 0x10, 0x39, 0x88, 0x32, 0x85, 0x13, 0x50, 0x86,
+    0x01, 0x94, 0x21, 0xF0, 0x1B, 0x2A, 0x75, 0x00, 0xA6, 0xF8, 0x1B, 0x90, 0xCA, 0x05, 0x69, 0xFF,
+    0x05, 0x33, 0x10, 0xA8, 0x44, 0x1E, 0xD5, 0x52, 0xF2, 0xDC, 0x0C, 0xF3, 0xB2, 0x00, 0x2C, 0x10,
+    0x60, 0xC1, 0x02, 0x0F, 0x28, 0x78, 0xD0, 0x81, 0x19, 0x4C, 0x68, 0xC1, 0x0B, 0x0D, 0x70, 0x58,
+    0x14, 0x00, 0x00, 0x1E, 0x58, 0xA4, 0x7C, 0x78, 0x9C, 0x63, 0x60, 0x40, 0x06, 0x01, 0xAF, 0xDF,
+    0xF7, 0x30, 0x83, 0x59, 0x0A, 0xAC, 0x0A, 0x7F, 0xFE, 0xFF, 0xFF, 0x7F, 0x9F, 0x15, 0xC4, 0xB9,
+    0xC4, 0xF6, 0xE8, 0x3F, 0x08, 0xDC, 0x67, 0x03, 0x2A, 0xF9, 0xC7, 0xF6, 0xE7, 0x3F, 0x04, 0x54,
+    0x95, 0xFE, 0xF9, 0xCF, 0xF6, 0xF7, 0x3F, 0x02, 0x00, 0x39, 0x99, 0x6D, 0x30, 0x01, 0xD6, 0xBF,
+    0xD2, 0x40, 0x63, 0x7E, 0x81, 0xD9, 0xF3, 0x19, 0xE6, 0x82, 0x0D, 0xFD, 0x09, 0xE2, 0x70, 0x30,
+    0xB0, 0x83, 0xAD, 0x10, 0xD8, 0xF6, 0xEF, 0xBE, 0x26, 0x03, 0x2A, 0x00, 0x00, 0x00, 0x3B, 0x42,
+    0xE6, 0x78, 0x9C, 0x63, 0x60, 0x08, 0x78, 0xFD, 0xBF, 0x86, 0x91, 0x81, 0x81, 0x41, 0xE1, 0xEF,
+    0xFF, 0xFF, 0xFF, 0xF3, 0x81, 0x8C, 0x2F, 0xFF, 0x41, 0x80, 0x93, 0x41, 0xE0, 0x1F, 0x98, 0x91,
+    0xCF, 0xB0, 0xE1, 0xFF, 0xFF, 0xFB, 0xBB, 0x80, 0x2C, 0xA6, 0x4F, 0xFF, 0xFF, 0xB3, 0x32, 0x5C,
+    0x02, 0xCA, 0x7D, 0xFF, 0x5F, 0x0F, 0xD4, 0xF0, 0xFF, 0x3F, 0xDF, 0xAF, 0xFF, 0xFC, 0x40, 0x1D,
+    0x40, 0xF2, 0xF7, 0x7F, 0x3E, 0x20, 0xE3, 0xC7, 0x7F, 0x79, 0x98, 0x88, 0xFC, 0x0F, 0x90, 0x1A,
+    0x01, 0xA0, 0x9A, 0xCF, 0x30, 0x5D, 0x07, 0x60, 0xE6, 0x18, 0x80, 0x0D, 0x06, 0xC9, 0x7F, 0x05,
+    0x33, 0xB8, 0x18, 0x18, 0x0C, 0xFE, 0x42, 0x04, 0x18, 0x18, 0x12, 0x5E, 0xFF, 0xEF, 0x01, 0xBA,
+    0x07, 0x00, 0x5F, 0xE9, 0x57, 0x8E, 0x78, 0x9C, 0x95, 0x52, 0x4B, 0x4E, 0x02, 0x41, 0x10, 0x2D,
+    0xD0, 0x31, 0xA8, 0xA8, 0x73, 0x02, 0xF5, 0x02, 0xA8, 0x37, 0xE0, 0x06, 0xCA, 0xCA, 0xE8, 0x46,
+    0xD9, 0x10, 0x6F, 0xC0, 0x16, 0x6E, 0x00, 0x2B, 0x97, 0x70, 0x04, 0xB8, 0x80, 0x81, 0x1B, 0x70,
+    0x01, 0x13, 0x58, 0x99, 0x98, 0x98, 0x28, 0xE2, 0x87, 0x20, 0xF0, 0xAC, 0xEA, 0xCF, 0x4C, 0xF7,
+    0xB4, 0x1B, 0xDF, 0xA2, 0xA7, 0xE6, 0x4D, 0x4D, 0x55, 0xD7, 0xAB, 0x47, 0x64, 0xD0, 0x04, 0xF0,
+    0x9A, 0x23, 0x07, 0x33, 0x66, 0x4E, 0x5C, 0x22, 0x5E, 0x03, 0x63, 0x2F, 0xA5, 0xCF, 0x29, 0xBB,
+    0x2E, 0x41, 0x73, 0xA0, 0xE5, 0x11, 0x55, 0x4E, 0x89, 0x3C, 0x86, 0xEB, 0x96, 0x3C, 0x82, 0xD6,
+    0xE8, 0xD1, 0x7F, 0x11, 0xDF, 0x3F, 0x02, 0x0F, 0xD7, 0xE9, 0x75, 0x2A, 0x4B, 0x28, 0x0C, 0x36,
+    0x0D, 0x71, 0xB6, 0x82, 0xC1, 0x20, 0xAF, 0x99, 0x6F, 0x24, 0xB8, 0x55, 0x44, 0x13, 0x0E, 0xB6,
+    0x32, 0x29, 0xC0, 0x85, 0x54, 0x51, 0x51, 0xE7, 0xB2, 0xF6, 0x0C, 0xA3, 0xD0, 0x50, 0x82, 0x1B,
+    0x49, 0x7E, 0x92, 0x68, 0x9B, 0xE8, 0x03, 0x56, 0x98, 0x63, 0x96, 0x08, 0x47, 0x44, 0x3F, 0xFC,
+    0x38, 0xD4, 0x4D, 0xDF, 0x39, 0x6C, 0x50, 0x9C, 0x74, 0xD0, 0x5D, 0xC7, 0x54, 0x91, 0x72, 0x76,
+    0x18, 0xF9, 0x9A, 0x6F, 0xC3, 0x11, 0x4F, 0x2A, 0x44, 0x43, 0x73, 0x09, 0x05, 0x96, 0x16, 0x85,
+    0x89, 0xAE, 0xAF, 0xF1, 0xC9, 0x2F, 0x3B, 0x6F, 0x7C, 0x1C, 0x58, 0x46, 0x9A, 0x15, 0x85, 0xD9,
+    0x77, 0x99, 0xBD, 0xA9, 0x1C, 0x96, 0x99, 0xFE, 0xCD, 0x84, 0x7F, 0x85, 0x95, 0xA5, 0xFB, 0xA9,
+    0xD7, 0xBD, 0x1F, 0xDC, 0x50, 0xA6, 0xEB, 0x5A, 0x46, 0x76, 0x12, 0x05, 0x93, 0xE6, 0x08, 0xA9,
+    0x2B, 0xDA, 0x4A, 0x0D, 0x5A, 0xA4, 0x8A, 0xCD, 0x94, 0x62, 0x4A, 0xD5, 0x91, 0xA7, 0x6A, 0xAA,
+    0xBC, 0x5A, 0x53, 0x81, 0xBF, 0xE8, 0xED, 0xDC, 0xD5, 0x17, 0xB0, 0x4D, 0xBE, 0xDC, 0x0D, 0x96,
+    0x83, 0x2D, 0x47, 0x59, 0x27, 0x9C, 0x1B, 0xB7, 0x2C, 0xB3, 0x6E, 0x49, 0x1C, 0xD5, 0xDB, 0xB0,
+    0xE3, 0xB0, 0xEB, 0x5E, 0xD8, 0x75, 0x57, 0xDA, 0x75, 0xBF, 0x8E, 0x7A, 0x65, 0x3D, 0x78, 0x9C,
+    0x95, 0x91, 0xBD, 0x4A, 0x03, 0x51, 0x10, 0x85, 0x0F, 0xD9, 0xAC, 0xD7, 0x42, 0x21, 0x75, 0x9E,
+    0xC0, 0x2A, 0xE4, 0x0D, 0xC4, 0xCA, 0xD2, 0x58, 0x59, 0x6B, 0xE1, 0x33, 0x44, 0x9B, 0xBC, 0x81,
+    0x11, 0x6C, 0x2C, 0x04, 0xB5, 0xB2, 0x34, 0x4D, 0xC0, 0x2E, 0x62, 0x25, 0x08, 0xAE, 0xE4, 0x01,
+    0x82, 0x58, 0x29, 0xB8, 0x24, 0x86, 0x18, 0xFC, 0xDB, 0x3D, 0xCE, 0xCC, 0xDE, 0x6B, 0xD2, 0x3A,
+    0xC5, 0x9D, 0xFB, 0x71, 0x99, 0x73, 0xCE, 0xEC, 0x02, 0xD8, 0xDE, 0x02, 0xB0, 0xB3, 0x0E, 0xAD,
+    0x3A, 0xB9, 0x8C, 0x06, 0xB9, 0xA4, 0x70, 0x4D, 0xB6, 0x31, 0x22, 0x5B, 0x0A, 0xD2, 0x7B, 0x18,
+    0x93, 0x97, 0x0A, 0x8F, 0xDA, 0xDF, 0xC8, 0x53, 0x85, 0x43, 0x72, 0x03, 0x1D, 0x72, 0xD5, 0x14,
+    0x9E, 0x93, 0x18, 0x95, 0x97, 0xA4, 0x8C, 0x7F, 0xD4, 0xE6, 0x55, 0xCA, 0xC1, 0x7E, 0xC9, 0xEE,
+    0x5D, 0x5A, 0x25, 0x91, 0xDC, 0x9F, 0xE8, 0xAB, 0x2D, 0xF0, 0x10, 0x80, 0x8B, 0xD0, 0x88, 0xBE,
+    0xD4, 0x35, 0x23, 0x4F, 0x8E, 0x7F, 0xA8, 0x09, 0x81, 0xE9, 0x41, 0x64, 0x7B, 0x90, 0x02, 0x0D,
+    0xD3, 0x9C, 0x0A, 0x44, 0xC1, 0x4C, 0x62, 0x33, 0x0E, 0x20, 0x5B, 0x71, 0x61, 0x1E, 0x9C, 0xF4,
+    0xB5, 0x8B, 0xBB, 0x34, 0x67, 0x01, 0xDD, 0x3F, 0x23, 0x87, 0x1B, 0xCE, 0xA0, 0x9E, 0xCF, 0x81,
+    0x45, 0xEB, 0xED, 0xED, 0xBE, 0x2B, 0xE8, 0xD1, 0x0A, 0x6A, 0x5F, 0xDE, 0xCC, 0x40, 0x12, 0x0E,
+    0x43, 0x02, 0x27, 0xF3, 0x89, 0x82, 0xCD, 0x64, 0xC5, 0x4B, 0x25, 0x53, 0xF8, 0x2E, 0x32, 0xF5,
+    0x4D, 0xFA, 0x43, 0xBF, 0x45, 0xF3, 0xB6, 0xF0, 0x19, 0x7B, 0xC3, 0xA1, 0xC2, 0x99, 0x87, 0x9A,
+    0x28, 0x39, 0x9B, 0x94, 0x87, 0xD2, 0xA7, 0x06, 0x3D, 0x37, 0xA8, 0x62, 0x62, 0x2B, 0x1C, 0xBD,
+    0xF2, 0x7E, 0xC5, 0xFE, 0x99, 0xFB, 0x05, 0xDB, 0x87, 0x08, 0xD4, 0x78, 0x9C, 0x8D, 0x91, 0x4B,
+    0x0E, 0x01, 0x41, 0x10, 0x86, 0x8B, 0x91, 0x31, 0x08, 0x71, 0x00, 0xC2, 0x11, 0x5C, 0xC0, 0xC2,
+    0x9A, 0x8D, 0x13, 0x38, 0x84, 0xA5, 0x8D, 0xC4, 0x01, 0xB8, 0x01, 0x37, 0x70, 0x04, 0x24, 0xF6,
+    0x6C, 0xAC, 0x24, 0x1E, 0x6B, 0x0B, 0x84, 0x78, 0x8C, 0xE1, 0x57, 0xD5, 0xA3, 0x9B, 0xDE, 0xF9,
+    0x17, 0xD5, 0xF5, 0xA5, 0xBA, 0xEB, 0xD5, 0x44, 0x4A, 0x27, 0x00, 0x0D, 0xD2, 0x7A, 0x32, 0xC5,
+    0x35, 0x0C, 0xAC, 0xD0, 0x05, 0xD8, 0x3B, 0x1A, 0x4A, 0x1C, 0xCA, 0x99, 0xD0, 0x16, 0xE8, 0x1B,
+    0x90, 0x1C, 0xAE, 0x81, 0x36, 0x50, 0xA6, 0xBF, 0xD4, 0x5C, 0xBE, 0xD6, 0xAD, 0xE8, 0x07, 0x16,
+    0x10, 0xCD, 0x62, 0x0A, 0x26, 0x08, 0x35, 0x14, 0x28, 0xBE, 0x3E, 0xA4, 0xEA, 0xCF, 0x35, 0x60,
+    0xC4, 0xE4, 0x1B, 0xE2, 0x21, 0x8A, 0x72, 0x54, 0x23, 0xF5, 0x80, 0x8F, 0x02, 0xF5, 0x10, 0xF6,
+    0x28, 0x33, 0x75, 0xE9, 0xC0, 0x36, 0x2D, 0xD9, 0x38, 0xD9, 0x5E, 0xAD, 0x40, 0x0D, 0x7D, 0x63,
+    0x27, 0x7A, 0x15, 0x23, 0x74, 0x66, 0xC7, 0xBD, 0xB3, 0x51, 0x4D, 0x1C, 0xD9, 0xF1, 0x7C, 0xB9,
+    0x2E, 0x92, 0x04, 0xC9, 0x07, 0xB0, 0x56, 0xB4, 0x61, 0x4A, 0x59, 0x94, 0xB4, 0x6E, 0x26, 0xEC,
+    0x2C, 0xBC, 0x49, 0x38, 0xA6, 0x82, 0x5D, 0x5D, 0x1E, 0x67, 0x4C, 0x67, 0x6D, 0xAB, 0xEB, 0xAC,
+    0x4C, 0x54, 0x8B, 0x54, 0xC2, 0x89, 0xE8, 0xFA, 0x9D, 0xD6, 0x23, 0x1A, 0x1B, 0x98, 0xF1, 0x83,
+    0x6C, 0xA0, 0x29, 0xAF, 0x7F, 0x52, 0x2F, 0x89, 0x35, 0xFD, 0xDD, 0x2E, 0x51, 0x67, 0x87, 0x55,
+    0x4B, 0x35, 0xF4, 0x06, 0xF3, 0x65, 0x00, 0x1D, 0x78, 0x9C, 0x65, 0x92, 0x3B, 0x52, 0x02, 0x41,
+    0x10, 0x86, 0x5B, 0x41, 0x29, 0x14, 0x2D, 0x6E, 0x80, 0x37, 0x80, 0xDC, 0x40, 0x6E, 0x80, 0x89,
+    0x99, 0x55, 0x72, 0x03, 0x4C, 0x8C, 0x4C, 0x24, 0x34, 0xD2, 0x1B, 0xE8, 0x0D, 0x34, 0x35, 0xD2,
+    0x1B, 0xE0, 0x0D, 0xF0, 0x06, 0x20, 0xB5, 0x82, 0xAF, 0xB5, 0xED, 0xC7, 0x4C, 0x4F, 0xCF, 0xF2,
+    0x57, 0xC1, 0xCE, 0x7C, 0xBB, 0x33, 0x3B, 0xFB, 0x75, 0x03, 0x70, 0xBE, 0x90, 0x02, 0x3E, 0x7F,
+    0x4C, 0xB6, 0x1C, 0xE8, 0x33, 0xC0, 0x5D, 0x47, 0xEE, 0x85, 0x74, 0x1C, 0x99, 0x0B, 0x19, 0x39,
+    0xF2, 0x21, 0x64, 0xE2, 0xC8, 0x37, 0xE2, 0x0D, 0xA1, 0xCD, 0x44, 0x68, 0x76, 0x48, 0xBF, 0x86,
+    0x81, 0x21, 0xCD, 0xB6, 0xE9, 0x00, 0x7B, 0x46, 0x1E, 0x79, 0x05, 0x1D, 0xB2, 0x6B, 0xE4, 0x1D,
+    0x71, 0x0A, 0x05, 0xED, 0x65, 0x64, 0xC9, 0x13, 0x3A, 0xC1, 0xCC, 0xC8, 0x2F, 0xE2, 0x91, 0x2C,
+    0xAD, 0x05, 0x70, 0x40, 0xE3, 0x7D, 0xD9, 0xBE, 0x19, 0xC8, 0x39, 0x8D, 0x77, 0xA0, 0x2D, 0x5C,
+    0xF3, 0xAA, 0xDF, 0x4D, 0x6B, 0x07, 0x81, 0x2C, 0xD4, 0xCD, 0x0A, 0xF1, 0x21, 0x90, 0x4F, 0xC4,
+    0xE7, 0x74, 0x23, 0xE8, 0x1A, 0xA5, 0xC5, 0x94, 0x5E, 0x50, 0x73, 0x65, 0xD2, 0x6E, 0x69, 0xD4,
+    0x72, 0x77, 0x00, 0xDE, 0x30, 0x45, 0xA5, 0x15, 0x8E, 0x4C, 0xA2, 0xAE, 0x94, 0x8D, 0xA0, 0x2B,
+    0x85, 0xA5, 0x1D, 0x67, 0xA4, 0x65, 0x95, 0x89, 0xE9, 0x86, 0xCA, 0x9C, 0x9E, 0x70, 0x2E, 0x50,
+    0xA5, 0x2D, 0x59, 0xB2, 0x1D, 0x7E, 0x4A, 0x97, 0x9F, 0xF8, 0x06, 0xED, 0x87, 0x9A, 0x68, 0x89,
+    0xA5, 0x2B, 0x44, 0xDA, 0x10, 0x93, 0xF1, 0xB9, 0x48, 0x7B, 0x41, 0x96, 0x9C, 0xAA, 0x34, 0x10,
+    0x2B, 0x51, 0x26, 0x3F, 0x7F, 0xC7, 0xE6, 0x4C, 0x78, 0x5B, 0x3A, 0xAD, 0xA4, 0xBF, 0xBA, 0x2B,
+    0x53, 0xD6, 0x69, 0xDC, 0x6A, 0x75, 0xC8, 0xB2, 0xB2, 0x62, 0xA4, 0x8D, 0x1B, 0x39, 0x59, 0x64,
+    0x5D, 0xA6, 0x1F, 0x71, 0x56, 0x21, 0xA5, 0x6B, 0x20, 0x0D, 0xAE, 0x3D, 0x43, 0x32, 0xAE, 0x9F,
+    0x2A, 0xFB, 0xF8, 0xA6, 0xD2, 0x77, 0x55, 0x49, 0x7F, 0x8D, 0xC0, 0xB8, 0x9C, 0x5D, 0x02, 0xFC,
+    0x03, 0x3F, 0xDE, 0x47, 0x25, 0x78, 0x9C, 0x4D, 0xD0, 0x3D, 0x6A, 0x42, 0x41, 0x10, 0x07, 0xF0,
+    0xE1, 0xA9, 0xD9, 0x80, 0x08, 0xD6, 0x56, 0x96, 0x56, 0xC1, 0x1B, 0x88, 0x27, 0xD0, 0x5C, 0x22,
+    0xAD, 0x29, 0x4D, 0x9A, 0xDC, 0x20, 0x16, 0x69, 0x2C, 0x04, 0x4D, 0xE5, 0x09, 0x04, 0x2B, 0x05,
+    0x2B, 0x41, 0xD0, 0x60, 0x97, 0x26, 0x84, 0xD4, 0x11, 0x4D, 0x88, 0xE6, 0xC3, 0x3C, 0xC7, 0xFF,
+    0xCC, 0xEE, 0x5B, 0x77, 0x8A, 0xE7, 0xFE, 0x18, 0xE7, 0x63, 0x97, 0x88, 0x2E, 0x87, 0x2B, 0x7E,
+    0xB9, 0x8D, 0x48, 0x62, 0xC0, 0x1A, 0x8B, 0x14, 0xCE, 0x6F, 0xEC, 0xA2, 0x05, 0x3C, 0x25, 0xE0,
+    0x73, 0xA2, 0xBA, 0x47, 0x05, 0xA9, 0x98, 0xB9, 0xD3, 0xFE, 0x07, 0xC6, 0xC0, 0xEE, 0x1E, 0xA5,
+    0x65, 0x49, 0x01, 0x75, 0xED, 0xB9, 0x03, 0x52, 0xE4, 0xE2, 0x03, 0xC8, 0x24, 0xD8, 0x00, 0x67,
+    0x21, 0x0C, 0x7E, 0xAB, 0xFD, 0xD9, 0xEA, 0xC0, 0x16, 0x03, 0x3F, 0xC8, 0xD0, 0x84, 0x4F, 0x28,
+    0x1F, 0x02, 0xE8, 0x6A, 0xE3, 0x9B, 0xAB, 0xAD, 0x40, 0x3E, 0x77, 0x49, 0xB7, 0x3F, 0x37, 0x4C,
+    0x81, 0x0D, 0xD7, 0xC9, 0x06, 0x06, 0xF5, 0x0B, 0x81, 0xD6, 0xC4, 0x36, 0x93, 0x8F, 0x05, 0x7B,
+    0xBB, 0xD3, 0x52, 0x5B, 0xFF, 0xC8, 0x5B, 0x34, 0xA7, 0x76, 0xCE, 0xA7, 0x1B, 0xB8, 0x16, 0xF4,
+    0x1C, 0x2E, 0xD0, 0xC9, 0x68, 0x25, 0x12, 0xD1, 0xAF, 0x2C, 0xFA, 0xA8, 0x28, 0xD0, 0x97, 0x5E,
+    0xE1, 0xE1, 0x9D, 0xE7, 0x25, 0xA2, 0x57, 0x7B, 0x39, 0x1B, 0x5B, 0xAE, 0xF9, 0xF3, 0x35, 0x73,
+    0xDA, 0xE3, 0x9B, 0x1B, 0xFE, 0x8C, 0x47, 0xCC, 0x7A, 0xF4, 0xC2, 0x7F, 0xA1, 0x57, 0xE4, 0xB1,
+    0x09, 0xDE, 0x53, 0x32, 0xDD, 0x76, 0xF6, 0x54, 0xC3, 0x9C, 0x73, 0x28, 0x86, 0xD0, 0x6B, 0x7B,
+    0x14, 0x9F, 0x79, 0x64, 0x8E, 0x73, 0xDB, 0x09, 0xE1, 0x78, 0x9C, 0x63, 0x60, 0x80, 0x00, 0x81,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xE7, 0x64, 0x80, 0x81, 0x05, 0x40, 0xDE, 0x7C, 0x38, 0x8F, 0xE1, 0x1B,
+    0x90, 0xCB, 0x0E, 0xE7, 0x19, 0x00, 0x79, 0xF1, 0x08, 0xC9, 0x87, 0xFF, 0xFF, 0xBF, 0x67, 0x46,
+    0x70, 0xFF, 0xFC, 0xFF, 0x2F, 0x83, 0xE0, 0x01, 0x0D, 0xEA, 0x47, 0xF0, 0x18, 0xBE, 0xFE, 0x7F,
+    0xCF, 0xCA, 0x40, 0x2C, 0x68, 0xBD, 0xFD, 0xEF, 0xFD, 0x1C, 0x35, 0x28, 0x47, 0xE1, 0xD7, 0x7F,
+    0x30, 0xE8, 0x63, 0x02, 0x73, 0x7F, 0xFE, 0x87, 0x82, 0xFD, 0x20, 0xDE, 0xE3, 0xFF, 0xC8, 0x5C,
+    0x07, 0x38, 0x0F, 0xEC, 0xCC, 0x4F, 0x08, 0x2E, 0x1F, 0x90, 0xFB, 0x17, 0xC4, 0xE8, 0x0D, 0x2B,
+    0xFD, 0xFD, 0xFF, 0x3F, 0x07, 0x03, 0x43, 0x01, 0x88, 0xE7, 0x07, 0x32, 0xE3, 0xE8, 0x7F, 0xA0,
+    0xC9, 0x1F, 0x81, 0xBC, 0xFB, 0x8C, 0x60, 0x1B, 0x92, 0x80, 0xF8, 0x3B, 0x90, 0x2B, 0x87, 0x70,
+    0x10, 0x28, 0x8C, 0xD8, 0x50, 0x82, 0xE1, 0x3E, 0x42, 0x12, 0x64, 0x12, 0x92, 0x57, 0x41, 0x21,
+    0x68, 0x8F, 0xE0, 0x5E, 0x00, 0x72, 0xF9, 0x11, 0xDC, 0x0F, 0x40, 0x2E, 0x2F, 0x2A, 0x97, 0x07,
+    0xC1, 0x05, 0xB9, 0x82, 0x1B, 0x27, 0x17, 0x4D, 0x31, 0x1A, 0xF7, 0x01, 0xAA, 0x45, 0x07, 0x80,
+    0x5C, 0x79, 0x04, 0x77, 0x02, 0x6A, 0xD4, 0x25, 0xC0, 0x02, 0x10, 0x02, 0x04, 0x40, 0x81, 0xC1,
+    0x84, 0xE0, 0xFF, 0x41, 0xB5, 0xF8, 0x1B, 0x6A, 0xA2, 0x00, 0xD9, 0xF4, 0x5F, 0x1B, 0xC4, 0x52,
+    0x38, 0x0E, 0x74, 0x40, 0x00, 0x38, 0x84, 0x7B, 0xC2, 0x52, 0x77, 0xFC, 0x03, 0xBB, 0xE7, 0x17,
+    0x22, 0xD8, 0x79, 0xA0, 0x0E, 0x41, 0xE2, 0x32, 0xFC, 0x46, 0xE5, 0x16, 0xA0, 0x72, 0x19, 0x26,
+    0x41, 0x79, 0xF3, 0xA1, 0x29, 0xCB, 0x61, 0xC7, 0xDF, 0xFF, 0xEF, 0xD6, 0x98, 0x03, 0x59, 0x00,
+    0x3C, 0x1D, 0xF8, 0xE8, 0x78, 0x9C, 0x85, 0xD0, 0x3D, 0x0E, 0x01, 0x61, 0x10, 0x06, 0xE0, 0xD7,
+    0xBF, 0xA0, 0x70, 0x02, 0x56, 0xA3, 0x13, 0x5C, 0x04, 0x47, 0xE0, 0x00, 0x12, 0x89, 0x0B, 0xB8,
+    0x81, 0x4A, 0xA5, 0x51, 0xA9, 0xD4, 0x5A, 0x9C, 0x80, 0x4A, 0xA3, 0x70, 0x02, 0x59, 0xBF, 0xF1,
+    0x9B, 0x1D, 0xB3, 0x33, 0xDF, 0xF2, 0x15, 0x12, 0x53, 0x3D, 0xD9, 0x7C, 0x33, 0xF3, 0xCE, 0x02,
+    0x52, 0x2F, 0x22, 0xCA, 0x28, 0x3B, 0xCC, 0x65, 0x48, 0x7D, 0x62, 0xA7, 0x94, 0x59, 0x8F, 0xA8,
+    0xAF, 0xC4, 0x9C, 0x3F, 0xC7, 0x8C, 0x1F, 0x44, 0x25, 0x7C, 0x3A, 0x67, 0xA6, 0x11, 0x47, 0xA2,
+    0x04, 0xFE, 0x54, 0x77, 0xE3, 0xB9, 0x93, 0xA2, 0x70, 0x4D, 0x52, 0x6D, 0xE6, 0x42, 0x49, 0x2E,
+    0xE0, 0x78, 0xC6, 0xBC, 0x78, 0x65, 0x48, 0x65, 0xD9, 0xA9, 0x95, 0x86, 0x23, 0x6D, 0xA1, 0xEA,
+    0x94, 0x03, 0x8D, 0xFC, 0xE4, 0xFE, 0xB4, 0x16, 0xB0, 0x67, 0xE7, 0xF1, 0xBD, 0x22, 0x69, 0x7C,
+    0x65, 0x47, 0x8C, 0xEF, 0xEC, 0x20, 0xCB, 0x43, 0x16, 0x6A, 0x3D, 0x89, 0xB6, 0xBF, 0x6C, 0xBF,
+    0xB1, 0x7B, 0x6F, 0xD6, 0xCC, 0x8B, 0xB5, 0xEB, 0xC0, 0xCE, 0xE9, 0xCF, 0x93, 0xF8, 0x33, 0x9F,
+    0x8D, 0x1A, 0x9A, 0x92, 0x39, 0x5C, 0x18, 0x78, 0x75, 0x20, 0x38, 0x91, 0xD8, 0x67, 0xCB, 0x3D,
+    0xCB, 0x92, 0x3A, 0x70, 0x45, 0xAF, 0x77, 0xE3, 0xFE, 0x34, 0x67, 0xBC, 0x23, 0x77, 0x18, 0x05,
+    0xDE, 0xD5, 0xA1, 0xC0, 0xFE, 0x78, 0x9C, 0xFB, 0xF1, 0x1F, 0x06, 0xF8, 0x7F, 0x90, 0xCF, 0x34,
+    0x31, 0x06, 0x01, 0x66, 0x10, 0x93, 0x91, 0x01, 0x0C, 0xA8, 0xC3, 0x84, 0x00, 0x26, 0x0A, 0x98,
+    0x10, 0x97, 0x51, 0xC9, 0x39, 0xD8, 0x99, 0x2E, 0x60, 0xC0, 0x42, 0x41, 0xF0, 0x41, 0x99, 0x10,
+    0x23, 0x1D, 0xFE, 0xFD, 0x67, 0x85, 0xB0, 0x18, 0xBE, 0xFD, 0x8F, 0x87, 0xB2, 0x12, 0xFE, 0xFF,
+    0x67, 0x87, 0x32, 0x3F, 0xFD, 0xBF, 0x0F, 0x65, 0x31, 0xFC, 0xFC, 0x9F, 0x0F, 0x63, 0xFE, 0xFD,
+    0x6F, 0x0F, 0x63, 0xFE, 0x43, 0x16, 0xFD, 0x5F, 0x79, 0x12, 0xA6, 0x16, 0x08, 0x20, 0xCC, 0x8F,
+    0x08, 0xA6, 0xC1, 0x3F, 0x38, 0x93, 0xA1, 0xF1, 0xEF, 0xFB, 0x1E, 0x06, 0x00, 0xFD, 0x3A, 0x25,
+    0x08, 0x78, 0x9C, 0x75, 0x90, 0xB1, 0xAE, 0x01, 0x51, 0x10, 0x86, 0x67, 0x71, 0x43, 0x10, 0xD9,
+    0x27, 0x90, 0xAD, 0x35, 0xD4, 0x1E, 0x82, 0xEA, 0xD6, 0x68, 0x35, 0xB7, 0xD7, 0x50, 0xE8, 0x24,
+    0xA2, 0x95, 0x48, 0x3C, 0x82, 0x42, 0x22, 0xA2, 0xA2, 0x92, 0x5B, 0xF1, 0x00, 0x42, 0x21, 0xD1,
+    0xDE, 0x9B, 0xDC, 0x5C, 0x82, 0xB5, 0xE3, 0x9F, 0xB3, 0x7B, 0x8E, 0xD3, 0x98, 0x62, 0x66, 0xBE,
+    0xEC, 0xCC, 0x3F, 0xFF, 0x1E, 0x22, 0xA2, 0xEE, 0x8E, 0xF7, 0x4D, 0x87, 0x54, 0x9C, 0x58, 0x62,
+    0xAC, 0x68, 0xC5, 0x61, 0x54, 0xD0, 0x7B, 0x41, 0x04, 0xFC, 0x41, 0xB4, 0xD5, 0x3D, 0x17, 0x89,
+    0x6E, 0x28, 0xFD, 0xCF, 0x35, 0xF2, 0x86, 0x3C, 0xC9, 0xD8, 0x3D, 0xA3, 0x26, 0x06, 0x48, 0x79,
+    0xAC, 0x76, 0x50, 0xD3, 0xBF, 0x48, 0x49, 0x80, 0x8B, 0x9A, 0xFB, 0x43, 0x8A, 0xCB, 0x05, 0x1F,
+    0x0A, 0x32, 0xAB, 0x4E, 0x43, 0xA8, 0x7A, 0xE5, 0x57, 0xD4, 0x6E, 0x16, 0x7C, 0xDD, 0xDF, 0x82,
+    0x3D, 0x56, 0x83, 0xC0, 0x81, 0x74, 0x5C, 0xB4, 0xB4, 0x84, 0x1C, 0x4D, 0x68, 0x10, 0x3B, 0x59,
+    0x0D, 0x62, 0xB4, 0x1D, 0xB6, 0x0D, 0xF5, 0x0B, 0x5C, 0x10, 0xA7, 0x33, 0x08, 0x29, 0x3F, 0xA3,
+    0xE1, 0x22, 0x10, 0xD5, 0xA5, 0x39, 0x03, 0x70, 0x7D, 0x0B, 0x94, 0x84, 0x01, 0x9A, 0x46, 0x50,
+    0x0E, 0x35, 0xBF, 0x03, 0xDE, 0xF7, 0xCC, 0x69, 0xF2, 0x1E, 0x9C, 0x32, 0x70, 0xE4, 0xB1, 0xE9,
+    0x4B, 0xCC, 0x19, 0x03, 0x78, 0x63, 0xC7, 0xC0, 0xBF, 0x35, 0x05, 0x4F, 0xED, 0x17, 0xDC, 0x79,
+    0x62, 0x7F, 0xE1, 0xD6, 0x3C, 0x66, 0x76, 0xF4, 0x2B, 0x53, 0x64, 0x5D, 0x83, 0xFB, 0xB0, 0x80,
+    0xEA, 0xFE, 0xCF, 0xC8, 0xA1, 0x27, 0x36, 0x6C, 0x05, 0x4D, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0xF1,
+    0xFF, 0xFF, 0x7F, 0x46, 0x06, 0x18, 0x18, 0x04, 0x3C, 0x03, 0x64, 0x9E, 0xE1, 0x1F, 0x26, 0x24,
+    0xDE, 0xCF, 0xFF, 0xDC, 0x48, 0xBC, 0xFF, 0xFF, 0xE3, 0x51, 0x78, 0xF7, 0x51, 0x79, 0x4C, 0xC8,
+    0x3C, 0x0E, 0x08, 0x47, 0xE0, 0x37, 0x88, 0xA3, 0x0D, 0x55, 0xF8, 0x0C, 0xC4, 0x89, 0x83, 0x72,
+    0x0E, 0x81, 0xD5, 0xC1, 0xDC, 0xF2, 0x1B, 0x85, 0xF7, 0x09, 0x85, 0x37, 0x01, 0x85, 0x27, 0xF0,
+    0x0F, 0x99, 0xC7, 0x50, 0x46, 0xBD, 0x90, 0x70, 0x81, 0x00, 0x26, 0x98, 0x1F, 0x60, 0x1E, 0xA1,
+    0x06, 0x0F, 0x00, 0x6D, 0xCD, 0xD3, 0x59, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0xF1, 0xFF, 0xFF, 0x7F,
+    0x06, 0x10, 0x18, 0x30, 0xC6, 0x11, 0x18, 0xE3, 0x3F, 0x07, 0x8C, 0xA1, 0x0F, 0x63, 0xEC, 0x87,
+    0x31, 0xFE, 0xB3, 0x30, 0x30, 0xFC, 0x02, 0xD1, 0x79, 0x0C, 0x0C, 0x57, 0x40, 0xF4, 0x7C, 0x06,
+    0x86, 0x4D, 0x60, 0x09, 0x26, 0x06, 0x86, 0x3F, 0x60, 0x06, 0x50, 0xE9, 0x67, 0x18, 0x63, 0x01,
+    0x8C, 0xA1, 0x00, 0x63, 0x30, 0xCC, 0xA0, 0x9F, 0xBF, 0x00, 0x94, 0x1A, 0xA9, 0x1A, 0x78, 0x9C,
+    0x8D, 0xD1, 0xDD, 0x09, 0xC2, 0x30, 0x14, 0x86, 0xE1, 0x63, 0x51, 0x41, 0x41, 0xED, 0x04, 0x3A,
+    0x81, 0x3A, 0x42, 0xDD, 0x40, 0xEF, 0xBD, 0x11, 0x27, 0x70, 0x03, 0xDD, 0xC0, 0x2E, 0x20, 0x75,
+    0x14, 0x37, 0x68, 0x37, 0x70, 0x04, 0x41, 0xC4, 0x1F, 0x94, 0x1E, 0x93, 0x93, 0xA4, 0x7E, 0x3D,
+    0x57, 0xE6, 0x2A, 0x79, 0x48, 0xF2, 0x42, 0x42, 0xE4, 0x46, 0xCA, 0xCC, 0x17, 0x82, 0x71, 0x33,
+    0x30, 0x81, 0x75, 0x5C, 0x32, 0xE7, 0x0D, 0x80, 0x93, 0xD9, 0xD0, 0xC5, 0x13, 0x2F, 0xE6, 0x2D,
+    0xAE, 0x57, 0x66, 0x43, 0x53, 0x5D, 0x39, 0xC6, 0x35, 0x95, 0x9C, 0xD1, 0xDF, 0xE3, 0x69, 0xAE,
+    0xE3, 0x96, 0x9B, 0x1F, 0xCD, 0x34, 0x12, 0xE8, 0x69, 0xD8, 0x6A, 0xE0, 0x86, 0x86, 0x8E, 0x86,
+    0x44, 0x43, 0xAE, 0xC1, 0x85, 0x11, 0xFA, 0x08, 0x87, 0x10, 0x0E, 0x30, 0x2C, 0x7D, 0x38, 0xC0,
+    0xE0, 0xEE, 0x9F, 0xAB, 0x82, 0xC2, 0x87, 0x03, 0x8C, 0x66, 0x3E, 0x5C, 0x01, 0xBD, 0x5D, 0x38,
+    0xC0, 0x94, 0xAE, 0x2E, 0x1C, 0x20, 0x91, 0x6F, 0xDB, 0x23, 0xD8, 0x6F, 0xE2, 0x08, 0x80, 0x1E,
+    0x12, 0x06, 0x70, 0xE1, 0xD4, 0xC3, 0x9C, 0xC8, 0x86, 0xCF, 0x08, 0x12, 0x6E, 0xEF, 0x00, 0x24,
+    0x8C, 0x20, 0xE1, 0x0D, 0x40, 0x6C, 0x1F, 0x65, 0x0D, 0x20, 0xE1, 0x25, 0x82, 0x0D, 0x67, 0x08,
+    0x0B, 0xF7, 0x94, 0x3F, 0x90, 0x70, 0x0D, 0xAE, 0x1A, 0x52, 0x0D, 0xB1, 0x06, 0x09, 0xD7, 0xA0,
+    0xD0, 0xB0, 0xD0, 0x40, 0x1F, 0x81, 0x2F, 0xDE, 0x96, 0x8A, 0x87, 0x78, 0x9C, 0x63, 0x60, 0x00,
+    0x83, 0xAF, 0xFF, 0xFF, 0xFF, 0xB7, 0x67, 0x80, 0x02, 0x81, 0x7F, 0x40, 0x1E, 0x2B, 0x8C, 0x77,
+    0x00, 0xC8, 0xB1, 0x83, 0x71, 0x18, 0x7E, 0xFC, 0xFF, 0x7F, 0x9F, 0x09, 0xC6, 0x09, 0x00, 0x4A,
+    0x71, 0xC3, 0xA5, 0x3E, 0xFF, 0xFF, 0xDF, 0x0F, 0xE7, 0x00, 0xCD, 0x78, 0xCF, 0x02, 0xE7, 0x2D,
+    0xF8, 0xFF, 0x5F, 0x87, 0x81, 0x48, 0xB0, 0xEC, 0xEF, 0xFB, 0xB9, 0x20, 0xCB, 0x3F, 0xFE, 0xFF,
+    0xCF, 0xC3, 0xF0, 0x0C, 0x68, 0xC3, 0xFF, 0xF7, 0xAC, 0x60, 0x9E, 0xFC, 0x82, 0xFF, 0x60, 0x50,
+    0x0F, 0xE6, 0xE5, 0xFF, 0x80, 0xF0, 0x80, 0x0E, 0xFD, 0xF8, 0x1F, 0x01, 0xF8, 0x50, 0x78, 0xF1,
+    0x10, 0x5E, 0x3F, 0xB3, 0xC0, 0x77, 0x20, 0xB5, 0x1E, 0xC2, 0x03, 0x3A, 0x2B, 0x01, 0x64, 0x2A,
+    0x98, 0x07, 0x76, 0xF1, 0x5F, 0x20, 0x03, 0xCC, 0x93, 0x07, 0xF1, 0x7E, 0x02, 0x19, 0x8C, 0x20,
+    0x1E, 0x0F, 0x88, 0xF7, 0x0D, 0xC6, 0xE3, 0x84, 0x85, 0x13, 0x98, 0xC7, 0x8E, 0xC2, 0x63, 0xC3,
+    0xC3, 0x63, 0x1D, 0x72, 0x3C, 0x00, 0xC7, 0x1F, 0x08, 0xA4, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x81,
+    0x09, 0xFF, 0xFF, 0xFF, 0x7F, 0xCF, 0x00, 0x01, 0x5F, 0x80, 0x6C, 0x3D, 0x08, 0x53, 0xE0, 0xDF,
+    0xFF, 0xFF, 0xE7, 0x19, 0x21, 0xEC, 0x03, 0x40, 0x61, 0x2E, 0xA8, 0x92, 0x9F, 0xFF, 0xFF, 0xD7,
+    0x43, 0x99, 0x09, 0x40, 0x61, 0x16, 0x84, 0x4E, 0x5D, 0x28, 0x93, 0xE1, 0xDF, 0xFF, 0xF9, 0x0C,
+    0x04, 0x80, 0xC1, 0xF6, 0xB7, 0xFF, 0xEF, 0x55, 0x31, 0x83, 0x98, 0x01, 0x7F, 0xFF, 0x83, 0xC0,
+    0x7B, 0x4B, 0xA0, 0x9D, 0xBF, 0xFF, 0x43, 0x81, 0x2E, 0xC3, 0x41, 0x18, 0xF3, 0x3F, 0x3F, 0x03,
+    0x5C, 0xF8, 0x3F, 0xA7, 0x03, 0x9C, 0xF9, 0x9F, 0x69, 0x03, 0x88, 0xCC, 0x0A, 0x5D, 0xFE, 0xF7,
+    0xFF, 0x7E, 0x86, 0x0F, 0x50, 0x97, 0x2B, 0x5C, 0x8F, 0x67, 0xF8, 0x04, 0x64, 0xB3, 0x81, 0xAD,
+    0x61, 0x66, 0xF8, 0x0C, 0x52, 0x88, 0xE4, 0x3B, 0x66, 0x28, 0x1B, 0xA4, 0x86, 0x13, 0xCA, 0x06,
+    0xE9, 0xED, 0x87, 0xB2, 0x17, 0x80, 0xCC, 0xF4, 0x85, 0x3A, 0x12, 0x6C, 0x8D, 0x0F, 0x84, 0xF3,
+    0x03, 0xCC, 0x89, 0x05, 0xB3, 0x37, 0x40, 0x1C, 0x00, 0x51, 0xF6, 0x0B, 0xC2, 0x91, 0x02, 0x87,
+    0xC8, 0x3F, 0x88, 0x5F, 0xC0, 0xB6, 0x34, 0x42, 0x24, 0xFC, 0x19, 0x10, 0x9C, 0xF7, 0x90, 0x00,
+    0x2D, 0x00, 0x2B, 0x83, 0x5A, 0xDF, 0x00, 0x62, 0xCB, 0x23, 0x39, 0xD1, 0x1F, 0xCA, 0x0E, 0xF8,
+    0x8F, 0x08, 0x6A, 0x06, 0x24, 0x27, 0x02, 0xC3, 0xF7, 0x7F, 0xFD, 0x2A, 0x88, 0x47, 0x14, 0x80,
+    0xE2, 0xF9, 0xBF, 0xEF, 0xAB, 0x83, 0xD8, 0xA0, 0x10, 0xD3, 0x07, 0x06, 0xD5, 0xBA, 0x70, 0x97,
+    0xA9, 0x20, 0x0B, 0x78, 0x11, 0xC1, 0xF6, 0x9F, 0x0D, 0xC1, 0xDE, 0x8F, 0x14, 0x9C, 0x3C, 0x30,
+    0xD7, 0xFF, 0x07, 0x45, 0x59, 0x00, 0x54, 0x62, 0x3F, 0xD8, 0xEC, 0xD6, 0xDB, 0xFF, 0xFE, 0x9F,
+    0xCB, 0x04, 0x39, 0x18, 0x00, 0xD9, 0x08, 0x07, 0x68, 0x78, 0x9C, 0x7D, 0xD0, 0x3D, 0x0E, 0x01,
+    0x51, 0x10, 0x07, 0xF0, 0x59, 0xEB, 0x23, 0x22, 0x2B, 0x2A, 0xB5, 0x5E, 0xA2, 0x54, 0x8A, 0x1B,
+    0x38, 0x80, 0x42, 0xB8, 0x00, 0xA5, 0x23, 0x48, 0x44, 0xE2, 0x00, 0x12, 0x25, 0x15, 0x47, 0xA0,
+    0x10, 0x85, 0x06, 0x8D, 0x42, 0x41, 0xA2, 0xD2, 0xC8, 0x46, 0x22, 0xBE, 0x56, 0xFC, 0xCD, 0x9B,
+    0xD9, 0xDD, 0xD2, 0x14, 0x2F, 0xBF, 0x4C, 0xF2, 0x66, 0xFE, 0xEF, 0x11, 0x71, 0x95, 0xC1, 0x15,
+    0x33, 0xA2, 0x0D, 0xAB, 0x29, 0xA2, 0x37, 0x33, 0x2A, 0x6A, 0xB1, 0x0A, 0xDA, 0xBC, 0x01, 0x6B,
+    0x4B, 0x94, 0xFB, 0x02, 0x49, 0x6D, 0x6E, 0x81, 0x9A, 0x8A, 0x5E, 0x38, 0x46, 0xE8, 0x4F, 0xE5,
+    0x46, 0x17, 0x1C, 0xBA, 0x66, 0x6C, 0xF9, 0x03, 0xA9, 0x2A, 0xD1, 0x13, 0x7E, 0x25, 0x5A, 0x81,
+    0x60, 0x5D, 0x03, 0x4D, 0xE9, 0xC1, 0xE7, 0xA4, 0xB3, 0x07, 0x2A, 0x26, 0x94, 0xCB, 0xFB, 0xEB,
+    0x1F, 0x87, 0x3C, 0x60, 0x26, 0x23, 0x6D, 0x89, 0x6A, 0xEB, 0x02, 0x33, 0x6B, 0x68, 0x05, 0x59,
+    0xF9, 0xB6, 0x3C, 0x61, 0x2E, 0x93, 0x8E, 0x71, 0x3F, 0x37, 0x97, 0x9B, 0x60, 0x9F, 0x74, 0x83,
+    0x44, 0xF6, 0x43, 0x94, 0x98, 0x99, 0xB3, 0xB6, 0x65, 0xCA, 0x52, 0x1C, 0x17, 0x2F, 0x0C, 0x53,
+    0xBA, 0xE8, 0xCE, 0x74, 0x94, 0x7D, 0x66, 0xBA, 0x18, 0x7E, 0x95, 0xE3, 0xF5, 0x6C, 0xFD, 0x15,
+    0xA4, 0x38, 0xE4, 0xA0, 0x3D, 0x96, 0x09, 0x5E, 0xF0, 0x20, 0xD7, 0x0A, 0x59, 0xA3, 0x90, 0x31,
+    0xDA, 0xF9, 0xCA, 0xF3, 0xE5, 0xC6, 0xEA, 0x0B, 0x77, 0x90, 0x65, 0xFD, 0x00, 0x97, 0xF9, 0xD4,
+    0xB1, 0x78, 0x9C, 0xAD, 0xD1, 0xDD, 0x0D, 0x01, 0x41, 0x14, 0x05, 0xE0, 0xF1, 0x4F, 0x2C, 0x51,
+    0x80, 0x50, 0x02, 0x1D, 0x20, 0xF1, 0x4E, 0x29, 0x3A, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 0x50,
+    0x02, 0x1D, 0x20, 0xF1, 0x2E, 0xFE, 0x36, 0x96, 0xE5, 0x3A, 0xC3, 0xDE, 0x93, 0xF1, 0xE4, 0x65,
+    0xEF, 0xDB, 0x97, 0x33, 0x99, 0xC9, 0x9C, 0x6B, 0xCC, 0x67, 0x02, 0x11, 0x29, 0x9B, 0x68, 0xDA,
+    0xC0, 0x21, 0xA9, 0xDA, 0x41, 0x55, 0x85, 0x09, 0x45, 0xE6, 0xC4, 0x04, 0x51, 0x8E, 0xF2, 0x45,
+    0x7A, 0x04, 0xEE, 0xD8, 0xF0, 0x0A, 0xB3, 0x15, 0x29, 0x98, 0xBF, 0x73, 0x15, 0x67, 0xD2, 0x71,
+    0x68, 0x63, 0x3A, 0xDD, 0xEF, 0xEC, 0xA1, 0x16, 0x5F, 0xBA, 0x41, 0x79, 0x45, 0x13, 0x58, 0x31,
+    0x5A, 0x43, 0x0D, 0x2A, 0x70, 0x7F, 0x68, 0x7B, 0x59, 0x32, 0xB2, 0xBD, 0xD4, 0xA9, 0x3B, 0x94,
+    0x55, 0xF4, 0x7F, 0x0E, 0x1E, 0xA1, 0x1A, 0xF5, 0x80, 0x32, 0x8A, 0x81, 0xB8, 0x75, 0x9E, 0xDC,
+    0x25, 0xD8, 0xA6, 0x25, 0xAD, 0x18, 0x01, 0x53, 0x46, 0x67, 0xA8, 0x44, 0x3D, 0xA1, 0x94, 0xC2,
+    0xAE, 0x64, 0xCC, 0xE8, 0x02, 0x79, 0xD4, 0x0B, 0xE2, 0x4E, 0x66, 0xC0, 0x90, 0x91, 0x2D, 0xAD,
+    0xA8, 0xA8, 0xD8, 0x83, 0x09, 0xD5, 0xC2, 0x3E, 0x1D, 0xB5, 0xD8, 0x4D, 0xF9, 0x6E, 0xD7, 0x5E,
+    0x18, 0x8B, 0xDE, 0x2A, 0x70, 0x1D, 0x1E, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x81, 0x87, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x07, 0xB3, 0x18, 0x7E, 0x03, 0x99, 0x9C, 0x60, 0x56, 0x01, 0x90, 0x55, 0x0F, 0x11,
+    0xFC, 0x0C, 0x64, 0xB2, 0x82, 0x59, 0x02, 0xFF, 0xFE, 0xFF, 0xB7, 0x83, 0x08, 0x1E, 0xF8, 0xFF,
+    0x7F, 0x3F, 0x23, 0x84, 0xF9, 0xEB, 0xFF, 0x7F, 0x0E, 0x08, 0x2B, 0xE0, 0xFF, 0x7F, 0x3F, 0x06,
+    0x62, 0xC0, 0x83, 0xFF, 0x30, 0x50, 0x4F, 0x0A, 0x73, 0xC2, 0x6E, 0x10, 0x00, 0x39, 0x52, 0x0E,
+    0x62, 0xCE, 0x4F, 0x20, 0x93, 0x19, 0x66, 0x35, 0xCC, 0xBD, 0x9F, 0x80, 0x4C, 0x6E, 0x08, 0xF3,
+    0xEF, 0xFF, 0xFF, 0xEF, 0x21, 0xAE, 0x9C, 0x00, 0x14, 0xB4, 0x87, 0x08, 0x7E, 0x05, 0x32, 0xD9,
+    0xC1, 0x2C, 0x05, 0x20, 0x6B, 0x3F, 0x44, 0xF0, 0x02, 0xAA, 0xA1, 0x2C, 0x78, 0x0C, 0xFD, 0x83,
+    0x62, 0xA8, 0x3F, 0xC2, 0x50, 0x0E, 0x74, 0x43, 0x81, 0x81, 0xF4, 0xFF, 0x3C, 0xD8, 0xCD, 0xB3,
+    0x7F, 0xC0, 0x7D, 0xF1, 0xFE, 0x17, 0x09, 0x4C, 0x00, 0xB4, 0x2F, 0xD2, 0x6D, 0x78, 0x9C, 0xAD,
+    0xD1, 0xDB, 0x0D, 0x01, 0x41, 0x18, 0x05, 0xE0, 0x61, 0xD7, 0x25, 0xB1, 0x44, 0x05, 0xE8, 0x80,
+    0x0E, 0x5C, 0xB2, 0x05, 0xE8, 0x80, 0x12, 0x74, 0x40, 0x07, 0x74, 0x40, 0x14, 0x80, 0x0E, 0x94,
+    0x40, 0x07, 0x22, 0xE1, 0x59, 0x5C, 0xE3, 0xB2, 0xF6, 0x77, 0x26, 0xCC, 0xD9, 0xDD, 0x47, 0xC9,
+    0xFE, 0x6F, 0x5F, 0xCE, 0x64, 0x26, 0x73, 0x7E, 0xA5, 0xF4, 0xB4, 0x92, 0x2A, 0x98, 0xBD, 0x1C,
+    0x6C, 0xA2, 0x22, 0x22, 0x65, 0xAA, 0x07, 0x75, 0xA8, 0x01, 0xD4, 0xA7, 0xBA, 0x91, 0xAC, 0xE8,
+    0x8B, 0xE4, 0x83, 0x3B, 0xA7, 0xFE, 0x2C, 0xA1, 0xFE, 0x9B, 0xAB, 0x84, 0xC6, 0x8E, 0x43, 0x1B,
+    0xD5, 0x74, 0xBF, 0xB3, 0x83, 0xEA, 0x7C, 0xE9, 0x0E, 0x65, 0x0D, 0x6A, 0xC0, 0x8A, 0xD1, 0x1A,
+    0xAA, 0x52, 0x0F, 0x28, 0x63, 0xD0, 0x00, 0x96, 0x8C, 0xB6, 0x91, 0x9E, 0x9E, 0x50, 0xDA, 0xA0,
+    0x1D, 0x39, 0x78, 0x84, 0x4A, 0xD4, 0x0B, 0x4A, 0x19, 0xE8, 0x76, 0xE7, 0x8C, 0x4E, 0x50, 0x81,
+    0xF2, 0xF4, 0x67, 0x0C, 0x74, 0xF1, 0x63, 0x46, 0x67, 0x09, 0x57, 0xFD, 0x86, 0x2C, 0x83, 0x11,
+    0x30, 0x64, 0x74, 0x81, 0x1C, 0x0A, 0x0B, 0x12, 0xAE, 0x7D, 0x12, 0x59, 0xA5, 0x2E, 0x2D, 0x67,
+    0xA0, 0x37, 0x29, 0x5C, 0xDE, 0x42, 0x3F, 0xFD, 0x6B, 0xD1, 0xB5, 0x6E, 0xE1, 0xAE, 0x1D, 0x2F,
+    0x16, 0x7D, 0x00, 0x2A, 0x3C, 0x17, 0xAF, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x10, 0x30, 0x66,
+    0x64, 0x80, 0x82, 0x5F, 0xFF, 0xF7, 0x43, 0xD9, 0x0D, 0xFF, 0xFF, 0xFF, 0xE7, 0x82, 0x30, 0x2F,
+    0x00, 0x99, 0xFC, 0x10, 0xE6, 0x03, 0x20, 0x53, 0x1E, 0xC2, 0x3C, 0x80, 0x10, 0x0D, 0x00, 0x32,
+    0x39, 0xA0, 0x26, 0x1C, 0xFD, 0x57, 0xCB, 0x40, 0x22, 0x00, 0x19, 0x0A, 0x01, 0xF5, 0xA4, 0x30,
+    0x27, 0xEC, 0x06, 0x81, 0xDF, 0x40, 0xA6, 0x1C, 0xC4, 0x9C, 0x9F, 0x40, 0x26, 0x33, 0xDC, 0x41,
+    0xF5, 0x10, 0xC1, 0x4F, 0x40, 0x26, 0x37, 0x84, 0xF9, 0xF7, 0xFF, 0xFF, 0xF7, 0x10, 0xDF, 0x4D,
+    0x00, 0x0A, 0xDA, 0x43, 0x04, 0xBF, 0x02, 0x99, 0xEC, 0x60, 0x96, 0x02, 0x90, 0xB5, 0x1F, 0xE1,
+    0x63, 0x24, 0x43, 0x59, 0xF0, 0x18, 0xFA, 0x07, 0xC5, 0x50, 0x7F, 0x84, 0xA1, 0x1C, 0xE8, 0x86,
+    0x82, 0x02, 0xEC, 0x3C, 0xD8, 0xCD, 0xB3, 0x7F, 0xC0, 0x7D, 0xF1, 0xFE, 0x17, 0x09, 0x4C, 0x00,
+    0xD7, 0xDC, 0xCD, 0x77,
+};
+const GFXglyph OpenSans24BGlyphs[] = {
+    { 0, 0, 13, 0, 0, 8, 0 }, //  
+    { 10, 37, 14, 2, 36, 128, 8 }, // !
+    { 18, 13, 24, 3, 36, 100, 136 }, // "
+    { 31, 36, 32, 1, 36, 220, 236 }, // #
+    { 25, 41, 29, 2, 38, 222, 456 }, // $
+    { 43, 36, 45, 1, 36, 370, 678 }, // %
+    { 36, 36, 38, 2, 36, 305, 1048 }, // &
+    { 8, 13, 13, 3, 36, 53, 1353 }, // '
+    { 14, 44, 17, 2, 36, 165, 1406 }, // (
+    { 14, 44, 17, 1, 36, 162, 1571 }, // )
+    { 25, 24, 27, 1, 38, 185, 1733 }, // *
+    { 25, 25, 29, 2, 30, 52, 1918 }, // +
+    { 11, 12, 15, 1, 6, 68, 1970 }, // ,
+    { 14, 7, 16, 1, 16, 20, 2038 }, // -
+    { 10, 9, 14, 2, 8, 46, 2058 }, // .
+    { 21, 36, 21, 0, 36, 171, 2104 }, // /
+    { 26, 36, 29, 1, 36, 244, 2275 }, // 0
+    { 19, 36, 29, 2, 36, 89, 2519 }, // 1
+    { 26, 36, 29, 1, 36, 186, 2608 }, // 2
+    { 26, 36, 29, 1, 36, 231, 2794 }, // 3
+    { 28, 36, 29, 0, 36, 144, 3025 }, // 4
+    { 25, 36, 29, 2, 36, 206, 3169 }, // 5
+    { 26, 36, 29, 1, 36, 254, 3375 }, // 6
+    { 26, 36, 29, 1, 36, 166, 3629 }, // 7
+    { 26, 36, 29, 1, 36, 270, 3795 }, // 8
+    { 26, 36, 29, 1, 36, 257, 4065 }, // 9
+    { 10, 29, 14, 2, 28, 78, 4322 }, // :
+    { 11, 34, 15, 1, 28, 109, 4400 }, // ;
+    { 25, 28, 29, 2, 32, 133, 4509 }, // <
+    { 25, 15, 29, 2, 25, 30, 4642 }, // =
+    { 25, 28, 29, 2, 32, 132, 4672 }, // >
+    { 23, 37, 24, 0, 36, 189, 4804 }, // ?
+    { 41, 40, 45, 2, 36, 445, 4993 }, // @
+    { 35, 36, 35, 0, 36, 264, 5438 }, // A
+    { 27, 36, 34, 4, 36, 179, 5702 }, // B
+    { 29, 36, 32, 2, 36, 221, 5881 }, // C
+    { 31, 36, 37, 4, 36, 200, 6102 }, // D
+    { 22, 36, 28, 4, 36, 47, 6302 }, // E
+    { 21, 36, 27, 4, 36, 37, 6349 }, // F
+    { 31, 36, 36, 2, 36, 244, 6386 }, // G
+    { 30, 36, 38, 4, 36, 37, 6630 }, // H
+    { 9, 36, 17, 4, 36, 17, 6667 }, // I
+    { 17, 46, 17, -4, 36, 82, 6684 }, // J
+    { 30, 36, 33, 4, 36, 200, 6766 }, // K
+    { 23, 36, 28, 4, 36, 31, 6966 }, // L
+    { 39, 36, 47, 4, 36, 276, 6997 }, // M
+    { 33, 36, 41, 4, 36, 175, 7273 }, // N
+    { 35, 36, 40, 2, 36, 269, 7448 }, // O
+    { 26, 36, 31, 4, 36, 129, 7717 }, // P
+    { 35, 44, 40, 2, 36, 309, 7846 }, // Q
+    { 30, 36, 33, 4, 36, 183, 8155 }, // R
+    { 24, 36, 28, 2, 36, 232, 8338 }, // S
+    { 27, 36, 29, 1, 36, 38, 8570 }, // T
+    { 30, 36, 38, 4, 36, 135, 8608 }, // U
+    { 33, 36, 33, 0, 36, 254, 8743 }, // V
+    { 49, 36, 48, 0, 36, 402, 8997 }, // W
+    { 34, 36, 33, 0, 36, 271, 9399 }, // X
+    { 32, 36, 31, 0, 36, 178, 9670 }, // Y
+    { 27, 36, 29, 1, 36, 160, 9848 }, // Z
+    { 13, 44, 17, 3, 36, 31, 10008 }, // [
+    { 21, 36, 21, 0, 36, 164, 10039 }, // '\\'
+    { 13, 44, 17, 1, 36, 32, 10203 }, // ]
+    { 27, 23, 27, 0, 36, 169, 10235 }, // ^
+    { 22, 4, 21, -1, -4, 19, 10404 }, // _
+    { 15, 8, 30, 8, 38, 55, 10423 }, // `
+    { 25, 28, 30, 2, 28, 205, 10478 }, // a
+    { 27, 38, 32, 3, 38, 194, 10683 }, // b
+    { 23, 28, 26, 2, 28, 171, 10877 }, // c
+    { 26, 38, 32, 2, 38, 205, 11048 }, // d
+    { 26, 28, 30, 2, 28, 189, 11253 }, // e
+    { 21, 38, 19, 1, 38, 98, 11442 }, // f
+    { 28, 40, 28, 0, 28, 294, 11540 }, // g
+    { 27, 38, 33, 3, 38, 112, 11834 }, // h
+    { 9, 38, 15, 3, 38, 51, 11946 }, // i
+    { 16, 50, 15, -4, 38, 109, 11997 }, // j
+    { 28, 38, 31, 3, 38, 168, 12106 }, // k
+    { 9, 38, 15, 3, 38, 17, 12274 }, // l
+    { 43, 28, 49, 3, 28, 171, 12291 }, // m
+    { 27, 28, 33, 3, 28, 107, 12462 }, // n
+    { 27, 28, 31, 2, 28, 200, 12569 }, // o
+    { 27, 40, 32, 3, 28, 194, 12769 }, // p
+    { 26, 40, 32, 2, 28, 207, 12963 }, // q
+    { 19, 28, 23, 3, 28, 87, 13170 }, // r
+    { 21, 28, 25, 2, 28, 195, 13257 }, // s
+    { 20, 33, 22, 1, 33, 110, 13452 }, // t
+    { 26, 27, 33, 3, 27, 106, 13562 }, // u
+    { 29, 27, 28, 0, 27, 213, 13668 }, // v
+    { 43, 27, 43, 0, 27, 312, 13881 }, // w
+    { 29, 27, 29, 0, 27, 178, 14193 }, // x
+    { 29, 39, 28, 0, 27, 249, 14371 }, // y
+    { 22, 27, 24, 1, 27, 98, 14620 }, // z
+    { 18, 44, 20, 0, 36, 145, 14718 }, // {
+    { 6, 49, 28, 11, 38, 14, 14863 }, // |
+    { 17, 44, 20, 2, 36, 138, 14877 }, // }
+    { 25, 11, 29, 2, 23, 90, 15015 }, // ~
+    { 18, 17, 21, 2, 36, 117, 15105 }, // °
+    { 35, 46, 40, 2, 46, 312, 15222 }, // Ó
+    { 25, 38, 30, 2, 38, 269, 15534 }, // ä
+    { 27, 38, 31, 2, 38, 237, 15803 }, // ó
+    { 35, 48, 35, 0, 36, 317, 16040 }, // Ą
+    { 25, 40, 30, 2, 28, 260, 16357 }, // ą
+    { 29, 46, 32, 2, 46, 267, 16617 }, // Ć
+    { 23, 38, 26, 2, 38, 209, 16884 }, // ć
+    { 22, 48, 28, 4, 36, 108, 17093 }, // Ę
+    { 26, 40, 30, 2, 28, 249, 17201 }, // ę
+    { 27, 36, 28, 0, 36, 93, 17450 }, // Ł
+    { 17, 38, 17, 0, 38, 71, 17543 }, // ł
+    { 33, 46, 41, 4, 46, 221, 17614 }, // Ń
+    { 27, 38, 33, 3, 38, 159, 17835 }, // ń
+    { 24, 46, 28, 2, 46, 271, 17994 }, // Ś
+    { 21, 38, 25, 2, 38, 232, 18265 }, // ś
+    { 27, 46, 29, 1, 46, 198, 18497 }, // Ź
+    { 22, 38, 24, 1, 38, 150, 18695 }, // ź
+    { 27, 47, 29, 1, 47, 202, 18845 }, // Ż
+    { 22, 39, 24, 1, 39, 141, 19047 }, // ż
+};
+const UnicodeInterval OpenSans24BIntervals[] = {
+    { 0x20, 0x7E, 0x0 },
+    { 0xB0, 0xB0, 0x5F },
+    { 0xD3, 0xD3, 0x60 },
+    { 0xE4, 0xE4, 0x61 },
+    { 0xF3, 0xF3, 0x62 },
+    { 0x104, 0x107, 0x63 },
+    { 0x118, 0x119, 0x67 },
+    { 0x141, 0x144, 0x69 },
+    { 0x15A, 0x15B, 0x6D },
+    { 0x179, 0x17C, 0x6F },
+};
+const GFXfont OpenSans24B = {
+    (uint8_t*)OpenSans24BBitmaps,
+    (GFXglyph*)OpenSans24BGlyphs,
+    (UnicodeInterval*)OpenSans24BIntervals,
+    10,
+    1,
+    68,
+    54,
+    -15,
+};
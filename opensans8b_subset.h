@@ -0,0 +1,523 @@
+#pragma once
+// Generated by tools/fontsubset.py from opensans8b.h, do not edit
+#include "epd_driver.h"
+const uint8_t OpenSans8BBitmaps[6062] = {
+    0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x9C, 0x01, 0x18, 0x00, 0xE7, 0xFF, 0xF0,
+    0xDF, 0xE0, 0xCF, 0xD0, 0xBF, 0xD0, 0xAF, 0xC0, 0xAF, 0xB0, 0x9F, 0xA0, 0x8F, 0x70, 0x5B, 0x00,
+    0x00, 0x70, 0x5C, 0xF0, 0xDF, 0xA0, 0x7F, 0xD1, 0x3C, 0x0E, 0xFF, 0x78, 0x9C, 0xFB, 0x1B, 0xF6,
+    0xFE, 0x8F, 0xCB, 0xF9, 0x5F, 0xCA, 0xFB, 0x7F, 0x0A, 0xCE, 0x07, 0x00, 0x36, 0xC8, 0x07, 0xD7,
+    0x78, 0x9C, 0x63, 0x10, 0xD8, 0xBF, 0x40, 0x9F, 0x81, 0xC1, 0xA1, 0xFF, 0x02, 0x1F, 0x03, 0x43,
+    0x83, 0xFF, 0x47, 0x6E, 0x86, 0x0F, 0xFF, 0x81, 0x80, 0x73, 0xC3, 0xEF, 0xFD, 0xFF, 0xF6, 0xB0,
+    0x33, 0x7C, 0xE4, 0xFE, 0xC5, 0xC4, 0xC0, 0xF0, 0x99, 0xE3, 0x2F, 0x03, 0xC3, 0x2F, 0x90, 0x38,
+    0xC3, 0xF6, 0x7F, 0xA7, 0xEF, 0xEF, 0x66, 0x60, 0xF8, 0x93, 0x90, 0xCF, 0xC0, 0xC0, 0x70, 0x7E,
+    0x82, 0x3D, 0x03, 0x83, 0xC2, 0xFC, 0x03, 0xFC, 0x0C, 0x0C, 0x00, 0xAF, 0xB5, 0x20, 0x2E, 0x78,
+    0x9C, 0x63, 0x60, 0xA8, 0x66, 0x60, 0x60, 0x38, 0xFE, 0x7F, 0x2D, 0xEB, 0x86, 0xFF, 0xFF, 0xFF,
+    0x73, 0x7E, 0xEA, 0xEF, 0x6E, 0x66, 0xFA, 0xD4, 0x0F, 0x14, 0x3B, 0xF0, 0x7F, 0x3D, 0x23, 0x83,
+    0xC0, 0xAF, 0xFF, 0xFD, 0x0C, 0x0C, 0x0A, 0x7F, 0xFF, 0x73, 0x31, 0x30, 0x54, 0xFF, 0xE6, 0x9F,
+    0x2C, 0x52, 0xFD, 0x8B, 0xEF, 0x0B, 0x50, 0x1D, 0x7B, 0xE3, 0x9B, 0xFF, 0xD1, 0x40, 0x7D, 0x20,
+    0xBD, 0x20, 0x02, 0x00, 0x64, 0xC3, 0x1D, 0xC8, 0x78, 0x9C, 0x33, 0xF8, 0xAB, 0xC3, 0xE0, 0xB0,
+    0x9F, 0x81, 0xE1, 0xC3, 0xFD, 0xF3, 0x0C, 0x17, 0xF4, 0x19, 0x18, 0xBE, 0xF2, 0xFC, 0x67, 0xFC,
+    0xC6, 0xC9, 0xC0, 0xF0, 0x8D, 0xEB, 0x2F, 0xF3, 0x3F, 0x46, 0x30, 0xDD, 0xDC, 0xFF, 0xB2, 0x8E,
+    0xE1, 0x0B, 0xCF, 0xFF, 0xCF, 0x7D, 0xEF, 0xFF, 0xB3, 0x3C, 0xB8, 0x7F, 0xFE, 0xD7, 0x55, 0xFF,
+    0xEF, 0x9C, 0x0E, 0x7F, 0xA3, 0xCF, 0x3F, 0xD0, 0xFF, 0xCA, 0xCD, 0xC0, 0x70, 0xC0, 0x1E, 0x42,
+    0x7F, 0xE5, 0x3A, 0x00, 0x14, 0x67, 0x60, 0xF8, 0xCB, 0x54, 0x00, 0x54, 0xC7, 0x50, 0xD0, 0xCF,
+    0xC0, 0xF0, 0xB3, 0x8E, 0x01, 0x00, 0x65, 0x66, 0x2B, 0xF2, 0x78, 0x9C, 0x63, 0x58, 0xF8, 0x2F,
+    0x96, 0x01, 0x08, 0xFE, 0xFE, 0xFF, 0xCF, 0xC2, 0xC0, 0x60, 0xF0, 0x9F, 0xE5, 0x2F, 0x27, 0x88,
+    0x62, 0xFA, 0xCB, 0x01, 0x14, 0xFC, 0xB7, 0xFB, 0x3F, 0x13, 0x90, 0xFA, 0xFA, 0xDF, 0x0E, 0x48,
+    0x1A, 0xFC, 0xFB, 0xCF, 0x35, 0xE1, 0x3F, 0xE3, 0x83, 0xF7, 0xDF, 0xCF, 0x7F, 0x5A, 0xCF, 0xF0,
+    0x25, 0x1F, 0xC8, 0xD7, 0x67, 0xF8, 0x7C, 0x5E, 0xF9, 0xDB, 0x7F, 0x76, 0x86, 0x03, 0xFF, 0x81,
+    0x40, 0x8F, 0x81, 0xE1, 0xF8, 0xBF, 0xDE, 0xC3, 0xFF, 0x59, 0x00, 0xCF, 0xD8, 0x27, 0xF6, 0x78,
+    0x9C, 0xFB, 0xCB, 0xF6, 0x87, 0xE5, 0x17, 0xF3, 0x4F, 0x46, 0x00, 0x13, 0xFA, 0x03, 0xFB, 0x78,
+    0x9C, 0x63, 0xF8, 0xC4, 0xC7, 0xF0, 0x87, 0xD5, 0xE1, 0x3D, 0xC3, 0x82, 0x7E, 0x86, 0x07, 0xFE,
+    0x0C, 0x9F, 0xF8, 0x19, 0x3E, 0xF3, 0x33, 0x7C, 0xE1, 0x03, 0x91, 0x40, 0xF6, 0x07, 0x7F, 0x86,
+    0x0D, 0xFD, 0x0C, 0x01, 0xEF, 0x19, 0x18, 0xFE, 0xB2, 0x32, 0x7C, 0xE6, 0x03, 0x00, 0x7D, 0xD7,
+    0x10, 0x57, 0x78, 0x9C, 0xFB, 0xCC, 0xCB, 0x30, 0x61, 0x3E, 0x83, 0xC2, 0x7F, 0x46, 0x86, 0x3F,
+    0xEC, 0x0C, 0x3F, 0xB8, 0x19, 0xBE, 0xF0, 0x31, 0x7C, 0xE6, 0x67, 0xF8, 0xC4, 0x0F, 0x22, 0x81,
+    0x6C, 0xA0, 0xC8, 0x1F, 0x76, 0xA0, 0x2C, 0x50, 0xCD, 0x67, 0x5E, 0x06, 0x00, 0x6C, 0x28, 0x0F,
+    0xB4, 0x78, 0x9C, 0x63, 0x48, 0x58, 0xCF, 0xC0, 0xC0, 0xE0, 0xD0, 0xCF, 0xC0, 0x30, 0xC9, 0xA4,
+    0xBE, 0x99, 0xF5, 0xEB, 0xFF, 0xFF, 0xFF, 0xB9, 0x82, 0x9E, 0xFF, 0xCF, 0x60, 0x66, 0xF8, 0xF6,
+    0x97, 0x8B, 0x41, 0xE1, 0xFF, 0xA5, 0x7C, 0x06, 0x81, 0x19, 0x01, 0xDA, 0x0C, 0x60, 0x00, 0x00,
+    0x86, 0x86, 0x0F, 0xCB, 0x78, 0x9C, 0x63, 0x60, 0x30, 0x61, 0x60, 0x60, 0x10, 0x38, 0x8F, 0x4C,
+    0x7C, 0xF9, 0xFF, 0xFF, 0x3F, 0xFF, 0xE5, 0xBB, 0xFF, 0xEF, 0xF2, 0xA0, 0x49, 0x00, 0x00, 0x14,
+    0x85, 0x0D, 0x07, 0x78, 0x9C, 0x3B, 0xB0, 0xFF, 0x43, 0xFC, 0x27, 0xFE, 0x6F, 0x1C, 0x00, 0x18,
+    0xA5, 0x04, 0xCE, 0x78, 0x9C, 0xFB, 0xF1, 0x9F, 0xFF, 0xC7, 0x7F, 0x7E, 0x01, 0x41, 0x46, 0x00,
+    0x1C, 0x7C, 0x04, 0x2F, 0x78, 0x9C, 0x2B, 0x88, 0xF9, 0x70, 0x7F, 0x41, 0x3D, 0x00, 0x0C, 0x8E,
+    0x03, 0xBB, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0xC1, 0xCD, 0xC0, 0xF0, 0x8F, 0x95, 0xC1, 0xE1, 0x3F,
+    0x03, 0xC3, 0x82, 0xF9, 0x0C, 0x0C, 0x1F, 0xED, 0x19, 0x18, 0xBE, 0xF3, 0x32, 0x30, 0xFC, 0x65,
+    0x67, 0x30, 0xF8, 0xCF, 0xC8, 0x30, 0x61, 0x3F, 0x03, 0xC3, 0x83, 0x78, 0x06, 0x86, 0xAF, 0xFC,
+    0x0C, 0x0C, 0xBF, 0x39, 0x19, 0x18, 0x00, 0x50, 0xB1, 0x0D, 0x83, 0x78, 0x9C, 0x63, 0x38, 0xFA,
+    0x5E, 0x8A, 0x21, 0xE0, 0xFF, 0xFF, 0xF7, 0x8C, 0x17, 0xEE, 0x07, 0xFF, 0xE7, 0xF8, 0x94, 0xCF,
+    0xF0, 0x9B, 0xF7, 0x8B, 0x3D, 0xC3, 0x0F, 0xFE, 0xAF, 0xFA, 0x0C, 0xDF, 0xE5, 0xC1, 0x04, 0x98,
+    0x0B, 0x96, 0xB8, 0x70, 0x3F, 0xE8, 0x3F, 0x87, 0x03, 0x48, 0x31, 0xC3, 0x91, 0xFF, 0xDA, 0x0C,
+    0x00, 0x9B, 0xAC, 0x1D, 0xF4, 0x78, 0x9C, 0x63, 0x58, 0xF0, 0x9F, 0x41, 0xE1, 0xEF, 0x7F, 0x86,
+    0x27, 0xFF, 0xFF, 0x33, 0xFC, 0xEA, 0xFA, 0xCF, 0x90, 0xD0, 0xF0, 0x9F, 0x81, 0x01, 0x0F, 0x06,
+    0x00, 0x3D, 0x0C, 0x15, 0x79, 0x78, 0x9C, 0x63, 0xB8, 0xFE, 0xDF, 0x87, 0xE1, 0xE2, 0xFF, 0xFF,
+    0xFF, 0x59, 0x36, 0xD4, 0x05, 0xFD, 0xE7, 0x66, 0x60, 0x64, 0xF8, 0xC3, 0xC3, 0xC0, 0xC0, 0xF0,
+    0x8F, 0x93, 0x81, 0x61, 0xC2, 0x7F, 0x26, 0x06, 0x86, 0x1F, 0xF1, 0x0C, 0x0C, 0x0D, 0xFF, 0x59,
+    0x81, 0x0C, 0x7F, 0x90, 0x88, 0xAA, 0x12, 0xD3, 0x17, 0xA0, 0x62, 0xFD, 0xAF, 0x20, 0x02, 0x00,
+    0xF2, 0x4A, 0x1A, 0x5B, 0x78, 0x9C, 0x73, 0x78, 0xF5, 0xDE, 0x9B, 0xE1, 0xE3, 0xFF, 0xFF, 0xFF,
+    0x59, 0x0A, 0x2C, 0x03, 0xFF, 0x73, 0x31, 0x30, 0x30, 0xFC, 0xE3, 0x64, 0x60, 0x48, 0xFC, 0xCF,
+    0xC4, 0xF0, 0xFD, 0xBF, 0x36, 0x03, 0x90, 0xD8, 0xCF, 0xC4, 0xC0, 0xE0, 0xF0, 0x8F, 0x07, 0x28,
+    0xF1, 0x9B, 0xBF, 0x45, 0x38, 0xF0, 0x3F, 0xDF, 0x57, 0xA0, 0x62, 0xD6, 0x49, 0x7F, 0xDF, 0x5B,
+    0x31, 0x00, 0x00, 0x24, 0xE8, 0x1A, 0x93, 0x78, 0x9C, 0x63, 0x60, 0xD8, 0xF0, 0x9F, 0x81, 0x81,
+    0xE1, 0x2B, 0x90, 0x10, 0xF8, 0x07, 0x24, 0x16, 0xEC, 0x07, 0x12, 0x5F, 0xBA, 0x80, 0xC4, 0xBF,
+    0xC6, 0xFF, 0x0C, 0x13, 0xEA, 0x1B, 0xFE, 0x33, 0x7C, 0xE1, 0x05, 0x12, 0xBF, 0xFF, 0xFF, 0xFF,
+    0x5F, 0x0F, 0x26, 0x18, 0x18, 0x1A, 0x40, 0x3A, 0x80, 0x04, 0x00, 0x5C, 0xAF, 0x1E, 0x04, 0x78,
+    0x9C, 0x6B, 0xF8, 0xFF, 0xFF, 0x3F, 0xE3, 0x04, 0x10, 0xB1, 0xE0, 0xBC, 0x92, 0x12, 0xC3, 0x86,
+    0xF5, 0x0C, 0x0C, 0x0C, 0x17, 0xFE, 0xBF, 0xB7, 0x01, 0x12, 0xFF, 0xFF, 0xB3, 0x08, 0x88, 0x14,
+    0xFD, 0xE7, 0x01, 0x8A, 0xFC, 0xE6, 0x03, 0x11, 0xBC, 0x8B, 0x54, 0x8A, 0xFE, 0x73, 0x7E, 0xFA,
+    0xFF, 0xFF, 0x3D, 0xE3, 0xC4, 0xBF, 0xF7, 0x25, 0x19, 0x00, 0xAA, 0x0D, 0x1D, 0x42, 0x78, 0x9C,
+    0x01, 0x3C, 0x00, 0xC3, 0xFF, 0x00, 0x40, 0xEB, 0xFF, 0x04, 0x00, 0xFA, 0xFF, 0xFF, 0x05, 0x60,
+    0xFF, 0x27, 0x10, 0x00, 0xE0, 0x6F, 0x00, 0x00, 0x00, 0xF2, 0x4F, 0xFC, 0x8E, 0x00, 0xF5, 0xEF,
+    0xFF, 0xFF, 0x08, 0xF6, 0xBF, 0x11, 0xFC, 0x0F, 0xF5, 0x3F, 0x00, 0xF5, 0x1F, 0xF3, 0x4F, 0x00,
+    0xF6, 0x1F, 0xE0, 0xDF, 0x22, 0xFD, 0x0E, 0x40, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xB3, 0xFF, 0x5C,
+    0x00, 0x8C, 0xE1, 0x1E, 0x72, 0x78, 0x9C, 0xFB, 0xF1, 0xFF, 0xFF, 0x7F, 0xFD, 0x1F, 0x20, 0x42,
+    0x51, 0x49, 0xE9, 0x0F, 0x0F, 0x03, 0x83, 0xC2, 0x7F, 0x56, 0x06, 0x86, 0x05, 0xEF, 0x19, 0x18,
+    0x18, 0x3E, 0xD6, 0x03, 0x89, 0x9F, 0xFC, 0x0C, 0x0C, 0x02, 0xFF, 0x39, 0x19, 0x18, 0x0A, 0xFE,
+    0x33, 0x31, 0x30, 0x3C, 0x58, 0x0F, 0x14, 0xFA, 0x66, 0x0F, 0x24, 0xFE, 0x02, 0x95, 0x02, 0x00,
+    0x20, 0x61, 0x15, 0x37, 0x78, 0x9C, 0x01, 0x3C, 0x00, 0xC3, 0xFF, 0x00, 0xD6, 0xEF, 0x4B, 0x00,
+    0x90, 0xFF, 0xFE, 0xFF, 0x05, 0xF0, 0x9F, 0x00, 0xFD, 0x0A, 0xE0, 0x8F, 0x00, 0xFC, 0x09, 0x70,
+    0xFF, 0xB9, 0xFF, 0x02, 0x00, 0xF8, 0xFF, 0x2E, 0x00, 0x40, 0xFE, 0xFF, 0xBF, 0x00, 0xF1, 0xAF,
+    0x40, 0xFE, 0x0A, 0xF5, 0x0F, 0x00, 0xF5, 0x0F, 0xF5, 0x5F, 0x00, 0xF9, 0x0F, 0xD0, 0xFF, 0xFE,
+    0xFF, 0x08, 0x10, 0xD8, 0xEF, 0x5C, 0x00, 0xE4, 0xDA, 0x20, 0x49, 0x78, 0x9C, 0x01, 0x3C, 0x00,
+    0xC3, 0xFF, 0x00, 0xD7, 0xEF, 0x19, 0x00, 0xA0, 0xFF, 0xFF, 0xEF, 0x01, 0xF2, 0xAF, 0x51, 0xFF,
+    0x09, 0xF6, 0x1F, 0x00, 0xF9, 0x0E, 0xF6, 0x1F, 0x00, 0xF7, 0x0F, 0xF4, 0x8F, 0x30, 0xFE, 0x1F,
+    0xD0, 0xFF, 0xFF, 0xFE, 0x0F, 0x10, 0xEA, 0xAF, 0xF7, 0x0D, 0x00, 0x00, 0x00, 0xFB, 0x09, 0x10,
+    0x00, 0xA3, 0xFF, 0x02, 0x90, 0xFF, 0xFF, 0x5F, 0x00, 0x90, 0xFF, 0x9D, 0x02, 0x00, 0xB9, 0xB6,
+    0x1D, 0xCA, 0x78, 0x9C, 0x5B, 0xD0, 0xFF, 0xE1, 0x7E, 0x41, 0x0C, 0x03, 0x18, 0x14, 0xC4, 0x7C,
+    0xB8, 0xBF, 0xA0, 0x1E, 0x00, 0x48, 0x36, 0x07, 0x85, 0x78, 0x9C, 0x5B, 0xD0, 0xFF, 0xE1, 0x7E,
+    0x41, 0x0C, 0x03, 0x14, 0x1C, 0xD8, 0xFF, 0x21, 0xFE, 0x13, 0xFF, 0x37, 0x0E, 0x00, 0x63, 0x77,
+    0x08, 0x98, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x60, 0x05, 0xE2, 0x6B, 0xFC, 0x40, 0xFC, 0x9F,
+    0x93, 0xE1, 0xDA, 0x7B, 0x09, 0x86, 0x47, 0xEF, 0xD9, 0x19, 0x18, 0x3E, 0x03, 0x19, 0x0C, 0x0C,
+    0xCF, 0xFF, 0x7B, 0x01, 0xC9, 0xA3, 0xFF, 0x79, 0x81, 0xE4, 0x62, 0xA0, 0x12, 0x06, 0x06, 0x46,
+    0x00, 0x54, 0xB7, 0x0D, 0x2C, 0x78, 0x9C, 0xFB, 0xF2, 0xFF, 0xFF, 0x7F, 0xFE, 0xCB, 0x77, 0xEF,
+    0xDE, 0xE5, 0x61, 0x00, 0x01, 0x30, 0xEB, 0x0B, 0x48, 0x0C, 0x00, 0xC8, 0xC5, 0x0E, 0xED, 0x78,
+    0x9C, 0x33, 0x62, 0x00, 0x82, 0x2F, 0xD6, 0x40, 0x62, 0xE3, 0x7F, 0x10, 0xB9, 0x08, 0x4C, 0x4E,
+    0xFA, 0xCF, 0xCD, 0xC0, 0xB0, 0xF8, 0x3F, 0x2F, 0xC3, 0xB1, 0xFF, 0x31, 0x0C, 0x9F, 0xFF, 0x5B,
+    0x31, 0x30, 0x3C, 0x91, 0x00, 0x0A, 0x33, 0x82, 0x14, 0x03, 0x00, 0x69, 0x50, 0x0D, 0xBE, 0x78,
+    0x9C, 0x9B, 0xF4, 0xF7, 0x1C, 0xCB, 0xEF, 0xFF, 0xFF, 0xFD, 0x17, 0x8B, 0x3C, 0x5A, 0xCF, 0xC0,
+    0x70, 0x60, 0x3E, 0x03, 0xC3, 0x4F, 0x7B, 0x86, 0x03, 0xEF, 0x59, 0x18, 0x7E, 0xC8, 0x32, 0x30,
+    0xFC, 0xE6, 0x60, 0x00, 0x83, 0xE3, 0x6C, 0x0C, 0x0C, 0xFF, 0xF8, 0x80, 0x52, 0x1C, 0x0C, 0x00,
+    0x11, 0xE5, 0x11, 0x2E, 0x78, 0x9C, 0x63, 0x60, 0x68, 0x7A, 0x7B, 0xDF, 0x92, 0x81, 0x81, 0xA1,
+    0xE0, 0xFF, 0x9A, 0x93, 0xFF, 0xD9, 0x19, 0x18, 0x7E, 0xE8, 0x30, 0x30, 0x5C, 0xCA, 0x67, 0x70,
+    0x38, 0xEF, 0xF0, 0xE7, 0xBE, 0xD4, 0x7B, 0x86, 0x0D, 0xF6, 0x5F, 0xE6, 0xFF, 0xE0, 0xFB, 0xC5,
+    0xFC, 0x81, 0xF7, 0x2F, 0xCB, 0x07, 0xBE, 0xEF, 0xAC, 0x1F, 0xB9, 0xFF, 0x33, 0x7C, 0xE4, 0x05,
+    0xD1, 0xFF, 0x18, 0xBE, 0xF2, 0xFE, 0x62, 0xFA, 0xC0, 0xF7, 0x73, 0xCE, 0xBF, 0xF9, 0xFB, 0x19,
+    0x16, 0xC4, 0x4F, 0xF8, 0x67, 0xF5, 0x57, 0x8A, 0x41, 0xE1, 0x3F, 0x2B, 0x03, 0x83, 0x22, 0xD0,
+    0xBC, 0x27, 0xF7, 0x67, 0xDD, 0xAE, 0x07, 0xD2, 0x02, 0xC7, 0xFF, 0x9D, 0xD3, 0x60, 0x60, 0x00,
+    0x00, 0xA6, 0xFB, 0x2E, 0x08, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0x37, 0x9F, 0x81, 0x81, 0xC1, 0xE1,
+    0xFF, 0x7B, 0x20, 0x39, 0x61, 0xFF, 0x7F, 0x56, 0x06, 0x86, 0x0F, 0xF9, 0xBF, 0xB8, 0x18, 0x18,
+    0xBE, 0xCA, 0x7F, 0x95, 0x67, 0x60, 0xF8, 0xC5, 0xF3, 0x21, 0x9F, 0x41, 0xE0, 0x3F, 0xFB, 0x86,
+    0xF3, 0x0C, 0x09, 0xFF, 0x81, 0x80, 0xF1, 0x00, 0x88, 0x64, 0xFF, 0x38, 0x5F, 0x49, 0xE9, 0x2F,
+    0xEF, 0x77, 0x7B, 0x06, 0x86, 0x1F, 0xF6, 0x7F, 0xF9, 0x18, 0x18, 0x3E, 0xF7, 0x03, 0x00, 0x46,
+    0x1B, 0x20, 0x9C, 0x78, 0x9C, 0xFB, 0xFE, 0xFF, 0x7D, 0x0D, 0xC3, 0xF7, 0xFF, 0xFF, 0xFF, 0x73,
+    0x7F, 0xB7, 0x77, 0xFC, 0xAB, 0xFF, 0x5D, 0x9E, 0xE1, 0x3B, 0x90, 0x50, 0xF8, 0xC3, 0x07, 0x14,
+    0xBB, 0xCF, 0x0C, 0x92, 0xE0, 0xF8, 0xAE, 0xAF, 0xF0, 0xD3, 0x1F, 0x28, 0xF1, 0xB9, 0xFE, 0xBB,
+    0xBD, 0xD1, 0xEF, 0x7C, 0x90, 0x18, 0x2F, 0x90, 0xE8, 0x65, 0x04, 0x00, 0x82, 0x0B, 0x25, 0xBF,
+    0x78, 0x9C, 0x63, 0x50, 0xB8, 0xF9, 0x3E, 0x9B, 0x81, 0xE1, 0xEB, 0xFF, 0xFF, 0xFF, 0x19, 0x14,
+    0xFE, 0xE7, 0x39, 0x75, 0x32, 0x34, 0xFC, 0x67, 0x61, 0x60, 0x60, 0xB8, 0x70, 0x1F, 0x48, 0x30,
+    0x7C, 0xD8, 0x8F, 0x20, 0x1F, 0x80, 0x45, 0x16, 0xFC, 0x67, 0x06, 0x92, 0x06, 0xFF, 0xF3, 0x8C,
+    0xDB, 0x18, 0x18, 0x7E, 0xFC, 0xFF, 0x7F, 0x9E, 0x81, 0xC1, 0xE1, 0xF5, 0xFB, 0x1C, 0x06, 0x00,
+    0xF2, 0x01, 0x1B, 0x30, 0x78, 0x9C, 0xFB, 0xFE, 0xFF, 0x7D, 0x34, 0x03, 0xC3, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xF3, 0x30, 0x7C, 0xB7, 0x77, 0xFA, 0xBD, 0x9E, 0xE1, 0xBB, 0x3C, 0xC3, 0x86, 0xFF, 0x4C,
+    0x40, 0xD2, 0xE1, 0x3F, 0x3B, 0x90, 0x54, 0xF8, 0xCF, 0x01, 0x27, 0x03, 0xFE, 0xB3, 0x01, 0xC9,
+    0x03, 0x40, 0x59, 0xFB, 0xA0, 0x3F, 0xF3, 0xC1, 0xBA, 0xB8, 0x81, 0xE4, 0x7B, 0x2F, 0x06, 0x06,
+    0x00, 0x2B, 0xCE, 0x23, 0x93, 0x78, 0x9C, 0xFB, 0xFE, 0xFF, 0x7F, 0xFF, 0x77, 0x10, 0xB6, 0x17,
+    0x64, 0xFC, 0x2E, 0xCF, 0xC0, 0x00, 0xC6, 0xFF, 0xFF, 0xDB, 0x83, 0x31, 0x4C, 0xCC, 0x5E, 0x49,
+    0xE8, 0x3B, 0x54, 0x1D, 0x00, 0xB1, 0x94, 0x1B, 0xB5, 0x78, 0x9C, 0xFB, 0xFE, 0xFF, 0x7F, 0xFD,
+    0x77, 0x10, 0xD6, 0x17, 0x64, 0xFC, 0x2E, 0xCF, 0xC0, 0x00, 0xC6, 0xFF, 0xFF, 0xEB, 0x83, 0x31,
+    0xB2, 0x18, 0x14, 0x03, 0x00, 0x8E, 0x4C, 0x16, 0x25, 0x78, 0x9C, 0x63, 0x10, 0x38, 0xF1, 0x7F,
+    0x1F, 0x2B, 0xC3, 0x93, 0xFF, 0xFF, 0xFF, 0x73, 0x2A, 0xFC, 0x9F, 0xAF, 0x3C, 0x85, 0x79, 0xC2,
+    0x7F, 0x76, 0x06, 0x06, 0x86, 0x0B, 0xEF, 0x81, 0x04, 0xC3, 0x87, 0xFD, 0x0C, 0x7F, 0xFF, 0xF3,
+    0x43, 0xC8, 0x07, 0xF7, 0x19, 0x14, 0x7F, 0xF2, 0x2F, 0xF8, 0xCF, 0xC2, 0xF0, 0x93, 0xDF, 0xE0,
+    0x7F, 0xBE, 0xF1, 0x6F, 0x7E, 0x86, 0xEF, 0x40, 0x5D, 0xFC, 0x0C, 0x0E, 0xAF, 0xFE, 0xAF, 0x65,
+    0x03, 0x00, 0xDE, 0x31, 0x23, 0x13, 0x78, 0x9C, 0xFB, 0x2E, 0xCF, 0x20, 0xF0, 0x9F, 0xFD, 0x3B,
+    0x2E, 0xF2, 0x3F, 0x10, 0xC0, 0x48, 0x7B, 0x25, 0x23, 0xDC, 0x2A, 0x01, 0x9E, 0x28, 0x20, 0x11,
+    0x78, 0x9C, 0xFB, 0x2E, 0xFF, 0x1D, 0x2B, 0x04, 0x00, 0xA8, 0x0C, 0x0D, 0x09, 0x78, 0x9C, 0x63,
+    0x28, 0xF8, 0xCF, 0xC8, 0x40, 0x0A, 0x9E, 0xF0, 0x9F, 0xC1, 0xF0, 0xC9, 0x7D, 0x86, 0x2F, 0xFF,
+    0xE3, 0x19, 0x1E, 0xDF, 0x67, 0x63, 0x00, 0x00, 0xF9, 0xCA, 0x18, 0xDE, 0x78, 0x9C, 0xFB, 0x2E,
+    0xCF, 0xF0, 0xF0, 0x3C, 0xC3, 0x77, 0x79, 0x86, 0x3F, 0x7A, 0x40, 0x72, 0xC2, 0x7F, 0x16, 0x20,
+    0xF9, 0xAD, 0x9E, 0x81, 0xE1, 0xBB, 0xFF, 0x7F, 0x2E, 0x20, 0xF9, 0xFE, 0x3F, 0x33, 0x90, 0xFC,
+    0xFF, 0x9F, 0x07, 0x48, 0xD6, 0x7F, 0xCF, 0x07, 0x92, 0xF2, 0x17, 0xFE, 0x33, 0x02, 0x49, 0x83,
+    0xFF, 0xDC, 0x20, 0x5D, 0x3F, 0xE3, 0x41, 0xE4, 0x83, 0xF7, 0x8C, 0x00, 0x9C, 0xE3, 0x1F, 0xD9,
+    0x78, 0x9C, 0xFB, 0x2E, 0xCF, 0xC0, 0xC0, 0xF0, 0x9D, 0x58, 0xC2, 0x5E, 0x49, 0x89, 0xE1, 0xFB,
+    0xFF, 0xFF, 0xFF, 0x21, 0x04, 0x00, 0xCA, 0xB9, 0x13, 0x29, 0x78, 0x9C, 0xFB, 0xFE, 0x9F, 0x89,
+    0x41, 0xE1, 0x7F, 0xFF, 0xF7, 0xFF, 0x1C, 0x0C, 0x0D, 0x20, 0x8A, 0x97, 0xE1, 0x02, 0x90, 0xFA,
+    0xAD, 0xCF, 0xF0, 0xE9, 0x6C, 0xFF, 0xF7, 0x35, 0xF5, 0x0C, 0xDF, 0x6F, 0xF4, 0x7F, 0x8F, 0x39,
+    0xCF, 0xF0, 0xF7, 0x51, 0xFF, 0x77, 0xDE, 0xFF, 0x8A, 0xF7, 0x1F, 0x00, 0xA9, 0xDF, 0x65, 0xFD,
+    0x20, 0xEA, 0xDB, 0x6D, 0x7D, 0x10, 0xF5, 0xF1, 0x3F, 0x2F, 0x88, 0x3A, 0xF0, 0x9F, 0x03, 0x44,
+    0x15, 0xFC, 0x67, 0x7A, 0xD0, 0x0F, 0x00, 0x80, 0xC7, 0x33, 0x79, 0x78, 0x9C, 0xFB, 0xFE, 0x9F,
+    0x91, 0xE1, 0x83, 0xFF, 0xF7, 0xFF, 0x5C, 0x60, 0xD2, 0x1E, 0x44, 0xBE, 0x3E, 0x0F, 0x22, 0x63,
+    0xFE, 0xB3, 0x01, 0x49, 0x9E, 0x3F, 0x72, 0x40, 0x92, 0xF7, 0xD3, 0x7C, 0x10, 0x39, 0xE1, 0xFF,
+    0x27, 0x20, 0x29, 0xF0, 0xEF, 0x0D, 0x90, 0x64, 0xF8, 0xF6, 0x1F, 0x44, 0x5E, 0x00, 0x93, 0x0E,
+    0xFF, 0xFD, 0x01, 0xFA, 0xC1, 0x28, 0xBE, 0x78, 0x9C, 0x63, 0x30, 0x78, 0xF5, 0xBF, 0x86, 0x81,
+    0x81, 0xE1, 0xDB, 0xFF, 0xFF, 0xFF, 0x65, 0x19, 0x0C, 0xFE, 0xE7, 0x3B, 0xFF, 0xDA, 0xCF, 0xB0,
+    0xE0, 0x3F, 0x0B, 0xC3, 0x86, 0xFF, 0x4C, 0x0F, 0xDE, 0x33, 0x30, 0x04, 0xFC, 0x67, 0xFB, 0xB0,
+    0x9F, 0x01, 0x28, 0xC1, 0x01, 0xA5, 0xA0, 0x82, 0x50, 0x25, 0x20, 0x0D, 0xBF, 0xF7, 0xC3, 0xB4,
+    0x33, 0x40, 0x0C, 0x03, 0x00, 0x94, 0x92, 0x27, 0x3C, 0x78, 0x9C, 0xFB, 0xFE, 0xFF, 0xBD, 0x15,
+    0xC3, 0xF7, 0xFF, 0xFF, 0xFF, 0x33, 0x7F, 0xB7, 0x4F, 0xFA, 0xCF, 0xFD, 0x5D, 0x9E, 0xE1, 0x0F,
+    0x2F, 0x84, 0xB0, 0x6F, 0xFA, 0xCF, 0x09, 0x94, 0x78, 0xCF, 0xF4, 0xFD, 0xFF, 0x7B, 0x49, 0x06,
+    0xA0, 0x18, 0x03, 0x3A, 0x01, 0x00, 0x01, 0xE5, 0x1B, 0xF3, 0x78, 0x9C, 0x63, 0x30, 0x78, 0xF5,
+    0xBF, 0x86, 0x81, 0x81, 0xE1, 0xDB, 0xFF, 0xFF, 0xFF, 0x65, 0x19, 0x0C, 0xFE, 0xE7, 0x3B, 0xFF,
+    0xDA, 0xCF, 0xB0, 0xE0, 0x3F, 0x0B, 0xC3, 0x86, 0xFF, 0x4C, 0x0F, 0xDE, 0x33, 0x30, 0x04, 0xFC,
+    0x67, 0xFB, 0xB0, 0x9F, 0x01, 0x28, 0xC1, 0x01, 0xA1, 0xD8, 0xA1, 0x82, 0x50, 0x25, 0x20, 0x0D,
+    0xBF, 0xF7, 0xC3, 0xB4, 0x33, 0x00, 0x0D, 0x3B, 0xCF, 0x00, 0x02, 0x0B, 0xFE, 0xB3, 0x81, 0xE9,
+    0xBF, 0xF6, 0x60, 0xEA, 0xF3, 0x7B, 0x26, 0x00, 0x01, 0xAA, 0x2C, 0x53, 0x78, 0x9C, 0xFB, 0xFE,
+    0xFF, 0xBD, 0x17, 0x03, 0xC3, 0xF7, 0xFF, 0xFF, 0xFF, 0xB3, 0x32, 0x7C, 0xB7, 0x4F, 0xFA, 0xCF,
+    0xC3, 0xF0, 0x5D, 0x9E, 0xE1, 0x37, 0x2F, 0x90, 0x74, 0xF8, 0xCF, 0x05, 0x12, 0x7F, 0xCF, 0x04,
+    0x22, 0xE5, 0x80, 0x6A, 0xF4, 0xBF, 0xFA, 0x03, 0x49, 0xF9, 0x0D, 0xEF, 0x41, 0xA4, 0xC2, 0x7F,
+    0x4E, 0x90, 0xCA, 0x1F, 0xF6, 0x20, 0xF2, 0xC1, 0x7D, 0x06, 0x00, 0x2B, 0xDD, 0x21, 0xC1, 0x78,
+    0x9C, 0x63, 0x38, 0xFA, 0xAE, 0x87, 0xA9, 0xE0, 0xFF, 0xFF, 0xFF, 0xAC, 0x1F, 0xCE, 0x1B, 0x6F,
+    0x63, 0xF8, 0xD0, 0xCF, 0xC0, 0xC0, 0x70, 0xE1, 0x3F, 0x3B, 0x03, 0x83, 0xC1, 0x7F, 0x10, 0x39,
+    0xF1, 0xFF, 0x79, 0xA0, 0xC0, 0x42, 0x10, 0x93, 0xE1, 0x1F, 0xD7, 0x65, 0xF7, 0xA0, 0xFF, 0x1C,
+    0x9F, 0xFF, 0xFF, 0x7F, 0xCF, 0xD8, 0xF8, 0xE6, 0xBE, 0x24, 0x03, 0x00, 0x54, 0xE2, 0x1B, 0xAD,
+    0x78, 0x9C, 0xFB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFE, 0x5F, 0x20, 0x42, 0xB1, 0xE8, 0xBF, 0xAA, 0x10,
+    0x43, 0xC0, 0x7F, 0x66, 0x06, 0x62, 0x09, 0x00, 0x62, 0x4D, 0x16, 0xB8, 0x78, 0x9C, 0xFB, 0xC9,
+    0xCF, 0xA0, 0xF0, 0x9F, 0xED, 0x27, 0x11, 0xE4, 0x0F, 0x7E, 0x06, 0x83, 0xFF, 0x6C, 0xDF, 0xED,
+    0x19, 0x12, 0xFE, 0xB3, 0x7C, 0xBA, 0x6F, 0xFA, 0xF4, 0x3F, 0x43, 0xC3, 0xFF, 0xFF, 0xFF, 0xE3,
+    0x19, 0x18, 0xB6, 0xFE, 0x5F, 0xC7, 0xCC, 0x00, 0x00, 0xFD, 0x4F, 0x1E, 0x3C, 0x78, 0x9C, 0xFB,
+    0xCB, 0xC3, 0xC0, 0xF0, 0x9B, 0xF7, 0xBB, 0x3C, 0x03, 0xC3, 0x7F, 0x8E, 0x4F, 0xF9, 0x0C, 0x01,
+    0xFF, 0x99, 0x0E, 0xEC, 0x67, 0x58, 0x70, 0x9F, 0xA1, 0xE0, 0x3F, 0xC3, 0x87, 0x7A, 0x06, 0x81,
+    0xFF, 0xAC, 0x5F, 0xF5, 0x19, 0x18, 0xFE, 0x70, 0xFD, 0x02, 0x2A, 0xFB, 0xC6, 0xFF, 0x8F, 0x9D,
+    0x81, 0xE1, 0x63, 0xFD, 0x7F, 0x26, 0x06, 0x86, 0x0D, 0xEF, 0xCF, 0x33, 0x30, 0x30, 0x24, 0xFC,
+    0xCF, 0x07, 0x92, 0x02, 0xFF, 0x81, 0xBA, 0x01, 0x1E, 0x06, 0x1A, 0xE6, 0x78, 0x9C, 0x0D, 0xC6,
+    0x6D, 0x11, 0x82, 0x40, 0x00, 0x45, 0xD1, 0xEB, 0xE7, 0x28, 0xE3, 0xAC, 0x36, 0x30, 0x02, 0xDB,
+    0x44, 0x1B, 0x18, 0x41, 0x1A, 0x60, 0x03, 0x6D, 0xB0, 0x15, 0x34, 0x01, 0x36, 0xC0, 0x06, 0xD8,
+    0x00, 0x64, 0x56, 0x06, 0xD7, 0x59, 0x9E, 0x9E, 0x5F, 0x27, 0x26, 0xB4, 0x0E, 0xAB, 0xE9, 0xC7,
+    0xD0, 0x55, 0x64, 0xE2, 0xBD, 0x25, 0x68, 0x74, 0x2D, 0x79, 0x1D, 0x18, 0xE2, 0xEC, 0x79, 0xE6,
+    0xE1, 0x6C, 0xDD, 0x2F, 0xDB, 0x1D, 0x97, 0x2A, 0x2B, 0xBC, 0xE9, 0xD6, 0xEC, 0x75, 0xCB, 0x9B,
+    0x34, 0xAC, 0xD8, 0xC8, 0xA7, 0xF7, 0x63, 0x5C, 0x40, 0x0C, 0xE6, 0xE4, 0x34, 0x81, 0x7E, 0x48,
+    0x6C, 0x2D, 0xC0, 0x6B, 0x8E, 0x8A, 0x7F, 0x1A, 0x8D, 0xF9, 0xE6, 0xF0, 0x03, 0x55, 0x06, 0x33,
+    0x48, 0x78, 0x9C, 0x01, 0x48, 0x00, 0xB7, 0xFF, 0xF6, 0x6F, 0x00, 0x10, 0xFE, 0x0B, 0xC0, 0xEF,
+    0x01, 0x90, 0xFF, 0x02, 0x20, 0xFF, 0x09, 0xF3, 0x7F, 0x00, 0x00, 0xF7, 0x3F, 0xFC, 0x0C, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x30, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0xF1, 0xDF, 0xFF, 0x04, 0x00, 0x00, 0xFB, 0x0E, 0xFC, 0x1E, 0x00, 0x50, 0xFF,
+    0x05, 0xF2, 0xAF, 0x00, 0xE1, 0xBF, 0x00, 0x80, 0xFF, 0x05, 0xFA, 0x1F, 0x00, 0x00, 0xFD, 0x1E,
+    0x65, 0x46, 0x1E, 0x57, 0x78, 0x9C, 0xFB, 0x2D, 0xCF, 0x90, 0xF0, 0x9F, 0xF5, 0x73, 0x3F, 0xC3,
+    0x83, 0xF3, 0x0C, 0x0B, 0xFE, 0x33, 0x7E, 0xB7, 0x67, 0x50, 0xF8, 0xCF, 0xF9, 0x8F, 0x9B, 0x81,
+    0xE1, 0xE7, 0xFC, 0xFF, 0x4C, 0x0C, 0x0C, 0x1F, 0xFF, 0xCF, 0x67, 0x60, 0x60, 0x28, 0xF8, 0x2F,
+    0x0F, 0x24, 0x19, 0xFE, 0x73, 0xE2, 0x26, 0x01, 0xF7, 0xCB, 0x16, 0x95, 0x78, 0x9C, 0xFB, 0xFE,
+    0xFF, 0xFF, 0x7F, 0xFF, 0xEF, 0x40, 0xC2, 0x5E, 0x41, 0xC9, 0xE8, 0x3F, 0x17, 0x03, 0xC3, 0x86,
+    0xF7, 0x8C, 0x0C, 0x0C, 0xDF, 0xFD, 0x19, 0x18, 0x0C, 0xFE, 0x73, 0x30, 0x30, 0x5C, 0xB8, 0xCF,
+    0xC0, 0xC0, 0xF0, 0x53, 0x9F, 0x81, 0xC1, 0xE1, 0x3F, 0x3B, 0x03, 0xC3, 0xC3, 0xF3, 0x4A, 0x4A,
+    0x4C, 0x3F, 0x80, 0x8A, 0xEB, 0x7F, 0x82, 0x08, 0x00, 0x6F, 0xA6, 0x1D, 0x0D, 0x78, 0x9C, 0xFB,
+    0xFB, 0x9F, 0xF9, 0xEF, 0x59, 0xA6, 0xBF, 0xAC, 0x0C, 0x04, 0x10, 0x50, 0xCD, 0x7F, 0x66, 0x00,
+    0xBC, 0x79, 0x12, 0xAD, 0x78, 0x9C, 0xFB, 0xCD, 0xC9, 0xC0, 0xF0, 0x95, 0x8F, 0x81, 0xE1, 0x41,
+    0x3C, 0x03, 0xC3, 0x84, 0xFD, 0x0C, 0x0C, 0x06, 0xFF, 0x19, 0x19, 0x18, 0xFE, 0xB2, 0x33, 0x30,
+    0x7C, 0xE7, 0x65, 0x60, 0xF8, 0x68, 0xCF, 0xC0, 0xB0, 0x61, 0x3E, 0x03, 0x43, 0xC0, 0x7F, 0x06,
+    0x06, 0x86, 0x7F, 0xAC, 0x0C, 0x0C, 0x3F, 0xB9, 0x01, 0x53, 0xB8, 0x0D, 0xA3, 0x78, 0x9C, 0xFB,
+    0xF9, 0x9F, 0xFD, 0xD8, 0x3F, 0x76, 0x86, 0xDF, 0x04, 0x10, 0x50, 0xCD, 0xCF, 0xFF, 0xEC, 0x00,
+    0xB0, 0x97, 0x12, 0xAB, 0x78, 0x9C, 0x63, 0x68, 0xD0, 0x67, 0x60, 0x60, 0x78, 0xB0, 0x1E, 0x48,
+    0x7C, 0xFF, 0xC7, 0xC4, 0xC0, 0xF0, 0xF6, 0x33, 0x17, 0x43, 0x40, 0xFF, 0x06, 0x7B, 0x86, 0x03,
+    0xF2, 0x06, 0xFB, 0x19, 0xBE, 0x70, 0x31, 0xFC, 0x66, 0xFE, 0xCD, 0xCC, 0xF0, 0x99, 0x1B, 0x00,
+    0x05, 0x59, 0x0D, 0xB4, 0x78, 0x9C, 0x53, 0x50, 0x52, 0x52, 0x62, 0xF8, 0xF0, 0xFF, 0xFF, 0x7F,
+    0x06, 0x00, 0x12, 0x21, 0x04, 0x74, 0x78, 0x9C, 0xBB, 0x78, 0x9F, 0x41, 0xE0, 0x0F, 0x27, 0xC3,
+    0x86, 0x78, 0x00, 0x15, 0x89, 0x03, 0xD5, 0x78, 0x9C, 0x13, 0x38, 0xF1, 0xAF, 0x96, 0x41, 0xE0,
+    0xFF, 0xFB, 0xFF, 0x1C, 0x0C, 0xAA, 0x0C, 0xBF, 0x78, 0x05, 0x4E, 0xFC, 0xFB, 0xCF, 0x7F, 0xE1,
+    0x7F, 0xD7, 0x1F, 0xFE, 0xCF, 0xF5, 0x0C, 0x3F, 0x81, 0x84, 0xC2, 0x3F, 0xFE, 0x07, 0xFF, 0xFF,
+    0xFD, 0xE5, 0x37, 0xF8, 0x33, 0xEF, 0x01, 0x3F, 0x00, 0x18, 0x21, 0x18, 0x88, 0x78, 0x9C, 0xFB,
+    0xC5, 0xCB, 0xC0, 0xC0, 0xF0, 0x0B, 0x8D, 0x88, 0xF9, 0x1B, 0xCB, 0xF0, 0xEB, 0xFF, 0xFF, 0xFF,
+    0xCC, 0xBF, 0xEA, 0x03, 0xFF, 0x73, 0xFD, 0xE2, 0x67, 0xF8, 0xCD, 0x07, 0x94, 0xF8, 0xC9, 0x0F,
+    0x62, 0xF1, 0xFE, 0xEA, 0x07, 0x89, 0x81, 0x65, 0xD3, 0x81, 0xEA, 0x00, 0x3D, 0xCF, 0x1D, 0x64,
+    0x78, 0x9C, 0x63, 0xD8, 0xF2, 0x6F, 0x2E, 0x43, 0xC0, 0xFF, 0xFF, 0xF7, 0x19, 0x2E, 0xBC, 0x17,
+    0x71, 0x61, 0xF8, 0x54, 0xCF, 0xC0, 0xC0, 0xF0, 0x39, 0x1E, 0x48, 0x80, 0x59, 0x0F, 0xDE, 0x0B,
+    0x4F, 0x66, 0x48, 0xF8, 0xFF, 0xFF, 0x3D, 0x03, 0xC3, 0xD1, 0xFF, 0xB5, 0x0C, 0x00, 0xD0, 0x4F,
+    0x13, 0xCB, 0x78, 0x9C, 0x63, 0x60, 0x60, 0xF8, 0x58, 0xCF, 0x80, 0x46, 0x3C, 0x3F, 0xFF, 0xA5,
+    0x3E, 0xE1, 0xFF, 0xFF, 0xFF, 0xF5, 0x0F, 0xDE, 0x2B, 0xFF, 0xAC, 0x07, 0x0A, 0x7C, 0xA8, 0xFF,
+    0x1C, 0x0F, 0x24, 0xC0, 0xAC, 0x07, 0xF7, 0x85, 0x7E, 0xD4, 0x17, 0xFC, 0xFF, 0xFF, 0xAF, 0x9E,
+    0xE1, 0xC5, 0xF9, 0xCD, 0xF5, 0x00, 0xD9, 0x9A, 0x22, 0xCB, 0x78, 0x9C, 0x01, 0x2D, 0x00, 0xD2,
+    0xFF, 0x00, 0xB4, 0xFF, 0x5D, 0x00, 0x40, 0xFF, 0xDE, 0xFF, 0x07, 0xD0, 0xDF, 0x00, 0xF8, 0x0F,
+    0xF2, 0x7F, 0x00, 0xF2, 0x3F, 0xF3, 0xFF, 0xFF, 0xFF, 0x4F, 0xF2, 0xCF, 0xBB, 0xBB, 0x3B, 0xD0,
+    0xBF, 0x01, 0x10, 0x03, 0x40, 0xFF, 0xEF, 0xFF, 0x0C, 0x00, 0xA3, 0xFE, 0xCF, 0x06, 0x51, 0xE1,
+    0x19, 0x8F, 0x78, 0x9C, 0x63, 0xD8, 0xF4, 0x4F, 0x97, 0xE1, 0xEF, 0x7F, 0x3E, 0x85, 0xFF, 0x12,
+    0x4C, 0x0E, 0xFF, 0x59, 0x18, 0xAE, 0xFC, 0xFF, 0xCF, 0xFE, 0xF2, 0xFF, 0x3B, 0x36, 0x10, 0x1B,
+    0x17, 0x06, 0x00, 0x64, 0xE8, 0x14, 0xEE, 0x78, 0x9C, 0x13, 0xB8, 0xF9, 0xFF, 0x7F, 0xFE, 0x81,
+    0xFB, 0x37, 0xFF, 0x6B, 0x7C, 0xF2, 0x57, 0xF8, 0xCF, 0x02, 0x26, 0x0E, 0xBC, 0xBF, 0xF9, 0x9E,
+    0x41, 0xE1, 0xDF, 0x7D, 0x49, 0x86, 0x0D, 0xF9, 0x0C, 0x0C, 0x0C, 0x0B, 0xFE, 0xFF, 0xBF, 0xCF,
+    0x32, 0xF1, 0xFF, 0xFF, 0xFF, 0xF2, 0xBF, 0x39, 0x19, 0x3E, 0xFB, 0xFF, 0x63, 0x65, 0xF8, 0xAC,
+    0xFF, 0x6B, 0xFF, 0xA9, 0xFF, 0x9C, 0x0D, 0x7F, 0xDF, 0x47, 0x33, 0x00, 0x00, 0xCD, 0x18, 0x24,
+    0x55, 0x78, 0x9C, 0xFB, 0xC5, 0xCB, 0xC0, 0xC0, 0xF0, 0x0B, 0x8D, 0x88, 0xF9, 0x5B, 0xCB, 0xF0,
+    0xEB, 0xDF, 0xFF, 0xFF, 0xEC, 0xBF, 0xE6, 0x1B, 0xFE, 0xE7, 0xF9, 0xC5, 0xCF, 0xF0, 0x9B, 0xEF,
+    0x17, 0x1F, 0xC3, 0x2F, 0x3E, 0xA0, 0x2C, 0x06, 0x01, 0x00, 0x25, 0x0D, 0x1A, 0x1D, 0x78, 0x9C,
+    0xFB, 0xCE, 0xF5, 0x9B, 0xAF, 0x88, 0x99, 0x81, 0xE1, 0x17, 0x2F, 0x3A, 0x04, 0x00, 0x99, 0x00,
+    0x0B, 0xBF, 0x78, 0x9C, 0x63, 0x28, 0x58, 0xCF, 0xB0, 0xE1, 0x3D, 0x83, 0x82, 0x39, 0x03, 0x10,
+    0x2C, 0xB8, 0x8F, 0x07, 0x09, 0x3C, 0x3A, 0xFF, 0xF1, 0x7F, 0xFD, 0xC3, 0xFB, 0x1C, 0x00, 0x15,
+    0xD3, 0x18, 0x04, 0x78, 0x9C, 0xFB, 0xC5, 0xCB, 0xC0, 0xC0, 0xF0, 0x0B, 0x9D, 0x10, 0xF8, 0xC7,
+    0xF3, 0x8B, 0xF7, 0xE2, 0x7D, 0xC6, 0x5F, 0xB2, 0x7F, 0x65, 0x19, 0x7E, 0xED, 0x79, 0xCF, 0xC4,
+    0xF0, 0xEB, 0x3F, 0x88, 0xD8, 0xFF, 0x8F, 0x87, 0xE1, 0x17, 0xDF, 0xE7, 0xF9, 0x40, 0x25, 0x05,
+    0xFF, 0xD9, 0x80, 0x8A, 0x7F, 0xDB, 0x03, 0x00, 0x02, 0x4B, 0x1A, 0xD2, 0x78, 0x9C, 0xFB, 0xC5,
+    0xFB, 0x0B, 0x07, 0x04, 0x00, 0xBA, 0x6B, 0x0D, 0x5C, 0x78, 0x9C, 0xFB, 0x95, 0xF6, 0x37, 0xB7,
+    0xE1, 0x9F, 0x0F, 0xC3, 0xAF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x9F, 0xF1, 0xD7, 0xFC, 0xC0,
+    0xFF, 0xF1, 0x8D, 0xFF, 0x59, 0x7F, 0xF1, 0x33, 0xFC, 0xE3, 0x51, 0xF8, 0xCF, 0xF6, 0x8B, 0x8F,
+    0xE1, 0x1F, 0x97, 0x00, 0x90, 0xE6, 0xC5, 0x4F, 0x03, 0x00, 0xBD, 0x3C, 0x23, 0x41, 0x78, 0x9C,
+    0xFB, 0x95, 0xF6, 0xB7, 0x96, 0xE1, 0xD7, 0xBF, 0xFF, 0xFF, 0xD9, 0x7F, 0xCD, 0x37, 0xFC, 0xCF,
+    0xF3, 0x8B, 0x9F, 0xE1, 0x37, 0xDF, 0x2F, 0x3E, 0x86, 0x5F, 0x7C, 0xBF, 0x78, 0x31, 0x09, 0x00,
+    0x3A, 0x8C, 0x16, 0x0B, 0x78, 0x9C, 0x63, 0xD8, 0xFC, 0xAF, 0x96, 0xC1, 0xE1, 0xFF, 0xFF, 0xFF,
+    0xDC, 0x17, 0xDE, 0x0B, 0xFF, 0x88, 0xFF, 0x54, 0xCF, 0xF0, 0x61, 0xFD, 0xE7, 0x78, 0x86, 0x0B,
+    0xFB, 0x3F, 0x82, 0x58, 0x20, 0xB1, 0x7C, 0x03, 0xA0, 0x2C, 0x0F, 0xC3, 0xE2, 0x7F, 0xBD, 0x0C,
+    0x00, 0x5E, 0xE9, 0x1A, 0x40, 0x78, 0x9C, 0xFB, 0x15, 0xF1, 0x37, 0x96, 0xE1, 0xD7, 0xBF, 0xFF,
+    0xFF, 0x99, 0x7F, 0xD5, 0x3B, 0xFE, 0xE7, 0xFA, 0xC5, 0xCF, 0xF0, 0x9B, 0xEF, 0x17, 0x2F, 0xC3,
+    0x4F, 0x7E, 0x08, 0xAB, 0x3F, 0x10, 0x28, 0xF6, 0x1F, 0x24, 0x9B, 0xF3, 0xD7, 0x87, 0x01, 0x28,
+    0xC1, 0x80, 0x4E, 0x00, 0x00, 0x79, 0x19, 0x1D, 0x44, 0x78, 0x9C, 0x63, 0x78, 0x7E, 0xFE, 0x70,
+    0x7D, 0xC2, 0xFF, 0xFF, 0xFF, 0xEB, 0x1F, 0xBC, 0x57, 0xFE, 0x59, 0xFF, 0xB1, 0x9E, 0xE1, 0x43,
+    0xFD, 0xE7, 0x78, 0x20, 0x01, 0x66, 0x3D, 0xB8, 0xCF, 0xF4, 0xA3, 0xBE, 0x00, 0x24, 0xCB, 0xF0,
+    0xE2, 0xFC, 0x97, 0x7A, 0x06, 0x06, 0x86, 0x8F, 0xE8, 0x04, 0x00, 0x13, 0x83, 0x22, 0xCC, 0x78,
+    0x9C, 0xFB, 0x65, 0xFA, 0x87, 0xE5, 0xD7, 0xEF, 0xFF, 0xCC, 0xBF, 0xDE, 0x67, 0x30, 0xFE, 0xD2,
+    0x67, 0x60, 0xF8, 0xC5, 0x07, 0xC4, 0xBC, 0xA8, 0x18, 0x00, 0x40, 0xC9, 0x0D, 0xC6, 0x78, 0x9C,
+    0x01, 0x24, 0x00, 0xDB, 0xFF, 0x20, 0xEA, 0xEF, 0x4A, 0xE0, 0xFF, 0xFE, 0x6F, 0xF2, 0x6F, 0x00,
+    0x06, 0xF0, 0xFF, 0x4A, 0x00, 0x30, 0xFC, 0xFF, 0x2D, 0x00, 0x30, 0xFA, 0xAF, 0x52, 0x00, 0xD0,
+    0xBF, 0xF3, 0xEF, 0xFE, 0x6F, 0xB1, 0xFE, 0xCE, 0x06, 0x82, 0xC6, 0x15, 0x14, 0x78, 0x9C, 0x63,
+    0xF8, 0xC5, 0xC4, 0x20, 0xF0, 0x9F, 0x89, 0xE1, 0xF2, 0xFF, 0xFF, 0xDC, 0x3F, 0xFE, 0xBF, 0xE3,
+    0x4A, 0x00, 0xB2, 0x91, 0x71, 0xC0, 0x7F, 0x36, 0x26, 0x85, 0xFF, 0xFF, 0x79, 0x19, 0xAE, 0xBE,
+    0xE7, 0x04, 0x00, 0xA9, 0xD4, 0x12, 0xAC, 0x78, 0x9C, 0xFB, 0xCD, 0xCB, 0xF0, 0x9B, 0xF7, 0x37,
+    0x76, 0xE2, 0x2F, 0xEF, 0x4F, 0xFF, 0xC2, 0xFF, 0xBC, 0x5F, 0xFE, 0xFF, 0xFF, 0xC7, 0x9B, 0xF0,
+    0xB7, 0xEE, 0x33, 0x2F, 0x00, 0xCF, 0x83, 0x16, 0x00, 0x78, 0x9C, 0x01, 0x2D, 0x00, 0xD2, 0xFF,
+    0xFC, 0x0D, 0x00, 0xF2, 0x7F, 0xF6, 0x2F, 0x00, 0xF8, 0x1F, 0xF0, 0x8F, 0x00, 0xFD, 0x0B, 0xA0,
+    0xDF, 0x30, 0xFF, 0x04, 0x30, 0xFF, 0x93, 0xEF, 0x00, 0x00, 0xFD, 0xD8, 0x8F, 0x00, 0x00, 0xF7,
+    0xFD, 0x2F, 0x00, 0x00, 0xF1, 0xFF, 0x0B, 0x00, 0x00, 0xA0, 0xFF, 0x05, 0x00, 0xFE, 0x90, 0x14,
+    0xC7, 0x78, 0x9C, 0x01, 0x48, 0x00, 0xB7, 0xFF, 0xFA, 0x0D, 0x30, 0xFF, 0x0C, 0x30, 0xFF, 0x03,
+    0xF6, 0x1F, 0x70, 0xFF, 0x1F, 0x80, 0xEF, 0x00, 0xF1, 0x5F, 0xC0, 0xAF, 0x5F, 0xC0, 0xAF, 0x00,
+    0xC0, 0xAF, 0xF0, 0x5D, 0x9F, 0xF1, 0x5F, 0x00, 0x80, 0xDF, 0xF4, 0x19, 0xCF, 0xF5, 0x1F, 0x00,
+    0x30, 0xFF, 0xF8, 0x05, 0xFD, 0xF8, 0x0C, 0x00, 0x00, 0xFE, 0xFD, 0x01, 0xF9, 0xFD, 0x07, 0x00,
+    0x00, 0xFA, 0xEF, 0x00, 0xF6, 0xFF, 0x02, 0x00, 0x00, 0xF5, 0xAF, 0x00, 0xF2, 0xDF, 0x00, 0x00,
+    0x5C, 0x0B, 0x24, 0x89, 0x78, 0x9C, 0x01, 0x2D, 0x00, 0xD2, 0xFF, 0xF6, 0x6F, 0x00, 0xF9, 0x4F,
+    0xB0, 0xFF, 0x31, 0xFF, 0x09, 0x10, 0xFF, 0xDB, 0xDF, 0x00, 0x00, 0xF6, 0xFF, 0x3F, 0x00, 0x00,
+    0xE0, 0xFF, 0x0C, 0x00, 0x00, 0xF8, 0xFF, 0x5F, 0x00, 0x30, 0xFF, 0xB9, 0xEF, 0x01, 0xD0, 0xEF,
+    0x20, 0xFF, 0x0B, 0xF9, 0x4F, 0x00, 0xF7, 0x6F, 0x1C, 0xA0, 0x17, 0x43, 0x78, 0x9C, 0xFB, 0xC3,
+    0xC7, 0xF0, 0xB9, 0xFE, 0x9B, 0x3F, 0xC3, 0x0F, 0xF9, 0x07, 0xEB, 0x19, 0xFE, 0x71, 0x4F, 0xF8,
+    0x6F, 0xF0, 0x9F, 0x55, 0xE1, 0xFF, 0xD4, 0xF7, 0x0C, 0x0C, 0xBF, 0x6F, 0xF6, 0x33, 0x30, 0x7C,
+    0xFD, 0xA7, 0xCF, 0xC0, 0xF0, 0xE0, 0x3F, 0x0F, 0x03, 0x43, 0xC3, 0x7F, 0x36, 0x10, 0xC1, 0xC0,
+    0x20, 0xF0, 0x75, 0x3E, 0x03, 0xC3, 0xB7, 0xFF, 0x72, 0x40, 0xC9, 0x75, 0x8C, 0x0C, 0x0C, 0x00,
+    0xF2, 0x27, 0x1B, 0xA6, 0x78, 0x9C, 0x01, 0x24, 0x00, 0xDB, 0xFF, 0xF4, 0xFF, 0xFF, 0xAF, 0xF4,
+    0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xFA, 0x1E, 0x00, 0x70, 0xFF, 0x03, 0x00, 0xF3, 0x6F, 0x00, 0x10,
+    0xFE, 0x0A, 0x00, 0xC0, 0xDF, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xCF, 0x86,
+    0x88, 0x15, 0x4F, 0x78, 0x9C, 0x63, 0x98, 0xF0, 0x8F, 0x81, 0xE1, 0xFB, 0x7F, 0x06, 0x86, 0x9F,
+    0xDC, 0x0C, 0x0C, 0xBF, 0x38, 0x21, 0xF8, 0x0F, 0x07, 0xC3, 0xB6, 0xFF, 0x2C, 0x0C, 0x7F, 0xE2,
+    0x18, 0xC0, 0x34, 0xC3, 0x1F, 0x4E, 0x84, 0x1C, 0x48, 0x1D, 0x48, 0x3D, 0x50, 0x1F, 0x00, 0x68,
+    0x9C, 0x13, 0xF2, 0x78, 0x9C, 0xFB, 0xCC, 0xF9, 0x99, 0x00, 0x04, 0x00, 0x2C, 0xD0, 0x10, 0xBD,
+    0x78, 0x9C, 0xFB, 0x52, 0xCB, 0xC0, 0xF0, 0xE5, 0x3F, 0x13, 0x83, 0xC0, 0x7F, 0x16, 0x06, 0x86,
+    0x7F, 0xAC, 0x10, 0xFC, 0x97, 0x8D, 0x81, 0xE1, 0xE7, 0x7C, 0x66, 0x86, 0x09, 0xFF, 0xD9, 0xC1,
+    0xF4, 0x5F, 0x76, 0xB8, 0x1C, 0x48, 0x1D, 0x48, 0xFD, 0x17, 0xA0, 0x3E, 0x00, 0x68, 0x0D, 0x13,
+    0xD2, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x82, 0x09, 0xEF, 0xAD, 0x18, 0x38, 0xBE, 0xFC, 0xFD, 0xFF,
+    0x8E, 0x3F, 0x98, 0xE1, 0xE8, 0x7B, 0x56, 0x90, 0x10, 0x03, 0x00, 0x66, 0x99, 0x07, 0xBB, 0x78,
+    0x9C, 0x13, 0xF8, 0xED, 0xCB, 0x70, 0x60, 0xFD, 0x3F, 0xC6, 0x4F, 0xEC, 0x9F, 0xD9, 0x41, 0x18,
+    0xC8, 0x66, 0x12, 0x00, 0x8A, 0x01, 0x00, 0x93, 0xCF, 0x0B, 0x74, 0x78, 0x9C, 0x63, 0x60, 0x60,
+    0x78, 0x70, 0x9F, 0x91, 0x01, 0x08, 0x7E, 0xCA, 0x80, 0xC8, 0x80, 0xFD, 0x0C, 0x08, 0x60, 0xF0,
+    0xEA, 0x7F, 0x0D, 0x90, 0xFA, 0xF6, 0xFF, 0xFF, 0x7F, 0x59, 0x06, 0x83, 0xFF, 0xF9, 0xCE, 0xBF,
+    0xF6, 0x33, 0x2C, 0xF8, 0xCF, 0xC2, 0xB0, 0xE1, 0x3F, 0xD3, 0x83, 0xF7, 0x40, 0xB5, 0xFF, 0xD9,
+    0x3E, 0x00, 0x95, 0x1B, 0xFC, 0xE7, 0x80, 0x52, 0x50, 0x41, 0xA8, 0x12, 0x90, 0x86, 0xDF, 0xFB,
+    0x61, 0xDA, 0xA1, 0x86, 0x01, 0x00, 0x25, 0xCE, 0x2B, 0x20, 0x78, 0x9C, 0x63, 0x50, 0x60, 0x10,
+    0x62, 0x60, 0xF8, 0x61, 0xF9, 0x9E, 0x81, 0xE1, 0x9B, 0xFA, 0x39, 0x06, 0x30, 0x10, 0x38, 0xF1,
+    0xAF, 0x96, 0x41, 0xE0, 0xFF, 0xFB, 0xFF, 0x1C, 0x0C, 0xAA, 0x0C, 0xBF, 0x78, 0x81, 0xDC, 0xFF,
+    0xFC, 0x17, 0xFE, 0x77, 0xFD, 0xE1, 0xFF, 0x5C, 0xCF, 0xF0, 0x13, 0x48, 0x28, 0xFC, 0xE3, 0x7F,
+    0xF0, 0xFF, 0xDF, 0x5F, 0x7E, 0x83, 0x3F, 0xF3, 0x1E, 0xF0, 0x03, 0x00, 0x05, 0xB8, 0x1C, 0xC5,
+    0x78, 0x9C, 0x63, 0x60, 0x68, 0xF8, 0xCF, 0xCA, 0xC0, 0xF0, 0x39, 0x9E, 0x81, 0x81, 0xE1, 0x2D,
+    0x33, 0x03, 0x04, 0x6C, 0xFE, 0x57, 0xCB, 0xE0, 0xF0, 0xFF, 0xFF, 0x7F, 0xEE, 0x0B, 0xEF, 0x85,
+    0x7F, 0xC4, 0x7F, 0xAA, 0x67, 0xF8, 0xB0, 0x1E, 0xA8, 0xE0, 0xC2, 0xFE, 0x8F, 0x20, 0x16, 0x48,
+    0x2C, 0xDF, 0x00, 0x28, 0xCB, 0xC3, 0xB0, 0xF8, 0x5F, 0x2F, 0x03, 0x00, 0x3B, 0x61, 0x1E, 0x06,
+    0x78, 0x9C, 0x63, 0x60, 0xF8, 0x37, 0x9F, 0x81, 0x81, 0xC1, 0xE1, 0xFF, 0x7B, 0x20, 0x39, 0x61,
+    0xFF, 0x7F, 0x56, 0x06, 0x86, 0x0F, 0xF9, 0xBF, 0xB8, 0x18, 0x18, 0xBE, 0xCA, 0x7F, 0x95, 0x67,
+    0x60, 0xF8, 0xC5, 0xF3, 0x21, 0x9F, 0x41, 0xE0, 0x3F, 0xFB, 0x86, 0xF3, 0x0C, 0x09, 0xFF, 0x81,
+    0x80, 0xF1, 0x00, 0x88, 0x64, 0xFF, 0x38, 0x5F, 0x49, 0xE9, 0x2F, 0xEF, 0x77, 0x7B, 0x06, 0x86,
+    0x1F, 0xF6, 0x7F, 0xF9, 0x18, 0x18, 0x3E, 0xF7, 0x03, 0x75, 0x33, 0xBC, 0x64, 0x04, 0x12, 0x09,
+    0xF1, 0x20, 0x66, 0xC1, 0x7E, 0x0E, 0x20, 0x29, 0xF0, 0x9B, 0x1B, 0x00, 0x7E, 0x52, 0x24, 0x92,
+    0x78, 0x9C, 0x13, 0x38, 0xF1, 0xAF, 0x96, 0x41, 0xE0, 0xFF, 0xFB, 0xFF, 0x1C, 0x0C, 0xAA, 0x0C,
+    0xBF, 0x78, 0x05, 0x4E, 0xFC, 0xFB, 0xCF, 0x7F, 0xE1, 0x7F, 0xD7, 0x1F, 0xFE, 0xCF, 0xF5, 0x0C,
+    0x3F, 0x81, 0x84, 0xC2, 0x3F, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0xE5, 0x37, 0xF8, 0x33, 0xEF, 0x01,
+    0x3F, 0x03, 0x03, 0xC3, 0x57, 0x16, 0x06, 0x06, 0x81, 0xF9, 0x40, 0x86, 0xC2, 0x7D, 0x49, 0x20,
+    0xF9, 0x43, 0x0E, 0x00, 0x25, 0x65, 0x1C, 0x5E, 0x78, 0x9C, 0x63, 0x60, 0x60, 0xF8, 0x96, 0xCF,
+    0xC0, 0xC0, 0xA0, 0xF0, 0x9F, 0x0D, 0x48, 0x5E, 0xF0, 0x67, 0x80, 0x01, 0x85, 0x9B, 0xEF, 0xB3,
+    0x19, 0x18, 0xBE, 0xFE, 0xFF, 0xFF, 0x1F, 0x28, 0x97, 0xE7, 0xD4, 0xC9, 0xD0, 0xF0, 0x9F, 0x05,
+    0xA4, 0xE2, 0x3E, 0x48, 0xF2, 0xC3, 0x7E, 0x04, 0xF9, 0x00, 0x2C, 0xB2, 0xE0, 0x3F, 0x33, 0x90,
+    0x34, 0xF8, 0x9F, 0x67, 0xDC, 0xC6, 0xC0, 0xF0, 0xE3, 0xFF, 0xFF, 0xF3, 0x0C, 0x0C, 0x0E, 0xAF,
+    0xDF, 0xE7, 0x30, 0x00, 0x00, 0x32, 0xC5, 0x1E, 0xD9, 0x78, 0x9C, 0x63, 0x60, 0xD8, 0xF0, 0x9F,
+    0x99, 0x81, 0xE1, 0x9B, 0x1D, 0x03, 0x83, 0xC2, 0x7D, 0x26, 0x06, 0x08, 0xD8, 0xF2, 0x6F, 0x2E,
+    0x43, 0xC0, 0xFF, 0xFF, 0xF7, 0x19, 0x2E, 0xBC, 0x17, 0x71, 0x61, 0xF8, 0x54, 0x0F, 0x14, 0xFA,
+    0x1C, 0x0F, 0x24, 0xC0, 0xAC, 0x07, 0xEF, 0x85, 0x27, 0x33, 0x24, 0xFC, 0xFF, 0xFF, 0x9E, 0x81,
+    0xE1, 0xE8, 0xFF, 0x5A, 0x06, 0x00, 0xB5, 0x18, 0x17, 0xB2, 0x78, 0x9C, 0xFB, 0xFE, 0xFF, 0x7F,
+    0xFF, 0x77, 0x10, 0xB6, 0x17, 0x64, 0xFC, 0x2E, 0xCF, 0xC0, 0x00, 0xC6, 0xFF, 0xFF, 0xDB, 0x83,
+    0x31, 0x4C, 0xCC, 0x5E, 0x49, 0xE8, 0x3B, 0x54, 0x1D, 0x03, 0xC3, 0x57, 0x16, 0x06, 0x81, 0xF9,
+    0x0C, 0x0C, 0x0A, 0xF7, 0x25, 0x19, 0x18, 0x7E, 0xC8, 0x01, 0x00, 0x8A, 0x27, 0x1F, 0x8B, 0x78,
+    0x9C, 0x01, 0x41, 0x00, 0xBE, 0xFF, 0x00, 0xB4, 0xFF, 0x5D, 0x00, 0x40, 0xFF, 0xDE, 0xFF, 0x07,
+    0xD0, 0xDF, 0x00, 0xF8, 0x0F, 0xF2, 0x7F, 0x00, 0xF2, 0x3F, 0xF3, 0xFF, 0xFF, 0xFF, 0x4F, 0xF2,
+    0xCF, 0xBB, 0xBB, 0x3B, 0xD0, 0xBF, 0x01, 0x10, 0x03, 0x40, 0xFF, 0xEF, 0xFF, 0x0C, 0x00, 0xA3,
+    0xFE, 0xCF, 0x06, 0x00, 0x00, 0x40, 0x5F, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0x00, 0x00, 0x00, 0xF1,
+    0x9E, 0x02, 0x00, 0x00, 0x70, 0xEE, 0x02, 0x77, 0xC2, 0x1E, 0x1A, 0x78, 0x9C, 0x2B, 0xF8, 0xCF,
+    0xC8, 0xC0, 0x50, 0x80, 0x44, 0x28, 0x81, 0x88, 0xFB, 0x0C, 0x0C, 0x0D, 0xFF, 0xE7, 0x33, 0x30,
+    0xFC, 0xFC, 0xCF, 0xCC, 0xC0, 0xF0, 0x03, 0x24, 0xD1, 0x00, 0x91, 0x55, 0x56, 0x62, 0x2A, 0xF8,
+    0xFF, 0xFF, 0x3F, 0x3F, 0x98, 0x00, 0x00, 0x98, 0x7B, 0x18, 0x6F, 0x78, 0x9C, 0x2B, 0xF8, 0xCF,
+    0x58, 0x80, 0x82, 0x78, 0x26, 0xFC, 0x8F, 0xFF, 0xF3, 0x9F, 0xF9, 0x29, 0xAA, 0x38, 0x00, 0x96,
+    0xF8, 0x14, 0x3D, 0x78, 0x9C, 0x63, 0x60, 0x60, 0xF8, 0x27, 0xCB, 0xC0, 0xC0, 0xB0, 0xE0, 0x3C,
+    0x23, 0x90, 0xFC, 0xCA, 0xC5, 0x00, 0x05, 0xDF, 0xFF, 0x33, 0x32, 0x7C, 0xF0, 0xFF, 0xFE, 0x9F,
+    0x0B, 0x4C, 0xDA, 0x83, 0xC8, 0xD7, 0xE7, 0x41, 0x64, 0xCC, 0x7F, 0x36, 0x20, 0xC9, 0xF3, 0x47,
+    0x0E, 0x48, 0xF2, 0x7E, 0x9A, 0x0F, 0x22, 0x27, 0xFC, 0xFF, 0x04, 0x24, 0x05, 0xFE, 0xBD, 0x01,
+    0x92, 0x0C, 0xDF, 0xFE, 0x83, 0xC8, 0x0B, 0x60, 0xD2, 0xE1, 0xBF, 0x3F, 0x00, 0x30, 0xFC, 0x2C,
+    0x48, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0x3C, 0x9F, 0x81, 0x81, 0xE1, 0x2F, 0x27, 0x03, 0xC3, 0x82,
+    0x7A, 0x06, 0x08, 0xF8, 0x95, 0xF6, 0xB7, 0x96, 0xE1, 0xD7, 0xBF, 0xFF, 0xFF, 0xD9, 0x7F, 0xCD,
+    0x37, 0xFC, 0xCF, 0xF3, 0x8B, 0x9F, 0xE1, 0x37, 0xDF, 0x2F, 0x3E, 0x86, 0x5F, 0x7C, 0xBF, 0x78,
+    0x31, 0x09, 0x00, 0x14, 0x5C, 0x19, 0xC2, 0x78, 0x9C, 0x63, 0x60, 0x78, 0x78, 0x9E, 0x81, 0x81,
+    0xE1, 0x17, 0x0F, 0x03, 0x43, 0xC2, 0x7A, 0x06, 0x28, 0x38, 0xFA, 0xAE, 0x87, 0xA9, 0xE0, 0xFF,
+    0xFF, 0xFF, 0xAC, 0x1F, 0xCE, 0x1B, 0x6F, 0x63, 0xF8, 0xD0, 0x0F, 0x14, 0xBA, 0xF0, 0x9F, 0x9D,
+    0x81, 0xC1, 0xE0, 0x3F, 0x88, 0x9C, 0xF8, 0x1F, 0xA4, 0x63, 0x21, 0x88, 0xC9, 0xF0, 0x8F, 0xEB,
+    0xB2, 0x7B, 0xD0, 0x7F, 0x8E, 0xCF, 0xFF, 0xFF, 0xBF, 0x67, 0x6C, 0x7C, 0x73, 0x5F, 0x92, 0x01,
+    0x00, 0x6A, 0xDC, 0x1F, 0x72, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0x11, 0xCF, 0x60, 0xF0, 0x9F, 0x85,
+    0xE1, 0x81, 0x1D, 0x03, 0x08, 0x28, 0xBC, 0x7A, 0xEF, 0xF5, 0xE0, 0xFF, 0xBF, 0xFC, 0x4F, 0xF9,
+    0x0C, 0x6C, 0x1F, 0xFE, 0x7B, 0x31, 0x18, 0xFC, 0xF9, 0xAF, 0xCB, 0x60, 0xF0, 0x6B, 0x7D, 0x10,
+    0xC3, 0x85, 0xFD, 0x9F, 0xDF, 0xFF, 0xCB, 0xDF, 0xF8, 0xEF, 0x1C, 0x1B, 0x00, 0x2C, 0xA6, 0x18,
+    0xBC, 0x78, 0x9C, 0x63, 0x60, 0x78, 0x78, 0x9E, 0x81, 0x81, 0xE1, 0x17, 0x0F, 0x03, 0x43, 0xC2,
+    0x7A, 0x06, 0x08, 0xF8, 0xFE, 0xFF, 0xFF, 0x7F, 0x7F, 0x10, 0x61, 0xAF, 0xA0, 0x64, 0xF4, 0x9F,
+    0x8B, 0x81, 0x61, 0xC3, 0x7B, 0x46, 0xA0, 0xA8, 0x3F, 0x03, 0x83, 0xC1, 0x7F, 0x0E, 0x06, 0x86,
+    0x0B, 0xF7, 0x81, 0x6A, 0x7E, 0xEA, 0x33, 0x30, 0x38, 0xFC, 0x67, 0x67, 0x00, 0x6A, 0x57, 0x52,
+    0x62, 0xFA, 0x01, 0x54, 0x5C, 0xFF, 0x13, 0x44, 0x00, 0x00, 0x85, 0xA0, 0x20, 0xD2, 0x78, 0x9C,
+    0x63, 0x60, 0xF8, 0x9E, 0xCF, 0xA0, 0xF0, 0x9F, 0x95, 0xE1, 0x82, 0x3F, 0x03, 0x08, 0x7C, 0xF9,
+    0xFF, 0x7F, 0x3D, 0x10, 0xCF, 0x67, 0x60, 0xF8, 0x25, 0xC7, 0x50, 0xF0, 0x9F, 0x99, 0xE1, 0x73,
+    0x3E, 0x83, 0xC0, 0x3F, 0x2E, 0x86, 0x03, 0xF7, 0x19, 0x18, 0xBE, 0xFF, 0xFF, 0xBF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xE7, 0x01, 0x30, 0x9D, 0x18, 0xF8, 0x78, 0x9C, 0x63, 0x60, 0x08, 0x63, 0x60, 0x60,
+    0x48, 0xF8, 0xCF, 0xCC, 0xC0, 0x60, 0x70, 0x8F, 0x91, 0x01, 0x0C, 0xBE, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x1F, 0x44, 0xD8, 0x2B, 0x28, 0x19, 0xFD, 0xE7, 0x62, 0x60, 0xD8, 0xF0, 0x1E, 0x28, 0xF3, 0xDD,
+    0x1F, 0xA8, 0xE4, 0x3F, 0x07, 0x03, 0xC3, 0x85, 0xFB, 0x40, 0x35, 0x3F, 0xF5, 0x19, 0x18, 0x1C,
+    0xFE, 0xB3, 0x33, 0x30, 0x3C, 0x3C, 0xAF, 0xA4, 0xC4, 0xF4, 0x03, 0xA8, 0xB8, 0xFE, 0x27, 0x88,
+    0x00, 0x00, 0x37, 0x77, 0x1F, 0xD4, 0x78, 0x9C, 0x63, 0x08, 0x60, 0x63, 0x60, 0xF8, 0x9C, 0xCF,
+    0xC0, 0x70, 0xD1, 0x8E, 0x01, 0x04, 0xBE, 0xFC, 0xFF, 0xBF, 0x1E, 0x88, 0xE7, 0x33, 0x30, 0xFC,
+    0x92, 0x63, 0x28, 0xF8, 0xCF, 0x0C, 0x92, 0x13, 0xF8, 0xC7, 0xC5, 0x70, 0xE0, 0x3E, 0x03, 0xC3,
+    0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xF8, 0xFF, 0xFF, 0x3C, 0x00, 0x05, 0x99, 0x18, 0x16,
+};
+const GFXglyph OpenSans8BGlyphs[] = {
+    { 0, 0, 4, 0, 0, 8, 0 }, //  
+    { 4, 12, 5, 0, 12, 35, 8 }, // !
+    { 6, 4, 8, 1, 12, 21, 43 }, // "
+    { 11, 12, 11, 0, 12, 79, 64 }, // #
+    { 10, 14, 10, 0, 13, 73, 143 }, // $
+    { 15, 12, 15, 0, 12, 98, 216 }, // %
+    { 13, 12, 13, 0, 12, 85, 314 }, // &
+    { 3, 4, 5, 1, 12, 16, 399 }, // '
+    { 6, 15, 6, 0, 12, 51, 415 }, // (
+    { 6, 15, 6, 0, 12, 47, 466 }, // )
+    { 9, 9, 9, 0, 13, 51, 513 }, // *
+    { 9, 9, 10, 0, 11, 31, 564 }, // +
+    { 4, 4, 5, 0, 2, 16, 595 }, // ,
+    { 5, 3, 5, 0, 6, 17, 611 }, // -
+    { 4, 3, 5, 0, 3, 14, 628 }, // .
+    { 7, 12, 7, 0, 12, 57, 642 }, // /
+    { 10, 12, 10, 0, 12, 58, 699 }, // 0
+    { 7, 12, 10, 1, 12, 32, 757 }, // 1
+    { 10, 12, 10, 0, 12, 63, 789 }, // 2
+    { 10, 12, 10, 0, 12, 67, 852 }, // 3
+    { 10, 12, 10, 0, 12, 56, 919 }, // 4
+    { 9, 12, 10, 0, 12, 63, 975 }, // 5
+    { 10, 12, 10, 0, 12, 71, 1038 }, // 6
+    { 10, 12, 10, 0, 12, 63, 1109 }, // 7
+    { 10, 12, 10, 0, 12, 71, 1172 }, // 8
+    { 10, 12, 10, 0, 12, 71, 1243 }, // 9
+    { 4, 9, 5, 0, 9, 23, 1314 }, // :
+    { 4, 11, 5, 0, 9, 25, 1337 }, // ;
+    { 9, 10, 10, 0, 11, 51, 1362 }, // <
+    { 9, 5, 10, 0, 9, 26, 1413 }, // =
+    { 9, 10, 10, 0, 11, 48, 1439 }, // >
+    { 8, 12, 8, 0, 12, 53, 1487 }, // ?
+    { 15, 13, 15, 0, 12, 113, 1540 }, // @
+    { 12, 12, 12, 0, 12, 78, 1653 }, // A
+    { 10, 12, 11, 1, 12, 61, 1731 }, // B
+    { 11, 12, 11, 0, 12, 68, 1792 }, // C
+    { 11, 12, 13, 1, 12, 65, 1860 }, // D
+    { 8, 12, 10, 1, 12, 36, 1925 }, // E
+    { 8, 12, 9, 1, 12, 32, 1961 }, // F
+    { 11, 12, 12, 0, 12, 77, 1993 }, // G
+    { 11, 12, 13, 1, 12, 26, 2070 }, // H
+    { 4, 12, 6, 1, 12, 13, 2096 }, // I
+    { 7, 16, 6, -2, 12, 31, 2109 }, // J
+    { 11, 12, 11, 1, 12, 68, 2140 }, // K
+    { 9, 12, 10, 1, 12, 26, 2208 }, // L
+    { 14, 12, 16, 1, 12, 81, 2234 }, // M
+    { 12, 12, 14, 1, 12, 60, 2315 }, // N
+    { 13, 12, 14, 0, 12, 66, 2375 }, // O
+    { 9, 12, 11, 1, 12, 49, 2441 }, // P
+    { 13, 15, 14, 0, 12, 82, 2490 }, // Q
+    { 11, 12, 11, 1, 12, 67, 2572 }, // R
+    { 9, 12, 9, 0, 12, 65, 2639 }, // S
+    { 10, 12, 10, 0, 12, 28, 2704 }, // T
+    { 11, 12, 13, 1, 12, 49, 2732 }, // U
+    { 12, 12, 11, 0, 12, 79, 2781 }, // V
+    { 17, 12, 16, 0, 12, 117, 2860 }, // W
+    { 12, 12, 11, 0, 12, 83, 2977 }, // X
+    { 11, 12, 11, 0, 12, 56, 3060 }, // Y
+    { 10, 12, 10, 0, 12, 65, 3116 }, // Z
+    { 5, 15, 6, 1, 12, 23, 3181 }, // [
+    { 7, 12, 7, 0, 12, 57, 3204 }, // '\\'
+    { 5, 15, 6, 0, 12, 23, 3261 }, // ]
+    { 9, 8, 9, 0, 12, 48, 3284 }, // ^
+    { 9, 2, 7, -1, -1, 18, 3332 }, // _
+    { 6, 3, 10, 2, 13, 17, 3350 }, // `
+    { 9, 9, 10, 0, 9, 54, 3367 }, // a
+    { 9, 13, 11, 1, 13, 51, 3421 }, // b
+    { 9, 9, 9, 0, 9, 50, 3472 }, // c
+    { 10, 13, 11, 0, 13, 56, 3522 }, // d
+    { 10, 9, 10, 0, 9, 56, 3578 }, // e
+    { 8, 13, 7, 0, 13, 37, 3634 }, // f
+    { 10, 13, 10, 0, 9, 74, 3671 }, // g
+    { 9, 13, 11, 1, 13, 45, 3745 }, // h
+    { 3, 13, 5, 1, 13, 20, 3790 }, // i
+    { 6, 17, 5, -2, 13, 33, 3810 }, // j
+    { 10, 13, 11, 1, 13, 57, 3843 }, // k
+    { 3, 13, 5, 1, 13, 13, 3900 }, // l
+    { 15, 9, 17, 1, 9, 53, 3913 }, // m
+    { 9, 9, 11, 1, 9, 38, 3966 }, // n
+    { 10, 9, 11, 0, 9, 49, 4004 }, // o
+    { 9, 13, 11, 1, 9, 52, 4053 }, // p
+    { 10, 13, 11, 0, 9, 54, 4105 }, // q
+    { 7, 9, 8, 1, 9, 31, 4159 }, // r
+    { 8, 9, 8, 0, 9, 47, 4190 }, // s
+    { 7, 11, 7, 0, 11, 42, 4237 }, // t
+    { 9, 9, 11, 1, 9, 34, 4279 }, // u
+    { 10, 9, 10, 0, 9, 56, 4313 }, // v
+    { 15, 9, 15, 0, 9, 83, 4369 }, // w
+    { 10, 9, 10, 0, 9, 56, 4452 }, // x
+    { 10, 13, 10, 0, 9, 72, 4508 }, // y
+    { 8, 9, 8, 0, 9, 47, 4580 }, // z
+    { 7, 15, 7, 0, 12, 48, 4627 }, // {
+    { 3, 17, 9, 3, 13, 13, 4675 }, // |
+    { 7, 15, 7, 0, 12, 49, 4688 }, // }
+    { 9, 5, 10, 0, 8, 30, 4737 }, // ~
+    { 7, 6, 7, 0, 12, 28, 4767 }, // °
+    { 13, 16, 14, 0, 16, 79, 4795 }, // Ó
+    { 9, 13, 10, 0, 13, 70, 4874 }, // ä
+    { 10, 13, 11, 0, 13, 64, 4944 }, // ó
+    { 12, 16, 12, 0, 12, 96, 5008 }, // Ą
+    { 10, 13, 10, 0, 9, 72, 5104 }, // ą
+    { 11, 16, 11, 0, 16, 81, 5176 }, // Ć
+    { 9, 13, 9, 0, 13, 65, 5257 }, // ć
+    { 8, 16, 10, 1, 12, 53, 5322 }, // Ę
+    { 10, 13, 10, 0, 9, 76, 5375 }, // ę
+    { 10, 12, 10, 0, 12, 48, 5451 }, // Ł
+    { 6, 13, 6, 0, 13, 24, 5499 }, // ł
+    { 12, 16, 14, 1, 16, 78, 5523 }, // Ń
+    { 9, 13, 11, 1, 13, 54, 5601 }, // ń
+    { 9, 16, 9, 0, 16, 78, 5655 }, // Ś
+    { 8, 13, 8, 0, 13, 60, 5733 }, // ś
+    { 10, 16, 10, 0, 16, 77, 5793 }, // Ź
+    { 8, 13, 8, 0, 13, 58, 5870 }, // ź
+    { 10, 16, 10, 0, 16, 78, 5928 }, // Ż
+    { 8, 13, 8, 0, 13, 56, 6006 }, // ż
+};
+const UnicodeInterval OpenSans8BIntervals[] = {
+    { 0x20, 0x7E, 0x0 },
+    { 0xB0, 0xB0, 0x5F },
+    { 0xD3, 0xD3, 0x60 },
+    { 0xE4, 0xE4, 0x61 },
+    { 0xF3, 0xF3, 0x62 },
+    { 0x104, 0x107, 0x63 },
+    { 0x118, 0x119, 0x67 },
+    { 0x141, 0x144, 0x69 },
+    { 0x15A, 0x15B, 0x6D },
+    { 0x179, 0x17C, 0x6F },
+};
+const GFXfont OpenSans8B = {
+    (uint8_t*)OpenSans8BBitmaps,
+    (GFXglyph*)OpenSans8BGlyphs,
+    (UnicodeInterval*)OpenSans8BIntervals,
+    10,
+    1,
+    23,
+    18,
+    -5,
+};
@@ -0,0 +1,81 @@
+#include "packbits.h"
+
+int ByteSource::read()
+{
+    if (stream)
+        return stream->read();
+    return pos < length ? data[pos++] : -1;
+}
+
+size_t ByteSource::read(uint8_t *buffer, size_t n)
+{
+    if (stream)
+        return stream->readBytes(buffer, n);
+    n = min(n, length - pos);
+    memcpy(buffer, data + pos, n);
+    pos += n;
+    return n;
+}
+
+// Repeats of 3 or more bytes become runs, anything shorter stays in the surrounding literal
+size_t PackBitsEncode(const uint8_t *src, size_t n, uint8_t *dst)
+{
+    size_t in = 0, out = 0;
+    while (in < n)
+    {
+        size_t run = 1;
+        while (in + run < n && run < 128 && src[in + run] == src[in])
+            run++;
+        if (run >= 3)
+        {
+            dst[out++] = uint8_t(1 - int(run));
+            dst[out++] = src[in];
+            in += run;
+            continue;
+        }
+        size_t literal = 0; // Literal up to the next run of 3
+        while (in + literal < n && literal < 128)
+        {
+            if (in + literal + 2 < n && src[in + literal] == src[in + literal + 1] && src[in + literal] == src[in + literal + 2])
+                break;
+            literal++;
+        }
+        dst[out++] = uint8_t(literal - 1);
+        memcpy(dst + out, src + in, literal);
+        out += literal;
+        in += literal;
+    }
+    return out;
+}
+
+// Decodes exactly n bytes, false when the input ends early or a run overshoots the row
+bool PackBitsDecode(ByteSource &in, uint8_t *out, size_t n)
+{
+    size_t pos = 0;
+    while (pos < n)
+    {
+        const int header = in.read();
+        if (header < 0)
+            return false;
+        const int8_t count = int8_t(header);
+        if (count == -128)
+            continue;
+        if (count >= 0)
+        {
+            const size_t literal = count + 1;
+            if (pos + literal > n || in.read(out + pos, literal) != literal)
+                return false;
+            pos += literal;
+        }
+        else
+        {
+            const size_t run = 1 - count;
+            const int value = in.read();
+            if (value < 0 || pos + run > n)
+                return false;
+            memset(out + pos, value, run);
+            pos += run;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,31 @@
+#ifndef PACKBITS_H
+#define PACKBITS_H
+
+#include <Arduino.h>           // In-built
+
+// PackBits run-length coding (as in TIFF): a header byte n, 0..127 copies the next n + 1 bytes literally,
+// -127..-1 repeats the next byte 1 - n times, -128 is skipped. Runs never cross a row, so every row can be
+// decoded on its own into a row sized buffer.
+
+class ByteSource
+{ // Stream or memory buffer read through one interface, decoders never need a copy of their whole input
+public:
+    ByteSource(Stream &s) : stream(&s), data(NULL), length(0), pos(0) {}
+    ByteSource(const uint8_t *d, size_t n) : stream(NULL), data(d), length(n), pos(0) {}
+
+    int read();                            // -1 at the end of the input
+    size_t read(uint8_t *buffer, size_t n); // Bytes actually read
+
+private:
+    Stream *stream;
+    const uint8_t *data;
+    size_t length;
+    size_t pos;
+};
+
+#define PACKBITS_MAX_SIZE(n) ((n) + ((n) + 127) / 128) // Worst case encoded size of n bytes
+
+size_t PackBitsEncode(const uint8_t *src, size_t n, uint8_t *dst);
+bool PackBitsDecode(ByteSource &in, uint8_t *out, size_t n);
+
+#endif // PACKBITS_H
@@ -0,0 +1,653 @@
+#include "rasteriser.h"
+#include "displayList.h"
+
+#define MAX_ROW_SPANS 8        // Enough for a cloud: 4 discs + 1 box per row
+#define MAX_POLYLINE_POINTS 64 // Longer polylines are drawn in chunks
+
+typedef struct
+{
+    int x0;
+    int x1;
+} RowSpan;
+
+static int clipX0 = 0, clipY0 = 0, clipX1 = EPD_WIDTH - 1, clipY1 = EPD_HEIGHT - 1;
+static uint8_t *targetBuffer = NULL; // NULL draws into the full screen framebuffer
+static int targetY = 0;              // Screen row stored in the first row of targetBuffer
+
+#if RASTER_STATS
+uint32_t rasterPixelWrites = 0;
+uint32_t rasterSpanWrites = 0;
+uint32_t rasterPrimitives = 0;
+uint32_t rasterPrimitiveCounts[RASTER_PRIMITIVE_TYPES];
+const char *const rasterPrimitiveNames[RASTER_PRIMITIVE_TYPES] = {"rect", "circle", "line", "polyline", "disc",
+                                                                  "ring", "capsule", "triangle", "outlined", "glyph",
+                                                                  "image"};
+
+void rasterResetStats()
+{
+    rasterPixelWrites = 0;
+    rasterSpanWrites = 0;
+    rasterPrimitives = 0;
+    memset(rasterPrimitiveCounts, 0, sizeof(rasterPrimitiveCounts));
+}
+#define COUNT_PRIMITIVE(type) (rasterPrimitives++, rasterPrimitiveCounts[type]++)
+#else
+#define COUNT_PRIMITIVE(type)
+#endif
+
+// While a display list records, primitives store themselves with their bounding box instead of drawing
+#define RECORD(op, color, x0, y0, x1, y1, ...)                                                             \
+    do                                                                                                      \
+    {                                                                                                       \
+        const int params[] = {__VA_ARGS__};                                                                 \
+        DisplayListRecord(op, color, 0, x0, y0, x1, y1, params, sizeof(params) / sizeof(params[0]));        \
+    } while (0)
+
+void rasterSetClip(int x, int y, int w, int h)
+{
+    clipX0 = max(x, 0);
+    clipY0 = max(y, 0);
+    clipX1 = min(x + w, EPD_WIDTH) - 1;
+    clipY1 = min(y + h, EPD_HEIGHT) - 1;
+}
+
+void rasterResetClip()
+{
+    rasterSetClip(0, 0, EPD_WIDTH, EPD_HEIGHT);
+}
+
+// Draws into a band buffer holding screen rows y..y+rows-1, full width, instead of the framebuffer
+void rasterSetTarget(uint8_t *buffer, int y, int rows)
+{
+    targetBuffer = buffer;
+    targetY = y;
+    rasterSetClip(0, y, EPD_WIDTH, rows);
+}
+
+void rasterResetTarget()
+{
+    targetBuffer = NULL;
+    targetY = 0;
+    rasterResetClip();
+}
+
+// True when any of the rows y..y+h-1 can be written, lets callers skip work outside the current band
+bool rasterRowsVisible(int y, int h)
+{
+    return y <= clipY1 && y + h - 1 >= clipY0;
+}
+
+bool rasterBoxVisible(int x, int y, int w, int h)
+{
+    return y <= clipY1 && y + h - 1 >= clipY0 && x <= clipX1 && x + w - 1 >= clipX0;
+}
+
+static inline uint8_t *targetRow(int y)
+{
+    return (targetBuffer ? targetBuffer : framebuffer) + (y - targetY) * (EPD_WIDTH / 2);
+}
+
+// Span kernel: writes pixels x0..x1 (inclusive) of row y, two pixels per byte, even x in the low nibble
+void rasterSpan(int x0, int x1, int y, uint8_t color)
+{
+    if (x0 > x1)
+    {
+        int t = x0;
+        x0 = x1;
+        x1 = t;
+    }
+    if (displayListRecording)
+    {
+        RECORD(DL_SPAN, color, x0, y, x1, y, x0, x1, y);
+        return;
+    }
+    if (y < clipY0 || y > clipY1)
+        return;
+    x0 = max(x0, clipX0);
+    x1 = min(x1, clipX1);
+    if (x0 > x1)
+        return;
+#if RASTER_STATS
+    rasterPixelWrites += x1 - x0 + 1;
+    rasterSpanWrites++;
+#endif
+    const uint8_t nibble = color >> 4;
+    uint8_t *row = targetRow(y);
+    if (x0 & 1)
+    { // Leading odd pixel lives in the high nibble
+        row[x0 / 2] = (row[x0 / 2] & 0x0F) | (nibble << 4);
+        x0++;
+    }
+    if (x0 > x1)
+        return;
+    if (!(x1 & 1))
+    { // Trailing even pixel lives in the low nibble
+        row[x1 / 2] = (row[x1 / 2] & 0xF0) | nibble;
+        x1--;
+    }
+    if (x0 < x1)
+        memset(row + x0 / 2, nibble | (nibble << 4), (x1 - x0 + 1) / 2);
+}
+
+void rasterFillRect(int x, int y, int w, int h, uint8_t color)
+{
+    if (displayListRecording)
+    {
+        if (w > 0 && h > 0)
+            RECORD(DL_RECT, color, x, y, x + w - 1, y + h - 1, x, y, w, h);
+        return;
+    }
+    COUNT_PRIMITIVE(RASTER_RECT);
+    for (int row = max(y, clipY0); row < y + h && row <= clipY1; row++)
+        rasterSpan(x, x + w - 1, row, color);
+}
+
+void rasterPixel(int x, int y, uint8_t color)
+{
+    rasterSpan(x, x, y, color);
+}
+
+// Midpoint circle outline
+void rasterCircle(int x, int y, int r, uint8_t color)
+{
+    if (displayListRecording)
+    {
+        RECORD(DL_CIRCLE, color, x - r, y - r, x + r, y + r, x, y, r);
+        return;
+    }
+    COUNT_PRIMITIVE(RASTER_CIRCLE);
+    int f = 1 - r, ddF_x = 1, ddF_y = -2 * r, px = 0, py = r;
+    rasterPixel(x, y + r, color);
+    rasterPixel(x, y - r, color);
+    rasterPixel(x + r, y, color);
+    rasterPixel(x - r, y, color);
+    while (px < py)
+    {
+        if (f >= 0)
+        {
+            py--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        px++;
+        ddF_x += 2;
+        f += ddF_x;
+        rasterPixel(x + px, y + py, color);
+        rasterPixel(x - px, y + py, color);
+        rasterPixel(x + px, y - py, color);
+        rasterPixel(x - px, y - py, color);
+        rasterPixel(x + py, y + px, color);
+        rasterPixel(x - py, y + px, color);
+        rasterPixel(x + py, y - px, color);
+        rasterPixel(x - py, y - px, color);
+    }
+}
+
+// Copies a w x h 4bpp bitmap (rows of (w + 1) / 2 bytes, even pixel in the low nibble) with clipping.
+// invert stores 15 - value, which turns font coverage (0 = none) into framebuffer grey (15 = white).
+void rasterBlit4(int x, int y, int w, int h, const uint8_t *data, bool invert)
+{
+    COUNT_PRIMITIVE(RASTER_GLYPH);
+    const int stride = (w + 1) / 2;
+    const int sx0 = max(0, clipX0 - x), sx1 = min(w, clipX1 - x + 1);
+    if (sx0 >= sx1)
+        return;
+    for (int row = max(0, clipY0 - y); row < h && y + row <= clipY1; row++)
+    {
+        const uint8_t *src = data + row * stride;
+        uint8_t *dst = targetRow(y + row);
+        for (int sx = sx0; sx < sx1; sx++)
+        {
+            uint8_t v = (sx & 1) ? src[sx / 2] >> 4 : src[sx / 2] & 0x0F;
+            if (invert)
+                v = 15 - v;
+            const int dx = x + sx;
+            uint8_t *b = dst + dx / 2;
+            *b = (dx & 1) ? (*b & 0x0F) | (v << 4) : (*b & 0xF0) | v;
+        }
+#if RASTER_STATS
+        rasterPixelWrites += sx1 - sx0;
+#endif
+    }
+}
+
+// One image row, a 0..15 gray level per byte (15 = white), packed two pixels per framebuffer byte
+void rasterGrayRow(int x, int y, int w, const uint8_t *levels)
+{
+    COUNT_PRIMITIVE(RASTER_IMAGE);
+    if (y < clipY0 || y > clipY1)
+        return;
+    int x0 = max(x, clipX0), x1 = min(x + w - 1, clipX1);
+    if (x0 > x1)
+        return;
+#if RASTER_STATS
+    rasterPixelWrites += x1 - x0 + 1;
+    rasterSpanWrites++;
+#endif
+    uint8_t *row = targetRow(y);
+    const uint8_t *src = levels - x;
+    if (x0 & 1)
+    { // Leading odd pixel lives in the high nibble
+        row[x0 / 2] = (row[x0 / 2] & 0x0F) | (src[x0] << 4);
+        x0++;
+    }
+    for (; x0 < x1; x0 += 2) // Whole bytes
+        row[x0 / 2] = src[x0] | (src[x0 + 1] << 4);
+    if (x0 == x1)
+        row[x0 / 2] = (row[x0 / 2] & 0xF0) | src[x0];
+}
+
+// Bresenham line emitted as horizontal runs, one span per row instead of one write per pixel.
+// skipFirst leaves out the start pixel so joined polyline segments do not write their shared vertex twice.
+static void lineSpans(int x0, int y0, int x1, int y1, uint8_t color, bool skipFirst)
+{
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    int runX0 = x0, runX1 = x0, runY = y0;
+    bool haveRun = !skipFirst;
+    while (x0 != x1 || y0 != y1)
+    {
+        int e2 = 2 * err;
+        if (e2 >= dy)
+        {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx)
+        {
+            err += dx;
+            y0 += sy;
+        }
+        if (y0 != runY)
+        {
+            if (haveRun)
+                rasterSpan(runX0, runX1, runY, color);
+            runX0 = runX1 = x0;
+            runY = y0;
+            haveRun = true;
+        }
+        else
+        {
+            if (!haveRun)
+                runX0 = x0;
+            runX1 = x0;
+            haveRun = true;
+        }
+    }
+    if (haveRun)
+        rasterSpan(runX0, runX1, runY, color);
+}
+
+void rasterLine(int x0, int y0, int x1, int y1, uint8_t color)
+{
+    if (displayListRecording)
+    {
+        RECORD(DL_LINE, color, min(x0, x1), min(y0, y1), max(x0, x1), max(y0, y1), x0, y0, x1, y1);
+        return;
+    }
+    COUNT_PRIMITIVE(RASTER_LINE);
+    lineSpans(x0, y0, x1, y1, color, false);
+}
+
+// Half-width of a disc of radius r at vertical distance dy, -1 when the row misses the disc
+static int discHalfWidth(int r, int dy)
+{
+    if (r < 0 || dy > r || dy < -r)
+        return -1;
+    int rr = r * r + r; // (r + 0.5)^2 rounded, gives the same outline as the midpoint circle
+    int dd = rr - dy * dy;
+    int hw = sqrt(dd);
+    while (hw * hw > dd)
+        hw--;
+    while ((hw + 1) * (hw + 1) <= dd)
+        hw++;
+    return min(hw, r);
+}
+
+void rasterFillCircle(int x, int y, int r, uint8_t color)
+{
+    if (displayListRecording)
+    {
+        RECORD(DL_DISC, color, x - r, y - r, x + r, y + r, x, y, r);
+        return;
+    }
+    COUNT_PRIMITIVE(RASTER_DISC);
+    for (int dy = -r; dy <= r; dy++)
+    {
+        int hw = discHalfWidth(r, dy);
+        if (hw >= 0)
+            rasterSpan(x - hw, x + hw, y + dy, color);
+    }
+}
+
+// Annulus between rInner (exclusive) and rOuter (inclusive)
+void rasterFillRing(int x, int y, int rOuter, int rInner, uint8_t color)
+{
+    if (displayListRecording)
+    {
+        RECORD(DL_RING, color, x - rOuter, y - rOuter, x + rOuter, y + rOuter, x, y, rOuter, rInner);
+        return;
+    }
+    COUNT_PRIMITIVE(RASTER_RING);
+    for (int dy = -rOuter; dy <= rOuter; dy++)
+    {
+        int ho = discHalfWidth(rOuter, dy);
+        int hi = discHalfWidth(rInner, dy);
+        if (ho < 0)
+            continue;
+        if (hi < 0)
+        {
+            rasterSpan(x - ho, x + ho, y + dy, color);
+        }
+        else
+        {
+            if (ho > hi)
+            {
+                rasterSpan(x - ho, x - hi - 1, y + dy, color);
+                rasterSpan(x + hi + 1, x + ho, y + dy, color);
+            }
+        }
+    }
+}
+
+// Rounded capsule (stadium) inside the w x h box, ends are half circles of radius h/2 (or w/2 when upright)
+void rasterFillCapsule(int x, int y, int w, int h, uint8_t color)
+{
+    if (displayListRecording)
+    {
+        if (w > 0 && h > 0)
+            RECORD(DL_CAPSULE, color, x, y, x + w - 1, y + h - 1, x, y, w, h);
+        return;
+    }
+    COUNT_PRIMITIVE(RASTER_CAPSULE);
+    if (w <= 0 || h <= 0)
+        return;
+    if (w >= h)
+    {
+        int r = (h - 1) / 2;
+        for (int row = 0; row < h; row++)
+        {
+            int dy = (row < r) ? row - r : ((row > h - 1 - r) ? row - (h - 1 - r) : 0);
+            int hw = discHalfWidth(r, dy);
+            if (hw >= 0)
+                rasterSpan(x + r - hw, x + w - 1 - r + hw, y + row, color);
+        }
+    }
+    else
+    {
+        int r = (w - 1) / 2;
+        for (int row = 0; row < h; row++)
+        {
+            int dy = (row < r) ? row - r : ((row > h - 1 - r) ? row - (h - 1 - r) : 0);
+            int hw = discHalfWidth(r, dy);
+            if (hw >= 0)
+                rasterSpan(x + r - hw, x + r + hw, y + row, color);
+        }
+    }
+}
+
+void rasterFillTriangle(int x0, int y0, int x1, int y1, int x2, int y2, uint8_t color)
+{
+    if (displayListRecording)
+    {
+        RECORD(DL_TRIANGLE, color, min(x0, min(x1, x2)), min(y0, min(y1, y2)), max(x0, max(x1, x2)), max(y0, max(y1, y2)), x0, y0, x1, y1, x2, y2);
+        return;
+    }
+    COUNT_PRIMITIVE(RASTER_TRIANGLE);
+    // Sort vertices by y so that y0 <= y1 <= y2
+    if (y0 > y1)
+    {
+        int t = y0; y0 = y1; y1 = t;
+        t = x0; x0 = x1; x1 = t;
+    }
+    if (y1 > y2)
+    {
+        int t = y1; y1 = y2; y2 = t;
+        t = x1; x1 = x2; x2 = t;
+    }
+    if (y0 > y1)
+    {
+        int t = y0; y0 = y1; y1 = t;
+        t = x0; x0 = x1; x1 = t;
+    }
+    if (y0 == y2)
+    { // Degenerate, all on one row
+        rasterSpan(min(x0, min(x1, x2)), max(x0, max(x1, x2)), y0, color);
+        return;
+    }
+    // Edge steps in 16.16 fixed point, long edge 0->2 against short edges 0->1 and 1->2
+    int32_t dx02 = ((int32_t)(x2 - x0) << 16) / (y2 - y0);
+    int32_t dx01 = (y1 != y0) ? ((int32_t)(x1 - x0) << 16) / (y1 - y0) : 0;
+    int32_t dx12 = (y2 != y1) ? ((int32_t)(x2 - x1) << 16) / (y2 - y1) : 0;
+    int32_t xa = (int32_t)x0 << 16, xb = (int32_t)x0 << 16;
+    int last = (y1 == y2) ? y1 : y1 - 1; // Include row y1 in the upper half only if it is the last row
+    int y = y0;
+    for (; y <= last; y++)
+    {
+        rasterSpan((xa + 0x8000) >> 16, (xb + 0x8000) >> 16, y, color);
+        xa += dx02;
+        xb += dx01;
+    }
+    xb = (int32_t)x1 << 16;
+    for (; y <= y2; y++)
+    {
+        rasterSpan((xa + 0x8000) >> 16, (xb + 0x8000) >> 16, y, color);
+        xa += dx02;
+        xb += dx12;
+    }
+}
+
+// Sorts and merges overlapping/adjacent spans in place, returns the new count
+static int mergeSpans(RowSpan *spans, int count)
+{
+    for (int i = 1; i < count; i++)
+    { // Insertion sort, counts are tiny
+        RowSpan s = spans[i];
+        int j = i - 1;
+        while (j >= 0 && spans[j].x0 > s.x0)
+        {
+            spans[j + 1] = spans[j];
+            j--;
+        }
+        spans[j + 1] = s;
+    }
+    int merged = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (merged > 0 && spans[i].x0 <= spans[merged - 1].x1 + 1)
+            spans[merged - 1].x1 = max(spans[merged - 1].x1, spans[i].x1);
+        else
+            spans[merged++] = spans[i];
+    }
+    return merged;
+}
+
+static int collectSpans(const RasterDisc *discs, int count, RasterBox box, int y, RowSpan *spans)
+{
+    int n = 0;
+    for (int i = 0; i < count && n < MAX_ROW_SPANS; i++)
+    {
+        int hw = discHalfWidth(discs[i].r, y - discs[i].y);
+        if (hw >= 0)
+            spans[n++] = {discs[i].x - hw, discs[i].x + hw};
+    }
+    if (box.w > 0 && y >= box.y && y < box.y + box.h && n < MAX_ROW_SPANS)
+        spans[n++] = {box.x, box.x + box.w - 1};
+    return mergeSpans(spans, n);
+}
+
+// Draws an outlined compound shape in one pass: the union of 'outer' discs and outerBox minus the union of
+// 'inner' discs and innerBox is written in 'outline', the inner union in 'fill'. Replaces fill-then-erase drawing.
+void rasterFillOutlined(const RasterDisc *outer, const RasterDisc *inner, int discs, RasterBox outerBox, RasterBox innerBox, uint8_t outline, uint8_t fill)
+{
+    int top = outerBox.h > 0 ? outerBox.y : EPD_HEIGHT, bottom = outerBox.h > 0 ? outerBox.y + outerBox.h - 1 : -1;
+    for (int i = 0; i < discs; i++)
+    {
+        top = min(top, outer[i].y - outer[i].r);
+        bottom = max(bottom, outer[i].y + outer[i].r);
+    }
+    if (displayListRecording)
+    {
+        int left = outerBox.w > 0 ? outerBox.x : EPD_WIDTH, right = outerBox.w > 0 ? outerBox.x + outerBox.w - 1 : -1;
+        for (int i = 0; i < discs; i++)
+        {
+            left = min(left, outer[i].x - outer[i].r);
+            right = max(right, outer[i].x + outer[i].r);
+        }
+        const int params[] = {discs};
+        DisplayListRecord(DL_OUTLINED, outline, fill, left, top, right, bottom, params, 1);
+        DisplayListAppend(outer, discs * sizeof(RasterDisc));
+        DisplayListAppend(inner, discs * sizeof(RasterDisc));
+        DisplayListAppend(&outerBox, sizeof(RasterBox));
+        DisplayListAppend(&innerBox, sizeof(RasterBox));
+        return;
+    }
+    COUNT_PRIMITIVE(RASTER_OUTLINED);
+    RowSpan os[MAX_ROW_SPANS], is[MAX_ROW_SPANS];
+    for (int y = max(top, clipY0); y <= bottom && y <= clipY1; y++)
+    {
+        int on = collectSpans(outer, discs, outerBox, y, os);
+        int in = collectSpans(inner, discs, innerBox, y, is);
+        for (int i = 0; i < in; i++)
+            rasterSpan(is[i].x0, is[i].x1, y, fill);
+        for (int o = 0; o < on; o++)
+        { // Emit the parts of each outer span that are not covered by an inner span
+            int x = os[o].x0;
+            for (int i = 0; i < in && x <= os[o].x1; i++)
+            {
+                if (is[i].x1 < x)
+                    continue;
+                if (is[i].x0 > os[o].x1)
+                    break;
+                if (is[i].x0 > x)
+                    rasterSpan(x, is[i].x0 - 1, y, outline);
+                x = is[i].x1 + 1;
+            }
+            if (x <= os[o].x1)
+                rasterSpan(x, os[o].x1, y, outline);
+        }
+    }
+}
+
+// Horizontal extent on row y of the capsule swept by a disc of radius r moving from a to b.
+// The capsule is convex, so every row it touches is a single interval.
+static bool capsuleRowSpan(float ax, float ay, float bx, float by, float r, float y, float *xmin, float *xmax)
+{
+    float lo = 1e9f, hi = -1e9f;
+    const float ex[2] = {ax, bx}, ey[2] = {ay, by};
+    for (int i = 0; i < 2; i++)
+    { // Round caps and joins
+        float dy = y - ey[i];
+        if (fabsf(dy) <= r)
+        {
+            float hw = sqrtf(r * r - dy * dy);
+            lo = min(lo, ex[i] - hw);
+            hi = max(hi, ex[i] + hw);
+        }
+    }
+    float dx = bx - ax, dy = by - ay;
+    float len = sqrtf(dx * dx + dy * dy);
+    if (len > 0)
+    { // Body: the segment offset by +/- r along its normal
+        float nx = -dy / len * r, ny = dx / len * r;
+        const float qx[4] = {ax + nx, bx + nx, bx - nx, ax - nx};
+        const float qy[4] = {ay + ny, by + ny, by - ny, ay - ny};
+        for (int i = 0; i < 4; i++)
+        {
+            int j = (i + 1) & 3;
+            if ((qy[i] - y) * (qy[j] - y) > 0)
+                continue;
+            if (qy[i] == qy[j])
+            {
+                lo = min(lo, min(qx[i], qx[j]));
+                hi = max(hi, max(qx[i], qx[j]));
+            }
+            else
+            {
+                float x = qx[i] + (y - qy[i]) * (qx[j] - qx[i]) / (qy[j] - qy[i]);
+                lo = min(lo, x);
+                hi = max(hi, x);
+            }
+        }
+    }
+    if (lo > hi)
+        return false;
+    *xmin = lo;
+    *xmax = hi;
+    return true;
+}
+
+// Width-aware polyline with round joins and caps. Each row collects one interval per segment, the
+// intervals are merged and emitted once, so overlapping joins never write a pixel twice.
+// Even widths are centred half a pixel up/left, matching the old "line plus line offset by -1" idiom.
+void rasterPolyline(const RasterPoint *points, int count, int width, uint8_t color)
+{
+    if (count < 2)
+        return;
+    if (displayListRecording)
+    {
+        int left = points[0].x, top = points[0].y, right = left, bottom = top;
+        for (int i = 1; i < count; i++)
+        {
+            left = min(left, points[i].x);
+            right = max(right, points[i].x);
+            top = min(top, points[i].y);
+            bottom = max(bottom, points[i].y);
+        }
+        const int pad = width / 2 + 1;
+        RECORD(DL_POLYLINE, color, left - pad, top - pad, right + pad, bottom + pad, count, width);
+        DisplayListAppend(points, count * sizeof(RasterPoint));
+        return;
+    }
+    COUNT_PRIMITIVE(RASTER_POLYLINE);
+    if (width <= 1)
+    {
+        for (int i = 1; i < count; i++)
+            lineSpans(points[i - 1].x, points[i - 1].y, points[i].x, points[i].y, color, i > 1);
+        return;
+    }
+    while (count > MAX_POLYLINE_POINTS)
+    { // Draw in chunks sharing their end vertex
+        rasterPolyline(points, MAX_POLYLINE_POINTS, width, color);
+        points += MAX_POLYLINE_POINTS - 1;
+        count -= MAX_POLYLINE_POINTS - 1;
+    }
+    const float shift = (width % 2 == 0) ? -0.5f : 0.0f;
+    const float r = width / 2.0f - 0.01f;
+    int top = points[0].y, bottom = points[0].y;
+    for (int i = 1; i < count; i++)
+    {
+        top = min(top, points[i].y);
+        bottom = max(bottom, points[i].y);
+    }
+    top = max((int)floorf(top + shift - r), clipY0);
+    bottom = min((int)ceilf(bottom + shift + r), clipY1);
+    RowSpan spans[MAX_POLYLINE_POINTS];
+    for (int y = top; y <= bottom; y++)
+    {
+        int n = 0;
+        for (int i = 1; i < count; i++)
+        {
+            float ay = points[i - 1].y + shift, by = points[i].y + shift;
+            if (y < min(ay, by) - r || y > max(ay, by) + r)
+                continue;
+            float lo, hi;
+            if (capsuleRowSpan(points[i - 1].x + shift, ay, points[i].x + shift, by, r, y, &lo, &hi))
+            {
+                int x0 = (int)ceilf(lo), x1 = (int)floorf(hi);
+                if (x0 <= x1)
+                    spans[n++] = {x0, x1};
+            }
+        }
+        n = mergeSpans(spans, n);
+        for (int i = 0; i < n; i++)
+            rasterSpan(spans[i].x0, spans[i].x1, y, color);
+    }
+}
+
+void rasterThickLine(int x0, int y0, int x1, int y1, int width, uint8_t color)
+{
+    const RasterPoint points[] = {{x0, y0}, {x1, y1}};
+    rasterPolyline(points, 2, width, color);
+}
@@ -0,0 +1,92 @@
+#ifndef RASTERISER_H
+#define RASTERISER_H
+
+#include <Arduino.h>           // In-built
+#include "epd_driver.h"        // https://github.com/Xinyuan-LilyGO/LilyGo-EPD47
+
+// Scanline rasteriser writing horizontal spans straight into the 4bpp framebuffer.
+// Every shape is decomposed into rows of [x0, x1] spans so each pixel is written exactly once.
+// Colours use the same 0x00..0xFF convention as drawingFunctions.h, only the upper nibble is stored.
+// Coordinates are always screen coordinates; the target can be the full framebuffer or a horizontal
+// band of it (strip rendering), rows outside the target are clipped.
+
+// Set RASTER_STATS to 1 (e.g. -DRASTER_STATS=1 in platformio.ini) to count pixel writes, the render profiler
+// (RENDER_PROFILE) turns it on as well
+#ifndef RENDER_PROFILE
+#define RENDER_PROFILE 0
+#endif
+#ifndef RASTER_STATS
+#define RASTER_STATS RENDER_PROFILE
+#endif
+
+typedef struct
+{ // Filled disc, centre x/y and radius r
+    int x;
+    int y;
+    int r;
+} RasterDisc;
+
+typedef struct
+{ // Polyline vertex
+    int x;
+    int y;
+} RasterPoint;
+
+typedef struct
+{ // Axis aligned box, top-left x/y, width and height
+    int x;
+    int y;
+    int w;
+    int h;
+} RasterBox;
+
+extern uint8_t *framebuffer;
+
+#if RASTER_STATS
+typedef enum
+{
+    RASTER_RECT,
+    RASTER_CIRCLE,
+    RASTER_LINE,
+    RASTER_POLYLINE,
+    RASTER_DISC,
+    RASTER_RING,
+    RASTER_CAPSULE,
+    RASTER_TRIANGLE,
+    RASTER_OUTLINED,
+    RASTER_GLYPH,
+    RASTER_IMAGE,
+    RASTER_PRIMITIVE_TYPES
+} RasterPrimitive;
+
+extern uint32_t rasterPixelWrites;
+extern uint32_t rasterSpanWrites;
+extern uint32_t rasterPrimitives;
+extern uint32_t rasterPrimitiveCounts[RASTER_PRIMITIVE_TYPES];
+extern const char *const rasterPrimitiveNames[RASTER_PRIMITIVE_TYPES];
+void rasterResetStats();
+#endif
+
+void rasterSetClip(int x, int y, int w, int h);
+void rasterResetClip();
+void rasterSetTarget(uint8_t *buffer, int y, int rows);
+void rasterResetTarget();
+bool rasterRowsVisible(int y, int h);
+bool rasterBoxVisible(int x, int y, int w, int h);
+
+void rasterSpan(int x0, int x1, int y, uint8_t color);
+void rasterFillRect(int x, int y, int w, int h, uint8_t color);
+void rasterPixel(int x, int y, uint8_t color);
+void rasterCircle(int x, int y, int r, uint8_t color);
+void rasterBlit4(int x, int y, int w, int h, const uint8_t *data, bool invert);
+void rasterGrayRow(int x, int y, int w, const uint8_t *levels);
+void rasterLine(int x0, int y0, int x1, int y1, uint8_t color);
+void rasterThickLine(int x0, int y0, int x1, int y1, int width, uint8_t color);
+void rasterPolyline(const RasterPoint *points, int count, int width, uint8_t color);
+void rasterFillCircle(int x, int y, int r, uint8_t color);
+void rasterFillRing(int x, int y, int rOuter, int rInner, uint8_t color);
+void rasterFillCapsule(int x, int y, int w, int h, uint8_t color);
+void rasterFillTriangle(int x0, int y0, int x1, int y1, int x2, int y2, uint8_t color);
+void rasterFillOutlined(const RasterDisc *outer, const RasterDisc *inner, int discs, RasterBox outerBox, RasterBox innerBox, uint8_t outline, uint8_t fill);
+
+#endif // RASTERISER_H
@@ -0,0 +1,86 @@
+#include "renderProfiler.h"
+
+#if RENDER_PROFILE
+
+typedef struct
+{
+    const char *name; // String literal, sections are matched by pointer
+    uint32_t calls;
+    uint32_t cycles;
+    uint32_t primitives;
+    uint32_t spans;
+    uint32_t pixels;
+} ProfileSection;
+
+static ProfileSection sections[MAX_PROFILE_SECTIONS];
+static int sectionCount = 0;
+static uint32_t frameStartCycles = 0;
+static char table[3072]; // Last finished frame, served by /profile
+
+static int FindSection(const char *name)
+{
+    for (int i = 0; i < sectionCount; i++)
+        if (sections[i].name == name)
+            return i;
+    if (sectionCount == MAX_PROFILE_SECTIONS)
+        return -1;
+    sections[sectionCount] = {name, 0, 0, 0, 0, 0};
+    return sectionCount++;
+}
+
+ProfileScope::ProfileScope(const char *name)
+{
+    section = FindSection(name);
+    startPrimitives = rasterPrimitives;
+    startSpans = rasterSpanWrites;
+    startPixels = rasterPixelWrites;
+    startCycles = ESP.getCycleCount();
+}
+
+ProfileScope::~ProfileScope()
+{
+    const uint32_t cycles = ESP.getCycleCount() - startCycles;
+    if (section < 0)
+        return;
+    ProfileSection &s = sections[section];
+    s.calls++;
+    s.cycles += cycles;
+    s.primitives += rasterPrimitives - startPrimitives;
+    s.spans += rasterSpanWrites - startSpans;
+    s.pixels += rasterPixelWrites - startPixels;
+}
+
+void ProfileBeginFrame()
+{
+    sectionCount = 0;
+    rasterResetStats();
+    frameStartCycles = ESP.getCycleCount();
+}
+
+// Formats the frame into the table served over the web and prints it on serial
+void ProfileEndFrame(const char *frameName)
+{
+    const uint32_t frameCycles = ESP.getCycleCount() - frameStartCycles;
+    size_t n = snprintf(table, sizeof(table), "%s: %u kcycles, %u primitives, %u spans, %u pixels\n%-28s %5s %9s %6s %6s %7s\n",
+                        frameName, frameCycles / 1000, rasterPrimitives, rasterSpanWrites, rasterPixelWrites,
+                        "Section", "Calls", "kcycles", "Prims", "Spans", "Pixels");
+    for (int i = 0; i < sectionCount && n < sizeof(table); i++)
+    {
+        const ProfileSection &s = sections[i];
+        n += snprintf(table + n, sizeof(table) - n, "%-28s %5u %9u %6u %6u %7u\n",
+                      s.name, s.calls, s.cycles / 1000, s.primitives, s.spans, s.pixels);
+    }
+    for (int i = 0; i < RASTER_PRIMITIVE_TYPES && n < sizeof(table); i++)
+    {
+        if (rasterPrimitiveCounts[i])
+            n += snprintf(table + n, sizeof(table) - n, "  %-10s %6u\n", rasterPrimitiveNames[i], rasterPrimitiveCounts[i]);
+    }
+    Serial.print(table);
+}
+
+const char *ProfileTable()
+{
+    return table;
+}
+
+#endif // RENDER_PROFILE
@@ -0,0 +1,44 @@
+#ifndef RENDERPROFILER_H
+#define RENDERPROFILER_H
+
+#include <Arduino.h>           // In-built
+#include "rasteriser.h"
+
+// Per-section render profiler, enabled with -DRENDER_PROFILE=1 (compiled out otherwise).
+// PROFILE_SECTION("name") at the top of a function records its cycles, primitives, spans and pixels
+// until the function returns. Sections nest, so the figures are inclusive of nested sections.
+#if RENDER_PROFILE
+
+#define MAX_PROFILE_SECTIONS 32
+
+class ProfileScope
+{
+public:
+    ProfileScope(const char *name);
+    ~ProfileScope();
+
+private:
+    int section;
+    uint32_t startCycles;
+    uint32_t startPrimitives;
+    uint32_t startSpans;
+    uint32_t startPixels;
+};
+
+#define PROFILE_CONCAT2(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT2(a, b)
+#define PROFILE_SECTION(name) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+
+void ProfileBeginFrame();
+void ProfileEndFrame(const char *frameName);
+const char *ProfileTable();
+
+#else
+
+#define PROFILE_SECTION(name)
+#define ProfileBeginFrame()
+#define ProfileEndFrame(frameName)
+
+#endif // RENDER_PROFILE
+
+#endif // RENDERPROFILER_H
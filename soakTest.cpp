@@ -0,0 +1,241 @@
+#include "soakTest.h"
+
+#if SOAK_TEST
+#include <esp_heap_caps.h>     // In-built
+#include <sys/time.h>          // In-built
+#include "wakeArena.h"
+#include "allocCounter.h"
+
+#if ALLOC_COUNT
+#error "SOAK_TEST and ALLOC_COUNT both wrap malloc, build one of them"
+#endif
+
+static const char *TAG = "SOAK";
+
+#define SOAK_HEAP_CAPS (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT) // Fragmentation matters in internal RAM
+
+//################ Live heap blocks ##################################################
+
+// Open addressing table of the live blocks allocated through the wraps, keyed by address. Blocks from
+// heap_caps_malloc() or from before the first wrapped call are not in it, their free() is ignored.
+typedef struct
+{
+    void *ptr; // NULL for an empty slot
+    size_t size;
+} TrackedBlock;
+
+static TrackedBlock tracked[SOAK_TRACKED_BLOCKS];
+static SoakHeapUse heapUse = {};
+static portMUX_TYPE trackMux = portMUX_INITIALIZER_UNLOCKED; // Every task allocates
+
+extern "C" void *__real_malloc(size_t size);
+extern "C" void *__real_calloc(size_t count, size_t size);
+extern "C" void *__real_realloc(void *ptr, size_t size);
+extern "C" void __real_free(void *ptr);
+
+static inline uint32_t slotOf(const void *ptr)
+{
+    return (uint32_t)(((uintptr_t)ptr >> 3) * 2654435761u) % SOAK_TRACKED_BLOCKS;
+}
+
+static void track(void *ptr, size_t size)
+{
+    if (!ptr)
+        return;
+    portENTER_CRITICAL(&trackMux);
+    if (heapUse.blocks < SOAK_TRACKED_BLOCKS - 1) // One slot stays empty to end the probes
+    {
+        uint32_t i = slotOf(ptr);
+        while (tracked[i].ptr)
+            i = (i + 1) % SOAK_TRACKED_BLOCKS;
+        tracked[i] = {ptr, size};
+        heapUse.blocks++;
+        heapUse.bytes += size;
+        if (heapUse.bytes > heapUse.peakBytes)
+            heapUse.peakBytes = heapUse.bytes;
+    }
+    else
+        heapUse.untracked++;
+    portEXIT_CRITICAL(&trackMux);
+}
+
+// Removes ptr with a backward shift of the probe run behind it, so no tombstones are needed.
+// Returns the size it was allocated with, 0 when it was not tracked.
+static size_t untrack(void *ptr)
+{
+    if (!ptr)
+        return 0;
+    size_t size = 0;
+    portENTER_CRITICAL(&trackMux);
+    uint32_t i = slotOf(ptr);
+    while (tracked[i].ptr && tracked[i].ptr != ptr)
+        i = (i + 1) % SOAK_TRACKED_BLOCKS;
+    if (tracked[i].ptr)
+    {
+        size = tracked[i].size;
+        heapUse.blocks--;
+        heapUse.bytes -= size;
+        for (uint32_t j = (i + 1) % SOAK_TRACKED_BLOCKS; tracked[j].ptr; j = (j + 1) % SOAK_TRACKED_BLOCKS)
+        {
+            const uint32_t home = slotOf(tracked[j].ptr);
+            if ((j > i && (home <= i || home > j)) || (j < i && home <= i && home > j))
+            {
+                tracked[i] = tracked[j];
+                i = j;
+            }
+        }
+        tracked[i].ptr = NULL;
+    }
+    portEXIT_CRITICAL(&trackMux);
+    return size;
+}
+
+// The linker routes every malloc, calloc, realloc and free call here with --wrap
+extern "C" void *__wrap_malloc(size_t size)
+{
+    void *ptr = __real_malloc(size);
+    track(ptr, size);
+    return ptr;
+}
+
+extern "C" void *__wrap_calloc(size_t count, size_t size)
+{
+    void *ptr = __real_calloc(count, size);
+    track(ptr, count * size);
+    return ptr;
+}
+
+extern "C" void *__wrap_realloc(void *ptr, size_t size)
+{
+    const size_t oldSize = untrack(ptr); // Before the block can be handed to another task
+    void *moved = __real_realloc(ptr, size);
+    if (moved)
+        track(moved, size);
+    else if (size && oldSize)
+        track(ptr, oldSize); // Failed, the old block is still live
+    return moved;
+}
+
+extern "C" void __wrap_free(void *ptr)
+{
+    untrack(ptr);
+    __real_free(ptr);
+}
+
+SoakHeapUse SoakHeapLive()
+{
+    portENTER_CRITICAL(&trackMux);
+    SoakHeapUse use = heapUse;
+    portEXIT_CRITICAL(&trackMux);
+    return use;
+}
+
+//################ Trend ##################################################
+
+// Running least-squares sums of one metric against the cycle number
+typedef struct
+{
+    double sumY;
+    double sumXY;
+} Trend;
+
+static uint32_t cycle = 0;
+static uint32_t samples = 0; // In the current verdict window
+static uint32_t verdicts = 0;
+static bool failed = false;
+static double sumX = 0, sumXX = 0;
+static Trend freeTrend, largestTrend, liveTrend;
+static size_t firstFree = 0, lowestLargest = 0, firstLive = 0, cyclePeak = 0;
+
+// Moves the system clock on as a sleep would, so hour, day and moon phase changes are exercised at speed
+void SoakAdvanceClock(int minutes)
+{
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    if (now.tv_sec < SOAK_START_TIME)
+        now.tv_sec = SOAK_START_TIME; // Unset clock after boot
+    now.tv_sec += minutes * 60;
+    settimeofday(&now, NULL);
+}
+
+static void addSample(Trend &trend, double x, double y)
+{
+    trend.sumY += y;
+    trend.sumXY += x * y;
+}
+
+static double slope(const Trend &trend)
+{
+    double n = samples;
+    double denominator = n * sumXX - sumX * sumX;
+    return denominator != 0 ? (n * trend.sumXY - sumX * trend.sumY) / denominator : 0;
+}
+
+static void verdict()
+{
+    double freeSlope = slope(freeTrend);
+    double largestSlope = slope(largestTrend);
+    double liveSlope = slope(liveTrend);
+    bool pass = freeSlope > -SOAK_LEAK_LIMIT && largestSlope > -SOAK_LEAK_LIMIT && liveSlope < SOAK_LEAK_LIMIT;
+    const SoakHeapUse live = SoakHeapLive();
+    ESP_LOGI(TAG, "%s after %u cycles: free heap %+.2f B/cycle (first %u), largest block %+.2f B/cycle (lowest %u), live %+.2f B/cycle (first %u, now %u in %u blocks, %u untracked), cycle peak %u, arena high water %u",
+             pass ? "PASS" : "FAIL", (unsigned)cycle, freeSlope, (unsigned)firstFree, largestSlope, (unsigned)lowestLargest,
+             liveSlope, (unsigned)firstLive, (unsigned)live.bytes, (unsigned)live.blocks, (unsigned)live.untracked,
+             (unsigned)cyclePeak, (unsigned)ArenaHighWater());
+    verdicts++;
+    failed = failed || !pass;
+    samples = 0;
+    sumX = sumXX = 0;
+    cyclePeak = 0;
+    freeTrend = largestTrend = liveTrend = Trend();
+}
+
+// Called once per cycle after the arena reset, when only long-lived allocations remain. Free size and largest
+// block are of the same internal pool; a leak into PSRAM shows in the live bytes of the wraps.
+void SoakSample()
+{
+    cycle++;
+    size_t freeBytes = heap_caps_get_free_size(SOAK_HEAP_CAPS);
+    size_t largest = heap_caps_get_largest_free_block(SOAK_HEAP_CAPS);
+    portENTER_CRITICAL(&trackMux);
+    const size_t liveBytes = heapUse.bytes;
+    const size_t peak = heapUse.peakBytes;
+    heapUse.peakBytes = heapUse.bytes; // The next cycle's peak starts from what survived this one
+    portEXIT_CRITICAL(&trackMux);
+    if (cycle <= SOAK_WARMUP)
+        return;
+    if (peak > cyclePeak)
+        cyclePeak = peak;
+    if (samples == 0)
+    {
+        firstFree = freeBytes;
+        lowestLargest = largest;
+        firstLive = liveBytes;
+    }
+    if (largest < lowestLargest)
+        lowestLargest = largest;
+    double x = samples++;
+    sumX += x;
+    sumXX += x * x;
+    addSample(freeTrend, x, freeBytes);
+    addSample(largestTrend, x, largest);
+    addSample(liveTrend, x, liveBytes);
+    if (cycle % 100 == 0)
+        ESP_LOGI(TAG, "Cycle %u: free %u, largest block %u, live %u, cycle peak %u", (unsigned)cycle, (unsigned)freeBytes,
+                 (unsigned)largest, (unsigned)liveBytes, (unsigned)peak);
+    if (samples == SOAK_CYCLES)
+        verdict();
+}
+
+// Verdicts logged so far, and whether any of them failed
+uint32_t SoakVerdicts()
+{
+    return verdicts;
+}
+
+bool SoakFailed()
+{
+    return failed;
+}
+
+#endif // SOAK_TEST
@@ -0,0 +1,55 @@
+#ifndef SOAKTEST_H
+#define SOAKTEST_H
+
+#include <Arduino.h>           // In-built
+
+// On-device soak of the wake loop, enabled with -DSOAK_TEST=1. WeatherUpdateTask runs its whole cycle without
+// Wi-Fi: the weather and forecast responses are decoded from the fixtures in data/soak (upload them with
+// "pio run -t uploadfs"), the clock is moved on by SleepDuration instead of sleeping, and the heap is sampled
+// after every ArenaReset(). Every SOAK_CYCLES cycles a least-squares trend of the free internal heap, of its
+// largest free block and of the live heap bytes is logged with PASS or FAIL, a loss of more than SOAK_LEAK_LIMIT
+// bytes per cycle fails. Live blocks and bytes, and their peak within each cycle, come from wrapping the heap
+// calls: link with -Wl,--wrap=malloc -Wl,--wrap=calloc -Wl,--wrap=realloc -Wl,--wrap=free (not with ALLOC_COUNT).
+// The host build runs the same loop, see host/soak.cpp.
+#ifndef SOAK_TEST
+#define SOAK_TEST 0
+#endif
+#ifndef SOAK_CYCLES
+#define SOAK_CYCLES 2000 // Cycles per verdict
+#endif
+#ifndef SOAK_WARMUP
+#define SOAK_WARMUP 10 // First cycles not in the trend (one-off caches, first font decode, web server)
+#endif
+#ifndef SOAK_LEAK_LIMIT
+#define SOAK_LEAK_LIMIT 2 // Bytes per cycle the free heap or the largest free block may lose
+#endif
+#ifndef SOAK_CYCLE_MS
+#define SOAK_CYCLE_MS 1000 // Pause between cycles in place of the sleep
+#endif
+#ifndef SOAK_TRACKED_BLOCKS
+#define SOAK_TRACKED_BLOCKS 4096 // Live heap blocks the wraps can follow, later ones are counted as untracked
+#endif
+
+#define SOAK_START_TIME 1760000400 // 2025-10-09 09:00 UTC, the "dt" of the weather fixture
+#define SOAK_WEATHER_FIXTURE "/soak/weather.json"
+#define SOAK_FORECAST_FIXTURE "/soak/forecast.json"
+
+#if SOAK_TEST
+
+typedef struct
+{
+    uint32_t blocks;    // Live blocks allocated through the wraps
+    size_t bytes;       // Their requested sizes
+    size_t peakBytes;   // Highest bytes since the last sample
+    uint32_t untracked; // Allocations the block table had no room for
+} SoakHeapUse;
+
+void SoakAdvanceClock(int minutes);
+void SoakSample();
+SoakHeapUse SoakHeapLive();
+uint32_t SoakVerdicts();
+bool SoakFailed();
+
+#endif // SOAK_TEST
+
+#endif // SOAKTEST_H
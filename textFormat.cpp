@@ -0,0 +1,197 @@
+#include "textFormat.h"
+
+typedef struct
+{ // Output cursor, characters past the end are dropped
+    char *out;
+    size_t size;
+    size_t length;
+} FormatSink;
+
+static inline void put(FormatSink &sink, char c)
+{
+    if (sink.length + 1 < sink.size)
+        sink.out[sink.length] = c;
+    sink.length++;
+}
+
+static void putRepeated(FormatSink &sink, char c, int count)
+{
+    while (count-- > 0)
+        put(sink, c);
+}
+
+// Digits of value in the given base, most significant first, returns the digit count
+static int toDigits(char *digits, unsigned long long value, unsigned base, bool upper)
+{
+    const char *const symbols = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    char reversed[24];
+    int count = 0;
+    do
+    {
+        reversed[count++] = symbols[value % base];
+        value /= base;
+    } while (value);
+    for (int i = 0; i < count; i++)
+        digits[i] = reversed[count - 1 - i];
+    return count;
+}
+
+// Pads and writes one converted field: sign or prefix, zeros, then the body
+static void putField(FormatSink &sink, const char *prefix, int zeros, const char *body, int bodyLength, int width, bool left, bool zeroPad)
+{
+    const int prefixLength = strlen(prefix);
+    int padding = width - prefixLength - zeros - bodyLength;
+    if (zeroPad && !left && padding > 0)
+    {
+        zeros += padding;
+        padding = 0;
+    }
+    if (!left)
+        putRepeated(sink, ' ', padding);
+    for (int i = 0; i < prefixLength; i++)
+        put(sink, prefix[i]);
+    putRepeated(sink, '0', zeros);
+    for (int i = 0; i < bodyLength; i++)
+        put(sink, body[i]);
+    if (left)
+        putRepeated(sink, ' ', padding);
+}
+
+int vformatText(char *out, size_t size, const char *format, va_list args)
+{
+    static const unsigned long long powers[] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+    FormatSink sink = {out, size, 0};
+    for (const char *f = format; *f; f++)
+    {
+        if (*f != '%')
+        {
+            put(sink, *f);
+            continue;
+        }
+        bool left = false, plus = false, space = false, zeroPad = false;
+        for (;; f++)
+        {
+            if (f[1] == '-')
+                left = true;
+            else if (f[1] == '+')
+                plus = true;
+            else if (f[1] == ' ')
+                space = true;
+            else if (f[1] == '0')
+                zeroPad = true;
+            else
+                break;
+        }
+        int width = 0, precision = -1;
+        if (f[1] == '*')
+        {
+            width = va_arg(args, int);
+            f++;
+        }
+        else
+            while (isdigit((unsigned char)f[1]))
+                width = width * 10 + (*++f - '0');
+        if (f[1] == '.')
+        {
+            f++;
+            precision = 0;
+            if (f[1] == '*')
+            {
+                precision = va_arg(args, int);
+                f++;
+            }
+            else
+                while (isdigit((unsigned char)f[1]))
+                    precision = precision * 10 + (*++f - '0');
+        }
+        int longs = 0;
+        while (f[1] == 'l' || f[1] == 'h')
+            longs += *++f == 'l';
+        const char conversion = *++f;
+        const char *sign = "";
+        char digits[48];
+        int count;
+        switch (conversion)
+        {
+        case 'd':
+        case 'i':
+        {
+            const long long value = longs >= 2 ? va_arg(args, long long) : longs ? va_arg(args, long) : va_arg(args, int);
+            sign = value < 0 ? "-" : plus ? "+" : space ? " " : "";
+            count = toDigits(digits, value < 0 ? 0ULL - (unsigned long long)value : value, 10, false);
+            putField(sink, sign, max(precision - count, 0), digits, count, width, left, zeroPad && precision < 0);
+            break;
+        }
+        case 'u':
+        case 'x':
+        case 'X':
+        {
+            const unsigned long long value = longs >= 2 ? va_arg(args, unsigned long long) : longs ? va_arg(args, unsigned long) : va_arg(args, unsigned);
+            count = toDigits(digits, value, conversion == 'u' ? 10 : 16, conversion == 'X');
+            putField(sink, "", max(precision - count, 0), digits, count, width, left, zeroPad && precision < 0);
+            break;
+        }
+        case 'f':
+        {
+            const double value = va_arg(args, double);
+            const int decimals = precision < 0 ? 6 : min(precision, 6);
+            if (isnan(value) || isinf(value) || fabs(value) >= 1e12)
+            {
+                sign = value < 0 ? "-" : "";
+                putField(sink, sign, 0, isnan(value) ? "nan" : "inf", 3, width, left, false);
+                break;
+            }
+            const unsigned long long scaled = llround(fabs(value) * powers[decimals]); // Fixed point, rounded once
+            sign = value < 0 && scaled ? "-" : plus ? "+" : space ? " " : "";
+            count = toDigits(digits, scaled / powers[decimals], 10, false);
+            if (decimals)
+            {
+                digits[count++] = '.';
+                char fraction[8];
+                const int fractionCount = toDigits(fraction, scaled % powers[decimals], 10, false);
+                for (int i = fractionCount; i < decimals; i++)
+                    digits[count++] = '0';
+                memcpy(digits + count, fraction, fractionCount);
+                count += fractionCount;
+            }
+            putField(sink, sign, 0, digits, count, width, left, zeroPad);
+            break;
+        }
+        case 'c':
+            digits[0] = (char)va_arg(args, int);
+            putField(sink, "", 0, digits, 1, width, left, false);
+            break;
+        case 's':
+        {
+            const char *text = va_arg(args, const char *);
+            if (!text)
+                text = "(null)";
+            count = precision < 0 ? strlen(text) : strnlen(text, precision);
+            putField(sink, "", 0, text, count, width, left, false);
+            break;
+        }
+        case '%':
+            put(sink, '%');
+            break;
+        default: // Unknown conversion: written as is, the argument list stays where it was
+            put(sink, '%');
+            if (conversion)
+                put(sink, conversion);
+            else
+                f--;
+            break;
+        }
+    }
+    if (size)
+        out[min(sink.length, size - 1)] = 0;
+    return sink.length;
+}
+
+int formatText(char *out, size_t size, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    const int length = vformatText(out, size, format, args);
+    va_end(args);
+    return length;
+}
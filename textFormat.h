@@ -0,0 +1,14 @@
+#ifndef TEXTFORMAT_H
+#define TEXTFORMAT_H
+
+#include <Arduino.h>           // In-built
+#include <stdarg.h>            // In-built
+
+// printf-style formatting into a caller buffer without touching the heap. Floats are rounded to a scaled
+// integer and printed as whole and fractional digits, so newlib's dtoa (which allocates) is never reached.
+// Supported: flags - + 0 space, width and precision (also *), length l ll h, conversions d i u x X c s f %.
+// %f takes at most 6 decimals, rounds halves away from zero and prints no "-0". The output is always terminated, the return value is the length written.
+int formatText(char *out, size_t size, const char *format, ...) __attribute__((format(printf, 3, 4)));
+int vformatText(char *out, size_t size, const char *format, va_list args);
+
+#endif // TEXTFORMAT_H
@@ -0,0 +1,477 @@
+#include "textRenderer.h"
+#include "rasteriser.h"
+#include "displayList.h"
+#if TEXT_BENCHMARK
+#include "esp_timer.h"         // In-built
+#endif
+
+#if CONFIG_IDF_TARGET_ESP32S3
+#include "esp32s3/rom/miniz.h" // In-built, ROM inflate used by the compressed font headers
+#else
+#include "esp32/rom/miniz.h"   // In-built
+#endif
+
+#define FONT_FACES 8     // Distinct fonts with a Latin-1 index, further fonts use the interval search only
+#define NO_GLYPH 0xFFFF
+
+typedef struct
+{ // Direct glyph index of one font for code points 0..255, fonts are told apart by their bitmap
+    const uint8_t *bitmap;
+    uint16_t latin1[256];
+} FontFace;
+
+static FontFace faces[FONT_FACES];
+static volatile int faceCount = 0;
+static const FontFace *lastFace = NULL; // Consecutive lookups nearly always hit the same font
+
+static tinfl_decompressor *inflater = NULL; // ~11KB, allocated once on first compressed glyph
+static uint8_t *glyphScratch = NULL;        // Decoded glyph bitmap, grows to the largest glyph drawn
+static size_t glyphScratchSize = 0;
+
+// Decodes one UTF-8 code point and advances the pointer, 0 at the end of the string
+static uint32_t nextCodePoint(const uint8_t **text)
+{
+    const uint8_t *s = *text;
+    uint32_t cp = *s;
+    if (cp == 0)
+        return 0;
+    int extra = 0;
+    if (cp >= 0xF0)
+    {
+        cp &= 0x07;
+        extra = 3;
+    }
+    else if (cp >= 0xE0)
+    {
+        cp &= 0x0F;
+        extra = 2;
+    }
+    else if (cp >= 0xC0)
+    {
+        cp &= 0x1F;
+        extra = 1;
+    }
+    s++;
+    while (extra-- > 0 && (*s & 0xC0) == 0x80)
+        cp = (cp << 6) | (*s++ & 0x3F);
+    *text = s;
+    return cp;
+}
+
+// Pure ASCII text never enters the multi-byte decoder
+static inline uint32_t nextChar(const uint8_t **text)
+{
+    const uint32_t c = **text;
+    if (c < 0x80)
+    {
+        if (c)
+            (*text)++;
+        return c;
+    }
+    return nextCodePoint(text);
+}
+
+// Finds or builds the Latin-1 index of a font, NULL when all face slots are taken
+static const FontFace *fontFace(const GFXfont *font)
+{
+    const FontFace *face = lastFace;
+    if (face && face->bitmap == font->bitmap)
+        return face;
+    for (int i = 0; i < faceCount; i++)
+    {
+        if (faces[i].bitmap == font->bitmap)
+            return lastFace = &faces[i];
+    }
+    if (faceCount == FONT_FACES)
+        return NULL;
+    FontFace *built = &faces[faceCount];
+    built->bitmap = font->bitmap;
+    for (int cp = 0; cp < 256; cp++)
+        built->latin1[cp] = NO_GLYPH;
+    for (uint32_t i = 0; i < font->interval_count; i++)
+    {
+        const UnicodeInterval &interval = font->intervals[i];
+        for (uint32_t cp = interval.first; cp <= interval.last && cp < 256; cp++)
+            built->latin1[cp] = interval.offset + cp - interval.first;
+    }
+    faceCount = faceCount + 1; // Published once complete, screens are composed under the render mutex
+    return lastFace = built;
+}
+
+#if TEXT_BENCHMARK
+// Drops the index of a font whose bitmap is about to be freed, a later font at the same address gets a new one
+static void forgetFontFace(const uint8_t *bitmap)
+{
+    for (int i = 0; i < faceCount; i++)
+    {
+        if (faces[i].bitmap == bitmap)
+        {
+            faces[i] = faces[faceCount - 1];
+            faceCount = faceCount - 1;
+            lastFace = NULL;
+            return;
+        }
+    }
+}
+#endif
+
+// Glyph of cp through face, the font's index resolved once per string (NULL: interval search only)
+static inline const GFXglyph *faceGlyph(const GFXfont *font, const FontFace *face, uint32_t cp)
+{
+    if (cp < 256 && face)
+        return face->latin1[cp] == NO_GLYPH ? NULL : &font->glyph[face->latin1[cp]];
+    int lo = 0, hi = int(font->interval_count) - 1;
+    while (lo <= hi)
+    {
+        const int mid = (lo + hi) / 2;
+        const UnicodeInterval &interval = font->intervals[mid];
+        if (cp < interval.first)
+            hi = mid - 1;
+        else if (cp > interval.last)
+            lo = mid + 1;
+        else
+            return &font->glyph[interval.offset + cp - interval.first];
+    }
+    return NULL;
+}
+
+// Same result as the driver's get_glyph(): an indexed load below 0x100, binary search over the sorted intervals above
+const GFXglyph *findGlyph(const GFXfont *font, uint32_t cp)
+{
+    return faceGlyph(font, cp < 256 ? fontFace(font) : NULL, cp);
+}
+
+// Box of the inked pixels like the driver's get_text_bounds(): x, y is the baseline start, y1 the top row
+void textBounds(const GFXfont *font, const char *text, int x, int y, int *x1, int *y1, int *w, int *h)
+{
+    const uint8_t *s = (const uint8_t *)text;
+    const FontFace *face = fontFace(font);
+    int minx = 100000, miny = 100000, maxx = -1, maxy = -1;
+    const int startX = x;
+    uint32_t cp;
+    if (*s == 0)
+    {
+        *x1 = x;
+        *y1 = y;
+        *w = *h = 0;
+        return;
+    }
+    while ((cp = nextChar(&s)) != 0)
+    {
+        const GFXglyph *glyph = faceGlyph(font, face, cp);
+        if (!glyph)
+            continue;
+        const int gx = x + glyph->left, gy = y + glyph->top - glyph->height;
+        minx = min(minx, gx);
+        miny = min(miny, gy);
+        maxx = max(maxx, gx + glyph->width);
+        maxy = max(maxy, gy + glyph->height);
+        x += glyph->advance_x;
+    }
+    *x1 = min(startX, minx);
+    *w = maxx - *x1;
+    *y1 = miny;
+    *h = maxy - miny;
+}
+
+// Run-length fonts from tools/fontencode.py keep compressed set and start their bitmap with this tag
+static inline bool isRleFont(const GFXfont *font)
+{
+    return font->compressed && memcmp(font->bitmap, "RLE4", 4) == 0;
+}
+
+// Expands a run-length glyph into 4bpp rows: background runs are skipped over the cleared rows, ink and
+// level runs set nibbles. Runs continue across rows.
+static void rleDecode(const uint8_t *src, const uint8_t *end, uint8_t *dst, int width, int height)
+{
+    const int rowBytes = (width + 1) / 2;
+    uint8_t *row = dst;
+    int x = 0, y = 0;
+    memset(dst, 0, rowBytes * height);
+    while (y < height && src < end)
+    {
+        const uint8_t token = *src++;
+        int run;
+        uint8_t value;
+        if (token < 0x80)
+        {
+            run = (token & 0x3F) + 1;
+            value = token & 0x40 ? 0x0F : 0x00;
+        }
+        else
+        {
+            run = ((token >> 4) & 0x07) + 1;
+            value = token & 0x0F;
+        }
+        if (value == 0)
+        {
+            x += run;
+            while (x >= width)
+            {
+                x -= width;
+                y++;
+                row += rowBytes;
+            }
+            continue;
+        }
+        while (run-- > 0 && y < height)
+        {
+            row[x >> 1] |= x & 1 ? value << 4 : value; // Even pixel in the low nibble
+            if (++x == width)
+            {
+                x = 0;
+                y++;
+                row += rowBytes;
+            }
+        }
+    }
+}
+
+static const uint8_t *glyphBitmap(const GFXfont *font, const GFXglyph *glyph)
+{
+    if (!font->compressed)
+        return font->bitmap + glyph->data_offset;
+    size_t size = ((glyph->width + 1) / 2) * glyph->height;
+    if (size > glyphScratchSize)
+    {
+        uint8_t *grown = (uint8_t *)realloc(glyphScratch, size);
+        if (!grown)
+            return NULL;
+        glyphScratch = grown;
+        glyphScratchSize = size;
+    }
+    if (isRleFont(font))
+    {
+        const uint8_t *src = font->bitmap + glyph->data_offset;
+        rleDecode(src, src + glyph->compressed_size, glyphScratch, glyph->width, glyph->height);
+        return glyphScratch;
+    }
+    if (!inflater)
+    {
+        inflater = (tinfl_decompressor *)malloc(sizeof(tinfl_decompressor));
+        if (!inflater)
+            return NULL;
+    }
+    tinfl_init(inflater);
+    size_t inSize = glyph->compressed_size, outSize = size;
+    tinfl_status status = tinfl_decompress(inflater, font->bitmap + glyph->data_offset, &inSize, glyphScratch, glyphScratch, &outSize,
+                                           TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+    if (status != TINFL_STATUS_DONE)
+    {
+        ESP_LOGW("TEXT", "Glyph inflate failed: %d", status);
+        return NULL;
+    }
+    return glyphScratch;
+}
+
+// Display list recording: stores the font and string with the box covered by the glyphs, advances the cursor
+static void recordText(const GFXfont *font, const char *text, int *cursor_x, int *cursor_y)
+{
+    const uint8_t *s = (const uint8_t *)text;
+    const FontFace *face = fontFace(font);
+    const int x = *cursor_x, y = *cursor_y;
+    int left = EPD_WIDTH, top = EPD_HEIGHT, right = -1, bottom = -1;
+    uint32_t cp;
+    while ((cp = nextChar(&s)) != 0)
+    {
+        if (cp == '\n')
+        {
+            *cursor_x = x;
+            *cursor_y += font->advance_y;
+            continue;
+        }
+        const GFXglyph *glyph = faceGlyph(font, face, cp);
+        if (!glyph)
+            continue;
+        if (glyph->width > 0)
+        {
+            left = min(left, *cursor_x + glyph->left);
+            right = max(right, *cursor_x + glyph->left + glyph->width - 1);
+            top = min(top, *cursor_y - glyph->top);
+            bottom = max(bottom, *cursor_y - glyph->top + glyph->height - 1);
+        }
+        *cursor_x += glyph->advance_x;
+    }
+    if (right < left)
+        return; // Nothing visible, e.g. only spaces
+    const int params[] = {x, y};
+    DisplayListRecord(DL_TEXT, 0x00, 0, left, top, right, bottom, params, 2);
+    DisplayListAppend(font, sizeof(GFXfont));
+    DisplayListAppend(text, strlen(text) + 1);
+}
+
+// Draws text starting at the baseline cursor position and advances the cursor, like write_string()
+void textWrite(const GFXfont *font, const char *text, int *cursor_x, int *cursor_y)
+{
+    const uint8_t *s = (const uint8_t *)text;
+    const int line_start = *cursor_x;
+    uint32_t cp;
+    if (displayListRecording)
+    {
+        recordText(font, text, cursor_x, cursor_y);
+        return;
+    }
+    const FontFace *face = fontFace(font);
+    while ((cp = nextChar(&s)) != 0)
+    {
+        if (cp == '\n')
+        {
+            *cursor_x = line_start;
+            *cursor_y += font->advance_y;
+            continue;
+        }
+        const GFXglyph *glyph = faceGlyph(font, face, cp);
+        if (!glyph)
+            continue;
+        const int top = *cursor_y - glyph->top;
+        if (glyph->width > 0 && rasterRowsVisible(top, glyph->height))
+        { // Glyphs outside the current band are not decompressed at all
+            const uint8_t *bitmap = glyphBitmap(font, glyph);
+            if (bitmap)
+                rasterBlit4(*cursor_x + glyph->left, top, glyph->width, glyph->height, bitmap, true);
+        }
+        *cursor_x += glyph->advance_x;
+    }
+}
+
+#if TEXT_BENCHMARK
+// Glyph lookups through the driver's interval walk and the index, then measured and drawn text, in characters/s
+void BenchmarkText(const GFXfont *font)
+{
+    static const char ascii[] = "Temperatura 21.5 Wilgotnosc 45% Cisnienie 1013 hPa 12:45";
+    static const char latin1[] = "Temperatura (\u00B0C) \u00D3smego \u00B0\u00F3\u00B0 21.5\u00B0";
+    const int rounds = 200;
+    const int length = strlen(ascii);
+    GFXglyph *glyph;
+    int64_t start = esp_timer_get_time();
+    for (int r = 0; r < rounds; r++)
+        for (int i = 0; i < length; i++)
+            get_glyph(font, (uint8_t)ascii[i], &glyph);
+    const int64_t walk = esp_timer_get_time() - start;
+    start = esp_timer_get_time();
+    for (int r = 0; r < rounds; r++)
+        for (int i = 0; i < length; i++)
+            findGlyph(font, (uint8_t)ascii[i]);
+    const int64_t indexed = esp_timer_get_time() - start;
+    ESP_LOGI("TEXT", "Lookups: interval walk %lld chars/s, index %lld chars/s", rounds * length * 1000000LL / max(walk, (int64_t)1),
+             rounds * length * 1000000LL / max(indexed, (int64_t)1));
+    const char *const texts[] = {ascii, latin1};
+    const char *const names[] = {"ASCII", "Latin-1"};
+    for (int t = 0; t < 2; t++)
+    {
+        int chars = 0;
+        for (const uint8_t *s = (const uint8_t *)texts[t]; nextChar(&s);)
+            chars++;
+        start = esp_timer_get_time();
+        for (int r = 0; r < rounds / 10; r++)
+        {
+            int x1, y1, w, h, x = 10, y = 100;
+            textBounds(font, texts[t], x, y, &x1, &y1, &w, &h); // Measure and draw, like drawString()
+            textWrite(font, texts[t], &x, &y);
+        }
+        const int64_t elapsed = esp_timer_get_time() - start;
+        ESP_LOGI("TEXT", "%s drawString: %lld chars/s", names[t], (rounds / 10) * chars * 1000000LL / max(elapsed, (int64_t)1));
+    }
+}
+
+// Token stream of rleDecode() for one glyph, returns its length
+static size_t rleEncode(const uint8_t *bitmap, int width, int height, uint8_t *out)
+{
+    const int rowBytes = (width + 1) / 2;
+    uint8_t *start = out;
+    int run = 0, value = -1;
+    for (int i = 0; i <= width * height; i++)
+    {
+        const int pixel = i < width * height ? (bitmap[(i / width) * rowBytes + (i % width) / 2] >> (4 * (i % width % 2))) & 0x0F : -1;
+        if (pixel == value)
+        {
+            run++;
+            continue;
+        }
+        const int longest = value == 0 || value == 15 ? 64 : 8;
+        while (run > 0)
+        {
+            const int n = min(run, longest);
+            *out++ = value == 0 ? n - 1 : value == 15 ? 0x40 | (n - 1) : 0x80 | (n - 1) << 4 | value;
+            run -= n;
+        }
+        value = pixel;
+        run = 1;
+    }
+    return out - start;
+}
+
+// Copies of a font in all three glyph encodings, then the flash size and drawn digits per second of each.
+// The raw and run-length copies are built in RAM from the font as compiled, so one build compares all of them.
+void BenchmarkFontEncodings(const GFXfont *font)
+{
+    static const char digits[] = "21.5 1013 12:45 -3.8";
+    const UnicodeInterval &lastInterval = font->intervals[font->interval_count - 1];
+    const int glyphCount = lastInterval.offset + lastInterval.last - lastInterval.first + 1;
+    size_t rawSize = 0, pixels = 0;
+    for (int i = 0; i < glyphCount; i++)
+    {
+        rawSize += ((font->glyph[i].width + 1) / 2) * font->glyph[i].height;
+        pixels += font->glyph[i].width * font->glyph[i].height;
+    }
+    GFXfont fonts[3] = {*font, *font, *font}; // As compiled, raw, run-length
+    GFXglyph *glyphs = (GFXglyph *)malloc(2 * glyphCount * sizeof(GFXglyph));
+    uint8_t *raw = (uint8_t *)ps_malloc(rawSize);
+    uint8_t *rle = (uint8_t *)ps_malloc(4 + pixels);
+    if (!glyphs || !raw || !rle)
+    {
+        ESP_LOGW("TEXT", "No memory for the font encoding benchmark");
+        free(glyphs);
+        free(raw);
+        free(rle);
+        return;
+    }
+    size_t rawUsed = 0, rleUsed = 4;
+    memcpy(rle, "RLE4", 4);
+    for (int i = 0; i < glyphCount; i++)
+    {
+        const GFXglyph &glyph = font->glyph[i];
+        const size_t size = ((glyph.width + 1) / 2) * glyph.height;
+        const uint8_t *bitmap = size ? glyphBitmap(font, &glyph) : NULL;
+        glyphs[i] = glyphs[glyphCount + i] = glyph;
+        glyphs[i].data_offset = rawUsed;
+        glyphs[glyphCount + i].data_offset = rleUsed;
+        if (!bitmap)
+        {
+            glyphs[i].compressed_size = glyphs[glyphCount + i].compressed_size = 0;
+            continue;
+        }
+        memcpy(raw + rawUsed, bitmap, size);
+        rawUsed += size;
+        glyphs[glyphCount + i].compressed_size = rleEncode(bitmap, glyph.width, glyph.height, rle + rleUsed);
+        rleUsed += glyphs[glyphCount + i].compressed_size;
+    }
+    fonts[1].bitmap = raw;
+    fonts[1].glyph = glyphs;
+    fonts[1].compressed = false;
+    fonts[2].bitmap = rle;
+    fonts[2].glyph = glyphs + glyphCount;
+    size_t compiledSize = isRleFont(font) ? 4 : 0;
+    for (int i = 0; i < glyphCount; i++)
+        compiledSize += font->compressed ? font->glyph[i].compressed_size : ((font->glyph[i].width + 1) / 2) * font->glyph[i].height;
+    const size_t sizes[] = {compiledSize, rawUsed, rleUsed};
+    const char *const names[] = {font->compressed ? (isRleFont(font) ? "as built (RLE)" : "as built (zlib)") : "as built (raw)", "raw", "RLE"};
+    const int rounds = 20, chars = strlen(digits);
+    for (int f = 0; f < 3; f++)
+    {
+        const int64_t start = esp_timer_get_time();
+        for (int r = 0; r < rounds; r++)
+        {
+            int x = 10, y = 200;
+            textWrite(&fonts[f], digits, &x, &y);
+        }
+        const int64_t elapsed = esp_timer_get_time() - start;
+        ESP_LOGI("TEXT", "%-16s %6u bitmap bytes, %lld chars/s", names[f], (unsigned)sizes[f], rounds * chars * 1000000LL / max(elapsed, (int64_t)1));
+    }
+    forgetFontFace(raw); // The copies' indexes would match whatever is allocated there next
+    forgetFontFace(rle);
+    free(glyphs);
+    free(raw);
+    free(rle);
+}
+#endif
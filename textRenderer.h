@@ -0,0 +1,22 @@
+#ifndef TEXTRENDERER_H
+#define TEXTRENDERER_H
+
+#include <Arduino.h>           // In-built
+#include "epd_driver.h"        // https://github.com/Xinyuan-LilyGO/LilyGo-EPD47
+
+// Glyph renderer drawing through the rasteriser, so text honours its clip and band target.
+// Same output as the driver's write_string(): black text, glyph boxes written on white.
+
+#ifndef TEXT_BENCHMARK
+#define TEXT_BENCHMARK 0 // 1 = log glyph lookups and rendered characters per second before each frame
+#endif
+
+const GFXglyph *findGlyph(const GFXfont *font, uint32_t cp);
+void textBounds(const GFXfont *font, const char *text, int x, int y, int *x1, int *y1, int *w, int *h);
+void textWrite(const GFXfont *font, const char *text, int *cursor_x, int *cursor_y);
+#if TEXT_BENCHMARK
+void BenchmarkText(const GFXfont *font);
+void BenchmarkFontEncodings(const GFXfont *font);
+#endif
+
+#endif // TEXTRENDERER_H
@@ -0,0 +1,284 @@
+#include "timeFormat.h"
+#include "textFormat.h"
+#include "lang.h"
+
+#define SECONDS_PER_DAY 86400
+#define SECONDS_PER_WEEK (7 * SECONDS_PER_DAY)
+#define ZONE_SEARCH_WEEKS 54     // A DST rule changes at least once a year
+#define ZONE_MIN_GAP (28 * SECONDS_PER_DAY) // No zone changes its offset twice within four weeks
+#define ZONE_NEVER INT64_MAX
+
+RTC_DATA_ATTR static uint32_t zoneHash = 0;      // Of the TZ string the cache belongs to, 0 = no cache
+RTC_DATA_ATTR static int64_t zoneFrom = 0;       // zoneOffset applies from here...
+RTC_DATA_ATTR static int64_t zoneChange = 0;     // ...up to the next transition
+RTC_DATA_ATTR static int32_t zoneOffset = 0;
+RTC_DATA_ATTR static int32_t zoneOffsetAfter = 0; // From zoneChange for at least ZONE_MIN_GAP
+
+static const char *const shortWeekdays[7] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+static const char *const shortMonths[12] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+// Days since 1970-01-01 of a proleptic Gregorian date and back, see http://howardhinnant.github.io/date_algorithms.html
+static int32_t daysFromCivil(int32_t y, int32_t m, int32_t d)
+{
+    y -= m <= 2;
+    const int32_t era = (y >= 0 ? y : y - 399) / 400;
+    const int32_t yoe = y - era * 400;
+    const int32_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const int32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+static void civilFromDays(int32_t z, int32_t &y, int32_t &m, int32_t &d)
+{
+    z += 719468;
+    const int32_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const int32_t doe = z - era * 146097;
+    const int32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const int32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const int32_t mp = (5 * doy + 2) / 153;
+    d = doy - (153 * mp + 2) / 5 + 1;
+    m = mp < 10 ? mp + 3 : mp - 9;
+    y = yoe + era * 400 + (m <= 2);
+}
+
+// The slow path, through the TZ rules
+static int32_t offsetAt(int64_t utc)
+{
+    time_t t = (time_t)utc;
+    struct tm local;
+    localtime_r(&t, &local);
+    int64_t localSeconds = (int64_t)daysFromCivil(local.tm_year + 1900, local.tm_mon + 1, local.tm_mday) * SECONDS_PER_DAY +
+                           local.tm_hour * 3600 + local.tm_min * 60 + local.tm_sec;
+    return (int32_t)(localSeconds - utc);
+}
+
+// First second in (lo, hi] whose offset differs from the one at lo, given that hi's does
+static int64_t findChange(int64_t lo, int64_t hi)
+{
+    const int32_t before = offsetAt(lo);
+    while (hi - lo > 1)
+    {
+        int64_t mid = lo + (hi - lo) / 2;
+        if (offsetAt(mid) == before)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return hi;
+}
+
+void TimeZoneSet(const char *tz)
+{
+    uint32_t hash = 2166136261u; // FNV-1a
+    for (const char *c = tz; *c; c++)
+        hash = (hash ^ (uint8_t)*c) * 16777619u;
+    if (hash == 0)
+        hash = 1;
+    if (hash != zoneHash)
+    {
+        zoneHash = hash;
+        zoneFrom = zoneChange = 0; // Empty range, TimeZoneUpdate() rebuilds it
+    }
+}
+
+void TimeZoneUpdate(time_t now)
+{
+    if (now >= zoneFrom && now < zoneChange)
+        return;
+    zoneOffset = offsetAt(now);
+    zoneFrom = (int64_t)now - SECONDS_PER_WEEK;
+    if (offsetAt(zoneFrom) != zoneOffset)
+        zoneFrom = findChange(zoneFrom, now);
+    zoneChange = ZONE_NEVER;
+    zoneOffsetAfter = zoneOffset;
+    for (int64_t t = now; t < (int64_t)now + (int64_t)ZONE_SEARCH_WEEKS * SECONDS_PER_WEEK; t += SECONDS_PER_WEEK)
+    {
+        if (offsetAt(t + SECONDS_PER_WEEK) != zoneOffset)
+        {
+            zoneChange = findChange(t, t + SECONDS_PER_WEEK);
+            zoneOffsetAfter = offsetAt(zoneChange);
+            break;
+        }
+    }
+    ESP_LOGI("TIME", "UTC offset %d s, next change %lld to %d s", (int)zoneOffset, zoneChange == ZONE_NEVER ? -1LL : (long long)zoneChange,
+             (int)zoneOffsetAfter);
+}
+
+int32_t LocalOffset(time_t utc)
+{
+    if (utc >= zoneFrom && utc < zoneChange)
+        return zoneOffset;
+    if (utc >= zoneChange && utc - zoneChange < ZONE_MIN_GAP)
+        return zoneOffsetAfter;
+    return offsetAt(utc); // Outside the cached range, e.g. before the first TimeZoneUpdate()
+}
+
+void LocalTimeFields(time_t utc, struct tm *local)
+{
+    int64_t seconds = (int64_t)utc + LocalOffset(utc);
+    int32_t days = (int32_t)(seconds >= 0 ? seconds / SECONDS_PER_DAY : (seconds - SECONDS_PER_DAY + 1) / SECONDS_PER_DAY);
+    int32_t secondOfDay = (int32_t)(seconds - (int64_t)days * SECONDS_PER_DAY);
+    int32_t y, m, d;
+    civilFromDays(days, y, m, d);
+    local->tm_year = y - 1900;
+    local->tm_mon = m - 1;
+    local->tm_mday = d;
+    local->tm_hour = secondOfDay / 3600;
+    local->tm_min = secondOfDay / 60 % 60;
+    local->tm_sec = secondOfDay % 60;
+    local->tm_wday = (days % 7 + 11) % 7; // 1970-01-01 was a Thursday
+    local->tm_yday = days - daysFromCivil(y, 1, 1);
+    local->tm_isdst = -1; // Unknown, only offsets are cached
+}
+
+// Two digits without snprintf
+static inline char *twoDigits(char *p, int value)
+{
+    p[0] = '0' + value / 10;
+    p[1] = '0' + value % 10;
+    return p + 2;
+}
+
+static inline int twelveHourOf(int hour)
+{
+    return hour % 12 == 0 ? 12 : hour % 12;
+}
+
+int FormatClock(char *out, size_t size, time_t utc, bool twelveHour)
+{
+    if (size < 6)
+        return formatText(out, size, "%s", "");
+    struct tm local;
+    LocalTimeFields(utc, &local);
+    char *p = twoDigits(out, twelveHour ? twelveHourOf(local.tm_hour) : local.tm_hour);
+    *p++ = ':';
+    p = twoDigits(p, local.tm_min);
+    *p = '\0';
+    return p - out;
+}
+
+int FormatClockSeconds(char *out, size_t size, time_t utc, bool twelveHour)
+{
+    if (size < 12)
+        return formatText(out, size, "%s", "");
+    struct tm local;
+    LocalTimeFields(utc, &local);
+    char *p = twoDigits(out, twelveHour ? twelveHourOf(local.tm_hour) : local.tm_hour);
+    *p++ = ':';
+    p = twoDigits(p, local.tm_min);
+    *p++ = ':';
+    p = twoDigits(p, local.tm_sec);
+    if (twelveHour)
+    {
+        *p++ = ' ';
+        *p++ = local.tm_hour < 12 ? 'A' : 'P';
+        *p++ = 'M';
+    }
+    *p = '\0';
+    return p - out;
+}
+
+int FormatDate(char *out, size_t size, time_t utc, DateStyle style)
+{
+    struct tm local;
+    LocalTimeFields(utc, &local);
+    const int year = local.tm_year + 1900;
+    switch (style)
+    {
+    case DATE_DMY:
+    case DATE_MDY:
+    {
+        if (size < 9)
+            return formatText(out, size, "%s", "");
+        char *p = twoDigits(out, style == DATE_DMY ? local.tm_mday : local.tm_mon + 1);
+        *p++ = '/';
+        p = twoDigits(p, style == DATE_DMY ? local.tm_mon + 1 : local.tm_mday);
+        *p++ = '/';
+        p = twoDigits(p, year % 100);
+        *p = '\0';
+        return p - out;
+    }
+    case DATE_LONG:
+        return formatText(out, size, "%s, %02d %s %04d", WeekdayName(local.tm_wday), local.tm_mday, MonthName(local.tm_mon), year);
+    default:
+        return formatText(out, size, "%s %s-%02d-%04d", shortWeekdays[local.tm_wday], shortMonths[local.tm_mon], local.tm_mday, year);
+    }
+}
+
+#if TIME_BENCHMARK
+// Steps through 400 days around now in 37 minute steps (so every hour and minute alignment is hit) plus every
+// second around the cached transition, and compares with the C library of the current TZ. Returns the number of
+// mismatches, the first ones are logged.
+int CheckTimeFormat(time_t now, int *checkedTimes)
+{
+    TimeZoneUpdate(now);
+    char fast[32], slow[32];
+    int checked = 0, mismatches = 0;
+    for (int64_t t = (int64_t)now - 200 * SECONDS_PER_DAY; t < (int64_t)now + 200 * SECONDS_PER_DAY; t += 37 * 60)
+    {
+        time_t utc = (time_t)t;
+        struct tm local;
+        localtime_r(&utc, &local);
+        FormatClockSeconds(fast, sizeof(fast), utc, false);
+        strftime(slow, sizeof(slow), "%H:%M:%S", &local);
+        int bad = strcmp(fast, slow);
+        FormatDate(fast, sizeof(fast), utc, DATE_DMY);
+        strftime(slow, sizeof(slow), "%d/%m/%y", &local);
+        bad |= strcmp(fast, slow);
+        FormatDate(fast, sizeof(fast), utc, DATE_US_SHORT);
+        strftime(slow, sizeof(slow), "%a %b-%d-%Y", &local);
+        bad |= strcmp(fast, slow);
+        if (bad && mismatches++ < 5)
+            ESP_LOGW("TIME", "Mismatch at %lld: %s vs %s", (long long)t, fast, slow);
+        checked++;
+    }
+    if (zoneChange != ZONE_NEVER)
+    {
+        for (int64_t t = zoneChange - 3600; t < zoneChange + 3600; t++)
+        {
+            time_t utc = (time_t)t;
+            struct tm local;
+            localtime_r(&utc, &local);
+            FormatClockSeconds(fast, sizeof(fast), utc, true);
+            strftime(slow, sizeof(slow), "%I:%M:%S %p", &local);
+            if (strcmp(fast, slow) && mismatches++ < 5)
+                ESP_LOGW("TIME", "Mismatch at %lld: %s vs %s", (long long)t, fast, slow);
+            checked++;
+        }
+    }
+    if (checkedTimes)
+        *checkedTimes = checked;
+    return mismatches;
+}
+
+// The check above, then the speed of the formatters against localtime_r/strftime
+void BenchmarkTimeFormat()
+{
+    const time_t now = time(NULL);
+    int checked = 0;
+    const int mismatches = CheckTimeFormat(now, &checked);
+    char fast[32], slow[32];
+
+    const int rounds = 2000;
+    unsigned long start = micros();
+    for (int i = 0; i < rounds; i++)
+    {
+        time_t utc = now + i % 40 * 10800; // The forecast slots
+        struct tm local;
+        localtime_r(&utc, &local);
+        strftime(slow, sizeof(slow), "%H:%M %d/%m/%y", &local);
+    }
+    unsigned long libraryTime = micros() - start;
+    start = micros();
+    for (int i = 0; i < rounds; i++)
+    {
+        time_t utc = now + i % 40 * 10800;
+        int length = FormatClock(fast, sizeof(fast), utc, false);
+        fast[length++] = ' ';
+        FormatDate(fast + length, sizeof(fast) - length, utc, DATE_DMY);
+    }
+    unsigned long cachedTime = micros() - start;
+    ESP_LOGI("TIME", "%d times checked, %d mismatches. localtime+strftime %lu ns, cached %lu ns per time and date", checked,
+             mismatches, libraryTime * 1000 / rounds, cachedTime * 1000 / rounds);
+}
+#endif // TIME_BENCHMARK
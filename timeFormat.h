@@ -0,0 +1,37 @@
+#ifndef TIMEFORMAT_H
+#define TIMEFORMAT_H
+
+#include <Arduino.h>           // In-built
+#include <time.h>              // In-built
+
+// Local time without going through the POSIX TZ rules for every timestamp. TimeZoneUpdate() finds the current
+// UTC offset and the next DST transition with localtime_r() once, the result is kept in RTC memory and only
+// recomputed after that transition or when the TZ string changes. Everything else is integer arithmetic into
+// caller buffers: LocalOffset() picks the cached offset, the formatters split days and seconds by hand.
+#ifndef TIME_BENCHMARK
+#define TIME_BENCHMARK 0 // 1 = check the formatters against localtime_r/strftime across DST changes and log their speed
+#endif
+
+typedef enum
+{
+    DATE_DMY,      // 24/06/17
+    DATE_MDY,      // 06/24/17
+    DATE_LONG,     // Saturday, 24 June 2017 with the names of the selected language
+    DATE_US_SHORT  // Sat Jun-24-2017, like strftime "%a %b-%d-%Y"
+} DateStyle;
+
+void TimeZoneSet(const char *tz);
+void TimeZoneUpdate(time_t now);
+int32_t LocalOffset(time_t utc);
+void LocalTimeFields(time_t utc, struct tm *local);
+
+int FormatClock(char *out, size_t size, time_t utc, bool twelveHour);                // 21:12 or 09:12
+int FormatClockSeconds(char *out, size_t size, time_t utc, bool twelveHour);         // 21:12:05 or 09:12:05 PM
+int FormatDate(char *out, size_t size, time_t utc, DateStyle style);
+
+#if TIME_BENCHMARK
+int CheckTimeFormat(time_t now, int *checkedTimes);
+void BenchmarkTimeFormat();
+#endif
+
+#endif // TIMEFORMAT_H
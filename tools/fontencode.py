@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""Re-encodes font headers from zlib to a glyph encoding that is cheaper to decode.
+
+  raw  4bpp rows as drawn, no decode at all (compressed = 0, the driver's uncompressed format)
+  rle  run-length tokens read by textRenderer.cpp; the bitmap starts with "RLE4", compressed stays 1
+       0b00nnnnnn  n+1 background pixels (0)
+       0b01nnnnnn  n+1 full ink pixels (15)
+       0b1nnnvvvv  n+1 pixels of level v
+       Runs continue across rows, a row holds the glyph width in pixels (the padding nibble is not coded).
+
+opensansNb.h becomes opensansNb_raw.h / opensansNb_rle.h with the same symbol names, --subset encodes
+opensansNb_subset.h instead. -DFONT_ENCODING_24B=FONT_RLE (or _18B, FONT_RAW) makes fonts.cpp include them.
+The report lists the flash size of every encoding, TEXT_BENCHMARK logs the render speed of each on the device.
+
+Usage: python3 tools/fontencode.py {raw,rle,all} [--fonts 18 24] [--subset]
+"""
+import argparse
+import os
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from fontsubset import GLYPH_BYTES, INTERVAL_BYTES, ROOT, build_intervals, parse_header, write_header  # noqa: E402
+
+RLE_MAGIC = b"RLE4"
+
+
+def glyph_pixels(data, width, height):
+    row_bytes = (width + 1) // 2
+    return [(data[y * row_bytes + x // 2] >> (4 * (x % 2))) & 0x0F for y in range(height) for x in range(width)]
+
+
+def rle_encode(pixels):
+    out = bytearray()
+    i = 0
+    while i < len(pixels):
+        value, run = pixels[i], 1
+        while i + run < len(pixels) and pixels[i + run] == value:
+            run += 1
+        i += run
+        longest = 64 if value in (0, 15) else 8
+        while run:
+            n = min(run, longest)
+            out.append((0x40 if value else 0x00) | (n - 1) if value in (0, 15) else 0x80 | (n - 1) << 4 | value)
+            run -= n
+    return bytes(out)
+
+
+def rle_decode(blob, width, height):
+    """Reference decoder, the same loop as textRenderer.cpp, used to check every encoded glyph."""
+    pixels = []
+    for token in blob:
+        if token < 0x80:
+            pixels += [15 if token & 0x40 else 0] * ((token & 0x3F) + 1)
+        else:
+            pixels += [token & 0x0F] * (((token >> 4) & 0x07) + 1)
+    return pixels
+
+
+def encode(header, encoding):
+    name, bitmap, glyphs, fields, _ = parse_header(header)
+    points = sorted(glyphs)
+    compressed = fields[1] != "0"
+    data = []
+    for cp in points:
+        w, h, _, _, _, size, offset = glyphs[cp]
+        blob = bitmap[offset:offset + size] if compressed else bitmap[offset:offset + (w + 1) // 2 * h]
+        raw = zlib.decompress(blob) if compressed else blob
+        if encoding == "raw":
+            data.append(raw if w else b"")
+        else:
+            pixels = glyph_pixels(raw, w, h)
+            blob = rle_encode(pixels)
+            assert rle_decode(blob, w, h) == pixels, "RLE round trip of U+%04X" % cp
+            data.append(blob)
+    fields = list(fields)
+    fields[1] = "0" if encoding == "raw" else "1"
+    glyph_rows = [(cp, glyphs[cp][:5] + [len(blob)]) for cp, blob in zip(points, data)]
+    prefix = RLE_MAGIC if encoding == "rle" else b""
+    size = len(prefix) + sum(len(d) for d in data) + len(points) * GLYPH_BYTES + len(build_intervals(points)) * INTERVAL_BYTES
+    return name, glyph_rows, data, fields, prefix, size
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("encoding", choices=["raw", "rle", "all"])
+    parser.add_argument("--fonts", nargs="+", type=int, default=[18, 24])
+    parser.add_argument("--subset", action="store_true")
+    args = parser.parse_args()
+    for size in args.fonts:
+        stem = "opensans%db%s" % (size, "_subset" if args.subset else "")
+        header = os.path.join(ROOT, stem + ".h")
+        _, bitmap, glyphs, _, interval_count = parse_header(header)
+        sizes = ["zlib %d" % (len(bitmap) + len(glyphs) * GLYPH_BYTES + interval_count * INTERVAL_BYTES)]
+        for encoding in (["raw", "rle"] if args.encoding == "all" else [args.encoding]):
+            name, rows, data, fields, prefix, total = encode(header, encoding)
+            out = os.path.join(ROOT, "%s_%s.h" % (stem, encoding))
+            write_header(out, name, rows, data, fields, "tools/fontencode.py %s from %s.h" % (encoding, stem), prefix)
+            sizes.append("%s %d" % (encoding, total))
+        print("%s: %s bytes" % (stem, ", ".join(sizes)))
+
+
+if __name__ == "__main__":
+    main()
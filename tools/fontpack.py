@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+"""Packs font headers into one binary image for the "fonts" flash partition (partitions.csv).
+
+The firmware maps the partition and uses the glyph tables and bitmaps in place (fontPack.cpp), so fonts can be
+added or exchanged without rebuilding: config.json "display" -> "fonts" picks which packed font replaces which
+compiled-in one, e.g. "OpenSans8B=OpenSans9B,OpenSans24B=OpenSans26B".
+
+Image layout, little endian, every table 4-byte aligned:
+  "FPK1", uint32 font count, then per font: char name[24], uint32 offset, uint32 size
+  per font at its offset: "FNT1", uint32 glyph count, uint32 interval count, uint32 bitmap size,
+    uint8 compressed, uint8 advance_y, int16 ascender, int16 descender, uint16 0,
+    GFXglyph[glyph count] (16 bytes each), UnicodeInterval[interval count] (12 bytes each), bitmap
+
+Usage: python3 tools/fontpack.py [-o fonts.bin] [headers ...]     default: every header in "Font Files"
+Flash: esptool.py --chip esp32s3 write_flash 0xf00000 fonts.bin
+"""
+import argparse
+import glob
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from fontsubset import ROOT, build_intervals, parse_header  # noqa: E402
+
+PARTITION_SIZE = 0x100000  # "fonts" in partitions.csv
+NAME_BYTES = 24
+ENTRY = struct.Struct("<%dsII" % NAME_BYTES)
+FONT = struct.Struct("<4sIIIBBhhH")
+GLYPH = struct.Struct("<BBBxhhHxxI")  # GFXglyph as laid out by the ESP32 compilers
+INTERVAL = struct.Struct("<III")
+
+
+def pad4(data):
+    return data + b"\0" * (-len(data) % 4)
+
+
+def font_name(path, symbol):
+    """OpenSans<size>[B] from the file name, the symbol of a few headers lacks the size."""
+    m = re.fullmatch(r"opensans(\d+)(b?)\.h", os.path.basename(path))
+    return "OpenSans%s%s" % (m.group(1), m.group(2).upper()) if m else symbol
+
+
+def font_blob(path):
+    symbol, bitmap, glyphs, fields, _ = parse_header(path)
+    points = sorted(glyphs)
+    intervals = build_intervals(points)
+    compressed, advance_y, ascender, descender = (int(v) for v in fields[1:5])
+    table = b"".join(GLYPH.pack(w, h, adv, left, top, size, offset)
+                     for w, h, adv, left, top, size, offset in (glyphs[cp] for cp in points))
+    ranges = b"".join(INTERVAL.pack(*interval) for interval in intervals)
+    header = FONT.pack(b"FNT1", len(points), len(intervals), len(bitmap), compressed, advance_y, ascender, descender, 0)
+    return font_name(path, symbol), header + table + ranges + pad4(bitmap)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("headers", nargs="*")
+    parser.add_argument("-o", "--output", default=os.path.join(ROOT, "fonts.bin"))
+    args = parser.parse_args()
+    headers = args.headers or sorted(glob.glob(os.path.join(ROOT, "Font Files", "*.h")))
+    fonts = [font_blob(path) for path in headers]
+    names = [name for name, _ in fonts]
+    if len(set(names)) != len(names):
+        sys.exit("Duplicate font names: %s" % ", ".join(sorted({n for n in names if names.count(n) > 1})))
+    offset = 8 + ENTRY.size * len(fonts)
+    directory, blobs = b"", b""
+    for name, blob in fonts:
+        if len(name) >= NAME_BYTES:
+            sys.exit("Font name too long: %s" % name)
+        directory += ENTRY.pack(name.encode(), offset, len(blob))
+        print("%-14s %7d bytes" % (name, len(blob)))
+        blobs += blob
+        offset += len(blob)
+    image = b"FPK1" + struct.pack("<I", len(fonts)) + directory + blobs
+    print("%d fonts, %d bytes, partition %d bytes" % (len(fonts), len(image), PARTITION_SIZE))
+    if len(image) > PARTITION_SIZE:
+        sys.exit("Image does not fit the fonts partition, pass fewer headers")
+    with open(args.output, "wb") as f:
+        f.write(image)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""Generates subsetted font headers holding only the glyphs the firmware renders.
+
+Code points come from the string literals of lang.cpp and of the screen code (every *.cpp at the repository
+root), plus tools/font_extra_glyphs.txt for text that only arrives at run time (OWM descriptions, city names).
+Each opensansNb.h is read, its zlib compressed glyphs are copied unchanged, and opensansNb_subset.h is written
+with the same symbol names; -DFONT_SUBSET=1 makes fonts.cpp include the subsets instead.
+
+Glyphs missing from a header (Latin Extended-A for Polish: ą ć ę ł ń ś ź ż) are rendered from a TrueType file
+with --ttf, the same way the driver's fontconvert.py does (150 dpi, 4 bpp, zlib); this needs freetype-py.
+Without --ttf they are reported and left out.
+
+Usage: python3 tools/fontsubset.py [--ttf OpenSans-Bold.ttf] [--fonts 8 10 12 18 24] [--check]
+       --check only prints the report, no header is written.
+"""
+import argparse
+import glob
+import os
+import re
+import sys
+import zlib
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+EXTRA = os.path.join(os.path.dirname(os.path.abspath(__file__)), "font_extra_glyphs.txt")
+GLYPH_BYTES = 16    # sizeof(GFXglyph) on the ESP32
+INTERVAL_BYTES = 12  # sizeof(UnicodeInterval)
+DPI = 150            # fontconvert.py resolution
+
+
+def literal_code_points(path):
+    """Code points of all C string literals in a source file, escapes resolved."""
+    with open(path, encoding="utf-8") as f:
+        source = re.sub(r"//[^\n]*|/\*.*?\*/", "", f.read(), flags=re.S)
+    points = set()
+    for literal in re.findall(r'"((?:[^"\\\n]|\\.)*)"', source):
+        text = re.sub(r"\\(.)", lambda m: {"n": "\n", "t": "\t", "0": ""}.get(m.group(1), m.group(1)), literal)
+        points.update(ord(c) for c in text if c >= " ")
+    return points
+
+
+def extra_code_points(path):
+    """Parses the extra glyph list: '<font or *>: items', items are characters or U+XXXX[-U+YYYY] ranges."""
+    extras = {}
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.split(" #", 1)[0].rstrip("\n")
+            if not line.strip() or line.startswith("#"):
+                continue
+            font, items = line.split(":", 1)
+            points = extras.setdefault(font.strip(), set())
+            for item in items.split():
+                m = re.fullmatch(r"U\+([0-9A-Fa-f]+)(?:-U\+([0-9A-Fa-f]+))?", item)
+                if m:
+                    first = int(m.group(1), 16)
+                    points.update(range(first, int(m.group(2) or m.group(1), 16) + 1))
+                else:
+                    points.update(ord(c) for c in item)
+    return extras
+
+
+def parse_header(path):
+    """Returns (name, bitmap bytes, glyphs {code point: [w, h, adv, left, top, size, offset]}, font fields)."""
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    name = re.search(r"const GFXfont (\w+) =", text).group(1)
+    bitmap_text = re.search(r"Bitmaps\[\d*\] = \{(.*?)\};", text, re.S).group(1)
+    bitmap = bytes(int(b, 16) for b in re.findall(r"0x([0-9A-Fa-f]{2})", bitmap_text))
+    glyph_text = re.search(r"Glyphs\[\] = \{(.*?)\n\};", text, re.S).group(1)
+    rows = [[int(v) for v in m.split(",")] for m in re.findall(r"\{ *(-?\d+(?:, *-?\d+){6}) *\}", glyph_text)]
+    intervals = [(int(a, 16), int(b, 16), int(c, 16)) for a, b, c in
+                 re.findall(r"\{ *0x([0-9A-Fa-f]+), *0x([0-9A-Fa-f]+), *0x([0-9A-Fa-f]+) *\}", text)]
+    glyphs = {}
+    for first, last, offset in intervals:
+        for cp in range(first, last + 1):
+            glyphs[cp] = rows[offset + cp - first]
+    fields = re.search(r"const GFXfont \w+ = \{(.*?)\};", text, re.S).group(1).split(",")
+    fields = [v.strip() for v in fields if v.strip()][3:]  # interval count, compressed, advance_y, ascender, descender
+    return name, bitmap, glyphs, fields, len(intervals)
+
+
+def render_glyphs(ttf, size, points):
+    """Renders code points like fontconvert.py: {cp: (glyph fields without offset, zlib data)}."""
+    import freetype
+    face = freetype.Face(ttf)
+    face.set_char_size(size << 6, size << 6, DPI, DPI)
+    rendered = {}
+    for cp in sorted(points):
+        if face.get_char_index(cp) == 0:
+            continue
+        face.load_char(chr(cp))
+        bitmap = face.glyph.bitmap
+        packed = bytearray()
+        for y in range(bitmap.rows):
+            for x in range(0, bitmap.width, 2):
+                low = bitmap.buffer[y * bitmap.pitch + x] >> 4
+                high = bitmap.buffer[y * bitmap.pitch + x + 1] >> 4 if x + 1 < bitmap.width else 0
+                packed.append(low | (high << 4))
+        data = zlib.compress(bytes(packed))
+        rendered[cp] = ([bitmap.width, bitmap.rows, face.glyph.advance.x >> 6, face.glyph.bitmap_left,
+                         face.glyph.bitmap_top, len(data)], data)
+    return rendered
+
+
+def char_comment(cp):
+    c = chr(cp)
+    return "'\\\\'" if c == "\\" else c
+
+
+def build_intervals(points):
+    """[first, last, glyph index] for every run of consecutive code points."""
+    intervals = []
+    for index, cp in enumerate(points):
+        if intervals and intervals[-1][1] == cp - 1:
+            intervals[-1][1] = cp
+        else:
+            intervals.append([cp, cp, index])
+    return intervals
+
+
+def table_bytes(data, glyph_count, interval_count):
+    return sum(len(d) for d in data) + glyph_count * GLYPH_BYTES + interval_count * INTERVAL_BYTES
+
+
+def write_header(path, name, glyphs, data, fields, source=None, prefix=b""):
+    """glyphs: sorted [(cp, [w, h, adv, left, top, size])], data: matching glyph blobs, prefix: bytes before the first."""
+    intervals = build_intervals([cp for cp, _ in glyphs])
+    bitmap = prefix + b"".join(data)
+    source = source or "tools/fontsubset.py from %s" % os.path.basename(path).replace("_subset", "")
+    lines = ["#pragma once", "// Generated by %s, do not edit" % source,
+             '#include "epd_driver.h"', "const uint8_t %sBitmaps[%d] = {" % (name, len(bitmap))]
+    for i in range(0, len(bitmap), 16):
+        lines.append("    " + " ".join("0x%02X," % b for b in bitmap[i:i + 16]))
+    lines += ["};", "const GFXglyph %sGlyphs[] = {" % name]
+    offset = len(prefix)
+    for (cp, g), blob in zip(glyphs, data):
+        lines.append("    { %d, %d, %d, %d, %d, %d, %d }, // %s" % (g[0], g[1], g[2], g[3], g[4], len(blob), offset, char_comment(cp)))
+        offset += len(blob)
+    lines += ["};", "const UnicodeInterval %sIntervals[] = {" % name]
+    lines += ["    { 0x%X, 0x%X, 0x%X }," % tuple(i) for i in intervals]
+    lines += ["};", "const GFXfont %s = {" % name, "    (uint8_t*)%sBitmaps," % name, "    (GFXglyph*)%sGlyphs," % name,
+              "    (UnicodeInterval*)%sIntervals," % name, "    %d," % len(intervals)]
+    lines += ["    %s," % v for v in fields[1:]] + ["};", ""]
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--ttf")
+    parser.add_argument("--fonts", nargs="+", type=int, default=[8, 10, 12, 18, 24])
+    parser.add_argument("--extra", default=EXTRA)
+    parser.add_argument("--check", action="store_true")
+    args = parser.parse_args()
+
+    used = set()
+    for source in glob.glob(os.path.join(ROOT, "*.cpp")):
+        used |= literal_code_points(source)
+    extras = extra_code_points(args.extra)
+    total_saved = 0
+    for size in args.fonts:
+        header = os.path.join(ROOT, "opensans%db.h" % size)
+        name, bitmap, glyphs, fields, interval_count = parse_header(header)
+        wanted = used | extras.get("*", set()) | extras.get("opensans%db" % size, set())
+        kept = sorted(cp for cp in wanted if cp in glyphs)
+        subset = [(cp, glyphs[cp][:6]) for cp in kept]
+        data = [bitmap[glyphs[cp][6]:glyphs[cp][6] + glyphs[cp][5]] for cp in kept]
+        missing = sorted(cp for cp in wanted if cp not in glyphs)
+        if missing and args.ttf:
+            rendered = render_glyphs(args.ttf, size, missing)
+            merged = dict(zip(kept, zip([g for _, g in subset], data)))
+            merged.update({cp: (g, blob) for cp, (g, blob) in rendered.items()})
+            subset = [(cp, merged[cp][0]) for cp in sorted(merged)]
+            data = [merged[cp][1] for cp in sorted(merged)]
+            missing = [cp for cp in missing if cp not in rendered]
+        original = len(bitmap) + len(glyphs) * GLYPH_BYTES + interval_count * INTERVAL_BYTES
+        intervals = len(build_intervals([cp for cp, _ in subset]))
+        size_bytes = table_bytes(data, len(subset), intervals)
+        if not args.check:
+            write_header(header.replace(".h", "_subset.h"), name, subset, data, fields)
+        total_saved += original - size_bytes
+        print("%s: %d -> %d glyphs, %d intervals, %d -> %d bytes, %d saved" %
+              (name, len(glyphs), len(subset), intervals, original, size_bytes, original - size_bytes))
+        if missing:
+            print("    missing (use --ttf): %s" % "".join(chr(cp) for cp in missing))
+    print("total saved: %d bytes" % total_saved)
+
+
+if __name__ == "__main__":
+    main()
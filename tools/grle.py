@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+"""Converts an image to GRLE, the PackBits coded gray format drawn by DrawGrayImage() (grayImage.h).
+
+Layout: b"GRLE", width and height as little endian uint16, then every row PackBits coded on its own.
+Binary PGM (P5) is read directly; other formats (PNG, JPEG, ...) need Pillow and are converted to 8-bit gray.
+Dithering to the panel's 16 levels happens on the device, the file keeps full 8-bit gray.
+
+Usage: python3 tools/grle.py INPUT OUTPUT.grle
+"""
+import struct
+import sys
+
+
+def read_gray(path):
+    """Returns (width, height, pixels) with one byte per pixel."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:2] == b"P5":
+        sys.path.insert(0, __file__.rsplit("/", 1)[0] if "/" in __file__ else ".")
+        from snapshot_check import read_pgm
+        width, height, _, pixels = read_pgm(data)
+        return width, height, pixels
+    from PIL import Image  # Only needed for formats other than PGM
+    image = Image.open(path).convert("L")
+    return image.width, image.height, image.tobytes()
+
+
+def packbits(row):
+    """Same coding as PackBitsEncode(): repeats of 3 or more become runs, the rest literals of up to 128 bytes."""
+    out, i, n = bytearray(), 0, len(row)
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and row[i + run] == row[i]:
+            run += 1
+        if run >= 3:
+            out += bytes(((1 - run) & 0xFF, row[i]))
+            i += run
+            continue
+        literal = 0
+        while i + literal < n and literal < 128:
+            if i + literal + 2 < n and row[i + literal] == row[i + literal + 1] == row[i + literal + 2]:
+                break
+            literal += 1
+        out.append(literal - 1)
+        out += row[i:i + literal]
+        i += literal
+    return out
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    width, height, pixels = read_gray(sys.argv[1])
+    if width > 960:
+        sys.exit("images wider than the panel (960) are not drawn")
+    out = bytearray(b"GRLE" + struct.pack("<HH", width, height))
+    for y in range(height):
+        out += packbits(pixels[y * width:(y + 1) * width])
+    with open(sys.argv[2], "wb") as f:
+        f.write(out)
+    print("%dx%d: %d bytes, %.1f%% of raw gray" % (width, height, len(out), 100.0 * len(out) / (width * height)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+"""Generates moon_sprites.h: the lit part of the moon for MOON_SPRITE_PHASES quantised phases.
+
+Replays the geometry of the former DrawMoon() (diameter 75, 90 scan lines, phase 0..1 from
+NormalizedMoonPhase()) and stores, per phase and per row, the lit span as offsets from the
+moon's top-left drawing position. The southern hemisphere uses phase (PHASES - i) % PHASES.
+
+Usage: python3 tools/moon_sprites.py > moon_sprites.h
+"""
+import math
+
+PHASES = 32
+DIAMETER = 75
+LINES = 90
+
+
+def sprite(phase):
+    rows = {}
+    for ypos in range(0, LINES // 2 + 1):
+        xpos = math.sqrt(LINES // 2 * LINES // 2 - ypos * ypos)
+        rpos = 2 * xpos
+        if phase < 0.5:
+            x1, x2 = -xpos, rpos - 2 * phase * rpos - xpos
+        else:
+            x1, x2 = xpos, xpos - 2 * phase * rpos + rpos
+        px1 = math.floor((x1 + LINES) / LINES * DIAMETER)
+        px2 = math.floor((x2 + LINES) / LINES * DIAMETER)
+        for row in (math.floor((LINES - ypos) / LINES * DIAMETER), math.floor((ypos + LINES) / LINES * DIAMETER)):
+            lo, hi = min(px1, px2), max(px1, px2)
+            if row in rows:
+                # Two scan lines can land on one row; keep their hull (at most a 1px rim gap at half phase)
+                olo, ohi = rows[row]
+                lo, hi = min(lo, olo), max(hi, ohi)
+            rows[row] = (lo, hi)
+    return rows
+
+
+def main():
+    sprites = [sprite(i / PHASES) for i in range(PHASES)]
+    first = min(min(s) for s in sprites)
+    last = max(max(s) for s in sprites)
+    print("#pragma once")
+    print("// Generated by tools/moon_sprites.py, do not edit")
+    print("#include <stdint.h>")
+    print()
+    print("#define MOON_SPRITE_PHASES %d" % PHASES)
+    print("#define MOON_SPRITE_ROW0   %d // First row, relative to the DrawMoon() y position" % first)
+    print("#define MOON_SPRITE_ROWS   %d" % (last - first + 1))
+    print()
+    print("// Lit span {x0, x1} per row, relative to the DrawMoon() x position, {0xFF, 0x00} when the row is dark")
+    print("const uint8_t MoonSpriteSpans[MOON_SPRITE_PHASES][MOON_SPRITE_ROWS][2] = {")
+    for i, rows in enumerate(sprites):
+        cells = []
+        for row in range(first, last + 1):
+            lo, hi = rows.get(row, (0xFF, 0x00))
+            cells.append("{%d, %d}" % (lo, hi))
+        print("    { // Phase %d/%d" % (i, PHASES))
+        for j in range(0, len(cells), 12):
+            print("        " + ", ".join(cells[j:j + 12]) + ",")
+        print("    },")
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
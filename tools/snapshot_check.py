@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""Fetches PGM snapshots of every screen from a running display and compares them with golden images.
+
+The device renders each screen from its current data into a spare buffer (GET /snapshot?screen=N),
+so the panel is not touched. Snapshots are written to OUT_DIR; a screen fails when it differs from
+GOLDEN_DIR/screenN.pgm, and the changed pixel count and bounding box are printed with the render time.
+HOST is the setup access point (192.168.4.1), or the station IP of a -DWEB_DEBUG_SERVER=1 build.
+
+The device renders its live data, so its golden images are kept apart from tools/golden: those are the
+host renders of the data/soak fixtures, checked by ctest in the host build (see host/CMakeLists.txt).
+
+Usage: python3 tools/snapshot_check.py HOST [--screens 3] [--golden device-golden] [--out snapshots] [--update]
+       --update copies the fetched snapshots over the golden images.
+"""
+import argparse
+import os
+import shutil
+import sys
+import urllib.request
+
+
+def read_pgm(data):
+    """Returns (width, height, comments, pixels) of a binary 8-bit PGM."""
+    fields, comments, pos = [], [], 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            end = data.index(b"\n", pos)
+            comments.append(data[pos + 1:end].decode().strip())
+            pos = end + 1
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    if fields[0] != b"P5" or int(fields[3]) != 255:
+        raise ValueError("not an 8-bit binary PGM")
+    width, height = int(fields[1]), int(fields[2])
+    pos += 1  # Single whitespace after maxval
+    return width, height, comments, data[pos:pos + width * height]
+
+
+def compare(golden, snapshot):
+    """Returns (changed pixels, (x0, y0, x1, y1) or None)."""
+    gw, gh, _, gpix = golden
+    sw, sh, _, spix = snapshot
+    if (gw, gh) != (sw, sh):
+        return gw * gh, (0, 0, sw - 1, sh - 1)
+    changed, box = 0, None
+    for y in range(sh):
+        row = y * sw
+        if gpix[row:row + sw] == spix[row:row + sw]:
+            continue
+        for x in range(sw):
+            if gpix[row + x] != spix[row + x]:
+                changed += 1
+                box = (x, y, x, y) if box is None else (min(box[0], x), box[1], max(box[2], x), y)
+    return changed, box
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("host")
+    parser.add_argument("--screens", type=int, default=3)
+    parser.add_argument("--golden", default="device-golden")
+    parser.add_argument("--out", default="snapshots")
+    parser.add_argument("--update", action="store_true")
+    args = parser.parse_args()
+
+    os.makedirs(args.out, exist_ok=True)
+    failures = 0
+    for screen in range(args.screens):
+        data = urllib.request.urlopen("http://%s/snapshot?screen=%d" % (args.host, screen), timeout=30).read()
+        path = os.path.join(args.out, "screen%d.pgm" % screen)
+        with open(path, "wb") as f:
+            f.write(data)
+        snapshot = read_pgm(data)
+        timing = next((c for c in snapshot[2] if "rendered" in c), "")
+        golden_path = os.path.join(args.golden, "screen%d.pgm" % screen)
+        if args.update:
+            os.makedirs(args.golden, exist_ok=True)
+            shutil.copyfile(path, golden_path)
+            print("screen %d: golden updated (%s)" % (screen, timing))
+            continue
+        if not os.path.exists(golden_path):
+            print("screen %d: no golden image (%s)" % (screen, timing))
+            failures += 1
+            continue
+        with open(golden_path, "rb") as f:
+            changed, box = compare(read_pgm(f.read()), snapshot)
+        if changed:
+            failures += 1
+            print("screen %d: %d pixels differ in %s (%s)" % (screen, changed, box, timing))
+        else:
+            print("screen %d: matches (%s)" % (screen, timing))
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == "__main__":
+    main()
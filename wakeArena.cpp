@@ -0,0 +1,112 @@
+#include "wakeArena.h"
+#include <esp_heap_caps.h>     // In-built
+
+static const char *TAG = "ARENA";
+
+#define ARENA_ALIGN 8
+#define ARENA_HEADER ARENA_ALIGN // Each block is preceded by its size, needed by reallocate()
+
+static uint8_t *arena = NULL;
+static size_t arenaTop = 0;
+static size_t arenaHighWater = 0;
+static int liveBlocks = 0;     // Arena blocks not yet released through the allocator
+static bool arenaTried = false;
+
+static bool arenaBegin()
+{
+#if WAKE_ARENA
+    if (!arena && !arenaTried)
+    {
+        arenaTried = true;
+        arena = (uint8_t *)heap_caps_malloc(WAKE_ARENA_SIZE, MALLOC_CAP_SPIRAM); // Kept for the whole uptime
+        if (!arena)
+            ESP_LOGW(TAG, "No PSRAM for the %u byte arena, per-wake data uses the heap", (unsigned)WAKE_ARENA_SIZE);
+    }
+#endif
+    return arena != NULL;
+}
+
+void *ArenaAlloc(size_t size)
+{
+    if (!arenaBegin())
+        return NULL;
+    size_t need = ARENA_HEADER + ((size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1));
+    if (need > WAKE_ARENA_SIZE - arenaTop)
+        return NULL;
+    uint8_t *block = arena + arenaTop;
+    *(size_t *)block = size;
+    arenaTop += need;
+    if (arenaTop > arenaHighWater)
+        arenaHighWater = arenaTop;
+    return block + ARENA_HEADER;
+}
+
+bool ArenaOwns(const void *ptr)
+{
+    return arena && (const uint8_t *)ptr >= arena && (const uint8_t *)ptr < arena + WAKE_ARENA_SIZE;
+}
+
+void ArenaReset()
+{
+    if (liveBlocks)
+        ESP_LOGW(TAG, "Reset with %d block(s) still in use", liveBlocks);
+    ESP_LOGI(TAG, "Reset, %u of %u bytes used this wake", (unsigned)arenaTop, (unsigned)WAKE_ARENA_SIZE);
+    arenaTop = 0;
+    liveBlocks = 0;
+}
+
+size_t ArenaUsed()
+{
+    return arenaTop;
+}
+
+size_t ArenaHighWater()
+{
+    return arenaHighWater;
+}
+
+// Fragmentation = 1 - largest free block / total free, 0% means all free memory is one block
+void LogHeapFragmentation(const char *when)
+{
+    size_t freeBytes = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    size_t minimum = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    unsigned fragmentation = freeBytes ? (unsigned)(100 - (uint64_t)largest * 100 / freeBytes) : 0;
+    ESP_LOGI(TAG, "%s: heap free %u, largest block %u, fragmentation %u%%, minimum free %u, arena high water %u",
+             when, (unsigned)freeBytes, (unsigned)largest, fragmentation, (unsigned)minimum, (unsigned)arenaHighWater);
+}
+
+void *ArenaAllocator::allocate(size_t size)
+{
+    void *ptr = ArenaAlloc(size);
+    if (ptr)
+    {
+        liveBlocks++;
+        return ptr;
+    }
+    return malloc(size);
+}
+
+void ArenaAllocator::deallocate(void *ptr)
+{
+    if (ArenaOwns(ptr))
+        liveBlocks--; // The memory itself comes back with ArenaReset()
+    else
+        free(ptr);
+}
+
+void *ArenaAllocator::reallocate(void *ptr, size_t newSize)
+{
+    if (!ArenaOwns(ptr))
+        return realloc(ptr, newSize);
+    size_t oldSize = *(size_t *)((uint8_t *)ptr - ARENA_HEADER);
+    if (newSize <= oldSize)
+        return ptr; // ArduinoJson only shrinks, keep the block
+    void *grown = allocate(newSize);
+    if (grown)
+    {
+        memcpy(grown, ptr, oldSize);
+        deallocate(ptr);
+    }
+    return grown;
+}
@@ -0,0 +1,33 @@
+#ifndef WAKEARENA_H
+#define WAKEARENA_H
+
+#include <Arduino.h>           // In-built
+
+// Per-wake bump allocator in PSRAM for data that lives for one wake cycle only: the JSON document pools, the
+// request URIs and other formatting scratch. Nothing is freed on its own, InitiateSleep() drops everything in one
+// step with ArenaReset(), so the regular heap no longer sees the 64 KB allocate/free pattern on every cycle and
+// stays unfragmented over weeks of light sleep. When the arena is full (or there is no PSRAM) ArenaAllocator
+// falls back to the heap, the old behaviour.
+#ifndef WAKE_ARENA
+#define WAKE_ARENA 1 // 0 = per-wake data is allocated from the heap as before
+#endif
+#ifndef WAKE_ARENA_SIZE
+#define WAKE_ARENA_SIZE (160 * 1024) // Two 64 KB JSON documents plus scratch
+#endif
+
+void *ArenaAlloc(size_t size);
+bool ArenaOwns(const void *ptr);
+void ArenaReset();
+size_t ArenaUsed();
+size_t ArenaHighWater();
+void LogHeapFragmentation(const char *when);
+
+// Allocator for ArduinoJson's BasicJsonDocument<>, blocks that do not fit in the arena come from the heap
+struct ArenaAllocator
+{
+    void *allocate(size_t size);
+    void deallocate(void *ptr);
+    void *reallocate(void *ptr, size_t newSize);
+};
+
+#endif // WAKEARENA_H
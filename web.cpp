@@ -9,8 +9,12 @@
 
 #include "FS.h"
 #include "SPIFFS.h"
+#include "LilyGo-EPD-4-7-OWM-Weather-Display.h"
+#include "renderProfiler.h"
+#include "frameSnapshot.h"
 
 static WebServer server(80);
+static bool serverStarted = false; // By setupWEB() or setupDebugWEB(), which keep serving until the restart
 
 void storeConfig();
 
@@ -47,6 +51,77 @@ void handleConfig()
 }
 
 
+// One framebuffer row as 8-bit PGM pixels (4bpp values scaled by 17)
+static void sendPgmRow(int y, const uint8_t *src, void *context)
+{
+    uint8_t row[EPD_WIDTH];
+    for (int x = 0; x < EPD_WIDTH / 2; x++)
+    {
+        row[2 * x] = (src[x] & 0x0F) * 17;   // Even pixel in the low nibble
+        row[2 * x + 1] = (src[x] >> 4) * 17; // Odd pixel in the high nibble
+    }
+    server.sendContent((const char *)row, EPD_WIDTH);
+}
+
+// Streams a screen rendered from the current data as an 8-bit binary PGM (4bpp values scaled by 17),
+// e.g. /snapshot?screen=0. The render time goes into a PGM comment line.
+void handleSnapshot()
+{
+    int screen = server.hasArg("screen") ? server.arg("screen").toInt() : 0;
+    if (screen < 0 || screen >= ScreenCount())
+    {
+        server.send(400, "text/plain", "Invalid screen");
+        return;
+    }
+    uint8_t *frame = (uint8_t *)ps_malloc(EPD_WIDTH * EPD_HEIGHT / 2);
+    if (!frame)
+    {
+        server.send(503, "text/plain", "No memory for snapshot");
+        return;
+    }
+    unsigned long renderTime = RenderScreenSnapshot(screen, frame);
+    char header[64];
+    int headerLength = snprintf(header, sizeof(header), "P5\n# screen %d rendered in %lu us\n%d %d\n255\n", screen, renderTime, EPD_WIDTH, EPD_HEIGHT);
+    server.setContentLength(headerLength + EPD_WIDTH * EPD_HEIGHT);
+    server.send(200, "image/x-portable-graymap", "");
+    server.sendContent(header, headerLength);
+    for (int y = 0; y < EPD_HEIGHT; y++)
+        sendPgmRow(y, frame + y * (EPD_WIDTH / 2), NULL);
+    free(frame);
+    ESP_LOGI("WEB", "Snapshot of screen %d sent, rendered in %lu us", screen, renderTime);
+}
+
+// The last frame pushed to the panel, from the compressed flash snapshot: /framesnapshot as a PGM decoded row by
+// row, /framesnapshot?raw=1 as the stored PackBits file
+void handleFrameSnapshot()
+{
+    xSemaphoreTake(panelMutex, portMAX_DELAY); // On the station server a wake may be rewriting the file
+    if (!SPIFFS.exists(FRAME_SNAPSHOT_PATH))
+    {
+        xSemaphoreGive(panelMutex);
+        server.send(404, "text/plain", "No frame snapshot");
+        return;
+    }
+    if (server.hasArg("raw"))
+    {
+        File file = SPIFFS.open(FRAME_SNAPSHOT_PATH, FILE_READ);
+        server.streamFile(file, "application/octet-stream");
+        file.close();
+        xSemaphoreGive(panelMutex);
+        return;
+    }
+    char header[64];
+    int headerLength = snprintf(header, sizeof(header), "P5\n# frame snapshot\n%d %d\n255\n", EPD_WIDTH, EPD_HEIGHT);
+    server.setContentLength(headerLength + EPD_WIDTH * EPD_HEIGHT);
+    server.send(200, "image/x-portable-graymap", "");
+    server.sendContent(header, headerLength);
+    const unsigned long start = micros();
+    if (!ReadFrameSnapshot(NULL, sendPgmRow, NULL, NULL))
+        ESP_LOGE("WEB", "Frame snapshot ended early");
+    xSemaphoreGive(panelMutex);
+    ESP_LOGI("WEB", "Frame snapshot sent in %lu us", micros() - start);
+}
+
 void handleNotFound()
 {
     String message = "File Not Found\n\n";
@@ -89,6 +164,18 @@ void webTask(void *args)
 }
 
 
+// Read-only diagnostics, on the setup access point and on the station server alike
+static void registerDebugPages()
+{
+    server.on("/snapshot", HTTP_GET, handleSnapshot);           // Any screen rendered from the current data
+    server.on("/framesnapshot", HTTP_GET, handleFrameSnapshot); // The frame the panel shows
+#if RENDER_PROFILE
+    server.on("/profile", HTTP_GET, []() {
+        server.send(200, "text/plain", ProfileTable());
+    });
+#endif
+}
+
 void setupWEB(void)
 {
     Serial.begin(115200);
@@ -103,6 +190,7 @@ void setupWEB(void)
         file.close();
         return;
     });
+    registerDebugPages();
     server.on("/restart", HTTP_GET, []() {
         server.send(200);
         delay(1000);
@@ -113,6 +201,7 @@ void setupWEB(void)
     server.onNotFound(handleNotFound);
 
     server.begin();
+    serverStarted = true;
     Serial.println("HTTP server started");
 
     TaskHandle_t t1;
@@ -120,6 +209,23 @@ void setupWEB(void)
 }
 
 
+// Diagnostics on the IP the router gave, started on the first wake with a connection and kept for the
+// following ones. The settings pages stay on the setup access point.
+void setupDebugWEB(void)
+{
+    if (serverStarted)
+        return; // The setup server, still listening, serves the same pages on the station IP
+    registerDebugPages();
+    server.onNotFound(handleNotFound);
+    server.begin();
+    serverStarted = true;
+    Serial.println("Debug HTTP server at http://" + WiFi.localIP().toString() + "/");
+
+    TaskHandle_t t1;
+    xTaskCreatePinnedToCore((void (*)(void *))webTask, "webTask", 8192, NULL, 10, &t1, 0);
+}
+
+
 void storeConfig()
 {
     StaticJsonDocument<1024> doc;
@@ -160,6 +266,14 @@ void storeConfig()
         {
             doc["OpenWeather"]["hemisphere"] = server.arg(i);
         }
+        else if (server.argName(i).equals("latitude"))
+        {
+            doc["OpenWeather"]["latitude"] = server.arg(i).toFloat();
+        }
+        else if (server.argName(i).equals("longitude"))
+        {
+            doc["OpenWeather"]["longitude"] = server.arg(i).toFloat();
+        }
         else if (server.argName(i).equals("units"))
         {
             doc["OpenWeather"]["units"] = server.arg(i);
@@ -180,6 +294,14 @@ void storeConfig()
         {
             doc["schedule_power"]["off_time"] = server.arg(i);
         }
+        else if (server.argName(i).equals("fonts"))
+        {
+            doc["display"]["fonts"] = server.arg(i);
+        }
+        else if (server.argName(i).equals("language"))
+        {
+            doc["Language"] = server.arg(i);
+        }
     }
 
     configfile = SPIFFS.open("/config.json", FILE_WRITE);
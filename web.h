@@ -3,12 +3,20 @@
 #ifndef WEB_H
 #define WEB_H
 
+#ifndef WEB_DEBUG_SERVER
+#define WEB_DEBUG_SERVER 0 // 1 = diagnostic pages served on the station IP on every wake, not only on the setup AP
+#endif
+#define WEB_DEBUG_WINDOW_MS 30000 // Time the station server stays reachable before each sleep
+
 void setupWEB(void);
+void setupDebugWEB(void);
 void setupAP(void);
 void handleRoot();
 void handleSettings();
 void handleConfig();
 void handleNotFound();
+void handleSnapshot();
+void handleFrameSnapshot();
 void storeConfig();
 void webTask(void *args);
 